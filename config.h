@@ -0,0 +1,272 @@
+/* config.h.  Generated from config.h.in by configure.  */
+/* config.h.in.  Generated from configure.ac by autoheader.  */
+
+/* Define if building universal (internal helper macro) */
+/* #undef AC_APPLE_UNIVERSAL_BUILD */
+
+/* Copyright year */
+#define COPYRIGHT_YEAR "2025"
+
+/* Define db-ip.com(MaxMindDB) database directory. */
+/* #undef DBIP2_DB */
+
+/* Define if bundled GETOPT should be used */
+/* #undef ENABLE_BUNDLED_GETOPT */
+
+/* Define if bundled MD5 should be used */
+#define ENABLE_BUNDLED_MD5 1
+
+/* Define if libmd MD5 should be used */
+/* #undef ENABLE_LIBMD_MD5 */
+
+/* Define if OpenSSL EVP MD5 should be used */
+/* #undef ENABLE_OPENSSL_EVP_MD5 */
+
+/* Define if OpenSSL legacy MD5 should be used */
+/* #undef ENABLE_OPENSSL_MD5 */
+
+/* Define external database directory. */
+/* #undef EXTERNAL_DB */
+
+/* Define GeoIP(MaxMindDB) database directory. */
+/* #undef GEOIP2_DB */
+
+/* Define if Berkeley DB support is required. */
+/* #undef HAVE_BERKELEY_DB_SUPPORT */
+
+/* Define to 1 if you have the declaration of 'API_VERSION', and to 0 if you
+   don't. */
+/* #undef HAVE_DECL_API_VERSION */
+
+/* Define to 1 if you have the declaration of
+   'IP2Location_api_version_string', and to 0 if you don't. */
+/* #undef HAVE_DECL_IP2LOCATION_API_VERSION_STRING */
+
+/* Define to 1 if you have the declaration of 'IP2Location_close', and to 0 if
+   you don't. */
+/* #undef HAVE_DECL_IP2LOCATION_CLOSE */
+
+/* Define to 1 if you have the declaration of 'IP2Location_get_country_long',
+   and to 0 if you don't. */
+/* #undef HAVE_DECL_IP2LOCATION_GET_COUNTRY_LONG */
+
+/* Define to 1 if you have the declaration of 'IP2Location_get_country_short',
+   and to 0 if you don't. */
+/* #undef HAVE_DECL_IP2LOCATION_GET_COUNTRY_SHORT */
+
+/* Define to 1 if you have the declaration of 'MMDB_lib_version', and to 0 if
+   you don't. */
+/* #undef HAVE_DECL_MMDB_LIB_VERSION */
+
+/* Define to 1 if you have the 'EVP_DigestFinal_ex' function. */
+/* #undef HAVE_EVP_DIGESTFINAL_EX */
+
+/* Define to 1 if you have the 'EVP_DigestInit_ex' function. */
+/* #undef HAVE_EVP_DIGESTINIT_EX */
+
+/* Define to 1 if you have the 'EVP_DigestUpdate' function. */
+/* #undef HAVE_EVP_DIGESTUPDATE */
+
+/* Define to 1 if you have the 'EVP_md5' function. */
+/* #undef HAVE_EVP_MD5 */
+
+/* Define to 1 if you have the 'EVP_MD_CTX_free' function. */
+/* #undef HAVE_EVP_MD_CTX_FREE */
+
+/* Define to 1 if you have the 'EVP_MD_CTX_init' function. */
+/* #undef HAVE_EVP_MD_CTX_INIT */
+
+/* Define to 1 if you have the 'EVP_MD_CTX_new' function. */
+/* #undef HAVE_EVP_MD_CTX_NEW */
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+#define HAVE_INTTYPES_H 1
+
+/* Define to 1 if you have the 'MD5Final' function. */
+/* #undef HAVE_MD5FINAL */
+
+/* Define to 1 if you have the 'MD5Init' function. */
+/* #undef HAVE_MD5INIT */
+
+/* Define to 1 if you have the 'MD5Update' function. */
+/* #undef HAVE_MD5UPDATE */
+
+/* Define to 1 if you have the 'MD5_Final' function. */
+/* #undef HAVE_MD5_FINAL */
+
+/* Define to 1 if you have the 'MD5_Init' function. */
+/* #undef HAVE_MD5_INIT */
+
+/* Define to 1 if you have the 'MD5_Update' function. */
+/* #undef HAVE_MD5_UPDATE */
+
+/* Define to 1 if you have the <stdint.h> header file. */
+#define HAVE_STDINT_H 1
+
+/* Define to 1 if you have the <stdio.h> header file. */
+#define HAVE_STDIO_H 1
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H 1
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define HAVE_STRINGS_H 1
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H 1
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define HAVE_SYS_STAT_H 1
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H 1
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H 1
+
+/* Define IP2Location(MaxMindDB) database directory. */
+/* #undef IP2LOCATION2_DB */
+
+/* Define IP2Location database directory. */
+/* #undef IP2LOCATION_DB */
+
+/* Define IP2Location dynamic library. */
+/* #undef IP2LOCATION_DYN_LIB */
+
+/* IP2Location include file version. */
+/* #undef IP2LOCATION_INCLUDE_VERSION */
+
+/* "API version Bugfix" */
+#define IPV6CALC_API_VERSION_BUGFIX 0  
+
+/* "API version Major" */
+#define IPV6CALC_API_VERSION_MAJOR 4   
+
+/* "API version Minor" */
+#define IPV6CALC_API_VERSION_MINOR 4   
+
+/* "API version numeric" */
+#define IPV6CALC_API_VERSION_NUMERIC 4004000 
+
+/* "API version as string" */
+#define IPV6CALC_API_VERSION_STRING "4.4.0"
+
+/* "Package version Bugfix" */
+#define IPV6CALC_PACKAGE_VERSION_BUGFIX 0  
+
+/* "Package version Major" */
+#define IPV6CALC_PACKAGE_VERSION_MAJOR 4   
+
+/* "Package version Minor" */
+#define IPV6CALC_PACKAGE_VERSION_MINOR 4   
+
+/* "Package version numeric" */
+#define IPV6CALC_PACKAGE_VERSION_NUMERIC 4004000 
+
+/* "Package version as string" */
+#define IPV6CALC_PACKAGE_VERSION_STRING "4.4.0"
+
+/* Define MaxMindDB database directory. */
+/* #undef MMDB_DB */
+
+/* Define MaxMindDB dynamic library. */
+/* #undef MMDB_DYN_LIB */
+
+/* MaxMindDB include file version. */
+/* #undef MMDB_INCLUDE_VERSION */
+
+/* Define to the address where bug reports for this package should be sent. */
+#define PACKAGE_BUGREPORT "ipv6calc@deepspace6.net"
+
+/* Define to the full name of this package. */
+#define PACKAGE_NAME "ipv6calc"
+
+/* Define to the full name and version of this package. */
+#define PACKAGE_STRING "ipv6calc 4.4.0"
+
+/* Define to the one symbol short name of this package. */
+#define PACKAGE_TARNAME "ipv6calc"
+
+/* Define to the home page for this package. */
+#define PACKAGE_URL "https://www.deepspace6.net/projects/ipv6calc.html"
+
+/* Define to the version of this package. */
+#define PACKAGE_VERSION "4.4.0"
+
+/* Define if you want ipv6calc binaries compiled with shared library
+   libipv6calc */
+/* #undef SHARED_LIBRARY */
+
+/* Define to 1 if all of the C89 standard headers exist (not just the ones
+   required in a freestanding environment). This macro is provided for
+   backward compatibility; new code need not use it. */
+#define STDC_HEADERS 1
+
+/* Define if you want general BuiltIn database included. */
+#define SUPPORT_BUILTIN 1
+
+/* Define if you want db-ip.com(MaxMindDB) support included. */
+/* #undef SUPPORT_DBIP2 */
+
+/* Define if you want AS-to-Registry database included. */
+#define SUPPORT_DB_AS_REG 1
+
+/* Define if you want CC-to-Registry database included. */
+#define SUPPORT_DB_CC_REG 1
+
+/* Define if you want IEEE database included. */
+#define SUPPORT_DB_IEEE 1
+
+/* Define if you want IPv4-to-Registry database included. */
+#define SUPPORT_DB_IPV4_REG 1
+
+/* Define if you want IPv6-to-Registry database included. */
+#define SUPPORT_DB_IPV6_REG 1
+
+/* Define if you want external support included. */
+/* #undef SUPPORT_EXTERNAL */
+
+/* Define if you want GeoIP(MaxMindDB) support. */
+/* #undef SUPPORT_GEOIP2 */
+
+/* Define if you want IP2Location(BIN) support. */
+/* #undef SUPPORT_IP2LOCATION */
+
+/* Define if you want IP2Location(MaxMindDB) support included. */
+/* #undef SUPPORT_IP2LOCATION2 */
+
+/* Define if you want IP2Location(BIN) support with dynamic loading support -
+   requires also additional linker options. */
+/* #undef SUPPORT_IP2LOCATION_DYN */
+
+/* Define if you want IP2Location(BIN) support statically linked - requires
+   also additional linker options. */
+/* #undef SUPPORT_IP2LOCATION_STATIC */
+
+/* Define if you want MaxMindDB support. */
+/* #undef SUPPORT_MMDB */
+
+/* Define if you want MaxMindDB support with dynamic loading support -
+   requires also additional linker options. */
+/* #undef SUPPORT_MMDB_DYN */
+
+/* Define WORDS_BIGENDIAN to 1 if your processor stores words with the most
+   significant byte first (like Motorola and SPARC, unlike Intel). */
+#if defined AC_APPLE_UNIVERSAL_BUILD
+# if defined __BIG_ENDIAN__
+#  define WORDS_BIGENDIAN 1
+# endif
+#else
+# ifndef WORDS_BIGENDIAN
+/* #  undef WORDS_BIGENDIAN */
+# endif
+#endif
+
+/* Define to empty if 'const' does not conform to ANSI C. */
+/* #undef const */
+
+/* Define to 'long int' if <sys/types.h> does not define. */
+/* #undef off_t */
+
+/* Define as 'unsigned int' if <stddef.h> doesn't define. */
+/* #undef size_t */
@@ -13,4580 +13,12105 @@
 
 
 static const s_ieee_iab libieee_iab[] = {
-	{ 0x0050C2, 0x000000, 0x000FFF, "T.L.S. Corp.", "T-L-S" },
-	{ 0x0050C2, 0x001000, 0x001FFF, "JMBS Developpements", "JMBS-DEVELOPPEMENTS" },
-	{ 0x0050C2, 0x002000, 0x002FFF, "Integrated Automation Solutions", "INTEGRATED-AUTOMATION-SOLUTIONS" },
-	{ 0x0050C2, 0x003000, 0x003FFF, "Microsoft", "MICROSOFT" },
-	{ 0x0050C2, 0x004000, 0x004FFF, "SCI Technology Inc.", "SCI" },
-	{ 0x0050C2, 0x005000, 0x005FFF, "GD California, Inc.", "GD-CALIFORNIA" },
-	{ 0x0050C2, 0x006000, 0x006FFF, "Project Management Enterprises, Inc.", "PROJECT-MANAGEMENT-ENTERPRISES" },
-	{ 0x0050C2, 0x007000, 0x007FFF, "Clive Green & Co. Ltd.", "CLIVE-GREEN" },
-	{ 0x0050C2, 0x008000, 0x008FFF, "Portable Add-Ons", "PORTABLE-ADD-ONS" },
-	{ 0x0050C2, 0x009000, 0x009FFF, "Datakinetics Ltd.", "DATAKINETICS" },
-	{ 0x0050C2, 0x00A000, 0x00AFFF, "Tharsys", "THARSYS" },
-	{ 0x0050C2, 0x00B000, 0x00BFFF, "IO Limited", "IO" },
-	{ 0x0050C2, 0x00C000, 0x00CFFF, "Vbrick Systems Inc.", "VBRICK" },
-	{ 0x0050C2, 0x00D000, 0x00DFFF, "Opus Telecom Inc.", "OPUS-TELECOM" },
-	{ 0x0050C2, 0x00E000, 0x00EFFF, "TTTech", "TTTECH" },
-	{ 0x0050C2, 0x00F000, 0x00FFFF, "XLN-t", "XLN-T" },
-	{ 0x0050C2, 0x010000, 0x010FFF, "Moisture Systems", "MOISTURE" },
-	{ 0x0050C2, 0x011000, 0x011FFF, "Bihl + Wiedemann GmbH", "BIHL-+-WIEDEMANN" },
-	{ 0x0050C2, 0x012000, 0x012FFF, "Floware System Solutions Ltd.", "FLOWARE-SYSTEM-SOLUTIONS" },
-	{ 0x0050C2, 0x013000, 0x013FFF, "Sensys Technologies Inc.", "SENSYS-TECHNOLOGIES" },
-	{ 0x0050C2, 0x014000, 0x014FFF, "Canal +", "CANAL" },
-	{ 0x0050C2, 0x015000, 0x015FFF, "LEROY AUTOMATION", "LEROY-AUTOMATION" },
-	{ 0x0050C2, 0x016000, 0x016FFF, "DSP Design Ltd.", "DSP-DESIGN" },
-	{ 0x0050C2, 0x017000, 0x017FFF, "Hunter Technology Inc.", "HUNTER" },
-	{ 0x0050C2, 0x018000, 0x018FFF, "CAD-UL GmbH", "CAD-UL" },
-	{ 0x0050C2, 0x019000, 0x019FFF, "Emtac Technology Corp.", "EMTAC" },
-	{ 0x0050C2, 0x01A000, 0x01AFFF, "Skylake Talix", "SKYLAKE-TALIX" },
-	{ 0x0050C2, 0x01B000, 0x01BFFF, "Cross Products Ltd.", "CROSS-PRODUCTS" },
-	{ 0x0050C2, 0x01C000, 0x01CFFF, "Tadiran Scopus", "TADIRAN-SCOPUS" },
-	{ 0x0050C2, 0x01D000, 0x01DFFF, "Princeton Gamma Tech", "PRINCETON-GAMMA-TECH" },
-	{ 0x0050C2, 0x01E000, 0x01EFFF, "CallTech International Limited", "CALLTECH" },
-	{ 0x0050C2, 0x01F000, 0x01FFFF, "KBS Industrieelektronik GmbH", "KBS-INDUSTRIEELEKTRONIK" },
-	{ 0x0050C2, 0x020000, 0x020FFF, "Icon Research Ltd.", "ICON-RESEARCH" },
-	{ 0x0050C2, 0x021000, 0x021FFF, "DRS Technologies Canada Co.", "DRS-TECHNOLOGIES-CANADA" },
-	{ 0x0050C2, 0x022000, 0x022FFF, "Ashling Microsystems Ltd.", "ASHLING-MICROSYSTEMS" },
-	{ 0x0050C2, 0x023000, 0x023FFF, "Zabacom, Inc.", "ZABACOM" },
-	{ 0x0050C2, 0x024000, 0x024FFF, "IPITEK", "IPITEK" },
-	{ 0x0050C2, 0x025000, 0x025FFF, "TERACOM TELEMATICA S.A", "TERACOM-TELEMATICA" },
-	{ 0x0050C2, 0x026000, 0x026FFF, "Abatis Systems Corp.", "ABATIS" },
-	{ 0x0050C2, 0x027000, 0x027FFF, "Industrial Control Links", "INDUSTRIAL-CONTROL-LINKS" },
-	{ 0x0050C2, 0x028000, 0x028FFF, "The Frensch Corporation (Pty) Ltd.", "THE-FRENSCH-PTY" },
-	{ 0x0050C2, 0x029000, 0x029FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x0050C2, 0x02A000, 0x02AFFF, "VersaLogic Corp.", "VERSALOGIC" },
-	{ 0x0050C2, 0x02B000, 0x02BFFF, "Nova Engineering Inc.", "NOVA-ENGINEERING" },
-	{ 0x0050C2, 0x02C000, 0x02CFFF, "Narrowband Telecommunications", "NARROWBAND-TELECOMMUNICATIONS" },
-	{ 0x0050C2, 0x02D000, 0x02DFFF, "Innocor LTD", "INNOCOR" },
-	{ 0x0050C2, 0x02E000, 0x02EFFF, "Turtle Mountain Corp", "TURTLE-MOUNTAIN" },
-	{ 0x0050C2, 0x02F000, 0x02FFFF, "Sinetica Corp", "SINETICA" },
-	{ 0x0050C2, 0x030000, 0x030FFF, "Lockheed Martin Tactical Defense Systems Eagan", "LOCKHEED-MARTIN-TACTICAL-DEFENSE-EAGAN" },
-	{ 0x0050C2, 0x031000, 0x031FFF, "Eloquence Ltd", "ELOQUENCE" },
-	{ 0x0050C2, 0x032000, 0x032FFF, "MotionIO", "MOTIONIO" },
-	{ 0x0050C2, 0x033000, 0x033FFF, "Doble Engineering", "DOBLE-ENGINEERING" },
-	{ 0x0050C2, 0x034000, 0x034FFF, "Ing. Buero W. Kanis GmbH", "ING-BUERO-W-KANIS" },
-	{ 0x0050C2, 0x035000, 0x035FFF, "Alliant Techsystems, Inc.", "ALLIANT-TECHSYSTEMS" },
-	{ 0x0050C2, 0x036000, 0x036FFF, "Arcturus Networks Inc.", "ARCTURUS-NETWORKS" },
-	{ 0x0050C2, 0x037000, 0x037FFF, "E.I.S.M.", "E-I-S-M" },
-	{ 0x0050C2, 0x038000, 0x038FFF, "Etheira Technologies", "ETHEIRA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x039000, 0x039FFF, "Apex Signal Corp", "APEX-SIGNAL" },
-	{ 0x0050C2, 0x03A000, 0x03AFFF, "PLLB Elettronica SPA", "PLLB-ELETTRONICA-SPA" },
-	{ 0x0050C2, 0x03B000, 0x03BFFF, "VNR Electronique SA", "VNR-ELECTRONIQUE" },
-	{ 0x0050C2, 0x03C000, 0x03CFFF, "BrainBoxes Ltd", "BRAINBOXES" },
-	{ 0x0050C2, 0x03D000, 0x03DFFF, "ISDN Gateway Technology AG", "ISDN-GATEWAY" },
-	{ 0x0050C2, 0x03E000, 0x03EFFF, "MSU UK Ltd", "MSU-UK" },
-	{ 0x0050C2, 0x03F000, 0x03FFFF, "Celotek Corp", "CELOTEK" },
-	{ 0x0050C2, 0x040000, 0x040FFF, "MiSPO Co., Ltd.", "MISPO" },
-	{ 0x0050C2, 0x041000, 0x041FFF, "Damler Chrysler Rail System (Signal) AB", "DAMLER-CHRYSLER-RAIL-SYSTEM-SIGNAL-AB" },
-	{ 0x0050C2, 0x042000, 0x042FFF, "B.E.A.R. Solutions (Australasia) Pty, Ltd", "B-E-A-R-SOLUTIONS-AUSTRALASIA-PTY" },
-	{ 0x0050C2, 0x043000, 0x043FFF, "Curtis, Inc.", "CURTIS" },
-	{ 0x0050C2, 0x044000, 0x044FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x045000, 0x045FFF, "Chase Manhattan Bank", "CHASE-MANHATTAN-BANK" },
-	{ 0x0050C2, 0x046000, 0x046FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x047000, 0x047FFF, "B. R. Electronics", "B-R-ELECTRONICS" },
-	{ 0x0050C2, 0x048000, 0x048FFF, "Cybectec Inc.", "CYBECTEC" },
-	{ 0x0050C2, 0x049000, 0x049FFF, "Computer Concepts Corp", "CONCEPTS" },
-	{ 0x0050C2, 0x04A000, 0x04AFFF, "Telecom Analysis Systems, LP", "TELECOM-ANALYSIS-LP" },
-	{ 0x0050C2, 0x04B000, 0x04BFFF, "Tecstar Demo Systems Division", "TECSTAR-DEMO-DIVISION" },
-	{ 0x0050C2, 0x04C000, 0x04CFFF, "New Standard Engineering NV", "NEW-STANDARD-ENGINEERING-NV" },
-	{ 0x0050C2, 0x04E000, 0x04EFFF, "Industrial Electronic Engineers, Inc.", "INDUSTRIAL-ENGINEERS" },
-	{ 0x0050C2, 0x04F000, 0x04FFFF, "Luma Corporation", "LUMA" },
-	{ 0x0050C2, 0x050000, 0x050FFF, "Dataprobe, Inc.", "DATAPROBE" },
-	{ 0x0050C2, 0x051000, 0x051FFF, "JSR Ultrasonics", "JSR-ULTRASONICS" },
-	{ 0x0050C2, 0x052000, 0x052FFF, "Mayo Foundation", "MAYO-FOUNDATION" },
-	{ 0x0050C2, 0x054000, 0x054FFF, "Optionexist Limited", "OPTIONEXIST" },
-	{ 0x0050C2, 0x055000, 0x055FFF, "San Castle Technologies, Inc.", "SAN-CASTLE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x056000, 0x056FFF, "Base 2", "BASE-2" },
-	{ 0x0050C2, 0x057000, 0x057FFF, "Lite F GmBH", "LITE-F" },
-	{ 0x0050C2, 0x058000, 0x058FFF, "Vision Research, Inc.", "VISION-RESEARCH" },
-	{ 0x0050C2, 0x059000, 0x059FFF, "Austco Marketing & Service (USA) ltd.", "AUSTCO-MARKETING-SERVICE-USA" },
-	{ 0x0050C2, 0x05A000, 0x05AFFF, "Sonifex Ltd", "SONIFEX" },
-	{ 0x0050C2, 0x05B000, 0x05BFFF, "Radiometer Medical A/S", "RADIOMETER-MEDICAL-A/S" },
-	{ 0x0050C2, 0x05C000, 0x05CFFF, "Nortel Networks PLC (UK)", "NORTEL-NETWORKS-PLC-UK" },
-	{ 0x0050C2, 0x05D000, 0x05DFFF, "Ignitus Communications, LLC", "IGNITUS-COMMUNICATION" },
-	{ 0x0050C2, 0x05E000, 0x05EFFF, "DIVA Systems", "DIVA" },
-	{ 0x0050C2, 0x05F000, 0x05FFFF, "Malden Electronics Ltd", "MALDEN-ELECTRONICS" },
-	{ 0x0050C2, 0x060000, 0x060FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x061000, 0x061FFF, "Simple Network Magic Corporation", "SIMPLE-NETWORK-MAGIC" },
-	{ 0x0050C2, 0x062000, 0x062FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x063000, 0x063FFF, "Ticketmaster Corp", "TICKETMASTER" },
-	{ 0x0050C2, 0x064000, 0x064FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x065000, 0x065FFF, "Clever Devices", "CLEVER-DEVICES" },
-	{ 0x0050C2, 0x066000, 0x066FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x067000, 0x067FFF, "Riverlink Computers, Ltd.", "RIVERLINK-COMPUTERS" },
-	{ 0x0050C2, 0x068000, 0x068FFF, "Seabridge", "SEABRIDGE" },
-	{ 0x0050C2, 0x069000, 0x069FFF, "EC Elettronica S.R.L.", "EC-ELETTRONICA" },
-	{ 0x0050C2, 0x06A000, 0x06AFFF, "Unimark", "UNIMARK" },
-	{ 0x0050C2, 0x06B000, 0x06BFFF, "NCast Corporation", "NCAST" },
-	{ 0x0050C2, 0x06C000, 0x06CFFF, "WaveCom Electronics, Inc.", "WAVECOM-ELECTRONICS" },
-	{ 0x0050C2, 0x06D000, 0x06DFFF, "Advanced Signal Corp.", "ADVANCED-SIGNAL" },
-	{ 0x0050C2, 0x06E000, 0x06EFFF, "Avtron Manufacturing Inc.", "AVTRON-MANUFACTURING" },
-	{ 0x0050C2, 0x06F000, 0x06FFFF, "Digital Services Group", "DIGITAL-SERVICES-GROUP" },
-	{ 0x0050C2, 0x070000, 0x070FFF, "Katchall Technologies Group", "KATCHALL-TECHNOLOGIES-GROUP" },
-	{ 0x0050C2, 0x071000, 0x071FFF, "NetVision Telecom", "NETVISION-TELECOM" },
-	{ 0x0050C2, 0x072000, 0x072FFF, "Neuberger Gebaeudeautomation GmbH & Co.", "NEUBERGER-GEBAEUDEAUTOMATION" },
-	{ 0x0050C2, 0x073000, 0x073FFF, "Alstom Signalling Ltd.", "ALSTOM-SIGNALLING" },
-	{ 0x0050C2, 0x074000, 0x074FFF, "Edge Tech Co., Ltd.", "EDGE-TECH" },
-	{ 0x0050C2, 0x075000, 0x075FFF, "ENTTEC Pty Ltd.", "ENTTEC-PTY" },
-	{ 0x0050C2, 0x076000, 0x076FFF, "Litton Guidance & Control Systems", "LITTON-GUIDANCE-CONTROL" },
-	{ 0x0050C2, 0x077000, 0x077FFF, "Saco Smartvision Inc.", "SACO-SMARTVISION" },
-	{ 0x0050C2, 0x078000, 0x078FFF, "Reselec AG", "RESELEC" },
-	{ 0x0050C2, 0x079000, 0x079FFF, "Flextel S.p.A", "FLEXTEL" },
-	{ 0x0050C2, 0x07A000, 0x07AFFF, "RadioTel", "RADIOTEL" },
-	{ 0x0050C2, 0x07B000, 0x07BFFF, "Trikon Technologies Ltd.", "TRIKON-TECHNOLOGIES" },
-	{ 0x0050C2, 0x07C000, 0x07CFFF, "PLLB elettronica spa", "PLLB-ELETTRONICA-SPA" },
-	{ 0x0050C2, 0x07D000, 0x07DFFF, "Caspian Networks", "CASPIAN-NETWORKS" },
-	{ 0x0050C2, 0x07E000, 0x07EFFF, "JL-teknik", "JL-TEKNIK" },
-	{ 0x0050C2, 0x07F000, 0x07FFFF, "Dunti Corporation", "DUNTI" },
-	{ 0x0050C2, 0x080000, 0x080FFF, "AIM", "AIM" },
-	{ 0x0050C2, 0x081000, 0x081FFF, "Matuschek Messtechnik GmbH", "MATUSCHEK-MESSTECHNIK" },
-	{ 0x0050C2, 0x082000, 0x082FFF, "GFI Chrono Time", "GFI-CHRONO-TIME" },
-	{ 0x0050C2, 0x083000, 0x083FFF, "ard sa", "ARD" },
-	{ 0x0050C2, 0x084000, 0x084FFF, "DIALOG4 System Engineering GmbH", "DIALOG4-SYSTEM-ENGINEERING" },
-	{ 0x0050C2, 0x085000, 0x085FFF, "Crossport Systems", "CROSSPORT" },
-	{ 0x0050C2, 0x086000, 0x086FFF, "Validyne Engineering Corp.", "VALIDYNE-ENGINEERING" },
-	{ 0x0050C2, 0x087000, 0x087FFF, "Monitor Business Machines Ltd.", "MONITOR-BUSINESS-MACHINES" },
-	{ 0x0050C2, 0x088000, 0x088FFF, "TELINC Corporation", "TELINC" },
-	{ 0x0050C2, 0x089000, 0x089FFF, "Fenwal Italia S.P.A.", "FENWAL-ITALIA" },
-	{ 0x0050C2, 0x08A000, 0x08AFFF, "Rising Edge Technologies", "RISING-EDGE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x08B000, 0x08BFFF, "HYPERCHIP Inc.", "HYPERCHIP" },
-	{ 0x0050C2, 0x08C000, 0x08CFFF, "IP Unity", "IP-UNITY" },
-	{ 0x0050C2, 0x08D000, 0x08DFFF, "Kylink Communications Corp.", "KYLINK-COMMUNICATION" },
-	{ 0x0050C2, 0x08E000, 0x08EFFF, "BSQUARE", "BSQUARE" },
-	{ 0x0050C2, 0x08F000, 0x08FFFF, "General Industries Argentina", "GENERAL-INDUSTRIES-ARGENTINA" },
-	{ 0x0050C2, 0x090000, 0x090FFF, "Invensys Controls Network Systems", "INVENSYS-CONTROLS-NETWORK" },
-	{ 0x0050C2, 0x091000, 0x091FFF, "StorLogic, Inc.", "STORLOGIC" },
-	{ 0x0050C2, 0x092000, 0x092FFF, "DigitAll World Co., Ltd", "DIGITALL-WORLD" },
-	{ 0x0050C2, 0x093000, 0x093FFF, "KOREALINK", "KOREALINK" },
-	{ 0x0050C2, 0x094000, 0x094FFF, "Analytical Spectral Devices, Inc.", "ANALYTICAL-SPECTRAL-DEVICES" },
-	{ 0x0050C2, 0x095000, 0x095FFF, "SEATECH", "SEATECH" },
-	{ 0x0050C2, 0x096000, 0x096FFF, "Utronix Elektronikutreckling AB", "UTRONIX-ELEKTRONIKUTRECKLING-AB" },
-	{ 0x0050C2, 0x097000, 0x097FFF, "IMV Invertomatic", "IMV-INVERTOMATIC" },
-	{ 0x0050C2, 0x098000, 0x098FFF, "EPEL Industrial, S.A.", "EPEL-INDUSTRIAL" },
-	{ 0x0050C2, 0x099000, 0x099FFF, "Case Information & Communications", "CASE-INFORMATION-COMMUNICATION" },
-	{ 0x0050C2, 0x09A000, 0x09AFFF, "NBO Development Center Sekusui Chemical Co. Ltd.", "NBO-DEVELOPMENT-CENTER-SEKUSUI-CHEMICAL" },
-	{ 0x0050C2, 0x09B000, 0x09BFFF, "Seffle Instrument AB", "SEFFLE-INSTRUMENT-AB" },
-	{ 0x0050C2, 0x09C000, 0x09CFFF, "RF Applications, Inc.", "RF-APPLICATIONS" },
-	{ 0x0050C2, 0x09D000, 0x09DFFF, "ZELPOS", "ZELPOS" },
-	{ 0x0050C2, 0x09E000, 0x09EFFF, "Infinitec Networks, Inc.", "INFINITEC-NETWORKS" },
-	{ 0x0050C2, 0x09F000, 0x09FFFF, "MetaWave Vedeo Systems", "METAWAVE-VEDEO" },
-	{ 0x0050C2, 0x0A0000, 0x0A0FFF, "CYNAPS", "CYNAPS" },
-	{ 0x0050C2, 0x0A1000, 0x0A1FFF, "Visable Genetics, Inc.", "VISABLE-GENETICS" },
-	{ 0x0050C2, 0x0A2000, 0x0A2FFF, "Jäger Computergesteuerte Meßtechnik GmbH.", "JAEGER-COMPUTERGESTEUERTE-MESSTECHNIK" },
-	{ 0x0050C2, 0x0A3000, 0x0A3FFF, "BaSyTec GmbH", "BASYTEC" },
-	{ 0x0050C2, 0x0A4000, 0x0A4FFF, "Bounty Systems Pty Ltd.", "BOUNTY-PTY" },
-	{ 0x0050C2, 0x0A5000, 0x0A5FFF, "Mobiltex Data Ltd.", "MOBILTEX-DATA" },
-	{ 0x0050C2, 0x0A6000, 0x0A6FFF, "Arula Systems, Inc.", "ARULA" },
-	{ 0x0050C2, 0x0A7000, 0x0A7FFF, "WaterCove Networks", "WATERCOVE-NETWORKS" },
-	{ 0x0050C2, 0x0A8000, 0x0A8FFF, "Kaveri Networks", "KAVERI-NETWORKS" },
-	{ 0x0050C2, 0x0A9000, 0x0A9FFF, "Radiant Networks Plc", "RADIANT-NETWORKS-PLC" },
-	{ 0x0050C2, 0x0AA000, 0x0AAFFF, "Log-In, Inc.", "LOG-IN" },
-	{ 0x0050C2, 0x0AB000, 0x0ABFFF, "Fastware.Net, LLC", "FASTWARE-NET" },
-	{ 0x0050C2, 0x0AC000, 0x0ACFFF, "Honeywell GNO", "HONEYWELL-GNO" },
-	{ 0x0050C2, 0x0AD000, 0x0ADFFF, "BMC Messsysteme GmbH", "BMC-MESSSYSTEME" },
-	{ 0x0050C2, 0x0AE000, 0x0AEFFF, "Zarak Systems Corp.", "ZARAK" },
-	{ 0x0050C2, 0x0AF000, 0x0AFFFF, "Latus Lightworks, Inc.", "LATUS-LIGHTWORKS" },
-	{ 0x0050C2, 0x0B0000, 0x0B0FFF, "LMI Technologies", "LMI-TECHNOLOGIES" },
-	{ 0x0050C2, 0x0B1000, 0x0B1FFF, "Beeline Networks, Inc.", "BEELINE-NETWORKS" },
-	{ 0x0050C2, 0x0B2000, 0x0B2FFF, "R F Micro Devices", "R-F-MICRO-DEVICES" },
-	{ 0x0050C2, 0x0B3000, 0x0B3FFF, "SMX Corporation", "SMX" },
-	{ 0x0050C2, 0x0B4000, 0x0B4FFF, "Wavefly Corporation", "WAVEFLY" },
-	{ 0x0050C2, 0x0B5000, 0x0B5FFF, "EXTREME COPPER,  INC.", "EXTREME-COPPER" },
-	{ 0x0050C2, 0x0B6000, 0x0B6FFF, "ApSecure Technologies (Canada), Inc.", "APSECURE-TECHNOLOGIES-CANADA" },
-	{ 0x0050C2, 0x0B7000, 0x0B7FFF, "RYMIC", "RYMIC" },
-	{ 0x0050C2, 0x0B8000, 0x0B8FFF, "LAN Controls, Inc.", "LAN-CONTROLS" },
-	{ 0x0050C2, 0x0B9000, 0x0B9FFF, "Helmut Mauell GmbH Werk Weida", "HELMUT-MAUELL-WERK-WEIDA" },
-	{ 0x0050C2, 0x0BA000, 0x0BAFFF, "Pro-Active", "PRO-ACTIVE" },
-	{ 0x0050C2, 0x0BB000, 0x0BBFFF, "MAZet GmbH", "MAZET" },
-	{ 0x0050C2, 0x0BC000, 0x0BCFFF, "Infolink Software AG", "INFOLINK-SOFTWARE" },
-	{ 0x0050C2, 0x0BD000, 0x0BDFFF, "Tattile", "TATTILE" },
-	{ 0x0050C2, 0x0BE000, 0x0BEFFF, "Stella Electronics & Tagging", "STELLA-ELECTRONICS-TAGGING" },
-	{ 0x0050C2, 0x0BF000, 0x0BFFFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x0C0000, 0x0C0FFF, "Imigix Ltd.", "IMIGIX" },
-	{ 0x0050C2, 0x0C1000, 0x0C1FFF, "Casabyte", "CASABYTE" },
-	{ 0x0050C2, 0x0C2000, 0x0C2FFF, "Alchemy Semiconductor, Inc.", "ALCHEMY-SEMICONDUCTOR" },
-	{ 0x0050C2, 0x0C3000, 0x0C3FFF, "Tonbu, Inc.", "TONBU" },
-	{ 0x0050C2, 0x0C4000, 0x0C4FFF, "InterEpoch Technology,INC.", "INTEREPOCH" },
-	{ 0x0050C2, 0x0C5000, 0x0C5FFF, "SAIA Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x0C6000, 0x0C6FFF, "Advanced Medical Information Technologies, Inc.", "ADVANCED-MEDICAL-INFORMATION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x0C7000, 0x0C7FFF, "TransComm Technology System, Inc.", "TRANSCOMM-SYSTEM" },
-	{ 0x0050C2, 0x0C8000, 0x0C8FFF, "The Trane Company", "THE-TRANE-COMPANY" },
-	{ 0x0050C2, 0x0C9000, 0x0C9FFF, "DSS Networks, Inc.", "DSS-NETWORKS" },
-	{ 0x0050C2, 0x0CA000, 0x0CAFFF, "J D Richards", "J-D-RICHARDS" },
-	{ 0x0050C2, 0x0CB000, 0x0CBFFF, "STUDIEL", "STUDIEL" },
-	{ 0x0050C2, 0x0CC000, 0x0CCFFF, "AlphaMedia Co., Ltd", "ALPHAMEDIA" },
-	{ 0x0050C2, 0x0CD000, 0x0CDFFF, "LINET OY", "LINET-OY" },
-	{ 0x0050C2, 0x0CE000, 0x0CEFFF, "RFL Electronics, Inc.", "RFL-ELECTRONICS" },
-	{ 0x0050C2, 0x0CF000, 0x0CFFFF, "PCSC", "PCSC" },
-	{ 0x0050C2, 0x0D0000, 0x0D0FFF, "Telefrang AB", "TELEFRANG-AB" },
-	{ 0x0050C2, 0x0D1000, 0x0D1FFF, "Renaissance Networking, Inc.", "RENAISSANCE-NETWORKING" },
-	{ 0x0050C2, 0x0D2000, 0x0D2FFF, "Real World Computing Partnership", "REAL-WORLD-COMPUTING-PARTNERSHIP" },
-	{ 0x0050C2, 0x0D3000, 0x0D3FFF, "Lake Technology, Ltd.", "LAKE" },
-	{ 0x0050C2, 0x0D4000, 0x0D4FFF, "Palm, Inc.", "PALM" },
-	{ 0x0050C2, 0x0D5000, 0x0D5FFF, "Zelax", "ZELAX" },
-	{ 0x0050C2, 0x0D6000, 0x0D6FFF, "Inco Startec GmbH", "INCO-STARTEC" },
-	{ 0x0050C2, 0x0D7000, 0x0D7FFF, "Summit Avionics, Inc.", "SUMMIT-AVIONICS" },
-	{ 0x0050C2, 0x0D8000, 0x0D8FFF, "Charlotte's Web Networks", "CHARLOTTE-S-WEB-NETWORKS" },
-	{ 0x0050C2, 0x0D9000, 0x0D9FFF, "Loewe Opta GmbH", "LOEWE-OPTA" },
-	{ 0x0050C2, 0x0DA000, 0x0DAFFF, "Motion Analysis Corp.", "MOTION-ANALYSIS" },
-	{ 0x0050C2, 0x0DB000, 0x0DBFFF, "Cyberex", "CYBEREX" },
-	{ 0x0050C2, 0x0DC000, 0x0DCFFF, "Elbit Systems Ltd.", "ELBIT" },
-	{ 0x0050C2, 0x0DD000, 0x0DDFFF, "Interisa Electronica, S.A.", "INTERISA-ELECTRONICA" },
-	{ 0x0050C2, 0x0DE000, 0x0DEFFF, "Frederick Engineering", "FREDERICK-ENGINEERING" },
-	{ 0x0050C2, 0x0DF000, 0x0DFFFF, "Innovation Institute, Inc.", "INNOVATION-INSTITUTE" },
-	{ 0x0050C2, 0x0E0000, 0x0E0FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x0050C2, 0x0E1000, 0x0E1FFF, "Inspiration Technology P/L", "INSPIRATION-P/L" },
-	{ 0x0050C2, 0x0E2000, 0x0E2FFF, "Visual Circuits Corp.", "VISUAL-CIRCUITS" },
-	{ 0x0050C2, 0x0E3000, 0x0E3FFF, "Lanex S.A.", "LANEX" },
-	{ 0x0050C2, 0x0E4000, 0x0E4FFF, "Collabo Tec. Co., Ltd.", "COLLABO-TEC" },
-	{ 0x0050C2, 0x0E5000, 0x0E5FFF, "Clearwater Networks", "CLEARWATER-NETWORKS" },
-	{ 0x0050C2, 0x0E6000, 0x0E6FFF, "RouteFree, Inc.", "ROUTEFREE" },
-	{ 0x0050C2, 0x0E7000, 0x0E7FFF, "Century Geophysical Corp.", "CENTURY-GEOPHYSICAL" },
-	{ 0x0050C2, 0x0E8000, 0x0E8FFF, "Audio Design Associates, Inc.", "AUDIO-DESIGN-ASSOCIATES" },
-	{ 0x0050C2, 0x0E9000, 0x0E9FFF, "Smartmedia LLC", "SMARTMEDIA" },
-	{ 0x0050C2, 0x0EA000, 0x0EAFFF, "iReady Corporation", "IREADY" },
-	{ 0x0050C2, 0x0EB000, 0x0EBFFF, "iREZ Technologies LLC", "IREZ-TECHNOLOGIES" },
-	{ 0x0050C2, 0x0EC000, 0x0ECFFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x0ED000, 0x0EDFFF, "Valley Products Corporation", "VALLEY-PRODUCTS" },
-	{ 0x0050C2, 0x0EE000, 0x0EEFFF, "Industrial Indexing Systems, Inc.", "INDUSTRIAL-INDEXING" },
-	{ 0x0050C2, 0x0EF000, 0x0EFFFF, "Movaz Networks, Inc.", "MOVAZ-NETWORKS" },
-	{ 0x0050C2, 0x0F0000, 0x0F0FFF, "VHB Technologies, Inc.", "VHB-TECHNOLOGIES" },
-	{ 0x0050C2, 0x0F1000, 0x0F1FFF, "Steelcase Inc.", "STEELCASE" },
-	{ 0x0050C2, 0x0F2000, 0x0F2FFF, "KMS Systems, Inc.", "KMS" },
-	{ 0x0050C2, 0x0F3000, 0x0F3FFF, "Young Computer Co., Ltd.", "YOUNG" },
-	{ 0x0050C2, 0x0F4000, 0x0F4FFF, "Sysnet Co., Ltd.", "SYSNET" },
-	{ 0x0050C2, 0x0F5000, 0x0F5FFF, "Spectra Technologies Holding Co., Ltd.", "SPECTRA-TECHNOLOGIES-HOLDING" },
-	{ 0x0050C2, 0x0F6000, 0x0F6FFF, "Carl Baasel Lasertechnik GmbH", "CARL-BAASEL-LASERTECHNIK" },
-	{ 0x0050C2, 0x0F7000, 0x0F7FFF, "Foss NIRSystems, Inc.", "FOSS-NIRSYSTEMS" },
-	{ 0x0050C2, 0x0F8000, 0x0F8FFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
-	{ 0x0050C2, 0x0F9000, 0x0F9FFF, "Raven Industries Inc.", "RAVEN-INDUSTRIES" },
-	{ 0x0050C2, 0x0FA000, 0x0FAFFF, "GE Transportation Systems", "GE-TRANSPORTATION" },
-	{ 0x0050C2, 0x0FB000, 0x0FBFFF, "PIUSYS Co., Ltd.", "PIUSYS" },
-	{ 0x0050C2, 0x0FC000, 0x0FCFFF, "Kimmon Manufacturing Co., Ltd.", "KIMMON-MANUFACTURING" },
-	{ 0x0050C2, 0x0FD000, 0x0FDFFF, "Inducomp Corporation", "INDUCOMP" },
-	{ 0x0050C2, 0x0FE000, 0x0FEFFF, "Energy ICT", "ENERGY-ICT" },
-	{ 0x0050C2, 0x0FF000, 0x0FFFFF, "IPAXS Corporation", "IPAXS" },
-	{ 0x0050C2, 0x100000, 0x100FFF, "Corelatus A.B.", "CORELATUS-A-B" },
-	{ 0x0050C2, 0x101000, 0x101FFF, "LAUD Electronic Design AS", "LAUD-DESIGN-AS" },
-	{ 0x0050C2, 0x102000, 0x102FFF, "Million Tech Development Ltd.", "MILLION-TECH-DEVELOPMENT" },
-	{ 0x0050C2, 0x103000, 0x103FFF, "Green Hills Software, Inc.", "GREEN-HILLS-SOFTWARE" },
-	{ 0x0050C2, 0x104000, 0x104FFF, "Adescom Inc.", "ADESCOM" },
-	{ 0x0050C2, 0x105000, 0x105FFF, "Lumentis AB", "LUMENTIS-AB" },
-	{ 0x0050C2, 0x106000, 0x106FFF, "MATSUOKA", "MATSUOKA" },
-	{ 0x0050C2, 0x107000, 0x107FFF, "NewHer Systems", "NEWHER" },
-	{ 0x0050C2, 0x108000, 0x108FFF, "Balogh S.A.", "BALOGH" },
-	{ 0x0050C2, 0x109000, 0x109FFF, "ITK Dr. Kassen GmbH", "ITK-DR-KASSEN" },
-	{ 0x0050C2, 0x10A000, 0x10AFFF, "Quinx AG", "QUINX" },
-	{ 0x0050C2, 0x10B000, 0x10BFFF, "MarekMicro GmbH", "MAREKMICRO" },
-	{ 0x0050C2, 0x10C000, 0x10CFFF, "Photonic Bridges, Inc.", "PHOTONIC-BRIDGES" },
-	{ 0x0050C2, 0x10D000, 0x10DFFF, "Implementa GmbH", "IMPLEMENTA" },
-	{ 0x0050C2, 0x10E000, 0x10EFFF, "Unipower AB", "UNIPOWER-AB" },
-	{ 0x0050C2, 0x10F000, 0x10FFFF, "Perceptics Corp.", "PERCEPTICS" },
-	{ 0x0050C2, 0x110000, 0x110FFF, "QuesCom", "QUESCOM" },
-	{ 0x0050C2, 0x111000, 0x111FFF, "Endusis Limited", "ENDUSIS" },
-	{ 0x0050C2, 0x112000, 0x112FFF, "Compuworx", "COMPUWORX" },
-	{ 0x0050C2, 0x113000, 0x113FFF, "Ace Electronics, Inc.", "ACE-ELECTRONICS" },
-	{ 0x0050C2, 0x114000, 0x114FFF, "Quest Innovations", "QUEST-INNOVATIONS" },
-	{ 0x0050C2, 0x115000, 0x115FFF, "Vidco, Inc.", "VIDCO" },
-	{ 0x0050C2, 0x116000, 0x116FFF, "DSP Design, Ltd.", "DSP-DESIGN" },
-	{ 0x0050C2, 0x117000, 0x117FFF, "Wintegra Ltd.", "WINTEGRA" },
-	{ 0x0050C2, 0x118000, 0x118FFF, "Microbit 2.0 AB", "MICROBIT-2-0-AB" },
-	{ 0x0050C2, 0x119000, 0x119FFF, "Global Opto Communication Tech. Corp", "GLOBAL-OPTO-COMMUNICATION-TECH" },
-	{ 0x0050C2, 0x11A000, 0x11AFFF, "Teamaxess Ticketing GmbH", "TEAMAXESS-TICKETING" },
-	{ 0x0050C2, 0x11B000, 0x11BFFF, "Digital Vision AB", "DIGITAL-VISION-AB" },
-	{ 0x0050C2, 0x11C000, 0x11CFFF, "Stonefly Networks", "STONEFLY-NETWORKS" },
-	{ 0x0050C2, 0x11D000, 0x11DFFF, "Destiny Networks, Inc.", "DESTINY-NETWORKS" },
-	{ 0x0050C2, 0x11E000, 0x11EFFF, "Volvo Car Corporation", "VOLVO-CAR" },
-	{ 0x0050C2, 0x11F000, 0x11FFFF, "CSS Industrie Computer GmbH", "CSS-INDUSTRIE" },
-	{ 0x0050C2, 0x120000, 0x120FFF, "XStore, Inc.", "XSTORE" },
-	{ 0x0050C2, 0x121000, 0x121FFF, "COE Limited", "COE" },
-	{ 0x0050C2, 0x122000, 0x122FFF, "Diva Systems", "DIVA" },
-	{ 0x0050C2, 0x123000, 0x123FFF, "Seranoa Networks, Inc.", "SERANOA-NETWORKS" },
-	{ 0x0050C2, 0x124000, 0x124FFF, "Tokai Soft Corporation", "TOKAI-SOFT" },
-	{ 0x0050C2, 0x125000, 0x125FFF, "Tecwings GmBh", "TECWINGS" },
-	{ 0x0050C2, 0x126000, 0x126FFF, "MaxLinear Hispania S.L.U.", "MAXLINEAR-HISPANIA-S-L-U" },
-	{ 0x0050C2, 0x127000, 0x127FFF, "TPA Traffic & Parking Automation BV", "TPA-TRAFFIC-PARKING-AUTOMATION" },
-	{ 0x0050C2, 0x128000, 0x128FFF, "Pycon, Inc.", "PYCON" },
-	{ 0x0050C2, 0x129000, 0x129FFF, "TTPCom Ltd.", "TTPCOM" },
-	{ 0x0050C2, 0x12A000, 0x12AFFF, "Symbolic Sound Corp.", "SYMBOLIC-SOUND" },
-	{ 0x0050C2, 0x12B000, 0x12BFFF, "Dong A Eltek Co., Ltd.", "DONG-A-ELTEK" },
-	{ 0x0050C2, 0x12C000, 0x12CFFF, "DELTA TAU DATA SYSTEMS, INC.", "DELTA-TAU-DATA" },
-	{ 0x0050C2, 0x12D000, 0x12DFFF, "Megisto Systems, Inc.", "MEGISTO" },
-	{ 0x0050C2, 0x12E000, 0x12EFFF, "RUNCOM", "RUNCOM" },
-	{ 0x0050C2, 0x12F000, 0x12FFFF, "Haag-Streit AG", "HAAG-STREIT" },
-	{ 0x0050C2, 0x130000, 0x130FFF, "U.S. Traffic Corporation", "U-S-TRAFFIC" },
-	{ 0x0050C2, 0x131000, 0x131FFF, "InBus Engineering, Inc.", "INBUS-ENGINEERING" },
-	{ 0x0050C2, 0x132000, 0x132FFF, "Procon Electronics", "PROCON-ELECTRONICS" },
-	{ 0x0050C2, 0x133000, 0x133FFF, "ChipWrights, Inc.", "CHIPWRIGHTS" },
-	{ 0x0050C2, 0x134000, 0x134FFF, "DRS Photronics", "DRS-PHOTRONICS" },
-	{ 0x0050C2, 0x135000, 0x135FFF, "ELAD SRL", "ELAD-SRL" },
-	{ 0x0050C2, 0x136000, 0x136FFF, "Tensilica, Inc.", "TENSILICA" },
-	{ 0x0050C2, 0x137000, 0x137FFF, "Uniwell Systems (UK) Ltd.", "UNIWELL-UK" },
-	{ 0x0050C2, 0x138000, 0x138FFF, "Delphin Technology AG", "DELPHIN" },
-	{ 0x0050C2, 0x139000, 0x139FFF, "SR RESEARCH LTD", "SR-RESEARCH" },
-	{ 0x0050C2, 0x13A000, 0x13AFFF, "Tex Computer SRL", "TEX-SRL" },
-	{ 0x0050C2, 0x13B000, 0x13BFFF, "Vaisala Oyj", "VAISALA-OYJ" },
-	{ 0x0050C2, 0x13C000, 0x13CFFF, "NBG Industrial Automation B.V.", "NBG-INDUSTRIAL-AUTOMATION-B-V" },
-	{ 0x0050C2, 0x13D000, 0x13DFFF, "Formula One Management Ltd.", "FORMULA-ONE-MANAGEMENT" },
-	{ 0x0050C2, 0x13E000, 0x13EFFF, "AVerMedia Systems, Inc.", "AVERMEDIA" },
-	{ 0x0050C2, 0x13F000, 0x13FFFF, "Sentito Networks", "SENTITO-NETWORKS" },
-	{ 0x0050C2, 0x140000, 0x140FFF, "ITS, Inc.", "ITS" },
-	{ 0x0050C2, 0x141000, 0x141FFF, "Time Terminal Adductor Group AB", "TIME-TERMINAL-ADDUCTOR-GROUP-AB" },
-	{ 0x0050C2, 0x142000, 0x142FFF, "Instrumeter A/S", "INSTRUMETER-A/S" },
-	{ 0x0050C2, 0x143000, 0x143FFF, "AARTESYS AG", "AARTESYS" },
-	{ 0x0050C2, 0x144000, 0x144FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x145000, 0x145FFF, "ELC Lighting", "ELC-LIGHTING" },
-	{ 0x0050C2, 0x146000, 0x146FFF, "APCON, Inc.", "APCON" },
-	{ 0x0050C2, 0x147000, 0x147FFF, "UniSUR", "UNISUR" },
-	{ 0x0050C2, 0x148000, 0x148FFF, "Alltec GmbH", "ALLTEC" },
-	{ 0x0050C2, 0x149000, 0x149FFF, "Haag-Streit AG", "HAAG-STREIT" },
-	{ 0x0050C2, 0x14A000, 0x14AFFF, "DYCEC, S.A.", "DYCEC" },
-	{ 0x0050C2, 0x14B000, 0x14BFFF, "HECUBA Elektronik", "HECUBA-ELEKTRONIK" },
-	{ 0x0050C2, 0x14C000, 0x14CFFF, "Optibase Ltd.", "OPTIBASE" },
-	{ 0x0050C2, 0x14D000, 0x14DFFF, "wellink, Ltd.", "WELLINK" },
-	{ 0x0050C2, 0x14E000, 0x14EFFF, "Corinex Global", "CORINEX-GLOBAL" },
-	{ 0x0050C2, 0x14F000, 0x14FFFF, "Telephonics Corp.", "TELEPHONICS" },
-	{ 0x0050C2, 0x150000, 0x150FFF, "Torse", "TORSE" },
-	{ 0x0050C2, 0x151000, 0x151FFF, "Redux Communications Ltd.", "REDUX-COMMUNICATION" },
-	{ 0x0050C2, 0x152000, 0x152FFF, "AirVast Technology Inc.", "AIRVAST" },
-	{ 0x0050C2, 0x153000, 0x153FFF, "Advanced Devices SpA", "ADVANCED-DEVICES-SPA" },
-	{ 0x0050C2, 0x154000, 0x154FFF, "Jostra AB", "JOSTRA-AB" },
-	{ 0x0050C2, 0x155000, 0x155FFF, "Enea Real Time AB", "ENEA-REAL-TIME-AB" },
-	{ 0x0050C2, 0x156000, 0x156FFF, "CommServ Solutions Inc.", "COMMSERV-SOLUTIONS" },
-	{ 0x0050C2, 0x157000, 0x157FFF, "nCore, Inc.", "NCORE" },
-	{ 0x0050C2, 0x158000, 0x158FFF, "Communication Solutions, Inc.", "COMMUNICATION-SOLUTIONS" },
-	{ 0x0050C2, 0x159000, 0x159FFF, "Standard Comm. Corp.", "STANDARD-COMM" },
-	{ 0x0050C2, 0x15A000, 0x15AFFF, "Plextek Limited", "PLEXTEK" },
-	{ 0x0050C2, 0x15B000, 0x15BFFF, "Dune Networks", "DUNE-NETWORKS" },
-	{ 0x0050C2, 0x15C000, 0x15CFFF, "Aoptix Technologies", "AOPTIX-TECHNOLOGIES" },
-	{ 0x0050C2, 0x15D000, 0x15DFFF, "Cepheid", "CEPHEID" },
-	{ 0x0050C2, 0x15E000, 0x15EFFF, "Celite Systems, Inc.", "CELITE" },
-	{ 0x0050C2, 0x15F000, 0x15FFFF, "Pulsar GmbH", "PULSAR" },
-	{ 0x0050C2, 0x160000, 0x160FFF, "TTI - Telecom International Ltd.", "TTI-TELECOM" },
-	{ 0x0050C2, 0x161000, 0x161FFF, "J&B Engineering Group S.L.", "J-B-ENGINEERING-GROUP" },
-	{ 0x0050C2, 0x162000, 0x162FFF, "Teseda Corporation", "TESEDA" },
-	{ 0x0050C2, 0x163000, 0x163FFF, "Computerwise, Inc.", "COMPUTERWISE" },
-	{ 0x0050C2, 0x164000, 0x164FFF, "Acunia N.V.", "ACUNIA-N-V" },
-	{ 0x0050C2, 0x165000, 0x165FFF, "IPCAST", "IPCAST" },
-	{ 0x0050C2, 0x166000, 0x166FFF, "Infineer Ltd.", "INFINEER" },
-	{ 0x0050C2, 0x167000, 0x167FFF, "Precision Filters, Inc.", "PRECISION-FILTERS" },
-	{ 0x0050C2, 0x168000, 0x168FFF, "ExtremeSpeed Inc.", "EXTREMESPEED" },
-	{ 0x0050C2, 0x169000, 0x169FFF, "Nordson Corp.", "NORDSON" },
-	{ 0x0050C2, 0x16A000, 0x16AFFF, "Time Domain", "TIME-DOMAIN" },
-	{ 0x0050C2, 0x16B000, 0x16BFFF, "Masterclock, Inc.", "MASTERCLOCK" },
-	{ 0x0050C2, 0x16C000, 0x16CFFF, "Brijing Embedor Embedded Internet Tech. Co. Ltd.", "BRIJING-EMBEDOR-EMBEDDED-INTERNET-TECH" },
-	{ 0x0050C2, 0x16D000, 0x16DFFF, "Postec Data Systems Ltd.", "POSTEC-DATA" },
-	{ 0x0050C2, 0x16E000, 0x16EFFF, "PMC", "PMC" },
-	{ 0x0050C2, 0x16F000, 0x16FFFF, "Dickson Technologies", "DICKSON-TECHNOLOGIES" },
-	{ 0x0050C2, 0x170000, 0x170FFF, "Taishodo Seiko Co., Ltd.", "TAISHODO-SEIKO" },
-	{ 0x0050C2, 0x171000, 0x171FFF, "Quantronix, Inc.", "QUANTRONIX" },
-	{ 0x0050C2, 0x172000, 0x172FFF, "SAET I.S. S.r.l.", "SAET-I-S" },
-	{ 0x0050C2, 0x173000, 0x173FFF, "DeMeTec GmbH", "DEMETEC" },
-	{ 0x0050C2, 0x174000, 0x174FFF, "N&P Technologies", "N-P-TECHNOLOGIES" },
-	{ 0x0050C2, 0x175000, 0x175FFF, "Sei S.p.A.", "SEI" },
-	{ 0x0050C2, 0x176000, 0x176FFF, "Wavium AB", "WAVIUM-AB" },
-	{ 0x0050C2, 0x177000, 0x177FFF, "Unicoi Systems", "UNICOI" },
-	{ 0x0050C2, 0x178000, 0x178FFF, "Partner Voxstream A/S", "PARTNER-VOXSTREAM-A/S" },
-	{ 0x0050C2, 0x179000, 0x179FFF, "Verifiber LLC", "VERIFIBER" },
-	{ 0x0050C2, 0x17A000, 0x17AFFF, "WOLF Advanced Technology.", "WOLF-ADVANCED" },
-	{ 0x0050C2, 0x17B000, 0x17BFFF, "Broadstorm Telecom", "BROADSTORM-TELECOM" },
-	{ 0x0050C2, 0x17C000, 0x17CFFF, "Jeffress Engineering Pty Ltd", "JEFFRESS-ENGINEERING-PTY" },
-	{ 0x0050C2, 0x17D000, 0x17DFFF, "Cognex Corporation", "COGNEX" },
-	{ 0x0050C2, 0x17E000, 0x17EFFF, "Binary Wave Technologies Inc.", "BINARY-WAVE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x17F000, 0x17FFFF, "PDQ Manufacturing", "PDQ-MANUFACTURING" },
-	{ 0x0050C2, 0x180000, 0x180FFF, "Zultys Technologies", "ZULTYS-TECHNOLOGIES" },
-	{ 0x0050C2, 0x181000, 0x181FFF, "Task 84 Spa", "TASK-84-SPA" },
-	{ 0x0050C2, 0x182000, 0x182FFF, "wolf-inf-tec", "WOLF-INF-TEC" },
-	{ 0x0050C2, 0x183000, 0x183FFF, "Mixbaal S.A. de C.V.", "MIXBAAL-DE-C-V" },
-	{ 0x0050C2, 0x184000, 0x184FFF, "H M Computing Limited", "H-M-COMPUTING" },
-	{ 0x0050C2, 0x185000, 0x185FFF, "Optical Wireless Link Inc.", "OPTICAL-WIRELESS-LINK" },
-	{ 0x0050C2, 0x186000, 0x186FFF, "Pantec Engineering AG", "PANTEC-ENGINEERING" },
-	{ 0x0050C2, 0x187000, 0x187FFF, "Cyan Technology Ltd", "CYAN" },
-	{ 0x0050C2, 0x188000, 0x188FFF, "dresden-elektronik", "DRESDEN-ELEKTRONIK" },
-	{ 0x0050C2, 0x189000, 0x189FFF, "CC Systems AB", "CC-AB" },
-	{ 0x0050C2, 0x18A000, 0x18AFFF, "Basler Electric Company", "BASLER-ELECTRIC-COMPANY" },
-	{ 0x0050C2, 0x18B000, 0x18BFFF, "Teradyne Inc.", "TERADYNE" },
-	{ 0x0050C2, 0x18C000, 0x18CFFF, "Technodrive srl", "TECHNODRIVE-SRL" },
-	{ 0x0050C2, 0x18D000, 0x18DFFF, "CCII Systems (Pty) Ltd", "CCII-PTY" },
-	{ 0x0050C2, 0x18E000, 0x18EFFF, "SPARR ELECTRONICS LTD", "SPARR-ELECTRONICS" },
-	{ 0x0050C2, 0x18F000, 0x18FFFF, "MATSUI MFG CO.,LTD", "MATSUI-MFG" },
-	{ 0x0050C2, 0x190000, 0x190FFF, "Goerlitz AG", "GOERLITZ" },
-	{ 0x0050C2, 0x191000, 0x191FFF, "Partner Voxstream A/S", "PARTNER-VOXSTREAM-A/S" },
-	{ 0x0050C2, 0x192000, 0x192FFF, "Advanced Concepts, Inc.", "ADVANCED-CONCEPTS" },
-	{ 0x0050C2, 0x193000, 0x193FFF, "LaserBit Communications Corp.", "LASERBIT-COMMUNICATION" },
-	{ 0x0050C2, 0x194000, 0x194FFF, "Cominfo, Inc.", "COMINFO" },
-	{ 0x0050C2, 0x195000, 0x195FFF, "Momentum Data Systems", "MOMENTUM-DATA" },
-	{ 0x0050C2, 0x196000, 0x196FFF, "Netsynt Spa", "NETSYNT-SPA" },
-	{ 0x0050C2, 0x197000, 0x197FFF, "EPM Tecnologia e Equipamentos", "EPM-TECNOLOGIA-E-EQUIPAMENTOS" },
-	{ 0x0050C2, 0x198000, 0x198FFF, "PotsTek, Inc", "POTSTEK" },
-	{ 0x0050C2, 0x199000, 0x199FFF, "Survalent Technology Corporation", "SURVALENT" },
-	{ 0x0050C2, 0x19A000, 0x19AFFF, "AZIO TECHNOLOGY CO.", "AZIO" },
-	{ 0x0050C2, 0x19B000, 0x19BFFF, "Wilcoxon Research, Inc.", "WILCOXON-RESEARCH" },
-	{ 0x0050C2, 0x19C000, 0x19CFFF, "Artec Design", "ARTEC-DESIGN" },
-	{ 0x0050C2, 0x19D000, 0x19DFFF, "ELECTREX S.R.L", "ELECTREX" },
-	{ 0x0050C2, 0x19E000, 0x19EFFF, "Paltronics, Inc.", "PALTRONICS" },
-	{ 0x0050C2, 0x19F000, 0x19FFFF, "Fleetwood Electronics Ltd", "FLEETWOOD-ELECTRONICS" },
-	{ 0x0050C2, 0x1A0000, 0x1A0FFF, "SCA Data Systems", "SCA-DATA" },
-	{ 0x0050C2, 0x1A1000, 0x1A1FFF, "Portalplayer, Inc", "PORTALPLAYER" },
-	{ 0x0050C2, 0x1A2000, 0x1A2FFF, "ABB Switzerland Inc", "ABB-SWITZERLAND" },
-	{ 0x0050C2, 0x1A3000, 0x1A3FFF, "Tidel Engineering, L.P.", "TIDEL-ENGINEERING-L-P" },
-	{ 0x0050C2, 0x1A4000, 0x1A4FFF, "Protech Optronics Co. Ltd.", "PROTECH-OPTRONICS" },
-	{ 0x0050C2, 0x1A5000, 0x1A5FFF, "NORCO", "NORCO" },
-	{ 0x0050C2, 0x1A6000, 0x1A6FFF, "RF Code", "RF-CODE" },
-	{ 0x0050C2, 0x1A7000, 0x1A7FFF, "Alpha Beta Technologies, Inc.", "ALPHA-BETA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x1A8000, 0x1A8FFF, "ANOVA BROADBAND", "ANOVA-BROADBAND" },
-	{ 0x0050C2, 0x1A9000, 0x1A9FFF, "Axotec Technologies GmbH", "AXOTEC-TECHNOLOGIES" },
-	{ 0x0050C2, 0x1AA000, 0x1AAFFF, "BitBox Ltd", "BITBOX" },
-	{ 0x0050C2, 0x1AB000, 0x1ABFFF, "Streaming Networks", "STREAMING-NETWORKS" },
-	{ 0x0050C2, 0x1AC000, 0x1ACFFF, "Beckmann+Egle GmbH", "BECKMANN+EGLE" },
-	{ 0x0050C2, 0x1AD000, 0x1ADFFF, "Remia s.r.o.", "REMIA-S-R-O" },
-	{ 0x0050C2, 0x1AE000, 0x1AEFFF, "Home Director, Inc", "HOME-DIRECTOR" },
-	{ 0x0050C2, 0x1AF000, 0x1AFFFF, "PESA Inc.", "PESA" },
-	{ 0x0050C2, 0x1B0000, 0x1B0FFF, "BLANKOM Antennentechnik GmbH", "BLANKOM-ANTENNENTECHNIK" },
-	{ 0x0050C2, 0x1B1000, 0x1B1FFF, "Axes Technologies", "AXES-TECHNOLOGIES" },
-	{ 0x0050C2, 0x1B2000, 0x1B2FFF, "SIGOS Systemintegration GmbH", "SIGOS-SYSTEMINTEGRATION" },
-	{ 0x0050C2, 0x1B3000, 0x1B3FFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x0050C2, 0x1B4000, 0x1B4FFF, "DSP Group Inc.", "DSP-GROUP" },
-	{ 0x0050C2, 0x1B5000, 0x1B5FFF, "Thrane & Thrane A/S", "THRANE-THRANE-A/S" },
-	{ 0x0050C2, 0x1B6000, 0x1B6FFF, "DTS, Inc.", "DTS" },
-	{ 0x0050C2, 0x1B7000, 0x1B7FFF, "MosChip USA", "MOSCHIP-USA" },
-	{ 0x0050C2, 0x1B8000, 0x1B8FFF, "Electronic Systems Development", "DEVELOPMENT" },
-	{ 0x0050C2, 0x1B9000, 0x1B9FFF, "EmCom Technology Inc.", "EMCOM" },
-	{ 0x0050C2, 0x1BA000, 0x1BAFFF, "INTERZEAG AG", "INTERZEAG" },
-	{ 0x0050C2, 0x1BB000, 0x1BBFFF, "Email Metering", "EMAIL-METERING" },
-	{ 0x0050C2, 0x1BC000, 0x1BCFFF, "DINEC International", "DINEC" },
-	{ 0x0050C2, 0x1BD000, 0x1BDFFF, "AIOI Systems Co., Ltd.", "AIOI" },
-	{ 0x0050C2, 0x1BE000, 0x1BEFFF, "Sedia Electronics", "SEDIA-ELECTRONICS" },
-	{ 0x0050C2, 0x1BF000, 0x1BFFFF, "International Test & Engineering Services Co.,Ltd.", "TEST-ENGINEERING-SERVICES" },
-	{ 0x0050C2, 0x1C0000, 0x1C0FFF, "WillMonius Inc.", "WILLMONIUS" },
-	{ 0x0050C2, 0x1C1000, 0x1C1FFF, "InfinitiNetworks Inc.", "INFINITINETWORKS" },
-	{ 0x0050C2, 0x1C2000, 0x1C2FFF, "Weltronics Corp.", "WELTRONICS" },
-	{ 0x0050C2, 0x1C3000, 0x1C3FFF, "TT electronics plc", "TT-ELECTRONICS-PLC" },
-	{ 0x0050C2, 0x1C4000, 0x1C4FFF, "Palm Solutions Group", "PALM-SOLUTIONS-GROUP" },
-	{ 0x0050C2, 0x1C5000, 0x1C5FFF, "Flander Oy", "FLANDER-OY" },
-	{ 0x0050C2, 0x1C6000, 0x1C6FFF, "Remco Italia Spa", "REMCO-ITALIA-SPA" },
-	{ 0x0050C2, 0x1C7000, 0x1C7FFF, "TWIN DEVELOPMENT S.A.", "TWIN-DEVELOPMENT" },
-	{ 0x0050C2, 0x1C8000, 0x1C8FFF, "Euphony technology CO., LTD.", "EUPHONY" },
-	{ 0x0050C2, 0x1C9000, 0x1C9FFF, "modas GmbH", "MODAS" },
-	{ 0x0050C2, 0x1CA000, 0x1CAFFF, "EVER Sp. z o.o.", "EVER-SP-Z-O-O" },
-	{ 0x0050C2, 0x1CB000, 0x1CBFFF, "quantumBEAM Limited", "QUANTUMBEAM" },
-	{ 0x0050C2, 0x1CC000, 0x1CCFFF, "WaveIP", "WAVEIP" },
-	{ 0x0050C2, 0x1CD000, 0x1CDFFF, "INCAA Informatica Italia  srl", "INCAA-INFORMATICA-ITALIA-SRL" },
-	{ 0x0050C2, 0x1CE000, 0x1CEFFF, "Datatek Applications, Inc.", "DATATEK-APPLICATIONS" },
-	{ 0x0050C2, 0x1CF000, 0x1CFFFF, "LIFETIME MEMORY PRODUCTS, INC.", "LIFETIME-MEMORY-PRODUCTS" },
-	{ 0x0050C2, 0x1D0000, 0x1D0FFF, "Yazaki North America, Inc.", "YAZAKI-NORTH-AMERICA" },
-	{ 0x0050C2, 0x1D1000, 0x1D1FFF, "Benchmark Electronics", "BENCHMARK-ELECTRONICS" },
-	{ 0x0050C2, 0x1D2000, 0x1D2FFF, "Shenyang Internet Technology Inc", "SHENYANG-INTERNET" },
-	{ 0x0050C2, 0x1D3000, 0x1D3FFF, "Synopsys", "SYNOPSYS" },
-	{ 0x0050C2, 0x1D4000, 0x1D4FFF, "Phase IV Engineering Inc.", "PHASE-IV-ENGINEERING" },
-	{ 0x0050C2, 0x1D5000, 0x1D5FFF, "Redpoint Controls", "REDPOINT-CONTROLS" },
-	{ 0x0050C2, 0x1D6000, 0x1D6FFF, "shanghai trend intelligent systems CO.,LTD", "SHANGHAI-TREND-INTELLIGENT" },
-	{ 0x0050C2, 0x1D7000, 0x1D7FFF, "Pleora Technologies Inc.", "PLEORA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x1D8000, 0x1D8FFF, "Guardian Controls International Ltd", "GUARDIAN-CONTROLS" },
-	{ 0x0050C2, 0x1D9000, 0x1D9FFF, "EDC", "EDC" },
-	{ 0x0050C2, 0x1DA000, 0x1DAFFF, "GFI Chrono Time", "GFI-CHRONO-TIME" },
-	{ 0x0050C2, 0x1DB000, 0x1DBFFF, "Applied Systems Engineering, Inc.", "APPLIED-ENGINEERING" },
-	{ 0x0050C2, 0x1DC000, 0x1DCFFF, "Imarda New Zealand Limited", "IMARDA-NEW-ZEALAND" },
-	{ 0x0050C2, 0x1DD000, 0x1DDFFF, "peiker acustic GmbH", "PEIKER-ACUSTIC" },
-	{ 0x0050C2, 0x1DE000, 0x1DEFFF, "ReliOn Inc.", "RELION" },
-	{ 0x0050C2, 0x1DF000, 0x1DFFFF, "Lulea University of Technology", "LULEA-UNIVERSITY-OF" },
-	{ 0x0050C2, 0x1E0000, 0x1E0FFF, "Cognex Corporation", "COGNEX" },
-	{ 0x0050C2, 0x1E1000, 0x1E1FFF, "Automaatiotekniikka Seppo Saari Oy", "AUTOMAATIOTEKNIIKKA-SEPPO-SAARI-OY" },
-	{ 0x0050C2, 0x1E2000, 0x1E2FFF, "DIGITRONIC Automationsanlagen GmbH", "DIGITRONIC-AUTOMATIONSANLAGEN" },
-	{ 0x0050C2, 0x1E3000, 0x1E3FFF, "Bluesocket, Inc.", "BLUESOCKET" },
-	{ 0x0050C2, 0x1E4000, 0x1E4FFF, "Soronti, Inc.", "SORONTI" },
-	{ 0x0050C2, 0x1E5000, 0x1E5FFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x0050C2, 0x1E6000, 0x1E6FFF, "United Tri-Tech Corporation", "UNITED-TRI-TECH" },
-	{ 0x0050C2, 0x1E7000, 0x1E7FFF, "Smith Meter, Inc.", "SMITH-METER" },
-	{ 0x0050C2, 0x1E8000, 0x1E8FFF, "Metrotech", "METROTECH" },
-	{ 0x0050C2, 0x1E9000, 0x1E9FFF, "Ranch Networks", "RANCH-NETWORKS" },
-	{ 0x0050C2, 0x1EA000, 0x1EAFFF, "DAVE SRL", "DAVE-SRL" },
-	{ 0x0050C2, 0x1EB000, 0x1EBFFF, "Data Respons A/S", "DATA-RESPONS-A/S" },
-	{ 0x0050C2, 0x1EC000, 0x1ECFFF, "COSMO co.,ltd.", "COSMO" },
-	{ 0x0050C2, 0x1ED000, 0x1EDFFF, "EMKA-electronic AG", "EMKA" },
-	{ 0x0050C2, 0x1EE000, 0x1EEFFF, "Perto Periféricos de Automação S.A.", "PERTO-PERIFRICOS-DE-AUTOMAO" },
-	{ 0x0050C2, 0x1EF000, 0x1EFFFF, "M2 Technology Pty Ltd", "M2-PTY" },
-	{ 0x0050C2, 0x1F0000, 0x1F0FFF, "EXI Wireless Systems Inc.", "EXI-WIRELESS" },
-	{ 0x0050C2, 0x1F1000, 0x1F1FFF, "SKY Computers, Inc.", "SKY-COMPUTERS" },
-	{ 0x0050C2, 0x1F2000, 0x1F2FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0x1F3000, 0x1F3FFF, "Radionor Communications", "RADIONOR-COMMUNICATION" },
-	{ 0x0050C2, 0x1F4000, 0x1F4FFF, "Covia, Inc", "COVIA" },
-	{ 0x0050C2, 0x1F5000, 0x1F5FFF, "Abest Communication Corp.", "ABEST-COMMUNICATION" },
-	{ 0x0050C2, 0x1F6000, 0x1F6FFF, "BAE SYSTEMS Controls", "BAE-CONTROLS" },
-	{ 0x0050C2, 0x1F7000, 0x1F7FFF, "ARC'Créations", "ARC-CRATIONS" },
-	{ 0x0050C2, 0x1F8000, 0x1F8FFF, "ULTRACKER TECHNOLOGY", "ULTRACKER" },
-	{ 0x0050C2, 0x1F9000, 0x1F9FFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0x1FA000, 0x1FAFFF, "SP Controls, Inc", "SP-CONTROLS" },
-	{ 0x0050C2, 0x1FB000, 0x1FBFFF, "Willowglen Systems Inc.", "WILLOWGLEN" },
-	{ 0x0050C2, 0x1FC000, 0x1FCFFF, "EDD Srl", "EDD-SRL" },
-	{ 0x0050C2, 0x1FD000, 0x1FDFFF, "SouthWing S.L.", "SOUTHWING" },
-	{ 0x0050C2, 0x1FE000, 0x1FEFFF, "Safetran Traffic Systems Inc.", "SAFETRAN-TRAFFIC" },
-	{ 0x0050C2, 0x1FF000, 0x1FFFFF, "Product Design Dept., Sohwa Corporation", "PRODUCT-DESIGN-DEPT-SOHWA" },
-	{ 0x0050C2, 0x200000, 0x200FFF, "Whittier Mailing Products, Inc.", "WHITTIER-MAILING-PRODUCTS" },
-	{ 0x0050C2, 0x201000, 0x201FFF, "OlympusNDT", "OLYMPUSNDT" },
-	{ 0x0050C2, 0x202000, 0x202FFF, "Audio Riders Oy", "AUDIO-RIDERS-OY" },
-	{ 0x0050C2, 0x203000, 0x203FFF, "Vocality International Ltd", "VOCALITY" },
-	{ 0x0050C2, 0x204000, 0x204FFF, "Algodue Elettronica Srl", "ALGODUE-ELETTRONICA-SRL" },
-	{ 0x0050C2, 0x205000, 0x205FFF, "SystIng", "SYSTING" },
-	{ 0x0050C2, 0x206000, 0x206FFF, "Windmill Innovations", "WINDMILL-INNOVATIONS" },
-	{ 0x0050C2, 0x207000, 0x207FFF, "Solectron Ind.Com.Servs.Exportadora do Brasil Ltda.", "SOLECTRON-IND-COM-SERVS-EXPORTADORA-DO-BRASIL-LTDA" },
-	{ 0x0050C2, 0x208000, 0x208FFF, "nNovia, Inc.", "NNOVIA" },
-	{ 0x0050C2, 0x209000, 0x209FFF, "LK Ltd", "LK" },
-	{ 0x0050C2, 0x20A000, 0x20AFFF, "Ferrari electronic AG", "FERRARI" },
-	{ 0x0050C2, 0x20B000, 0x20BFFF, "Rafael", "RAFAEL" },
-	{ 0x0050C2, 0x20C000, 0x20CFFF, "Communication and Telemechanical Systems Company Limited", "COMMUNICATION-AND-TELEMECHANICAL-COMPANY" },
-	{ 0x0050C2, 0x20D000, 0x20DFFF, "Varisys Ltd", "VARISYS" },
-	{ 0x0050C2, 0x20E000, 0x20EFFF, "PYRAMID Computer GmbH", "PYRAMID" },
-	{ 0x0050C2, 0x20F000, 0x20FFFF, "OMICRON electronics GmbH", "OMICRON-ELECTRONICS" },
-	{ 0x0050C2, 0x210000, 0x210FFF, "Innovics Wireless Inc", "INNOVICS-WIRELESS" },
-	{ 0x0050C2, 0x211000, 0x211FFF, "Hochschule für Technik, Wirtschaft und Kultur Leipzig (FH)", "HOCHSCHULE-FUER-TECHNIK-WIRTSCHAFT-UND-KULTUR-LEIPZIG-FH" },
-	{ 0x0050C2, 0x212000, 0x212FFF, "4Links Limited", "4LINKS" },
-	{ 0x0050C2, 0x213000, 0x213FFF, "SysAware S.A.R.L.", "SYSAWARE-R-L" },
-	{ 0x0050C2, 0x214000, 0x214FFF, "Oshimi System Design Inc.", "OSHIMI-SYSTEM-DESIGN" },
-	{ 0x0050C2, 0x215000, 0x215FFF, "VoiceCom AG", "VOICECOM" },
-	{ 0x0050C2, 0x216000, 0x216FFF, "Level Control Systems", "LEVEL-CONTROL" },
-	{ 0x0050C2, 0x217000, 0x217FFF, "Linn Products Ltd", "LINN-PRODUCTS" },
-	{ 0x0050C2, 0x218000, 0x218FFF, "Nansen S. A. - Instrumentos de Precisão", "NANSEN-S-A-INSTRUMENTOS-DE-PRECISO" },
-	{ 0x0050C2, 0x219000, 0x219FFF, "Aeroflex GmbH", "AEROFLEX" },
-	{ 0x0050C2, 0x21A000, 0x21AFFF, "MST SYSTEMS LIMITED", "MST" },
-	{ 0x0050C2, 0x21B000, 0x21BFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0x21C000, 0x21CFFF, "Fracarro srl", "FRACARRO-SRL" },
-	{ 0x0050C2, 0x21D000, 0x21DFFF, "ESG Elektroniksystem u. Logistik GmbH", "ESG-ELEKTRONIKSYSTEM-U-LOGISTIK" },
-	{ 0x0050C2, 0x21E000, 0x21EFFF, "Applied Technologies Associates", "APPLIED-TECHNOLOGIES-ASSOCIATES" },
-	{ 0x0050C2, 0x21F000, 0x21FFFF, "Monitor Business Machines Ltd", "MONITOR-BUSINESS-MACHINES" },
-	{ 0x0050C2, 0x220000, 0x220FFF, "Serveron Corporation", "SERVERON" },
-	{ 0x0050C2, 0x221000, 0x221FFF, "Getinge IT Solutions ApS", "GETINGE-IT-SOLUTIONS-APS" },
-	{ 0x0050C2, 0x222000, 0x222FFF, "imo-elektronik GmbH", "IMO-ELEKTRONIK" },
-	{ 0x0050C2, 0x223000, 0x223FFF, "visicontrol GmbH", "VISICONTROL" },
-	{ 0x0050C2, 0x224000, 0x224FFF, "PANNOCOM Ltd.", "PANNOCOM" },
-	{ 0x0050C2, 0x225000, 0x225FFF, "nVent, Schroff GmbH", "NVENT-SCHROFF" },
-	{ 0x0050C2, 0x226000, 0x226FFF, "Ross Video Limited", "ROSS-VIDEO" },
-	{ 0x0050C2, 0x227000, 0x227FFF, "Intelligent Photonics Control", "INTELLIGENT-PHOTONICS-CONTROL" },
-	{ 0x0050C2, 0x228000, 0x228FFF, "Intelligent Media Technologies, Inc.", "INTELLIGENT-MEDIA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x229000, 0x229FFF, "eko systems inc.", "EKO" },
-	{ 0x0050C2, 0x22A000, 0x22AFFF, "Crescendo Networks", "CRESCENDO-NETWORKS" },
-	{ 0x0050C2, 0x22B000, 0x22BFFF, "Riegl Laser Measurement Systems GmbH", "RIEGL-LASER-MEASUREMENT" },
-	{ 0x0050C2, 0x22C000, 0x22CFFF, "Intrinsity", "INTRINSITY" },
-	{ 0x0050C2, 0x22D000, 0x22DFFF, "asetek Inc.", "ASETEK" },
-	{ 0x0050C2, 0x22E000, 0x22EFFF, "LORD INGENIERIE", "LORD-INGENIERIE" },
-	{ 0x0050C2, 0x22F000, 0x22FFFF, "HTEC Limited", "HTEC" },
-	{ 0x0050C2, 0x230000, 0x230FFF, "AutoTOOLS group Co. Ltd.", "AUTOTOOLS-GROUP" },
-	{ 0x0050C2, 0x231000, 0x231FFF, "Legra Systems, Inc.", "LEGRA" },
-	{ 0x0050C2, 0x232000, 0x232FFF, "SIMET", "SIMET" },
-	{ 0x0050C2, 0x233000, 0x233FFF, "EdenTree Technologies, Inc.", "EDENTREE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x234000, 0x234FFF, "Silverback Systems", "SILVERBACK" },
-	{ 0x0050C2, 0x235000, 0x235FFF, "POLIMAR ELEKTRONIK LTD.", "POLIMAR-ELEKTRONIK" },
-	{ 0x0050C2, 0x236000, 0x236FFF, "JLCooper Electronics", "JLCOOPER-ELECTRONICS" },
-	{ 0x0050C2, 0x237000, 0x237FFF, "Tandata Systems Ltd", "TANDATA" },
-	{ 0x0050C2, 0x238000, 0x238FFF, "Schwer+Kopka GmbH", "SCHWER+KOPKA" },
-	{ 0x0050C2, 0x239000, 0x239FFF, "Stins Coman", "STINS-COMAN" },
-	{ 0x0050C2, 0x23A000, 0x23AFFF, "Chantry Networks", "CHANTRY-NETWORKS" },
-	{ 0x0050C2, 0x23B000, 0x23BFFF, "Envara", "ENVARA" },
-	{ 0x0050C2, 0x23C000, 0x23CFFF, "Wheatstone Corporation", "WHEATSTONE" },
-	{ 0x0050C2, 0x23D000, 0x23DFFF, "Gauging Systems Inc", "GAUGING" },
-	{ 0x0050C2, 0x23E000, 0x23EFFF, "Kallastra Inc.", "KALLASTRA" },
-	{ 0x0050C2, 0x23F000, 0x23FFFF, "Halliburton - NUMAR", "HALLIBURTON-NUMAR" },
-	{ 0x0050C2, 0x240000, 0x240FFF, "Geoquip Ltd", "GEOQUIP" },
-	{ 0x0050C2, 0x241000, 0x241FFF, "Contronics Automacao Ltda", "CONTRONICS-AUTOMACAO-LTDA" },
-	{ 0x0050C2, 0x242000, 0x242FFF, "MDS SCIEX", "MDS-SCIEX" },
-	{ 0x0050C2, 0x243000, 0x243FFF, "RGB Spectrum", "RGB-SPECTRUM" },
-	{ 0x0050C2, 0x244000, 0x244FFF, "intec GmbH", "INTEC" },
-	{ 0x0050C2, 0x245000, 0x245FFF, "Hauppauge Computer Works, Inc.", "HAUPPAUGE-WORKS" },
-	{ 0x0050C2, 0x246000, 0x246FFF, "Hardmeier", "HARDMEIER" },
-	{ 0x0050C2, 0x247000, 0x247FFF, "Gradual Tecnologia Ltda.", "GRADUAL-TECNOLOGIA-LTDA" },
-	{ 0x0050C2, 0x248000, 0x248FFF, "Dixtal Biomedica Ind. Com. Ltda.", "DIXTAL-BIOMEDICA-IND-COM-LTDA" },
-	{ 0x0050C2, 0x249000, 0x249FFF, "Bender GmbH & Co. KG", "BENDER" },
-	{ 0x0050C2, 0x24A000, 0x24AFFF, "CDS Rail", "CDS-RAIL" },
-	{ 0x0050C2, 0x24B000, 0x24BFFF, "Azimuth Systems, Inc.", "AZIMUTH" },
-	{ 0x0050C2, 0x24C000, 0x24CFFF, "Supertel", "SUPERTEL" },
-	{ 0x0050C2, 0x24D000, 0x24DFFF, "Mettler Toledo", "METTLER-TOLEDO" },
-	{ 0x0050C2, 0x24E000, 0x24EFFF, "Scharff Weisberg Systems Integration Inc", "SCHARFF-WEISBERG-INTEGRATION" },
-	{ 0x0050C2, 0x24F000, 0x24FFFF, "Macronet s.r.l.", "MACRONET" },
-	{ 0x0050C2, 0x250000, 0x250FFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0x251000, 0x251FFF, "DGT Sp. z o.o.", "DGT-SP-Z-O-O" },
-	{ 0x0050C2, 0x252000, 0x252FFF, "ads-tec GmbH", "ADS-TEC" },
-	{ 0x0050C2, 0x253000, 0x253FFF, "DSM-Messtechnik GmbH", "DSM-MESSTECHNIK" },
-	{ 0x0050C2, 0x254000, 0x254FFF, "Thales Communications Ltd", "THALES-COMMUNICATION" },
-	{ 0x0050C2, 0x255000, 0x255FFF, "STMicroelectronics SRL", "STMICROELECTRONICS-SRL" },
-	{ 0x0050C2, 0x256000, 0x256FFF, "Information Technology Corp.", "INFORMATION" },
-	{ 0x0050C2, 0x257000, 0x257FFF, "Digicast Networks", "DIGICAST-NETWORKS" },
-	{ 0x0050C2, 0x258000, 0x258FFF, "Spacesaver Corporation", "SPACESAVER" },
-	{ 0x0050C2, 0x259000, 0x259FFF, "Omicron Ceti AB", "OMICRON-CETI-AB" },
-	{ 0x0050C2, 0x25A000, 0x25AFFF, "Zendex Corporation", "ZENDEX" },
-	{ 0x0050C2, 0x25B000, 0x25BFFF, "Winford Engineering", "WINFORD-ENGINEERING" },
-	{ 0x0050C2, 0x25C000, 0x25CFFF, "Softhill Technologies Ltd.", "SOFTHILL-TECHNOLOGIES" },
-	{ 0x0050C2, 0x25D000, 0x25DFFF, "RDTECH", "RDTECH" },
-	{ 0x0050C2, 0x25E000, 0x25EFFF, "MITE Hradec Kralove, s.r.o.", "MITE-HRADEC-KRALOVE-S-R-O" },
-	{ 0x0050C2, 0x25F000, 0x25FFFF, "Albert Handtmann Maschinenfabrik GmbH&Co.KG", "ALBERT-HANDTMANN-MASCHINENFABRIK" },
-	{ 0x0050C2, 0x260000, 0x260FFF, "BIOTAGE", "BIOTAGE" },
-	{ 0x0050C2, 0x261000, 0x261FFF, "Tattile Srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0x262000, 0x262FFF, "Shanghai Gaozhi Science&Technology Development Ltd.", "SHANGHAI-GAOZHI-SCIENCE-DEVELOPMENT" },
-	{ 0x0050C2, 0x263000, 0x263FFF, "Vansco Electronics Oy", "VANSCO-ELECTRONICS-OY" },
-	{ 0x0050C2, 0x264000, 0x264FFF, "Confidence Direct Ltd", "CONFIDENCE-DIRECT" },
-	{ 0x0050C2, 0x265000, 0x265FFF, "BELIK S.P.R.L.", "BELIK-S-P-R-L" },
-	{ 0x0050C2, 0x266000, 0x266FFF, "ATOM GIKEN Co.,Ltd.", "ATOM-GIKEN" },
-	{ 0x0050C2, 0x267000, 0x267FFF, "Allen Martin Conservation Ltd", "ALLEN-MARTIN-CONSERVATION" },
-	{ 0x0050C2, 0x268000, 0x268FFF, "Parabit Systems", "PARABIT" },
-	{ 0x0050C2, 0x269000, 0x269FFF, "Technisyst Pty Ltd", "TECHNISYST-PTY" },
-	{ 0x0050C2, 0x26A000, 0x26AFFF, "FG SYNERYS", "FG-SYNERYS" },
-	{ 0x0050C2, 0x26B000, 0x26BFFF, "Continental Gateway Limited", "CONTINENTAL-GATEWAY" },
-	{ 0x0050C2, 0x26C000, 0x26CFFF, "Crystal Vision Ltd", "CRYSTAL-VISION" },
-	{ 0x0050C2, 0x26D000, 0x26DFFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x0050C2, 0x26E000, 0x26EFFF, "ZP Engineering SEL", "ZP-ENGINEERING-SEL" },
-	{ 0x0050C2, 0x26F000, 0x26FFFF, "Digital Recorders Inc", "DIGITAL-RECORDERS" },
-	{ 0x0050C2, 0x270000, 0x270FFF, "S4 Technology Pty Ltd", "S4-PTY" },
-	{ 0x0050C2, 0x271000, 0x271FFF, "VLSIP TECHNOLOGIES INC.", "VLSIP-TECHNOLOGIES" },
-	{ 0x0050C2, 0x272000, 0x272FFF, "Verex Technology", "VEREX" },
-	{ 0x0050C2, 0x273000, 0x273FFF, "Servicios Condumex, S. A. de C. V.", "SERVICIOS-CONDUMEX-S-A-DE-C-V" },
-	{ 0x0050C2, 0x274000, 0x274FFF, "Fundación TECNALIA Research & Innovation", "FUNDACIN-TECNALIA-RESEARCH-INNOVATION" },
-	{ 0x0050C2, 0x275000, 0x275FFF, "Extreme Engineering Solutions", "EXTREME-ENGINEERING-SOLUTIONS" },
-	{ 0x0050C2, 0x276000, 0x276FFF, "Tieline Research Pty Ltd", "TIELINE-RESEARCH-PTY" },
-	{ 0x0050C2, 0x277000, 0x277FFF, "T/R Systems, Inc.", "T/R" },
-	{ 0x0050C2, 0x278000, 0x278FFF, "Replicom Ltd.", "REPLICOM" },
-	{ 0x0050C2, 0x279000, 0x279FFF, "PATLITE Corporation", "PATLITE" },
-	{ 0x0050C2, 0x27A000, 0x27AFFF, "Maestro Pty Ltd", "MAESTRO-PTY" },
-	{ 0x0050C2, 0x27B000, 0x27BFFF, "LinkSecurity A/S", "LINKSECURITY-A/S" },
-	{ 0x0050C2, 0x27C000, 0x27CFFF, "Danlaw Inc", "DANLAW" },
-	{ 0x0050C2, 0x27D000, 0x27DFFF, "ALLIED TELESIS K.K.", "ALLIED-TELESIS-K-K" },
-	{ 0x0050C2, 0x27E000, 0x27EFFF, "AnaLogic Computers Ltd.", "ANALOGIC-COMPUTERS" },
-	{ 0x0050C2, 0x27F000, 0x27FFFF, "Air Broadband Communications, Inc.", "AIR-BROADBAND-COMMUNICATION" },
-	{ 0x0050C2, 0x280000, 0x280FFF, "AGECODAGIS SARL", "AGECODAGIS-SARL" },
-	{ 0x0050C2, 0x281000, 0x281FFF, "Cabtronix AG", "CABTRONIX" },
-	{ 0x0050C2, 0x282000, 0x282FFF, "Telvent", "TELVENT" },
-	{ 0x0050C2, 0x283000, 0x283FFF, "ANSITEX CORP.", "ANSITEX" },
-	{ 0x0050C2, 0x284000, 0x284FFF, "Micronet Ltd.", "MICRONET" },
-	{ 0x0050C2, 0x285000, 0x285FFF, "Littwin GmbH & Co KG", "LITTWIN" },
-	{ 0x0050C2, 0x286000, 0x286FFF, "ATEME", "ATEME" },
-	{ 0x0050C2, 0x287000, 0x287FFF, "TECNEW Electronics Engineering Cr., Ltd.", "TECNEW-ELECTRONICS-ENGINEERING-CR" },
-	{ 0x0050C2, 0x288000, 0x288FFF, "RPM Systems Corporation", "RPM" },
-	{ 0x0050C2, 0x289000, 0x289FFF, "Rototype S.p.A.", "ROTOTYPE" },
-	{ 0x0050C2, 0x28A000, 0x28AFFF, "Real Time Systems", "REAL-TIME" },
-	{ 0x0050C2, 0x28B000, 0x28BFFF, "Orion Technologies,LLC", "ORION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x28C000, 0x28CFFF, "Futaba Corporation", "FUTABA" },
-	{ 0x0050C2, 0x28D000, 0x28DFFF, "AXODE SA", "AXODE" },
-	{ 0x0050C2, 0x28E000, 0x28EFFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0x28F000, 0x28FFFF, "Spellman High Voltage Electronics Corp", "SPELLMAN-HIGH-VOLTAGE-ELECTRONICS" },
-	{ 0x0050C2, 0x290000, 0x290FFF, "EBNEURO SPA", "EBNEURO-SPA" },
-	{ 0x0050C2, 0x291000, 0x291FFF, "CHAUVIN ARNOUX", "CHAUVIN-ARNOUX" },
-	{ 0x0050C2, 0x292000, 0x292FFF, "AMIRIX Systems", "AMIRIX" },
-	{ 0x0050C2, 0x293000, 0x293FFF, "IP Unity", "IP-UNITY" },
-	{ 0x0050C2, 0x294000, 0x294FFF, "EPSa GmbH", "EPSA" },
-	{ 0x0050C2, 0x295000, 0x295FFF, "LOGOSOL, INC.", "LOGOSOL" },
-	{ 0x0050C2, 0x296000, 0x296FFF, "OpVista", "OPVISTA" },
-	{ 0x0050C2, 0x297000, 0x297FFF, "KINETICS", "KINETICS" },
-	{ 0x0050C2, 0x298000, 0x298FFF, "Harvad University", "HARVAD-UNIVERSITY" },
-	{ 0x0050C2, 0x299000, 0x299FFF, "CAD-UL GmbH", "CAD-UL" },
-	{ 0x0050C2, 0x29A000, 0x29AFFF, "Packet Techniques Inc.", "PACKET-TECHNIQUES" },
-	{ 0x0050C2, 0x29B000, 0x29BFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0x29C000, 0x29CFFF, "2N TELEKOMUNIKACE a.s.", "2N-TELEKOMUNIKACE" },
-	{ 0x0050C2, 0x29D000, 0x29DFFF, "Globe Wireless", "GLOBE-WIRELESS" },
-	{ 0x0050C2, 0x29E000, 0x29EFFF, "SELEX Communications Ltd", "SELEX-COMMUNICATION" },
-	{ 0x0050C2, 0x29F000, 0x29FFFF, "Baudisch Electronic GmbH", "BAUDISCH" },
-	{ 0x0050C2, 0x2A0000, 0x2A0FFF, "Sterling Industry Consult GmbH", "STERLING-INDUSTRY-CONSULT" },
-	{ 0x0050C2, 0x2A1000, 0x2A1FFF, "Infinetix Corp", "INFINETIX" },
-	{ 0x0050C2, 0x2A2000, 0x2A2FFF, "Epelsa, SL", "EPELSA-SL" },
-	{ 0x0050C2, 0x2A3000, 0x2A3FFF, "West-Com Nurse Call Systems, Inc.", "WEST-COM-NURSE-CALL" },
-	{ 0x0050C2, 0x2A4000, 0x2A4FFF, "Xipher Embedded Networking", "XIPHER-EMBEDDED-NETWORKING" },
-	{ 0x0050C2, 0x2A5000, 0x2A5FFF, "Septier Communication Ltd", "SEPTIER-COMMUNICATION" },
-	{ 0x0050C2, 0x2A6000, 0x2A6FFF, "Brannstroms Elektronik AB", "BRANNSTROMS-ELEKTRONIK-AB" },
-	{ 0x0050C2, 0x2A7000, 0x2A7FFF, "Micro System Architecturing srl", "MICRO-SYSTEM-ARCHITECTURING-SRL" },
-	{ 0x0050C2, 0x2A8000, 0x2A8FFF, "DVTel Israel Ltd.", "DVTEL-ISRAEL" },
-	{ 0x0050C2, 0x2A9000, 0x2A9FFF, "Dr. Staiger, Mohilo + Co GmbH", "DR-STAIGER-MOHILO" },
-	{ 0x0050C2, 0x2AA000, 0x2AAFFF, "DEUTA Werke GmbH", "DEUTA-WERKE" },
-	{ 0x0050C2, 0x2AB000, 0x2ABFFF, "AUM Infotech Private Limited", "AUM-INFOTECH-PRIVATE" },
-	{ 0x0050C2, 0x2AC000, 0x2ACFFF, "BBI Engineering, Inc.", "BBI-ENGINEERING" },
-	{ 0x0050C2, 0x2AD000, 0x2ADFFF, "ABB T&D Spa", "ABB-T-D-SPA" },
-	{ 0x0050C2, 0x2AE000, 0x2AEFFF, "Quest Retail Technology Pty Ltd", "QUEST-RETAIL-PTY" },
-	{ 0x0050C2, 0x2AF000, 0x2AFFFF, "CSA  Computer & Antriebstechnik GmbH", "CSA-ANTRIEBSTECHNIK" },
-	{ 0x0050C2, 0x2B0000, 0x2B0FFF, "Telda Electronics", "TELDA-ELECTRONICS" },
-	{ 0x0050C2, 0x2B1000, 0x2B1FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x2B2000, 0x2B2FFF, "Smiths Detection", "SMITHS-DETECTION" },
-	{ 0x0050C2, 0x2B3000, 0x2B3FFF, "Embedded Systems Design", "EMBEDDED-DESIGN" },
-	{ 0x0050C2, 0x2B4000, 0x2B4FFF, "Polatis Ltd", "POLATIS" },
-	{ 0x0050C2, 0x2B5000, 0x2B5FFF, "Hobbes Computer Network Accessories", "HOBBES-NETWORK-ACCESSORIES" },
-	{ 0x0050C2, 0x2B6000, 0x2B6FFF, "Softier Inc.", "SOFTIER" },
-	{ 0x0050C2, 0x2B7000, 0x2B7FFF, "RAFI GmbH & Co.KG", "RAFI" },
-	{ 0x0050C2, 0x2B8000, 0x2B8FFF, "Admiral Secure Products, Ltd.", "ADMIRAL-SECURE-PRODUCTS" },
-	{ 0x0050C2, 0x2B9000, 0x2B9FFF, "Richmond Sound Design Ltd.", "RICHMOND-SOUND-DESIGN" },
-	{ 0x0050C2, 0x2BA000, 0x2BAFFF, "NORCO INDUSTRIAL TECHNOLOGY INC", "NORCO-INDUSTRIAL" },
-	{ 0x0050C2, 0x2BB000, 0x2BBFFF, "TA Instruments Ltd", "TA-INSTRUMENTS" },
-	{ 0x0050C2, 0x2BC000, 0x2BCFFF, "Uster Technologies AG", "USTER-TECHNOLOGIES" },
-	{ 0x0050C2, 0x2BD000, 0x2BDFFF, "StorLink Semi", "STORLINK-SEMI" },
-	{ 0x0050C2, 0x2BE000, 0x2BEFFF, "Lipowsky Industrie-Elektronik GmbH", "LIPOWSKY-INDUSTRIE-ELEKTRONIK" },
-	{ 0x0050C2, 0x2BF000, 0x2BFFFF, "PERAX", "PERAX" },
-	{ 0x0050C2, 0x2C0000, 0x2C0FFF, "Magellan Technology Pty Limited", "MAGELLAN-PTY" },
-	{ 0x0050C2, 0x2C1000, 0x2C1FFF, "Stage Tec Entwicklungsgesellschaft für professionelle Audio", "STAGE-TEC-ENTWICKLUNGSGESELLSCHAFT-FUER-PROFESSIONELLE-AUDIO" },
-	{ 0x0050C2, 0x2C2000, 0x2C2FFF, "Smarteye Corporation", "SMARTEYE" },
-	{ 0x0050C2, 0x2C3000, 0x2C3FFF, "Digital SP Ltd", "DIGITAL-SP" },
-	{ 0x0050C2, 0x2C4000, 0x2C4FFF, "Invensys Energy Systens (NZ) Limited", "INVENSYS-ENERGY-SYSTENS-NZ" },
-	{ 0x0050C2, 0x2C5000, 0x2C5FFF, "Elman srl", "ELMAN-SRL" },
-	{ 0x0050C2, 0x2C6000, 0x2C6FFF, "Initial Electronic Security Systems", "INITIAL-SECURITY" },
-	{ 0x0050C2, 0x2C7000, 0x2C7FFF, "Siliquent Technologies Ltd", "SILIQUENT-TECHNOLOGIES" },
-	{ 0x0050C2, 0x2C8000, 0x2C8FFF, "SELCO", "SELCO" },
-	{ 0x0050C2, 0x2C9000, 0x2C9FFF, "Roseman Engineering Ltd.", "ROSEMAN-ENGINEERING" },
-	{ 0x0050C2, 0x2CA000, 0x2CAFFF, "PUTERCOM CO., LTD", "PUTERCOM" },
-	{ 0x0050C2, 0x2CB000, 0x2CBFFF, "FACTS Engineering LLC", "FACTS-ENGINEERING" },
-	{ 0x0050C2, 0x2CC000, 0x2CCFFF, "EMBEDDED TOOLSMITHS", "EMBEDDED-TOOLSMITHS" },
-	{ 0x0050C2, 0x2CD000, 0x2CDFFF, "DataWind Research", "DATAWIND-RESEARCH" },
-	{ 0x0050C2, 0x2CE000, 0x2CEFFF, "Ross Video Limited", "ROSS-VIDEO" },
-	{ 0x0050C2, 0x2CF000, 0x2CFFFF, "Diseño de Sistemas en Silicio S.A.", "DISEO-DE-SISTEMAS-EN-SILICIO" },
-	{ 0x0050C2, 0x2D0000, 0x2D0FFF, "Worth Data, Inc.", "WORTH-DATA" },
-	{ 0x0050C2, 0x2D1000, 0x2D1FFF, "Miritek, Inc.", "MIRITEK" },
-	{ 0x0050C2, 0x2D2000, 0x2D2FFF, "AIRNET COMMUNICATIONS CORP", "AIRNET-COMMUNICATION" },
-	{ 0x0050C2, 0x2D3000, 0x2D3FFF, "Gerber Scientific Products, Inc.", "GERBER-SCIENTIFIC-PRODUCTS" },
-	{ 0x0050C2, 0x2D4000, 0x2D4FFF, "Integrated System Solution Corp.", "INTEGRATED-SYSTEM-SOLUTION" },
-	{ 0x0050C2, 0x2D5000, 0x2D5FFF, "PIXY AG", "PIXY" },
-	{ 0x0050C2, 0x2D6000, 0x2D6FFF, "WIS Technologies", "WIS-TECHNOLOGIES" },
-	{ 0x0050C2, 0x2D7000, 0x2D7FFF, "Neo Electronics Ltd", "NEO-ELECTRONICS" },
-	{ 0x0050C2, 0x2D8000, 0x2D8FFF, "SYN-TECH SYSTEMS INC", "SYN-TECH" },
-	{ 0x0050C2, 0x2D9000, 0x2D9FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x2DA000, 0x2DAFFF, "PYRAMID Computer GmbH", "PYRAMID" },
-	{ 0x0050C2, 0x2DB000, 0x2DBFFF, "AutoTOOLS group Co. Ltd.", "AUTOTOOLS-GROUP" },
-	{ 0x0050C2, 0x2DC000, 0x2DCFFF, "Wiener, Plein & Baus GmbH", "WIENER-PLEIN-BAUS" },
-	{ 0x0050C2, 0x2DD000, 0x2DDFFF, "Westek Technology Ltd", "WESTEK" },
-	{ 0x0050C2, 0x2DE000, 0x2DEFFF, "Research Applications", "RESEARCH-APPLICATIONS" },
-	{ 0x0050C2, 0x2DF000, 0x2DFFFF, "MICREL-NKE", "MICREL-NKE" },
-	{ 0x0050C2, 0x2E0000, 0x2E0FFF, "Baxter International Inc", "BAXTER" },
-	{ 0x0050C2, 0x2E1000, 0x2E1FFF, "Access IS", "ACCESS-IS" },
-	{ 0x0050C2, 0x2E2000, 0x2E2FFF, "Ballard Technology, Inc,", "BALLARD" },
-	{ 0x0050C2, 0x2E3000, 0x2E3FFF, "MG Industrieelektronik GmbH", "MG-INDUSTRIEELEKTRONIK" },
-	{ 0x0050C2, 0x2E4000, 0x2E4FFF, "iamba LTD.", "IAMBA" },
-	{ 0x0050C2, 0x2E5000, 0x2E5FFF, "Transtech DSP", "TRANSTECH-DSP" },
-	{ 0x0050C2, 0x2E6000, 0x2E6FFF, "DALSA", "DALSA" },
-	{ 0x0050C2, 0x2E7000, 0x2E7FFF, "SafeView, Inc.", "SAFEVIEW" },
-	{ 0x0050C2, 0x2E8000, 0x2E8FFF, "S.M.V. Systemelektronik GmbH", "S-M-V-SYSTEMELEKTRONIK" },
-	{ 0x0050C2, 0x2E9000, 0x2E9FFF, "SRI International", "SRI" },
-	{ 0x0050C2, 0x2EA000, 0x2EAFFF, "QUBIsoft S.r.l.", "QUBISOFT" },
-	{ 0x0050C2, 0x2EB000, 0x2EBFFF, "Lingg & Janke OHG", "LINGG-JANKE-OHG" },
-	{ 0x0050C2, 0x2EC000, 0x2ECFFF, "CHENGDU  BOOK DIGITAL CO., LTD", "CHENGDU-BOOK-DIGITAL" },
-	{ 0x0050C2, 0x2ED000, 0x2EDFFF, "4RF Communications Ltd", "4RF-COMMUNICATION" },
-	{ 0x0050C2, 0x2EE000, 0x2EEFFF, "SHF Communication Technologies AG", "SHF-COMMUNICATION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x2EF000, 0x2EFFFF, "Profline B.V.", "PROFLINE-B-V" },
-	{ 0x0050C2, 0x2F0000, 0x2F0FFF, "LECO Corporation", "LECO" },
-	{ 0x0050C2, 0x2F1000, 0x2F1FFF, "Geometrics, Inc.", "GEOMETRICS" },
-	{ 0x0050C2, 0x2F2000, 0x2F2FFF, "Eurotek Srl", "EUROTEK-SRL" },
-	{ 0x0050C2, 0x2F3000, 0x2F3FFF, "Crossbow Technology, Inc.", "CROSSBOW" },
-	{ 0x0050C2, 0x2F4000, 0x2F4FFF, "Efficient Channel Coding", "EFFICIENT-CHANNEL-CODING" },
-	{ 0x0050C2, 0x2F5000, 0x2F5FFF, "ADChips", "ADCHIPS" },
-	{ 0x0050C2, 0x2F6000, 0x2F6FFF, "Clifford Chance LLP", "CLIFFORD-CHANCE-LLP" },
-	{ 0x0050C2, 0x2F7000, 0x2F7FFF, "GILLAM-FEI S.A.", "GILLAM-FEI" },
-	{ 0x0050C2, 0x2F8000, 0x2F8FFF, "SavvyCorp.com Ltd", "SAVVYCORP-COM" },
-	{ 0x0050C2, 0x2F9000, 0x2F9FFF, "Digilent Inc.", "DIGILENT" },
-	{ 0x0050C2, 0x2FA000, 0x2FAFFF, "Tornado Modular Systems", "TORNADO-MODULAR" },
-	{ 0x0050C2, 0x2FB000, 0x2FBFFF, "Arthur Industries Inc., dba On Hold Media Group", "ARTHUR-INDUSTRIES-DBA-ON-HOLD-MEDIA-GROUP" },
-	{ 0x0050C2, 0x2FC000, 0x2FCFFF, "Blackline Systems Corporation", "BLACKLINE" },
-	{ 0x0050C2, 0x2FD000, 0x2FDFFF, "American Microsystems, Ltd.", "AMERICAN-MICROSYSTEMS" },
-	{ 0x0050C2, 0x2FE000, 0x2FEFFF, "Saab AB", "SAAB-AB" },
-	{ 0x0050C2, 0x2FF000, 0x2FFFFF, "Patria Advanced Solutions", "PATRIA-ADVANCED-SOLUTIONS" },
-	{ 0x0050C2, 0x300000, 0x300FFF, "Soredex Instrumentarium Oyj", "SOREDEX-INSTRUMENTARIUM-OYJ" },
-	{ 0x0050C2, 0x301000, 0x301FFF, "Delphi Display Systems, Inc.", "DELPHI-DISPLAY" },
-	{ 0x0050C2, 0x302000, 0x302FFF, "EuroDesign embedded technologies GmbH", "EURODESIGN-EMBEDDED-TECHNOLOGIES" },
-	{ 0x0050C2, 0x303000, 0x303FFF, "CI Systems Ltd.", "CI" },
-	{ 0x0050C2, 0x304000, 0x304FFF, "COMERSON S.r.l.", "COMERSON" },
-	{ 0x0050C2, 0x305000, 0x305FFF, "Symbium Corporation", "SYMBIUM" },
-	{ 0x0050C2, 0x306000, 0x306FFF, "Noran Tel Communications Ltd.", "NORAN-TEL-COMMUNICATION" },
-	{ 0x0050C2, 0x307000, 0x307FFF, "UNIONDIGITAL.,CO.LTD", "UNIONDIGITAL" },
-	{ 0x0050C2, 0x308000, 0x308FFF, "FiveCo", "FIVECO" },
-	{ 0x0050C2, 0x309000, 0x309FFF, "Rackmaster Systems, Inc.", "RACKMASTER" },
-	{ 0x0050C2, 0x30A000, 0x30AFFF, "Innings Telecom Inc.", "INNINGS-TELECOM" },
-	{ 0x0050C2, 0x30B000, 0x30BFFF, "VX Technologies Inc.", "VX-TECHNOLOGIES" },
-	{ 0x0050C2, 0x30C000, 0x30CFFF, "TEAMLOG", "TEAMLOG" },
-	{ 0x0050C2, 0x30D000, 0x30DFFF, "SETARAM", "SETARAM" },
-	{ 0x0050C2, 0x30E000, 0x30EFFF, "Leviton Manufacturing Co., Inc", "LEVITON-MANUFACTURING" },
-	{ 0x0050C2, 0x30F000, 0x30FFFF, "Digicontrole Lda", "DIGICONTROLE-LDA" },
-	{ 0x0050C2, 0x310000, 0x310FFF, "CYBERTRON CO., LTD.", "CYBERTRON" },
-	{ 0x0050C2, 0x311000, 0x311FFF, "Comodo", "COMODO" },
-	{ 0x0050C2, 0x312000, 0x312FFF, "Dese Technologies SL", "DESE-TECHNOLOGIES-SL" },
-	{ 0x0050C2, 0x313000, 0x313FFF, "SAIA Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x314000, 0x314FFF, "MicroBee Systems, Inc", "MICROBEE" },
-	{ 0x0050C2, 0x315000, 0x315FFF, "ifak system GmbH", "IFAK-SYSTEM" },
-	{ 0x0050C2, 0x316000, 0x316FFF, "Dataline AB", "DATALINE-AB" },
-	{ 0x0050C2, 0x317000, 0x317FFF, "Cosine Systems, Inc.", "COSINE" },
-	{ 0x0050C2, 0x318000, 0x318FFF, "Milmega Ltd", "MILMEGA" },
-	{ 0x0050C2, 0x319000, 0x319FFF, "Invatron Systems Corp.", "INVATRON" },
-	{ 0x0050C2, 0x31A000, 0x31AFFF, "Zodiak Data Systems", "ZODIAK-DATA" },
-	{ 0x0050C2, 0x31B000, 0x31BFFF, "Datacon", "DATACON" },
-	{ 0x0050C2, 0x31C000, 0x31CFFF, "AxyomCore Inc.", "AXYOMCORE" },
-	{ 0x0050C2, 0x31D000, 0x31DFFF, "Imarda New Zealand Limited", "IMARDA-NEW-ZEALAND" },
-	{ 0x0050C2, 0x31E000, 0x31EFFF, "C3-ilex, LLC", "C3-ILEX" },
-	{ 0x0050C2, 0x31F000, 0x31FFFF, "Geotech Instruments, LLC", "GEOTECH-INSTRUMENTS" },
-	{ 0x0050C2, 0x320000, 0x320FFF, "DTASENSOR S.p.A.", "DTASENSOR" },
-	{ 0x0050C2, 0x321000, 0x321FFF, "UXP", "UXP" },
-	{ 0x0050C2, 0x322000, 0x322FFF, "BQT Solutions (Australia) Limited", "BQT-SOLUTIONS-AUSTRALIA" },
-	{ 0x0050C2, 0x323000, 0x323FFF, "Red Rock Networks", "RED-ROCK-NETWORKS" },
-	{ 0x0050C2, 0x324000, 0x324FFF, "ODIXION", "ODIXION" },
-	{ 0x0050C2, 0x325000, 0x325FFF, "Federal Aviation Administration", "FEDERAL-AVIATION-ADMINISTRATION" },
-	{ 0x0050C2, 0x326000, 0x326FFF, "Navionics S.p.A.", "NAVIONICS" },
-	{ 0x0050C2, 0x327000, 0x327FFF, "Dornier GmbH", "DORNIER" },
-	{ 0x0050C2, 0x328000, 0x328FFF, "I.C.S. Electronics Limited", "I-C-S-ELECTRONICS" },
-	{ 0x0050C2, 0x329000, 0x329FFF, "Imax", "IMAX" },
-	{ 0x0050C2, 0x32A000, 0x32AFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x32B000, 0x32BFFF, "Digital Multimedia Technologies Spa", "DIGITAL-MULTIMEDIA-TECHNOLOGIES-SPA" },
-	{ 0x0050C2, 0x32C000, 0x32CFFF, "Integrated Silicon Solution (Taiwan), Inc.", "INTEGRATED-SILICON-SOLUTION-TAIWAN" },
-	{ 0x0050C2, 0x32D000, 0x32DFFF, "Consens Zeiterfassung GMBH", "CONSENS-ZEITERFASSUNG" },
-	{ 0x0050C2, 0x32E000, 0x32EFFF, "MANUSA-GEST, S.L.", "MANUSA-GEST" },
-	{ 0x0050C2, 0x32F000, 0x32FFFF, "PULTRONICS", "PULTRONICS" },
-	{ 0x0050C2, 0x330000, 0x330FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0x331000, 0x331FFF, "Broadcast Sports Inc", "BROADCAST-SPORTS" },
-	{ 0x0050C2, 0x332000, 0x332FFF, "PUNJAB COMMUNICATIONS LTD", "PUNJAB-COMMUNICATION" },
-	{ 0x0050C2, 0x333000, 0x333FFF, "Radix Corporation", "RADIX" },
-	{ 0x0050C2, 0x334000, 0x334FFF, "Picture Elements, Inc.", "PICTURE-ELEMENTS" },
-	{ 0x0050C2, 0x335000, 0x335FFF, "Nimcat Networks", "NIMCAT-NETWORKS" },
-	{ 0x0050C2, 0x336000, 0x336FFF, "Golden River Traffic", "GOLDEN-RIVER-TRAFFIC" },
-	{ 0x0050C2, 0x337000, 0x337FFF, "ETI", "ETI" },
-	{ 0x0050C2, 0x338000, 0x338FFF, "Ernitec A/S", "ERNITEC-A/S" },
-	{ 0x0050C2, 0x339000, 0x339FFF, "Secure Systems & Services", "SECURE-SERVICES" },
-	{ 0x0050C2, 0x33A000, 0x33AFFF, "United Telecoms Ltd", "UNITED-TELECOMS" },
-	{ 0x0050C2, 0x33B000, 0x33BFFF, "MultimediaLED", "MULTIMEDIALED" },
-	{ 0x0050C2, 0x33C000, 0x33CFFF, "SkipJam", "SKIPJAM" },
-	{ 0x0050C2, 0x33D000, 0x33DFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0x33E000, 0x33EFFF, "CA Technology, Inc", "CA" },
-	{ 0x0050C2, 0x33F000, 0x33FFFF, "EXYS bvba", "EXYS-BVBA" },
-	{ 0x0050C2, 0x340000, 0x340FFF, "Virtu", "VIRTU" },
-	{ 0x0050C2, 0x341000, 0x341FFF, "Novx Systems", "NOVX" },
-	{ 0x0050C2, 0x342000, 0x342FFF, "St. Michael Strategies", "ST-MICHAEL-STRATEGIES" },
-	{ 0x0050C2, 0x343000, 0x343FFF, "ABB Xiamen Switchgear Co. Ltd.", "ABB-XIAMEN-SWITCHGEAR" },
-	{ 0x0050C2, 0x344000, 0x344FFF, "ads-tec GmbH", "ADS-TEC" },
-	{ 0x0050C2, 0x345000, 0x345FFF, "ACT", "ACT" },
-	{ 0x0050C2, 0x346000, 0x346FFF, "biokeysystem", "BIOKEYSYSTEM" },
-	{ 0x0050C2, 0x347000, 0x347FFF, "Row Seven Ltd", "ROW-SEVEN" },
-	{ 0x0050C2, 0x348000, 0x348FFF, "KoolSpan, Inc.", "KOOLSPAN" },
-	{ 0x0050C2, 0x349000, 0x349FFF, "SSI Schaefer Peem", "SSI-SCHAEFER-PEEM" },
-	{ 0x0050C2, 0x34A000, 0x34AFFF, "NIE Corporation", "NIE" },
-	{ 0x0050C2, 0x34B000, 0x34BFFF, "Ecutel Systems, Inc.", "ECUTEL" },
-	{ 0x0050C2, 0x34C000, 0x34CFFF, "Chuo Electric Works Co., LTD.", "CHUO-ELECTRIC-WORKS" },
-	{ 0x0050C2, 0x34D000, 0x34DFFF, "BMK professional electronics GmbH", "BMK-PROFESSIONAL-ELECTRONICS" },
-	{ 0x0050C2, 0x34E000, 0x34EFFF, "ABB Power Technologies S.p.A.  Unità  Operativa SACE (PTMV)", "ABB-POWER-TECHNOLOGIES-S-P-A-UNIT-OPERATIVA-SACE-PTMV" },
-	{ 0x0050C2, 0x34F000, 0x34FFFF, "North Pole Engineering, Inc.", "NORTH-POLE-ENGINEERING" },
-	{ 0x0050C2, 0x350000, 0x350FFF, "Kinesys Projects Limited", "KINESYS-PROJECTS" },
-	{ 0x0050C2, 0x351000, 0x351FFF, "Finesystem Co., Ltd", "FINESYSTEM" },
-	{ 0x0050C2, 0x352000, 0x352FFF, "LUCEO", "LUCEO" },
-	{ 0x0050C2, 0x353000, 0x353FFF, "Crossing Informationssysteme GmbH", "CROSSING-INFORMATIONSSYSTEME" },
-	{ 0x0050C2, 0x354000, 0x354FFF, "Advanced IP Communications", "ADVANCED-IP-COMMUNICATION" },
-	{ 0x0050C2, 0x355000, 0x355FFF, "IHM", "IHM" },
-	{ 0x0050C2, 0x356000, 0x356FFF, "Baytech Cinema", "BAYTECH-CINEMA" },
-	{ 0x0050C2, 0x357000, 0x357FFF, "Athena Semiconductor", "ATHENA-SEMICONDUCTOR" },
-	{ 0x0050C2, 0x358000, 0x358FFF, "ALCEA", "ALCEA" },
-	{ 0x0050C2, 0x359000, 0x359FFF, "Kramer Electronics Ltd.", "KRAMER-ELECTRONICS" },
-	{ 0x0050C2, 0x35A000, 0x35AFFF, "Advanced Si-Net Co., LTD.", "ADVANCED-SI-NET" },
-	{ 0x0050C2, 0x35B000, 0x35BFFF, "VLSIP TECHNOLOGIES, INC", "VLSIP-TECHNOLOGIES" },
-	{ 0x0050C2, 0x35C000, 0x35CFFF, "Ratotec GmbH", "RATOTEC" },
-	{ 0x0050C2, 0x35D000, 0x35DFFF, "NetTest A/S", "NETTEST-A/S" },
-	{ 0x0050C2, 0x35E000, 0x35EFFF, "Jobin Yvon,Inc", "JOBIN-YVON" },
-	{ 0x0050C2, 0x35F000, 0x35FFFF, "F.Imm. S.r.L.", "F-IMM" },
-	{ 0x0050C2, 0x360000, 0x360FFF, "Digital Receiver Technology", "DIGITAL-RECEIVER" },
-	{ 0x0050C2, 0x361000, 0x361FFF, "Contec", "CONTEC" },
-	{ 0x0050C2, 0x362000, 0x362FFF, "AZD Praha s.r.o.", "AZD-PRAHA-S-R-O" },
-	{ 0x0050C2, 0x363000, 0x363FFF, "Septentrio nv/sa", "SEPTENTRIO-NV/" },
-	{ 0x0050C2, 0x364000, 0x364FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0x365000, 0x365FFF, "VPG", "VPG" },
-	{ 0x0050C2, 0x366000, 0x366FFF, "Vanguard Technology Corp.", "VANGUARD" },
-	{ 0x0050C2, 0x367000, 0x367FFF, "CANMAX Technology Ltd.", "CANMAX" },
-	{ 0x0050C2, 0x368000, 0x368FFF, "ASPEL S.A.", "ASPEL" },
-	{ 0x0050C2, 0x369000, 0x369FFF, "Always On Wireless", "ALWAYS-ON-WIRELESS" },
-	{ 0x0050C2, 0x36A000, 0x36AFFF, "Optronic Partner pr AB", "OPTRONIC-PARTNER-PR-AB" },
-	{ 0x0050C2, 0x36B000, 0x36BFFF, "Minerva Technology Inc", "MINERVA" },
-	{ 0x0050C2, 0x36C000, 0x36CFFF, "RISCO Group", "RISCO-GROUP" },
-	{ 0x0050C2, 0x36D000, 0x36DFFF, "Oplink Communications", "OPLINK-COMMUNICATION" },
-	{ 0x0050C2, 0x36E000, 0x36EFFF, "Minicom Advanced Systems Ltd", "MINICOM-ADVANCED" },
-	{ 0x0050C2, 0x36F000, 0x36FFFF, "XIMEA s.r.o.", "XIMEA-S-R-O" },
-	{ 0x0050C2, 0x370000, 0x370FFF, "Europe Technologies", "EUROPE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x371000, 0x371FFF, "DIGITAL ART SYSTEM", "DIGITAL-ART-SYSTEM" },
-	{ 0x0050C2, 0x372000, 0x372FFF, "ELV Elektronik AG", "ELV-ELEKTRONIK" },
-	{ 0x0050C2, 0x373000, 0x373FFF, "Companion Worlds, inc.", "COMPANION-WORLDS" },
-	{ 0x0050C2, 0x374000, 0x374FFF, "Owasys Advanced Wireless Devices", "OWASYS-ADVANCED-WIRELESS-DEVICES" },
-	{ 0x0050C2, 0x375000, 0x375FFF, "TIR Systems Ltd.", "TIR" },
-	{ 0x0050C2, 0x376000, 0x376FFF, "CLEODE", "CLEODE" },
-	{ 0x0050C2, 0x377000, 0x377FFF, "Xycom VME", "XYCOM-VME" },
-	{ 0x0050C2, 0x378000, 0x378FFF, "Daintree Networks Pty", "DAINTREE-NETWORKS-PTY" },
-	{ 0x0050C2, 0x379000, 0x379FFF, "Control LAN S.A.", "CONTROL-LAN" },
-	{ 0x0050C2, 0x37A000, 0x37AFFF, "IDA Corporation", "IDA" },
-	{ 0x0050C2, 0x37B000, 0x37BFFF, "Freescale Semiconductor", "FREESCALE-SEMICONDUCTOR" },
-	{ 0x0050C2, 0x37C000, 0x37CFFF, "MODIA SYSTEMS Co., Ltd", "MODIA" },
-	{ 0x0050C2, 0x37D000, 0x37DFFF, "VeroTrak Inc.", "VEROTRAK" },
-	{ 0x0050C2, 0x37E000, 0x37EFFF, "Ni.Co. S.r.l.", "NI" },
-	{ 0x0050C2, 0x37F000, 0x37FFFF, "Foresearch", "FORESEARCH" },
-	{ 0x0050C2, 0x380000, 0x380FFF, "EKE-Electronics Ltd.", "EKE-ELECTRONICS" },
-	{ 0x0050C2, 0x381000, 0x381FFF, "Realtime Engineering AG", "REALTIME-ENGINEERING" },
-	{ 0x0050C2, 0x382000, 0x382FFF, "Colorado vNet", "COLORADO-VNET" },
-	{ 0x0050C2, 0x383000, 0x383FFF, "ICS Electronics", "ICS-ELECTRONICS" },
-	{ 0x0050C2, 0x384000, 0x384FFF, "Wireless Reading Systems Holding ASA", "WIRELESS-READING-HOLDING-ASA" },
-	{ 0x0050C2, 0x385000, 0x385FFF, "SUNGJIN NEOTECH Co.Ltd.", "SUNGJIN-NEOTECH" },
-	{ 0x0050C2, 0x386000, 0x386FFF, "Precision System Science Co.,Ltd", "PRECISION-SYSTEM-SCIENCE" },
-	{ 0x0050C2, 0x387000, 0x387FFF, "Inoteska s.r.o.", "INOTESKA-S-R-O" },
-	{ 0x0050C2, 0x388000, 0x388FFF, "IEE Inc", "IEE" },
-	{ 0x0050C2, 0x389000, 0x389FFF, "Exavio Inc.", "EXAVIO" },
-	{ 0x0050C2, 0x38A000, 0x38AFFF, "Embedtronics Enterprise", "EMBEDTRONICS" },
-	{ 0x0050C2, 0x38B000, 0x38BFFF, "InterBridge,Inc.", "INTERBRIDGE" },
-	{ 0x0050C2, 0x38C000, 0x38CFFF, "EPSILON SRL", "EPSILON-SRL" },
-	{ 0x0050C2, 0x38D000, 0x38DFFF, "A&G Soluzioni Digitali", "A-G-SOLUZIONI-DIGITALI" },
-	{ 0x0050C2, 0x38E000, 0x38EFFF, "Nordic Alarm AB", "NORDIC-ALARM-AB" },
-	{ 0x0050C2, 0x38F000, 0x38FFFF, "TTC Telecom", "TTC-TELECOM" },
-	{ 0x0050C2, 0x390000, 0x390FFF, "TC Communications", "TC-COMMUNICATION" },
-	{ 0x0050C2, 0x391000, 0x391FFF, "Esensors, Inc.", "ESENSORS" },
-	{ 0x0050C2, 0x392000, 0x392FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x393000, 0x393FFF, "SYS TEC electronic GmbH", "SYS-TEC" },
-	{ 0x0050C2, 0x394000, 0x394FFF, "Embedit A/S", "EMBEDIT-A/S" },
-	{ 0x0050C2, 0x395000, 0x395FFF, "vidisys gmbh", "VIDISYS" },
-	{ 0x0050C2, 0x396000, 0x396FFF, "RapidWave Inc.", "RAPIDWAVE" },
-	{ 0x0050C2, 0x397000, 0x397FFF, "MANGO DSP Ltd.", "MANGO-DSP" },
-	{ 0x0050C2, 0x398000, 0x398FFF, "Inhand Electronics, Inc.", "INHAND-ELECTRONICS" },
-	{ 0x0050C2, 0x399000, 0x399FFF, "Advanced Micro Controls Inc.", "ADVANCED-MICRO-CONTROLS" },
-	{ 0x0050C2, 0x39A000, 0x39AFFF, "Optical Air Data Systems", "OPTICAL-AIR-DATA" },
-	{ 0x0050C2, 0x39B000, 0x39BFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x0050C2, 0x39C000, 0x39CFFF, "TIYODA MFG CO.,LTD.", "TIYODA-MFG" },
-	{ 0x0050C2, 0x39D000, 0x39DFFF, "DigitalDeck, Inc.", "DIGITALDECK" },
-	{ 0x0050C2, 0x39E000, 0x39EFFF, "A.R.G ElectroDesign Ltd", "A-R-G-ELECTRODESIGN" },
-	{ 0x0050C2, 0x39F000, 0x39FFFF, "Isensix", "ISENSIX" },
-	{ 0x0050C2, 0x3A0000, 0x3A0FFF, "StreetFire Sound Labs, LLC", "STREETFIRE-SOUND-LABS" },
-	{ 0x0050C2, 0x3A1000, 0x3A1FFF, "Samsoft", "SAMSOFT" },
-	{ 0x0050C2, 0x3A2000, 0x3A2FFF, "Vegas Amusement", "VEGAS-AMUSEMENT" },
-	{ 0x0050C2, 0x3A3000, 0x3A3FFF, "Star Link Communication Pvt. Ltd.", "STAR-LINK-COMMUNICATION-PVT" },
-	{ 0x0050C2, 0x3A4000, 0x3A4FFF, "Silvertree Engineering Ltd", "SILVERTREE-ENGINEERING" },
-	{ 0x0050C2, 0x3A5000, 0x3A5FFF, "LabJack Corporation", "LABJACK" },
-	{ 0x0050C2, 0x3A6000, 0x3A6FFF, "IntelliDesign Pty Ltd", "INTELLIDESIGN-PTY" },
-	{ 0x0050C2, 0x3A7000, 0x3A7FFF, "Elektrotechnik & Elektronik Oltmann GmbH", "ELEKTROTECHNIK-ELEKTRONIK-OLTMANN" },
-	{ 0x0050C2, 0x3A8000, 0x3A8FFF, "Engim, Inc.", "ENGIM" },
-	{ 0x0050C2, 0x3A9000, 0x3A9FFF, "Westronic Systems Inc.", "WESTRONIC" },
-	{ 0x0050C2, 0x3AA000, 0x3AAFFF, "Networked Robotics Corporation", "NETWORKED-ROBOTICS" },
-	{ 0x0050C2, 0x3AB000, 0x3ABFFF, "taskit Rechnertechnik GmbH", "TASKIT-RECHNERTECHNIK" },
-	{ 0x0050C2, 0x3AC000, 0x3ACFFF, "InAccess Networks", "INACCESS-NETWORKS" },
-	{ 0x0050C2, 0x3AD000, 0x3ADFFF, "Spirent Communications (Scotland) Limited", "SPIRENT-COMMUNICATION-SCOTLAND" },
-	{ 0x0050C2, 0x3AE000, 0x3AEFFF, "Hankuk Tapi Computer Co., Ltd", "HANKUK-TAPI" },
-	{ 0x0050C2, 0x3AF000, 0x3AFFFF, "Norbit ODM AS", "NORBIT-ODM-AS" },
-	{ 0x0050C2, 0x3B0000, 0x3B0FFF, "Microtarget Tecnologia Digital Ltda.", "MICROTARGET-TECNOLOGIA-DIGITAL-LTDA" },
-	{ 0x0050C2, 0x3B1000, 0x3B1FFF, "Specstroy-Svyaz Ltd", "SPECSTROY-SVYAZ" },
-	{ 0x0050C2, 0x3B2000, 0x3B2FFF, "Tennessee Valley Authority", "TENNESSEE-VALLEY-AUTHORITY" },
-	{ 0x0050C2, 0x3B3000, 0x3B3FFF, "Media Lab., Inc.", "MEDIA-LAB" },
-	{ 0x0050C2, 0x3B4000, 0x3B4FFF, "Contrôle Analytique inc.", "CONTRLE-ANALYTIQUE" },
-	{ 0x0050C2, 0x3B5000, 0x3B5FFF, "NEC TOKIN Corporation", "NEC-TOKIN" },
-	{ 0x0050C2, 0x3B6000, 0x3B6FFF, "Arecont Vision", "ARECONT-VISION" },
-	{ 0x0050C2, 0x3B7000, 0x3B7FFF, "Mindspeed Technologies", "MINDSPEED-TECHNOLOGIES" },
-	{ 0x0050C2, 0x3B8000, 0x3B8FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x3B9000, 0x3B9FFF, "Gilbarco Autotank AB", "GILBARCO-AUTOTANK-AB" },
-	{ 0x0050C2, 0x3BA000, 0x3BAFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x3BB000, 0x3BBFFF, "IMAGO Technologies GmbH", "IMAGO-TECHNOLOGIES" },
-	{ 0x0050C2, 0x3BC000, 0x3BCFFF, "Tyzx, Inc.", "TYZX" },
-	{ 0x0050C2, 0x3BD000, 0x3BDFFF, "Bigbang L.T.D.", "BIGBANG-L-T-D" },
-	{ 0x0050C2, 0x3BE000, 0x3BEFFF, "Pauly Steuer- und Regelanlagen GmbH & Co. KG", "PAULY-STEUER-UND-REGELANLAGEN" },
-	{ 0x0050C2, 0x3BF000, 0x3BFFFF, "Audio Processing Technology Ltd", "AUDIO-PROCESSING" },
-	{ 0x0050C2, 0x3C0000, 0x3C0FFF, "EDA Industries Pte. Ltd", "EDA-INDUSTRIES-PTE" },
-	{ 0x0050C2, 0x3C1000, 0x3C1FFF, "MicroTek Electronics, Inc.", "MICROTEK-ELECTRONICS" },
-	{ 0x0050C2, 0x3C2000, 0x3C2FFF, "Casabyte Inc.", "CASABYTE" },
-	{ 0x0050C2, 0x3C3000, 0x3C3FFF, "4g Technologies, L.P.", "4G-TECHNOLOGIES-L-P" },
-	{ 0x0050C2, 0x3C4000, 0x3C4FFF, "Sypris Electronics", "SYPRIS-ELECTRONICS" },
-	{ 0x0050C2, 0x3C5000, 0x3C5FFF, "Silicon Optix Canada Inc.", "SILICON-OPTIX-CANADA" },
-	{ 0x0050C2, 0x3C6000, 0x3C6FFF, "Net Optics", "NET-OPTICS" },
-	{ 0x0050C2, 0x3C7000, 0x3C7FFF, "Salent Technologies Ltd", "SALENT-TECHNOLOGIES" },
-	{ 0x0050C2, 0x3C8000, 0x3C8FFF, "Wheels of Zeus Inc.", "WHEELS-OF-ZEUS" },
-	{ 0x0050C2, 0x3C9000, 0x3C9FFF, "Dilax Intelcom AG", "DILAX-INTELCOM" },
-	{ 0x0050C2, 0x3CA000, 0x3CAFFF, "ABB Inc.", "ABB" },
-	{ 0x0050C2, 0x3CB000, 0x3CBFFF, "Analytica GmbH", "ANALYTICA" },
-	{ 0x0050C2, 0x3CC000, 0x3CCFFF, "Linkwell Telesystems Pvt Ltd", "LINKWELL-TELESYSTEMS-PVT" },
-	{ 0x0050C2, 0x3CD000, 0x3CDFFF, "Micro-Measurements", "MICRO-MEASUREMENTS" },
-	{ 0x0050C2, 0x3CE000, 0x3CEFFF, "Ward Leonard Electric Company", "WARD-LEONARD-ELECTRIC-COMPANY" },
-	{ 0x0050C2, 0x3CF000, 0x3CFFFF, "Technovare Systems, Inc.", "TECHNOVARE" },
-	{ 0x0050C2, 0x3D0000, 0x3D0FFF, "Micro-Robotics Limited", "MICRO-ROBOTICS" },
-	{ 0x0050C2, 0x3D1000, 0x3D1FFF, "Braintronics BV", "BRAINTRONICS" },
-	{ 0x0050C2, 0x3D2000, 0x3D2FFF, "Adilec Enginyeria SL", "ADILEC-ENGINYERIA-SL" },
-	{ 0x0050C2, 0x3D3000, 0x3D3FFF, "American LED-gible Inc.", "AMERICAN-LED-GIBLE" },
-	{ 0x0050C2, 0x3D4000, 0x3D4FFF, "Wisnu and Supak Co.,Ltd.", "WISNU-AND-SUPAK" },
-	{ 0x0050C2, 0x3D5000, 0x3D5FFF, "Fluke Biomedical, Radiation Management Services", "FLUKE-BIOMEDICAL-RADIATION-MANAGEMENT-SERVICES" },
-	{ 0x0050C2, 0x3D6000, 0x3D6FFF, "Comlab Inc.", "COMLAB" },
-	{ 0x0050C2, 0x3D7000, 0x3D7FFF, "TTC TELEKOMUNIKACE Ltd", "TTC-TELEKOMUNIKACE" },
-	{ 0x0050C2, 0x3D8000, 0x3D8FFF, "Key Systems , Inc.", "KEY" },
-	{ 0x0050C2, 0x3D9000, 0x3D9FFF, "Bavaria Digital Technik GmbH", "BAVARIA-DIGITAL-TECHNIK" },
-	{ 0x0050C2, 0x3DA000, 0x3DAFFF, "M5 Data Limited", "M5-DATA" },
-	{ 0x0050C2, 0x3DB000, 0x3DBFFF, "Osmetech Inc.", "OSMETECH" },
-	{ 0x0050C2, 0x3DC000, 0x3DCFFF, "3D perception AS", "3D-PERCEPTION-AS" },
-	{ 0x0050C2, 0x3DD000, 0x3DDFFF, "ELMIC GmbH", "ELMIC" },
-	{ 0x0050C2, 0x3DE000, 0x3DEFFF, "ABB Power Technologies S.p.A.  Unità  Operativa SACE (PTMV)", "ABB-POWER-TECHNOLOGIES-S-P-A-UNIT-OPERATIVA-SACE-PTMV" },
-	{ 0x0050C2, 0x3DF000, 0x3DFFFF, "BiODE Inc.", "BIODE" },
-	{ 0x0050C2, 0x3E0000, 0x3E0FFF, "Oy Stinghorn Ltd", "OY-STINGHORN" },
-	{ 0x0050C2, 0x3E1000, 0x3E1FFF, "NeuLion Incorporated", "NEULION-INCORPORATED" },
-	{ 0x0050C2, 0x3E2000, 0x3E2FFF, "SysNova", "SYSNOVA" },
-	{ 0x0050C2, 0x3E3000, 0x3E3FFF, "CSIRO - Division of Exploration and Mining", "CSIRO-DIVISION-OF-EXPLORATION-AND-MINING" },
-	{ 0x0050C2, 0x3E4000, 0x3E4FFF, "CUE, a.s.", "CUE" },
-	{ 0x0050C2, 0x3E5000, 0x3E5FFF, "Vacon Plc", "VACON-PLC" },
-	{ 0x0050C2, 0x3E6000, 0x3E6FFF, "CRDE", "CRDE" },
-	{ 0x0050C2, 0x3E7000, 0x3E7FFF, "Revolution Education Ltd", "REVOLUTION-EDUCATION" },
-	{ 0x0050C2, 0x3E8000, 0x3E8FFF, "Conformative Systems, Inc.", "CONFORMATIVE" },
-	{ 0x0050C2, 0x3E9000, 0x3E9FFF, "MedAvant Healthcare", "MEDAVANT-HEALTHCARE" },
-	{ 0x0050C2, 0x3EA000, 0x3EAFFF, "Alro Information Systems SA", "ALRO-INFORMATION" },
-	{ 0x0050C2, 0x3EB000, 0x3EBFFF, "ISS International", "ISS" },
-	{ 0x0050C2, 0x3EC000, 0x3ECFFF, "Teneros", "TENEROS" },
-	{ 0x0050C2, 0x3ED000, 0x3EDFFF, "The Board Room Inc.", "THE-BOARD-ROOM" },
-	{ 0x0050C2, 0x3EE000, 0x3EEFFF, "Commoca, Inc", "COMMOCA" },
-	{ 0x0050C2, 0x3EF000, 0x3EFFFF, "PAT Industries, DBA Pacific Advanced Technology", "PAT-INDUSTRIES-DBA-PACIFIC-ADVANCED" },
-	{ 0x0050C2, 0x3F0000, 0x3F0FFF, "megatec electronic GmbH", "MEGATEC" },
-	{ 0x0050C2, 0x3F1000, 0x3F1FFF, "Salland Electronics Holding BV", "SALLAND-ELECTRONICS-HOLDING" },
-	{ 0x0050C2, 0x3F2000, 0x3F2FFF, "STL GmbH", "STL" },
-	{ 0x0050C2, 0x3F3000, 0x3F3FFF, "Hitachi Energy Germany AG", "HITACHI-ENERGY-GERMANY" },
-	{ 0x0050C2, 0x3F4000, 0x3F4FFF, "MC TECHNOLOGY GmbH", "MC" },
-	{ 0x0050C2, 0x3F5000, 0x3F5FFF, "Phaedrus Limited", "PHAEDRUS" },
-	{ 0x0050C2, 0x3F6000, 0x3F6FFF, "dAFTdATA Limited", "DAFTDATA" },
-	{ 0x0050C2, 0x3F7000, 0x3F7FFF, "Advantage R&D", "ADVANTAGE-R-D" },
-	{ 0x0050C2, 0x3F8000, 0x3F8FFF, "Superna Ltd", "SUPERNA" },
-	{ 0x0050C2, 0x3F9000, 0x3F9FFF, "Sintium Ltd", "SINTIUM" },
-	{ 0x0050C2, 0x3FA000, 0x3FAFFF, "Tumsan", "TUMSAN" },
-	{ 0x0050C2, 0x3FB000, 0x3FBFFF, "nVent, Schroff GmbH", "NVENT-SCHROFF" },
-	{ 0x0050C2, 0x3FC000, 0x3FCFFF, "Weinberger Deutschland GmbH", "WEINBERGER-DEUTSCHLAND" },
-	{ 0x0050C2, 0x3FD000, 0x3FDFFF, "HARTMANN software GbR", "HARTMANN-SOFTWARE-GBR" },
-	{ 0x0050C2, 0x3FE000, 0x3FEFFF, "HaiVision Systems Inc", "HAIVISION" },
-	{ 0x0050C2, 0x3FF000, 0x3FFFFF, "Cast Iron Systems", "CAST-IRON" },
-	{ 0x0050C2, 0x400000, 0x400FFF, "SmartMotor AS", "SMARTMOTOR-AS" },
-	{ 0x0050C2, 0x401000, 0x401FFF, "Promess Incorporated", "PROMESS-INCORPORATED" },
-	{ 0x0050C2, 0x402000, 0x402FFF, "Numeron Sp. z o.o.", "NUMERON-SP-Z-O-O" },
-	{ 0x0050C2, 0x403000, 0x403FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0x404000, 0x404FFF, "NanShanBridge Co.Ltd", "NANSHANBRIDGE" },
-	{ 0x0050C2, 0x405000, 0x405FFF, "Guralp Systems Limited", "GURALP" },
-	{ 0x0050C2, 0x406000, 0x406FFF, "CoreStreet, Ltd", "CORESTREET" },
-	{ 0x0050C2, 0x407000, 0x407FFF, "AIE Etudes", "AIE-ETUDES" },
-	{ 0x0050C2, 0x408000, 0x408FFF, "TERN, Inc.", "TERN" },
-	{ 0x0050C2, 0x409000, 0x409FFF, "KTEC LTD", "KTEC" },
-	{ 0x0050C2, 0x40A000, 0x40AFFF, "Contec Steuerungstechnik & Automation GmbH", "CONTEC-STEUERUNGSTECHNIK-AUTOMATION" },
-	{ 0x0050C2, 0x40B000, 0x40BFFF, "Center VOSPI JSC", "CENTER-VOSPI-JSC" },
-	{ 0x0050C2, 0x40C000, 0x40CFFF, "Applied Materials UK Ltd", "APPLIED-MATERIALS-UK" },
-	{ 0x0050C2, 0x40D000, 0x40DFFF, "Afonics Fibreoptics Ltd", "AFONICS-FIBREOPTICS" },
-	{ 0x0050C2, 0x40E000, 0x40EFFF, "ads-tec GmbH", "ADS-TEC" },
-	{ 0x0050C2, 0x40F000, 0x40FFFF, "BIR,INC.", "BIR" },
-	{ 0x0050C2, 0x410000, 0x410FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x0050C2, 0x411000, 0x411FFF, "Multimessage Systems Ltd.", "MULTIMESSAGE" },
-	{ 0x0050C2, 0x412000, 0x412FFF, "TSB Solutions Inc.", "TSB-SOLUTIONS" },
-	{ 0x0050C2, 0x413000, 0x413FFF, "Goodrich", "GOODRICH" },
-	{ 0x0050C2, 0x414000, 0x414FFF, "Talleres de Escoriaza SA", "TALLERES-DE-ESCORIAZA" },
-	{ 0x0050C2, 0x415000, 0x415FFF, "SensoTech GmbH", "SENSOTECH" },
-	{ 0x0050C2, 0x416000, 0x416FFF, "SELCO s.r.l.", "SELCO" },
-	{ 0x0050C2, 0x417000, 0x417FFF, "QT systems ab", "QT-AB" },
-	{ 0x0050C2, 0x418000, 0x418FFF, "Planea Oy", "PLANEA-OY" },
-	{ 0x0050C2, 0x419000, 0x419FFF, "Mecsel Oy", "MECSEL-OY" },
-	{ 0x0050C2, 0x41A000, 0x41AFFF, "Bluewater Systems Ltd", "BLUEWATER" },
-	{ 0x0050C2, 0x41B000, 0x41BFFF, "LogiM GmbH Software und Entwicklung", "LOGIM-SOFTWARE-UND-ENTWICKLUNG" },
-	{ 0x0050C2, 0x41C000, 0x41CFFF, "Infrasafe, Inc.", "INFRASAFE" },
-	{ 0x0050C2, 0x41D000, 0x41DFFF, "Altronic, Inc.", "ALTRONIC" },
-	{ 0x0050C2, 0x41E000, 0x41EFFF, "Videotek Sistemas Eletronicos Ltda.", "VIDEOTEK-SISTEMAS-ELETRONICOS-LTDA" },
-	{ 0x0050C2, 0x41F000, 0x41FFFF, "Avionica, Inc", "AVIONICA" },
-	{ 0x0050C2, 0x420000, 0x420FFF, "Boundless Technologies", "BOUNDLESS-TECHNOLOGIES" },
-	{ 0x0050C2, 0x421000, 0x421FFF, "EFSYS", "EFSYS" },
-	{ 0x0050C2, 0x422000, 0x422FFF, "ads-tec GmbH", "ADS-TEC" },
-	{ 0x0050C2, 0x423000, 0x423FFF, "Power-One Inc.", "POWER-ONE" },
-	{ 0x0050C2, 0x424000, 0x424FFF, "Metrolab Technology SA", "METROLAB" },
-	{ 0x0050C2, 0x425000, 0x425FFF, "Pinnacle Technology", "PINNACLE" },
-	{ 0x0050C2, 0x426000, 0x426FFF, "STOM System", "STOM-SYSTEM" },
-	{ 0x0050C2, 0x427000, 0x427FFF, "Scheidt & Bachmann GmbH", "SCHEIDT-BACHMANN" },
-	{ 0x0050C2, 0x428000, 0x428FFF, "Roxar A/S", "ROXAR-A/S" },
-	{ 0x0050C2, 0x429000, 0x429FFF, "Matthews Australasia", "MATTHEWS-AUSTRALASIA" },
-	{ 0x0050C2, 0x42A000, 0x42AFFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x0050C2, 0x42B000, 0x42BFFF, "VLSIP TECHNOLOGIES, INC.", "VLSIP-TECHNOLOGIES" },
-	{ 0x0050C2, 0x42C000, 0x42CFFF, "Trapeze Software Group Inc", "TRAPEZE-SOFTWARE-GROUP" },
-	{ 0x0050C2, 0x42D000, 0x42DFFF, "Argo-Tech", "ARGO-TECH" },
-	{ 0x0050C2, 0x42E000, 0x42EFFF, "Oelmann Elektronik GmbH", "OELMANN-ELEKTRONIK" },
-	{ 0x0050C2, 0x42F000, 0x42FFFF, "Win4NET", "WIN4NET" },
-	{ 0x0050C2, 0x430000, 0x430FFF, "Arcom Digital", "ARCOM-DIGITAL" },
-	{ 0x0050C2, 0x431000, 0x431FFF, "Octatron, Inc.", "OCTATRON" },
-	{ 0x0050C2, 0x432000, 0x432FFF, "Topway Industries Ltd.", "TOPWAY-INDUSTRIES" },
-	{ 0x0050C2, 0x433000, 0x433FFF, "Idetech Europe S.A.", "IDETECH-EUROPE" },
-	{ 0x0050C2, 0x434000, 0x434FFF, "ImperativeNetworks", "IMPERATIVENETWORKS" },
-	{ 0x0050C2, 0x435000, 0x435FFF, "ADATEL TELECOMUNICACIONES S.A.", "ADATEL-TELECOMUNICACIONES" },
-	{ 0x0050C2, 0x436000, 0x436FFF, "Satellite Services BV", "SATELLITE-SERVICES" },
-	{ 0x0050C2, 0x437000, 0x437FFF, "PowerWAN, Inc", "POWERWAN" },
-	{ 0x0050C2, 0x438000, 0x438FFF, "Telecom Protection Technologies Limited", "TELECOM-PROTECTION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x439000, 0x439FFF, "Peleton Photonic Systems", "PELETON-PHOTONIC" },
-	{ 0x0050C2, 0x43A000, 0x43AFFF, "ProDesign GmbH", "PRODESIGN" },
-	{ 0x0050C2, 0x43B000, 0x43BFFF, "A3IP", "A3IP" },
-	{ 0x0050C2, 0x43C000, 0x43CFFF, "Ducommun LaBarge Technologies, Inc", "DUCOMMUN-LABARGE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x43D000, 0x43DFFF, "Ann Arbor Sensor Systems LLC", "ANN-ARBOR-SENSOR" },
-	{ 0x0050C2, 0x43E000, 0x43EFFF, "Coppercom", "COPPERCOM" },
-	{ 0x0050C2, 0x43F000, 0x43FFFF, "ARVOO Imaging Products BV", "ARVOO-IMAGING-PRODUCTS" },
-	{ 0x0050C2, 0x440000, 0x440FFF, "Advanced Modular Computers Ltd.", "ADVANCED-MODULAR-COMPUTERS" },
-	{ 0x0050C2, 0x441000, 0x441FFF, "Sammi Information Systems Co.,Ltd", "SAMMI-INFORMATION" },
-	{ 0x0050C2, 0x442000, 0x442FFF, "Pico Computing, Inc.", "PICO-COMPUTING" },
-	{ 0x0050C2, 0x443000, 0x443FFF, "Pickering Laboratories", "PICKERING-LABORATORIES" },
-	{ 0x0050C2, 0x444000, 0x444FFF, "Offshore Systems Ltd", "OFFSHORE" },
-	{ 0x0050C2, 0x445000, 0x445FFF, "MICRONIC s.r.o.", "MICRONIC-S-R-O" },
-	{ 0x0050C2, 0x446000, 0x446FFF, "Micro Technic A-S", "MICRO-TECHNIC" },
-	{ 0x0050C2, 0x447000, 0x447FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0x448000, 0x448FFF, "Comtech Systems Inc.", "COMTECH" },
-	{ 0x0050C2, 0x449000, 0x449FFF, "BLEILE DATENTECHNIK GmbH", "BLEILE-DATENTECHNIK" },
-	{ 0x0050C2, 0x44A000, 0x44AFFF, "Elettronica Santerno SpA", "ELETTRONICA-SANTERNO-SPA" },
-	{ 0x0050C2, 0x44B000, 0x44BFFF, "Solace Systems, Inc.", "SOLACE" },
-	{ 0x0050C2, 0x44C000, 0x44CFFF, "Computime Systems UK Ltd.", "COMPUTIME-UK" },
-	{ 0x0050C2, 0x44D000, 0x44DFFF, "Electro-Matic Products, Inc.", "ELECTRO-MATIC-PRODUCTS" },
-	{ 0x0050C2, 0x44E000, 0x44EFFF, "QQ Technology,Inc", "QQ" },
-	{ 0x0050C2, 0x44F000, 0x44FFFF, "kippdata GmbH", "KIPPDATA" },
-	{ 0x0050C2, 0x450000, 0x450FFF, "Enconair Ecological Chambers Inc.", "ENCONAIR-ECOLOGICAL-CHAMBERS" },
-	{ 0x0050C2, 0x451000, 0x451FFF, "HAMEG GmbH", "HAMEG" },
-	{ 0x0050C2, 0x452000, 0x452FFF, "Scame Sistemi srl", "SCAME-SISTEMI-SRL" },
-	{ 0x0050C2, 0x453000, 0x453FFF, "Erhardt+Leimer GmbH", "ERHARDT+LEIMER" },
-	{ 0x0050C2, 0x454000, 0x454FFF, "Brivo Systems, LLC", "BRIVO" },
-	{ 0x0050C2, 0x455000, 0x455FFF, "Gogo BA", "GOGO-BA" },
-	{ 0x0050C2, 0x456000, 0x456FFF, "DRDC Valcartier", "DRDC-VALCARTIER" },
-	{ 0x0050C2, 0x457000, 0x457FFF, "Danbridge", "DANBRIDGE" },
-	{ 0x0050C2, 0x458000, 0x458FFF, "HRZ data GmbH", "HRZ-DATA" },
-	{ 0x0050C2, 0x459000, 0x459FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x45A000, 0x45AFFF, "Funkwerk plettac electronic GmbH", "FUNKWERK-PLETTAC" },
-	{ 0x0050C2, 0x45B000, 0x45BFFF, "Matra Electronique", "MATRA-ELECTRONIQUE" },
-	{ 0x0050C2, 0x45C000, 0x45CFFF, "Deister Electronic GmbH", "DEISTER" },
-	{ 0x0050C2, 0x45D000, 0x45DFFF, "Digital Engineering, Inc.", "DIGITAL-ENGINEERING" },
-	{ 0x0050C2, 0x45E000, 0x45EFFF, "Halliburton - Sperry Drilling Service", "HALLIBURTON-SPERRY-DRILLING-SERVICE" },
-	{ 0x0050C2, 0x45F000, 0x45FFFF, "T2C Marketing AB", "T2C-MARKETING-AB" },
-	{ 0x0050C2, 0x460000, 0x460FFF, "Vitelnet", "VITELNET" },
-	{ 0x0050C2, 0x461000, 0x461FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x0050C2, 0x462000, 0x462FFF, "CT Company", "CT-COMPANY" },
-	{ 0x0050C2, 0x463000, 0x463FFF, "Codem Systems, Inc.", "CODEM" },
-	{ 0x0050C2, 0x464000, 0x464FFF, "XYTAC system technologies", "XYTAC-SYSTEM-TECHNOLOGIES" },
-	{ 0x0050C2, 0x465000, 0x465FFF, "PDTS GmbH", "PDTS" },
-	{ 0x0050C2, 0x466000, 0x466FFF, "LONAP Limited", "LONAP" },
-	{ 0x0050C2, 0x467000, 0x467FFF, "United Western Technologies", "UNITED-WESTERN-TECHNOLOGIES" },
-	{ 0x0050C2, 0x468000, 0x468FFF, "Network I/O", "NETWORK-I/O" },
-	{ 0x0050C2, 0x469000, 0x469FFF, "Bipom Electronics, Inc.", "BIPOM-ELECTRONICS" },
-	{ 0x0050C2, 0x46A000, 0x46AFFF, "ISE GmbH", "ISE" },
-	{ 0x0050C2, 0x46B000, 0x46BFFF, "EASYTECH GmbH", "EASYTECH" },
-	{ 0x0050C2, 0x46C000, 0x46CFFF, "CAMCO GmbH", "CAMCO" },
-	{ 0x0050C2, 0x46D000, 0x46DFFF, "Paul Scherrer Institut (PSI)", "PAUL-SCHERRER-INSTITUT-PSI" },
-	{ 0x0050C2, 0x46E000, 0x46EFFF, "Avenir Technologies Inc.", "AVENIR-TECHNOLOGIES" },
-	{ 0x0050C2, 0x46F000, 0x46FFFF, "Neuroware", "NEUROWARE" },
-	{ 0x0050C2, 0x470000, 0x470FFF, "Cybectec inc.", "CYBECTEC" },
-	{ 0x0050C2, 0x471000, 0x471FFF, "Pixtree Technologies, inc.", "PIXTREE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x472000, 0x472FFF, "KOP Ltd", "KOP" },
-	{ 0x0050C2, 0x473000, 0x473FFF, "Sensus Metering Systems Israel", "SENSUS-METERING-ISRAEL" },
-	{ 0x0050C2, 0x474000, 0x474FFF, "Venue 1, Inc.", "VENUE-1" },
-	{ 0x0050C2, 0x475000, 0x475FFF, "ISEPOS GmbH", "ISEPOS" },
-	{ 0x0050C2, 0x476000, 0x476FFF, "Ascon S.p.a.", "ASCON" },
-	{ 0x0050C2, 0x477000, 0x477FFF, "SEV Tidsystem AB", "SEV-TIDSYSTEM-AB" },
-	{ 0x0050C2, 0x478000, 0x478FFF, "Metafix Inc.", "METAFIX" },
-	{ 0x0050C2, 0x479000, 0x479FFF, "Unlimited Bandwidth LLC", "UNLIMITED-BANDWIDTH" },
-	{ 0x0050C2, 0x47A000, 0x47AFFF, "Efficient Channel Coding", "EFFICIENT-CHANNEL-CODING" },
-	{ 0x0050C2, 0x47B000, 0x47BFFF, "Pitney Bowes, Inc", "PITNEY-BOWES" },
-	{ 0x0050C2, 0x47C000, 0x47CFFF, "AUCONET GmbH", "AUCONET" },
-	{ 0x0050C2, 0x47D000, 0x47DFFF, "WIT Inc", "WIT" },
-	{ 0x0050C2, 0x47E000, 0x47EFFF, "Energie Umwelt Systemtechnik GmbH", "ENERGIE-UMWELT-SYSTEMTECHNIK" },
-	{ 0x0050C2, 0x47F000, 0x47FFFF, "BRIT Inc.", "BRIT" },
-	{ 0x0050C2, 0x480000, 0x480FFF, "SELKOM GmbH", "SELKOM" },
-	{ 0x0050C2, 0x481000, 0x481FFF, "Computer Sciences Corp", "SCIENCES" },
-	{ 0x0050C2, 0x482000, 0x482FFF, "PRIAMUS SYSTEM TECHNOLOGIES AG", "PRIAMUS-SYSTEM-TECHNOLOGIES" },
-	{ 0x0050C2, 0x483000, 0x483FFF, "SES", "SES" },
-	{ 0x0050C2, 0x484000, 0x484FFF, "Kooltech LLC", "KOOLTECH" },
-	{ 0x0050C2, 0x485000, 0x485FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x486000, 0x486FFF, "Safegate International AB", "SAFEGATE-AB" },
-	{ 0x0050C2, 0x487000, 0x487FFF, "Eridon Corporation", "ERIDON" },
-	{ 0x0050C2, 0x488000, 0x488FFF, "DA SISTEMI SPA", "DA-SISTEMI-SPA" },
-	{ 0x0050C2, 0x489000, 0x489FFF, "EREE Electronique", "EREE-ELECTRONIQUE" },
-	{ 0x0050C2, 0x48A000, 0x48AFFF, "Mobile Matrix, Inc.", "MOBILE-MATRIX" },
-	{ 0x0050C2, 0x48B000, 0x48BFFF, "ads-tec GmbH", "ADS-TEC" },
-	{ 0x0050C2, 0x48C000, 0x48CFFF, "UNITON AG", "UNITON" },
-	{ 0x0050C2, 0x48D000, 0x48DFFF, "Metron Sp. z o.o.", "METRON-SP-Z-O-O" },
-	{ 0x0050C2, 0x48E000, 0x48EFFF, "Teledyne Tekmar", "TELEDYNE-TEKMAR" },
-	{ 0x0050C2, 0x48F000, 0x48FFFF, "DENGYOSHA co.,LTD.", "DENGYOSHA" },
-	{ 0x0050C2, 0x490000, 0x490FFF, "Cloanto Corporation", "CLOANTO" },
-	{ 0x0050C2, 0x491000, 0x491FFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0x492000, 0x492FFF, "TRAFSYS AS", "TRAFSYS-AS" },
-	{ 0x0050C2, 0x493000, 0x493FFF, "Artis GmbH", "ARTIS" },
-	{ 0x0050C2, 0x494000, 0x494FFF, "Ultimate Technology, Inc.", "ULTIMATE" },
-	{ 0x0050C2, 0x495000, 0x495FFF, "VAZA Elektronik AB", "VAZA-ELEKTRONIK-AB" },
-	{ 0x0050C2, 0x496000, 0x496FFF, "Acutelogic Corporation", "ACUTELOGIC" },
-	{ 0x0050C2, 0x497000, 0x497FFF, "Advanced Driver Information Technology GmbH", "ADVANCED-DRIVER-INFORMATION" },
-	{ 0x0050C2, 0x498000, 0x498FFF, "Quartet Technology, Inc.", "QUARTET" },
-	{ 0x0050C2, 0x499000, 0x499FFF, "Trellia Networks", "TRELLIA-NETWORKS" },
-	{ 0x0050C2, 0x49A000, 0x49AFFF, "TelASIC Communications, Inc.", "TELASIC-COMMUNICATION" },
-	{ 0x0050C2, 0x49B000, 0x49BFFF, "vg controls, inc", "VG-CONTROLS" },
-	{ 0x0050C2, 0x49C000, 0x49CFFF, "Envisacor Technologies Inc.", "ENVISACOR-TECHNOLOGIES" },
-	{ 0x0050C2, 0x49D000, 0x49DFFF, "Critical Link LLC", "CRITICAL-LINK" },
-	{ 0x0050C2, 0x49E000, 0x49EFFF, "Armorlink Co .Ltd", "ARMORLINK" },
-	{ 0x0050C2, 0x49F000, 0x49FFFF, "GCS, Inc", "GCS" },
-	{ 0x0050C2, 0x4A0000, 0x4A0FFF, "Advanced technologies & Engineering (pty) Ltd", "ADVANCED-TECHNOLOGIES-ENGINEERING-PTY" },
-	{ 0x0050C2, 0x4A1000, 0x4A1FFF, "nVent, Schroff GmbH", "NVENT-SCHROFF" },
-	{ 0x0050C2, 0x4A2000, 0x4A2FFF, "SPECS GmbH", "SPECS" },
-	{ 0x0050C2, 0x4A3000, 0x4A3FFF, "Protium Technologies, Inc.", "PROTIUM-TECHNOLOGIES" },
-	{ 0x0050C2, 0x4A4000, 0x4A4FFF, "IEEE P1609 WG", "IEEE-P1609-WG" },
-	{ 0x0050C2, 0x4A5000, 0x4A5FFF, "Teledyne Monitor Labs", "TELEDYNE-MONITOR-LABS" },
-	{ 0x0050C2, 0x4A6000, 0x4A6FFF, "BUYANG ELECTRONICS INDUSTRIAL CO., LTD.", "BUYANG-ELECTRONICS-INDUSTRIAL" },
-	{ 0x0050C2, 0x4A7000, 0x4A7FFF, "iseg Spezialelektronik GmbH", "ISEG-SPEZIALELEKTRONIK" },
-	{ 0x0050C2, 0x4A8000, 0x4A8FFF, "CYJAYA Korea", "CYJAYA-KOREA" },
-	{ 0x0050C2, 0x4A9000, 0x4A9FFF, "Faber Electronics BV", "FABER-ELECTRONICS" },
-	{ 0x0050C2, 0x4AA000, 0x4AAFFF, "HEINEN ELEKTRONIK GmbH", "HEINEN-ELEKTRONIK" },
-	{ 0x0050C2, 0x4AB000, 0x4ABFFF, "JVF Communications Ltd", "JVF-COMMUNICATION" },
-	{ 0x0050C2, 0x4AC000, 0x4ACFFF, "Doramu Co.,Ltd.", "DORAMU" },
-	{ 0x0050C2, 0x4AD000, 0x4ADFFF, "OpenPeak, Inc.", "OPENPEAK" },
-	{ 0x0050C2, 0x4AE000, 0x4AEFFF, "ads-tec GmbH", "ADS-TEC" },
-	{ 0x0050C2, 0x4AF000, 0x4AFFFF, "Orbis Oy", "ORBIS-OY" },
-	{ 0x0050C2, 0x4B0000, 0x4B0FFF, "Esmart Distribution Pte Ltd", "ESMART-DISTRIBUTION-PTE" },
-	{ 0x0050C2, 0x4B1000, 0x4B1FFF, "NSFOCUS Information Technology Co., Ltd.", "NSFOCUS-INFORMATION" },
-	{ 0x0050C2, 0x4B2000, 0x4B2FFF, "TESLA, a.s.", "TESLA" },
-	{ 0x0050C2, 0x4B3000, 0x4B3FFF, "ANSA Corporation", "ANSA" },
-	{ 0x0050C2, 0x4B4000, 0x4B4FFF, "Matrix Audio Designs", "MATRIX-AUDIO-DESIGNS" },
-	{ 0x0050C2, 0x4B5000, 0x4B5FFF, "Valley Tecnologia", "VALLEY-TECNOLOGIA" },
-	{ 0x0050C2, 0x4B6000, 0x4B6FFF, "General Resources Co., LTD.", "GENERAL-RESOURCES" },
-	{ 0x0050C2, 0x4B7000, 0x4B7FFF, "GFI Chrono Time", "GFI-CHRONO-TIME" },
-	{ 0x0050C2, 0x4B8000, 0x4B8FFF, "Shenzhen Hongdian Technologies.,Ltd", "SHENZHEN-HONGDIAN-TECHNOLOGIES" },
-	{ 0x0050C2, 0x4B9000, 0x4B9FFF, "Rose Technologies", "ROSE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x4BA000, 0x4BAFFF, "Mistletoe Technologies", "MISTLETOE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x4BB000, 0x4BBFFF, "Protonic Holland", "PROTONIC-HOLLAND" },
-	{ 0x0050C2, 0x4BC000, 0x4BCFFF, "Saia Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x4BD000, 0x4BDFFF, "Argon ST", "ARGON-ST" },
-	{ 0x0050C2, 0x4BE000, 0x4BEFFF, "Digital Dynamics, Inc.", "DIGITAL-DYNAMICS" },
-	{ 0x0050C2, 0x4BF000, 0x4BFFFF, "Westinghouse Rail Systems Ltd", "WESTINGHOUSE-RAIL" },
-	{ 0x0050C2, 0x4C0000, 0x4C0FFF, "Bio-logic Systems Corp", "BIO-LOGIC" },
-	{ 0x0050C2, 0x4C1000, 0x4C1FFF, "Movaz Networks, Inc.", "MOVAZ-NETWORKS" },
-	{ 0x0050C2, 0x4C2000, 0x4C2FFF, "Elbit Systems Ltd.", "ELBIT" },
-	{ 0x0050C2, 0x4C3000, 0x4C3FFF, "Quantum3D, Inc.", "QUANTUM3D" },
-	{ 0x0050C2, 0x4C4000, 0x4C4FFF, "Black Diamond Video, Inc.", "BLACK-DIAMOND-VIDEO" },
-	{ 0x0050C2, 0x4C5000, 0x4C5FFF, "eXray Broadband Inc.", "EXRAY-BROADBAND" },
-	{ 0x0050C2, 0x4C6000, 0x4C6FFF, "Rubin Ltd.", "RUBIN" },
-	{ 0x0050C2, 0x4C7000, 0x4C7FFF, "Transbit Sp.z o.o.", "TRANSBIT-SP-Z-O-O" },
-	{ 0x0050C2, 0x4C8000, 0x4C8FFF, "Neets", "NEETS" },
-	{ 0x0050C2, 0x4C9000, 0x4C9FFF, "Scirocco AB", "SCIROCCO-AB" },
-	{ 0x0050C2, 0x4CA000, 0x4CAFFF, "Yarg Biometrics Limited", "YARG-BIOMETRICS" },
-	{ 0x0050C2, 0x4CB000, 0x4CBFFF, "Verint Systems Ltd", "VERINT" },
-	{ 0x0050C2, 0x4CC000, 0x4CCFFF, "ImpediMed Limited", "IMPEDIMED" },
-	{ 0x0050C2, 0x4CD000, 0x4CDFFF, "Securiton AG", "SECURITON" },
-	{ 0x0050C2, 0x4CE000, 0x4CEFFF, "Open Date Equipment Limited", "OPEN-DATE-EQUIPMENT" },
-	{ 0x0050C2, 0x4CF000, 0x4CFFFF, "Ziehl-Abegg AG", "ZIEHL-ABEGG" },
-	{ 0x0050C2, 0x4D0000, 0x4D0FFF, "RCS Energy Management Ltd", "RCS-ENERGY-MANAGEMENT" },
-	{ 0x0050C2, 0x4D1000, 0x4D1FFF, "SLICAN sp. z o.o.", "SLICAN-SP-Z-O-O" },
-	{ 0x0050C2, 0x4D2000, 0x4D2FFF, "Twoway CATV SERVICE INC.", "TWOWAY-CATV-SERVICE" },
-	{ 0x0050C2, 0x4D3000, 0x4D3FFF, "ELPROC sp. z o.o.", "ELPROC-SP-Z-O-O" },
-	{ 0x0050C2, 0x4D4000, 0x4D4FFF, "Herholdt Controls srl", "HERHOLDT-CONTROLS-SRL" },
-	{ 0x0050C2, 0x4D5000, 0x4D5FFF, "SEBA Design Pty Ltd", "SEBA-DESIGN-PTY" },
-	{ 0x0050C2, 0x4D6000, 0x4D6FFF, "Ingenieurbüro Schober", "INGENIEURBUERO-SCHOBER" },
-	{ 0x0050C2, 0x4D7000, 0x4D7FFF, "DELTA TAU DATA SYSTEMS, INC.", "DELTA-TAU-DATA" },
-	{ 0x0050C2, 0x4D8000, 0x4D8FFF, "Avantry Ltd.", "AVANTRY" },
-	{ 0x0050C2, 0x4D9000, 0x4D9FFF, "GE Security Kampro", "GE-SECURITY-KAMPRO" },
-	{ 0x0050C2, 0x4DA000, 0x4DAFFF, "MEDIORNET GmbH", "MEDIORNET" },
-	{ 0x0050C2, 0x4DB000, 0x4DBFFF, "Alfing Montagetechnik GmbH", "ALFING-MONTAGETECHNIK" },
-	{ 0x0050C2, 0x4DC000, 0x4DCFFF, "Ace Electronics, Inc.", "ACE-ELECTRONICS" },
-	{ 0x0050C2, 0x4DD000, 0x4DDFFF, "Truteq Wireless (PTY) Ltd.", "TRUTEQ-WIRELESS-PTY" },
-	{ 0x0050C2, 0x4DE000, 0x4DEFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0x4DF000, 0x4DFFFF, "Thermo Electron", "THERMO-ELECTRON" },
-	{ 0x0050C2, 0x4E0000, 0x4E0FFF, "Telematrix", "TELEMATRIX" },
-	{ 0x0050C2, 0x4E1000, 0x4E1FFF, "SS Telecoms CC", "SS-TELECOMS-CC" },
-	{ 0x0050C2, 0x4E2000, 0x4E2FFF, "Applied Research Laboratories: UT", "APPLIED-RESEARCH-LABORATORIES:-UT" },
-	{ 0x0050C2, 0x4E3000, 0x4E3FFF, "Romteck Pty Ltd", "ROMTECK-PTY" },
-	{ 0x0050C2, 0x4E4000, 0x4E4FFF, "Embigence GmbH", "EMBIGENCE" },
-	{ 0x0050C2, 0x4E5000, 0x4E5FFF, "Sedo Systems Ltd", "SEDO" },
-	{ 0x0050C2, 0x4E6000, 0x4E6FFF, "Photonic Bridges  Inc.", "PHOTONIC-BRIDGES" },
-	{ 0x0050C2, 0x4E7000, 0x4E7FFF, "Computerized Elevator Contol", "COMPUTERIZED-ELEVATOR-CONTOL" },
-	{ 0x0050C2, 0x4E8000, 0x4E8FFF, "SATEL sp. z o.o.", "SATEL-SP-Z-O-O" },
-	{ 0x0050C2, 0x4E9000, 0x4E9FFF, "Seachange international", "SEACHANGE" },
-	{ 0x0050C2, 0x4EA000, 0x4EAFFF, "PMC", "PMC" },
-	{ 0x0050C2, 0x4EB000, 0x4EBFFF, "Mandozzi Elettronica SA", "MANDOZZI-ELETTRONICA" },
-	{ 0x0050C2, 0x4EC000, 0x4ECFFF, "Thales Defence and Security Systems GmbH", "THALES-DEFENCE-AND-SECURITY" },
-	{ 0x0050C2, 0x4ED000, 0x4EDFFF, "Lab X Technologies, LLC", "LAB-X-TECHNOLOGIES" },
-	{ 0x0050C2, 0x4EE000, 0x4EEFFF, "Beijing Corelogic Communication Co., Ltd.", "BEIJING-CORELOGIC-COMMUNICATION" },
-	{ 0x0050C2, 0x4EF000, 0x4EFFFF, "Creative Retail Entertainment", "CREATIVE-RETAIL-ENTERTAINMENT" },
-	{ 0x0050C2, 0x4F0000, 0x4F0FFF, "MedAvant Healthcare", "MEDAVANT-HEALTHCARE" },
-	{ 0x0050C2, 0x4F1000, 0x4F1FFF, "Packet Island Inc.", "PACKET-ISLAND" },
-	{ 0x0050C2, 0x4F2000, 0x4F2FFF, "Tantronic AG", "TANTRONIC" },
-	{ 0x0050C2, 0x4F3000, 0x4F3FFF, "Autronica Fire And Securirty", "AUTRONICA-FIRE-AND-SECURIRTY" },
-	{ 0x0050C2, 0x4F4000, 0x4F4FFF, "O2RUN", "O2RUN" },
-	{ 0x0050C2, 0x4F5000, 0x4F5FFF, "Monroe Electronics, Inc.", "MONROE-ELECTRONICS" },
-	{ 0x0050C2, 0x4F6000, 0x4F6FFF, "RealD, Inc.", "REALD" },
-	{ 0x0050C2, 0x4F7000, 0x4F7FFF, "WaveIP", "WAVEIP" },
-	{ 0x0050C2, 0x4F8000, 0x4F8FFF, "Prodco International Inc.", "PRODCO" },
-	{ 0x0050C2, 0x4F9000, 0x4F9FFF, "RTDS Technologies Inc.", "RTDS-TECHNOLOGIES" },
-	{ 0x0050C2, 0x4FA000, 0x4FAFFF, "Cambridge Technology, Inc.", "CAMBRIDGE" },
-	{ 0x0050C2, 0x4FB000, 0x4FBFFF, "BES Technology Group", "BES-GROUP" },
-	{ 0x0050C2, 0x4FC000, 0x4FCFFF, "Hwayoung RF Solution Inc", "HWAYOUNG-RF-SOLUTION" },
-	{ 0x0050C2, 0x4FD000, 0x4FDFFF, "Network Automation mxc AB", "NETWORK-AUTOMATION-MXC-AB" },
-	{ 0x0050C2, 0x4FE000, 0x4FEFFF, "GEM ELETTRONICA Srl", "GEM-ELETTRONICA-SRL" },
-	{ 0x0050C2, 0x4FF000, 0x4FFFFF, "Dakty GmbH", "DAKTY" },
-	{ 0x0050C2, 0x500000, 0x500FFF, "Orenco Systems, Inc.", "ORENCO" },
-	{ 0x0050C2, 0x501000, 0x501FFF, "IBEX UK Limited", "IBEX-UK" },
-	{ 0x0050C2, 0x502000, 0x502FFF, "Criterion Systems Limited", "CRITERION" },
-	{ 0x0050C2, 0x503000, 0x503FFF, "RESPIRONICS INC.", "RESPIRONICS" },
-	{ 0x0050C2, 0x504000, 0x504FFF, "Aphex Systems Ltd.", "APHEX" },
-	{ 0x0050C2, 0x505000, 0x505FFF, "Computerwise, Inc.", "COMPUTERWISE" },
-	{ 0x0050C2, 0x506000, 0x506FFF, "7+ Kft", "7+-KFT" },
-	{ 0x0050C2, 0x507000, 0x507FFF, "Micro Connect Pty Ltd", "MICRO-CONNECT-PTY" },
-	{ 0x0050C2, 0x508000, 0x508FFF, "PUTERCOM ENTERPRISE CO., LTD.", "PUTERCOM" },
-	{ 0x0050C2, 0x509000, 0x509FFF, "Hillcrest Laboratories, Inc.", "HILLCREST-LABORATORIES" },
-	{ 0x0050C2, 0x50A000, 0x50AFFF, "Monitor Business Machines Ltd", "MONITOR-BUSINESS-MACHINES" },
-	{ 0x0050C2, 0x50B000, 0x50BFFF, "Logic Beach Inc", "LOGIC-BEACH" },
-	{ 0x0050C2, 0x50C000, 0x50CFFF, "AIRWISE TECHNOLOGY CO., LTD.", "AIRWISE" },
-	{ 0x0050C2, 0x50D000, 0x50DFFF, "Clearsonics Pty. Ltd.", "CLEARSONICS-PTY" },
-	{ 0x0050C2, 0x50E000, 0x50EFFF, "Fibresavers Corporation", "FIBRESAVERS" },
-	{ 0x0050C2, 0x50F000, 0x50FFFF, "Polystar Instruments AB", "POLYSTAR-INSTRUMENTS-AB" },
-	{ 0x0050C2, 0x510000, 0x510FFF, "Summit Developmen", "SUMMIT-DEVELOPMEN" },
-	{ 0x0050C2, 0x511000, 0x511FFF, "Tecna Srl", "TECNA-SRL" },
-	{ 0x0050C2, 0x512000, 0x512FFF, "Linear Acoustic, Inc", "LINEAR-ACOUSTIC" },
-	{ 0x0050C2, 0x513000, 0x513FFF, "Genie Network Resource Management Inc.", "GENIE-NETWORK-RESOURCE-MANAGEMENT" },
-	{ 0x0050C2, 0x514000, 0x514FFF, "Tadian Electronics Systems LTD", "TADIAN-ELECTRONICS" },
-	{ 0x0050C2, 0x515000, 0x515FFF, "Monaghan Engineering, Inc.", "MONAGHAN-ENGINEERING" },
-	{ 0x0050C2, 0x516000, 0x516FFF, "SOWA ELECTRIC CO., LTD.", "SOWA-ELECTRIC" },
-	{ 0x0050C2, 0x517000, 0x517FFF, "Solid State Logic", "SOLID-STATE-LOGIC" },
-	{ 0x0050C2, 0x518000, 0x518FFF, "Christ Elektronik GmbH", "CHRIST-ELEKTRONIK" },
-	{ 0x0050C2, 0x519000, 0x519FFF, "DBMCORP, Inc.", "DBMCORP" },
-	{ 0x0050C2, 0x51A000, 0x51AFFF, "SpeasTech, Inc.", "SPEASTECH" },
-	{ 0x0050C2, 0x51B000, 0x51BFFF, "Beta Lasermike Ltd", "BETA-LASERMIKE" },
-	{ 0x0050C2, 0x51C000, 0x51CFFF, "TOA Systems", "TOA" },
-	{ 0x0050C2, 0x51D000, 0x51DFFF, "VELUX", "VELUX" },
-	{ 0x0050C2, 0x51E000, 0x51EFFF, "Alcon Technologies", "ALCON-TECHNOLOGIES" },
-	{ 0x0050C2, 0x51F000, 0x51FFFF, "Traquair Data Systems, Inc.", "TRAQUAIR-DATA" },
-	{ 0x0050C2, 0x520000, 0x520FFF, "McCain Traffic Supply", "MCCAIN-TRAFFIC-SUPPLY" },
-	{ 0x0050C2, 0x521000, 0x521FFF, "ARIS TECHNOLOGIES", "ARIS-TECHNOLOGIES" },
-	{ 0x0050C2, 0x522000, 0x522FFF, "Mark IV IDS Corp.", "MARK-IV-IDS" },
-	{ 0x0050C2, 0x523000, 0x523FFF, "AMRDEC Prototype Integration Facility", "AMRDEC-PROTOTYPE-INTEGRATION-FACILITY" },
-	{ 0x0050C2, 0x524000, 0x524FFF, "Motec Pty Ltd", "MOTEC-PTY" },
-	{ 0x0050C2, 0x525000, 0x525FFF, "VASTech", "VASTECH" },
-	{ 0x0050C2, 0x526000, 0x526FFF, "AC SYSTEMS, s.r.o.", "AC-S-R-O" },
-	{ 0x0050C2, 0x527000, 0x527FFF, "IRTrans GmbH", "IRTRANS" },
-	{ 0x0050C2, 0x528000, 0x528FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0x529000, 0x529FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x52A000, 0x52AFFF, "OMNITRONICS PTY LTD", "OMNITRONICS-PTY" },
-	{ 0x0050C2, 0x52B000, 0x52BFFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0x52C000, 0x52CFFF, "VITEC MULTIMEDIA", "VITEC-MULTIMEDIA" },
-	{ 0x0050C2, 0x52D000, 0x52DFFF, "Smartcom-Bulgaria AD", "SMARTCOM-BULGARIA-AD" },
-	{ 0x0050C2, 0x52E000, 0x52EFFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x0050C2, 0x52F000, 0x52FFFF, "Gesellschaft für  Rationalisierung und Rechentechnik mbH", "GESELLSCHAFT-FUER-RATIONALISIERUNG-UND-RECHENTECHNIK" },
-	{ 0x0050C2, 0x530000, 0x530FFF, "Innovation, Institute, Inc", "INNOVATION-INSTITUTE" },
-	{ 0x0050C2, 0x531000, 0x531FFF, "Orion Technologies,LLC", "ORION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x532000, 0x532FFF, "NVE Corporation", "NVE" },
-	{ 0x0050C2, 0x533000, 0x533FFF, "NanShanBridge Co.Ltd", "NANSHANBRIDGE" },
-	{ 0x0050C2, 0x534000, 0x534FFF, "Hyundai J. Comm", "HYUNDAI-J-COMM" },
-	{ 0x0050C2, 0x535000, 0x535FFF, "MMS Servis s.r.o.", "MMS-SERVIS-S-R-O" },
-	{ 0x0050C2, 0x536000, 0x536FFF, "C2 DIAGNOSTICS", "C2-DIAGNOSTICS" },
-	{ 0x0050C2, 0x537000, 0x537FFF, "DST CONTROL AB", "DST-CONTROL-AB" },
-	{ 0x0050C2, 0x538000, 0x538FFF, "EtherTek Circuits", "ETHERTEK-CIRCUITS" },
-	{ 0x0050C2, 0x539000, 0x539FFF, "Detection Technology Inc.", "DETECTION" },
-	{ 0x0050C2, 0x53A000, 0x53AFFF, "Image Control Design Limited", "IMAGE-CONTROL-DESIGN" },
-	{ 0x0050C2, 0x53B000, 0x53BFFF, "Teleks Co. Ltd.", "TELEKS" },
-	{ 0x0050C2, 0x53C000, 0x53CFFF, "Marposs SPA", "MARPOSS-SPA" },
-	{ 0x0050C2, 0x53D000, 0x53DFFF, "Digital communications Technologies", "DIGITAL-COMMUNICATION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x53E000, 0x53EFFF, "Honeywell", "HONEYWELL" },
-	{ 0x0050C2, 0x53F000, 0x53FFFF, "Ellips B.V.", "ELLIPS-B-V" },
-	{ 0x0050C2, 0x540000, 0x540FFF, "Mesure Controle Commande", "MESURE-CONTROLE-COMMANDE" },
-	{ 0x0050C2, 0x541000, 0x541FFF, "WAVES SYSTEM", "WAVES-SYSTEM" },
-	{ 0x0050C2, 0x542000, 0x542FFF, "AVerMedia Technologies, Inc.", "AVERMEDIA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x543000, 0x543FFF, "DIGI SESN AG", "DIGI-SESN" },
-	{ 0x0050C2, 0x544000, 0x544FFF, "Zetera", "ZETERA" },
-	{ 0x0050C2, 0x545000, 0x545FFF, "SecuInfo Co., Ltd.", "SECUINFO" },
-	{ 0x0050C2, 0x546000, 0x546FFF, "Universidad de Chile Facultad de Medicina", "UNIVERSIDAD-DE-CHILE-FACULTAD-DE-MEDICINA" },
-	{ 0x0050C2, 0x547000, 0x547FFF, "BLANKOM Antennentechnik GmbH", "BLANKOM-ANTENNENTECHNIK" },
-	{ 0x0050C2, 0x548000, 0x548FFF, "I.T.W. Betaprint", "I-T-W-BETAPRINT" },
-	{ 0x0050C2, 0x549000, 0x549FFF, "Netsynt S.p.A.", "NETSYNT" },
-	{ 0x0050C2, 0x54A000, 0x54AFFF, "IPTC Tech. Comm. AB", "IPTC-TECH-COMM-AB" },
-	{ 0x0050C2, 0x54B000, 0x54BFFF, "Innopsys", "INNOPSYS" },
-	{ 0x0050C2, 0x54C000, 0x54CFFF, "Sintecnos srl", "SINTECNOS-SRL" },
-	{ 0x0050C2, 0x54D000, 0x54DFFF, "Silent System", "SILENT-SYSTEM" },
-	{ 0x0050C2, 0x54E000, 0x54EFFF, "Convergent Design", "CONVERGENT-DESIGN" },
-	{ 0x0050C2, 0x54F000, 0x54FFFF, "Valtronic SA", "VALTRONIC" },
-	{ 0x0050C2, 0x550000, 0x550FFF, "LJU Automatisierungstechnik GmbH", "LJU-AUTOMATISIERUNGSTECHNIK" },
-	{ 0x0050C2, 0x551000, 0x551FFF, "Innovative Neurotroncs", "INNOVATIVE-NEUROTRONCS" },
-	{ 0x0050C2, 0x552000, 0x552FFF, "Elfiq Inc.", "ELFIQ" },
-	{ 0x0050C2, 0x553000, 0x553FFF, "ATH system", "ATH-SYSTEM" },
-	{ 0x0050C2, 0x554000, 0x554FFF, "Weinzierl Engineering GmbH", "WEINZIERL-ENGINEERING" },
-	{ 0x0050C2, 0x555000, 0x555FFF, "Control Alternative Solutions, Inc.", "CONTROL-ALTERNATIVE-SOLUTIONS" },
-	{ 0x0050C2, 0x556000, 0x556FFF, "Freiburger BlickZentrum", "FREIBURGER-BLICKZENTRUM" },
-	{ 0x0050C2, 0x557000, 0x557FFF, "Netcomsec Co Ltd", "NETCOMSEC" },
-	{ 0x0050C2, 0x558000, 0x558FFF, "Bedo Elektronik GmbH", "BEDO-ELEKTRONIK" },
-	{ 0x0050C2, 0x559000, 0x559FFF, "Fail Safe Solutions LLC", "FAIL-SAFE-SOLUTIONS" },
-	{ 0x0050C2, 0x55A000, 0x55AFFF, "Valde Systems, Inc.", "VALDE" },
-	{ 0x0050C2, 0x55B000, 0x55BFFF, "MATRIX COMSEC PRIVATE LIMITED", "MATRIX-COMSEC-PRIVATE" },
-	{ 0x0050C2, 0x55C000, 0x55CFFF, "ads-tec GmbH", "ADS-TEC" },
-	{ 0x0050C2, 0x55D000, 0x55DFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0x55E000, 0x55EFFF, "HANZAS ELEKTRONIKA, SIA", "HANZAS-ELEKTRONIKA-SIA" },
-	{ 0x0050C2, 0x55F000, 0x55FFFF, "Moog Broad Reach", "MOOG-BROAD-REACH" },
-	{ 0x0050C2, 0x560000, 0x560FFF, "Procon Electronics", "PROCON-ELECTRONICS" },
-	{ 0x0050C2, 0x561000, 0x561FFF, "Seitec Elektronik GmbH", "SEITEC-ELEKTRONIK" },
-	{ 0x0050C2, 0x562000, 0x562FFF, "C21 Systems Limited", "C21" },
-	{ 0x0050C2, 0x563000, 0x563FFF, "ORTRAT, S.L.", "ORTRAT" },
-	{ 0x0050C2, 0x564000, 0x564FFF, "Last Mile Gear", "LAST-MILE-GEAR" },
-	{ 0x0050C2, 0x565000, 0x565FFF, "WORKPOWER TECNOLOGIA ELETRONICA LTDA-EPP", "WORKPOWER-TECNOLOGIA-ELETRONICA-LTDA-EPP" },
-	{ 0x0050C2, 0x566000, 0x566FFF, "ubinetsys.co..ltd", "UBINETSYS" },
-	{ 0x0050C2, 0x567000, 0x567FFF, "Tess GmbH", "TESS" },
-	{ 0x0050C2, 0x568000, 0x568FFF, "GeoFocus, LLC", "GEOFOCUS" },
-	{ 0x0050C2, 0x569000, 0x569FFF, "Twinwin Technplogy Co.,Ltd.", "TWINWIN-TECHNPLOGY" },
-	{ 0x0050C2, 0x56A000, 0x56AFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0x56B000, 0x56BFFF, "Dataton Utvecklings AB", "DATATON-UTVECKLINGS-AB" },
-	{ 0x0050C2, 0x56C000, 0x56CFFF, "Targeted Technologies, LLC", "TARGETED-TECHNOLOGIES" },
-	{ 0x0050C2, 0x56D000, 0x56DFFF, "Computrol Fuel Systems Inc.", "COMPUTROL-FUEL" },
-	{ 0x0050C2, 0x56E000, 0x56EFFF, "LAB-EL ELEKTRONIKA LABORATORYJNA S.J.", "LAB-EL-ELEKTRONIKA-LABORATORYJNA-S-J" },
-	{ 0x0050C2, 0x56F000, 0x56FFFF, "GMA, LLC", "GMA" },
-	{ 0x0050C2, 0x570000, 0x570FFF, "Ellex Medical Pty Ltd", "ELLEX-MEDICAL-PTY" },
-	{ 0x0050C2, 0x571000, 0x571FFF, "Oberon Service srl", "OBERON-SERVICE-SRL" },
-	{ 0x0050C2, 0x572000, 0x572FFF, "Chell Instruments Ltd", "CHELL-INSTRUMENTS" },
-	{ 0x0050C2, 0x573000, 0x573FFF, "DATAMICRO Co., Ltd.", "DATAMICRO" },
-	{ 0x0050C2, 0x574000, 0x574FFF, "Ingeniería AlmudÃ­ S.L.", "INGENIERA-ALMUD" },
-	{ 0x0050C2, 0x575000, 0x575FFF, "SOLYSTIC", "SOLYSTIC" },
-	{ 0x0050C2, 0x576000, 0x576FFF, "Visi-tech Systems Ltd", "VISI-TECH" },
-	{ 0x0050C2, 0x577000, 0x577FFF, "Advanced Software Technologies", "ADVANCED-SOFTWARE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x578000, 0x578FFF, "Delphi Display Systems, Inc.", "DELPHI-DISPLAY" },
-	{ 0x0050C2, 0x579000, 0x579FFF, "Gastager Systemtechnik GmbH", "GASTAGER-SYSTEMTECHNIK" },
-	{ 0x0050C2, 0x57A000, 0x57AFFF, "nVent, Schroff GmbH", "NVENT-SCHROFF" },
-	{ 0x0050C2, 0x57B000, 0x57BFFF, "ptswitch", "PTSWITCH" },
-	{ 0x0050C2, 0x57C000, 0x57CFFF, "éolane", "OLANE" },
-	{ 0x0050C2, 0x57D000, 0x57DFFF, "Sierra Video Systems", "SIERRA-VIDEO" },
-	{ 0x0050C2, 0x57E000, 0x57EFFF, "Digital Way", "DIGITAL-WAY" },
-	{ 0x0050C2, 0x57F000, 0x57FFFF, "Orderite, Inc.", "ORDERITE" },
-	{ 0x0050C2, 0x580000, 0x580FFF, "Buyang Electronics Industrial co.,Ltd.", "BUYANG-ELECTRONICS-INDUSTRIAL" },
-	{ 0x0050C2, 0x581000, 0x581FFF, "Devitech ApS", "DEVITECH-APS" },
-	{ 0x0050C2, 0x582000, 0x582FFF, "AllSun A/S", "ALLSUN-A/S" },
-	{ 0x0050C2, 0x583000, 0x583FFF, "Junger Audio-Studiotechnik GmbH", "JUNGER-AUDIO-STUDIOTECHNIK" },
-	{ 0x0050C2, 0x584000, 0x584FFF, "Toyota Motorsport GmbH", "TOYOTA-MOTORSPORT" },
-	{ 0x0050C2, 0x585000, 0x585FFF, "Wireless Cables Inc.", "WIRELESS-CABLES" },
-	{ 0x0050C2, 0x586000, 0x586FFF, "Genetix Ltd", "GENETIX" },
-	{ 0x0050C2, 0x587000, 0x587FFF, "Dynalco", "DYNALCO" },
-	{ 0x0050C2, 0x588000, 0x588FFF, "Federal Electronics", "FEDERAL-ELECTRONICS" },
-	{ 0x0050C2, 0x589000, 0x589FFF, "HORIBA ABX SAS", "HORIBA-ABX-SAS" },
-	{ 0x0050C2, 0x58A000, 0x58AFFF, "Dixell S.p.a.", "DIXELL" },
-	{ 0x0050C2, 0x58B000, 0x58BFFF, "Innovative Dynamics GmbH", "INNOVATIVE-DYNAMICS" },
-	{ 0x0050C2, 0x58C000, 0x58CFFF, "Lattice Semiconductor Corp. (LPA)", "LATTICE-SEMICONDUCTOR-LPA" },
-	{ 0x0050C2, 0x58D000, 0x58DFFF, "ZAO", "ZAO" },
-	{ 0x0050C2, 0x58E000, 0x58EFFF, "Penny & Giles Aerospace Ltd", "PENNY-GILES-AEROSPACE" },
-	{ 0x0050C2, 0x58F000, 0x58FFFF, "XoIP Systems Pty Ltd", "XOIP-PTY" },
-	{ 0x0050C2, 0x590000, 0x590FFF, "EM Motorsport Ltd", "EM-MOTORSPORT" },
-	{ 0x0050C2, 0x591000, 0x591FFF, "Grosvenor Technology Ltd", "GROSVENOR" },
-	{ 0x0050C2, 0x592000, 0x592FFF, "PaloDEx Group Oy", "PALODEX-GROUP-OY" },
-	{ 0x0050C2, 0x593000, 0x593FFF, "Broadlight", "BROADLIGHT" },
-	{ 0x0050C2, 0x594000, 0x594FFF, "Pixel Velocity, Inc", "PIXEL-VELOCITY" },
-	{ 0x0050C2, 0x595000, 0x595FFF, "Callpod, Inc.", "CALLPOD" },
-	{ 0x0050C2, 0x596000, 0x596FFF, "SPANSION", "SPANSION" },
-	{ 0x0050C2, 0x597000, 0x597FFF, "Nautel LTD", "NAUTEL" },
-	{ 0x0050C2, 0x598000, 0x598FFF, "Bundesamt für Strahlenschutz", "BUNDESAMT-FUER-STRAHLENSCHUTZ" },
-	{ 0x0050C2, 0x599000, 0x599FFF, "Fen Technology Limited", "FEN" },
-	{ 0x0050C2, 0x59A000, 0x59AFFF, "MultiTrode Pty Ltd", "MULTITRODE-PTY" },
-	{ 0x0050C2, 0x59B000, 0x59BFFF, "SAPEC", "SAPEC" },
-	{ 0x0050C2, 0x59C000, 0x59CFFF, "DELSAT GROUP S.A.", "DELSAT-GROUP" },
-	{ 0x0050C2, 0x59D000, 0x59DFFF, "DSS Networks, Inc.", "DSS-NETWORKS" },
-	{ 0x0050C2, 0x59E000, 0x59EFFF, "Legerity", "LEGERITY" },
-	{ 0x0050C2, 0x59F000, 0x59FFFF, "ads-tec GmbH", "ADS-TEC" },
-	{ 0x0050C2, 0x5A0000, 0x5A0FFF, "Rudolph Technologies, Inc.", "RUDOLPH-TECHNOLOGIES" },
-	{ 0x0050C2, 0x5A1000, 0x5A1FFF, "Vestfold Butikkdata AS", "VESTFOLD-BUTIKKDATA-AS" },
-	{ 0x0050C2, 0x5A2000, 0x5A2FFF, "iNET Systems Inc.", "INET" },
-	{ 0x0050C2, 0x5A3000, 0x5A3FFF, "LUMEL S.A.", "LUMEL" },
-	{ 0x0050C2, 0x5A4000, 0x5A4FFF, "Federal State Unitary Enterprise Experimental Factory for Sc", "FEDERAL-STATE-UNITARY-EXPERIMENTAL-FACTORY-FOR-SC" },
-	{ 0x0050C2, 0x5A5000, 0x5A5FFF, "Equipos de Telecomunicación  Optoelectronicos, S.A.", "EQUIPOS-DE-TELECOMUNICACIN-OPTOELECTRONICOS" },
-	{ 0x0050C2, 0x5A6000, 0x5A6FFF, "Plastic Logic", "PLASTIC-LOGIC" },
-	{ 0x0050C2, 0x5A7000, 0x5A7FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x5A8000, 0x5A8FFF, "ETAP NV", "ETAP-NV" },
-	{ 0x0050C2, 0x5A9000, 0x5A9FFF, "AYC Telecom Ltd", "AYC-TELECOM" },
-	{ 0x0050C2, 0x5AA000, 0x5AAFFF, "Transenna AB", "TRANSENNA-AB" },
-	{ 0x0050C2, 0x5AB000, 0x5ABFFF, "Eaton Corp. Electrical Group Data Center Solutions - Pulizzi", "EATON-ELECTRICAL-GROUP-DATA-CENTER-SOLUTIONS-PULIZZI" },
-	{ 0x0050C2, 0x5AC000, 0x5ACFFF, "Kinemetrics, Inc.", "KINEMETRICS" },
-	{ 0x0050C2, 0x5AD000, 0x5ADFFF, "Emcom Systems", "EMCOM" },
-	{ 0x0050C2, 0x5AE000, 0x5AEFFF, "CPS EUROPE B.V.", "CPS-EUROPE-B-V" },
-	{ 0x0050C2, 0x5AF000, 0x5AFFFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x0050C2, 0x5B0000, 0x5B0FFF, "INCOTEC GmbH", "INCOTEC" },
-	{ 0x0050C2, 0x5B1000, 0x5B1FFF, "Rosta Ltd", "ROSTA" },
-	{ 0x0050C2, 0x5B2000, 0x5B2FFF, "Syntronic AB", "SYNTRONIC-AB" },
-	{ 0x0050C2, 0x5B3000, 0x5B3FFF, "HITECOM System", "HITECOM-SYSTEM" },
-	{ 0x0050C2, 0x5B4000, 0x5B4FFF, "Terrascience Systems Ltd.", "TERRASCIENCE" },
-	{ 0x0050C2, 0x5B5000, 0x5B5FFF, "RAFAEL", "RAFAEL" },
-	{ 0x0050C2, 0x5B6000, 0x5B6FFF, "Kontron (BeiJing) Technology Co.,Ltd", "KONTRON-BEIJING" },
-	{ 0x0050C2, 0x5B7000, 0x5B7FFF, "AVerMedia Technologies, Inc.", "AVERMEDIA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x5B8000, 0x5B8FFF, "WestfaliaSurge GmbH", "WESTFALIASURGE" },
-	{ 0x0050C2, 0x5B9000, 0x5B9FFF, "Taiwan Video & Monitor", "TAIWAN-VIDEO-MONITOR" },
-	{ 0x0050C2, 0x5BA000, 0x5BAFFF, "SAIA Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x5BB000, 0x5BBFFF, "UNIC TECHNOLOGIES INC", "UNIC-TECHNOLOGIES" },
-	{ 0x0050C2, 0x5BC000, 0x5BCFFF, "Guangzhou Hui Si Information Technologies Inc.", "GUANGZHOU-HUI-SI-INFORMATION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x5BD000, 0x5BDFFF, "NOMUS COMM SYSTEMS", "NOMUS-COMM" },
-	{ 0x0050C2, 0x5BE000, 0x5BEFFF, "Card Access Services Pty Ltd", "CARD-ACCESS-SERVICES-PTY" },
-	{ 0x0050C2, 0x5BF000, 0x5BFFFF, "Techimp Systems S.r.l.", "TECHIMP" },
-	{ 0x0050C2, 0x5C0000, 0x5C0FFF, "Pyott-Boone Electronics", "PYOTT-BOONE-ELECTRONICS" },
-	{ 0x0050C2, 0x5C1000, 0x5C1FFF, "R. L. Drake Company", "R-L-DRAKE-COMPANY" },
-	{ 0x0050C2, 0x5C2000, 0x5C2FFF, "Intuitive Surgical, Inc", "INTUITIVE-SURGICAL" },
-	{ 0x0050C2, 0x5C3000, 0x5C3FFF, "KS System GmbH", "KS-SYSTEM" },
-	{ 0x0050C2, 0x5C4000, 0x5C4FFF, "ProMik GmbH", "PROMIK" },
-	{ 0x0050C2, 0x5C5000, 0x5C5FFF, "Radiant Imaging, Inc.", "RADIANT-IMAGING" },
-	{ 0x0050C2, 0x5C6000, 0x5C6FFF, "Technische Alternative GmbH", "TECHNISCHE-ALTERNATIVE" },
-	{ 0x0050C2, 0x5C7000, 0x5C7FFF, "InSync Technology Ltd", "INSYNC" },
-	{ 0x0050C2, 0x5C8000, 0x5C8FFF, "Georgia Tech Research Institute", "GEORGIA-TECH-RESEARCH-INSTITUTE" },
-	{ 0x0050C2, 0x5C9000, 0x5C9FFF, "Shenzhen Quanlong Technique Co.Ltd", "SHENZHEN-QUANLONG-TECHNIQUE" },
-	{ 0x0050C2, 0x5CA000, 0x5CAFFF, "Buyang Electronics Industrial Co., Ltd.", "BUYANG-ELECTRONICS-INDUSTRIAL" },
-	{ 0x0050C2, 0x5CB000, 0x5CBFFF, "Kobold Sistemi s.r.l.", "KOBOLD-SISTEMI" },
-	{ 0x0050C2, 0x5CC000, 0x5CCFFF, "Enseo, Inc.", "ENSEO" },
-	{ 0x0050C2, 0x5CD000, 0x5CDFFF, "RADA Electronics Industries Ltd.", "RADA-ELECTRONICS-INDUSTRIES" },
-	{ 0x0050C2, 0x5CE000, 0x5CEFFF, "Roke Manor Research Ltd", "ROKE-MANOR-RESEARCH" },
-	{ 0x0050C2, 0x5CF000, 0x5CFFFF, "Innomed Medical Inc", "INNOMED-MEDICAL" },
-	{ 0x0050C2, 0x5D0000, 0x5D0FFF, "Automata Spa", "AUTOMATA-SPA" },
-	{ 0x0050C2, 0x5D1000, 0x5D1FFF, "Meucci Solutions", "MEUCCI-SOLUTIONS" },
-	{ 0x0050C2, 0x5D2000, 0x5D2FFF, "DA-Design Oy", "DA-DESIGN-OY" },
-	{ 0x0050C2, 0x5D3000, 0x5D3FFF, "Wexiodisk AB", "WEXIODISK-AB" },
-	{ 0x0050C2, 0x5D4000, 0x5D4FFF, "Buyang Electronics Industrial Co., Ltd.", "BUYANG-ELECTRONICS-INDUSTRIAL" },
-	{ 0x0050C2, 0x5D5000, 0x5D5FFF, "Cannon Technologies", "CANNON-TECHNOLOGIES" },
-	{ 0x0050C2, 0x5D6000, 0x5D6FFF, "BioAccess Tecnologia em Biometria Ltda.", "BIOACCESS-TECNOLOGIA-EM-BIOMETRIA-LTDA" },
-	{ 0x0050C2, 0x5D7000, 0x5D7FFF, "Synrad, Inc.", "SYNRAD" },
-	{ 0x0050C2, 0x5D8000, 0x5D8FFF, "TECHNIFOR SAS", "TECHNIFOR-SAS" },
-	{ 0x0050C2, 0x5D9000, 0x5D9FFF, "Crimson Microsystems, Inc.", "CRIMSON-MICROSYSTEMS" },
-	{ 0x0050C2, 0x5DA000, 0x5DAFFF, "TONNA ELECTRONIQUE", "TONNA-ELECTRONIQUE" },
-	{ 0x0050C2, 0x5DB000, 0x5DBFFF, "Secure Systems & Services", "SECURE-SERVICES" },
-	{ 0x0050C2, 0x5DC000, 0x5DCFFF, "RM Michaelides Software & Elektronik GmbH", "RM-MICHAELIDES-SOFTWARE-ELEKTRONIK" },
-	{ 0x0050C2, 0x5DD000, 0x5DDFFF, "SomerData ltd", "SOMERDATA" },
-	{ 0x0050C2, 0x5DE000, 0x5DEFFF, "Magal Senstar Inc.", "MAGAL-SENSTAR" },
-	{ 0x0050C2, 0x5DF000, 0x5DFFFF, "Gnutek Ltd.", "GNUTEK" },
-	{ 0x0050C2, 0x5E0000, 0x5E0FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x5E1000, 0x5E1FFF, "Ittiam Systems (P) Ltd", "ITTIAM-P" },
-	{ 0x0050C2, 0x5E2000, 0x5E2FFF, "PYRAMID Computer GmbH", "PYRAMID" },
-	{ 0x0050C2, 0x5E3000, 0x5E3FFF, "Computechnic AG", "COMPUTECHNIC" },
-	{ 0x0050C2, 0x5E4000, 0x5E4FFF, "Buyang Electronics Industrial Co., Ltd.", "BUYANG-ELECTRONICS-INDUSTRIAL" },
-	{ 0x0050C2, 0x5E5000, 0x5E5FFF, "Stresstech OY", "STRESSTECH-OY" },
-	{ 0x0050C2, 0x5E6000, 0x5E6FFF, "Musatel", "MUSATEL" },
-	{ 0x0050C2, 0x5E7000, 0x5E7FFF, "EADS TEST & SERVICES", "EADS-TEST-SERVICES" },
-	{ 0x0050C2, 0x5E8000, 0x5E8FFF, "Info-Chip Communications Ltd.", "INFO-CHIP-COMMUNICATION" },
-	{ 0x0050C2, 0x5E9000, 0x5E9FFF, "Micro Technology Services Inc.", "MICRO-SERVICES" },
-	{ 0x0050C2, 0x5EA000, 0x5EAFFF, "Micro Elektronische Producten", "MICRO-ELEKTRONISCHE-PRODUCTEN" },
-	{ 0x0050C2, 0x5EB000, 0x5EBFFF, "Garper Telecomunicaciones, S.L.", "GARPER-TELECOMUNICACIONES" },
-	{ 0x0050C2, 0x5EC000, 0x5ECFFF, "ASiS Technologies Pte Ltd", "ASIS-TECHNOLOGIES-PTE" },
-	{ 0x0050C2, 0x5ED000, 0x5EDFFF, "AQUAROTTER A FRANKE COMPANY", "AQUAROTTER-A-FRANKE-COMPANY" },
-	{ 0x0050C2, 0x5EE000, 0x5EEFFF, "Condre Corporation", "CONDRE" },
-	{ 0x0050C2, 0x5EF000, 0x5EFFFF, "pikkerton GmbH", "PIKKERTON" },
-	{ 0x0050C2, 0x5F0000, 0x5F0FFF, "DIAS Infrared GmbH", "DIAS-INFRARED" },
-	{ 0x0050C2, 0x5F1000, 0x5F1FFF, "Technomarine JSC", "TECHNOMARINE-JSC" },
-	{ 0x0050C2, 0x5F2000, 0x5F2FFF, "ESEM Grünau GmbH & Co. KG", "ESEM-GRUENAU" },
-	{ 0x0050C2, 0x5F3000, 0x5F3FFF, "POSNET Polska S.A.", "POSNET-POLSKA" },
-	{ 0x0050C2, 0x5F4000, 0x5F4FFF, "TeamProjects BV", "TEAMPROJECTS" },
-	{ 0x0050C2, 0x5F5000, 0x5F5FFF, "Genesis inc", "GENESIS" },
-	{ 0x0050C2, 0x5F6000, 0x5F6FFF, "CAMBRIDGE CONSULTANTS LTD", "CAMBRIDGE-CONSULTANTS" },
-	{ 0x0050C2, 0x5F7000, 0x5F7FFF, "Metrologic Group", "METROLOGIC-GROUP" },
-	{ 0x0050C2, 0x5F8000, 0x5F8FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0x5F9000, 0x5F9FFF, "ROTHARY Solutions AG", "ROTHARY-SOLUTIONS" },
-	{ 0x0050C2, 0x5FA000, 0x5FAFFF, "LEA d.o.o.", "LEA-D-O-O" },
-	{ 0x0050C2, 0x5FB000, 0x5FBFFF, "All-Systems Electronics Pty Ltd", "ALL-ELECTRONICS-PTY" },
-	{ 0x0050C2, 0x5FC000, 0x5FCFFF, "FilmLight Limited", "FILMLIGHT" },
-	{ 0x0050C2, 0x5FD000, 0x5FDFFF, "MEG Electronic Inc.", "MEG" },
-	{ 0x0050C2, 0x5FE000, 0x5FEFFF, "NOVACOMM LTDA", "NOVACOMM-LTDA" },
-	{ 0x0050C2, 0x5FF000, 0x5FFFFF, "Gazelle Monitoring Systems", "GAZELLE-MONITORING" },
-	{ 0x0050C2, 0x600000, 0x600FFF, "Protec Fire Detection plc", "PROTEC-FIRE-DETECTION-PLC" },
-	{ 0x0050C2, 0x601000, 0x601FFF, "MedAvant Healthcare", "MEDAVANT-HEALTHCARE" },
-	{ 0x0050C2, 0x602000, 0x602FFF, "CHAUVIN ARNOUX", "CHAUVIN-ARNOUX" },
-	{ 0x0050C2, 0x603000, 0x603FFF, "Cerus Corp", "CERUS" },
-	{ 0x0050C2, 0x604000, 0x604FFF, "HCJB Global", "HCJB-GLOBAL" },
-	{ 0x0050C2, 0x605000, 0x605FFF, "Swistec GmbH", "SWISTEC" },
-	{ 0x0050C2, 0x606000, 0x606FFF, "Shenzhen Huazhong Technology Inc", "SHENZHEN-HUAZHONG" },
-	{ 0x0050C2, 0x607000, 0x607FFF, "Telecom FM", "TELECOM-FM" },
-	{ 0x0050C2, 0x608000, 0x608FFF, "Silex Industrial Automation Ltd.", "SILEX-INDUSTRIAL-AUTOMATION" },
-	{ 0x0050C2, 0x609000, 0x609FFF, "Toptech Systems, Inc.", "TOPTECH" },
-	{ 0x0050C2, 0x60A000, 0x60AFFF, "Gradual Tecnologia Ltda.", "GRADUAL-TECNOLOGIA-LTDA" },
-	{ 0x0050C2, 0x60B000, 0x60BFFF, "Shanghai QianJin Electronic Equipment Co. Ltd.", "SHANGHAI-QIANJIN-EQUIPMENT" },
-	{ 0x0050C2, 0x60C000, 0x60CFFF, "IDENTIC AB", "IDENTIC-AB" },
-	{ 0x0050C2, 0x60D000, 0x60DFFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0x60E000, 0x60EFFF, "Automation and Control Technology, Inc.", "AUTOMATION-AND-CONTROL" },
-	{ 0x0050C2, 0x60F000, 0x60FFFF, "Kommunikations- & Sicherheitssysteme Gesellschaft m.b.H", "KOMMUNIKATIONS-SICHERHEITSSYSTEME-GESELLSCHAFT-M-B-H" },
-	{ 0x0050C2, 0x610000, 0x610FFF, "FDT Manufacturing, LLC", "FDT-MANUFACTURING" },
-	{ 0x0050C2, 0x611000, 0x611FFF, "Brookhaven National Laboratory", "BROOKHAVEN-NATIONAL-LABORATORY" },
-	{ 0x0050C2, 0x612000, 0x612FFF, "IHP-GmbH", "IHP" },
-	{ 0x0050C2, 0x613000, 0x613FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x0050C2, 0x614000, 0x614FFF, "Proserv", "PROSERV" },
-	{ 0x0050C2, 0x615000, 0x615FFF, "Axis Electronics", "AXIS-ELECTRONICS" },
-	{ 0x0050C2, 0x616000, 0x616FFF, "Honeywell", "HONEYWELL" },
-	{ 0x0050C2, 0x617000, 0x617FFF, "NARINET, INC.", "NARINET" },
-	{ 0x0050C2, 0x618000, 0x618FFF, "Intergrated Security Mfg. Ltd", "INTERGRATED-SECURITY-MFG" },
-	{ 0x0050C2, 0x619000, 0x619FFF, "Linkbit, Inc.", "LINKBIT" },
-	{ 0x0050C2, 0x61A000, 0x61AFFF, "Communication Components Inc.", "COMMUNICATION-COMPONENTS" },
-	{ 0x0050C2, 0x61B000, 0x61BFFF, "NCI Technologies Inc.", "NCI-TECHNOLOGIES" },
-	{ 0x0050C2, 0x61C000, 0x61CFFF, "TestPro Systems, Inc.", "TESTPRO" },
-	{ 0x0050C2, 0x61D000, 0x61DFFF, "Sutus Inc", "SUTUS" },
-	{ 0x0050C2, 0x61E000, 0x61EFFF, "LESTER ELECTRONICS LTD", "LESTER-ELECTRONICS" },
-	{ 0x0050C2, 0x61F000, 0x61FFFF, "Imagine Communications", "IMAGINE-COMMUNICATION" },
-	{ 0x0050C2, 0x620000, 0x620FFF, "Harman/Becker Automotive Systems GmbH", "HARMAN/BECKER-AUTOMOTIVE" },
-	{ 0x0050C2, 0x621000, 0x621FFF, "Version-T", "VERSION-T" },
-	{ 0x0050C2, 0x622000, 0x622FFF, "2N TELEKOMUNIKACE a.s.", "2N-TELEKOMUNIKACE" },
-	{ 0x0050C2, 0x623000, 0x623FFF, "SAFELINE SL", "SAFELINE-SL" },
-	{ 0x0050C2, 0x624000, 0x624FFF, "Comtest Networks", "COMTEST-NETWORKS" },
-	{ 0x0050C2, 0x625000, 0x625FFF, "EBNeuro SpA", "EBNEURO-SPA" },
-	{ 0x0050C2, 0x626000, 0x626FFF, "Winsys Informatica ltda", "WINSYS-INFORMATICA-LTDA" },
-	{ 0x0050C2, 0x627000, 0x627FFF, "JungleSystem Co., Ltd.", "JUNGLESYSTEM" },
-	{ 0x0050C2, 0x628000, 0x628FFF, "DARE Development", "DARE-DEVELOPMENT" },
-	{ 0x0050C2, 0x629000, 0x629FFF, "MacDonald Humfrey (Products) Ltd", "MACDONALD-HUMFREY-PRODUCTS" },
-	{ 0x0050C2, 0x62A000, 0x62AFFF, "Prisma Engineering srl", "PRISMA-ENGINEERING-SRL" },
-	{ 0x0050C2, 0x62B000, 0x62BFFF, "First Control Systems AB", "FIRST-CONTROL-AB" },
-	{ 0x0050C2, 0x62C000, 0x62CFFF, "AirMatrix, Inc.", "AIRMATRIX" },
-	{ 0x0050C2, 0x62D000, 0x62DFFF, "Procon Electronics", "PROCON-ELECTRONICS" },
-	{ 0x0050C2, 0x62E000, 0x62EFFF, "TDM Ingénierie", "TDM-INGNIERIE" },
-	{ 0x0050C2, 0x62F000, 0x62FFFF, "QES", "QES" },
-	{ 0x0050C2, 0x630000, 0x630FFF, "Aurora Flight Sciences", "AURORA-FLIGHT-SCIENCES" },
-	{ 0x0050C2, 0x631000, 0x631FFF, "Fraunhofer IIS", "FRAUNHOFER-IIS" },
-	{ 0x0050C2, 0x632000, 0x632FFF, "RoseTechnology A/S", "ROSETECHNOLOGY-A/S" },
-	{ 0x0050C2, 0x633000, 0x633FFF, "Rice University", "RICE-UNIVERSITY" },
-	{ 0x0050C2, 0x634000, 0x634FFF, "Sohon Inc", "SOHON" },
-	{ 0x0050C2, 0x635000, 0x635FFF, "Shockfish SA", "SHOCKFISH" },
-	{ 0x0050C2, 0x636000, 0x636FFF, "dSPACE GmbH", "DSPACE" },
-	{ 0x0050C2, 0x637000, 0x637FFF, "Omnitrol Networks, Inc.", "OMNITROL-NETWORKS" },
-	{ 0x0050C2, 0x638000, 0x638FFF, "HUNGAROCOM Telecommunication Ltd.", "HUNGAROCOM-TELECOMMUNICATION" },
-	{ 0x0050C2, 0x639000, 0x639FFF, "Qstreams Networks Inc.", "QSTREAMS-NETWORKS" },
-	{ 0x0050C2, 0x63A000, 0x63AFFF, "3DSP Corporation", "3DSP" },
-	{ 0x0050C2, 0x63B000, 0x63BFFF, "Powis Corporation", "POWIS" },
-	{ 0x0050C2, 0x63C000, 0x63CFFF, "dPict Imaging, Inc.", "DPICT-IMAGING" },
-	{ 0x0050C2, 0x63D000, 0x63DFFF, "IDERs Inc", "IDERS" },
-	{ 0x0050C2, 0x63E000, 0x63EFFF, "T2 Communication Ltd", "T2-COMMUNICATION" },
-	{ 0x0050C2, 0x63F000, 0x63FFFF, "SPEECH TECHNOLOGY CENTER LIMITED", "SPEECH-CENTER" },
-	{ 0x0050C2, 0x640000, 0x640FFF, "IAC", "IAC" },
-	{ 0x0050C2, 0x641000, 0x641FFF, "NEO Information Systems Co., Ltd.", "NEO-INFORMATION" },
-	{ 0x0050C2, 0x642000, 0x642FFF, "Stanton Technologies Sdn Bhd", "STANTON-TECHNOLOGIES" },
-	{ 0x0050C2, 0x643000, 0x643FFF, "Enatel Limited", "ENATEL" },
-	{ 0x0050C2, 0x644000, 0x644FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x645000, 0x645FFF, "The Software Group Limited", "THE-SOFTWARE-GROUP" },
-	{ 0x0050C2, 0x646000, 0x646FFF, "TRUTOUCH TECHNOLOGIES INC", "TRUTOUCH-TECHNOLOGIES" },
-	{ 0x0050C2, 0x647000, 0x647FFF, "R&D Technology Solutionz Limited", "R-D-SOLUTIONZ" },
-	{ 0x0050C2, 0x648000, 0x648FFF, "Fidelity Comtech, Inc.", "FIDELITY-COMTECH" },
-	{ 0x0050C2, 0x649000, 0x649FFF, "Pan-STARRS", "PAN-STARRS" },
-	{ 0x0050C2, 0x64A000, 0x64AFFF, "CPqD", "CPQD" },
-	{ 0x0050C2, 0x64B000, 0x64BFFF, "MangoDSP", "MANGODSP" },
-	{ 0x0050C2, 0x64C000, 0x64CFFF, "CIS Corporation", "CIS" },
-	{ 0x0050C2, 0x64D000, 0x64DFFF, "Tera Information System Labs", "TERA-INFORMATION-SYSTEM-LABS" },
-	{ 0x0050C2, 0x64E000, 0x64EFFF, "Northern Power", "NORTHERN-POWER" },
-	{ 0x0050C2, 0x64F000, 0x64FFFF, "MA Lighting Technology GmbH", "MA-LIGHTING" },
-	{ 0x0050C2, 0x650000, 0x650FFF, "Liquid Breaker, LLC", "LIQUID-BREAKER" },
-	{ 0x0050C2, 0x651000, 0x651FFF, "STAER SPA", "STAER-SPA" },
-	{ 0x0050C2, 0x652000, 0x652FFF, "Wideco Sweden AB", "WIDECO-SWEDEN-AB" },
-	{ 0x0050C2, 0x653000, 0x653FFF, "Doble Engineering", "DOBLE-ENGINEERING" },
-	{ 0x0050C2, 0x654000, 0x654FFF, "PaloDEx Group Oy", "PALODEX-GROUP-OY" },
-	{ 0x0050C2, 0x655000, 0x655FFF, "Physik Instrumente (PI) GmbH&Co.KG", "PHYSIK-INSTRUMENTE-PI" },
-	{ 0x0050C2, 0x656000, 0x656FFF, "LDA Audio Video Profesional", "LDA-AUDIO-VIDEO-PROFESIONAL" },
-	{ 0x0050C2, 0x657000, 0x657FFF, "MONYTEL S.A.", "MONYTEL" },
-	{ 0x0050C2, 0x658000, 0x658FFF, "OpenPKG GmbH", "OPENPKG" },
-	{ 0x0050C2, 0x659000, 0x659FFF, "Dorsett Technologies Inc", "DORSETT-TECHNOLOGIES" },
-	{ 0x0050C2, 0x65A000, 0x65AFFF, "Hisstema AB", "HISSTEMA-AB" },
-	{ 0x0050C2, 0x65B000, 0x65BFFF, "Silverbrook Research", "SILVERBROOK-RESEARCH" },
-	{ 0x0050C2, 0x65C000, 0x65CFFF, "VTZ d.o.o.", "VTZ-D-O-O" },
-	{ 0x0050C2, 0x65D000, 0x65DFFF, "Redfone Communications LLC", "REDFONE-COMMUNICATION" },
-	{ 0x0050C2, 0x65E000, 0x65EFFF, "Cantion A/S", "CANTION-A/S" },
-	{ 0x0050C2, 0x65F000, 0x65FFFF, "Invocon, Inc.", "INVOCON" },
-	{ 0x0050C2, 0x660000, 0x660FFF, "IZISOFT", "IZISOFT" },
-	{ 0x0050C2, 0x661000, 0x661FFF, "P.C.E.", "P-C-E" },
-	{ 0x0050C2, 0x662000, 0x662FFF, "Asia Pacific Card & System Sdn Bhd", "ASIA-PACIFIC-CARD-SYSTEM" },
-	{ 0x0050C2, 0x663000, 0x663FFF, "COE Limited", "COE" },
-	{ 0x0050C2, 0x664000, 0x664FFF, "Westel Wireless Systems", "WESTEL-WIRELESS" },
-	{ 0x0050C2, 0x665000, 0x665FFF, "NetworkSound, Inc", "NETWORKSOUND" },
-	{ 0x0050C2, 0x666000, 0x666FFF, "Xworks NZ Limited", "XWORKS-NZ" },
-	{ 0x0050C2, 0x667000, 0x667FFF, "Vocality International Ltd", "VOCALITY" },
-	{ 0x0050C2, 0x668000, 0x668FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x669000, 0x669FFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x0050C2, 0x66A000, 0x66AFFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0x66B000, 0x66BFFF, "flsystem", "FLSYSTEM" },
-	{ 0x0050C2, 0x66C000, 0x66CFFF, "DESY", "DESY" },
-	{ 0x0050C2, 0x66D000, 0x66DFFF, "DIGITEK S.p.A.", "DIGITEK" },
-	{ 0x0050C2, 0x66E000, 0x66EFFF, "Linear Systems Ltd.", "LINEAR" },
-	{ 0x0050C2, 0x66F000, 0x66FFFF, "Nilan A/S", "NILAN-A/S" },
-	{ 0x0050C2, 0x670000, 0x670FFF, "Naim Audio", "NAIM-AUDIO" },
-	{ 0x0050C2, 0x671000, 0x671FFF, "Skyline Products, Inc", "SKYLINE-PRODUCTS" },
-	{ 0x0050C2, 0x672000, 0x672FFF, "DDS Elettronica srl", "DDS-ELETTRONICA-SRL" },
-	{ 0x0050C2, 0x673000, 0x673FFF, "Ferrari electronic AG", "FERRARI" },
-	{ 0x0050C2, 0x674000, 0x674FFF, "Protech Optronics Co., Ltd.", "PROTECH-OPTRONICS" },
-	{ 0x0050C2, 0x675000, 0x675FFF, "Kenton Research Ltd", "KENTON-RESEARCH" },
-	{ 0x0050C2, 0x676000, 0x676FFF, "EDS", "EDS" },
-	{ 0x0050C2, 0x677000, 0x677FFF, "ProconX Pty Ltd", "PROCONX-PTY" },
-	{ 0x0050C2, 0x678000, 0x678FFF, "IHM", "IHM" },
-	{ 0x0050C2, 0x679000, 0x679FFF, "Industrial Vacuum Systems", "INDUSTRIAL-VACUUM" },
-	{ 0x0050C2, 0x67A000, 0x67AFFF, "CC Systems AB", "CC-AB" },
-	{ 0x0050C2, 0x67B000, 0x67BFFF, "Sparton Electronics", "SPARTON-ELECTRONICS" },
-	{ 0x0050C2, 0x67C000, 0x67CFFF, "Gogo BA", "GOGO-BA" },
-	{ 0x0050C2, 0x67D000, 0x67DFFF, "ESA  Messtechnik GmbH", "ESA-MESSTECHNIK" },
-	{ 0x0050C2, 0x67E000, 0x67EFFF, "SAIA Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x67F000, 0x67FFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x680000, 0x680FFF, "Honey Network Research Limited", "HONEY-NETWORK-RESEARCH" },
-	{ 0x0050C2, 0x681000, 0x681FFF, "Owasys Advanced Wireless Devices", "OWASYS-ADVANCED-WIRELESS-DEVICES" },
-	{ 0x0050C2, 0x682000, 0x682FFF, "Commet AB", "COMMET-AB" },
-	{ 0x0050C2, 0x683000, 0x683FFF, "MEGGITT Safety System", "MEGGITT-SAFETY-SYSTEM" },
-	{ 0x0050C2, 0x684000, 0x684FFF, "REASON Tecnologia S.A.", "REASON-TECNOLOGIA" },
-	{ 0x0050C2, 0x685000, 0x685FFF, "Datamars SA", "DATAMARS" },
-	{ 0x0050C2, 0x686000, 0x686FFF, "ANNAX Anzeigesysteme GmbH", "ANNAX-ANZEIGESYSTEME" },
-	{ 0x0050C2, 0x687000, 0x687FFF, "Access Specialties, Inc", "ACCESS-SPECIALTIES" },
-	{ 0x0050C2, 0x688000, 0x688FFF, "Elk Products", "ELK-PRODUCTS" },
-	{ 0x0050C2, 0x689000, 0x689FFF, "RF Code", "RF-CODE" },
-	{ 0x0050C2, 0x68A000, 0x68AFFF, "Zhuhai Jiahe Electronics Co.,LTD", "ZHUHAI-JIAHE-ELECTRONICS" },
-	{ 0x0050C2, 0x68B000, 0x68BFFF, "SIMTEK INC.", "SIMTEK" },
-	{ 0x0050C2, 0x68C000, 0x68CFFF, "Isochron Inc", "ISOCHRON" },
-	{ 0x0050C2, 0x68D000, 0x68DFFF, "CXR Larus Corporation", "CXR-LARUS" },
-	{ 0x0050C2, 0x68E000, 0x68EFFF, "SELCO", "SELCO" },
-	{ 0x0050C2, 0x68F000, 0x68FFFF, "BERTRONIC SRL", "BERTRONIC-SRL" },
-	{ 0x0050C2, 0x690000, 0x690FFF, "GHL Systems Berhad", "GHL-BERHAD" },
-	{ 0x0050C2, 0x691000, 0x691FFF, "Interopix, Inc.", "INTEROPIX" },
-	{ 0x0050C2, 0x692000, 0x692FFF, "Mate Media Access Technologies", "MATE-MEDIA-ACCESS-TECHNOLOGIES" },
-	{ 0x0050C2, 0x693000, 0x693FFF, "Tech Comm, Inc.", "TECH-COMM" },
-	{ 0x0050C2, 0x694000, 0x694FFF, "Initel srl", "INITEL-SRL" },
-	{ 0x0050C2, 0x695000, 0x695FFF, "Purelink Technology, inc.", "PURELINK" },
-	{ 0x0050C2, 0x696000, 0x696FFF, "Casabyte Inc.", "CASABYTE" },
-	{ 0x0050C2, 0x697000, 0x697FFF, "Monarch Instrument", "MONARCH-INSTRUMENT" },
-	{ 0x0050C2, 0x698000, 0x698FFF, "Navtech Radar Ltd", "NAVTECH-RADAR" },
-	{ 0x0050C2, 0x699000, 0x699FFF, "Bulletendpoints Enterprises Inc", "BULLETENDPOINTS-ENTERPRISES" },
-	{ 0x0050C2, 0x69A000, 0x69AFFF, "StoreTech Limited", "STORETECH" },
-	{ 0x0050C2, 0x69B000, 0x69BFFF, "Tsien (UK) Ltd", "TSIEN-UK" },
-	{ 0x0050C2, 0x69C000, 0x69CFFF, "Bug Labs, Inc.", "BUG-LABS" },
-	{ 0x0050C2, 0x69D000, 0x69DFFF, "Dvation.co.,Ltd", "DVATION" },
-	{ 0x0050C2, 0x69E000, 0x69EFFF, "Ideus AB", "IDEUS-AB" },
-	{ 0x0050C2, 0x69F000, 0x69FFFF, "Total RF, LLC", "TOTAL-RF" },
-	{ 0x0050C2, 0x6A0000, 0x6A0FFF, "GFP Lab S.r.l.", "GFP-LAB" },
-	{ 0x0050C2, 0x6A1000, 0x6A1FFF, "PRICOL LIMITED", "PRICOL" },
-	{ 0x0050C2, 0x6A2000, 0x6A2FFF, "Cadi Scientific Pte Ltd", "CADI-SCIENTIFIC-PTE" },
-	{ 0x0050C2, 0x6A3000, 0x6A3FFF, "CreaTech Electronics Co.", "CREATECH-ELECTRONICS" },
-	{ 0x0050C2, 0x6A4000, 0x6A4FFF, "TELETASK", "TELETASK" },
-	{ 0x0050C2, 0x6A5000, 0x6A5FFF, "EATON FHF Funke + Huster Fernsig GmbH", "EATON-FHF-FUNKE-+-HUSTER-FERNSIG" },
-	{ 0x0050C2, 0x6A6000, 0x6A6FFF, "Victory Concept Industries Ltd.", "VICTORY-CONCEPT-INDUSTRIES" },
-	{ 0x0050C2, 0x6A7000, 0x6A7FFF, "Hoer GmbH & Co. Industrie-Electronic KG", "HOER-INDUSTRIE" },
-	{ 0x0050C2, 0x6A8000, 0x6A8FFF, "Delcan Technologies, Inc", "DELCAN-TECHNOLOGIES" },
-	{ 0x0050C2, 0x6A9000, 0x6A9FFF, "Armida Technologies Corporation", "ARMIDA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x6AA000, 0x6AAFFF, "Ifox - Industria e Comercio Ltda", "IFOX-INDUSTRIA-E-COMERCIO-LTDA" },
-	{ 0x0050C2, 0x6AB000, 0x6ABFFF, "Softwareentwicklung", "SOFTWAREENTWICKLUNG" },
-	{ 0x0050C2, 0x6AC000, 0x6ACFFF, "Thales UK", "THALES-UK" },
-	{ 0x0050C2, 0x6AD000, 0x6ADFFF, "Heim- & Bürokommunikation", "HEIM-BUEROKOMMUNIKATION" },
-	{ 0x0050C2, 0x6AE000, 0x6AEFFF, "Qualisys AB", "QUALISYS-AB" },
-	{ 0x0050C2, 0x6AF000, 0x6AFFFF, "Nanoradio AB", "NANORADIO-AB" },
-	{ 0x0050C2, 0x6B0000, 0x6B0FFF, "Smart Key International Limited", "SMART-KEY" },
-	{ 0x0050C2, 0x6B1000, 0x6B1FFF, "Burk Technology", "BURK" },
-	{ 0x0050C2, 0x6B2000, 0x6B2FFF, "Edgeware AB", "EDGEWARE-AB" },
-	{ 0x0050C2, 0x6B3000, 0x6B3FFF, "4RF Communications Ltd", "4RF-COMMUNICATION" },
-	{ 0x0050C2, 0x6B4000, 0x6B4FFF, "SOMESCA", "SOMESCA" },
-	{ 0x0050C2, 0x6B5000, 0x6B5FFF, "TRIUMF", "TRIUMF" },
-	{ 0x0050C2, 0x6B6000, 0x6B6FFF, "CommoDaS GmbH", "COMMODAS" },
-	{ 0x0050C2, 0x6B7000, 0x6B7FFF, "System LSI CO.Ltd.", "SYSTEM-LSI" },
-	{ 0x0050C2, 0x6B8000, 0x6B8FFF, "Epec Oy", "EPEC-OY" },
-	{ 0x0050C2, 0x6B9000, 0x6B9FFF, "unipo GmbH", "UNIPO" },
-	{ 0x0050C2, 0x6BA000, 0x6BAFFF, "Fertron Controle e Automacao Industrial Ltda.", "FERTRON-CONTROLE-E-AUTOMACAO-INDUSTRIAL-LTDA" },
-	{ 0x0050C2, 0x6BB000, 0x6BBFFF, "Ele.Mag S.r.l.", "ELE-MAG" },
-	{ 0x0050C2, 0x6BC000, 0x6BCFFF, "Paraytec Ltd", "PARAYTEC" },
-	{ 0x0050C2, 0x6BD000, 0x6BDFFF, "Mitron Oy", "MITRON-OY" },
-	{ 0x0050C2, 0x6BE000, 0x6BEFFF, "ESTEC Co.,Ltd.", "ESTEC" },
-	{ 0x0050C2, 0x6BF000, 0x6BFFFF, "Optoplan as", "OPTOPLAN-AS" },
-	{ 0x0050C2, 0x6C0000, 0x6C0FFF, "GLOSTER SANTE EUROPE", "GLOSTER-SANTE-EUROPE" },
-	{ 0x0050C2, 0x6C1000, 0x6C1FFF, "RADIUS Sweden AB", "RADIUS-SWEDEN-AB" },
-	{ 0x0050C2, 0x6C2000, 0x6C2FFF, "HoseoTelnet Inc...", "HOSEOTELNET" },
-	{ 0x0050C2, 0x6C3000, 0x6C3FFF, "iTRACS Corporation", "ITRACS" },
-	{ 0x0050C2, 0x6C4000, 0x6C4FFF, "REXXON GmbH", "REXXON" },
-	{ 0x0050C2, 0x6C5000, 0x6C5FFF, "Oerlikon Contraves AG", "OERLIKON-CONTRAVES" },
-	{ 0x0050C2, 0x6C6000, 0x6C6FFF, "MedAvant Healthcare", "MEDAVANT-HEALTHCARE" },
-	{ 0x0050C2, 0x6C7000, 0x6C7FFF, "QuickCircuit Ltd.", "QUICKCIRCUIT" },
-	{ 0x0050C2, 0x6C8000, 0x6C8FFF, "B&S MEDIA Co., LTD.", "B-S-MEDIA" },
-	{ 0x0050C2, 0x6C9000, 0x6C9FFF, "NETAMI", "NETAMI" },
-	{ 0x0050C2, 0x6CA000, 0x6CAFFF, "Dynamic Hearing Pty Ltd", "DYNAMIC-HEARING-PTY" },
-	{ 0x0050C2, 0x6CB000, 0x6CBFFF, "Stream Processors", "STREAM-PROCESSORS" },
-	{ 0x0050C2, 0x6CC000, 0x6CCFFF, "Widmer Time Recorder Co., Inc.", "WIDMER-TIME-RECORDER" },
-	{ 0x0050C2, 0x6CD000, 0x6CDFFF, "RGM SPA", "RGM-SPA" },
-	{ 0x0050C2, 0x6CE000, 0x6CEFFF, "EMITALL Surveillance S.A,", "EMITALL-SURVEILLANCE" },
-	{ 0x0050C2, 0x6CF000, 0x6CFFFF, "Microway", "MICROWAY" },
-	{ 0x0050C2, 0x6D0000, 0x6D0FFF, "EDS Systemtechnik", "EDS-SYSTEMTECHNIK" },
-	{ 0x0050C2, 0x6D1000, 0x6D1FFF, "Schnick-Schnack-Systems GmbH", "SCHNICK-SCHNACK" },
-	{ 0x0050C2, 0x6D2000, 0x6D2FFF, "Lumistar Incorporated", "LUMISTAR-INCORPORATED" },
-	{ 0x0050C2, 0x6D3000, 0x6D3FFF, "DigiSensory technologies Pty Ltd", "DIGISENSORY-TECHNOLOGIES-PTY" },
-	{ 0x0050C2, 0x6D4000, 0x6D4FFF, "Etani Electronics Co.,Ltd.", "ETANI-ELECTRONICS" },
-	{ 0x0050C2, 0x6D5000, 0x6D5FFF, "Becker Electronics GmbH", "BECKER-ELECTRONICS" },
-	{ 0x0050C2, 0x6D6000, 0x6D6FFF, "ADL Electronics Ltd.", "ADL-ELECTRONICS" },
-	{ 0x0050C2, 0x6D7000, 0x6D7FFF, "Mavenir System, Inc.", "MAVENIR-SYSTEM" },
-	{ 0x0050C2, 0x6D8000, 0x6D8FFF, "BL Healthcare, Inc.", "BL-HEALTHCARE" },
-	{ 0x0050C2, 0x6D9000, 0x6D9FFF, "Ajeco Oy", "AJECO-OY" },
-	{ 0x0050C2, 0x6DA000, 0x6DAFFF, "Techno Fittings S.r.l.", "TECHNO-FITTINGS" },
-	{ 0x0050C2, 0x6DB000, 0x6DBFFF, "Gebhardt Ventilatoren GmbH", "GEBHARDT-VENTILATOREN" },
-	{ 0x0050C2, 0x6DC000, 0x6DCFFF, "L-3 Communications Mobile-Vision, Inc.", "L-3-COMMUNICATION-MOBILE-VISION" },
-	{ 0x0050C2, 0x6DD000, 0x6DDFFF, "Zmicro Systems Inc", "ZMICRO" },
-	{ 0x0050C2, 0x6DE000, 0x6DEFFF, "Laser Tools & Technics Corp.", "LASER-TOOLS-TECHNICS" },
-	{ 0x0050C2, 0x6DF000, 0x6DFFFF, "QR Sciences Ltd", "QR-SCIENCES" },
-	{ 0x0050C2, 0x6E0000, 0x6E0FFF, "FIRSTTRUST Co.,Ltd.", "FIRSTTRUST" },
-	{ 0x0050C2, 0x6E1000, 0x6E1FFF, "NewOnSys Ltd.", "NEWONSYS" },
-	{ 0x0050C2, 0x6E2000, 0x6E2FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x6E3000, 0x6E3FFF, "Miros AS", "MIROS-AS" },
-	{ 0x0050C2, 0x6E4000, 0x6E4FFF, "MangoDSP", "MANGODSP" },
-	{ 0x0050C2, 0x6E5000, 0x6E5FFF, "Boeckeler Instruments, Inc.", "BOECKELER-INSTRUMENTS" },
-	{ 0x0050C2, 0x6E6000, 0x6E6FFF, "Lanetco", "LANETCO" },
-	{ 0x0050C2, 0x6E7000, 0x6E7FFF, "Ace Axis Limited", "ACE-AXIS" },
-	{ 0x0050C2, 0x6E8000, 0x6E8FFF, "Anymax", "ANYMAX" },
-	{ 0x0050C2, 0x6E9000, 0x6E9FFF, "Bando electronic communication Co.Lltd", "BANDO-COMMUNICATION-LLTD" },
-	{ 0x0050C2, 0x6EA000, 0x6EAFFF, "FIRSTEC SA", "FIRSTEC" },
-	{ 0x0050C2, 0x6EB000, 0x6EBFFF, "Harrison Audio, LLC", "HARRISON-AUDIO" },
-	{ 0x0050C2, 0x6EC000, 0x6ECFFF, "Netistix Technologies Corporation", "NETISTIX-TECHNOLOGIES" },
-	{ 0x0050C2, 0x6ED000, 0x6EDFFF, "Sechan Electronics, Inc.", "SECHAN-ELECTRONICS" },
-	{ 0x0050C2, 0x6EE000, 0x6EEFFF, "Interactive Electronic Systems", "INTERACTIVE" },
-	{ 0x0050C2, 0x6EF000, 0x6EFFFF, "Pneumopartners LaenneXT SA", "PNEUMOPARTNERS-LAENNEXT" },
-	{ 0x0050C2, 0x6F0000, 0x6F0FFF, "Stanley Security Solutions, Inc.", "STANLEY-SECURITY-SOLUTIONS" },
-	{ 0x0050C2, 0x6F1000, 0x6F1FFF, "ITS Telecom", "ITS-TELECOM" },
-	{ 0x0050C2, 0x6F2000, 0x6F2FFF, "Laser Electronics Ltd", "LASER-ELECTRONICS" },
-	{ 0x0050C2, 0x6F3000, 0x6F3FFF, "E3Switch LLC", "E3SWITCH" },
-	{ 0x0050C2, 0x6F4000, 0x6F4FFF, "Cryogenic Control Systems, Inc.", "CRYOGENIC-CONTROL" },
-	{ 0x0050C2, 0x6F5000, 0x6F5FFF, "Kitron Microelectronics AB", "KITRON-MICROELECTRONICS-AB" },
-	{ 0x0050C2, 0x6F6000, 0x6F6FFF, "AV SatCom AS", "AV-SATCOM-AS" },
-	{ 0x0050C2, 0x6F7000, 0x6F7FFF, "infoplan Gesellschaftfür  Informationssysteme mbH", "INFOPLAN-GESELLSCHAFTFUER-INFORMATIONSSYSTEME" },
-	{ 0x0050C2, 0x6F8000, 0x6F8FFF, "RV Technology Limited", "RV" },
-	{ 0x0050C2, 0x6F9000, 0x6F9FFF, "Revox GmbH", "REVOX" },
-	{ 0x0050C2, 0x6FA000, 0x6FAFFF, "DCNS", "DCNS" },
-	{ 0x0050C2, 0x6FB000, 0x6FBFFF, "WaveIP", "WAVEIP" },
-	{ 0x0050C2, 0x6FC000, 0x6FCFFF, "Acte Sp. z o.o.", "ACTE-SP-Z-O-O" },
-	{ 0x0050C2, 0x6FD000, 0x6FDFFF, "SAIA Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x6FE000, 0x6FEFFF, "Blue Origin", "BLUE-ORIGIN" },
-	{ 0x0050C2, 0x6FF000, 0x6FFFFF, "St. Michael Strategies Inc.", "ST-MICHAEL-STRATEGIES" },
-	{ 0x0050C2, 0x700000, 0x700FFF, "GEM-MED SL", "GEM-MED-SL" },
-	{ 0x0050C2, 0x701000, 0x701FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x702000, 0x702FFF, "SPM Instrument AB", "SPM-INSTRUMENT-AB" },
-	{ 0x0050C2, 0x703000, 0x703FFF, "SAE IT-systems GmbH & Co. KG", "SAE-IT" },
-	{ 0x0050C2, 0x704000, 0x704FFF, "The Dini Group, La Jolla inc.", "THE-DINI-GROUP-LA-JOLLA" },
-	{ 0x0050C2, 0x705000, 0x705FFF, "Hauch & Bach ApS", "HAUCH-BACH-APS" },
-	{ 0x0050C2, 0x706000, 0x706FFF, "DioDigiWorks. CO., LTD.", "DIODIGIWORKS" },
-	{ 0x0050C2, 0x707000, 0x707FFF, "DTech Labs Inc", "DTECH-LABS" },
-	{ 0x0050C2, 0x708000, 0x708FFF, "Smartek d.o.o.", "SMARTEK-D-O-O" },
-	{ 0x0050C2, 0x709000, 0x709FFF, "RO.VE.R. Laboratories S.p.A", "RO-VE-R-LABORATORIES" },
-	{ 0x0050C2, 0x70A000, 0x70AFFF, "Efficient Channel Coding", "EFFICIENT-CHANNEL-CODING" },
-	{ 0x0050C2, 0x70B000, 0x70BFFF, "B.E.A.R. Solutions (Australasia) Pty, Ltd", "B-E-A-R-SOLUTIONS-AUSTRALASIA-PTY" },
-	{ 0x0050C2, 0x70C000, 0x70CFFF, "Exertus", "EXERTUS" },
-	{ 0x0050C2, 0x70D000, 0x70DFFF, "ela-soft GmbH & Co. KG", "ELA-SOFT" },
-	{ 0x0050C2, 0x70E000, 0x70EFFF, "AUDICO SYSTEMS OY", "AUDICO-OY" },
-	{ 0x0050C2, 0x70F000, 0x70FFFF, "Zumbach Electronic AG", "ZUMBACH" },
-	{ 0x0050C2, 0x710000, 0x710FFF, "Wharton Electronics Ltd", "WHARTON-ELECTRONICS" },
-	{ 0x0050C2, 0x711000, 0x711FFF, "LINKIT S.R.L.", "LINKIT" },
-	{ 0x0050C2, 0x712000, 0x712FFF, "Pasan SA", "PASAN" },
-	{ 0x0050C2, 0x713000, 0x713FFF, "3DX-Ray Limited", "3DX-RAY" },
-	{ 0x0050C2, 0x714000, 0x714FFF, "T.E.AM., S. A.", "T-E-AM-S-A" },
-	{ 0x0050C2, 0x715000, 0x715FFF, "RIEXINGER Elektronik", "RIEXINGER-ELEKTRONIK" },
-	{ 0x0050C2, 0x716000, 0x716FFF, "MITROL S.R.L.", "MITROL" },
-	{ 0x0050C2, 0x717000, 0x717FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x0050C2, 0x718000, 0x718FFF, "illunis LLC", "ILLUNIS" },
-	{ 0x0050C2, 0x719000, 0x719FFF, "ennovatis GmbH", "ENNOVATIS" },
-	{ 0x0050C2, 0x71A000, 0x71AFFF, "Logus Broadband Wireless Solutions Inc.", "LOGUS-BROADBAND-WIRELESS-SOLUTIONS" },
-	{ 0x0050C2, 0x71B000, 0x71BFFF, "ADVA Optical Networking", "ADVA-OPTICAL-NETWORKING" },
-	{ 0x0050C2, 0x71C000, 0x71CFFF, "Elmec Inc.", "ELMEC" },
-	{ 0x0050C2, 0x71D000, 0x71DFFF, "MG s.r.l.", "MG" },
-	{ 0x0050C2, 0x71E000, 0x71EFFF, "ASKI Industrie Elektronik Ges.m.b.H.", "ASKI-INDUSTRIE-ELEKTRONIK-GES-M-B-H" },
-	{ 0x0050C2, 0x71F000, 0x71FFFF, "ASC telecom AG", "ASC-TELECOM" },
-	{ 0x0050C2, 0x720000, 0x720FFF, "Colorado Engineering Inc.", "COLORADO-ENGINEERING" },
-	{ 0x0050C2, 0x721000, 0x721FFF, "Spectrum Communications FZE", "SPECTRUM-COMMUNICATION-FZE" },
-	{ 0x0050C2, 0x722000, 0x722FFF, "Centric TSolve BV", "CENTRIC-TSOLVE" },
-	{ 0x0050C2, 0x723000, 0x723FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA" },
-	{ 0x0050C2, 0x724000, 0x724FFF, "HSC-Regelungstechnik GmbH", "HSC-REGELUNGSTECHNIK" },
-	{ 0x0050C2, 0x725000, 0x725FFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x0050C2, 0x726000, 0x726FFF, "eta systemi CKB", "ETA-SYSTEMI-CKB" },
-	{ 0x0050C2, 0x727000, 0x727FFF, "Pelweckyj Videotechnik GmbH", "PELWECKYJ-VIDEOTECHNIK" },
-	{ 0x0050C2, 0x728000, 0x728FFF, "InterDigital Canada Ltd", "INTERDIGITAL-CANADA" },
-	{ 0x0050C2, 0x729000, 0x729FFF, "SP Controls, Inc", "SP-CONTROLS" },
-	{ 0x0050C2, 0x72A000, 0x72AFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x72B000, 0x72BFFF, "Sequestered Solutions", "SEQUESTERED-SOLUTIONS" },
-	{ 0x0050C2, 0x72C000, 0x72CFFF, "Richard Griessbach Feinmechanik GmbH", "RICHARD-GRIESSBACH-FEINMECHANIK" },
-	{ 0x0050C2, 0x72D000, 0x72DFFF, "Physical Acoustics Corporation", "PHYSICAL-ACOUSTICS" },
-	{ 0x0050C2, 0x72E000, 0x72EFFF, "SNCF EIM PAYS DE LOIRE", "SNCF-EIM-PAYS-DE-LOIRE" },
-	{ 0x0050C2, 0x72F000, 0x72FFFF, "Priority Electronics Ltd", "PRIORITY-ELECTRONICS" },
-	{ 0x0050C2, 0x730000, 0x730FFF, "haber & koenig electronics gmbh", "HABER-KOENIG-ELECTRONICS" },
-	{ 0x0050C2, 0x731000, 0x731FFF, "Spirent Communications", "SPIRENT-COMMUNICATION" },
-	{ 0x0050C2, 0x732000, 0x732FFF, "Schlumberger K.K.", "SCHLUMBERGER-K-K" },
-	{ 0x0050C2, 0x733000, 0x733FFF, "Cimetrics Research Pty Ltd", "CIMETRICS-RESEARCH-PTY" },
-	{ 0x0050C2, 0x734000, 0x734FFF, "CardioMEMS Inc.", "CARDIOMEMS" },
-	{ 0x0050C2, 0x735000, 0x735FFF, "Ant Lamp, Inc", "ANT-LAMP" },
-	{ 0x0050C2, 0x736000, 0x736FFF, "Nika Ltd", "NIKA" },
-	{ 0x0050C2, 0x737000, 0x737FFF, "Teradici Corporation", "TERADICI" },
-	{ 0x0050C2, 0x738000, 0x738FFF, "Miracom Technology Co., Ltd.", "MIRACOM" },
-	{ 0x0050C2, 0x739000, 0x739FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0x73A000, 0x73AFFF, "Naturela Ltd.", "NATURELA" },
-	{ 0x0050C2, 0x73B000, 0x73BFFF, "On Air Networks", "ON-AIR-NETWORKS" },
-	{ 0x0050C2, 0x73C000, 0x73CFFF, "Simicon", "SIMICON" },
-	{ 0x0050C2, 0x73D000, 0x73DFFF, "cryptiris", "CRYPTIRIS" },
-	{ 0x0050C2, 0x73E000, 0x73EFFF, "Quantec Networks GmbH", "QUANTEC-NETWORKS" },
-	{ 0x0050C2, 0x73F000, 0x73FFFF, "MEDAV GmbH", "MEDAV" },
-	{ 0x0050C2, 0x740000, 0x740FFF, "McQuay China", "MCQUAY-CHINA" },
-	{ 0x0050C2, 0x741000, 0x741FFF, "Dain", "DAIN" },
-	{ 0x0050C2, 0x742000, 0x742FFF, "Fantuzzi Reggiane", "FANTUZZI-REGGIANE" },
-	{ 0x0050C2, 0x743000, 0x743FFF, "Elektro-Top 3000 Ltd.", "ELEKTRO-TOP-3000" },
-	{ 0x0050C2, 0x744000, 0x744FFF, "Avonaco Systems, Inc.", "AVONACO" },
-	{ 0x0050C2, 0x745000, 0x745FFF, "ACISA", "ACISA" },
-	{ 0x0050C2, 0x746000, 0x746FFF, "Realtronix Company", "REALTRONIX-COMPANY" },
-	{ 0x0050C2, 0x747000, 0x747FFF, "CDSA Dam Neck", "CDSA-DAM-NECK" },
-	{ 0x0050C2, 0x748000, 0x748FFF, "Letechnic Ltd", "LETECHNIC" },
-	{ 0x0050C2, 0x749000, 0x749FFF, "Affolter Technologies SA", "AFFOLTER-TECHNOLOGIES" },
-	{ 0x0050C2, 0x74A000, 0x74AFFF, "MONITOR ELECTRONICS LTD", "MONITOR-ELECTRONICS" },
-	{ 0x0050C2, 0x74B000, 0x74BFFF, "STAR-Dundee Ltd", "STAR-DUNDEE" },
-	{ 0x0050C2, 0x74C000, 0x74CFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x74D000, 0x74DFFF, "Beceem Communications, Inc.", "BECEEM-COMMUNICATION" },
-	{ 0x0050C2, 0x74E000, 0x74EFFF, "TRONICO", "TRONICO" },
-	{ 0x0050C2, 0x74F000, 0x74FFFF, "German Technologies", "GERMAN-TECHNOLOGIES" },
-	{ 0x0050C2, 0x750000, 0x750FFF, "Brightlights Intellectual Property Ltd", "BRIGHTLIGHTS-INTELLECTUAL-PROPERTY" },
-	{ 0x0050C2, 0x751000, 0x751FFF, "e&s Engineering & Software GmbH", "E-S-ENGINEERING-SOFTWARE" },
-	{ 0x0050C2, 0x752000, 0x752FFF, "LOBER, S.A.", "LOBER" },
-	{ 0x0050C2, 0x753000, 0x753FFF, "ABB", "ABB" },
-	{ 0x0050C2, 0x754000, 0x754FFF, "Abeo Corporation", "ABEO" },
-	{ 0x0050C2, 0x755000, 0x755FFF, "Teletek Electronics", "TELETEK-ELECTRONICS" },
-	{ 0x0050C2, 0x756000, 0x756FFF, "Chesapeake Sciences Corp", "CHESAPEAKE-SCIENCES" },
-	{ 0x0050C2, 0x757000, 0x757FFF, "E S P Technologies Ltd", "E-S-P-TECHNOLOGIES" },
-	{ 0x0050C2, 0x758000, 0x758FFF, "AixSolve GmbH", "AIXSOLVE" },
-	{ 0x0050C2, 0x759000, 0x759FFF, "Sequentric Energy Systems, LLC", "SEQUENTRIC-ENERGY" },
-	{ 0x0050C2, 0x75A000, 0x75AFFF, "Gaisler Research AB", "GAISLER-RESEARCH-AB" },
-	{ 0x0050C2, 0x75B000, 0x75BFFF, "DMT System S.p.A.", "DMT-SYSTEM" },
-	{ 0x0050C2, 0x75C000, 0x75CFFF, "STÖRK-TRONIC Störk GmbH&Co. KG", "STOERK-TRONIC-STOERK" },
-	{ 0x0050C2, 0x75D000, 0x75DFFF, "Fluid Analytics, Inc.", "FLUID-ANALYTICS" },
-	{ 0x0050C2, 0x75E000, 0x75EFFF, "Sky-Skan, Incorporated", "SKY-SKAN-INCORPORATED" },
-	{ 0x0050C2, 0x75F000, 0x75FFFF, "B. Rexroth the identity company GmbH", "B-REXROTH-THE-IDENTITY-COMPANY" },
-	{ 0x0050C2, 0x760000, 0x760FFF, "AR'S CO., LTD.", "AR-S" },
-	{ 0x0050C2, 0x761000, 0x761FFF, "Elbit Systems of America", "ELBIT-OF-AMERICA" },
-	{ 0x0050C2, 0x762000, 0x762FFF, "Assembly Contracts Limited", "ASSEMBLY-CONTRACTS" },
-	{ 0x0050C2, 0x763000, 0x763FFF, "XtendWave", "XTENDWAVE" },
-	{ 0x0050C2, 0x764000, 0x764FFF, "ARGUS-SPECTRUM", "ARGUS-SPECTRUM" },
-	{ 0x0050C2, 0x765000, 0x765FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x766000, 0x766FFF, "Gutermann Technology GmbH", "GUTERMANN" },
-	{ 0x0050C2, 0x767000, 0x767FFF, "EID", "EID" },
-	{ 0x0050C2, 0x768000, 0x768FFF, "Control Service do Brasil Ltda", "CONTROL-SERVICE-DO-BRASIL-LTDA" },
-	{ 0x0050C2, 0x769000, 0x769FFF, "BES GmbH", "BES" },
-	{ 0x0050C2, 0x76A000, 0x76AFFF, "Digidrive Audio Limited", "DIGIDRIVE-AUDIO" },
-	{ 0x0050C2, 0x76B000, 0x76BFFF, "Putercom Enterprise Co., LTD.", "PUTERCOM" },
-	{ 0x0050C2, 0x76C000, 0x76CFFF, "EFG CZ spol. s r.o.", "EFG-CZ-SPOL-S-R-O" },
-	{ 0x0050C2, 0x76D000, 0x76DFFF, "Mobilisme", "MOBILISME" },
-	{ 0x0050C2, 0x76E000, 0x76EFFF, "Crinia Corporation", "CRINIA" },
-	{ 0x0050C2, 0x76F000, 0x76FFFF, "Control and Robotics Solutions", "CONTROL-AND-ROBOTICS-SOLUTIONS" },
-	{ 0x0050C2, 0x770000, 0x770FFF, "Cadex Electronics Inc.", "CADEX-ELECTRONICS" },
-	{ 0x0050C2, 0x771000, 0x771FFF, "ZigBee Alliance", "ZIGBEE-ALLIANCE" },
-	{ 0x0050C2, 0x772000, 0x772FFF, "IES Elektronikentwicklung", "IES-ELEKTRONIKENTWICKLUNG" },
-	{ 0x0050C2, 0x773000, 0x773FFF, "Pointe Conception Medical Inc.", "POINTE-CONCEPTION-MEDICAL" },
-	{ 0x0050C2, 0x774000, 0x774FFF, "GeoSIG Ltd.", "GEOSIG" },
-	{ 0x0050C2, 0x775000, 0x775FFF, "Laserdyne Technologies", "LASERDYNE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x776000, 0x776FFF, "Integrated Security Corporation", "INTEGRATED-SECURITY" },
-	{ 0x0050C2, 0x777000, 0x777FFF, "Euro Display Srl", "EURO-DISPLAY-SRL" },
-	{ 0x0050C2, 0x778000, 0x778FFF, "SunGard Vivista", "SUNGARD-VIVISTA" },
-	{ 0x0050C2, 0x779000, 0x779FFF, "Coral Telecom Ltd", "CORAL-TELECOM" },
-	{ 0x0050C2, 0x77A000, 0x77AFFF, "Smith Meter, Inc", "SMITH-METER" },
-	{ 0x0050C2, 0x77B000, 0x77BFFF, "Itibia Technologies", "ITIBIA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x77C000, 0x77CFFF, "ATEC SRL", "ATEC-SRL" },
-	{ 0x0050C2, 0x77D000, 0x77DFFF, "Lincoln Industrial", "LINCOLN-INDUSTRIAL" },
-	{ 0x0050C2, 0x77E000, 0x77EFFF, "Cominfo, Inc.", "COMINFO" },
-	{ 0x0050C2, 0x77F000, 0x77FFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0x780000, 0x780FFF, "IQ Solutions GmbH & Co. KG", "IQ-SOLUTIONS" },
-	{ 0x0050C2, 0x781000, 0x781FFF, "Starling Advanced Communications", "STARLING-ADVANCED-COMMUNICATION" },
-	{ 0x0050C2, 0x782000, 0x782FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x783000, 0x783FFF, "NORMA systems GmbH", "NORMA" },
-	{ 0x0050C2, 0x784000, 0x784FFF, "Lewis Controls Inc.", "LEWIS-CONTROLS" },
-	{ 0x0050C2, 0x785000, 0x785FFF, "Icon Time Systems", "ICON-TIME" },
-	{ 0x0050C2, 0x786000, 0x786FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x787000, 0x787FFF, "Austco Marketing & Service (USA) ltd.", "AUSTCO-MARKETING-SERVICE-USA" },
-	{ 0x0050C2, 0x788000, 0x788FFF, "HOSA TECHNOLOGY, INC.", "HOSA" },
-	{ 0x0050C2, 0x789000, 0x789FFF, "Rosslare Enterprises Limited", "ROSSLARE-ENTERPRISES" },
-	{ 0x0050C2, 0x78A000, 0x78AFFF, "LEVEL TELECOM", "LEVEL-TELECOM" },
-	{ 0x0050C2, 0x78B000, 0x78BFFF, "OMICRON electronics GmbH", "OMICRON-ELECTRONICS" },
-	{ 0x0050C2, 0x78C000, 0x78CFFF, "Giga-tronics, Inc.", "GIGA-TRONICS" },
-	{ 0x0050C2, 0x78D000, 0x78DFFF, "Telairity", "TELAIRITY" },
-	{ 0x0050C2, 0x78E000, 0x78EFFF, "GLOBALCOM ENGINEERING SRL", "GLOBALCOM-ENGINEERING-SRL" },
-	{ 0x0050C2, 0x78F000, 0x78FFFF, "ELMAR electronic", "ELMAR" },
-	{ 0x0050C2, 0x790000, 0x790FFF, "GE Security-Kampro", "GE-SECURITY-KAMPRO" },
-	{ 0x0050C2, 0x791000, 0x791FFF, "M Squared Lasers Limited", "M-SQUARED-LASERS" },
-	{ 0x0050C2, 0x792000, 0x792FFF, "SMARTRO Co.,Ltd.", "SMARTRO" },
-	{ 0x0050C2, 0x793000, 0x793FFF, "Enertex Bayern GmbH", "ENERTEX-BAYERN" },
-	{ 0x0050C2, 0x794000, 0x794FFF, "COMSONICS, INC.", "COMSONICS" },
-	{ 0x0050C2, 0x795000, 0x795FFF, "Ameli Spa", "AMELI-SPA" },
-	{ 0x0050C2, 0x796000, 0x796FFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x0050C2, 0x797000, 0x797FFF, "Tiefenbach Control Systems GmbH", "TIEFENBACH-CONTROL" },
-	{ 0x0050C2, 0x798000, 0x798FFF, "Indefia", "INDEFIA" },
-	{ 0x0050C2, 0x799000, 0x799FFF, "AAVD", "AAVD" },
-	{ 0x0050C2, 0x79A000, 0x79AFFF, "JMC America, LLC", "JMC-AMERICA" },
-	{ 0x0050C2, 0x79B000, 0x79BFFF, "Schniewindt GmbH & Co. KG", "SCHNIEWINDT" },
-	{ 0x0050C2, 0x79C000, 0x79CFFF, "Vital Systems Inc", "VITAL" },
-	{ 0x0050C2, 0x79D000, 0x79DFFF, "MiraTrek", "MIRATREK" },
-	{ 0x0050C2, 0x79E000, 0x79EFFF, "Benshaw Canada Controls, Inc.", "BENSHAW-CANADA-CONTROLS" },
-	{ 0x0050C2, 0x79F000, 0x79FFFF, "ZAO NPC", "ZAO-NPC" },
-	{ 0x0050C2, 0x7A0000, 0x7A0FFF, "MedAvant Healthcare", "MEDAVANT-HEALTHCARE" },
-	{ 0x0050C2, 0x7A1000, 0x7A1FFF, "Field Design Service", "FIELD-DESIGN-SERVICE" },
-	{ 0x0050C2, 0x7A2000, 0x7A2FFF, "RaySat Israel LTD", "RAYSAT-ISRAEL" },
-	{ 0x0050C2, 0x7A3000, 0x7A3FFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0x7A4000, 0x7A4FFF, "Calibre UK LTD", "CALIBRE-UK" },
-	{ 0x0050C2, 0x7A5000, 0x7A5FFF, "Quantum Medical Imaging", "QUANTUM-MEDICAL-IMAGING" },
-	{ 0x0050C2, 0x7A6000, 0x7A6FFF, "ASIANA IDT", "ASIANA-IDT" },
-	{ 0x0050C2, 0x7A7000, 0x7A7FFF, "Guidance Navigation Limited", "GUIDANCE-NAVIGATION" },
-	{ 0x0050C2, 0x7A8000, 0x7A8FFF, "Integrated Design Tools, Inc.", "INTEGRATED-DESIGN-TOOLS" },
-	{ 0x0050C2, 0x7A9000, 0x7A9FFF, "DELTA TAU DATA SYSTEMS, INC.", "DELTA-TAU-DATA" },
-	{ 0x0050C2, 0x7AA000, 0x7AAFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0x7AB000, 0x7ABFFF, "General Microsystems Sdn Bhd", "GENERAL-MICROSYSTEMS" },
-	{ 0x0050C2, 0x7AC000, 0x7ACFFF, "IUSA SA DE CV", "IUSA-DE-CV" },
-	{ 0x0050C2, 0x7AD000, 0x7ADFFF, "Turun Turvatekniikka Oy", "TURUN-TURVATEKNIIKKA-OY" },
-	{ 0x0050C2, 0x7AE000, 0x7AEFFF, "Global Tel-Link", "GLOBAL-TEL-LINK" },
-	{ 0x0050C2, 0x7AF000, 0x7AFFFF, "C2 Microsystems", "C2-MICROSYSTEMS" },
-	{ 0x0050C2, 0x7B0000, 0x7B0FFF, "IMP Telekom", "IMP-TELEKOM" },
-	{ 0x0050C2, 0x7B1000, 0x7B1FFF, "ATEME", "ATEME" },
-	{ 0x0050C2, 0x7B2000, 0x7B2FFF, "A.D.I Video technologies", "A-D-I-VIDEO-TECHNOLOGIES" },
-	{ 0x0050C2, 0x7B3000, 0x7B3FFF, "Elmec,  Inc.", "ELMEC" },
-	{ 0x0050C2, 0x7B4000, 0x7B4FFF, "T 1 Engineering", "T-1-ENGINEERING" },
-	{ 0x0050C2, 0x7B5000, 0x7B5FFF, "DIT-MCO International", "DIT-MCO" },
-	{ 0x0050C2, 0x7B6000, 0x7B6FFF, "Alstom (Schweiz) AG", "ALSTOM-SCHWEIZ" },
-	{ 0x0050C2, 0x7B7000, 0x7B7FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0x7B8000, 0x7B8FFF, "Design 2000 Pty Ltd", "DESIGN-2000-PTY" },
-	{ 0x0050C2, 0x7B9000, 0x7B9FFF, "Technovare Systems, Inc.", "TECHNOVARE" },
-	{ 0x0050C2, 0x7BA000, 0x7BAFFF, "Infodev Electronic Designers Intl.", "INFODEV-DESIGNERS-INTL" },
-	{ 0x0050C2, 0x7BB000, 0x7BBFFF, "InRay Solutions Ltd.", "INRAY-SOLUTIONS" },
-	{ 0x0050C2, 0x7BC000, 0x7BCFFF, "EIDOS SPA", "EIDOS-SPA" },
-	{ 0x0050C2, 0x7BD000, 0x7BDFFF, "PROMATE ELECTRONIC CO.LTD", "PROMATE" },
-	{ 0x0050C2, 0x7BE000, 0x7BEFFF, "Powerlinx, Inc.", "POWERLINX" },
-	{ 0x0050C2, 0x7BF000, 0x7BFFFF, "Zoe Medical", "ZOE-MEDICAL" },
-	{ 0x0050C2, 0x7C0000, 0x7C0FFF, "European Industrial Electronics B.V.", "EUROPEAN-INDUSTRIAL-ELECTRONICS-B-V" },
-	{ 0x0050C2, 0x7C1000, 0x7C1FFF, "Primary Integration Encorp LLC", "PRIMARY-INTEGRATION-ENCORP" },
-	{ 0x0050C2, 0x7C2000, 0x7C2FFF, "DSR Information Technologies Ltd.", "DSR-INFORMATION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x7C3000, 0x7C3FFF, "AST INCORPORATED", "AST-INCORPORATED" },
-	{ 0x0050C2, 0x7C4000, 0x7C4FFF, "MoBaCon", "MOBACON" },
-	{ 0x0050C2, 0x7C5000, 0x7C5FFF, "Venture Research Inc.", "VENTURE-RESEARCH" },
-	{ 0x0050C2, 0x7C6000, 0x7C6FFF, "SL Audio A/S", "SL-AUDIO-A/S" },
-	{ 0x0050C2, 0x7C7000, 0x7C7FFF, "Pyrosequencing AB", "PYROSEQUENCING-AB" },
-	{ 0x0050C2, 0x7C8000, 0x7C8FFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0x7C9000, 0x7C9FFF, "Bluebell Opticom Limited", "BLUEBELL-OPTICOM" },
-	{ 0x0050C2, 0x7CA000, 0x7CAFFF, "CEDAR Audio Ltd", "CEDAR-AUDIO" },
-	{ 0x0050C2, 0x7CB000, 0x7CBFFF, "ViewPlus Technologies, Inc.", "VIEWPLUS-TECHNOLOGIES" },
-	{ 0x0050C2, 0x7CC000, 0x7CCFFF, "SWECO JAPS AB", "SWECO-JAPS-AB" },
-	{ 0x0050C2, 0x7CD000, 0x7CDFFF, "Precision MicroControl Corporation", "PRECISION-MICROCONTROL" },
-	{ 0x0050C2, 0x7CE000, 0x7CEFFF, "Gogo BA", "GOGO-BA" },
-	{ 0x0050C2, 0x7CF000, 0x7CFFFF, "Emitech Corporation", "EMITECH" },
-	{ 0x0050C2, 0x7D0000, 0x7D0FFF, "Radar Tronic ltd.", "RADAR-TRONIC" },
-	{ 0x0050C2, 0x7D1000, 0x7D1FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x7D2000, 0x7D2FFF, "Bittitalo Oy", "BITTITALO-OY" },
-	{ 0x0050C2, 0x7D3000, 0x7D3FFF, "Highrail Systems Limited", "HIGHRAIL" },
-	{ 0x0050C2, 0x7D4000, 0x7D4FFF, "WR Systems, Ltd.", "WR" },
-	{ 0x0050C2, 0x7D5000, 0x7D5FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x0050C2, 0x7D6000, 0x7D6FFF, "International Mining Technologies", "MINING-TECHNOLOGIES" },
-	{ 0x0050C2, 0x7D7000, 0x7D7FFF, "Newtec A/S", "NEWTEC-A/S" },
-	{ 0x0050C2, 0x7D8000, 0x7D8FFF, "InnoScan K/S", "INNOSCAN-K/S" },
-	{ 0x0050C2, 0x7D9000, 0x7D9FFF, "Volumatic Limited", "VOLUMATIC" },
-	{ 0x0050C2, 0x7DA000, 0x7DAFFF, "HTEC Limited", "HTEC" },
-	{ 0x0050C2, 0x7DB000, 0x7DBFFF, "Mueller Elektronik", "MUELLER-ELEKTRONIK" },
-	{ 0x0050C2, 0x7DC000, 0x7DCFFF, "aiXtrusion GmbH", "AIXTRUSION" },
-	{ 0x0050C2, 0x7DD000, 0x7DDFFF, "LS Elektronik AB", "LS-ELEKTRONIK-AB" },
-	{ 0x0050C2, 0x7DE000, 0x7DEFFF, "Cascade Technologies Ltd", "CASCADE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x7DF000, 0x7DFFFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x7E0000, 0x7E0FFF, "C&D Technologies, Inc", "C-D-TECHNOLOGIES" },
-	{ 0x0050C2, 0x7E1000, 0x7E1FFF, "Zeltiq Aesthetics, Inc.", "ZELTIQ-AESTHETICS" },
-	{ 0x0050C2, 0x7E2000, 0x7E2FFF, "DIGITROL LTD", "DIGITROL" },
-	{ 0x0050C2, 0x7E3000, 0x7E3FFF, "Progentech Limited", "PROGENTECH" },
-	{ 0x0050C2, 0x7E4000, 0x7E4FFF, "Meta Vision Systems Ltd.", "META-VISION" },
-	{ 0x0050C2, 0x7E5000, 0x7E5FFF, "Nystrom Engineering", "NYSTROM-ENGINEERING" },
-	{ 0x0050C2, 0x7E6000, 0x7E6FFF, "Empirix Italy S.p.A.", "EMPIRIX-ITALY" },
-	{ 0x0050C2, 0x7E7000, 0x7E7FFF, "V2Green, Inc.", "V2GREEN" },
-	{ 0x0050C2, 0x7E8000, 0x7E8FFF, "Mistral Solutions Pvt. Ltd", "MISTRAL-SOLUTIONS-PVT" },
-	{ 0x0050C2, 0x7E9000, 0x7E9FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0x7EA000, 0x7EAFFF, "Monitor Business Machines Ltd.", "MONITOR-BUSINESS-MACHINES" },
-	{ 0x0050C2, 0x7EB000, 0x7EBFFF, "Sesol Industrial Computer", "SESOL-INDUSTRIAL" },
-	{ 0x0050C2, 0x7EC000, 0x7ECFFF, "Lyngsoe Systems", "LYNGSOE" },
-	{ 0x0050C2, 0x7ED000, 0x7EDFFF, "Genesis Automation Inc.", "GENESIS-AUTOMATION" },
-	{ 0x0050C2, 0x7EE000, 0x7EEFFF, "NH Research", "NH-RESEARCH" },
-	{ 0x0050C2, 0x7EF000, 0x7EFFFF, "GFI Chrono Time", "GFI-CHRONO-TIME" },
-	{ 0x0050C2, 0x7F0000, 0x7F0FFF, "Network Harbor, Inc.", "NETWORK-HARBOR" },
-	{ 0x0050C2, 0x7F1000, 0x7F1FFF, "STUHL Regelsysteme GmbH", "STUHL-REGELSYSTEME" },
-	{ 0x0050C2, 0x7F2000, 0x7F2FFF, "Logotherm Regelsysteme GmbH", "LOGOTHERM-REGELSYSTEME" },
-	{ 0x0050C2, 0x7F3000, 0x7F3FFF, "SOREC", "SOREC" },
-	{ 0x0050C2, 0x7F4000, 0x7F4FFF, "Wireless Cables Inc.", "WIRELESS-CABLES" },
-	{ 0x0050C2, 0x7F5000, 0x7F5FFF, "ACE Carwash Systems", "ACE-CARWASH" },
-	{ 0x0050C2, 0x7F6000, 0x7F6FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x7F7000, 0x7F7FFF, "MangoDSP", "MANGODSP" },
-	{ 0x0050C2, 0x7F8000, 0x7F8FFF, "Wise Industria de Telecomunicações Ldta.", "WISE-INDUSTRIA-DE-TELECOMUNICAES-LDTA" },
-	{ 0x0050C2, 0x7F9000, 0x7F9FFF, "Karl DUNGS GmbH & Co. KG", "KARL-DUNGS" },
-	{ 0x0050C2, 0x7FA000, 0x7FAFFF, "AutomationX GmbH", "AUTOMATIONX" },
-	{ 0x0050C2, 0x7FB000, 0x7FBFFF, "Qtron Pty Ltd", "QTRON-PTY" },
-	{ 0x0050C2, 0x7FC000, 0x7FCFFF, "TIS Dialog LLC", "TIS-DIALOG" },
-	{ 0x0050C2, 0x7FD000, 0x7FDFFF, "Adeneo", "ADENEO" },
-	{ 0x0050C2, 0x7FE000, 0x7FEFFF, "Wireless Cables Inc.", "WIRELESS-CABLES" },
-	{ 0x0050C2, 0x7FF000, 0x7FFFFF, "Shenzhen MaiWei Cable TV Equipment CO.,LTD.", "SHENZHEN-MAIWEI-CABLE-TV-EQUIPMENT" },
-	{ 0x0050C2, 0x800000, 0x800FFF, "Delphi Display Systems, Inc.", "DELPHI-DISPLAY" },
-	{ 0x0050C2, 0x801000, 0x801FFF, "JANUS srl", "JANUS-SRL" },
-	{ 0x0050C2, 0x802000, 0x802FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0x803000, 0x803FFF, "dB Broadcast Limited", "DB-BROADCAST" },
-	{ 0x0050C2, 0x804000, 0x804FFF, "SoftSwitching Technologies", "SOFTSWITCHING-TECHNOLOGIES" },
-	{ 0x0050C2, 0x805000, 0x805FFF, "MultimediaLED", "MULTIMEDIALED" },
-	{ 0x0050C2, 0x806000, 0x806FFF, "CET", "CET" },
-	{ 0x0050C2, 0x807000, 0x807FFF, "TECHNOMARK", "TECHNOMARK" },
-	{ 0x0050C2, 0x808000, 0x808FFF, "ITB CompuPhase", "ITB-COMPUPHASE" },
-	{ 0x0050C2, 0x809000, 0x809FFF, "Varma Electronics Oy", "VARMA-ELECTRONICS-OY" },
-	{ 0x0050C2, 0x80A000, 0x80AFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x80B000, 0x80BFFF, "Open Video, Inc.", "OPEN-VIDEO" },
-	{ 0x0050C2, 0x80C000, 0x80CFFF, "Luxpert Technologies Co., Ltd.", "LUXPERT-TECHNOLOGIES" },
-	{ 0x0050C2, 0x80D000, 0x80DFFF, "Acube Systems s.r.l.", "ACUBE" },
-	{ 0x0050C2, 0x80E000, 0x80EFFF, "Bruno International Ltd.", "BRUNO" },
-	{ 0x0050C2, 0x80F000, 0x80FFFF, "Selekron Microcontrol s.l.", "SELEKRON-MICROCONTROL" },
-	{ 0x0050C2, 0x810000, 0x810FFF, "Alphion Corporation", "ALPHION" },
-	{ 0x0050C2, 0x811000, 0x811FFF, "Open System Solutions Limited", "OPEN-SYSTEM-SOLUTIONS" },
-	{ 0x0050C2, 0x812000, 0x812FFF, "Femto SA", "FEMTO" },
-	{ 0x0050C2, 0x813000, 0x813FFF, "Intelleflex Corporation", "INTELLEFLEX" },
-	{ 0x0050C2, 0x814000, 0x814FFF, "Telvent", "TELVENT" },
-	{ 0x0050C2, 0x815000, 0x815FFF, "microC Design SRL", "MICROC-DESIGN-SRL" },
-	{ 0x0050C2, 0x816000, 0x816FFF, "Q-Free America, Inc.", "Q-FREE-AMERICA" },
-	{ 0x0050C2, 0x817000, 0x817FFF, "Odin TeleSystems Inc", "ODIN-TELESYSTEMS" },
-	{ 0x0050C2, 0x818000, 0x818FFF, "Wireless Value BV", "WIRELESS-VALUE" },
-	{ 0x0050C2, 0x819000, 0x819FFF, "Cabinplant A/S", "CABINPLANT-A/S" },
-	{ 0x0050C2, 0x81A000, 0x81AFFF, "InfoGLOBAL", "INFOGLOBAL" },
-	{ 0x0050C2, 0x81B000, 0x81BFFF, "Brain Tech Co., Ltd", "BRAIN-TECH" },
-	{ 0x0050C2, 0x81C000, 0x81CFFF, "Telcom", "TELCOM" },
-	{ 0x0050C2, 0x81D000, 0x81DFFF, "IT SALUX CO., LTD.", "IT-SALUX" },
-	{ 0x0050C2, 0x81E000, 0x81EFFF, "Channelot Ltd.", "CHANNELOT" },
-	{ 0x0050C2, 0x81F000, 0x81FFFF, "2N TELEKOMUNIKACE a.s.", "2N-TELEKOMUNIKACE" },
-	{ 0x0050C2, 0x820000, 0x820FFF, "TESCAN, s.r.o.", "TESCAN-S-R-O" },
-	{ 0x0050C2, 0x821000, 0x821FFF, "MISCO Refractometer", "MISCO-REFRACTOMETER" },
-	{ 0x0050C2, 0x822000, 0x822FFF, "Winner Technology Co, Ltd.", "WINNER" },
-	{ 0x0050C2, 0x823000, 0x823FFF, "Robot Visual Systems GmbH", "ROBOT-VISUAL" },
-	{ 0x0050C2, 0x824000, 0x824FFF, "SMT d.o.o.", "SMT-D-O-O" },
-	{ 0x0050C2, 0x825000, 0x825FFF, "Funkwerk Information Technologies Karlsfeld GmbH", "FUNKWERK-INFORMATION-TECHNOLOGIES-KARLSFELD" },
-	{ 0x0050C2, 0x826000, 0x826FFF, "HEWI Heinrich Wilke GmbH", "HEWI-HEINRICH-WILKE" },
-	{ 0x0050C2, 0x827000, 0x827FFF, "Enero Solutions inc.", "ENERO-SOLUTIONS" },
-	{ 0x0050C2, 0x828000, 0x828FFF, "SLICAN sp. z o.o.", "SLICAN-SP-Z-O-O" },
-	{ 0x0050C2, 0x829000, 0x829FFF, "Intellectronika", "INTELLECTRONIKA" },
-	{ 0x0050C2, 0x82A000, 0x82AFFF, "VDC Display Systems", "VDC-DISPLAY" },
-	{ 0x0050C2, 0x82B000, 0x82BFFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x82C000, 0x82CFFF, "Vitel Net", "VITEL-NET" },
-	{ 0x0050C2, 0x82D000, 0x82DFFF, "Elmec, Inc.", "ELMEC" },
-	{ 0x0050C2, 0x82E000, 0x82EFFF, "LogiCom GmbH", "LOGICOM" },
-	{ 0x0050C2, 0x82F000, 0x82FFFF, "Momentum Data Systems", "MOMENTUM-DATA" },
-	{ 0x0050C2, 0x830000, 0x830FFF, "CompuShop Services LLC", "COMPUSHOP-SERVICES" },
-	{ 0x0050C2, 0x831000, 0x831FFF, "St Jude Medical, Inc.", "ST-JUDE-MEDICAL" },
-	{ 0x0050C2, 0x832000, 0x832FFF, "S1nn GmbH & Co. KG", "S1NN" },
-	{ 0x0050C2, 0x833000, 0x833FFF, "LaserLinc, Inc.", "LASERLINC" },
-	{ 0x0050C2, 0x834000, 0x834FFF, "ANTEK GmbH", "ANTEK" },
-	{ 0x0050C2, 0x835000, 0x835FFF, "Communications Laboratories Inc", "COMMUNICATION-LABORATORIES" },
-	{ 0x0050C2, 0x836000, 0x836FFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x0050C2, 0x837000, 0x837FFF, "ID-KARTA s.r.o.", "ID-KARTA-S-R-O" },
-	{ 0x0050C2, 0x838000, 0x838FFF, "T PROJE MUHENDISLIK DIS. TIC. LTD. STI.", "T-PROJE-MUHENDISLIK-DIS-TIC-STI" },
-	{ 0x0050C2, 0x839000, 0x839FFF, "IMS Röntgensysteme GmbH", "IMS-ROENTGENSYSTEME" },
-	{ 0x0050C2, 0x83A000, 0x83AFFF, "Syr-Tec Engineering & Marketing", "SYR-TEC-ENGINEERING-MARKETING" },
-	{ 0x0050C2, 0x83B000, 0x83BFFF, "O. Bay AG", "O-BAY" },
-	{ 0x0050C2, 0x83C000, 0x83CFFF, "hema electronic GmbH", "HEMA" },
-	{ 0x0050C2, 0x83D000, 0x83DFFF, "beroNet GmbH", "BERONET" },
-	{ 0x0050C2, 0x83E000, 0x83EFFF, "KPE spol. s r.o.", "KPE-SPOL-S-R-O" },
-	{ 0x0050C2, 0x83F000, 0x83FFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x840000, 0x840FFF, "Residential Control Systems", "RESIDENTIAL-CONTROL" },
-	{ 0x0050C2, 0x841000, 0x841FFF, "Connection Electronics Ltd.", "CONNECTION-ELECTRONICS" },
-	{ 0x0050C2, 0x842000, 0x842FFF, "Quantum Controls BV", "QUANTUM-CONTROLS" },
-	{ 0x0050C2, 0x843000, 0x843FFF, "Xtensor Systems Inc.", "XTENSOR" },
-	{ 0x0050C2, 0x844000, 0x844FFF, "Prodigy Electronics Limited", "PRODIGY-ELECTRONICS" },
-	{ 0x0050C2, 0x845000, 0x845FFF, "VisualSonics Inc.", "VISUALSONICS" },
-	{ 0x0050C2, 0x846000, 0x846FFF, "ESP-Planning Co.", "ESP-PLANNING" },
-	{ 0x0050C2, 0x847000, 0x847FFF, "Lars Morich Kommunikationstechnik GmbH", "LARS-MORICH-KOMMUNIKATIONSTECHNIK" },
-	{ 0x0050C2, 0x848000, 0x848FFF, "DASA ROBOT Co., Ltd.", "DASA-ROBOT" },
-	{ 0x0050C2, 0x849000, 0x849FFF, "Design Analysis Associates, Inc.", "DESIGN-ANALYSIS-ASSOCIATES" },
-	{ 0x0050C2, 0x84A000, 0x84AFFF, "Keystone Electronic Solutions", "KEYSTONE-SOLUTIONS" },
-	{ 0x0050C2, 0x84B000, 0x84BFFF, "TASK SISTEMAS DE COMPUTACAO LTDA", "TASK-SISTEMAS-DE-COMPUTACAO-LTDA" },
-	{ 0x0050C2, 0x84C000, 0x84CFFF, "Performance Motion Devices", "PERFORMANCE-MOTION-DEVICES" },
-	{ 0x0050C2, 0x84D000, 0x84DFFF, "BMTI", "BMTI" },
-	{ 0x0050C2, 0x84E000, 0x84EFFF, "DRACO SYSTEMS", "DRACO" },
-	{ 0x0050C2, 0x84F000, 0x84FFFF, "Gamber-Johnson LLC", "GAMBER-JOHNSON" },
-	{ 0x0050C2, 0x850000, 0x850FFF, "K.K. Rocky", "K-K-ROCKY" },
-	{ 0x0050C2, 0x851000, 0x851FFF, "SPJ Embedded Technologies Pvt. Ltd.", "SPJ-EMBEDDED-TECHNOLOGIES-PVT" },
-	{ 0x0050C2, 0x852000, 0x852FFF, "eInfochips Ltd.", "EINFOCHIPS" },
-	{ 0x0050C2, 0x853000, 0x853FFF, "Ettus Research LLC", "ETTUS-RESEARCH" },
-	{ 0x0050C2, 0x854000, 0x854FFF, "Ratioplast-Optoelectronics GmbH", "RATIOPLAST-OPTOELECTRONICS" },
-	{ 0x0050C2, 0x855000, 0x855FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0x856000, 0x856FFF, "CT Company", "CT-COMPANY" },
-	{ 0x0050C2, 0x857000, 0x857FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0x858000, 0x858FFF, "Wireless Acquisition LLC", "WIRELESS-ACQUISITION" },
-	{ 0x0050C2, 0x859000, 0x859FFF, "Nuvation", "NUVATION" },
-	{ 0x0050C2, 0x85A000, 0x85AFFF, "ART SPA", "ART-SPA" },
-	{ 0x0050C2, 0x85B000, 0x85BFFF, "Boreste", "BORESTE" },
-	{ 0x0050C2, 0x85C000, 0x85CFFF, "B S E", "B-S-E" },
-	{ 0x0050C2, 0x85D000, 0x85DFFF, "Ing. Knauseder Mechatronik GmbH", "ING-KNAUSEDER-MECHATRONIK" },
-	{ 0x0050C2, 0x85E000, 0x85EFFF, "Radiometer Medical ApS", "RADIOMETER-MEDICAL-APS" },
-	{ 0x0050C2, 0x85F000, 0x85FFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0x860000, 0x860FFF, "Eutron S.p.A.", "EUTRON" },
-	{ 0x0050C2, 0x861000, 0x861FFF, "Grantronics Pty Ltd", "GRANTRONICS-PTY" },
-	{ 0x0050C2, 0x862000, 0x862FFF, "Elsys AG", "ELSYS" },
-	{ 0x0050C2, 0x863000, 0x863FFF, "Advanced Technology Solutions", "ADVANCED-SOLUTIONS" },
-	{ 0x0050C2, 0x864000, 0x864FFF, "ATG Automatisierungstechnik GERA GmbH", "ATG-AUTOMATISIERUNGSTECHNIK-GERA" },
-	{ 0x0050C2, 0x865000, 0x865FFF, "Persy Control Services B.v.", "PERSY-CONTROL-SERVICES-B-V" },
-	{ 0x0050C2, 0x866000, 0x866FFF, "Saia Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x867000, 0x867FFF, "Syntronics", "SYNTRONICS" },
-	{ 0x0050C2, 0x868000, 0x868FFF, "Aethon, Inc.", "AETHON" },
-	{ 0x0050C2, 0x869000, 0x869FFF, "Funkwerk plettac electronic GmbH", "FUNKWERK-PLETTAC" },
-	{ 0x0050C2, 0x86A000, 0x86AFFF, "USM Systems, Ltd", "USM" },
-	{ 0x0050C2, 0x86B000, 0x86BFFF, "OMB Sistemas Electronicos S.A.", "OMB-SISTEMAS-ELECTRONICOS" },
-	{ 0x0050C2, 0x86C000, 0x86CFFF, "Condigi Televagt A/S", "CONDIGI-TELEVAGT-A/S" },
-	{ 0x0050C2, 0x86D000, 0x86DFFF, "Tieline Research Pty Ltd", "TIELINE-RESEARCH-PTY" },
-	{ 0x0050C2, 0x86E000, 0x86EFFF, "HANYANG ELECTRIC CP., LTD", "HANYANG-ELECTRIC-CP" },
-	{ 0x0050C2, 0x86F000, 0x86FFFF, "b-plus GmbH", "B-PLUS" },
-	{ 0x0050C2, 0x870000, 0x870FFF, "LOGEL S.R.L.", "LOGEL" },
-	{ 0x0050C2, 0x871000, 0x871FFF, "R-S-I Elektrotechnik GmbH & Co. KG", "R-S-I-ELEKTROTECHNIK" },
-	{ 0x0050C2, 0x872000, 0x872FFF, "Oliotalo Oy", "OLIOTALO-OY" },
-	{ 0x0050C2, 0x873000, 0x873FFF, "XRONET Corporation", "XRONET" },
-	{ 0x0050C2, 0x874000, 0x874FFF, "Arcos Technologies Ltd.", "ARCOS-TECHNOLOGIES" },
-	{ 0x0050C2, 0x875000, 0x875FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x876000, 0x876FFF, "Privatquelle Gruber GmbH & CO KG", "PRIVATQUELLE-GRUBER" },
-	{ 0x0050C2, 0x877000, 0x877FFF, "Motion Analysis Corp", "MOTION-ANALYSIS" },
-	{ 0x0050C2, 0x878000, 0x878FFF, "Acoustic Research Laboratories Pty Ltd", "ACOUSTIC-RESEARCH-LABORATORIES-PTY" },
-	{ 0x0050C2, 0x879000, 0x879FFF, "MILESYS", "MILESYS" },
-	{ 0x0050C2, 0x87A000, 0x87AFFF, "Spectrum Management, LC", "SPECTRUM-MANAGEMENT-LC" },
-	{ 0x0050C2, 0x87B000, 0x87BFFF, "UAVNavigation S.L.", "UAVNAVIGATION" },
-	{ 0x0050C2, 0x87C000, 0x87CFFF, "Arcontia AB", "ARCONTIA-AB" },
-	{ 0x0050C2, 0x87D000, 0x87DFFF, "AT&T Government Solutions", "AT-T-GOVERNMENT-SOLUTIONS" },
-	{ 0x0050C2, 0x87E000, 0x87EFFF, "SCM PRODUCTS, INC.", "SCM-PRODUCTS" },
-	{ 0x0050C2, 0x87F000, 0x87FFFF, "Optoelettronica Italia S.r.l.", "OPTOELETTRONICA-ITALIA" },
-	{ 0x0050C2, 0x880000, 0x880FFF, "Creation Technologies Chicago", "CREATION-TECHNOLOGIES-CHICAGO" },
-	{ 0x0050C2, 0x881000, 0x881FFF, "InnoTrans Communications, Inc.", "INNOTRANS-COMMUNICATION" },
-	{ 0x0050C2, 0x882000, 0x882FFF, "WARECUBE,INC.", "WARECUBE" },
-	{ 0x0050C2, 0x883000, 0x883FFF, "Neocontrol Soluções em Automação", "NEOCONTROL-SOLUES-EM-AUTOMAO" },
-	{ 0x0050C2, 0x884000, 0x884FFF, "IP Thinking A/S", "IP-THINKING-A/S" },
-	{ 0x0050C2, 0x885000, 0x885FFF, "OOO NTK IMOS", "OOO-NTK-IMOS" },
-	{ 0x0050C2, 0x886000, 0x886FFF, "Wartsila Voyage Oy", "WARTSILA-VOYAGE-OY" },
-	{ 0x0050C2, 0x887000, 0x887FFF, "Inventis Technology Pty Limited", "INVENTIS-PTY" },
-	{ 0x0050C2, 0x888000, 0x888FFF, "IAdea Corporation", "IADEA" },
-	{ 0x0050C2, 0x889000, 0x889FFF, "ACS Motion Control Ltd.", "ACS-MOTION-CONTROL" },
-	{ 0x0050C2, 0x88A000, 0x88AFFF, "Continental Electronics Corp.", "CONTINENTAL-ELECTRONICS" },
-	{ 0x0050C2, 0x88B000, 0x88BFFF, "Hollis Electronics Company LLC", "HOLLIS-ELECTRONICS-COMPANY" },
-	{ 0x0050C2, 0x88C000, 0x88CFFF, "Z-App Systems", "Z-APP" },
-	{ 0x0050C2, 0x88D000, 0x88DFFF, "L3 Communications Nova Engineering", "L3-COMMUNICATION-NOVA-ENGINEERING" },
-	{ 0x0050C2, 0x88E000, 0x88EFFF, "Cardinal Scale Mfg Co", "CARDINAL-SCALE-MFG" },
-	{ 0x0050C2, 0x88F000, 0x88FFFF, "Keynote SIGOS GmbH", "KEYNOTE-SIGOS" },
-	{ 0x0050C2, 0x890000, 0x890FFF, "BAE Systems Hägglunds AB", "BAE-HAEGGLUNDS-AB" },
-	{ 0x0050C2, 0x891000, 0x891FFF, "Admiral Secure Products, Ltd.", "ADMIRAL-SECURE-PRODUCTS" },
-	{ 0x0050C2, 0x892000, 0x892FFF, "Trakce a.s.", "TRAKCE" },
-	{ 0x0050C2, 0x893000, 0x893FFF, "EIZO Technologies GmbH", "EIZO-TECHNOLOGIES" },
-	{ 0x0050C2, 0x894000, 0x894FFF, "Shockfish SA", "SHOCKFISH" },
-	{ 0x0050C2, 0x895000, 0x895FFF, "Marine Communications Limited", "MARINE-COMMUNICATION" },
-	{ 0x0050C2, 0x896000, 0x896FFF, "Blankom", "BLANKOM" },
-	{ 0x0050C2, 0x897000, 0x897FFF, "ODF Optronics, Inc.", "ODF-OPTRONICS" },
-	{ 0x0050C2, 0x898000, 0x898FFF, "Veeco Process Equipment, Inc.", "VEECO-PROCESS-EQUIPMENT" },
-	{ 0x0050C2, 0x899000, 0x899FFF, "Inico Technologies Ltd.", "INICO-TECHNOLOGIES" },
-	{ 0x0050C2, 0x89A000, 0x89AFFF, "Neptune Technology Group Inc.", "NEPTUNE-GROUP" },
-	{ 0x0050C2, 0x89B000, 0x89BFFF, "Sensata Technologies", "SENSATA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x89C000, 0x89CFFF, "Mediana", "MEDIANA" },
-	{ 0x0050C2, 0x89D000, 0x89DFFF, "Systemtechnik GmbH", "SYSTEMTECHNIK" },
-	{ 0x0050C2, 0x89E000, 0x89EFFF, "Broadcast Electronics", "BROADCAST-ELECTRONICS" },
-	{ 0x0050C2, 0x89F000, 0x89FFFF, "Datalink Technologies Gateways Inc.", "DATALINK-TECHNOLOGIES-GATEWAYS" },
-	{ 0x0050C2, 0x8A0000, 0x8A0FFF, "Specialized Communications Corp.", "SPECIALIZED-COMMUNICATION" },
-	{ 0x0050C2, 0x8A1000, 0x8A1FFF, "Intune Networks", "INTUNE-NETWORKS" },
-	{ 0x0050C2, 0x8A2000, 0x8A2FFF, "UAVISION Engenharia de Sistemas", "UAVISION-ENGENHARIA-DE-SISTEMAS" },
-	{ 0x0050C2, 0x8A3000, 0x8A3FFF, "RTW GmbH & Co.KG", "RTW" },
-	{ 0x0050C2, 0x8A4000, 0x8A4FFF, "BALOGH T.A.G Corporation", "BALOGH-T-A-G" },
-	{ 0x0050C2, 0x8A5000, 0x8A5FFF, "Mocon, Inc.", "MOCON" },
-	{ 0x0050C2, 0x8A6000, 0x8A6FFF, "SELCO", "SELCO" },
-	{ 0x0050C2, 0x8A7000, 0x8A7FFF, "PIXEYE LTD", "PIXEYE" },
-	{ 0x0050C2, 0x8A8000, 0x8A8FFF, "ALTEK ELECTRONICS", "ALTEK-ELECTRONICS" },
-	{ 0x0050C2, 0x8A9000, 0x8A9FFF, "Intelligent Security Systems", "INTELLIGENT-SECURITY" },
-	{ 0x0050C2, 0x8AA000, 0x8AAFFF, "ATS Elektronik GmbH", "ATS-ELEKTRONIK" },
-	{ 0x0050C2, 0x8AB000, 0x8ABFFF, "Nanomotion Ltd.", "NANOMOTION" },
-	{ 0x0050C2, 0x8AC000, 0x8ACFFF, "Telsa s.r.l", "TELSA" },
-	{ 0x0050C2, 0x8AD000, 0x8ADFFF, "Thales Communications Inc", "THALES-COMMUNICATION" },
-	{ 0x0050C2, 0x8AE000, 0x8AEFFF, "DESARROLLO DE SISTEMAS INTEGRADOS DE CONTROL S.A.", "DESARROLLO-DE-SISTEMAS-INTEGRADOS-DE-CONTROL" },
-	{ 0x0050C2, 0x8AF000, 0x8AFFFF, "Xelerated", "XELERATED" },
-	{ 0x0050C2, 0x8B0000, 0x8B0FFF, "BK Innovation, Inc.", "BK-INNOVATION" },
-	{ 0x0050C2, 0x8B1000, 0x8B1FFF, "RingCube Technologies, Inc.", "RINGCUBE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x8B2000, 0x8B2FFF, "SERVAIND SA.", "SERVAIND" },
-	{ 0x0050C2, 0x8B3000, 0x8B3FFF, "VTQ Videtronik GmbH", "VTQ-VIDETRONIK" },
-	{ 0x0050C2, 0x8B4000, 0x8B4FFF, "Sandar Telecast AS", "SANDAR-TELECAST-AS" },
-	{ 0x0050C2, 0x8B5000, 0x8B5FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x8B6000, 0x8B6FFF, "Shadrinskiy Telefonny Zavod", "SHADRINSKIY-TELEFONNY-ZAVOD" },
-	{ 0x0050C2, 0x8B7000, 0x8B7FFF, "Calnex Solutions plc", "CALNEX-SOLUTIONS-PLC" },
-	{ 0x0050C2, 0x8B8000, 0x8B8FFF, "DSS Networks, Inc.", "DSS-NETWORKS" },
-	{ 0x0050C2, 0x8B9000, 0x8B9FFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0x8BA000, 0x8BAFFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0x8BB000, 0x8BBFFF, "smtag international ag", "SMTAG" },
-	{ 0x0050C2, 0x8BC000, 0x8BCFFF, "Honeywell Sensotec", "HONEYWELL-SENSOTEC" },
-	{ 0x0050C2, 0x8BD000, 0x8BDFFF, "Matrix Switch Corporation", "MATRIX-SWITCH" },
-	{ 0x0050C2, 0x8BE000, 0x8BEFFF, "The Pennsylvania State University", "THE-PENNSYLVANIA-STATE-UNIVERSITY" },
-	{ 0x0050C2, 0x8BF000, 0x8BFFFF, "ARISTO Graphic Systeme GmbH & Co. KG", "ARISTO-GRAPHIC-SYSTEME" },
-	{ 0x0050C2, 0x8C0000, 0x8C0FFF, "S.C.E. s.r.l.", "S-C-E" },
-	{ 0x0050C2, 0x8C1000, 0x8C1FFF, "Heraeus Noblelight GmbH", "HERAEUS-NOBLELIGHT" },
-	{ 0x0050C2, 0x8C2000, 0x8C2FFF, "Access Control Systems JSC", "ACCESS-CONTROL-JSC" },
-	{ 0x0050C2, 0x8C3000, 0x8C3FFF, "Byte Paradigm", "BYTE-PARADIGM" },
-	{ 0x0050C2, 0x8C4000, 0x8C4FFF, "Soldig Industria e Comercio de Equipamentos Eletronicos LTDA", "SOLDIG-INDUSTRIA-E-COMERCIO-DE-EQUIPAMENTOS-ELETRONICOS-LTDA" },
-	{ 0x0050C2, 0x8C5000, 0x8C5FFF, "Vortex Engineering pvt ltd", "VORTEX-ENGINEERING-PVT" },
-	{ 0x0050C2, 0x8C6000, 0x8C6FFF, "Gradual Tecnologia Ltda.", "GRADUAL-TECNOLOGIA-LTDA" },
-	{ 0x0050C2, 0x8C7000, 0x8C7FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x0050C2, 0x8C8000, 0x8C8FFF, "Pumatronix Equipamentos Eletronicos Ltda.", "PUMATRONIX-EQUIPAMENTOS-ELETRONICOS-LTDA" },
-	{ 0x0050C2, 0x8C9000, 0x8C9FFF, "A+S Aktuatorik und Sensorik GmbH", "A+S-AKTUATORIK-UND-SENSORIK" },
-	{ 0x0050C2, 0x8CA000, 0x8CAFFF, "Altair semiconductor Ltd", "ALTAIR-SEMICONDUCTOR" },
-	{ 0x0050C2, 0x8CB000, 0x8CBFFF, "Beonic Corporation", "BEONIC" },
-	{ 0x0050C2, 0x8CC000, 0x8CCFFF, "LyconSys GmbH & Co.KG", "LYCONSYS" },
-	{ 0x0050C2, 0x8CD000, 0x8CDFFF, "Cambridge Sound Management, LLC", "CAMBRIDGE-SOUND-MANAGEMENT" },
-	{ 0x0050C2, 0x8CE000, 0x8CEFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x8CF000, 0x8CFFFF, "GigaLinx Ltd.", "GIGALINX" },
-	{ 0x0050C2, 0x8D0000, 0x8D0FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x8D1000, 0x8D1FFF, "Bachmann Monitoring GmbH", "BACHMANN-MONITORING" },
-	{ 0x0050C2, 0x8D2000, 0x8D2FFF, "TTi Ltd", "TTI" },
-	{ 0x0050C2, 0x8D3000, 0x8D3FFF, "IFAM GmbH", "IFAM" },
-	{ 0x0050C2, 0x8D4000, 0x8D4FFF, "INTERNET PROTOCOLO LOGICA SL", "INTERNET-PROTOCOLO-LOGICA-SL" },
-	{ 0x0050C2, 0x8D5000, 0x8D5FFF, "Peek Traffic Corp", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0x8D6000, 0x8D6FFF, "UltraVision Security Systems, Inc.", "ULTRAVISION-SECURITY" },
-	{ 0x0050C2, 0x8D7000, 0x8D7FFF, "Polygon Informatics Ltd.", "POLYGON-INFORMATICS" },
-	{ 0x0050C2, 0x8D8000, 0x8D8FFF, "Array Technologies Inc", "ARRAY-TECHNOLOGIES" },
-	{ 0x0050C2, 0x8D9000, 0x8D9FFF, "Industrial Control and Communication Limited", "INDUSTRIAL-CONTROL-AND-COMMUNICATION" },
-	{ 0x0050C2, 0x8DA000, 0x8DAFFF, "DOCUTEMP, INC", "DOCUTEMP" },
-	{ 0x0050C2, 0x8DB000, 0x8DBFFF, "DCOM Network Technology (Pty) Ltd", "DCOM-NETWORK-PTY" },
-	{ 0x0050C2, 0x8DC000, 0x8DCFFF, "Frame Systems Limited", "FRAME" },
-	{ 0x0050C2, 0x8DD000, 0x8DDFFF, "GIMCON", "GIMCON" },
-	{ 0x0050C2, 0x8DE000, 0x8DEFFF, "Coherix, Inc", "COHERIX" },
-	{ 0x0050C2, 0x8DF000, 0x8DFFFF, "Dipl.-Ing. W. Nophut GmbH", "DIPL-ING-W-NOPHUT" },
-	{ 0x0050C2, 0x8E0000, 0x8E0FFF, "Shenzhen Pennda Technologies Co., Ltd.", "SHENZHEN-PENNDA-TECHNOLOGIES" },
-	{ 0x0050C2, 0x8E1000, 0x8E1FFF, "Deutscher Weterdienst", "DEUTSCHER-WETERDIENST" },
-	{ 0x0050C2, 0x8E2000, 0x8E2FFF, "Wireless Cables Inc.", "WIRELESS-CABLES" },
-	{ 0x0050C2, 0x8E3000, 0x8E3FFF, "bioMérieux Italia S.p.A.", "BIOMRIEUX-ITALIA" },
-	{ 0x0050C2, 0x8E4000, 0x8E4FFF, "MaCaPS International Limited", "MACAPS" },
-	{ 0x0050C2, 0x8E5000, 0x8E5FFF, "Berthel GmbH", "BERTHEL" },
-	{ 0x0050C2, 0x8E6000, 0x8E6FFF, "Sandel Avionics, Inc.", "SANDEL-AVIONICS" },
-	{ 0x0050C2, 0x8E7000, 0x8E7FFF, "MKT Systemtechnik", "MKT-SYSTEMTECHNIK" },
-	{ 0x0050C2, 0x8E8000, 0x8E8FFF, "Friedrich Kuhnt GmbH", "FRIEDRICH-KUHNT" },
-	{ 0x0050C2, 0x8E9000, 0x8E9FFF, "UNIDATA", "UNIDATA" },
-	{ 0x0050C2, 0x8EA000, 0x8EAFFF, "ATEME", "ATEME" },
-	{ 0x0050C2, 0x8EB000, 0x8EBFFF, "C-COM Satellite Systems Inc.", "C-COM-SATELLITE" },
-	{ 0x0050C2, 0x8EC000, 0x8ECFFF, "Balfour Beatty Rail GmbH", "BALFOUR-BEATTY-RAIL" },
-	{ 0x0050C2, 0x8ED000, 0x8EDFFF, "AT-Automation Technology GmbH", "AT-AUTOMATION" },
-	{ 0x0050C2, 0x8EE000, 0x8EEFFF, "PCSC", "PCSC" },
-	{ 0x0050C2, 0x8EF000, 0x8EFFFF, "Technologies Sensio Inc", "TECHNOLOGIES-SENSIO" },
-	{ 0x0050C2, 0x8F0000, 0x8F0FFF, "Xentras Communications", "XENTRAS-COMMUNICATION" },
-	{ 0x0050C2, 0x8F1000, 0x8F1FFF, "Detection Technologies Ltd.", "DETECTION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x8F2000, 0x8F2FFF, "Schneider Electric GmbH", "SCHNEIDER-ELECTRIC" },
-	{ 0x0050C2, 0x8F3000, 0x8F3FFF, "Curtis Door Systems Inc", "CURTIS-DOOR" },
-	{ 0x0050C2, 0x8F4000, 0x8F4FFF, "Critical Link LLC", "CRITICAL-LINK" },
-	{ 0x0050C2, 0x8F5000, 0x8F5FFF, "tec5 AG", "TEC5" },
-	{ 0x0050C2, 0x8F6000, 0x8F6FFF, "K-MAC Corp.", "K-MAC" },
-	{ 0x0050C2, 0x8F7000, 0x8F7FFF, "TGE Co., Ltd.", "TGE" },
-	{ 0x0050C2, 0x8F8000, 0x8F8FFF, "RMSD LTD", "RMSD" },
-	{ 0x0050C2, 0x8F9000, 0x8F9FFF, "Honeywell", "HONEYWELL" },
-	{ 0x0050C2, 0x8FA000, 0x8FAFFF, "TELIUM s.c.", "TELIUM-S-C" },
-	{ 0x0050C2, 0x8FB000, 0x8FBFFF, "Alfred Kuhse GmbH", "ALFRED-KUHSE" },
-	{ 0x0050C2, 0x8FC000, 0x8FCFFF, "Symetrics Industries", "SYMETRICS-INDUSTRIES" },
-	{ 0x0050C2, 0x8FD000, 0x8FDFFF, "Sindoma Müh Mim Ýnþ Elk San Tic Ltd.", "SINDOMA-MUEH-MIM-N-ELK-SAN-TIC" },
-	{ 0x0050C2, 0x8FE000, 0x8FEFFF, "Cross Country Systems AB", "CROSS-COUNTRY-AB" },
-	{ 0x0050C2, 0x8FF000, 0x8FFFFF, "Luceat", "LUCEAT" },
-	{ 0x0050C2, 0x900000, 0x900FFF, "Magor Communications Corp", "MAGOR-COMMUNICATION" },
-	{ 0x0050C2, 0x901000, 0x901FFF, "Research Applications Incorp", "RESEARCH-APPLICATIONS-INCORP" },
-	{ 0x0050C2, 0x902000, 0x902FFF, "China Railway Signal & Communication Corp.", "CHINA-RAILWAY-SIGNAL-COMMUNICATION" },
-	{ 0x0050C2, 0x903000, 0x903FFF, "EcoAxis Systems Pvt. Ltd.", "ECOAXIS-PVT" },
-	{ 0x0050C2, 0x904000, 0x904FFF, "R2Sonic, LLC", "R2SONIC" },
-	{ 0x0050C2, 0x905000, 0x905FFF, "Link Communications, Inc", "LINK-COMMUNICATION" },
-	{ 0x0050C2, 0x906000, 0x906FFF, "Gidel", "GIDEL" },
-	{ 0x0050C2, 0x907000, 0x907FFF, "Cristal Controles Ltee", "CRISTAL-CONTROLES-LTEE" },
-	{ 0x0050C2, 0x908000, 0x908FFF, "Codex Digital Ltd", "CODEX-DIGITAL" },
-	{ 0x0050C2, 0x909000, 0x909FFF, "Elisra", "ELISRA" },
-	{ 0x0050C2, 0x90A000, 0x90AFFF, "Board Level Limited", "BOARD-LEVEL" },
-	{ 0x0050C2, 0x90B000, 0x90BFFF, "E.ON ES Sverige AB", "E-ON-ES-SVERIGE-AB" },
-	{ 0x0050C2, 0x90C000, 0x90CFFF, "LSS GmbH", "LSS" },
-	{ 0x0050C2, 0x90D000, 0x90DFFF, "EVK DI Kerschhaggl GmbH", "EVK-DI-KERSCHHAGGL" },
-	{ 0x0050C2, 0x90E000, 0x90EFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x90F000, 0x90FFFF, "INTEGRA Biosciences AG", "INTEGRA-BIOSCIENCES" },
-	{ 0x0050C2, 0x910000, 0x910FFF, "Autotank AB", "AUTOTANK-AB" },
-	{ 0x0050C2, 0x911000, 0x911FFF, "Vapor Rail", "VAPOR-RAIL" },
-	{ 0x0050C2, 0x912000, 0x912FFF, "ASSET InterTech, Inc.", "ASSET-INTERTECH" },
-	{ 0x0050C2, 0x913000, 0x913FFF, "Leonardo UK Ltd", "LEONARDO-UK" },
-	{ 0x0050C2, 0x914000, 0x914FFF, "IO-Connect", "IO-CONNECT" },
-	{ 0x0050C2, 0x915000, 0x915FFF, "Verint Systems Ltd.", "VERINT" },
-	{ 0x0050C2, 0x916000, 0x916FFF, "CHK GridSense P/L", "CHK-GRIDSENSE-P/L" },
-	{ 0x0050C2, 0x917000, 0x917FFF, "CIRTEM", "CIRTEM" },
-	{ 0x0050C2, 0x918000, 0x918FFF, "Design Lightning Corp", "DESIGN-LIGHTNING" },
-	{ 0x0050C2, 0x919000, 0x919FFF, "AHV Systems, Inc.", "AHV" },
-	{ 0x0050C2, 0x91A000, 0x91AFFF, "Xtone Networks", "XTONE-NETWORKS" },
-	{ 0x0050C2, 0x91B000, 0x91BFFF, "Embedded Data Systems, LLC", "EMBEDDED-DATA" },
-	{ 0x0050C2, 0x91C000, 0x91CFFF, "MangoDSP", "MANGODSP" },
-	{ 0x0050C2, 0x91D000, 0x91DFFF, "Rosendahl Studiotechnik GmbH", "ROSENDAHL-STUDIOTECHNIK" },
-	{ 0x0050C2, 0x91E000, 0x91EFFF, "Automation Tec", "AUTOMATION-TEC" },
-	{ 0x0050C2, 0x91F000, 0x91FFFF, "2NCOMM DESIGN SRL", "2NCOMM-DESIGN-SRL" },
-	{ 0x0050C2, 0x920000, 0x920FFF, "Rogue Engineering Inc.", "ROGUE-ENGINEERING" },
-	{ 0x0050C2, 0x921000, 0x921FFF, "iQue RFID Technologies BV", "IQUE-RFID-TECHNOLOGIES" },
-	{ 0x0050C2, 0x922000, 0x922FFF, "Metrum Sweden AB", "METRUM-SWEDEN-AB" },
-	{ 0x0050C2, 0x923000, 0x923FFF, "Amicus Wireless", "AMICUS-WIRELESS" },
-	{ 0x0050C2, 0x924000, 0x924FFF, "Link Electric & Safety Control Co.", "LINK-ELECTRIC-SAFETY-CONTROL" },
-	{ 0x0050C2, 0x925000, 0x925FFF, "PHB Eletronica Ltda.", "PHB-ELETRONICA-LTDA" },
-	{ 0x0050C2, 0x926000, 0x926FFF, "DiTEST Fahrzeugdiagnose GmbH", "DITEST-FAHRZEUGDIAGNOSE" },
-	{ 0x0050C2, 0x927000, 0x927FFF, "ATIS group s.r.o.", "ATIS-GROUP-S-R-O" },
-	{ 0x0050C2, 0x928000, 0x928FFF, "Cinetix GmbH", "CINETIX" },
-	{ 0x0050C2, 0x929000, 0x929FFF, "Flight Deck Resources", "FLIGHT-DECK-RESOURCES" },
-	{ 0x0050C2, 0x92A000, 0x92AFFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0x92B000, 0x92BFFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x0050C2, 0x92C000, 0x92CFFF, "Exatrol Corporation", "EXATROL" },
-	{ 0x0050C2, 0x92D000, 0x92DFFF, "APProSoftware.com", "APPROSOFTWARE-COM" },
-	{ 0x0050C2, 0x92E000, 0x92EFFF, "Goanna Technologies Pty Ltd", "GOANNA-TECHNOLOGIES-PTY" },
-	{ 0x0050C2, 0x92F000, 0x92FFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x930000, 0x930FFF, "NETA Elektronik AS", "NETA-ELEKTRONIK-AS" },
-	{ 0x0050C2, 0x931000, 0x931FFF, "Korea Telecom Internet Solutions (KTIS)", "KOREA-TELECOM-INTERNET-SOLUTIONS-KTIS" },
-	{ 0x0050C2, 0x932000, 0x932FFF, "SMAVIS Inc.", "SMAVIS" },
-	{ 0x0050C2, 0x933000, 0x933FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x934000, 0x934FFF, "Xilar Corp.", "XILAR" },
-	{ 0x0050C2, 0x935000, 0x935FFF, "Image Video", "IMAGE-VIDEO" },
-	{ 0x0050C2, 0x936000, 0x936FFF, "Margaritis Engineering", "MARGARITIS-ENGINEERING" },
-	{ 0x0050C2, 0x937000, 0x937FFF, "BigBear", "BIGBEAR" },
-	{ 0x0050C2, 0x938000, 0x938FFF, "Postec Data Systems Ltd", "POSTEC-DATA" },
-	{ 0x0050C2, 0x939000, 0x939FFF, "Mosaic Dynamic Solutions", "MOSAIC-DYNAMIC-SOLUTIONS" },
-	{ 0x0050C2, 0x93A000, 0x93AFFF, "ALPHATRONICS nv", "ALPHATRONICS-NV" },
-	{ 0x0050C2, 0x93B000, 0x93BFFF, "Cleaveland/Price, Inc.", "CLEAVELAND/PRICE" },
-	{ 0x0050C2, 0x93C000, 0x93CFFF, "FractureCode Corporation", "FRACTURECODE" },
-	{ 0x0050C2, 0x93D000, 0x93DFFF, "Lighting Science Group", "LIGHTING-SCIENCE-GROUP" },
-	{ 0x0050C2, 0x93E000, 0x93EFFF, "RCS Communication Test Systems Ltd.", "RCS-COMMUNICATION-TEST" },
-	{ 0x0050C2, 0x93F000, 0x93FFFF, "TSB Solutions Inc.", "TSB-SOLUTIONS" },
-	{ 0x0050C2, 0x940000, 0x940FFF, "Phitek Systems Ltd.", "PHITEK" },
-	{ 0x0050C2, 0x941000, 0x941FFF, "Rolbit", "ROLBIT" },
-	{ 0x0050C2, 0x942000, 0x942FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x943000, 0x943FFF, "QuanZhou TDX Electronics Co., Ltd.", "QUANZHOU-TDX-ELECTRONICS" },
-	{ 0x0050C2, 0x944000, 0x944FFF, "Wireonair A/S", "WIREONAIR-A/S" },
-	{ 0x0050C2, 0x945000, 0x945FFF, "Exi Flow Measurement Ltd", "EXI-FLOW-MEASUREMENT" },
-	{ 0x0050C2, 0x946000, 0x946FFF, "MEGWARE Computer GmbH", "MEGWARE" },
-	{ 0x0050C2, 0x947000, 0x947FFF, "IMEXHIGHWAY cvba", "IMEXHIGHWAY-CVBA" },
-	{ 0x0050C2, 0x948000, 0x948FFF, "ELECTRONIA", "ELECTRONIA" },
-	{ 0x0050C2, 0x949000, 0x949FFF, "taskit GmbH", "TASKIT" },
-	{ 0x0050C2, 0x94A000, 0x94AFFF, "TruMedia Measurement Ltd.", "TRUMEDIA-MEASUREMENT" },
-	{ 0x0050C2, 0x94B000, 0x94BFFF, "Piller engineering Ltd.", "PILLER-ENGINEERING" },
-	{ 0x0050C2, 0x94C000, 0x94CFFF, "TEMIX", "TEMIX" },
-	{ 0x0050C2, 0x94D000, 0x94DFFF, "C&H technology  ltd.", "C-H" },
-	{ 0x0050C2, 0x94E000, 0x94EFFF, "Zynix Original Sdn. Bhd.", "ZYNIX-ORIGINAL" },
-	{ 0x0050C2, 0x94F000, 0x94FFFF, "IT-Designers GmbH", "IT-DESIGNERS" },
-	{ 0x0050C2, 0x950000, 0x950FFF, "Tele and Radio Research Institute", "TELE-AND-RADIO-RESEARCH-INSTITUTE" },
-	{ 0x0050C2, 0x951000, 0x951FFF, "EL.C.A. soc. coop.", "EL-C-A-SOC-COOP" },
-	{ 0x0050C2, 0x952000, 0x952FFF, "Tech Fass s.r.o.", "TECH-FASS-S-R-O" },
-	{ 0x0050C2, 0x953000, 0x953FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0x954000, 0x954FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x955000, 0x955FFF, "Roessmann Engineering", "ROESSMANN-ENGINEERING" },
-	{ 0x0050C2, 0x956000, 0x956FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0x957000, 0x957FFF, "STRATEC Control Systems", "STRATEC-CONTROL" },
-	{ 0x0050C2, 0x958000, 0x958FFF, "Sensoptics Ltd", "SENSOPTICS" },
-	{ 0x0050C2, 0x959000, 0x959FFF, "DECTRIS Ltd.", "DECTRIS" },
-	{ 0x0050C2, 0x95A000, 0x95AFFF, "TechnoAP", "TECHNOAP" },
-	{ 0x0050C2, 0x95B000, 0x95BFFF, "AS Solar GmbH", "AS-SOLAR" },
-	{ 0x0050C2, 0x95C000, 0x95CFFF, "Resurgent Health & Medical", "RESURGENT-HEALTH-MEDICAL" },
-	{ 0x0050C2, 0x95D000, 0x95DFFF, "full electronic system", "FULL-SYSTEM" },
-	{ 0x0050C2, 0x95E000, 0x95EFFF, "BEEcube Inc.", "BEECUBE" },
-	{ 0x0050C2, 0x95F000, 0x95FFFF, "METRONIC APARATURA KONTROLNO - POMIAROWA", "METRONIC-APARATURA-KONTROLNO-POMIAROWA" },
-	{ 0x0050C2, 0x960000, 0x960FFF, "kuroneko dennnou kenkyuushitsu", "KURONEKO-DENNNOU-KENKYUUSHITSU" },
-	{ 0x0050C2, 0x961000, 0x961FFF, "Picsolve International Limited", "PICSOLVE" },
-	{ 0x0050C2, 0x962000, 0x962FFF, "Shockfish SA", "SHOCKFISH" },
-	{ 0x0050C2, 0x963000, 0x963FFF, "Lécureux SA", "LCUREUX" },
-	{ 0x0050C2, 0x964000, 0x964FFF, "IQ Automation GmbH", "IQ-AUTOMATION" },
-	{ 0x0050C2, 0x965000, 0x965FFF, "Emitech Corporation", "EMITECH" },
-	{ 0x0050C2, 0x966000, 0x966FFF, "PCM Industries", "PCM-INDUSTRIES" },
-	{ 0x0050C2, 0x967000, 0x967FFF, "Watthour Engineering Co., Inc.", "WATTHOUR-ENGINEERING" },
-	{ 0x0050C2, 0x968000, 0x968FFF, "BuLogics, Inc.", "BULOGICS" },
-	{ 0x0050C2, 0x969000, 0x969FFF, "Gehrke Kommunikationssysteme GmbH", "GEHRKE-KOMMUNIKATIONSSYSTEME" },
-	{ 0x0050C2, 0x96A000, 0x96AFFF, "Bittium Wireless Ltd", "BITTIUM-WIRELESS" },
-	{ 0x0050C2, 0x96B000, 0x96BFFF, "Electronic Media Services Ltd", "MEDIA-SERVICES" },
-	{ 0x0050C2, 0x96C000, 0x96CFFF, "Aqua Cooler Pty Ltd", "AQUA-COOLER-PTY" },
-	{ 0x0050C2, 0x96D000, 0x96DFFF, "Keene Electronics Ltd.", "KEENE-ELECTRONICS" },
-	{ 0x0050C2, 0x96E000, 0x96EFFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0x96F000, 0x96FFFF, "Varec Inc.", "VAREC" },
-	{ 0x0050C2, 0x970000, 0x970FFF, "Tsuji Electronics Co.,Ltd", "TSUJI-ELECTRONICS" },
-	{ 0x0050C2, 0x971000, 0x971FFF, "IPITEK", "IPITEK" },
-	{ 0x0050C2, 0x972000, 0x972FFF, "Switch Science (Panini Keikaku)", "SWITCH-SCIENCE-PANINI-KEIKAKU" },
-	{ 0x0050C2, 0x973000, 0x973FFF, "Systèmes Pran", "SYSTMES-PRAN" },
-	{ 0x0050C2, 0x974000, 0x974FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x0050C2, 0x975000, 0x975FFF, "Pyramid Technical Consultants", "PYRAMID-TECHNICAL-CONSULTANTS" },
-	{ 0x0050C2, 0x976000, 0x976FFF, "SANDS INSTRUMENTATION INDIA PVT LTD", "SANDS-INSTRUMENTATION-INDIA-PVT" },
-	{ 0x0050C2, 0x977000, 0x977FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x978000, 0x978FFF, "LOGITAL DIGITAL MEDIA srl", "LOGITAL-DIGITAL-MEDIA-SRL" },
-	{ 0x0050C2, 0x979000, 0x979FFF, "Far South Networks (Pty) Ltd", "FAR-SOUTH-NETWORKS-PTY" },
-	{ 0x0050C2, 0x97A000, 0x97AFFF, "KST Technology Co., Ltd", "KST" },
-	{ 0x0050C2, 0x97B000, 0x97BFFF, "SMARTQUANTUM SA", "SMARTQUANTUM" },
-	{ 0x0050C2, 0x97C000, 0x97CFFF, "Creacon Technologies B.V.", "CREACON-TECHNOLOGIES-B-V" },
-	{ 0x0050C2, 0x97D000, 0x97DFFF, "Soehnle Professional GmbH & Co.KG", "SOEHNLE-PROFESSIONAL" },
-	{ 0x0050C2, 0x97E000, 0x97EFFF, "RF Industries", "RF-INDUSTRIES" },
-	{ 0x0050C2, 0x97F000, 0x97FFFF, "C&I  Co.Ltd", "C-I" },
-	{ 0x0050C2, 0x980000, 0x980FFF, "Digital Payment Technologies", "DIGITAL-PAYMENT-TECHNOLOGIES" },
-	{ 0x0050C2, 0x981000, 0x981FFF, "Novotronik GmbH", "NOVOTRONIK" },
-	{ 0x0050C2, 0x982000, 0x982FFF, "Triple Ring Technologies, Inc.", "TRIPLE-RING-TECHNOLOGIES" },
-	{ 0x0050C2, 0x983000, 0x983FFF, "Bogart Engineering", "BOGART-ENGINEERING" },
-	{ 0x0050C2, 0x984000, 0x984FFF, "Atel Corporation", "ATEL" },
-	{ 0x0050C2, 0x985000, 0x985FFF, "Earnestcom Sdn Bhd", "EARNESTCOM" },
-	{ 0x0050C2, 0x986000, 0x986FFF, "DSCI", "DSCI" },
-	{ 0x0050C2, 0x987000, 0x987FFF, "Joinsoon Electronics MFG. Co., Ltd", "JOINSOON-ELECTRONICS-MFG" },
-	{ 0x0050C2, 0x988000, 0x988FFF, "Pantel International", "PANTEL" },
-	{ 0x0050C2, 0x989000, 0x989FFF, "Psigenics Corporation", "PSIGENICS" },
-	{ 0x0050C2, 0x98A000, 0x98AFFF, "MEV Limited", "MEV" },
-	{ 0x0050C2, 0x98B000, 0x98BFFF, "TI2000 TECNOLOGIA INFORMATICA 2000", "TI2000-TECNOLOGIA-INFORMATICA-2000" },
-	{ 0x0050C2, 0x98C000, 0x98CFFF, "MGM-Devices Oy", "MGM-DEVICES-OY" },
-	{ 0x0050C2, 0x98D000, 0x98DFFF, "Mecos AG", "MECOS" },
-	{ 0x0050C2, 0x98E000, 0x98EFFF, "Link Technologies, Inc", "LINK-TECHNOLOGIES" },
-	{ 0x0050C2, 0x98F000, 0x98FFFF, "BELIK S.P.R.L.", "BELIK-S-P-R-L" },
-	{ 0x0050C2, 0x990000, 0x990FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x991000, 0x991FFF, "UGL Limited", "UGL" },
-	{ 0x0050C2, 0x992000, 0x992FFF, "IDT Sound Processing Corporation", "IDT-SOUND-PROCESSING" },
-	{ 0x0050C2, 0x993000, 0x993FFF, "UNETCONVERGENCE CO., LTD", "UNETCONVERGENCE" },
-	{ 0x0050C2, 0x994000, 0x994FFF, "Xafax Nederland bv", "XAFAX-NEDERLAND" },
-	{ 0x0050C2, 0x995000, 0x995FFF, "Inter Control Hermann Köhler  Elektrik GmbH&Co.KG", "INTER-CONTROL-HERMANN-KOEHLER-ELEKTRIK" },
-	{ 0x0050C2, 0x996000, 0x996FFF, "Commercial Timesharing Inc.", "COMMERCIAL-TIMESHARING" },
-	{ 0x0050C2, 0x997000, 0x997FFF, "Depro Électronique", "DEPRO-LECTRONIQUE" },
-	{ 0x0050C2, 0x998000, 0x998FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0x999000, 0x999FFF, "Cambustion Ltd", "CAMBUSTION" },
-	{ 0x0050C2, 0x99A000, 0x99AFFF, "Miromico AG", "MIROMICO" },
-	{ 0x0050C2, 0x99B000, 0x99BFFF, "Bettini srl", "BETTINI-SRL" },
-	{ 0x0050C2, 0x99C000, 0x99CFFF, "CaTs3 Limited", "CATS3" },
-	{ 0x0050C2, 0x99D000, 0x99DFFF, "Powersense A/S", "POWERSENSE-A/S" },
-	{ 0x0050C2, 0x99E000, 0x99EFFF, "Engage Technologies", "ENGAGE-TECHNOLOGIES" },
-	{ 0x0050C2, 0x99F000, 0x99FFFF, "Sietron Elektronik", "SIETRON-ELEKTRONIK" },
-	{ 0x0050C2, 0x9A0000, 0x9A0FFF, "Trs Systems, Inc.", "TRS" },
-	{ 0x0050C2, 0x9A1000, 0x9A1FFF, "ComAp s.r.o", "COMAP-S-R-O" },
-	{ 0x0050C2, 0x9A2000, 0x9A2FFF, "SAMsystems GmbH", "SAMSYSTEMS" },
-	{ 0x0050C2, 0x9A3000, 0x9A3FFF, "Computerwise, Inc.", "COMPUTERWISE" },
-	{ 0x0050C2, 0x9A4000, 0x9A4FFF, "Entwicklung Hard- & Software", "ENTWICKLUNG-HARD-SOFTWARE" },
-	{ 0x0050C2, 0x9A5000, 0x9A5FFF, "Conolog Corporation", "CONOLOG" },
-	{ 0x0050C2, 0x9A6000, 0x9A6FFF, "Metodo2", "METODO2" },
-	{ 0x0050C2, 0x9A7000, 0x9A7FFF, "Thales Communications & Security S.A.", "THALES-COMMUNICATION-SECURITY" },
-	{ 0x0050C2, 0x9A8000, 0x9A8FFF, "DOMIS SA", "DOMIS" },
-	{ 0x0050C2, 0x9A9000, 0x9A9FFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0x9AA000, 0x9AAFFF, "TEKO TELECOM SpA", "TEKO-TELECOM-SPA" },
-	{ 0x0050C2, 0x9AB000, 0x9ABFFF, "Electrodata Inc.", "ELECTRODATA" },
-	{ 0x0050C2, 0x9AC000, 0x9ACFFF, "Questek Australia Pty Ltd", "QUESTEK-AUSTRALIA-PTY" },
-	{ 0x0050C2, 0x9AD000, 0x9ADFFF, "Chronos Technology Ltd.", "CHRONOS" },
-	{ 0x0050C2, 0x9AE000, 0x9AEFFF, "Esensors, Inc.", "ESENSORS" },
-	{ 0x0050C2, 0x9AF000, 0x9AFFFF, "KRESS-NET Krzysztof Rutecki", "KRESS-NET-KRZYSZTOF-RUTECKI" },
-	{ 0x0050C2, 0x9B0000, 0x9B0FFF, "Ebru GmbH", "EBRU" },
-	{ 0x0050C2, 0x9B1000, 0x9B1FFF, "Bon Hora GmbH", "BON-HORA" },
-	{ 0x0050C2, 0x9B2000, 0x9B2FFF, "Mesa Labs, Inc.", "MESA-LABS" },
-	{ 0x0050C2, 0x9B3000, 0x9B3FFF, "Kahler Automation", "KAHLER-AUTOMATION" },
-	{ 0x0050C2, 0x9B4000, 0x9B4FFF, "EUKREA ELECTROMATIQUE SARL", "EUKREA-ELECTROMATIQUE-SARL" },
-	{ 0x0050C2, 0x9B5000, 0x9B5FFF, "Telegamma srl", "TELEGAMMA-SRL" },
-	{ 0x0050C2, 0x9B6000, 0x9B6FFF, "ACTECH", "ACTECH" },
-	{ 0x0050C2, 0x9B7000, 0x9B7FFF, "St. Michael Strategies", "ST-MICHAEL-STRATEGIES" },
-	{ 0x0050C2, 0x9B8000, 0x9B8FFF, "Sound Player Systems e.K.", "SOUND-PLAYER-E-K" },
-	{ 0x0050C2, 0x9B9000, 0x9B9FFF, "ISA - Intelligent Sensing Anywhere, S.A.", "ISA-INTELLIGENT-SENSING-ANYWHERE" },
-	{ 0x0050C2, 0x9BA000, 0x9BAFFF, "Connor-Winfield", "CONNOR-WINFIELD" },
-	{ 0x0050C2, 0x9BB000, 0x9BBFFF, "OMICRON electronics GmbH", "OMICRON-ELECTRONICS" },
-	{ 0x0050C2, 0x9BC000, 0x9BCFFF, "Kistler Straubenhardt GmbH", "KISTLER-STRAUBENHARDT" },
-	{ 0x0050C2, 0x9BD000, 0x9BDFFF, "Sensitron Semiconductor", "SENSITRON-SEMICONDUCTOR" },
-	{ 0x0050C2, 0x9BE000, 0x9BEFFF, "Xad Communications Ltd", "XAD-COMMUNICATION" },
-	{ 0x0050C2, 0x9BF000, 0x9BFFFF, "2N TELEKOMUNIKACE a.s.", "2N-TELEKOMUNIKACE" },
-	{ 0x0050C2, 0x9C0000, 0x9C0FFF, "Stuyts Engineering Haarlem BV", "STUYTS-ENGINEERING-HAARLEM" },
-	{ 0x0050C2, 0x9C1000, 0x9C1FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0x9C2000, 0x9C2FFF, "Team Enginers", "TEAM-ENGINERS" },
-	{ 0x0050C2, 0x9C3000, 0x9C3FFF, "GE Security-Kampro", "GE-SECURITY-KAMPRO" },
-	{ 0x0050C2, 0x9C4000, 0x9C4FFF, "Vitel Net", "VITEL-NET" },
-	{ 0x0050C2, 0x9C5000, 0x9C5FFF, "Scansonic MI GmbH", "SCANSONIC-MI" },
-	{ 0x0050C2, 0x9C6000, 0x9C6FFF, "Protronic GmbH", "PROTRONIC" },
-	{ 0x0050C2, 0x9C7000, 0x9C7FFF, "Kumera Drives Oy", "KUMERA-DRIVES-OY" },
-	{ 0x0050C2, 0x9C8000, 0x9C8FFF, "ethermetrics", "ETHERMETRICS" },
-	{ 0x0050C2, 0x9C9000, 0x9C9FFF, "LUMINEX Lighting Control Equipment", "LUMINEX-LIGHTING-CONTROL-EQUIPMENT" },
-	{ 0x0050C2, 0x9CA000, 0x9CAFFF, "ESAB-ATAS GmbH", "ESAB-ATAS" },
-	{ 0x0050C2, 0x9CB000, 0x9CBFFF, "NIS-time GmbH", "NIS-TIME" },
-	{ 0x0050C2, 0x9CC000, 0x9CCFFF, "Hirotech inc.", "HIROTECH" },
-	{ 0x0050C2, 0x9CD000, 0x9CDFFF, "Uwe Schneider GmbH", "UWE-SCHNEIDER" },
-	{ 0x0050C2, 0x9CE000, 0x9CEFFF, "Ronan Engineering", "RONAN-ENGINEERING" },
-	{ 0x0050C2, 0x9CF000, 0x9CFFFF, "Intuitive Surgical, Inc", "INTUITIVE-SURGICAL" },
-	{ 0x0050C2, 0x9D0000, 0x9D0FFF, "J. DITTRICH ELEKTRONIC GmbH & Co. KG", "J-DITTRICH-ELEKTRONIC" },
-	{ 0x0050C2, 0x9D1000, 0x9D1FFF, "Bladelius Design Group AB", "BLADELIUS-DESIGN-GROUP-AB" },
-	{ 0x0050C2, 0x9D2000, 0x9D2FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0x9D3000, 0x9D3FFF, "Telemetrie Elektronik GmbH", "TELEMETRIE-ELEKTRONIK" },
-	{ 0x0050C2, 0x9D4000, 0x9D4FFF, "FIRST", "FIRST" },
-	{ 0x0050C2, 0x9D5000, 0x9D5FFF, "Netpower Labs AB", "NETPOWER-LABS-AB" },
-	{ 0x0050C2, 0x9D6000, 0x9D6FFF, "Innovation, Institute, Inc", "INNOVATION-INSTITUTE" },
-	{ 0x0050C2, 0x9D7000, 0x9D7FFF, "Melex Inc.", "MELEX" },
-	{ 0x0050C2, 0x9D8000, 0x9D8FFF, "SAMSUNG HEAVY INDUSTRIES CO.,LTD.", "SAMSUNG-HEAVY-INDUSTRIES" },
-	{ 0x0050C2, 0x9D9000, 0x9D9FFF, "CNS Systems, Inc.", "CNS" },
-	{ 0x0050C2, 0x9DA000, 0x9DAFFF, "NEUTRONIK e.K.", "NEUTRONIK-E-K" },
-	{ 0x0050C2, 0x9DB000, 0x9DBFFF, "Walter Grotkasten", "WALTER-GROTKASTEN" },
-	{ 0x0050C2, 0x9DC000, 0x9DCFFF, "FTM Marketing Limited", "FTM-MARKETING" },
-	{ 0x0050C2, 0x9DD000, 0x9DDFFF, "Institut Dr. Foerster", "INSTITUT-DR-FOERSTER" },
-	{ 0x0050C2, 0x9DE000, 0x9DEFFF, "CHAUVIN ARNOUX", "CHAUVIN-ARNOUX" },
-	{ 0x0050C2, 0x9DF000, 0x9DFFFF, "CODEC Co., Ltd.", "CODEC" },
-	{ 0x0050C2, 0x9E0000, 0x9E0FFF, "DST Swiss AG", "DST-SWISS" },
-	{ 0x0050C2, 0x9E1000, 0x9E1FFF, "Enreduce Energy Control AB", "ENREDUCE-ENERGY-CONTROL-AB" },
-	{ 0x0050C2, 0x9E2000, 0x9E2FFF, "E-ViEWS SAFETY SYSTEMS, INC", "E-VIEWS-SAFETY" },
-	{ 0x0050C2, 0x9E3000, 0x9E3FFF, "SAI Informationstechnik", "SAI-INFORMATIONSTECHNIK" },
-	{ 0x0050C2, 0x9E4000, 0x9E4FFF, "Pyxis Controls WLL", "PYXIS-CONTROLS-WLL" },
-	{ 0x0050C2, 0x9E5000, 0x9E5FFF, "Halliburton Far East Pte Ltd", "HALLIBURTON-FAR-EAST-PTE" },
-	{ 0x0050C2, 0x9E6000, 0x9E6FFF, "Kumho Electric, Inc.", "KUMHO-ELECTRIC" },
-	{ 0x0050C2, 0x9E7000, 0x9E7FFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x0050C2, 0x9E8000, 0x9E8FFF, "Hammock Corporation", "HAMMOCK" },
-	{ 0x0050C2, 0x9E9000, 0x9E9FFF, "Ciemme Sistemi Spa", "CIEMME-SISTEMI-SPA" },
-	{ 0x0050C2, 0x9EA000, 0x9EAFFF, "SISMODULAR - Engenharia, Lda", "SISMODULAR-ENGENHARIA-LDA" },
-	{ 0x0050C2, 0x9EB000, 0x9EBFFF, "AFORE Solutions Inc.", "AFORE-SOLUTIONS" },
-	{ 0x0050C2, 0x9EC000, 0x9ECFFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0x9ED000, 0x9EDFFF, "Picell B.V.", "PICELL-B-V" },
-	{ 0x0050C2, 0x9EE000, 0x9EEFFF, "Michael Stevens & Partners Ltd", "MICHAEL-STEVENS-PARTNERS" },
-	{ 0x0050C2, 0x9EF000, 0x9EFFFF, "WoKa-Elektronik GmbH", "WOKA-ELEKTRONIK" },
-	{ 0x0050C2, 0x9F0000, 0x9F0FFF, "Veracity UK Ltd", "VERACITY-UK" },
-	{ 0x0050C2, 0x9F1000, 0x9F1FFF, "IDEAS s.r.l.", "IDEAS" },
-	{ 0x0050C2, 0x9F2000, 0x9F2FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0x9F3000, 0x9F3FFF, "Vision Technologies, Inc.", "VISION-TECHNOLOGIES" },
-	{ 0x0050C2, 0x9F4000, 0x9F4FFF, "FSR, INC.", "FSR" },
-	{ 0x0050C2, 0x9F5000, 0x9F5FFF, "Commex Technologies", "COMMEX-TECHNOLOGIES" },
-	{ 0x0050C2, 0x9F6000, 0x9F6FFF, "Ion Sense Inc.", "ION-SENSE" },
-	{ 0x0050C2, 0x9F7000, 0x9F7FFF, "Dave Jones Design", "DAVE-JONES-DESIGN" },
-	{ 0x0050C2, 0x9F8000, 0x9F8FFF, "Austco Marketing & Service (USA) ltd.", "AUSTCO-MARKETING-SERVICE-USA" },
-	{ 0x0050C2, 0x9F9000, 0x9F9FFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0x9FA000, 0x9FAFFF, "Teranex A Division of Silicon Optix", "TERANEX-A-DIVISION-OF-SILICON-OPTIX" },
-	{ 0x0050C2, 0x9FB000, 0x9FBFFF, "Villbau Kft.", "VILLBAU-KFT" },
-	{ 0x0050C2, 0x9FC000, 0x9FCFFF, "ECTEC INC.", "ECTEC" },
-	{ 0x0050C2, 0x9FD000, 0x9FDFFF, "Bitt technology-A Ltd.", "BITT-A" },
-	{ 0x0050C2, 0x9FE000, 0x9FEFFF, "SPECTRA EMBEDDED SYSTEMS", "SPECTRA-EMBEDDED" },
-	{ 0x0050C2, 0x9FF000, 0x9FFFFF, "Humphrey Products", "HUMPHREY-PRODUCTS" },
-	{ 0x0050C2, 0xA00000, 0xA00FFF, "Technovare Systems", "TECHNOVARE" },
-	{ 0x0050C2, 0xA01000, 0xA01FFF, "Patronics International LTD", "PATRONICS" },
-	{ 0x0050C2, 0xA02000, 0xA02FFF, "Reference, LLC.", "REFERENCE" },
-	{ 0x0050C2, 0xA03000, 0xA03FFF, "EEG Enterprises Inc", "EEG-ENTERPRISES" },
-	{ 0x0050C2, 0xA04000, 0xA04FFF, "TP Radio", "TP-RADIO" },
-	{ 0x0050C2, 0xA05000, 0xA05FFF, "Adgil Design Inc.", "ADGIL-DESIGN" },
-	{ 0x0050C2, 0xA06000, 0xA06FFF, "CLOOS ELECTRONIC GMBH", "CLOOS" },
-	{ 0x0050C2, 0xA07000, 0xA07FFF, "Dynon Instruments", "DYNON-INSTRUMENTS" },
-	{ 0x0050C2, 0xA08000, 0xA08FFF, "LabJack Corporation", "LABJACK" },
-	{ 0x0050C2, 0xA09000, 0xA09FFF, "Innovative American Technology", "INNOVATIVE-AMERICAN" },
-	{ 0x0050C2, 0xA0A000, 0xA0AFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0xA0B000, 0xA0BFFF, "IDS GeoRadar s.r.l.", "IDS-GEORADAR" },
-	{ 0x0050C2, 0xA0C000, 0xA0CFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xA0D000, 0xA0DFFF, "CHARLYROBOT", "CHARLYROBOT" },
-	{ 0x0050C2, 0xA0E000, 0xA0EFFF, "ENGICAM s.r.l.", "ENGICAM" },
-	{ 0x0050C2, 0xA0F000, 0xA0FFFF, "Visualware Inc", "VISUALWARE" },
-	{ 0x0050C2, 0xA10000, 0xA10FFF, "Essential Design & Integration P/L", "ESSENTIAL-DESIGN-INTEGRATION-P/L" },
-	{ 0x0050C2, 0xA11000, 0xA11FFF, "OJSC Rawenstvo", "OJSC-RAWENSTVO" },
-	{ 0x0050C2, 0xA12000, 0xA12FFF, "HCE Engineering S.r.l.", "HCE-ENGINEERING" },
-	{ 0x0050C2, 0xA13000, 0xA13FFF, "Talyst, Inc.", "TALYST" },
-	{ 0x0050C2, 0xA14000, 0xA14FFF, "Elbit Systems of America - Tallahassee Operations", "ELBIT-OF-AMERICA-TALLAHASSEE-OPERATIONS" },
-	{ 0x0050C2, 0xA15000, 0xA15FFF, "Industrial Computing Ltd", "INDUSTRIAL-COMPUTING" },
-	{ 0x0050C2, 0xA16000, 0xA16FFF, "Baudisch Electronic GmbH", "BAUDISCH" },
-	{ 0x0050C2, 0xA17000, 0xA17FFF, "Winners Satellite Electronics Corp.", "WINNERS-SATELLITE-ELECTRONICS" },
-	{ 0x0050C2, 0xA18000, 0xA18FFF, "Eoslink", "EOSLINK" },
-	{ 0x0050C2, 0xA19000, 0xA19FFF, "Icon Time Systems", "ICON-TIME" },
-	{ 0x0050C2, 0xA1A000, 0xA1AFFF, "DDL", "DDL" },
-	{ 0x0050C2, 0xA1B000, 0xA1BFFF, "Realtime Systems Ltd.", "REALTIME" },
-	{ 0x0050C2, 0xA1C000, 0xA1CFFF, "Microtechnica", "MICROTECHNICA" },
-	{ 0x0050C2, 0xA1D000, 0xA1DFFF, "SAMH Engineering Services", "SAMH-ENGINEERING-SERVICES" },
-	{ 0x0050C2, 0xA1E000, 0xA1EFFF, "MAMAC Systems, Inc.", "MAMAC" },
-	{ 0x0050C2, 0xA1F000, 0xA1FFFF, "Flight Data Systems Pty Ltd", "FLIGHT-DATA-PTY" },
-	{ 0x0050C2, 0xA20000, 0xA20FFF, "Quorum Technologies Ltd", "QUORUM-TECHNOLOGIES" },
-	{ 0x0050C2, 0xA21000, 0xA21FFF, "ISAC SRL", "ISAC-SRL" },
-	{ 0x0050C2, 0xA22000, 0xA22FFF, "Nippon Manufacturing Service Corporation (abbreviated as 'nms')", "NIPPON-MANUFACTURING-SERVICE-ABBREVIATED-AS-NMS" },
-	{ 0x0050C2, 0xA23000, 0xA23FFF, "Agility Mfg, Inc.", "AGILITY-MFG" },
-	{ 0x0050C2, 0xA24000, 0xA24FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0xA25000, 0xA25FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xA26000, 0xA26FFF, "Preferred Oil, LLC", "PREFERRED-OIL" },
-	{ 0x0050C2, 0xA27000, 0xA27FFF, "meconet e. K.", "MECONET-E-K" },
-	{ 0x0050C2, 0xA28000, 0xA28FFF, "KENDA ELECTRONIC SYSTEMS LIMITED", "KENDA" },
-	{ 0x0050C2, 0xA29000, 0xA29FFF, "Luminex Corporation", "LUMINEX" },
-	{ 0x0050C2, 0xA2A000, 0xA2AFFF, "Astronics Custom Control Concepts", "ASTRONICS-CUSTOM-CONTROL-CONCEPTS" },
-	{ 0x0050C2, 0xA2B000, 0xA2BFFF, "APRILIA RACING S.R.L.", "APRILIA-RACING" },
-	{ 0x0050C2, 0xA2C000, 0xA2CFFF, "KWS-Electronic GmbH", "KWS" },
-	{ 0x0050C2, 0xA2D000, 0xA2DFFF, "Inventure Inc.", "INVENTURE" },
-	{ 0x0050C2, 0xA2E000, 0xA2EFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x0050C2, 0xA2F000, 0xA2FFFF, "DragonFly Scientific LLC", "DRAGONFLY-SCIENTIFIC" },
-	{ 0x0050C2, 0xA30000, 0xA30FFF, "D-TA Systems", "D-TA" },
-	{ 0x0050C2, 0xA31000, 0xA31FFF, "Coolit Systems, Inc.", "COOLIT" },
-	{ 0x0050C2, 0xA32000, 0xA32FFF, "Harris Designs of NRV, Inc.", "HARRIS-DESIGNS-OF-NRV" },
-	{ 0x0050C2, 0xA33000, 0xA33FFF, "Fuji Firmware", "FUJI-FIRMWARE" },
-	{ 0x0050C2, 0xA34000, 0xA34FFF, "Casabyte Inc.", "CASABYTE" },
-	{ 0x0050C2, 0xA35000, 0xA35FFF, "Appareo Systems, LLC", "APPAREO" },
-	{ 0x0050C2, 0xA36000, 0xA36FFF, "Shenzhen Shangji electronic Co.Ltd", "SHENZHEN-SHANGJI" },
-	{ 0x0050C2, 0xA37000, 0xA37FFF, "Software Systems Plus", "SOFTWARE-PLUS" },
-	{ 0x0050C2, 0xA38000, 0xA38FFF, "Tred Displays", "TRED-DISPLAYS" },
-	{ 0x0050C2, 0xA39000, 0xA39FFF, "Industrial Data Products Ltd", "INDUSTRIAL-DATA-PRODUCTS" },
-	{ 0x0050C2, 0xA3A000, 0xA3AFFF, "Telecor Inc.", "TELECOR" },
-	{ 0x0050C2, 0xA3B000, 0xA3BFFF, "IPcontrols GmbH", "IPCONTROLS" },
-	{ 0x0050C2, 0xA3C000, 0xA3CFFF, "Brähler ICS Konferenztechnik AG", "BRAEHLER-ICS-KONFERENZTECHNIK" },
-	{ 0x0050C2, 0xA3D000, 0xA3DFFF, "OWANDY", "OWANDY" },
-	{ 0x0050C2, 0xA3E000, 0xA3EFFF, "DUEVI SNC DI MORA E SANTESE", "DUEVI-SNC-DI-MORA-E-SANTESE" },
-	{ 0x0050C2, 0xA3F000, 0xA3FFFF, "LHA Systems CC", "LHA-CC" },
-	{ 0x0050C2, 0xA40000, 0xA40FFF, "Mosberger Consulting LLC", "MOSBERGER-CONSULTING" },
-	{ 0x0050C2, 0xA41000, 0xA41FFF, "Meiryo Denshi Corp.", "MEIRYO-DENSHI" },
-	{ 0x0050C2, 0xA42000, 0xA42FFF, "RealVision Inc.", "REALVISION" },
-	{ 0x0050C2, 0xA43000, 0xA43FFF, "NKS Co.Ltd.", "NKS" },
-	{ 0x0050C2, 0xA44000, 0xA44FFF, "TORC Technologies", "TORC-TECHNOLOGIES" },
-	{ 0x0050C2, 0xA45000, 0xA45FFF, "Sofradir-EC", "SOFRADIR-EC" },
-	{ 0x0050C2, 0xA46000, 0xA46FFF, "Softronics Ltd.", "SOFTRONICS" },
-	{ 0x0050C2, 0xA47000, 0xA47FFF, "PRIMETECH ENGINEERING CORP.", "PRIMETECH-ENGINEERING" },
-	{ 0x0050C2, 0xA48000, 0xA48FFF, "Thales UK Limited", "THALES-UK" },
-	{ 0x0050C2, 0xA49000, 0xA49FFF, "Wayne Dalton Corp.", "WAYNE-DALTON" },
-	{ 0x0050C2, 0xA4A000, 0xA4AFFF, "DITRON S.r.l.", "DITRON" },
-	{ 0x0050C2, 0xA4B000, 0xA4BFFF, "L-3 Communications Mobile-Vision, Inc.", "L-3-COMMUNICATION-MOBILE-VISION" },
-	{ 0x0050C2, 0xA4C000, 0xA4CFFF, "VasoNova, Inc.", "VASONOVA" },
-	{ 0x0050C2, 0xA4D000, 0xA4DFFF, "LevelStar LLC.", "LEVELSTAR" },
-	{ 0x0050C2, 0xA4E000, 0xA4EFFF, "Conduant Corporation", "CONDUANT" },
-	{ 0x0050C2, 0xA4F000, 0xA4FFFF, "Deuta GmbH", "DEUTA" },
-	{ 0x0050C2, 0xA50000, 0xA50FFF, "i-RED Infrarot Systeme GmbH", "I-RED-INFRAROT-SYSTEME" },
-	{ 0x0050C2, 0xA51000, 0xA51FFF, "Y-products co.ltd.", "Y-PRODUCTS" },
-	{ 0x0050C2, 0xA52000, 0xA52FFF, "The VON Corporation", "THE-VON" },
-	{ 0x0050C2, 0xA53000, 0xA53FFF, "Quality & Design", "QUALITY-DESIGN" },
-	{ 0x0050C2, 0xA54000, 0xA54FFF, "Diamond Point International (Europe) Ltd", "DIAMOND-POINT-EUROPE" },
-	{ 0x0050C2, 0xA55000, 0xA55FFF, "Arrowvale Electronics", "ARROWVALE-ELECTRONICS" },
-	{ 0x0050C2, 0xA56000, 0xA56FFF, "ReaMetrix, Inc.", "REAMETRIX" },
-	{ 0x0050C2, 0xA57000, 0xA57FFF, "Juice Technologies, LLC", "JUICE-TECHNOLOGIES" },
-	{ 0x0050C2, 0xA58000, 0xA58FFF, "EPL", "EPL" },
-	{ 0x0050C2, 0xA59000, 0xA59FFF, "Televic Rail GmbH", "TELEVIC-RAIL" },
-	{ 0x0050C2, 0xA5A000, 0xA5AFFF, "ITAS A/S", "ITAS-A/S" },
-	{ 0x0050C2, 0xA5B000, 0xA5BFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xA5C000, 0xA5CFFF, "JSC Component-ASU", "JSC-COMPONENT-ASU" },
-	{ 0x0050C2, 0xA5D000, 0xA5DFFF, "MECC CO., LTD.", "MECC" },
-	{ 0x0050C2, 0xA5E000, 0xA5EFFF, "Ansen Investment Holdings Ltd.", "ANSEN-INVESTMENT-HOLDINGS" },
-	{ 0x0050C2, 0xA5F000, 0xA5FFFF, "Alga Microwave Inc", "ALGA-MICROWAVE" },
-	{ 0x0050C2, 0xA60000, 0xA60FFF, "Arrow Central Europe GmbH - Division Spoerle", "ARROW-CENTRAL-EUROPE-DIVISION-SPOERLE" },
-	{ 0x0050C2, 0xA61000, 0xA61FFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0xA62000, 0xA62FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x0050C2, 0xA63000, 0xA63FFF, "EMS Industries", "EMS-INDUSTRIES" },
-	{ 0x0050C2, 0xA64000, 0xA64FFF, "tetronik GmbH AEN", "TETRONIK-AEN" },
-	{ 0x0050C2, 0xA65000, 0xA65FFF, "Mark-O-Print GmbH", "MARK-O-PRINT" },
-	{ 0x0050C2, 0xA66000, 0xA66FFF, "DVTech", "DVTECH" },
-	{ 0x0050C2, 0xA67000, 0xA67FFF, "GSS Avionics Limited", "GSS-AVIONICS" },
-	{ 0x0050C2, 0xA68000, 0xA68FFF, "X-Pert Paint Mixing Systems", "X-PERT-PAINT-MIXING" },
-	{ 0x0050C2, 0xA69000, 0xA69FFF, "Advanced Integrated Systems", "ADVANCED-INTEGRATED" },
-	{ 0x0050C2, 0xA6A000, 0xA6AFFF, "Infocrossing", "INFOCROSSING" },
-	{ 0x0050C2, 0xA6B000, 0xA6BFFF, "Explorer Inc.", "EXPLORER" },
-	{ 0x0050C2, 0xA6C000, 0xA6CFFF, "Figment Design Laboratories", "FIGMENT-DESIGN-LABORATORIES" },
-	{ 0x0050C2, 0xA6D000, 0xA6DFFF, "DTV Innovations", "DTV-INNOVATIONS" },
-	{ 0x0050C2, 0xA6E000, 0xA6EFFF, "Screen Technics Pty Limited", "SCREEN-TECHNICS-PTY" },
-	{ 0x0050C2, 0xA6F000, 0xA6FFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xA70000, 0xA70FFF, "Reliable System Services Corp", "RELIABLE-SYSTEM-SERVICES" },
-	{ 0x0050C2, 0xA71000, 0xA71FFF, "Purite Ltd", "PURITE" },
-	{ 0x0050C2, 0xA72000, 0xA72FFF, "Gamber-Johnson LLC.", "GAMBER-JOHNSON" },
-	{ 0x0050C2, 0xA73000, 0xA73FFF, "KYOEI ENGINEERING Co.,Ltd.", "KYOEI-ENGINEERING" },
-	{ 0x0050C2, 0xA74000, 0xA74FFF, "DSP DESIGN LTD", "DSP-DESIGN" },
-	{ 0x0050C2, 0xA75000, 0xA75FFF, "JTL Systems Ltd.", "JTL" },
-	{ 0x0050C2, 0xA76000, 0xA76FFF, "Roesch & Walter Industrie-Elektronik GmbH", "ROESCH-WALTER-INDUSTRIE-ELEKTRONIK" },
-	{ 0x0050C2, 0xA77000, 0xA77FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xA78000, 0xA78FFF, "Apantac LLC", "APANTAC" },
-	{ 0x0050C2, 0xA79000, 0xA79FFF, "Saintronic", "SAINTRONIC" },
-	{ 0x0050C2, 0xA7A000, 0xA7AFFF, "DetNet South Africa PTY (LTD)", "DETNET-SOUTH-AFRICA-PTY" },
-	{ 0x0050C2, 0xA7B000, 0xA7BFFF, "Orange Tree Technologies", "ORANGE-TREE-TECHNOLOGIES" },
-	{ 0x0050C2, 0xA7C000, 0xA7CFFF, "Pneu-Logic Corporation", "PNEU-LOGIC" },
-	{ 0x0050C2, 0xA7D000, 0xA7DFFF, "Vitel Net", "VITEL-NET" },
-	{ 0x0050C2, 0xA7E000, 0xA7EFFF, "Densitron Technologies Ltd", "DENSITRON-TECHNOLOGIES" },
-	{ 0x0050C2, 0xA7F000, 0xA7FFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xA80000, 0xA80FFF, "ard sa", "ARD" },
-	{ 0x0050C2, 0xA81000, 0xA81FFF, "BPC circuits Ltd", "BPC-CIRCUITS" },
-	{ 0x0050C2, 0xA82000, 0xA82FFF, "CT Company", "CT-COMPANY" },
-	{ 0x0050C2, 0xA83000, 0xA83FFF, "Techno Sobi Co. Ltd.", "TECHNO-SOBI" },
-	{ 0x0050C2, 0xA84000, 0xA84FFF, "Lino Manfrotto +Co spa", "LINO-MANFROTTO-+-SPA" },
-	{ 0x0050C2, 0xA85000, 0xA85FFF, "JOYSYSTEM", "JOYSYSTEM" },
-	{ 0x0050C2, 0xA86000, 0xA86FFF, "LIMAB AB", "LIMAB-AB" },
-	{ 0x0050C2, 0xA87000, 0xA87FFF, "Littlemore Scientific", "LITTLEMORE-SCIENTIFIC" },
-	{ 0x0050C2, 0xA88000, 0xA88FFF, "S-SYS", "S-SYS" },
-	{ 0x0050C2, 0xA89000, 0xA89FFF, "CA Traffic Ltd", "CA-TRAFFIC" },
-	{ 0x0050C2, 0xA8A000, 0xA8AFFF, "Audio Engineering Ltd.", "AUDIO-ENGINEERING" },
-	{ 0x0050C2, 0xA8B000, 0xA8BFFF, "Navicron Oy", "NAVICRON-OY" },
-	{ 0x0050C2, 0xA8C000, 0xA8CFFF, "Redwire, LLC", "REDWIRE" },
-	{ 0x0050C2, 0xA8D000, 0xA8DFFF, "Frontier Electronic Systems Corp.", "FRONTIER" },
-	{ 0x0050C2, 0xA8E000, 0xA8EFFF, "BFI Industrie-Elektronik GmbH & Co.KG", "BFI-INDUSTRIE-ELEKTRONIK" },
-	{ 0x0050C2, 0xA8F000, 0xA8FFFF, "Quantum3D, Inc.", "QUANTUM3D" },
-	{ 0x0050C2, 0xA90000, 0xA90FFF, "S.two Corporation", "S-TWO" },
-	{ 0x0050C2, 0xA91000, 0xA91FFF, "Ceron Tech Co.,LTD", "CERON-TECH" },
-	{ 0x0050C2, 0xA92000, 0xA92FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0xA93000, 0xA93FFF, "SPX Flow Technology", "SPX-FLOW" },
-	{ 0x0050C2, 0xA94000, 0xA94FFF, "Par-Tech, Inc.", "PAR-TECH" },
-	{ 0x0050C2, 0xA95000, 0xA95FFF, "INNOVACIONES Microelectrónicas SL (AnaFocus)", "INNOVACIONES-MICROELECTRNICAS-SL-ANAFOCUS" },
-	{ 0x0050C2, 0xA96000, 0xA96FFF, "FEP SRL", "FEP-SRL" },
-	{ 0x0050C2, 0xA97000, 0xA97FFF, "MICROSYSTEMES", "MICROSYSTEMES" },
-	{ 0x0050C2, 0xA98000, 0xA98FFF, "Sentry 360 Security", "SENTRY-360-SECURITY" },
-	{ 0x0050C2, 0xA99000, 0xA99FFF, "Haivision Systems Inc", "HAIVISION" },
-	{ 0x0050C2, 0xA9A000, 0xA9AFFF, "Absolutron. LLC", "ABSOLUTRON" },
-	{ 0x0050C2, 0xA9B000, 0xA9BFFF, "PDQ Manufacturing  Inc.", "PDQ-MANUFACTURING" },
-	{ 0x0050C2, 0xA9C000, 0xA9CFFF, "Star Electronics GmbH & Co. KG", "STAR-ELECTRONICS" },
-	{ 0x0050C2, 0xA9D000, 0xA9DFFF, "Joehl & Koeferli AG", "JOEHL-KOEFERLI" },
-	{ 0x0050C2, 0xA9E000, 0xA9EFFF, "Procon Engineering Limited", "PROCON-ENGINEERING" },
-	{ 0x0050C2, 0xA9F000, 0xA9FFFF, "YellowSoft Co., Ltd.", "YELLOWSOFT" },
-	{ 0x0050C2, 0xAA0000, 0xAA0FFF, "Smith Meter, Inc.", "SMITH-METER" },
-	{ 0x0050C2, 0xAA1000, 0xAA1FFF, "ELREM ELECTRONIC AG", "ELREM" },
-	{ 0x0050C2, 0xAA2000, 0xAA2FFF, "ELPA sas", "ELPA-SAS" },
-	{ 0x0050C2, 0xAA3000, 0xAA3FFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0xAA4000, 0xAA4FFF, "PSi Printer Systems international GmbH", "PSI-PRINTER" },
-	{ 0x0050C2, 0xAA5000, 0xAA5FFF, "Tampere University of Technology", "TAMPERE-UNIVERSITY-OF" },
-	{ 0x0050C2, 0xAA6000, 0xAA6FFF, "Bassett Electronic Systems ltd", "BASSETT" },
-	{ 0x0050C2, 0xAA7000, 0xAA7FFF, "Endeas Oy", "ENDEAS-OY" },
-	{ 0x0050C2, 0xAA8000, 0xAA8FFF, "Nexans Cabling Solutions", "NEXANS-CABLING-SOLUTIONS" },
-	{ 0x0050C2, 0xAA9000, 0xAA9FFF, "SAN GIORGIO S.E.I.N. srl", "SAN-GIORGIO-S-E-I-N-SRL" },
-	{ 0x0050C2, 0xAAA000, 0xAAAFFF, "Flexible Picture Systems", "FLEXIBLE-PICTURE" },
-	{ 0x0050C2, 0xAAB000, 0xAABFFF, "BRS Sistemas Eletrônicos", "BRS-SISTEMAS-ELETRNICOS" },
-	{ 0x0050C2, 0xAAC000, 0xAACFFF, "VisiCon GmbH", "VISICON" },
-	{ 0x0050C2, 0xAAD000, 0xAADFFF, "Update Systems Inc.", "UPDATE" },
-	{ 0x0050C2, 0xAAE000, 0xAAEFFF, "OUTLINE srl", "OUTLINE-SRL" },
-	{ 0x0050C2, 0xAAF000, 0xAAFFFF, "Santa Barbara Instrument Group", "SANTA-BARBARA-INSTRUMENT-GROUP" },
-	{ 0x0050C2, 0xAB0000, 0xAB0FFF, "FRAKO Kondensatoren- und Anlagenbau GmbH", "FRAKO-KONDENSATOREN-UND-ANLAGENBAU" },
-	{ 0x0050C2, 0xAB1000, 0xAB1FFF, "Bitmanufaktur GmbH", "BITMANUFAKTUR" },
-	{ 0x0050C2, 0xAB2000, 0xAB2FFF, "ProCom Systems, Inc.", "PROCOM" },
-	{ 0x0050C2, 0xAB3000, 0xAB3FFF, "Compañía de Instrumentacion y control, S.L.", "COMPAA-DE-INSTRUMENTACION-Y-CONTROL" },
-	{ 0x0050C2, 0xAB4000, 0xAB4FFF, "n3k Informatik GmbH", "N3K-INFORMATIK" },
-	{ 0x0050C2, 0xAB5000, 0xAB5FFF, "Mettler Toledo", "METTLER-TOLEDO" },
-	{ 0x0050C2, 0xAB6000, 0xAB6FFF, "Gygax Embedded Engineering GEE.ch", "GYGAX-EMBEDDED-ENGINEERING-GEE-CH" },
-	{ 0x0050C2, 0xAB7000, 0xAB7FFF, "Twinfalls Technologies", "TWINFALLS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xAB8000, 0xAB8FFF, "AHM Limited (CLiKAPAD)", "AHM-CLIKAPAD" },
-	{ 0x0050C2, 0xAB9000, 0xAB9FFF, "Showtacle", "SHOWTACLE" },
-	{ 0x0050C2, 0xABA000, 0xABAFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xABB000, 0xABBFFF, "Volantic AB", "VOLANTIC-AB" },
-	{ 0x0050C2, 0xABC000, 0xABCFFF, "Barrick", "BARRICK" },
-	{ 0x0050C2, 0xABD000, 0xABDFFF, "Monitor Business Machines Ltd.", "MONITOR-BUSINESS-MACHINES" },
-	{ 0x0050C2, 0xABE000, 0xABEFFF, "AP Labs", "AP-LABS" },
-	{ 0x0050C2, 0xABF000, 0xABFFFF, "MCC Computer Company", "MCC-COMPANY" },
-	{ 0x0050C2, 0xAC0000, 0xAC0FFF, "DS PRO Audio Ltda", "DS-PRO-AUDIO-LTDA" },
-	{ 0x0050C2, 0xAC1000, 0xAC1FFF, "DAISHIN-DENSHI Co., Ltd", "DAISHIN-DENSHI" },
-	{ 0x0050C2, 0xAC2000, 0xAC2FFF, "OpenXS B.V.", "OPENXS-B-V" },
-	{ 0x0050C2, 0xAC3000, 0xAC3FFF, "Diversified Control, Inc.", "DIVERSIFIED-CONTROL" },
-	{ 0x0050C2, 0xAC4000, 0xAC4FFF, "Orion Technologies,LLC", "ORION-TECHNOLOGIES" },
-	{ 0x0050C2, 0xAC5000, 0xAC5FFF, "E-Motion System, Inc.", "E-MOTION-SYSTEM" },
-	{ 0x0050C2, 0xAC6000, 0xAC6FFF, "Marathon Products, Inc.", "MARATHON-PRODUCTS" },
-	{ 0x0050C2, 0xAC7000, 0xAC7FFF, "WaveIP", "WAVEIP" },
-	{ 0x0050C2, 0xAC8000, 0xAC8FFF, "Palladio Systeme GmbH", "PALLADIO-SYSTEME" },
-	{ 0x0050C2, 0xAC9000, 0xAC9FFF, "Steinbeis-Transferzentrum Embedded Design und Networking", "STEINBEIS-TRANSFERZENTRUM-EMBEDDED-DESIGN-UND-NETWORKING" },
-	{ 0x0050C2, 0xACA000, 0xACAFFF, "Soft & Control Technology s.r.o.", "SOFT-CONTROL-S-R-O" },
-	{ 0x0050C2, 0xACB000, 0xACBFFF, "U-CARE INC.", "U-CARE" },
-	{ 0x0050C2, 0xACC000, 0xACCFFF, "ProPhotonix", "PROPHOTONIX" },
-	{ 0x0050C2, 0xACD000, 0xACDFFF, "MeshWorks Wireless Oy", "MESHWORKS-WIRELESS-OY" },
-	{ 0x0050C2, 0xACE000, 0xACEFFF, "ChronoLogic Pty. Ltd.", "CHRONOLOGIC-PTY" },
-	{ 0x0050C2, 0xACF000, 0xACFFFF, "SP Controls, Inc", "SP-CONTROLS" },
-	{ 0x0050C2, 0xAD0000, 0xAD0FFF, "Geonautics Australia Pty Ltd", "GEONAUTICS-AUSTRALIA-PTY" },
-	{ 0x0050C2, 0xAD1000, 0xAD1FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xAD2000, 0xAD2FFF, "Rafael", "RAFAEL" },
-	{ 0x0050C2, 0xAD3000, 0xAD3FFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0xAD4000, 0xAD4FFF, "Global Rainmakers Inc.", "GLOBAL-RAINMAKERS" },
-	{ 0x0050C2, 0xAD5000, 0xAD5FFF, "Mighty Lube Systematic Lubrication, Inc.", "MIGHTY-LUBE-SYSTEMATIC-LUBRICATION" },
-	{ 0x0050C2, 0xAD6000, 0xAD6FFF, "Unisensor A/S", "UNISENSOR-A/S" },
-	{ 0x0050C2, 0xAD7000, 0xAD7FFF, "Air Monitors Ltd", "AIR-MONITORS" },
-	{ 0x0050C2, 0xAD8000, 0xAD8FFF, "Incyma", "INCYMA" },
-	{ 0x0050C2, 0xAD9000, 0xAD9FFF, "elettrondata srl", "ELETTRONDATA-SRL" },
-	{ 0x0050C2, 0xADA000, 0xADAFFF, "Essepie Srl", "ESSEPIE-SRL" },
-	{ 0x0050C2, 0xADB000, 0xADBFFF, "GO engineering GmbH", "GO-ENGINEERING" },
-	{ 0x0050C2, 0xADC000, 0xADCFFF, "Synthesechemie Dr. Penth GmbH", "SYNTHESECHEMIE-DR-PENTH" },
-	{ 0x0050C2, 0xADD000, 0xADDFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0xADE000, 0xADEFFF, "Neoptix Inc.", "NEOPTIX" },
-	{ 0x0050C2, 0xADF000, 0xADFFFF, "Altinex, Inc", "ALTINEX" },
-	{ 0x0050C2, 0xAE0000, 0xAE0FFF, "AT4 wireless.S.A", "AT4-WIRELESS" },
-	{ 0x0050C2, 0xAE1000, 0xAE1FFF, "EVERCARE", "EVERCARE" },
-	{ 0x0050C2, 0xAE2000, 0xAE2FFF, "Power Medical Interventions", "POWER-MEDICAL-INTERVENTIONS" },
-	{ 0x0050C2, 0xAE3000, 0xAE3FFF, "PSD", "PSD" },
-	{ 0x0050C2, 0xAE4000, 0xAE4FFF, "Advanced Electronic Designs, Inc.", "ADVANCED-DESIGNS" },
-	{ 0x0050C2, 0xAE5000, 0xAE5FFF, "ABS Gesellschaft f. Automatisierung, Bildverarbeitung und Software mbH", "ABS-GESELLSCHAFT-F-AUTOMATISIERUNG-BILDVERARBEITUNG-UND-SOFTWARE" },
-	{ 0x0050C2, 0xAE6000, 0xAE6FFF, "VECOM USA", "VECOM-USA" },
-	{ 0x0050C2, 0xAE7000, 0xAE7FFF, "Redwood Systems", "REDWOOD" },
-	{ 0x0050C2, 0xAE8000, 0xAE8FFF, "Bit-Lab PTY LTD", "BIT-LAB-PTY" },
-	{ 0x0050C2, 0xAE9000, 0xAE9FFF, "ClearCorp Enterprises, Inc", "CLEARCORP-ENTERPRISES" },
-	{ 0x0050C2, 0xAEA000, 0xAEAFFF, "EMBEDIA", "EMBEDIA" },
-	{ 0x0050C2, 0xAEB000, 0xAEBFFF, "UMLogics Corporation", "UMLOGICS" },
-	{ 0x0050C2, 0xAEC000, 0xAECFFF, "Fritz Pauker Ingenieure GmbH", "FRITZ-PAUKER-INGENIEURE" },
-	{ 0x0050C2, 0xAED000, 0xAEDFFF, "3Roam", "3ROAM" },
-	{ 0x0050C2, 0xAEE000, 0xAEEFFF, "IPtec, Inc.", "IPTEC" },
-	{ 0x0050C2, 0xAEF000, 0xAEFFFF, "National CineMedia", "NATIONAL-CINEMEDIA" },
-	{ 0x0050C2, 0xAF0000, 0xAF0FFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0xAF1000, 0xAF1FFF, "Green Goose", "GREEN-GOOSE" },
-	{ 0x0050C2, 0xAF2000, 0xAF2FFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0xAF3000, 0xAF3FFF, "Palomar Products, Inc.", "PALOMAR-PRODUCTS" },
-	{ 0x0050C2, 0xAF4000, 0xAF4FFF, "Dixell S.p.A.", "DIXELL" },
-	{ 0x0050C2, 0xAF5000, 0xAF5FFF, "Kramara s.r.o.", "KRAMARA-S-R-O" },
-	{ 0x0050C2, 0xAF6000, 0xAF6FFF, "Energid", "ENERGID" },
-	{ 0x0050C2, 0xAF7000, 0xAF7FFF, "Midwest Microwave Solutions Inc.", "MIDWEST-MICROWAVE-SOLUTIONS" },
-	{ 0x0050C2, 0xAF8000, 0xAF8FFF, "Global Satellite Engineering", "GLOBAL-SATELLITE-ENGINEERING" },
-	{ 0x0050C2, 0xAF9000, 0xAF9FFF, "Ingenieurbuero Bickele und Buehler GmbH", "INGENIEURBUERO-BICKELE-UND-BUEHLER" },
-	{ 0x0050C2, 0xAFA000, 0xAFAFFF, "Absolute Fire Solutions Inc.", "ABSOLUTE-FIRE-SOLUTIONS" },
-	{ 0x0050C2, 0xAFB000, 0xAFBFFF, "Vocality International Ltd", "VOCALITY" },
-	{ 0x0050C2, 0xAFC000, 0xAFCFFF, "Odus Technologies SA", "ODUS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xAFD000, 0xAFDFFF, "HomeScenario, Inc.", "HOMESCENARIO" },
-	{ 0x0050C2, 0xAFE000, 0xAFEFFF, "Trolex Limited", "TROLEX" },
-	{ 0x0050C2, 0xAFF000, 0xAFFFFF, "XoByte LLC", "XOBYTE" },
-	{ 0x0050C2, 0xB00000, 0xB00FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xB01000, 0xB01FFF, "HSR Harald L. Reuter", "HSR-HARALD-L-REUTER" },
-	{ 0x0050C2, 0xB02000, 0xB02FFF, "MASTER CO LTD", "MASTER" },
-	{ 0x0050C2, 0xB03000, 0xB03FFF, "Spider Tecnologia Ind. e Com. Ltda.", "SPIDER-TECNOLOGIA-IND-E-COM-LTDA" },
-	{ 0x0050C2, 0xB04000, 0xB04FFF, "Ubiquiti Inc", "UBIQUITI" },
-	{ 0x0050C2, 0xB05000, 0xB05FFF, "POLA s.r.l.", "POLA" },
-	{ 0x0050C2, 0xB06000, 0xB06FFF, "CompuDesigns, Inc.", "COMPUDESIGNS" },
-	{ 0x0050C2, 0xB07000, 0xB07FFF, "FARECO", "FARECO" },
-	{ 0x0050C2, 0xB08000, 0xB08FFF, "Goerlitz AG", "GOERLITZ" },
-	{ 0x0050C2, 0xB09000, 0xB09FFF, "Harper Chalice Group Limited", "HARPER-CHALICE-GROUP" },
-	{ 0x0050C2, 0xB0A000, 0xB0AFFF, "Indutherm Giesstechnologie GmbH", "INDUTHERM-GIESSTECHNOLOGIE" },
-	{ 0x0050C2, 0xB0B000, 0xB0BFFF, "Honeywell", "HONEYWELL" },
-	{ 0x0050C2, 0xB0C000, 0xB0CFFF, "SMARTB TECHNOLOGIES", "SMARTB-TECHNOLOGIES" },
-	{ 0x0050C2, 0xB0D000, 0xB0DFFF, "Japan Electronics System, Inc", "JAPAN-ELECTRONICS-SYSTEM" },
-	{ 0x0050C2, 0xB0E000, 0xB0EFFF, "KYAB Lulea AB", "KYAB-LULEA-AB" },
-	{ 0x0050C2, 0xB0F000, 0xB0FFFF, "NARA Controls Inc.", "NARA-CONTROLS" },
-	{ 0x0050C2, 0xB10000, 0xB10FFF, "Marine Entertainment Systems Ltd", "MARINE-ENTERTAINMENT" },
-	{ 0x0050C2, 0xB11000, 0xB11FFF, "EXEL s.r.l", "EXEL" },
-	{ 0x0050C2, 0xB12000, 0xB12FFF, "CM Elektronik GmbH", "CM-ELEKTRONIK" },
-	{ 0x0050C2, 0xB13000, 0xB13FFF, "Measy Electronics Co., Ltd.", "MEASY-ELECTRONICS" },
-	{ 0x0050C2, 0xB14000, 0xB14FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xB15000, 0xB15FFF, "PhotoTelesis LP", "PHOTOTELESIS-LP" },
-	{ 0x0050C2, 0xB16000, 0xB16FFF, "Neothings, Inc.", "NEOTHINGS" },
-	{ 0x0050C2, 0xB17000, 0xB17FFF, "Elcoteq Design Center Oy", "ELCOTEQ-DESIGN-CENTER-OY" },
-	{ 0x0050C2, 0xB18000, 0xB18FFF, "Rosslare Enterprises Limited", "ROSSLARE-ENTERPRISES" },
-	{ 0x0050C2, 0xB19000, 0xB19FFF, "Polytron Corporation", "POLYTRON" },
-	{ 0x0050C2, 0xB1A000, 0xB1AFFF, "ELCUS", "ELCUS" },
-	{ 0x0050C2, 0xB1B000, 0xB1BFFF, "Integrated  Control Corp.", "INTEGRATED-CONTROL" },
-	{ 0x0050C2, 0xB1C000, 0xB1CFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xB1D000, 0xB1DFFF, "Telegenix", "TELEGENIX" },
-	{ 0x0050C2, 0xB1E000, 0xB1EFFF, "Abbott Medical Optics", "ABBOTT-MEDICAL-OPTICS" },
-	{ 0x0050C2, 0xB1F000, 0xB1FFFF, "Atlas Copco IAS GmbH", "ATLAS-COPCO-IAS" },
-	{ 0x0050C2, 0xB20000, 0xB20FFF, "FIVE9 NETWORK SYSTEMS LLC", "FIVE9-NETWORK" },
-	{ 0x0050C2, 0xB21000, 0xB21FFF, "Phytron-Elektronik GmbH", "PHYTRON-ELEKTRONIK" },
-	{ 0x0050C2, 0xB22000, 0xB22FFF, "FarSite Communications Limited", "FARSITE-COMMUNICATION" },
-	{ 0x0050C2, 0xB23000, 0xB23FFF, "Ronyo Technologies s.r.o.", "RONYO-TECHNOLOGIES-S-R-O" },
-	{ 0x0050C2, 0xB24000, 0xB24FFF, "Teledyne Defence Limited", "TELEDYNE-DEFENCE" },
-	{ 0x0050C2, 0xB25000, 0xB25FFF, "Triax A/S", "TRIAX-A/S" },
-	{ 0x0050C2, 0xB26000, 0xB26FFF, "Elko Systems", "ELKO" },
-	{ 0x0050C2, 0xB27000, 0xB27FFF, "ATEME", "ATEME" },
-	{ 0x0050C2, 0xB28000, 0xB28FFF, "Micromax Pty. Ltd.", "MICROMAX-PTY" },
-	{ 0x0050C2, 0xB29000, 0xB29FFF, "Integra LifeSciences (Ireland) Ltd", "INTEGRA-LIFESCIENCES-IRELAND" },
-	{ 0x0050C2, 0xB2A000, 0xB2AFFF, "Trench Austria GmbH", "TRENCH-AUSTRIA" },
-	{ 0x0050C2, 0xB2B000, 0xB2BFFF, "CosmoData Informatica Ltda.", "COSMODATA-INFORMATICA-LTDA" },
-	{ 0x0050C2, 0xB2C000, 0xB2CFFF, "Concepteers, LLC", "CONCEPTEERS" },
-	{ 0x0050C2, 0xB2D000, 0xB2DFFF, "Datasat Digital Entertainment", "DATASAT-DIGITAL-ENTERTAINMENT" },
-	{ 0x0050C2, 0xB2E000, 0xB2EFFF, "ACT", "ACT" },
-	{ 0x0050C2, 0xB2F000, 0xB2FFFF, "IntelliVision Technologies, Corp", "INTELLIVISION-TECHNOLOGIES" },
-	{ 0x0050C2, 0xB30000, 0xB30FFF, "Applied Micro Electronics AME bv", "APPLIED-MICRO-ELECTRONICS-AME" },
-	{ 0x0050C2, 0xB31000, 0xB31FFF, "Shop Safe AG", "SHOP-SAFE" },
-	{ 0x0050C2, 0xB32000, 0xB32FFF, "Byres Security Inc", "BYRES-SECURITY" },
-	{ 0x0050C2, 0xB33000, 0xB33FFF, "Numcore Ltd", "NUMCORE" },
-	{ 0x0050C2, 0xB34000, 0xB34FFF, "Meisol co.,ltd", "MEISOL" },
-	{ 0x0050C2, 0xB35000, 0xB35FFF, "haneron", "HANERON" },
-	{ 0x0050C2, 0xB36000, 0xB36FFF, "CRDE", "CRDE" },
-	{ 0x0050C2, 0xB37000, 0xB37FFF, "IAdea Corporation", "IADEA" },
-	{ 0x0050C2, 0xB38000, 0xB38FFF, "Grenmore Ltd", "GRENMORE" },
-	{ 0x0050C2, 0xB39000, 0xB39FFF, "siXis, Inc.", "SIXIS" },
-	{ 0x0050C2, 0xB3A000, 0xB3AFFF, "Nikon Systems Inc.", "NIKON" },
-	{ 0x0050C2, 0xB3B000, 0xB3BFFF, "Sportvision Inc.", "SPORTVISION" },
-	{ 0x0050C2, 0xB3C000, 0xB3CFFF, "JanasCard", "JANASCARD" },
-	{ 0x0050C2, 0xB3D000, 0xB3DFFF, "AMS", "AMS" },
-	{ 0x0050C2, 0xB3E000, 0xB3EFFF, "Sage Consultants", "SAGE-CONSULTANTS" },
-	{ 0x0050C2, 0xB3F000, 0xB3FFFF, "M-Tronic Design and Technology GmbH", "M-TRONIC-DESIGN" },
-	{ 0x0050C2, 0xB40000, 0xB40FFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
-	{ 0x0050C2, 0xB41000, 0xB41FFF, "Tata Power Company, Strategic Electronics Division", "TATA-POWER-COMPANY-STRATEGIC-ELECTRONICS-DIVISION" },
-	{ 0x0050C2, 0xB42000, 0xB42FFF, "ETM Electromatic Incorporated", "ETM-ELECTROMATIC-INCORPORATED" },
-	{ 0x0050C2, 0xB43000, 0xB43FFF, "J-Systems Inc.", "J" },
-	{ 0x0050C2, 0xB44000, 0xB44FFF, "Ampcontrol Pty Ltd", "AMPCONTROL-PTY" },
-	{ 0x0050C2, 0xB45000, 0xB45FFF, "Efftronics Systems (P) Ltd", "EFFTRONICS-P" },
-	{ 0x0050C2, 0xB46000, 0xB46FFF, "Mobileye", "MOBILEYE" },
-	{ 0x0050C2, 0xB47000, 0xB47FFF, "MCS MICRONIC Computer Systeme GmbH", "MCS-MICRONIC-SYSTEME" },
-	{ 0x0050C2, 0xB48000, 0xB48FFF, "MTD GmbH", "MTD" },
-	{ 0x0050C2, 0xB49000, 0xB49FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x0050C2, 0xB4A000, 0xB4AFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xB4B000, 0xB4BFFF, "Chitose Co.,Ltd", "CHITOSE" },
-	{ 0x0050C2, 0xB4C000, 0xB4CFFF, "ElectroCom", "ELECTROCOM" },
-	{ 0x0050C2, 0xB4D000, 0xB4DFFF, "Troll Systems Corporation", "TROLL" },
-	{ 0x0050C2, 0xB4E000, 0xB4EFFF, "AixControl GmbH", "AIXCONTROL" },
-	{ 0x0050C2, 0xB4F000, 0xB4FFFF, "Sencon UK Ltd.", "SENCON-UK" },
-	{ 0x0050C2, 0xB50000, 0xB50FFF, "SELCO", "SELCO" },
-	{ 0x0050C2, 0xB51000, 0xB51FFF, "Aeroflex GmbH", "AEROFLEX" },
-	{ 0x0050C2, 0xB52000, 0xB52FFF, "SMH Technologies", "SMH-TECHNOLOGIES" },
-	{ 0x0050C2, 0xB53000, 0xB53FFF, "Prodco", "PRODCO" },
-	{ 0x0050C2, 0xB54000, 0xB54FFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER" },
-	{ 0x0050C2, 0xB55000, 0xB55FFF, "SANYO ELECTRONIC INDUSTRIES CO.,LTD", "SANYO-INDUSTRIES" },
-	{ 0x0050C2, 0xB56000, 0xB56FFF, "SINOVIA SA", "SINOVIA" },
-	{ 0x0050C2, 0xB57000, 0xB57FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xB58000, 0xB58FFF, "RealD, Inc.", "REALD" },
-	{ 0x0050C2, 0xB59000, 0xB59FFF, "SLICAN sp. z o.o.", "SLICAN-SP-Z-O-O" },
-	{ 0x0050C2, 0xB5A000, 0xB5AFFF, "GREEN Center s.r.o.", "GREEN-CENTER-S-R-O" },
-	{ 0x0050C2, 0xB5B000, 0xB5BFFF, "Timberline Manufacturing", "TIMBERLINE-MANUFACTURING" },
-	{ 0x0050C2, 0xB5C000, 0xB5CFFF, "ADI Video Technologies", "ADI-VIDEO-TECHNOLOGIES" },
-	{ 0x0050C2, 0xB5D000, 0xB5DFFF, "Plitron Manufacturing Inc.", "PLITRON-MANUFACTURING" },
-	{ 0x0050C2, 0xB5E000, 0xB5EFFF, "Palgiken Co.,Ltd.", "PALGIKEN" },
-	{ 0x0050C2, 0xB5F000, 0xB5FFFF, "North Bridge Technologies", "NORTH-BRIDGE-TECHNOLOGIES" },
-	{ 0x0050C2, 0xB60000, 0xB60FFF, "OOO NPF ATIS", "OOO-NPF-ATIS" },
-	{ 0x0050C2, 0xB61000, 0xB61FFF, "Nayos LTD", "NAYOS" },
-	{ 0x0050C2, 0xB62000, 0xB62FFF, "Rugged Controls", "RUGGED-CONTROLS" },
-	{ 0x0050C2, 0xB63000, 0xB63FFF, "RO.VE.R. Laboratories S.p.A", "RO-VE-R-LABORATORIES" },
-	{ 0x0050C2, 0xB64000, 0xB64FFF, "FEW Bauer GmbH", "FEW-BAUER" },
-	{ 0x0050C2, 0xB65000, 0xB65FFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0xB66000, 0xB66FFF, "8185", "8185" },
-	{ 0x0050C2, 0xB67000, 0xB67FFF, "RC Systems Co. Inc.", "RC" },
-	{ 0x0050C2, 0xB68000, 0xB68FFF, "Electronic Systems Protection, Inc.", "PROTECTION" },
-	{ 0x0050C2, 0xB69000, 0xB69FFF, "Thetis S.p.A.", "THETIS" },
-	{ 0x0050C2, 0xB6A000, 0xB6AFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xB6B000, 0xB6BFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xB6C000, 0xB6CFFF, "Drinelec", "DRINELEC" },
-	{ 0x0050C2, 0xB6D000, 0xB6DFFF, "Sound Metrics Corp", "SOUND-METRICS" },
-	{ 0x0050C2, 0xB6E000, 0xB6EFFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0xB6F000, 0xB6FFFF, "CT Company", "CT-COMPANY" },
-	{ 0x0050C2, 0xB70000, 0xB70FFF, "Nisshin Electronics co.,ltd.", "NISSHIN-ELECTRONICS" },
-	{ 0x0050C2, 0xB71000, 0xB71FFF, "Digitale Analoge COMponenten West Electronic Vertriebs GmbH", "DIGITALE-ANALOGE-COMPONENTEN-WEST-VERTRIEBS" },
-	{ 0x0050C2, 0xB72000, 0xB72FFF, "Advanced Desktop Systems Ltd", "ADVANCED-DESKTOP" },
-	{ 0x0050C2, 0xB73000, 0xB73FFF, "ARKRAY, Inc. Kyoto Laboratory", "ARKRAY-KYOTO-LABORATORY" },
-	{ 0x0050C2, 0xB74000, 0xB74FFF, "AXED Jakubowski Wojciechowski sp.j.", "AXED-JAKUBOWSKI-WOJCIECHOWSKI-SP-J" },
-	{ 0x0050C2, 0xB75000, 0xB75FFF, "Blankom", "BLANKOM" },
-	{ 0x0050C2, 0xB76000, 0xB76FFF, "ITF Fröschl GmbH", "ITF-FROESCHL" },
-	{ 0x0050C2, 0xB77000, 0xB77FFF, "KRISTECH", "KRISTECH" },
-	{ 0x0050C2, 0xB78000, 0xB78FFF, "Folink", "FOLINK" },
-	{ 0x0050C2, 0xB79000, 0xB79FFF, "MITSUYA LABORATORIES INC.", "MITSUYA-LABORATORIES" },
-	{ 0x0050C2, 0xB7A000, 0xB7AFFF, "Schnoor Industrieelektronik GmbH & Co. KG", "SCHNOOR-INDUSTRIEELEKTRONIK" },
-	{ 0x0050C2, 0xB7B000, 0xB7BFFF, "QUARTECH CORPORATION", "QUARTECH" },
-	{ 0x0050C2, 0xB7C000, 0xB7CFFF, "Bettini srl", "BETTINI-SRL" },
-	{ 0x0050C2, 0xB7D000, 0xB7DFFF, "ELETECH Srl", "ELETECH-SRL" },
-	{ 0x0050C2, 0xB7E000, 0xB7EFFF, "NARETRENDS", "NARETRENDS" },
-	{ 0x0050C2, 0xB7F000, 0xB7FFFF, "Enatel", "ENATEL" },
-	{ 0x0050C2, 0xB80000, 0xB80FFF, "iScreen LLC", "ISCREEN" },
-	{ 0x0050C2, 0xB81000, 0xB81FFF, "GHL Advanced Technolgy GmbH & Co. KG", "GHL-ADVANCED-TECHNOLGY" },
-	{ 0x0050C2, 0xB82000, 0xB82FFF, "TANABIKI Inc.", "TANABIKI" },
-	{ 0x0050C2, 0xB83000, 0xB83FFF, "Advanced Storage Concepts, Inc.", "ADVANCED-STORAGE-CONCEPTS" },
-	{ 0x0050C2, 0xB84000, 0xB84FFF, "Innovate Software Solutions Pvt Ltd", "INNOVATE-SOFTWARE-SOLUTIONS-PVT" },
-	{ 0x0050C2, 0xB85000, 0xB85FFF, "SilverNet", "SILVERNET" },
-	{ 0x0050C2, 0xB86000, 0xB86FFF, "ASTO", "ASTO" },
-	{ 0x0050C2, 0xB87000, 0xB87FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x0050C2, 0xB88000, 0xB88FFF, "Gigatronik  Köln GmbH", "GIGATRONIK-KOELN" },
-	{ 0x0050C2, 0xB89000, 0xB89FFF, "ENTEC Electric & Electronic Co., LTD.", "ENTEC-ELECTRIC" },
-	{ 0x0050C2, 0xB8A000, 0xB8AFFF, "MicroPoise", "MICROPOISE" },
-	{ 0x0050C2, 0xB8B000, 0xB8BFFF, "FBB", "FBB" },
-	{ 0x0050C2, 0xB8C000, 0xB8CFFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xB8D000, 0xB8DFFF, "CEMSI", "CEMSI" },
-	{ 0x0050C2, 0xB8E000, 0xB8EFFF, "WAC (Israel) Ltd.", "WAC-ISRAEL" },
-	{ 0x0050C2, 0xB8F000, 0xB8FFFF, "Gentec", "GENTEC" },
-	{ 0x0050C2, 0xB90000, 0xB90FFF, "NAONWORKS Co., Ltd", "NAONWORKS" },
-	{ 0x0050C2, 0xB91000, 0xB91FFF, "Finnet-Service Ltd.", "FINNET-SERVICE" },
-	{ 0x0050C2, 0xB92000, 0xB92FFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0xB93000, 0xB93FFF, "EMC PARTNER AG", "EMC-PARTNER" },
-	{ 0x0050C2, 0xB94000, 0xB94FFF, "Tritech International Ltd", "TRITECH" },
-	{ 0x0050C2, 0xB95000, 0xB95FFF, "Rx Monitoring Services", "RX-MONITORING-SERVICES" },
-	{ 0x0050C2, 0xB96000, 0xB96FFF, "Onix Electronic Systems Inc", "ONIX" },
-	{ 0x0050C2, 0xB97000, 0xB97FFF, "ikerlan", "IKERLAN" },
-	{ 0x0050C2, 0xB98000, 0xB98FFF, "Southwest Research Institute", "SOUTHWEST-RESEARCH-INSTITUTE" },
-	{ 0x0050C2, 0xB99000, 0xB99FFF, "Greenlight Innovation Corp.", "GREENLIGHT-INNOVATION" },
-	{ 0x0050C2, 0xB9A000, 0xB9AFFF, "Talo, NV Inc", "TALO-NV" },
-	{ 0x0050C2, 0xB9B000, 0xB9BFFF, "Telventy Energia S.A.", "TELVENTY-ENERGIA" },
-	{ 0x0050C2, 0xB9C000, 0xB9CFFF, "DAVE SRL", "DAVE-SRL" },
-	{ 0x0050C2, 0xB9D000, 0xB9DFFF, "W. Vershoven GmbH", "W-VERSHOVEN" },
-	{ 0x0050C2, 0xB9E000, 0xB9EFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xB9F000, 0xB9FFFF, "AUDIOSCOPE 2K SRL", "AUDIOSCOPE-2K-SRL" },
-	{ 0x0050C2, 0xBA0000, 0xBA0FFF, "txtr GmbH", "TXTR" },
-	{ 0x0050C2, 0xBA1000, 0xBA1FFF, "Transtechnik GmbH & Co.KG", "TRANSTECHNIK" },
-	{ 0x0050C2, 0xBA2000, 0xBA2FFF, "Logical Tools s.r.l.", "LOGICAL-TOOLS" },
-	{ 0x0050C2, 0xBA3000, 0xBA3FFF, "DSP DESIGN LTD", "DSP-DESIGN" },
-	{ 0x0050C2, 0xBA4000, 0xBA4FFF, "CUSTOS MOBILE S.L.", "CUSTOS-MOBILE" },
-	{ 0x0050C2, 0xBA5000, 0xBA5FFF, "InterCel Pty Ltd", "INTERCEL-PTY" },
-	{ 0x0050C2, 0xBA6000, 0xBA6FFF, "Jomitek", "JOMITEK" },
-	{ 0x0050C2, 0xBA7000, 0xBA7FFF, "RaumComputer Entwicklungs- und Vertriebs GmbH", "RAUMCOMPUTER-ENTWICKLUNGS-UND-VERTRIEBS" },
-	{ 0x0050C2, 0xBA8000, 0xBA8FFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0xBA9000, 0xBA9FFF, "SISS Technology Inc.", "SISS" },
-	{ 0x0050C2, 0xBAA000, 0xBAAFFF, "NetworkFX Communications, LLC", "NETWORKFX-COMMUNICATION" },
-	{ 0x0050C2, 0xBAB000, 0xBABFFF, "iDeal Teknoloji Bilisim Cozumleri A.S.", "IDEAL-TEKNOLOJI-BILISIM-COZUMLERI" },
-	{ 0x0050C2, 0xBAC000, 0xBACFFF, "VITECO VNPT JSC", "VITECO-VNPT-JSC" },
-	{ 0x0050C2, 0xBAD000, 0xBADFFF, "Prediktor AS", "PREDIKTOR-AS" },
-	{ 0x0050C2, 0xBAE000, 0xBAEFFF, "Fiber Connections Inc.", "FIBER-CONNECTIONS" },
-	{ 0x0050C2, 0xBAF000, 0xBAFFFF, "MangoDSP", "MANGODSP" },
-	{ 0x0050C2, 0xBB0000, 0xBB0FFF, "Gainbrain", "GAINBRAIN" },
-	{ 0x0050C2, 0xBB1000, 0xBB1FFF, "Pro4tech", "PRO4TECH" },
-	{ 0x0050C2, 0xBB2000, 0xBB2FFF, "St Michael Strategies Inc", "ST-MICHAEL-STRATEGIES" },
-	{ 0x0050C2, 0xBB3000, 0xBB3FFF, "ClimateWell AB (publ)", "CLIMATEWELL-AB-PUBL" },
-	{ 0x0050C2, 0xBB4000, 0xBB4FFF, "JSC Electrical Equipment Factory", "JSC-ELECTRICAL-EQUIPMENT-FACTORY" },
-	{ 0x0050C2, 0xBB5000, 0xBB5FFF, "MROAD INFORMATION SYSTEM", "MROAD-INFORMATION-SYSTEM" },
-	{ 0x0050C2, 0xBB6000, 0xBB6FFF, "Quarch Technology Ltd", "QUARCH" },
-	{ 0x0050C2, 0xBB7000, 0xBB7FFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0xBB8000, 0xBB8FFF, "MoeTronix", "MOETRONIX" },
-	{ 0x0050C2, 0xBB9000, 0xBB9FFF, "Toptech Systems, Inc.", "TOPTECH" },
-	{ 0x0050C2, 0xBBA000, 0xBBAFFF, "Systemteq Limited", "SYSTEMTEQ" },
-	{ 0x0050C2, 0xBBB000, 0xBBBFFF, "GHL Systems Berhad", "GHL-BERHAD" },
-	{ 0x0050C2, 0xBBC000, 0xBBCFFF, "ImpactSystems", "IMPACTSYSTEMS" },
-	{ 0x0050C2, 0xBBD000, 0xBBDFFF, "ITS Telecom", "ITS-TELECOM" },
-	{ 0x0050C2, 0xBBE000, 0xBBEFFF, "Onlinepizza Norden AB", "ONLINEPIZZA-NORDEN-AB" },
-	{ 0x0050C2, 0xBBF000, 0xBBFFFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xBC0000, 0xBC0FFF, "Galaxia Electronics", "GALAXIA-ELECTRONICS" },
-	{ 0x0050C2, 0xBC1000, 0xBC1FFF, "Sentec Ltd", "SENTEC" },
-	{ 0x0050C2, 0xBC2000, 0xBC2FFF, "Xslent Energy Technologies. LLC", "XSLENT-ENERGY-TECHNOLOGIES" },
-	{ 0x0050C2, 0xBC3000, 0xBC3FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xBC4000, 0xBC4FFF, "Wheatstone Corporation", "WHEATSTONE" },
-	{ 0x0050C2, 0xBC5000, 0xBC5FFF, "Toptechnology SRL", "TOPTECHNOLOGY-SRL" },
-	{ 0x0050C2, 0xBC6000, 0xBC6FFF, "MireroTack", "MIREROTACK" },
-	{ 0x0050C2, 0xBC7000, 0xBC7FFF, "PTS GmbH", "PTS" },
-	{ 0x0050C2, 0xBC8000, 0xBC8FFF, "AGWTech Ltd", "AGWTECH" },
-	{ 0x0050C2, 0xBC9000, 0xBC9FFF, "Nextmove Technologies", "NEXTMOVE-TECHNOLOGIES" },
-	{ 0x0050C2, 0xBCA000, 0xBCAFFF, "Aitecsystem Co.,Ltd.", "AITECSYSTEM" },
-	{ 0x0050C2, 0xBCB000, 0xBCBFFF, "ARTEIXO TELECOM", "ARTEIXO-TELECOM" },
-	{ 0x0050C2, 0xBCC000, 0xBCCFFF, "VVDN TECHNOLOGIES PVT. LTD.", "VVDN-TECHNOLOGIES-PVT" },
-	{ 0x0050C2, 0xBCD000, 0xBCDFFF, "Highlight Parking Systems Ltd", "HIGHLIGHT-PARKING" },
-	{ 0x0050C2, 0xBCE000, 0xBCEFFF, "TV Portal Co., Ltd.", "TV-PORTAL" },
-	{ 0x0050C2, 0xBCF000, 0xBCFFFF, "Epiko, elektronski sistemi d.o.o.", "EPIKO-ELEKTRONSKI-SISTEMI-D-O-O" },
-	{ 0x0050C2, 0xBD0000, 0xBD0FFF, "EDC wifi", "EDC-WIFI" },
-	{ 0x0050C2, 0xBD1000, 0xBD1FFF, "Ariem Technologies Pvt Ltd", "ARIEM-TECHNOLOGIES-PVT" },
-	{ 0x0050C2, 0xBD2000, 0xBD2FFF, "Percello Ltd.", "PERCELLO" },
-	{ 0x0050C2, 0xBD3000, 0xBD3FFF, "Postjet Systems Ltd", "POSTJET" },
-	{ 0x0050C2, 0xBD4000, 0xBD4FFF, "Global Security Devices", "GLOBAL-SECURITY-DEVICES" },
-	{ 0x0050C2, 0xBD5000, 0xBD5FFF, "RF-Embedded GmbH", "RF-EMBEDDED" },
-	{ 0x0050C2, 0xBD6000, 0xBD6FFF, "BG Systems, Inc.", "BG" },
-	{ 0x0050C2, 0xBD7000, 0xBD7FFF, "SLAT", "SLAT" },
-	{ 0x0050C2, 0xBD8000, 0xBD8FFF, "b.a.b-technologie gmbh", "B-A-B-TECHNOLOGIE" },
-	{ 0x0050C2, 0xBD9000, 0xBD9FFF, "AMS Controls, Inc.", "AMS-CONTROLS" },
-	{ 0x0050C2, 0xBDA000, 0xBDAFFF, "Digital Lumens", "DIGITAL-LUMENS" },
-	{ 0x0050C2, 0xBDB000, 0xBDBFFF, "GasTOPS Ltd.", "GASTOPS" },
-	{ 0x0050C2, 0xBDC000, 0xBDCFFF, "SS Systems LLC", "SS" },
-	{ 0x0050C2, 0xBDE000, 0xBDEFFF, "Evo-Teh d.o.o.", "EVO-TEH-D-O-O" },
-	{ 0x0050C2, 0xBDF000, 0xBDFFFF, "Euro-Konsult Sp. z o.o.", "EURO-KONSULT-SP-Z-O-O" },
-	{ 0x0050C2, 0xBE0000, 0xBE0FFF, "Phaedrus Limited", "PHAEDRUS" },
-	{ 0x0050C2, 0xBE1000, 0xBE1FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0xBE2000, 0xBE2FFF, "Convergent Bioscience Ltd.", "CONVERGENT-BIOSCIENCE" },
-	{ 0x0050C2, 0xBE3000, 0xBE3FFF, "Jiskoot Ltd", "JISKOOT" },
-	{ 0x0050C2, 0xBE4000, 0xBE4FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0xBE5000, 0xBE5FFF, "RF Code", "RF-CODE" },
-	{ 0x0050C2, 0xBE6000, 0xBE6FFF, "Docobo Ltd", "DOCOBO" },
-	{ 0x0050C2, 0xBE7000, 0xBE7FFF, "Genetec Inc.", "GENETEC" },
-	{ 0x0050C2, 0xBE8000, 0xBE8FFF, "VEHICLE TESTING EQUIPMENT, S.L.", "VEHICLE-TESTING-EQUIPMENT" },
-	{ 0x0050C2, 0xBE9000, 0xBE9FFF, "ZUCCHETTI SPA", "ZUCCHETTI-SPA" },
-	{ 0x0050C2, 0xBEA000, 0xBEAFFF, "Daeyoung inc.", "DAEYOUNG" },
-	{ 0x0050C2, 0xBEB000, 0xBEBFFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0xBEC000, 0xBECFFF, "DRS Laruel Technologies", "DRS-LARUEL-TECHNOLOGIES" },
-	{ 0x0050C2, 0xBED000, 0xBEDFFF, "Touch Revolution Inc.", "TOUCH-REVOLUTION" },
-	{ 0x0050C2, 0xBEE000, 0xBEEFFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0xBEF000, 0xBEFFFF, "SOCIEDAD IBERICA DE CONSTRUCCIONES ELECTRICAS, S.A. (SICE)", "SOCIEDAD-IBERICA-DE-CONSTRUCCIONES-ELECTRICAS-SICE" },
-	{ 0x0050C2, 0xBF0000, 0xBF0FFF, "AIM", "AIM" },
-	{ 0x0050C2, 0xBF1000, 0xBF1FFF, "Amatic Industries GmbH", "AMATIC-INDUSTRIES" },
-	{ 0x0050C2, 0xBF2000, 0xBF2FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xBF3000, 0xBF3FFF, "Wanco Inc.", "WANCO" },
-	{ 0x0050C2, 0xBF4000, 0xBF4FFF, "Monarch Innovative Technologies Pvt Ltd", "MONARCH-INNOVATIVE-TECHNOLOGIES-PVT" },
-	{ 0x0050C2, 0xBF5000, 0xBF5FFF, "AILES ELECTRONICS CO., LTD.", "AILES-ELECTRONICS" },
-	{ 0x0050C2, 0xBF6000, 0xBF6FFF, "NOLAM EMBEDDED SYSTEMS", "NOLAM-EMBEDDED" },
-	{ 0x0050C2, 0xBF7000, 0xBF7FFF, "Phytec Messtechnik GmbH", "PHYTEC-MESSTECHNIK" },
-	{ 0x0050C2, 0xBF8000, 0xBF8FFF, "Crtiical Link", "CRTIICAL-LINK" },
-	{ 0x0050C2, 0xBF9000, 0xBF9FFF, "Vitel Net", "VITEL-NET" },
-	{ 0x0050C2, 0xBFA000, 0xBFAFFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xBFB000, 0xBFBFFF, "ECS Srl", "ECS-SRL" },
-	{ 0x0050C2, 0xBFC000, 0xBFCFFF, "Altronix Corporation", "ALTRONIX" },
-	{ 0x0050C2, 0xBFD000, 0xBFDFFF, "Ernemann Cine Tec GmbH", "ERNEMANN-CINE-TEC" },
-	{ 0x0050C2, 0xBFE000, 0xBFEFFF, "Ingeteam Paneles S.A.U.", "INGETEAM-PANELES-U" },
-	{ 0x0050C2, 0xBFF000, 0xBFFFFF, "I.S.A. S.r.l.", "I" },
-	{ 0x0050C2, 0xC00000, 0xC00FFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0xC01000, 0xC01FFF, "QUERCUS TECHNOLOGIES, S.L.", "QUERCUS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xC02000, 0xC02FFF, "Hanning Elektro-Werke GmbH & Co. KG", "HANNING-ELEKTRO-WERKE" },
-	{ 0x0050C2, 0xC03000, 0xC03FFF, "Volumatic Limited.", "VOLUMATIC" },
-	{ 0x0050C2, 0xC04000, 0xC04FFF, "SoGEME", "SOGEME" },
-	{ 0x0050C2, 0xC05000, 0xC05FFF, "Doppler Systems LLC", "DOPPLER" },
-	{ 0x0050C2, 0xC06000, 0xC06FFF, "ANALOG WAY", "ANALOG-WAY" },
-	{ 0x0050C2, 0xC07000, 0xC07FFF, "CIO Informatique Industrielle", "CIO-INFORMATIQUE-INDUSTRIELLE" },
-	{ 0x0050C2, 0xC08000, 0xC08FFF, "juiceboss", "JUICEBOSS" },
-	{ 0x0050C2, 0xC09000, 0xC09FFF, "Globe Wireless", "GLOBE-WIRELESS" },
-	{ 0x0050C2, 0xC0A000, 0xC0AFFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0xC0B000, 0xC0BFFF, "ProSourcing GmbH", "PROSOURCING" },
-	{ 0x0050C2, 0xC0C000, 0xC0CFFF, "Altierre", "ALTIERRE" },
-	{ 0x0050C2, 0xC0D000, 0xC0DFFF, "Fr. SauterAG", "FR-SAUTERAG" },
-	{ 0x0050C2, 0xC0E000, 0xC0EFFF, "AVItronic GmbH", "AVITRONIC" },
-	{ 0x0050C2, 0xC0F000, 0xC0FFFF, "DYCEC, S.A.", "DYCEC" },
-	{ 0x0050C2, 0xC10000, 0xC10FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xC11000, 0xC11FFF, "ART Antriebs- und Regeltechnik GmbH", "ART-ANTRIEBS-UND-REGELTECHNIK" },
-	{ 0x0050C2, 0xC12000, 0xC12FFF, "OKI DENKI BOHSAI CO.,LTD.", "OKI-DENKI-BOHSAI" },
-	{ 0x0050C2, 0xC13000, 0xC13FFF, "Dantec Dynamics A/S", "DANTEC-DYNAMICS-A/S" },
-	{ 0x0050C2, 0xC14000, 0xC14FFF, "Spectronix Corporation", "SPECTRONIX" },
-	{ 0x0050C2, 0xC15000, 0xC15FFF, "INO - Institut National d'Optique", "INO-INSTITUT-NATIONAL-D-OPTIQUE" },
-	{ 0x0050C2, 0xC16000, 0xC16FFF, "OMICRON electronics GmbH", "OMICRON-ELECTRONICS" },
-	{ 0x0050C2, 0xC17000, 0xC17FFF, "Axis-Shield PoC AS", "AXIS-SHIELD-POC-AS" },
-	{ 0x0050C2, 0xC18000, 0xC18FFF, "Linuxstamp Designs, LLC", "LINUXSTAMP-DESIGNS" },
-	{ 0x0050C2, 0xC19000, 0xC19FFF, "Ibercomp SA", "IBERCOMP" },
-	{ 0x0050C2, 0xC1A000, 0xC1AFFF, "SAM Co., Ltd.", "SAM" },
-	{ 0x0050C2, 0xC1B000, 0xC1BFFF, "Graesslin GmbH", "GRAESSLIN" },
-	{ 0x0050C2, 0xC1C000, 0xC1CFFF, "Becton Dickinson", "BECTON-DICKINSON" },
-	{ 0x0050C2, 0xC1D000, 0xC1DFFF, "Powerbase Energy Systems Inc.", "POWERBASE-ENERGY" },
-	{ 0x0050C2, 0xC1E000, 0xC1EFFF, "Peperoni-Light", "PEPERONI-LIGHT" },
-	{ 0x0050C2, 0xC1F000, 0xC1FFFF, "Specialist Electronics Services Ltd", "SPECIALIST-ELECTRONICS-SERVICES" },
-	{ 0x0050C2, 0xC20000, 0xC20FFF, "SRC Computers, LLC", "SRC-COMPUTERS" },
-	{ 0x0050C2, 0xC21000, 0xC21FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0xC22000, 0xC22FFF, "Audient Ltd", "AUDIENT" },
-	{ 0x0050C2, 0xC23000, 0xC23FFF, "Vidicon LLC", "VIDICON" },
-	{ 0x0050C2, 0xC24000, 0xC24FFF, "Qualnetics Corporation", "QUALNETICS" },
-	{ 0x0050C2, 0xC25000, 0xC25FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0xC26000, 0xC26FFF, "Austco Marketing & Service (USA) ltd.", "AUSTCO-MARKETING-SERVICE-USA" },
-	{ 0x0050C2, 0xC27000, 0xC27FFF, "Qtechnology A/S", "QTECHNOLOGY-A/S" },
-	{ 0x0050C2, 0xC28000, 0xC28FFF, "ELREHA GmbH", "ELREHA" },
-	{ 0x0050C2, 0xC29000, 0xC29FFF, "Newtel Engineering S.r.l.", "NEWTEL-ENGINEERING" },
-	{ 0x0050C2, 0xC2A000, 0xC2AFFF, "RealTime Systems Ltd", "REALTIME" },
-	{ 0x0050C2, 0xC2B000, 0xC2BFFF, "Z-App Systems, Inc.", "Z-APP" },
-	{ 0x0050C2, 0xC2C000, 0xC2CFFF, "bach-messtechnik gmbh", "BACH-MESSTECHNIK" },
-	{ 0x0050C2, 0xC2D000, 0xC2DFFF, "Digitale Analoge COMponenten West Electronic Vertriebs GmbH", "DIGITALE-ANALOGE-COMPONENTEN-WEST-VERTRIEBS" },
-	{ 0x0050C2, 0xC2E000, 0xC2EFFF, "DISMUNTEL SAL", "DISMUNTEL-SAL" },
-	{ 0x0050C2, 0xC2F000, 0xC2FFFF, "REFLEX CES", "REFLEX-CES" },
-	{ 0x0050C2, 0xC30000, 0xC30FFF, "Wagner Group GmbH", "WAGNER-GROUP" },
-	{ 0x0050C2, 0xC31000, 0xC31FFF, "4D Technology Corporation", "4D" },
-	{ 0x0050C2, 0xC32000, 0xC32FFF, "Procon Electronics", "PROCON-ELECTRONICS" },
-	{ 0x0050C2, 0xC34000, 0xC34FFF, "Kyuhen", "KYUHEN" },
-	{ 0x0050C2, 0xC35000, 0xC35FFF, "Insitu, Inc", "INSITU" },
-	{ 0x0050C2, 0xC36000, 0xC36FFF, "SET GmbH", "SET" },
-	{ 0x0050C2, 0xC37000, 0xC37FFF, "B.E.A.R. Solutions (Australasia) Pty, Ltd", "B-E-A-R-SOLUTIONS-AUSTRALASIA-PTY" },
-	{ 0x0050C2, 0xC38000, 0xC38FFF, "Computer Automation Technology Inc", "AUTOMATION" },
-	{ 0x0050C2, 0xC39000, 0xC39FFF, "SECAD SA", "SECAD" },
-	{ 0x0050C2, 0xC3A000, 0xC3AFFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0xC3B000, 0xC3BFFF, "ELEKTRO-AUTOMATIK GmbH & Co. KG", "ELEKTRO-AUTOMATIK" },
-	{ 0x0050C2, 0xC3C000, 0xC3CFFF, "ELSIST S.r.l.", "ELSIST" },
-	{ 0x0050C2, 0xC3D000, 0xC3DFFF, "PLA ELECTRO APPLIANCES PVT. LTD.", "PLA-ELECTRO-APPLIANCES-PVT" },
-	{ 0x0050C2, 0xC3E000, 0xC3EFFF, "Sysacom", "SYSACOM" },
-	{ 0x0050C2, 0xC3F000, 0xC3FFFF, "ANXeBusiness Corporation", "ANXEBUSINESS" },
-	{ 0x0050C2, 0xC40000, 0xC40FFF, "BAE Systems Bofors AB", "BAE-BOFORS-AB" },
-	{ 0x0050C2, 0xC41000, 0xC41FFF, "COMPRION GmbH", "COMPRION" },
-	{ 0x0050C2, 0xC42000, 0xC42FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xC43000, 0xC43FFF, "Cammegh Limited", "CAMMEGH" },
-	{ 0x0050C2, 0xC44000, 0xC44FFF, "Beijing Zhongherongzhi Elec.&Tech.Co.,Ltd.", "BEIJING-ZHONGHERONGZHI-ELEC-TECH" },
-	{ 0x0050C2, 0xC45000, 0xC45FFF, "Galvamat & Unican Technologies SA", "GALVAMAT-UNICAN-TECHNOLOGIES" },
-	{ 0x0050C2, 0xC46000, 0xC46FFF, "QNE GmbH & Co. KG", "QNE" },
-	{ 0x0050C2, 0xC47000, 0xC47FFF, "Weltek Technologies Co. Ltd.", "WELTEK-TECHNOLOGIES" },
-	{ 0x0050C2, 0xC48000, 0xC48FFF, "Cytek Media Systems, INC.", "CYTEK-MEDIA" },
-	{ 0x0050C2, 0xC49000, 0xC49FFF, "Elektronic Thoma GmbH", "ELEKTRONIC-THOMA" },
-	{ 0x0050C2, 0xC4A000, 0xC4AFFF, "Herrick Technology Laboratories, Inc.", "HERRICK-LABORATORIES" },
-	{ 0x0050C2, 0xC4B000, 0xC4BFFF, "R.V.R. elettronica s.p.a.", "R-V-R-ELETTRONICA" },
-	{ 0x0050C2, 0xC4C000, 0xC4CFFF, "Lancier Monitoring GmbH", "LANCIER-MONITORING" },
-	{ 0x0050C2, 0xC4D000, 0xC4DFFF, "Industrial Automation Systems", "INDUSTRIAL-AUTOMATION" },
-	{ 0x0050C2, 0xC4E000, 0xC4EFFF, "Elaso AG", "ELASO" },
-	{ 0x0050C2, 0xC4F000, 0xC4FFFF, "Powersense A/S", "POWERSENSE-A/S" },
-	{ 0x0050C2, 0xC50000, 0xC50FFF, "Beceem Communications, Inc.", "BECEEM-COMMUNICATION" },
-	{ 0x0050C2, 0xC51000, 0xC51FFF, "InForce Computing, Inc.", "INFORCE-COMPUTING" },
-	{ 0x0050C2, 0xC52000, 0xC52FFF, "Smartfield, Inc.", "SMARTFIELD" },
-	{ 0x0050C2, 0xC53000, 0xC53FFF, "Eilersen Electric A/S", "EILERSEN-ELECTRIC-A/S" },
-	{ 0x0050C2, 0xC54000, 0xC54FFF, "HPC Platform", "HPC-PLATFORM" },
-	{ 0x0050C2, 0xC55000, 0xC55FFF, "Watterott electronic", "WATTEROTT" },
-	{ 0x0050C2, 0xC56000, 0xC56FFF, "Spirent Communications", "SPIRENT-COMMUNICATION" },
-	{ 0x0050C2, 0xC57000, 0xC57FFF, "High Speed Design, Inc.", "HIGH-SPEED-DESIGN" },
-	{ 0x0050C2, 0xC58000, 0xC58FFF, "Foerster-Technik GmbH", "FOERSTER-TECHNIK" },
-	{ 0x0050C2, 0xC59000, 0xC59FFF, "SKD System AB", "SKD-SYSTEM-AB" },
-	{ 0x0050C2, 0xC5A000, 0xC5AFFF, "Commotive A/S", "COMMOTIVE-A/S" },
-	{ 0x0050C2, 0xC5B000, 0xC5BFFF, "MICRO TECHNICA", "MICRO-TECHNICA" },
-	{ 0x0050C2, 0xC5C000, 0xC5CFFF, "WAVECOM ELEKTRONIK AG", "WAVECOM-ELEKTRONIK" },
-	{ 0x0050C2, 0xC5D000, 0xC5DFFF, "SweMet AB", "SWEMET-AB" },
-	{ 0x0050C2, 0xC5E000, 0xC5EFFF, "CellPlus technologies, Inc.", "CELLPLUS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xC5F000, 0xC5FFFF, "Icon Time Systems", "ICON-TIME" },
-	{ 0x0050C2, 0xC60000, 0xC60FFF, "Integration Technologies Limited", "INTEGRATION-TECHNOLOGIES" },
-	{ 0x0050C2, 0xC61000, 0xC61FFF, "HaiVision Systems Incorporated", "HAIVISION-INCORPORATED" },
-	{ 0x0050C2, 0xC62000, 0xC62FFF, "Zeus Systems Private Limited", "ZEUS-PRIVATE" },
-	{ 0x0050C2, 0xC63000, 0xC63FFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL" },
-	{ 0x0050C2, 0xC64000, 0xC64FFF, "Pal Software Service Co.,Ltd.", "PAL-SOFTWARE-SERVICE" },
-	{ 0x0050C2, 0xC65000, 0xC65FFF, "Micro I/O Servicos de Electronica, Lda", "MICRO-I/O-SERVICOS-DE-ELECTRONICA-LDA" },
-	{ 0x0050C2, 0xC66000, 0xC66FFF, "KS Beschallungstechnik GmbH", "KS-BESCHALLUNGSTECHNIK" },
-	{ 0x0050C2, 0xC67000, 0xC67FFF, "Practical Control Ltd", "PRACTICAL-CONTROL" },
-	{ 0x0050C2, 0xC68000, 0xC68FFF, "Broadsoft PacketSmart, Inc.", "BROADSOFT-PACKETSMART" },
-	{ 0x0050C2, 0xC69000, 0xC69FFF, "REBO CO.,LTD.", "REBO" },
-	{ 0x0050C2, 0xC6A000, 0xC6AFFF, "ELECTRONICA KELD", "ELECTRONICA-KELD" },
-	{ 0x0050C2, 0xC6B000, 0xC6BFFF, "SiGarden Sp z o.o.", "SIGARDEN-SP-Z-O-O" },
-	{ 0x0050C2, 0xC6C000, 0xC6CFFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x0050C2, 0xC6D000, 0xC6DFFF, "Deansoft CO., Ltd.", "DEANSOFT" },
-	{ 0x0050C2, 0xC6E000, 0xC6EFFF, "TBS Holding AG", "TBS-HOLDING" },
-	{ 0x0050C2, 0xC6F000, 0xC6FFFF, "MSB Elektronik und Geraetebau GmbH", "MSB-ELEKTRONIK-UND-GERAETEBAU" },
-	{ 0x0050C2, 0xC70000, 0xC70FFF, "Wilke Technology GmbH", "WILKE" },
-	{ 0x0050C2, 0xC71000, 0xC71FFF, "Sequoia Technology Group Ltd", "SEQUOIA-GROUP" },
-	{ 0x0050C2, 0xC72000, 0xC72FFF, "Quail", "QUAIL" },
-	{ 0x0050C2, 0xC73000, 0xC73FFF, "Industry Controls, Inc.", "INDUSTRY-CONTROLS" },
-	{ 0x0050C2, 0xC74000, 0xC74FFF, "Wapice Ltd.", "WAPICE" },
-	{ 0x0050C2, 0xC75000, 0xC75FFF, "Rovsing A/S", "ROVSING-A/S" },
-	{ 0x0050C2, 0xC76000, 0xC76FFF, "GridManager A/S", "GRIDMANAGER-A/S" },
-	{ 0x0050C2, 0xC77000, 0xC77FFF, "AIM Co.,Ltd", "AIM" },
-	{ 0x0050C2, 0xC78000, 0xC78FFF, "9Solutions Oy", "9SOLUTIONS-OY" },
-	{ 0x0050C2, 0xC79000, 0xC79FFF, "CODESYSTEM Co.,Ltd", "CODESYSTEM" },
-	{ 0x0050C2, 0xC7A000, 0xC7AFFF, "Protonic Holland", "PROTONIC-HOLLAND" },
-	{ 0x0050C2, 0xC7B000, 0xC7BFFF, "Honeywell", "HONEYWELL" },
-	{ 0x0050C2, 0xC7C000, 0xC7CFFF, "Keysight Technologies Inc.", "KEYSIGHT-TECHNOLOGIES" },
-	{ 0x0050C2, 0xC7D000, 0xC7DFFF, "TAE Antriebstechnik GmbH", "TAE-ANTRIEBSTECHNIK" },
-	{ 0x0050C2, 0xC7E000, 0xC7EFFF, "Buerkert Werke GmbH", "BUERKERT-WERKE" },
-	{ 0x0050C2, 0xC7F000, 0xC7FFFF, "Kinects Solutions Inc", "KINECTS-SOLUTIONS" },
-	{ 0x0050C2, 0xC80000, 0xC80FFF, "Reko-vek", "REKO-VEK" },
-	{ 0x0050C2, 0xC81000, 0xC81FFF, "Odyssee Systemes SAS", "ODYSSEE-SYSTEMES-SAS" },
-	{ 0x0050C2, 0xC82000, 0xC82FFF, "Kyosha Industries", "KYOSHA-INDUSTRIES" },
-	{ 0x0050C2, 0xC83000, 0xC83FFF, "Gronic Systems GmbH", "GRONIC" },
-	{ 0x0050C2, 0xC84000, 0xC84FFF, "DOMIS", "DOMIS" },
-	{ 0x0050C2, 0xC85000, 0xC85FFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0xC86000, 0xC86FFF, "Bruckner & Jarosch Ingenieurgesellschaft mbH", "BRUCKNER-JAROSCH-INGENIEURGESELLSCHAFT" },
-	{ 0x0050C2, 0xC87000, 0xC87FFF, "LECO Corporation", "LECO" },
-	{ 0x0050C2, 0xC88000, 0xC88FFF, "CSI Controles e Sistemas Industriais Ltda.", "CSI-CONTROLES-E-SISTEMAS-INDUSTRIAIS-LTDA" },
-	{ 0x0050C2, 0xC89000, 0xC89FFF, "Creative Micro Design", "CREATIVE-MICRO-DESIGN" },
-	{ 0x0050C2, 0xC8A000, 0xC8AFFF, "Automated Media Services, Inc.", "AUTOMATED-MEDIA-SERVICES" },
-	{ 0x0050C2, 0xC8B000, 0xC8BFFF, "OCAS AS", "OCAS-AS" },
-	{ 0x0050C2, 0xC8C000, 0xC8CFFF, "Lanmark Controls Inc.", "LANMARK-CONTROLS" },
-	{ 0x0050C2, 0xC8D000, 0xC8DFFF, "Emergency Message Controls LLC", "EMERGENCY-MESSAGE-CONTROLS" },
-	{ 0x0050C2, 0xC8E000, 0xC8EFFF, "SDD ITG", "SDD-ITG" },
-	{ 0x0050C2, 0xC8F000, 0xC8FFFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xC90000, 0xC90FFF, "RealD, Inc.", "REALD" },
-	{ 0x0050C2, 0xC91000, 0xC91FFF, "Media Technologies Ltd.", "MEDIA-TECHNOLOGIES" },
-	{ 0x0050C2, 0xC92000, 0xC92FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x0050C2, 0xC93000, 0xC93FFF, "SENSAIR Pty Ltd", "SENSAIR-PTY" },
-	{ 0x0050C2, 0xC94000, 0xC94FFF, "ISIS ENGINEERING, S.A.", "ISIS-ENGINEERING" },
-	{ 0x0050C2, 0xC95000, 0xC95FFF, "IPSES S.r.l.", "IPSES" },
-	{ 0x0050C2, 0xC96000, 0xC96FFF, "CyberCraft", "CYBERCRAFT" },
-	{ 0x0050C2, 0xC97000, 0xC97FFF, "MSTRONIC CO., LTD.", "MSTRONIC" },
-	{ 0x0050C2, 0xC98000, 0xC98FFF, "Criticare Systems, Inc", "CRITICARE" },
-	{ 0x0050C2, 0xC99000, 0xC99FFF, "HJPC Corporation dba Pactron", "HJPC-DBA-PACTRON" },
-	{ 0x0050C2, 0xC9A000, 0xC9AFFF, "PACOMP Sp. z o.o.", "PACOMP-SP-Z-O-O" },
-	{ 0x0050C2, 0xC9B000, 0xC9BFFF, "Sm electronic co.", "SM" },
-	{ 0x0050C2, 0xC9C000, 0xC9CFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xC9D000, 0xC9DFFF, "Radius Sweden AB", "RADIUS-SWEDEN-AB" },
-	{ 0x0050C2, 0xC9E000, 0xC9EFFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xC9F000, 0xC9FFFF, "xxter b.v.", "XXTER-B-V" },
-	{ 0x0050C2, 0xCA0000, 0xCA0FFF, "Kiefer technic GmbH", "KIEFER-TECHNIC" },
-	{ 0x0050C2, 0xCA1000, 0xCA1FFF, "Wayne Kerr Electronics", "WAYNE-KERR-ELECTRONICS" },
-	{ 0x0050C2, 0xCA2000, 0xCA2FFF, "The Logical Company", "THE-LOGICAL-COMPANY" },
-	{ 0x0050C2, 0xCA3000, 0xCA3FFF, "CT Company", "CT-COMPANY" },
-	{ 0x0050C2, 0xCA4000, 0xCA4FFF, "Vox Technologies", "VOX-TECHNOLOGIES" },
-	{ 0x0050C2, 0xCA5000, 0xCA5FFF, "YOKOWO CO.,LTD", "YOKOWO" },
-	{ 0x0050C2, 0xCA6000, 0xCA6FFF, "Vidisys GmbH", "VIDISYS" },
-	{ 0x0050C2, 0xCA7000, 0xCA7FFF, "Thermo Fisher Scientific", "THERMO-FISHER-SCIENTIFIC" },
-	{ 0x0050C2, 0xCA8000, 0xCA8FFF, "Systems With Intelligence Inc.", "WITH-INTELLIGENCE" },
-	{ 0x0050C2, 0xCA9000, 0xCA9FFF, "Intelligent Devices", "INTELLIGENT-DEVICES" },
-	{ 0x0050C2, 0xCAA000, 0xCAAFFF, "DSP DESIGN LTD", "DSP-DESIGN" },
-	{ 0x0050C2, 0xCAB000, 0xCABFFF, "SAE IT-systems GmbH & Co. KG", "SAE-IT" },
-	{ 0x0050C2, 0xCAC000, 0xCACFFF, "PURVIS Systems Incorporated", "PURVIS-INCORPORATED" },
-	{ 0x0050C2, 0xCAD000, 0xCADFFF, "Pacific Coast Engineering", "PACIFIC-COAST-ENGINEERING" },
-	{ 0x0050C2, 0xCAE000, 0xCAEFFF, "Campbell Scientific Canada Corp.", "CAMPBELL-SCIENTIFIC-CANADA" },
-	{ 0x0050C2, 0xCAF000, 0xCAFFFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0xCB0000, 0xCB0FFF, "Konsmetal S.A.", "KONSMETAL" },
-	{ 0x0050C2, 0xCB1000, 0xCB1FFF, "ZK Celltest Inc", "ZK-CELLTEST" },
-	{ 0x0050C2, 0xCB2000, 0xCB2FFF, "Moravian Instruments", "MORAVIAN-INSTRUMENTS" },
-	{ 0x0050C2, 0xCB3000, 0xCB3FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x0050C2, 0xCB4000, 0xCB4FFF, "GEA Farm Technologies GmbH", "GEA-FARM-TECHNOLOGIES" },
-	{ 0x0050C2, 0xCB5000, 0xCB5FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0xCB6000, 0xCB6FFF, "Krontek Pty Ltd", "KRONTEK-PTY" },
-	{ 0x0050C2, 0xCB7000, 0xCB7FFF, "inotech GmbH", "INOTECH" },
-	{ 0x0050C2, 0xCB8000, 0xCB8FFF, "Raith GmbH", "RAITH" },
-	{ 0x0050C2, 0xCB9000, 0xCB9FFF, "Micro Technic A/S", "MICRO-TECHNIC-A/S" },
-	{ 0x0050C2, 0xCBA000, 0xCBAFFF, "DELTA TAU DATA SYSTEMS, INC.", "DELTA-TAU-DATA" },
-	{ 0x0050C2, 0xCBB000, 0xCBBFFF, "Coptonix GmbH", "COPTONIX" },
-	{ 0x0050C2, 0xCBC000, 0xCBCFFF, "CP ELETRONICA SA", "CP-ELETRONICA" },
-	{ 0x0050C2, 0xCBD000, 0xCBDFFF, "Hi Tech Electronics Ltd", "HI-TECH-ELECTRONICS" },
-	{ 0x0050C2, 0xCBE000, 0xCBEFFF, "CODE BLUE CORPORATION", "CODE-BLUE" },
-	{ 0x0050C2, 0xCBF000, 0xCBFFFF, "Megacon AB", "MEGACON-AB" },
-	{ 0x0050C2, 0xCC0000, 0xCC0FFF, "World Time Solutions Limited", "WORLD-TIME-SOLUTIONS" },
-	{ 0x0050C2, 0xCC1000, 0xCC1FFF, "Level 3 Communications", "LEVEL-3-COMMUNICATION" },
-	{ 0x0050C2, 0xCC2000, 0xCC2FFF, "ConectaIP Tecnologia S.L.", "CONECTAIP-TECNOLOGIA" },
-	{ 0x0050C2, 0xCC3000, 0xCC3FFF, "viscount systems inc.", "VISCOUNT" },
-	{ 0x0050C2, 0xCC4000, 0xCC4FFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0xCC5000, 0xCC5FFF, "Tecnovum AG", "TECNOVUM" },
-	{ 0x0050C2, 0xCC6000, 0xCC6FFF, "KDT", "KDT" },
-	{ 0x0050C2, 0xCC7000, 0xCC7FFF, "TOPROOTTechnology Corp. Ltd.", "TOPROOTTECHNOLOGY" },
-	{ 0x0050C2, 0xCC8000, 0xCC8FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0xCC9000, 0xCC9FFF, "Promess GmbH", "PROMESS" },
-	{ 0x0050C2, 0xCCA000, 0xCCAFFF, "SANMINA SHENZHEN", "SANMINA-SHENZHEN" },
-	{ 0x0050C2, 0xCCB000, 0xCCBFFF, "CaptiveAire Systems Inc.", "CAPTIVEAIRE" },
-	{ 0x0050C2, 0xCCC000, 0xCCCFFF, "Smartech-technology", "SMARTECH" },
-	{ 0x0050C2, 0xCCD000, 0xCCDFFF, "FUJI DATA SYSTEM Co.,Ltd.", "FUJI-DATA-SYSTEM" },
-	{ 0x0050C2, 0xCCE000, 0xCCEFFF, "Mac-Gray Corporation", "MAC-GRAY" },
-	{ 0x0050C2, 0xCCF000, 0xCCFFFF, "TASK SISTEMAS DE COMPUTACAO LTDA", "TASK-SISTEMAS-DE-COMPUTACAO-LTDA" },
-	{ 0x0050C2, 0xCD0000, 0xCD0FFF, "MME Mueller Mikroelektronik", "MME-MUELLER-MIKROELEKTRONIK" },
-	{ 0x0050C2, 0xCD1000, 0xCD1FFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0xCD2000, 0xCD2FFF, "SIM2 Multimedia S.p.A.", "SIM2-MULTIMEDIA" },
-	{ 0x0050C2, 0xCD3000, 0xCD3FFF, "Covidence A/S", "COVIDENCE-A/S" },
-	{ 0x0050C2, 0xCD4000, 0xCD4FFF, "SCHRAML GmbH", "SCHRAML" },
-	{ 0x0050C2, 0xCD5000, 0xCD5FFF, "Arcos Technologies Ltd.", "ARCOS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xCD6000, 0xCD6FFF, "Arktan Systems", "ARKTAN" },
-	{ 0x0050C2, 0xCD7000, 0xCD7FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xCD8000, 0xCD8FFF, "IT-IS International Ltd.", "IT-IS" },
-	{ 0x0050C2, 0xCD9000, 0xCD9FFF, "NDC Infrared Engineering, Inc.", "NDC-INFRARED-ENGINEERING" },
-	{ 0x0050C2, 0xCDA000, 0xCDAFFF, "taskit GmbH", "TASKIT" },
-	{ 0x0050C2, 0xCDB000, 0xCDBFFF, "RUTTER INC", "RUTTER" },
-	{ 0x0050C2, 0xCDC000, 0xCDCFFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0xCDD000, 0xCDDFFF, "K.C.C. SHOKAI LIMITED", "K-C-C-SHOKAI" },
-	{ 0x0050C2, 0xCDE000, 0xCDEFFF, "Axotec Technologies GmbH", "AXOTEC-TECHNOLOGIES" },
-	{ 0x0050C2, 0xCDF000, 0xCDFFFF, "CoreEL TEchnologies (I) Pvt Ltd", "COREEL-TECHNOLOGIES-I-PVT" },
-	{ 0x0050C2, 0xCE0000, 0xCE0FFF, "Industrial Control Links, Inc.", "INDUSTRIAL-CONTROL-LINKS" },
-	{ 0x0050C2, 0xCE1000, 0xCE1FFF, "Satellink Inc.", "SATELLINK" },
-	{ 0x0050C2, 0xCE2000, 0xCE2FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0xCE3000, 0xCE3FFF, "Industrial Automatics Design Bureau", "INDUSTRIAL-AUTOMATICS-DESIGN-BUREAU" },
-	{ 0x0050C2, 0xCE4000, 0xCE4FFF, "TEKTRONIK", "TEKTRONIK" },
-	{ 0x0050C2, 0xCE5000, 0xCE5FFF, "Maretron, LLP", "MARETRON-LLP" },
-	{ 0x0050C2, 0xCE6000, 0xCE6FFF, "APLICA TECHNOLOGIES", "APLICA-TECHNOLOGIES" },
-	{ 0x0050C2, 0xCE7000, 0xCE7FFF, "Echola Systems", "ECHOLA" },
-	{ 0x0050C2, 0xCE8000, 0xCE8FFF, "Thomas & Betts", "THOMAS-BETTS" },
-	{ 0x0050C2, 0xCE9000, 0xCE9FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0xCEA000, 0xCEAFFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xCEB000, 0xCEBFFF, "Toyon Research Corporation", "TOYON-RESEARCH" },
-	{ 0x0050C2, 0xCEC000, 0xCECFFF, "Erhardt+Leimer GmbH", "ERHARDT+LEIMER" },
-	{ 0x0050C2, 0xCED000, 0xCEDFFF, "AeroMechanical Services Ltd, FLYHT", "AEROMECHANICAL-SERVICES-FLYHT" },
-	{ 0x0050C2, 0xCEE000, 0xCEEFFF, "EMBED-IT OG", "EMBED-IT-OG" },
-	{ 0x0050C2, 0xCEF000, 0xCEFFFF, "Lupatecnologia e Sistemas Ltda", "LUPATECNOLOGIA-E-SISTEMAS-LTDA" },
-	{ 0x0050C2, 0xCF0000, 0xCF0FFF, "Inviso B.V.", "INVISO-B-V" },
-	{ 0x0050C2, 0xCF1000, 0xCF1FFF, "Bascom Hunter", "BASCOM-HUNTER" },
-	{ 0x0050C2, 0xCF2000, 0xCF2FFF, "Weiss Robotics GmbH & Co. KG", "WEISS-ROBOTICS" },
-	{ 0x0050C2, 0xCF3000, 0xCF3FFF, "Daiken Automacao Ltda", "DAIKEN-AUTOMACAO-LTDA" },
-	{ 0x0050C2, 0xCF4000, 0xCF4FFF, "Baudisch Electronic GmbH", "BAUDISCH" },
-	{ 0x0050C2, 0xCF5000, 0xCF5FFF, "Gogo BA", "GOGO-BA" },
-	{ 0x0050C2, 0xCF6000, 0xCF6FFF, "Epec Oy", "EPEC-OY" },
-	{ 0x0050C2, 0xCF7000, 0xCF7FFF, "Armour Home Electronics LTD", "ARMOUR-HOME-ELECTRONICS" },
-	{ 0x0050C2, 0xCF8000, 0xCF8FFF, "beks Kommunikacios Technika kft", "BEKS-KOMMUNIKACIOS-TECHNIKA-KFT" },
-	{ 0x0050C2, 0xCF9000, 0xCF9FFF, "Elbit Systems of America", "ELBIT-OF-AMERICA" },
-	{ 0x0050C2, 0xCFA000, 0xCFAFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0xCFB000, 0xCFBFFF, "New Embedded Technology", "NEW-EMBEDDED" },
-	{ 0x0050C2, 0xCFC000, 0xCFCFFF, "Tritium Pty Ltd", "TRITIUM-PTY" },
-	{ 0x0050C2, 0xCFD000, 0xCFDFFF, "AIRFOLC,INC.", "AIRFOLC" },
-	{ 0x0050C2, 0xCFE000, 0xCFEFFF, "Techleader", "TECHLEADER" },
-	{ 0x0050C2, 0xCFF000, 0xCFFFFF, "Infrasafe, Inc.", "INFRASAFE" },
-	{ 0x0050C2, 0xD00000, 0xD00FFF, "Bodensee Gravitymeter Geosystem GmbH", "BODENSEE-GRAVITYMETER-GEOSYSTEM" },
-	{ 0x0050C2, 0xD01000, 0xD01FFF, "Aanderaa Data Instruments", "AANDERAA-DATA-INSTRUMENTS" },
-	{ 0x0050C2, 0xD02000, 0xD02FFF, "SURVALENT TECHNOLOGY CORP", "SURVALENT" },
-	{ 0x0050C2, 0xD03000, 0xD03FFF, "Peekel Instruments B.V.", "PEEKEL-INSTRUMENTS-B-V" },
-	{ 0x0050C2, 0xD04000, 0xD04FFF, "Tehama Wireless", "TEHAMA-WIRELESS" },
-	{ 0x0050C2, 0xD06000, 0xD06FFF, "nCk Research LLC", "NCK-RESEARCH" },
-	{ 0x0050C2, 0xD07000, 0xD07FFF, "IAF GmbH", "IAF" },
-	{ 0x0050C2, 0xD08000, 0xD08FFF, "Reimesch Kommunikationssysteme GmbH", "REIMESCH-KOMMUNIKATIONSSYSTEME" },
-	{ 0x0050C2, 0xD09000, 0xD09FFF, "Guardtec,Inc", "GUARDTEC" },
-	{ 0x0050C2, 0xD0A000, 0xD0AFFF, "Airpoint Co., Ltd.", "AIRPOINT" },
-	{ 0x0050C2, 0xD0B000, 0xD0BFFF, "CODACO ELECTRONIC s.r.o.", "CODACO-S-R-O" },
-	{ 0x0050C2, 0xD0C000, 0xD0CFFF, "JVL Industri Elektronik", "JVL-INDUSTRI-ELEKTRONIK" },
-	{ 0x0050C2, 0xD0D000, 0xD0DFFF, "DECA Card Engineering GmbH", "DECA-CARD-ENGINEERING" },
-	{ 0x0050C2, 0xD0E000, 0xD0EFFF, "Weinert Engineering GmbH", "WEINERT-ENGINEERING" },
-	{ 0x0050C2, 0xD0F000, 0xD0FFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xD10000, 0xD10FFF, "Rosslare Enterprises Ltd.", "ROSSLARE-ENTERPRISES" },
-	{ 0x0050C2, 0xD11000, 0xD11FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x0050C2, 0xD12000, 0xD12FFF, "Tokyo Weld Co.,Ltd.", "TOKYO-WELD" },
-	{ 0x0050C2, 0xD13000, 0xD13FFF, "GUNMA ELECTRONICS CO LTD", "GUNMA-ELECTRONICS" },
-	{ 0x0050C2, 0xD14000, 0xD14FFF, "SAET I.S.", "SAET-I-S" },
-	{ 0x0050C2, 0xD15000, 0xD15FFF, "MSR-Office GmbH", "MSR-OFFICE" },
-	{ 0x0050C2, 0xD16000, 0xD16FFF, "Imricor Medical Systems, Inc.", "IMRICOR-MEDICAL" },
-	{ 0x0050C2, 0xD17000, 0xD17FFF, "CUE, a.s.", "CUE" },
-	{ 0x0050C2, 0xD18000, 0xD18FFF, "Glyn GmbH & Co.KG", "GLYN" },
-	{ 0x0050C2, 0xD19000, 0xD19FFF, "Applied Medical Technologies, Inc DBA AirClean Systems", "APPLIED-MEDICAL-TECHNOLOGIES-DBA-AIRCLEAN" },
-	{ 0x0050C2, 0xD1A000, 0xD1AFFF, "GILLAM-FEI S.A.", "GILLAM-FEI" },
-	{ 0x0050C2, 0xD1B000, 0xD1BFFF, "TECHKON GmbH", "TECHKON" },
-	{ 0x0050C2, 0xD1C000, 0xD1CFFF, "Recon Dynamics, LLC", "RECON-DYNAMICS" },
-	{ 0x0050C2, 0xD1D000, 0xD1DFFF, "Moco Media Pty Ltd", "MOCO-MEDIA-PTY" },
-	{ 0x0050C2, 0xD1E000, 0xD1EFFF, "Tobila Systems, Inc.", "TOBILA" },
-	{ 0x0050C2, 0xD1F000, 0xD1FFFF, "Olympus NDT Canada", "OLYMPUS-NDT-CANADA" },
-	{ 0x0050C2, 0xD20000, 0xD20FFF, "7+ Kft", "7+-KFT" },
-	{ 0x0050C2, 0xD21000, 0xD21FFF, "Innovative Circuit Technology", "INNOVATIVE-CIRCUIT" },
-	{ 0x0050C2, 0xD22000, 0xD22FFF, "eMDee Technology, Inc.", "EMDEE" },
-	{ 0x0050C2, 0xD23000, 0xD23FFF, "Bluestone Technology GmbH", "BLUESTONE" },
-	{ 0x0050C2, 0xD24000, 0xD24FFF, "Expro North Sea", "EXPRO-NORTH-SEA" },
-	{ 0x0050C2, 0xD25000, 0xD25FFF, "VAF Instruments BV", "VAF-INSTRUMENTS" },
-	{ 0x0050C2, 0xD26000, 0xD26FFF, "RCH GROUP", "RCH-GROUP" },
-	{ 0x0050C2, 0xD27000, 0xD27FFF, "Fr.Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0xD28000, 0xD28FFF, "Digitale Analoge COMponenten West Electronic Vertriebs GmbH", "DIGITALE-ANALOGE-COMPONENTEN-WEST-VERTRIEBS" },
-	{ 0x0050C2, 0xD29000, 0xD29FFF, "Axible Technologies", "AXIBLE-TECHNOLOGIES" },
-	{ 0x0050C2, 0xD2A000, 0xD2AFFF, "Millennium Electronics Pty.Ltd.", "MILLENNIUM-ELECTRONICS-PTY" },
-	{ 0x0050C2, 0xD2B000, 0xD2BFFF, "Video Tech Laboratories, Inc.", "VIDEO-TECH-LABORATORIES" },
-	{ 0x0050C2, 0xD2C000, 0xD2CFFF, "Schneider Electric Motion USA", "SCHNEIDER-ELECTRIC-MOTION-USA" },
-	{ 0x0050C2, 0xD2D000, 0xD2DFFF, "Cadi Scientific Pte Ltd", "CADI-SCIENTIFIC-PTE" },
-	{ 0x0050C2, 0xD2E000, 0xD2EFFF, "RS Gesellschaft fur Informationstechnik mbH & Co KG", "RS-GESELLSCHAFT-FUR-INFORMATIONSTECHNIK" },
-	{ 0x0050C2, 0xD2F000, 0xD2FFFF, "Key Systems, Inc.", "KEY" },
-	{ 0x0050C2, 0xD30000, 0xD30FFF, "ACTIV Financial Systems, Inc.", "ACTIV-FINANCIAL" },
-	{ 0x0050C2, 0xD31000, 0xD31FFF, "UNGAVA Technologies Inc.", "UNGAVA-TECHNOLOGIES" },
-	{ 0x0050C2, 0xD32000, 0xD32FFF, "RealTime Systems Ltd", "REALTIME" },
-	{ 0x0050C2, 0xD33000, 0xD33FFF, "Maddalena S.p.A", "MADDALENA" },
-	{ 0x0050C2, 0xD34000, 0xD34FFF, "GAON TECH corp.", "GAON-TECH" },
-	{ 0x0050C2, 0xD35000, 0xD35FFF, "UG Systems GmbH & Co. KG", "UG" },
-	{ 0x0050C2, 0xD36000, 0xD36FFF, "Enatel Limited", "ENATEL" },
-	{ 0x0050C2, 0xD37000, 0xD37FFF, "LJT & Associates, Inc.", "LJT-ASSOCIATES" },
-	{ 0x0050C2, 0xD38000, 0xD38FFF, "Kyowa Electronics Co.,Ltd.", "KYOWA-ELECTRONICS" },
-	{ 0x0050C2, 0xD39000, 0xD39FFF, "Apex NV", "APEX-NV" },
-	{ 0x0050C2, 0xD3A000, 0xD3AFFF, "WellSense Technologies", "WELLSENSE-TECHNOLOGIES" },
-	{ 0x0050C2, 0xD3B000, 0xD3BFFF, "Gitsn Inc.", "GITSN" },
-	{ 0x0050C2, 0xD3C000, 0xD3CFFF, "ASSYSTEM France", "ASSYSTEM-FRANCE" },
-	{ 0x0050C2, 0xD3D000, 0xD3DFFF, "Tellabs Operations Inc.", "TELLABS-OPERATIONS" },
-	{ 0x0050C2, 0xD3E000, 0xD3EFFF, "Synatec Electronic GmbH", "SYNATEC" },
-	{ 0x0050C2, 0xD3F000, 0xD3FFFF, "Communication Systems Solutions", "COMMUNICATION-SOLUTIONS" },
-	{ 0x0050C2, 0xD40000, 0xD40FFF, "demmel products", "DEMMEL-PRODUCTS" },
-	{ 0x0050C2, 0xD41000, 0xD41FFF, "AREA ENERGY, INC.", "AREA-ENERGY" },
-	{ 0x0050C2, 0xD42000, 0xD42FFF, "Hagenuk KMT GmbH", "HAGENUK-KMT" },
-	{ 0x0050C2, 0xD43000, 0xD43FFF, "DSP4YOU LTd", "DSP4YOU" },
-	{ 0x0050C2, 0xD44000, 0xD44FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xD45000, 0xD45FFF, "Technagon GmbH", "TECHNAGON" },
-	{ 0x0050C2, 0xD46000, 0xD46FFF, "Thales Nederland BV", "THALES-NEDERLAND" },
-	{ 0x0050C2, 0xD47000, 0xD47FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xD48000, 0xD48FFF, "Watermark Estate Management Services, LLC", "WATERMARK-ESTATE-MANAGEMENT-SERVICES" },
-	{ 0x0050C2, 0xD49000, 0xD49FFF, "Smith Meter, Inc", "SMITH-METER" },
-	{ 0x0050C2, 0xD4A000, 0xD4AFFF, "ATH system", "ATH-SYSTEM" },
-	{ 0x0050C2, 0xD4B000, 0xD4BFFF, "Indra Australia", "INDRA-AUSTRALIA" },
-	{ 0x0050C2, 0xD4C000, 0xD4CFFF, "DALOG Diagnosesysteme GmbH", "DALOG-DIAGNOSESYSTEME" },
-	{ 0x0050C2, 0xD4D000, 0xD4DFFF, "Yardney Technical Products Inc.", "YARDNEY-TECHNICAL-PRODUCTS" },
-	{ 0x0050C2, 0xD4E000, 0xD4EFFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xD4F000, 0xD4FFFF, "SECOM GmbH", "SECOM" },
-	{ 0x0050C2, 0xD50000, 0xD50FFF, "Solbrig Electronics, Inc.", "SOLBRIG-ELECTRONICS" },
-	{ 0x0050C2, 0xD51000, 0xD51FFF, "BETTINI SRL", "BETTINI-SRL" },
-	{ 0x0050C2, 0xD52000, 0xD52FFF, "F+D Feinwerk- und Drucktechnik GmbH", "F+D-FEINWERK-UND-DRUCKTECHNIK" },
-	{ 0x0050C2, 0xD53000, 0xD53FFF, "Telemerkki Oy", "TELEMERKKI-OY" },
-	{ 0x0050C2, 0xD54000, 0xD54FFF, "ABtrack s.r.l.", "ABTRACK" },
-	{ 0x0050C2, 0xD55000, 0xD55FFF, "Sterna Security", "STERNA-SECURITY" },
-	{ 0x0050C2, 0xD56000, 0xD56FFF, "SELEX Communications Limited", "SELEX-COMMUNICATION" },
-	{ 0x0050C2, 0xD57000, 0xD57FFF, "Hijikata Denki Corp.", "HIJIKATA-DENKI" },
-	{ 0x0050C2, 0xD58000, 0xD58FFF, "NIK-ELEKTRONIKA Ltd", "NIK-ELEKTRONIKA" },
-	{ 0x0050C2, 0xD59000, 0xD59FFF, "BUANCO SYSTEM A/S", "BUANCO-SYSTEM-A/S" },
-	{ 0x0050C2, 0xD5A000, 0xD5AFFF, "Embedded Monitoring Systems Ltd.", "EMBEDDED-MONITORING" },
-	{ 0x0050C2, 0xD5B000, 0xD5BFFF, "Infinition Inc.", "INFINITION" },
-	{ 0x0050C2, 0xD5C000, 0xD5CFFF, "Ibetor S.L.", "IBETOR" },
-	{ 0x0050C2, 0xD5D000, 0xD5DFFF, "GLOBALCOM ENGINEERING SRL", "GLOBALCOM-ENGINEERING-SRL" },
-	{ 0x0050C2, 0xD5E000, 0xD5EFFF, "PRIVATECH Inc.", "PRIVATECH" },
-	{ 0x0050C2, 0xD5F000, 0xD5FFFF, "Embedded Solution Bank Co., Ltd.", "EMBEDDED-SOLUTION-BANK" },
-	{ 0x0050C2, 0xD60000, 0xD60FFF, "Nihon Kessho Koogaku Co., Ltd.", "NIHON-KESSHO-KOOGAKU" },
-	{ 0x0050C2, 0xD61000, 0xD61FFF, "system2 GmbH", "SYSTEM2" },
-	{ 0x0050C2, 0xD62000, 0xD62FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x0050C2, 0xD63000, 0xD63FFF, "DATAREGIS S.A.", "DATAREGIS" },
-	{ 0x0050C2, 0xD64000, 0xD64FFF, "TV1 GmbH", "TV1" },
-	{ 0x0050C2, 0xD65000, 0xD65FFF, "TX Technology Corp", "TX" },
-	{ 0x0050C2, 0xD66000, 0xD66FFF, "Uvax Concepts", "UVAX-CONCEPTS" },
-	{ 0x0050C2, 0xD67000, 0xD67FFF, "KLING & FREITAG GmbH", "KLING-FREITAG" },
-	{ 0x0050C2, 0xD68000, 0xD68FFF, "HiSpeed Data, Inc.", "HISPEED-DATA" },
-	{ 0x0050C2, 0xD69000, 0xD69FFF, "GHL Systems Bhd", "GHL" },
-	{ 0x0050C2, 0xD6A000, 0xD6AFFF, "A&T Corporation, Electrics Group , LAS R&D Unit,", "A-T-ELECTRICS-GROUP-LAS-R-D-UNIT" },
-	{ 0x0050C2, 0xD6B000, 0xD6BFFF, "Nemec Automation", "NEMEC-AUTOMATION" },
-	{ 0x0050C2, 0xD6C000, 0xD6CFFF, "ALPHA Corporation", "ALPHA" },
-	{ 0x0050C2, 0xD6D000, 0xD6DFFF, "Pro-Digital Industria Eletronica", "PRO-DIGITAL-INDUSTRIA-ELETRONICA" },
-	{ 0x0050C2, 0xD6E000, 0xD6EFFF, "BC Illumination, Inc.", "BC-ILLUMINATION" },
-	{ 0x0050C2, 0xD6F000, 0xD6FFFF, "Imtron Messtechnik GmbH", "IMTRON-MESSTECHNIK" },
-	{ 0x0050C2, 0xD70000, 0xD70FFF, "C. Rob. Hammerstein GmbH & Co. KG", "C-ROB-HAMMERSTEIN" },
-	{ 0x0050C2, 0xD71000, 0xD71FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x0050C2, 0xD72000, 0xD72FFF, "Scale-Tron, Inc.", "SCALE-TRON" },
-	{ 0x0050C2, 0xD73000, 0xD73FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xD74000, 0xD74FFF, "Computech International", "COMPUTECH" },
-	{ 0x0050C2, 0xD75000, 0xD75FFF, "Collectric AB", "COLLECTRIC-AB" },
-	{ 0x0050C2, 0xD76000, 0xD76FFF, "Telvent", "TELVENT" },
-	{ 0x0050C2, 0xD77000, 0xD77FFF, "Fr.SauterAG", "FR-SAUTERAG" },
-	{ 0x0050C2, 0xD78000, 0xD78FFF, "P4Q Electronics", "P4Q-ELECTRONICS" },
-	{ 0x0050C2, 0xD79000, 0xD79FFF, "DSI RF Systems, Inc.", "DSI-RF" },
-	{ 0x0050C2, 0xD7A000, 0xD7AFFF, "Transbit Sp. z o.o.", "TRANSBIT-SP-Z-O-O" },
-	{ 0x0050C2, 0xD7B000, 0xD7BFFF, "OWITA GmbH", "OWITA" },
-	{ 0x0050C2, 0xD7C000, 0xD7CFFF, "Microcubs Systems Pvt Ltd", "MICROCUBS-PVT" },
-	{ 0x0050C2, 0xD7D000, 0xD7DFFF, "Voltech Instruments", "VOLTECH-INSTRUMENTS" },
-	{ 0x0050C2, 0xD7E000, 0xD7EFFF, "LYNX Technik AG", "LYNX-TECHNIK" },
-	{ 0x0050C2, 0xD7F000, 0xD7FFFF, "HMI Technologies", "HMI-TECHNOLOGIES" },
-	{ 0x0050C2, 0xD80000, 0xD80FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xD81000, 0xD81FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0xD82000, 0xD82FFF, "Audio Authority Corp", "AUDIO-AUTHORITY" },
-	{ 0x0050C2, 0xD83000, 0xD83FFF, "Blankom", "BLANKOM" },
-	{ 0x0050C2, 0xD84000, 0xD84FFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0xD85000, 0xD85FFF, "VITEC", "VITEC" },
-	{ 0x0050C2, 0xD86000, 0xD86FFF, "ECOMM ERA", "ECOMM-ERA" },
-	{ 0x0050C2, 0xD87000, 0xD87FFF, "Electrolight Shivuk (1994) Ltd.", "ELECTROLIGHT-SHIVUK-1994" },
-	{ 0x0050C2, 0xD88000, 0xD88FFF, "T+A elektroakustik GmbH & Co.KG", "T+A-ELEKTROAKUSTIK" },
-	{ 0x0050C2, 0xD89000, 0xD89FFF, "Visual Telecommunication Network, Inc", "VISUAL-TELECOMMUNICATION-NETWORK" },
-	{ 0x0050C2, 0xD8A000, 0xD8AFFF, "OptoLink  Industria e Comercio Ltda", "OPTOLINK-INDUSTRIA-E-COMERCIO-LTDA" },
-	{ 0x0050C2, 0xD8B000, 0xD8BFFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0xD8C000, 0xD8CFFF, "iRphotonics", "IRPHOTONICS" },
-	{ 0x0050C2, 0xD8D000, 0xD8DFFF, "CS-Instruments", "CS-INSTRUMENTS" },
-	{ 0x0050C2, 0xD8E000, 0xD8EFFF, "LSD Science&Technology Co.,Ltd.", "LSD-SCIENCE" },
-	{ 0x0050C2, 0xD8F000, 0xD8FFFF, "Syes srl", "SYES-SRL" },
-	{ 0x0050C2, 0xD90000, 0xD90FFF, "Dumps Electronic", "DUMPS" },
-	{ 0x0050C2, 0xD91000, 0xD91FFF, "CHAUVIN ARNOUX", "CHAUVIN-ARNOUX" },
-	{ 0x0050C2, 0xD92000, 0xD92FFF, "Manz", "MANZ" },
-	{ 0x0050C2, 0xD93000, 0xD93FFF, "Axlon AB", "AXLON-AB" },
-	{ 0x0050C2, 0xD94000, 0xD94FFF, "Software Effect Enterprises, Inc", "SOFTWARE-EFFECT-ENTERPRISES" },
-	{ 0x0050C2, 0xD95000, 0xD95FFF, "Honeywell", "HONEYWELL" },
-	{ 0x0050C2, 0xD96000, 0xD96FFF, "CONTEC GmbH", "CONTEC" },
-	{ 0x0050C2, 0xD97000, 0xD97FFF, "ERS electronic GmbH", "ERS" },
-	{ 0x0050C2, 0xD98000, 0xD98FFF, "Rong Shun Xuan Corp.", "RONG-SHUN-XUAN" },
-	{ 0x0050C2, 0xD99000, 0xD99FFF, "T-Industry, s.r.o.", "T-INDUSTRY-S-R-O" },
-	{ 0x0050C2, 0xD9A000, 0xD9AFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xD9B000, 0xD9BFFF, "Intuitive Surgical, Inc", "INTUITIVE-SURGICAL" },
-	{ 0x0050C2, 0xD9C000, 0xD9CFFF, "Gamber Johnson LLC", "GAMBER-JOHNSON" },
-	{ 0x0050C2, 0xD9D000, 0xD9DFFF, "Mistral Solutions Pvt. Ltd", "MISTRAL-SOLUTIONS-PVT" },
-	{ 0x0050C2, 0xD9E000, 0xD9EFFF, "Vocality International Ltd", "VOCALITY" },
-	{ 0x0050C2, 0xD9F000, 0xD9FFFF, "BitWise Controls", "BITWISE-CONTROLS" },
-	{ 0x0050C2, 0xDA0000, 0xDA0FFF, "Precision Remotes", "PRECISION-REMOTES" },
-	{ 0x0050C2, 0xDA1000, 0xDA1FFF, "MangoDSP", "MANGODSP" },
-	{ 0x0050C2, 0xDA2000, 0xDA2FFF, "metraTec GmbH", "METRATEC" },
-	{ 0x0050C2, 0xDA3000, 0xDA3FFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0xDA4000, 0xDA4FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x0050C2, 0xDA5000, 0xDA5FFF, "megatec electronic GmbH", "MEGATEC" },
-	{ 0x0050C2, 0xDA6000, 0xDA6FFF, "Manitowoc Ice", "MANITOWOC-ICE" },
-	{ 0x0050C2, 0xDA7000, 0xDA7FFF, "Capton", "CAPTON" },
-	{ 0x0050C2, 0xDA8000, 0xDA8FFF, "Sine Systems, Inc.", "SINE" },
-	{ 0x0050C2, 0xDA9000, 0xDA9FFF, "Tieline Research Pty Ltd", "TIELINE-RESEARCH-PTY" },
-	{ 0x0050C2, 0xDAA000, 0xDAAFFF, "M & PAUL, INC", "M-PAUL" },
-	{ 0x0050C2, 0xDAB000, 0xDABFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x0050C2, 0xDAC000, 0xDACFFF, "RFL Electronics, Inc.", "RFL-ELECTRONICS" },
-	{ 0x0050C2, 0xDAD000, 0xDADFFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xDAE000, 0xDAEFFF, "Spang Power Electronics", "SPANG-POWER-ELECTRONICS" },
-	{ 0x0050C2, 0xDAF000, 0xDAFFFF, "eumig industrie-TV GmbH.", "EUMIG-INDUSTRIE-TV" },
-	{ 0x0050C2, 0xDB0000, 0xDB0FFF, "IMAGO Technologies GmbH", "IMAGO-TECHNOLOGIES" },
-	{ 0x0050C2, 0xDB1000, 0xDB1FFF, "RF Code", "RF-CODE" },
-	{ 0x0050C2, 0xDB2000, 0xDB2FFF, "SoftwareCannery", "SOFTWARECANNERY" },
-	{ 0x0050C2, 0xDB3000, 0xDB3FFF, "LAUDA DR. R. WOBSER GMBH & CO. KG", "LAUDA-DR-R-WOBSER" },
-	{ 0x0050C2, 0xDB4000, 0xDB4FFF, "ZAO NPC Kompjuternie Technologii", "ZAO-NPC-KOMPJUTERNIE-TECHNOLOGII" },
-	{ 0x0050C2, 0xDB5000, 0xDB5FFF, "DSP DESIGN LTD", "DSP-DESIGN" },
-	{ 0x0050C2, 0xDB6000, 0xDB6FFF, "PROSOFT-SYSTEMS LTD", "PROSOFT" },
-	{ 0x0050C2, 0xDB7000, 0xDB7FFF, "SOREL GmbH", "SOREL" },
-	{ 0x0050C2, 0xDB8000, 0xDB8FFF, "Comsat VertriebsgmbH", "COMSAT-VERTRIEBSGMBH" },
-	{ 0x0050C2, 0xDB9000, 0xDB9FFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0xDBA000, 0xDBAFFF, "Motor Protection Electronics", "MOTOR-PROTECTION-ELECTRONICS" },
-	{ 0x0050C2, 0xDBB000, 0xDBBFFF, "Esensors, Inc.", "ESENSORS" },
-	{ 0x0050C2, 0xDBC000, 0xDBCFFF, "Nantes Systems Private Limited", "NANTES-PRIVATE" },
-	{ 0x0050C2, 0xDBD000, 0xDBDFFF, "Margento R&D", "MARGENTO-R-D" },
-	{ 0x0050C2, 0xDBE000, 0xDBEFFF, "WITHSYSTEM Co.,Ltd", "WITHSYSTEM" },
-	{ 0x0050C2, 0xDBF000, 0xDBFFFF, "One-Nemoto Engineering Corporation", "ONE-NEMOTO-ENGINEERING" },
-	{ 0x0050C2, 0xDC0000, 0xDC0FFF, "Security Services Group (SSG)", "SECURITY-SERVICES-GROUP-SSG" },
-	{ 0x0050C2, 0xDC1000, 0xDC1FFF, "Acrux Technology Limited", "ACRUX" },
-	{ 0x0050C2, 0xDC2000, 0xDC2FFF, "TESSERA TECHNOLOGY INC.", "TESSERA" },
-	{ 0x0050C2, 0xDC3000, 0xDC3FFF, "ZED Ziegler Electronic Devices GmbH", "ZED-ZIEGLER-DEVICES" },
-	{ 0x0050C2, 0xDC4000, 0xDC4FFF, "Keith & Koep GmbH", "KEITH-KOEP" },
-	{ 0x0050C2, 0xDC5000, 0xDC5FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xDC6000, 0xDC6FFF, "Fluid Components Intl", "FLUID-COMPONENTS-INTL" },
-	{ 0x0050C2, 0xDC7000, 0xDC7FFF, "AGT Holdings Limited", "AGT-HOLDINGS" },
-	{ 0x0050C2, 0xDC8000, 0xDC8FFF, "T2M2 GmbH", "T2M2" },
-	{ 0x0050C2, 0xDC9000, 0xDC9FFF, "KinotonGmbH", "KINOTONGMBH" },
-	{ 0x0050C2, 0xDCA000, 0xDCAFFF, "Tele Data Control", "TELE-DATA-CONTROL" },
-	{ 0x0050C2, 0xDCB000, 0xDCBFFF, "CT Company", "CT-COMPANY" },
-	{ 0x0050C2, 0xDCC000, 0xDCCFFF, "Instrumentel Limited", "INSTRUMENTEL" },
-	{ 0x0050C2, 0xDCD000, 0xDCDFFF, "dilitronics GmbH", "DILITRONICS" },
-	{ 0x0050C2, 0xDCE000, 0xDCEFFF, "Mecsel Oy", "MECSEL-OY" },
-	{ 0x0050C2, 0xDCF000, 0xDCFFFF, "MCS Engenharia ltda", "MCS-ENGENHARIA-LTDA" },
-	{ 0x0050C2, 0xDD0000, 0xDD0FFF, "IDC Solutions Pty Ltd", "IDC-SOLUTIONS-PTY" },
-	{ 0x0050C2, 0xDD1000, 0xDD1FFF, "Brankamp GmbH", "BRANKAMP" },
-	{ 0x0050C2, 0xDD2000, 0xDD2FFF, "Electronic Applications, Inc.", "APPLICATIONS" },
-	{ 0x0050C2, 0xDD3000, 0xDD3FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xDD4000, 0xDD4FFF, "SYSTECH", "SYSTECH" },
-	{ 0x0050C2, 0xDD5000, 0xDD5FFF, "Friend Spring Industrial Co., Ltd.", "FRIEND-SPRING-INDUSTRIAL" },
-	{ 0x0050C2, 0xDD6000, 0xDD6FFF, "Wartsila Voyage Oy", "WARTSILA-VOYAGE-OY" },
-	{ 0x0050C2, 0xDD7000, 0xDD7FFF, "Tornado Modular Systems", "TORNADO-MODULAR" },
-	{ 0x0050C2, 0xDD8000, 0xDD8FFF, "Leonardo UK Ltd", "LEONARDO-UK" },
-	{ 0x0050C2, 0xDD9000, 0xDD9FFF, "Metraware", "METRAWARE" },
-	{ 0x0050C2, 0xDDA000, 0xDDAFFF, "rbz robot design s.l.", "RBZ-ROBOT-DESIGN" },
-	{ 0x0050C2, 0xDDB000, 0xDDBFFF, "LUCEO", "LUCEO" },
-	{ 0x0050C2, 0xDDC000, 0xDDCFFF, "Vision  & Control GmbH", "VISION-CONTROL" },
-	{ 0x0050C2, 0xDDD000, 0xDDDFFF, "A&A GENERAL SRL", "A-A-GENERAL-SRL" },
-	{ 0x0050C2, 0xDDE000, 0xDDEFFF, "DRS Imaging and Targeting Solutions", "DRS-IMAGING-AND-TARGETING-SOLUTIONS" },
-	{ 0x0050C2, 0xDDF000, 0xDDFFFF, "Device GmbH", "DEVICE" },
-	{ 0x0050C2, 0xDE0000, 0xDE0FFF, "INTERNET PROTOCOLO LOGICA SL", "INTERNET-PROTOCOLO-LOGICA-SL" },
-	{ 0x0050C2, 0xDE1000, 0xDE1FFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0xDE2000, 0xDE2FFF, "SEQUTEC INC", "SEQUTEC" },
-	{ 0x0050C2, 0xDE3000, 0xDE3FFF, "Breakaway Systems LLC", "BREAKAWAY" },
-	{ 0x0050C2, 0xDE4000, 0xDE4FFF, "EGS Technologies Ltd", "EGS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xDE5000, 0xDE5FFF, "Neets", "NEETS" },
-	{ 0x0050C2, 0xDE6000, 0xDE6FFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0xDE7000, 0xDE7FFF, "Bucher Automation Budapest", "BUCHER-AUTOMATION-BUDAPEST" },
-	{ 0x0050C2, 0xDE8000, 0xDE8FFF, "Visual Productions", "VISUAL-PRODUCTIONS" },
-	{ 0x0050C2, 0xDE9000, 0xDE9FFF, "Dacom West GmbH", "DACOM-WEST" },
-	{ 0x0050C2, 0xDEA000, 0xDEAFFF, "Cerner Corporation", "CERNER" },
-	{ 0x0050C2, 0xDEB000, 0xDEBFFF, "Ruwisch & Kollegen GmbH", "RUWISCH-KOLLEGEN" },
-	{ 0x0050C2, 0xDEC000, 0xDECFFF, "VendNovation LLC", "VENDNOVATION" },
-	{ 0x0050C2, 0xDED000, 0xDEDFFF, "Lee Laser", "LEE-LASER" },
-	{ 0x0050C2, 0xDEF000, 0xDEFFFF, "Powersense A/S", "POWERSENSE-A/S" },
-	{ 0x0050C2, 0xDF0000, 0xDF0FFF, "Koncar Electrical Engineering Institute", "KONCAR-ELECTRICAL-ENGINEERING-INSTITUTE" },
-	{ 0x0050C2, 0xDF1000, 0xDF1FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xDF2000, 0xDF2FFF, "Ocean Sonics", "OCEAN-SONICS" },
-	{ 0x0050C2, 0xDF3000, 0xDF3FFF, "INSEVIS GmbH", "INSEVIS" },
-	{ 0x0050C2, 0xDF4000, 0xDF4FFF, "Potter Electric Signal Co. LLC", "POTTER-ELECTRIC-SIGNAL" },
-	{ 0x0050C2, 0xDF5000, 0xDF5FFF, "EtherLight", "ETHERLIGHT" },
-	{ 0x0050C2, 0xDF6000, 0xDF6FFF, "HINO ENGINEERING, INC", "HINO-ENGINEERING" },
-	{ 0x0050C2, 0xDF7000, 0xDF7FFF, "Combilent", "COMBILENT" },
-	{ 0x0050C2, 0xDF8000, 0xDF8FFF, "Tommotek (WA) Pty Ltd.", "TOMMOTEK-WA-PTY" },
-	{ 0x0050C2, 0xDF9000, 0xDF9FFF, "Jenny Science AG", "JENNY-SCIENCE" },
-	{ 0x0050C2, 0xDFA000, 0xDFAFFF, "MAC Valves, Inc.", "MAC-VALVES" },
-	{ 0x0050C2, 0xDFB000, 0xDFBFFF, "BETTINI SRL", "BETTINI-SRL" },
-	{ 0x0050C2, 0xDFC000, 0xDFCFFF, "I-Evo Ltd", "I-EVO" },
-	{ 0x0050C2, 0xDFD000, 0xDFDFFF, "Wotbox ltd", "WOTBOX" },
-	{ 0x0050C2, 0xDFE000, 0xDFEFFF, "Xitek Design Limited", "XITEK-DESIGN" },
-	{ 0x0050C2, 0xDFF000, 0xDFFFFF, "TANTAL ELECTRONICA, SL", "TANTAL-ELECTRONICA-SL" },
-	{ 0x0050C2, 0xE00000, 0xE00FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x0050C2, 0xE01000, 0xE01FFF, "Tyco Traffic & Transportation", "TYCO-TRAFFIC-TRANSPORTATION" },
-	{ 0x0050C2, 0xE02000, 0xE02FFF, "Cleverscope", "CLEVERSCOPE" },
-	{ 0x0050C2, 0xE03000, 0xE03FFF, "ICU Scandinavia Schweiz GmbH", "ICU-SCANDINAVIA-SCHWEIZ" },
-	{ 0x0050C2, 0xE04000, 0xE04FFF, "Sec.Eng Systems Pty Ltd", "SEC-ENG-PTY" },
-	{ 0x0050C2, 0xE05000, 0xE05FFF, "NOCOSIUM", "NOCOSIUM" },
-	{ 0x0050C2, 0xE06000, 0xE06FFF, "Ebner Electronic GmbH", "EBNER" },
-	{ 0x0050C2, 0xE07000, 0xE07FFF, "Protagon Process Technologies GmbH", "PROTAGON-PROCESS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xE08000, 0xE08FFF, "KST Technology", "KST" },
-	{ 0x0050C2, 0xE09000, 0xE09FFF, "ATEME", "ATEME" },
-	{ 0x0050C2, 0xE0A000, 0xE0AFFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0xE0B000, 0xE0BFFF, "Seartech", "SEARTECH" },
-	{ 0x0050C2, 0xE0C000, 0xE0CFFF, "YOUHO ELECTRIC IND.,LTD.", "YOUHO-ELECTRIC-IND" },
-	{ 0x0050C2, 0xE0D000, 0xE0DFFF, "Unixmedia Srl", "UNIXMEDIA-SRL" },
-	{ 0x0050C2, 0xE0E000, 0xE0EFFF, "PMAC JAPAN", "PMAC-JAPAN" },
-	{ 0x0050C2, 0xE0F000, 0xE0FFFF, "Trentino Systems", "TRENTINO" },
-	{ 0x0050C2, 0xE10000, 0xE10FFF, "Radinetworks Co., Ltd", "RADINETWORKS" },
-	{ 0x0050C2, 0xE11000, 0xE11FFF, "RadioMobile Inc", "RADIOMOBILE" },
-	{ 0x0050C2, 0xE12000, 0xE12FFF, "Kago Electronics BV", "KAGO-ELECTRONICS" },
-	{ 0x0050C2, 0xE13000, 0xE13FFF, "Automation Assist Japan Company", "AUTOMATION-ASSIST-JAPAN-COMPANY" },
-	{ 0x0050C2, 0xE14000, 0xE14FFF, "Calixto Systems Pvt Ltd", "CALIXTO-PVT" },
-	{ 0x0050C2, 0xE15000, 0xE15FFF, "IHI Scube Co.,Ltd", "IHI-SCUBE" },
-	{ 0x0050C2, 0xE16000, 0xE16FFF, "Jetstream Ltd.", "JETSTREAM" },
-	{ 0x0050C2, 0xE17000, 0xE17FFF, "Gall Tankdatensysteme GmbH", "GALL-TANKDATENSYSTEME" },
-	{ 0x0050C2, 0xE18000, 0xE18FFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0xE19000, 0xE19FFF, "Zoe Medical", "ZOE-MEDICAL" },
-	{ 0x0050C2, 0xE1A000, 0xE1AFFF, "Rosslare Enterprises Limited", "ROSSLARE-ENTERPRISES" },
-	{ 0x0050C2, 0xE1B000, 0xE1BFFF, "Embedded Labs", "EMBEDDED-LABS" },
-	{ 0x0050C2, 0xE1C000, 0xE1CFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xE1D000, 0xE1DFFF, "Holdline Tecnologia e Sistemas Ltda", "HOLDLINE-TECNOLOGIA-E-SISTEMAS-LTDA" },
-	{ 0x0050C2, 0xE1E000, 0xE1EFFF, "Lo-Q plc", "LO-Q-PLC" },
-	{ 0x0050C2, 0xE1F000, 0xE1FFFF, "ELVEES", "ELVEES" },
-	{ 0x0050C2, 0xE20000, 0xE20FFF, "Divelbiss Corporation", "DIVELBISS" },
-	{ 0x0050C2, 0xE21000, 0xE21FFF, "Norwia AS", "NORWIA-AS" },
-	{ 0x0050C2, 0xE22000, 0xE22FFF, "Michael Riedel Transformatorenbau GmbH", "MICHAEL-RIEDEL-TRANSFORMATORENBAU" },
-	{ 0x0050C2, 0xE23000, 0xE23FFF, "VITEC", "VITEC" },
-	{ 0x0050C2, 0xE24000, 0xE24FFF, "DiTEST Fahrzeugdiagnose GmbH", "DITEST-FAHRZEUGDIAGNOSE" },
-	{ 0x0050C2, 0xE25000, 0xE25FFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0xE26000, 0xE26FFF, "Cinetix s.r.l.", "CINETIX" },
-	{ 0x0050C2, 0xE27000, 0xE27FFF, "CONTROL SYSTEMS Srl", "CONTROL-SRL" },
-	{ 0x0050C2, 0xE28000, 0xE28FFF, "Teplovodokhran", "TEPLOVODOKHRAN" },
-	{ 0x0050C2, 0xE29000, 0xE29FFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0xE2A000, 0xE2AFFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xE2B000, 0xE2BFFF, "Plant Integrity Limited", "PLANT-INTEGRITY" },
-	{ 0x0050C2, 0xE2C000, 0xE2CFFF, "EN ElectronicNetwork Hamburg GmbH", "EN-ELECTRONICNETWORK-HAMBURG" },
-	{ 0x0050C2, 0xE2D000, 0xE2DFFF, "Funkwerk IT Karlsfeld GmbH", "FUNKWERK-IT-KARLSFELD" },
-	{ 0x0050C2, 0xE2E000, 0xE2EFFF, "DS! Ingenieurbuero", "DS!-INGENIEURBUERO" },
-	{ 0x0050C2, 0xE2F000, 0xE2FFFF, "Beam Ltd", "BEAM" },
-	{ 0x0050C2, 0xE30000, 0xE30FFF, "Goennheimer Elektronic GmbH", "GOENNHEIMER-ELEKTRONIC" },
-	{ 0x0050C2, 0xE31000, 0xE31FFF, "ENSIS Co., Ltd.", "ENSIS" },
-	{ 0x0050C2, 0xE32000, 0xE32FFF, "Oshoksh Corporation", "OSHOKSH" },
-	{ 0x0050C2, 0xE33000, 0xE33FFF, "Morita Technical Center Company", "MORITA-TECHNICAL-CENTER-COMPANY" },
-	{ 0x0050C2, 0xE34000, 0xE34FFF, "HGL Dynamics", "HGL-DYNAMICS" },
-	{ 0x0050C2, 0xE35000, 0xE35FFF, "Omnica Corporation", "OMNICA" },
-	{ 0x0050C2, 0xE36000, 0xE36FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xE37000, 0xE37FFF, "FUJI DATA SYSTEM Co., Ltd", "FUJI-DATA-SYSTEM" },
-	{ 0x0050C2, 0xE38000, 0xE38FFF, "Aesir Copenhagen", "AESIR-COPENHAGEN" },
-	{ 0x0050C2, 0xE39000, 0xE39FFF, "Telemetrics Inc.", "TELEMETRICS" },
-	{ 0x0050C2, 0xE3A000, 0xE3AFFF, "Vocality International Ltd", "VOCALITY" },
-	{ 0x0050C2, 0xE3B000, 0xE3BFFF, "Nanosolution Inc.", "NANOSOLUTION" },
-	{ 0x0050C2, 0xE3C000, 0xE3CFFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0xE3D000, 0xE3DFFF, "Baudisch Electronic GmbH", "BAUDISCH" },
-	{ 0x0050C2, 0xE3E000, 0xE3EFFF, "Monnit Corp.", "MONNIT" },
-	{ 0x0050C2, 0xE3F000, 0xE3FFFF, "VISITO S.R.L.", "VISITO" },
-	{ 0x0050C2, 0xE40000, 0xE40FFF, "Ecrin Systems", "ECRIN" },
-	{ 0x0050C2, 0xE41000, 0xE41FFF, "Higeco S.r.l.", "HIGECO" },
-	{ 0x0050C2, 0xE42000, 0xE42FFF, "Wings for Media SL", "WINGS-FOR-MEDIA-SL" },
-	{ 0x0050C2, 0xE43000, 0xE43FFF, "Technica Engineering GmbH", "TECHNICA-ENGINEERING" },
-	{ 0x0050C2, 0xE44000, 0xE44FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x0050C2, 0xE45000, 0xE45FFF, "Stichting Sunrise", "STICHTING-SUNRISE" },
-	{ 0x0050C2, 0xE46000, 0xE46FFF, "Industrea Mining Technology", "INDUSTREA-MINING" },
-	{ 0x0050C2, 0xE47000, 0xE47FFF, "ENIKA.CZ", "ENIKA-CZ" },
-	{ 0x0050C2, 0xE48000, 0xE48FFF, "ITW Reyflex North America", "ITW-REYFLEX-NORTH-AMERICA" },
-	{ 0x0050C2, 0xE49000, 0xE49FFF, "CTF TECHNOLOGIES DO BRASIL LTDA", "CTF-TECHNOLOGIES-DO-BRASIL-LTDA" },
-	{ 0x0050C2, 0xE4A000, 0xE4AFFF, "GHL Systems Bhd", "GHL" },
-	{ 0x0050C2, 0xE4B000, 0xE4BFFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xE4C000, 0xE4CFFF, "Applied Micro Electronics AME bv", "APPLIED-MICRO-ELECTRONICS-AME" },
-	{ 0x0050C2, 0xE4D000, 0xE4DFFF, "PCSC", "PCSC" },
-	{ 0x0050C2, 0xE4E000, 0xE4EFFF, "Institute For Information Industry", "INSTITUTE-FOR-INFORMATION-INDUSTRY" },
-	{ 0x0050C2, 0xE4F000, 0xE4FFFF, "Wine Technology Marlborough", "WINE-MARLBOROUGH" },
-	{ 0x0050C2, 0xE50000, 0xE50FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0xE51000, 0xE51FFF, "Motec Pty Ltd", "MOTEC-PTY" },
-	{ 0x0050C2, 0xE52000, 0xE52FFF, "Famas System S.p.A.", "FAMAS-SYSTEM" },
-	{ 0x0050C2, 0xE53000, 0xE53FFF, "NEXT video systems Hard- and Software Development GmbH", "NEXT-VIDEO-HARD-AND-SOFTWARE-DEVELOPMENT" },
-	{ 0x0050C2, 0xE54000, 0xE54FFF, "Arcos Technologies LTD", "ARCOS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xE55000, 0xE55FFF, "TTi Ltd", "TTI" },
-	{ 0x0050C2, 0xE56000, 0xE56FFF, "RFENGINE CO., LTD.", "RFENGINE" },
-	{ 0x0050C2, 0xE57000, 0xE57FFF, "EOLANE MONTCEAU", "EOLANE-MONTCEAU" },
-	{ 0x0050C2, 0xE58000, 0xE58FFF, "Agri-hitech LLC", "AGRI-HITECH" },
-	{ 0x0050C2, 0xE59000, 0xE59FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xE5A000, 0xE5AFFF, "FUTEC INC.", "FUTEC" },
-	{ 0x0050C2, 0xE5B000, 0xE5BFFF, "CAIPO Automazione Industriale s.r.l.", "CAIPO-AUTOMAZIONE-INDUSTRIALE" },
-	{ 0x0050C2, 0xE5C000, 0xE5CFFF, "MCOPIA Co., Ltd", "MCOPIA" },
-	{ 0x0050C2, 0xE5D000, 0xE5DFFF, "T8 Ltd", "T8" },
-	{ 0x0050C2, 0xE5E000, 0xE5EFFF, "OREP", "OREP" },
-	{ 0x0050C2, 0xE5F000, 0xE5FFFF, "Pantec Engineering AG", "PANTEC-ENGINEERING" },
-	{ 0x0050C2, 0xE60000, 0xE60FFF, "HORIZON.INC", "HORIZON" },
-	{ 0x0050C2, 0xE61000, 0xE61FFF, "Detech Electronics ApS", "DETECH-ELECTRONICS-APS" },
-	{ 0x0050C2, 0xE62000, 0xE62FFF, "SAE IT-systems GmbH & Co. KG", "SAE-IT" },
-	{ 0x0050C2, 0xE63000, 0xE63FFF, "Prima sistemi", "PRIMA-SISTEMI" },
-	{ 0x0050C2, 0xE64000, 0xE64FFF, "Edgeware AB", "EDGEWARE-AB" },
-	{ 0x0050C2, 0xE65000, 0xE65FFF, "IB Elektronik GmbH", "IB-ELEKTRONIK" },
-	{ 0x0050C2, 0xE66000, 0xE66FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x0050C2, 0xE67000, 0xE67FFF, "Critical Link LLC", "CRITICAL-LINK" },
-	{ 0x0050C2, 0xE68000, 0xE68FFF, "Kyoritsu Electric Corporation", "KYORITSU-ELECTRIC" },
-	{ 0x0050C2, 0xE69000, 0xE69FFF, "Netmaker", "NETMAKER" },
-	{ 0x0050C2, 0xE6A000, 0xE6AFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x0050C2, 0xE6B000, 0xE6BFFF, "Sika Technology AG", "SIKA" },
-	{ 0x0050C2, 0xE6C000, 0xE6CFFF, "SAMSUNG Electronics Co.,Ltd.(LED Division)", "SAMSUNG-ELECTRONICS-LED-DIVISION" },
-	{ 0x0050C2, 0xE6D000, 0xE6DFFF, "Allerta Inc", "ALLERTA" },
-	{ 0x0050C2, 0xE6E000, 0xE6EFFF, "Power-One Italia S.p.A", "POWER-ONE-ITALIA" },
-	{ 0x0050C2, 0xE6F000, 0xE6FFFF, "Leyden Engineering", "LEYDEN-ENGINEERING" },
-	{ 0x0050C2, 0xE70000, 0xE70FFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x0050C2, 0xE71000, 0xE71FFF, "traffic network solutions s.l", "TRAFFIC-NETWORK-SOLUTIONS" },
-	{ 0x0050C2, 0xE73000, 0xE73FFF, "ACS Motion Control Ltd.", "ACS-MOTION-CONTROL" },
-	{ 0x0050C2, 0xE74000, 0xE74FFF, "Will corp.", "WILL" },
-	{ 0x0050C2, 0xE75000, 0xE75FFF, "FSM AG", "FSM" },
-	{ 0x0050C2, 0xE76000, 0xE76FFF, "Embedded Solution Bank Co., Ltd.", "EMBEDDED-SOLUTION-BANK" },
-	{ 0x0050C2, 0xE77000, 0xE77FFF, "Fr. Sauter AG", "FR-SAUTER" },
-	{ 0x0050C2, 0xE78000, 0xE78FFF, "TASK SISTEMAS DE COMPUTACAO LTDA", "TASK-SISTEMAS-DE-COMPUTACAO-LTDA" },
-	{ 0x0050C2, 0xE79000, 0xE79FFF, "MCS MICRONIC Computer Systeme GmbH", "MCS-MICRONIC-SYSTEME" },
-	{ 0x0050C2, 0xE7A000, 0xE7AFFF, "Lightel", "LIGHTEL" },
-	{ 0x0050C2, 0xE7B000, 0xE7BFFF, "ATOM GIKEN Co.,Ltd.", "ATOM-GIKEN" },
-	{ 0x0050C2, 0xE7C000, 0xE7CFFF, "sp controls, inc", "SP-CONTROLS" },
-	{ 0x0050C2, 0xE7D000, 0xE7DFFF, "AEL Microsystems Limited", "AEL-MICROSYSTEMS" },
-	{ 0x0050C2, 0xE7E000, 0xE7EFFF, "Swareflex GmbH", "SWAREFLEX" },
-	{ 0x0050C2, 0xE7F000, 0xE7FFFF, "LS Control A/S", "LS-CONTROL-A/S" },
-	{ 0x0050C2, 0xE80000, 0xE80FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xE81000, 0xE81FFF, "Adaptive Technologies, Inc.", "ADAPTIVE-TECHNOLOGIES" },
-	{ 0x0050C2, 0xE82000, 0xE82FFF, "Xplore Technologies Corp", "XPLORE-TECHNOLOGIES" },
-	{ 0x0050C2, 0xE83000, 0xE83FFF, "Witree Co.,Ltd", "WITREE" },
-	{ 0x0050C2, 0xE84000, 0xE84FFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0xE85000, 0xE85FFF, "Cosmo Life Co.,Ltd", "COSMO-LIFE" },
-	{ 0x0050C2, 0xE86000, 0xE86FFF, "Multisuns Corporation", "MULTISUNS" },
-	{ 0x0050C2, 0xE87000, 0xE87FFF, "Lamson Safes & Security", "LAMSON-SAFES-SECURITY" },
-	{ 0x0050C2, 0xE88000, 0xE88FFF, "Pivitec, LLC", "PIVITEC" },
-	{ 0x0050C2, 0xE89000, 0xE89FFF, "PROTEQSEN", "PROTEQSEN" },
-	{ 0x0050C2, 0xE8A000, 0xE8AFFF, "Macronet s.r.l.", "MACRONET" },
-	{ 0x0050C2, 0xE8B000, 0xE8BFFF, "RPA Electronic Solutions, Inc.", "RPA-SOLUTIONS" },
-	{ 0x0050C2, 0xE8C000, 0xE8CFFF, "Epec Oy", "EPEC-OY" },
-	{ 0x0050C2, 0xE8D000, 0xE8DFFF, "SystemAdvanced Co,Ltd", "SYSTEMADVANCED" },
-	{ 0x0050C2, 0xE8E000, 0xE8EFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0xE8F000, 0xE8FFFF, "STT Condigi A/S", "STT-CONDIGI-A/S" },
-	{ 0x0050C2, 0xE90000, 0xE90FFF, "GS Elektromedizinische Geraete G. Stemple GmbH", "GS-ELEKTROMEDIZINISCHE-GERAETE-G-STEMPLE" },
-	{ 0x0050C2, 0xE91000, 0xE91FFF, "DSP DESIGN LTD", "DSP-DESIGN" },
-	{ 0x0050C2, 0xE92000, 0xE92FFF, "CT Company", "CT-COMPANY" },
-	{ 0x0050C2, 0xE93000, 0xE93FFF, "Perceptive Pixel Inc.", "PERCEPTIVE-PIXEL" },
-	{ 0x0050C2, 0xE94000, 0xE94FFF, "ANA-U GmbH", "ANA-U" },
-	{ 0x0050C2, 0xE95000, 0xE95FFF, "Dlite Comercio, Importadora e Serviços de Automação Ltda", "DLITE-COMERCIO-IMPORTADORA-E-SERVIOS-DE-AUTOMAO-LTDA" },
-	{ 0x0050C2, 0xE96000, 0xE96FFF, "PROYECSON S.A.", "PROYECSON" },
-	{ 0x0050C2, 0xE97000, 0xE97FFF, "Arista Systems Corporation", "ARISTA" },
-	{ 0x0050C2, 0xE98000, 0xE98FFF, "i3 International Inc.", "I3" },
-	{ 0x0050C2, 0xE99000, 0xE99FFF, "UV Networks, Inc.", "UV-NETWORKS" },
-	{ 0x0050C2, 0xE9A000, 0xE9AFFF, "Solace Systems", "SOLACE" },
-	{ 0x0050C2, 0xE9B000, 0xE9BFFF, "Hentschel System GmbH", "HENTSCHEL-SYSTEM" },
-	{ 0x0050C2, 0xE9C000, 0xE9CFFF, "SPARQ systems", "SPARQ" },
-	{ 0x0050C2, 0xE9D000, 0xE9DFFF, "nicai-systems", "NICAI" },
-	{ 0x0050C2, 0xE9E000, 0xE9EFFF, "American Microsystems, Ltd.", "AMERICAN-MICROSYSTEMS" },
-	{ 0x0050C2, 0xE9F000, 0xE9FFFF, "DataSoft Corporation", "DATASOFT" },
-	{ 0x0050C2, 0xEA0000, 0xEA0FFF, "Robert Bosch Healthcare Systems, Inc.", "ROBERT-BOSCH-HEALTHCARE" },
-	{ 0x0050C2, 0xEA1000, 0xEA1FFF, "TEX COMPUTER SRL", "TEX-SRL" },
-	{ 0x0050C2, 0xEA2000, 0xEA2FFF, "ThinkRF Corp", "THINKRF" },
-	{ 0x0050C2, 0xEA3000, 0xEA3FFF, "Subsea Systems, Inc.", "SUBSEA" },
-	{ 0x0050C2, 0xEA4000, 0xEA4FFF, "head", "HEAD" },
-	{ 0x0050C2, 0xEA5000, 0xEA5FFF, "Aerodata AG", "AERODATA" },
-	{ 0x0050C2, 0xEA6000, 0xEA6FFF, "Powersense A/S", "POWERSENSE-A/S" },
-	{ 0x0050C2, 0xEA7000, 0xEA7FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xEA8000, 0xEA8FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x0050C2, 0xEA9000, 0xEA9FFF, "Mettler Toledo", "METTLER-TOLEDO" },
-	{ 0x0050C2, 0xEAA000, 0xEAAFFF, "BAE Systems", "BAE" },
-	{ 0x0050C2, 0xEAB000, 0xEABFFF, "Warp9 Tech Design, Inc.", "WARP9-TECH-DESIGN" },
-	{ 0x0050C2, 0xEAC000, 0xEACFFF, "Alias ip", "ALIAS-IP" },
-	{ 0x0050C2, 0xEAD000, 0xEADFFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xEAE000, 0xEAEFFF, "Alyrica Networks", "ALYRICA-NETWORKS" },
-	{ 0x0050C2, 0xEAF000, 0xEAFFFF, "Gogo BA", "GOGO-BA" },
-	{ 0x0050C2, 0xEB0000, 0xEB0FFF, "Pulse Communication Systems Pvt. Ltd.", "PULSE-COMMUNICATION-PVT" },
-	{ 0x0050C2, 0xEB1000, 0xEB1FFF, "PDU EXPERT UK LTD", "PDU-EXPERT-UK" },
-	{ 0x0050C2, 0xEB2000, 0xEB2FFF, "Otaki Electric Corporation", "OTAKI-ELECTRIC" },
-	{ 0x0050C2, 0xEB3000, 0xEB3FFF, "AR RF/Microwave Instrumentation", "AR-RF/MICROWAVE-INSTRUMENTATION" },
-	{ 0x0050C2, 0xEB4000, 0xEB4FFF, "Wishtek Technology, Inc.", "WISHTEK" },
-	{ 0x0050C2, 0xEB5000, 0xEB5FFF, "Covidence A/S", "COVIDENCE-A/S" },
-	{ 0x0050C2, 0xEB6000, 0xEB6FFF, "Monsoon Solutions, Inc.", "MONSOON-SOLUTIONS" },
-	{ 0x0050C2, 0xEB7000, 0xEB7FFF, "Saab AB", "SAAB-AB" },
-	{ 0x0050C2, 0xEB8000, 0xEB8FFF, "dspnor", "DSPNOR" },
-	{ 0x0050C2, 0xEB9000, 0xEB9FFF, "ALPHA-MOS", "ALPHA-MOS" },
-	{ 0x0050C2, 0xEBA000, 0xEBAFFF, "West-Com Nurse Call Systems, Inc.", "WEST-COM-NURSE-CALL" },
-	{ 0x0050C2, 0xEBB000, 0xEBBFFF, "TimeTerminal Adductor Group AB", "TIMETERMINAL-ADDUCTOR-GROUP-AB" },
-	{ 0x0050C2, 0xEBC000, 0xEBCFFF, "Diehl AKO Stiftung & Co. KG", "DIEHL-AKO-STIFTUNG" },
-	{ 0x0050C2, 0xEBD000, 0xEBDFFF, "Droplet Measurement Technologies", "DROPLET-MEASUREMENT-TECHNOLOGIES" },
-	{ 0x0050C2, 0xEBE000, 0xEBEFFF, "Global Tecnologia LTDA.", "GLOBAL-TECNOLOGIA-LTDA" },
-	{ 0x0050C2, 0xEBF000, 0xEBFFFF, "CIVOLUTION", "CIVOLUTION" },
-	{ 0x0050C2, 0xEC0000, 0xEC0FFF, "UgMO Technologies", "UGMO-TECHNOLOGIES" },
-	{ 0x0050C2, 0xEC1000, 0xEC1FFF, "ANT Group s.r.l", "ANT-GROUP" },
-	{ 0x0050C2, 0xEC2000, 0xEC2FFF, "Ixonos Plc", "IXONOS-PLC" },
-	{ 0x0050C2, 0xEC3000, 0xEC3FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x0050C2, 0xEC4000, 0xEC4FFF, "Logical Electromechanical Sys Inc.", "LOGICAL-ELECTROMECHANICAL-SYS" },
-	{ 0x0050C2, 0xEC5000, 0xEC5FFF, "RSUPPORT Co., Ltd.", "RSUPPORT" },
-	{ 0x0050C2, 0xEC6000, 0xEC6FFF, "INFRONICS SYSTEMS LIMITED", "INFRONICS" },
-	{ 0x0050C2, 0xEC7000, 0xEC7FFF, "LIQUID ROBOTICS, INC", "LIQUID-ROBOTICS" },
-	{ 0x0050C2, 0xEC8000, 0xEC8FFF, "IBERNEX INGENIERIA, S.L.", "IBERNEX-INGENIERIA" },
-	{ 0x0050C2, 0xEC9000, 0xEC9FFF, "Amsterdam Scientific Instruments BV", "AMSTERDAM-SCIENTIFIC-INSTRUMENTS" },
-	{ 0x0050C2, 0xECA000, 0xECAFFF, "BitWise Controls", "BITWISE-CONTROLS" },
-	{ 0x0050C2, 0xECB000, 0xECBFFF, "FAL Corp", "FAL" },
-	{ 0x0050C2, 0xECC000, 0xECCFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xECD000, 0xECDFFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0xECE000, 0xECEFFF, "easii ic adiis", "EASII-IC-ADIIS" },
-	{ 0x0050C2, 0xECF000, 0xECFFFF, "TAIWAN HIPLUS CORPORATION", "TAIWAN-HIPLUS" },
-	{ 0x0050C2, 0xED0000, 0xED0FFF, "Nippon Systemware Co.,Ltd.", "NIPPON-SYSTEMWARE" },
-	{ 0x0050C2, 0xED1000, 0xED1FFF, "Arcontia Technology AB", "ARCONTIA-AB" },
-	{ 0x0050C2, 0xED2000, 0xED2FFF, "Klangspektrum GmbH", "KLANGSPEKTRUM" },
-	{ 0x0050C2, 0xED3000, 0xED3FFF, "ECO MONITORING UTILITY SYSTEMS LTD", "ECO-MONITORING-UTILITY" },
-	{ 0x0050C2, 0xED4000, 0xED4FFF, "TAMAGAWA ELECTRONICS CO.,LTD.", "TAMAGAWA-ELECTRONICS" },
-	{ 0x0050C2, 0xED5000, 0xED5FFF, "RFL Electronics, Inc.", "RFL-ELECTRONICS" },
-	{ 0x0050C2, 0xED6000, 0xED6FFF, "Cat AB", "CAT-AB" },
-	{ 0x0050C2, 0xED7000, 0xED7FFF, "FBT Elettronica spa", "FBT-ELETTRONICA-SPA" },
-	{ 0x0050C2, 0xED8000, 0xED8FFF, "AVocation Systems, Inc.", "AVOCATION" },
-	{ 0x0050C2, 0xED9000, 0xED9FFF, "Plasmatronics pty ltd", "PLASMATRONICS-PTY" },
-	{ 0x0050C2, 0xEDA000, 0xEDAFFF, "Joint Stock Company Svyaz Inginiring M", "JOINT-STOCK-COMPANY-SVYAZ-INGINIRING-M" },
-	{ 0x0050C2, 0xEDB000, 0xEDBFFF, "BELIK S.P.R.L.", "BELIK-S-P-R-L" },
-	{ 0x0050C2, 0xEDC000, 0xEDCFFF, "Eyelock Corporation", "EYELOCK" },
-	{ 0x0050C2, 0xEDD000, 0xEDDFFF, "EBNEURO SPA", "EBNEURO-SPA" },
-	{ 0x0050C2, 0xEDE000, 0xEDEFFF, "Smart Grid Networks", "SMART-GRID-NETWORKS" },
-	{ 0x0050C2, 0xEDF000, 0xEDFFFF, "Monitor Business Machines", "MONITOR-BUSINESS-MACHINES" },
-	{ 0x0050C2, 0xEE0000, 0xEE0FFF, "osf Hansjuergen Meier GmbH & Co. KG", "OSF-HANSJUERGEN-MEIER" },
-	{ 0x0050C2, 0xEE1000, 0xEE1FFF, "Procon Electronics", "PROCON-ELECTRONICS" },
-	{ 0x0050C2, 0xEE2000, 0xEE2FFF, "System Industrie Electronic GmbH", "SYSTEM-INDUSTRIE" },
-	{ 0x0050C2, 0xEE3000, 0xEE3FFF, "Tecnint HTE SRL", "TECNINT-HTE-SRL" },
-	{ 0x0050C2, 0xEE4000, 0xEE4FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xEE5000, 0xEE5FFF, "Cytec Zylindertechnik GmbH", "CYTEC-ZYLINDERTECHNIK" },
-	{ 0x0050C2, 0xEE6000, 0xEE6FFF, "B:TECH, a. s.", "B:TECH" },
-	{ 0x0050C2, 0xEE7000, 0xEE7FFF, "syes srl", "SYES-SRL" },
-	{ 0x0050C2, 0xEE8000, 0xEE8FFF, "Kamacho Scale Co., Ltd.", "KAMACHO-SCALE" },
-	{ 0x0050C2, 0xEE9000, 0xEE9FFF, "QUANTA S.r.l.", "QUANTA" },
-	{ 0x0050C2, 0xEEA000, 0xEEAFFF, "Positioneering Limited", "POSITIONEERING" },
-	{ 0x0050C2, 0xEEB000, 0xEEBFFF, "fibrisTerre GmbH", "FIBRISTERRE" },
-	{ 0x0050C2, 0xEEC000, 0xEECFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x0050C2, 0xEED000, 0xEEDFFF, "Future Design Controls, Inc", "FUTURE-DESIGN-CONTROLS" },
-	{ 0x0050C2, 0xEEE000, 0xEEEFFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0xEEF000, 0xEEFFFF, "IDTRONIC GmbH", "IDTRONIC" },
-	{ 0x0050C2, 0xEF0000, 0xEF0FFF, "Homaetrix Ltd", "HOMAETRIX" },
-	{ 0x0050C2, 0xEF1000, 0xEF1FFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xEF2000, 0xEF2FFF, "Specialty Microwave Corp", "SPECIALTY-MICROWAVE" },
-	{ 0x0050C2, 0xEF3000, 0xEF3FFF, "Smart Power Electronics GmbH & Co. KG", "SMART-POWER-ELECTRONICS" },
-	{ 0x0050C2, 0xEF4000, 0xEF4FFF, "RO.VE.R. Laboratories S.p.A", "RO-VE-R-LABORATORIES" },
-	{ 0x0050C2, 0xEF5000, 0xEF5FFF, "Human Network Labs, Inc.", "HUMAN-NETWORK-LABS" },
-	{ 0x0050C2, 0xEF6000, 0xEF6FFF, "Netline Communication Technologies", "NETLINE-COMMUNICATION-TECHNOLOGIES" },
-	{ 0x0050C2, 0xEF7000, 0xEF7FFF, "Amstelland Electronic BV", "AMSTELLAND" },
-	{ 0x0050C2, 0xEF8000, 0xEF8FFF, "HCL Technologies", "HCL-TECHNOLOGIES" },
-	{ 0x0050C2, 0xEF9000, 0xEF9FFF, "HORIBA ABX SAS", "HORIBA-ABX-SAS" },
-	{ 0x0050C2, 0xEFA000, 0xEFAFFF, "Predictive Sensor Technology", "PREDICTIVE-SENSOR" },
-	{ 0x0050C2, 0xEFB000, 0xEFBFFF, "Norbit ODM AS", "NORBIT-ODM-AS" },
-	{ 0x0050C2, 0xEFC000, 0xEFCFFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0xEFD000, 0xEFDFFF, "Sanmina", "SANMINA" },
-	{ 0x0050C2, 0xEFE000, 0xEFEFFF, "PLR Information Systems Ltd.", "PLR-INFORMATION" },
-	{ 0x0050C2, 0xEFF000, 0xEFFFFF, "Zephyrus Electronics LTD.", "ZEPHYRUS-ELECTRONICS" },
-	{ 0x0050C2, 0xF00000, 0xF00FFF, "Syscom Instruments", "SYSCOM-INSTRUMENTS" },
-	{ 0x0050C2, 0xF01000, 0xF01FFF, "Mango DSP, Inc", "MANGO-DSP" },
-	{ 0x0050C2, 0xF02000, 0xF02FFF, "BMR", "BMR" },
-	{ 0x0050C2, 0xF03000, 0xF03FFF, "Wren Sound Systems", "WREN-SOUND" },
-	{ 0x0050C2, 0xF04000, 0xF04FFF, "KINKI ROENTGEN INDUSTRIAL CO.,LTD", "KINKI-ROENTGEN-INDUSTRIAL" },
-	{ 0x0050C2, 0xF05000, 0xF05FFF, "ESI Ventures, LLC", "ESI-VENTURES" },
-	{ 0x0050C2, 0xF06000, 0xF06FFF, "Micro-Key BV", "MICRO-KEY" },
-	{ 0x0050C2, 0xF07000, 0xF07FFF, "Icon Research Ltd", "ICON-RESEARCH" },
-	{ 0x0050C2, 0xF08000, 0xF08FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x0050C2, 0xF09000, 0xF09FFF, "Wheatstone Corporation", "WHEATSTONE" },
-	{ 0x0050C2, 0xF0A000, 0xF0AFFF, "HASCOM International Pty Ltd", "HASCOM-PTY" },
-	{ 0x0050C2, 0xF0B000, 0xF0BFFF, "Treehaven Technologies, Inc.", "TREEHAVEN-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF0C000, 0xF0CFFF, "SKYCHANNEL LTD", "SKYCHANNEL" },
-	{ 0x0050C2, 0xF0D000, 0xF0DFFF, "Bluetest AB", "BLUETEST-AB" },
-	{ 0x0050C2, 0xF0E000, 0xF0EFFF, "Micro Technic A/S", "MICRO-TECHNIC-A/S" },
-	{ 0x0050C2, 0xF0F000, 0xF0FFFF, "AeroVision Avionics, Inc.", "AEROVISION-AVIONICS" },
-	{ 0x0050C2, 0xF10000, 0xF10FFF, "Wincor Nixdorf Sp. z o.o.", "WINCOR-NIXDORF-SP-Z-O-O" },
-	{ 0x0050C2, 0xF11000, 0xF11FFF, "Organis GmbH", "ORGANIS" },
-	{ 0x0050C2, 0xF12000, 0xF12FFF, "General Industrial Controls Pvt Ltd", "GENERAL-INDUSTRIAL-CONTROLS-PVT" },
-	{ 0x0050C2, 0xF13000, 0xF13FFF, "Packet Plus, Inc.", "PACKET-PLUS" },
-	{ 0x0050C2, 0xF14000, 0xF14FFF, "VISION SYSTEMS AERONAUTIC", "VISION-AERONAUTIC" },
-	{ 0x0050C2, 0xF15000, 0xF15FFF, "Sascal Displays Ltd", "SASCAL-DISPLAYS" },
-	{ 0x0050C2, 0xF16000, 0xF16FFF, "Peter Huber Kaeltemaschinenbau SE", "PETER-HUBER-KAELTEMASCHINENBAU-SE" },
-	{ 0x0050C2, 0xF17000, 0xF17FFF, "ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.", "ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN" },
-	{ 0x0050C2, 0xF18000, 0xF18FFF, "Vitec Multimedia", "VITEC-MULTIMEDIA" },
-	{ 0x0050C2, 0xF19000, 0xF19FFF, "Netlink Bilisim Sistemleri San. ve Tic. Ltd. Sti.", "NETLINK-BILISIM-SISTEMLERI-SAN-VE-TIC-STI" },
-	{ 0x0050C2, 0xF1A000, 0xF1AFFF, "Aqua Management", "AQUA-MANAGEMENT" },
-	{ 0x0050C2, 0xF1B000, 0xF1BFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xF1C000, 0xF1CFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0xF1D000, 0xF1DFFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x0050C2, 0xF1E000, 0xF1EFFF, "Dell'Orto S.P.A.", "DELL-ORTO" },
-	{ 0x0050C2, 0xF1F000, 0xF1FFFF, "Verified Energy, LLC.", "VERIFIED-ENERGY" },
-	{ 0x0050C2, 0xF20000, 0xF20FFF, "Unfors Instruments AB", "UNFORS-INSTRUMENTS-AB" },
-	{ 0x0050C2, 0xF21000, 0xF21FFF, "SEITEC Co. Ltd", "SEITEC" },
-	{ 0x0050C2, 0xF22000, 0xF22FFF, "Harland Simon plc", "HARLAND-SIMON-PLC" },
-	{ 0x0050C2, 0xF23000, 0xF23FFF, "Electro-Motive Diesel", "ELECTRO-MOTIVE-DIESEL" },
-	{ 0x0050C2, 0xF24000, 0xF24FFF, "CT Company", "CT-COMPANY" },
-	{ 0x0050C2, 0xF25000, 0xF25FFF, "Samway Electronic SRL", "SAMWAY-SRL" },
-	{ 0x0050C2, 0xF26000, 0xF26FFF, "WaveIP", "WAVEIP" },
-	{ 0x0050C2, 0xF27000, 0xF27FFF, "Bucher Automation Budapest", "BUCHER-AUTOMATION-BUDAPEST" },
-	{ 0x0050C2, 0xF28000, 0xF28FFF, "Vertex Antennentechnik GmbH", "VERTEX-ANTENNENTECHNIK" },
-	{ 0x0050C2, 0xF29000, 0xF29FFF, "RADYNE CORPORATION", "RADYNE" },
-	{ 0x0050C2, 0xF2A000, 0xF2AFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0xF2B000, 0xF2BFFF, "Bio Guard component & technologies", "BIO-GUARD-COMPONENT-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF2C000, 0xF2CFFF, "Terratel Technology s.r.o.", "TERRATEL-S-R-O" },
-	{ 0x0050C2, 0xF2D000, 0xF2DFFF, "Robert Bosch Healthcare Systems, Inc.", "ROBERT-BOSCH-HEALTHCARE" },
-	{ 0x0050C2, 0xF2E000, 0xF2EFFF, "H&L Instruments, LLC", "H-L-INSTRUMENTS" },
-	{ 0x0050C2, 0xF2F000, 0xF2FFFF, "Arcos Technologies LTD", "ARCOS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF30000, 0xF30FFF, "Miris AB", "MIRIS-AB" },
-	{ 0x0050C2, 0xF31000, 0xF31FFF, "Ruetz Technologies GmbH", "RUETZ-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF32000, 0xF32FFF, "Net4Things", "NET4THINGS" },
-	{ 0x0050C2, 0xF33000, 0xF33FFF, "Applied Micro Electronics AME bv", "APPLIED-MICRO-ELECTRONICS-AME" },
-	{ 0x0050C2, 0xF34000, 0xF34FFF, "Sequip S+E GmbH", "SEQUIP-S+E" },
-	{ 0x0050C2, 0xF35000, 0xF35FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x0050C2, 0xF36000, 0xF36FFF, "Visitech AS", "VISITECH-AS" },
-	{ 0x0050C2, 0xF37000, 0xF37FFF, "Rosslare Enterprises Limited", "ROSSLARE-ENTERPRISES" },
-	{ 0x0050C2, 0xF38000, 0xF38FFF, "AeroControl, Inc.", "AEROCONTROL" },
-	{ 0x0050C2, 0xF39000, 0xF39FFF, "InForce Computing, Inc.", "INFORCE-COMPUTING" },
-	{ 0x0050C2, 0xF3A000, 0xF3AFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xF3B000, 0xF3BFFF, "TAMS firmware co.", "TAMS-FIRMWARE" },
-	{ 0x0050C2, 0xF3C000, 0xF3CFFF, "Vemco Sp. z o. o.", "VEMCO-SP-Z-O-O" },
-	{ 0x0050C2, 0xF3D000, 0xF3DFFF, "Project service S.a.s", "PROJECT-SERVICE-S" },
-	{ 0x0050C2, 0xF3E000, 0xF3EFFF, "Vtron Pty Ltd", "VTRON-PTY" },
-	{ 0x0050C2, 0xF3F000, 0xF3FFFF, "DENSEI COMMUNICATION Inc.", "DENSEI-COMMUNICATION" },
-	{ 0x0050C2, 0xF40000, 0xF40FFF, "iBWorld co.,ltd.", "IBWORLD" },
-	{ 0x0050C2, 0xF41000, 0xF41FFF, "FairyDevices Inc.", "FAIRYDEVICES" },
-	{ 0x0050C2, 0xF42000, 0xF42FFF, "DSPCon", "DSPCON" },
-	{ 0x0050C2, 0xF43000, 0xF43FFF, "Special Systems Engineering Center LLC", "SPECIAL-ENGINEERING-CENTER" },
-	{ 0x0050C2, 0xF44000, 0xF44FFF, "Steinbichler Optotechnik GmbH", "STEINBICHLER-OPTOTECHNIK" },
-	{ 0x0050C2, 0xF45000, 0xF45FFF, "HUSTY M.Styczen J.Hupert Sp.J.", "HUSTY-M-STYCZEN-J-HUPERT-SP-J" },
-	{ 0x0050C2, 0xF46000, 0xF46FFF, "Reason Tecnologia S.A.", "REASON-TECNOLOGIA" },
-	{ 0x0050C2, 0xF47000, 0xF47FFF, "cadac,inc.", "CADAC" },
-	{ 0x0050C2, 0xF48000, 0xF48FFF, "SHURE INCORPORATED", "SHURE-INCORPORATED" },
-	{ 0x0050C2, 0xF49000, 0xF49FFF, "Green Instruments A/S", "GREEN-INSTRUMENTS-A/S" },
-	{ 0x0050C2, 0xF4A000, 0xF4AFFF, "Z-App Systems, Inc.", "Z-APP" },
-	{ 0x0050C2, 0xF4B000, 0xF4BFFF, "Supranet", "SUPRANET" },
-	{ 0x0050C2, 0xF4C000, 0xF4CFFF, "Enistic Limited", "ENISTIC" },
-	{ 0x0050C2, 0xF4D000, 0xF4DFFF, "KNOWHOW INFOCOM INC.", "KNOWHOW-INFOCOM" },
-	{ 0x0050C2, 0xF4E000, 0xF4EFFF, "Heinzinger electronic GmbH", "HEINZINGER" },
-	{ 0x0050C2, 0xF4F000, 0xF4FFFF, "BAP Precision Ltd.", "BAP-PRECISION" },
-	{ 0x0050C2, 0xF50000, 0xF50FFF, "Moritex Corporation", "MORITEX" },
-	{ 0x0050C2, 0xF51000, 0xF51FFF, "NDC Infrared Engineering, Inc.", "NDC-INFRARED-ENGINEERING" },
-	{ 0x0050C2, 0xF52000, 0xF52FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xF53000, 0xF53FFF, "BAYCOM OPTO-ELECTRONICS TECHNOLGY CO., LTD.", "BAYCOM-OPTO-ELECTRONICS-TECHNOLGY" },
-	{ 0x0050C2, 0xF54000, 0xF54FFF, "Hella Gutmann Solutions GmbH", "HELLA-GUTMANN-SOLUTIONS" },
-	{ 0x0050C2, 0xF55000, 0xF55FFF, "Honeywell", "HONEYWELL" },
-	{ 0x0050C2, 0xF56000, 0xF56FFF, "Monsoon Solutions, Inc.", "MONSOON-SOLUTIONS" },
-	{ 0x0050C2, 0xF57000, 0xF57FFF, "Reach Technologies Inc.", "REACH-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF58000, 0xF58FFF, "IEEE Registration Authority", "IEEE-REGISTRATION-AUTHORITY" },
-	{ 0x0050C2, 0xF59000, 0xF59FFF, "G3 Technologies", "G3-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF5A000, 0xF5AFFF, "Sentry 360 Security", "SENTRY-360-SECURITY" },
-	{ 0x0050C2, 0xF5B000, 0xF5BFFF, "Saia-Burgess Controls AG", "SAIA-BURGESS-CONTROLS" },
-	{ 0x0050C2, 0xF5C000, 0xF5CFFF, "DSP DESIGN LTD", "DSP-DESIGN" },
-	{ 0x0050C2, 0xF5D000, 0xF5DFFF, "SMARTB TECHNOLOGIES", "SMARTB-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF5E000, 0xF5EFFF, "Y-cam Solutions Ltd", "Y-CAM-SOLUTIONS" },
-	{ 0x0050C2, 0xF5F000, 0xF5FFFF, "BORYEU TECHNOLOGY CO.,LTD", "BORYEU" },
-	{ 0x0050C2, 0xF60000, 0xF60FFF, "Deckma GmbH", "DECKMA" },
-	{ 0x0050C2, 0xF61000, 0xF61FFF, "Brauch Elektronik GmbH&Co.KG", "BRAUCH-ELEKTRONIK" },
-	{ 0x0050C2, 0xF62000, 0xF62FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x0050C2, 0xF63000, 0xF63FFF, "Triax A/S", "TRIAX-A/S" },
-	{ 0x0050C2, 0xF64000, 0xF64FFF, "Chrisso Technologies LLC", "CHRISSO-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF65000, 0xF65FFF, "Telebyte Inc.", "TELEBYTE" },
-	{ 0x0050C2, 0xF66000, 0xF66FFF, "GWT LLC", "GWT" },
-	{ 0x0050C2, 0xF67000, 0xF67FFF, "Celestial Audio", "CELESTIAL-AUDIO" },
-	{ 0x0050C2, 0xF68000, 0xF68FFF, "Newtec A/S", "NEWTEC-A/S" },
-	{ 0x0050C2, 0xF69000, 0xF69FFF, "Safe Place Solutions Ltd", "SAFE-PLACE-SOLUTIONS" },
-	{ 0x0050C2, 0xF6A000, 0xF6AFFF, "OFI Inc. (dba 2D2C)", "OFI-DBA-2D2C" },
-	{ 0x0050C2, 0xF6B000, 0xF6BFFF, "Algodue Elettronica Srl", "ALGODUE-ELETTRONICA-SRL" },
-	{ 0x0050C2, 0xF6C000, 0xF6CFFF, "Pro Design Electronic GmbH", "PRO-DESIGN" },
-	{ 0x0050C2, 0xF6D000, 0xF6DFFF, "Pro Design Electronic GmbH", "PRO-DESIGN" },
-	{ 0x0050C2, 0xF6E000, 0xF6EFFF, "Smith Meter, Inc.", "SMITH-METER" },
-	{ 0x0050C2, 0xF6F000, 0xF6FFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x0050C2, 0xF70000, 0xF70FFF, "Noralta Technologies Inc", "NORALTA-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF71000, 0xF71FFF, "RF Code", "RF-CODE" },
-	{ 0x0050C2, 0xF72000, 0xF72FFF, "MaxDeTec AG", "MAXDETEC" },
-	{ 0x0050C2, 0xF73000, 0xF73FFF, "DELTACAST.TV", "DELTACAST-TV" },
-	{ 0x0050C2, 0xF74000, 0xF74FFF, "Thor Technologies Pty Ltd", "THOR-TECHNOLOGIES-PTY" },
-	{ 0x0050C2, 0xF75000, 0xF75FFF, "PumpWell Solutions Ltd.", "PUMPWELL-SOLUTIONS" },
-	{ 0x0050C2, 0xF76000, 0xF76FFF, "Rong Jie(FuZhou)Electronics Co.,Ltd", "RONG-JIE-FUZHOU-ELECTRONICS" },
-	{ 0x0050C2, 0xF77000, 0xF77FFF, "SYSTEMTECHNIK GmbH", "SYSTEMTECHNIK" },
-	{ 0x0050C2, 0xF78000, 0xF78FFF, "Gets MSS S.A.", "GETS-MSS" },
-	{ 0x0050C2, 0xF79000, 0xF79FFF, "Tattile srl", "TATTILE-SRL" },
-	{ 0x0050C2, 0xF7A000, 0xF7AFFF, "C3 LLC", "C3" },
-	{ 0x0050C2, 0xF7B000, 0xF7BFFF, "MCM Electronics", "MCM-ELECTRONICS" },
-	{ 0x0050C2, 0xF7C000, 0xF7CFFF, "Atonometrics, Inc.", "ATONOMETRICS" },
-	{ 0x0050C2, 0xF7D000, 0xF7DFFF, "D-Hike Electroncs Technology Co.,Ltd", "D-HIKE-ELECTRONCS" },
-	{ 0x0050C2, 0xF7E000, 0xF7EFFF, "TruTeq Wireless (Pty) Ltd", "TRUTEQ-WIRELESS-PTY" },
-	{ 0x0050C2, 0xF7F000, 0xF7FFFF, "Dynamic Design", "DYNAMIC-DESIGN" },
-	{ 0x0050C2, 0xF80000, 0xF80FFF, "SYS TEC electronic GmbH", "SYS-TEC" },
-	{ 0x0050C2, 0xF81000, 0xF81FFF, "PLDA", "PLDA" },
-	{ 0x0050C2, 0xF82000, 0xF82FFF, "Sincair Systems International", "SINCAIR" },
-	{ 0x0050C2, 0xF83000, 0xF83FFF, "Televic Rail GmbH", "TELEVIC-RAIL" },
-	{ 0x0050C2, 0xF84000, 0xF84FFF, "Dynon Instruments", "DYNON-INSTRUMENTS" },
-	{ 0x0050C2, 0xF85000, 0xF85FFF, "Enetics, Inc.", "ENETICS" },
-	{ 0x0050C2, 0xF86000, 0xF86FFF, "Audio Power Labs", "AUDIO-POWER-LABS" },
-	{ 0x0050C2, 0xF87000, 0xF87FFF, "Vaisala Oyj", "VAISALA-OYJ" },
-	{ 0x0050C2, 0xF88000, 0xF88FFF, "RTC Manufacturing Inc.", "RTC-MANUFACTURING" },
-	{ 0x0050C2, 0xF89000, 0xF89FFF, "CSA Engineering AG", "CSA-ENGINEERING" },
-	{ 0x0050C2, 0xF8A000, 0xF8AFFF, "EMAC, Inc.", "EMAC" },
-	{ 0x0050C2, 0xF8B000, 0xF8BFFF, "comlet Verteilte Systeme GmbH", "COMLET-VERTEILTE-SYSTEME" },
-	{ 0x0050C2, 0xF8C000, 0xF8CFFF, "UBSTechnology Co., Ltd", "UBSTECHNOLOGY" },
-	{ 0x0050C2, 0xF8D000, 0xF8DFFF, "Guangdong East Power Co.,", "GUANGDONG-EAST-POWER" },
-	{ 0x0050C2, 0xF8E000, 0xF8EFFF, "GPO", "GPO" },
-	{ 0x0050C2, 0xF8F000, 0xF8FFFF, "Computerwise, Inc.", "COMPUTERWISE" },
-	{ 0x0050C2, 0xF90000, 0xF90FFF, "SecureTech Systems, Inc.", "SECURETECH" },
-	{ 0x0050C2, 0xF91000, 0xF91FFF, "RE2 Inc", "RE2" },
-	{ 0x0050C2, 0xF92000, 0xF92FFF, "CONET Solutions GmbH", "CONET-SOLUTIONS" },
-	{ 0x0050C2, 0xF93000, 0xF93FFF, "Baudisch Electronic GmbH", "BAUDISCH" },
-	{ 0x0050C2, 0xF94000, 0xF94FFF, "Digital Barriers", "DIGITAL-BARRIERS" },
-	{ 0x0050C2, 0xF95000, 0xF95FFF, "TTi LTD (Thurlby Thandar Instruments LTD)", "TTI-THURLBY-THANDAR-INSTRUMENTS" },
-	{ 0x0050C2, 0xF96000, 0xF96FFF, "JLCooper Electronics", "JLCOOPER-ELECTRONICS" },
-	{ 0x0050C2, 0xF97000, 0xF97FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x0050C2, 0xF98000, 0xF98FFF, "Infotech North America", "INFOTECH-NORTH-AMERICA" },
-	{ 0x0050C2, 0xF99000, 0xF99FFF, "Dr. Neumann elektronik GmbH", "DR-NEUMANN-ELEKTRONIK" },
-	{ 0x0050C2, 0xF9A000, 0xF9AFFF, "Telvent", "TELVENT" },
-	{ 0x0050C2, 0xF9B000, 0xF9BFFF, "NEWELL TECHNOLOGIES LIMITED", "NEWELL-TECHNOLOGIES" },
-	{ 0x0050C2, 0xF9C000, 0xF9CFFF, "R&D KOMETEH", "R-D-KOMETEH" },
-	{ 0x0050C2, 0xF9D000, 0xF9DFFF, "JSC Kaluga Teletypes Manufacturing Plant", "JSC-KALUGA-TELETYPES-MANUFACTURING-PLANT" },
-	{ 0x0050C2, 0xF9E000, 0xF9EFFF, "Matsusada Precision Inc.", "MATSUSADA-PRECISION" },
-	{ 0x0050C2, 0xF9F000, 0xF9FFFF, "Nanjing SAC Power Grid Automation Co., Ltd.", "NANJING-SAC-POWER-GRID-AUTOMATION" },
-	{ 0x0050C2, 0xFA0000, 0xFA0FFF, "Amplus Communication Pte Ltd", "AMPLUS-COMMUNICATION-PTE" },
-	{ 0x0050C2, 0xFA1000, 0xFA1FFF, "N-Hands GmbH und Co KG", "N-HANDS-UND" },
-	{ 0x0050C2, 0xFA2000, 0xFA2FFF, "Power-One", "POWER-ONE" },
-	{ 0x0050C2, 0xFA3000, 0xFA3FFF, "Xemex NV", "XEMEX-NV" },
-	{ 0x0050C2, 0xFA5000, 0xFA5FFF, "Intuitive Surgical, Inc", "INTUITIVE-SURGICAL" },
-	{ 0x0050C2, 0xFA6000, 0xFA6FFF, "Hilkom digital GmbH", "HILKOM-DIGITAL" },
-	{ 0x0050C2, 0xFA7000, 0xFA7FFF, "Exelis Inc.", "EXELIS" },
-	{ 0x0050C2, 0xFA8000, 0xFA8FFF, "Yash SiQure Technologies India Pvt. Ltd.", "YASH-SIQURE-TECHNOLOGIES-INDIA-PVT" },
-	{ 0x0050C2, 0xFA9000, 0xFA9FFF, "Hijet Print d.o.o.", "HIJET-PRINT-D-O-O" },
-	{ 0x0050C2, 0xFAA000, 0xFAAFFF, "YJSYSTEM", "YJSYSTEM" },
-	{ 0x0050C2, 0xFAB000, 0xFABFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x0050C2, 0xFAC000, 0xFACFFF, "ADETEL GROUP", "ADETEL-GROUP" },
-	{ 0x0050C2, 0xFAD000, 0xFADFFF, "Finishing Brands", "FINISHING-BRANDS" },
-	{ 0x0050C2, 0xFAE000, 0xFAEFFF, "ATI Automação Telecomunicações e Informática Ltda", "ATI-AUTOMAO-TELECOMUNICAES-E-INFORMTICA-LTDA" },
-	{ 0x0050C2, 0xFAF000, 0xFAFFFF, "Vremya-CH JSC", "VREMYA-CH-JSC" },
-	{ 0x0050C2, 0xFB0000, 0xFB0FFF, "Tateishi Kobisha Co.LTD", "TATEISHI-KOBISHA" },
-	{ 0x0050C2, 0xFB1000, 0xFB1FFF, "MATELEX", "MATELEX" },
-	{ 0x0050C2, 0xFB2000, 0xFB2FFF, "Preston Industries dba PolyScience", "PRESTON-INDUSTRIES-DBA-POLYSCIENCE" },
-	{ 0x0050C2, 0xFB3000, 0xFB3FFF, "CT Company", "CT-COMPANY" },
-	{ 0x0050C2, 0xFB4000, 0xFB4FFF, "MC-monitoring SA", "MC-MONITORING" },
-	{ 0x0050C2, 0xFB5000, 0xFB5FFF, "Assembly Contracts Limited", "ASSEMBLY-CONTRACTS" },
-	{ 0x0050C2, 0xFB6000, 0xFB6FFF, "ARGUS-SPECTRUM", "ARGUS-SPECTRUM" },
-	{ 0x0050C2, 0xFB7000, 0xFB7FFF, "Pounce Consulting", "POUNCE-CONSULTING" },
-	{ 0x0050C2, 0xFB8000, 0xFB8FFF, "TECHNO CO.,LTD.", "TECHNO" },
-	{ 0x0050C2, 0xFB9000, 0xFB9FFF, "Coral Telecom Ltd", "CORAL-TELECOM" },
-	{ 0x0050C2, 0xFBA000, 0xFBAFFF, "Elbit Systems of America", "ELBIT-OF-AMERICA" },
-	{ 0x0050C2, 0xFBB000, 0xFBBFFF, "ACIDA GmbH", "ACIDA" },
-	{ 0x0050C2, 0xFBC000, 0xFBCFFF, "Leroy Somer", "LEROY-SOMER" },
-	{ 0x0050C2, 0xFBD000, 0xFBDFFF, "EATON FHF Funke + Huster Fernsig GmbH", "EATON-FHF-FUNKE-+-HUSTER-FERNSIG" },
-	{ 0x0050C2, 0xFBE000, 0xFBEFFF, "senTec Elektronik GmbH", "SENTEC-ELEKTRONIK" },
-	{ 0x0050C2, 0xFBF000, 0xFBFFFF, "MYLOGIC", "MYLOGIC" },
-	{ 0x0050C2, 0xFC0000, 0xFC0FFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x0050C2, 0xFC1000, 0xFC1FFF, "Motec Pty Ltd", "MOTEC-PTY" },
-	{ 0x0050C2, 0xFC2000, 0xFC2FFF, "ELTA", "ELTA" },
-	{ 0x0050C2, 0xFC3000, 0xFC3FFF, "HSDC Sp. z o.o.", "HSDC-SP-Z-O-O" },
-	{ 0x0050C2, 0xFC4000, 0xFC4FFF, "Kyowadensi", "KYOWADENSI" },
-	{ 0x0050C2, 0xFC5000, 0xFC5FFF, "Sakura Seiki Co.,Ltd.", "SAKURA-SEIKI" },
-	{ 0x0050C2, 0xFC6000, 0xFC6FFF, "Critical Link LLC", "CRITICAL-LINK" },
-	{ 0x0050C2, 0xFC7000, 0xFC7FFF, "SERCOM Regeltechniek", "SERCOM-REGELTECHNIEK" },
-	{ 0x0050C2, 0xFC8000, 0xFC8FFF, "Far South Networks", "FAR-SOUTH-NETWORKS" },
-	{ 0x0050C2, 0xFC9000, 0xFC9FFF, "Mehta Tech, Inc.", "MEHTA-TECH" },
-	{ 0x0050C2, 0xFCA000, 0xFCAFFF, "Telemisis Ltd", "TELEMISIS" },
-	{ 0x0050C2, 0xFCB000, 0xFCBFFF, "Propagation Systems Limited", "PROPAGATION" },
-	{ 0x0050C2, 0xFCC000, 0xFCCFFF, "Soudronic AG", "SOUDRONIC" },
-	{ 0x0050C2, 0xFCD000, 0xFCDFFF, "Jinyoung Contech", "JINYOUNG-CONTECH" },
-	{ 0x0050C2, 0xFCE000, 0xFCEFFF, "KOYO ELECTRIC", "KOYO-ELECTRIC" },
-	{ 0x0050C2, 0xFCF000, 0xFCFFFF, "DINTEK Shanghai Electronic Ltd", "DINTEK-SHANGHAI" },
-	{ 0x0050C2, 0xFD0000, 0xFD0FFF, "Simple Solutions", "SIMPLE-SOLUTIONS" },
-	{ 0x0050C2, 0xFD1000, 0xFD1FFF, "Enyx SA", "ENYX" },
-	{ 0x0050C2, 0xFD2000, 0xFD2FFF, "Autonomic Controls. Inc", "AUTONOMIC-CONTROLS" },
-	{ 0x0050C2, 0xFD3000, 0xFD3FFF, "Aster Electric Co.,Ltd.", "ASTER-ELECTRIC" },
-	{ 0x0050C2, 0xFD4000, 0xFD4FFF, "Insitu, Inc", "INSITU" },
-	{ 0x0050C2, 0xFD5000, 0xFD5FFF, "American Microsystems, Ltd.", "AMERICAN-MICROSYSTEMS" },
-	{ 0x0050C2, 0xFD6000, 0xFD6FFF, "City Computing Ltd", "CITY-COMPUTING" },
-	{ 0x0050C2, 0xFD7000, 0xFD7FFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x0050C2, 0xFD8000, 0xFD8FFF, "Ease Inc.", "EASE" },
-	{ 0x0050C2, 0xFD9000, 0xFD9FFF, "Figment Design Laboratories", "FIGMENT-DESIGN-LABORATORIES" },
-	{ 0x0050C2, 0xFDA000, 0xFDAFFF, "Bucher Automation Budapest", "BUCHER-AUTOMATION-BUDAPEST" },
-	{ 0x0050C2, 0xFDB000, 0xFDBFFF, "The Security Center Inc", "THE-SECURITY-CENTER" },
-	{ 0x0050C2, 0xFDC000, 0xFDCFFF, "QUERCUS TECHNOLOGIES, S.L.", "QUERCUS-TECHNOLOGIES" },
-	{ 0x0050C2, 0xFDD000, 0xFDDFFF, "Toptech Systems, Inc.", "TOPTECH" },
-	{ 0x0050C2, 0xFDE000, 0xFDEFFF, "Peek Traffic", "PEEK-TRAFFIC" },
-	{ 0x0050C2, 0xFDF000, 0xFDFFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x0050C2, 0xFE0000, 0xFE0FFF, "Azurtest", "AZURTEST" },
-	{ 0x0050C2, 0xFE1000, 0xFE1FFF, "dotOcean", "DOTOCEAN" },
-	{ 0x0050C2, 0xFE2000, 0xFE2FFF, "Pulsotronic Anlagentechnik GmbH", "PULSOTRONIC-ANLAGENTECHNIK" },
-	{ 0x0050C2, 0xFE3000, 0xFE3FFF, "Private", "PRIVATE" },
-	{ 0x0050C2, 0xFE4000, 0xFE4FFF, "RTT Mobile Interpretation", "RTT-MOBILE-INTERPRETATION" },
-	{ 0x0050C2, 0xFE5000, 0xFE5FFF, "ScandiNova Systems", "SCANDINOVA" },
-	{ 0x0050C2, 0xFE6000, 0xFE6FFF, "Exibea AB", "EXIBEA-AB" },
-	{ 0x0050C2, 0xFE7000, 0xFE7FFF, "Erhardt+Leimer GmbH", "ERHARDT+LEIMER" },
-	{ 0x0050C2, 0xFE8000, 0xFE8FFF, "Mango DSP, Inc.", "MANGO-DSP" },
-	{ 0x0050C2, 0xFE9000, 0xFE9FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x0050C2, 0xFEA000, 0xFEAFFF, "Brunel GmbH Section Communications", "BRUNEL-SECTION-COMMUNICATION" },
-	{ 0x0050C2, 0xFEB000, 0xFEBFFF, "Axible Technologies", "AXIBLE-TECHNOLOGIES" },
-	{ 0x0050C2, 0xFEC000, 0xFECFFF, "First System Technology Co., Ltd.", "FIRST-SYSTEM" },
-	{ 0x0050C2, 0xFED000, 0xFEDFFF, "LOGISOL Kft.", "LOGISOL-KFT" },
-	{ 0x0050C2, 0xFEE000, 0xFEEFFF, "Sparks Instruments SA", "SPARKS-INSTRUMENTS" },
-	{ 0x0050C2, 0xFEF000, 0xFEFFFF, "Task Sistemas de Computacao", "TASK-SISTEMAS-DE-COMPUTACAO" },
-	{ 0x0050C2, 0xFF0000, 0xFF0FFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x0050C2, 0xFF1000, 0xFF1FFF, "DiTEST Fahrzeugdiagnose GmbH", "DITEST-FAHRZEUGDIAGNOSE" },
-	{ 0x0050C2, 0xFF2000, 0xFF2FFF, "GLOBALCOM ENGINEERING SRL", "GLOBALCOM-ENGINEERING-SRL" },
-	{ 0x0050C2, 0xFF3000, 0xFF3FFF, "CONTROL SYSTEMS Srl", "CONTROL-SRL" },
-	{ 0x0050C2, 0xFF4000, 0xFF4FFF, "Burk Technology", "BURK" },
-	{ 0x0050C2, 0xFF5000, 0xFF5FFF, "Flexkom Internet Pazarlama Bilipim ve Eoitim Hiz.Inp.Mim.Muh.Oto.Enerji San. Tic. A.p.", "FLEXKOM-INTERNET-PAZARLAMA-BILIPIM-VE-EOITIM-HIZ-INP-MIM-MUH-OTO-ENERJI-SAN-TIC-A-P" },
-	{ 0x0050C2, 0xFF6000, 0xFF6FFF, "Booyco Electronics", "BOOYCO-ELECTRONICS" },
-	{ 0x0050C2, 0xFF7000, 0xFF7FFF, "Human Intech", "HUMAN-INTECH" },
-	{ 0x0050C2, 0xFF8000, 0xFF8FFF, "KST technology", "KST" },
-	{ 0x0050C2, 0xFF9000, 0xFF9FFF, "AVA Monitoring AB", "AVA-MONITORING-AB" },
-	{ 0x0050C2, 0xFFA000, 0xFFAFFF, "Nupoint Systems Inc.", "NUPOINT" },
-	{ 0x0050C2, 0xFFB000, 0xFFBFFF, "SEFRAM", "SEFRAM" },
-	{ 0x0050C2, 0xFFC000, 0xFFCFFF, "Spirent Communications", "SPIRENT-COMMUNICATION" },
-	{ 0x0050C2, 0xFFD000, 0xFFDFFF, "Touchless Biometric Systems AG", "TOUCHLESS-BIOMETRIC" },
-	{ 0x0050C2, 0xFFE000, 0xFFEFFF, "Sensata Technologies", "SENSATA-TECHNOLOGIES" },
-	{ 0x0050C2, 0xFFF000, 0xFFFFFF, "MSR-Solutions GmbH", "MSR-SOLUTIONS" },
-	{ 0x40D855, 0x000000, 0x000FFF, "XRONOS.INC", "XRONOS" },
-	{ 0x40D855, 0x001000, 0x001FFF, "Vemotion", "VEMOTION" },
-	{ 0x40D855, 0x002000, 0x002FFF, "Hangzhou Chenxiao Technologies Co. Ltd.", "HANGZHOU-CHENXIAO-TECHNOLOGIES" },
-	{ 0x40D855, 0x003000, 0x003FFF, "AlphaNavigation coltd", "ALPHANAVIGATION-COLTD" },
-	{ 0x40D855, 0x004000, 0x004FFF, "CR Magnetics, Inc.", "CR-MAGNETICS" },
-	{ 0x40D855, 0x005000, 0x005FFF, "Monarch Instrument", "MONARCH-INSTRUMENT" },
-	{ 0x40D855, 0x006000, 0x006FFF, "Bactest Limited", "BACTEST" },
-	{ 0x40D855, 0x007000, 0x007FFF, "Digital Audio SA", "DIGITAL-AUDIO" },
-	{ 0x40D855, 0x008000, 0x008FFF, "Kaori Industria Eletronica Ltda", "KAORI-INDUSTRIA-ELETRONICA-LTDA" },
-	{ 0x40D855, 0x009000, 0x009FFF, "ClearSite Communications Inc.", "CLEARSITE-COMMUNICATION" },
-	{ 0x40D855, 0x00A000, 0x00AFFF, "Sarana Sistem Mikro", "SARANA-SISTEM-MIKRO" },
-	{ 0x40D855, 0x00B000, 0x00BFFF, "Gogo BA", "GOGO-BA" },
-	{ 0x40D855, 0x00C000, 0x00CFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x40D855, 0x00D000, 0x00DFFF, "HuNS", "HUNS" },
-	{ 0x40D855, 0x00E000, 0x00EFFF, "Brightwell Dispensers", "BRIGHTWELL-DISPENSERS" },
-	{ 0x40D855, 0x00F000, 0x00FFFF, "DIGITAL DYNAMICS, INC.", "DIGITAL-DYNAMICS" },
-	{ 0x40D855, 0x010000, 0x010FFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER" },
-	{ 0x40D855, 0x011000, 0x011FFF, "Flexim Security Oy", "FLEXIM-SECURITY-OY" },
-	{ 0x40D855, 0x012000, 0x012FFF, "Sencon Inc.", "SENCON" },
-	{ 0x40D855, 0x013000, 0x013FFF, "Grande Vitesse Systems", "GRANDE-VITESSE" },
-	{ 0x40D855, 0x014000, 0x014FFF, "Toni Studio", "TONI-STUDIO" },
-	{ 0x40D855, 0x015000, 0x015FFF, "BITMILL srl", "BITMILL-SRL" },
-	{ 0x40D855, 0x016000, 0x016FFF, "Par-Tech, Inc.", "PAR-TECH" },
-	{ 0x40D855, 0x017000, 0x017FFF, "Franke Aquarotter GmbH", "FRANKE-AQUAROTTER" },
-	{ 0x40D855, 0x018000, 0x018FFF, "STANEO SAS", "STANEO-SAS" },
-	{ 0x40D855, 0x019000, 0x019FFF, "Nautel LTD", "NAUTEL" },
-	{ 0x40D855, 0x01A000, 0x01AFFF, "MEGGITT DEFENSE SYSTEMS INC.", "MEGGITT-DEFENSE" },
-	{ 0x40D855, 0x01B000, 0x01BFFF, "Audio Enhancement", "AUDIO-ENHANCEMENT" },
-	{ 0x40D855, 0x01C000, 0x01CFFF, "BERG Cloud Limited", "BERG-CLOUD" },
-	{ 0x40D855, 0x01D000, 0x01DFFF, "Scharco Elektronik GmbH", "SCHARCO-ELEKTRONIK" },
-	{ 0x40D855, 0x01E000, 0x01EFFF, "A2S", "A2S" },
-	{ 0x40D855, 0x01F000, 0x01FFFF, "Sitep Italia Spa", "SITEP-ITALIA-SPA" },
-	{ 0x40D855, 0x020000, 0x020FFF, "ENTEC Electric & Electronic CO., LTD.", "ENTEC-ELECTRIC" },
-	{ 0x40D855, 0x021000, 0x021FFF, "SMT D.O.O.", "SMT-D-O-O" },
-	{ 0x40D855, 0x022000, 0x022FFF, "Digimerge Technology Inc", "DIGIMERGE" },
-	{ 0x40D855, 0x023000, 0x023FFF, "Shanghai o-solution electronics & Technology Co., Ltd.", "SHANGHAI-O-SOLUTION-ELECTRONICS" },
-	{ 0x40D855, 0x024000, 0x024FFF, "Electrical Geodesics Incorporated", "ELECTRICAL-GEODESICS-INCORPORATED" },
-	{ 0x40D855, 0x025000, 0x025FFF, "Rosemount Analytical", "ROSEMOUNT-ANALYTICAL" },
-	{ 0x40D855, 0x026000, 0x026FFF, "Symetrics Industries", "SYMETRICS-INDUSTRIES" },
-	{ 0x40D855, 0x027000, 0x027FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x40D855, 0x028000, 0x028FFF, "Integrated Control Corp.", "INTEGRATED-CONTROL" },
-	{ 0x40D855, 0x029000, 0x029FFF, "Depro Electronique", "DEPRO-ELECTRONIQUE" },
-	{ 0x40D855, 0x02A000, 0x02AFFF, "Tinkerforge GmbH", "TINKERFORGE" },
-	{ 0x40D855, 0x02B000, 0x02BFFF, "Nomatronics", "NOMATRONICS" },
-	{ 0x40D855, 0x02C000, 0x02CFFF, "InventLab s.c.", "INVENTLAB-S-C" },
-	{ 0x40D855, 0x02D000, 0x02DFFF, "Elgama Sistemos", "ELGAMA-SISTEMOS" },
-	{ 0x40D855, 0x02E000, 0x02EFFF, "Circuitec Ind. Equip. Eletr. Ltda", "CIRCUITEC-IND-EQUIP-ELETR-LTDA" },
-	{ 0x40D855, 0x02F000, 0x02FFFF, "Advatek Lighting Pty Ltd", "ADVATEK-LIGHTING-PTY" },
-	{ 0x40D855, 0x030000, 0x030FFF, "Tecnologias Plexus", "TECNOLOGIAS-PLEXUS" },
-	{ 0x40D855, 0x031000, 0x031FFF, "Dommel GmbH", "DOMMEL" },
-	{ 0x40D855, 0x032000, 0x032FFF, "BETTINI SRL", "BETTINI-SRL" },
-	{ 0x40D855, 0x033000, 0x033FFF, "Ermes Elettronica s.r.l.", "ERMES-ELETTRONICA" },
-	{ 0x40D855, 0x034000, 0x034FFF, "Dacom West GmbH", "DACOM-WEST" },
-	{ 0x40D855, 0x035000, 0x035FFF, "Mesotech International, Inc.", "MESOTECH" },
-	{ 0x40D855, 0x036000, 0x036FFF, "Schweers informationstechnologie GmbH", "SCHWEERS-INFORMATIONSTECHNOLOGIE" },
-	{ 0x40D855, 0x037000, 0x037FFF, "Software Workshop", "SOFTWARE-WORKSHOP" },
-	{ 0x40D855, 0x038000, 0x038FFF, "Special Measurements Labs LLC", "SPECIAL-MEASUREMENTS-LABS" },
-	{ 0x40D855, 0x039000, 0x039FFF, "CI Systems Ltd", "CI" },
-	{ 0x40D855, 0x03A000, 0x03AFFF, "Socus networks", "SOCUS-NETWORKS" },
-	{ 0x40D855, 0x03B000, 0x03BFFF, "Telcomkorea", "TELCOMKOREA" },
-	{ 0x40D855, 0x03C000, 0x03CFFF, "Computer System Co.,Ltd", "SYSTEM" },
-	{ 0x40D855, 0x03D000, 0x03DFFF, "Tekelek Europe Ltd", "TEKELEK-EUROPE" },
-	{ 0x40D855, 0x03E000, 0x03EFFF, "Vishay Celtron Technologies, Inc.", "VISHAY-CELTRON-TECHNOLOGIES" },
-	{ 0x40D855, 0x03F000, 0x03FFFF, "UniSVR Global Information Technology Corp.", "UNISVR-GLOBAL-INFORMATION" },
-	{ 0x40D855, 0x040000, 0x040FFF, "GHL Systems Berhad", "GHL-BERHAD" },
-	{ 0x40D855, 0x041000, 0x041FFF, "T.Q.M. Itaca Technology s.r.l.", "T-Q-M-ITACA" },
-	{ 0x40D855, 0x042000, 0x042FFF, "Mango Communicaitons Inc.", "MANGO-COMMUNICAITONS" },
-	{ 0x40D855, 0x043000, 0x043FFF, "SchulerControl GmbH", "SCHULERCONTROL" },
-	{ 0x40D855, 0x044000, 0x044FFF, "An Chen Computer Co., Ltd.", "AN-CHEN" },
-	{ 0x40D855, 0x045000, 0x045FFF, "Genadsystem", "GENADSYSTEM" },
-	{ 0x40D855, 0x046000, 0x046FFF, "Circuitlink Pty Ltd", "CIRCUITLINK-PTY" },
-	{ 0x40D855, 0x047000, 0x047FFF, "Dos&Donts SRL", "DOS-DONTS-SRL" },
-	{ 0x40D855, 0x048000, 0x048FFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x40D855, 0x049000, 0x049FFF, "Thermo Fisher Scientific", "THERMO-FISHER-SCIENTIFIC" },
-	{ 0x40D855, 0x04A000, 0x04AFFF, "Gateway Technologies SA de CV", "GATEWAY-TECHNOLOGIES-DE-CV" },
-	{ 0x40D855, 0x04B000, 0x04BFFF, "Vital Tech Industria e Comercio Ltda", "VITAL-TECH-INDUSTRIA-E-COMERCIO-LTDA" },
-	{ 0x40D855, 0x04C000, 0x04CFFF, "Serveron Corporation", "SERVERON" },
-	{ 0x40D855, 0x04D000, 0x04DFFF, "MACHINEPERFORMANCE ApS", "MACHINEPERFORMANCE-APS" },
-	{ 0x40D855, 0x04E000, 0x04EFFF, "Honeywell International", "HONEYWELL" },
-	{ 0x40D855, 0x04F000, 0x04FFFF, "Haein S&S Co., Ltd", "HAEIN-S-S" },
-	{ 0x40D855, 0x050000, 0x050FFF, "ATG UV Technology", "ATG-UV" },
-	{ 0x40D855, 0x051000, 0x051FFF, "CS Instruments Asia", "CS-INSTRUMENTS-ASIA" },
-	{ 0x40D855, 0x052000, 0x052FFF, "DAN ELECTRONICS SYSTEM (P) LIMITED", "DAN-ELECTRONICS-SYSTEM-P" },
-	{ 0x40D855, 0x053000, 0x053FFF, "Amantys Ltd", "AMANTYS" },
-	{ 0x40D855, 0x054000, 0x054FFF, "VITEC", "VITEC" },
-	{ 0x40D855, 0x055000, 0x055FFF, "Helmholtz Zentrum Dresden Rossendorf e.V.", "HELMHOLTZ-ZENTRUM-DRESDEN-ROSSENDORF" },
-	{ 0x40D855, 0x056000, 0x056FFF, "GROUP 57", "GROUP-57" },
-	{ 0x40D855, 0x057000, 0x057FFF, "Tammermatic Group Oy", "TAMMERMATIC-GROUP-OY" },
-	{ 0x40D855, 0x058000, 0x058FFF, "Energy Team S.p.A.", "ENERGY-TEAM" },
-	{ 0x40D855, 0x059000, 0x059FFF, "COLONIAL ASSEMBLY and  DESIGN", "COLONIAL-ASSEMBLY-AND-DESIGN" },
-	{ 0x40D855, 0x05A000, 0x05AFFF, "Ultra Electronics Flightline Systems", "ULTRA-ELECTRONICS-FLIGHTLINE" },
-	{ 0x40D855, 0x05B000, 0x05BFFF, "Data Flow Systems, Inc.", "DATA-FLOW" },
-	{ 0x40D855, 0x05C000, 0x05CFFF, "Rosslare Enterprises Limited", "ROSSLARE-ENTERPRISES" },
-	{ 0x40D855, 0x05D000, 0x05DFFF, "Leica Biosystems", "LEICA-BIOSYSTEMS" },
-	{ 0x40D855, 0x05E000, 0x05EFFF, "inoage GmbH", "INOAGE" },
-	{ 0x40D855, 0x05F000, 0x05FFFF, "EPSa GmbH", "EPSA" },
-	{ 0x40D855, 0x060000, 0x060FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x40D855, 0x061000, 0x061FFF, "Cominfo, Inc.", "COMINFO" },
-	{ 0x40D855, 0x062000, 0x062FFF, "Tech Source Inc", "TECH-SOURCE" },
-	{ 0x40D855, 0x063000, 0x063FFF, "Protonic Holland", "PROTONIC-HOLLAND" },
-	{ 0x40D855, 0x064000, 0x064FFF, "HIPODROMO DE AGUA CALIENTE, S.A. DE C.V.", "HIPODROMO-DE-AGUA-CALIENTE-DE-C-V" },
-	{ 0x40D855, 0x065000, 0x065FFF, "Parallel Wireless, Inc", "PARALLEL-WIRELESS" },
-	{ 0x40D855, 0x066000, 0x066FFF, "TeraTron GmbH", "TERATRON" },
-	{ 0x40D855, 0x067000, 0x067FFF, "Tronic Control ltd.", "TRONIC-CONTROL" },
-	{ 0x40D855, 0x068000, 0x068FFF, "Oki Seatec Co., Ltd.", "OKI-SEATEC" },
-	{ 0x40D855, 0x069000, 0x069FFF, "Smartcom-Bulgaria AD", "SMARTCOM-BULGARIA-AD" },
-	{ 0x40D855, 0x06A000, 0x06AFFF, "elgris UG", "ELGRIS-UG" },
-	{ 0x40D855, 0x06B000, 0x06BFFF, "BRS Sistemas Eletrônicos", "BRS-SISTEMAS-ELETRNICOS" },
-	{ 0x40D855, 0x06C000, 0x06CFFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x40D855, 0x06D000, 0x06DFFF, "BroadSoft, INC", "BROADSOFT" },
-	{ 0x40D855, 0x06E000, 0x06EFFF, "C-COM Satellite Systems Inc.", "C-COM-SATELLITE" },
-	{ 0x40D855, 0x06F000, 0x06FFFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x40D855, 0x070000, 0x070FFF, "JSC Electrical Equipment Factory", "JSC-ELECTRICAL-EQUIPMENT-FACTORY" },
-	{ 0x40D855, 0x071000, 0x071FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x40D855, 0x072000, 0x072FFF, "CT Company", "CT-COMPANY" },
-	{ 0x40D855, 0x073000, 0x073FFF, "Diamond Technologies, Inc", "DIAMOND-TECHNOLOGIES" },
-	{ 0x40D855, 0x074000, 0x074FFF, "Sphere Medical Ltd", "SPHERE-MEDICAL" },
-	{ 0x40D855, 0x075000, 0x075FFF, "Teraflops", "TERAFLOPS" },
-	{ 0x40D855, 0x076000, 0x076FFF, "INTERNET PROTOCOLO LOGICA SL", "INTERNET-PROTOCOLO-LOGICA-SL" },
-	{ 0x40D855, 0x077000, 0x077FFF, "TOEC TECHNOLOGY CO.,LTD", "TOEC" },
-	{ 0x40D855, 0x078000, 0x078FFF, "NACHI-FUJIKOSHI CORP", "NACHI-FUJIKOSHI" },
-	{ 0x40D855, 0x079000, 0x079FFF, "DelfiSolutions A/S", "DELFISOLUTIONS-A/S" },
-	{ 0x40D855, 0x07A000, 0x07AFFF, "4embedded", "4EMBEDDED" },
-	{ 0x40D855, 0x07B000, 0x07BFFF, "IPS Technology Limited", "IPS" },
-	{ 0x40D855, 0x07C000, 0x07CFFF, "Agramkow Fluid Systems A/S", "AGRAMKOW-FLUID-A/S" },
-	{ 0x40D855, 0x07D000, 0x07DFFF, "Wuxi SiNeng New Energy Co., Ltd.", "WUXI-SINENG-NEW-ENERGY" },
-	{ 0x40D855, 0x07E000, 0x07EFFF, "TESCOM CORPORATION", "TESCOM" },
-	{ 0x40D855, 0x07F000, 0x07FFFF, "Wheatstone Corporation", "WHEATSTONE" },
-	{ 0x40D855, 0x080000, 0x080FFF, "Honeywell", "HONEYWELL" },
-	{ 0x40D855, 0x081000, 0x081FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x40D855, 0x082000, 0x082FFF, "ard sa", "ARD" },
-	{ 0x40D855, 0x083000, 0x083FFF, "DELOPT", "DELOPT" },
-	{ 0x40D855, 0x084000, 0x084FFF, "Papendorf Software Engineering GmbH", "PAPENDORF-SOFTWARE-ENGINEERING" },
-	{ 0x40D855, 0x085000, 0x085FFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x40D855, 0x086000, 0x086FFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x40D855, 0x087000, 0x087FFF, "Bestel China", "BESTEL-CHINA" },
-	{ 0x40D855, 0x088000, 0x088FFF, "JEL SYSTEM CO., LTD.", "JEL-SYSTEM" },
-	{ 0x40D855, 0x089000, 0x089FFF, "Wuhan Xingtuxinke ELectronic Co.,Ltd", "WUHAN-XINGTUXINKE" },
-	{ 0x40D855, 0x08A000, 0x08AFFF, "Leder Elektronik Design", "LEDER-ELEKTRONIK-DESIGN" },
-	{ 0x40D855, 0x08B000, 0x08BFFF, "MeshWorks Wireless Oy", "MESHWORKS-WIRELESS-OY" },
-	{ 0x40D855, 0x08C000, 0x08CFFF, "Magnescale Co.,Ltd", "MAGNESCALE" },
-	{ 0x40D855, 0x08D000, 0x08DFFF, "Boehme Nachrichtentechnik", "BOEHME-NACHRICHTENTECHNIK" },
-	{ 0x40D855, 0x08E000, 0x08EFFF, "Lyngsoe Systems", "LYNGSOE" },
-	{ 0x40D855, 0x08F000, 0x08FFFF, "Excelitas", "EXCELITAS" },
-	{ 0x40D855, 0x090000, 0x090FFF, "Axxess Identification Ltd", "AXXESS-IDENTIFICATION" },
-	{ 0x40D855, 0x091000, 0x091FFF, "KDT", "KDT" },
-	{ 0x40D855, 0x092000, 0x092FFF, "Wasserbauer GmbH", "WASSERBAUER" },
-	{ 0x40D855, 0x093000, 0x093FFF, "Sentry 360 Security", "SENTRY-360-SECURITY" },
-	{ 0x40D855, 0x094000, 0x094FFF, "Nomad Digital Limited", "NOMAD-DIGITAL" },
-	{ 0x40D855, 0x095000, 0x095FFF, "Heart Force Medical", "HEART-FORCE-MEDICAL" },
-	{ 0x40D855, 0x096000, 0x096FFF, "Comtel Electronics GmbH", "COMTEL-ELECTRONICS" },
-	{ 0x40D855, 0x097000, 0x097FFF, "Burton Technical Services LLC", "BURTON-TECHNICAL-SERVICES" },
-	{ 0x40D855, 0x098000, 0x098FFF, "DAVE SRL", "DAVE-SRL" },
-	{ 0x40D855, 0x099000, 0x099FFF, "idcell co.ltd", "IDCELL" },
-	{ 0x40D855, 0x09A000, 0x09AFFF, "CoherentPlus Sdn Bhd", "COHERENTPLUS" },
-	{ 0x40D855, 0x09B000, 0x09BFFF, "Tokyo Denki Gijutsu Kogyo", "TOKYO-DENKI-GIJUTSU-KOGYO" },
-	{ 0x40D855, 0x09C000, 0x09CFFF, "Keyware Solutions Inc.", "KEYWARE-SOLUTIONS" },
-	{ 0x40D855, 0x09D000, 0x09DFFF, "EMAC, Inc.", "EMAC" },
-	{ 0x40D855, 0x09E000, 0x09EFFF, "NanoPulse, Inc.", "NANOPULSE" },
-	{ 0x40D855, 0x09F000, 0x09FFFF, "Bascules Robbe nv", "BASCULES-ROBBE-NV" },
-	{ 0x40D855, 0x0A0000, 0x0A0FFF, "Quantronix, Inc.", "QUANTRONIX" },
-	{ 0x40D855, 0x0A1000, 0x0A1FFF, "ADVALY SYSTEM Inc.", "ADVALY-SYSTEM" },
-	{ 0x40D855, 0x0A2000, 0x0A2FFF, "Xemex NV", "XEMEX-NV" },
-	{ 0x40D855, 0x0A3000, 0x0A3FFF, "Telefrank GmbH", "TELEFRANK" },
-	{ 0x40D855, 0x0A4000, 0x0A4FFF, "Resch Electronic Innovation GmbH", "RESCH-INNOVATION" },
-	{ 0x40D855, 0x0A5000, 0x0A5FFF, "WooshCom Corporation", "WOOSHCOM" },
-	{ 0x40D855, 0x0A6000, 0x0A6FFF, "Alumbra Produtos Elétricos e Eletrônicos Ltda", "ALUMBRA-PRODUTOS-ELTRICOS-E-ELETRNICOS-LTDA" },
-	{ 0x40D855, 0x0A7000, 0x0A7FFF, "First Design System Inc.", "FIRST-DESIGN-SYSTEM" },
-	{ 0x40D855, 0x0A8000, 0x0A8FFF, "Baudisch Electronic GmbH", "BAUDISCH" },
-	{ 0x40D855, 0x0A9000, 0x0A9FFF, "Apantac LLC", "APANTAC" },
-	{ 0x40D855, 0x0AA000, 0x0AAFFF, "Thermal Imaging Radar, LLC", "THERMAL-IMAGING-RADAR" },
-	{ 0x40D855, 0x0AB000, 0x0ABFFF, "Enel doo Belgrade", "ENEL-DOO-BELGRADE" },
-	{ 0x40D855, 0x0AC000, 0x0ACFFF, "Fraunhofer HHI", "FRAUNHOFER-HHI" },
-	{ 0x40D855, 0x0AD000, 0x0ADFFF, "Space Micro", "SPACE-MICRO" },
-	{ 0x40D855, 0x0AE000, 0x0AEFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x40D855, 0x0AF000, 0x0AFFFF, "EnVerv Inc.", "ENVERV" },
-	{ 0x40D855, 0x0B0000, 0x0B0FFF, "Micrologic", "MICROLOGIC" },
-	{ 0x40D855, 0x0B1000, 0x0B1FFF, "Nanjing TIANSU Automation Control System Co., Ltd.", "NANJING-TIANSU-AUTOMATION-CONTROL-SYSTEM" },
-	{ 0x40D855, 0x0B2000, 0x0B2FFF, "Ever Trend Technology Development Limited", "EVER-TREND-DEVELOPMENT" },
-	{ 0x40D855, 0x0B3000, 0x0B3FFF, "T.W.S. srl", "T-W-S-SRL" },
-	{ 0x40D855, 0x0B4000, 0x0B4FFF, "MITSUBISHI ELECTRIC SYSTEM & SERVICE CO.,LTD.", "MITSUBISHI-ELECTRIC-SYSTEM-SERVICE" },
-	{ 0x40D855, 0x0B5000, 0x0B5FFF, "DATA SHARING CONSULTING", "DATA-SHARING-CONSULTING" },
-	{ 0x40D855, 0x0B6000, 0x0B6FFF, "Telvent", "TELVENT" },
-	{ 0x40D855, 0x0B7000, 0x0B7FFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x40D855, 0x0B8000, 0x0B8FFF, "Ferlin Trading BV", "FERLIN-TRADING" },
-	{ 0x40D855, 0x0B9000, 0x0B9FFF, "WxBR Sistemas de Telecomunicacoes Ltda", "WXBR-SISTEMAS-DE-TELECOMUNICACOES-LTDA" },
-	{ 0x40D855, 0x0BA000, 0x0BAFFF, "PCH Engineering A/S", "PCH-ENGINEERING-A/S" },
-	{ 0x40D855, 0x0BB000, 0x0BBFFF, "Whiptail", "WHIPTAIL" },
-	{ 0x40D855, 0x0BC000, 0x0BCFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x40D855, 0x0BD000, 0x0BDFFF, "iCOGNIZE GmbH", "ICOGNIZE" },
-	{ 0x40D855, 0x0BE000, 0x0BEFFF, "Manufacturing System Insights Inc", "MANUFACTURING-SYSTEM-INSIGHTS" },
-	{ 0x40D855, 0x0BF000, 0x0BFFFF, "Shenzhen SETEC Power Co.,Ltd", "SHENZHEN-SETEC-POWER" },
-	{ 0x40D855, 0x0C0000, 0x0C0FFF, "ACT", "ACT" },
-	{ 0x40D855, 0x0C1000, 0x0C1FFF, "Xepto Computing Inc", "XEPTO-COMPUTING" },
-	{ 0x40D855, 0x0C2000, 0x0C2FFF, "SC Techswarm SRL", "SC-TECHSWARM-SRL" },
-	{ 0x40D855, 0x0C3000, 0x0C3FFF, "APG Cash Drawer, LLC", "APG-CASH-DRAWER" },
-	{ 0x40D855, 0x0C4000, 0x0C4FFF, "Inspired Systems", "INSPIRED" },
-	{ 0x40D855, 0x0C5000, 0x0C5FFF, "M.M. Elektrolab", "M-M-ELEKTROLAB" },
-	{ 0x40D855, 0x0C6000, 0x0C6FFF, "comtime GmbH", "COMTIME" },
-	{ 0x40D855, 0x0C7000, 0x0C7FFF, "insensiv GmbH", "INSENSIV" },
-	{ 0x40D855, 0x0C8000, 0x0C8FFF, "Mettler Toledo", "METTLER-TOLEDO" },
-	{ 0x40D855, 0x0C9000, 0x0C9FFF, "QUANTAFLOW", "QUANTAFLOW" },
-	{ 0x40D855, 0x0CA000, 0x0CAFFF, "NEUTRIK AG", "NEUTRIK" },
-	{ 0x40D855, 0x0CB000, 0x0CBFFF, "ReliOn Inc", "RELION" },
-	{ 0x40D855, 0x0CC000, 0x0CCFFF, "ATEME", "ATEME" },
-	{ 0x40D855, 0x0CD000, 0x0CDFFF, "Logical Product", "LOGICAL-PRODUCT" },
-	{ 0x40D855, 0x0CE000, 0x0CEFFF, "EST Analytical", "EST-ANALYTICAL" },
-	{ 0x40D855, 0x0CF000, 0x0CFFFF, "Clark-MXR, Inc.", "CLARK-MXR" },
-	{ 0x40D855, 0x0D0000, 0x0D0FFF, "Icraft Oy", "ICRAFT-OY" },
-	{ 0x40D855, 0x0D1000, 0x0D1FFF, "Cantada Inc", "CANTADA" },
-	{ 0x40D855, 0x0D2000, 0x0D2FFF, "Bucher Automation Budapest", "BUCHER-AUTOMATION-BUDAPEST" },
-	{ 0x40D855, 0x0D3000, 0x0D3FFF, "LECO Corporation", "LECO" },
-	{ 0x40D855, 0x0D4000, 0x0D4FFF, "Mitsubishi Heavy Industries, Ltd.", "MITSUBISHI-HEAVY-INDUSTRIES" },
-	{ 0x40D855, 0x0D5000, 0x0D5FFF, "Shimizu Electric Co., Ltd.", "SHIMIZU-ELECTRIC" },
-	{ 0x40D855, 0x0D6000, 0x0D6FFF, "deskontrol electronics", "DESKONTROL-ELECTRONICS" },
-	{ 0x40D855, 0x0D7000, 0x0D7FFF, "Avant Technologies", "AVANT-TECHNOLOGIES" },
-	{ 0x40D855, 0x0D8000, 0x0D8FFF, "NEXT! s.c. S.Piela B.Dryja", "NEXT!-S-C-S-PIELA-B-DRYJA" },
-	{ 0x40D855, 0x0D9000, 0x0D9FFF, "YUKO ELECTRIC CO.,LTD", "YUKO-ELECTRIC" },
-	{ 0x40D855, 0x0DA000, 0x0DAFFF, "Devialet SA", "DEVIALET" },
-	{ 0x40D855, 0x0DB000, 0x0DBFFF, "Top Connect OU", "TOP-CONNECT-OU" },
-	{ 0x40D855, 0x0DC000, 0x0DCFFF, "NVS Technologies Inc", "NVS-TECHNOLOGIES" },
-	{ 0x40D855, 0x0DD000, 0x0DDFFF, "Embed Limited", "EMBED" },
-	{ 0x40D855, 0x0DE000, 0x0DEFFF, "VPG", "VPG" },
-	{ 0x40D855, 0x0DF000, 0x0DFFFF, "Xadi Inc", "XADI" },
-	{ 0x40D855, 0x0E0000, 0x0E0FFF, "Richter", "RICHTER" },
-	{ 0x40D855, 0x0E1000, 0x0E1FFF, "STV Electronic GmbH", "STV" },
-	{ 0x40D855, 0x0E2000, 0x0E2FFF, "Keocko Holding Kft.", "KEOCKO-HOLDING-KFT" },
-	{ 0x40D855, 0x0E3000, 0x0E3FFF, "Medigus Ltd", "MEDIGUS" },
-	{ 0x40D855, 0x0E4000, 0x0E4FFF, "ARAGO SYSTEMS", "ARAGO" },
-	{ 0x40D855, 0x0E5000, 0x0E5FFF, "Triton Electronics LTD", "TRITON-ELECTRONICS" },
-	{ 0x40D855, 0x0E6000, 0x0E6FFF, "Kyoritsu Electric Corp.", "KYORITSU-ELECTRIC" },
-	{ 0x40D855, 0x0E7000, 0x0E7FFF, "LIGHTSTAR", "LIGHTSTAR" },
-	{ 0x40D855, 0x0E8000, 0x0E8FFF, "HEITEC AG", "HEITEC" },
-	{ 0x40D855, 0x0E9000, 0x0E9FFF, "HAMEG GmbH", "HAMEG" },
-	{ 0x40D855, 0x0EA000, 0x0EAFFF, "A-Z-E", "A-Z-E" },
-	{ 0x40D855, 0x0EB000, 0x0EBFFF, "WANTECH Networks", "WANTECH-NETWORKS" },
-	{ 0x40D855, 0x0EC000, 0x0ECFFF, "Sentry 360 Security", "SENTRY-360-SECURITY" },
-	{ 0x40D855, 0x0ED000, 0x0EDFFF, "IntelliDesign Pty Ltd", "INTELLIDESIGN-PTY" },
-	{ 0x40D855, 0x0EE000, 0x0EEFFF, "Siegmar Zander HuSWare", "SIEGMAR-ZANDER-HUSWARE" },
-	{ 0x40D855, 0x0EF000, 0x0EFFFF, "GeneSys Elektronik GmbH", "GENESYS-ELEKTRONIK" },
-	{ 0x40D855, 0x0F0000, 0x0F0FFF, "Redwood Systems", "REDWOOD" },
-	{ 0x40D855, 0x0F1000, 0x0F1FFF, "Grossenbacher Systeme AG", "GROSSENBACHER-SYSTEME" },
-	{ 0x40D855, 0x0F2000, 0x0F2FFF, "SigmaPhi Electronics", "SIGMAPHI-ELECTRONICS" },
-	{ 0x40D855, 0x0F3000, 0x0F3FFF, "ECON Systems Inc.", "ECON" },
-	{ 0x40D855, 0x0F4000, 0x0F4FFF, "MB connect line GmbH Fernwartungssysteme", "MB-CONNECT-LINE-FERNWARTUNGSSYSTEME" },
-	{ 0x40D855, 0x0F5000, 0x0F5FFF, "CST Group", "CST-GROUP" },
-	{ 0x40D855, 0x0F6000, 0x0F6FFF, "Private", "PRIVATE" },
-	{ 0x40D855, 0x0F7000, 0x0F7FFF, "Comline Elektronik Elektrotechnik GmbH", "COMLINE-ELEKTRONIK-ELEKTROTECHNIK" },
-	{ 0x40D855, 0x0F8000, 0x0F8FFF, "Better Place", "BETTER-PLACE" },
-	{ 0x40D855, 0x0F9000, 0x0F9FFF, "Invisua Lighting BV", "INVISUA-LIGHTING" },
-	{ 0x40D855, 0x0FA000, 0x0FAFFF, "Marmitek BV", "MARMITEK" },
-	{ 0x40D855, 0x0FB000, 0x0FBFFF, "InfoMac Sp. z o. o. Sp. k.", "INFOMAC-SP-Z-O-O-SP-K" },
-	{ 0x40D855, 0x0FC000, 0x0FCFFF, "eumig industrie-TV GmbH.", "EUMIG-INDUSTRIE-TV" },
-	{ 0x40D855, 0x0FD000, 0x0FDFFF, "MONOGRAM technologies ltd", "MONOGRAM-TECHNOLOGIES" },
-	{ 0x40D855, 0x0FE000, 0x0FEFFF, "Cytech Technology Pte Ltd", "CYTECH-PTE" },
-	{ 0x40D855, 0x0FF000, 0x0FFFFF, "YUYAMA MFG Co.,Ltd", "YUYAMA-MFG" },
-	{ 0x40D855, 0x100000, 0x100FFF, "TASK SISTEMAS DE COMPUTACAO S.A.", "TASK-SISTEMAS-DE-COMPUTACAO" },
-	{ 0x40D855, 0x101000, 0x101FFF, "e.p.g. Elettronica Srl", "E-P-G-ELETTRONICA-SRL" },
-	{ 0x40D855, 0x102000, 0x102FFF, "Power Electronics Espana, S.L.", "POWER-ELECTRONICS-ESPANA" },
-	{ 0x40D855, 0x103000, 0x103FFF, "Peek Traffic Corporation", "PEEK-TRAFFIC" },
-	{ 0x40D855, 0x104000, 0x104FFF, "IMPLE SISTEMAS ELETRONICOS EMBARCADOS LTDA", "IMPLE-SISTEMAS-ELETRONICOS-EMBARCADOS-LTDA" },
-	{ 0x40D855, 0x105000, 0x105FFF, "Tieline Research Pty Ltd", "TIELINE-RESEARCH-PTY" },
-	{ 0x40D855, 0x106000, 0x106FFF, "Orbital A/S", "ORBITAL-A/S" },
-	{ 0x40D855, 0x107000, 0x107FFF, "Smith Meter, Inc", "SMITH-METER" },
-	{ 0x40D855, 0x108000, 0x108FFF, "ALPHA DESIGN CO.,LTD.", "ALPHA-DESIGN" },
-	{ 0x40D855, 0x109000, 0x109FFF, "Rosslare Enterprises Limited", "ROSSLARE-ENTERPRISES" },
-	{ 0x40D855, 0x10A000, 0x10AFFF, "DAVIS DERBY LIMITED", "DAVIS-DERBY" },
-	{ 0x40D855, 0x10B000, 0x10BFFF, "So-Cool Corporation.", "SO-COOL" },
-	{ 0x40D855, 0x10C000, 0x10CFFF, "Contrans TI sp. z o.o.", "CONTRANS-TI-SP-Z-O-O" },
-	{ 0x40D855, 0x10D000, 0x10DFFF, "Rite-Tech Industrial Co., Ltd.", "RITE-TECH-INDUSTRIAL" },
-	{ 0x40D855, 0x10E000, 0x10EFFF, "HKS-Prozesstechnik GmbH", "HKS-PROZESSTECHNIK" },
-	{ 0x40D855, 0x10F000, 0x10FFFF, "CAVALRY STORAGE INC", "CAVALRY-STORAGE" },
-	{ 0x40D855, 0x110000, 0x110FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x40D855, 0x111000, 0x111FFF, "Grupo Epelsa S.L.", "GRUPO-EPELSA" },
-	{ 0x40D855, 0x112000, 0x112FFF, "Halliburton - Sperry Drilling Service", "HALLIBURTON-SPERRY-DRILLING-SERVICE" },
-	{ 0x40D855, 0x113000, 0x113FFF, "Testbook Ltd", "TESTBOOK" },
-	{ 0x40D855, 0x114000, 0x114FFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x40D855, 0x115000, 0x115FFF, "MESA Electronic GmbH", "MESA" },
-	{ 0x40D855, 0x116000, 0x116FFF, "Uniscan LLC", "UNISCAN" },
-	{ 0x40D855, 0x117000, 0x117FFF, "RCS Energy Management Limited", "RCS-ENERGY-MANAGEMENT" },
-	{ 0x40D855, 0x118000, 0x118FFF, "University of Nebraska -- Lincoln", "UNIVERSITY-OF-NEBRASKA-LINCOLN" },
-	{ 0x40D855, 0x119000, 0x119FFF, "OOO Group of Industrial Technologies", "OOO-GROUP-OF-INDUSTRIAL-TECHNOLOGIES" },
-	{ 0x40D855, 0x11A000, 0x11AFFF, "Sicon srl", "SICON-SRL" },
-	{ 0x40D855, 0x11B000, 0x11BFFF, "nanoTRONIC GmbH", "NANOTRONIC" },
-	{ 0x40D855, 0x11C000, 0x11CFFF, "DEUTA-WERKE GmbH", "DEUTA-WERKE" },
-	{ 0x40D855, 0x11D000, 0x11DFFF, "ACD Elektronik GmbH", "ACD-ELEKTRONIK" },
-	{ 0x40D855, 0x11E000, 0x11EFFF, "CEMSI, Inc.", "CEMSI" },
-	{ 0x40D855, 0x11F000, 0x11FFFF, "KOMPAN Pawel Sokolowski", "KOMPAN-PAWEL-SOKOLOWSKI" },
-	{ 0x40D855, 0x120000, 0x120FFF, "ObjectFab GmbH", "OBJECTFAB" },
-	{ 0x40D855, 0x121000, 0x121FFF, "shanghai Anjian Information technology co. , ltd.", "SHANGHAI-ANJIAN-INFORMATION" },
-	{ 0x40D855, 0x122000, 0x122FFF, "ATX Networks Ltd.", "ATX-NETWORKS" },
-	{ 0x40D855, 0x123000, 0x123FFF, "ZAO NPC  Kompjuternie Technologii", "ZAO-NPC-KOMPJUTERNIE-TECHNOLOGII" },
-	{ 0x40D855, 0x124000, 0x124FFF, "Debug s.r.l.", "DEBUG" },
-	{ 0x40D855, 0x125000, 0x125FFF, "Scandyna A/S", "SCANDYNA-A/S" },
-	{ 0x40D855, 0x126000, 0x126FFF, "TTI LTD", "TTI" },
-	{ 0x40D855, 0x127000, 0x127FFF, "LIGHTSTAR", "LIGHTSTAR" },
-	{ 0x40D855, 0x128000, 0x128FFF, "AKSE srl", "AKSE-SRL" },
-	{ 0x40D855, 0x129000, 0x129FFF, "DSP DESIGN", "DSP-DESIGN" },
-	{ 0x40D855, 0x12A000, 0x12AFFF, "Jadpod Communication Company Limited", "JADPOD-COMMUNICATION-COMPANY" },
-	{ 0x40D855, 0x12B000, 0x12BFFF, "Mango DSP, Inc.", "MANGO-DSP" },
-	{ 0x40D855, 0x12C000, 0x12CFFF, "NSP Europe Ltd", "NSP-EUROPE" },
-	{ 0x40D855, 0x12D000, 0x12DFFF, "Biotage Sweden AB", "BIOTAGE-SWEDEN-AB" },
-	{ 0x40D855, 0x12E000, 0x12EFFF, "Canfield Scientific, Inc.", "CANFIELD-SCIENTIFIC" },
-	{ 0x40D855, 0x12F000, 0x12FFFF, "Private", "PRIVATE" },
-	{ 0x40D855, 0x130000, 0x130FFF, "Televic Rail GmbH", "TELEVIC-RAIL" },
-	{ 0x40D855, 0x131000, 0x131FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x40D855, 0x132000, 0x132FFF, "AeroVision Avionics, Inc", "AEROVISION-AVIONICS" },
-	{ 0x40D855, 0x133000, 0x133FFF, "TATTILE SRL", "TATTILE-SRL" },
-	{ 0x40D855, 0x134000, 0x134FFF, "digitech GmbH &amp; Co. KG", "DIGITECH-AMP" },
-	{ 0x40D855, 0x135000, 0x135FFF, "GLOBALCOM ENGINEERING SRL", "GLOBALCOM-ENGINEERING-SRL" },
-	{ 0x40D855, 0x136000, 0x136FFF, "Devriecom B.V.", "DEVRIECOM-B-V" },
-	{ 0x40D855, 0x137000, 0x137FFF, "GDE Polska", "GDE-POLSKA" },
-	{ 0x40D855, 0x138000, 0x138FFF, "Calon Associates Limited", "CALON-ASSOCIATES" },
-	{ 0x40D855, 0x139000, 0x139FFF, "WOW System", "WOW-SYSTEM" },
-	{ 0x40D855, 0x13A000, 0x13AFFF, "Supplier Ind. e Com de Eletroeletrônicos", "SUPPLIER-IND-E-COM-DE-ELETROELETRNICOS" },
-	{ 0x40D855, 0x13B000, 0x13BFFF, "Davin Technologies Co.,Ltd", "DAVIN-TECHNOLOGIES" },
-	{ 0x40D855, 0x13C000, 0x13CFFF, "shanghai Anjian Information technology co. , ltd.", "SHANGHAI-ANJIAN-INFORMATION" },
-	{ 0x40D855, 0x13D000, 0x13DFFF, "Perm Scientific-Industrial Instrument Making Company JSC", "PERM-SCIENTIFIC-INDUSTRIAL-INSTRUMENT-MAKING-COMPANY-JSC" },
-	{ 0x40D855, 0x13E000, 0x13EFFF, "hanatech", "HANATECH" },
-	{ 0x40D855, 0x13F000, 0x13FFFF, "Zhejiang Wellsun Electric Meter Co.,Ltd", "ZHEJIANG-WELLSUN-ELECTRIC-METER" },
-	{ 0x40D855, 0x140000, 0x140FFF, "InnoTrans Communications, Inc", "INNOTRANS-COMMUNICATION" },
-	{ 0x40D855, 0x141000, 0x141FFF, "Key Systems, Inc.", "KEY" },
-	{ 0x40D855, 0x142000, 0x142FFF, "Tetracore, Inc.", "TETRACORE" },
-	{ 0x40D855, 0x143000, 0x143FFF, "Tokyo Drawing Ltd.", "TOKYO-DRAWING" },
-	{ 0x40D855, 0x144000, 0x144FFF, "Venco", "VENCO" },
-	{ 0x40D855, 0x145000, 0x145FFF, "Weber Marking Systems GmbH", "WEBER-MARKING" },
-	{ 0x40D855, 0x146000, 0x146FFF, "Pleiger Elektronik GmbH  and Co. KG", "PLEIGER-ELEKTRONIK" },
-	{ 0x40D855, 0x147000, 0x147FFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x40D855, 0x148000, 0x148FFF, "SEIKO TIME SYSTEMS INC.", "SEIKO-TIME" },
-	{ 0x40D855, 0x149000, 0x149FFF, "Engage Technologies", "ENGAGE-TECHNOLOGIES" },
-	{ 0x40D855, 0x14A000, 0x14AFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x40D855, 0x14B000, 0x14BFFF, "Vocality International Ltd", "VOCALITY" },
-	{ 0x40D855, 0x14C000, 0x14CFFF, "PLT", "PLT" },
-	{ 0x40D855, 0x14D000, 0x14DFFF, "SOMFY SAS", "SOMFY-SAS" },
-	{ 0x40D855, 0x14E000, 0x14EFFF, "Marposs S.p.A", "MARPOSS" },
-	{ 0x40D855, 0x14F000, 0x14FFFF, "TDS Software Solutions Pty Ltd", "TDS-SOFTWARE-SOLUTIONS-PTY" },
-	{ 0x40D855, 0x150000, 0x150FFF, "SHIKINO HIGH-TECH", "SHIKINO-HIGH-TECH" },
-	{ 0x40D855, 0x151000, 0x151FFF, "Progress Rail Services, Inspection and Information Systems", "PROGRESS-RAIL-SERVICES-INSPECTION-AND-INFORMATION" },
-	{ 0x40D855, 0x152000, 0x152FFF, "Home Automation Europe", "HOME-AUTOMATION-EUROPE" },
-	{ 0x40D855, 0x153000, 0x153FFF, "BlinkPipe Ltd", "BLINKPIPE" },
-	{ 0x40D855, 0x154000, 0x154FFF, "iart", "IART" },
-	{ 0x40D855, 0x155000, 0x155FFF, "Telefrang AB", "TELEFRANG-AB" },
-	{ 0x40D855, 0x156000, 0x156FFF, "Emphysys, Inc.", "EMPHYSYS" },
-	{ 0x40D855, 0x157000, 0x157FFF, "Hitachi Power Solutions Co., Ltd.", "HITACHI-POWER-SOLUTIONS" },
-	{ 0x40D855, 0x158000, 0x158FFF, "Exibea AB", "EXIBEA-AB" },
-	{ 0x40D855, 0x159000, 0x159FFF, "PLATINUM GmbH", "PLATINUM" },
-	{ 0x40D855, 0x15A000, 0x15AFFF, "DORLET SAU", "DORLET-SAU" },
-	{ 0x40D855, 0x15B000, 0x15BFFF, "SQF Spezialelektronik GmbH", "SQF-SPEZIALELEKTRONIK" },
-	{ 0x40D855, 0x15C000, 0x15CFFF, "Spectratech Inc.", "SPECTRATECH" },
-	{ 0x40D855, 0x15D000, 0x15DFFF, "Actronic Technologies", "ACTRONIC-TECHNOLOGIES" },
-	{ 0x40D855, 0x15E000, 0x15EFFF, "Prodco International Inc.", "PRODCO" },
-	{ 0x40D855, 0x15F000, 0x15FFFF, "CT Company", "CT-COMPANY" },
-	{ 0x40D855, 0x160000, 0x160FFF, "Thermo Fisher Sceintific", "THERMO-FISHER-SCEINTIFIC" },
-	{ 0x40D855, 0x161000, 0x161FFF, "Solidscape Inc", "SOLIDSCAPE" },
-	{ 0x40D855, 0x162000, 0x162FFF, "LUNA-NEXUS", "LUNA-NEXUS" },
-	{ 0x40D855, 0x163000, 0x163FFF, "KMtronic ltd", "KMTRONIC" },
-	{ 0x40D855, 0x164000, 0x164FFF, "NFT Automatisierungssysteme GmbH", "NFT-AUTOMATISIERUNGSSYSTEME" },
-	{ 0x40D855, 0x165000, 0x165FFF, "TECHBOARD SRL", "TECHBOARD-SRL" },
-	{ 0x40D855, 0x166000, 0x166FFF, "Anhui Jiante Network Technology Co., Ltd.", "ANHUI-JIANTE-NETWORK" },
-	{ 0x40D855, 0x167000, 0x167FFF, "Assembly Contracts Ltd", "ASSEMBLY-CONTRACTS" },
-	{ 0x40D855, 0x168000, 0x168FFF, "OPASCA Systems GmbH", "OPASCA" },
-	{ 0x40D855, 0x169000, 0x169FFF, "Photop Koncent", "PHOTOP-KONCENT" },
-	{ 0x40D855, 0x16A000, 0x16AFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x40D855, 0x16B000, 0x16BFFF, "TECHWAY", "TECHWAY" },
-	{ 0x40D855, 0x16C000, 0x16CFFF, "Private", "PRIVATE" },
-	{ 0x40D855, 0x16D000, 0x16DFFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x40D855, 0x16E000, 0x16EFFF, "Secuinfo Co.Ltd", "SECUINFO" },
-	{ 0x40D855, 0x16F000, 0x16FFFF, "BrightLeaf Power", "BRIGHTLEAF-POWER" },
-	{ 0x40D855, 0x170000, 0x170FFF, "ICS Eletronics", "ICS-ELETRONICS" },
-	{ 0x40D855, 0x171000, 0x171FFF, "Sicon srl", "SICON-SRL" },
-	{ 0x40D855, 0x172000, 0x172FFF, "YAWATA ELECTRIC INDUSTRIAL CO.,LTD.", "YAWATA-ELECTRIC-INDUSTRIAL" },
-	{ 0x40D855, 0x173000, 0x173FFF, "Contec Steuerungstechnik & Automation GmbH", "CONTEC-STEUERUNGSTECHNIK-AUTOMATION" },
-	{ 0x40D855, 0x174000, 0x174FFF, "EcoGuard AB", "ECOGUARD-AB" },
-	{ 0x40D855, 0x175000, 0x175FFF, "AHB Systeme GmbH", "AHB-SYSTEME" },
-	{ 0x40D855, 0x176000, 0x176FFF, "Schneider Electric Motion, Inc. USA", "SCHNEIDER-ELECTRIC-MOTION-USA" },
-	{ 0x40D855, 0x177000, 0x177FFF, "TRI Engineering co.,ltd.", "TRI-ENGINEERING" },
-	{ 0x40D855, 0x178000, 0x178FFF, "REDER Domotic GmbH", "REDER-DOMOTIC" },
-	{ 0x40D855, 0x179000, 0x179FFF, "Servo-Robot Inc.", "SERVO-ROBOT" },
-	{ 0x40D855, 0x17A000, 0x17AFFF, "ARGUS-SPECTRUM", "ARGUS-SPECTRUM" },
-	{ 0x40D855, 0x17B000, 0x17BFFF, "LUCEO", "LUCEO" },
-	{ 0x40D855, 0x17C000, 0x17CFFF, "Critical Link LLC", "CRITICAL-LINK" },
-	{ 0x40D855, 0x17D000, 0x17DFFF, "Kiwigrid GmbH", "KIWIGRID" },
-	{ 0x40D855, 0x17E000, 0x17EFFF, "TOKHATEC", "TOKHATEC" },
-	{ 0x40D855, 0x17F000, 0x17FFFF, "Telvent", "TELVENT" },
-	{ 0x40D855, 0x180000, 0x180FFF, "BroadSoft Inc", "BROADSOFT" },
-	{ 0x40D855, 0x181000, 0x181FFF, "eROCCA", "EROCCA" },
-	{ 0x40D855, 0x182000, 0x182FFF, "Georg Neumann GmbH", "GEORG-NEUMANN" },
-	{ 0x40D855, 0x183000, 0x183FFF, "EMAC, Inc.", "EMAC" },
-	{ 0x40D855, 0x184000, 0x184FFF, "Satkirit Ltd", "SATKIRIT" },
-	{ 0x40D855, 0x185000, 0x185FFF, "Standard Change Makers", "STANDARD-CHANGE-MAKERS" },
-	{ 0x40D855, 0x186000, 0x186FFF, "KST technology", "KST" },
-	{ 0x40D855, 0x187000, 0x187FFF, "CDEX Corp.", "CDEX" },
-	{ 0x40D855, 0x188000, 0x188FFF, "Array Corporation", "ARRAY" },
-	{ 0x40D855, 0x189000, 0x189FFF, "Yoozma Corporation", "YOOZMA" },
-	{ 0x40D855, 0x18A000, 0x18AFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x40D855, 0x18B000, 0x18BFFF, "Diagnosys Test Systems Ltd", "DIAGNOSYS-TEST" },
-	{ 0x40D855, 0x18C000, 0x18CFFF, "EOS S.r.l.", "EOS" },
-	{ 0x40D855, 0x18D000, 0x18DFFF, "Zoe Medical", "ZOE-MEDICAL" },
-	{ 0x40D855, 0x18E000, 0x18EFFF, "Kerun Visual Technology Co., Ltd.(Shenzhen)", "KERUN-VISUAL-SHENZHEN" },
-	{ 0x40D855, 0x18F000, 0x18FFFF, "Beat Sensing co. , ltd.", "BEAT-SENSING" },
-	{ 0x40D855, 0x190000, 0x190FFF, "Spider Tecnologia Ind. e Com Ltda", "SPIDER-TECNOLOGIA-IND-E-COM-LTDA" },
-	{ 0x40D855, 0x191000, 0x191FFF, "Soukai Electric", "SOUKAI-ELECTRIC" },
-	{ 0x40D855, 0x192000, 0x192FFF, "GD Mission Systems", "GD-MISSION" },
-	{ 0x40D855, 0x193000, 0x193FFF, "FORZA SILICON CORP.", "FORZA-SILICON" },
-	{ 0x40D855, 0x194000, 0x194FFF, "RF Code", "RF-CODE" },
-	{ 0x40D855, 0x195000, 0x195FFF, "TONNA ELECTRONIQUE", "TONNA-ELECTRONIQUE" },
-	{ 0x40D855, 0x196000, 0x196FFF, "Advanced Micro Controls Inc.", "ADVANCED-MICRO-CONTROLS" },
-	{ 0x40D855, 0x197000, 0x197FFF, "Berg Cloud Limited", "BERG-CLOUD" },
-	{ 0x40D855, 0x198000, 0x198FFF, "devboards GmbH", "DEVBOARDS" },
-	{ 0x40D855, 0x199000, 0x199FFF, "PRESSOL Schmiergeraete GmbH", "PRESSOL-SCHMIERGERAETE" },
-	{ 0x40D855, 0x19A000, 0x19AFFF, "Rohde&Schwarz Topex SA", "ROHDE-SCHWARZ-TOPEX" },
-	{ 0x40D855, 0x19B000, 0x19BFFF, "Northern Star Technologies", "NORTHERN-STAR-TECHNOLOGIES" },
-	{ 0x40D855, 0x19C000, 0x19CFFF, "Parris Service Corporation", "PARRIS-SERVICE" },
-	{ 0x40D855, 0x19D000, 0x19DFFF, "EMAC, Inc.", "EMAC" },
-	{ 0x40D855, 0x19E000, 0x19EFFF, "Thirdwayv Inc.", "THIRDWAYV" },
-	{ 0x40D855, 0x19F000, 0x19FFFF, "Patria Aviation Oy", "PATRIA-AVIATION-OY" },
-	{ 0x40D855, 0x1A0000, 0x1A0FFF, "Futaba Corporation", "FUTABA" },
-	{ 0x40D855, 0x1A1000, 0x1A1FFF, "KRONOTECH SRL", "KRONOTECH-SRL" },
-	{ 0x40D855, 0x1A2000, 0x1A2FFF, "HIPODROMO DE AGUA CALIENTE, S.A. DE C.V.", "HIPODROMO-DE-AGUA-CALIENTE-DE-C-V" },
-	{ 0x40D855, 0x1A3000, 0x1A3FFF, "Noritake Itron Corporation", "NORITAKE-ITRON" },
-	{ 0x40D855, 0x1A4000, 0x1A4FFF, "cibite AG", "CIBITE" },
-	{ 0x40D855, 0x1A5000, 0x1A5FFF, "DemoPad", "DEMOPAD" },
-	{ 0x40D855, 0x1A6000, 0x1A6FFF, "RB-LINK Wireless", "RB-LINK-WIRELESS" },
-	{ 0x40D855, 0x1A7000, 0x1A7FFF, "ENTEC Electric & Electronic CO., LTD", "ENTEC-ELECTRIC" },
-	{ 0x40D855, 0x1A8000, 0x1A8FFF, "Multiobrabotka", "MULTIOBRABOTKA" },
-	{ 0x40D855, 0x1A9000, 0x1A9FFF, "Lubino s.r.o.", "LUBINO-S-R-O" },
-	{ 0x40D855, 0x1AA000, 0x1AAFFF, "Broachlink Technology Co.,Limited", "BROACHLINK" },
-	{ 0x40D855, 0x1AB000, 0x1ABFFF, "Rosslare Enterprises Limited", "ROSSLARE-ENTERPRISES" },
-	{ 0x40D855, 0x1AC000, 0x1ACFFF, "Bucher Automation Budapest", "BUCHER-AUTOMATION-BUDAPEST" },
-	{ 0x40D855, 0x1AD000, 0x1ADFFF, "WICHER DIGITAL TECHNIK", "WICHER-DIGITAL-TECHNIK" },
-	{ 0x40D855, 0x1AE000, 0x1AEFFF, "Autonomous Solutions, Inc", "AUTONOMOUS-SOLUTIONS" },
-	{ 0x40D855, 0x1AF000, 0x1AFFFF, "Vigitron Inc.", "VIGITRON" },
-	{ 0x40D855, 0x1B0000, 0x1B0FFF, "Shin-ei Electronic Measuring Co.,Ltd.", "SHIN-EI-MEASURING" },
-	{ 0x40D855, 0x1B1000, 0x1B1FFF, "Logos 01 S.r.l.", "LOGOS-01" },
-	{ 0x40D855, 0x1B2000, 0x1B2FFF, "AGE A. Gilg Elektronik", "AGE-A-GILG-ELEKTRONIK" },
-	{ 0x40D855, 0x1B3000, 0x1B3FFF, "BETTINI SRL", "BETTINI-SRL" },
-	{ 0x40D855, 0x1B4000, 0x1B4FFF, "Inforce Computing Inc.", "INFORCE-COMPUTING" },
-	{ 0x40D855, 0x1B5000, 0x1B5FFF, "A+EC Klein Ingenieurbuero", "A+EC-KLEIN-INGENIEURBUERO" },
-	{ 0x40D855, 0x1B6000, 0x1B6FFF, "Magic Systems", "MAGIC" },
-	{ 0x40D855, 0x1B7000, 0x1B7FFF, "TEWS Elektronik GmbH & Co. KG", "TEWS-ELEKTRONIK" },
-	{ 0x40D855, 0x1B8000, 0x1B8FFF, "Orion Systems, Inc", "ORION" },
-	{ 0x40D855, 0x1B9000, 0x1B9FFF, "Beking Industrieele automatisering", "BEKING-INDUSTRIEELE-AUTOMATISERING" },
-	{ 0x40D855, 0x1BA000, 0x1BAFFF, "Creative Lighting And Sound Systems Pty Ltd", "CREATIVE-LIGHTING-AND-SOUND-PTY" },
-	{ 0x40D855, 0x1BB000, 0x1BBFFF, "Micromega Dynamics SA", "MICROMEGA-DYNAMICS" },
-	{ 0x40D855, 0x1BC000, 0x1BCFFF, "KbDevice,Inc.", "KBDEVICE" },
-	{ 0x40D855, 0x1BD000, 0x1BDFFF, "HORIBA ABX SAS", "HORIBA-ABX-SAS" },
-	{ 0x40D855, 0x1BE000, 0x1BEFFF, "Peek Traffic", "PEEK-TRAFFIC" },
-	{ 0x40D855, 0x1BF000, 0x1BFFFF, "shanghai mingding information tech co.Ltd", "SHANGHAI-MINGDING-INFORMATION-TECH" },
-	{ 0x40D855, 0x1C0000, 0x1C0FFF, "NPB Automation AB", "NPB-AUTOMATION-AB" },
-	{ 0x40D855, 0x1C1000, 0x1C1FFF, "Triamec Motion AG", "TRIAMEC-MOTION" },
-	{ 0x40D855, 0x1C2000, 0x1C2FFF, "Digital Display Systems", "DIGITAL-DISPLAY" },
-	{ 0x40D855, 0x1C3000, 0x1C3FFF, "Cornfed Systems LLC", "CORNFED" },
-	{ 0x40D855, 0x1C4000, 0x1C4FFF, "QED Advanced Systems Limited", "QED-ADVANCED" },
-	{ 0x40D855, 0x1C5000, 0x1C5FFF, "Private", "PRIVATE" },
-	{ 0x40D855, 0x1C6000, 0x1C6FFF, "Device Solutions Ltd", "DEVICE-SOLUTIONS" },
-	{ 0x40D855, 0x1C7000, 0x1C7FFF, "Wexiodisk AB", "WEXIODISK-AB" },
-	{ 0x40D855, 0x1C8000, 0x1C8FFF, "Sensata Technologies", "SENSATA-TECHNOLOGIES" },
-	{ 0x40D855, 0x1C9000, 0x1C9FFF, "Andy-L Ltd.", "ANDY-L" },
-	{ 0x40D855, 0x1CA000, 0x1CAFFF, "Rigel Engineering", "RIGEL-ENGINEERING" },
-	{ 0x40D855, 0x1CB000, 0x1CBFFF, "MG s.r.l.", "MG" },
-	{ 0x40D855, 0x1CC000, 0x1CCFFF, "NKT Photonics A/S", "NKT-PHOTONICS-A/S" },
-	{ 0x40D855, 0x1CD000, 0x1CDFFF, "YXLON International A/S", "YXLON-A/S" },
-	{ 0x40D855, 0x1CE000, 0x1CEFFF, "Peter Huber Kaeltemaschinenbau SE", "PETER-HUBER-KAELTEMASCHINENBAU-SE" },
-	{ 0x40D855, 0x1CF000, 0x1CFFFF, "Omnik New Energy Co., Ltd", "OMNIK-NEW-ENERGY" },
-	{ 0x40D855, 0x1D0000, 0x1D0FFF, "Webeasy BV", "WEBEASY" },
-	{ 0x40D855, 0x1D1000, 0x1D1FFF, "Founder Broadband Network Service Co.,Ltd.", "FOUNDER-BROADBAND-NETWORK-SERVICE" },
-	{ 0x40D855, 0x1D2000, 0x1D2FFF, "InventLab s.c.", "INVENTLAB-S-C" },
-	{ 0x40D855, 0x1D3000, 0x1D3FFF, "Kaluga Teletypes Manufacturing Plant", "KALUGA-TELETYPES-MANUFACTURING-PLANT" },
-	{ 0x40D855, 0x1D4000, 0x1D4FFF, "Prisma Engineering srl", "PRISMA-ENGINEERING-SRL" },
-	{ 0x40D855, 0x1D5000, 0x1D5FFF, "FST21 Ltd.", "FST21" },
-	{ 0x40D855, 0x1D6000, 0x1D6FFF, "EMS Computers Pty Ltd", "EMS-COMPUTERS-PTY" },
-	{ 0x40D855, 0x1D7000, 0x1D7FFF, "Wheatstone Corporation", "WHEATSTONE" },
-	{ 0x40D855, 0x1D8000, 0x1D8FFF, "Owl Cyber Defense Solutions, LLC", "OWL-CYBER-DEFENSE-SOLUTIONS" },
-	{ 0x40D855, 0x1D9000, 0x1D9FFF, "Commercial Wireless Systems International LLC.", "COMMERCIAL-WIRELESS" },
-	{ 0x40D855, 0x1DA000, 0x1DAFFF, "Energy Technology and Control Ltd.", "ENERGY-AND-CONTROL" },
-	{ 0x40D855, 0x1DB000, 0x1DBFFF, "NIPPON TECHNO LAB.,INC,", "NIPPON-TECHNO-LAB" },
-	{ 0x40D855, 0x1DC000, 0x1DCFFF, "Aplex Technology Inc.", "APLEX" },
-	{ 0x40D855, 0x1DD000, 0x1DDFFF, "BaOpt Benelux bv", "BAOPT-BENELUX" },
-	{ 0x40D855, 0x1DE000, 0x1DEFFF, "Vidisys GmbH", "VIDISYS" },
-	{ 0x40D855, 0x1DF000, 0x1DFFFF, "Chengdu Meihuan Technology Co., Ltd", "CHENGDU-MEIHUAN" },
-	{ 0x40D855, 0x1E0000, 0x1E0FFF, "Embedded Technology Corporation", "EMBEDDED" },
-	{ 0x40D855, 0x1E1000, 0x1E1FFF, "AD QUALITE", "AD-QUALITE" },
-	{ 0x40D855, 0x1E2000, 0x1E2FFF, "ELNEC s.r.o.", "ELNEC-S-R-O" },
-	{ 0x40D855, 0x1E3000, 0x1E3FFF, "Mega Electronics Ltd", "MEGA-ELECTRONICS" },
-	{ 0x40D855, 0x1E4000, 0x1E4FFF, "STEK Ltd", "STEK" },
-	{ 0x40D855, 0x50D000, 0x50DFFF, "Shenzhen MaiWei Cable TV Equipment CO.,LTD.", "SHENZHEN-MAIWEI-CABLE-TV-EQUIPMENT" },
-	{ 0x40D855, 0xEE6000, 0xEE6FFF, "Narinet, Inc.", "NARINET" },
+	{ 0x0050C2, 0x000000, 0x000FFF, 0, 13 },
+	{ 0x0050C2, 0x001000, 0x001FFF, 19, 39 },
+	{ 0x0050C2, 0x002000, 0x002FFF, 59, 91 },
+	{ 0x0050C2, 0x003000, 0x003FFF, 123, 133 },
+	{ 0x0050C2, 0x004000, 0x004FFF, 143, 163 },
+	{ 0x0050C2, 0x005000, 0x005FFF, 167, 187 },
+	{ 0x0050C2, 0x006000, 0x006FFF, 201, 238 },
+	{ 0x0050C2, 0x007000, 0x007FFF, 269, 292 },
+	{ 0x0050C2, 0x008000, 0x008FFF, 304, 321 },
+	{ 0x0050C2, 0x009000, 0x009FFF, 338, 356 },
+	{ 0x0050C2, 0x00A000, 0x00AFFF, 369, 377 },
+	{ 0x0050C2, 0x00B000, 0x00BFFF, 385, 396 },
+	{ 0x0050C2, 0x00C000, 0x00CFFF, 399, 419 },
+	{ 0x0050C2, 0x00D000, 0x00DFFF, 426, 444 },
+	{ 0x0050C2, 0x00E000, 0x00EFFF, 457, 464 },
+	{ 0x0050C2, 0x00F000, 0x00FFFF, 471, 477 },
+	{ 0x0050C2, 0x010000, 0x010FFF, 483, 500 },
+	{ 0x0050C2, 0x011000, 0x011FFF, 509, 531 },
+	{ 0x0050C2, 0x012000, 0x012FFF, 548, 578 },
+	{ 0x0050C2, 0x013000, 0x013FFF, 603, 628 },
+	{ 0x0050C2, 0x014000, 0x014FFF, 648, 656 },
+	{ 0x0050C2, 0x015000, 0x015FFF, 662, 679 },
+	{ 0x0050C2, 0x016000, 0x016FFF, 696, 712 },
+	{ 0x0050C2, 0x017000, 0x017FFF, 723, 746 },
+	{ 0x0050C2, 0x018000, 0x018FFF, 753, 765 },
+	{ 0x0050C2, 0x019000, 0x019FFF, 772, 795 },
+	{ 0x0050C2, 0x01A000, 0x01AFFF, 801, 815 },
+	{ 0x0050C2, 0x01B000, 0x01BFFF, 829, 849 },
+	{ 0x0050C2, 0x01C000, 0x01CFFF, 864, 879 },
+	{ 0x0050C2, 0x01D000, 0x01DFFF, 894, 915 },
+	{ 0x0050C2, 0x01E000, 0x01EFFF, 936, 967 },
+	{ 0x0050C2, 0x01F000, 0x01FFFF, 976, 1005 },
+	{ 0x0050C2, 0x020000, 0x020FFF, 1029, 1048 },
+	{ 0x0050C2, 0x021000, 0x021FFF, 1062, 1090 },
+	{ 0x0050C2, 0x022000, 0x022FFF, 1114, 1140 },
+	{ 0x0050C2, 0x023000, 0x023FFF, 1161, 1175 },
+	{ 0x0050C2, 0x024000, 0x024FFF, 1183, 1183 },
+	{ 0x0050C2, 0x025000, 0x025FFF, 1190, 1213 },
+	{ 0x0050C2, 0x026000, 0x026FFF, 1232, 1253 },
+	{ 0x0050C2, 0x027000, 0x027FFF, 1260, 1285 },
+	{ 0x0050C2, 0x028000, 0x028FFF, 1310, 1345 },
+	{ 0x0050C2, 0x029000, 0x029FFF, 1361, 1386 },
+	{ 0x0050C2, 0x02A000, 0x02AFFF, 1408, 1425 },
+	{ 0x0050C2, 0x02B000, 0x02BFFF, 1436, 1458 },
+	{ 0x0050C2, 0x02C000, 0x02CFFF, 1475, 1505 },
+	{ 0x0050C2, 0x02D000, 0x02DFFF, 1535, 1547 },
+	{ 0x0050C2, 0x02E000, 0x02EFFF, 1555, 1576 },
+	{ 0x0050C2, 0x02F000, 0x02FFFF, 1592, 1606 },
+	{ 0x0050C2, 0x030000, 0x030FFF, 1615, 1662 },
+	{ 0x0050C2, 0x031000, 0x031FFF, 1701, 1715 },
+	{ 0x0050C2, 0x032000, 0x032FFF, 1725, 1734 },
+	{ 0x0050C2, 0x033000, 0x033FFF, 1743, 1761 },
+	{ 0x0050C2, 0x034000, 0x034FFF, 1779, 1804 },
+	{ 0x0050C2, 0x035000, 0x035FFF, 1822, 1848 },
+	{ 0x0050C2, 0x036000, 0x036FFF, 1868, 1891 },
+	{ 0x0050C2, 0x037000, 0x037FFF, 1909, 1918 },
+	{ 0x0050C2, 0x038000, 0x038FFF, 1926, 1947 },
+	{ 0x0050C2, 0x039000, 0x039FFF, 1968, 1985 },
+	{ 0x0050C2, 0x03A000, 0x03AFFF, 1997, 2018 },
+	{ 0x0050C2, 0x03B000, 0x03BFFF, 2039, 2059 },
+	{ 0x0050C2, 0x03C000, 0x03CFFF, 2076, 2091 },
+	{ 0x0050C2, 0x03D000, 0x03DFFF, 2102, 2129 },
+	{ 0x0050C2, 0x03E000, 0x03EFFF, 2142, 2153 },
+	{ 0x0050C2, 0x03F000, 0x03FFFF, 2160, 2173 },
+	{ 0x0050C2, 0x040000, 0x040FFF, 2181, 2197 },
+	{ 0x0050C2, 0x041000, 0x041FFF, 2203, 2243 },
+	{ 0x0050C2, 0x042000, 0x042FFF, 2281, 2323 },
+	{ 0x0050C2, 0x043000, 0x043FFF, 2357, 2370 },
+	{ 0x0050C2, 0x044000, 0x044FFF, 2377, 2385 },
+	{ 0x0050C2, 0x045000, 0x045FFF, 2393, 2414 },
+	{ 0x0050C2, 0x046000, 0x046FFF, 2377, 2385 },
+	{ 0x0050C2, 0x047000, 0x047FFF, 2435, 2453 },
+	{ 0x0050C2, 0x048000, 0x048FFF, 2469, 2483 },
+	{ 0x0050C2, 0x049000, 0x049FFF, 2492, 2515 },
+	{ 0x0050C2, 0x04A000, 0x04AFFF, 2524, 2553 },
+	{ 0x0050C2, 0x04B000, 0x04BFFF, 2573, 2603 },
+	{ 0x0050C2, 0x04C000, 0x04CFFF, 2625, 2653 },
+	{ 0x0050C2, 0x04E000, 0x04EFFF, 2681, 2719 },
+	{ 0x0050C2, 0x04F000, 0x04FFFF, 2740, 2757 },
+	{ 0x0050C2, 0x050000, 0x050FFF, 2762, 2778 },
+	{ 0x0050C2, 0x051000, 0x051FFF, 2788, 2804 },
+	{ 0x0050C2, 0x052000, 0x052FFF, 2820, 2836 },
+	{ 0x0050C2, 0x054000, 0x054FFF, 2852, 2872 },
+	{ 0x0050C2, 0x055000, 0x055FFF, 2884, 2914 },
+	{ 0x0050C2, 0x056000, 0x056FFF, 2938, 2945 },
+	{ 0x0050C2, 0x057000, 0x057FFF, 2952, 2964 },
+	{ 0x0050C2, 0x058000, 0x058FFF, 2971, 2993 },
+	{ 0x0050C2, 0x059000, 0x059FFF, 3009, 3047 },
+	{ 0x0050C2, 0x05A000, 0x05AFFF, 3076, 3088 },
+	{ 0x0050C2, 0x05B000, 0x05BFFF, 3096, 3119 },
+	{ 0x0050C2, 0x05C000, 0x05CFFF, 3142, 3167 },
+	{ 0x0050C2, 0x05D000, 0x05DFFF, 3190, 3218 },
+	{ 0x0050C2, 0x05E000, 0x05EFFF, 3240, 3253 },
+	{ 0x0050C2, 0x05F000, 0x05FFFF, 3258, 3281 },
+	{ 0x0050C2, 0x060000, 0x060FFF, 2377, 2385 },
+	{ 0x0050C2, 0x061000, 0x061FFF, 3300, 3333 },
+	{ 0x0050C2, 0x062000, 0x062FFF, 2377, 2385 },
+	{ 0x0050C2, 0x063000, 0x063FFF, 3354, 3372 },
+	{ 0x0050C2, 0x064000, 0x064FFF, 2377, 2385 },
+	{ 0x0050C2, 0x065000, 0x065FFF, 3385, 3400 },
+	{ 0x0050C2, 0x066000, 0x066FFF, 2377, 2385 },
+	{ 0x0050C2, 0x067000, 0x067FFF, 3415, 3441 },
+	{ 0x0050C2, 0x068000, 0x068FFF, 3461, 3471 },
+	{ 0x0050C2, 0x069000, 0x069FFF, 3481, 3503 },
+	{ 0x0050C2, 0x06A000, 0x06AFFF, 3518, 3526 },
+	{ 0x0050C2, 0x06B000, 0x06BFFF, 3534, 3552 },
+	{ 0x0050C2, 0x06C000, 0x06CFFF, 3558, 3584 },
+	{ 0x0050C2, 0x06D000, 0x06DFFF, 3604, 3626 },
+	{ 0x0050C2, 0x06E000, 0x06EFFF, 3642, 3668 },
+	{ 0x0050C2, 0x06F000, 0x06FFFF, 3689, 3712 },
+	{ 0x0050C2, 0x070000, 0x070FFF, 3735, 3763 },
+	{ 0x0050C2, 0x071000, 0x071FFF, 3791, 3809 },
+	{ 0x0050C2, 0x072000, 0x072FFF, 3827, 3867 },
+	{ 0x0050C2, 0x073000, 0x073FFF, 3896, 3919 },
+	{ 0x0050C2, 0x074000, 0x074FFF, 3937, 3957 },
+	{ 0x0050C2, 0x075000, 0x075FFF, 3967, 3983 },
+	{ 0x0050C2, 0x076000, 0x076FFF, 3994, 4028 },
+	{ 0x0050C2, 0x077000, 0x077FFF, 4052, 4074 },
+	{ 0x0050C2, 0x078000, 0x078FFF, 4091, 4102 },
+	{ 0x0050C2, 0x079000, 0x079FFF, 4110, 4124 },
+	{ 0x0050C2, 0x07A000, 0x07AFFF, 4132, 4141 },
+	{ 0x0050C2, 0x07B000, 0x07BFFF, 4150, 4175 },
+	{ 0x0050C2, 0x07C000, 0x07CFFF, 4195, 2018 },
+	{ 0x0050C2, 0x07D000, 0x07DFFF, 4216, 4233 },
+	{ 0x0050C2, 0x07E000, 0x07EFFF, 4250, 4260 },
+	{ 0x0050C2, 0x07F000, 0x07FFFF, 4270, 4288 },
+	{ 0x0050C2, 0x080000, 0x080FFF, 4294, 4294 },
+	{ 0x0050C2, 0x081000, 0x081FFF, 4298, 4325 },
+	{ 0x0050C2, 0x082000, 0x082FFF, 4347, 4363 },
+	{ 0x0050C2, 0x083000, 0x083FFF, 4379, 4386 },
+	{ 0x0050C2, 0x084000, 0x084FFF, 4390, 4422 },
+	{ 0x0050C2, 0x085000, 0x085FFF, 4449, 4467 },
+	{ 0x0050C2, 0x086000, 0x086FFF, 4477, 4504 },
+	{ 0x0050C2, 0x087000, 0x087FFF, 4525, 4556 },
+	{ 0x0050C2, 0x088000, 0x088FFF, 4582, 4601 },
+	{ 0x0050C2, 0x089000, 0x089FFF, 4608, 4629 },
+	{ 0x0050C2, 0x08A000, 0x08AFFF, 4643, 4668 },
+	{ 0x0050C2, 0x08B000, 0x08BFFF, 4693, 4708 },
+	{ 0x0050C2, 0x08C000, 0x08CFFF, 4718, 4727 },
+	{ 0x0050C2, 0x08D000, 0x08DFFF, 4736, 4764 },
+	{ 0x0050C2, 0x08E000, 0x08EFFF, 4785, 4785 },
+	{ 0x0050C2, 0x08F000, 0x08FFFF, 4793, 4822 },
+	{ 0x0050C2, 0x090000, 0x090FFF, 4851, 4885 },
+	{ 0x0050C2, 0x091000, 0x091FFF, 4911, 4927 },
+	{ 0x0050C2, 0x092000, 0x092FFF, 4937, 4961 },
+	{ 0x0050C2, 0x093000, 0x093FFF, 4976, 4976 },
+	{ 0x0050C2, 0x094000, 0x094FFF, 4986, 5020 },
+	{ 0x0050C2, 0x095000, 0x095FFF, 5048, 5048 },
+	{ 0x0050C2, 0x096000, 0x096FFF, 5056, 5088 },
+	{ 0x0050C2, 0x097000, 0x097FFF, 5120, 5137 },
+	{ 0x0050C2, 0x098000, 0x098FFF, 5154, 5176 },
+	{ 0x0050C2, 0x099000, 0x099FFF, 5192, 5226 },
+	{ 0x0050C2, 0x09A000, 0x09AFFF, 5257, 5306 },
+	{ 0x0050C2, 0x09B000, 0x09BFFF, 5346, 5367 },
+	{ 0x0050C2, 0x09C000, 0x09CFFF, 5388, 5410 },
+	{ 0x0050C2, 0x09D000, 0x09DFFF, 5426, 5426 },
+	{ 0x0050C2, 0x09E000, 0x09EFFF, 5433, 5458 },
+	{ 0x0050C2, 0x09F000, 0x09FFFF, 5477, 5500 },
+	{ 0x0050C2, 0x0A0000, 0x0A0FFF, 5515, 5515 },
+	{ 0x0050C2, 0x0A1000, 0x0A1FFF, 5522, 5545 },
+	{ 0x0050C2, 0x0A2000, 0x0A2FFF, 5562, 5606 },
+	{ 0x0050C2, 0x0A3000, 0x0A3FFF, 5644, 5657 },
+	{ 0x0050C2, 0x0A4000, 0x0A4FFF, 5665, 5689 },
+	{ 0x0050C2, 0x0A5000, 0x0A5FFF, 5700, 5719 },
+	{ 0x0050C2, 0x0A6000, 0x0A6FFF, 5733, 5753 },
+	{ 0x0050C2, 0x0A7000, 0x0A7FFF, 5759, 5778 },
+	{ 0x0050C2, 0x0A8000, 0x0A8FFF, 5797, 5813 },
+	{ 0x0050C2, 0x0A9000, 0x0A9FFF, 5829, 5850 },
+	{ 0x0050C2, 0x0AA000, 0x0AAFFF, 5871, 5884 },
+	{ 0x0050C2, 0x0AB000, 0x0ABFFF, 5891, 5909 },
+	{ 0x0050C2, 0x0AC000, 0x0ACFFF, 5922, 5936 },
+	{ 0x0050C2, 0x0AD000, 0x0ADFFF, 5950, 5971 },
+	{ 0x0050C2, 0x0AE000, 0x0AEFFF, 5987, 6007 },
+	{ 0x0050C2, 0x0AF000, 0x0AFFFF, 6013, 6036 },
+	{ 0x0050C2, 0x0B0000, 0x0B0FFF, 6053, 6070 },
+	{ 0x0050C2, 0x0B1000, 0x0B1FFF, 6087, 6110 },
+	{ 0x0050C2, 0x0B2000, 0x0B2FFF, 6127, 6145 },
+	{ 0x0050C2, 0x0B3000, 0x0B3FFF, 6163, 6179 },
+	{ 0x0050C2, 0x0B4000, 0x0B4FFF, 6183, 6203 },
+	{ 0x0050C2, 0x0B5000, 0x0B5FFF, 6211, 6233 },
+	{ 0x0050C2, 0x0B6000, 0x0B6FFF, 6248, 6285 },
+	{ 0x0050C2, 0x0B7000, 0x0B7FFF, 6314, 6314 },
+	{ 0x0050C2, 0x0B8000, 0x0B8FFF, 6320, 6339 },
+	{ 0x0050C2, 0x0B9000, 0x0B9FFF, 6352, 6382 },
+	{ 0x0050C2, 0x0BA000, 0x0BAFFF, 6407, 6418 },
+	{ 0x0050C2, 0x0BB000, 0x0BBFFF, 6429, 6440 },
+	{ 0x0050C2, 0x0BC000, 0x0BCFFF, 6446, 6467 },
+	{ 0x0050C2, 0x0BD000, 0x0BDFFF, 6485, 6493 },
+	{ 0x0050C2, 0x0BE000, 0x0BEFFF, 6501, 6530 },
+	{ 0x0050C2, 0x0BF000, 0x0BFFFF, 2377, 2385 },
+	{ 0x0050C2, 0x0C0000, 0x0C0FFF, 6557, 6569 },
+	{ 0x0050C2, 0x0C1000, 0x0C1FFF, 6576, 6585 },
+	{ 0x0050C2, 0x0C2000, 0x0C2FFF, 6594, 6622 },
+	{ 0x0050C2, 0x0C3000, 0x0C3FFF, 6644, 6656 },
+	{ 0x0050C2, 0x0C4000, 0x0C4FFF, 6662, 6689 },
+	{ 0x0050C2, 0x0C5000, 0x0C5FFF, 6700, 6725 },
+	{ 0x0050C2, 0x0C6000, 0x0C6FFF, 6747, 6795 },
+	{ 0x0050C2, 0x0C7000, 0x0C7FFF, 6837, 6871 },
+	{ 0x0050C2, 0x0C8000, 0x0C8FFF, 6888, 6906 },
+	{ 0x0050C2, 0x0C9000, 0x0C9FFF, 6924, 6943 },
+	{ 0x0050C2, 0x0CA000, 0x0CAFFF, 6956, 6969 },
+	{ 0x0050C2, 0x0CB000, 0x0CBFFF, 6982, 6982 },
+	{ 0x0050C2, 0x0CC000, 0x0CCFFF, 6990, 7010 },
+	{ 0x0050C2, 0x0CD000, 0x0CDFFF, 7021, 7030 },
+	{ 0x0050C2, 0x0CE000, 0x0CEFFF, 7039, 7061 },
+	{ 0x0050C2, 0x0CF000, 0x0CFFFF, 7077, 7077 },
+	{ 0x0050C2, 0x0D0000, 0x0D0FFF, 7082, 7095 },
+	{ 0x0050C2, 0x0D1000, 0x0D1FFF, 7108, 7137 },
+	{ 0x0050C2, 0x0D2000, 0x0D2FFF, 7160, 7193 },
+	{ 0x0050C2, 0x0D3000, 0x0D3FFF, 7226, 7248 },
+	{ 0x0050C2, 0x0D4000, 0x0D4FFF, 7253, 7264 },
+	{ 0x0050C2, 0x0D5000, 0x0D5FFF, 7269, 7275 },
+	{ 0x0050C2, 0x0D6000, 0x0D6FFF, 7281, 7299 },
+	{ 0x0050C2, 0x0D7000, 0x0D7FFF, 7312, 7334 },
+	{ 0x0050C2, 0x0D8000, 0x0D8FFF, 7350, 7375 },
+	{ 0x0050C2, 0x0D9000, 0x0D9FFF, 7400, 7416 },
+	{ 0x0050C2, 0x0DA000, 0x0DAFFF, 7427, 7449 },
+	{ 0x0050C2, 0x0DB000, 0x0DBFFF, 7465, 7473 },
+	{ 0x0050C2, 0x0DC000, 0x0DCFFF, 7481, 7500 },
+	{ 0x0050C2, 0x0DD000, 0x0DDFFF, 7506, 7533 },
+	{ 0x0050C2, 0x0DE000, 0x0DEFFF, 7554, 7576 },
+	{ 0x0050C2, 0x0DF000, 0x0DFFFF, 7598, 7625 },
+	{ 0x0050C2, 0x0E0000, 0x0E0FFF, 7646, 7657 },
+	{ 0x0050C2, 0x0E1000, 0x0E1FFF, 7662, 7689 },
+	{ 0x0050C2, 0x0E2000, 0x0E2FFF, 7705, 7727 },
+	{ 0x0050C2, 0x0E3000, 0x0E3FFF, 7743, 7754 },
+	{ 0x0050C2, 0x0E4000, 0x0E4FFF, 7760, 7783 },
+	{ 0x0050C2, 0x0E5000, 0x0E5FFF, 7795, 7815 },
+	{ 0x0050C2, 0x0E6000, 0x0E6FFF, 7835, 7851 },
+	{ 0x0050C2, 0x0E7000, 0x0E7FFF, 7861, 7887 },
+	{ 0x0050C2, 0x0E8000, 0x0E8FFF, 7907, 7937 },
+	{ 0x0050C2, 0x0E9000, 0x0E9FFF, 7961, 7976 },
+	{ 0x0050C2, 0x0EA000, 0x0EAFFF, 7987, 8006 },
+	{ 0x0050C2, 0x0EB000, 0x0EBFFF, 8013, 8035 },
+	{ 0x0050C2, 0x0EC000, 0x0ECFFF, 8053, 8071 },
+	{ 0x0050C2, 0x0ED000, 0x0EDFFF, 8082, 8110 },
+	{ 0x0050C2, 0x0EE000, 0x0EEFFF, 8126, 8160 },
+	{ 0x0050C2, 0x0EF000, 0x0EFFFF, 8180, 8201 },
+	{ 0x0050C2, 0x0F0000, 0x0F0FFF, 8216, 8239 },
+	{ 0x0050C2, 0x0F1000, 0x0F1FFF, 8256, 8271 },
+	{ 0x0050C2, 0x0F2000, 0x0F2FFF, 8281, 8299 },
+	{ 0x0050C2, 0x0F3000, 0x0F3FFF, 8303, 8328 },
+	{ 0x0050C2, 0x0F4000, 0x0F4FFF, 8334, 8351 },
+	{ 0x0050C2, 0x0F5000, 0x0F5FFF, 8358, 8397 },
+	{ 0x0050C2, 0x0F6000, 0x0F6FFF, 8426, 8456 },
+	{ 0x0050C2, 0x0F7000, 0x0F7FFF, 8481, 8503 },
+	{ 0x0050C2, 0x0F8000, 0x0F8FFF, 8519, 8535 },
+	{ 0x0050C2, 0x0F9000, 0x0F9FFF, 8551, 8573 },
+	{ 0x0050C2, 0x0FA000, 0x0FAFFF, 8590, 8616 },
+	{ 0x0050C2, 0x0FB000, 0x0FBFFF, 8634, 8651 },
+	{ 0x0050C2, 0x0FC000, 0x0FCFFF, 8658, 8689 },
+	{ 0x0050C2, 0x0FD000, 0x0FDFFF, 8710, 8731 },
+	{ 0x0050C2, 0x0FE000, 0x0FEFFF, 8740, 8751 },
+	{ 0x0050C2, 0x0FF000, 0x0FFFFF, 8762, 8780 },
+	{ 0x0050C2, 0x100000, 0x100FFF, 8786, 8801 },
+	{ 0x0050C2, 0x101000, 0x101FFF, 8815, 8841 },
+	{ 0x0050C2, 0x102000, 0x102FFF, 8856, 8886 },
+	{ 0x0050C2, 0x103000, 0x103FFF, 8911, 8938 },
+	{ 0x0050C2, 0x104000, 0x104FFF, 8959, 8972 },
+	{ 0x0050C2, 0x105000, 0x105FFF, 8980, 8992 },
+	{ 0x0050C2, 0x106000, 0x106FFF, 9004, 9004 },
+	{ 0x0050C2, 0x107000, 0x107FFF, 9013, 9028 },
+	{ 0x0050C2, 0x108000, 0x108FFF, 9035, 9047 },
+	{ 0x0050C2, 0x109000, 0x109FFF, 9054, 9074 },
+	{ 0x0050C2, 0x10A000, 0x10AFFF, 9088, 9097 },
+	{ 0x0050C2, 0x10B000, 0x10BFFF, 9103, 9119 },
+	{ 0x0050C2, 0x10C000, 0x10CFFF, 9130, 9153 },
+	{ 0x0050C2, 0x10D000, 0x10DFFF, 9170, 9186 },
+	{ 0x0050C2, 0x10E000, 0x10EFFF, 9197, 9209 },
+	{ 0x0050C2, 0x10F000, 0x10FFFF, 9221, 9238 },
+	{ 0x0050C2, 0x110000, 0x110FFF, 9249, 9257 },
+	{ 0x0050C2, 0x111000, 0x111FFF, 9265, 9281 },
+	{ 0x0050C2, 0x112000, 0x112FFF, 9289, 9299 },
+	{ 0x0050C2, 0x113000, 0x113FFF, 9309, 9331 },
+	{ 0x0050C2, 0x114000, 0x114FFF, 9347, 9365 },
+	{ 0x0050C2, 0x115000, 0x115FFF, 9383, 9395 },
+	{ 0x0050C2, 0x116000, 0x116FFF, 9401, 712 },
+	{ 0x0050C2, 0x117000, 0x117FFF, 9418, 9432 },
+	{ 0x0050C2, 0x118000, 0x118FFF, 9441, 9457 },
+	{ 0x0050C2, 0x119000, 0x119FFF, 9473, 9510 },
+	{ 0x0050C2, 0x11A000, 0x11AFFF, 9541, 9566 },
+	{ 0x0050C2, 0x11B000, 0x11BFFF, 9586, 9604 },
+	{ 0x0050C2, 0x11C000, 0x11CFFF, 9622, 9640 },
+	{ 0x0050C2, 0x11D000, 0x11DFFF, 9658, 9681 },
+	{ 0x0050C2, 0x11E000, 0x11EFFF, 9698, 9720 },
+	{ 0x0050C2, 0x11F000, 0x11FFFF, 9730, 9758 },
+	{ 0x0050C2, 0x120000, 0x120FFF, 9772, 9785 },
+	{ 0x0050C2, 0x121000, 0x121FFF, 9792, 9804 },
+	{ 0x0050C2, 0x122000, 0x122FFF, 9808, 3253 },
+	{ 0x0050C2, 0x123000, 0x123FFF, 9821, 9844 },
+	{ 0x0050C2, 0x124000, 0x124FFF, 9861, 9884 },
+	{ 0x0050C2, 0x125000, 0x125FFF, 9895, 9909 },
+	{ 0x0050C2, 0x126000, 0x126FFF, 9918, 9944 },
+	{ 0x0050C2, 0x127000, 0x127FFF, 9969, 10005 },
+	{ 0x0050C2, 0x128000, 0x128FFF, 10036, 10048 },
+	{ 0x0050C2, 0x129000, 0x129FFF, 10054, 10066 },
+	{ 0x0050C2, 0x12A000, 0x12AFFF, 10073, 10094 },
+	{ 0x0050C2, 0x12B000, 0x12BFFF, 10109, 10132 },
+	{ 0x0050C2, 0x12C000, 0x12CFFF, 10145, 10174 },
+	{ 0x0050C2, 0x12D000, 0x12DFFF, 10189, 10211 },
+	{ 0x0050C2, 0x12E000, 0x12EFFF, 10219, 10219 },
+	{ 0x0050C2, 0x12F000, 0x12FFFF, 10226, 10241 },
+	{ 0x0050C2, 0x130000, 0x130FFF, 10253, 10278 },
+	{ 0x0050C2, 0x131000, 0x131FFF, 10290, 10314 },
+	{ 0x0050C2, 0x132000, 0x132FFF, 10332, 10351 },
+	{ 0x0050C2, 0x133000, 0x133FFF, 10370, 10388 },
+	{ 0x0050C2, 0x134000, 0x134FFF, 10400, 10415 },
+	{ 0x0050C2, 0x135000, 0x135FFF, 10430, 10439 },
+	{ 0x0050C2, 0x136000, 0x136FFF, 10448, 10464 },
+	{ 0x0050C2, 0x137000, 0x137FFF, 10474, 10500 },
+	{ 0x0050C2, 0x138000, 0x138FFF, 10511, 10533 },
+	{ 0x0050C2, 0x139000, 0x139FFF, 10541, 10557 },
+	{ 0x0050C2, 0x13A000, 0x13AFFF, 10569, 10586 },
+	{ 0x0050C2, 0x13B000, 0x13BFFF, 10594, 10606 },
+	{ 0x0050C2, 0x13C000, 0x13CFFF, 10618, 10649 },
+	{ 0x0050C2, 0x13D000, 0x13DFFF, 10679, 10707 },
+	{ 0x0050C2, 0x13E000, 0x13EFFF, 10730, 10754 },
+	{ 0x0050C2, 0x13F000, 0x13FFFF, 10764, 10781 },
+	{ 0x0050C2, 0x140000, 0x140FFF, 10798, 10808 },
+	{ 0x0050C2, 0x141000, 0x141FFF, 10812, 10844 },
+	{ 0x0050C2, 0x142000, 0x142FFF, 10876, 10892 },
+	{ 0x0050C2, 0x143000, 0x143FFF, 10908, 10920 },
+	{ 0x0050C2, 0x144000, 0x144FFF, 10929, 10953 },
+	{ 0x0050C2, 0x145000, 0x145FFF, 10972, 10985 },
+	{ 0x0050C2, 0x146000, 0x146FFF, 10998, 11010 },
+	{ 0x0050C2, 0x147000, 0x147FFF, 11016, 11023 },
+	{ 0x0050C2, 0x148000, 0x148FFF, 11030, 11042 },
+	{ 0x0050C2, 0x149000, 0x149FFF, 10226, 10241 },
+	{ 0x0050C2, 0x14A000, 0x14AFFF, 11049, 11061 },
+	{ 0x0050C2, 0x14B000, 0x14BFFF, 11067, 11085 },
+	{ 0x0050C2, 0x14C000, 0x14CFFF, 11103, 11117 },
+	{ 0x0050C2, 0x14D000, 0x14DFFF, 11126, 11140 },
+	{ 0x0050C2, 0x14E000, 0x14EFFF, 11148, 11163 },
+	{ 0x0050C2, 0x14F000, 0x14FFFF, 11178, 11196 },
+	{ 0x0050C2, 0x150000, 0x150FFF, 11208, 11214 },
+	{ 0x0050C2, 0x151000, 0x151FFF, 11220, 11246 },
+	{ 0x0050C2, 0x152000, 0x152FFF, 11266, 11290 },
+	{ 0x0050C2, 0x153000, 0x153FFF, 11298, 11319 },
+	{ 0x0050C2, 0x154000, 0x154FFF, 11340, 11350 },
+	{ 0x0050C2, 0x155000, 0x155FFF, 11360, 11378 },
+	{ 0x0050C2, 0x156000, 0x156FFF, 11396, 11420 },
+	{ 0x0050C2, 0x157000, 0x157FFF, 11439, 11451 },
+	{ 0x0050C2, 0x158000, 0x158FFF, 11457, 11487 },
+	{ 0x0050C2, 0x159000, 0x159FFF, 11511, 11532 },
+	{ 0x0050C2, 0x15A000, 0x15AFFF, 11546, 11562 },
+	{ 0x0050C2, 0x15B000, 0x15BFFF, 11570, 11584 },
+	{ 0x0050C2, 0x15C000, 0x15CFFF, 11598, 11618 },
+	{ 0x0050C2, 0x15D000, 0x15DFFF, 11638, 11646 },
+	{ 0x0050C2, 0x15E000, 0x15EFFF, 11654, 11675 },
+	{ 0x0050C2, 0x15F000, 0x15FFFF, 11682, 11694 },
+	{ 0x0050C2, 0x160000, 0x160FFF, 11701, 11734 },
+	{ 0x0050C2, 0x161000, 0x161FFF, 11746, 11773 },
+	{ 0x0050C2, 0x162000, 0x162FFF, 11795, 11814 },
+	{ 0x0050C2, 0x163000, 0x163FFF, 11821, 11840 },
+	{ 0x0050C2, 0x164000, 0x164FFF, 11853, 11865 },
+	{ 0x0050C2, 0x165000, 0x165FFF, 11876, 11876 },
+	{ 0x0050C2, 0x166000, 0x166FFF, 11883, 11897 },
+	{ 0x0050C2, 0x167000, 0x167FFF, 11906, 11930 },
+	{ 0x0050C2, 0x168000, 0x168FFF, 11948, 11966 },
+	{ 0x0050C2, 0x169000, 0x169FFF, 11979, 11993 },
+	{ 0x0050C2, 0x16A000, 0x16AFFF, 12001, 12013 },
+	{ 0x0050C2, 0x16B000, 0x16BFFF, 12025, 12043 },
+	{ 0x0050C2, 0x16C000, 0x16CFFF, 12055, 12104 },
+	{ 0x0050C2, 0x16D000, 0x16DFFF, 12143, 12168 },
+	{ 0x0050C2, 0x16E000, 0x16EFFF, 12180, 12180 },
+	{ 0x0050C2, 0x16F000, 0x16FFFF, 12184, 12205 },
+	{ 0x0050C2, 0x170000, 0x170FFF, 12226, 12251 },
+	{ 0x0050C2, 0x171000, 0x171FFF, 12266, 12283 },
+	{ 0x0050C2, 0x172000, 0x172FFF, 12294, 12311 },
+	{ 0x0050C2, 0x173000, 0x173FFF, 12320, 12333 },
+	{ 0x0050C2, 0x174000, 0x174FFF, 12341, 12358 },
+	{ 0x0050C2, 0x175000, 0x175FFF, 12375, 12386 },
+	{ 0x0050C2, 0x176000, 0x176FFF, 12390, 12400 },
+	{ 0x0050C2, 0x177000, 0x177FFF, 12410, 12425 },
+	{ 0x0050C2, 0x178000, 0x178FFF, 12432, 12454 },
+	{ 0x0050C2, 0x179000, 0x179FFF, 12476, 12490 },
+	{ 0x0050C2, 0x17A000, 0x17AFFF, 12500, 12526 },
+	{ 0x0050C2, 0x17B000, 0x17BFFF, 12540, 12559 },
+	{ 0x0050C2, 0x17C000, 0x17CFFF, 12578, 12607 },
+	{ 0x0050C2, 0x17D000, 0x17DFFF, 12632, 12651 },
+	{ 0x0050C2, 0x17E000, 0x17EFFF, 12658, 12688 },
+	{ 0x0050C2, 0x17F000, 0x17FFFF, 12713, 12731 },
+	{ 0x0050C2, 0x180000, 0x180FFF, 12749, 12769 },
+	{ 0x0050C2, 0x181000, 0x181FFF, 12789, 12801 },
+	{ 0x0050C2, 0x182000, 0x182FFF, 12813, 12826 },
+	{ 0x0050C2, 0x183000, 0x183FFF, 12839, 12860 },
+	{ 0x0050C2, 0x184000, 0x184FFF, 12875, 12897 },
+	{ 0x0050C2, 0x185000, 0x185FFF, 12911, 12938 },
+	{ 0x0050C2, 0x186000, 0x186FFF, 12960, 12982 },
+	{ 0x0050C2, 0x187000, 0x187FFF, 13001, 13021 },
+	{ 0x0050C2, 0x188000, 0x188FFF, 13026, 13045 },
+	{ 0x0050C2, 0x189000, 0x189FFF, 13064, 13078 },
+	{ 0x0050C2, 0x18A000, 0x18AFFF, 13084, 13108 },
+	{ 0x0050C2, 0x18B000, 0x18BFFF, 13132, 13146 },
+	{ 0x0050C2, 0x18C000, 0x18CFFF, 13155, 13171 },
+	{ 0x0050C2, 0x18D000, 0x18DFFF, 13187, 13210 },
+	{ 0x0050C2, 0x18E000, 0x18EFFF, 13219, 13241 },
+	{ 0x0050C2, 0x18F000, 0x18FFFF, 13259, 13278 },
+	{ 0x0050C2, 0x190000, 0x190FFF, 13289, 13301 },
+	{ 0x0050C2, 0x191000, 0x191FFF, 12432, 12454 },
+	{ 0x0050C2, 0x192000, 0x192FFF, 13310, 13334 },
+	{ 0x0050C2, 0x193000, 0x193FFF, 13352, 13382 },
+	{ 0x0050C2, 0x194000, 0x194FFF, 13405, 13419 },
+	{ 0x0050C2, 0x195000, 0x195FFF, 13427, 13449 },
+	{ 0x0050C2, 0x196000, 0x196FFF, 13463, 13475 },
+	{ 0x0050C2, 0x197000, 0x197FFF, 13487, 13517 },
+	{ 0x0050C2, 0x198000, 0x198FFF, 13547, 13560 },
+	{ 0x0050C2, 0x199000, 0x199FFF, 13568, 13601 },
+	{ 0x0050C2, 0x19A000, 0x19AFFF, 13611, 13631 },
+	{ 0x0050C2, 0x19B000, 0x19BFFF, 13636, 13660 },
+	{ 0x0050C2, 0x19C000, 0x19CFFF, 13678, 13691 },
+	{ 0x0050C2, 0x19D000, 0x19DFFF, 13704, 13719 },
+	{ 0x0050C2, 0x19E000, 0x19EFFF, 13728, 13745 },
+	{ 0x0050C2, 0x19F000, 0x19FFFF, 13756, 13782 },
+	{ 0x0050C2, 0x1A0000, 0x1A0FFF, 13804, 13821 },
+	{ 0x0050C2, 0x1A1000, 0x1A1FFF, 13830, 13848 },
+	{ 0x0050C2, 0x1A2000, 0x1A2FFF, 13861, 13881 },
+	{ 0x0050C2, 0x1A3000, 0x1A3FFF, 13897, 13921 },
+	{ 0x0050C2, 0x1A4000, 0x1A4FFF, 13943, 13970 },
+	{ 0x0050C2, 0x1A5000, 0x1A5FFF, 13988, 13988 },
+	{ 0x0050C2, 0x1A6000, 0x1A6FFF, 13994, 14002 },
+	{ 0x0050C2, 0x1A7000, 0x1A7FFF, 14010, 14040 },
+	{ 0x0050C2, 0x1A8000, 0x1A8FFF, 14064, 14080 },
+	{ 0x0050C2, 0x1A9000, 0x1A9FFF, 14096, 14121 },
+	{ 0x0050C2, 0x1AA000, 0x1AAFFF, 14141, 14152 },
+	{ 0x0050C2, 0x1AB000, 0x1ABFFF, 14159, 14178 },
+	{ 0x0050C2, 0x1AC000, 0x1ACFFF, 14197, 14216 },
+	{ 0x0050C2, 0x1AD000, 0x1ADFFF, 14230, 14243 },
+	{ 0x0050C2, 0x1AE000, 0x1AEFFF, 14255, 14274 },
+	{ 0x0050C2, 0x1AF000, 0x1AFFFF, 14288, 14298 },
+	{ 0x0050C2, 0x1B0000, 0x1B0FFF, 14303, 14332 },
+	{ 0x0050C2, 0x1B1000, 0x1B1FFF, 14356, 14374 },
+	{ 0x0050C2, 0x1B2000, 0x1B2FFF, 14392, 14421 },
+	{ 0x0050C2, 0x1B3000, 0x1B3FFF, 14445, 712 },
+	{ 0x0050C2, 0x1B4000, 0x1B4FFF, 14456, 14471 },
+	{ 0x0050C2, 0x1B5000, 0x1B5FFF, 14481, 14501 },
+	{ 0x0050C2, 0x1B6000, 0x1B6FFF, 14519, 14529 },
+	{ 0x0050C2, 0x1B7000, 0x1B7FFF, 14533, 14545 },
+	{ 0x0050C2, 0x1B8000, 0x1B8FFF, 14557, 14588 },
+	{ 0x0050C2, 0x1B9000, 0x1B9FFF, 14600, 14622 },
+	{ 0x0050C2, 0x1BA000, 0x1BAFFF, 14628, 14641 },
+	{ 0x0050C2, 0x1BB000, 0x1BBFFF, 14651, 14666 },
+	{ 0x0050C2, 0x1BC000, 0x1BCFFF, 14681, 14701 },
+	{ 0x0050C2, 0x1BD000, 0x1BDFFF, 14707, 14730 },
+	{ 0x0050C2, 0x1BE000, 0x1BEFFF, 14735, 14753 },
+	{ 0x0050C2, 0x1BF000, 0x1BFFFF, 14771, 14822 },
+	{ 0x0050C2, 0x1C0000, 0x1C0FFF, 14848, 14864 },
+	{ 0x0050C2, 0x1C1000, 0x1C1FFF, 14875, 14897 },
+	{ 0x0050C2, 0x1C2000, 0x1C2FFF, 14914, 14931 },
+	{ 0x0050C2, 0x1C3000, 0x1C3FFF, 14942, 14961 },
+	{ 0x0050C2, 0x1C4000, 0x1C4FFF, 14980, 15001 },
+	{ 0x0050C2, 0x1C5000, 0x1C5FFF, 15022, 15033 },
+	{ 0x0050C2, 0x1C6000, 0x1C6FFF, 15044, 15061 },
+	{ 0x0050C2, 0x1C7000, 0x1C7FFF, 15078, 15100 },
+	{ 0x0050C2, 0x1C8000, 0x1C8FFF, 15117, 15146 },
+	{ 0x0050C2, 0x1C9000, 0x1C9FFF, 15154, 15165 },
+	{ 0x0050C2, 0x1CA000, 0x1CAFFF, 15171, 15187 },
+	{ 0x0050C2, 0x1CB000, 0x1CBFFF, 15201, 15221 },
+	{ 0x0050C2, 0x1CC000, 0x1CCFFF, 15233, 15240 },
+	{ 0x0050C2, 0x1CD000, 0x1CDFFF, 15247, 15277 },
+	{ 0x0050C2, 0x1CE000, 0x1CEFFF, 15306, 15333 },
+	{ 0x0050C2, 0x1CF000, 0x1CFFFF, 15354, 15385 },
+	{ 0x0050C2, 0x1D0000, 0x1D0FFF, 15410, 15437 },
+	{ 0x0050C2, 0x1D1000, 0x1D1FFF, 15458, 15480 },
+	{ 0x0050C2, 0x1D2000, 0x1D2FFF, 15502, 15535 },
+	{ 0x0050C2, 0x1D3000, 0x1D3FFF, 15553, 15562 },
+	{ 0x0050C2, 0x1D4000, 0x1D4FFF, 15571, 15597 },
+	{ 0x0050C2, 0x1D5000, 0x1D5FFF, 15618, 15636 },
+	{ 0x0050C2, 0x1D6000, 0x1D6FFF, 15654, 15697 },
+	{ 0x0050C2, 0x1D7000, 0x1D7FFF, 15724, 15749 },
+	{ 0x0050C2, 0x1D8000, 0x1D8FFF, 15769, 15805 },
+	{ 0x0050C2, 0x1D9000, 0x1D9FFF, 15823, 15823 },
+	{ 0x0050C2, 0x1DA000, 0x1DAFFF, 4347, 4363 },
+	{ 0x0050C2, 0x1DB000, 0x1DBFFF, 15827, 15861 },
+	{ 0x0050C2, 0x1DC000, 0x1DCFFF, 15881, 15908 },
+	{ 0x0050C2, 0x1DD000, 0x1DDFFF, 15927, 15947 },
+	{ 0x0050C2, 0x1DE000, 0x1DEFFF, 15962, 15974 },
+	{ 0x0050C2, 0x1DF000, 0x1DFFFF, 15981, 16012 },
+	{ 0x0050C2, 0x1E0000, 0x1E0FFF, 12632, 12651 },
+	{ 0x0050C2, 0x1E1000, 0x1E1FFF, 16032, 16067 },
+	{ 0x0050C2, 0x1E2000, 0x1E2FFF, 16102, 16137 },
+	{ 0x0050C2, 0x1E3000, 0x1E3FFF, 16167, 16184 },
+	{ 0x0050C2, 0x1E4000, 0x1E4FFF, 16195, 16209 },
+	{ 0x0050C2, 0x1E5000, 0x1E5FFF, 16217, 16228 },
+	{ 0x0050C2, 0x1E6000, 0x1E6FFF, 16239, 16267 },
+	{ 0x0050C2, 0x1E7000, 0x1E7FFF, 16283, 16301 },
+	{ 0x0050C2, 0x1E8000, 0x1E8FFF, 16313, 16323 },
+	{ 0x0050C2, 0x1E9000, 0x1E9FFF, 16333, 16348 },
+	{ 0x0050C2, 0x1EA000, 0x1EAFFF, 16363, 16372 },
+	{ 0x0050C2, 0x1EB000, 0x1EBFFF, 16381, 16398 },
+	{ 0x0050C2, 0x1EC000, 0x1ECFFF, 16415, 16430 },
+	{ 0x0050C2, 0x1ED000, 0x1EDFFF, 16436, 16455 },
+	{ 0x0050C2, 0x1EE000, 0x1EEFFF, 16460, 16499 },
+	{ 0x0050C2, 0x1EF000, 0x1EFFFF, 16527, 16549 },
+	{ 0x0050C2, 0x1F0000, 0x1F0FFF, 16556, 16582 },
+	{ 0x0050C2, 0x1F1000, 0x1F1FFF, 16595, 16615 },
+	{ 0x0050C2, 0x1F2000, 0x1F2FFF, 16629, 16641 },
+	{ 0x0050C2, 0x1F3000, 0x1F3FFF, 16653, 16677 },
+	{ 0x0050C2, 0x1F4000, 0x1F4FFF, 16700, 16711 },
+	{ 0x0050C2, 0x1F5000, 0x1F5FFF, 16717, 16743 },
+	{ 0x0050C2, 0x1F6000, 0x1F6FFF, 16763, 16784 },
+	{ 0x0050C2, 0x1F7000, 0x1F7FFF, 16797, 16812 },
+	{ 0x0050C2, 0x1F8000, 0x1F8FFF, 16825, 16846 },
+	{ 0x0050C2, 0x1F9000, 0x1F9FFF, 16856, 16870 },
+	{ 0x0050C2, 0x1FA000, 0x1FAFFF, 16880, 16897 },
+	{ 0x0050C2, 0x1FB000, 0x1FBFFF, 16909, 16933 },
+	{ 0x0050C2, 0x1FC000, 0x1FCFFF, 16944, 16952 },
+	{ 0x0050C2, 0x1FD000, 0x1FDFFF, 16960, 16975 },
+	{ 0x0050C2, 0x1FE000, 0x1FEFFF, 16985, 17015 },
+	{ 0x0050C2, 0x1FF000, 0x1FFFFF, 17032, 17072 },
+	{ 0x0050C2, 0x200000, 0x200FFF, 17098, 17130 },
+	{ 0x0050C2, 0x201000, 0x201FFF, 17156, 17167 },
+	{ 0x0050C2, 0x202000, 0x202FFF, 17178, 17194 },
+	{ 0x0050C2, 0x203000, 0x203FFF, 17210, 17237 },
+	{ 0x0050C2, 0x204000, 0x204FFF, 17246, 17270 },
+	{ 0x0050C2, 0x205000, 0x205FFF, 17294, 17302 },
+	{ 0x0050C2, 0x206000, 0x206FFF, 17310, 17331 },
+	{ 0x0050C2, 0x207000, 0x207FFF, 17352, 17404 },
+	{ 0x0050C2, 0x208000, 0x208FFF, 17455, 17468 },
+	{ 0x0050C2, 0x209000, 0x209FFF, 17475, 17482 },
+	{ 0x0050C2, 0x20A000, 0x20AFFF, 17485, 17507 },
+	{ 0x0050C2, 0x20B000, 0x20BFFF, 17515, 17522 },
+	{ 0x0050C2, 0x20C000, 0x20CFFF, 17529, 17586 },
+	{ 0x0050C2, 0x20D000, 0x20DFFF, 17627, 17639 },
+	{ 0x0050C2, 0x20E000, 0x20EFFF, 17647, 17669 },
+	{ 0x0050C2, 0x20F000, 0x20FFFF, 17677, 17702 },
+	{ 0x0050C2, 0x210000, 0x210FFF, 17722, 17744 },
+	{ 0x0050C2, 0x211000, 0x211FFF, 17762, 17822 },
+	{ 0x0050C2, 0x212000, 0x212FFF, 17879, 17894 },
+	{ 0x0050C2, 0x213000, 0x213FFF, 17901, 17919 },
+	{ 0x0050C2, 0x214000, 0x214FFF, 17932, 17958 },
+	{ 0x0050C2, 0x215000, 0x215FFF, 17979, 17991 },
+	{ 0x0050C2, 0x216000, 0x216FFF, 18000, 18022 },
+	{ 0x0050C2, 0x217000, 0x217FFF, 18036, 18054 },
+	{ 0x0050C2, 0x218000, 0x218FFF, 18068, 18109 },
+	{ 0x0050C2, 0x219000, 0x219FFF, 18144, 18158 },
+	{ 0x0050C2, 0x21A000, 0x21AFFF, 18167, 18187 },
+	{ 0x0050C2, 0x21B000, 0x21BFFF, 18191, 18210 },
+	{ 0x0050C2, 0x21C000, 0x21CFFF, 18221, 18234 },
+	{ 0x0050C2, 0x21D000, 0x21DFFF, 18247, 18285 },
+	{ 0x0050C2, 0x21E000, 0x21EFFF, 18317, 18349 },
+	{ 0x0050C2, 0x21F000, 0x21FFFF, 18381, 4556 },
+	{ 0x0050C2, 0x220000, 0x220FFF, 18411, 18432 },
+	{ 0x0050C2, 0x221000, 0x221FFF, 18441, 18466 },
+	{ 0x0050C2, 0x222000, 0x222FFF, 18491, 18511 },
+	{ 0x0050C2, 0x223000, 0x223FFF, 18526, 18543 },
+	{ 0x0050C2, 0x224000, 0x224FFF, 18555, 18569 },
+	{ 0x0050C2, 0x225000, 0x225FFF, 18578, 18598 },
+	{ 0x0050C2, 0x226000, 0x226FFF, 18612, 18631 },
+	{ 0x0050C2, 0x227000, 0x227FFF, 18642, 18672 },
+	{ 0x0050C2, 0x228000, 0x228FFF, 18702, 18739 },
+	{ 0x0050C2, 0x229000, 0x229FFF, 18770, 18787 },
+	{ 0x0050C2, 0x22A000, 0x22AFFF, 18791, 18810 },
+	{ 0x0050C2, 0x22B000, 0x22BFFF, 18829, 18866 },
+	{ 0x0050C2, 0x22C000, 0x22CFFF, 18890, 18901 },
+	{ 0x0050C2, 0x22D000, 0x22DFFF, 18912, 18924 },
+	{ 0x0050C2, 0x22E000, 0x22EFFF, 18931, 18947 },
+	{ 0x0050C2, 0x22F000, 0x22FFFF, 18963, 18976 },
+	{ 0x0050C2, 0x230000, 0x230FFF, 18981, 19006 },
+	{ 0x0050C2, 0x231000, 0x231FFF, 19022, 19042 },
+	{ 0x0050C2, 0x232000, 0x232FFF, 19048, 19048 },
+	{ 0x0050C2, 0x233000, 0x233FFF, 19054, 19082 },
+	{ 0x0050C2, 0x234000, 0x234FFF, 19104, 19123 },
+	{ 0x0050C2, 0x235000, 0x235FFF, 19134, 19158 },
+	{ 0x0050C2, 0x236000, 0x236FFF, 19177, 19198 },
+	{ 0x0050C2, 0x237000, 0x237FFF, 19219, 19239 },
+	{ 0x0050C2, 0x238000, 0x238FFF, 19247, 19265 },
+	{ 0x0050C2, 0x239000, 0x239FFF, 19278, 19290 },
+	{ 0x0050C2, 0x23A000, 0x23AFFF, 19302, 19319 },
+	{ 0x0050C2, 0x23B000, 0x23BFFF, 19336, 19343 },
+	{ 0x0050C2, 0x23C000, 0x23CFFF, 19350, 19373 },
+	{ 0x0050C2, 0x23D000, 0x23DFFF, 19384, 19404 },
+	{ 0x0050C2, 0x23E000, 0x23EFFF, 19412, 19427 },
+	{ 0x0050C2, 0x23F000, 0x23FFFF, 19437, 19457 },
+	{ 0x0050C2, 0x240000, 0x240FFF, 19475, 19487 },
+	{ 0x0050C2, 0x241000, 0x241FFF, 19495, 19521 },
+	{ 0x0050C2, 0x242000, 0x242FFF, 19547, 19557 },
+	{ 0x0050C2, 0x243000, 0x243FFF, 19567, 19580 },
+	{ 0x0050C2, 0x244000, 0x244FFF, 19593, 19604 },
+	{ 0x0050C2, 0x245000, 0x245FFF, 19610, 19641 },
+	{ 0x0050C2, 0x246000, 0x246FFF, 19657, 19667 },
+	{ 0x0050C2, 0x247000, 0x247FFF, 19677, 19702 },
+	{ 0x0050C2, 0x248000, 0x248FFF, 19726, 19759 },
+	{ 0x0050C2, 0x249000, 0x249FFF, 19789, 19810 },
+	{ 0x0050C2, 0x24A000, 0x24AFFF, 19817, 19826 },
+	{ 0x0050C2, 0x24B000, 0x24BFFF, 19835, 19857 },
+	{ 0x0050C2, 0x24C000, 0x24CFFF, 19865, 19874 },
+	{ 0x0050C2, 0x24D000, 0x24DFFF, 19883, 19898 },
+	{ 0x0050C2, 0x24E000, 0x24EFFF, 19913, 19954 },
+	{ 0x0050C2, 0x24F000, 0x24FFFF, 19983, 19999 },
+	{ 0x0050C2, 0x250000, 0x250FFF, 20008, 20028 },
+	{ 0x0050C2, 0x251000, 0x251FFF, 20043, 20058 },
+	{ 0x0050C2, 0x252000, 0x252FFF, 20071, 20084 },
+	{ 0x0050C2, 0x253000, 0x253FFF, 20092, 20113 },
+	{ 0x0050C2, 0x254000, 0x254FFF, 20129, 20155 },
+	{ 0x0050C2, 0x255000, 0x255FFF, 20176, 20199 },
+	{ 0x0050C2, 0x256000, 0x256FFF, 20222, 20251 },
+	{ 0x0050C2, 0x257000, 0x257FFF, 20263, 20281 },
+	{ 0x0050C2, 0x258000, 0x258FFF, 20299, 20322 },
+	{ 0x0050C2, 0x259000, 0x259FFF, 20333, 20349 },
+	{ 0x0050C2, 0x25A000, 0x25AFFF, 20365, 20384 },
+	{ 0x0050C2, 0x25B000, 0x25BFFF, 20391, 20411 },
+	{ 0x0050C2, 0x25C000, 0x25CFFF, 20431, 20458 },
+	{ 0x0050C2, 0x25D000, 0x25DFFF, 20480, 20480 },
+	{ 0x0050C2, 0x25E000, 0x25EFFF, 20487, 20515 },
+	{ 0x0050C2, 0x25F000, 0x25FFFF, 20541, 20585 },
+	{ 0x0050C2, 0x260000, 0x260FFF, 20618, 20618 },
+	{ 0x0050C2, 0x261000, 0x261FFF, 20626, 16641 },
+	{ 0x0050C2, 0x262000, 0x262FFF, 20638, 20690 },
+	{ 0x0050C2, 0x263000, 0x263FFF, 20726, 20748 },
+	{ 0x0050C2, 0x264000, 0x264FFF, 20770, 20792 },
+	{ 0x0050C2, 0x265000, 0x265FFF, 20810, 20825 },
+	{ 0x0050C2, 0x266000, 0x266FFF, 20839, 20859 },
+	{ 0x0050C2, 0x267000, 0x267FFF, 20870, 20900 },
+	{ 0x0050C2, 0x268000, 0x268FFF, 20926, 20942 },
+	{ 0x0050C2, 0x269000, 0x269FFF, 20950, 20969 },
+	{ 0x0050C2, 0x26A000, 0x26AFFF, 20984, 20995 },
+	{ 0x0050C2, 0x26B000, 0x26BFFF, 21006, 21034 },
+	{ 0x0050C2, 0x26C000, 0x26CFFF, 21054, 21073 },
+	{ 0x0050C2, 0x26D000, 0x26DFFF, 14445, 712 },
+	{ 0x0050C2, 0x26E000, 0x26EFFF, 21088, 21107 },
+	{ 0x0050C2, 0x26F000, 0x26FFFF, 21126, 21148 },
+	{ 0x0050C2, 0x270000, 0x270FFF, 21166, 21188 },
+	{ 0x0050C2, 0x271000, 0x271FFF, 21195, 21219 },
+	{ 0x0050C2, 0x272000, 0x272FFF, 21238, 21255 },
+	{ 0x0050C2, 0x273000, 0x273FFF, 21261, 21296 },
+	{ 0x0050C2, 0x274000, 0x274FFF, 21326, 21368 },
+	{ 0x0050C2, 0x275000, 0x275FFF, 21406, 21436 },
+	{ 0x0050C2, 0x276000, 0x276FFF, 21466, 21491 },
+	{ 0x0050C2, 0x277000, 0x277FFF, 21512, 21530 },
+	{ 0x0050C2, 0x278000, 0x278FFF, 21534, 21548 },
+	{ 0x0050C2, 0x279000, 0x279FFF, 21557, 21577 },
+	{ 0x0050C2, 0x27A000, 0x27AFFF, 21585, 21601 },
+	{ 0x0050C2, 0x27B000, 0x27BFFF, 21613, 21630 },
+	{ 0x0050C2, 0x27C000, 0x27CFFF, 21647, 21658 },
+	{ 0x0050C2, 0x27D000, 0x27DFFF, 21665, 21685 },
+	{ 0x0050C2, 0x27E000, 0x27EFFF, 21704, 21728 },
+	{ 0x0050C2, 0x27F000, 0x27FFFF, 21747, 21782 },
+	{ 0x0050C2, 0x280000, 0x280FFF, 21810, 21826 },
+	{ 0x0050C2, 0x281000, 0x281FFF, 21842, 21855 },
+	{ 0x0050C2, 0x282000, 0x282FFF, 21865, 21873 },
+	{ 0x0050C2, 0x283000, 0x283FFF, 21881, 21895 },
+	{ 0x0050C2, 0x284000, 0x284FFF, 21903, 21917 },
+	{ 0x0050C2, 0x285000, 0x285FFF, 21926, 21947 },
+	{ 0x0050C2, 0x286000, 0x286FFF, 21955, 21955 },
+	{ 0x0050C2, 0x287000, 0x287FFF, 21961, 22002 },
+	{ 0x0050C2, 0x288000, 0x288FFF, 22036, 22060 },
+	{ 0x0050C2, 0x289000, 0x289FFF, 22064, 22080 },
+	{ 0x0050C2, 0x28A000, 0x28AFFF, 22089, 22107 },
+	{ 0x0050C2, 0x28B000, 0x28BFFF, 22117, 22140 },
+	{ 0x0050C2, 0x28C000, 0x28CFFF, 22159, 22178 },
+	{ 0x0050C2, 0x28D000, 0x28DFFF, 22185, 22194 },
+	{ 0x0050C2, 0x28E000, 0x28EFFF, 16629, 16641 },
+	{ 0x0050C2, 0x28F000, 0x28FFFF, 22200, 22239 },
+	{ 0x0050C2, 0x290000, 0x290FFF, 22273, 22285 },
+	{ 0x0050C2, 0x291000, 0x291FFF, 22297, 22312 },
+	{ 0x0050C2, 0x292000, 0x292FFF, 22327, 22342 },
+	{ 0x0050C2, 0x293000, 0x293FFF, 4718, 4727 },
+	{ 0x0050C2, 0x294000, 0x294FFF, 22349, 22359 },
+	{ 0x0050C2, 0x295000, 0x295FFF, 22364, 22378 },
+	{ 0x0050C2, 0x296000, 0x296FFF, 22386, 22394 },
+	{ 0x0050C2, 0x297000, 0x297FFF, 22402, 22402 },
+	{ 0x0050C2, 0x298000, 0x298FFF, 22411, 22429 },
+	{ 0x0050C2, 0x299000, 0x299FFF, 753, 765 },
+	{ 0x0050C2, 0x29A000, 0x29AFFF, 22447, 22470 },
+	{ 0x0050C2, 0x29B000, 0x29BFFF, 20008, 20028 },
+	{ 0x0050C2, 0x29C000, 0x29CFFF, 22488, 22511 },
+	{ 0x0050C2, 0x29D000, 0x29DFFF, 22529, 22544 },
+	{ 0x0050C2, 0x29E000, 0x29EFFF, 22559, 22584 },
+	{ 0x0050C2, 0x29F000, 0x29FFFF, 22604, 22629 },
+	{ 0x0050C2, 0x2A0000, 0x2A0FFF, 22638, 22669 },
+	{ 0x0050C2, 0x2A1000, 0x2A1FFF, 22695, 22710 },
+	{ 0x0050C2, 0x2A2000, 0x2A2FFF, 22720, 22731 },
+	{ 0x0050C2, 0x2A3000, 0x2A3FFF, 22741, 22775 },
+	{ 0x0050C2, 0x2A4000, 0x2A4FFF, 22795, 22822 },
+	{ 0x0050C2, 0x2A5000, 0x2A5FFF, 22849, 22875 },
+	{ 0x0050C2, 0x2A6000, 0x2A6FFF, 22897, 22923 },
+	{ 0x0050C2, 0x2A7000, 0x2A7FFF, 22949, 22981 },
+	{ 0x0050C2, 0x2A8000, 0x2A8FFF, 23013, 23031 },
+	{ 0x0050C2, 0x2A9000, 0x2A9FFF, 23044, 23074 },
+	{ 0x0050C2, 0x2AA000, 0x2AAFFF, 23092, 23109 },
+	{ 0x0050C2, 0x2AB000, 0x2ABFFF, 23121, 23150 },
+	{ 0x0050C2, 0x2AC000, 0x2ACFFF, 23171, 23193 },
+	{ 0x0050C2, 0x2AD000, 0x2ADFFF, 23209, 23221 },
+	{ 0x0050C2, 0x2AE000, 0x2AEFFF, 23233, 23265 },
+	{ 0x0050C2, 0x2AF000, 0x2AFFFF, 23282, 23319 },
+	{ 0x0050C2, 0x2B0000, 0x2B0FFF, 23339, 23357 },
+	{ 0x0050C2, 0x2B1000, 0x2B1FFF, 2377, 2385 },
+	{ 0x0050C2, 0x2B2000, 0x2B2FFF, 23375, 23392 },
+	{ 0x0050C2, 0x2B3000, 0x2B3FFF, 23409, 23433 },
+	{ 0x0050C2, 0x2B4000, 0x2B4FFF, 23449, 23461 },
+	{ 0x0050C2, 0x2B5000, 0x2B5FFF, 23469, 23505 },
+	{ 0x0050C2, 0x2B6000, 0x2B6FFF, 23532, 23545 },
+	{ 0x0050C2, 0x2B7000, 0x2B7FFF, 23553, 23571 },
+	{ 0x0050C2, 0x2B8000, 0x2B8FFF, 23576, 23606 },
+	{ 0x0050C2, 0x2B9000, 0x2B9FFF, 23630, 23657 },
+	{ 0x0050C2, 0x2BA000, 0x2BAFFF, 23679, 23711 },
+	{ 0x0050C2, 0x2BB000, 0x2BBFFF, 23728, 23747 },
+	{ 0x0050C2, 0x2BC000, 0x2BCFFF, 23762, 23784 },
+	{ 0x0050C2, 0x2BD000, 0x2BDFFF, 23803, 23817 },
+	{ 0x0050C2, 0x2BE000, 0x2BEFFF, 23831, 23866 },
+	{ 0x0050C2, 0x2BF000, 0x2BFFFF, 23896, 23896 },
+	{ 0x0050C2, 0x2C0000, 0x2C0FFF, 23902, 23934 },
+	{ 0x0050C2, 0x2C1000, 0x2C1FFF, 23947, 24008 },
+	{ 0x0050C2, 0x2C2000, 0x2C2FFF, 24069, 24090 },
+	{ 0x0050C2, 0x2C3000, 0x2C3FFF, 24099, 24114 },
+	{ 0x0050C2, 0x2C4000, 0x2C4FFF, 24125, 24162 },
+	{ 0x0050C2, 0x2C5000, 0x2C5FFF, 24189, 24199 },
+	{ 0x0050C2, 0x2C6000, 0x2C6FFF, 24209, 24245 },
+	{ 0x0050C2, 0x2C7000, 0x2C7FFF, 24262, 24289 },
+	{ 0x0050C2, 0x2C8000, 0x2C8FFF, 24312, 24312 },
+	{ 0x0050C2, 0x2C9000, 0x2C9FFF, 24318, 24343 },
+	{ 0x0050C2, 0x2CA000, 0x2CAFFF, 24363, 24381 },
+	{ 0x0050C2, 0x2CB000, 0x2CBFFF, 24390, 24412 },
+	{ 0x0050C2, 0x2CC000, 0x2CCFFF, 24430, 24450 },
+	{ 0x0050C2, 0x2CD000, 0x2CDFFF, 24470, 24488 },
+	{ 0x0050C2, 0x2CE000, 0x2CEFFF, 18612, 18631 },
+	{ 0x0050C2, 0x2CF000, 0x2CFFFF, 24506, 24542 },
+	{ 0x0050C2, 0x2D0000, 0x2D0FFF, 24571, 24588 },
+	{ 0x0050C2, 0x2D1000, 0x2D1FFF, 24599, 24613 },
+	{ 0x0050C2, 0x2D2000, 0x2D2FFF, 24621, 24648 },
+	{ 0x0050C2, 0x2D3000, 0x2D3FFF, 24669, 24702 },
+	{ 0x0050C2, 0x2D4000, 0x2D4FFF, 24729, 24762 },
+	{ 0x0050C2, 0x2D5000, 0x2D5FFF, 24789, 24797 },
+	{ 0x0050C2, 0x2D6000, 0x2D6FFF, 24802, 24819 },
+	{ 0x0050C2, 0x2D7000, 0x2D7FFF, 24836, 24856 },
+	{ 0x0050C2, 0x2D8000, 0x2D8FFF, 24872, 24893 },
+	{ 0x0050C2, 0x2D9000, 0x2D9FFF, 2377, 2385 },
+	{ 0x0050C2, 0x2DA000, 0x2DAFFF, 17647, 17669 },
+	{ 0x0050C2, 0x2DB000, 0x2DBFFF, 18981, 19006 },
+	{ 0x0050C2, 0x2DC000, 0x2DCFFF, 24902, 24928 },
+	{ 0x0050C2, 0x2DD000, 0x2DDFFF, 24946, 24968 },
+	{ 0x0050C2, 0x2DE000, 0x2DEFFF, 24975, 24997 },
+	{ 0x0050C2, 0x2DF000, 0x2DFFFF, 25019, 25019 },
+	{ 0x0050C2, 0x2E0000, 0x2E0FFF, 25030, 25055 },
+	{ 0x0050C2, 0x2E1000, 0x2E1FFF, 25062, 25072 },
+	{ 0x0050C2, 0x2E2000, 0x2E2FFF, 25082, 25107 },
+	{ 0x0050C2, 0x2E3000, 0x2E3FFF, 25115, 25143 },
+	{ 0x0050C2, 0x2E4000, 0x2E4FFF, 25166, 25177 },
+	{ 0x0050C2, 0x2E5000, 0x2E5FFF, 25183, 25197 },
+	{ 0x0050C2, 0x2E6000, 0x2E6FFF, 25211, 25211 },
+	{ 0x0050C2, 0x2E7000, 0x2E7FFF, 25217, 25232 },
+	{ 0x0050C2, 0x2E8000, 0x2E8FFF, 25241, 25270 },
+	{ 0x0050C2, 0x2E9000, 0x2E9FFF, 25293, 25311 },
+	{ 0x0050C2, 0x2EA000, 0x2EAFFF, 25315, 25331 },
+	{ 0x0050C2, 0x2EB000, 0x2EBFFF, 25340, 25358 },
+	{ 0x0050C2, 0x2EC000, 0x2ECFFF, 25374, 25405 },
+	{ 0x0050C2, 0x2ED000, 0x2EDFFF, 25426, 25449 },
+	{ 0x0050C2, 0x2EE000, 0x2EEFFF, 25467, 25501 },
+	{ 0x0050C2, 0x2EF000, 0x2EFFFF, 25532, 25546 },
+	{ 0x0050C2, 0x2F0000, 0x2F0FFF, 25559, 25576 },
+	{ 0x0050C2, 0x2F1000, 0x2F1FFF, 25581, 25598 },
+	{ 0x0050C2, 0x2F2000, 0x2F2FFF, 25609, 25621 },
+	{ 0x0050C2, 0x2F3000, 0x2F3FFF, 25633, 25659 },
+	{ 0x0050C2, 0x2F4000, 0x2F4FFF, 25668, 25693 },
+	{ 0x0050C2, 0x2F5000, 0x2F5FFF, 25718, 25726 },
+	{ 0x0050C2, 0x2F6000, 0x2F6FFF, 25734, 25754 },
+	{ 0x0050C2, 0x2F7000, 0x2F7FFF, 25774, 25790 },
+	{ 0x0050C2, 0x2F8000, 0x2F8FFF, 25801, 25819 },
+	{ 0x0050C2, 0x2F9000, 0x2F9FFF, 25833, 25847 },
+	{ 0x0050C2, 0x2FA000, 0x2FAFFF, 25856, 25880 },
+	{ 0x0050C2, 0x2FB000, 0x2FBFFF, 25896, 25944 },
+	{ 0x0050C2, 0x2FC000, 0x2FCFFF, 25986, 26016 },
+	{ 0x0050C2, 0x2FD000, 0x2FDFFF, 26026, 26054 },
+	{ 0x0050C2, 0x2FE000, 0x2FEFFF, 26076, 26084 },
+	{ 0x0050C2, 0x2FF000, 0x2FFFFF, 26092, 26118 },
+	{ 0x0050C2, 0x300000, 0x300FFF, 26144, 26172 },
+	{ 0x0050C2, 0x301000, 0x301FFF, 26200, 26229 },
+	{ 0x0050C2, 0x302000, 0x302FFF, 26244, 26282 },
+	{ 0x0050C2, 0x303000, 0x303FFF, 26315, 26331 },
+	{ 0x0050C2, 0x304000, 0x304FFF, 26334, 26350 },
+	{ 0x0050C2, 0x305000, 0x305FFF, 26359, 26379 },
+	{ 0x0050C2, 0x306000, 0x306FFF, 26387, 26417 },
+	{ 0x0050C2, 0x307000, 0x307FFF, 26441, 26462 },
+	{ 0x0050C2, 0x308000, 0x308FFF, 26475, 26482 },
+	{ 0x0050C2, 0x309000, 0x309FFF, 26489, 26514 },
+	{ 0x0050C2, 0x30A000, 0x30AFFF, 26525, 26546 },
+	{ 0x0050C2, 0x30B000, 0x30BFFF, 26562, 26583 },
+	{ 0x0050C2, 0x30C000, 0x30CFFF, 26599, 26599 },
+	{ 0x0050C2, 0x30D000, 0x30DFFF, 26607, 26607 },
+	{ 0x0050C2, 0x30E000, 0x30EFFF, 26615, 26646 },
+	{ 0x0050C2, 0x30F000, 0x30FFFF, 26668, 26685 },
+	{ 0x0050C2, 0x310000, 0x310FFF, 26702, 26722 },
+	{ 0x0050C2, 0x311000, 0x311FFF, 26732, 26739 },
+	{ 0x0050C2, 0x312000, 0x312FFF, 26746, 26767 },
+	{ 0x0050C2, 0x313000, 0x313FFF, 6700, 6725 },
+	{ 0x0050C2, 0x314000, 0x314FFF, 26788, 26810 },
+	{ 0x0050C2, 0x315000, 0x315FFF, 26819, 26836 },
+	{ 0x0050C2, 0x316000, 0x316FFF, 26848, 26860 },
+	{ 0x0050C2, 0x317000, 0x317FFF, 26872, 26893 },
+	{ 0x0050C2, 0x318000, 0x318FFF, 26900, 26912 },
+	{ 0x0050C2, 0x319000, 0x319FFF, 26920, 26943 },
+	{ 0x0050C2, 0x31A000, 0x31AFFF, 26952, 26972 },
+	{ 0x0050C2, 0x31B000, 0x31BFFF, 26984, 26992 },
+	{ 0x0050C2, 0x31C000, 0x31CFFF, 27000, 27015 },
+	{ 0x0050C2, 0x31D000, 0x31DFFF, 15881, 15908 },
+	{ 0x0050C2, 0x31E000, 0x31EFFF, 27025, 27038 },
+	{ 0x0050C2, 0x31F000, 0x31FFFF, 27046, 27071 },
+	{ 0x0050C2, 0x320000, 0x320FFF, 27091, 27108 },
+	{ 0x0050C2, 0x321000, 0x321FFF, 27118, 27118 },
+	{ 0x0050C2, 0x322000, 0x322FFF, 27122, 27156 },
+	{ 0x0050C2, 0x323000, 0x323FFF, 27180, 27198 },
+	{ 0x0050C2, 0x324000, 0x324FFF, 27216, 27216 },
+	{ 0x0050C2, 0x325000, 0x325FFF, 27224, 27256 },
+	{ 0x0050C2, 0x326000, 0x326FFF, 27288, 27305 },
+	{ 0x0050C2, 0x327000, 0x327FFF, 27315, 27328 },
+	{ 0x0050C2, 0x328000, 0x328FFF, 27336, 27363 },
+	{ 0x0050C2, 0x329000, 0x329FFF, 27381, 27386 },
+	{ 0x0050C2, 0x32A000, 0x32AFFF, 10929, 10953 },
+	{ 0x0050C2, 0x32B000, 0x32BFFF, 27391, 27427 },
+	{ 0x0050C2, 0x32C000, 0x32CFFF, 27463, 27506 },
+	{ 0x0050C2, 0x32D000, 0x32DFFF, 27541, 27568 },
+	{ 0x0050C2, 0x32E000, 0x32EFFF, 27590, 27608 },
+	{ 0x0050C2, 0x32F000, 0x32FFFF, 27620, 27620 },
+	{ 0x0050C2, 0x330000, 0x330FFF, 27631, 27641 },
+	{ 0x0050C2, 0x331000, 0x331FFF, 27651, 27672 },
+	{ 0x0050C2, 0x332000, 0x332FFF, 27689, 27715 },
+	{ 0x0050C2, 0x333000, 0x333FFF, 27736, 27754 },
+	{ 0x0050C2, 0x334000, 0x334FFF, 27760, 27783 },
+	{ 0x0050C2, 0x335000, 0x335FFF, 27800, 27816 },
+	{ 0x0050C2, 0x336000, 0x336FFF, 27832, 27853 },
+	{ 0x0050C2, 0x337000, 0x337FFF, 27874, 27874 },
+	{ 0x0050C2, 0x338000, 0x338FFF, 27878, 27890 },
+	{ 0x0050C2, 0x339000, 0x339FFF, 27902, 27928 },
+	{ 0x0050C2, 0x33A000, 0x33AFFF, 27944, 27964 },
+	{ 0x0050C2, 0x33B000, 0x33BFFF, 27980, 27994 },
+	{ 0x0050C2, 0x33C000, 0x33CFFF, 28008, 28016 },
+	{ 0x0050C2, 0x33D000, 0x33DFFF, 18191, 18210 },
+	{ 0x0050C2, 0x33E000, 0x33EFFF, 28024, 28043 },
+	{ 0x0050C2, 0x33F000, 0x33FFFF, 28046, 28056 },
+	{ 0x0050C2, 0x340000, 0x340FFF, 28066, 28072 },
+	{ 0x0050C2, 0x341000, 0x341FFF, 28078, 28091 },
+	{ 0x0050C2, 0x342000, 0x342FFF, 28096, 28119 },
+	{ 0x0050C2, 0x343000, 0x343FFF, 28141, 28172 },
+	{ 0x0050C2, 0x344000, 0x344FFF, 20071, 20084 },
+	{ 0x0050C2, 0x345000, 0x345FFF, 28194, 28194 },
+	{ 0x0050C2, 0x346000, 0x346FFF, 28198, 28211 },
+	{ 0x0050C2, 0x347000, 0x347FFF, 28224, 28238 },
+	{ 0x0050C2, 0x348000, 0x348FFF, 28248, 28263 },
+	{ 0x0050C2, 0x349000, 0x349FFF, 28272, 28290 },
+	{ 0x0050C2, 0x34A000, 0x34AFFF, 28308, 28324 },
+	{ 0x0050C2, 0x34B000, 0x34BFFF, 28328, 28349 },
+	{ 0x0050C2, 0x34C000, 0x34CFFF, 28356, 28386 },
+	{ 0x0050C2, 0x34D000, 0x34DFFF, 28406, 28440 },
+	{ 0x0050C2, 0x34E000, 0x34EFFF, 28469, 28531 },
+	{ 0x0050C2, 0x34F000, 0x34FFFF, 28585, 28614 },
+	{ 0x0050C2, 0x350000, 0x350FFF, 28637, 28662 },
+	{ 0x0050C2, 0x351000, 0x351FFF, 28679, 28699 },
+	{ 0x0050C2, 0x352000, 0x352FFF, 28710, 28710 },
+	{ 0x0050C2, 0x353000, 0x353FFF, 28716, 28750 },
+	{ 0x0050C2, 0x354000, 0x354FFF, 28779, 28806 },
+	{ 0x0050C2, 0x355000, 0x355FFF, 28832, 28832 },
+	{ 0x0050C2, 0x356000, 0x356FFF, 28836, 28851 },
+	{ 0x0050C2, 0x357000, 0x357FFF, 28866, 28887 },
+	{ 0x0050C2, 0x358000, 0x358FFF, 28908, 28908 },
+	{ 0x0050C2, 0x359000, 0x359FFF, 28914, 28938 },
+	{ 0x0050C2, 0x35A000, 0x35AFFF, 28957, 28983 },
+	{ 0x0050C2, 0x35B000, 0x35BFFF, 28999, 21219 },
+	{ 0x0050C2, 0x35C000, 0x35CFFF, 29023, 29036 },
+	{ 0x0050C2, 0x35D000, 0x35DFFF, 29044, 29056 },
+	{ 0x0050C2, 0x35E000, 0x35EFFF, 29068, 29083 },
+	{ 0x0050C2, 0x35F000, 0x35FFFF, 29094, 29108 },
+	{ 0x0050C2, 0x360000, 0x360FFF, 29114, 29142 },
+	{ 0x0050C2, 0x361000, 0x361FFF, 29159, 29166 },
+	{ 0x0050C2, 0x362000, 0x362FFF, 29173, 29190 },
+	{ 0x0050C2, 0x363000, 0x363FFF, 29206, 29223 },
+	{ 0x0050C2, 0x364000, 0x364FFF, 16629, 16641 },
+	{ 0x0050C2, 0x365000, 0x365FFF, 29238, 29238 },
+	{ 0x0050C2, 0x366000, 0x366FFF, 29242, 29268 },
+	{ 0x0050C2, 0x367000, 0x367FFF, 29277, 29300 },
+	{ 0x0050C2, 0x368000, 0x368FFF, 29307, 29318 },
+	{ 0x0050C2, 0x369000, 0x369FFF, 29324, 29343 },
+	{ 0x0050C2, 0x36A000, 0x36AFFF, 29362, 29385 },
+	{ 0x0050C2, 0x36B000, 0x36BFFF, 29408, 29431 },
+	{ 0x0050C2, 0x36C000, 0x36CFFF, 29439, 29451 },
+	{ 0x0050C2, 0x36D000, 0x36DFFF, 29463, 29485 },
+	{ 0x0050C2, 0x36E000, 0x36EFFF, 29506, 29535 },
+	{ 0x0050C2, 0x36F000, 0x36FFFF, 29552, 29565 },
+	{ 0x0050C2, 0x370000, 0x370FFF, 29577, 29597 },
+	{ 0x0050C2, 0x371000, 0x371FFF, 29617, 29636 },
+	{ 0x0050C2, 0x372000, 0x372FFF, 29655, 29673 },
+	{ 0x0050C2, 0x373000, 0x373FFF, 29688, 29711 },
+	{ 0x0050C2, 0x374000, 0x374FFF, 29728, 29761 },
+	{ 0x0050C2, 0x375000, 0x375FFF, 29794, 29811 },
+	{ 0x0050C2, 0x376000, 0x376FFF, 29815, 29815 },
+	{ 0x0050C2, 0x377000, 0x377FFF, 29822, 29832 },
+	{ 0x0050C2, 0x378000, 0x378FFF, 29842, 29864 },
+	{ 0x0050C2, 0x379000, 0x379FFF, 29886, 29903 },
+	{ 0x0050C2, 0x37A000, 0x37AFFF, 29915, 29931 },
+	{ 0x0050C2, 0x37B000, 0x37BFFF, 29935, 29959 },
+	{ 0x0050C2, 0x37C000, 0x37CFFF, 29983, 30006 },
+	{ 0x0050C2, 0x37D000, 0x37DFFF, 30012, 30026 },
+	{ 0x0050C2, 0x37E000, 0x37EFFF, 30035, 30049 },
+	{ 0x0050C2, 0x37F000, 0x37FFFF, 30052, 30063 },
+	{ 0x0050C2, 0x380000, 0x380FFF, 30074, 30095 },
+	{ 0x0050C2, 0x381000, 0x381FFF, 30111, 30135 },
+	{ 0x0050C2, 0x382000, 0x382FFF, 30156, 30170 },
+	{ 0x0050C2, 0x383000, 0x383FFF, 30184, 30200 },
+	{ 0x0050C2, 0x384000, 0x384FFF, 30216, 30253 },
+	{ 0x0050C2, 0x385000, 0x385FFF, 30282, 30306 },
+	{ 0x0050C2, 0x386000, 0x386FFF, 30322, 30355 },
+	{ 0x0050C2, 0x387000, 0x387FFF, 30380, 30396 },
+	{ 0x0050C2, 0x388000, 0x388FFF, 30411, 30419 },
+	{ 0x0050C2, 0x389000, 0x389FFF, 30423, 30435 },
+	{ 0x0050C2, 0x38A000, 0x38AFFF, 30442, 30466 },
+	{ 0x0050C2, 0x38B000, 0x38BFFF, 30479, 30496 },
+	{ 0x0050C2, 0x38C000, 0x38CFFF, 30508, 30520 },
+	{ 0x0050C2, 0x38D000, 0x38DFFF, 30532, 30555 },
+	{ 0x0050C2, 0x38E000, 0x38EFFF, 30578, 30594 },
+	{ 0x0050C2, 0x38F000, 0x38FFFF, 30610, 30622 },
+	{ 0x0050C2, 0x390000, 0x390FFF, 30634, 30652 },
+	{ 0x0050C2, 0x391000, 0x391FFF, 30669, 30684 },
+	{ 0x0050C2, 0x392000, 0x392FFF, 10929, 10953 },
+	{ 0x0050C2, 0x393000, 0x393FFF, 30693, 30717 },
+	{ 0x0050C2, 0x394000, 0x394FFF, 30725, 30737 },
+	{ 0x0050C2, 0x395000, 0x395FFF, 30749, 30762 },
+	{ 0x0050C2, 0x396000, 0x396FFF, 30770, 30785 },
+	{ 0x0050C2, 0x397000, 0x397FFF, 30795, 30810 },
+	{ 0x0050C2, 0x398000, 0x398FFF, 30820, 30845 },
+	{ 0x0050C2, 0x399000, 0x399FFF, 30864, 30893 },
+	{ 0x0050C2, 0x39A000, 0x39AFFF, 30917, 30942 },
+	{ 0x0050C2, 0x39B000, 0x39BFFF, 30959, 30978 },
+	{ 0x0050C2, 0x39C000, 0x39CFFF, 30989, 31009 },
+	{ 0x0050C2, 0x39D000, 0x39DFFF, 31020, 31038 },
+	{ 0x0050C2, 0x39E000, 0x39EFFF, 31050, 31074 },
+	{ 0x0050C2, 0x39F000, 0x39FFFF, 31094, 31102 },
+	{ 0x0050C2, 0x3A0000, 0x3A0FFF, 31110, 31137 },
+	{ 0x0050C2, 0x3A1000, 0x3A1FFF, 31159, 31167 },
+	{ 0x0050C2, 0x3A2000, 0x3A2FFF, 31175, 31191 },
+	{ 0x0050C2, 0x3A3000, 0x3A3FFF, 31207, 31241 },
+	{ 0x0050C2, 0x3A4000, 0x3A4FFF, 31269, 31296 },
+	{ 0x0050C2, 0x3A5000, 0x3A5FFF, 31319, 31339 },
+	{ 0x0050C2, 0x3A6000, 0x3A6FFF, 31347, 31369 },
+	{ 0x0050C2, 0x3A7000, 0x3A7FFF, 31387, 31428 },
+	{ 0x0050C2, 0x3A8000, 0x3A8FFF, 31462, 31474 },
+	{ 0x0050C2, 0x3A9000, 0x3A9FFF, 31480, 31503 },
+	{ 0x0050C2, 0x3AA000, 0x3AAFFF, 31513, 31544 },
+	{ 0x0050C2, 0x3AB000, 0x3ABFFF, 31563, 31590 },
+	{ 0x0050C2, 0x3AC000, 0x3ACFFF, 31612, 31630 },
+	{ 0x0050C2, 0x3AD000, 0x3ADFFF, 31648, 31690 },
+	{ 0x0050C2, 0x3AE000, 0x3AEFFF, 31721, 31751 },
+	{ 0x0050C2, 0x3AF000, 0x3AFFFF, 31763, 31777 },
+	{ 0x0050C2, 0x3B0000, 0x3B0FFF, 31791, 31828 },
+	{ 0x0050C2, 0x3B1000, 0x3B1FFF, 31864, 31884 },
+	{ 0x0050C2, 0x3B2000, 0x3B2FFF, 31900, 31927 },
+	{ 0x0050C2, 0x3B3000, 0x3B3FFF, 31954, 31971 },
+	{ 0x0050C2, 0x3B4000, 0x3B4FFF, 31981, 32007 },
+	{ 0x0050C2, 0x3B5000, 0x3B5FFF, 32026, 32048 },
+	{ 0x0050C2, 0x3B6000, 0x3B6FFF, 32058, 32073 },
+	{ 0x0050C2, 0x3B7000, 0x3B7FFF, 32088, 32111 },
+	{ 0x0050C2, 0x3B8000, 0x3B8FFF, 8053, 8071 },
+	{ 0x0050C2, 0x3B9000, 0x3B9FFF, 32134, 32155 },
+	{ 0x0050C2, 0x3BA000, 0x3BAFFF, 10929, 10953 },
+	{ 0x0050C2, 0x3BB000, 0x3BBFFF, 32176, 32200 },
+	{ 0x0050C2, 0x3BC000, 0x3BCFFF, 32219, 32230 },
+	{ 0x0050C2, 0x3BD000, 0x3BDFFF, 32235, 32250 },
+	{ 0x0050C2, 0x3BE000, 0x3BEFFF, 32264, 32309 },
+	{ 0x0050C2, 0x3BF000, 0x3BFFFF, 32339, 32371 },
+	{ 0x0050C2, 0x3C0000, 0x3C0FFF, 32388, 32412 },
+	{ 0x0050C2, 0x3C1000, 0x3C1FFF, 32431, 32458 },
+	{ 0x0050C2, 0x3C2000, 0x3C2FFF, 32479, 6585 },
+	{ 0x0050C2, 0x3C3000, 0x3C3FFF, 32493, 32515 },
+	{ 0x0050C2, 0x3C4000, 0x3C4FFF, 32535, 32554 },
+	{ 0x0050C2, 0x3C5000, 0x3C5FFF, 32573, 32599 },
+	{ 0x0050C2, 0x3C6000, 0x3C6FFF, 32620, 32631 },
+	{ 0x0050C2, 0x3C7000, 0x3C7FFF, 32642, 32666 },
+	{ 0x0050C2, 0x3C8000, 0x3C8FFF, 32686, 32706 },
+	{ 0x0050C2, 0x3C9000, 0x3C9FFF, 32721, 32739 },
+	{ 0x0050C2, 0x3CA000, 0x3CAFFF, 32754, 32763 },
+	{ 0x0050C2, 0x3CB000, 0x3CBFFF, 32767, 32782 },
+	{ 0x0050C2, 0x3CC000, 0x3CCFFF, 32792, 32821 },
+	{ 0x0050C2, 0x3CD000, 0x3CDFFF, 32846, 32865 },
+	{ 0x0050C2, 0x3CE000, 0x3CEFFF, 32884, 32914 },
+	{ 0x0050C2, 0x3CF000, 0x3CFFFF, 32944, 32969 },
+	{ 0x0050C2, 0x3D0000, 0x3D0FFF, 32980, 33003 },
+	{ 0x0050C2, 0x3D1000, 0x3D1FFF, 33018, 33034 },
+	{ 0x0050C2, 0x3D2000, 0x3D2FFF, 33047, 33068 },
+	{ 0x0050C2, 0x3D3000, 0x3D3FFF, 33089, 33113 },
+	{ 0x0050C2, 0x3D4000, 0x3D4FFF, 33132, 33157 },
+	{ 0x0050C2, 0x3D5000, 0x3D5FFF, 33173, 33221 },
+	{ 0x0050C2, 0x3D6000, 0x3D6FFF, 33268, 33280 },
+	{ 0x0050C2, 0x3D7000, 0x3D7FFF, 33287, 33310 },
+	{ 0x0050C2, 0x3D8000, 0x3D8FFF, 33329, 33348 },
+	{ 0x0050C2, 0x3D9000, 0x3D9FFF, 33352, 33381 },
+	{ 0x0050C2, 0x3DA000, 0x3DAFFF, 33405, 33421 },
+	{ 0x0050C2, 0x3DB000, 0x3DBFFF, 33429, 33443 },
+	{ 0x0050C2, 0x3DC000, 0x3DCFFF, 33452, 33469 },
+	{ 0x0050C2, 0x3DD000, 0x3DDFFF, 33486, 33497 },
+	{ 0x0050C2, 0x3DE000, 0x3DEFFF, 28469, 28531 },
+	{ 0x0050C2, 0x3DF000, 0x3DFFFF, 33503, 33514 },
+	{ 0x0050C2, 0x3E0000, 0x3E0FFF, 33520, 33537 },
+	{ 0x0050C2, 0x3E1000, 0x3E1FFF, 33550, 33571 },
+	{ 0x0050C2, 0x3E2000, 0x3E2FFF, 33592, 33600 },
+	{ 0x0050C2, 0x3E3000, 0x3E3FFF, 33608, 33651 },
+	{ 0x0050C2, 0x3E4000, 0x3E4FFF, 33692, 33702 },
+	{ 0x0050C2, 0x3E5000, 0x3E5FFF, 33706, 33716 },
+	{ 0x0050C2, 0x3E6000, 0x3E6FFF, 33726, 33726 },
+	{ 0x0050C2, 0x3E7000, 0x3E7FFF, 33731, 33756 },
+	{ 0x0050C2, 0x3E8000, 0x3E8FFF, 33777, 33804 },
+	{ 0x0050C2, 0x3E9000, 0x3E9FFF, 33817, 33837 },
+	{ 0x0050C2, 0x3EA000, 0x3EAFFF, 33857, 33885 },
+	{ 0x0050C2, 0x3EB000, 0x3EBFFF, 33902, 33920 },
+	{ 0x0050C2, 0x3EC000, 0x3ECFFF, 33924, 33932 },
+	{ 0x0050C2, 0x3ED000, 0x3EDFFF, 33940, 33960 },
+	{ 0x0050C2, 0x3EE000, 0x3EEFFF, 33975, 33988 },
+	{ 0x0050C2, 0x3EF000, 0x3EFFFF, 33996, 34044 },
+	{ 0x0050C2, 0x3F0000, 0x3F0FFF, 34080, 34104 },
+	{ 0x0050C2, 0x3F1000, 0x3F1FFF, 34112, 34143 },
+	{ 0x0050C2, 0x3F2000, 0x3F2FFF, 34171, 34180 },
+	{ 0x0050C2, 0x3F3000, 0x3F3FFF, 34184, 34210 },
+	{ 0x0050C2, 0x3F4000, 0x3F4FFF, 34233, 34252 },
+	{ 0x0050C2, 0x3F5000, 0x3F5FFF, 34255, 34272 },
+	{ 0x0050C2, 0x3F6000, 0x3F6FFF, 34281, 34298 },
+	{ 0x0050C2, 0x3F7000, 0x3F7FFF, 34307, 34321 },
+	{ 0x0050C2, 0x3F8000, 0x3F8FFF, 34335, 34347 },
+	{ 0x0050C2, 0x3F9000, 0x3F9FFF, 34355, 34367 },
+	{ 0x0050C2, 0x3FA000, 0x3FAFFF, 34375, 34382 },
+	{ 0x0050C2, 0x3FB000, 0x3FBFFF, 18578, 18598 },
+	{ 0x0050C2, 0x3FC000, 0x3FCFFF, 34389, 34417 },
+	{ 0x0050C2, 0x3FD000, 0x3FDFFF, 34440, 34462 },
+	{ 0x0050C2, 0x3FE000, 0x3FEFFF, 34484, 34506 },
+	{ 0x0050C2, 0x3FF000, 0x3FFFFF, 34516, 34534 },
+	{ 0x0050C2, 0x400000, 0x400FFF, 34544, 34558 },
+	{ 0x0050C2, 0x401000, 0x401FFF, 34572, 34593 },
+	{ 0x0050C2, 0x402000, 0x402FFF, 34614, 34633 },
+	{ 0x0050C2, 0x403000, 0x403FFF, 34650, 34673 },
+	{ 0x0050C2, 0x404000, 0x404FFF, 34693, 34714 },
+	{ 0x0050C2, 0x405000, 0x405FFF, 34728, 34751 },
+	{ 0x0050C2, 0x406000, 0x406FFF, 34758, 34774 },
+	{ 0x0050C2, 0x407000, 0x407FFF, 34785, 34796 },
+	{ 0x0050C2, 0x408000, 0x408FFF, 34807, 34818 },
+	{ 0x0050C2, 0x409000, 0x409FFF, 34823, 34832 },
+	{ 0x0050C2, 0x40A000, 0x40AFFF, 34837, 34880 },
+	{ 0x0050C2, 0x40B000, 0x40BFFF, 34916, 34933 },
+	{ 0x0050C2, 0x40C000, 0x40CFFF, 34950, 34975 },
+	{ 0x0050C2, 0x40D000, 0x40DFFF, 34996, 35020 },
+	{ 0x0050C2, 0x40E000, 0x40EFFF, 20071, 20084 },
+	{ 0x0050C2, 0x40F000, 0x40FFFF, 35040, 35049 },
+	{ 0x0050C2, 0x410000, 0x410FFF, 1361, 1386 },
+	{ 0x0050C2, 0x411000, 0x411FFF, 35053, 35079 },
+	{ 0x0050C2, 0x412000, 0x412FFF, 35092, 35111 },
+	{ 0x0050C2, 0x413000, 0x413FFF, 35125, 35134 },
+	{ 0x0050C2, 0x414000, 0x414FFF, 35143, 35168 },
+	{ 0x0050C2, 0x415000, 0x415FFF, 35190, 35205 },
+	{ 0x0050C2, 0x416000, 0x416FFF, 35215, 24312 },
+	{ 0x0050C2, 0x417000, 0x417FFF, 35228, 35242 },
+	{ 0x0050C2, 0x418000, 0x418FFF, 35248, 35258 },
+	{ 0x0050C2, 0x419000, 0x419FFF, 35268, 35278 },
+	{ 0x0050C2, 0x41A000, 0x41AFFF, 35288, 35310 },
+	{ 0x0050C2, 0x41B000, 0x41BFFF, 35320, 35356 },
+	{ 0x0050C2, 0x41C000, 0x41CFFF, 35387, 35403 },
+	{ 0x0050C2, 0x41D000, 0x41DFFF, 35413, 35428 },
+	{ 0x0050C2, 0x41E000, 0x41EFFF, 35437, 35473 },
+	{ 0x0050C2, 0x41F000, 0x41FFFF, 35508, 35522 },
+	{ 0x0050C2, 0x420000, 0x420FFF, 35531, 35554 },
+	{ 0x0050C2, 0x421000, 0x421FFF, 35577, 35577 },
+	{ 0x0050C2, 0x422000, 0x422FFF, 20071, 20084 },
+	{ 0x0050C2, 0x423000, 0x423FFF, 35583, 35598 },
+	{ 0x0050C2, 0x424000, 0x424FFF, 35608, 35631 },
+	{ 0x0050C2, 0x425000, 0x425FFF, 35640, 35660 },
+	{ 0x0050C2, 0x426000, 0x426FFF, 35669, 35681 },
+	{ 0x0050C2, 0x427000, 0x427FFF, 35693, 35717 },
+	{ 0x0050C2, 0x428000, 0x428FFF, 35734, 35744 },
+	{ 0x0050C2, 0x429000, 0x429FFF, 35754, 35775 },
+	{ 0x0050C2, 0x42A000, 0x42AFFF, 14445, 712 },
+	{ 0x0050C2, 0x42B000, 0x42BFFF, 35796, 21219 },
+	{ 0x0050C2, 0x42C000, 0x42CFFF, 35821, 35848 },
+	{ 0x0050C2, 0x42D000, 0x42DFFF, 35871, 35881 },
+	{ 0x0050C2, 0x42E000, 0x42EFFF, 35891, 35915 },
+	{ 0x0050C2, 0x42F000, 0x42FFFF, 35934, 35942 },
+	{ 0x0050C2, 0x430000, 0x430FFF, 35950, 35964 },
+	{ 0x0050C2, 0x431000, 0x431FFF, 35978, 35993 },
+	{ 0x0050C2, 0x432000, 0x432FFF, 36002, 36025 },
+	{ 0x0050C2, 0x433000, 0x433FFF, 36043, 36063 },
+	{ 0x0050C2, 0x434000, 0x434FFF, 36078, 36097 },
+	{ 0x0050C2, 0x435000, 0x435FFF, 36116, 36147 },
+	{ 0x0050C2, 0x436000, 0x436FFF, 36173, 36195 },
+	{ 0x0050C2, 0x437000, 0x437FFF, 36214, 36228 },
+	{ 0x0050C2, 0x438000, 0x438FFF, 36237, 36277 },
+	{ 0x0050C2, 0x439000, 0x439FFF, 36309, 36334 },
+	{ 0x0050C2, 0x43A000, 0x43AFFF, 36351, 36366 },
+	{ 0x0050C2, 0x43B000, 0x43BFFF, 36376, 36376 },
+	{ 0x0050C2, 0x43C000, 0x43CFFF, 36381, 36416 },
+	{ 0x0050C2, 0x43D000, 0x43DFFF, 36446, 36475 },
+	{ 0x0050C2, 0x43E000, 0x43EFFF, 36492, 36502 },
+	{ 0x0050C2, 0x43F000, 0x43FFFF, 36512, 36538 },
+	{ 0x0050C2, 0x440000, 0x440FFF, 36561, 36593 },
+	{ 0x0050C2, 0x441000, 0x441FFF, 36620, 36654 },
+	{ 0x0050C2, 0x442000, 0x442FFF, 36672, 36693 },
+	{ 0x0050C2, 0x443000, 0x443FFF, 36708, 36731 },
+	{ 0x0050C2, 0x444000, 0x444FFF, 36754, 36775 },
+	{ 0x0050C2, 0x445000, 0x445FFF, 36784, 36800 },
+	{ 0x0050C2, 0x446000, 0x446FFF, 36815, 36833 },
+	{ 0x0050C2, 0x447000, 0x447FFF, 36847, 36865 },
+	{ 0x0050C2, 0x448000, 0x448FFF, 36878, 36899 },
+	{ 0x0050C2, 0x449000, 0x449FFF, 36907, 36932 },
+	{ 0x0050C2, 0x44A000, 0x44AFFF, 36952, 36977 },
+	{ 0x0050C2, 0x44B000, 0x44BFFF, 37002, 37023 },
+	{ 0x0050C2, 0x44C000, 0x44CFFF, 37030, 37056 },
+	{ 0x0050C2, 0x44D000, 0x44DFFF, 37069, 37098 },
+	{ 0x0050C2, 0x44E000, 0x44EFFF, 37121, 37139 },
+	{ 0x0050C2, 0x44F000, 0x44FFFF, 37142, 37156 },
+	{ 0x0050C2, 0x450000, 0x450FFF, 37165, 37199 },
+	{ 0x0050C2, 0x451000, 0x451FFF, 37228, 37239 },
+	{ 0x0050C2, 0x452000, 0x452FFF, 37245, 37263 },
+	{ 0x0050C2, 0x453000, 0x453FFF, 37281, 37301 },
+	{ 0x0050C2, 0x454000, 0x454FFF, 37316, 37335 },
+	{ 0x0050C2, 0x455000, 0x455FFF, 37341, 37349 },
+	{ 0x0050C2, 0x456000, 0x456FFF, 37357, 37373 },
+	{ 0x0050C2, 0x457000, 0x457FFF, 37389, 37399 },
+	{ 0x0050C2, 0x458000, 0x458FFF, 37409, 37423 },
+	{ 0x0050C2, 0x459000, 0x459FFF, 10929, 10953 },
+	{ 0x0050C2, 0x45A000, 0x45AFFF, 37432, 37465 },
+	{ 0x0050C2, 0x45B000, 0x45BFFF, 37482, 37501 },
+	{ 0x0050C2, 0x45C000, 0x45CFFF, 37520, 37544 },
+	{ 0x0050C2, 0x45D000, 0x45DFFF, 37552, 37578 },
+	{ 0x0050C2, 0x45E000, 0x45EFFF, 37598, 37636 },
+	{ 0x0050C2, 0x45F000, 0x45FFFF, 37672, 37689 },
+	{ 0x0050C2, 0x460000, 0x460FFF, 37706, 37715 },
+	{ 0x0050C2, 0x461000, 0x461FFF, 37724, 16641 },
+	{ 0x0050C2, 0x462000, 0x462FFF, 37736, 37747 },
+	{ 0x0050C2, 0x463000, 0x463FFF, 37758, 37778 },
+	{ 0x0050C2, 0x464000, 0x464FFF, 37784, 37810 },
+	{ 0x0050C2, 0x465000, 0x465FFF, 37836, 37846 },
+	{ 0x0050C2, 0x466000, 0x466FFF, 37851, 37865 },
+	{ 0x0050C2, 0x467000, 0x467FFF, 37871, 37899 },
+	{ 0x0050C2, 0x468000, 0x468FFF, 37927, 37939 },
+	{ 0x0050C2, 0x469000, 0x469FFF, 37951, 37975 },
+	{ 0x0050C2, 0x46A000, 0x46AFFF, 37993, 38002 },
+	{ 0x0050C2, 0x46B000, 0x46BFFF, 38006, 38020 },
+	{ 0x0050C2, 0x46C000, 0x46CFFF, 38029, 38040 },
+	{ 0x0050C2, 0x46D000, 0x46DFFF, 38046, 38075 },
+	{ 0x0050C2, 0x46E000, 0x46EFFF, 38102, 38127 },
+	{ 0x0050C2, 0x46F000, 0x46FFFF, 38147, 38157 },
+	{ 0x0050C2, 0x470000, 0x470FFF, 38167, 2483 },
+	{ 0x0050C2, 0x471000, 0x471FFF, 38181, 38208 },
+	{ 0x0050C2, 0x472000, 0x472FFF, 38229, 38237 },
+	{ 0x0050C2, 0x473000, 0x473FFF, 38241, 38272 },
+	{ 0x0050C2, 0x474000, 0x474FFF, 38295, 38309 },
+	{ 0x0050C2, 0x475000, 0x475FFF, 38317, 38329 },
+	{ 0x0050C2, 0x476000, 0x476FFF, 38336, 38349 },
+	{ 0x0050C2, 0x477000, 0x477FFF, 38355, 38372 },
+	{ 0x0050C2, 0x478000, 0x478FFF, 38389, 38402 },
+	{ 0x0050C2, 0x479000, 0x479FFF, 38410, 38434 },
+	{ 0x0050C2, 0x47A000, 0x47AFFF, 25668, 25693 },
+	{ 0x0050C2, 0x47B000, 0x47BFFF, 38454, 38472 },
+	{ 0x0050C2, 0x47C000, 0x47CFFF, 38485, 38498 },
+	{ 0x0050C2, 0x47D000, 0x47DFFF, 38506, 38514 },
+	{ 0x0050C2, 0x47E000, 0x47EFFF, 38518, 38552 },
+	{ 0x0050C2, 0x47F000, 0x47FFFF, 38581, 38591 },
+	{ 0x0050C2, 0x480000, 0x480FFF, 38596, 38608 },
+	{ 0x0050C2, 0x481000, 0x481FFF, 38615, 38638 },
+	{ 0x0050C2, 0x482000, 0x482FFF, 38647, 38678 },
+	{ 0x0050C2, 0x483000, 0x483FFF, 38706, 38706 },
+	{ 0x0050C2, 0x484000, 0x484FFF, 38710, 38723 },
+	{ 0x0050C2, 0x485000, 0x485FFF, 10929, 10953 },
+	{ 0x0050C2, 0x486000, 0x486FFF, 38732, 38758 },
+	{ 0x0050C2, 0x487000, 0x487FFF, 38770, 38789 },
+	{ 0x0050C2, 0x488000, 0x488FFF, 38796, 38811 },
+	{ 0x0050C2, 0x489000, 0x489FFF, 38826, 38844 },
+	{ 0x0050C2, 0x48A000, 0x48AFFF, 38862, 38882 },
+	{ 0x0050C2, 0x48B000, 0x48BFFF, 20071, 20084 },
+	{ 0x0050C2, 0x48C000, 0x48CFFF, 38896, 38906 },
+	{ 0x0050C2, 0x48D000, 0x48DFFF, 38913, 38931 },
+	{ 0x0050C2, 0x48E000, 0x48EFFF, 38947, 38963 },
+	{ 0x0050C2, 0x48F000, 0x48FFFF, 38979, 38998 },
+	{ 0x0050C2, 0x490000, 0x490FFF, 39008, 39028 },
+	{ 0x0050C2, 0x491000, 0x491FFF, 16856, 16870 },
+	{ 0x0050C2, 0x492000, 0x492FFF, 39036, 39047 },
+	{ 0x0050C2, 0x493000, 0x493FFF, 39058, 39069 },
+	{ 0x0050C2, 0x494000, 0x494FFF, 39075, 39101 },
+	{ 0x0050C2, 0x495000, 0x495FFF, 39110, 39129 },
+	{ 0x0050C2, 0x496000, 0x496FFF, 39148, 39171 },
+	{ 0x0050C2, 0x497000, 0x497FFF, 39182, 39226 },
+	{ 0x0050C2, 0x498000, 0x498FFF, 39254, 39279 },
+	{ 0x0050C2, 0x499000, 0x499FFF, 39287, 39304 },
+	{ 0x0050C2, 0x49A000, 0x49AFFF, 39321, 39350 },
+	{ 0x0050C2, 0x49B000, 0x49BFFF, 39372, 39389 },
+	{ 0x0050C2, 0x49C000, 0x49CFFF, 39401, 39429 },
+	{ 0x0050C2, 0x49D000, 0x49DFFF, 39452, 39470 },
+	{ 0x0050C2, 0x49E000, 0x49EFFF, 39484, 39502 },
+	{ 0x0050C2, 0x49F000, 0x49FFFF, 39512, 39521 },
+	{ 0x0050C2, 0x4A0000, 0x4A0FFF, 39525, 39571 },
+	{ 0x0050C2, 0x4A1000, 0x4A1FFF, 18578, 18598 },
+	{ 0x0050C2, 0x4A2000, 0x4A2FFF, 39609, 39620 },
+	{ 0x0050C2, 0x4A3000, 0x4A3FFF, 39626, 39653 },
+	{ 0x0050C2, 0x4A4000, 0x4A4FFF, 39674, 39688 },
+	{ 0x0050C2, 0x4A5000, 0x4A5FFF, 39702, 39724 },
+	{ 0x0050C2, 0x4A6000, 0x4A6FFF, 39746, 39786 },
+	{ 0x0050C2, 0x4A7000, 0x4A7FFF, 39816, 39844 },
+	{ 0x0050C2, 0x4A8000, 0x4A8FFF, 39867, 39880 },
+	{ 0x0050C2, 0x4A9000, 0x4A9FFF, 39893, 39914 },
+	{ 0x0050C2, 0x4AA000, 0x4AAFFF, 39932, 39955 },
+	{ 0x0050C2, 0x4AB000, 0x4ABFFF, 39973, 39996 },
+	{ 0x0050C2, 0x4AC000, 0x4ACFFF, 40014, 40030 },
+	{ 0x0050C2, 0x4AD000, 0x4ADFFF, 40037, 40052 },
+	{ 0x0050C2, 0x4AE000, 0x4AEFFF, 20071, 20084 },
+	{ 0x0050C2, 0x4AF000, 0x4AFFFF, 40061, 40070 },
+	{ 0x0050C2, 0x4B0000, 0x4B0FFF, 40079, 40107 },
+	{ 0x0050C2, 0x4B1000, 0x4B1FFF, 40131, 40172 },
+	{ 0x0050C2, 0x4B2000, 0x4B2FFF, 40192, 40204 },
+	{ 0x0050C2, 0x4B3000, 0x4B3FFF, 40210, 40227 },
+	{ 0x0050C2, 0x4B4000, 0x4B4FFF, 40232, 40253 },
+	{ 0x0050C2, 0x4B5000, 0x4B5FFF, 40274, 40292 },
+	{ 0x0050C2, 0x4B6000, 0x4B6FFF, 40310, 40338 },
+	{ 0x0050C2, 0x4B7000, 0x4B7FFF, 4347, 4363 },
+	{ 0x0050C2, 0x4B8000, 0x4B8FFF, 40356, 40392 },
+	{ 0x0050C2, 0x4B9000, 0x4B9FFF, 40423, 40441 },
+	{ 0x0050C2, 0x4BA000, 0x4BAFFF, 40459, 40482 },
+	{ 0x0050C2, 0x4BB000, 0x4BBFFF, 40505, 40522 },
+	{ 0x0050C2, 0x4BC000, 0x4BCFFF, 40539, 6725 },
+	{ 0x0050C2, 0x4BD000, 0x4BDFFF, 40564, 40573 },
+	{ 0x0050C2, 0x4BE000, 0x4BEFFF, 40582, 40605 },
+	{ 0x0050C2, 0x4BF000, 0x4BFFFF, 40622, 40652 },
+	{ 0x0050C2, 0x4C0000, 0x4C0FFF, 40670, 40693 },
+	{ 0x0050C2, 0x4C1000, 0x4C1FFF, 8180, 8201 },
+	{ 0x0050C2, 0x4C2000, 0x4C2FFF, 7481, 7500 },
+	{ 0x0050C2, 0x4C3000, 0x4C3FFF, 40703, 40719 },
+	{ 0x0050C2, 0x4C4000, 0x4C4FFF, 40729, 40755 },
+	{ 0x0050C2, 0x4C5000, 0x4C5FFF, 40775, 40796 },
+	{ 0x0050C2, 0x4C6000, 0x4C6FFF, 40812, 40823 },
+	{ 0x0050C2, 0x4C7000, 0x4C7FFF, 40829, 40848 },
+	{ 0x0050C2, 0x4C8000, 0x4C8FFF, 40866, 40872 },
+	{ 0x0050C2, 0x4C9000, 0x4C9FFF, 40878, 40890 },
+	{ 0x0050C2, 0x4CA000, 0x4CAFFF, 40902, 40926 },
+	{ 0x0050C2, 0x4CB000, 0x4CBFFF, 40942, 40961 },
+	{ 0x0050C2, 0x4CC000, 0x4CCFFF, 40968, 40986 },
+	{ 0x0050C2, 0x4CD000, 0x4CDFFF, 40996, 41009 },
+	{ 0x0050C2, 0x4CE000, 0x4CEFFF, 41019, 41047 },
+	{ 0x0050C2, 0x4CF000, 0x4CFFFF, 41067, 41082 },
+	{ 0x0050C2, 0x4D0000, 0x4D0FFF, 41094, 41120 },
+	{ 0x0050C2, 0x4D1000, 0x4D1FFF, 41142, 41160 },
+	{ 0x0050C2, 0x4D2000, 0x4D2FFF, 41176, 41201 },
+	{ 0x0050C2, 0x4D3000, 0x4D3FFF, 41221, 41239 },
+	{ 0x0050C2, 0x4D4000, 0x4D4FFF, 41255, 41277 },
+	{ 0x0050C2, 0x4D5000, 0x4D5FFF, 41299, 41319 },
+	{ 0x0050C2, 0x4D6000, 0x4D6FFF, 41335, 41358 },
+	{ 0x0050C2, 0x4D7000, 0x4D7FFF, 10145, 10174 },
+	{ 0x0050C2, 0x4D8000, 0x4D8FFF, 41381, 41394 },
+	{ 0x0050C2, 0x4D9000, 0x4D9FFF, 41402, 41421 },
+	{ 0x0050C2, 0x4DA000, 0x4DAFFF, 41440, 41455 },
+	{ 0x0050C2, 0x4DB000, 0x4DBFFF, 41465, 41492 },
+	{ 0x0050C2, 0x4DC000, 0x4DCFFF, 9309, 9331 },
+	{ 0x0050C2, 0x4DD000, 0x4DDFFF, 41514, 41541 },
+	{ 0x0050C2, 0x4DE000, 0x4DEFFF, 18191, 18210 },
+	{ 0x0050C2, 0x4DF000, 0x4DFFFF, 41561, 41577 },
+	{ 0x0050C2, 0x4E0000, 0x4E0FFF, 41593, 41604 },
+	{ 0x0050C2, 0x4E1000, 0x4E1FFF, 41615, 41630 },
+	{ 0x0050C2, 0x4E2000, 0x4E2FFF, 41645, 41679 },
+	{ 0x0050C2, 0x4E3000, 0x4E3FFF, 41713, 41729 },
+	{ 0x0050C2, 0x4E4000, 0x4E4FFF, 41741, 41756 },
+	{ 0x0050C2, 0x4E5000, 0x4E5FFF, 41766, 41783 },
+	{ 0x0050C2, 0x4E6000, 0x4E6FFF, 41788, 9153 },
+	{ 0x0050C2, 0x4E7000, 0x4E7FFF, 41811, 41840 },
+	{ 0x0050C2, 0x4E8000, 0x4E8FFF, 41869, 41886 },
+	{ 0x0050C2, 0x4E9000, 0x4E9FFF, 41901, 41925 },
+	{ 0x0050C2, 0x4EA000, 0x4EAFFF, 12180, 12180 },
+	{ 0x0050C2, 0x4EB000, 0x4EBFFF, 41935, 41959 },
+	{ 0x0050C2, 0x4EC000, 0x4ECFFF, 41980, 42021 },
+	{ 0x0050C2, 0x4ED000, 0x4EDFFF, 42049, 42073 },
+	{ 0x0050C2, 0x4EE000, 0x4EEFFF, 42092, 42134 },
+	{ 0x0050C2, 0x4EF000, 0x4EFFFF, 42166, 42196 },
+	{ 0x0050C2, 0x4F0000, 0x4F0FFF, 33817, 33837 },
+	{ 0x0050C2, 0x4F1000, 0x4F1FFF, 42226, 42245 },
+	{ 0x0050C2, 0x4F2000, 0x4F2FFF, 42259, 42272 },
+	{ 0x0050C2, 0x4F3000, 0x4F3FFF, 42282, 42311 },
+	{ 0x0050C2, 0x4F4000, 0x4F4FFF, 42340, 42340 },
+	{ 0x0050C2, 0x4F5000, 0x4F5FFF, 42346, 42371 },
+	{ 0x0050C2, 0x4F6000, 0x4F6FFF, 42390, 42402 },
+	{ 0x0050C2, 0x4F7000, 0x4F7FFF, 15233, 15240 },
+	{ 0x0050C2, 0x4F8000, 0x4F8FFF, 42408, 42434 },
+	{ 0x0050C2, 0x4F9000, 0x4F9FFF, 42441, 42464 },
+	{ 0x0050C2, 0x4FA000, 0x4FAFFF, 42482, 42509 },
+	{ 0x0050C2, 0x4FB000, 0x4FBFFF, 42519, 42540 },
+	{ 0x0050C2, 0x4FC000, 0x4FCFFF, 42550, 42575 },
+	{ 0x0050C2, 0x4FD000, 0x4FDFFF, 42596, 42622 },
+	{ 0x0050C2, 0x4FE000, 0x4FEFFF, 42648, 42668 },
+	{ 0x0050C2, 0x4FF000, 0x4FFFFF, 42688, 42699 },
+	{ 0x0050C2, 0x500000, 0x500FFF, 42705, 42726 },
+	{ 0x0050C2, 0x501000, 0x501FFF, 42733, 42749 },
+	{ 0x0050C2, 0x502000, 0x502FFF, 42757, 42783 },
+	{ 0x0050C2, 0x503000, 0x503FFF, 42793, 42810 },
+	{ 0x0050C2, 0x504000, 0x504FFF, 42822, 42841 },
+	{ 0x0050C2, 0x505000, 0x505FFF, 11821, 11840 },
+	{ 0x0050C2, 0x506000, 0x506FFF, 42847, 42854 },
+	{ 0x0050C2, 0x507000, 0x507FFF, 42861, 42883 },
+	{ 0x0050C2, 0x508000, 0x508FFF, 42901, 24381 },
+	{ 0x0050C2, 0x509000, 0x509FFF, 42931, 42960 },
+	{ 0x0050C2, 0x50A000, 0x50AFFF, 18381, 4556 },
+	{ 0x0050C2, 0x50B000, 0x50BFFF, 42983, 42999 },
+	{ 0x0050C2, 0x50C000, 0x50CFFF, 43011, 43040 },
+	{ 0x0050C2, 0x50D000, 0x50DFFF, 43048, 43070 },
+	{ 0x0050C2, 0x50E000, 0x50EFFF, 43086, 43110 },
+	{ 0x0050C2, 0x50F000, 0x50FFFF, 43122, 43146 },
+	{ 0x0050C2, 0x510000, 0x510FFF, 43170, 43188 },
+	{ 0x0050C2, 0x511000, 0x511FFF, 43206, 43216 },
+	{ 0x0050C2, 0x512000, 0x512FFF, 43226, 43247 },
+	{ 0x0050C2, 0x513000, 0x513FFF, 43263, 43302 },
+	{ 0x0050C2, 0x514000, 0x514FFF, 43336, 43367 },
+	{ 0x0050C2, 0x515000, 0x515FFF, 43386, 43413 },
+	{ 0x0050C2, 0x516000, 0x516FFF, 43434, 43458 },
+	{ 0x0050C2, 0x517000, 0x517FFF, 43472, 43490 },
+	{ 0x0050C2, 0x518000, 0x518FFF, 43508, 43531 },
+	{ 0x0050C2, 0x519000, 0x519FFF, 43549, 43563 },
+	{ 0x0050C2, 0x51A000, 0x51AFFF, 43571, 43587 },
+	{ 0x0050C2, 0x51B000, 0x51BFFF, 43597, 43616 },
+	{ 0x0050C2, 0x51C000, 0x51CFFF, 43631, 43643 },
+	{ 0x0050C2, 0x51D000, 0x51DFFF, 43647, 43647 },
+	{ 0x0050C2, 0x51E000, 0x51EFFF, 43653, 43672 },
+	{ 0x0050C2, 0x51F000, 0x51FFFF, 43691, 43719 },
+	{ 0x0050C2, 0x520000, 0x520FFF, 43733, 43755 },
+	{ 0x0050C2, 0x521000, 0x521FFF, 43777, 43795 },
+	{ 0x0050C2, 0x522000, 0x522FFF, 43813, 43831 },
+	{ 0x0050C2, 0x523000, 0x523FFF, 43843, 43881 },
+	{ 0x0050C2, 0x524000, 0x524FFF, 43919, 43933 },
+	{ 0x0050C2, 0x525000, 0x525FFF, 43943, 43951 },
+	{ 0x0050C2, 0x526000, 0x526FFF, 43959, 43978 },
+	{ 0x0050C2, 0x527000, 0x527FFF, 43987, 44000 },
+	{ 0x0050C2, 0x528000, 0x528FFF, 16629, 16641 },
+	{ 0x0050C2, 0x529000, 0x529FFF, 10929, 10953 },
+	{ 0x0050C2, 0x52A000, 0x52AFFF, 44008, 44028 },
+	{ 0x0050C2, 0x52B000, 0x52BFFF, 27631, 27641 },
+	{ 0x0050C2, 0x52C000, 0x52CFFF, 44044, 44061 },
+	{ 0x0050C2, 0x52D000, 0x52DFFF, 44078, 44099 },
+	{ 0x0050C2, 0x52E000, 0x52EFFF, 14445, 712 },
+	{ 0x0050C2, 0x52F000, 0x52FFFF, 44120, 44178 },
+	{ 0x0050C2, 0x530000, 0x530FFF, 44231, 7625 },
+	{ 0x0050C2, 0x531000, 0x531FFF, 22117, 22140 },
+	{ 0x0050C2, 0x532000, 0x532FFF, 44258, 44274 },
+	{ 0x0050C2, 0x533000, 0x533FFF, 34693, 34714 },
+	{ 0x0050C2, 0x534000, 0x534FFF, 44278, 44294 },
+	{ 0x0050C2, 0x535000, 0x535FFF, 44309, 44327 },
+	{ 0x0050C2, 0x536000, 0x536FFF, 44344, 44359 },
+	{ 0x0050C2, 0x537000, 0x537FFF, 44374, 44389 },
+	{ 0x0050C2, 0x538000, 0x538FFF, 44404, 44422 },
+	{ 0x0050C2, 0x539000, 0x539FFF, 44440, 44466 },
+	{ 0x0050C2, 0x53A000, 0x53AFFF, 44476, 44505 },
+	{ 0x0050C2, 0x53B000, 0x53BFFF, 44526, 44542 },
+	{ 0x0050C2, 0x53C000, 0x53CFFF, 44549, 44561 },
+	{ 0x0050C2, 0x53D000, 0x53DFFF, 44573, 44609 },
+	{ 0x0050C2, 0x53E000, 0x53EFFF, 44644, 44654 },
+	{ 0x0050C2, 0x53F000, 0x53FFFF, 44664, 44676 },
+	{ 0x0050C2, 0x540000, 0x540FFF, 44687, 44712 },
+	{ 0x0050C2, 0x541000, 0x541FFF, 44737, 44750 },
+	{ 0x0050C2, 0x542000, 0x542FFF, 44763, 44792 },
+	{ 0x0050C2, 0x543000, 0x543FFF, 44815, 44828 },
+	{ 0x0050C2, 0x544000, 0x544FFF, 44838, 44845 },
+	{ 0x0050C2, 0x545000, 0x545FFF, 44852, 44871 },
+	{ 0x0050C2, 0x546000, 0x546FFF, 44880, 44922 },
+	{ 0x0050C2, 0x547000, 0x547FFF, 14303, 14332 },
+	{ 0x0050C2, 0x548000, 0x548FFF, 44964, 44981 },
+	{ 0x0050C2, 0x549000, 0x549FFF, 44997, 45012 },
+	{ 0x0050C2, 0x54A000, 0x54AFFF, 45020, 45040 },
+	{ 0x0050C2, 0x54B000, 0x54BFFF, 45058, 45067 },
+	{ 0x0050C2, 0x54C000, 0x54CFFF, 45076, 45090 },
+	{ 0x0050C2, 0x54D000, 0x54DFFF, 45104, 45118 },
+	{ 0x0050C2, 0x54E000, 0x54EFFF, 45132, 45150 },
+	{ 0x0050C2, 0x54F000, 0x54FFFF, 45168, 45181 },
+	{ 0x0050C2, 0x550000, 0x550FFF, 45191, 45224 },
+	{ 0x0050C2, 0x551000, 0x551FFF, 45252, 45275 },
+	{ 0x0050C2, 0x552000, 0x552FFF, 45298, 45309 },
+	{ 0x0050C2, 0x553000, 0x553FFF, 45315, 45326 },
+	{ 0x0050C2, 0x554000, 0x554FFF, 45337, 45364 },
+	{ 0x0050C2, 0x555000, 0x555FFF, 45386, 45422 },
+	{ 0x0050C2, 0x556000, 0x556FFF, 45452, 45476 },
+	{ 0x0050C2, 0x557000, 0x557FFF, 45500, 45517 },
+	{ 0x0050C2, 0x558000, 0x558FFF, 45527, 45548 },
+	{ 0x0050C2, 0x559000, 0x559FFF, 45564, 45588 },
+	{ 0x0050C2, 0x55A000, 0x55AFFF, 45608, 45628 },
+	{ 0x0050C2, 0x55B000, 0x55BFFF, 45634, 45664 },
+	{ 0x0050C2, 0x55C000, 0x55CFFF, 20071, 20084 },
+	{ 0x0050C2, 0x55D000, 0x55DFFF, 20008, 20028 },
+	{ 0x0050C2, 0x55E000, 0x55EFFF, 45686, 45710 },
+	{ 0x0050C2, 0x55F000, 0x55FFFF, 45733, 45750 },
+	{ 0x0050C2, 0x560000, 0x560FFF, 10332, 10351 },
+	{ 0x0050C2, 0x561000, 0x561FFF, 45767, 45790 },
+	{ 0x0050C2, 0x562000, 0x562FFF, 45808, 45828 },
+	{ 0x0050C2, 0x563000, 0x563FFF, 45832, 45845 },
+	{ 0x0050C2, 0x564000, 0x564FFF, 45852, 45867 },
+	{ 0x0050C2, 0x565000, 0x565FFF, 45882, 45923 },
+	{ 0x0050C2, 0x566000, 0x566FFF, 45964, 45982 },
+	{ 0x0050C2, 0x567000, 0x567FFF, 45992, 46002 },
+	{ 0x0050C2, 0x568000, 0x568FFF, 46007, 46021 },
+	{ 0x0050C2, 0x569000, 0x569FFF, 46030, 46058 },
+	{ 0x0050C2, 0x56A000, 0x56AFFF, 36847, 36865 },
+	{ 0x0050C2, 0x56B000, 0x56BFFF, 46077, 46100 },
+	{ 0x0050C2, 0x56C000, 0x56CFFF, 46123, 46150 },
+	{ 0x0050C2, 0x56D000, 0x56DFFF, 46172, 46200 },
+	{ 0x0050C2, 0x56E000, 0x56EFFF, 46215, 46253 },
+	{ 0x0050C2, 0x56F000, 0x56FFFF, 46290, 46299 },
+	{ 0x0050C2, 0x570000, 0x570FFF, 46303, 46325 },
+	{ 0x0050C2, 0x571000, 0x571FFF, 46343, 46362 },
+	{ 0x0050C2, 0x572000, 0x572FFF, 46381, 46403 },
+	{ 0x0050C2, 0x573000, 0x573FFF, 46421, 46441 },
+	{ 0x0050C2, 0x574000, 0x574FFF, 46451, 46478 },
+	{ 0x0050C2, 0x575000, 0x575FFF, 46494, 46494 },
+	{ 0x0050C2, 0x576000, 0x576FFF, 46503, 46525 },
+	{ 0x0050C2, 0x577000, 0x577FFF, 46535, 46566 },
+	{ 0x0050C2, 0x578000, 0x578FFF, 26200, 26229 },
+	{ 0x0050C2, 0x579000, 0x579FFF, 46597, 46625 },
+	{ 0x0050C2, 0x57A000, 0x57AFFF, 18578, 18598 },
+	{ 0x0050C2, 0x57B000, 0x57BFFF, 46648, 46657 },
+	{ 0x0050C2, 0x57C000, 0x57CFFF, 46666, 46674 },
+	{ 0x0050C2, 0x57D000, 0x57DFFF, 46680, 46701 },
+	{ 0x0050C2, 0x57E000, 0x57EFFF, 46714, 46726 },
+	{ 0x0050C2, 0x57F000, 0x57FFFF, 46738, 46753 },
+	{ 0x0050C2, 0x580000, 0x580FFF, 46762, 39786 },
+	{ 0x0050C2, 0x581000, 0x581FFF, 46801, 46814 },
+	{ 0x0050C2, 0x582000, 0x582FFF, 46827, 46838 },
+	{ 0x0050C2, 0x583000, 0x583FFF, 46849, 46881 },
+	{ 0x0050C2, 0x584000, 0x584FFF, 46908, 46931 },
+	{ 0x0050C2, 0x585000, 0x585FFF, 46949, 46970 },
+	{ 0x0050C2, 0x586000, 0x586FFF, 46986, 46998 },
+	{ 0x0050C2, 0x587000, 0x587FFF, 47006, 47014 },
+	{ 0x0050C2, 0x588000, 0x588FFF, 47022, 47042 },
+	{ 0x0050C2, 0x589000, 0x589FFF, 47062, 47077 },
+	{ 0x0050C2, 0x58A000, 0x58AFFF, 47092, 47106 },
+	{ 0x0050C2, 0x58B000, 0x58BFFF, 47113, 47138 },
+	{ 0x0050C2, 0x58C000, 0x58CFFF, 47158, 47192 },
+	{ 0x0050C2, 0x58D000, 0x58DFFF, 47218, 47218 },
+	{ 0x0050C2, 0x58E000, 0x58EFFF, 47222, 47250 },
+	{ 0x0050C2, 0x58F000, 0x58FFFF, 47272, 47293 },
+	{ 0x0050C2, 0x590000, 0x590FFF, 47302, 47320 },
+	{ 0x0050C2, 0x591000, 0x591FFF, 47334, 47359 },
+	{ 0x0050C2, 0x592000, 0x592FFF, 47369, 47386 },
+	{ 0x0050C2, 0x593000, 0x593FFF, 47403, 47414 },
+	{ 0x0050C2, 0x594000, 0x594FFF, 47425, 47445 },
+	{ 0x0050C2, 0x595000, 0x595FFF, 47460, 47474 },
+	{ 0x0050C2, 0x596000, 0x596FFF, 47482, 47482 },
+	{ 0x0050C2, 0x597000, 0x597FFF, 47491, 47502 },
+	{ 0x0050C2, 0x598000, 0x598FFF, 47509, 47539 },
+	{ 0x0050C2, 0x599000, 0x599FFF, 47569, 47592 },
+	{ 0x0050C2, 0x59A000, 0x59AFFF, 47596, 47615 },
+	{ 0x0050C2, 0x59B000, 0x59BFFF, 47630, 47630 },
+	{ 0x0050C2, 0x59C000, 0x59CFFF, 47636, 47654 },
+	{ 0x0050C2, 0x59D000, 0x59DFFF, 6924, 6943 },
+	{ 0x0050C2, 0x59E000, 0x59EFFF, 47667, 47676 },
+	{ 0x0050C2, 0x59F000, 0x59FFFF, 20071, 20084 },
+	{ 0x0050C2, 0x5A0000, 0x5A0FFF, 47685, 47712 },
+	{ 0x0050C2, 0x5A1000, 0x5A1FFF, 47733, 47756 },
+	{ 0x0050C2, 0x5A2000, 0x5A2FFF, 47779, 47797 },
+	{ 0x0050C2, 0x5A3000, 0x5A3FFF, 47802, 47813 },
+	{ 0x0050C2, 0x5A4000, 0x5A4FFF, 47819, 47880 },
+	{ 0x0050C2, 0x5A5000, 0x5A5FFF, 47930, 47983 },
+	{ 0x0050C2, 0x5A6000, 0x5A6FFF, 48027, 48041 },
+	{ 0x0050C2, 0x5A7000, 0x5A7FFF, 10929, 10953 },
+	{ 0x0050C2, 0x5A8000, 0x5A8FFF, 48055, 48063 },
+	{ 0x0050C2, 0x5A9000, 0x5A9FFF, 48071, 48087 },
+	{ 0x0050C2, 0x5AA000, 0x5AAFFF, 48099, 48112 },
+	{ 0x0050C2, 0x5AB000, 0x5ABFFF, 48125, 48186 },
+	{ 0x0050C2, 0x5AC000, 0x5ACFFF, 48239, 48257 },
+	{ 0x0050C2, 0x5AD000, 0x5ADFFF, 48269, 14622 },
+	{ 0x0050C2, 0x5AE000, 0x5AEFFF, 48283, 48299 },
+	{ 0x0050C2, 0x5AF000, 0x5AFFFF, 16217, 16228 },
+	{ 0x0050C2, 0x5B0000, 0x5B0FFF, 48314, 48327 },
+	{ 0x0050C2, 0x5B1000, 0x5B1FFF, 48335, 48345 },
+	{ 0x0050C2, 0x5B2000, 0x5B2FFF, 48351, 48364 },
+	{ 0x0050C2, 0x5B3000, 0x5B3FFF, 48377, 48392 },
+	{ 0x0050C2, 0x5B4000, 0x5B4FFF, 48407, 48433 },
+	{ 0x0050C2, 0x5B5000, 0x5B5FFF, 17522, 17522 },
+	{ 0x0050C2, 0x5B6000, 0x5B6FFF, 48446, 48483 },
+	{ 0x0050C2, 0x5B7000, 0x5B7FFF, 44763, 44792 },
+	{ 0x0050C2, 0x5B8000, 0x5B8FFF, 48499, 48519 },
+	{ 0x0050C2, 0x5B9000, 0x5B9FFF, 48534, 48557 },
+	{ 0x0050C2, 0x5BA000, 0x5BAFFF, 6700, 6725 },
+	{ 0x0050C2, 0x5BB000, 0x5BBFFF, 48578, 48600 },
+	{ 0x0050C2, 0x5BC000, 0x5BCFFF, 48618, 48665 },
+	{ 0x0050C2, 0x5BD000, 0x5BDFFF, 48707, 48726 },
+	{ 0x0050C2, 0x5BE000, 0x5BEFFF, 48737, 48766 },
+	{ 0x0050C2, 0x5BF000, 0x5BFFFF, 48791, 48814 },
+	{ 0x0050C2, 0x5C0000, 0x5C0FFF, 48822, 48846 },
+	{ 0x0050C2, 0x5C1000, 0x5C1FFF, 48870, 48890 },
+	{ 0x0050C2, 0x5C2000, 0x5C2FFF, 48908, 48932 },
+	{ 0x0050C2, 0x5C3000, 0x5C3FFF, 48951, 48966 },
+	{ 0x0050C2, 0x5C4000, 0x5C4FFF, 48976, 48988 },
+	{ 0x0050C2, 0x5C5000, 0x5C5FFF, 48995, 49017 },
+	{ 0x0050C2, 0x5C6000, 0x5C6FFF, 49033, 49061 },
+	{ 0x0050C2, 0x5C7000, 0x5C7FFF, 49084, 49106 },
+	{ 0x0050C2, 0x5C8000, 0x5C8FFF, 49113, 49145 },
+	{ 0x0050C2, 0x5C9000, 0x5C9FFF, 49177, 49212 },
+	{ 0x0050C2, 0x5CA000, 0x5CAFFF, 49240, 39786 },
+	{ 0x0050C2, 0x5CB000, 0x5CBFFF, 49280, 49302 },
+	{ 0x0050C2, 0x5CC000, 0x5CCFFF, 49317, 49329 },
+	{ 0x0050C2, 0x5CD000, 0x5CDFFF, 49335, 49368 },
+	{ 0x0050C2, 0x5CE000, 0x5CEFFF, 49396, 49420 },
+	{ 0x0050C2, 0x5CF000, 0x5CFFFF, 49440, 49460 },
+	{ 0x0050C2, 0x5D0000, 0x5D0FFF, 49476, 49489 },
+	{ 0x0050C2, 0x5D1000, 0x5D1FFF, 49502, 49519 },
+	{ 0x0050C2, 0x5D2000, 0x5D2FFF, 49536, 49549 },
+	{ 0x0050C2, 0x5D3000, 0x5D3FFF, 49562, 49575 },
+	{ 0x0050C2, 0x5D4000, 0x5D4FFF, 49240, 39786 },
+	{ 0x0050C2, 0x5D5000, 0x5D5FFF, 49588, 49608 },
+	{ 0x0050C2, 0x5D6000, 0x5D6FFF, 49628, 49668 },
+	{ 0x0050C2, 0x5D7000, 0x5D7FFF, 49707, 49720 },
+	{ 0x0050C2, 0x5D8000, 0x5D8FFF, 49727, 49741 },
+	{ 0x0050C2, 0x5D9000, 0x5D9FFF, 49755, 49782 },
+	{ 0x0050C2, 0x5DA000, 0x5DAFFF, 49803, 49822 },
+	{ 0x0050C2, 0x5DB000, 0x5DBFFF, 27902, 27928 },
+	{ 0x0050C2, 0x5DC000, 0x5DCFFF, 49841, 49883 },
+	{ 0x0050C2, 0x5DD000, 0x5DDFFF, 49918, 49932 },
+	{ 0x0050C2, 0x5DE000, 0x5DEFFF, 49942, 49961 },
+	{ 0x0050C2, 0x5DF000, 0x5DFFFF, 49975, 49987 },
+	{ 0x0050C2, 0x5E0000, 0x5E0FFF, 10929, 10953 },
+	{ 0x0050C2, 0x5E1000, 0x5E1FFF, 49994, 50017 },
+	{ 0x0050C2, 0x5E2000, 0x5E2FFF, 17647, 17669 },
+	{ 0x0050C2, 0x5E3000, 0x5E3FFF, 50026, 50042 },
+	{ 0x0050C2, 0x5E4000, 0x5E4FFF, 49240, 39786 },
+	{ 0x0050C2, 0x5E5000, 0x5E5FFF, 50055, 50069 },
+	{ 0x0050C2, 0x5E6000, 0x5E6FFF, 50083, 50091 },
+	{ 0x0050C2, 0x5E7000, 0x5E7FFF, 50099, 50120 },
+	{ 0x0050C2, 0x5E8000, 0x5E8FFF, 50139, 50169 },
+	{ 0x0050C2, 0x5E9000, 0x5E9FFF, 50193, 50224 },
+	{ 0x0050C2, 0x5EA000, 0x5EAFFF, 50239, 50269 },
+	{ 0x0050C2, 0x5EB000, 0x5EBFFF, 50299, 50331 },
+	{ 0x0050C2, 0x5EC000, 0x5ECFFF, 50357, 50383 },
+	{ 0x0050C2, 0x5ED000, 0x5EDFFF, 50405, 50433 },
+	{ 0x0050C2, 0x5EE000, 0x5EEFFF, 50461, 50480 },
+	{ 0x0050C2, 0x5EF000, 0x5EFFFF, 50487, 50502 },
+	{ 0x0050C2, 0x5F0000, 0x5F0FFF, 50512, 50531 },
+	{ 0x0050C2, 0x5F1000, 0x5F1FFF, 50545, 50562 },
+	{ 0x0050C2, 0x5F2000, 0x5F2FFF, 50579, 50606 },
+	{ 0x0050C2, 0x5F3000, 0x5F3FFF, 50619, 50638 },
+	{ 0x0050C2, 0x5F4000, 0x5F4FFF, 50652, 50668 },
+	{ 0x0050C2, 0x5F5000, 0x5F5FFF, 50681, 50693 },
+	{ 0x0050C2, 0x5F6000, 0x5F6FFF, 50701, 50727 },
+	{ 0x0050C2, 0x5F7000, 0x5F7FFF, 50749, 50766 },
+	{ 0x0050C2, 0x5F8000, 0x5F8FFF, 36847, 36865 },
+	{ 0x0050C2, 0x5F9000, 0x5F9FFF, 50783, 50804 },
+	{ 0x0050C2, 0x5FA000, 0x5FAFFF, 50822, 50833 },
+	{ 0x0050C2, 0x5FB000, 0x5FBFFF, 50843, 50875 },
+	{ 0x0050C2, 0x5FC000, 0x5FCFFF, 50895, 50913 },
+	{ 0x0050C2, 0x5FD000, 0x5FDFFF, 50923, 50943 },
+	{ 0x0050C2, 0x5FE000, 0x5FEFFF, 50947, 50961 },
+	{ 0x0050C2, 0x5FF000, 0x5FFFFF, 50975, 51002 },
+	{ 0x0050C2, 0x600000, 0x600FFF, 51021, 51047 },
+	{ 0x0050C2, 0x601000, 0x601FFF, 33817, 33837 },
+	{ 0x0050C2, 0x602000, 0x602FFF, 22297, 22312 },
+	{ 0x0050C2, 0x603000, 0x603FFF, 51073, 51084 },
+	{ 0x0050C2, 0x604000, 0x604FFF, 51090, 51102 },
+	{ 0x0050C2, 0x605000, 0x605FFF, 51114, 51127 },
+	{ 0x0050C2, 0x606000, 0x606FFF, 51135, 51168 },
+	{ 0x0050C2, 0x607000, 0x607FFF, 51186, 51197 },
+	{ 0x0050C2, 0x608000, 0x608FFF, 51208, 51241 },
+	{ 0x0050C2, 0x609000, 0x609FFF, 51269, 51291 },
+	{ 0x0050C2, 0x60A000, 0x60AFFF, 19677, 19702 },
+	{ 0x0050C2, 0x60B000, 0x60BFFF, 51299, 51346 },
+	{ 0x0050C2, 0x60C000, 0x60CFFF, 51373, 51384 },
+	{ 0x0050C2, 0x60D000, 0x60DFFF, 27631, 27641 },
+	{ 0x0050C2, 0x60E000, 0x60EFFF, 51395, 51435 },
+	{ 0x0050C2, 0x60F000, 0x60FFFF, 51458, 51514 },
+	{ 0x0050C2, 0x610000, 0x610FFF, 51567, 51590 },
+	{ 0x0050C2, 0x611000, 0x611FFF, 51608, 51639 },
+	{ 0x0050C2, 0x612000, 0x612FFF, 51670, 51679 },
+	{ 0x0050C2, 0x613000, 0x613FFF, 37724, 16641 },
+	{ 0x0050C2, 0x614000, 0x614FFF, 51683, 51691 },
+	{ 0x0050C2, 0x615000, 0x615FFF, 51699, 51716 },
+	{ 0x0050C2, 0x616000, 0x616FFF, 44644, 44654 },
+	{ 0x0050C2, 0x617000, 0x617FFF, 51733, 51747 },
+	{ 0x0050C2, 0x618000, 0x618FFF, 51755, 51785 },
+	{ 0x0050C2, 0x619000, 0x619FFF, 51810, 51824 },
+	{ 0x0050C2, 0x61A000, 0x61AFFF, 51832, 51862 },
+	{ 0x0050C2, 0x61B000, 0x61BFFF, 51887, 51909 },
+	{ 0x0050C2, 0x61C000, 0x61CFFF, 51926, 51948 },
+	{ 0x0050C2, 0x61D000, 0x61DFFF, 51956, 51966 },
+	{ 0x0050C2, 0x61E000, 0x61EFFF, 51972, 51995 },
+	{ 0x0050C2, 0x61F000, 0x61FFFF, 52014, 52037 },
+	{ 0x0050C2, 0x620000, 0x620FFF, 52059, 52097 },
+	{ 0x0050C2, 0x621000, 0x621FFF, 52122, 52132 },
+	{ 0x0050C2, 0x622000, 0x622FFF, 22488, 22511 },
+	{ 0x0050C2, 0x623000, 0x623FFF, 52142, 52154 },
+	{ 0x0050C2, 0x624000, 0x624FFF, 52166, 52183 },
+	{ 0x0050C2, 0x625000, 0x625FFF, 52200, 22285 },
+	{ 0x0050C2, 0x626000, 0x626FFF, 52212, 52236 },
+	{ 0x0050C2, 0x627000, 0x627FFF, 52260, 52283 },
+	{ 0x0050C2, 0x628000, 0x628FFF, 52296, 52313 },
+	{ 0x0050C2, 0x629000, 0x629FFF, 52330, 52363 },
+	{ 0x0050C2, 0x62A000, 0x62AFFF, 52390, 52413 },
+	{ 0x0050C2, 0x62B000, 0x62BFFF, 52436, 52461 },
+	{ 0x0050C2, 0x62C000, 0x62CFFF, 52478, 52494 },
+	{ 0x0050C2, 0x62D000, 0x62DFFF, 10332, 10351 },
+	{ 0x0050C2, 0x62E000, 0x62EFFF, 52504, 52520 },
+	{ 0x0050C2, 0x62F000, 0x62FFFF, 52534, 52534 },
+	{ 0x0050C2, 0x630000, 0x630FFF, 52538, 52561 },
+	{ 0x0050C2, 0x631000, 0x631FFF, 52584, 52599 },
+	{ 0x0050C2, 0x632000, 0x632FFF, 52614, 52633 },
+	{ 0x0050C2, 0x633000, 0x633FFF, 52652, 52668 },
+	{ 0x0050C2, 0x634000, 0x634FFF, 52684, 52694 },
+	{ 0x0050C2, 0x635000, 0x635FFF, 52700, 52713 },
+	{ 0x0050C2, 0x636000, 0x636FFF, 52723, 52735 },
+	{ 0x0050C2, 0x637000, 0x637FFF, 52742, 52766 },
+	{ 0x0050C2, 0x638000, 0x638FFF, 52784, 52818 },
+	{ 0x0050C2, 0x639000, 0x639FFF, 52847, 52870 },
+	{ 0x0050C2, 0x63A000, 0x63AFFF, 52888, 52905 },
+	{ 0x0050C2, 0x63B000, 0x63BFFF, 52910, 52928 },
+	{ 0x0050C2, 0x63C000, 0x63CFFF, 52934, 52954 },
+	{ 0x0050C2, 0x63D000, 0x63DFFF, 52968, 52978 },
+	{ 0x0050C2, 0x63E000, 0x63EFFF, 52984, 53005 },
+	{ 0x0050C2, 0x63F000, 0x63FFFF, 53022, 53055 },
+	{ 0x0050C2, 0x640000, 0x640FFF, 53069, 53069 },
+	{ 0x0050C2, 0x641000, 0x641FFF, 53073, 53107 },
+	{ 0x0050C2, 0x642000, 0x642FFF, 53123, 53152 },
+	{ 0x0050C2, 0x643000, 0x643FFF, 53173, 53188 },
+	{ 0x0050C2, 0x644000, 0x644FFF, 10929, 10953 },
+	{ 0x0050C2, 0x645000, 0x645FFF, 53195, 53222 },
+	{ 0x0050C2, 0x646000, 0x646FFF, 53241, 53267 },
+	{ 0x0050C2, 0x647000, 0x647FFF, 53289, 53322 },
+	{ 0x0050C2, 0x648000, 0x648FFF, 53336, 53359 },
+	{ 0x0050C2, 0x649000, 0x649FFF, 53376, 53387 },
+	{ 0x0050C2, 0x64A000, 0x64AFFF, 53398, 53403 },
+	{ 0x0050C2, 0x64B000, 0x64BFFF, 53408, 53417 },
+	{ 0x0050C2, 0x64C000, 0x64CFFF, 53426, 53442 },
+	{ 0x0050C2, 0x64D000, 0x64DFFF, 53446, 53475 },
+	{ 0x0050C2, 0x64E000, 0x64EFFF, 53504, 53519 },
+	{ 0x0050C2, 0x64F000, 0x64FFFF, 53534, 53562 },
+	{ 0x0050C2, 0x650000, 0x650FFF, 53574, 53594 },
+	{ 0x0050C2, 0x651000, 0x651FFF, 53609, 53619 },
+	{ 0x0050C2, 0x652000, 0x652FFF, 53629, 53646 },
+	{ 0x0050C2, 0x653000, 0x653FFF, 1743, 1761 },
+	{ 0x0050C2, 0x654000, 0x654FFF, 47369, 47386 },
+	{ 0x0050C2, 0x655000, 0x655FFF, 53663, 53698 },
+	{ 0x0050C2, 0x656000, 0x656FFF, 53720, 53748 },
+	{ 0x0050C2, 0x657000, 0x657FFF, 53776, 53789 },
+	{ 0x0050C2, 0x658000, 0x658FFF, 53797, 53810 },
+	{ 0x0050C2, 0x659000, 0x659FFF, 53818, 53843 },
+	{ 0x0050C2, 0x65A000, 0x65AFFF, 53864, 53876 },
+	{ 0x0050C2, 0x65B000, 0x65BFFF, 53888, 53909 },
+	{ 0x0050C2, 0x65C000, 0x65CFFF, 53930, 53941 },
+	{ 0x0050C2, 0x65D000, 0x65DFFF, 53951, 53978 },
+	{ 0x0050C2, 0x65E000, 0x65EFFF, 54000, 54012 },
+	{ 0x0050C2, 0x65F000, 0x65FFFF, 54024, 54038 },
+	{ 0x0050C2, 0x660000, 0x660FFF, 54046, 54046 },
+	{ 0x0050C2, 0x661000, 0x661FFF, 54054, 54061 },
+	{ 0x0050C2, 0x662000, 0x662FFF, 54067, 54102 },
+	{ 0x0050C2, 0x663000, 0x663FFF, 9792, 9804 },
+	{ 0x0050C2, 0x664000, 0x664FFF, 54127, 54151 },
+	{ 0x0050C2, 0x665000, 0x665FFF, 54167, 54185 },
+	{ 0x0050C2, 0x666000, 0x666FFF, 54198, 54216 },
+	{ 0x0050C2, 0x667000, 0x667FFF, 17210, 17237 },
+	{ 0x0050C2, 0x668000, 0x668FFF, 8053, 8071 },
+	{ 0x0050C2, 0x669000, 0x669FFF, 14445, 712 },
+	{ 0x0050C2, 0x66A000, 0x66AFFF, 54226, 54300 },
+	{ 0x0050C2, 0x66B000, 0x66BFFF, 54362, 54371 },
+	{ 0x0050C2, 0x66C000, 0x66CFFF, 54380, 54380 },
+	{ 0x0050C2, 0x66D000, 0x66DFFF, 54385, 54400 },
+	{ 0x0050C2, 0x66E000, 0x66EFFF, 54408, 54428 },
+	{ 0x0050C2, 0x66F000, 0x66FFFF, 54435, 54445 },
+	{ 0x0050C2, 0x670000, 0x670FFF, 54455, 54466 },
+	{ 0x0050C2, 0x671000, 0x671FFF, 54477, 54499 },
+	{ 0x0050C2, 0x672000, 0x672FFF, 54516, 54536 },
+	{ 0x0050C2, 0x673000, 0x673FFF, 17485, 17507 },
+	{ 0x0050C2, 0x674000, 0x674FFF, 54556, 13970 },
+	{ 0x0050C2, 0x675000, 0x675FFF, 54584, 54604 },
+	{ 0x0050C2, 0x676000, 0x676FFF, 54620, 54620 },
+	{ 0x0050C2, 0x677000, 0x677FFF, 54624, 54640 },
+	{ 0x0050C2, 0x678000, 0x678FFF, 28832, 28832 },
+	{ 0x0050C2, 0x679000, 0x679FFF, 54652, 54678 },
+	{ 0x0050C2, 0x67A000, 0x67AFFF, 13064, 13078 },
+	{ 0x0050C2, 0x67B000, 0x67BFFF, 54696, 54716 },
+	{ 0x0050C2, 0x67C000, 0x67CFFF, 37341, 37349 },
+	{ 0x0050C2, 0x67D000, 0x67DFFF, 54736, 54758 },
+	{ 0x0050C2, 0x67E000, 0x67EFFF, 6700, 6725 },
+	{ 0x0050C2, 0x67F000, 0x67FFFF, 10929, 10953 },
+	{ 0x0050C2, 0x680000, 0x680FFF, 54774, 54805 },
+	{ 0x0050C2, 0x681000, 0x681FFF, 29728, 29761 },
+	{ 0x0050C2, 0x682000, 0x682FFF, 54828, 54838 },
+	{ 0x0050C2, 0x683000, 0x683FFF, 54848, 54870 },
+	{ 0x0050C2, 0x684000, 0x684FFF, 54892, 54915 },
+	{ 0x0050C2, 0x685000, 0x685FFF, 54933, 54945 },
+	{ 0x0050C2, 0x686000, 0x686FFF, 54954, 54980 },
+	{ 0x0050C2, 0x687000, 0x687FFF, 55001, 55025 },
+	{ 0x0050C2, 0x688000, 0x688FFF, 55044, 55057 },
+	{ 0x0050C2, 0x689000, 0x689FFF, 13994, 14002 },
+	{ 0x0050C2, 0x68A000, 0x68AFFF, 55070, 55103 },
+	{ 0x0050C2, 0x68B000, 0x68BFFF, 55128, 55140 },
+	{ 0x0050C2, 0x68C000, 0x68CFFF, 55147, 55160 },
+	{ 0x0050C2, 0x68D000, 0x68DFFF, 55169, 55191 },
+	{ 0x0050C2, 0x68E000, 0x68EFFF, 24312, 24312 },
+	{ 0x0050C2, 0x68F000, 0x68FFFF, 55201, 55215 },
+	{ 0x0050C2, 0x690000, 0x690FFF, 55229, 55248 },
+	{ 0x0050C2, 0x691000, 0x691FFF, 55259, 55275 },
+	{ 0x0050C2, 0x692000, 0x692FFF, 55285, 55316 },
+	{ 0x0050C2, 0x693000, 0x693FFF, 55347, 55363 },
+	{ 0x0050C2, 0x694000, 0x694FFF, 55373, 55384 },
+	{ 0x0050C2, 0x695000, 0x695FFF, 55395, 55421 },
+	{ 0x0050C2, 0x696000, 0x696FFF, 32479, 6585 },
+	{ 0x0050C2, 0x697000, 0x697FFF, 55430, 55449 },
+	{ 0x0050C2, 0x698000, 0x698FFF, 55468, 55486 },
+	{ 0x0050C2, 0x699000, 0x699FFF, 55500, 55532 },
+	{ 0x0050C2, 0x69A000, 0x69AFFF, 55560, 55578 },
+	{ 0x0050C2, 0x69B000, 0x69BFFF, 55588, 55603 },
+	{ 0x0050C2, 0x69C000, 0x69CFFF, 55612, 55627 },
+	{ 0x0050C2, 0x69D000, 0x69DFFF, 55636, 55652 },
+	{ 0x0050C2, 0x69E000, 0x69EFFF, 55660, 55669 },
+	{ 0x0050C2, 0x69F000, 0x69FFFF, 55678, 55692 },
+	{ 0x0050C2, 0x6A0000, 0x6A0FFF, 55701, 55716 },
+	{ 0x0050C2, 0x6A1000, 0x6A1FFF, 55724, 55739 },
+	{ 0x0050C2, 0x6A2000, 0x6A2FFF, 55746, 55770 },
+	{ 0x0050C2, 0x6A3000, 0x6A3FFF, 55790, 55815 },
+	{ 0x0050C2, 0x6A4000, 0x6A4FFF, 55836, 55836 },
+	{ 0x0050C2, 0x6A5000, 0x6A5FFF, 55845, 55883 },
+	{ 0x0050C2, 0x6A6000, 0x6A6FFF, 55916, 55948 },
+	{ 0x0050C2, 0x6A7000, 0x6A7FFF, 55975, 56015 },
+	{ 0x0050C2, 0x6A8000, 0x6A8FFF, 56030, 56055 },
+	{ 0x0050C2, 0x6A9000, 0x6A9FFF, 56075, 56107 },
+	{ 0x0050C2, 0x6AA000, 0x6AAFFF, 56127, 56160 },
+	{ 0x0050C2, 0x6AB000, 0x6ABFFF, 56191, 56211 },
+	{ 0x0050C2, 0x6AC000, 0x6ACFFF, 56231, 56241 },
+	{ 0x0050C2, 0x6AD000, 0x6ADFFF, 56251, 56278 },
+	{ 0x0050C2, 0x6AE000, 0x6AEFFF, 56302, 56314 },
+	{ 0x0050C2, 0x6AF000, 0x6AFFFF, 56326, 56339 },
+	{ 0x0050C2, 0x6B0000, 0x6B0FFF, 56352, 56384 },
+	{ 0x0050C2, 0x6B1000, 0x6B1FFF, 56394, 56410 },
+	{ 0x0050C2, 0x6B2000, 0x6B2FFF, 56415, 56427 },
+	{ 0x0050C2, 0x6B3000, 0x6B3FFF, 25426, 25449 },
+	{ 0x0050C2, 0x6B4000, 0x6B4FFF, 56439, 56439 },
+	{ 0x0050C2, 0x6B5000, 0x6B5FFF, 56447, 56447 },
+	{ 0x0050C2, 0x6B6000, 0x6B6FFF, 56454, 56468 },
+	{ 0x0050C2, 0x6B7000, 0x6B7FFF, 56477, 56496 },
+	{ 0x0050C2, 0x6B8000, 0x6B8FFF, 56507, 56515 },
+	{ 0x0050C2, 0x6B9000, 0x6B9FFF, 56523, 56534 },
+	{ 0x0050C2, 0x6BA000, 0x6BAFFF, 56540, 56586 },
+	{ 0x0050C2, 0x6BB000, 0x6BBFFF, 56631, 56646 },
+	{ 0x0050C2, 0x6BC000, 0x6BCFFF, 56654, 56667 },
+	{ 0x0050C2, 0x6BD000, 0x6BDFFF, 56676, 56686 },
+	{ 0x0050C2, 0x6BE000, 0x6BEFFF, 56696, 56711 },
+	{ 0x0050C2, 0x6BF000, 0x6BFFFF, 56717, 56729 },
+	{ 0x0050C2, 0x6C0000, 0x6C0FFF, 56741, 56762 },
+	{ 0x0050C2, 0x6C1000, 0x6C1FFF, 56783, 56800 },
+	{ 0x0050C2, 0x6C2000, 0x6C2FFF, 56817, 56836 },
+	{ 0x0050C2, 0x6C3000, 0x6C3FFF, 56848, 56867 },
+	{ 0x0050C2, 0x6C4000, 0x6C4FFF, 56874, 56886 },
+	{ 0x0050C2, 0x6C5000, 0x6C5FFF, 56893, 56915 },
+	{ 0x0050C2, 0x6C6000, 0x6C6FFF, 33817, 33837 },
+	{ 0x0050C2, 0x6C7000, 0x6C7FFF, 56934, 56952 },
+	{ 0x0050C2, 0x6C8000, 0x6C8FFF, 56965, 56985 },
+	{ 0x0050C2, 0x6C9000, 0x6C9FFF, 56995, 56995 },
+	{ 0x0050C2, 0x6CA000, 0x6CAFFF, 57002, 57026 },
+	{ 0x0050C2, 0x6CB000, 0x6CBFFF, 57046, 57064 },
+	{ 0x0050C2, 0x6CC000, 0x6CCFFF, 57082, 57113 },
+	{ 0x0050C2, 0x6CD000, 0x6CDFFF, 57134, 57142 },
+	{ 0x0050C2, 0x6CE000, 0x6CEFFF, 57150, 57176 },
+	{ 0x0050C2, 0x6CF000, 0x6CFFFF, 57197, 57206 },
+	{ 0x0050C2, 0x6D0000, 0x6D0FFF, 57215, 57233 },
+	{ 0x0050C2, 0x6D1000, 0x6D1FFF, 57251, 57280 },
+	{ 0x0050C2, 0x6D2000, 0x6D2FFF, 57296, 57318 },
+	{ 0x0050C2, 0x6D3000, 0x6D3FFF, 57340, 57373 },
+	{ 0x0050C2, 0x6D4000, 0x6D4FFF, 57402, 57429 },
+	{ 0x0050C2, 0x6D5000, 0x6D5FFF, 57447, 57471 },
+	{ 0x0050C2, 0x6D6000, 0x6D6FFF, 57490, 57511 },
+	{ 0x0050C2, 0x6D7000, 0x6D7FFF, 57527, 57548 },
+	{ 0x0050C2, 0x6D8000, 0x6D8FFF, 57563, 57583 },
+	{ 0x0050C2, 0x6D9000, 0x6D9FFF, 57597, 57606 },
+	{ 0x0050C2, 0x6DA000, 0x6DAFFF, 57615, 57638 },
+	{ 0x0050C2, 0x6DB000, 0x6DBFFF, 57654, 57681 },
+	{ 0x0050C2, 0x6DC000, 0x6DCFFF, 57703, 57742 },
+	{ 0x0050C2, 0x6DD000, 0x6DDFFF, 57774, 57793 },
+	{ 0x0050C2, 0x6DE000, 0x6DEFFF, 57800, 57829 },
+	{ 0x0050C2, 0x6DF000, 0x6DFFFF, 57850, 57866 },
+	{ 0x0050C2, 0x6E0000, 0x6E0FFF, 57878, 57898 },
+	{ 0x0050C2, 0x6E1000, 0x6E1FFF, 57909, 57923 },
+	{ 0x0050C2, 0x6E2000, 0x6E2FFF, 10929, 10953 },
+	{ 0x0050C2, 0x6E3000, 0x6E3FFF, 57932, 57941 },
+	{ 0x0050C2, 0x6E4000, 0x6E4FFF, 53408, 53417 },
+	{ 0x0050C2, 0x6E5000, 0x6E5FFF, 57950, 57978 },
+	{ 0x0050C2, 0x6E6000, 0x6E6FFF, 58000, 58008 },
+	{ 0x0050C2, 0x6E7000, 0x6E7FFF, 58016, 58033 },
+	{ 0x0050C2, 0x6E8000, 0x6E8FFF, 58042, 58049 },
+	{ 0x0050C2, 0x6E9000, 0x6E9FFF, 58056, 58095 },
+	{ 0x0050C2, 0x6EA000, 0x6EAFFF, 58120, 58131 },
+	{ 0x0050C2, 0x6EB000, 0x6EBFFF, 58139, 58159 },
+	{ 0x0050C2, 0x6EC000, 0x6ECFFF, 58174, 58208 },
+	{ 0x0050C2, 0x6ED000, 0x6EDFFF, 58230, 58255 },
+	{ 0x0050C2, 0x6EE000, 0x6EEFFF, 58274, 58305 },
+	{ 0x0050C2, 0x6EF000, 0x6EFFFF, 58317, 58344 },
+	{ 0x0050C2, 0x6F0000, 0x6F0FFF, 58368, 58401 },
+	{ 0x0050C2, 0x6F1000, 0x6F1FFF, 58428, 58440 },
+	{ 0x0050C2, 0x6F2000, 0x6F2FFF, 58452, 58474 },
+	{ 0x0050C2, 0x6F3000, 0x6F3FFF, 58492, 58505 },
+	{ 0x0050C2, 0x6F4000, 0x6F4FFF, 58514, 58546 },
+	{ 0x0050C2, 0x6F5000, 0x6F5FFF, 58564, 58591 },
+	{ 0x0050C2, 0x6F6000, 0x6F6FFF, 58618, 58631 },
+	{ 0x0050C2, 0x6F7000, 0x6F7FFF, 58644, 58695 },
+	{ 0x0050C2, 0x6F8000, 0x6F8FFF, 58741, 58763 },
+	{ 0x0050C2, 0x6F9000, 0x6F9FFF, 58766, 58777 },
+	{ 0x0050C2, 0x6FA000, 0x6FAFFF, 58783, 58783 },
+	{ 0x0050C2, 0x6FB000, 0x6FBFFF, 15233, 15240 },
+	{ 0x0050C2, 0x6FC000, 0x6FCFFF, 58788, 58804 },
+	{ 0x0050C2, 0x6FD000, 0x6FDFFF, 6700, 6725 },
+	{ 0x0050C2, 0x6FE000, 0x6FEFFF, 58818, 58830 },
+	{ 0x0050C2, 0x6FF000, 0x6FFFFF, 58842, 28119 },
+	{ 0x0050C2, 0x700000, 0x700FFF, 58870, 58881 },
+	{ 0x0050C2, 0x701000, 0x701FFF, 8053, 8071 },
+	{ 0x0050C2, 0x702000, 0x702FFF, 58892, 58910 },
+	{ 0x0050C2, 0x703000, 0x703FFF, 58928, 58957 },
+	{ 0x0050C2, 0x704000, 0x704FFF, 58964, 58994 },
+	{ 0x0050C2, 0x705000, 0x705FFF, 59018, 59035 },
+	{ 0x0050C2, 0x706000, 0x706FFF, 59050, 59074 },
+	{ 0x0050C2, 0x707000, 0x707FFF, 59087, 59102 },
+	{ 0x0050C2, 0x708000, 0x708FFF, 59113, 59128 },
+	{ 0x0050C2, 0x709000, 0x709FFF, 59142, 59170 },
+	{ 0x0050C2, 0x70A000, 0x70AFFF, 25668, 25693 },
+	{ 0x0050C2, 0x70B000, 0x70BFFF, 2281, 2323 },
+	{ 0x0050C2, 0x70C000, 0x70CFFF, 59191, 59199 },
+	{ 0x0050C2, 0x70D000, 0x70DFFF, 59207, 59230 },
+	{ 0x0050C2, 0x70E000, 0x70EFFF, 59239, 59257 },
+	{ 0x0050C2, 0x70F000, 0x70FFFF, 59267, 59289 },
+	{ 0x0050C2, 0x710000, 0x710FFF, 59297, 59321 },
+	{ 0x0050C2, 0x711000, 0x711FFF, 59341, 59355 },
+	{ 0x0050C2, 0x712000, 0x712FFF, 59362, 59371 },
+	{ 0x0050C2, 0x713000, 0x713FFF, 59377, 59393 },
+	{ 0x0050C2, 0x714000, 0x714FFF, 59401, 59416 },
+	{ 0x0050C2, 0x715000, 0x715FFF, 59427, 59448 },
+	{ 0x0050C2, 0x716000, 0x716FFF, 59469, 59483 },
+	{ 0x0050C2, 0x717000, 0x717FFF, 59490, 59531 },
+	{ 0x0050C2, 0x718000, 0x718FFF, 59567, 59579 },
+	{ 0x0050C2, 0x719000, 0x719FFF, 59587, 59602 },
+	{ 0x0050C2, 0x71A000, 0x71AFFF, 59612, 59652 },
+	{ 0x0050C2, 0x71B000, 0x71BFFF, 59687, 59711 },
+	{ 0x0050C2, 0x71C000, 0x71CFFF, 59735, 59746 },
+	{ 0x0050C2, 0x71D000, 0x71DFFF, 59752, 59762 },
+	{ 0x0050C2, 0x71E000, 0x71EFFF, 59765, 59802 },
+	{ 0x0050C2, 0x71F000, 0x71FFFF, 59838, 59853 },
+	{ 0x0050C2, 0x720000, 0x720FFF, 59865, 59891 },
+	{ 0x0050C2, 0x721000, 0x721FFF, 59912, 59940 },
+	{ 0x0050C2, 0x722000, 0x722FFF, 59967, 59985 },
+	{ 0x0050C2, 0x723000, 0x723FFF, 60000, 60031 },
+	{ 0x0050C2, 0x724000, 0x724FFF, 60056, 60082 },
+	{ 0x0050C2, 0x725000, 0x725FFF, 14445, 712 },
+	{ 0x0050C2, 0x726000, 0x726FFF, 60103, 60119 },
+	{ 0x0050C2, 0x727000, 0x727FFF, 60135, 60163 },
+	{ 0x0050C2, 0x728000, 0x728FFF, 60186, 60210 },
+	{ 0x0050C2, 0x729000, 0x729FFF, 16880, 16897 },
+	{ 0x0050C2, 0x72A000, 0x72AFFF, 10929, 10953 },
+	{ 0x0050C2, 0x72B000, 0x72BFFF, 60230, 60252 },
+	{ 0x0050C2, 0x72C000, 0x72CFFF, 60274, 60311 },
+	{ 0x0050C2, 0x72D000, 0x72DFFF, 60343, 60374 },
+	{ 0x0050C2, 0x72E000, 0x72EFFF, 60393, 60416 },
+	{ 0x0050C2, 0x72F000, 0x72FFFF, 60439, 60464 },
+	{ 0x0050C2, 0x730000, 0x730FFF, 60485, 60517 },
+	{ 0x0050C2, 0x731000, 0x731FFF, 60542, 60565 },
+	{ 0x0050C2, 0x732000, 0x732FFF, 60587, 60605 },
+	{ 0x0050C2, 0x733000, 0x733FFF, 60622, 60649 },
+	{ 0x0050C2, 0x734000, 0x734FFF, 60672, 60688 },
+	{ 0x0050C2, 0x735000, 0x735FFF, 60699, 60713 },
+	{ 0x0050C2, 0x736000, 0x736FFF, 60722, 60731 },
+	{ 0x0050C2, 0x737000, 0x737FFF, 60736, 60757 },
+	{ 0x0050C2, 0x738000, 0x738FFF, 60766, 60795 },
+	{ 0x0050C2, 0x739000, 0x739FFF, 16629, 16641 },
+	{ 0x0050C2, 0x73A000, 0x73AFFF, 60803, 60817 },
+	{ 0x0050C2, 0x73B000, 0x73BFFF, 60826, 60842 },
+	{ 0x0050C2, 0x73C000, 0x73CFFF, 60858, 60866 },
+	{ 0x0050C2, 0x73D000, 0x73DFFF, 60874, 60884 },
+	{ 0x0050C2, 0x73E000, 0x73EFFF, 60894, 60916 },
+	{ 0x0050C2, 0x73F000, 0x73FFFF, 60933, 60944 },
+	{ 0x0050C2, 0x740000, 0x740FFF, 60950, 60963 },
+	{ 0x0050C2, 0x741000, 0x741FFF, 60976, 60981 },
+	{ 0x0050C2, 0x742000, 0x742FFF, 60986, 61004 },
+	{ 0x0050C2, 0x743000, 0x743FFF, 61022, 61044 },
+	{ 0x0050C2, 0x744000, 0x744FFF, 61061, 61083 },
+	{ 0x0050C2, 0x745000, 0x745FFF, 61091, 61091 },
+	{ 0x0050C2, 0x746000, 0x746FFF, 61097, 61116 },
+	{ 0x0050C2, 0x747000, 0x747FFF, 61135, 61149 },
+	{ 0x0050C2, 0x748000, 0x748FFF, 61163, 61177 },
+	{ 0x0050C2, 0x749000, 0x749FFF, 61187, 61212 },
+	{ 0x0050C2, 0x74A000, 0x74AFFF, 61234, 61258 },
+	{ 0x0050C2, 0x74B000, 0x74BFFF, 61278, 61294 },
+	{ 0x0050C2, 0x74C000, 0x74CFFF, 61306, 6725 },
+	{ 0x0050C2, 0x74D000, 0x74DFFF, 61331, 61359 },
+	{ 0x0050C2, 0x74E000, 0x74EFFF, 61380, 61380 },
+	{ 0x0050C2, 0x74F000, 0x74FFFF, 61388, 61408 },
+	{ 0x0050C2, 0x750000, 0x750FFF, 61428, 61467 },
+	{ 0x0050C2, 0x751000, 0x751FFF, 61502, 61534 },
+	{ 0x0050C2, 0x752000, 0x752FFF, 61559, 61571 },
+	{ 0x0050C2, 0x753000, 0x753FFF, 32763, 32763 },
+	{ 0x0050C2, 0x754000, 0x754FFF, 61577, 61594 },
+	{ 0x0050C2, 0x755000, 0x755FFF, 61599, 61619 },
+	{ 0x0050C2, 0x756000, 0x756FFF, 61639, 61664 },
+	{ 0x0050C2, 0x757000, 0x757FFF, 61684, 61707 },
+	{ 0x0050C2, 0x758000, 0x758FFF, 61726, 61740 },
+	{ 0x0050C2, 0x759000, 0x759FFF, 61749, 61780 },
+	{ 0x0050C2, 0x75A000, 0x75AFFF, 61798, 61818 },
+	{ 0x0050C2, 0x75B000, 0x75BFFF, 61838, 61856 },
+	{ 0x0050C2, 0x75C000, 0x75CFFF, 61867, 61900 },
+	{ 0x0050C2, 0x75D000, 0x75DFFF, 61921, 61943 },
+	{ 0x0050C2, 0x75E000, 0x75EFFF, 61959, 61982 },
+	{ 0x0050C2, 0x75F000, 0x75FFFF, 62004, 62041 },
+	{ 0x0050C2, 0x760000, 0x760FFF, 62072, 62087 },
+	{ 0x0050C2, 0x761000, 0x761FFF, 62092, 62117 },
+	{ 0x0050C2, 0x762000, 0x762FFF, 62134, 62161 },
+	{ 0x0050C2, 0x763000, 0x763FFF, 62180, 62190 },
+	{ 0x0050C2, 0x764000, 0x764FFF, 62200, 62200 },
+	{ 0x0050C2, 0x765000, 0x765FFF, 10929, 10953 },
+	{ 0x0050C2, 0x766000, 0x766FFF, 62215, 62241 },
+	{ 0x0050C2, 0x767000, 0x767FFF, 62251, 62251 },
+	{ 0x0050C2, 0x768000, 0x768FFF, 62255, 62286 },
+	{ 0x0050C2, 0x769000, 0x769FFF, 62317, 62326 },
+	{ 0x0050C2, 0x76A000, 0x76AFFF, 62330, 62354 },
+	{ 0x0050C2, 0x76B000, 0x76BFFF, 62370, 24381 },
+	{ 0x0050C2, 0x76C000, 0x76CFFF, 62400, 62420 },
+	{ 0x0050C2, 0x76D000, 0x76DFFF, 62438, 62448 },
+	{ 0x0050C2, 0x76E000, 0x76EFFF, 62458, 62477 },
+	{ 0x0050C2, 0x76F000, 0x76FFFF, 62484, 62515 },
+	{ 0x0050C2, 0x770000, 0x770FFF, 62546, 62569 },
+	{ 0x0050C2, 0x771000, 0x771FFF, 62587, 62603 },
+	{ 0x0050C2, 0x772000, 0x772FFF, 62619, 62645 },
+	{ 0x0050C2, 0x773000, 0x773FFF, 62671, 62702 },
+	{ 0x0050C2, 0x774000, 0x774FFF, 62728, 62740 },
+	{ 0x0050C2, 0x775000, 0x775FFF, 62747, 62770 },
+	{ 0x0050C2, 0x776000, 0x776FFF, 62793, 62825 },
+	{ 0x0050C2, 0x777000, 0x777FFF, 62845, 62862 },
+	{ 0x0050C2, 0x778000, 0x778FFF, 62879, 62895 },
+	{ 0x0050C2, 0x779000, 0x779FFF, 62911, 62929 },
+	{ 0x0050C2, 0x77A000, 0x77AFFF, 62943, 16301 },
+	{ 0x0050C2, 0x77B000, 0x77BFFF, 62960, 62980 },
+	{ 0x0050C2, 0x77C000, 0x77CFFF, 63000, 63009 },
+	{ 0x0050C2, 0x77D000, 0x77DFFF, 63018, 63037 },
+	{ 0x0050C2, 0x77E000, 0x77EFFF, 13405, 13419 },
+	{ 0x0050C2, 0x77F000, 0x77FFFF, 20008, 20028 },
+	{ 0x0050C2, 0x780000, 0x780FFF, 63056, 63083 },
+	{ 0x0050C2, 0x781000, 0x781FFF, 63096, 63129 },
+	{ 0x0050C2, 0x782000, 0x782FFF, 10929, 10953 },
+	{ 0x0050C2, 0x783000, 0x783FFF, 63161, 63180 },
+	{ 0x0050C2, 0x784000, 0x784FFF, 63186, 63206 },
+	{ 0x0050C2, 0x785000, 0x785FFF, 63221, 63239 },
+	{ 0x0050C2, 0x786000, 0x786FFF, 8053, 8071 },
+	{ 0x0050C2, 0x787000, 0x787FFF, 3009, 3047 },
+	{ 0x0050C2, 0x788000, 0x788FFF, 63249, 63271 },
+	{ 0x0050C2, 0x789000, 0x789FFF, 63276, 63305 },
+	{ 0x0050C2, 0x78A000, 0x78AFFF, 63326, 63340 },
+	{ 0x0050C2, 0x78B000, 0x78BFFF, 17677, 17702 },
+	{ 0x0050C2, 0x78C000, 0x78CFFF, 63354, 63373 },
+	{ 0x0050C2, 0x78D000, 0x78DFFF, 63386, 63396 },
+	{ 0x0050C2, 0x78E000, 0x78EFFF, 63406, 63432 },
+	{ 0x0050C2, 0x78F000, 0x78FFFF, 63458, 63475 },
+	{ 0x0050C2, 0x790000, 0x790FFF, 63481, 41421 },
+	{ 0x0050C2, 0x791000, 0x791FFF, 63500, 63525 },
+	{ 0x0050C2, 0x792000, 0x792FFF, 63542, 63559 },
+	{ 0x0050C2, 0x793000, 0x793FFF, 63567, 63587 },
+	{ 0x0050C2, 0x794000, 0x794FFF, 63602, 63618 },
+	{ 0x0050C2, 0x795000, 0x795FFF, 63628, 63638 },
+	{ 0x0050C2, 0x796000, 0x796FFF, 16217, 16228 },
+	{ 0x0050C2, 0x797000, 0x797FFF, 63648, 63680 },
+	{ 0x0050C2, 0x798000, 0x798FFF, 63699, 63707 },
+	{ 0x0050C2, 0x799000, 0x799FFF, 63715, 63715 },
+	{ 0x0050C2, 0x79A000, 0x79AFFF, 63720, 63737 },
+	{ 0x0050C2, 0x79B000, 0x79BFFF, 63749, 63775 },
+	{ 0x0050C2, 0x79C000, 0x79CFFF, 63787, 63805 },
+	{ 0x0050C2, 0x79D000, 0x79DFFF, 63811, 63820 },
+	{ 0x0050C2, 0x79E000, 0x79EFFF, 63829, 63859 },
+	{ 0x0050C2, 0x79F000, 0x79FFFF, 63883, 63891 },
+	{ 0x0050C2, 0x7A0000, 0x7A0FFF, 33817, 33837 },
+	{ 0x0050C2, 0x7A1000, 0x7A1FFF, 63899, 63920 },
+	{ 0x0050C2, 0x7A2000, 0x7A2FFF, 63941, 63959 },
+	{ 0x0050C2, 0x7A3000, 0x7A3FFF, 54226, 54300 },
+	{ 0x0050C2, 0x7A4000, 0x7A4FFF, 63973, 63988 },
+	{ 0x0050C2, 0x7A5000, 0x7A5FFF, 63999, 64023 },
+	{ 0x0050C2, 0x7A6000, 0x7A6FFF, 64047, 64058 },
+	{ 0x0050C2, 0x7A7000, 0x7A7FFF, 64069, 64097 },
+	{ 0x0050C2, 0x7A8000, 0x7A8FFF, 64117, 64147 },
+	{ 0x0050C2, 0x7A9000, 0x7A9FFF, 10145, 10174 },
+	{ 0x0050C2, 0x7AA000, 0x7AAFFF, 36847, 36865 },
+	{ 0x0050C2, 0x7AB000, 0x7ABFFF, 64171, 64200 },
+	{ 0x0050C2, 0x7AC000, 0x7ACFFF, 64221, 64235 },
+	{ 0x0050C2, 0x7AD000, 0x7ADFFF, 64246, 64270 },
+	{ 0x0050C2, 0x7AE000, 0x7AEFFF, 64294, 64310 },
+	{ 0x0050C2, 0x7AF000, 0x7AFFFF, 64326, 64342 },
+	{ 0x0050C2, 0x7B0000, 0x7B0FFF, 64358, 64370 },
+	{ 0x0050C2, 0x7B1000, 0x7B1FFF, 21955, 21955 },
+	{ 0x0050C2, 0x7B2000, 0x7B2FFF, 64382, 64407 },
+	{ 0x0050C2, 0x7B3000, 0x7B3FFF, 64432, 59746 },
+	{ 0x0050C2, 0x7B4000, 0x7B4FFF, 64445, 64461 },
+	{ 0x0050C2, 0x7B5000, 0x7B5FFF, 64477, 64499 },
+	{ 0x0050C2, 0x7B6000, 0x7B6FFF, 64507, 64527 },
+	{ 0x0050C2, 0x7B7000, 0x7B7FFF, 16629, 16641 },
+	{ 0x0050C2, 0x7B8000, 0x7B8FFF, 64542, 64562 },
+	{ 0x0050C2, 0x7B9000, 0x7B9FFF, 32944, 32969 },
+	{ 0x0050C2, 0x7BA000, 0x7BAFFF, 64578, 64613 },
+	{ 0x0050C2, 0x7BB000, 0x7BBFFF, 64636, 64657 },
+	{ 0x0050C2, 0x7BC000, 0x7BCFFF, 64673, 64683 },
+	{ 0x0050C2, 0x7BD000, 0x7BDFFF, 64693, 64719 },
+	{ 0x0050C2, 0x7BE000, 0x7BEFFF, 64727, 64743 },
+	{ 0x0050C2, 0x7BF000, 0x7BFFFF, 64753, 64765 },
+	{ 0x0050C2, 0x7C0000, 0x7C0FFF, 64777, 64814 },
+	{ 0x0050C2, 0x7C1000, 0x7C1FFF, 64850, 64881 },
+	{ 0x0050C2, 0x7C2000, 0x7C2FFF, 64908, 64942 },
+	{ 0x0050C2, 0x7C3000, 0x7C3FFF, 64971, 64988 },
+	{ 0x0050C2, 0x7C4000, 0x7C4FFF, 65005, 65013 },
+	{ 0x0050C2, 0x7C5000, 0x7C5FFF, 65021, 65043 },
+	{ 0x0050C2, 0x7C6000, 0x7C6FFF, 65060, 65073 },
+	{ 0x0050C2, 0x7C7000, 0x7C7FFF, 65086, 65104 },
+	{ 0x0050C2, 0x7C8000, 0x7C8FFF, 16856, 16870 },
+	{ 0x0050C2, 0x7C9000, 0x7C9FFF, 65122, 65147 },
+	{ 0x0050C2, 0x7CA000, 0x7CAFFF, 65164, 65180 },
+	{ 0x0050C2, 0x7CB000, 0x7CBFFF, 65192, 65220 },
+	{ 0x0050C2, 0x7CC000, 0x7CCFFF, 65242, 65256 },
+	{ 0x0050C2, 0x7CD000, 0x7CDFFF, 65270, 65305 },
+	{ 0x0050C2, 0x7CE000, 0x7CEFFF, 37341, 37349 },
+	{ 0x0050C2, 0x7CF000, 0x7CFFFF, 65328, 65348 },
+	{ 0x0050C2, 0x7D0000, 0x7D0FFF, 65356, 65374 },
+	{ 0x0050C2, 0x7D1000, 0x7D1FFF, 10929, 10953 },
+	{ 0x0050C2, 0x7D2000, 0x7D2FFF, 65387, 65400 },
+	{ 0x0050C2, 0x7D3000, 0x7D3FFF, 65413, 65438 },
+	{ 0x0050C2, 0x7D4000, 0x7D4FFF, 65447, 65464 },
+	{ 0x0050C2, 0x7D5000, 0x7D5FFF, 65467, 23109 },
+	{ 0x0050C2, 0x7D6000, 0x7D6FFF, 65484, 65518 },
+	{ 0x0050C2, 0x7D7000, 0x7D7FFF, 65538, 65549 },
+	{ 0x0050C2, 0x7D8000, 0x7D8FFF, 65560, 65573 },
+	{ 0x0050C2, 0x7D9000, 0x7D9FFF, 65586, 65604 },
+	{ 0x0050C2, 0x7DA000, 0x7DAFFF, 18963, 18976 },
+	{ 0x0050C2, 0x7DB000, 0x7DBFFF, 65614, 65633 },
+	{ 0x0050C2, 0x7DC000, 0x7DCFFF, 65652, 65668 },
+	{ 0x0050C2, 0x7DD000, 0x7DDFFF, 65679, 65696 },
+	{ 0x0050C2, 0x7DE000, 0x7DEFFF, 65713, 65738 },
+	{ 0x0050C2, 0x7DF000, 0x7DFFFF, 2377, 2385 },
+	{ 0x0050C2, 0x7E0000, 0x7E0FFF, 65759, 65781 },
+	{ 0x0050C2, 0x7E1000, 0x7E1FFF, 65798, 65822 },
+	{ 0x0050C2, 0x7E2000, 0x7E2FFF, 65840, 65853 },
+	{ 0x0050C2, 0x7E3000, 0x7E3FFF, 65862, 65881 },
+	{ 0x0050C2, 0x7E4000, 0x7E4FFF, 65892, 65917 },
+	{ 0x0050C2, 0x7E5000, 0x7E5FFF, 65929, 65949 },
+	{ 0x0050C2, 0x7E6000, 0x7E6FFF, 65969, 65990 },
+	{ 0x0050C2, 0x7E7000, 0x7E7FFF, 66004, 66018 },
+	{ 0x0050C2, 0x7E8000, 0x7E8FFF, 66026, 66053 },
+	{ 0x0050C2, 0x7E9000, 0x7E9FFF, 27631, 27641 },
+	{ 0x0050C2, 0x7EA000, 0x7EAFFF, 4525, 4556 },
+	{ 0x0050C2, 0x7EB000, 0x7EBFFF, 66075, 66101 },
+	{ 0x0050C2, 0x7EC000, 0x7ECFFF, 66118, 66134 },
+	{ 0x0050C2, 0x7ED000, 0x7EDFFF, 66142, 66166 },
+	{ 0x0050C2, 0x7EE000, 0x7EEFFF, 66185, 66197 },
+	{ 0x0050C2, 0x7EF000, 0x7EFFFF, 4347, 4363 },
+	{ 0x0050C2, 0x7F0000, 0x7F0FFF, 66209, 66230 },
+	{ 0x0050C2, 0x7F1000, 0x7F1FFF, 66245, 66269 },
+	{ 0x0050C2, 0x7F2000, 0x7F2FFF, 66288, 66316 },
+	{ 0x0050C2, 0x7F3000, 0x7F3FFF, 66339, 66339 },
+	{ 0x0050C2, 0x7F4000, 0x7F4FFF, 46949, 46970 },
+	{ 0x0050C2, 0x7F5000, 0x7F5FFF, 66345, 66365 },
+	{ 0x0050C2, 0x7F6000, 0x7F6FFF, 61306, 6725 },
+	{ 0x0050C2, 0x7F7000, 0x7F7FFF, 53408, 53417 },
+	{ 0x0050C2, 0x7F8000, 0x7F8FFF, 66377, 66420 },
+	{ 0x0050C2, 0x7F9000, 0x7F9FFF, 66458, 66483 },
+	{ 0x0050C2, 0x7FA000, 0x7FAFFF, 66494, 66511 },
+	{ 0x0050C2, 0x7FB000, 0x7FBFFF, 66523, 66537 },
+	{ 0x0050C2, 0x7FC000, 0x7FCFFF, 66547, 66562 },
+	{ 0x0050C2, 0x7FD000, 0x7FDFFF, 66573, 66580 },
+	{ 0x0050C2, 0x7FE000, 0x7FEFFF, 46949, 46970 },
+	{ 0x0050C2, 0x7FF000, 0x7FFFFF, 66587, 66631 },
+	{ 0x0050C2, 0x800000, 0x800FFF, 26200, 26229 },
+	{ 0x0050C2, 0x801000, 0x801FFF, 66666, 66676 },
+	{ 0x0050C2, 0x802000, 0x802FFF, 2377, 2385 },
+	{ 0x0050C2, 0x803000, 0x803FFF, 66686, 66707 },
+	{ 0x0050C2, 0x804000, 0x804FFF, 66720, 66747 },
+	{ 0x0050C2, 0x805000, 0x805FFF, 27980, 27994 },
+	{ 0x0050C2, 0x806000, 0x806FFF, 66774, 66774 },
+	{ 0x0050C2, 0x807000, 0x807FFF, 66778, 66778 },
+	{ 0x0050C2, 0x808000, 0x808FFF, 66789, 66804 },
+	{ 0x0050C2, 0x809000, 0x809FFF, 66819, 66840 },
+	{ 0x0050C2, 0x80A000, 0x80AFFF, 10929, 10953 },
+	{ 0x0050C2, 0x80B000, 0x80BFFF, 66861, 66878 },
+	{ 0x0050C2, 0x80C000, 0x80CFFF, 66889, 66920 },
+	{ 0x0050C2, 0x80D000, 0x80DFFF, 66941, 66962 },
+	{ 0x0050C2, 0x80E000, 0x80EFFF, 66968, 66993 },
+	{ 0x0050C2, 0x80F000, 0x80FFFF, 66999, 67026 },
+	{ 0x0050C2, 0x810000, 0x810FFF, 67048, 67068 },
+	{ 0x0050C2, 0x811000, 0x811FFF, 67076, 67106 },
+	{ 0x0050C2, 0x812000, 0x812FFF, 67128, 67137 },
+	{ 0x0050C2, 0x813000, 0x813FFF, 67143, 67167 },
+	{ 0x0050C2, 0x814000, 0x814FFF, 21865, 21873 },
+	{ 0x0050C2, 0x815000, 0x815FFF, 67179, 67197 },
+	{ 0x0050C2, 0x816000, 0x816FFF, 67215, 67236 },
+	{ 0x0050C2, 0x817000, 0x817FFF, 67251, 67272 },
+	{ 0x0050C2, 0x818000, 0x818FFF, 67289, 67307 },
+	{ 0x0050C2, 0x819000, 0x819FFF, 67322, 67337 },
+	{ 0x0050C2, 0x81A000, 0x81AFFF, 67352, 67363 },
+	{ 0x0050C2, 0x81B000, 0x81BFFF, 67374, 67394 },
+	{ 0x0050C2, 0x81C000, 0x81CFFF, 67405, 67412 },
+	{ 0x0050C2, 0x81D000, 0x81DFFF, 67419, 67438 },
+	{ 0x0050C2, 0x81E000, 0x81EFFF, 67447, 67462 },
+	{ 0x0050C2, 0x81F000, 0x81FFFF, 22488, 22511 },
+	{ 0x0050C2, 0x820000, 0x820FFF, 67472, 67487 },
+	{ 0x0050C2, 0x821000, 0x821FFF, 67500, 67520 },
+	{ 0x0050C2, 0x822000, 0x822FFF, 67540, 67567 },
+	{ 0x0050C2, 0x823000, 0x823FFF, 67574, 67600 },
+	{ 0x0050C2, 0x824000, 0x824FFF, 67613, 67624 },
+	{ 0x0050C2, 0x825000, 0x825FFF, 67634, 67683 },
+	{ 0x0050C2, 0x826000, 0x826FFF, 67727, 67752 },
+	{ 0x0050C2, 0x827000, 0x827FFF, 67772, 67793 },
+	{ 0x0050C2, 0x828000, 0x828FFF, 41142, 41160 },
+	{ 0x0050C2, 0x829000, 0x829FFF, 67809, 67825 },
+	{ 0x0050C2, 0x82A000, 0x82AFFF, 67841, 67861 },
+	{ 0x0050C2, 0x82B000, 0x82BFFF, 8053, 8071 },
+	{ 0x0050C2, 0x82C000, 0x82CFFF, 67873, 67883 },
+	{ 0x0050C2, 0x82D000, 0x82DFFF, 67893, 59746 },
+	{ 0x0050C2, 0x82E000, 0x82EFFF, 67905, 67918 },
+	{ 0x0050C2, 0x82F000, 0x82FFFF, 13427, 13449 },
+	{ 0x0050C2, 0x830000, 0x830FFF, 67926, 67949 },
+	{ 0x0050C2, 0x831000, 0x831FFF, 67968, 67990 },
+	{ 0x0050C2, 0x832000, 0x832FFF, 68006, 68025 },
+	{ 0x0050C2, 0x833000, 0x833FFF, 68030, 68046 },
+	{ 0x0050C2, 0x834000, 0x834FFF, 68056, 68067 },
+	{ 0x0050C2, 0x835000, 0x835FFF, 68073, 68105 },
+	{ 0x0050C2, 0x836000, 0x836FFF, 14445, 712 },
+	{ 0x0050C2, 0x837000, 0x837FFF, 68132, 68148 },
+	{ 0x0050C2, 0x838000, 0x838FFF, 68163, 68203 },
+	{ 0x0050C2, 0x839000, 0x839FFF, 68235, 68260 },
+	{ 0x0050C2, 0x83A000, 0x83AFFF, 68280, 68312 },
+	{ 0x0050C2, 0x83B000, 0x83BFFF, 68342, 68352 },
+	{ 0x0050C2, 0x83C000, 0x83CFFF, 68358, 68379 },
+	{ 0x0050C2, 0x83D000, 0x83DFFF, 68384, 68397 },
+	{ 0x0050C2, 0x83E000, 0x83EFFF, 68405, 68422 },
+	{ 0x0050C2, 0x83F000, 0x83FFFF, 10929, 10953 },
+	{ 0x0050C2, 0x840000, 0x840FFF, 68437, 68465 },
+	{ 0x0050C2, 0x841000, 0x841FFF, 68485, 68513 },
+	{ 0x0050C2, 0x842000, 0x842FFF, 68536, 68556 },
+	{ 0x0050C2, 0x843000, 0x843FFF, 68573, 68594 },
+	{ 0x0050C2, 0x844000, 0x844FFF, 68602, 68630 },
+	{ 0x0050C2, 0x845000, 0x845FFF, 68650, 68668 },
+	{ 0x0050C2, 0x846000, 0x846FFF, 68681, 68698 },
+	{ 0x0050C2, 0x847000, 0x847FFF, 68711, 68750 },
+	{ 0x0050C2, 0x848000, 0x848FFF, 68784, 68805 },
+	{ 0x0050C2, 0x849000, 0x849FFF, 68816, 68849 },
+	{ 0x0050C2, 0x84A000, 0x84AFFF, 68876, 68906 },
+	{ 0x0050C2, 0x84B000, 0x84BFFF, 68925, 68958 },
+	{ 0x0050C2, 0x84C000, 0x84CFFF, 68991, 69018 },
+	{ 0x0050C2, 0x84D000, 0x84DFFF, 69045, 69045 },
+	{ 0x0050C2, 0x84E000, 0x84EFFF, 69050, 69064 },
+	{ 0x0050C2, 0x84F000, 0x84FFFF, 69070, 69089 },
+	{ 0x0050C2, 0x850000, 0x850FFF, 69104, 69115 },
+	{ 0x0050C2, 0x851000, 0x851FFF, 69125, 69161 },
+	{ 0x0050C2, 0x852000, 0x852FFF, 69191, 69207 },
+	{ 0x0050C2, 0x853000, 0x853FFF, 69218, 69237 },
+	{ 0x0050C2, 0x854000, 0x854FFF, 69252, 69284 },
+	{ 0x0050C2, 0x855000, 0x855FFF, 34650, 34673 },
+	{ 0x0050C2, 0x856000, 0x856FFF, 37736, 37747 },
+	{ 0x0050C2, 0x857000, 0x857FFF, 36847, 36865 },
+	{ 0x0050C2, 0x858000, 0x858FFF, 69311, 69336 },
+	{ 0x0050C2, 0x859000, 0x859FFF, 69357, 69366 },
+	{ 0x0050C2, 0x85A000, 0x85AFFF, 69375, 69383 },
+	{ 0x0050C2, 0x85B000, 0x85BFFF, 69391, 69399 },
+	{ 0x0050C2, 0x85C000, 0x85CFFF, 69407, 69413 },
+	{ 0x0050C2, 0x85D000, 0x85DFFF, 69419, 69451 },
+	{ 0x0050C2, 0x85E000, 0x85EFFF, 69477, 69500 },
+	{ 0x0050C2, 0x85F000, 0x85FFFF, 18191, 18210 },
+	{ 0x0050C2, 0x860000, 0x860FFF, 69523, 69537 },
+	{ 0x0050C2, 0x861000, 0x861FFF, 69544, 69564 },
+	{ 0x0050C2, 0x862000, 0x862FFF, 69580, 69589 },
+	{ 0x0050C2, 0x863000, 0x863FFF, 69595, 69625 },
+	{ 0x0050C2, 0x864000, 0x864FFF, 69644, 69682 },
+	{ 0x0050C2, 0x865000, 0x865FFF, 69715, 69743 },
+	{ 0x0050C2, 0x866000, 0x866FFF, 40539, 6725 },
+	{ 0x0050C2, 0x867000, 0x867FFF, 69770, 69781 },
+	{ 0x0050C2, 0x868000, 0x868FFF, 69792, 69805 },
+	{ 0x0050C2, 0x869000, 0x869FFF, 37432, 37465 },
+	{ 0x0050C2, 0x86A000, 0x86AFFF, 69812, 69829 },
+	{ 0x0050C2, 0x86B000, 0x86BFFF, 69833, 69864 },
+	{ 0x0050C2, 0x86C000, 0x86CFFF, 69890, 69911 },
+	{ 0x0050C2, 0x86D000, 0x86DFFF, 21466, 21491 },
+	{ 0x0050C2, 0x86E000, 0x86EFFF, 69932, 69958 },
+	{ 0x0050C2, 0x86F000, 0x86FFFF, 69978, 69990 },
+	{ 0x0050C2, 0x870000, 0x870FFF, 69997, 70010 },
+	{ 0x0050C2, 0x871000, 0x871FFF, 70016, 70051 },
+	{ 0x0050C2, 0x872000, 0x872FFF, 70072, 70084 },
+	{ 0x0050C2, 0x873000, 0x873FFF, 70096, 70115 },
+	{ 0x0050C2, 0x874000, 0x874FFF, 70122, 70146 },
+	{ 0x0050C2, 0x875000, 0x875FFF, 10929, 10953 },
+	{ 0x0050C2, 0x876000, 0x876FFF, 70165, 70198 },
+	{ 0x0050C2, 0x877000, 0x877FFF, 70218, 7449 },
+	{ 0x0050C2, 0x878000, 0x878FFF, 70239, 70278 },
+	{ 0x0050C2, 0x879000, 0x879FFF, 70313, 70313 },
+	{ 0x0050C2, 0x87A000, 0x87AFFF, 70321, 70345 },
+	{ 0x0050C2, 0x87B000, 0x87BFFF, 70368, 70387 },
+	{ 0x0050C2, 0x87C000, 0x87CFFF, 70401, 70413 },
+	{ 0x0050C2, 0x87D000, 0x87DFFF, 70425, 70451 },
+	{ 0x0050C2, 0x87E000, 0x87EFFF, 70477, 70496 },
+	{ 0x0050C2, 0x87F000, 0x87FFFF, 70509, 70539 },
+	{ 0x0050C2, 0x880000, 0x880FFF, 70562, 70592 },
+	{ 0x0050C2, 0x881000, 0x881FFF, 70622, 70653 },
+	{ 0x0050C2, 0x882000, 0x882FFF, 70677, 70691 },
+	{ 0x0050C2, 0x883000, 0x883FFF, 70700, 70737 },
+	{ 0x0050C2, 0x884000, 0x884FFF, 70766, 70782 },
+	{ 0x0050C2, 0x885000, 0x885FFF, 70798, 70811 },
+	{ 0x0050C2, 0x886000, 0x886FFF, 70824, 70843 },
+	{ 0x0050C2, 0x887000, 0x887FFF, 70862, 70894 },
+	{ 0x0050C2, 0x888000, 0x888FFF, 70907, 70925 },
+	{ 0x0050C2, 0x889000, 0x889FFF, 70931, 70955 },
+	{ 0x0050C2, 0x88A000, 0x88AFFF, 70974, 71004 },
+	{ 0x0050C2, 0x88B000, 0x88BFFF, 71028, 71059 },
+	{ 0x0050C2, 0x88C000, 0x88CFFF, 71086, 71100 },
+	{ 0x0050C2, 0x88D000, 0x88DFFF, 71106, 71141 },
+	{ 0x0050C2, 0x88E000, 0x88EFFF, 71175, 71197 },
+	{ 0x0050C2, 0x88F000, 0x88FFFF, 71216, 71235 },
+	{ 0x0050C2, 0x890000, 0x890FFF, 71249, 71275 },
+	{ 0x0050C2, 0x891000, 0x891FFF, 23576, 23606 },
+	{ 0x0050C2, 0x892000, 0x892FFF, 71293, 71305 },
+	{ 0x0050C2, 0x893000, 0x893FFF, 71312, 71335 },
+	{ 0x0050C2, 0x894000, 0x894FFF, 52700, 52713 },
+	{ 0x0050C2, 0x895000, 0x895FFF, 71353, 71383 },
+	{ 0x0050C2, 0x896000, 0x896FFF, 71404, 71412 },
+	{ 0x0050C2, 0x897000, 0x897FFF, 71420, 71440 },
+	{ 0x0050C2, 0x898000, 0x898FFF, 71454, 71484 },
+	{ 0x0050C2, 0x899000, 0x899FFF, 71508, 71532 },
+	{ 0x0050C2, 0x89A000, 0x89AFFF, 71551, 71581 },
+	{ 0x0050C2, 0x89B000, 0x89BFFF, 71595, 71616 },
+	{ 0x0050C2, 0x89C000, 0x89CFFF, 71637, 71645 },
+	{ 0x0050C2, 0x89D000, 0x89DFFF, 71653, 71672 },
+	{ 0x0050C2, 0x89E000, 0x89EFFF, 71686, 71708 },
+	{ 0x0050C2, 0x89F000, 0x89FFFF, 71730, 71766 },
+	{ 0x0050C2, 0x8A0000, 0x8A0FFF, 71797, 71830 },
+	{ 0x0050C2, 0x8A1000, 0x8A1FFF, 71856, 71872 },
+	{ 0x0050C2, 0x8A2000, 0x8A2FFF, 71888, 71920 },
+	{ 0x0050C2, 0x8A3000, 0x8A3FFF, 71952, 71969 },
+	{ 0x0050C2, 0x8A4000, 0x8A4FFF, 71973, 71998 },
+	{ 0x0050C2, 0x8A5000, 0x8A5FFF, 72011, 72023 },
+	{ 0x0050C2, 0x8A6000, 0x8A6FFF, 24312, 24312 },
+	{ 0x0050C2, 0x8A7000, 0x8A7FFF, 72029, 72040 },
+	{ 0x0050C2, 0x8A8000, 0x8A8FFF, 72047, 72065 },
+	{ 0x0050C2, 0x8A9000, 0x8A9FFF, 72083, 72112 },
+	{ 0x0050C2, 0x8AA000, 0x8AAFFF, 72133, 72153 },
+	{ 0x0050C2, 0x8AB000, 0x8ABFFF, 72168, 72184 },
+	{ 0x0050C2, 0x8AC000, 0x8ACFFF, 72195, 72207 },
+	{ 0x0050C2, 0x8AD000, 0x8ADFFF, 72213, 20155 },
+	{ 0x0050C2, 0x8AE000, 0x8AEFFF, 72239, 72289 },
+	{ 0x0050C2, 0x8AF000, 0x8AFFFF, 72334, 72344 },
+	{ 0x0050C2, 0x8B0000, 0x8B0FFF, 72354, 72374 },
+	{ 0x0050C2, 0x8B1000, 0x8B1FFF, 72388, 72416 },
+	{ 0x0050C2, 0x8B2000, 0x8B2FFF, 72438, 72451 },
+	{ 0x0050C2, 0x8B3000, 0x8B3FFF, 72460, 72480 },
+	{ 0x0050C2, 0x8B4000, 0x8B4FFF, 72495, 72514 },
+	{ 0x0050C2, 0x8B5000, 0x8B5FFF, 8053, 8071 },
+	{ 0x0050C2, 0x8B6000, 0x8B6FFF, 72533, 72561 },
+	{ 0x0050C2, 0x8B7000, 0x8B7FFF, 72589, 72610 },
+	{ 0x0050C2, 0x8B8000, 0x8B8FFF, 6924, 6943 },
+	{ 0x0050C2, 0x8B9000, 0x8B9FFF, 20008, 20028 },
+	{ 0x0050C2, 0x8BA000, 0x8BAFFF, 16856, 16870 },
+	{ 0x0050C2, 0x8BB000, 0x8BBFFF, 72631, 72654 },
+	{ 0x0050C2, 0x8BC000, 0x8BCFFF, 72660, 72679 },
+	{ 0x0050C2, 0x8BD000, 0x8BDFFF, 72698, 72724 },
+	{ 0x0050C2, 0x8BE000, 0x8BEFFF, 72738, 72772 },
+	{ 0x0050C2, 0x8BF000, 0x8BFFFF, 72806, 72843 },
+	{ 0x0050C2, 0x8C0000, 0x8C0FFF, 72866, 72880 },
+	{ 0x0050C2, 0x8C1000, 0x8C1FFF, 72886, 72910 },
+	{ 0x0050C2, 0x8C2000, 0x8C2FFF, 72929, 72956 },
+	{ 0x0050C2, 0x8C3000, 0x8C3FFF, 72975, 72989 },
+	{ 0x0050C2, 0x8C4000, 0x8C4FFF, 73003, 73064 },
+	{ 0x0050C2, 0x8C5000, 0x8C5FFF, 73125, 73152 },
+	{ 0x0050C2, 0x8C6000, 0x8C6FFF, 19677, 19702 },
+	{ 0x0050C2, 0x8C7000, 0x8C7FFF, 37724, 16641 },
+	{ 0x0050C2, 0x8C8000, 0x8C8FFF, 73175, 73217 },
+	{ 0x0050C2, 0x8C9000, 0x8C9FFF, 73258, 73291 },
+	{ 0x0050C2, 0x8CA000, 0x8CAFFF, 73319, 73344 },
+	{ 0x0050C2, 0x8CB000, 0x8CBFFF, 73365, 73384 },
+	{ 0x0050C2, 0x8CC000, 0x8CCFFF, 73391, 73413 },
+	{ 0x0050C2, 0x8CD000, 0x8CDFFF, 73422, 73454 },
+	{ 0x0050C2, 0x8CE000, 0x8CEFFF, 10929, 10953 },
+	{ 0x0050C2, 0x8CF000, 0x8CFFFF, 73481, 73495 },
+	{ 0x0050C2, 0x8D0000, 0x8D0FFF, 61306, 6725 },
+	{ 0x0050C2, 0x8D1000, 0x8D1FFF, 73504, 73529 },
+	{ 0x0050C2, 0x8D2000, 0x8D2FFF, 73549, 73557 },
+	{ 0x0050C2, 0x8D3000, 0x8D3FFF, 73561, 73571 },
+	{ 0x0050C2, 0x8D4000, 0x8D4FFF, 73576, 73605 },
+	{ 0x0050C2, 0x8D5000, 0x8D5FFF, 73634, 73652 },
+	{ 0x0050C2, 0x8D6000, 0x8D6FFF, 73665, 73700 },
+	{ 0x0050C2, 0x8D7000, 0x8D7FFF, 73721, 73746 },
+	{ 0x0050C2, 0x8D8000, 0x8D8FFF, 73766, 73789 },
+	{ 0x0050C2, 0x8D9000, 0x8D9FFF, 73808, 73853 },
+	{ 0x0050C2, 0x8DA000, 0x8DAFFF, 73890, 73904 },
+	{ 0x0050C2, 0x8DB000, 0x8DBFFF, 73913, 73947 },
+	{ 0x0050C2, 0x8DC000, 0x8DCFFF, 73964, 73986 },
+	{ 0x0050C2, 0x8DD000, 0x8DDFFF, 73992, 73992 },
+	{ 0x0050C2, 0x8DE000, 0x8DEFFF, 73999, 74012 },
+	{ 0x0050C2, 0x8DF000, 0x8DFFFF, 74020, 74046 },
+	{ 0x0050C2, 0x8E0000, 0x8E0FFF, 74064, 74103 },
+	{ 0x0050C2, 0x8E1000, 0x8E1FFF, 74132, 74154 },
+	{ 0x0050C2, 0x8E2000, 0x8E2FFF, 46949, 46970 },
+	{ 0x0050C2, 0x8E3000, 0x8E3FFF, 74176, 74202 },
+	{ 0x0050C2, 0x8E4000, 0x8E4FFF, 74219, 74248 },
+	{ 0x0050C2, 0x8E5000, 0x8E5FFF, 74255, 74268 },
+	{ 0x0050C2, 0x8E6000, 0x8E6FFF, 74276, 74298 },
+	{ 0x0050C2, 0x8E7000, 0x8E7FFF, 74314, 74332 },
+	{ 0x0050C2, 0x8E8000, 0x8E8FFF, 74350, 74371 },
+	{ 0x0050C2, 0x8E9000, 0x8E9FFF, 74387, 74387 },
+	{ 0x0050C2, 0x8EA000, 0x8EAFFF, 21955, 21955 },
+	{ 0x0050C2, 0x8EB000, 0x8EBFFF, 74395, 74424 },
+	{ 0x0050C2, 0x8EC000, 0x8ECFFF, 74440, 74465 },
+	{ 0x0050C2, 0x8ED000, 0x8EDFFF, 74485, 74515 },
+	{ 0x0050C2, 0x8EE000, 0x8EEFFF, 7077, 7077 },
+	{ 0x0050C2, 0x8EF000, 0x8EFFFF, 74529, 74553 },
+	{ 0x0050C2, 0x8F0000, 0x8F0FFF, 74573, 74596 },
+	{ 0x0050C2, 0x8F1000, 0x8F1FFF, 74618, 74646 },
+	{ 0x0050C2, 0x8F2000, 0x8F2FFF, 74669, 74693 },
+	{ 0x0050C2, 0x8F3000, 0x8F3FFF, 74712, 74736 },
+	{ 0x0050C2, 0x8F4000, 0x8F4FFF, 39452, 39470 },
+	{ 0x0050C2, 0x8F5000, 0x8F5FFF, 74748, 74756 },
+	{ 0x0050C2, 0x8F6000, 0x8F6FFF, 74761, 74773 },
+	{ 0x0050C2, 0x8F7000, 0x8F7FFF, 74779, 74793 },
+	{ 0x0050C2, 0x8F8000, 0x8F8FFF, 74797, 74806 },
+	{ 0x0050C2, 0x8F9000, 0x8F9FFF, 44644, 44654 },
+	{ 0x0050C2, 0x8FA000, 0x8FAFFF, 74811, 74823 },
+	{ 0x0050C2, 0x8FB000, 0x8FBFFF, 74834, 74852 },
+	{ 0x0050C2, 0x8FC000, 0x8FCFFF, 74865, 74886 },
+	{ 0x0050C2, 0x8FD000, 0x8FDFFF, 74907, 74947 },
+	{ 0x0050C2, 0x8FE000, 0x8FEFFF, 74978, 75003 },
+	{ 0x0050C2, 0x8FF000, 0x8FFFFF, 75020, 75027 },
+	{ 0x0050C2, 0x900000, 0x900FFF, 75034, 75060 },
+	{ 0x0050C2, 0x901000, 0x901FFF, 75080, 75109 },
+	{ 0x0050C2, 0x902000, 0x902FFF, 75138, 75181 },
+	{ 0x0050C2, 0x903000, 0x903FFF, 75216, 75242 },
+	{ 0x0050C2, 0x904000, 0x904FFF, 75254, 75267 },
+	{ 0x0050C2, 0x905000, 0x905FFF, 75275, 75300 },
+	{ 0x0050C2, 0x906000, 0x906FFF, 75319, 75325 },
+	{ 0x0050C2, 0x907000, 0x907FFF, 75331, 75354 },
+	{ 0x0050C2, 0x908000, 0x908FFF, 75377, 75395 },
+	{ 0x0050C2, 0x909000, 0x909FFF, 75409, 75416 },
+	{ 0x0050C2, 0x90A000, 0x90AFFF, 75423, 75443 },
+	{ 0x0050C2, 0x90B000, 0x90BFFF, 75455, 75474 },
+	{ 0x0050C2, 0x90C000, 0x90CFFF, 75493, 75502 },
+	{ 0x0050C2, 0x90D000, 0x90DFFF, 75506, 75530 },
+	{ 0x0050C2, 0x90E000, 0x90EFFF, 10929, 10953 },
+	{ 0x0050C2, 0x90F000, 0x90FFFF, 75549, 75572 },
+	{ 0x0050C2, 0x910000, 0x910FFF, 75592, 75604 },
+	{ 0x0050C2, 0x911000, 0x911FFF, 75616, 75627 },
+	{ 0x0050C2, 0x912000, 0x912FFF, 75638, 75660 },
+	{ 0x0050C2, 0x913000, 0x913FFF, 75676, 75692 },
+	{ 0x0050C2, 0x914000, 0x914FFF, 75704, 75715 },
+	{ 0x0050C2, 0x915000, 0x915FFF, 75726, 40961 },
+	{ 0x0050C2, 0x916000, 0x916FFF, 75746, 75764 },
+	{ 0x0050C2, 0x917000, 0x917FFF, 75782, 75782 },
+	{ 0x0050C2, 0x918000, 0x918FFF, 75789, 75811 },
+	{ 0x0050C2, 0x919000, 0x919FFF, 75828, 75846 },
+	{ 0x0050C2, 0x91A000, 0x91AFFF, 75850, 75865 },
+	{ 0x0050C2, 0x91B000, 0x91BFFF, 75880, 75907 },
+	{ 0x0050C2, 0x91C000, 0x91CFFF, 53408, 53417 },
+	{ 0x0050C2, 0x91D000, 0x91DFFF, 75921, 75950 },
+	{ 0x0050C2, 0x91E000, 0x91EFFF, 75974, 75989 },
+	{ 0x0050C2, 0x91F000, 0x91FFFF, 76004, 76022 },
+	{ 0x0050C2, 0x920000, 0x920FFF, 76040, 76063 },
+	{ 0x0050C2, 0x921000, 0x921FFF, 76081, 76107 },
+	{ 0x0050C2, 0x922000, 0x922FFF, 76130, 76147 },
+	{ 0x0050C2, 0x923000, 0x923FFF, 76164, 76180 },
+	{ 0x0050C2, 0x924000, 0x924FFF, 76196, 76231 },
+	{ 0x0050C2, 0x925000, 0x925FFF, 76260, 76281 },
+	{ 0x0050C2, 0x926000, 0x926FFF, 76301, 76330 },
+	{ 0x0050C2, 0x927000, 0x927FFF, 76354, 76372 },
+	{ 0x0050C2, 0x928000, 0x928FFF, 76389, 76402 },
+	{ 0x0050C2, 0x929000, 0x929FFF, 76410, 76432 },
+	{ 0x0050C2, 0x92A000, 0x92AFFF, 34650, 34673 },
+	{ 0x0050C2, 0x92B000, 0x92BFFF, 14445, 712 },
+	{ 0x0050C2, 0x92C000, 0x92CFFF, 76454, 76474 },
+	{ 0x0050C2, 0x92D000, 0x92DFFF, 76482, 76500 },
+	{ 0x0050C2, 0x92E000, 0x92EFFF, 76518, 76546 },
+	{ 0x0050C2, 0x92F000, 0x92FFFF, 10929, 10953 },
+	{ 0x0050C2, 0x930000, 0x930FFF, 76570, 76589 },
+	{ 0x0050C2, 0x931000, 0x931FFF, 76608, 76648 },
+	{ 0x0050C2, 0x932000, 0x932FFF, 76686, 76698 },
+	{ 0x0050C2, 0x933000, 0x933FFF, 61306, 6725 },
+	{ 0x0050C2, 0x934000, 0x934FFF, 76705, 76717 },
+	{ 0x0050C2, 0x935000, 0x935FFF, 76723, 76735 },
+	{ 0x0050C2, 0x936000, 0x936FFF, 76747, 76770 },
+	{ 0x0050C2, 0x937000, 0x937FFF, 76793, 76801 },
+	{ 0x0050C2, 0x938000, 0x938FFF, 76809, 12168 },
+	{ 0x0050C2, 0x939000, 0x939FFF, 76833, 76858 },
+	{ 0x0050C2, 0x93A000, 0x93AFFF, 76883, 76899 },
+	{ 0x0050C2, 0x93B000, 0x93BFFF, 76915, 76938 },
+	{ 0x0050C2, 0x93C000, 0x93CFFF, 76955, 76980 },
+	{ 0x0050C2, 0x93D000, 0x93DFFF, 76993, 77016 },
+	{ 0x0050C2, 0x93E000, 0x93EFFF, 77039, 77075 },
+	{ 0x0050C2, 0x93F000, 0x93FFFF, 35092, 35111 },
+	{ 0x0050C2, 0x940000, 0x940FFF, 77098, 77118 },
+	{ 0x0050C2, 0x941000, 0x941FFF, 77125, 77132 },
+	{ 0x0050C2, 0x942000, 0x942FFF, 8053, 8071 },
+	{ 0x0050C2, 0x943000, 0x943FFF, 77139, 77174 },
+	{ 0x0050C2, 0x944000, 0x944FFF, 77199, 77213 },
+	{ 0x0050C2, 0x945000, 0x945FFF, 77227, 77252 },
+	{ 0x0050C2, 0x946000, 0x946FFF, 77273, 77295 },
+	{ 0x0050C2, 0x947000, 0x947FFF, 77303, 77320 },
+	{ 0x0050C2, 0x948000, 0x948FFF, 77337, 77337 },
+	{ 0x0050C2, 0x949000, 0x949FFF, 77348, 77360 },
+	{ 0x0050C2, 0x94A000, 0x94AFFF, 77367, 77393 },
+	{ 0x0050C2, 0x94B000, 0x94BFFF, 77414, 77438 },
+	{ 0x0050C2, 0x94C000, 0x94CFFF, 77457, 77457 },
+	{ 0x0050C2, 0x94D000, 0x94DFFF, 77463, 77484 },
+	{ 0x0050C2, 0x94E000, 0x94EFFF, 77488, 77513 },
+	{ 0x0050C2, 0x94F000, 0x94FFFF, 77528, 77546 },
+	{ 0x0050C2, 0x950000, 0x950FFF, 77559, 77593 },
+	{ 0x0050C2, 0x951000, 0x951FFF, 77627, 77646 },
+	{ 0x0050C2, 0x952000, 0x952FFF, 77662, 77679 },
+	{ 0x0050C2, 0x953000, 0x953FFF, 36847, 36865 },
+	{ 0x0050C2, 0x954000, 0x954FFF, 10929, 10953 },
+	{ 0x0050C2, 0x955000, 0x955FFF, 77695, 77717 },
+	{ 0x0050C2, 0x956000, 0x956FFF, 27631, 27641 },
+	{ 0x0050C2, 0x957000, 0x957FFF, 77739, 77763 },
+	{ 0x0050C2, 0x958000, 0x958FFF, 77779, 77794 },
+	{ 0x0050C2, 0x959000, 0x959FFF, 77805, 77818 },
+	{ 0x0050C2, 0x95A000, 0x95AFFF, 77826, 77835 },
+	{ 0x0050C2, 0x95B000, 0x95BFFF, 77844, 77858 },
+	{ 0x0050C2, 0x95C000, 0x95CFFF, 77867, 77894 },
+	{ 0x0050C2, 0x95D000, 0x95DFFF, 77919, 77942 },
+	{ 0x0050C2, 0x95E000, 0x95EFFF, 77954, 77967 },
+	{ 0x0050C2, 0x95F000, 0x95FFFF, 77975, 78016 },
+	{ 0x0050C2, 0x960000, 0x960FFF, 78055, 78086 },
+	{ 0x0050C2, 0x961000, 0x961FFF, 78117, 78148 },
+	{ 0x0050C2, 0x962000, 0x962FFF, 52700, 52713 },
+	{ 0x0050C2, 0x963000, 0x963FFF, 78157, 78170 },
+	{ 0x0050C2, 0x964000, 0x964FFF, 78178, 78197 },
+	{ 0x0050C2, 0x965000, 0x965FFF, 65328, 65348 },
+	{ 0x0050C2, 0x966000, 0x966FFF, 78211, 78226 },
+	{ 0x0050C2, 0x967000, 0x967FFF, 78241, 78272 },
+	{ 0x0050C2, 0x968000, 0x968FFF, 78293, 78308 },
+	{ 0x0050C2, 0x969000, 0x969FFF, 78317, 78351 },
+	{ 0x0050C2, 0x96A000, 0x96AFFF, 78380, 78401 },
+	{ 0x0050C2, 0x96B000, 0x96BFFF, 78418, 78448 },
+	{ 0x0050C2, 0x96C000, 0x96CFFF, 78463, 78483 },
+	{ 0x0050C2, 0x96D000, 0x96DFFF, 78499, 78522 },
+	{ 0x0050C2, 0x96E000, 0x96EFFF, 78540, 73652 },
+	{ 0x0050C2, 0x96F000, 0x96FFFF, 78565, 78576 },
+	{ 0x0050C2, 0x970000, 0x970FFF, 78582, 78608 },
+	{ 0x0050C2, 0x971000, 0x971FFF, 1183, 1183 },
+	{ 0x0050C2, 0x972000, 0x972FFF, 78626, 78658 },
+	{ 0x0050C2, 0x973000, 0x973FFF, 78688, 78703 },
+	{ 0x0050C2, 0x974000, 0x974FFF, 7646, 7657 },
+	{ 0x0050C2, 0x975000, 0x975FFF, 78716, 78746 },
+	{ 0x0050C2, 0x976000, 0x976FFF, 78776, 78812 },
+	{ 0x0050C2, 0x977000, 0x977FFF, 61306, 6725 },
+	{ 0x0050C2, 0x978000, 0x978FFF, 78844, 78870 },
+	{ 0x0050C2, 0x979000, 0x979FFF, 78896, 78925 },
+	{ 0x0050C2, 0x97A000, 0x97AFFF, 78948, 78972 },
+	{ 0x0050C2, 0x97B000, 0x97BFFF, 78976, 78992 },
+	{ 0x0050C2, 0x97C000, 0x97CFFF, 79005, 79031 },
+	{ 0x0050C2, 0x97D000, 0x97DFFF, 79056, 79090 },
+	{ 0x0050C2, 0x97E000, 0x97EFFF, 79111, 79125 },
+	{ 0x0050C2, 0x97F000, 0x97FFFF, 79139, 79151 },
+	{ 0x0050C2, 0x980000, 0x980FFF, 79155, 79184 },
+	{ 0x0050C2, 0x981000, 0x981FFF, 79213, 79229 },
+	{ 0x0050C2, 0x982000, 0x982FFF, 79240, 79271 },
+	{ 0x0050C2, 0x983000, 0x983FFF, 79296, 79315 },
+	{ 0x0050C2, 0x984000, 0x984FFF, 79334, 79351 },
+	{ 0x0050C2, 0x985000, 0x985FFF, 79356, 79375 },
+	{ 0x0050C2, 0x986000, 0x986FFF, 79386, 79386 },
+	{ 0x0050C2, 0x987000, 0x987FFF, 79391, 79426 },
+	{ 0x0050C2, 0x988000, 0x988FFF, 79451, 79472 },
+	{ 0x0050C2, 0x989000, 0x989FFF, 79479, 79501 },
+	{ 0x0050C2, 0x98A000, 0x98AFFF, 79511, 79523 },
+	{ 0x0050C2, 0x98B000, 0x98BFFF, 79527, 79562 },
+	{ 0x0050C2, 0x98C000, 0x98CFFF, 79597, 79612 },
+	{ 0x0050C2, 0x98D000, 0x98DFFF, 79627, 79636 },
+	{ 0x0050C2, 0x98E000, 0x98EFFF, 79642, 79665 },
+	{ 0x0050C2, 0x98F000, 0x98FFFF, 20810, 20825 },
+	{ 0x0050C2, 0x990000, 0x990FFF, 8053, 8071 },
+	{ 0x0050C2, 0x991000, 0x991FFF, 79683, 79695 },
+	{ 0x0050C2, 0x992000, 0x992FFF, 79699, 79732 },
+	{ 0x0050C2, 0x993000, 0x993FFF, 79753, 79778 },
+	{ 0x0050C2, 0x994000, 0x994FFF, 79794, 79813 },
+	{ 0x0050C2, 0x995000, 0x995FFF, 79829, 79880 },
+	{ 0x0050C2, 0x996000, 0x996FFF, 79919, 79947 },
+	{ 0x0050C2, 0x997000, 0x997FFF, 79970, 79990 },
+	{ 0x0050C2, 0x998000, 0x998FFF, 10929, 10953 },
+	{ 0x0050C2, 0x999000, 0x999FFF, 80008, 80023 },
+	{ 0x0050C2, 0x99A000, 0x99AFFF, 80034, 80046 },
+	{ 0x0050C2, 0x99B000, 0x99BFFF, 80055, 80067 },
+	{ 0x0050C2, 0x99C000, 0x99CFFF, 80079, 80093 },
+	{ 0x0050C2, 0x99D000, 0x99DFFF, 80099, 80114 },
+	{ 0x0050C2, 0x99E000, 0x99EFFF, 80129, 80149 },
+	{ 0x0050C2, 0x99F000, 0x99FFFF, 80169, 80188 },
+	{ 0x0050C2, 0x9A0000, 0x9A0FFF, 80207, 80225 },
+	{ 0x0050C2, 0x9A1000, 0x9A1FFF, 80229, 80241 },
+	{ 0x0050C2, 0x9A2000, 0x9A2FFF, 80253, 80269 },
+	{ 0x0050C2, 0x9A3000, 0x9A3FFF, 11821, 11840 },
+	{ 0x0050C2, 0x9A4000, 0x9A4FFF, 80280, 80309 },
+	{ 0x0050C2, 0x9A5000, 0x9A5FFF, 80335, 80355 },
+	{ 0x0050C2, 0x9A6000, 0x9A6FFF, 80363, 80371 },
+	{ 0x0050C2, 0x9A7000, 0x9A7FFF, 80379, 80417 },
+	{ 0x0050C2, 0x9A8000, 0x9A8FFF, 80447, 80456 },
+	{ 0x0050C2, 0x9A9000, 0x9A9FFF, 18191, 18210 },
+	{ 0x0050C2, 0x9AA000, 0x9AAFFF, 80462, 80479 },
+	{ 0x0050C2, 0x9AB000, 0x9ABFFF, 80496, 80513 },
+	{ 0x0050C2, 0x9AC000, 0x9ACFFF, 80525, 80551 },
+	{ 0x0050C2, 0x9AD000, 0x9ADFFF, 80573, 80597 },
+	{ 0x0050C2, 0x9AE000, 0x9AEFFF, 30669, 30684 },
+	{ 0x0050C2, 0x9AF000, 0x9AFFFF, 80605, 80633 },
+	{ 0x0050C2, 0x9B0000, 0x9B0FFF, 80661, 80671 },
+	{ 0x0050C2, 0x9B1000, 0x9B1FFF, 80676, 80690 },
+	{ 0x0050C2, 0x9B2000, 0x9B2FFF, 80699, 80715 },
+	{ 0x0050C2, 0x9B3000, 0x9B3FFF, 80725, 80743 },
+	{ 0x0050C2, 0x9B4000, 0x9B4FFF, 80761, 80788 },
+	{ 0x0050C2, 0x9B5000, 0x9B5FFF, 80815, 80829 },
+	{ 0x0050C2, 0x9B6000, 0x9B6FFF, 80843, 80843 },
+	{ 0x0050C2, 0x9B7000, 0x9B7FFF, 28096, 28119 },
+	{ 0x0050C2, 0x9B8000, 0x9B8FFF, 80850, 80876 },
+	{ 0x0050C2, 0x9B9000, 0x9B9FFF, 80893, 80934 },
+	{ 0x0050C2, 0x9BA000, 0x9BAFFF, 80967, 80983 },
+	{ 0x0050C2, 0x9BB000, 0x9BBFFF, 17677, 17702 },
+	{ 0x0050C2, 0x9BC000, 0x9BCFFF, 80999, 81026 },
+	{ 0x0050C2, 0x9BD000, 0x9BDFFF, 81048, 81072 },
+	{ 0x0050C2, 0x9BE000, 0x9BEFFF, 81096, 81119 },
+	{ 0x0050C2, 0x9BF000, 0x9BFFFF, 22488, 22511 },
+	{ 0x0050C2, 0x9C0000, 0x9C0FFF, 81137, 81167 },
+	{ 0x0050C2, 0x9C1000, 0x9C1FFF, 16629, 16641 },
+	{ 0x0050C2, 0x9C2000, 0x9C2FFF, 81194, 81208 },
+	{ 0x0050C2, 0x9C3000, 0x9C3FFF, 63481, 41421 },
+	{ 0x0050C2, 0x9C4000, 0x9C4FFF, 67873, 67883 },
+	{ 0x0050C2, 0x9C5000, 0x9C5FFF, 81222, 81240 },
+	{ 0x0050C2, 0x9C6000, 0x9C6FFF, 81253, 81268 },
+	{ 0x0050C2, 0x9C7000, 0x9C7FFF, 81278, 81295 },
+	{ 0x0050C2, 0x9C8000, 0x9C8FFF, 81312, 81325 },
+	{ 0x0050C2, 0x9C9000, 0x9C9FFF, 81338, 81373 },
+	{ 0x0050C2, 0x9CA000, 0x9CAFFF, 81408, 81423 },
+	{ 0x0050C2, 0x9CB000, 0x9CBFFF, 81433, 81447 },
+	{ 0x0050C2, 0x9CC000, 0x9CCFFF, 81456, 81470 },
+	{ 0x0050C2, 0x9CD000, 0x9CDFFF, 81479, 81498 },
+	{ 0x0050C2, 0x9CE000, 0x9CEFFF, 81512, 81530 },
+	{ 0x0050C2, 0x9CF000, 0x9CFFFF, 48908, 48932 },
+	{ 0x0050C2, 0x9D0000, 0x9D0FFF, 81548, 81585 },
+	{ 0x0050C2, 0x9D1000, 0x9D1FFF, 81607, 81633 },
+	{ 0x0050C2, 0x9D2000, 0x9D2FFF, 61306, 6725 },
+	{ 0x0050C2, 0x9D3000, 0x9D3FFF, 81659, 81686 },
+	{ 0x0050C2, 0x9D4000, 0x9D4FFF, 81708, 81708 },
+	{ 0x0050C2, 0x9D5000, 0x9D5FFF, 81714, 81731 },
+	{ 0x0050C2, 0x9D6000, 0x9D6FFF, 44231, 7625 },
+	{ 0x0050C2, 0x9D7000, 0x9D7FFF, 81748, 81759 },
+	{ 0x0050C2, 0x9D8000, 0x9D8FFF, 81765, 81799 },
+	{ 0x0050C2, 0x9D9000, 0x9D9FFF, 81824, 81842 },
+	{ 0x0050C2, 0x9DA000, 0x9DAFFF, 81846, 81861 },
+	{ 0x0050C2, 0x9DB000, 0x9DBFFF, 81875, 81893 },
+	{ 0x0050C2, 0x9DC000, 0x9DCFFF, 81911, 81933 },
+	{ 0x0050C2, 0x9DD000, 0x9DDFFF, 81947, 81969 },
+	{ 0x0050C2, 0x9DE000, 0x9DEFFF, 22297, 22312 },
+	{ 0x0050C2, 0x9DF000, 0x9DFFFF, 81990, 82006 },
+	{ 0x0050C2, 0x9E0000, 0x9E0FFF, 82012, 82025 },
+	{ 0x0050C2, 0x9E1000, 0x9E1FFF, 82035, 82062 },
+	{ 0x0050C2, 0x9E2000, 0x9E2FFF, 82089, 82117 },
+	{ 0x0050C2, 0x9E3000, 0x9E3FFF, 82132, 82156 },
+	{ 0x0050C2, 0x9E4000, 0x9E4FFF, 82180, 82199 },
+	{ 0x0050C2, 0x9E5000, 0x9E5FFF, 82218, 82247 },
+	{ 0x0050C2, 0x9E6000, 0x9E6FFF, 82272, 82293 },
+	{ 0x0050C2, 0x9E7000, 0x9E7FFF, 16217, 16228 },
+	{ 0x0050C2, 0x9E8000, 0x9E8FFF, 82308, 82328 },
+	{ 0x0050C2, 0x9E9000, 0x9E9FFF, 82336, 82355 },
+	{ 0x0050C2, 0x9EA000, 0x9EAFFF, 82374, 82403 },
+	{ 0x0050C2, 0x9EB000, 0x9EBFFF, 82429, 82450 },
+	{ 0x0050C2, 0x9EC000, 0x9ECFFF, 34650, 34673 },
+	{ 0x0050C2, 0x9ED000, 0x9EDFFF, 82466, 82478 },
+	{ 0x0050C2, 0x9EE000, 0x9EEFFF, 82489, 82520 },
+	{ 0x0050C2, 0x9EF000, 0x9EFFFF, 82545, 82566 },
+	{ 0x0050C2, 0x9F0000, 0x9F0FFF, 82582, 82598 },
+	{ 0x0050C2, 0x9F1000, 0x9F1FFF, 82610, 82623 },
+	{ 0x0050C2, 0x9F2000, 0x9F2FFF, 8053, 8071 },
+	{ 0x0050C2, 0x9F3000, 0x9F3FFF, 82629, 82655 },
+	{ 0x0050C2, 0x9F4000, 0x9F4FFF, 82675, 82685 },
+	{ 0x0050C2, 0x9F5000, 0x9F5FFF, 82689, 82709 },
+	{ 0x0050C2, 0x9F6000, 0x9F6FFF, 82729, 82744 },
+	{ 0x0050C2, 0x9F7000, 0x9F7FFF, 82754, 82772 },
+	{ 0x0050C2, 0x9F8000, 0x9F8FFF, 3009, 3047 },
+	{ 0x0050C2, 0x9F9000, 0x9F9FFF, 54226, 54300 },
+	{ 0x0050C2, 0x9FA000, 0x9FAFFF, 82790, 82826 },
+	{ 0x0050C2, 0x9FB000, 0x9FBFFF, 82862, 82875 },
+	{ 0x0050C2, 0x9FC000, 0x9FCFFF, 82887, 82898 },
+	{ 0x0050C2, 0x9FD000, 0x9FDFFF, 82904, 82927 },
+	{ 0x0050C2, 0x9FE000, 0x9FEFFF, 82934, 82959 },
+	{ 0x0050C2, 0x9FF000, 0x9FFFFF, 82976, 82994 },
+	{ 0x0050C2, 0xA00000, 0xA00FFF, 83012, 32969 },
+	{ 0x0050C2, 0xA01000, 0xA01FFF, 83031, 83059 },
+	{ 0x0050C2, 0xA02000, 0xA02FFF, 83069, 83085 },
+	{ 0x0050C2, 0xA03000, 0xA03FFF, 83095, 83115 },
+	{ 0x0050C2, 0xA04000, 0xA04FFF, 83131, 83140 },
+	{ 0x0050C2, 0xA05000, 0xA05FFF, 83149, 83167 },
+	{ 0x0050C2, 0xA06000, 0xA06FFF, 83180, 83202 },
+	{ 0x0050C2, 0xA07000, 0xA07FFF, 83208, 83226 },
+	{ 0x0050C2, 0xA08000, 0xA08FFF, 31319, 31339 },
+	{ 0x0050C2, 0xA09000, 0xA09FFF, 83244, 83275 },
+	{ 0x0050C2, 0xA0A000, 0xA0AFFF, 20008, 20028 },
+	{ 0x0050C2, 0xA0B000, 0xA0BFFF, 83295, 83315 },
+	{ 0x0050C2, 0xA0C000, 0xA0CFFF, 10929, 10953 },
+	{ 0x0050C2, 0xA0D000, 0xA0DFFF, 83328, 83328 },
+	{ 0x0050C2, 0xA0E000, 0xA0EFFF, 83340, 83355 },
+	{ 0x0050C2, 0xA0F000, 0xA0FFFF, 83363, 83378 },
+	{ 0x0050C2, 0xA10000, 0xA10FFF, 83389, 83424 },
+	{ 0x0050C2, 0xA11000, 0xA11FFF, 83457, 83472 },
+	{ 0x0050C2, 0xA12000, 0xA12FFF, 83487, 83510 },
+	{ 0x0050C2, 0xA13000, 0xA13FFF, 83526, 83539 },
+	{ 0x0050C2, 0xA14000, 0xA14FFF, 83546, 83596 },
+	{ 0x0050C2, 0xA15000, 0xA15FFF, 83636, 83661 },
+	{ 0x0050C2, 0xA16000, 0xA16FFF, 22604, 22629 },
+	{ 0x0050C2, 0xA17000, 0xA17FFF, 83682, 83718 },
+	{ 0x0050C2, 0xA18000, 0xA18FFF, 83748, 83756 },
+	{ 0x0050C2, 0xA19000, 0xA19FFF, 63221, 63239 },
+	{ 0x0050C2, 0xA1A000, 0xA1AFFF, 83764, 83764 },
+	{ 0x0050C2, 0xA1B000, 0xA1BFFF, 83768, 83790 },
+	{ 0x0050C2, 0xA1C000, 0xA1CFFF, 83799, 83813 },
+	{ 0x0050C2, 0xA1D000, 0xA1DFFF, 83827, 83853 },
+	{ 0x0050C2, 0xA1E000, 0xA1EFFF, 83879, 83899 },
+	{ 0x0050C2, 0xA1F000, 0xA1FFFF, 83905, 83933 },
+	{ 0x0050C2, 0xA20000, 0xA20FFF, 83949, 83973 },
+	{ 0x0050C2, 0xA21000, 0xA21FFF, 83993, 84002 },
+	{ 0x0050C2, 0xA22000, 0xA22FFF, 84011, 84075 },
+	{ 0x0050C2, 0xA23000, 0xA23FFF, 84123, 84141 },
+	{ 0x0050C2, 0xA24000, 0xA24FFF, 36847, 36865 },
+	{ 0x0050C2, 0xA25000, 0xA25FFF, 61306, 6725 },
+	{ 0x0050C2, 0xA26000, 0xA26FFF, 84153, 84172 },
+	{ 0x0050C2, 0xA27000, 0xA27FFF, 84186, 84200 },
+	{ 0x0050C2, 0xA28000, 0xA28FFF, 84212, 84245 },
+	{ 0x0050C2, 0xA29000, 0xA29FFF, 84251, 84271 },
+	{ 0x0050C2, 0xA2A000, 0xA2AFFF, 84279, 84313 },
+	{ 0x0050C2, 0xA2B000, 0xA2BFFF, 84347, 84369 },
+	{ 0x0050C2, 0xA2C000, 0xA2CFFF, 84384, 84404 },
+	{ 0x0050C2, 0xA2D000, 0xA2DFFF, 84408, 84423 },
+	{ 0x0050C2, 0xA2E000, 0xA2EFFF, 30959, 30978 },
+	{ 0x0050C2, 0xA2F000, 0xA2FFFF, 84433, 84458 },
+	{ 0x0050C2, 0xA30000, 0xA30FFF, 84479, 84492 },
+	{ 0x0050C2, 0xA31000, 0xA31FFF, 84497, 84518 },
+	{ 0x0050C2, 0xA32000, 0xA32FFF, 84525, 84553 },
+	{ 0x0050C2, 0xA33000, 0xA33FFF, 84575, 84589 },
+	{ 0x0050C2, 0xA34000, 0xA34FFF, 32479, 6585 },
+	{ 0x0050C2, 0xA35000, 0xA35FFF, 84603, 84624 },
+	{ 0x0050C2, 0xA36000, 0xA36FFF, 84632, 84667 },
+	{ 0x0050C2, 0xA37000, 0xA37FFF, 84684, 84706 },
+	{ 0x0050C2, 0xA38000, 0xA38FFF, 84720, 84734 },
+	{ 0x0050C2, 0xA39000, 0xA39FFF, 84748, 84777 },
+	{ 0x0050C2, 0xA3A000, 0xA3AFFF, 84802, 84815 },
+	{ 0x0050C2, 0xA3B000, 0xA3BFFF, 84823, 84839 },
+	{ 0x0050C2, 0xA3C000, 0xA3CFFF, 84850, 84883 },
+	{ 0x0050C2, 0xA3D000, 0xA3DFFF, 84913, 84913 },
+	{ 0x0050C2, 0xA3E000, 0xA3EFFF, 84920, 84948 },
+	{ 0x0050C2, 0xA3F000, 0xA3FFFF, 84976, 84991 },
+	{ 0x0050C2, 0xA40000, 0xA40FFF, 84998, 85023 },
+	{ 0x0050C2, 0xA41000, 0xA41FFF, 85044, 85064 },
+	{ 0x0050C2, 0xA42000, 0xA42FFF, 85078, 85094 },
+	{ 0x0050C2, 0xA43000, 0xA43FFF, 85105, 85117 },
+	{ 0x0050C2, 0xA44000, 0xA44FFF, 85121, 85139 },
+	{ 0x0050C2, 0xA45000, 0xA45FFF, 85157, 85169 },
+	{ 0x0050C2, 0xA46000, 0xA46FFF, 85181, 85197 },
+	{ 0x0050C2, 0xA47000, 0xA47FFF, 85208, 85236 },
+	{ 0x0050C2, 0xA48000, 0xA48FFF, 85258, 56241 },
+	{ 0x0050C2, 0xA49000, 0xA49FFF, 85276, 85295 },
+	{ 0x0050C2, 0xA4A000, 0xA4AFFF, 85308, 85322 },
+	{ 0x0050C2, 0xA4B000, 0xA4BFFF, 57703, 57742 },
+	{ 0x0050C2, 0xA4C000, 0xA4CFFF, 85329, 85344 },
+	{ 0x0050C2, 0xA4D000, 0xA4DFFF, 85353, 85368 },
+	{ 0x0050C2, 0xA4E000, 0xA4EFFF, 85378, 85399 },
+	{ 0x0050C2, 0xA4F000, 0xA4FFFF, 85408, 85419 },
+	{ 0x0050C2, 0xA50000, 0xA50FFF, 85425, 85453 },
+	{ 0x0050C2, 0xA51000, 0xA51FFF, 85476, 85495 },
+	{ 0x0050C2, 0xA52000, 0xA52FFF, 85506, 85526 },
+	{ 0x0050C2, 0xA53000, 0xA53FFF, 85534, 85551 },
+	{ 0x0050C2, 0xA54000, 0xA54FFF, 85566, 85607 },
+	{ 0x0050C2, 0xA55000, 0xA55FFF, 85628, 85650 },
+	{ 0x0050C2, 0xA56000, 0xA56FFF, 85672, 85688 },
+	{ 0x0050C2, 0xA57000, 0xA57FFF, 85698, 85722 },
+	{ 0x0050C2, 0xA58000, 0xA58FFF, 85741, 85741 },
+	{ 0x0050C2, 0xA59000, 0xA59FFF, 85745, 85763 },
+	{ 0x0050C2, 0xA5A000, 0xA5AFFF, 85776, 85785 },
+	{ 0x0050C2, 0xA5B000, 0xA5BFFF, 10929, 10953 },
+	{ 0x0050C2, 0xA5C000, 0xA5CFFF, 85794, 85812 },
+	{ 0x0050C2, 0xA5D000, 0xA5DFFF, 85830, 85845 },
+	{ 0x0050C2, 0xA5E000, 0xA5EFFF, 85850, 85881 },
+	{ 0x0050C2, 0xA5F000, 0xA5FFFF, 85907, 85926 },
+	{ 0x0050C2, 0xA60000, 0xA60FFF, 85941, 85986 },
+	{ 0x0050C2, 0xA61000, 0xA61FFF, 16856, 16870 },
+	{ 0x0050C2, 0xA62000, 0xA62FFF, 1361, 1386 },
+	{ 0x0050C2, 0xA63000, 0xA63FFF, 86024, 86039 },
+	{ 0x0050C2, 0xA64000, 0xA64FFF, 86054, 86072 },
+	{ 0x0050C2, 0xA65000, 0xA65FFF, 86085, 86103 },
+	{ 0x0050C2, 0xA66000, 0xA66FFF, 86116, 86123 },
+	{ 0x0050C2, 0xA67000, 0xA67FFF, 86130, 86151 },
+	{ 0x0050C2, 0xA68000, 0xA68FFF, 86164, 86192 },
+	{ 0x0050C2, 0xA69000, 0xA69FFF, 86212, 86240 },
+	{ 0x0050C2, 0xA6A000, 0xA6AFFF, 86260, 86273 },
+	{ 0x0050C2, 0xA6B000, 0xA6BFFF, 86286, 86300 },
+	{ 0x0050C2, 0xA6C000, 0xA6CFFF, 86309, 86337 },
+	{ 0x0050C2, 0xA6D000, 0xA6DFFF, 86365, 86381 },
+	{ 0x0050C2, 0xA6E000, 0xA6EFFF, 86397, 86425 },
+	{ 0x0050C2, 0xA6F000, 0xA6FFFF, 61306, 6725 },
+	{ 0x0050C2, 0xA70000, 0xA70FFF, 86445, 86475 },
+	{ 0x0050C2, 0xA71000, 0xA71FFF, 86500, 86511 },
+	{ 0x0050C2, 0xA72000, 0xA72FFF, 86518, 69089 },
+	{ 0x0050C2, 0xA73000, 0xA73FFF, 86538, 86565 },
+	{ 0x0050C2, 0xA74000, 0xA74FFF, 86583, 712 },
+	{ 0x0050C2, 0xA75000, 0xA75FFF, 86598, 86615 },
+	{ 0x0050C2, 0xA76000, 0xA76FFF, 86619, 86661 },
+	{ 0x0050C2, 0xA77000, 0xA77FFF, 8053, 8071 },
+	{ 0x0050C2, 0xA78000, 0xA78FFF, 86696, 86708 },
+	{ 0x0050C2, 0xA79000, 0xA79FFF, 86716, 86727 },
+	{ 0x0050C2, 0xA7A000, 0xA7AFFF, 86738, 86768 },
+	{ 0x0050C2, 0xA7B000, 0xA7BFFF, 86792, 86817 },
+	{ 0x0050C2, 0xA7C000, 0xA7CFFF, 86842, 86865 },
+	{ 0x0050C2, 0xA7D000, 0xA7DFFF, 67873, 67883 },
+	{ 0x0050C2, 0xA7E000, 0xA7EFFF, 86876, 86903 },
+	{ 0x0050C2, 0xA7F000, 0xA7FFFF, 10929, 10953 },
+	{ 0x0050C2, 0xA80000, 0xA80FFF, 4379, 4386 },
+	{ 0x0050C2, 0xA81000, 0xA81FFF, 86926, 86943 },
+	{ 0x0050C2, 0xA82000, 0xA82FFF, 37736, 37747 },
+	{ 0x0050C2, 0xA83000, 0xA83FFF, 86956, 86977 },
+	{ 0x0050C2, 0xA84000, 0xA84FFF, 86989, 87012 },
+	{ 0x0050C2, 0xA85000, 0xA85FFF, 87033, 87033 },
+	{ 0x0050C2, 0xA86000, 0xA86FFF, 87043, 87052 },
+	{ 0x0050C2, 0xA87000, 0xA87FFF, 87061, 87083 },
+	{ 0x0050C2, 0xA88000, 0xA88FFF, 87105, 87105 },
+	{ 0x0050C2, 0xA89000, 0xA89FFF, 87111, 87126 },
+	{ 0x0050C2, 0xA8A000, 0xA8AFFF, 87137, 87160 },
+	{ 0x0050C2, 0xA8B000, 0xA8BFFF, 87178, 87190 },
+	{ 0x0050C2, 0xA8C000, 0xA8CFFF, 87202, 87215 },
+	{ 0x0050C2, 0xA8D000, 0xA8DFFF, 87223, 87257 },
+	{ 0x0050C2, 0xA8E000, 0xA8EFFF, 87266, 87304 },
+	{ 0x0050C2, 0xA8F000, 0xA8FFFF, 40703, 40719 },
+	{ 0x0050C2, 0xA90000, 0xA90FFF, 87329, 87347 },
+	{ 0x0050C2, 0xA91000, 0xA91FFF, 87353, 87372 },
+	{ 0x0050C2, 0xA92000, 0xA92FFF, 27631, 27641 },
+	{ 0x0050C2, 0xA93000, 0xA93FFF, 87383, 87403 },
+	{ 0x0050C2, 0xA94000, 0xA94FFF, 87412, 87427 },
+	{ 0x0050C2, 0xA95000, 0xA95FFF, 87436, 87482 },
+	{ 0x0050C2, 0xA96000, 0xA96FFF, 87524, 87532 },
+	{ 0x0050C2, 0xA97000, 0xA97FFF, 87540, 87540 },
+	{ 0x0050C2, 0xA98000, 0xA98FFF, 87554, 87574 },
+	{ 0x0050C2, 0xA99000, 0xA99FFF, 87594, 34506 },
+	{ 0x0050C2, 0xA9A000, 0xA9AFFF, 87616, 87632 },
+	{ 0x0050C2, 0xA9B000, 0xA9BFFF, 87643, 12731 },
+	{ 0x0050C2, 0xA9C000, 0xA9CFFF, 87667, 87698 },
+	{ 0x0050C2, 0xA9D000, 0xA9DFFF, 87715, 87735 },
+	{ 0x0050C2, 0xA9E000, 0xA9EFFF, 87750, 87777 },
+	{ 0x0050C2, 0xA9F000, 0xA9FFFF, 87796, 87817 },
+	{ 0x0050C2, 0xAA0000, 0xAA0FFF, 16283, 16301 },
+	{ 0x0050C2, 0xAA1000, 0xAA1FFF, 87828, 87848 },
+	{ 0x0050C2, 0xAA2000, 0xAA2FFF, 87854, 87863 },
+	{ 0x0050C2, 0xAA3000, 0xAA3FFF, 78540, 73652 },
+	{ 0x0050C2, 0xAA4000, 0xAA4FFF, 87872, 87911 },
+	{ 0x0050C2, 0xAA5000, 0xAA5FFF, 87923, 87956 },
+	{ 0x0050C2, 0xAA6000, 0xAA6FFF, 87978, 88009 },
+	{ 0x0050C2, 0xAA7000, 0xAA7FFF, 88017, 88027 },
+	{ 0x0050C2, 0xAA8000, 0xAA8FFF, 88037, 88062 },
+	{ 0x0050C2, 0xAA9000, 0xAA9FFF, 88087, 88112 },
+	{ 0x0050C2, 0xAAA000, 0xAAAFFF, 88136, 88161 },
+	{ 0x0050C2, 0xAAB000, 0xAABFFF, 88178, 88204 },
+	{ 0x0050C2, 0xAAC000, 0xAACFFF, 88228, 88241 },
+	{ 0x0050C2, 0xAAD000, 0xAADFFF, 88249, 88269 },
+	{ 0x0050C2, 0xAAE000, 0xAAEFFF, 88276, 88288 },
+	{ 0x0050C2, 0xAAF000, 0xAAFFFF, 88300, 88331 },
+	{ 0x0050C2, 0xAB0000, 0xAB0FFF, 88362, 88403 },
+	{ 0x0050C2, 0xAB1000, 0xAB1FFF, 88438, 88457 },
+	{ 0x0050C2, 0xAB2000, 0xAB2FFF, 88471, 88492 },
+	{ 0x0050C2, 0xAB3000, 0xAB3FFF, 88499, 88545 },
+	{ 0x0050C2, 0xAB4000, 0xAB4FFF, 88581, 88601 },
+	{ 0x0050C2, 0xAB5000, 0xAB5FFF, 19883, 19898 },
+	{ 0x0050C2, 0xAB6000, 0xAB6FFF, 88616, 88650 },
+	{ 0x0050C2, 0xAB7000, 0xAB7FFF, 88684, 88707 },
+	{ 0x0050C2, 0xAB8000, 0xAB8FFF, 88730, 88753 },
+	{ 0x0050C2, 0xAB9000, 0xAB9FFF, 88766, 88776 },
+	{ 0x0050C2, 0xABA000, 0xABAFFF, 61306, 6725 },
+	{ 0x0050C2, 0xABB000, 0xABBFFF, 88786, 88798 },
+	{ 0x0050C2, 0xABC000, 0xABCFFF, 88810, 88818 },
+	{ 0x0050C2, 0xABD000, 0xABDFFF, 4525, 4556 },
+	{ 0x0050C2, 0xABE000, 0xABEFFF, 88826, 88834 },
+	{ 0x0050C2, 0xABF000, 0xABFFFF, 88842, 88863 },
+	{ 0x0050C2, 0xAC0000, 0xAC0FFF, 88875, 88893 },
+	{ 0x0050C2, 0xAC1000, 0xAC1FFF, 88911, 88935 },
+	{ 0x0050C2, 0xAC2000, 0xAC2FFF, 88950, 88962 },
+	{ 0x0050C2, 0xAC3000, 0xAC3FFF, 88973, 88999 },
+	{ 0x0050C2, 0xAC4000, 0xAC4FFF, 22117, 22140 },
+	{ 0x0050C2, 0xAC5000, 0xAC5FFF, 89019, 89041 },
+	{ 0x0050C2, 0xAC6000, 0xAC6FFF, 89057, 89081 },
+	{ 0x0050C2, 0xAC7000, 0xAC7FFF, 15233, 15240 },
+	{ 0x0050C2, 0xAC8000, 0xAC8FFF, 89099, 89121 },
+	{ 0x0050C2, 0xAC9000, 0xAC9FFF, 89138, 89195 },
+	{ 0x0050C2, 0xACA000, 0xACAFFF, 89252, 89285 },
+	{ 0x0050C2, 0xACB000, 0xACBFFF, 89304, 89316 },
+	{ 0x0050C2, 0xACC000, 0xACCFFF, 89323, 89335 },
+	{ 0x0050C2, 0xACD000, 0xACDFFF, 89347, 89369 },
+	{ 0x0050C2, 0xACE000, 0xACEFFF, 89391, 89413 },
+	{ 0x0050C2, 0xACF000, 0xACFFFF, 16880, 16897 },
+	{ 0x0050C2, 0xAD0000, 0xAD0FFF, 89429, 89458 },
+	{ 0x0050C2, 0xAD1000, 0xAD1FFF, 10929, 10953 },
+	{ 0x0050C2, 0xAD2000, 0xAD2FFF, 17515, 17522 },
+	{ 0x0050C2, 0xAD3000, 0xAD3FFF, 78540, 73652 },
+	{ 0x0050C2, 0xAD4000, 0xAD4FFF, 89483, 89506 },
+	{ 0x0050C2, 0xAD5000, 0xAD5FFF, 89524, 89565 },
+	{ 0x0050C2, 0xAD6000, 0xAD6FFF, 89600, 89614 },
+	{ 0x0050C2, 0xAD7000, 0xAD7FFF, 89628, 89645 },
+	{ 0x0050C2, 0xAD8000, 0xAD8FFF, 89658, 89665 },
+	{ 0x0050C2, 0xAD9000, 0xAD9FFF, 89672, 89689 },
+	{ 0x0050C2, 0xADA000, 0xADAFFF, 89706, 89718 },
+	{ 0x0050C2, 0xADB000, 0xADBFFF, 89730, 89750 },
+	{ 0x0050C2, 0xADC000, 0xADCFFF, 89765, 89795 },
+	{ 0x0050C2, 0xADD000, 0xADDFFF, 18191, 18210 },
+	{ 0x0050C2, 0xADE000, 0xADEFFF, 89819, 89832 },
+	{ 0x0050C2, 0xADF000, 0xADFFFF, 89840, 89853 },
+	{ 0x0050C2, 0xAE0000, 0xAE0FFF, 89861, 89878 },
+	{ 0x0050C2, 0xAE1000, 0xAE1FFF, 89891, 89891 },
+	{ 0x0050C2, 0xAE2000, 0xAE2FFF, 89900, 89928 },
+	{ 0x0050C2, 0xAE3000, 0xAE3FFF, 89956, 89956 },
+	{ 0x0050C2, 0xAE4000, 0xAE4FFF, 89960, 89994 },
+	{ 0x0050C2, 0xAE5000, 0xAE5FFF, 90011, 90082 },
+	{ 0x0050C2, 0xAE6000, 0xAE6FFF, 90147, 90157 },
+	{ 0x0050C2, 0xAE7000, 0xAE7FFF, 90167, 90183 },
+	{ 0x0050C2, 0xAE8000, 0xAE8FFF, 90191, 90207 },
+	{ 0x0050C2, 0xAE9000, 0xAE9FFF, 90219, 90246 },
+	{ 0x0050C2, 0xAEA000, 0xAEAFFF, 90268, 90268 },
+	{ 0x0050C2, 0xAEB000, 0xAEBFFF, 90276, 90297 },
+	{ 0x0050C2, 0xAEC000, 0xAECFFF, 90306, 90335 },
+	{ 0x0050C2, 0xAED000, 0xAEDFFF, 90359, 90365 },
+	{ 0x0050C2, 0xAEE000, 0xAEEFFF, 90371, 90383 },
+	{ 0x0050C2, 0xAEF000, 0xAEFFFF, 90389, 90408 },
+	{ 0x0050C2, 0xAF0000, 0xAF0FFF, 16856, 16870 },
+	{ 0x0050C2, 0xAF1000, 0xAF1FFF, 90427, 90439 },
+	{ 0x0050C2, 0xAF2000, 0xAF2FFF, 20008, 20028 },
+	{ 0x0050C2, 0xAF3000, 0xAF3FFF, 90451, 90474 },
+	{ 0x0050C2, 0xAF4000, 0xAF4FFF, 90491, 47106 },
+	{ 0x0050C2, 0xAF5000, 0xAF5FFF, 90505, 90520 },
+	{ 0x0050C2, 0xAF6000, 0xAF6FFF, 90534, 90542 },
+	{ 0x0050C2, 0xAF7000, 0xAF7FFF, 90550, 90583 },
+	{ 0x0050C2, 0xAF8000, 0xAF8FFF, 90611, 90640 },
+	{ 0x0050C2, 0xAF9000, 0xAF9FFF, 90669, 90709 },
+	{ 0x0050C2, 0xAFA000, 0xAFAFFF, 90744, 90773 },
+	{ 0x0050C2, 0xAFB000, 0xAFBFFF, 17210, 17237 },
+	{ 0x0050C2, 0xAFC000, 0xAFCFFF, 90797, 90818 },
+	{ 0x0050C2, 0xAFD000, 0xAFDFFF, 90836, 90855 },
+	{ 0x0050C2, 0xAFE000, 0xAFEFFF, 90868, 90883 },
+	{ 0x0050C2, 0xAFF000, 0xAFFFFF, 90890, 90901 },
+	{ 0x0050C2, 0xB00000, 0xB00FFF, 61306, 6725 },
+	{ 0x0050C2, 0xB01000, 0xB01FFF, 90908, 90929 },
+	{ 0x0050C2, 0xB02000, 0xB02FFF, 90949, 90963 },
+	{ 0x0050C2, 0xB03000, 0xB03FFF, 90970, 91006 },
+	{ 0x0050C2, 0xB04000, 0xB04FFF, 91039, 91052 },
+	{ 0x0050C2, 0xB05000, 0xB05FFF, 91061, 91073 },
+	{ 0x0050C2, 0xB06000, 0xB06FFF, 91078, 91097 },
+	{ 0x0050C2, 0xB07000, 0xB07FFF, 91110, 91110 },
+	{ 0x0050C2, 0xB08000, 0xB08FFF, 13289, 13301 },
+	{ 0x0050C2, 0xB09000, 0xB09FFF, 91117, 91146 },
+	{ 0x0050C2, 0xB0A000, 0xB0AFFF, 91167, 91199 },
+	{ 0x0050C2, 0xB0B000, 0xB0BFFF, 44644, 44654 },
+	{ 0x0050C2, 0xB0C000, 0xB0CFFF, 91226, 91246 },
+	{ 0x0050C2, 0xB0D000, 0xB0DFFF, 91266, 91296 },
+	{ 0x0050C2, 0xB0E000, 0xB0EFFF, 91321, 91335 },
+	{ 0x0050C2, 0xB0F000, 0xB0FFFF, 91349, 91368 },
+	{ 0x0050C2, 0xB10000, 0xB10FFF, 91382, 91415 },
+	{ 0x0050C2, 0xB11000, 0xB11FFF, 91436, 91447 },
+	{ 0x0050C2, 0xB12000, 0xB12FFF, 91452, 91471 },
+	{ 0x0050C2, 0xB13000, 0xB13FFF, 91485, 91513 },
+	{ 0x0050C2, 0xB14000, 0xB14FFF, 8053, 8071 },
+	{ 0x0050C2, 0xB15000, 0xB15FFF, 91531, 91547 },
+	{ 0x0050C2, 0xB16000, 0xB16FFF, 91563, 91579 },
+	{ 0x0050C2, 0xB17000, 0xB17FFF, 91589, 91614 },
+	{ 0x0050C2, 0xB18000, 0xB18FFF, 63276, 63305 },
+	{ 0x0050C2, 0xB19000, 0xB19FFF, 91639, 91660 },
+	{ 0x0050C2, 0xB1A000, 0xB1AFFF, 91669, 91669 },
+	{ 0x0050C2, 0xB1B000, 0xB1BFFF, 91675, 91701 },
+	{ 0x0050C2, 0xB1C000, 0xB1CFFF, 10929, 10953 },
+	{ 0x0050C2, 0xB1D000, 0xB1DFFF, 91720, 91730 },
+	{ 0x0050C2, 0xB1E000, 0xB1EFFF, 91740, 91762 },
+	{ 0x0050C2, 0xB1F000, 0xB1FFFF, 91784, 91805 },
+	{ 0x0050C2, 0xB20000, 0xB20FFF, 91821, 91847 },
+	{ 0x0050C2, 0xB21000, 0xB21FFF, 91861, 91885 },
+	{ 0x0050C2, 0xB22000, 0xB22FFF, 91904, 91935 },
+	{ 0x0050C2, 0xB23000, 0xB23FFF, 91957, 91983 },
+	{ 0x0050C2, 0xB24000, 0xB24FFF, 92008, 92033 },
+	{ 0x0050C2, 0xB25000, 0xB25FFF, 92050, 92060 },
+	{ 0x0050C2, 0xB26000, 0xB26FFF, 92070, 92083 },
+	{ 0x0050C2, 0xB27000, 0xB27FFF, 21955, 21955 },
+	{ 0x0050C2, 0xB28000, 0xB28FFF, 92088, 92107 },
+	{ 0x0050C2, 0xB29000, 0xB29FFF, 92120, 92155 },
+	{ 0x0050C2, 0xB2A000, 0xB2AFFF, 92184, 92204 },
+	{ 0x0050C2, 0xB2B000, 0xB2BFFF, 92219, 92247 },
+	{ 0x0050C2, 0xB2C000, 0xB2CFFF, 92274, 92291 },
+	{ 0x0050C2, 0xB2D000, 0xB2DFFF, 92303, 92333 },
+	{ 0x0050C2, 0xB2E000, 0xB2EFFF, 28194, 28194 },
+	{ 0x0050C2, 0xB2F000, 0xB2FFFF, 92363, 92396 },
+	{ 0x0050C2, 0xB30000, 0xB30FFF, 92423, 92456 },
+	{ 0x0050C2, 0xB31000, 0xB31FFF, 92486, 92499 },
+	{ 0x0050C2, 0xB32000, 0xB32FFF, 92509, 92528 },
+	{ 0x0050C2, 0xB33000, 0xB33FFF, 92543, 92555 },
+	{ 0x0050C2, 0xB34000, 0xB34FFF, 92563, 92578 },
+	{ 0x0050C2, 0xB35000, 0xB35FFF, 92585, 92593 },
+	{ 0x0050C2, 0xB36000, 0xB36FFF, 33726, 33726 },
+	{ 0x0050C2, 0xB37000, 0xB37FFF, 70907, 70925 },
+	{ 0x0050C2, 0xB38000, 0xB38FFF, 92601, 92614 },
+	{ 0x0050C2, 0xB39000, 0xB39FFF, 92623, 92635 },
+	{ 0x0050C2, 0xB3A000, 0xB3AFFF, 92641, 92660 },
+	{ 0x0050C2, 0xB3B000, 0xB3BFFF, 92666, 92683 },
+	{ 0x0050C2, 0xB3C000, 0xB3CFFF, 92695, 92705 },
+	{ 0x0050C2, 0xB3D000, 0xB3DFFF, 92715, 92715 },
+	{ 0x0050C2, 0xB3E000, 0xB3EFFF, 92719, 92736 },
+	{ 0x0050C2, 0xB3F000, 0xB3FFFF, 92753, 92789 },
+	{ 0x0050C2, 0xB40000, 0xB40FFF, 8519, 8535 },
+	{ 0x0050C2, 0xB41000, 0xB41FFF, 92805, 92856 },
+	{ 0x0050C2, 0xB42000, 0xB42FFF, 92906, 92936 },
+	{ 0x0050C2, 0xB43000, 0xB43FFF, 92966, 92981 },
+	{ 0x0050C2, 0xB44000, 0xB44FFF, 92983, 93002 },
+	{ 0x0050C2, 0xB45000, 0xB45FFF, 93017, 93044 },
+	{ 0x0050C2, 0xB46000, 0xB46FFF, 93057, 93066 },
+	{ 0x0050C2, 0xB47000, 0xB47FFF, 93075, 93110 },
+	{ 0x0050C2, 0xB48000, 0xB48FFF, 93131, 93140 },
+	{ 0x0050C2, 0xB49000, 0xB49FFF, 93144, 93166 },
+	{ 0x0050C2, 0xB4A000, 0xB4AFFF, 61306, 6725 },
+	{ 0x0050C2, 0xB4B000, 0xB4BFFF, 93172, 93188 },
+	{ 0x0050C2, 0xB4C000, 0xB4CFFF, 93196, 93207 },
+	{ 0x0050C2, 0xB4D000, 0xB4DFFF, 93218, 93244 },
+	{ 0x0050C2, 0xB4E000, 0xB4EFFF, 93250, 93266 },
+	{ 0x0050C2, 0xB4F000, 0xB4FFFF, 93277, 93292 },
+	{ 0x0050C2, 0xB50000, 0xB50FFF, 24312, 24312 },
+	{ 0x0050C2, 0xB51000, 0xB51FFF, 18144, 18158 },
+	{ 0x0050C2, 0xB52000, 0xB52FFF, 93302, 93319 },
+	{ 0x0050C2, 0xB53000, 0xB53FFF, 93336, 42434 },
+	{ 0x0050C2, 0xB54000, 0xB54FFF, 93343, 93364 },
+	{ 0x0050C2, 0xB55000, 0xB55FFF, 93380, 93416 },
+	{ 0x0050C2, 0xB56000, 0xB56FFF, 93433, 93444 },
+	{ 0x0050C2, 0xB57000, 0xB57FFF, 10929, 10953 },
+	{ 0x0050C2, 0xB58000, 0xB58FFF, 42390, 42402 },
+	{ 0x0050C2, 0xB59000, 0xB59FFF, 41142, 41160 },
+	{ 0x0050C2, 0xB5A000, 0xB5AFFF, 93452, 93472 },
+	{ 0x0050C2, 0xB5B000, 0xB5BFFF, 93491, 93516 },
+	{ 0x0050C2, 0xB5C000, 0xB5CFFF, 93541, 93564 },
+	{ 0x0050C2, 0xB5D000, 0xB5DFFF, 93587, 93614 },
+	{ 0x0050C2, 0xB5E000, 0xB5EFFF, 93636, 93654 },
+	{ 0x0050C2, 0xB5F000, 0xB5FFFF, 93663, 93689 },
+	{ 0x0050C2, 0xB60000, 0xB60FFF, 93715, 93728 },
+	{ 0x0050C2, 0xB61000, 0xB61FFF, 93741, 93751 },
+	{ 0x0050C2, 0xB62000, 0xB62FFF, 93757, 93773 },
+	{ 0x0050C2, 0xB63000, 0xB63FFF, 59142, 59170 },
+	{ 0x0050C2, 0xB64000, 0xB64FFF, 93789, 93804 },
+	{ 0x0050C2, 0xB65000, 0xB65FFF, 78540, 73652 },
+	{ 0x0050C2, 0xB66000, 0xB66FFF, 93814, 93814 },
+	{ 0x0050C2, 0xB67000, 0xB67FFF, 93819, 93839 },
+	{ 0x0050C2, 0xB68000, 0xB68FFF, 93842, 93878 },
+	{ 0x0050C2, 0xB69000, 0xB69FFF, 93889, 93903 },
+	{ 0x0050C2, 0xB6A000, 0xB6AFFF, 10929, 10953 },
+	{ 0x0050C2, 0xB6B000, 0xB6BFFF, 10929, 10953 },
+	{ 0x0050C2, 0xB6C000, 0xB6CFFF, 93910, 93919 },
+	{ 0x0050C2, 0xB6D000, 0xB6DFFF, 93928, 93947 },
+	{ 0x0050C2, 0xB6E000, 0xB6EFFF, 2377, 2385 },
+	{ 0x0050C2, 0xB6F000, 0xB6FFFF, 37736, 37747 },
+	{ 0x0050C2, 0xB70000, 0xB70FFF, 93961, 93990 },
+	{ 0x0050C2, 0xB71000, 0xB71FFF, 94010, 94070 },
+	{ 0x0050C2, 0xB72000, 0xB72FFF, 94114, 94143 },
+	{ 0x0050C2, 0xB73000, 0xB73FFF, 94160, 94190 },
+	{ 0x0050C2, 0xB74000, 0xB74FFF, 94214, 94250 },
+	{ 0x0050C2, 0xB75000, 0xB75FFF, 71404, 71412 },
+	{ 0x0050C2, 0xB76000, 0xB76FFF, 94285, 94303 },
+	{ 0x0050C2, 0xB77000, 0xB77FFF, 94316, 94316 },
+	{ 0x0050C2, 0xB78000, 0xB78FFF, 94325, 94332 },
+	{ 0x0050C2, 0xB79000, 0xB79FFF, 94339, 94365 },
+	{ 0x0050C2, 0xB7A000, 0xB7AFFF, 94386, 94428 },
+	{ 0x0050C2, 0xB7B000, 0xB7BFFF, 94456, 94477 },
+	{ 0x0050C2, 0xB7C000, 0xB7CFFF, 80055, 80067 },
+	{ 0x0050C2, 0xB7D000, 0xB7DFFF, 94486, 94498 },
+	{ 0x0050C2, 0xB7E000, 0xB7EFFF, 94510, 94510 },
+	{ 0x0050C2, 0xB7F000, 0xB7FFFF, 94521, 53188 },
+	{ 0x0050C2, 0xB80000, 0xB80FFF, 94528, 94540 },
+	{ 0x0050C2, 0xB81000, 0xB81FFF, 94548, 94585 },
+	{ 0x0050C2, 0xB82000, 0xB82FFF, 94608, 94622 },
+	{ 0x0050C2, 0xB83000, 0xB83FFF, 94631, 94663 },
+	{ 0x0050C2, 0xB84000, 0xB84FFF, 94689, 94725 },
+	{ 0x0050C2, 0xB85000, 0xB85FFF, 94757, 94767 },
+	{ 0x0050C2, 0xB86000, 0xB86FFF, 94777, 94777 },
+	{ 0x0050C2, 0xB87000, 0xB87FFF, 7646, 7657 },
+	{ 0x0050C2, 0xB88000, 0xB88FFF, 94782, 94805 },
+	{ 0x0050C2, 0xB89000, 0xB89FFF, 94822, 94860 },
+	{ 0x0050C2, 0xB8A000, 0xB8AFFF, 94875, 94886 },
+	{ 0x0050C2, 0xB8B000, 0xB8BFFF, 94897, 94897 },
+	{ 0x0050C2, 0xB8C000, 0xB8CFFF, 8053, 8071 },
+	{ 0x0050C2, 0xB8D000, 0xB8DFFF, 94901, 94901 },
+	{ 0x0050C2, 0xB8E000, 0xB8EFFF, 94907, 94925 },
+	{ 0x0050C2, 0xB8F000, 0xB8FFFF, 94936, 94943 },
+	{ 0x0050C2, 0xB90000, 0xB90FFF, 94950, 94969 },
+	{ 0x0050C2, 0xB91000, 0xB91FFF, 94979, 94999 },
+	{ 0x0050C2, 0xB92000, 0xB92FFF, 54226, 54300 },
+	{ 0x0050C2, 0xB93000, 0xB93FFF, 95014, 95029 },
+	{ 0x0050C2, 0xB94000, 0xB94FFF, 95041, 95067 },
+	{ 0x0050C2, 0xB95000, 0xB95FFF, 95075, 95098 },
+	{ 0x0050C2, 0xB96000, 0xB96FFF, 95121, 95149 },
+	{ 0x0050C2, 0xB97000, 0xB97FFF, 95154, 95162 },
+	{ 0x0050C2, 0xB98000, 0xB98FFF, 95170, 95199 },
+	{ 0x0050C2, 0xB99000, 0xB99FFF, 95228, 95256 },
+	{ 0x0050C2, 0xB9A000, 0xB9AFFF, 95278, 95291 },
+	{ 0x0050C2, 0xB9B000, 0xB9BFFF, 95299, 95321 },
+	{ 0x0050C2, 0xB9C000, 0xB9CFFF, 16363, 16372 },
+	{ 0x0050C2, 0xB9D000, 0xB9DFFF, 95338, 95356 },
+	{ 0x0050C2, 0xB9E000, 0xB9EFFF, 61306, 6725 },
+	{ 0x0050C2, 0xB9F000, 0xB9FFFF, 95368, 95386 },
+	{ 0x0050C2, 0xBA0000, 0xBA0FFF, 95404, 95414 },
+	{ 0x0050C2, 0xBA1000, 0xBA1FFF, 95419, 95445 },
+	{ 0x0050C2, 0xBA2000, 0xBA2FFF, 95458, 95479 },
+	{ 0x0050C2, 0xBA3000, 0xBA3FFF, 86583, 712 },
+	{ 0x0050C2, 0xBA4000, 0xBA4FFF, 95493, 95512 },
+	{ 0x0050C2, 0xBA5000, 0xBA5FFF, 95526, 95543 },
+	{ 0x0050C2, 0xBA6000, 0xBA6FFF, 95556, 95564 },
+	{ 0x0050C2, 0xBA7000, 0xBA7FFF, 95572, 95618 },
+	{ 0x0050C2, 0xBA8000, 0xBA8FFF, 78540, 73652 },
+	{ 0x0050C2, 0xBA9000, 0xBA9FFF, 95658, 95679 },
+	{ 0x0050C2, 0xBAA000, 0xBAAFFF, 95684, 95714 },
+	{ 0x0050C2, 0xBAB000, 0xBABFFF, 95738, 95777 },
+	{ 0x0050C2, 0xBAC000, 0xBACFFF, 95811, 95827 },
+	{ 0x0050C2, 0xBAD000, 0xBADFFF, 95843, 95856 },
+	{ 0x0050C2, 0xBAE000, 0xBAEFFF, 95869, 95892 },
+	{ 0x0050C2, 0xBAF000, 0xBAFFFF, 53408, 53417 },
+	{ 0x0050C2, 0xBB0000, 0xBB0FFF, 95910, 95920 },
+	{ 0x0050C2, 0xBB1000, 0xBB1FFF, 95930, 95939 },
+	{ 0x0050C2, 0xBB2000, 0xBB2FFF, 95948, 28119 },
+	{ 0x0050C2, 0xBB3000, 0xBB3FFF, 95974, 95996 },
+	{ 0x0050C2, 0xBB4000, 0xBB4FFF, 96016, 96049 },
+	{ 0x0050C2, 0xBB5000, 0xBB5FFF, 96082, 96107 },
+	{ 0x0050C2, 0xBB6000, 0xBB6FFF, 96132, 96154 },
+	{ 0x0050C2, 0xBB7000, 0xBB7FFF, 18191, 18210 },
+	{ 0x0050C2, 0xBB8000, 0xBB8FFF, 96161, 96171 },
+	{ 0x0050C2, 0xBB9000, 0xBB9FFF, 51269, 51291 },
+	{ 0x0050C2, 0xBBA000, 0xBBAFFF, 96181, 96199 },
+	{ 0x0050C2, 0xBBB000, 0xBBBFFF, 55229, 55248 },
+	{ 0x0050C2, 0xBBC000, 0xBBCFFF, 96209, 96223 },
+	{ 0x0050C2, 0xBBD000, 0xBBDFFF, 58428, 58440 },
+	{ 0x0050C2, 0xBBE000, 0xBBEFFF, 96237, 96259 },
+	{ 0x0050C2, 0xBBF000, 0xBBFFFF, 10929, 10953 },
+	{ 0x0050C2, 0xBC0000, 0xBC0FFF, 96281, 96301 },
+	{ 0x0050C2, 0xBC1000, 0xBC1FFF, 96321, 96332 },
+	{ 0x0050C2, 0xBC2000, 0xBC2FFF, 96339, 96371 },
+	{ 0x0050C2, 0xBC3000, 0xBC3FFF, 10929, 10953 },
+	{ 0x0050C2, 0xBC4000, 0xBC4FFF, 19350, 19373 },
+	{ 0x0050C2, 0xBC5000, 0xBC5FFF, 96398, 96416 },
+	{ 0x0050C2, 0xBC6000, 0xBC6FFF, 96434, 96445 },
+	{ 0x0050C2, 0xBC7000, 0xBC7FFF, 96456, 96465 },
+	{ 0x0050C2, 0xBC8000, 0xBC8FFF, 96469, 96481 },
+	{ 0x0050C2, 0xBC9000, 0xBC9FFF, 96489, 96511 },
+	{ 0x0050C2, 0xBCA000, 0xBCAFFF, 96533, 96554 },
+	{ 0x0050C2, 0xBCB000, 0xBCBFFF, 96566, 96582 },
+	{ 0x0050C2, 0xBCC000, 0xBCCFFF, 96598, 96626 },
+	{ 0x0050C2, 0xBCD000, 0xBCDFFF, 96648, 96678 },
+	{ 0x0050C2, 0xBCE000, 0xBCEFFF, 96696, 96716 },
+	{ 0x0050C2, 0xBCF000, 0xBCFFFF, 96726, 96760 },
+	{ 0x0050C2, 0xBD0000, 0xBD0FFF, 96792, 96801 },
+	{ 0x0050C2, 0xBD1000, 0xBD1FFF, 96810, 96837 },
+	{ 0x0050C2, 0xBD2000, 0xBD2FFF, 96860, 96874 },
+	{ 0x0050C2, 0xBD3000, 0xBD3FFF, 96883, 96903 },
+	{ 0x0050C2, 0xBD4000, 0xBD4FFF, 96911, 96935 },
+	{ 0x0050C2, 0xBD5000, 0xBD5FFF, 96959, 96976 },
+	{ 0x0050C2, 0xBD6000, 0xBD6FFF, 96988, 97005 },
+	{ 0x0050C2, 0xBD7000, 0xBD7FFF, 97008, 97008 },
+	{ 0x0050C2, 0xBD8000, 0xBD8FFF, 97013, 97036 },
+	{ 0x0050C2, 0xBD9000, 0xBD9FFF, 97054, 97073 },
+	{ 0x0050C2, 0xBDA000, 0xBDAFFF, 97086, 97101 },
+	{ 0x0050C2, 0xBDB000, 0xBDBFFF, 97116, 97129 },
+	{ 0x0050C2, 0xBDC000, 0xBDCFFF, 97137, 97152 },
+	{ 0x0050C2, 0xBDE000, 0xBDEFFF, 97155, 97170 },
+	{ 0x0050C2, 0xBDF000, 0xBDFFFF, 97184, 97208 },
+	{ 0x0050C2, 0xBE0000, 0xBE0FFF, 34255, 34272 },
+	{ 0x0050C2, 0xBE1000, 0xBE1FFF, 16629, 16641 },
+	{ 0x0050C2, 0xBE2000, 0xBE2FFF, 97230, 97257 },
+	{ 0x0050C2, 0xBE3000, 0xBE3FFF, 97279, 97291 },
+	{ 0x0050C2, 0xBE4000, 0xBE4FFF, 36847, 36865 },
+	{ 0x0050C2, 0xBE5000, 0xBE5FFF, 13994, 14002 },
+	{ 0x0050C2, 0xBE6000, 0xBE6FFF, 97299, 97310 },
+	{ 0x0050C2, 0xBE7000, 0xBE7FFF, 97317, 97330 },
+	{ 0x0050C2, 0xBE8000, 0xBE8FFF, 97338, 97370 },
+	{ 0x0050C2, 0xBE9000, 0xBE9FFF, 97396, 97410 },
+	{ 0x0050C2, 0xBEA000, 0xBEAFFF, 97424, 97438 },
+	{ 0x0050C2, 0xBEB000, 0xBEBFFF, 78540, 73652 },
+	{ 0x0050C2, 0xBEC000, 0xBECFFF, 97447, 97471 },
+	{ 0x0050C2, 0xBED000, 0xBEDFFF, 97495, 97517 },
+	{ 0x0050C2, 0xBEE000, 0xBEEFFF, 2377, 2385 },
+	{ 0x0050C2, 0xBEF000, 0xBEFFFF, 97534, 97593 },
+	{ 0x0050C2, 0xBF0000, 0xBF0FFF, 4294, 4294 },
+	{ 0x0050C2, 0xBF1000, 0xBF1FFF, 97644, 97667 },
+	{ 0x0050C2, 0xBF2000, 0xBF2FFF, 61306, 6725 },
+	{ 0x0050C2, 0xBF3000, 0xBF3FFF, 97685, 97696 },
+	{ 0x0050C2, 0xBF4000, 0xBF4FFF, 97702, 97742 },
+	{ 0x0050C2, 0xBF5000, 0xBF5FFF, 97778, 97806 },
+	{ 0x0050C2, 0xBF6000, 0xBF6FFF, 97824, 97847 },
+	{ 0x0050C2, 0xBF7000, 0xBF7FFF, 10929, 10953 },
+	{ 0x0050C2, 0xBF8000, 0xBF8FFF, 97862, 97876 },
+	{ 0x0050C2, 0xBF9000, 0xBF9FFF, 67873, 67883 },
+	{ 0x0050C2, 0xBFA000, 0xBFAFFF, 34650, 34673 },
+	{ 0x0050C2, 0xBFB000, 0xBFBFFF, 97890, 97898 },
+	{ 0x0050C2, 0xBFC000, 0xBFCFFF, 97906, 97927 },
+	{ 0x0050C2, 0xBFD000, 0xBFDFFF, 97936, 97959 },
+	{ 0x0050C2, 0xBFE000, 0xBFEFFF, 97977, 98001 },
+	{ 0x0050C2, 0xBFF000, 0xBFFFFF, 98020, 98034 },
+	{ 0x0050C2, 0xC00000, 0xC00FFF, 20008, 20028 },
+	{ 0x0050C2, 0xC01000, 0xC01FFF, 98036, 98063 },
+	{ 0x0050C2, 0xC02000, 0xC02FFF, 98084, 98120 },
+	{ 0x0050C2, 0xC03000, 0xC03FFF, 98142, 65604 },
+	{ 0x0050C2, 0xC04000, 0xC04FFF, 98161, 98168 },
+	{ 0x0050C2, 0xC05000, 0xC05FFF, 98175, 98195 },
+	{ 0x0050C2, 0xC06000, 0xC06FFF, 98203, 98214 },
+	{ 0x0050C2, 0xC07000, 0xC07FFF, 98225, 98255 },
+	{ 0x0050C2, 0xC08000, 0xC08FFF, 98285, 98295 },
+	{ 0x0050C2, 0xC09000, 0xC09FFF, 22529, 22544 },
+	{ 0x0050C2, 0xC0A000, 0xC0AFFF, 54226, 54300 },
+	{ 0x0050C2, 0xC0B000, 0xC0BFFF, 98305, 98322 },
+	{ 0x0050C2, 0xC0C000, 0xC0CFFF, 98334, 98343 },
+	{ 0x0050C2, 0xC0D000, 0xC0DFFF, 98352, 98365 },
+	{ 0x0050C2, 0xC0E000, 0xC0EFFF, 98377, 98392 },
+	{ 0x0050C2, 0xC0F000, 0xC0FFFF, 11049, 11061 },
+	{ 0x0050C2, 0xC10000, 0xC10FFF, 8053, 8071 },
+	{ 0x0050C2, 0xC11000, 0xC11FFF, 98402, 98438 },
+	{ 0x0050C2, 0xC12000, 0xC12FFF, 98468, 98494 },
+	{ 0x0050C2, 0xC13000, 0xC13FFF, 98511, 98531 },
+	{ 0x0050C2, 0xC14000, 0xC14FFF, 98551, 98574 },
+	{ 0x0050C2, 0xC15000, 0xC15FFF, 98585, 98619 },
+	{ 0x0050C2, 0xC16000, 0xC16FFF, 17677, 17702 },
+	{ 0x0050C2, 0xC17000, 0xC17FFF, 98651, 98670 },
+	{ 0x0050C2, 0xC18000, 0xC18FFF, 98689, 98713 },
+	{ 0x0050C2, 0xC19000, 0xC19FFF, 98732, 98744 },
+	{ 0x0050C2, 0xC1A000, 0xC1AFFF, 98753, 98767 },
+	{ 0x0050C2, 0xC1B000, 0xC1BFFF, 98771, 98786 },
+	{ 0x0050C2, 0xC1C000, 0xC1CFFF, 98796, 98813 },
+	{ 0x0050C2, 0xC1D000, 0xC1DFFF, 98830, 98860 },
+	{ 0x0050C2, 0xC1E000, 0xC1EFFF, 98877, 98892 },
+	{ 0x0050C2, 0xC1F000, 0xC1FFFF, 98907, 98943 },
+	{ 0x0050C2, 0xC20000, 0xC20FFF, 98975, 98994 },
+	{ 0x0050C2, 0xC21000, 0xC21FFF, 2377, 2385 },
+	{ 0x0050C2, 0xC22000, 0xC22FFF, 99008, 99020 },
+	{ 0x0050C2, 0xC23000, 0xC23FFF, 99028, 99040 },
+	{ 0x0050C2, 0xC24000, 0xC24FFF, 99048, 99071 },
+	{ 0x0050C2, 0xC25000, 0xC25FFF, 2377, 2385 },
+	{ 0x0050C2, 0xC26000, 0xC26FFF, 3009, 3047 },
+	{ 0x0050C2, 0xC27000, 0xC27FFF, 99082, 99098 },
+	{ 0x0050C2, 0xC28000, 0xC28FFF, 99114, 99126 },
+	{ 0x0050C2, 0xC29000, 0xC29FFF, 99133, 99159 },
+	{ 0x0050C2, 0xC2A000, 0xC2AFFF, 99178, 83790 },
+	{ 0x0050C2, 0xC2B000, 0xC2BFFF, 99199, 71100 },
+	{ 0x0050C2, 0xC2C000, 0xC2CFFF, 99219, 99241 },
+	{ 0x0050C2, 0xC2D000, 0xC2DFFF, 94010, 94070 },
+	{ 0x0050C2, 0xC2E000, 0xC2EFFF, 99258, 99272 },
+	{ 0x0050C2, 0xC2F000, 0xC2FFFF, 99286, 99297 },
+	{ 0x0050C2, 0xC30000, 0xC30FFF, 99308, 99326 },
+	{ 0x0050C2, 0xC31000, 0xC31FFF, 99339, 99365 },
+	{ 0x0050C2, 0xC32000, 0xC32FFF, 10332, 10351 },
+	{ 0x0050C2, 0xC34000, 0xC34FFF, 99368, 99375 },
+	{ 0x0050C2, 0xC35000, 0xC35FFF, 99382, 99394 },
+	{ 0x0050C2, 0xC36000, 0xC36FFF, 99401, 99410 },
+	{ 0x0050C2, 0xC37000, 0xC37FFF, 2281, 2323 },
+	{ 0x0050C2, 0xC38000, 0xC38FFF, 99414, 99449 },
+	{ 0x0050C2, 0xC39000, 0xC39FFF, 99460, 99469 },
+	{ 0x0050C2, 0xC3A000, 0xC3AFFF, 27631, 27641 },
+	{ 0x0050C2, 0xC3B000, 0xC3BFFF, 99475, 99507 },
+	{ 0x0050C2, 0xC3C000, 0xC3CFFF, 99525, 99539 },
+	{ 0x0050C2, 0xC3D000, 0xC3DFFF, 99546, 99579 },
+	{ 0x0050C2, 0xC3E000, 0xC3EFFF, 99606, 99614 },
+	{ 0x0050C2, 0xC3F000, 0xC3FFFF, 99622, 99647 },
+	{ 0x0050C2, 0xC40000, 0xC40FFF, 99660, 99682 },
+	{ 0x0050C2, 0xC41000, 0xC41FFF, 99696, 99710 },
+	{ 0x0050C2, 0xC42000, 0xC42FFF, 61306, 6725 },
+	{ 0x0050C2, 0xC43000, 0xC43FFF, 99719, 99735 },
+	{ 0x0050C2, 0xC44000, 0xC44FFF, 99743, 99786 },
+	{ 0x0050C2, 0xC45000, 0xC45FFF, 99819, 99853 },
+	{ 0x0050C2, 0xC46000, 0xC46FFF, 99882, 99900 },
+	{ 0x0050C2, 0xC47000, 0xC47FFF, 99904, 99933 },
+	{ 0x0050C2, 0xC48000, 0xC48FFF, 99953, 99979 },
+	{ 0x0050C2, 0xC49000, 0xC49FFF, 99991, 100013 },
+	{ 0x0050C2, 0xC4A000, 0xC4AFFF, 100030, 100068 },
+	{ 0x0050C2, 0xC4B000, 0xC4BFFF, 100089, 100115 },
+	{ 0x0050C2, 0xC4C000, 0xC4CFFF, 100133, 100157 },
+	{ 0x0050C2, 0xC4D000, 0xC4DFFF, 100176, 100206 },
+	{ 0x0050C2, 0xC4E000, 0xC4EFFF, 100228, 100237 },
+	{ 0x0050C2, 0xC4F000, 0xC4FFFF, 80099, 80114 },
+	{ 0x0050C2, 0xC50000, 0xC50FFF, 61331, 61359 },
+	{ 0x0050C2, 0xC51000, 0xC51FFF, 100243, 100267 },
+	{ 0x0050C2, 0xC52000, 0xC52FFF, 100285, 100302 },
+	{ 0x0050C2, 0xC53000, 0xC53FFF, 100313, 100335 },
+	{ 0x0050C2, 0xC54000, 0xC54FFF, 100357, 100370 },
+	{ 0x0050C2, 0xC55000, 0xC55FFF, 100383, 100404 },
+	{ 0x0050C2, 0xC56000, 0xC56FFF, 60542, 60565 },
+	{ 0x0050C2, 0xC57000, 0xC57FFF, 100414, 100438 },
+	{ 0x0050C2, 0xC58000, 0xC58FFF, 100456, 100478 },
+	{ 0x0050C2, 0xC59000, 0xC59FFF, 100495, 100509 },
+	{ 0x0050C2, 0xC5A000, 0xC5AFFF, 100523, 100537 },
+	{ 0x0050C2, 0xC5B000, 0xC5BFFF, 100551, 100566 },
+	{ 0x0050C2, 0xC5C000, 0xC5CFFF, 100581, 100603 },
+	{ 0x0050C2, 0xC5D000, 0xC5DFFF, 100622, 100632 },
+	{ 0x0050C2, 0xC5E000, 0xC5EFFF, 100642, 100670 },
+	{ 0x0050C2, 0xC5F000, 0xC5FFFF, 63221, 63239 },
+	{ 0x0050C2, 0xC60000, 0xC60FFF, 100692, 100725 },
+	{ 0x0050C2, 0xC61000, 0xC61FFF, 100750, 100781 },
+	{ 0x0050C2, 0xC62000, 0xC62FFF, 100804, 100833 },
+	{ 0x0050C2, 0xC63000, 0xC63FFF, 100846, 100877 },
+	{ 0x0050C2, 0xC64000, 0xC64FFF, 100900, 100930 },
+	{ 0x0050C2, 0xC65000, 0xC65FFF, 100951, 100990 },
+	{ 0x0050C2, 0xC66000, 0xC66FFF, 101028, 101056 },
+	{ 0x0050C2, 0xC67000, 0xC67FFF, 101079, 101101 },
+	{ 0x0050C2, 0xC68000, 0xC68FFF, 101119, 101147 },
+	{ 0x0050C2, 0xC69000, 0xC69FFF, 101169, 101183 },
+	{ 0x0050C2, 0xC6A000, 0xC6AFFF, 101188, 101205 },
+	{ 0x0050C2, 0xC6B000, 0xC6BFFF, 101222, 101241 },
+	{ 0x0050C2, 0xC6C000, 0xC6CFFF, 16217, 16228 },
+	{ 0x0050C2, 0xC6D000, 0xC6DFFF, 101259, 101278 },
+	{ 0x0050C2, 0xC6E000, 0xC6EFFF, 101287, 101302 },
+	{ 0x0050C2, 0xC6F000, 0xC6FFFF, 101314, 101349 },
+	{ 0x0050C2, 0xC70000, 0xC70FFF, 101379, 101401 },
+	{ 0x0050C2, 0xC71000, 0xC71FFF, 101407, 101436 },
+	{ 0x0050C2, 0xC72000, 0xC72FFF, 101450, 101456 },
+	{ 0x0050C2, 0xC73000, 0xC73FFF, 101462, 101486 },
+	{ 0x0050C2, 0xC74000, 0xC74FFF, 101504, 101516 },
+	{ 0x0050C2, 0xC75000, 0xC75FFF, 101523, 101535 },
+	{ 0x0050C2, 0xC76000, 0xC76FFF, 101547, 101563 },
+	{ 0x0050C2, 0xC77000, 0xC77FFF, 101579, 4294 },
+	{ 0x0050C2, 0xC78000, 0xC78FFF, 101591, 101605 },
+	{ 0x0050C2, 0xC79000, 0xC79FFF, 101619, 101638 },
+	{ 0x0050C2, 0xC7A000, 0xC7AFFF, 40505, 40522 },
+	{ 0x0050C2, 0xC7B000, 0xC7BFFF, 44644, 44654 },
+	{ 0x0050C2, 0xC7C000, 0xC7CFFF, 101649, 101676 },
+	{ 0x0050C2, 0xC7D000, 0xC7DFFF, 101698, 101723 },
+	{ 0x0050C2, 0xC7E000, 0xC7EFFF, 101743, 101763 },
+	{ 0x0050C2, 0xC7F000, 0xC7FFFF, 101778, 101800 },
+	{ 0x0050C2, 0xC80000, 0xC80FFF, 101818, 101827 },
+	{ 0x0050C2, 0xC81000, 0xC81FFF, 101836, 101857 },
+	{ 0x0050C2, 0xC82000, 0xC82FFF, 101878, 101896 },
+	{ 0x0050C2, 0xC83000, 0xC83FFF, 101914, 101934 },
+	{ 0x0050C2, 0xC84000, 0xC84FFF, 80456, 80456 },
+	{ 0x0050C2, 0xC85000, 0xC85FFF, 78540, 73652 },
+	{ 0x0050C2, 0xC86000, 0xC86FFF, 101941, 101986 },
+	{ 0x0050C2, 0xC87000, 0xC87FFF, 25559, 25576 },
+	{ 0x0050C2, 0xC88000, 0xC88FFF, 102025, 102068 },
+	{ 0x0050C2, 0xC89000, 0xC89FFF, 102110, 102132 },
+	{ 0x0050C2, 0xC8A000, 0xC8AFFF, 102154, 102185 },
+	{ 0x0050C2, 0xC8B000, 0xC8BFFF, 102210, 102218 },
+	{ 0x0050C2, 0xC8C000, 0xC8CFFF, 102226, 102248 },
+	{ 0x0050C2, 0xC8D000, 0xC8DFFF, 102265, 102296 },
+	{ 0x0050C2, 0xC8E000, 0xC8EFFF, 102323, 102331 },
+	{ 0x0050C2, 0xC8F000, 0xC8FFFF, 8053, 8071 },
+	{ 0x0050C2, 0xC90000, 0xC90FFF, 42390, 42402 },
+	{ 0x0050C2, 0xC91000, 0xC91FFF, 102339, 102363 },
+	{ 0x0050C2, 0xC92000, 0xC92FFF, 7646, 7657 },
+	{ 0x0050C2, 0xC93000, 0xC93FFF, 102382, 102398 },
+	{ 0x0050C2, 0xC94000, 0xC94FFF, 102410, 102433 },
+	{ 0x0050C2, 0xC95000, 0xC95FFF, 102450, 102463 },
+	{ 0x0050C2, 0xC96000, 0xC96FFF, 102469, 102480 },
+	{ 0x0050C2, 0xC97000, 0xC97FFF, 102491, 102510 },
+	{ 0x0050C2, 0xC98000, 0xC98FFF, 102519, 102542 },
+	{ 0x0050C2, 0xC99000, 0xC99FFF, 102552, 102581 },
+	{ 0x0050C2, 0xC9A000, 0xC9AFFF, 102598, 102616 },
+	{ 0x0050C2, 0xC9B000, 0xC9BFFF, 102632, 102650 },
+	{ 0x0050C2, 0xC9C000, 0xC9CFFF, 61306, 6725 },
+	{ 0x0050C2, 0xC9D000, 0xC9DFFF, 102653, 56800 },
+	{ 0x0050C2, 0xC9E000, 0xC9EFFF, 34650, 34673 },
+	{ 0x0050C2, 0xC9F000, 0xC9FFFF, 102670, 102681 },
+	{ 0x0050C2, 0xCA0000, 0xCA0FFF, 102691, 102711 },
+	{ 0x0050C2, 0xCA1000, 0xCA1FFF, 102726, 102749 },
+	{ 0x0050C2, 0xCA2000, 0xCA2FFF, 102772, 102792 },
+	{ 0x0050C2, 0xCA3000, 0xCA3FFF, 37736, 37747 },
+	{ 0x0050C2, 0xCA4000, 0xCA4FFF, 102812, 102829 },
+	{ 0x0050C2, 0xCA5000, 0xCA5FFF, 102846, 102861 },
+	{ 0x0050C2, 0xCA6000, 0xCA6FFF, 102868, 30762 },
+	{ 0x0050C2, 0xCA7000, 0xCA7FFF, 102881, 102906 },
+	{ 0x0050C2, 0xCA8000, 0xCA8FFF, 102931, 102962 },
+	{ 0x0050C2, 0xCA9000, 0xCA9FFF, 102980, 103000 },
+	{ 0x0050C2, 0xCAA000, 0xCAAFFF, 86583, 712 },
+	{ 0x0050C2, 0xCAB000, 0xCABFFF, 58928, 58957 },
+	{ 0x0050C2, 0xCAC000, 0xCACFFF, 103020, 103048 },
+	{ 0x0050C2, 0xCAD000, 0xCADFFF, 103068, 103094 },
+	{ 0x0050C2, 0xCAE000, 0xCAEFFF, 103120, 103153 },
+	{ 0x0050C2, 0xCAF000, 0xCAFFFF, 16856, 16870 },
+	{ 0x0050C2, 0xCB0000, 0xCB0FFF, 103180, 103195 },
+	{ 0x0050C2, 0xCB1000, 0xCB1FFF, 103205, 103221 },
+	{ 0x0050C2, 0xCB2000, 0xCB2FFF, 103233, 103254 },
+	{ 0x0050C2, 0xCB3000, 0xCB3FFF, 65467, 23109 },
+	{ 0x0050C2, 0xCB4000, 0xCB4FFF, 103275, 103302 },
+	{ 0x0050C2, 0xCB5000, 0xCB5FFF, 2377, 2385 },
+	{ 0x0050C2, 0xCB6000, 0xCB6FFF, 103324, 103340 },
+	{ 0x0050C2, 0xCB7000, 0xCB7FFF, 103352, 103365 },
+	{ 0x0050C2, 0xCB8000, 0xCB8FFF, 103373, 103384 },
+	{ 0x0050C2, 0xCB9000, 0xCB9FFF, 103390, 103408 },
+	{ 0x0050C2, 0xCBA000, 0xCBAFFF, 10145, 10174 },
+	{ 0x0050C2, 0xCBB000, 0xCBBFFF, 103426, 103440 },
+	{ 0x0050C2, 0xCBC000, 0xCBCFFF, 103449, 103466 },
+	{ 0x0050C2, 0xCBD000, 0xCBDFFF, 103480, 103504 },
+	{ 0x0050C2, 0xCBE000, 0xCBEFFF, 103524, 103546 },
+	{ 0x0050C2, 0xCBF000, 0xCBFFFF, 103556, 103567 },
+	{ 0x0050C2, 0xCC0000, 0xCC0FFF, 103578, 103607 },
+	{ 0x0050C2, 0xCC1000, 0xCC1FFF, 103628, 103651 },
+	{ 0x0050C2, 0xCC2000, 0xCC2FFF, 103673, 103699 },
+	{ 0x0050C2, 0xCC3000, 0xCC3FFF, 103720, 103742 },
+	{ 0x0050C2, 0xCC4000, 0xCC4FFF, 18191, 18210 },
+	{ 0x0050C2, 0xCC5000, 0xCC5FFF, 103751, 103763 },
+	{ 0x0050C2, 0xCC6000, 0xCC6FFF, 103772, 103772 },
+	{ 0x0050C2, 0xCC7000, 0xCC7FFF, 103776, 103805 },
+	{ 0x0050C2, 0xCC8000, 0xCC8FFF, 2377, 2385 },
+	{ 0x0050C2, 0xCC9000, 0xCC9FFF, 103823, 103836 },
+	{ 0x0050C2, 0xCCA000, 0xCCAFFF, 103844, 103861 },
+	{ 0x0050C2, 0xCCB000, 0xCCBFFF, 103878, 103903 },
+	{ 0x0050C2, 0xCCC000, 0xCCCFFF, 103915, 103935 },
+	{ 0x0050C2, 0xCCD000, 0xCCDFFF, 103944, 103970 },
+	{ 0x0050C2, 0xCCE000, 0xCCEFFF, 103987, 104008 },
+	{ 0x0050C2, 0xCCF000, 0xCCFFFF, 68925, 68958 },
+	{ 0x0050C2, 0xCD0000, 0xCD0FFF, 104017, 104045 },
+	{ 0x0050C2, 0xCD1000, 0xCD1FFF, 20008, 20028 },
+	{ 0x0050C2, 0xCD2000, 0xCD2FFF, 104073, 104096 },
+	{ 0x0050C2, 0xCD3000, 0xCD3FFF, 104112, 104126 },
+	{ 0x0050C2, 0xCD4000, 0xCD4FFF, 104140, 104153 },
+	{ 0x0050C2, 0xCD5000, 0xCD5FFF, 70122, 70146 },
+	{ 0x0050C2, 0xCD6000, 0xCD6FFF, 104161, 104176 },
+	{ 0x0050C2, 0xCD7000, 0xCD7FFF, 61306, 6725 },
+	{ 0x0050C2, 0xCD8000, 0xCD8FFF, 104183, 104208 },
+	{ 0x0050C2, 0xCD9000, 0xCD9FFF, 104214, 104245 },
+	{ 0x0050C2, 0xCDA000, 0xCDAFFF, 77348, 77360 },
+	{ 0x0050C2, 0xCDB000, 0xCDBFFF, 104270, 104281 },
+	{ 0x0050C2, 0xCDC000, 0xCDCFFF, 54226, 54300 },
+	{ 0x0050C2, 0xCDD000, 0xCDDFFF, 104288, 104310 },
+	{ 0x0050C2, 0xCDE000, 0xCDEFFF, 14096, 14121 },
+	{ 0x0050C2, 0xCDF000, 0xCDFFFF, 104323, 104355 },
+	{ 0x0050C2, 0xCE0000, 0xCE0FFF, 104381, 1285 },
+	{ 0x0050C2, 0xCE1000, 0xCE1FFF, 104412, 104427 },
+	{ 0x0050C2, 0xCE2000, 0xCE2FFF, 27631, 27641 },
+	{ 0x0050C2, 0xCE3000, 0xCE3FFF, 104437, 104473 },
+	{ 0x0050C2, 0xCE4000, 0xCE4FFF, 104509, 104509 },
+	{ 0x0050C2, 0xCE5000, 0xCE5FFF, 104519, 104533 },
+	{ 0x0050C2, 0xCE6000, 0xCE6FFF, 104546, 104566 },
+	{ 0x0050C2, 0xCE7000, 0xCE7FFF, 104586, 104601 },
+	{ 0x0050C2, 0xCE8000, 0xCE8FFF, 104608, 104623 },
+	{ 0x0050C2, 0xCE9000, 0xCE9FFF, 2377, 2385 },
+	{ 0x0050C2, 0xCEA000, 0xCEAFFF, 8053, 8071 },
+	{ 0x0050C2, 0xCEB000, 0xCEBFFF, 104636, 104663 },
+	{ 0x0050C2, 0xCEC000, 0xCECFFF, 37281, 37301 },
+	{ 0x0050C2, 0xCED000, 0xCEDFFF, 104678, 104713 },
+	{ 0x0050C2, 0xCEE000, 0xCEEFFF, 104743, 104755 },
+	{ 0x0050C2, 0xCEF000, 0xCEFFFF, 104767, 104798 },
+	{ 0x0050C2, 0xCF0000, 0xCF0FFF, 104829, 104841 },
+	{ 0x0050C2, 0xCF1000, 0xCF1FFF, 104852, 104866 },
+	{ 0x0050C2, 0xCF2000, 0xCF2FFF, 104880, 104909 },
+	{ 0x0050C2, 0xCF3000, 0xCF3FFF, 104924, 104946 },
+	{ 0x0050C2, 0xCF4000, 0xCF4FFF, 22604, 22629 },
+	{ 0x0050C2, 0xCF5000, 0xCF5FFF, 37341, 37349 },
+	{ 0x0050C2, 0xCF6000, 0xCF6FFF, 56507, 56515 },
+	{ 0x0050C2, 0xCF7000, 0xCF7FFF, 104968, 104996 },
+	{ 0x0050C2, 0xCF8000, 0xCF8FFF, 105020, 105052 },
+	{ 0x0050C2, 0xCF9000, 0xCF9FFF, 62092, 62117 },
+	{ 0x0050C2, 0xCFA000, 0xCFAFFF, 36847, 36865 },
+	{ 0x0050C2, 0xCFB000, 0xCFBFFF, 105084, 105108 },
+	{ 0x0050C2, 0xCFC000, 0xCFCFFF, 105121, 105137 },
+	{ 0x0050C2, 0xCFD000, 0xCFDFFF, 105149, 105162 },
+	{ 0x0050C2, 0xCFE000, 0xCFEFFF, 105170, 105181 },
+	{ 0x0050C2, 0xCFF000, 0xCFFFFF, 35387, 35403 },
+	{ 0x0050C2, 0xD00000, 0xD00FFF, 105192, 105229 },
+	{ 0x0050C2, 0xD01000, 0xD01FFF, 105261, 105287 },
+	{ 0x0050C2, 0xD02000, 0xD02FFF, 105313, 13601 },
+	{ 0x0050C2, 0xD03000, 0xD03FFF, 105339, 105363 },
+	{ 0x0050C2, 0xD04000, 0xD04FFF, 105386, 105402 },
+	{ 0x0050C2, 0xD06000, 0xD06FFF, 105418, 105435 },
+	{ 0x0050C2, 0xD07000, 0xD07FFF, 105448, 105457 },
+	{ 0x0050C2, 0xD08000, 0xD08FFF, 105461, 105497 },
+	{ 0x0050C2, 0xD09000, 0xD09FFF, 105528, 105541 },
+	{ 0x0050C2, 0xD0A000, 0xD0AFFF, 105550, 105569 },
+	{ 0x0050C2, 0xD0B000, 0xD0BFFF, 105578, 105603 },
+	{ 0x0050C2, 0xD0C000, 0xD0CFFF, 105616, 105640 },
+	{ 0x0050C2, 0xD0D000, 0xD0DFFF, 105664, 105691 },
+	{ 0x0050C2, 0xD0E000, 0xD0EFFF, 105713, 105738 },
+	{ 0x0050C2, 0xD0F000, 0xD0FFFF, 61306, 6725 },
+	{ 0x0050C2, 0xD10000, 0xD10FFF, 105758, 63305 },
+	{ 0x0050C2, 0xD11000, 0xD11FFF, 93144, 93166 },
+	{ 0x0050C2, 0xD12000, 0xD12FFF, 105784, 105804 },
+	{ 0x0050C2, 0xD13000, 0xD13FFF, 105815, 105840 },
+	{ 0x0050C2, 0xD14000, 0xD14FFF, 105858, 12311 },
+	{ 0x0050C2, 0xD15000, 0xD15FFF, 105868, 105884 },
+	{ 0x0050C2, 0xD16000, 0xD16FFF, 105895, 105925 },
+	{ 0x0050C2, 0xD17000, 0xD17FFF, 33692, 33702 },
+	{ 0x0050C2, 0xD18000, 0xD18FFF, 105941, 105959 },
+	{ 0x0050C2, 0xD19000, 0xD19FFF, 105964, 106019 },
+	{ 0x0050C2, 0xD1A000, 0xD1AFFF, 25774, 25790 },
+	{ 0x0050C2, 0xD1B000, 0xD1BFFF, 106061, 106074 },
+	{ 0x0050C2, 0xD1C000, 0xD1CFFF, 106082, 106102 },
+	{ 0x0050C2, 0xD1D000, 0xD1DFFF, 106117, 106136 },
+	{ 0x0050C2, 0xD1E000, 0xD1EFFF, 106151, 106172 },
+	{ 0x0050C2, 0xD1F000, 0xD1FFFF, 106179, 106198 },
+	{ 0x0050C2, 0xD20000, 0xD20FFF, 42847, 42854 },
+	{ 0x0050C2, 0xD21000, 0xD21FFF, 106217, 106247 },
+	{ 0x0050C2, 0xD22000, 0xD22FFF, 106266, 106289 },
+	{ 0x0050C2, 0xD23000, 0xD23FFF, 106295, 106321 },
+	{ 0x0050C2, 0xD24000, 0xD24FFF, 106331, 106347 },
+	{ 0x0050C2, 0xD25000, 0xD25FFF, 106363, 106382 },
+	{ 0x0050C2, 0xD26000, 0xD26FFF, 106398, 106408 },
+	{ 0x0050C2, 0xD27000, 0xD27FFF, 106418, 16870 },
+	{ 0x0050C2, 0xD28000, 0xD28FFF, 94010, 94070 },
+	{ 0x0050C2, 0xD29000, 0xD29FFF, 106431, 106451 },
+	{ 0x0050C2, 0xD2A000, 0xD2AFFF, 106471, 106503 },
+	{ 0x0050C2, 0xD2B000, 0xD2BFFF, 106530, 106560 },
+	{ 0x0050C2, 0xD2C000, 0xD2CFFF, 106584, 106614 },
+	{ 0x0050C2, 0xD2D000, 0xD2DFFF, 55746, 55770 },
+	{ 0x0050C2, 0xD2E000, 0xD2EFFF, 106644, 106696 },
+	{ 0x0050C2, 0xD2F000, 0xD2FFFF, 106736, 33348 },
+	{ 0x0050C2, 0xD30000, 0xD30FFF, 106754, 106784 },
+	{ 0x0050C2, 0xD31000, 0xD31FFF, 106800, 106825 },
+	{ 0x0050C2, 0xD32000, 0xD32FFF, 99178, 83790 },
+	{ 0x0050C2, 0xD33000, 0xD33FFF, 106845, 106861 },
+	{ 0x0050C2, 0xD34000, 0xD34FFF, 106871, 106887 },
+	{ 0x0050C2, 0xD35000, 0xD35FFF, 106897, 106922 },
+	{ 0x0050C2, 0xD36000, 0xD36FFF, 53173, 53188 },
+	{ 0x0050C2, 0xD37000, 0xD37FFF, 106925, 106948 },
+	{ 0x0050C2, 0xD38000, 0xD38FFF, 106963, 106990 },
+	{ 0x0050C2, 0xD39000, 0xD39FFF, 107008, 107016 },
+	{ 0x0050C2, 0xD3A000, 0xD3AFFF, 107024, 107047 },
+	{ 0x0050C2, 0xD3B000, 0xD3BFFF, 107070, 107081 },
+	{ 0x0050C2, 0xD3C000, 0xD3CFFF, 107087, 107103 },
+	{ 0x0050C2, 0xD3D000, 0xD3DFFF, 107119, 107143 },
+	{ 0x0050C2, 0xD3E000, 0xD3EFFF, 107162, 107186 },
+	{ 0x0050C2, 0xD3F000, 0xD3FFFF, 107194, 11487 },
+	{ 0x0050C2, 0xD40000, 0xD40FFF, 107226, 107242 },
+	{ 0x0050C2, 0xD41000, 0xD41FFF, 107258, 107276 },
+	{ 0x0050C2, 0xD42000, 0xD42FFF, 107288, 107305 },
+	{ 0x0050C2, 0xD43000, 0xD43FFF, 107317, 107329 },
+	{ 0x0050C2, 0xD44000, 0xD44FFF, 61306, 6725 },
+	{ 0x0050C2, 0xD45000, 0xD45FFF, 107337, 107352 },
+	{ 0x0050C2, 0xD46000, 0xD46FFF, 107362, 107382 },
+	{ 0x0050C2, 0xD47000, 0xD47FFF, 34650, 34673 },
+	{ 0x0050C2, 0xD48000, 0xD48FFF, 107399, 107441 },
+	{ 0x0050C2, 0xD49000, 0xD49FFF, 62943, 16301 },
+	{ 0x0050C2, 0xD4A000, 0xD4AFFF, 45315, 45326 },
+	{ 0x0050C2, 0xD4B000, 0xD4BFFF, 107478, 107494 },
+	{ 0x0050C2, 0xD4C000, 0xD4CFFF, 107510, 107537 },
+	{ 0x0050C2, 0xD4D000, 0xD4DFFF, 107559, 107591 },
+	{ 0x0050C2, 0xD4E000, 0xD4EFFF, 8053, 8071 },
+	{ 0x0050C2, 0xD4F000, 0xD4FFFF, 107618, 107629 },
+	{ 0x0050C2, 0xD50000, 0xD50FFF, 107635, 107661 },
+	{ 0x0050C2, 0xD51000, 0xD51FFF, 107681, 80067 },
+	{ 0x0050C2, 0xD52000, 0xD52FFF, 107693, 107729 },
+	{ 0x0050C2, 0xD53000, 0xD53FFF, 107759, 107773 },
+	{ 0x0050C2, 0xD54000, 0xD54FFF, 107787, 107802 },
+	{ 0x0050C2, 0xD55000, 0xD55FFF, 107810, 107826 },
+	{ 0x0050C2, 0xD56000, 0xD56FFF, 107842, 22584 },
+	{ 0x0050C2, 0xD57000, 0xD57FFF, 107871, 107892 },
+	{ 0x0050C2, 0xD58000, 0xD58FFF, 107907, 107927 },
+	{ 0x0050C2, 0xD59000, 0xD59FFF, 107943, 107961 },
+	{ 0x0050C2, 0xD5A000, 0xD5AFFF, 107979, 108012 },
+	{ 0x0050C2, 0xD5B000, 0xD5BFFF, 108032, 108048 },
+	{ 0x0050C2, 0xD5C000, 0xD5CFFF, 108059, 108071 },
+	{ 0x0050C2, 0xD5D000, 0xD5DFFF, 63406, 63432 },
+	{ 0x0050C2, 0xD5E000, 0xD5EFFF, 108078, 108093 },
+	{ 0x0050C2, 0xD5F000, 0xD5FFFF, 108103, 108136 },
+	{ 0x0050C2, 0xD60000, 0xD60FFF, 108159, 108190 },
+	{ 0x0050C2, 0xD61000, 0xD61FFF, 108211, 108224 },
+	{ 0x0050C2, 0xD62000, 0xD62FFF, 7646, 7657 },
+	{ 0x0050C2, 0xD63000, 0xD63FFF, 108232, 108247 },
+	{ 0x0050C2, 0xD64000, 0xD64FFF, 108257, 108266 },
+	{ 0x0050C2, 0xD65000, 0xD65FFF, 108270, 108289 },
+	{ 0x0050C2, 0xD66000, 0xD66FFF, 108292, 108306 },
+	{ 0x0050C2, 0xD67000, 0xD67FFF, 108320, 108341 },
+	{ 0x0050C2, 0xD68000, 0xD68FFF, 108355, 108374 },
+	{ 0x0050C2, 0xD69000, 0xD69FFF, 108387, 108403 },
+	{ 0x0050C2, 0xD6A000, 0xD6AFFF, 108407, 108456 },
+	{ 0x0050C2, 0xD6B000, 0xD6BFFF, 108489, 108506 },
+	{ 0x0050C2, 0xD6C000, 0xD6CFFF, 108523, 108541 },
+	{ 0x0050C2, 0xD6D000, 0xD6DFFF, 108547, 108580 },
+	{ 0x0050C2, 0xD6E000, 0xD6EFFF, 108613, 108635 },
+	{ 0x0050C2, 0xD6F000, 0xD6FFFF, 108651, 108675 },
+	{ 0x0050C2, 0xD70000, 0xD70FFF, 108694, 108728 },
+	{ 0x0050C2, 0xD71000, 0xD71FFF, 7646, 7657 },
+	{ 0x0050C2, 0xD72000, 0xD72FFF, 108746, 108763 },
+	{ 0x0050C2, 0xD73000, 0xD73FFF, 61306, 6725 },
+	{ 0x0050C2, 0xD74000, 0xD74FFF, 108774, 108798 },
+	{ 0x0050C2, 0xD75000, 0xD75FFF, 108808, 108822 },
+	{ 0x0050C2, 0xD76000, 0xD76FFF, 21865, 21873 },
+	{ 0x0050C2, 0xD77000, 0xD77FFF, 108836, 98365 },
+	{ 0x0050C2, 0xD78000, 0xD78FFF, 108848, 108864 },
+	{ 0x0050C2, 0xD79000, 0xD79FFF, 108880, 108901 },
+	{ 0x0050C2, 0xD7A000, 0xD7AFFF, 108908, 40848 },
+	{ 0x0050C2, 0xD7B000, 0xD7BFFF, 108928, 108939 },
+	{ 0x0050C2, 0xD7C000, 0xD7CFFF, 108945, 108971 },
+	{ 0x0050C2, 0xD7D000, 0xD7DFFF, 108985, 109005 },
+	{ 0x0050C2, 0xD7E000, 0xD7EFFF, 109025, 109041 },
+	{ 0x0050C2, 0xD7F000, 0xD7FFFF, 109054, 109071 },
+	{ 0x0050C2, 0xD80000, 0xD80FFF, 8053, 8071 },
+	{ 0x0050C2, 0xD81000, 0xD81FFF, 16629, 16641 },
+	{ 0x0050C2, 0xD82000, 0xD82FFF, 109088, 109109 },
+	{ 0x0050C2, 0xD83000, 0xD83FFF, 71404, 71412 },
+	{ 0x0050C2, 0xD84000, 0xD84FFF, 54226, 54300 },
+	{ 0x0050C2, 0xD85000, 0xD85FFF, 109125, 109125 },
+	{ 0x0050C2, 0xD86000, 0xD86FFF, 109131, 109141 },
+	{ 0x0050C2, 0xD87000, 0xD87FFF, 109151, 109183 },
+	{ 0x0050C2, 0xD88000, 0xD88FFF, 109208, 109240 },
+	{ 0x0050C2, 0xD89000, 0xD89FFF, 109259, 109297 },
+	{ 0x0050C2, 0xD8A000, 0xD8AFFF, 109330, 109366 },
+	{ 0x0050C2, 0xD8B000, 0xD8BFFF, 27631, 27641 },
+	{ 0x0050C2, 0xD8C000, 0xD8CFFF, 109401, 109413 },
+	{ 0x0050C2, 0xD8D000, 0xD8DFFF, 109425, 109440 },
+	{ 0x0050C2, 0xD8E000, 0xD8EFFF, 109455, 109487 },
+	{ 0x0050C2, 0xD8F000, 0xD8FFFF, 109499, 109508 },
+	{ 0x0050C2, 0xD90000, 0xD90FFF, 109517, 109534 },
+	{ 0x0050C2, 0xD91000, 0xD91FFF, 22297, 22312 },
+	{ 0x0050C2, 0xD92000, 0xD92FFF, 109540, 109545 },
+	{ 0x0050C2, 0xD93000, 0xD93FFF, 109550, 109559 },
+	{ 0x0050C2, 0xD94000, 0xD94FFF, 109568, 109601 },
+	{ 0x0050C2, 0xD95000, 0xD95FFF, 44644, 44654 },
+	{ 0x0050C2, 0xD96000, 0xD96FFF, 109629, 29166 },
+	{ 0x0050C2, 0xD97000, 0xD97FFF, 109641, 109661 },
+	{ 0x0050C2, 0xD98000, 0xD98FFF, 109665, 109686 },
+	{ 0x0050C2, 0xD99000, 0xD99FFF, 109701, 109720 },
+	{ 0x0050C2, 0xD9A000, 0xD9AFFF, 61306, 6725 },
+	{ 0x0050C2, 0xD9B000, 0xD9BFFF, 48908, 48932 },
+	{ 0x0050C2, 0xD9C000, 0xD9CFFF, 109737, 69089 },
+	{ 0x0050C2, 0xD9D000, 0xD9DFFF, 66026, 66053 },
+	{ 0x0050C2, 0xD9E000, 0xD9EFFF, 17210, 17237 },
+	{ 0x0050C2, 0xD9F000, 0xD9FFFF, 109756, 109773 },
+	{ 0x0050C2, 0xDA0000, 0xDA0FFF, 109790, 109808 },
+	{ 0x0050C2, 0xDA1000, 0xDA1FFF, 53408, 53417 },
+	{ 0x0050C2, 0xDA2000, 0xDA2FFF, 109826, 109840 },
+	{ 0x0050C2, 0xDA3000, 0xDA3FFF, 18191, 18210 },
+	{ 0x0050C2, 0xDA4000, 0xDA4FFF, 65467, 23109 },
+	{ 0x0050C2, 0xDA5000, 0xDA5FFF, 34080, 34104 },
+	{ 0x0050C2, 0xDA6000, 0xDA6FFF, 109849, 109863 },
+	{ 0x0050C2, 0xDA7000, 0xDA7FFF, 109877, 109884 },
+	{ 0x0050C2, 0xDA8000, 0xDA8FFF, 109891, 109910 },
+	{ 0x0050C2, 0xDA9000, 0xDA9FFF, 21466, 21491 },
+	{ 0x0050C2, 0xDAA000, 0xDAAFFF, 109915, 109929 },
+	{ 0x0050C2, 0xDAB000, 0xDABFFF, 93144, 93166 },
+	{ 0x0050C2, 0xDAC000, 0xDACFFF, 7039, 7061 },
+	{ 0x0050C2, 0xDAD000, 0xDADFFF, 8053, 8071 },
+	{ 0x0050C2, 0xDAE000, 0xDAEFFF, 109936, 109960 },
+	{ 0x0050C2, 0xDAF000, 0xDAFFFF, 109984, 110009 },
+	{ 0x0050C2, 0xDB0000, 0xDB0FFF, 32176, 32200 },
+	{ 0x0050C2, 0xDB1000, 0xDB1FFF, 13994, 14002 },
+	{ 0x0050C2, 0xDB2000, 0xDB2FFF, 110028, 110044 },
+	{ 0x0050C2, 0xDB3000, 0xDB3FFF, 110060, 110094 },
+	{ 0x0050C2, 0xDB4000, 0xDB4FFF, 110112, 110145 },
+	{ 0x0050C2, 0xDB5000, 0xDB5FFF, 86583, 712 },
+	{ 0x0050C2, 0xDB6000, 0xDB6FFF, 110178, 110198 },
+	{ 0x0050C2, 0xDB7000, 0xDB7FFF, 110206, 110217 },
+	{ 0x0050C2, 0xDB8000, 0xDB8FFF, 110223, 110244 },
+	{ 0x0050C2, 0xDB9000, 0xDB9FFF, 78540, 73652 },
+	{ 0x0050C2, 0xDBA000, 0xDBAFFF, 110265, 110294 },
+	{ 0x0050C2, 0xDBB000, 0xDBBFFF, 30669, 30684 },
+	{ 0x0050C2, 0xDBC000, 0xDBCFFF, 110323, 110354 },
+	{ 0x0050C2, 0xDBD000, 0xDBDFFF, 110369, 110382 },
+	{ 0x0050C2, 0xDBE000, 0xDBEFFF, 110395, 110414 },
+	{ 0x0050C2, 0xDBF000, 0xDBFFFF, 110425, 110460 },
+	{ 0x0050C2, 0xDC0000, 0xDC0FFF, 110483, 110513 },
+	{ 0x0050C2, 0xDC1000, 0xDC1FFF, 110541, 110566 },
+	{ 0x0050C2, 0xDC2000, 0xDC2FFF, 110572, 110596 },
+	{ 0x0050C2, 0xDC3000, 0xDC3FFF, 110604, 110640 },
+	{ 0x0050C2, 0xDC4000, 0xDC4FFF, 8053, 8071 },
+	{ 0x0050C2, 0xDC5000, 0xDC5FFF, 61306, 6725 },
+	{ 0x0050C2, 0xDC6000, 0xDC6FFF, 110660, 110682 },
+	{ 0x0050C2, 0xDC7000, 0xDC7FFF, 110704, 110725 },
+	{ 0x0050C2, 0xDC8000, 0xDC8FFF, 110738, 110748 },
+	{ 0x0050C2, 0xDC9000, 0xDC9FFF, 110753, 110765 },
+	{ 0x0050C2, 0xDCA000, 0xDCAFFF, 110777, 110795 },
+	{ 0x0050C2, 0xDCB000, 0xDCBFFF, 37736, 37747 },
+	{ 0x0050C2, 0xDCC000, 0xDCCFFF, 110813, 110834 },
+	{ 0x0050C2, 0xDCD000, 0xDCDFFF, 110847, 110864 },
+	{ 0x0050C2, 0xDCE000, 0xDCEFFF, 35268, 35278 },
+	{ 0x0050C2, 0xDCF000, 0xDCFFFF, 110876, 110896 },
+	{ 0x0050C2, 0xDD0000, 0xDD0FFF, 110916, 110938 },
+	{ 0x0050C2, 0xDD1000, 0xDD1FFF, 110956, 110970 },
+	{ 0x0050C2, 0xDD2000, 0xDD2FFF, 110979, 111009 },
+	{ 0x0050C2, 0xDD3000, 0xDD3FFF, 34650, 34673 },
+	{ 0x0050C2, 0xDD4000, 0xDD4FFF, 111022, 111022 },
+	{ 0x0050C2, 0xDD5000, 0xDD5FFF, 111030, 111065 },
+	{ 0x0050C2, 0xDD6000, 0xDD6FFF, 70824, 70843 },
+	{ 0x0050C2, 0xDD7000, 0xDD7FFF, 25856, 25880 },
+	{ 0x0050C2, 0xDD8000, 0xDD8FFF, 75676, 75692 },
+	{ 0x0050C2, 0xDD9000, 0xDD9FFF, 111090, 111100 },
+	{ 0x0050C2, 0xDDA000, 0xDDAFFF, 111110, 111132 },
+	{ 0x0050C2, 0xDDB000, 0xDDBFFF, 28710, 28710 },
+	{ 0x0050C2, 0xDDC000, 0xDDCFFF, 111149, 111172 },
+	{ 0x0050C2, 0xDDD000, 0xDDDFFF, 111187, 111203 },
+	{ 0x0050C2, 0xDDE000, 0xDDEFFF, 111219, 111255 },
+	{ 0x0050C2, 0xDDF000, 0xDDFFFF, 111291, 111303 },
+	{ 0x0050C2, 0xDE0000, 0xDE0FFF, 73576, 73605 },
+	{ 0x0050C2, 0xDE1000, 0xDE1FFF, 54226, 54300 },
+	{ 0x0050C2, 0xDE2000, 0xDE2FFF, 111310, 111322 },
+	{ 0x0050C2, 0xDE3000, 0xDE3FFF, 111330, 111352 },
+	{ 0x0050C2, 0xDE4000, 0xDE4FFF, 111362, 111383 },
+	{ 0x0050C2, 0xDE5000, 0xDE5FFF, 40866, 40872 },
+	{ 0x0050C2, 0xDE6000, 0xDE6FFF, 16856, 16870 },
+	{ 0x0050C2, 0xDE7000, 0xDE7FFF, 111400, 111427 },
+	{ 0x0050C2, 0xDE8000, 0xDE8FFF, 111454, 111473 },
+	{ 0x0050C2, 0xDE9000, 0xDE9FFF, 111492, 111508 },
+	{ 0x0050C2, 0xDEA000, 0xDEAFFF, 111519, 111538 },
+	{ 0x0050C2, 0xDEB000, 0xDEBFFF, 111545, 111569 },
+	{ 0x0050C2, 0xDEC000, 0xDECFFF, 111586, 111603 },
+	{ 0x0050C2, 0xDED000, 0xDEDFFF, 111616, 111626 },
+	{ 0x0050C2, 0xDEF000, 0xDEFFFF, 80099, 80114 },
+	{ 0x0050C2, 0xDF0000, 0xDF0FFF, 111636, 111676 },
+	{ 0x0050C2, 0xDF1000, 0xDF1FFF, 61306, 6725 },
+	{ 0x0050C2, 0xDF2000, 0xDF2FFF, 111716, 111729 },
+	{ 0x0050C2, 0xDF3000, 0xDF3FFF, 111742, 111755 },
+	{ 0x0050C2, 0xDF4000, 0xDF4FFF, 100846, 100877 },
+	{ 0x0050C2, 0xDF5000, 0xDF5FFF, 111763, 111774 },
+	{ 0x0050C2, 0xDF6000, 0xDF6FFF, 111785, 111807 },
+	{ 0x0050C2, 0xDF7000, 0xDF7FFF, 111824, 111834 },
+	{ 0x0050C2, 0xDF8000, 0xDF8FFF, 111844, 111867 },
+	{ 0x0050C2, 0xDF9000, 0xDF9FFF, 111883, 111900 },
+	{ 0x0050C2, 0xDFA000, 0xDFAFFF, 111914, 111931 },
+	{ 0x0050C2, 0xDFB000, 0xDFBFFF, 107681, 80067 },
+	{ 0x0050C2, 0xDFC000, 0xDFCFFF, 111942, 111952 },
+	{ 0x0050C2, 0xDFD000, 0xDFDFFF, 111958, 111969 },
+	{ 0x0050C2, 0xDFE000, 0xDFEFFF, 111976, 111997 },
+	{ 0x0050C2, 0xDFF000, 0xDFFFFF, 112010, 112033 },
+	{ 0x0050C2, 0xE00000, 0xE00FFF, 93144, 93166 },
+	{ 0x0050C2, 0xE01000, 0xE01FFF, 112055, 112085 },
+	{ 0x0050C2, 0xE02000, 0xE02FFF, 112113, 112125 },
+	{ 0x0050C2, 0xE03000, 0xE03FFF, 112137, 112166 },
+	{ 0x0050C2, 0xE04000, 0xE04FFF, 112190, 112214 },
+	{ 0x0050C2, 0xE05000, 0xE05FFF, 112226, 112226 },
+	{ 0x0050C2, 0xE06000, 0xE06FFF, 112235, 112257 },
+	{ 0x0050C2, 0xE07000, 0xE07FFF, 112263, 112298 },
+	{ 0x0050C2, 0xE08000, 0xE08FFF, 112328, 78972 },
+	{ 0x0050C2, 0xE09000, 0xE09FFF, 21955, 21955 },
+	{ 0x0050C2, 0xE0A000, 0xE0AFFF, 27631, 27641 },
+	{ 0x0050C2, 0xE0B000, 0xE0BFFF, 112343, 112352 },
+	{ 0x0050C2, 0xE0C000, 0xE0CFFF, 112361, 112386 },
+	{ 0x0050C2, 0xE0D000, 0xE0DFFF, 112405, 112419 },
+	{ 0x0050C2, 0xE0E000, 0xE0EFFF, 112433, 112444 },
+	{ 0x0050C2, 0xE0F000, 0xE0FFFF, 112455, 112472 },
+	{ 0x0050C2, 0xE10000, 0xE10FFF, 112481, 112503 },
+	{ 0x0050C2, 0xE11000, 0xE11FFF, 112516, 112532 },
+	{ 0x0050C2, 0xE12000, 0xE12FFF, 112544, 112564 },
+	{ 0x0050C2, 0xE13000, 0xE13FFF, 112581, 112613 },
+	{ 0x0050C2, 0xE14000, 0xE14FFF, 112645, 112669 },
+	{ 0x0050C2, 0xE15000, 0xE15FFF, 112681, 112699 },
+	{ 0x0050C2, 0xE16000, 0xE16FFF, 112709, 112724 },
+	{ 0x0050C2, 0xE17000, 0xE17FFF, 112734, 112761 },
+	{ 0x0050C2, 0xE18000, 0xE18FFF, 54226, 54300 },
+	{ 0x0050C2, 0xE19000, 0xE19FFF, 64753, 64765 },
+	{ 0x0050C2, 0xE1A000, 0xE1AFFF, 63276, 63305 },
+	{ 0x0050C2, 0xE1B000, 0xE1BFFF, 112783, 112797 },
+	{ 0x0050C2, 0xE1C000, 0xE1CFFF, 61306, 6725 },
+	{ 0x0050C2, 0xE1D000, 0xE1DFFF, 112811, 112847 },
+	{ 0x0050C2, 0xE1E000, 0xE1EFFF, 112883, 112892 },
+	{ 0x0050C2, 0xE1F000, 0xE1FFFF, 112901, 112901 },
+	{ 0x0050C2, 0xE20000, 0xE20FFF, 112908, 112930 },
+	{ 0x0050C2, 0xE21000, 0xE21FFF, 112940, 112950 },
+	{ 0x0050C2, 0xE22000, 0xE22FFF, 112960, 112999 },
+	{ 0x0050C2, 0xE23000, 0xE23FFF, 109125, 109125 },
+	{ 0x0050C2, 0xE24000, 0xE24FFF, 76301, 76330 },
+	{ 0x0050C2, 0xE25000, 0xE25FFF, 20008, 20028 },
+	{ 0x0050C2, 0xE26000, 0xE26FFF, 113033, 76402 },
+	{ 0x0050C2, 0xE27000, 0xE27FFF, 113048, 113068 },
+	{ 0x0050C2, 0xE28000, 0xE28FFF, 113080, 113095 },
+	{ 0x0050C2, 0xE29000, 0xE29FFF, 16856, 16870 },
+	{ 0x0050C2, 0xE2A000, 0xE2AFFF, 34650, 34673 },
+	{ 0x0050C2, 0xE2B000, 0xE2BFFF, 113110, 113134 },
+	{ 0x0050C2, 0xE2C000, 0xE2CFFF, 113150, 113184 },
+	{ 0x0050C2, 0xE2D000, 0xE2DFFF, 113213, 113240 },
+	{ 0x0050C2, 0xE2E000, 0xE2EFFF, 113262, 113281 },
+	{ 0x0050C2, 0xE2F000, 0xE2FFFF, 113300, 113309 },
+	{ 0x0050C2, 0xE30000, 0xE30FFF, 113314, 113342 },
+	{ 0x0050C2, 0xE31000, 0xE31FFF, 113365, 113381 },
+	{ 0x0050C2, 0xE32000, 0xE32FFF, 113387, 113407 },
+	{ 0x0050C2, 0xE33000, 0xE33FFF, 113415, 113447 },
+	{ 0x0050C2, 0xE34000, 0xE34FFF, 113479, 113492 },
+	{ 0x0050C2, 0xE35000, 0xE35FFF, 113505, 113524 },
+	{ 0x0050C2, 0xE36000, 0xE36FFF, 61306, 6725 },
+	{ 0x0050C2, 0xE37000, 0xE37FFF, 113531, 103970 },
+	{ 0x0050C2, 0xE38000, 0xE38FFF, 113557, 113574 },
+	{ 0x0050C2, 0xE39000, 0xE39FFF, 113591, 113608 },
+	{ 0x0050C2, 0xE3A000, 0xE3AFFF, 17210, 17237 },
+	{ 0x0050C2, 0xE3B000, 0xE3BFFF, 113620, 113638 },
+	{ 0x0050C2, 0xE3C000, 0xE3CFFF, 36847, 36865 },
+	{ 0x0050C2, 0xE3D000, 0xE3DFFF, 22604, 22629 },
+	{ 0x0050C2, 0xE3E000, 0xE3EFFF, 113651, 113664 },
+	{ 0x0050C2, 0xE3F000, 0xE3FFFF, 113671, 113685 },
+	{ 0x0050C2, 0xE40000, 0xE40FFF, 113692, 113706 },
+	{ 0x0050C2, 0xE41000, 0xE41FFF, 113712, 113726 },
+	{ 0x0050C2, 0xE42000, 0xE42FFF, 113733, 113752 },
+	{ 0x0050C2, 0xE43000, 0xE43FFF, 113771, 113797 },
+	{ 0x0050C2, 0xE44000, 0xE44FFF, 65467, 23109 },
+	{ 0x0050C2, 0xE45000, 0xE45FFF, 113818, 113836 },
+	{ 0x0050C2, 0xE46000, 0xE46FFF, 113854, 113882 },
+	{ 0x0050C2, 0xE47000, 0xE47FFF, 113899, 113908 },
+	{ 0x0050C2, 0xE48000, 0xE48FFF, 113917, 113943 },
+	{ 0x0050C2, 0xE49000, 0xE49FFF, 113969, 114001 },
+	{ 0x0050C2, 0xE4A000, 0xE4AFFF, 108387, 108403 },
+	{ 0x0050C2, 0xE4B000, 0xE4BFFF, 34650, 34673 },
+	{ 0x0050C2, 0xE4C000, 0xE4CFFF, 92423, 92456 },
+	{ 0x0050C2, 0xE4D000, 0xE4DFFF, 7077, 7077 },
+	{ 0x0050C2, 0xE4E000, 0xE4EFFF, 114033, 114068 },
+	{ 0x0050C2, 0xE4F000, 0xE4FFFF, 114103, 114131 },
+	{ 0x0050C2, 0xE50000, 0xE50FFF, 16629, 16641 },
+	{ 0x0050C2, 0xE51000, 0xE51FFF, 43919, 43933 },
+	{ 0x0050C2, 0xE52000, 0xE52FFF, 114148, 114168 },
+	{ 0x0050C2, 0xE53000, 0xE53FFF, 114181, 114236 },
+	{ 0x0050C2, 0xE54000, 0xE54FFF, 114277, 70146 },
+	{ 0x0050C2, 0xE55000, 0xE55FFF, 73549, 73557 },
+	{ 0x0050C2, 0xE56000, 0xE56FFF, 114300, 114319 },
+	{ 0x0050C2, 0xE57000, 0xE57FFF, 114328, 114344 },
+	{ 0x0050C2, 0xE58000, 0xE58FFF, 114360, 114376 },
+	{ 0x0050C2, 0xE59000, 0xE59FFF, 61306, 6725 },
+	{ 0x0050C2, 0xE5A000, 0xE5AFFF, 114388, 114399 },
+	{ 0x0050C2, 0xE5B000, 0xE5BFFF, 114405, 114442 },
+	{ 0x0050C2, 0xE5C000, 0xE5CFFF, 114472, 114488 },
+	{ 0x0050C2, 0xE5D000, 0xE5DFFF, 114495, 114502 },
+	{ 0x0050C2, 0xE5E000, 0xE5EFFF, 114505, 114505 },
+	{ 0x0050C2, 0xE5F000, 0xE5FFFF, 12960, 12982 },
+	{ 0x0050C2, 0xE60000, 0xE60FFF, 114510, 114522 },
+	{ 0x0050C2, 0xE61000, 0xE61FFF, 114530, 114553 },
+	{ 0x0050C2, 0xE62000, 0xE62FFF, 58928, 58957 },
+	{ 0x0050C2, 0xE63000, 0xE63FFF, 114576, 114590 },
+	{ 0x0050C2, 0xE64000, 0xE64FFF, 56415, 56427 },
+	{ 0x0050C2, 0xE65000, 0xE65FFF, 114604, 114623 },
+	{ 0x0050C2, 0xE66000, 0xE66FFF, 7646, 7657 },
+	{ 0x0050C2, 0xE67000, 0xE67FFF, 39452, 39470 },
+	{ 0x0050C2, 0xE68000, 0xE68FFF, 114637, 114667 },
+	{ 0x0050C2, 0xE69000, 0xE69FFF, 114685, 114694 },
+	{ 0x0050C2, 0xE6A000, 0xE6AFFF, 93144, 93166 },
+	{ 0x0050C2, 0xE6B000, 0xE6BFFF, 114703, 114722 },
+	{ 0x0050C2, 0xE6C000, 0xE6CFFF, 114727, 114770 },
+	{ 0x0050C2, 0xE6D000, 0xE6DFFF, 114803, 114815 },
+	{ 0x0050C2, 0xE6E000, 0xE6EFFF, 114823, 114846 },
+	{ 0x0050C2, 0xE6F000, 0xE6FFFF, 114863, 114882 },
+	{ 0x0050C2, 0xE70000, 0xE70FFF, 16217, 16228 },
+	{ 0x0050C2, 0xE71000, 0xE71FFF, 114901, 114931 },
+	{ 0x0050C2, 0xE73000, 0xE73FFF, 70931, 70955 },
+	{ 0x0050C2, 0xE74000, 0xE74FFF, 114957, 114968 },
+	{ 0x0050C2, 0xE75000, 0xE75FFF, 114973, 114980 },
+	{ 0x0050C2, 0xE76000, 0xE76FFF, 108103, 108136 },
+	{ 0x0050C2, 0xE77000, 0xE77FFF, 16856, 16870 },
+	{ 0x0050C2, 0xE78000, 0xE78FFF, 68925, 68958 },
+	{ 0x0050C2, 0xE79000, 0xE79FFF, 93075, 93110 },
+	{ 0x0050C2, 0xE7A000, 0xE7AFFF, 114984, 114992 },
+	{ 0x0050C2, 0xE7B000, 0xE7BFFF, 20839, 20859 },
+	{ 0x0050C2, 0xE7C000, 0xE7CFFF, 115000, 16897 },
+	{ 0x0050C2, 0xE7D000, 0xE7DFFF, 115017, 115042 },
+	{ 0x0050C2, 0xE7E000, 0xE7EFFF, 115059, 115074 },
+	{ 0x0050C2, 0xE7F000, 0xE7FFFF, 115084, 115099 },
+	{ 0x0050C2, 0xE80000, 0xE80FFF, 61306, 6725 },
+	{ 0x0050C2, 0xE81000, 0xE81FFF, 115114, 115142 },
+	{ 0x0050C2, 0xE82000, 0xE82FFF, 115164, 115189 },
+	{ 0x0050C2, 0xE83000, 0xE83FFF, 115209, 115224 },
+	{ 0x0050C2, 0xE84000, 0xE84FFF, 54226, 54300 },
+	{ 0x0050C2, 0xE85000, 0xE85FFF, 115231, 115250 },
+	{ 0x0050C2, 0xE86000, 0xE86FFF, 115261, 115283 },
+	{ 0x0050C2, 0xE87000, 0xE87FFF, 115293, 115317 },
+	{ 0x0050C2, 0xE88000, 0xE88FFF, 115339, 115352 },
+	{ 0x0050C2, 0xE89000, 0xE89FFF, 115360, 115360 },
+	{ 0x0050C2, 0xE8A000, 0xE8AFFF, 19983, 19999 },
+	{ 0x0050C2, 0xE8B000, 0xE8BFFF, 115370, 115401 },
+	{ 0x0050C2, 0xE8C000, 0xE8CFFF, 56507, 56515 },
+	{ 0x0050C2, 0xE8D000, 0xE8DFFF, 115415, 115437 },
+	{ 0x0050C2, 0xE8E000, 0xE8EFFF, 18191, 18210 },
+	{ 0x0050C2, 0xE8F000, 0xE8FFFF, 115452, 115468 },
+	{ 0x0050C2, 0xE90000, 0xE90FFF, 115484, 115531 },
+	{ 0x0050C2, 0xE91000, 0xE91FFF, 86583, 712 },
+	{ 0x0050C2, 0xE92000, 0xE92FFF, 37736, 37747 },
+	{ 0x0050C2, 0xE93000, 0xE93FFF, 115572, 115594 },
+	{ 0x0050C2, 0xE94000, 0xE94FFF, 115611, 115622 },
+	{ 0x0050C2, 0xE95000, 0xE95FFF, 115628, 115688 },
+	{ 0x0050C2, 0xE96000, 0xE96FFF, 115741, 115756 },
+	{ 0x0050C2, 0xE97000, 0xE97FFF, 115766, 115793 },
+	{ 0x0050C2, 0xE98000, 0xE98FFF, 115800, 115822 },
+	{ 0x0050C2, 0xE99000, 0xE99FFF, 115825, 115843 },
+	{ 0x0050C2, 0xE9A000, 0xE9AFFF, 115855, 37023 },
+	{ 0x0050C2, 0xE9B000, 0xE9BFFF, 115870, 115892 },
+	{ 0x0050C2, 0xE9C000, 0xE9CFFF, 115909, 115923 },
+	{ 0x0050C2, 0xE9D000, 0xE9DFFF, 115929, 115943 },
+	{ 0x0050C2, 0xE9E000, 0xE9EFFF, 26026, 26054 },
+	{ 0x0050C2, 0xE9F000, 0xE9FFFF, 115949, 115970 },
+	{ 0x0050C2, 0xEA0000, 0xEA0FFF, 115979, 116017 },
+	{ 0x0050C2, 0xEA1000, 0xEA1FFF, 116041, 10586 },
+	{ 0x0050C2, 0xEA2000, 0xEA2FFF, 116058, 116071 },
+	{ 0x0050C2, 0xEA3000, 0xEA3FFF, 116079, 116100 },
+	{ 0x0050C2, 0xEA4000, 0xEA4FFF, 116107, 116112 },
+	{ 0x0050C2, 0xEA5000, 0xEA5FFF, 116117, 116129 },
+	{ 0x0050C2, 0xEA6000, 0xEA6FFF, 80099, 80114 },
+	{ 0x0050C2, 0xEA7000, 0xEA7FFF, 61306, 6725 },
+	{ 0x0050C2, 0xEA8000, 0xEA8FFF, 59490, 59531 },
+	{ 0x0050C2, 0xEA9000, 0xEA9FFF, 19883, 19898 },
+	{ 0x0050C2, 0xEAA000, 0xEAAFFF, 116138, 116150 },
+	{ 0x0050C2, 0xEAB000, 0xEABFFF, 116154, 116178 },
+	{ 0x0050C2, 0xEAC000, 0xEACFFF, 116196, 116205 },
+	{ 0x0050C2, 0xEAD000, 0xEADFFF, 34650, 34673 },
+	{ 0x0050C2, 0xEAE000, 0xEAEFFF, 116214, 116231 },
+	{ 0x0050C2, 0xEAF000, 0xEAFFFF, 37341, 37349 },
+	{ 0x0050C2, 0xEB0000, 0xEB0FFF, 116248, 116286 },
+	{ 0x0050C2, 0xEB1000, 0xEB1FFF, 116310, 116328 },
+	{ 0x0050C2, 0xEB2000, 0xEB2FFF, 116342, 116369 },
+	{ 0x0050C2, 0xEB3000, 0xEB3FFF, 116384, 116416 },
+	{ 0x0050C2, 0xEB4000, 0xEB4FFF, 116448, 116473 },
+	{ 0x0050C2, 0xEB5000, 0xEB5FFF, 104112, 104126 },
+	{ 0x0050C2, 0xEB6000, 0xEB6FFF, 116481, 116505 },
+	{ 0x0050C2, 0xEB7000, 0xEB7FFF, 26076, 26084 },
+	{ 0x0050C2, 0xEB8000, 0xEB8FFF, 116523, 116530 },
+	{ 0x0050C2, 0xEB9000, 0xEB9FFF, 116537, 116537 },
+	{ 0x0050C2, 0xEBA000, 0xEBAFFF, 22741, 22775 },
+	{ 0x0050C2, 0xEBB000, 0xEBBFFF, 116547, 116578 },
+	{ 0x0050C2, 0xEBC000, 0xEBCFFF, 116609, 116637 },
+	{ 0x0050C2, 0xEBD000, 0xEBDFFF, 116656, 116689 },
+	{ 0x0050C2, 0xEBE000, 0xEBEFFF, 116722, 116746 },
+	{ 0x0050C2, 0xEBF000, 0xEBFFFF, 116769, 116769 },
+	{ 0x0050C2, 0xEC0000, 0xEC0FFF, 116780, 116798 },
+	{ 0x0050C2, 0xEC1000, 0xEC1FFF, 116816, 116832 },
+	{ 0x0050C2, 0xEC2000, 0xEC2FFF, 116842, 116853 },
+	{ 0x0050C2, 0xEC3000, 0xEC3FFF, 93144, 93166 },
+	{ 0x0050C2, 0xEC4000, 0xEC4FFF, 116864, 116899 },
+	{ 0x0050C2, 0xEC5000, 0xEC5FFF, 116929, 116948 },
+	{ 0x0050C2, 0xEC6000, 0xEC6FFF, 116957, 116983 },
+	{ 0x0050C2, 0xEC7000, 0xEC7FFF, 116993, 117014 },
+	{ 0x0050C2, 0xEC8000, 0xEC8FFF, 117030, 117055 },
+	{ 0x0050C2, 0xEC9000, 0xEC9FFF, 117074, 117110 },
+	{ 0x0050C2, 0xECA000, 0xECAFFF, 109756, 109773 },
+	{ 0x0050C2, 0xECB000, 0xECBFFF, 117143, 117152 },
+	{ 0x0050C2, 0xECC000, 0xECCFFF, 61306, 6725 },
+	{ 0x0050C2, 0xECD000, 0xECDFFF, 78540, 73652 },
+	{ 0x0050C2, 0xECE000, 0xECEFFF, 117156, 117171 },
+	{ 0x0050C2, 0xECF000, 0xECFFFF, 117186, 117212 },
+	{ 0x0050C2, 0xED0000, 0xED0FFF, 117226, 117253 },
+	{ 0x0050C2, 0xED1000, 0xED1FFF, 117271, 70413 },
+	{ 0x0050C2, 0xED2000, 0xED2FFF, 117294, 117313 },
+	{ 0x0050C2, 0xED3000, 0xED3FFF, 117327, 117362 },
+	{ 0x0050C2, 0xED4000, 0xED4FFF, 117385, 117415 },
+	{ 0x0050C2, 0xED5000, 0xED5FFF, 7039, 7061 },
+	{ 0x0050C2, 0xED6000, 0xED6FFF, 117436, 117443 },
+	{ 0x0050C2, 0xED7000, 0xED7FFF, 117450, 117470 },
+	{ 0x0050C2, 0xED8000, 0xED8FFF, 117490, 117514 },
+	{ 0x0050C2, 0xED9000, 0xED9FFF, 117524, 117546 },
+	{ 0x0050C2, 0xEDA000, 0xEDAFFF, 117564, 117603 },
+	{ 0x0050C2, 0xEDB000, 0xEDBFFF, 20810, 20825 },
+	{ 0x0050C2, 0xEDC000, 0xEDCFFF, 117642, 117662 },
+	{ 0x0050C2, 0xEDD000, 0xEDDFFF, 22273, 22285 },
+	{ 0x0050C2, 0xEDE000, 0xEDEFFF, 117670, 117690 },
+	{ 0x0050C2, 0xEDF000, 0xEDFFFF, 117710, 4556 },
+	{ 0x0050C2, 0xEE0000, 0xEE0FFF, 117736, 117772 },
+	{ 0x0050C2, 0xEE1000, 0xEE1FFF, 10332, 10351 },
+	{ 0x0050C2, 0xEE2000, 0xEE2FFF, 117794, 117827 },
+	{ 0x0050C2, 0xEE3000, 0xEE3FFF, 8519, 8535 },
+	{ 0x0050C2, 0xEE4000, 0xEE4FFF, 34650, 34673 },
+	{ 0x0050C2, 0xEE5000, 0xEE5FFF, 117844, 117871 },
+	{ 0x0050C2, 0xEE6000, 0xEE6FFF, 117893, 117907 },
+	{ 0x0050C2, 0xEE7000, 0xEE7FFF, 117914, 109508 },
+	{ 0x0050C2, 0xEE8000, 0xEE8FFF, 117923, 117947 },
+	{ 0x0050C2, 0xEE9000, 0xEE9FFF, 117961, 117975 },
+	{ 0x0050C2, 0xEEA000, 0xEEAFFF, 117982, 118005 },
+	{ 0x0050C2, 0xEEB000, 0xEEBFFF, 118020, 118037 },
+	{ 0x0050C2, 0xEEC000, 0xEECFFF, 30959, 30978 },
+	{ 0x0050C2, 0xEED000, 0xEEDFFF, 118049, 118077 },
+	{ 0x0050C2, 0xEEE000, 0xEEEFFF, 54226, 54300 },
+	{ 0x0050C2, 0xEEF000, 0xEEFFFF, 118100, 118114 },
+	{ 0x0050C2, 0xEF0000, 0xEF0FFF, 118123, 118137 },
+	{ 0x0050C2, 0xEF1000, 0xEF1FFF, 61306, 6725 },
+	{ 0x0050C2, 0xEF2000, 0xEF2FFF, 118147, 118172 },
+	{ 0x0050C2, 0xEF3000, 0xEF3FFF, 118192, 118230 },
+	{ 0x0050C2, 0xEF4000, 0xEF4FFF, 59142, 59170 },
+	{ 0x0050C2, 0xEF5000, 0xEF5FFF, 118254, 118279 },
+	{ 0x0050C2, 0xEF6000, 0xEF6FFF, 118298, 118333 },
+	{ 0x0050C2, 0xEF7000, 0xEF7FFF, 118368, 118393 },
+	{ 0x0050C2, 0xEF8000, 0xEF8FFF, 118404, 118421 },
+	{ 0x0050C2, 0xEF9000, 0xEF9FFF, 47062, 47077 },
+	{ 0x0050C2, 0xEFA000, 0xEFAFFF, 118438, 118467 },
+	{ 0x0050C2, 0xEFB000, 0xEFBFFF, 31763, 31777 },
+	{ 0x0050C2, 0xEFC000, 0xEFCFFF, 2377, 2385 },
+	{ 0x0050C2, 0xEFD000, 0xEFDFFF, 118485, 118493 },
+	{ 0x0050C2, 0xEFE000, 0xEFEFFF, 118501, 118530 },
+	{ 0x0050C2, 0xEFF000, 0xEFFFFF, 118546, 118572 },
+	{ 0x0050C2, 0xF00000, 0xF00FFF, 118593, 118612 },
+	{ 0x0050C2, 0xF01000, 0xF01FFF, 118631, 30810 },
+	{ 0x0050C2, 0xF02000, 0xF02FFF, 118646, 118646 },
+	{ 0x0050C2, 0xF03000, 0xF03FFF, 118650, 118669 },
+	{ 0x0050C2, 0xF04000, 0xF04FFF, 118680, 118714 },
+	{ 0x0050C2, 0xF05000, 0xF05FFF, 118740, 118758 },
+	{ 0x0050C2, 0xF06000, 0xF06FFF, 118771, 118784 },
+	{ 0x0050C2, 0xF07000, 0xF07FFF, 118794, 1048 },
+	{ 0x0050C2, 0xF08000, 0xF08FFF, 93144, 93166 },
+	{ 0x0050C2, 0xF09000, 0xF09FFF, 19350, 19373 },
+	{ 0x0050C2, 0xF0A000, 0xF0AFFF, 118812, 118841 },
+	{ 0x0050C2, 0xF0B000, 0xF0BFFF, 118852, 118881 },
+	{ 0x0050C2, 0xF0C000, 0xF0CFFF, 118904, 118919 },
+	{ 0x0050C2, 0xF0D000, 0xF0DFFF, 118930, 118942 },
+	{ 0x0050C2, 0xF0E000, 0xF0EFFF, 103390, 103408 },
+	{ 0x0050C2, 0xF0F000, 0xF0FFFF, 118954, 118980 },
+	{ 0x0050C2, 0xF10000, 0xF10FFF, 119000, 119026 },
+	{ 0x0050C2, 0xF11000, 0xF11FFF, 119050, 119063 },
+	{ 0x0050C2, 0xF12000, 0xF12FFF, 119071, 119107 },
+	{ 0x0050C2, 0xF13000, 0xF13FFF, 119139, 119157 },
+	{ 0x0050C2, 0xF14000, 0xF14FFF, 119169, 119195 },
+	{ 0x0050C2, 0xF15000, 0xF15FFF, 119213, 119233 },
+	{ 0x0050C2, 0xF16000, 0xF16FFF, 119249, 119283 },
+	{ 0x0050C2, 0xF17000, 0xF17FFF, 54226, 54300 },
+	{ 0x0050C2, 0xF18000, 0xF18FFF, 119317, 44061 },
+	{ 0x0050C2, 0xF19000, 0xF19FFF, 119334, 119384 },
+	{ 0x0050C2, 0xF1A000, 0xF1AFFF, 119426, 119442 },
+	{ 0x0050C2, 0xF1B000, 0xF1BFFF, 61306, 6725 },
+	{ 0x0050C2, 0xF1C000, 0xF1CFFF, 18191, 18210 },
+	{ 0x0050C2, 0xF1D000, 0xF1DFFF, 1361, 1386 },
+	{ 0x0050C2, 0xF1E000, 0xF1EFFF, 119458, 119475 },
+	{ 0x0050C2, 0xF1F000, 0xF1FFFF, 119485, 119507 },
+	{ 0x0050C2, 0xF20000, 0xF20FFF, 119523, 119545 },
+	{ 0x0050C2, 0xF21000, 0xF21FFF, 119567, 119582 },
+	{ 0x0050C2, 0xF22000, 0xF22FFF, 119589, 119607 },
+	{ 0x0050C2, 0xF23000, 0xF23FFF, 119625, 119647 },
+	{ 0x0050C2, 0xF24000, 0xF24FFF, 37736, 37747 },
+	{ 0x0050C2, 0xF25000, 0xF25FFF, 119669, 119691 },
+	{ 0x0050C2, 0xF26000, 0xF26FFF, 15233, 15240 },
+	{ 0x0050C2, 0xF27000, 0xF27FFF, 111400, 111427 },
+	{ 0x0050C2, 0xF28000, 0xF28FFF, 119702, 119730 },
+	{ 0x0050C2, 0xF29000, 0xF29FFF, 119753, 119772 },
+	{ 0x0050C2, 0xF2A000, 0xF2AFFF, 20008, 20028 },
+	{ 0x0050C2, 0xF2B000, 0xF2BFFF, 119779, 119814 },
+	{ 0x0050C2, 0xF2C000, 0xF2CFFF, 119847, 119874 },
+	{ 0x0050C2, 0xF2D000, 0xF2DFFF, 115979, 116017 },
+	{ 0x0050C2, 0xF2E000, 0xF2EFFF, 119889, 119910 },
+	{ 0x0050C2, 0xF2F000, 0xF2FFFF, 114277, 70146 },
+	{ 0x0050C2, 0xF30000, 0xF30FFF, 119926, 119935 },
+	{ 0x0050C2, 0xF31000, 0xF31FFF, 119944, 119968 },
+	{ 0x0050C2, 0xF32000, 0xF32FFF, 119987, 119998 },
+	{ 0x0050C2, 0xF33000, 0xF33FFF, 92423, 92456 },
+	{ 0x0050C2, 0xF34000, 0xF34FFF, 120009, 120025 },
+	{ 0x0050C2, 0xF35000, 0xF35FFF, 36847, 36865 },
+	{ 0x0050C2, 0xF36000, 0xF36FFF, 120036, 120048 },
+	{ 0x0050C2, 0xF37000, 0xF37FFF, 63276, 63305 },
+	{ 0x0050C2, 0xF38000, 0xF38FFF, 120060, 120078 },
+	{ 0x0050C2, 0xF39000, 0xF39FFF, 100243, 100267 },
+	{ 0x0050C2, 0xF3A000, 0xF3AFFF, 61306, 6725 },
+	{ 0x0050C2, 0xF3B000, 0xF3BFFF, 120090, 120108 },
+	{ 0x0050C2, 0xF3C000, 0xF3CFFF, 120122, 120140 },
+	{ 0x0050C2, 0xF3D000, 0xF3DFFF, 120155, 120177 },
+	{ 0x0050C2, 0xF3E000, 0xF3EFFF, 120195, 120209 },
+	{ 0x0050C2, 0xF3F000, 0xF3FFFF, 120219, 120245 },
+	{ 0x0050C2, 0xF40000, 0xF40FFF, 120266, 120283 },
+	{ 0x0050C2, 0xF41000, 0xF41FFF, 120291, 120309 },
+	{ 0x0050C2, 0xF42000, 0xF42FFF, 120322, 120329 },
+	{ 0x0050C2, 0xF43000, 0xF43FFF, 120336, 120375 },
+	{ 0x0050C2, 0xF44000, 0xF44FFF, 120402, 120432 },
+	{ 0x0050C2, 0xF45000, 0xF45FFF, 120457, 120488 },
+	{ 0x0050C2, 0xF46000, 0xF46FFF, 120518, 54915 },
+	{ 0x0050C2, 0xF47000, 0xF47FFF, 120541, 120552 },
+	{ 0x0050C2, 0xF48000, 0xF48FFF, 120558, 120577 },
+	{ 0x0050C2, 0xF49000, 0xF49FFF, 120596, 120618 },
+	{ 0x0050C2, 0xF4A000, 0xF4AFFF, 99199, 71100 },
+	{ 0x0050C2, 0xF4B000, 0xF4BFFF, 120640, 120649 },
+	{ 0x0050C2, 0xF4C000, 0xF4CFFF, 120658, 120674 },
+	{ 0x0050C2, 0xF4D000, 0xF4DFFF, 120682, 120703 },
+	{ 0x0050C2, 0xF4E000, 0xF4EFFF, 120719, 120746 },
+	{ 0x0050C2, 0xF4F000, 0xF4FFFF, 120757, 120776 },
+	{ 0x0050C2, 0xF50000, 0xF50FFF, 120790, 120810 },
+	{ 0x0050C2, 0xF51000, 0xF51FFF, 104214, 104245 },
+	{ 0x0050C2, 0xF52000, 0xF52FFF, 34650, 34673 },
+	{ 0x0050C2, 0xF53000, 0xF53FFF, 120818, 120862 },
+	{ 0x0050C2, 0xF54000, 0xF54FFF, 120896, 120925 },
+	{ 0x0050C2, 0xF55000, 0xF55FFF, 44644, 44654 },
+	{ 0x0050C2, 0xF56000, 0xF56FFF, 116481, 116505 },
+	{ 0x0050C2, 0xF57000, 0xF57FFF, 120949, 120973 },
+	{ 0x0050C2, 0xF58000, 0xF58FFF, 120992, 121020 },
+	{ 0x0050C2, 0xF59000, 0xF59FFF, 121048, 121064 },
+	{ 0x0050C2, 0xF5A000, 0xF5AFFF, 87554, 87574 },
+	{ 0x0050C2, 0xF5B000, 0xF5BFFF, 61306, 6725 },
+	{ 0x0050C2, 0xF5C000, 0xF5CFFF, 86583, 712 },
+	{ 0x0050C2, 0xF5D000, 0xF5DFFF, 91226, 91246 },
+	{ 0x0050C2, 0xF5E000, 0xF5EFFF, 121080, 121100 },
+	{ 0x0050C2, 0xF5F000, 0xF5FFFF, 121116, 121142 },
+	{ 0x0050C2, 0xF60000, 0xF60FFF, 121149, 121161 },
+	{ 0x0050C2, 0xF61000, 0xF61FFF, 121168, 121197 },
+	{ 0x0050C2, 0xF62000, 0xF62FFF, 7646, 7657 },
+	{ 0x0050C2, 0xF63000, 0xF63FFF, 92050, 92060 },
+	{ 0x0050C2, 0xF64000, 0xF64FFF, 121215, 121240 },
+	{ 0x0050C2, 0xF65000, 0xF65FFF, 121261, 121275 },
+	{ 0x0050C2, 0xF66000, 0xF66FFF, 121284, 121292 },
+	{ 0x0050C2, 0xF67000, 0xF67FFF, 121296, 121312 },
+	{ 0x0050C2, 0xF68000, 0xF68FFF, 65538, 65549 },
+	{ 0x0050C2, 0xF69000, 0xF69FFF, 121328, 121353 },
+	{ 0x0050C2, 0xF6A000, 0xF6AFFF, 121374, 121394 },
+	{ 0x0050C2, 0xF6B000, 0xF6BFFF, 17246, 17270 },
+	{ 0x0050C2, 0xF6C000, 0xF6CFFF, 121407, 121434 },
+	{ 0x0050C2, 0xF6D000, 0xF6DFFF, 121407, 121434 },
+	{ 0x0050C2, 0xF6E000, 0xF6EFFF, 16283, 16301 },
+	{ 0x0050C2, 0xF6F000, 0xF6FFFF, 93144, 93166 },
+	{ 0x0050C2, 0xF70000, 0xF70FFF, 121445, 121470 },
+	{ 0x0050C2, 0xF71000, 0xF71FFF, 13994, 14002 },
+	{ 0x0050C2, 0xF72000, 0xF72FFF, 121491, 121503 },
+	{ 0x0050C2, 0xF73000, 0xF73FFF, 121512, 121525 },
+	{ 0x0050C2, 0xF74000, 0xF74FFF, 121538, 121564 },
+	{ 0x0050C2, 0xF75000, 0xF75FFF, 121586, 121610 },
+	{ 0x0050C2, 0xF76000, 0xF76FFF, 121629, 121665 },
+	{ 0x0050C2, 0xF77000, 0xF77FFF, 121693, 71672 },
+	{ 0x0050C2, 0xF78000, 0xF78FFF, 121712, 121726 },
+	{ 0x0050C2, 0xF79000, 0xF79FFF, 16629, 16641 },
+	{ 0x0050C2, 0xF7A000, 0xF7AFFF, 121735, 121742 },
+	{ 0x0050C2, 0xF7B000, 0xF7BFFF, 121745, 121761 },
+	{ 0x0050C2, 0xF7C000, 0xF7CFFF, 121777, 121796 },
+	{ 0x0050C2, 0xF7D000, 0xF7DFFF, 121809, 121846 },
+	{ 0x0050C2, 0xF7E000, 0xF7EFFF, 121864, 41541 },
+	{ 0x0050C2, 0xF7F000, 0xF7FFFF, 121890, 121905 },
+	{ 0x0050C2, 0xF80000, 0xF80FFF, 30693, 30717 },
+	{ 0x0050C2, 0xF81000, 0xF81FFF, 121920, 121920 },
+	{ 0x0050C2, 0xF82000, 0xF82FFF, 121925, 121955 },
+	{ 0x0050C2, 0xF83000, 0xF83FFF, 85745, 85763 },
+	{ 0x0050C2, 0xF84000, 0xF84FFF, 83208, 83226 },
+	{ 0x0050C2, 0xF85000, 0xF85FFF, 121963, 121977 },
+	{ 0x0050C2, 0xF86000, 0xF86FFF, 121985, 122002 },
+	{ 0x0050C2, 0xF87000, 0xF87FFF, 10594, 10606 },
+	{ 0x0050C2, 0xF88000, 0xF88FFF, 122019, 122042 },
+	{ 0x0050C2, 0xF89000, 0xF89FFF, 122060, 122079 },
+	{ 0x0050C2, 0xF8A000, 0xF8AFFF, 7646, 7657 },
+	{ 0x0050C2, 0xF8B000, 0xF8BFFF, 122095, 122125 },
+	{ 0x0050C2, 0xF8C000, 0xF8CFFF, 122150, 122173 },
+	{ 0x0050C2, 0xF8D000, 0xF8DFFF, 122187, 122213 },
+	{ 0x0050C2, 0xF8E000, 0xF8EFFF, 122234, 122234 },
+	{ 0x0050C2, 0xF8F000, 0xF8FFFF, 11821, 11840 },
+	{ 0x0050C2, 0xF90000, 0xF90FFF, 122238, 122263 },
+	{ 0x0050C2, 0xF91000, 0xF91FFF, 122274, 122282 },
+	{ 0x0050C2, 0xF92000, 0xF92FFF, 122286, 122307 },
+	{ 0x0050C2, 0xF93000, 0xF93FFF, 22604, 22629 },
+	{ 0x0050C2, 0xF94000, 0xF94FFF, 122323, 122340 },
+	{ 0x0050C2, 0xF95000, 0xF95FFF, 122357, 122399 },
+	{ 0x0050C2, 0xF96000, 0xF96FFF, 19177, 19198 },
+	{ 0x0050C2, 0xF97000, 0xF97FFF, 27631, 27641 },
+	{ 0x0050C2, 0xF98000, 0xF98FFF, 122431, 122454 },
+	{ 0x0050C2, 0xF99000, 0xF99FFF, 122477, 122505 },
+	{ 0x0050C2, 0xF9A000, 0xF9AFFF, 21865, 21873 },
+	{ 0x0050C2, 0xF9B000, 0xF9BFFF, 122527, 122555 },
+	{ 0x0050C2, 0xF9C000, 0xF9CFFF, 122575, 122587 },
+	{ 0x0050C2, 0xF9D000, 0xF9DFFF, 122599, 122640 },
+	{ 0x0050C2, 0xF9E000, 0xF9EFFF, 122681, 122706 },
+	{ 0x0050C2, 0xF9F000, 0xF9FFFF, 122726, 122770 },
+	{ 0x0050C2, 0xFA0000, 0xFA0FFF, 122804, 122833 },
+	{ 0x0050C2, 0xFA1000, 0xFA1FFF, 122858, 122881 },
+	{ 0x0050C2, 0xFA2000, 0xFA2FFF, 122893, 35598 },
+	{ 0x0050C2, 0xFA3000, 0xFA3FFF, 122903, 122912 },
+	{ 0x0050C2, 0xFA5000, 0xFA5FFF, 48908, 48932 },
+	{ 0x0050C2, 0xFA6000, 0xFA6FFF, 122921, 122941 },
+	{ 0x0050C2, 0xFA7000, 0xFA7FFF, 122956, 122968 },
+	{ 0x0050C2, 0xFA8000, 0xFA8FFF, 122975, 123016 },
+	{ 0x0050C2, 0xFA9000, 0xFA9FFF, 123051, 123070 },
+	{ 0x0050C2, 0xFAA000, 0xFAAFFF, 123088, 123088 },
+	{ 0x0050C2, 0xFAB000, 0xFABFFF, 93144, 93166 },
+	{ 0x0050C2, 0xFAC000, 0xFACFFF, 123097, 123110 },
+	{ 0x0050C2, 0xFAD000, 0xFADFFF, 123123, 123140 },
+	{ 0x0050C2, 0xFAE000, 0xFAEFFF, 123157, 123212 },
+	{ 0x0050C2, 0xFAF000, 0xFAFFFF, 123257, 123271 },
+	{ 0x0050C2, 0xFB0000, 0xFB0FFF, 123285, 123309 },
+	{ 0x0050C2, 0xFB1000, 0xFB1FFF, 123326, 123326 },
+	{ 0x0050C2, 0xFB2000, 0xFB2FFF, 123334, 123369 },
+	{ 0x0050C2, 0xFB3000, 0xFB3FFF, 37736, 37747 },
+	{ 0x0050C2, 0xFB4000, 0xFB4FFF, 123404, 123421 },
+	{ 0x0050C2, 0xFB5000, 0xFB5FFF, 62134, 62161 },
+	{ 0x0050C2, 0xFB6000, 0xFB6FFF, 62200, 62200 },
+	{ 0x0050C2, 0xFB7000, 0xFB7FFF, 123435, 123453 },
+	{ 0x0050C2, 0xFB8000, 0xFB8FFF, 123471, 123487 },
+	{ 0x0050C2, 0xFB9000, 0xFB9FFF, 62911, 62929 },
+	{ 0x0050C2, 0xFBA000, 0xFBAFFF, 62092, 62117 },
+	{ 0x0050C2, 0xFBB000, 0xFBBFFF, 123494, 123505 },
+	{ 0x0050C2, 0xFBC000, 0xFBCFFF, 123511, 123523 },
+	{ 0x0050C2, 0xFBD000, 0xFBDFFF, 55845, 55883 },
+	{ 0x0050C2, 0xFBE000, 0xFBEFFF, 123535, 123558 },
+	{ 0x0050C2, 0xFBF000, 0xFBFFFF, 123576, 123576 },
+	{ 0x0050C2, 0xFC0000, 0xFC0FFF, 34650, 34673 },
+	{ 0x0050C2, 0xFC1000, 0xFC1FFF, 43919, 43933 },
+	{ 0x0050C2, 0xFC2000, 0xFC2FFF, 123584, 123584 },
+	{ 0x0050C2, 0xFC3000, 0xFC3FFF, 123589, 123605 },
+	{ 0x0050C2, 0xFC4000, 0xFC4FFF, 123619, 123630 },
+	{ 0x0050C2, 0xFC5000, 0xFC5FFF, 123641, 123663 },
+	{ 0x0050C2, 0xFC6000, 0xFC6FFF, 39452, 39470 },
+	{ 0x0050C2, 0xFC7000, 0xFC7FFF, 123676, 123697 },
+	{ 0x0050C2, 0xFC8000, 0xFC8FFF, 123718, 123737 },
+	{ 0x0050C2, 0xFC9000, 0xFC9FFF, 123756, 123773 },
+	{ 0x0050C2, 0xFCA000, 0xFCAFFF, 123784, 123798 },
+	{ 0x0050C2, 0xFCB000, 0xFCBFFF, 123808, 123836 },
+	{ 0x0050C2, 0xFCC000, 0xFCCFFF, 123848, 123861 },
+	{ 0x0050C2, 0xFCD000, 0xFCDFFF, 123871, 123888 },
+	{ 0x0050C2, 0xFCE000, 0xFCEFFF, 123905, 123919 },
+	{ 0x0050C2, 0xFCF000, 0xFCFFFF, 123933, 123964 },
+	{ 0x0050C2, 0xFD0000, 0xFD0FFF, 123980, 123997 },
+	{ 0x0050C2, 0xFD1000, 0xFD1FFF, 124014, 124022 },
+	{ 0x0050C2, 0xFD2000, 0xFD2FFF, 124027, 124051 },
+	{ 0x0050C2, 0xFD3000, 0xFD3FFF, 124070, 124094 },
+	{ 0x0050C2, 0xFD4000, 0xFD4FFF, 99382, 99394 },
+	{ 0x0050C2, 0xFD5000, 0xFD5FFF, 26026, 26054 },
+	{ 0x0050C2, 0xFD6000, 0xFD6FFF, 124109, 124128 },
+	{ 0x0050C2, 0xFD7000, 0xFD7FFF, 65467, 23109 },
+	{ 0x0050C2, 0xFD8000, 0xFD8FFF, 124143, 124153 },
+	{ 0x0050C2, 0xFD9000, 0xFD9FFF, 86309, 86337 },
+	{ 0x0050C2, 0xFDA000, 0xFDAFFF, 111400, 111427 },
+	{ 0x0050C2, 0xFDB000, 0xFDBFFF, 124158, 124182 },
+	{ 0x0050C2, 0xFDC000, 0xFDCFFF, 98036, 98063 },
+	{ 0x0050C2, 0xFDD000, 0xFDDFFF, 51269, 51291 },
+	{ 0x0050C2, 0xFDE000, 0xFDEFFF, 124202, 73652 },
+	{ 0x0050C2, 0xFDF000, 0xFDFFFF, 20008, 20028 },
+	{ 0x0050C2, 0xFE0000, 0xFE0FFF, 124215, 124224 },
+	{ 0x0050C2, 0xFE1000, 0xFE1FFF, 124233, 124242 },
+	{ 0x0050C2, 0xFE2000, 0xFE2FFF, 124251, 124283 },
+	{ 0x0050C2, 0xFE3000, 0xFE3FFF, 2377, 2385 },
+	{ 0x0050C2, 0xFE4000, 0xFE4FFF, 124310, 124336 },
+	{ 0x0050C2, 0xFE5000, 0xFE5FFF, 124362, 124381 },
+	{ 0x0050C2, 0xFE6000, 0xFE6FFF, 124392, 124402 },
+	{ 0x0050C2, 0xFE7000, 0xFE7FFF, 37281, 37301 },
+	{ 0x0050C2, 0xFE8000, 0xFE8FFF, 124412, 30810 },
+	{ 0x0050C2, 0xFE9000, 0xFE9FFF, 59490, 59531 },
+	{ 0x0050C2, 0xFEA000, 0xFEAFFF, 124428, 124463 },
+	{ 0x0050C2, 0xFEB000, 0xFEBFFF, 106431, 106451 },
+	{ 0x0050C2, 0xFEC000, 0xFECFFF, 124492, 124526 },
+	{ 0x0050C2, 0xFED000, 0xFEDFFF, 124539, 124552 },
+	{ 0x0050C2, 0xFEE000, 0xFEEFFF, 124564, 124586 },
+	{ 0x0050C2, 0xFEF000, 0xFEFFFF, 124605, 124633 },
+	{ 0x0050C2, 0xFF0000, 0xFF0FFF, 18191, 18210 },
+	{ 0x0050C2, 0xFF1000, 0xFF1FFF, 76301, 76330 },
+	{ 0x0050C2, 0xFF2000, 0xFF2FFF, 63406, 63432 },
+	{ 0x0050C2, 0xFF3000, 0xFF3FFF, 113048, 113068 },
+	{ 0x0050C2, 0xFF4000, 0xFF4FFF, 56394, 56410 },
+	{ 0x0050C2, 0xFF5000, 0xFF5FFF, 124661, 124748 },
+	{ 0x0050C2, 0xFF6000, 0xFF6FFF, 124832, 124851 },
+	{ 0x0050C2, 0xFF7000, 0xFF7FFF, 124870, 124883 },
+	{ 0x0050C2, 0xFF8000, 0xFF8FFF, 124896, 78972 },
+	{ 0x0050C2, 0xFF9000, 0xFF9FFF, 124911, 124929 },
+	{ 0x0050C2, 0xFFA000, 0xFFAFFF, 124947, 124968 },
+	{ 0x0050C2, 0xFFB000, 0xFFBFFF, 124976, 124976 },
+	{ 0x0050C2, 0xFFC000, 0xFFCFFF, 60542, 60565 },
+	{ 0x0050C2, 0xFFD000, 0xFFDFFF, 124983, 125014 },
+	{ 0x0050C2, 0xFFE000, 0xFFEFFF, 71595, 71616 },
+	{ 0x0050C2, 0xFFF000, 0xFFFFFF, 125034, 125053 },
+	{ 0x40D855, 0x000000, 0x000FFF, 125067, 125078 },
+	{ 0x40D855, 0x001000, 0x001FFF, 125085, 125094 },
+	{ 0x40D855, 0x002000, 0x002FFF, 125103, 125143 },
+	{ 0x40D855, 0x003000, 0x003FFF, 125174, 125196 },
+	{ 0x40D855, 0x004000, 0x004FFF, 125218, 125237 },
+	{ 0x40D855, 0x005000, 0x005FFF, 55430, 55449 },
+	{ 0x40D855, 0x006000, 0x006FFF, 125250, 125266 },
+	{ 0x40D855, 0x007000, 0x007FFF, 125274, 125291 },
+	{ 0x40D855, 0x008000, 0x008FFF, 125305, 125337 },
+	{ 0x40D855, 0x009000, 0x009FFF, 125369, 125399 },
+	{ 0x40D855, 0x00A000, 0x00AFFF, 125423, 125443 },
+	{ 0x40D855, 0x00B000, 0x00BFFF, 37341, 37349 },
+	{ 0x40D855, 0x00C000, 0x00CFFF, 93144, 93166 },
+	{ 0x40D855, 0x00D000, 0x00DFFF, 125463, 125468 },
+	{ 0x40D855, 0x00E000, 0x00EFFF, 125473, 125495 },
+	{ 0x40D855, 0x00F000, 0x00FFFF, 125517, 40605 },
+	{ 0x40D855, 0x010000, 0x010FFF, 93343, 93364 },
+	{ 0x40D855, 0x011000, 0x011FFF, 125540, 125559 },
+	{ 0x40D855, 0x012000, 0x012FFF, 125578, 125590 },
+	{ 0x40D855, 0x013000, 0x013FFF, 125597, 125620 },
+	{ 0x40D855, 0x014000, 0x014FFF, 125635, 125647 },
+	{ 0x40D855, 0x015000, 0x015FFF, 125659, 125671 },
+	{ 0x40D855, 0x016000, 0x016FFF, 87412, 87427 },
+	{ 0x40D855, 0x017000, 0x017FFF, 125683, 125706 },
+	{ 0x40D855, 0x018000, 0x018FFF, 125724, 125735 },
+	{ 0x40D855, 0x019000, 0x019FFF, 47491, 47502 },
+	{ 0x40D855, 0x01A000, 0x01AFFF, 125746, 125775 },
+	{ 0x40D855, 0x01B000, 0x01BFFF, 125791, 125809 },
+	{ 0x40D855, 0x01C000, 0x01CFFF, 125827, 125846 },
+	{ 0x40D855, 0x01D000, 0x01DFFF, 125857, 125881 },
+	{ 0x40D855, 0x01E000, 0x01EFFF, 125900, 125900 },
+	{ 0x40D855, 0x01F000, 0x01FFFF, 125904, 125921 },
+	{ 0x40D855, 0x020000, 0x020FFF, 125938, 94860 },
+	{ 0x40D855, 0x021000, 0x021FFF, 125976, 67624 },
+	{ 0x40D855, 0x022000, 0x022FFF, 125987, 126012 },
+	{ 0x40D855, 0x023000, 0x023FFF, 126022, 126077 },
+	{ 0x40D855, 0x024000, 0x024FFF, 126109, 126143 },
+	{ 0x40D855, 0x025000, 0x025FFF, 126177, 126198 },
+	{ 0x40D855, 0x026000, 0x026FFF, 74865, 74886 },
+	{ 0x40D855, 0x027000, 0x027FFF, 36847, 36865 },
+	{ 0x40D855, 0x028000, 0x028FFF, 126219, 91701 },
+	{ 0x40D855, 0x029000, 0x029FFF, 126244, 126263 },
+	{ 0x40D855, 0x02A000, 0x02AFFF, 126282, 126299 },
+	{ 0x40D855, 0x02B000, 0x02BFFF, 126311, 126323 },
+	{ 0x40D855, 0x02C000, 0x02CFFF, 126335, 126350 },
+	{ 0x40D855, 0x02D000, 0x02DFFF, 126364, 126380 },
+	{ 0x40D855, 0x02E000, 0x02EFFF, 126396, 126430 },
+	{ 0x40D855, 0x02F000, 0x02FFFF, 126461, 126486 },
+	{ 0x40D855, 0x030000, 0x030FFF, 126507, 126526 },
+	{ 0x40D855, 0x031000, 0x031FFF, 126545, 126557 },
+	{ 0x40D855, 0x032000, 0x032FFF, 107681, 80067 },
+	{ 0x40D855, 0x033000, 0x033FFF, 126564, 126589 },
+	{ 0x40D855, 0x034000, 0x034FFF, 111492, 111508 },
+	{ 0x40D855, 0x035000, 0x035FFF, 126607, 126636 },
+	{ 0x40D855, 0x036000, 0x036FFF, 126645, 126683 },
+	{ 0x40D855, 0x037000, 0x037FFF, 126716, 126734 },
+	{ 0x40D855, 0x038000, 0x038FFF, 126752, 126782 },
+	{ 0x40D855, 0x039000, 0x039FFF, 126808, 26331 },
+	{ 0x40D855, 0x03A000, 0x03AFFF, 126823, 126838 },
+	{ 0x40D855, 0x03B000, 0x03BFFF, 126853, 126865 },
+	{ 0x40D855, 0x03C000, 0x03CFFF, 126877, 126901 },
+	{ 0x40D855, 0x03D000, 0x03DFFF, 126908, 126927 },
+	{ 0x40D855, 0x03E000, 0x03EFFF, 126942, 126976 },
+	{ 0x40D855, 0x03F000, 0x03FFFF, 127004, 127047 },
+	{ 0x40D855, 0x040000, 0x040FFF, 55229, 55248 },
+	{ 0x40D855, 0x041000, 0x041FFF, 127073, 127104 },
+	{ 0x40D855, 0x042000, 0x042FFF, 127116, 127142 },
+	{ 0x40D855, 0x043000, 0x043FFF, 127163, 127183 },
+	{ 0x40D855, 0x044000, 0x044FFF, 127198, 127225 },
+	{ 0x40D855, 0x045000, 0x045FFF, 127233, 127245 },
+	{ 0x40D855, 0x046000, 0x046FFF, 127257, 127277 },
+	{ 0x40D855, 0x047000, 0x047FFF, 127293, 127307 },
+	{ 0x40D855, 0x048000, 0x048FFF, 18191, 18210 },
+	{ 0x40D855, 0x049000, 0x049FFF, 102881, 102906 },
+	{ 0x40D855, 0x04A000, 0x04AFFF, 127321, 127351 },
+	{ 0x40D855, 0x04B000, 0x04BFFF, 127378, 127415 },
+	{ 0x40D855, 0x04C000, 0x04CFFF, 18411, 18432 },
+	{ 0x40D855, 0x04D000, 0x04DFFF, 127452, 127475 },
+	{ 0x40D855, 0x04E000, 0x04EFFF, 127498, 44654 },
+	{ 0x40D855, 0x04F000, 0x04FFFF, 127522, 127541 },
+	{ 0x40D855, 0x050000, 0x050FFF, 127551, 127569 },
+	{ 0x40D855, 0x051000, 0x051FFF, 127576, 127596 },
+	{ 0x40D855, 0x052000, 0x052FFF, 127616, 127651 },
+	{ 0x40D855, 0x053000, 0x053FFF, 127676, 127688 },
+	{ 0x40D855, 0x054000, 0x054FFF, 109125, 109125 },
+	{ 0x40D855, 0x055000, 0x055FFF, 127696, 127738 },
+	{ 0x40D855, 0x056000, 0x056FFF, 127775, 127784 },
+	{ 0x40D855, 0x057000, 0x057FFF, 127793, 127814 },
+	{ 0x40D855, 0x058000, 0x058FFF, 127835, 127854 },
+	{ 0x40D855, 0x059000, 0x059FFF, 127866, 127896 },
+	{ 0x40D855, 0x05A000, 0x05AFFF, 127925, 127962 },
+	{ 0x40D855, 0x05B000, 0x05BFFF, 127991, 128015 },
+	{ 0x40D855, 0x05C000, 0x05CFFF, 63276, 63305 },
+	{ 0x40D855, 0x05D000, 0x05DFFF, 128025, 128042 },
+	{ 0x40D855, 0x05E000, 0x05EFFF, 128059, 128071 },
+	{ 0x40D855, 0x05F000, 0x05FFFF, 22349, 22359 },
+	{ 0x40D855, 0x060000, 0x060FFF, 93144, 93166 },
+	{ 0x40D855, 0x061000, 0x061FFF, 13405, 13419 },
+	{ 0x40D855, 0x062000, 0x062FFF, 128078, 128094 },
+	{ 0x40D855, 0x063000, 0x063FFF, 40505, 40522 },
+	{ 0x40D855, 0x064000, 0x064FFF, 128106, 128147 },
+	{ 0x40D855, 0x065000, 0x065FFF, 128181, 128204 },
+	{ 0x40D855, 0x066000, 0x066FFF, 128222, 128236 },
+	{ 0x40D855, 0x067000, 0x067FFF, 128245, 128265 },
+	{ 0x40D855, 0x068000, 0x068FFF, 128280, 128301 },
+	{ 0x40D855, 0x069000, 0x069FFF, 44078, 44099 },
+	{ 0x40D855, 0x06A000, 0x06AFFF, 128312, 128322 },
+	{ 0x40D855, 0x06B000, 0x06BFFF, 88178, 88204 },
+	{ 0x40D855, 0x06C000, 0x06CFFF, 34650, 34673 },
+	{ 0x40D855, 0x06D000, 0x06DFFF, 128332, 128347 },
+	{ 0x40D855, 0x06E000, 0x06EFFF, 74395, 74424 },
+	{ 0x40D855, 0x06F000, 0x06FFFF, 16217, 16228 },
+	{ 0x40D855, 0x070000, 0x070FFF, 96016, 96049 },
+	{ 0x40D855, 0x071000, 0x071FFF, 37724, 16641 },
+	{ 0x40D855, 0x072000, 0x072FFF, 37736, 37747 },
+	{ 0x40D855, 0x073000, 0x073FFF, 128357, 128383 },
+	{ 0x40D855, 0x074000, 0x074FFF, 128404, 128423 },
+	{ 0x40D855, 0x075000, 0x075FFF, 128438, 128448 },
+	{ 0x40D855, 0x076000, 0x076FFF, 73576, 73605 },
+	{ 0x40D855, 0x077000, 0x077FFF, 128458, 128482 },
+	{ 0x40D855, 0x078000, 0x078FFF, 128487, 128508 },
+	{ 0x40D855, 0x079000, 0x079FFF, 128524, 128543 },
+	{ 0x40D855, 0x07A000, 0x07AFFF, 128562, 128572 },
+	{ 0x40D855, 0x07B000, 0x07BFFF, 128582, 128605 },
+	{ 0x40D855, 0x07C000, 0x07CFFF, 128609, 128636 },
+	{ 0x40D855, 0x07D000, 0x07DFFF, 128655, 128688 },
+	{ 0x40D855, 0x07E000, 0x07EFFF, 128711, 128730 },
+	{ 0x40D855, 0x07F000, 0x07FFFF, 19350, 19373 },
+	{ 0x40D855, 0x080000, 0x080FFF, 44644, 44654 },
+	{ 0x40D855, 0x081000, 0x081FFF, 27631, 27641 },
+	{ 0x40D855, 0x082000, 0x082FFF, 4379, 4386 },
+	{ 0x40D855, 0x083000, 0x083FFF, 128737, 128737 },
+	{ 0x40D855, 0x084000, 0x084FFF, 128744, 128780 },
+	{ 0x40D855, 0x085000, 0x085FFF, 78540, 73652 },
+	{ 0x40D855, 0x086000, 0x086FFF, 14445, 712 },
+	{ 0x40D855, 0x087000, 0x087FFF, 128811, 128824 },
+	{ 0x40D855, 0x088000, 0x088FFF, 128837, 128858 },
+	{ 0x40D855, 0x089000, 0x089FFF, 128869, 128906 },
+	{ 0x40D855, 0x08A000, 0x08AFFF, 128924, 128948 },
+	{ 0x40D855, 0x08B000, 0x08BFFF, 89347, 89369 },
+	{ 0x40D855, 0x08C000, 0x08CFFF, 128972, 128991 },
+	{ 0x40D855, 0x08D000, 0x08DFFF, 129002, 129028 },
+	{ 0x40D855, 0x08E000, 0x08EFFF, 66118, 66134 },
+	{ 0x40D855, 0x08F000, 0x08FFFF, 129054, 129064 },
+	{ 0x40D855, 0x090000, 0x090FFF, 129074, 129100 },
+	{ 0x40D855, 0x091000, 0x091FFF, 103772, 103772 },
+	{ 0x40D855, 0x092000, 0x092FFF, 129122, 129139 },
+	{ 0x40D855, 0x093000, 0x093FFF, 87554, 87574 },
+	{ 0x40D855, 0x094000, 0x094FFF, 129151, 129173 },
+	{ 0x40D855, 0x095000, 0x095FFF, 129187, 129207 },
+	{ 0x40D855, 0x096000, 0x096FFF, 129227, 129251 },
+	{ 0x40D855, 0x097000, 0x097FFF, 129270, 129300 },
+	{ 0x40D855, 0x098000, 0x098FFF, 16363, 16372 },
+	{ 0x40D855, 0x099000, 0x099FFF, 129326, 129340 },
+	{ 0x40D855, 0x09A000, 0x09AFFF, 129347, 129368 },
+	{ 0x40D855, 0x09B000, 0x09BFFF, 129381, 129407 },
+	{ 0x40D855, 0x09C000, 0x09CFFF, 129433, 129456 },
+	{ 0x40D855, 0x09D000, 0x09DFFF, 7646, 7657 },
+	{ 0x40D855, 0x09E000, 0x09EFFF, 129474, 129490 },
+	{ 0x40D855, 0x09F000, 0x09FFFF, 129500, 129518 },
+	{ 0x40D855, 0x0A0000, 0x0A0FFF, 12266, 12283 },
+	{ 0x40D855, 0x0A1000, 0x0A1FFF, 129536, 129555 },
+	{ 0x40D855, 0x0A2000, 0x0A2FFF, 122903, 122912 },
+	{ 0x40D855, 0x0A3000, 0x0A3FFF, 129569, 129584 },
+	{ 0x40D855, 0x0A4000, 0x0A4FFF, 129594, 129627 },
+	{ 0x40D855, 0x0A5000, 0x0A5FFF, 129644, 129665 },
+	{ 0x40D855, 0x0A6000, 0x0A6FFF, 129674, 129722 },
+	{ 0x40D855, 0x0A7000, 0x0A7FFF, 129766, 129791 },
+	{ 0x40D855, 0x0A8000, 0x0A8FFF, 22604, 22629 },
+	{ 0x40D855, 0x0A9000, 0x0A9FFF, 86696, 86708 },
+	{ 0x40D855, 0x0AA000, 0x0AAFFF, 129811, 129838 },
+	{ 0x40D855, 0x0AB000, 0x0ABFFF, 129860, 129878 },
+	{ 0x40D855, 0x0AC000, 0x0ACFFF, 129896, 129911 },
+	{ 0x40D855, 0x0AD000, 0x0ADFFF, 129926, 129938 },
+	{ 0x40D855, 0x0AE000, 0x0AEFFF, 18191, 18210 },
+	{ 0x40D855, 0x0AF000, 0x0AFFFF, 129950, 129962 },
+	{ 0x40D855, 0x0B0000, 0x0B0FFF, 129969, 129980 },
+	{ 0x40D855, 0x0B1000, 0x0B1FFF, 129991, 130042 },
+	{ 0x40D855, 0x0B2000, 0x0B2FFF, 130083, 130125 },
+	{ 0x40D855, 0x0B3000, 0x0B3FFF, 130148, 130159 },
+	{ 0x40D855, 0x0B4000, 0x0B4FFF, 130169, 130215 },
+	{ 0x40D855, 0x0B5000, 0x0B5FFF, 130250, 130274 },
+	{ 0x40D855, 0x0B6000, 0x0B6FFF, 21865, 21873 },
+	{ 0x40D855, 0x0B7000, 0x0B7FFF, 20008, 20028 },
+	{ 0x40D855, 0x0B8000, 0x0B8FFF, 130298, 130316 },
+	{ 0x40D855, 0x0B9000, 0x0B9FFF, 130331, 130370 },
+	{ 0x40D855, 0x0BA000, 0x0BAFFF, 130409, 130429 },
+	{ 0x40D855, 0x0BB000, 0x0BBFFF, 130449, 130458 },
+	{ 0x40D855, 0x0BC000, 0x0BCFFF, 93144, 93166 },
+	{ 0x40D855, 0x0BD000, 0x0BDFFF, 130467, 130481 },
+	{ 0x40D855, 0x0BE000, 0x0BEFFF, 130490, 130524 },
+	{ 0x40D855, 0x0BF000, 0x0BFFFF, 130554, 130583 },
+	{ 0x40D855, 0x0C0000, 0x0C0FFF, 28194, 28194 },
+	{ 0x40D855, 0x0C1000, 0x0C1FFF, 130604, 130624 },
+	{ 0x40D855, 0x0C2000, 0x0C2FFF, 130640, 130657 },
+	{ 0x40D855, 0x0C3000, 0x0C3FFF, 93343, 93364 },
+	{ 0x40D855, 0x0C4000, 0x0C4FFF, 130674, 130691 },
+	{ 0x40D855, 0x0C5000, 0x0C5FFF, 130700, 130716 },
+	{ 0x40D855, 0x0C6000, 0x0C6FFF, 130731, 130744 },
+	{ 0x40D855, 0x0C7000, 0x0C7FFF, 130752, 130766 },
+	{ 0x40D855, 0x0C8000, 0x0C8FFF, 19883, 19898 },
+	{ 0x40D855, 0x0C9000, 0x0C9FFF, 130775, 130775 },
+	{ 0x40D855, 0x0CA000, 0x0CAFFF, 130786, 130797 },
+	{ 0x40D855, 0x0CB000, 0x0CBFFF, 130805, 15974 },
+	{ 0x40D855, 0x0CC000, 0x0CCFFF, 21955, 21955 },
+	{ 0x40D855, 0x0CD000, 0x0CDFFF, 130816, 130832 },
+	{ 0x40D855, 0x0CE000, 0x0CEFFF, 130848, 130863 },
+	{ 0x40D855, 0x0CF000, 0x0CFFFF, 130878, 130894 },
+	{ 0x40D855, 0x0D0000, 0x0D0FFF, 130904, 130914 },
+	{ 0x40D855, 0x0D1000, 0x0D1FFF, 130924, 130936 },
+	{ 0x40D855, 0x0D2000, 0x0D2FFF, 111400, 111427 },
+	{ 0x40D855, 0x0D3000, 0x0D3FFF, 25559, 25576 },
+	{ 0x40D855, 0x0D4000, 0x0D4FFF, 130944, 130978 },
+	{ 0x40D855, 0x0D5000, 0x0D5FFF, 131006, 131033 },
+	{ 0x40D855, 0x0D6000, 0x0D6FFF, 131050, 131073 },
+	{ 0x40D855, 0x0D7000, 0x0D7FFF, 131096, 131115 },
+	{ 0x40D855, 0x0D8000, 0x0D8FFF, 131134, 131161 },
+	{ 0x40D855, 0x0D9000, 0x0D9FFF, 131187, 131209 },
+	{ 0x40D855, 0x0DA000, 0x0DAFFF, 131223, 131235 },
+	{ 0x40D855, 0x0DB000, 0x0DBFFF, 131244, 131259 },
+	{ 0x40D855, 0x0DC000, 0x0DCFFF, 131274, 131295 },
+	{ 0x40D855, 0x0DD000, 0x0DDFFF, 131312, 131326 },
+	{ 0x40D855, 0x0DE000, 0x0DEFFF, 29238, 29238 },
+	{ 0x40D855, 0x0DF000, 0x0DFFFF, 131332, 131341 },
+	{ 0x40D855, 0x0E0000, 0x0E0FFF, 131346, 131354 },
+	{ 0x40D855, 0x0E1000, 0x0E1FFF, 131362, 131382 },
+	{ 0x40D855, 0x0E2000, 0x0E2FFF, 131386, 131406 },
+	{ 0x40D855, 0x0E3000, 0x0E3FFF, 131425, 131437 },
+	{ 0x40D855, 0x0E4000, 0x0E4FFF, 131445, 131459 },
+	{ 0x40D855, 0x0E5000, 0x0E5FFF, 131465, 131488 },
+	{ 0x40D855, 0x0E6000, 0x0E6FFF, 131507, 114667 },
+	{ 0x40D855, 0x0E7000, 0x0E7FFF, 131531, 131531 },
+	{ 0x40D855, 0x0E8000, 0x0E8FFF, 131541, 131551 },
+	{ 0x40D855, 0x0E9000, 0x0E9FFF, 37228, 37239 },
+	{ 0x40D855, 0x0EA000, 0x0EAFFF, 131558, 131558 },
+	{ 0x40D855, 0x0EB000, 0x0EBFFF, 131564, 131581 },
+	{ 0x40D855, 0x0EC000, 0x0ECFFF, 87554, 87574 },
+	{ 0x40D855, 0x0ED000, 0x0EDFFF, 31347, 31369 },
+	{ 0x40D855, 0x0EE000, 0x0EEFFF, 131598, 131621 },
+	{ 0x40D855, 0x0EF000, 0x0EFFFF, 131644, 131668 },
+	{ 0x40D855, 0x0F0000, 0x0F0FFF, 90167, 90183 },
+	{ 0x40D855, 0x0F1000, 0x0F1FFF, 1361, 1386 },
+	{ 0x40D855, 0x0F2000, 0x0F2FFF, 131687, 131708 },
+	{ 0x40D855, 0x0F3000, 0x0F3FFF, 131729, 131747 },
+	{ 0x40D855, 0x0F4000, 0x0F4FFF, 59490, 59531 },
+	{ 0x40D855, 0x0F5000, 0x0F5FFF, 131752, 131762 },
+	{ 0x40D855, 0x0F6000, 0x0F6FFF, 2377, 2385 },
+	{ 0x40D855, 0x0F7000, 0x0F7FFF, 131772, 131811 },
+	{ 0x40D855, 0x0F8000, 0x0F8FFF, 131845, 131858 },
+	{ 0x40D855, 0x0F9000, 0x0F9FFF, 131871, 131891 },
+	{ 0x40D855, 0x0FA000, 0x0FAFFF, 131908, 131920 },
+	{ 0x40D855, 0x0FB000, 0x0FBFFF, 131929, 131956 },
+	{ 0x40D855, 0x0FC000, 0x0FCFFF, 109984, 110009 },
+	{ 0x40D855, 0x0FD000, 0x0FDFFF, 131978, 132004 },
+	{ 0x40D855, 0x0FE000, 0x0FEFFF, 132026, 132052 },
+	{ 0x40D855, 0x0FF000, 0x0FFFFF, 30959, 30978 },
+	{ 0x40D855, 0x100000, 0x100FFF, 132063, 124633 },
+	{ 0x40D855, 0x101000, 0x101FFF, 132096, 132119 },
+	{ 0x40D855, 0x102000, 0x102FFF, 60000, 60031 },
+	{ 0x40D855, 0x103000, 0x103FFF, 78540, 73652 },
+	{ 0x40D855, 0x104000, 0x104FFF, 132141, 132184 },
+	{ 0x40D855, 0x105000, 0x105FFF, 21466, 21491 },
+	{ 0x40D855, 0x106000, 0x106FFF, 132227, 132239 },
+	{ 0x40D855, 0x107000, 0x107FFF, 62943, 16301 },
+	{ 0x40D855, 0x108000, 0x108FFF, 132251, 132273 },
+	{ 0x40D855, 0x109000, 0x109FFF, 63276, 63305 },
+	{ 0x40D855, 0x10A000, 0x10AFFF, 132286, 132306 },
+	{ 0x40D855, 0x10B000, 0x10BFFF, 132318, 132339 },
+	{ 0x40D855, 0x10C000, 0x10CFFF, 132347, 132370 },
+	{ 0x40D855, 0x10D000, 0x10DFFF, 132391, 132422 },
+	{ 0x40D855, 0x10E000, 0x10EFFF, 132443, 132467 },
+	{ 0x40D855, 0x10F000, 0x10FFFF, 132486, 132506 },
+	{ 0x40D855, 0x110000, 0x110FFF, 93144, 93166 },
+	{ 0x40D855, 0x111000, 0x111FFF, 36847, 36865 },
+	{ 0x40D855, 0x112000, 0x112FFF, 37598, 37636 },
+	{ 0x40D855, 0x113000, 0x113FFF, 132522, 132535 },
+	{ 0x40D855, 0x114000, 0x114FFF, 18191, 18210 },
+	{ 0x40D855, 0x115000, 0x115FFF, 132544, 132565 },
+	{ 0x40D855, 0x116000, 0x116FFF, 132570, 132582 },
+	{ 0x40D855, 0x117000, 0x117FFF, 132590, 41120 },
+	{ 0x40D855, 0x118000, 0x118FFF, 132620, 132654 },
+	{ 0x40D855, 0x119000, 0x119FFF, 132685, 132722 },
+	{ 0x40D855, 0x11A000, 0x11AFFF, 27631, 27641 },
+	{ 0x40D855, 0x11B000, 0x11BFFF, 132759, 132775 },
+	{ 0x40D855, 0x11C000, 0x11CFFF, 65467, 23109 },
+	{ 0x40D855, 0x11D000, 0x11DFFF, 20008, 20028 },
+	{ 0x40D855, 0x11E000, 0x11EFFF, 132786, 94901 },
+	{ 0x40D855, 0x11F000, 0x11FFFF, 132798, 132822 },
+	{ 0x40D855, 0x120000, 0x120FFF, 132846, 132861 },
+	{ 0x40D855, 0x121000, 0x121FFF, 132871, 132921 },
+	{ 0x40D855, 0x122000, 0x122FFF, 132949, 132967 },
+	{ 0x40D855, 0x123000, 0x123FFF, 132980, 110145 },
+	{ 0x40D855, 0x124000, 0x124FFF, 133014, 133027 },
+	{ 0x40D855, 0x125000, 0x125FFF, 133033, 133046 },
+	{ 0x40D855, 0x126000, 0x126FFF, 133059, 73557 },
+	{ 0x40D855, 0x127000, 0x127FFF, 131531, 131531 },
+	{ 0x40D855, 0x128000, 0x128FFF, 133067, 133076 },
+	{ 0x40D855, 0x129000, 0x129FFF, 14445, 712 },
+	{ 0x40D855, 0x12A000, 0x12AFFF, 133085, 133122 },
+	{ 0x40D855, 0x12B000, 0x12BFFF, 124412, 30810 },
+	{ 0x40D855, 0x12C000, 0x12CFFF, 133151, 133166 },
+	{ 0x40D855, 0x12D000, 0x12DFFF, 133177, 133195 },
+	{ 0x40D855, 0x12E000, 0x12EFFF, 133213, 133239 },
+	{ 0x40D855, 0x12F000, 0x12FFFF, 2377, 2385 },
+	{ 0x40D855, 0x130000, 0x130FFF, 85745, 85763 },
+	{ 0x40D855, 0x131000, 0x131FFF, 7646, 7657 },
+	{ 0x40D855, 0x132000, 0x132FFF, 133259, 118980 },
+	{ 0x40D855, 0x133000, 0x133FFF, 37724, 16641 },
+	{ 0x40D855, 0x134000, 0x134FFF, 133284, 133311 },
+	{ 0x40D855, 0x135000, 0x135FFF, 63406, 63432 },
+	{ 0x40D855, 0x136000, 0x136FFF, 133324, 133339 },
+	{ 0x40D855, 0x137000, 0x137FFF, 133353, 133364 },
+	{ 0x40D855, 0x138000, 0x138FFF, 133375, 133400 },
+	{ 0x40D855, 0x139000, 0x139FFF, 133417, 133428 },
+	{ 0x40D855, 0x13A000, 0x13AFFF, 133439, 133481 },
+	{ 0x40D855, 0x13B000, 0x13BFFF, 133520, 133547 },
+	{ 0x40D855, 0x13C000, 0x13CFFF, 132871, 132921 },
+	{ 0x40D855, 0x13D000, 0x13DFFF, 133566, 133623 },
+	{ 0x40D855, 0x13E000, 0x13EFFF, 133680, 133689 },
+	{ 0x40D855, 0x13F000, 0x13FFFF, 133698, 133738 },
+	{ 0x40D855, 0x140000, 0x140FFF, 133770, 70653 },
+	{ 0x40D855, 0x141000, 0x141FFF, 106736, 33348 },
+	{ 0x40D855, 0x142000, 0x142FFF, 133800, 133816 },
+	{ 0x40D855, 0x143000, 0x143FFF, 133826, 133845 },
+	{ 0x40D855, 0x144000, 0x144FFF, 133859, 133865 },
+	{ 0x40D855, 0x145000, 0x145FFF, 133871, 133898 },
+	{ 0x40D855, 0x146000, 0x146FFF, 133912, 133948 },
+	{ 0x40D855, 0x147000, 0x147FFF, 93144, 93166 },
+	{ 0x40D855, 0x148000, 0x148FFF, 133967, 133991 },
+	{ 0x40D855, 0x149000, 0x149FFF, 80129, 80149 },
+	{ 0x40D855, 0x14A000, 0x14AFFF, 18191, 18210 },
+	{ 0x40D855, 0x14B000, 0x14BFFF, 17210, 17237 },
+	{ 0x40D855, 0x14C000, 0x14CFFF, 134002, 134002 },
+	{ 0x40D855, 0x14D000, 0x14DFFF, 134006, 134016 },
+	{ 0x40D855, 0x14E000, 0x14EFFF, 134026, 134040 },
+	{ 0x40D855, 0x14F000, 0x14FFFF, 134048, 134079 },
+	{ 0x40D855, 0x150000, 0x150FFF, 134106, 134124 },
+	{ 0x40D855, 0x151000, 0x151FFF, 134142, 134201 },
+	{ 0x40D855, 0x152000, 0x152FFF, 134251, 134274 },
+	{ 0x40D855, 0x153000, 0x153FFF, 134297, 134311 },
+	{ 0x40D855, 0x154000, 0x154FFF, 134321, 134326 },
+	{ 0x40D855, 0x155000, 0x155FFF, 7082, 7095 },
+	{ 0x40D855, 0x156000, 0x156FFF, 134331, 134346 },
+	{ 0x40D855, 0x157000, 0x157FFF, 134355, 134389 },
+	{ 0x40D855, 0x158000, 0x158FFF, 124392, 124402 },
+	{ 0x40D855, 0x159000, 0x159FFF, 134413, 134427 },
+	{ 0x40D855, 0x15A000, 0x15AFFF, 16217, 16228 },
+	{ 0x40D855, 0x15B000, 0x15BFFF, 134436, 134463 },
+	{ 0x40D855, 0x15C000, 0x15CFFF, 134485, 134502 },
+	{ 0x40D855, 0x15D000, 0x15DFFF, 134514, 134536 },
+	{ 0x40D855, 0x15E000, 0x15EFFF, 42408, 42434 },
+	{ 0x40D855, 0x15F000, 0x15FFFF, 37736, 37747 },
+	{ 0x40D855, 0x160000, 0x160FFF, 134558, 134583 },
+	{ 0x40D855, 0x161000, 0x161FFF, 134608, 134623 },
+	{ 0x40D855, 0x162000, 0x162FFF, 134634, 134634 },
+	{ 0x40D855, 0x163000, 0x163FFF, 134645, 134658 },
+	{ 0x40D855, 0x164000, 0x164FFF, 134667, 134700 },
+	{ 0x40D855, 0x165000, 0x165FFF, 134728, 134742 },
+	{ 0x40D855, 0x166000, 0x166FFF, 134756, 134798 },
+	{ 0x40D855, 0x167000, 0x167FFF, 134819, 62161 },
+	{ 0x40D855, 0x168000, 0x168FFF, 134842, 134862 },
+	{ 0x40D855, 0x169000, 0x169FFF, 134869, 134884 },
+	{ 0x40D855, 0x16A000, 0x16AFFF, 93144, 93166 },
+	{ 0x40D855, 0x16B000, 0x16BFFF, 134899, 134899 },
+	{ 0x40D855, 0x16C000, 0x16CFFF, 2377, 2385 },
+	{ 0x40D855, 0x16D000, 0x16DFFF, 18191, 18210 },
+	{ 0x40D855, 0x16E000, 0x16EFFF, 134907, 44871 },
+	{ 0x40D855, 0x16F000, 0x16FFFF, 134923, 134940 },
+	{ 0x40D855, 0x170000, 0x170FFF, 134957, 134972 },
+	{ 0x40D855, 0x171000, 0x171FFF, 27631, 27641 },
+	{ 0x40D855, 0x172000, 0x172FFF, 134987, 135023 },
+	{ 0x40D855, 0x173000, 0x173FFF, 34837, 34880 },
+	{ 0x40D855, 0x174000, 0x174FFF, 135050, 135062 },
+	{ 0x40D855, 0x175000, 0x175FFF, 135074, 135091 },
+	{ 0x40D855, 0x176000, 0x176FFF, 135103, 106614 },
+	{ 0x40D855, 0x177000, 0x177FFF, 135139, 135164 },
+	{ 0x40D855, 0x178000, 0x178FFF, 135180, 135199 },
+	{ 0x40D855, 0x179000, 0x179FFF, 135213, 135230 },
+	{ 0x40D855, 0x17A000, 0x17AFFF, 62200, 62200 },
+	{ 0x40D855, 0x17B000, 0x17BFFF, 28710, 28710 },
+	{ 0x40D855, 0x17C000, 0x17CFFF, 39452, 39470 },
+	{ 0x40D855, 0x17D000, 0x17DFFF, 135242, 135256 },
+	{ 0x40D855, 0x17E000, 0x17EFFF, 135265, 135265 },
+	{ 0x40D855, 0x17F000, 0x17FFFF, 21865, 21873 },
+	{ 0x40D855, 0x180000, 0x180FFF, 135274, 128347 },
+	{ 0x40D855, 0x181000, 0x181FFF, 135288, 135295 },
+	{ 0x40D855, 0x182000, 0x182FFF, 135302, 135321 },
+	{ 0x40D855, 0x183000, 0x183FFF, 7646, 7657 },
+	{ 0x40D855, 0x184000, 0x184FFF, 135335, 135348 },
+	{ 0x40D855, 0x185000, 0x185FFF, 135357, 135380 },
+	{ 0x40D855, 0x186000, 0x186FFF, 124896, 78972 },
+	{ 0x40D855, 0x187000, 0x187FFF, 135403, 135414 },
+	{ 0x40D855, 0x188000, 0x188FFF, 135419, 135437 },
+	{ 0x40D855, 0x189000, 0x189FFF, 135443, 135462 },
+	{ 0x40D855, 0x18A000, 0x18AFFF, 93144, 93166 },
+	{ 0x40D855, 0x18B000, 0x18BFFF, 135469, 135496 },
+	{ 0x40D855, 0x18C000, 0x18CFFF, 135511, 135522 },
+	{ 0x40D855, 0x18D000, 0x18DFFF, 64753, 64765 },
+	{ 0x40D855, 0x18E000, 0x18EFFF, 135526, 135570 },
+	{ 0x40D855, 0x18F000, 0x18FFFF, 135592, 135616 },
+	{ 0x40D855, 0x190000, 0x190FFF, 135629, 91006 },
+	{ 0x40D855, 0x191000, 0x191FFF, 135663, 135679 },
+	{ 0x40D855, 0x192000, 0x192FFF, 18191, 18210 },
+	{ 0x40D855, 0x193000, 0x193FFF, 135695, 135715 },
+	{ 0x40D855, 0x194000, 0x194FFF, 13994, 14002 },
+	{ 0x40D855, 0x195000, 0x195FFF, 49803, 49822 },
+	{ 0x40D855, 0x196000, 0x196FFF, 30864, 30893 },
+	{ 0x40D855, 0x197000, 0x197FFF, 135729, 125846 },
+	{ 0x40D855, 0x198000, 0x198FFF, 135748, 135763 },
+	{ 0x40D855, 0x199000, 0x199FFF, 135773, 135801 },
+	{ 0x40D855, 0x19A000, 0x19AFFF, 34650, 34673 },
+	{ 0x40D855, 0x19B000, 0x19BFFF, 135824, 135851 },
+	{ 0x40D855, 0x19C000, 0x19CFFF, 135878, 135905 },
+	{ 0x40D855, 0x19D000, 0x19DFFF, 7646, 7657 },
+	{ 0x40D855, 0x19E000, 0x19EFFF, 135920, 135935 },
+	{ 0x40D855, 0x19F000, 0x19FFFF, 135945, 135964 },
+	{ 0x40D855, 0x1A0000, 0x1A0FFF, 22159, 22178 },
+	{ 0x40D855, 0x1A1000, 0x1A1FFF, 135983, 135997 },
+	{ 0x40D855, 0x1A2000, 0x1A2FFF, 128106, 128147 },
+	{ 0x40D855, 0x1A3000, 0x1A3FFF, 136011, 136038 },
+	{ 0x40D855, 0x1A4000, 0x1A4FFF, 136053, 136063 },
+	{ 0x40D855, 0x1A5000, 0x1A5FFF, 136070, 136078 },
+	{ 0x40D855, 0x1A6000, 0x1A6FFF, 136086, 136103 },
+	{ 0x40D855, 0x1A7000, 0x1A7FFF, 136120, 94860 },
+	{ 0x40D855, 0x1A8000, 0x1A8FFF, 136157, 136172 },
+	{ 0x40D855, 0x1A9000, 0x1A9FFF, 136187, 136201 },
+	{ 0x40D855, 0x1AA000, 0x1AAFFF, 136214, 136248 },
+	{ 0x40D855, 0x1AB000, 0x1ABFFF, 63276, 63305 },
+	{ 0x40D855, 0x1AC000, 0x1ACFFF, 111400, 111427 },
+	{ 0x40D855, 0x1AD000, 0x1ADFFF, 136259, 136282 },
+	{ 0x40D855, 0x1AE000, 0x1AEFFF, 136305, 136331 },
+	{ 0x40D855, 0x1AF000, 0x1AFFFF, 136352, 136366 },
+	{ 0x40D855, 0x1B0000, 0x1B0FFF, 136375, 136413 },
+	{ 0x40D855, 0x1B1000, 0x1B1FFF, 136431, 136447 },
+	{ 0x40D855, 0x1B2000, 0x1B2FFF, 136456, 136479 },
+	{ 0x40D855, 0x1B3000, 0x1B3FFF, 107681, 80067 },
+	{ 0x40D855, 0x1B4000, 0x1B4FFF, 136501, 100267 },
+	{ 0x40D855, 0x1B5000, 0x1B5FFF, 136524, 136550 },
+	{ 0x40D855, 0x1B6000, 0x1B6FFF, 136576, 136590 },
+	{ 0x40D855, 0x1B7000, 0x1B7FFF, 136596, 136626 },
+	{ 0x40D855, 0x1B8000, 0x1B8FFF, 136642, 136661 },
+	{ 0x40D855, 0x1B9000, 0x1B9FFF, 136667, 136702 },
+	{ 0x40D855, 0x1BA000, 0x1BAFFF, 136737, 136781 },
+	{ 0x40D855, 0x1BB000, 0x1BBFFF, 136813, 136835 },
+	{ 0x40D855, 0x1BC000, 0x1BCFFF, 136854, 136868 },
+	{ 0x40D855, 0x1BD000, 0x1BDFFF, 47062, 47077 },
+	{ 0x40D855, 0x1BE000, 0x1BEFFF, 124202, 73652 },
+	{ 0x40D855, 0x1BF000, 0x1BFFFF, 136877, 136919 },
+	{ 0x40D855, 0x1C0000, 0x1C0FFF, 136954, 136972 },
+	{ 0x40D855, 0x1C1000, 0x1C1FFF, 136990, 137008 },
+	{ 0x40D855, 0x1C2000, 0x1C2FFF, 137023, 137047 },
+	{ 0x40D855, 0x1C3000, 0x1C3FFF, 137063, 137083 },
+	{ 0x40D855, 0x1C4000, 0x1C4FFF, 137091, 137120 },
+	{ 0x40D855, 0x1C5000, 0x1C5FFF, 2377, 2385 },
+	{ 0x40D855, 0x1C6000, 0x1C6FFF, 137133, 137154 },
+	{ 0x40D855, 0x1C7000, 0x1C7FFF, 49562, 49575 },
+	{ 0x40D855, 0x1C8000, 0x1C8FFF, 71595, 71616 },
+	{ 0x40D855, 0x1C9000, 0x1C9FFF, 137171, 137183 },
+	{ 0x40D855, 0x1CA000, 0x1CAFFF, 137190, 137208 },
+	{ 0x40D855, 0x1CB000, 0x1CBFFF, 59752, 59762 },
+	{ 0x40D855, 0x1CC000, 0x1CCFFF, 137226, 137244 },
+	{ 0x40D855, 0x1CD000, 0x1CDFFF, 137262, 137286 },
+	{ 0x40D855, 0x1CE000, 0x1CEFFF, 119249, 119283 },
+	{ 0x40D855, 0x1CF000, 0x1CFFFF, 137296, 137322 },
+	{ 0x40D855, 0x1D0000, 0x1D0FFF, 137339, 137350 },
+	{ 0x40D855, 0x1D1000, 0x1D1FFF, 137358, 137401 },
+	{ 0x40D855, 0x1D2000, 0x1D2FFF, 126335, 126350 },
+	{ 0x40D855, 0x1D3000, 0x1D3FFF, 137435, 137472 },
+	{ 0x40D855, 0x1D4000, 0x1D4FFF, 52390, 52413 },
+	{ 0x40D855, 0x1D5000, 0x1D5FFF, 137509, 137520 },
+	{ 0x40D855, 0x1D6000, 0x1D6FFF, 137526, 137548 },
+	{ 0x40D855, 0x1D7000, 0x1D7FFF, 19350, 19373 },
+	{ 0x40D855, 0x1D8000, 0x1D8FFF, 137566, 137599 },
+	{ 0x40D855, 0x1D9000, 0x1D9FFF, 137627, 137674 },
+	{ 0x40D855, 0x1DA000, 0x1DAFFF, 137694, 137729 },
+	{ 0x40D855, 0x1DB000, 0x1DBFFF, 137748, 137772 },
+	{ 0x40D855, 0x1DC000, 0x1DCFFF, 93144, 93166 },
+	{ 0x40D855, 0x1DD000, 0x1DDFFF, 137790, 137807 },
+	{ 0x40D855, 0x1DE000, 0x1DEFFF, 102868, 30762 },
+	{ 0x40D855, 0x1DF000, 0x1DFFFF, 137821, 137857 },
+	{ 0x40D855, 0x1E0000, 0x1E0FFF, 137873, 137905 },
+	{ 0x40D855, 0x1E1000, 0x1E1FFF, 137914, 137925 },
+	{ 0x40D855, 0x1E2000, 0x1E2FFF, 137936, 137949 },
+	{ 0x40D855, 0x1E3000, 0x1E3FFF, 137961, 137982 },
+	{ 0x40D855, 0x1E4000, 0x1E4FFF, 137999, 138008 },
+	{ 0x40D855, 0x50D000, 0x50DFFF, 66587, 66631 },
+	{ 0x40D855, 0xEE6000, 0xEE6FFF, 138013, 51747 },
 
 };
+
+
+static const char libieee_iab_strings[] =
+	"T.L.S. Corp.\0"
+	"T-L-S\0"
+	"JMBS Developpements\0"
+	"JMBS-DEVELOPPEMENTS\0"
+	"Integrated Automation Solutions\0"
+	"INTEGRATED-AUTOMATION-SOLUTIONS\0"
+	"Microsoft\0"
+	"MICROSOFT\0"
+	"SCI Technology Inc.\0"
+	"SCI\0"
+	"GD California, Inc.\0"
+	"GD-CALIFORNIA\0"
+	"Project Management Enterprises, Inc.\0"
+	"PROJECT-MANAGEMENT-ENTERPRISES\0"
+	"Clive Green & Co. Ltd.\0"
+	"CLIVE-GREEN\0"
+	"Portable Add-Ons\0"
+	"PORTABLE-ADD-ONS\0"
+	"Datakinetics Ltd.\0"
+	"DATAKINETICS\0"
+	"Tharsys\0"
+	"THARSYS\0"
+	"IO Limited\0"
+	"IO\0"
+	"Vbrick Systems Inc.\0"
+	"VBRICK\0"
+	"Opus Telecom Inc.\0"
+	"OPUS-TELECOM\0"
+	"TTTech\0"
+	"TTTECH\0"
+	"XLN-t\0"
+	"XLN-T\0"
+	"Moisture Systems\0"
+	"MOISTURE\0"
+	"Bihl + Wiedemann GmbH\0"
+	"BIHL-+-WIEDEMANN\0"
+	"Floware System Solutions Ltd.\0"
+	"FLOWARE-SYSTEM-SOLUTIONS\0"
+	"Sensys Technologies Inc.\0"
+	"SENSYS-TECHNOLOGIES\0"
+	"Canal +\0"
+	"CANAL\0"
+	"LEROY AUTOMATION\0"
+	"LEROY-AUTOMATION\0"
+	"DSP Design Ltd.\0"
+	"DSP-DESIGN\0"
+	"Hunter Technology Inc.\0"
+	"HUNTER\0"
+	"CAD-UL GmbH\0"
+	"CAD-UL\0"
+	"Emtac Technology Corp.\0"
+	"EMTAC\0"
+	"Skylake Talix\0"
+	"SKYLAKE-TALIX\0"
+	"Cross Products Ltd.\0"
+	"CROSS-PRODUCTS\0"
+	"Tadiran Scopus\0"
+	"TADIRAN-SCOPUS\0"
+	"Princeton Gamma Tech\0"
+	"PRINCETON-GAMMA-TECH\0"
+	"CallTech International Limited\0"
+	"CALLTECH\0"
+	"KBS Industrieelektronik GmbH\0"
+	"KBS-INDUSTRIEELEKTRONIK\0"
+	"Icon Research Ltd.\0"
+	"ICON-RESEARCH\0"
+	"DRS Technologies Canada Co.\0"
+	"DRS-TECHNOLOGIES-CANADA\0"
+	"Ashling Microsystems Ltd.\0"
+	"ASHLING-MICROSYSTEMS\0"
+	"Zabacom, Inc.\0"
+	"ZABACOM\0"
+	"IPITEK\0"
+	"TERACOM TELEMATICA S.A\0"
+	"TERACOM-TELEMATICA\0"
+	"Abatis Systems Corp.\0"
+	"ABATIS\0"
+	"Industrial Control Links\0"
+	"INDUSTRIAL-CONTROL-LINKS\0"
+	"The Frensch Corporation (Pty) Ltd.\0"
+	"THE-FRENSCH-PTY\0"
+	"Grossenbacher Systeme AG\0"
+	"GROSSENBACHER-SYSTEME\0"
+	"VersaLogic Corp.\0"
+	"VERSALOGIC\0"
+	"Nova Engineering Inc.\0"
+	"NOVA-ENGINEERING\0"
+	"Narrowband Telecommunications\0"
+	"NARROWBAND-TELECOMMUNICATIONS\0"
+	"Innocor LTD\0"
+	"INNOCOR\0"
+	"Turtle Mountain Corp\0"
+	"TURTLE-MOUNTAIN\0"
+	"Sinetica Corp\0"
+	"SINETICA\0"
+	"Lockheed Martin Tactical Defense Systems Eagan\0"
+	"LOCKHEED-MARTIN-TACTICAL-DEFENSE-EAGAN\0"
+	"Eloquence Ltd\0"
+	"ELOQUENCE\0"
+	"MotionIO\0"
+	"MOTIONIO\0"
+	"Doble Engineering\0"
+	"DOBLE-ENGINEERING\0"
+	"Ing. Buero W. Kanis GmbH\0"
+	"ING-BUERO-W-KANIS\0"
+	"Alliant Techsystems, Inc.\0"
+	"ALLIANT-TECHSYSTEMS\0"
+	"Arcturus Networks Inc.\0"
+	"ARCTURUS-NETWORKS\0"
+	"E.I.S.M.\0"
+	"E-I-S-M\0"
+	"Etheira Technologies\0"
+	"ETHEIRA-TECHNOLOGIES\0"
+	"Apex Signal Corp\0"
+	"APEX-SIGNAL\0"
+	"PLLB Elettronica SPA\0"
+	"PLLB-ELETTRONICA-SPA\0"
+	"VNR Electronique SA\0"
+	"VNR-ELECTRONIQUE\0"
+	"BrainBoxes Ltd\0"
+	"BRAINBOXES\0"
+	"ISDN Gateway Technology AG\0"
+	"ISDN-GATEWAY\0"
+	"MSU UK Ltd\0"
+	"MSU-UK\0"
+	"Celotek Corp\0"
+	"CELOTEK\0"
+	"MiSPO Co., Ltd.\0"
+	"MISPO\0"
+	"Damler Chrysler Rail System (Signal) AB\0"
+	"DAMLER-CHRYSLER-RAIL-SYSTEM-SIGNAL-AB\0"
+	"B.E.A.R. Solutions (Australasia) Pty, Ltd\0"
+	"B-E-A-R-SOLUTIONS-AUSTRALASIA-PTY\0"
+	"Curtis, Inc.\0"
+	"CURTIS\0"
+	"Private\0"
+	"PRIVATE\0"
+	"Chase Manhattan Bank\0"
+	"CHASE-MANHATTAN-BANK\0"
+	"B. R. Electronics\0"
+	"B-R-ELECTRONICS\0"
+	"Cybectec Inc.\0"
+	"CYBECTEC\0"
+	"Computer Concepts Corp\0"
+	"CONCEPTS\0"
+	"Telecom Analysis Systems, LP\0"
+	"TELECOM-ANALYSIS-LP\0"
+	"Tecstar Demo Systems Division\0"
+	"TECSTAR-DEMO-DIVISION\0"
+	"New Standard Engineering NV\0"
+	"NEW-STANDARD-ENGINEERING-NV\0"
+	"Industrial Electronic Engineers, Inc.\0"
+	"INDUSTRIAL-ENGINEERS\0"
+	"Luma Corporation\0"
+	"LUMA\0"
+	"Dataprobe, Inc.\0"
+	"DATAPROBE\0"
+	"JSR Ultrasonics\0"
+	"JSR-ULTRASONICS\0"
+	"Mayo Foundation\0"
+	"MAYO-FOUNDATION\0"
+	"Optionexist Limited\0"
+	"OPTIONEXIST\0"
+	"San Castle Technologies, Inc.\0"
+	"SAN-CASTLE-TECHNOLOGIES\0"
+	"Base 2\0"
+	"BASE-2\0"
+	"Lite F GmBH\0"
+	"LITE-F\0"
+	"Vision Research, Inc.\0"
+	"VISION-RESEARCH\0"
+	"Austco Marketing & Service (USA) ltd.\0"
+	"AUSTCO-MARKETING-SERVICE-USA\0"
+	"Sonifex Ltd\0"
+	"SONIFEX\0"
+	"Radiometer Medical A/S\0"
+	"RADIOMETER-MEDICAL-A/S\0"
+	"Nortel Networks PLC (UK)\0"
+	"NORTEL-NETWORKS-PLC-UK\0"
+	"Ignitus Communications, LLC\0"
+	"IGNITUS-COMMUNICATION\0"
+	"DIVA Systems\0"
+	"DIVA\0"
+	"Malden Electronics Ltd\0"
+	"MALDEN-ELECTRONICS\0"
+	"Simple Network Magic Corporation\0"
+	"SIMPLE-NETWORK-MAGIC\0"
+	"Ticketmaster Corp\0"
+	"TICKETMASTER\0"
+	"Clever Devices\0"
+	"CLEVER-DEVICES\0"
+	"Riverlink Computers, Ltd.\0"
+	"RIVERLINK-COMPUTERS\0"
+	"Seabridge\0"
+	"SEABRIDGE\0"
+	"EC Elettronica S.R.L.\0"
+	"EC-ELETTRONICA\0"
+	"Unimark\0"
+	"UNIMARK\0"
+	"NCast Corporation\0"
+	"NCAST\0"
+	"WaveCom Electronics, Inc.\0"
+	"WAVECOM-ELECTRONICS\0"
+	"Advanced Signal Corp.\0"
+	"ADVANCED-SIGNAL\0"
+	"Avtron Manufacturing Inc.\0"
+	"AVTRON-MANUFACTURING\0"
+	"Digital Services Group\0"
+	"DIGITAL-SERVICES-GROUP\0"
+	"Katchall Technologies Group\0"
+	"KATCHALL-TECHNOLOGIES-GROUP\0"
+	"NetVision Telecom\0"
+	"NETVISION-TELECOM\0"
+	"Neuberger Gebaeudeautomation GmbH & Co.\0"
+	"NEUBERGER-GEBAEUDEAUTOMATION\0"
+	"Alstom Signalling Ltd.\0"
+	"ALSTOM-SIGNALLING\0"
+	"Edge Tech Co., Ltd.\0"
+	"EDGE-TECH\0"
+	"ENTTEC Pty Ltd.\0"
+	"ENTTEC-PTY\0"
+	"Litton Guidance & Control Systems\0"
+	"LITTON-GUIDANCE-CONTROL\0"
+	"Saco Smartvision Inc.\0"
+	"SACO-SMARTVISION\0"
+	"Reselec AG\0"
+	"RESELEC\0"
+	"Flextel S.p.A\0"
+	"FLEXTEL\0"
+	"RadioTel\0"
+	"RADIOTEL\0"
+	"Trikon Technologies Ltd.\0"
+	"TRIKON-TECHNOLOGIES\0"
+	"PLLB elettronica spa\0"
+	"Caspian Networks\0"
+	"CASPIAN-NETWORKS\0"
+	"JL-teknik\0"
+	"JL-TEKNIK\0"
+	"Dunti Corporation\0"
+	"DUNTI\0"
+	"AIM\0"
+	"Matuschek Messtechnik GmbH\0"
+	"MATUSCHEK-MESSTECHNIK\0"
+	"GFI Chrono Time\0"
+	"GFI-CHRONO-TIME\0"
+	"ard sa\0"
+	"ARD\0"
+	"DIALOG4 System Engineering GmbH\0"
+	"DIALOG4-SYSTEM-ENGINEERING\0"
+	"Crossport Systems\0"
+	"CROSSPORT\0"
+	"Validyne Engineering Corp.\0"
+	"VALIDYNE-ENGINEERING\0"
+	"Monitor Business Machines Ltd.\0"
+	"MONITOR-BUSINESS-MACHINES\0"
+	"TELINC Corporation\0"
+	"TELINC\0"
+	"Fenwal Italia S.P.A.\0"
+	"FENWAL-ITALIA\0"
+	"Rising Edge Technologies\0"
+	"RISING-EDGE-TECHNOLOGIES\0"
+	"HYPERCHIP Inc.\0"
+	"HYPERCHIP\0"
+	"IP Unity\0"
+	"IP-UNITY\0"
+	"Kylink Communications Corp.\0"
+	"KYLINK-COMMUNICATION\0"
+	"BSQUARE\0"
+	"General Industries Argentina\0"
+	"GENERAL-INDUSTRIES-ARGENTINA\0"
+	"Invensys Controls Network Systems\0"
+	"INVENSYS-CONTROLS-NETWORK\0"
+	"StorLogic, Inc.\0"
+	"STORLOGIC\0"
+	"DigitAll World Co., Ltd\0"
+	"DIGITALL-WORLD\0"
+	"KOREALINK\0"
+	"Analytical Spectral Devices, Inc.\0"
+	"ANALYTICAL-SPECTRAL-DEVICES\0"
+	"SEATECH\0"
+	"Utronix Elektronikutreckling AB\0"
+	"UTRONIX-ELEKTRONIKUTRECKLING-AB\0"
+	"IMV Invertomatic\0"
+	"IMV-INVERTOMATIC\0"
+	"EPEL Industrial, S.A.\0"
+	"EPEL-INDUSTRIAL\0"
+	"Case Information & Communications\0"
+	"CASE-INFORMATION-COMMUNICATION\0"
+	"NBO Development Center Sekusui Chemical Co. Ltd.\0"
+	"NBO-DEVELOPMENT-CENTER-SEKUSUI-CHEMICAL\0"
+	"Seffle Instrument AB\0"
+	"SEFFLE-INSTRUMENT-AB\0"
+	"RF Applications, Inc.\0"
+	"RF-APPLICATIONS\0"
+	"ZELPOS\0"
+	"Infinitec Networks, Inc.\0"
+	"INFINITEC-NETWORKS\0"
+	"MetaWave Vedeo Systems\0"
+	"METAWAVE-VEDEO\0"
+	"CYNAPS\0"
+	"Visable Genetics, Inc.\0"
+	"VISABLE-GENETICS\0"
+	"Jäger Computergesteuerte Meßtechnik GmbH.\0"
+	"JAEGER-COMPUTERGESTEUERTE-MESSTECHNIK\0"
+	"BaSyTec GmbH\0"
+	"BASYTEC\0"
+	"Bounty Systems Pty Ltd.\0"
+	"BOUNTY-PTY\0"
+	"Mobiltex Data Ltd.\0"
+	"MOBILTEX-DATA\0"
+	"Arula Systems, Inc.\0"
+	"ARULA\0"
+	"WaterCove Networks\0"
+	"WATERCOVE-NETWORKS\0"
+	"Kaveri Networks\0"
+	"KAVERI-NETWORKS\0"
+	"Radiant Networks Plc\0"
+	"RADIANT-NETWORKS-PLC\0"
+	"Log-In, Inc.\0"
+	"LOG-IN\0"
+	"Fastware.Net, LLC\0"
+	"FASTWARE-NET\0"
+	"Honeywell GNO\0"
+	"HONEYWELL-GNO\0"
+	"BMC Messsysteme GmbH\0"
+	"BMC-MESSSYSTEME\0"
+	"Zarak Systems Corp.\0"
+	"ZARAK\0"
+	"Latus Lightworks, Inc.\0"
+	"LATUS-LIGHTWORKS\0"
+	"LMI Technologies\0"
+	"LMI-TECHNOLOGIES\0"
+	"Beeline Networks, Inc.\0"
+	"BEELINE-NETWORKS\0"
+	"R F Micro Devices\0"
+	"R-F-MICRO-DEVICES\0"
+	"SMX Corporation\0"
+	"SMX\0"
+	"Wavefly Corporation\0"
+	"WAVEFLY\0"
+	"EXTREME COPPER,  INC.\0"
+	"EXTREME-COPPER\0"
+	"ApSecure Technologies (Canada), Inc.\0"
+	"APSECURE-TECHNOLOGIES-CANADA\0"
+	"RYMIC\0"
+	"LAN Controls, Inc.\0"
+	"LAN-CONTROLS\0"
+	"Helmut Mauell GmbH Werk Weida\0"
+	"HELMUT-MAUELL-WERK-WEIDA\0"
+	"Pro-Active\0"
+	"PRO-ACTIVE\0"
+	"MAZet GmbH\0"
+	"MAZET\0"
+	"Infolink Software AG\0"
+	"INFOLINK-SOFTWARE\0"
+	"Tattile\0"
+	"TATTILE\0"
+	"Stella Electronics & Tagging\0"
+	"STELLA-ELECTRONICS-TAGGING\0"
+	"Imigix Ltd.\0"
+	"IMIGIX\0"
+	"Casabyte\0"
+	"CASABYTE\0"
+	"Alchemy Semiconductor, Inc.\0"
+	"ALCHEMY-SEMICONDUCTOR\0"
+	"Tonbu, Inc.\0"
+	"TONBU\0"
+	"InterEpoch Technology,INC.\0"
+	"INTEREPOCH\0"
+	"SAIA Burgess Controls AG\0"
+	"SAIA-BURGESS-CONTROLS\0"
+	"Advanced Medical Information Technologies, Inc.\0"
+	"ADVANCED-MEDICAL-INFORMATION-TECHNOLOGIES\0"
+	"TransComm Technology System, Inc.\0"
+	"TRANSCOMM-SYSTEM\0"
+	"The Trane Company\0"
+	"THE-TRANE-COMPANY\0"
+	"DSS Networks, Inc.\0"
+	"DSS-NETWORKS\0"
+	"J D Richards\0"
+	"J-D-RICHARDS\0"
+	"STUDIEL\0"
+	"AlphaMedia Co., Ltd\0"
+	"ALPHAMEDIA\0"
+	"LINET OY\0"
+	"LINET-OY\0"
+	"RFL Electronics, Inc.\0"
+	"RFL-ELECTRONICS\0"
+	"PCSC\0"
+	"Telefrang AB\0"
+	"TELEFRANG-AB\0"
+	"Renaissance Networking, Inc.\0"
+	"RENAISSANCE-NETWORKING\0"
+	"Real World Computing Partnership\0"
+	"REAL-WORLD-COMPUTING-PARTNERSHIP\0"
+	"Lake Technology, Ltd.\0"
+	"LAKE\0"
+	"Palm, Inc.\0"
+	"PALM\0"
+	"Zelax\0"
+	"ZELAX\0"
+	"Inco Startec GmbH\0"
+	"INCO-STARTEC\0"
+	"Summit Avionics, Inc.\0"
+	"SUMMIT-AVIONICS\0"
+	"Charlotte's Web Networks\0"
+	"CHARLOTTE-S-WEB-NETWORKS\0"
+	"Loewe Opta GmbH\0"
+	"LOEWE-OPTA\0"
+	"Motion Analysis Corp.\0"
+	"MOTION-ANALYSIS\0"
+	"Cyberex\0"
+	"CYBEREX\0"
+	"Elbit Systems Ltd.\0"
+	"ELBIT\0"
+	"Interisa Electronica, S.A.\0"
+	"INTERISA-ELECTRONICA\0"
+	"Frederick Engineering\0"
+	"FREDERICK-ENGINEERING\0"
+	"Innovation Institute, Inc.\0"
+	"INNOVATION-INSTITUTE\0"
+	"EMAC, Inc.\0"
+	"EMAC\0"
+	"Inspiration Technology P/L\0"
+	"INSPIRATION-P/L\0"
+	"Visual Circuits Corp.\0"
+	"VISUAL-CIRCUITS\0"
+	"Lanex S.A.\0"
+	"LANEX\0"
+	"Collabo Tec. Co., Ltd.\0"
+	"COLLABO-TEC\0"
+	"Clearwater Networks\0"
+	"CLEARWATER-NETWORKS\0"
+	"RouteFree, Inc.\0"
+	"ROUTEFREE\0"
+	"Century Geophysical Corp.\0"
+	"CENTURY-GEOPHYSICAL\0"
+	"Audio Design Associates, Inc.\0"
+	"AUDIO-DESIGN-ASSOCIATES\0"
+	"Smartmedia LLC\0"
+	"SMARTMEDIA\0"
+	"iReady Corporation\0"
+	"IREADY\0"
+	"iREZ Technologies LLC\0"
+	"IREZ-TECHNOLOGIES\0"
+	"Keith & Koep GmbH\0"
+	"KEITH-KOEP\0"
+	"Valley Products Corporation\0"
+	"VALLEY-PRODUCTS\0"
+	"Industrial Indexing Systems, Inc.\0"
+	"INDUSTRIAL-INDEXING\0"
+	"Movaz Networks, Inc.\0"
+	"MOVAZ-NETWORKS\0"
+	"VHB Technologies, Inc.\0"
+	"VHB-TECHNOLOGIES\0"
+	"Steelcase Inc.\0"
+	"STEELCASE\0"
+	"KMS Systems, Inc.\0"
+	"KMS\0"
+	"Young Computer Co., Ltd.\0"
+	"YOUNG\0"
+	"Sysnet Co., Ltd.\0"
+	"SYSNET\0"
+	"Spectra Technologies Holding Co., Ltd.\0"
+	"SPECTRA-TECHNOLOGIES-HOLDING\0"
+	"Carl Baasel Lasertechnik GmbH\0"
+	"CARL-BAASEL-LASERTECHNIK\0"
+	"Foss NIRSystems, Inc.\0"
+	"FOSS-NIRSYSTEMS\0"
+	"Tecnint HTE SRL\0"
+	"TECNINT-HTE-SRL\0"
+	"Raven Industries Inc.\0"
+	"RAVEN-INDUSTRIES\0"
+	"GE Transportation Systems\0"
+	"GE-TRANSPORTATION\0"
+	"PIUSYS Co., Ltd.\0"
+	"PIUSYS\0"
+	"Kimmon Manufacturing Co., Ltd.\0"
+	"KIMMON-MANUFACTURING\0"
+	"Inducomp Corporation\0"
+	"INDUCOMP\0"
+	"Energy ICT\0"
+	"ENERGY-ICT\0"
+	"IPAXS Corporation\0"
+	"IPAXS\0"
+	"Corelatus A.B.\0"
+	"CORELATUS-A-B\0"
+	"LAUD Electronic Design AS\0"
+	"LAUD-DESIGN-AS\0"
+	"Million Tech Development Ltd.\0"
+	"MILLION-TECH-DEVELOPMENT\0"
+	"Green Hills Software, Inc.\0"
+	"GREEN-HILLS-SOFTWARE\0"
+	"Adescom Inc.\0"
+	"ADESCOM\0"
+	"Lumentis AB\0"
+	"LUMENTIS-AB\0"
+	"MATSUOKA\0"
+	"NewHer Systems\0"
+	"NEWHER\0"
+	"Balogh S.A.\0"
+	"BALOGH\0"
+	"ITK Dr. Kassen GmbH\0"
+	"ITK-DR-KASSEN\0"
+	"Quinx AG\0"
+	"QUINX\0"
+	"MarekMicro GmbH\0"
+	"MAREKMICRO\0"
+	"Photonic Bridges, Inc.\0"
+	"PHOTONIC-BRIDGES\0"
+	"Implementa GmbH\0"
+	"IMPLEMENTA\0"
+	"Unipower AB\0"
+	"UNIPOWER-AB\0"
+	"Perceptics Corp.\0"
+	"PERCEPTICS\0"
+	"QuesCom\0"
+	"QUESCOM\0"
+	"Endusis Limited\0"
+	"ENDUSIS\0"
+	"Compuworx\0"
+	"COMPUWORX\0"
+	"Ace Electronics, Inc.\0"
+	"ACE-ELECTRONICS\0"
+	"Quest Innovations\0"
+	"QUEST-INNOVATIONS\0"
+	"Vidco, Inc.\0"
+	"VIDCO\0"
+	"DSP Design, Ltd.\0"
+	"Wintegra Ltd.\0"
+	"WINTEGRA\0"
+	"Microbit 2.0 AB\0"
+	"MICROBIT-2-0-AB\0"
+	"Global Opto Communication Tech. Corp\0"
+	"GLOBAL-OPTO-COMMUNICATION-TECH\0"
+	"Teamaxess Ticketing GmbH\0"
+	"TEAMAXESS-TICKETING\0"
+	"Digital Vision AB\0"
+	"DIGITAL-VISION-AB\0"
+	"Stonefly Networks\0"
+	"STONEFLY-NETWORKS\0"
+	"Destiny Networks, Inc.\0"
+	"DESTINY-NETWORKS\0"
+	"Volvo Car Corporation\0"
+	"VOLVO-CAR\0"
+	"CSS Industrie Computer GmbH\0"
+	"CSS-INDUSTRIE\0"
+	"XStore, Inc.\0"
+	"XSTORE\0"
+	"COE Limited\0"
+	"COE\0"
+	"Diva Systems\0"
+	"Seranoa Networks, Inc.\0"
+	"SERANOA-NETWORKS\0"
+	"Tokai Soft Corporation\0"
+	"TOKAI-SOFT\0"
+	"Tecwings GmBh\0"
+	"TECWINGS\0"
+	"MaxLinear Hispania S.L.U.\0"
+	"MAXLINEAR-HISPANIA-S-L-U\0"
+	"TPA Traffic & Parking Automation BV\0"
+	"TPA-TRAFFIC-PARKING-AUTOMATION\0"
+	"Pycon, Inc.\0"
+	"PYCON\0"
+	"TTPCom Ltd.\0"
+	"TTPCOM\0"
+	"Symbolic Sound Corp.\0"
+	"SYMBOLIC-SOUND\0"
+	"Dong A Eltek Co., Ltd.\0"
+	"DONG-A-ELTEK\0"
+	"DELTA TAU DATA SYSTEMS, INC.\0"
+	"DELTA-TAU-DATA\0"
+	"Megisto Systems, Inc.\0"
+	"MEGISTO\0"
+	"RUNCOM\0"
+	"Haag-Streit AG\0"
+	"HAAG-STREIT\0"
+	"U.S. Traffic Corporation\0"
+	"U-S-TRAFFIC\0"
+	"InBus Engineering, Inc.\0"
+	"INBUS-ENGINEERING\0"
+	"Procon Electronics\0"
+	"PROCON-ELECTRONICS\0"
+	"ChipWrights, Inc.\0"
+	"CHIPWRIGHTS\0"
+	"DRS Photronics\0"
+	"DRS-PHOTRONICS\0"
+	"ELAD SRL\0"
+	"ELAD-SRL\0"
+	"Tensilica, Inc.\0"
+	"TENSILICA\0"
+	"Uniwell Systems (UK) Ltd.\0"
+	"UNIWELL-UK\0"
+	"Delphin Technology AG\0"
+	"DELPHIN\0"
+	"SR RESEARCH LTD\0"
+	"SR-RESEARCH\0"
+	"Tex Computer SRL\0"
+	"TEX-SRL\0"
+	"Vaisala Oyj\0"
+	"VAISALA-OYJ\0"
+	"NBG Industrial Automation B.V.\0"
+	"NBG-INDUSTRIAL-AUTOMATION-B-V\0"
+	"Formula One Management Ltd.\0"
+	"FORMULA-ONE-MANAGEMENT\0"
+	"AVerMedia Systems, Inc.\0"
+	"AVERMEDIA\0"
+	"Sentito Networks\0"
+	"SENTITO-NETWORKS\0"
+	"ITS, Inc.\0"
+	"ITS\0"
+	"Time Terminal Adductor Group AB\0"
+	"TIME-TERMINAL-ADDUCTOR-GROUP-AB\0"
+	"Instrumeter A/S\0"
+	"INSTRUMETER-A/S\0"
+	"AARTESYS AG\0"
+	"AARTESYS\0"
+	"Phytec Messtechnik GmbH\0"
+	"PHYTEC-MESSTECHNIK\0"
+	"ELC Lighting\0"
+	"ELC-LIGHTING\0"
+	"APCON, Inc.\0"
+	"APCON\0"
+	"UniSUR\0"
+	"UNISUR\0"
+	"Alltec GmbH\0"
+	"ALLTEC\0"
+	"DYCEC, S.A.\0"
+	"DYCEC\0"
+	"HECUBA Elektronik\0"
+	"HECUBA-ELEKTRONIK\0"
+	"Optibase Ltd.\0"
+	"OPTIBASE\0"
+	"wellink, Ltd.\0"
+	"WELLINK\0"
+	"Corinex Global\0"
+	"CORINEX-GLOBAL\0"
+	"Telephonics Corp.\0"
+	"TELEPHONICS\0"
+	"Torse\0"
+	"TORSE\0"
+	"Redux Communications Ltd.\0"
+	"REDUX-COMMUNICATION\0"
+	"AirVast Technology Inc.\0"
+	"AIRVAST\0"
+	"Advanced Devices SpA\0"
+	"ADVANCED-DEVICES-SPA\0"
+	"Jostra AB\0"
+	"JOSTRA-AB\0"
+	"Enea Real Time AB\0"
+	"ENEA-REAL-TIME-AB\0"
+	"CommServ Solutions Inc.\0"
+	"COMMSERV-SOLUTIONS\0"
+	"nCore, Inc.\0"
+	"NCORE\0"
+	"Communication Solutions, Inc.\0"
+	"COMMUNICATION-SOLUTIONS\0"
+	"Standard Comm. Corp.\0"
+	"STANDARD-COMM\0"
+	"Plextek Limited\0"
+	"PLEXTEK\0"
+	"Dune Networks\0"
+	"DUNE-NETWORKS\0"
+	"Aoptix Technologies\0"
+	"AOPTIX-TECHNOLOGIES\0"
+	"Cepheid\0"
+	"CEPHEID\0"
+	"Celite Systems, Inc.\0"
+	"CELITE\0"
+	"Pulsar GmbH\0"
+	"PULSAR\0"
+	"TTI - Telecom International Ltd.\0"
+	"TTI-TELECOM\0"
+	"J&B Engineering Group S.L.\0"
+	"J-B-ENGINEERING-GROUP\0"
+	"Teseda Corporation\0"
+	"TESEDA\0"
+	"Computerwise, Inc.\0"
+	"COMPUTERWISE\0"
+	"Acunia N.V.\0"
+	"ACUNIA-N-V\0"
+	"IPCAST\0"
+	"Infineer Ltd.\0"
+	"INFINEER\0"
+	"Precision Filters, Inc.\0"
+	"PRECISION-FILTERS\0"
+	"ExtremeSpeed Inc.\0"
+	"EXTREMESPEED\0"
+	"Nordson Corp.\0"
+	"NORDSON\0"
+	"Time Domain\0"
+	"TIME-DOMAIN\0"
+	"Masterclock, Inc.\0"
+	"MASTERCLOCK\0"
+	"Brijing Embedor Embedded Internet Tech. Co. Ltd.\0"
+	"BRIJING-EMBEDOR-EMBEDDED-INTERNET-TECH\0"
+	"Postec Data Systems Ltd.\0"
+	"POSTEC-DATA\0"
+	"PMC\0"
+	"Dickson Technologies\0"
+	"DICKSON-TECHNOLOGIES\0"
+	"Taishodo Seiko Co., Ltd.\0"
+	"TAISHODO-SEIKO\0"
+	"Quantronix, Inc.\0"
+	"QUANTRONIX\0"
+	"SAET I.S. S.r.l.\0"
+	"SAET-I-S\0"
+	"DeMeTec GmbH\0"
+	"DEMETEC\0"
+	"N&P Technologies\0"
+	"N-P-TECHNOLOGIES\0"
+	"Sei S.p.A.\0"
+	"SEI\0"
+	"Wavium AB\0"
+	"WAVIUM-AB\0"
+	"Unicoi Systems\0"
+	"UNICOI\0"
+	"Partner Voxstream A/S\0"
+	"PARTNER-VOXSTREAM-A/S\0"
+	"Verifiber LLC\0"
+	"VERIFIBER\0"
+	"WOLF Advanced Technology.\0"
+	"WOLF-ADVANCED\0"
+	"Broadstorm Telecom\0"
+	"BROADSTORM-TELECOM\0"
+	"Jeffress Engineering Pty Ltd\0"
+	"JEFFRESS-ENGINEERING-PTY\0"
+	"Cognex Corporation\0"
+	"COGNEX\0"
+	"Binary Wave Technologies Inc.\0"
+	"BINARY-WAVE-TECHNOLOGIES\0"
+	"PDQ Manufacturing\0"
+	"PDQ-MANUFACTURING\0"
+	"Zultys Technologies\0"
+	"ZULTYS-TECHNOLOGIES\0"
+	"Task 84 Spa\0"
+	"TASK-84-SPA\0"
+	"wolf-inf-tec\0"
+	"WOLF-INF-TEC\0"
+	"Mixbaal S.A. de C.V.\0"
+	"MIXBAAL-DE-C-V\0"
+	"H M Computing Limited\0"
+	"H-M-COMPUTING\0"
+	"Optical Wireless Link Inc.\0"
+	"OPTICAL-WIRELESS-LINK\0"
+	"Pantec Engineering AG\0"
+	"PANTEC-ENGINEERING\0"
+	"Cyan Technology Ltd\0"
+	"CYAN\0"
+	"dresden-elektronik\0"
+	"DRESDEN-ELEKTRONIK\0"
+	"CC Systems AB\0"
+	"CC-AB\0"
+	"Basler Electric Company\0"
+	"BASLER-ELECTRIC-COMPANY\0"
+	"Teradyne Inc.\0"
+	"TERADYNE\0"
+	"Technodrive srl\0"
+	"TECHNODRIVE-SRL\0"
+	"CCII Systems (Pty) Ltd\0"
+	"CCII-PTY\0"
+	"SPARR ELECTRONICS LTD\0"
+	"SPARR-ELECTRONICS\0"
+	"MATSUI MFG CO.,LTD\0"
+	"MATSUI-MFG\0"
+	"Goerlitz AG\0"
+	"GOERLITZ\0"
+	"Advanced Concepts, Inc.\0"
+	"ADVANCED-CONCEPTS\0"
+	"LaserBit Communications Corp.\0"
+	"LASERBIT-COMMUNICATION\0"
+	"Cominfo, Inc.\0"
+	"COMINFO\0"
+	"Momentum Data Systems\0"
+	"MOMENTUM-DATA\0"
+	"Netsynt Spa\0"
+	"NETSYNT-SPA\0"
+	"EPM Tecnologia e Equipamentos\0"
+	"EPM-TECNOLOGIA-E-EQUIPAMENTOS\0"
+	"PotsTek, Inc\0"
+	"POTSTEK\0"
+	"Survalent Technology Corporation\0"
+	"SURVALENT\0"
+	"AZIO TECHNOLOGY CO.\0"
+	"AZIO\0"
+	"Wilcoxon Research, Inc.\0"
+	"WILCOXON-RESEARCH\0"
+	"Artec Design\0"
+	"ARTEC-DESIGN\0"
+	"ELECTREX S.R.L\0"
+	"ELECTREX\0"
+	"Paltronics, Inc.\0"
+	"PALTRONICS\0"
+	"Fleetwood Electronics Ltd\0"
+	"FLEETWOOD-ELECTRONICS\0"
+	"SCA Data Systems\0"
+	"SCA-DATA\0"
+	"Portalplayer, Inc\0"
+	"PORTALPLAYER\0"
+	"ABB Switzerland Inc\0"
+	"ABB-SWITZERLAND\0"
+	"Tidel Engineering, L.P.\0"
+	"TIDEL-ENGINEERING-L-P\0"
+	"Protech Optronics Co. Ltd.\0"
+	"PROTECH-OPTRONICS\0"
+	"NORCO\0"
+	"RF Code\0"
+	"RF-CODE\0"
+	"Alpha Beta Technologies, Inc.\0"
+	"ALPHA-BETA-TECHNOLOGIES\0"
+	"ANOVA BROADBAND\0"
+	"ANOVA-BROADBAND\0"
+	"Axotec Technologies GmbH\0"
+	"AXOTEC-TECHNOLOGIES\0"
+	"BitBox Ltd\0"
+	"BITBOX\0"
+	"Streaming Networks\0"
+	"STREAMING-NETWORKS\0"
+	"Beckmann+Egle GmbH\0"
+	"BECKMANN+EGLE\0"
+	"Remia s.r.o.\0"
+	"REMIA-S-R-O\0"
+	"Home Director, Inc\0"
+	"HOME-DIRECTOR\0"
+	"PESA Inc.\0"
+	"PESA\0"
+	"BLANKOM Antennentechnik GmbH\0"
+	"BLANKOM-ANTENNENTECHNIK\0"
+	"Axes Technologies\0"
+	"AXES-TECHNOLOGIES\0"
+	"SIGOS Systemintegration GmbH\0"
+	"SIGOS-SYSTEMINTEGRATION\0"
+	"DSP DESIGN\0"
+	"DSP Group Inc.\0"
+	"DSP-GROUP\0"
+	"Thrane & Thrane A/S\0"
+	"THRANE-THRANE-A/S\0"
+	"DTS, Inc.\0"
+	"DTS\0"
+	"MosChip USA\0"
+	"MOSCHIP-USA\0"
+	"Electronic Systems Development\0"
+	"DEVELOPMENT\0"
+	"EmCom Technology Inc.\0"
+	"EMCOM\0"
+	"INTERZEAG AG\0"
+	"INTERZEAG\0"
+	"Email Metering\0"
+	"EMAIL-METERING\0"
+	"DINEC International\0"
+	"DINEC\0"
+	"AIOI Systems Co., Ltd.\0"
+	"AIOI\0"
+	"Sedia Electronics\0"
+	"SEDIA-ELECTRONICS\0"
+	"International Test & Engineering Services Co.,Ltd.\0"
+	"TEST-ENGINEERING-SERVICES\0"
+	"WillMonius Inc.\0"
+	"WILLMONIUS\0"
+	"InfinitiNetworks Inc.\0"
+	"INFINITINETWORKS\0"
+	"Weltronics Corp.\0"
+	"WELTRONICS\0"
+	"TT electronics plc\0"
+	"TT-ELECTRONICS-PLC\0"
+	"Palm Solutions Group\0"
+	"PALM-SOLUTIONS-GROUP\0"
+	"Flander Oy\0"
+	"FLANDER-OY\0"
+	"Remco Italia Spa\0"
+	"REMCO-ITALIA-SPA\0"
+	"TWIN DEVELOPMENT S.A.\0"
+	"TWIN-DEVELOPMENT\0"
+	"Euphony technology CO., LTD.\0"
+	"EUPHONY\0"
+	"modas GmbH\0"
+	"MODAS\0"
+	"EVER Sp. z o.o.\0"
+	"EVER-SP-Z-O-O\0"
+	"quantumBEAM Limited\0"
+	"QUANTUMBEAM\0"
+	"WaveIP\0"
+	"WAVEIP\0"
+	"INCAA Informatica Italia  srl\0"
+	"INCAA-INFORMATICA-ITALIA-SRL\0"
+	"Datatek Applications, Inc.\0"
+	"DATATEK-APPLICATIONS\0"
+	"LIFETIME MEMORY PRODUCTS, INC.\0"
+	"LIFETIME-MEMORY-PRODUCTS\0"
+	"Yazaki North America, Inc.\0"
+	"YAZAKI-NORTH-AMERICA\0"
+	"Benchmark Electronics\0"
+	"BENCHMARK-ELECTRONICS\0"
+	"Shenyang Internet Technology Inc\0"
+	"SHENYANG-INTERNET\0"
+	"Synopsys\0"
+	"SYNOPSYS\0"
+	"Phase IV Engineering Inc.\0"
+	"PHASE-IV-ENGINEERING\0"
+	"Redpoint Controls\0"
+	"REDPOINT-CONTROLS\0"
+	"shanghai trend intelligent systems CO.,LTD\0"
+	"SHANGHAI-TREND-INTELLIGENT\0"
+	"Pleora Technologies Inc.\0"
+	"PLEORA-TECHNOLOGIES\0"
+	"Guardian Controls International Ltd\0"
+	"GUARDIAN-CONTROLS\0"
+	"EDC\0"
+	"Applied Systems Engineering, Inc.\0"
+	"APPLIED-ENGINEERING\0"
+	"Imarda New Zealand Limited\0"
+	"IMARDA-NEW-ZEALAND\0"
+	"peiker acustic GmbH\0"
+	"PEIKER-ACUSTIC\0"
+	"ReliOn Inc.\0"
+	"RELION\0"
+	"Lulea University of Technology\0"
+	"LULEA-UNIVERSITY-OF\0"
+	"Automaatiotekniikka Seppo Saari Oy\0"
+	"AUTOMAATIOTEKNIIKKA-SEPPO-SAARI-OY\0"
+	"DIGITRONIC Automationsanlagen GmbH\0"
+	"DIGITRONIC-AUTOMATIONSANLAGEN\0"
+	"Bluesocket, Inc.\0"
+	"BLUESOCKET\0"
+	"Soronti, Inc.\0"
+	"SORONTI\0"
+	"DORLET SAU\0"
+	"DORLET-SAU\0"
+	"United Tri-Tech Corporation\0"
+	"UNITED-TRI-TECH\0"
+	"Smith Meter, Inc.\0"
+	"SMITH-METER\0"
+	"Metrotech\0"
+	"METROTECH\0"
+	"Ranch Networks\0"
+	"RANCH-NETWORKS\0"
+	"DAVE SRL\0"
+	"DAVE-SRL\0"
+	"Data Respons A/S\0"
+	"DATA-RESPONS-A/S\0"
+	"COSMO co.,ltd.\0"
+	"COSMO\0"
+	"EMKA-electronic AG\0"
+	"EMKA\0"
+	"Perto Periféricos de Automação S.A.\0"
+	"PERTO-PERIFRICOS-DE-AUTOMAO\0"
+	"M2 Technology Pty Ltd\0"
+	"M2-PTY\0"
+	"EXI Wireless Systems Inc.\0"
+	"EXI-WIRELESS\0"
+	"SKY Computers, Inc.\0"
+	"SKY-COMPUTERS\0"
+	"Tattile srl\0"
+	"TATTILE-SRL\0"
+	"Radionor Communications\0"
+	"RADIONOR-COMMUNICATION\0"
+	"Covia, Inc\0"
+	"COVIA\0"
+	"Abest Communication Corp.\0"
+	"ABEST-COMMUNICATION\0"
+	"BAE SYSTEMS Controls\0"
+	"BAE-CONTROLS\0"
+	"ARC'Créations\0"
+	"ARC-CRATIONS\0"
+	"ULTRACKER TECHNOLOGY\0"
+	"ULTRACKER\0"
+	"Fr. Sauter AG\0"
+	"FR-SAUTER\0"
+	"SP Controls, Inc\0"
+	"SP-CONTROLS\0"
+	"Willowglen Systems Inc.\0"
+	"WILLOWGLEN\0"
+	"EDD Srl\0"
+	"EDD-SRL\0"
+	"SouthWing S.L.\0"
+	"SOUTHWING\0"
+	"Safetran Traffic Systems Inc.\0"
+	"SAFETRAN-TRAFFIC\0"
+	"Product Design Dept., Sohwa Corporation\0"
+	"PRODUCT-DESIGN-DEPT-SOHWA\0"
+	"Whittier Mailing Products, Inc.\0"
+	"WHITTIER-MAILING-PRODUCTS\0"
+	"OlympusNDT\0"
+	"OLYMPUSNDT\0"
+	"Audio Riders Oy\0"
+	"AUDIO-RIDERS-OY\0"
+	"Vocality International Ltd\0"
+	"VOCALITY\0"
+	"Algodue Elettronica Srl\0"
+	"ALGODUE-ELETTRONICA-SRL\0"
+	"SystIng\0"
+	"SYSTING\0"
+	"Windmill Innovations\0"
+	"WINDMILL-INNOVATIONS\0"
+	"Solectron Ind.Com.Servs.Exportadora do Brasil Ltda.\0"
+	"SOLECTRON-IND-COM-SERVS-EXPORTADORA-DO-BRASIL-LTDA\0"
+	"nNovia, Inc.\0"
+	"NNOVIA\0"
+	"LK Ltd\0"
+	"LK\0"
+	"Ferrari electronic AG\0"
+	"FERRARI\0"
+	"Rafael\0"
+	"RAFAEL\0"
+	"Communication and Telemechanical Systems Company Limited\0"
+	"COMMUNICATION-AND-TELEMECHANICAL-COMPANY\0"
+	"Varisys Ltd\0"
+	"VARISYS\0"
+	"PYRAMID Computer GmbH\0"
+	"PYRAMID\0"
+	"OMICRON electronics GmbH\0"
+	"OMICRON-ELECTRONICS\0"
+	"Innovics Wireless Inc\0"
+	"INNOVICS-WIRELESS\0"
+	"Hochschule für Technik, Wirtschaft und Kultur Leipzig (FH)\0"
+	"HOCHSCHULE-FUER-TECHNIK-WIRTSCHAFT-UND-KULTUR-LEIPZIG-FH\0"
+	"4Links Limited\0"
+	"4LINKS\0"
+	"SysAware S.A.R.L.\0"
+	"SYSAWARE-R-L\0"
+	"Oshimi System Design Inc.\0"
+	"OSHIMI-SYSTEM-DESIGN\0"
+	"VoiceCom AG\0"
+	"VOICECOM\0"
+	"Level Control Systems\0"
+	"LEVEL-CONTROL\0"
+	"Linn Products Ltd\0"
+	"LINN-PRODUCTS\0"
+	"Nansen S. A. - Instrumentos de Precisão\0"
+	"NANSEN-S-A-INSTRUMENTOS-DE-PRECISO\0"
+	"Aeroflex GmbH\0"
+	"AEROFLEX\0"
+	"MST SYSTEMS LIMITED\0"
+	"MST\0"
+	"GD Mission Systems\0"
+	"GD-MISSION\0"
+	"Fracarro srl\0"
+	"FRACARRO-SRL\0"
+	"ESG Elektroniksystem u. Logistik GmbH\0"
+	"ESG-ELEKTRONIKSYSTEM-U-LOGISTIK\0"
+	"Applied Technologies Associates\0"
+	"APPLIED-TECHNOLOGIES-ASSOCIATES\0"
+	"Monitor Business Machines Ltd\0"
+	"Serveron Corporation\0"
+	"SERVERON\0"
+	"Getinge IT Solutions ApS\0"
+	"GETINGE-IT-SOLUTIONS-APS\0"
+	"imo-elektronik GmbH\0"
+	"IMO-ELEKTRONIK\0"
+	"visicontrol GmbH\0"
+	"VISICONTROL\0"
+	"PANNOCOM Ltd.\0"
+	"PANNOCOM\0"
+	"nVent, Schroff GmbH\0"
+	"NVENT-SCHROFF\0"
+	"Ross Video Limited\0"
+	"ROSS-VIDEO\0"
+	"Intelligent Photonics Control\0"
+	"INTELLIGENT-PHOTONICS-CONTROL\0"
+	"Intelligent Media Technologies, Inc.\0"
+	"INTELLIGENT-MEDIA-TECHNOLOGIES\0"
+	"eko systems inc.\0"
+	"EKO\0"
+	"Crescendo Networks\0"
+	"CRESCENDO-NETWORKS\0"
+	"Riegl Laser Measurement Systems GmbH\0"
+	"RIEGL-LASER-MEASUREMENT\0"
+	"Intrinsity\0"
+	"INTRINSITY\0"
+	"asetek Inc.\0"
+	"ASETEK\0"
+	"LORD INGENIERIE\0"
+	"LORD-INGENIERIE\0"
+	"HTEC Limited\0"
+	"HTEC\0"
+	"AutoTOOLS group Co. Ltd.\0"
+	"AUTOTOOLS-GROUP\0"
+	"Legra Systems, Inc.\0"
+	"LEGRA\0"
+	"SIMET\0"
+	"EdenTree Technologies, Inc.\0"
+	"EDENTREE-TECHNOLOGIES\0"
+	"Silverback Systems\0"
+	"SILVERBACK\0"
+	"POLIMAR ELEKTRONIK LTD.\0"
+	"POLIMAR-ELEKTRONIK\0"
+	"JLCooper Electronics\0"
+	"JLCOOPER-ELECTRONICS\0"
+	"Tandata Systems Ltd\0"
+	"TANDATA\0"
+	"Schwer+Kopka GmbH\0"
+	"SCHWER+KOPKA\0"
+	"Stins Coman\0"
+	"STINS-COMAN\0"
+	"Chantry Networks\0"
+	"CHANTRY-NETWORKS\0"
+	"Envara\0"
+	"ENVARA\0"
+	"Wheatstone Corporation\0"
+	"WHEATSTONE\0"
+	"Gauging Systems Inc\0"
+	"GAUGING\0"
+	"Kallastra Inc.\0"
+	"KALLASTRA\0"
+	"Halliburton - NUMAR\0"
+	"HALLIBURTON-NUMAR\0"
+	"Geoquip Ltd\0"
+	"GEOQUIP\0"
+	"Contronics Automacao Ltda\0"
+	"CONTRONICS-AUTOMACAO-LTDA\0"
+	"MDS SCIEX\0"
+	"MDS-SCIEX\0"
+	"RGB Spectrum\0"
+	"RGB-SPECTRUM\0"
+	"intec GmbH\0"
+	"INTEC\0"
+	"Hauppauge Computer Works, Inc.\0"
+	"HAUPPAUGE-WORKS\0"
+	"Hardmeier\0"
+	"HARDMEIER\0"
+	"Gradual Tecnologia Ltda.\0"
+	"GRADUAL-TECNOLOGIA-LTDA\0"
+	"Dixtal Biomedica Ind. Com. Ltda.\0"
+	"DIXTAL-BIOMEDICA-IND-COM-LTDA\0"
+	"Bender GmbH & Co. KG\0"
+	"BENDER\0"
+	"CDS Rail\0"
+	"CDS-RAIL\0"
+	"Azimuth Systems, Inc.\0"
+	"AZIMUTH\0"
+	"Supertel\0"
+	"SUPERTEL\0"
+	"Mettler Toledo\0"
+	"METTLER-TOLEDO\0"
+	"Scharff Weisberg Systems Integration Inc\0"
+	"SCHARFF-WEISBERG-INTEGRATION\0"
+	"Macronet s.r.l.\0"
+	"MACRONET\0"
+	"ACD Elektronik GmbH\0"
+	"ACD-ELEKTRONIK\0"
+	"DGT Sp. z o.o.\0"
+	"DGT-SP-Z-O-O\0"
+	"ads-tec GmbH\0"
+	"ADS-TEC\0"
+	"DSM-Messtechnik GmbH\0"
+	"DSM-MESSTECHNIK\0"
+	"Thales Communications Ltd\0"
+	"THALES-COMMUNICATION\0"
+	"STMicroelectronics SRL\0"
+	"STMICROELECTRONICS-SRL\0"
+	"Information Technology Corp.\0"
+	"INFORMATION\0"
+	"Digicast Networks\0"
+	"DIGICAST-NETWORKS\0"
+	"Spacesaver Corporation\0"
+	"SPACESAVER\0"
+	"Omicron Ceti AB\0"
+	"OMICRON-CETI-AB\0"
+	"Zendex Corporation\0"
+	"ZENDEX\0"
+	"Winford Engineering\0"
+	"WINFORD-ENGINEERING\0"
+	"Softhill Technologies Ltd.\0"
+	"SOFTHILL-TECHNOLOGIES\0"
+	"RDTECH\0"
+	"MITE Hradec Kralove, s.r.o.\0"
+	"MITE-HRADEC-KRALOVE-S-R-O\0"
+	"Albert Handtmann Maschinenfabrik GmbH&Co.KG\0"
+	"ALBERT-HANDTMANN-MASCHINENFABRIK\0"
+	"BIOTAGE\0"
+	"Tattile Srl\0"
+	"Shanghai Gaozhi Science&Technology Development Ltd.\0"
+	"SHANGHAI-GAOZHI-SCIENCE-DEVELOPMENT\0"
+	"Vansco Electronics Oy\0"
+	"VANSCO-ELECTRONICS-OY\0"
+	"Confidence Direct Ltd\0"
+	"CONFIDENCE-DIRECT\0"
+	"BELIK S.P.R.L.\0"
+	"BELIK-S-P-R-L\0"
+	"ATOM GIKEN Co.,Ltd.\0"
+	"ATOM-GIKEN\0"
+	"Allen Martin Conservation Ltd\0"
+	"ALLEN-MARTIN-CONSERVATION\0"
+	"Parabit Systems\0"
+	"PARABIT\0"
+	"Technisyst Pty Ltd\0"
+	"TECHNISYST-PTY\0"
+	"FG SYNERYS\0"
+	"FG-SYNERYS\0"
+	"Continental Gateway Limited\0"
+	"CONTINENTAL-GATEWAY\0"
+	"Crystal Vision Ltd\0"
+	"CRYSTAL-VISION\0"
+	"ZP Engineering SEL\0"
+	"ZP-ENGINEERING-SEL\0"
+	"Digital Recorders Inc\0"
+	"DIGITAL-RECORDERS\0"
+	"S4 Technology Pty Ltd\0"
+	"S4-PTY\0"
+	"VLSIP TECHNOLOGIES INC.\0"
+	"VLSIP-TECHNOLOGIES\0"
+	"Verex Technology\0"
+	"VEREX\0"
+	"Servicios Condumex, S. A. de C. V.\0"
+	"SERVICIOS-CONDUMEX-S-A-DE-C-V\0"
+	"Fundación TECNALIA Research & Innovation\0"
+	"FUNDACIN-TECNALIA-RESEARCH-INNOVATION\0"
+	"Extreme Engineering Solutions\0"
+	"EXTREME-ENGINEERING-SOLUTIONS\0"
+	"Tieline Research Pty Ltd\0"
+	"TIELINE-RESEARCH-PTY\0"
+	"T/R Systems, Inc.\0"
+	"T/R\0"
+	"Replicom Ltd.\0"
+	"REPLICOM\0"
+	"PATLITE Corporation\0"
+	"PATLITE\0"
+	"Maestro Pty Ltd\0"
+	"MAESTRO-PTY\0"
+	"LinkSecurity A/S\0"
+	"LINKSECURITY-A/S\0"
+	"Danlaw Inc\0"
+	"DANLAW\0"
+	"ALLIED TELESIS K.K.\0"
+	"ALLIED-TELESIS-K-K\0"
+	"AnaLogic Computers Ltd.\0"
+	"ANALOGIC-COMPUTERS\0"
+	"Air Broadband Communications, Inc.\0"
+	"AIR-BROADBAND-COMMUNICATION\0"
+	"AGECODAGIS SARL\0"
+	"AGECODAGIS-SARL\0"
+	"Cabtronix AG\0"
+	"CABTRONIX\0"
+	"Telvent\0"
+	"TELVENT\0"
+	"ANSITEX CORP.\0"
+	"ANSITEX\0"
+	"Micronet Ltd.\0"
+	"MICRONET\0"
+	"Littwin GmbH & Co KG\0"
+	"LITTWIN\0"
+	"ATEME\0"
+	"TECNEW Electronics Engineering Cr., Ltd.\0"
+	"TECNEW-ELECTRONICS-ENGINEERING-CR\0"
+	"RPM Systems Corporation\0"
+	"RPM\0"
+	"Rototype S.p.A.\0"
+	"ROTOTYPE\0"
+	"Real Time Systems\0"
+	"REAL-TIME\0"
+	"Orion Technologies,LLC\0"
+	"ORION-TECHNOLOGIES\0"
+	"Futaba Corporation\0"
+	"FUTABA\0"
+	"AXODE SA\0"
+	"AXODE\0"
+	"Spellman High Voltage Electronics Corp\0"
+	"SPELLMAN-HIGH-VOLTAGE-ELECTRONICS\0"
+	"EBNEURO SPA\0"
+	"EBNEURO-SPA\0"
+	"CHAUVIN ARNOUX\0"
+	"CHAUVIN-ARNOUX\0"
+	"AMIRIX Systems\0"
+	"AMIRIX\0"
+	"EPSa GmbH\0"
+	"EPSA\0"
+	"LOGOSOL, INC.\0"
+	"LOGOSOL\0"
+	"OpVista\0"
+	"OPVISTA\0"
+	"KINETICS\0"
+	"Harvad University\0"
+	"HARVAD-UNIVERSITY\0"
+	"Packet Techniques Inc.\0"
+	"PACKET-TECHNIQUES\0"
+	"2N TELEKOMUNIKACE a.s.\0"
+	"2N-TELEKOMUNIKACE\0"
+	"Globe Wireless\0"
+	"GLOBE-WIRELESS\0"
+	"SELEX Communications Ltd\0"
+	"SELEX-COMMUNICATION\0"
+	"Baudisch Electronic GmbH\0"
+	"BAUDISCH\0"
+	"Sterling Industry Consult GmbH\0"
+	"STERLING-INDUSTRY-CONSULT\0"
+	"Infinetix Corp\0"
+	"INFINETIX\0"
+	"Epelsa, SL\0"
+	"EPELSA-SL\0"
+	"West-Com Nurse Call Systems, Inc.\0"
+	"WEST-COM-NURSE-CALL\0"
+	"Xipher Embedded Networking\0"
+	"XIPHER-EMBEDDED-NETWORKING\0"
+	"Septier Communication Ltd\0"
+	"SEPTIER-COMMUNICATION\0"
+	"Brannstroms Elektronik AB\0"
+	"BRANNSTROMS-ELEKTRONIK-AB\0"
+	"Micro System Architecturing srl\0"
+	"MICRO-SYSTEM-ARCHITECTURING-SRL\0"
+	"DVTel Israel Ltd.\0"
+	"DVTEL-ISRAEL\0"
+	"Dr. Staiger, Mohilo + Co GmbH\0"
+	"DR-STAIGER-MOHILO\0"
+	"DEUTA Werke GmbH\0"
+	"DEUTA-WERKE\0"
+	"AUM Infotech Private Limited\0"
+	"AUM-INFOTECH-PRIVATE\0"
+	"BBI Engineering, Inc.\0"
+	"BBI-ENGINEERING\0"
+	"ABB T&D Spa\0"
+	"ABB-T-D-SPA\0"
+	"Quest Retail Technology Pty Ltd\0"
+	"QUEST-RETAIL-PTY\0"
+	"CSA  Computer & Antriebstechnik GmbH\0"
+	"CSA-ANTRIEBSTECHNIK\0"
+	"Telda Electronics\0"
+	"TELDA-ELECTRONICS\0"
+	"Smiths Detection\0"
+	"SMITHS-DETECTION\0"
+	"Embedded Systems Design\0"
+	"EMBEDDED-DESIGN\0"
+	"Polatis Ltd\0"
+	"POLATIS\0"
+	"Hobbes Computer Network Accessories\0"
+	"HOBBES-NETWORK-ACCESSORIES\0"
+	"Softier Inc.\0"
+	"SOFTIER\0"
+	"RAFI GmbH & Co.KG\0"
+	"RAFI\0"
+	"Admiral Secure Products, Ltd.\0"
+	"ADMIRAL-SECURE-PRODUCTS\0"
+	"Richmond Sound Design Ltd.\0"
+	"RICHMOND-SOUND-DESIGN\0"
+	"NORCO INDUSTRIAL TECHNOLOGY INC\0"
+	"NORCO-INDUSTRIAL\0"
+	"TA Instruments Ltd\0"
+	"TA-INSTRUMENTS\0"
+	"Uster Technologies AG\0"
+	"USTER-TECHNOLOGIES\0"
+	"StorLink Semi\0"
+	"STORLINK-SEMI\0"
+	"Lipowsky Industrie-Elektronik GmbH\0"
+	"LIPOWSKY-INDUSTRIE-ELEKTRONIK\0"
+	"PERAX\0"
+	"Magellan Technology Pty Limited\0"
+	"MAGELLAN-PTY\0"
+	"Stage Tec Entwicklungsgesellschaft für professionelle Audio\0"
+	"STAGE-TEC-ENTWICKLUNGSGESELLSCHAFT-FUER-PROFESSIONELLE-AUDIO\0"
+	"Smarteye Corporation\0"
+	"SMARTEYE\0"
+	"Digital SP Ltd\0"
+	"DIGITAL-SP\0"
+	"Invensys Energy Systens (NZ) Limited\0"
+	"INVENSYS-ENERGY-SYSTENS-NZ\0"
+	"Elman srl\0"
+	"ELMAN-SRL\0"
+	"Initial Electronic Security Systems\0"
+	"INITIAL-SECURITY\0"
+	"Siliquent Technologies Ltd\0"
+	"SILIQUENT-TECHNOLOGIES\0"
+	"SELCO\0"
+	"Roseman Engineering Ltd.\0"
+	"ROSEMAN-ENGINEERING\0"
+	"PUTERCOM CO., LTD\0"
+	"PUTERCOM\0"
+	"FACTS Engineering LLC\0"
+	"FACTS-ENGINEERING\0"
+	"EMBEDDED TOOLSMITHS\0"
+	"EMBEDDED-TOOLSMITHS\0"
+	"DataWind Research\0"
+	"DATAWIND-RESEARCH\0"
+	"Diseño de Sistemas en Silicio S.A.\0"
+	"DISEO-DE-SISTEMAS-EN-SILICIO\0"
+	"Worth Data, Inc.\0"
+	"WORTH-DATA\0"
+	"Miritek, Inc.\0"
+	"MIRITEK\0"
+	"AIRNET COMMUNICATIONS CORP\0"
+	"AIRNET-COMMUNICATION\0"
+	"Gerber Scientific Products, Inc.\0"
+	"GERBER-SCIENTIFIC-PRODUCTS\0"
+	"Integrated System Solution Corp.\0"
+	"INTEGRATED-SYSTEM-SOLUTION\0"
+	"PIXY AG\0"
+	"PIXY\0"
+	"WIS Technologies\0"
+	"WIS-TECHNOLOGIES\0"
+	"Neo Electronics Ltd\0"
+	"NEO-ELECTRONICS\0"
+	"SYN-TECH SYSTEMS INC\0"
+	"SYN-TECH\0"
+	"Wiener, Plein & Baus GmbH\0"
+	"WIENER-PLEIN-BAUS\0"
+	"Westek Technology Ltd\0"
+	"WESTEK\0"
+	"Research Applications\0"
+	"RESEARCH-APPLICATIONS\0"
+	"MICREL-NKE\0"
+	"Baxter International Inc\0"
+	"BAXTER\0"
+	"Access IS\0"
+	"ACCESS-IS\0"
+	"Ballard Technology, Inc,\0"
+	"BALLARD\0"
+	"MG Industrieelektronik GmbH\0"
+	"MG-INDUSTRIEELEKTRONIK\0"
+	"iamba LTD.\0"
+	"IAMBA\0"
+	"Transtech DSP\0"
+	"TRANSTECH-DSP\0"
+	"DALSA\0"
+	"SafeView, Inc.\0"
+	"SAFEVIEW\0"
+	"S.M.V. Systemelektronik GmbH\0"
+	"S-M-V-SYSTEMELEKTRONIK\0"
+	"SRI International\0"
+	"SRI\0"
+	"QUBIsoft S.r.l.\0"
+	"QUBISOFT\0"
+	"Lingg & Janke OHG\0"
+	"LINGG-JANKE-OHG\0"
+	"CHENGDU  BOOK DIGITAL CO., LTD\0"
+	"CHENGDU-BOOK-DIGITAL\0"
+	"4RF Communications Ltd\0"
+	"4RF-COMMUNICATION\0"
+	"SHF Communication Technologies AG\0"
+	"SHF-COMMUNICATION-TECHNOLOGIES\0"
+	"Profline B.V.\0"
+	"PROFLINE-B-V\0"
+	"LECO Corporation\0"
+	"LECO\0"
+	"Geometrics, Inc.\0"
+	"GEOMETRICS\0"
+	"Eurotek Srl\0"
+	"EUROTEK-SRL\0"
+	"Crossbow Technology, Inc.\0"
+	"CROSSBOW\0"
+	"Efficient Channel Coding\0"
+	"EFFICIENT-CHANNEL-CODING\0"
+	"ADChips\0"
+	"ADCHIPS\0"
+	"Clifford Chance LLP\0"
+	"CLIFFORD-CHANCE-LLP\0"
+	"GILLAM-FEI S.A.\0"
+	"GILLAM-FEI\0"
+	"SavvyCorp.com Ltd\0"
+	"SAVVYCORP-COM\0"
+	"Digilent Inc.\0"
+	"DIGILENT\0"
+	"Tornado Modular Systems\0"
+	"TORNADO-MODULAR\0"
+	"Arthur Industries Inc., dba On Hold Media Group\0"
+	"ARTHUR-INDUSTRIES-DBA-ON-HOLD-MEDIA-GROUP\0"
+	"Blackline Systems Corporation\0"
+	"BLACKLINE\0"
+	"American Microsystems, Ltd.\0"
+	"AMERICAN-MICROSYSTEMS\0"
+	"Saab AB\0"
+	"SAAB-AB\0"
+	"Patria Advanced Solutions\0"
+	"PATRIA-ADVANCED-SOLUTIONS\0"
+	"Soredex Instrumentarium Oyj\0"
+	"SOREDEX-INSTRUMENTARIUM-OYJ\0"
+	"Delphi Display Systems, Inc.\0"
+	"DELPHI-DISPLAY\0"
+	"EuroDesign embedded technologies GmbH\0"
+	"EURODESIGN-EMBEDDED-TECHNOLOGIES\0"
+	"CI Systems Ltd.\0"
+	"CI\0"
+	"COMERSON S.r.l.\0"
+	"COMERSON\0"
+	"Symbium Corporation\0"
+	"SYMBIUM\0"
+	"Noran Tel Communications Ltd.\0"
+	"NORAN-TEL-COMMUNICATION\0"
+	"UNIONDIGITAL.,CO.LTD\0"
+	"UNIONDIGITAL\0"
+	"FiveCo\0"
+	"FIVECO\0"
+	"Rackmaster Systems, Inc.\0"
+	"RACKMASTER\0"
+	"Innings Telecom Inc.\0"
+	"INNINGS-TELECOM\0"
+	"VX Technologies Inc.\0"
+	"VX-TECHNOLOGIES\0"
+	"TEAMLOG\0"
+	"SETARAM\0"
+	"Leviton Manufacturing Co., Inc\0"
+	"LEVITON-MANUFACTURING\0"
+	"Digicontrole Lda\0"
+	"DIGICONTROLE-LDA\0"
+	"CYBERTRON CO., LTD.\0"
+	"CYBERTRON\0"
+	"Comodo\0"
+	"COMODO\0"
+	"Dese Technologies SL\0"
+	"DESE-TECHNOLOGIES-SL\0"
+	"MicroBee Systems, Inc\0"
+	"MICROBEE\0"
+	"ifak system GmbH\0"
+	"IFAK-SYSTEM\0"
+	"Dataline AB\0"
+	"DATALINE-AB\0"
+	"Cosine Systems, Inc.\0"
+	"COSINE\0"
+	"Milmega Ltd\0"
+	"MILMEGA\0"
+	"Invatron Systems Corp.\0"
+	"INVATRON\0"
+	"Zodiak Data Systems\0"
+	"ZODIAK-DATA\0"
+	"Datacon\0"
+	"DATACON\0"
+	"AxyomCore Inc.\0"
+	"AXYOMCORE\0"
+	"C3-ilex, LLC\0"
+	"C3-ILEX\0"
+	"Geotech Instruments, LLC\0"
+	"GEOTECH-INSTRUMENTS\0"
+	"DTASENSOR S.p.A.\0"
+	"DTASENSOR\0"
+	"UXP\0"
+	"BQT Solutions (Australia) Limited\0"
+	"BQT-SOLUTIONS-AUSTRALIA\0"
+	"Red Rock Networks\0"
+	"RED-ROCK-NETWORKS\0"
+	"ODIXION\0"
+	"Federal Aviation Administration\0"
+	"FEDERAL-AVIATION-ADMINISTRATION\0"
+	"Navionics S.p.A.\0"
+	"NAVIONICS\0"
+	"Dornier GmbH\0"
+	"DORNIER\0"
+	"I.C.S. Electronics Limited\0"
+	"I-C-S-ELECTRONICS\0"
+	"Imax\0"
+	"IMAX\0"
+	"Digital Multimedia Technologies Spa\0"
+	"DIGITAL-MULTIMEDIA-TECHNOLOGIES-SPA\0"
+	"Integrated Silicon Solution (Taiwan), Inc.\0"
+	"INTEGRATED-SILICON-SOLUTION-TAIWAN\0"
+	"Consens Zeiterfassung GMBH\0"
+	"CONSENS-ZEITERFASSUNG\0"
+	"MANUSA-GEST, S.L.\0"
+	"MANUSA-GEST\0"
+	"PULTRONICS\0"
+	"Sicon srl\0"
+	"SICON-SRL\0"
+	"Broadcast Sports Inc\0"
+	"BROADCAST-SPORTS\0"
+	"PUNJAB COMMUNICATIONS LTD\0"
+	"PUNJAB-COMMUNICATION\0"
+	"Radix Corporation\0"
+	"RADIX\0"
+	"Picture Elements, Inc.\0"
+	"PICTURE-ELEMENTS\0"
+	"Nimcat Networks\0"
+	"NIMCAT-NETWORKS\0"
+	"Golden River Traffic\0"
+	"GOLDEN-RIVER-TRAFFIC\0"
+	"ETI\0"
+	"Ernitec A/S\0"
+	"ERNITEC-A/S\0"
+	"Secure Systems & Services\0"
+	"SECURE-SERVICES\0"
+	"United Telecoms Ltd\0"
+	"UNITED-TELECOMS\0"
+	"MultimediaLED\0"
+	"MULTIMEDIALED\0"
+	"SkipJam\0"
+	"SKIPJAM\0"
+	"CA Technology, Inc\0"
+	"CA\0"
+	"EXYS bvba\0"
+	"EXYS-BVBA\0"
+	"Virtu\0"
+	"VIRTU\0"
+	"Novx Systems\0"
+	"NOVX\0"
+	"St. Michael Strategies\0"
+	"ST-MICHAEL-STRATEGIES\0"
+	"ABB Xiamen Switchgear Co. Ltd.\0"
+	"ABB-XIAMEN-SWITCHGEAR\0"
+	"ACT\0"
+	"biokeysystem\0"
+	"BIOKEYSYSTEM\0"
+	"Row Seven Ltd\0"
+	"ROW-SEVEN\0"
+	"KoolSpan, Inc.\0"
+	"KOOLSPAN\0"
+	"SSI Schaefer Peem\0"
+	"SSI-SCHAEFER-PEEM\0"
+	"NIE Corporation\0"
+	"NIE\0"
+	"Ecutel Systems, Inc.\0"
+	"ECUTEL\0"
+	"Chuo Electric Works Co., LTD.\0"
+	"CHUO-ELECTRIC-WORKS\0"
+	"BMK professional electronics GmbH\0"
+	"BMK-PROFESSIONAL-ELECTRONICS\0"
+	"ABB Power Technologies S.p.A.  Unità  Operativa SACE (PTMV)\0"
+	"ABB-POWER-TECHNOLOGIES-S-P-A-UNIT-OPERATIVA-SACE-PTMV\0"
+	"North Pole Engineering, Inc.\0"
+	"NORTH-POLE-ENGINEERING\0"
+	"Kinesys Projects Limited\0"
+	"KINESYS-PROJECTS\0"
+	"Finesystem Co., Ltd\0"
+	"FINESYSTEM\0"
+	"LUCEO\0"
+	"Crossing Informationssysteme GmbH\0"
+	"CROSSING-INFORMATIONSSYSTEME\0"
+	"Advanced IP Communications\0"
+	"ADVANCED-IP-COMMUNICATION\0"
+	"IHM\0"
+	"Baytech Cinema\0"
+	"BAYTECH-CINEMA\0"
+	"Athena Semiconductor\0"
+	"ATHENA-SEMICONDUCTOR\0"
+	"ALCEA\0"
+	"Kramer Electronics Ltd.\0"
+	"KRAMER-ELECTRONICS\0"
+	"Advanced Si-Net Co., LTD.\0"
+	"ADVANCED-SI-NET\0"
+	"VLSIP TECHNOLOGIES, INC\0"
+	"Ratotec GmbH\0"
+	"RATOTEC\0"
+	"NetTest A/S\0"
+	"NETTEST-A/S\0"
+	"Jobin Yvon,Inc\0"
+	"JOBIN-YVON\0"
+	"F.Imm. S.r.L.\0"
+	"F-IMM\0"
+	"Digital Receiver Technology\0"
+	"DIGITAL-RECEIVER\0"
+	"Contec\0"
+	"CONTEC\0"
+	"AZD Praha s.r.o.\0"
+	"AZD-PRAHA-S-R-O\0"
+	"Septentrio nv/sa\0"
+	"SEPTENTRIO-NV/\0"
+	"VPG\0"
+	"Vanguard Technology Corp.\0"
+	"VANGUARD\0"
+	"CANMAX Technology Ltd.\0"
+	"CANMAX\0"
+	"ASPEL S.A.\0"
+	"ASPEL\0"
+	"Always On Wireless\0"
+	"ALWAYS-ON-WIRELESS\0"
+	"Optronic Partner pr AB\0"
+	"OPTRONIC-PARTNER-PR-AB\0"
+	"Minerva Technology Inc\0"
+	"MINERVA\0"
+	"RISCO Group\0"
+	"RISCO-GROUP\0"
+	"Oplink Communications\0"
+	"OPLINK-COMMUNICATION\0"
+	"Minicom Advanced Systems Ltd\0"
+	"MINICOM-ADVANCED\0"
+	"XIMEA s.r.o.\0"
+	"XIMEA-S-R-O\0"
+	"Europe Technologies\0"
+	"EUROPE-TECHNOLOGIES\0"
+	"DIGITAL ART SYSTEM\0"
+	"DIGITAL-ART-SYSTEM\0"
+	"ELV Elektronik AG\0"
+	"ELV-ELEKTRONIK\0"
+	"Companion Worlds, inc.\0"
+	"COMPANION-WORLDS\0"
+	"Owasys Advanced Wireless Devices\0"
+	"OWASYS-ADVANCED-WIRELESS-DEVICES\0"
+	"TIR Systems Ltd.\0"
+	"TIR\0"
+	"CLEODE\0"
+	"Xycom VME\0"
+	"XYCOM-VME\0"
+	"Daintree Networks Pty\0"
+	"DAINTREE-NETWORKS-PTY\0"
+	"Control LAN S.A.\0"
+	"CONTROL-LAN\0"
+	"IDA Corporation\0"
+	"IDA\0"
+	"Freescale Semiconductor\0"
+	"FREESCALE-SEMICONDUCTOR\0"
+	"MODIA SYSTEMS Co., Ltd\0"
+	"MODIA\0"
+	"VeroTrak Inc.\0"
+	"VEROTRAK\0"
+	"Ni.Co. S.r.l.\0"
+	"NI\0"
+	"Foresearch\0"
+	"FORESEARCH\0"
+	"EKE-Electronics Ltd.\0"
+	"EKE-ELECTRONICS\0"
+	"Realtime Engineering AG\0"
+	"REALTIME-ENGINEERING\0"
+	"Colorado vNet\0"
+	"COLORADO-VNET\0"
+	"ICS Electronics\0"
+	"ICS-ELECTRONICS\0"
+	"Wireless Reading Systems Holding ASA\0"
+	"WIRELESS-READING-HOLDING-ASA\0"
+	"SUNGJIN NEOTECH Co.Ltd.\0"
+	"SUNGJIN-NEOTECH\0"
+	"Precision System Science Co.,Ltd\0"
+	"PRECISION-SYSTEM-SCIENCE\0"
+	"Inoteska s.r.o.\0"
+	"INOTESKA-S-R-O\0"
+	"IEE Inc\0"
+	"IEE\0"
+	"Exavio Inc.\0"
+	"EXAVIO\0"
+	"Embedtronics Enterprise\0"
+	"EMBEDTRONICS\0"
+	"InterBridge,Inc.\0"
+	"INTERBRIDGE\0"
+	"EPSILON SRL\0"
+	"EPSILON-SRL\0"
+	"A&G Soluzioni Digitali\0"
+	"A-G-SOLUZIONI-DIGITALI\0"
+	"Nordic Alarm AB\0"
+	"NORDIC-ALARM-AB\0"
+	"TTC Telecom\0"
+	"TTC-TELECOM\0"
+	"TC Communications\0"
+	"TC-COMMUNICATION\0"
+	"Esensors, Inc.\0"
+	"ESENSORS\0"
+	"SYS TEC electronic GmbH\0"
+	"SYS-TEC\0"
+	"Embedit A/S\0"
+	"EMBEDIT-A/S\0"
+	"vidisys gmbh\0"
+	"VIDISYS\0"
+	"RapidWave Inc.\0"
+	"RAPIDWAVE\0"
+	"MANGO DSP Ltd.\0"
+	"MANGO-DSP\0"
+	"Inhand Electronics, Inc.\0"
+	"INHAND-ELECTRONICS\0"
+	"Advanced Micro Controls Inc.\0"
+	"ADVANCED-MICRO-CONTROLS\0"
+	"Optical Air Data Systems\0"
+	"OPTICAL-AIR-DATA\0"
+	"YUYAMA MFG Co.,Ltd\0"
+	"YUYAMA-MFG\0"
+	"TIYODA MFG CO.,LTD.\0"
+	"TIYODA-MFG\0"
+	"DigitalDeck, Inc.\0"
+	"DIGITALDECK\0"
+	"A.R.G ElectroDesign Ltd\0"
+	"A-R-G-ELECTRODESIGN\0"
+	"Isensix\0"
+	"ISENSIX\0"
+	"StreetFire Sound Labs, LLC\0"
+	"STREETFIRE-SOUND-LABS\0"
+	"Samsoft\0"
+	"SAMSOFT\0"
+	"Vegas Amusement\0"
+	"VEGAS-AMUSEMENT\0"
+	"Star Link Communication Pvt. Ltd.\0"
+	"STAR-LINK-COMMUNICATION-PVT\0"
+	"Silvertree Engineering Ltd\0"
+	"SILVERTREE-ENGINEERING\0"
+	"LabJack Corporation\0"
+	"LABJACK\0"
+	"IntelliDesign Pty Ltd\0"
+	"INTELLIDESIGN-PTY\0"
+	"Elektrotechnik & Elektronik Oltmann GmbH\0"
+	"ELEKTROTECHNIK-ELEKTRONIK-OLTMANN\0"
+	"Engim, Inc.\0"
+	"ENGIM\0"
+	"Westronic Systems Inc.\0"
+	"WESTRONIC\0"
+	"Networked Robotics Corporation\0"
+	"NETWORKED-ROBOTICS\0"
+	"taskit Rechnertechnik GmbH\0"
+	"TASKIT-RECHNERTECHNIK\0"
+	"InAccess Networks\0"
+	"INACCESS-NETWORKS\0"
+	"Spirent Communications (Scotland) Limited\0"
+	"SPIRENT-COMMUNICATION-SCOTLAND\0"
+	"Hankuk Tapi Computer Co., Ltd\0"
+	"HANKUK-TAPI\0"
+	"Norbit ODM AS\0"
+	"NORBIT-ODM-AS\0"
+	"Microtarget Tecnologia Digital Ltda.\0"
+	"MICROTARGET-TECNOLOGIA-DIGITAL-LTDA\0"
+	"Specstroy-Svyaz Ltd\0"
+	"SPECSTROY-SVYAZ\0"
+	"Tennessee Valley Authority\0"
+	"TENNESSEE-VALLEY-AUTHORITY\0"
+	"Media Lab., Inc.\0"
+	"MEDIA-LAB\0"
+	"Contrôle Analytique inc.\0"
+	"CONTRLE-ANALYTIQUE\0"
+	"NEC TOKIN Corporation\0"
+	"NEC-TOKIN\0"
+	"Arecont Vision\0"
+	"ARECONT-VISION\0"
+	"Mindspeed Technologies\0"
+	"MINDSPEED-TECHNOLOGIES\0"
+	"Gilbarco Autotank AB\0"
+	"GILBARCO-AUTOTANK-AB\0"
+	"IMAGO Technologies GmbH\0"
+	"IMAGO-TECHNOLOGIES\0"
+	"Tyzx, Inc.\0"
+	"TYZX\0"
+	"Bigbang L.T.D.\0"
+	"BIGBANG-L-T-D\0"
+	"Pauly Steuer- und Regelanlagen GmbH & Co. KG\0"
+	"PAULY-STEUER-UND-REGELANLAGEN\0"
+	"Audio Processing Technology Ltd\0"
+	"AUDIO-PROCESSING\0"
+	"EDA Industries Pte. Ltd\0"
+	"EDA-INDUSTRIES-PTE\0"
+	"MicroTek Electronics, Inc.\0"
+	"MICROTEK-ELECTRONICS\0"
+	"Casabyte Inc.\0"
+	"4g Technologies, L.P.\0"
+	"4G-TECHNOLOGIES-L-P\0"
+	"Sypris Electronics\0"
+	"SYPRIS-ELECTRONICS\0"
+	"Silicon Optix Canada Inc.\0"
+	"SILICON-OPTIX-CANADA\0"
+	"Net Optics\0"
+	"NET-OPTICS\0"
+	"Salent Technologies Ltd\0"
+	"SALENT-TECHNOLOGIES\0"
+	"Wheels of Zeus Inc.\0"
+	"WHEELS-OF-ZEUS\0"
+	"Dilax Intelcom AG\0"
+	"DILAX-INTELCOM\0"
+	"ABB Inc.\0"
+	"ABB\0"
+	"Analytica GmbH\0"
+	"ANALYTICA\0"
+	"Linkwell Telesystems Pvt Ltd\0"
+	"LINKWELL-TELESYSTEMS-PVT\0"
+	"Micro-Measurements\0"
+	"MICRO-MEASUREMENTS\0"
+	"Ward Leonard Electric Company\0"
+	"WARD-LEONARD-ELECTRIC-COMPANY\0"
+	"Technovare Systems, Inc.\0"
+	"TECHNOVARE\0"
+	"Micro-Robotics Limited\0"
+	"MICRO-ROBOTICS\0"
+	"Braintronics BV\0"
+	"BRAINTRONICS\0"
+	"Adilec Enginyeria SL\0"
+	"ADILEC-ENGINYERIA-SL\0"
+	"American LED-gible Inc.\0"
+	"AMERICAN-LED-GIBLE\0"
+	"Wisnu and Supak Co.,Ltd.\0"
+	"WISNU-AND-SUPAK\0"
+	"Fluke Biomedical, Radiation Management Services\0"
+	"FLUKE-BIOMEDICAL-RADIATION-MANAGEMENT-SERVICES\0"
+	"Comlab Inc.\0"
+	"COMLAB\0"
+	"TTC TELEKOMUNIKACE Ltd\0"
+	"TTC-TELEKOMUNIKACE\0"
+	"Key Systems , Inc.\0"
+	"KEY\0"
+	"Bavaria Digital Technik GmbH\0"
+	"BAVARIA-DIGITAL-TECHNIK\0"
+	"M5 Data Limited\0"
+	"M5-DATA\0"
+	"Osmetech Inc.\0"
+	"OSMETECH\0"
+	"3D perception AS\0"
+	"3D-PERCEPTION-AS\0"
+	"ELMIC GmbH\0"
+	"ELMIC\0"
+	"BiODE Inc.\0"
+	"BIODE\0"
+	"Oy Stinghorn Ltd\0"
+	"OY-STINGHORN\0"
+	"NeuLion Incorporated\0"
+	"NEULION-INCORPORATED\0"
+	"SysNova\0"
+	"SYSNOVA\0"
+	"CSIRO - Division of Exploration and Mining\0"
+	"CSIRO-DIVISION-OF-EXPLORATION-AND-MINING\0"
+	"CUE, a.s.\0"
+	"CUE\0"
+	"Vacon Plc\0"
+	"VACON-PLC\0"
+	"CRDE\0"
+	"Revolution Education Ltd\0"
+	"REVOLUTION-EDUCATION\0"
+	"Conformative Systems, Inc.\0"
+	"CONFORMATIVE\0"
+	"MedAvant Healthcare\0"
+	"MEDAVANT-HEALTHCARE\0"
+	"Alro Information Systems SA\0"
+	"ALRO-INFORMATION\0"
+	"ISS International\0"
+	"ISS\0"
+	"Teneros\0"
+	"TENEROS\0"
+	"The Board Room Inc.\0"
+	"THE-BOARD-ROOM\0"
+	"Commoca, Inc\0"
+	"COMMOCA\0"
+	"PAT Industries, DBA Pacific Advanced Technology\0"
+	"PAT-INDUSTRIES-DBA-PACIFIC-ADVANCED\0"
+	"megatec electronic GmbH\0"
+	"MEGATEC\0"
+	"Salland Electronics Holding BV\0"
+	"SALLAND-ELECTRONICS-HOLDING\0"
+	"STL GmbH\0"
+	"STL\0"
+	"Hitachi Energy Germany AG\0"
+	"HITACHI-ENERGY-GERMANY\0"
+	"MC TECHNOLOGY GmbH\0"
+	"MC\0"
+	"Phaedrus Limited\0"
+	"PHAEDRUS\0"
+	"dAFTdATA Limited\0"
+	"DAFTDATA\0"
+	"Advantage R&D\0"
+	"ADVANTAGE-R-D\0"
+	"Superna Ltd\0"
+	"SUPERNA\0"
+	"Sintium Ltd\0"
+	"SINTIUM\0"
+	"Tumsan\0"
+	"TUMSAN\0"
+	"Weinberger Deutschland GmbH\0"
+	"WEINBERGER-DEUTSCHLAND\0"
+	"HARTMANN software GbR\0"
+	"HARTMANN-SOFTWARE-GBR\0"
+	"HaiVision Systems Inc\0"
+	"HAIVISION\0"
+	"Cast Iron Systems\0"
+	"CAST-IRON\0"
+	"SmartMotor AS\0"
+	"SMARTMOTOR-AS\0"
+	"Promess Incorporated\0"
+	"PROMESS-INCORPORATED\0"
+	"Numeron Sp. z o.o.\0"
+	"NUMERON-SP-Z-O-O\0"
+	"Rohde&Schwarz Topex SA\0"
+	"ROHDE-SCHWARZ-TOPEX\0"
+	"NanShanBridge Co.Ltd\0"
+	"NANSHANBRIDGE\0"
+	"Guralp Systems Limited\0"
+	"GURALP\0"
+	"CoreStreet, Ltd\0"
+	"CORESTREET\0"
+	"AIE Etudes\0"
+	"AIE-ETUDES\0"
+	"TERN, Inc.\0"
+	"TERN\0"
+	"KTEC LTD\0"
+	"KTEC\0"
+	"Contec Steuerungstechnik & Automation GmbH\0"
+	"CONTEC-STEUERUNGSTECHNIK-AUTOMATION\0"
+	"Center VOSPI JSC\0"
+	"CENTER-VOSPI-JSC\0"
+	"Applied Materials UK Ltd\0"
+	"APPLIED-MATERIALS-UK\0"
+	"Afonics Fibreoptics Ltd\0"
+	"AFONICS-FIBREOPTICS\0"
+	"BIR,INC.\0"
+	"BIR\0"
+	"Multimessage Systems Ltd.\0"
+	"MULTIMESSAGE\0"
+	"TSB Solutions Inc.\0"
+	"TSB-SOLUTIONS\0"
+	"Goodrich\0"
+	"GOODRICH\0"
+	"Talleres de Escoriaza SA\0"
+	"TALLERES-DE-ESCORIAZA\0"
+	"SensoTech GmbH\0"
+	"SENSOTECH\0"
+	"SELCO s.r.l.\0"
+	"QT systems ab\0"
+	"QT-AB\0"
+	"Planea Oy\0"
+	"PLANEA-OY\0"
+	"Mecsel Oy\0"
+	"MECSEL-OY\0"
+	"Bluewater Systems Ltd\0"
+	"BLUEWATER\0"
+	"LogiM GmbH Software und Entwicklung\0"
+	"LOGIM-SOFTWARE-UND-ENTWICKLUNG\0"
+	"Infrasafe, Inc.\0"
+	"INFRASAFE\0"
+	"Altronic, Inc.\0"
+	"ALTRONIC\0"
+	"Videotek Sistemas Eletronicos Ltda.\0"
+	"VIDEOTEK-SISTEMAS-ELETRONICOS-LTDA\0"
+	"Avionica, Inc\0"
+	"AVIONICA\0"
+	"Boundless Technologies\0"
+	"BOUNDLESS-TECHNOLOGIES\0"
+	"EFSYS\0"
+	"Power-One Inc.\0"
+	"POWER-ONE\0"
+	"Metrolab Technology SA\0"
+	"METROLAB\0"
+	"Pinnacle Technology\0"
+	"PINNACLE\0"
+	"STOM System\0"
+	"STOM-SYSTEM\0"
+	"Scheidt & Bachmann GmbH\0"
+	"SCHEIDT-BACHMANN\0"
+	"Roxar A/S\0"
+	"ROXAR-A/S\0"
+	"Matthews Australasia\0"
+	"MATTHEWS-AUSTRALASIA\0"
+	"VLSIP TECHNOLOGIES, INC.\0"
+	"Trapeze Software Group Inc\0"
+	"TRAPEZE-SOFTWARE-GROUP\0"
+	"Argo-Tech\0"
+	"ARGO-TECH\0"
+	"Oelmann Elektronik GmbH\0"
+	"OELMANN-ELEKTRONIK\0"
+	"Win4NET\0"
+	"WIN4NET\0"
+	"Arcom Digital\0"
+	"ARCOM-DIGITAL\0"
+	"Octatron, Inc.\0"
+	"OCTATRON\0"
+	"Topway Industries Ltd.\0"
+	"TOPWAY-INDUSTRIES\0"
+	"Idetech Europe S.A.\0"
+	"IDETECH-EUROPE\0"
+	"ImperativeNetworks\0"
+	"IMPERATIVENETWORKS\0"
+	"ADATEL TELECOMUNICACIONES S.A.\0"
+	"ADATEL-TELECOMUNICACIONES\0"
+	"Satellite Services BV\0"
+	"SATELLITE-SERVICES\0"
+	"PowerWAN, Inc\0"
+	"POWERWAN\0"
+	"Telecom Protection Technologies Limited\0"
+	"TELECOM-PROTECTION-TECHNOLOGIES\0"
+	"Peleton Photonic Systems\0"
+	"PELETON-PHOTONIC\0"
+	"ProDesign GmbH\0"
+	"PRODESIGN\0"
+	"A3IP\0"
+	"Ducommun LaBarge Technologies, Inc\0"
+	"DUCOMMUN-LABARGE-TECHNOLOGIES\0"
+	"Ann Arbor Sensor Systems LLC\0"
+	"ANN-ARBOR-SENSOR\0"
+	"Coppercom\0"
+	"COPPERCOM\0"
+	"ARVOO Imaging Products BV\0"
+	"ARVOO-IMAGING-PRODUCTS\0"
+	"Advanced Modular Computers Ltd.\0"
+	"ADVANCED-MODULAR-COMPUTERS\0"
+	"Sammi Information Systems Co.,Ltd\0"
+	"SAMMI-INFORMATION\0"
+	"Pico Computing, Inc.\0"
+	"PICO-COMPUTING\0"
+	"Pickering Laboratories\0"
+	"PICKERING-LABORATORIES\0"
+	"Offshore Systems Ltd\0"
+	"OFFSHORE\0"
+	"MICRONIC s.r.o.\0"
+	"MICRONIC-S-R-O\0"
+	"Micro Technic A-S\0"
+	"MICRO-TECHNIC\0"
+	"Grupo Epelsa S.L.\0"
+	"GRUPO-EPELSA\0"
+	"Comtech Systems Inc.\0"
+	"COMTECH\0"
+	"BLEILE DATENTECHNIK GmbH\0"
+	"BLEILE-DATENTECHNIK\0"
+	"Elettronica Santerno SpA\0"
+	"ELETTRONICA-SANTERNO-SPA\0"
+	"Solace Systems, Inc.\0"
+	"SOLACE\0"
+	"Computime Systems UK Ltd.\0"
+	"COMPUTIME-UK\0"
+	"Electro-Matic Products, Inc.\0"
+	"ELECTRO-MATIC-PRODUCTS\0"
+	"QQ Technology,Inc\0"
+	"QQ\0"
+	"kippdata GmbH\0"
+	"KIPPDATA\0"
+	"Enconair Ecological Chambers Inc.\0"
+	"ENCONAIR-ECOLOGICAL-CHAMBERS\0"
+	"HAMEG GmbH\0"
+	"HAMEG\0"
+	"Scame Sistemi srl\0"
+	"SCAME-SISTEMI-SRL\0"
+	"Erhardt+Leimer GmbH\0"
+	"ERHARDT+LEIMER\0"
+	"Brivo Systems, LLC\0"
+	"BRIVO\0"
+	"Gogo BA\0"
+	"GOGO-BA\0"
+	"DRDC Valcartier\0"
+	"DRDC-VALCARTIER\0"
+	"Danbridge\0"
+	"DANBRIDGE\0"
+	"HRZ data GmbH\0"
+	"HRZ-DATA\0"
+	"Funkwerk plettac electronic GmbH\0"
+	"FUNKWERK-PLETTAC\0"
+	"Matra Electronique\0"
+	"MATRA-ELECTRONIQUE\0"
+	"Deister Electronic GmbH\0"
+	"DEISTER\0"
+	"Digital Engineering, Inc.\0"
+	"DIGITAL-ENGINEERING\0"
+	"Halliburton - Sperry Drilling Service\0"
+	"HALLIBURTON-SPERRY-DRILLING-SERVICE\0"
+	"T2C Marketing AB\0"
+	"T2C-MARKETING-AB\0"
+	"Vitelnet\0"
+	"VITELNET\0"
+	"TATTILE SRL\0"
+	"CT Company\0"
+	"CT-COMPANY\0"
+	"Codem Systems, Inc.\0"
+	"CODEM\0"
+	"XYTAC system technologies\0"
+	"XYTAC-SYSTEM-TECHNOLOGIES\0"
+	"PDTS GmbH\0"
+	"PDTS\0"
+	"LONAP Limited\0"
+	"LONAP\0"
+	"United Western Technologies\0"
+	"UNITED-WESTERN-TECHNOLOGIES\0"
+	"Network I/O\0"
+	"NETWORK-I/O\0"
+	"Bipom Electronics, Inc.\0"
+	"BIPOM-ELECTRONICS\0"
+	"ISE GmbH\0"
+	"ISE\0"
+	"EASYTECH GmbH\0"
+	"EASYTECH\0"
+	"CAMCO GmbH\0"
+	"CAMCO\0"
+	"Paul Scherrer Institut (PSI)\0"
+	"PAUL-SCHERRER-INSTITUT-PSI\0"
+	"Avenir Technologies Inc.\0"
+	"AVENIR-TECHNOLOGIES\0"
+	"Neuroware\0"
+	"NEUROWARE\0"
+	"Cybectec inc.\0"
+	"Pixtree Technologies, inc.\0"
+	"PIXTREE-TECHNOLOGIES\0"
+	"KOP Ltd\0"
+	"KOP\0"
+	"Sensus Metering Systems Israel\0"
+	"SENSUS-METERING-ISRAEL\0"
+	"Venue 1, Inc.\0"
+	"VENUE-1\0"
+	"ISEPOS GmbH\0"
+	"ISEPOS\0"
+	"Ascon S.p.a.\0"
+	"ASCON\0"
+	"SEV Tidsystem AB\0"
+	"SEV-TIDSYSTEM-AB\0"
+	"Metafix Inc.\0"
+	"METAFIX\0"
+	"Unlimited Bandwidth LLC\0"
+	"UNLIMITED-BANDWIDTH\0"
+	"Pitney Bowes, Inc\0"
+	"PITNEY-BOWES\0"
+	"AUCONET GmbH\0"
+	"AUCONET\0"
+	"WIT Inc\0"
+	"WIT\0"
+	"Energie Umwelt Systemtechnik GmbH\0"
+	"ENERGIE-UMWELT-SYSTEMTECHNIK\0"
+	"BRIT Inc.\0"
+	"BRIT\0"
+	"SELKOM GmbH\0"
+	"SELKOM\0"
+	"Computer Sciences Corp\0"
+	"SCIENCES\0"
+	"PRIAMUS SYSTEM TECHNOLOGIES AG\0"
+	"PRIAMUS-SYSTEM-TECHNOLOGIES\0"
+	"SES\0"
+	"Kooltech LLC\0"
+	"KOOLTECH\0"
+	"Safegate International AB\0"
+	"SAFEGATE-AB\0"
+	"Eridon Corporation\0"
+	"ERIDON\0"
+	"DA SISTEMI SPA\0"
+	"DA-SISTEMI-SPA\0"
+	"EREE Electronique\0"
+	"EREE-ELECTRONIQUE\0"
+	"Mobile Matrix, Inc.\0"
+	"MOBILE-MATRIX\0"
+	"UNITON AG\0"
+	"UNITON\0"
+	"Metron Sp. z o.o.\0"
+	"METRON-SP-Z-O-O\0"
+	"Teledyne Tekmar\0"
+	"TELEDYNE-TEKMAR\0"
+	"DENGYOSHA co.,LTD.\0"
+	"DENGYOSHA\0"
+	"Cloanto Corporation\0"
+	"CLOANTO\0"
+	"TRAFSYS AS\0"
+	"TRAFSYS-AS\0"
+	"Artis GmbH\0"
+	"ARTIS\0"
+	"Ultimate Technology, Inc.\0"
+	"ULTIMATE\0"
+	"VAZA Elektronik AB\0"
+	"VAZA-ELEKTRONIK-AB\0"
+	"Acutelogic Corporation\0"
+	"ACUTELOGIC\0"
+	"Advanced Driver Information Technology GmbH\0"
+	"ADVANCED-DRIVER-INFORMATION\0"
+	"Quartet Technology, Inc.\0"
+	"QUARTET\0"
+	"Trellia Networks\0"
+	"TRELLIA-NETWORKS\0"
+	"TelASIC Communications, Inc.\0"
+	"TELASIC-COMMUNICATION\0"
+	"vg controls, inc\0"
+	"VG-CONTROLS\0"
+	"Envisacor Technologies Inc.\0"
+	"ENVISACOR-TECHNOLOGIES\0"
+	"Critical Link LLC\0"
+	"CRITICAL-LINK\0"
+	"Armorlink Co .Ltd\0"
+	"ARMORLINK\0"
+	"GCS, Inc\0"
+	"GCS\0"
+	"Advanced technologies & Engineering (pty) Ltd\0"
+	"ADVANCED-TECHNOLOGIES-ENGINEERING-PTY\0"
+	"SPECS GmbH\0"
+	"SPECS\0"
+	"Protium Technologies, Inc.\0"
+	"PROTIUM-TECHNOLOGIES\0"
+	"IEEE P1609 WG\0"
+	"IEEE-P1609-WG\0"
+	"Teledyne Monitor Labs\0"
+	"TELEDYNE-MONITOR-LABS\0"
+	"BUYANG ELECTRONICS INDUSTRIAL CO., LTD.\0"
+	"BUYANG-ELECTRONICS-INDUSTRIAL\0"
+	"iseg Spezialelektronik GmbH\0"
+	"ISEG-SPEZIALELEKTRONIK\0"
+	"CYJAYA Korea\0"
+	"CYJAYA-KOREA\0"
+	"Faber Electronics BV\0"
+	"FABER-ELECTRONICS\0"
+	"HEINEN ELEKTRONIK GmbH\0"
+	"HEINEN-ELEKTRONIK\0"
+	"JVF Communications Ltd\0"
+	"JVF-COMMUNICATION\0"
+	"Doramu Co.,Ltd.\0"
+	"DORAMU\0"
+	"OpenPeak, Inc.\0"
+	"OPENPEAK\0"
+	"Orbis Oy\0"
+	"ORBIS-OY\0"
+	"Esmart Distribution Pte Ltd\0"
+	"ESMART-DISTRIBUTION-PTE\0"
+	"NSFOCUS Information Technology Co., Ltd.\0"
+	"NSFOCUS-INFORMATION\0"
+	"TESLA, a.s.\0"
+	"TESLA\0"
+	"ANSA Corporation\0"
+	"ANSA\0"
+	"Matrix Audio Designs\0"
+	"MATRIX-AUDIO-DESIGNS\0"
+	"Valley Tecnologia\0"
+	"VALLEY-TECNOLOGIA\0"
+	"General Resources Co., LTD.\0"
+	"GENERAL-RESOURCES\0"
+	"Shenzhen Hongdian Technologies.,Ltd\0"
+	"SHENZHEN-HONGDIAN-TECHNOLOGIES\0"
+	"Rose Technologies\0"
+	"ROSE-TECHNOLOGIES\0"
+	"Mistletoe Technologies\0"
+	"MISTLETOE-TECHNOLOGIES\0"
+	"Protonic Holland\0"
+	"PROTONIC-HOLLAND\0"
+	"Saia Burgess Controls AG\0"
+	"Argon ST\0"
+	"ARGON-ST\0"
+	"Digital Dynamics, Inc.\0"
+	"DIGITAL-DYNAMICS\0"
+	"Westinghouse Rail Systems Ltd\0"
+	"WESTINGHOUSE-RAIL\0"
+	"Bio-logic Systems Corp\0"
+	"BIO-LOGIC\0"
+	"Quantum3D, Inc.\0"
+	"QUANTUM3D\0"
+	"Black Diamond Video, Inc.\0"
+	"BLACK-DIAMOND-VIDEO\0"
+	"eXray Broadband Inc.\0"
+	"EXRAY-BROADBAND\0"
+	"Rubin Ltd.\0"
+	"RUBIN\0"
+	"Transbit Sp.z o.o.\0"
+	"TRANSBIT-SP-Z-O-O\0"
+	"Neets\0"
+	"NEETS\0"
+	"Scirocco AB\0"
+	"SCIROCCO-AB\0"
+	"Yarg Biometrics Limited\0"
+	"YARG-BIOMETRICS\0"
+	"Verint Systems Ltd\0"
+	"VERINT\0"
+	"ImpediMed Limited\0"
+	"IMPEDIMED\0"
+	"Securiton AG\0"
+	"SECURITON\0"
+	"Open Date Equipment Limited\0"
+	"OPEN-DATE-EQUIPMENT\0"
+	"Ziehl-Abegg AG\0"
+	"ZIEHL-ABEGG\0"
+	"RCS Energy Management Ltd\0"
+	"RCS-ENERGY-MANAGEMENT\0"
+	"SLICAN sp. z o.o.\0"
+	"SLICAN-SP-Z-O-O\0"
+	"Twoway CATV SERVICE INC.\0"
+	"TWOWAY-CATV-SERVICE\0"
+	"ELPROC sp. z o.o.\0"
+	"ELPROC-SP-Z-O-O\0"
+	"Herholdt Controls srl\0"
+	"HERHOLDT-CONTROLS-SRL\0"
+	"SEBA Design Pty Ltd\0"
+	"SEBA-DESIGN-PTY\0"
+	"Ingenieurbüro Schober\0"
+	"INGENIEURBUERO-SCHOBER\0"
+	"Avantry Ltd.\0"
+	"AVANTRY\0"
+	"GE Security Kampro\0"
+	"GE-SECURITY-KAMPRO\0"
+	"MEDIORNET GmbH\0"
+	"MEDIORNET\0"
+	"Alfing Montagetechnik GmbH\0"
+	"ALFING-MONTAGETECHNIK\0"
+	"Truteq Wireless (PTY) Ltd.\0"
+	"TRUTEQ-WIRELESS-PTY\0"
+	"Thermo Electron\0"
+	"THERMO-ELECTRON\0"
+	"Telematrix\0"
+	"TELEMATRIX\0"
+	"SS Telecoms CC\0"
+	"SS-TELECOMS-CC\0"
+	"Applied Research Laboratories: UT\0"
+	"APPLIED-RESEARCH-LABORATORIES:-UT\0"
+	"Romteck Pty Ltd\0"
+	"ROMTECK-PTY\0"
+	"Embigence GmbH\0"
+	"EMBIGENCE\0"
+	"Sedo Systems Ltd\0"
+	"SEDO\0"
+	"Photonic Bridges  Inc.\0"
+	"Computerized Elevator Contol\0"
+	"COMPUTERIZED-ELEVATOR-CONTOL\0"
+	"SATEL sp. z o.o.\0"
+	"SATEL-SP-Z-O-O\0"
+	"Seachange international\0"
+	"SEACHANGE\0"
+	"Mandozzi Elettronica SA\0"
+	"MANDOZZI-ELETTRONICA\0"
+	"Thales Defence and Security Systems GmbH\0"
+	"THALES-DEFENCE-AND-SECURITY\0"
+	"Lab X Technologies, LLC\0"
+	"LAB-X-TECHNOLOGIES\0"
+	"Beijing Corelogic Communication Co., Ltd.\0"
+	"BEIJING-CORELOGIC-COMMUNICATION\0"
+	"Creative Retail Entertainment\0"
+	"CREATIVE-RETAIL-ENTERTAINMENT\0"
+	"Packet Island Inc.\0"
+	"PACKET-ISLAND\0"
+	"Tantronic AG\0"
+	"TANTRONIC\0"
+	"Autronica Fire And Securirty\0"
+	"AUTRONICA-FIRE-AND-SECURIRTY\0"
+	"O2RUN\0"
+	"Monroe Electronics, Inc.\0"
+	"MONROE-ELECTRONICS\0"
+	"RealD, Inc.\0"
+	"REALD\0"
+	"Prodco International Inc.\0"
+	"PRODCO\0"
+	"RTDS Technologies Inc.\0"
+	"RTDS-TECHNOLOGIES\0"
+	"Cambridge Technology, Inc.\0"
+	"CAMBRIDGE\0"
+	"BES Technology Group\0"
+	"BES-GROUP\0"
+	"Hwayoung RF Solution Inc\0"
+	"HWAYOUNG-RF-SOLUTION\0"
+	"Network Automation mxc AB\0"
+	"NETWORK-AUTOMATION-MXC-AB\0"
+	"GEM ELETTRONICA Srl\0"
+	"GEM-ELETTRONICA-SRL\0"
+	"Dakty GmbH\0"
+	"DAKTY\0"
+	"Orenco Systems, Inc.\0"
+	"ORENCO\0"
+	"IBEX UK Limited\0"
+	"IBEX-UK\0"
+	"Criterion Systems Limited\0"
+	"CRITERION\0"
+	"RESPIRONICS INC.\0"
+	"RESPIRONICS\0"
+	"Aphex Systems Ltd.\0"
+	"APHEX\0"
+	"7+ Kft\0"
+	"7+-KFT\0"
+	"Micro Connect Pty Ltd\0"
+	"MICRO-CONNECT-PTY\0"
+	"PUTERCOM ENTERPRISE CO., LTD.\0"
+	"Hillcrest Laboratories, Inc.\0"
+	"HILLCREST-LABORATORIES\0"
+	"Logic Beach Inc\0"
+	"LOGIC-BEACH\0"
+	"AIRWISE TECHNOLOGY CO., LTD.\0"
+	"AIRWISE\0"
+	"Clearsonics Pty. Ltd.\0"
+	"CLEARSONICS-PTY\0"
+	"Fibresavers Corporation\0"
+	"FIBRESAVERS\0"
+	"Polystar Instruments AB\0"
+	"POLYSTAR-INSTRUMENTS-AB\0"
+	"Summit Developmen\0"
+	"SUMMIT-DEVELOPMEN\0"
+	"Tecna Srl\0"
+	"TECNA-SRL\0"
+	"Linear Acoustic, Inc\0"
+	"LINEAR-ACOUSTIC\0"
+	"Genie Network Resource Management Inc.\0"
+	"GENIE-NETWORK-RESOURCE-MANAGEMENT\0"
+	"Tadian Electronics Systems LTD\0"
+	"TADIAN-ELECTRONICS\0"
+	"Monaghan Engineering, Inc.\0"
+	"MONAGHAN-ENGINEERING\0"
+	"SOWA ELECTRIC CO., LTD.\0"
+	"SOWA-ELECTRIC\0"
+	"Solid State Logic\0"
+	"SOLID-STATE-LOGIC\0"
+	"Christ Elektronik GmbH\0"
+	"CHRIST-ELEKTRONIK\0"
+	"DBMCORP, Inc.\0"
+	"DBMCORP\0"
+	"SpeasTech, Inc.\0"
+	"SPEASTECH\0"
+	"Beta Lasermike Ltd\0"
+	"BETA-LASERMIKE\0"
+	"TOA Systems\0"
+	"TOA\0"
+	"VELUX\0"
+	"Alcon Technologies\0"
+	"ALCON-TECHNOLOGIES\0"
+	"Traquair Data Systems, Inc.\0"
+	"TRAQUAIR-DATA\0"
+	"McCain Traffic Supply\0"
+	"MCCAIN-TRAFFIC-SUPPLY\0"
+	"ARIS TECHNOLOGIES\0"
+	"ARIS-TECHNOLOGIES\0"
+	"Mark IV IDS Corp.\0"
+	"MARK-IV-IDS\0"
+	"AMRDEC Prototype Integration Facility\0"
+	"AMRDEC-PROTOTYPE-INTEGRATION-FACILITY\0"
+	"Motec Pty Ltd\0"
+	"MOTEC-PTY\0"
+	"VASTech\0"
+	"VASTECH\0"
+	"AC SYSTEMS, s.r.o.\0"
+	"AC-S-R-O\0"
+	"IRTrans GmbH\0"
+	"IRTRANS\0"
+	"OMNITRONICS PTY LTD\0"
+	"OMNITRONICS-PTY\0"
+	"VITEC MULTIMEDIA\0"
+	"VITEC-MULTIMEDIA\0"
+	"Smartcom-Bulgaria AD\0"
+	"SMARTCOM-BULGARIA-AD\0"
+	"Gesellschaft für  Rationalisierung und Rechentechnik mbH\0"
+	"GESELLSCHAFT-FUER-RATIONALISIERUNG-UND-RECHENTECHNIK\0"
+	"Innovation, Institute, Inc\0"
+	"NVE Corporation\0"
+	"NVE\0"
+	"Hyundai J. Comm\0"
+	"HYUNDAI-J-COMM\0"
+	"MMS Servis s.r.o.\0"
+	"MMS-SERVIS-S-R-O\0"
+	"C2 DIAGNOSTICS\0"
+	"C2-DIAGNOSTICS\0"
+	"DST CONTROL AB\0"
+	"DST-CONTROL-AB\0"
+	"EtherTek Circuits\0"
+	"ETHERTEK-CIRCUITS\0"
+	"Detection Technology Inc.\0"
+	"DETECTION\0"
+	"Image Control Design Limited\0"
+	"IMAGE-CONTROL-DESIGN\0"
+	"Teleks Co. Ltd.\0"
+	"TELEKS\0"
+	"Marposs SPA\0"
+	"MARPOSS-SPA\0"
+	"Digital communications Technologies\0"
+	"DIGITAL-COMMUNICATION-TECHNOLOGIES\0"
+	"Honeywell\0"
+	"HONEYWELL\0"
+	"Ellips B.V.\0"
+	"ELLIPS-B-V\0"
+	"Mesure Controle Commande\0"
+	"MESURE-CONTROLE-COMMANDE\0"
+	"WAVES SYSTEM\0"
+	"WAVES-SYSTEM\0"
+	"AVerMedia Technologies, Inc.\0"
+	"AVERMEDIA-TECHNOLOGIES\0"
+	"DIGI SESN AG\0"
+	"DIGI-SESN\0"
+	"Zetera\0"
+	"ZETERA\0"
+	"SecuInfo Co., Ltd.\0"
+	"SECUINFO\0"
+	"Universidad de Chile Facultad de Medicina\0"
+	"UNIVERSIDAD-DE-CHILE-FACULTAD-DE-MEDICINA\0"
+	"I.T.W. Betaprint\0"
+	"I-T-W-BETAPRINT\0"
+	"Netsynt S.p.A.\0"
+	"NETSYNT\0"
+	"IPTC Tech. Comm. AB\0"
+	"IPTC-TECH-COMM-AB\0"
+	"Innopsys\0"
+	"INNOPSYS\0"
+	"Sintecnos srl\0"
+	"SINTECNOS-SRL\0"
+	"Silent System\0"
+	"SILENT-SYSTEM\0"
+	"Convergent Design\0"
+	"CONVERGENT-DESIGN\0"
+	"Valtronic SA\0"
+	"VALTRONIC\0"
+	"LJU Automatisierungstechnik GmbH\0"
+	"LJU-AUTOMATISIERUNGSTECHNIK\0"
+	"Innovative Neurotroncs\0"
+	"INNOVATIVE-NEUROTRONCS\0"
+	"Elfiq Inc.\0"
+	"ELFIQ\0"
+	"ATH system\0"
+	"ATH-SYSTEM\0"
+	"Weinzierl Engineering GmbH\0"
+	"WEINZIERL-ENGINEERING\0"
+	"Control Alternative Solutions, Inc.\0"
+	"CONTROL-ALTERNATIVE-SOLUTIONS\0"
+	"Freiburger BlickZentrum\0"
+	"FREIBURGER-BLICKZENTRUM\0"
+	"Netcomsec Co Ltd\0"
+	"NETCOMSEC\0"
+	"Bedo Elektronik GmbH\0"
+	"BEDO-ELEKTRONIK\0"
+	"Fail Safe Solutions LLC\0"
+	"FAIL-SAFE-SOLUTIONS\0"
+	"Valde Systems, Inc.\0"
+	"VALDE\0"
+	"MATRIX COMSEC PRIVATE LIMITED\0"
+	"MATRIX-COMSEC-PRIVATE\0"
+	"HANZAS ELEKTRONIKA, SIA\0"
+	"HANZAS-ELEKTRONIKA-SIA\0"
+	"Moog Broad Reach\0"
+	"MOOG-BROAD-REACH\0"
+	"Seitec Elektronik GmbH\0"
+	"SEITEC-ELEKTRONIK\0"
+	"C21 Systems Limited\0"
+	"C21\0"
+	"ORTRAT, S.L.\0"
+	"ORTRAT\0"
+	"Last Mile Gear\0"
+	"LAST-MILE-GEAR\0"
+	"WORKPOWER TECNOLOGIA ELETRONICA LTDA-EPP\0"
+	"WORKPOWER-TECNOLOGIA-ELETRONICA-LTDA-EPP\0"
+	"ubinetsys.co..ltd\0"
+	"UBINETSYS\0"
+	"Tess GmbH\0"
+	"TESS\0"
+	"GeoFocus, LLC\0"
+	"GEOFOCUS\0"
+	"Twinwin Technplogy Co.,Ltd.\0"
+	"TWINWIN-TECHNPLOGY\0"
+	"Dataton Utvecklings AB\0"
+	"DATATON-UTVECKLINGS-AB\0"
+	"Targeted Technologies, LLC\0"
+	"TARGETED-TECHNOLOGIES\0"
+	"Computrol Fuel Systems Inc.\0"
+	"COMPUTROL-FUEL\0"
+	"LAB-EL ELEKTRONIKA LABORATORYJNA S.J.\0"
+	"LAB-EL-ELEKTRONIKA-LABORATORYJNA-S-J\0"
+	"GMA, LLC\0"
+	"GMA\0"
+	"Ellex Medical Pty Ltd\0"
+	"ELLEX-MEDICAL-PTY\0"
+	"Oberon Service srl\0"
+	"OBERON-SERVICE-SRL\0"
+	"Chell Instruments Ltd\0"
+	"CHELL-INSTRUMENTS\0"
+	"DATAMICRO Co., Ltd.\0"
+	"DATAMICRO\0"
+	"Ingeniería AlmudÃ­ S.L.\0"
+	"INGENIERA-ALMUD\0"
+	"SOLYSTIC\0"
+	"Visi-tech Systems Ltd\0"
+	"VISI-TECH\0"
+	"Advanced Software Technologies\0"
+	"ADVANCED-SOFTWARE-TECHNOLOGIES\0"
+	"Gastager Systemtechnik GmbH\0"
+	"GASTAGER-SYSTEMTECHNIK\0"
+	"ptswitch\0"
+	"PTSWITCH\0"
+	"éolane\0"
+	"OLANE\0"
+	"Sierra Video Systems\0"
+	"SIERRA-VIDEO\0"
+	"Digital Way\0"
+	"DIGITAL-WAY\0"
+	"Orderite, Inc.\0"
+	"ORDERITE\0"
+	"Buyang Electronics Industrial co.,Ltd.\0"
+	"Devitech ApS\0"
+	"DEVITECH-APS\0"
+	"AllSun A/S\0"
+	"ALLSUN-A/S\0"
+	"Junger Audio-Studiotechnik GmbH\0"
+	"JUNGER-AUDIO-STUDIOTECHNIK\0"
+	"Toyota Motorsport GmbH\0"
+	"TOYOTA-MOTORSPORT\0"
+	"Wireless Cables Inc.\0"
+	"WIRELESS-CABLES\0"
+	"Genetix Ltd\0"
+	"GENETIX\0"
+	"Dynalco\0"
+	"DYNALCO\0"
+	"Federal Electronics\0"
+	"FEDERAL-ELECTRONICS\0"
+	"HORIBA ABX SAS\0"
+	"HORIBA-ABX-SAS\0"
+	"Dixell S.p.a.\0"
+	"DIXELL\0"
+	"Innovative Dynamics GmbH\0"
+	"INNOVATIVE-DYNAMICS\0"
+	"Lattice Semiconductor Corp. (LPA)\0"
+	"LATTICE-SEMICONDUCTOR-LPA\0"
+	"ZAO\0"
+	"Penny & Giles Aerospace Ltd\0"
+	"PENNY-GILES-AEROSPACE\0"
+	"XoIP Systems Pty Ltd\0"
+	"XOIP-PTY\0"
+	"EM Motorsport Ltd\0"
+	"EM-MOTORSPORT\0"
+	"Grosvenor Technology Ltd\0"
+	"GROSVENOR\0"
+	"PaloDEx Group Oy\0"
+	"PALODEX-GROUP-OY\0"
+	"Broadlight\0"
+	"BROADLIGHT\0"
+	"Pixel Velocity, Inc\0"
+	"PIXEL-VELOCITY\0"
+	"Callpod, Inc.\0"
+	"CALLPOD\0"
+	"SPANSION\0"
+	"Nautel LTD\0"
+	"NAUTEL\0"
+	"Bundesamt für Strahlenschutz\0"
+	"BUNDESAMT-FUER-STRAHLENSCHUTZ\0"
+	"Fen Technology Limited\0"
+	"FEN\0"
+	"MultiTrode Pty Ltd\0"
+	"MULTITRODE-PTY\0"
+	"SAPEC\0"
+	"DELSAT GROUP S.A.\0"
+	"DELSAT-GROUP\0"
+	"Legerity\0"
+	"LEGERITY\0"
+	"Rudolph Technologies, Inc.\0"
+	"RUDOLPH-TECHNOLOGIES\0"
+	"Vestfold Butikkdata AS\0"
+	"VESTFOLD-BUTIKKDATA-AS\0"
+	"iNET Systems Inc.\0"
+	"INET\0"
+	"LUMEL S.A.\0"
+	"LUMEL\0"
+	"Federal State Unitary Enterprise Experimental Factory for Sc\0"
+	"FEDERAL-STATE-UNITARY-EXPERIMENTAL-FACTORY-FOR-SC\0"
+	"Equipos de Telecomunicación  Optoelectronicos, S.A.\0"
+	"EQUIPOS-DE-TELECOMUNICACIN-OPTOELECTRONICOS\0"
+	"Plastic Logic\0"
+	"PLASTIC-LOGIC\0"
+	"ETAP NV\0"
+	"ETAP-NV\0"
+	"AYC Telecom Ltd\0"
+	"AYC-TELECOM\0"
+	"Transenna AB\0"
+	"TRANSENNA-AB\0"
+	"Eaton Corp. Electrical Group Data Center Solutions - Pulizzi\0"
+	"EATON-ELECTRICAL-GROUP-DATA-CENTER-SOLUTIONS-PULIZZI\0"
+	"Kinemetrics, Inc.\0"
+	"KINEMETRICS\0"
+	"Emcom Systems\0"
+	"CPS EUROPE B.V.\0"
+	"CPS-EUROPE-B-V\0"
+	"INCOTEC GmbH\0"
+	"INCOTEC\0"
+	"Rosta Ltd\0"
+	"ROSTA\0"
+	"Syntronic AB\0"
+	"SYNTRONIC-AB\0"
+	"HITECOM System\0"
+	"HITECOM-SYSTEM\0"
+	"Terrascience Systems Ltd.\0"
+	"TERRASCIENCE\0"
+	"Kontron (BeiJing) Technology Co.,Ltd\0"
+	"KONTRON-BEIJING\0"
+	"WestfaliaSurge GmbH\0"
+	"WESTFALIASURGE\0"
+	"Taiwan Video & Monitor\0"
+	"TAIWAN-VIDEO-MONITOR\0"
+	"UNIC TECHNOLOGIES INC\0"
+	"UNIC-TECHNOLOGIES\0"
+	"Guangzhou Hui Si Information Technologies Inc.\0"
+	"GUANGZHOU-HUI-SI-INFORMATION-TECHNOLOGIES\0"
+	"NOMUS COMM SYSTEMS\0"
+	"NOMUS-COMM\0"
+	"Card Access Services Pty Ltd\0"
+	"CARD-ACCESS-SERVICES-PTY\0"
+	"Techimp Systems S.r.l.\0"
+	"TECHIMP\0"
+	"Pyott-Boone Electronics\0"
+	"PYOTT-BOONE-ELECTRONICS\0"
+	"R. L. Drake Company\0"
+	"R-L-DRAKE-COMPANY\0"
+	"Intuitive Surgical, Inc\0"
+	"INTUITIVE-SURGICAL\0"
+	"KS System GmbH\0"
+	"KS-SYSTEM\0"
+	"ProMik GmbH\0"
+	"PROMIK\0"
+	"Radiant Imaging, Inc.\0"
+	"RADIANT-IMAGING\0"
+	"Technische Alternative GmbH\0"
+	"TECHNISCHE-ALTERNATIVE\0"
+	"InSync Technology Ltd\0"
+	"INSYNC\0"
+	"Georgia Tech Research Institute\0"
+	"GEORGIA-TECH-RESEARCH-INSTITUTE\0"
+	"Shenzhen Quanlong Technique Co.Ltd\0"
+	"SHENZHEN-QUANLONG-TECHNIQUE\0"
+	"Buyang Electronics Industrial Co., Ltd.\0"
+	"Kobold Sistemi s.r.l.\0"
+	"KOBOLD-SISTEMI\0"
+	"Enseo, Inc.\0"
+	"ENSEO\0"
+	"RADA Electronics Industries Ltd.\0"
+	"RADA-ELECTRONICS-INDUSTRIES\0"
+	"Roke Manor Research Ltd\0"
+	"ROKE-MANOR-RESEARCH\0"
+	"Innomed Medical Inc\0"
+	"INNOMED-MEDICAL\0"
+	"Automata Spa\0"
+	"AUTOMATA-SPA\0"
+	"Meucci Solutions\0"
+	"MEUCCI-SOLUTIONS\0"
+	"DA-Design Oy\0"
+	"DA-DESIGN-OY\0"
+	"Wexiodisk AB\0"
+	"WEXIODISK-AB\0"
+	"Cannon Technologies\0"
+	"CANNON-TECHNOLOGIES\0"
+	"BioAccess Tecnologia em Biometria Ltda.\0"
+	"BIOACCESS-TECNOLOGIA-EM-BIOMETRIA-LTDA\0"
+	"Synrad, Inc.\0"
+	"SYNRAD\0"
+	"TECHNIFOR SAS\0"
+	"TECHNIFOR-SAS\0"
+	"Crimson Microsystems, Inc.\0"
+	"CRIMSON-MICROSYSTEMS\0"
+	"TONNA ELECTRONIQUE\0"
+	"TONNA-ELECTRONIQUE\0"
+	"RM Michaelides Software & Elektronik GmbH\0"
+	"RM-MICHAELIDES-SOFTWARE-ELEKTRONIK\0"
+	"SomerData ltd\0"
+	"SOMERDATA\0"
+	"Magal Senstar Inc.\0"
+	"MAGAL-SENSTAR\0"
+	"Gnutek Ltd.\0"
+	"GNUTEK\0"
+	"Ittiam Systems (P) Ltd\0"
+	"ITTIAM-P\0"
+	"Computechnic AG\0"
+	"COMPUTECHNIC\0"
+	"Stresstech OY\0"
+	"STRESSTECH-OY\0"
+	"Musatel\0"
+	"MUSATEL\0"
+	"EADS TEST & SERVICES\0"
+	"EADS-TEST-SERVICES\0"
+	"Info-Chip Communications Ltd.\0"
+	"INFO-CHIP-COMMUNICATION\0"
+	"Micro Technology Services Inc.\0"
+	"MICRO-SERVICES\0"
+	"Micro Elektronische Producten\0"
+	"MICRO-ELEKTRONISCHE-PRODUCTEN\0"
+	"Garper Telecomunicaciones, S.L.\0"
+	"GARPER-TELECOMUNICACIONES\0"
+	"ASiS Technologies Pte Ltd\0"
+	"ASIS-TECHNOLOGIES-PTE\0"
+	"AQUAROTTER A FRANKE COMPANY\0"
+	"AQUAROTTER-A-FRANKE-COMPANY\0"
+	"Condre Corporation\0"
+	"CONDRE\0"
+	"pikkerton GmbH\0"
+	"PIKKERTON\0"
+	"DIAS Infrared GmbH\0"
+	"DIAS-INFRARED\0"
+	"Technomarine JSC\0"
+	"TECHNOMARINE-JSC\0"
+	"ESEM Grünau GmbH & Co. KG\0"
+	"ESEM-GRUENAU\0"
+	"POSNET Polska S.A.\0"
+	"POSNET-POLSKA\0"
+	"TeamProjects BV\0"
+	"TEAMPROJECTS\0"
+	"Genesis inc\0"
+	"GENESIS\0"
+	"CAMBRIDGE CONSULTANTS LTD\0"
+	"CAMBRIDGE-CONSULTANTS\0"
+	"Metrologic Group\0"
+	"METROLOGIC-GROUP\0"
+	"ROTHARY Solutions AG\0"
+	"ROTHARY-SOLUTIONS\0"
+	"LEA d.o.o.\0"
+	"LEA-D-O-O\0"
+	"All-Systems Electronics Pty Ltd\0"
+	"ALL-ELECTRONICS-PTY\0"
+	"FilmLight Limited\0"
+	"FILMLIGHT\0"
+	"MEG Electronic Inc.\0"
+	"MEG\0"
+	"NOVACOMM LTDA\0"
+	"NOVACOMM-LTDA\0"
+	"Gazelle Monitoring Systems\0"
+	"GAZELLE-MONITORING\0"
+	"Protec Fire Detection plc\0"
+	"PROTEC-FIRE-DETECTION-PLC\0"
+	"Cerus Corp\0"
+	"CERUS\0"
+	"HCJB Global\0"
+	"HCJB-GLOBAL\0"
+	"Swistec GmbH\0"
+	"SWISTEC\0"
+	"Shenzhen Huazhong Technology Inc\0"
+	"SHENZHEN-HUAZHONG\0"
+	"Telecom FM\0"
+	"TELECOM-FM\0"
+	"Silex Industrial Automation Ltd.\0"
+	"SILEX-INDUSTRIAL-AUTOMATION\0"
+	"Toptech Systems, Inc.\0"
+	"TOPTECH\0"
+	"Shanghai QianJin Electronic Equipment Co. Ltd.\0"
+	"SHANGHAI-QIANJIN-EQUIPMENT\0"
+	"IDENTIC AB\0"
+	"IDENTIC-AB\0"
+	"Automation and Control Technology, Inc.\0"
+	"AUTOMATION-AND-CONTROL\0"
+	"Kommunikations- & Sicherheitssysteme Gesellschaft m.b.H\0"
+	"KOMMUNIKATIONS-SICHERHEITSSYSTEME-GESELLSCHAFT-M-B-H\0"
+	"FDT Manufacturing, LLC\0"
+	"FDT-MANUFACTURING\0"
+	"Brookhaven National Laboratory\0"
+	"BROOKHAVEN-NATIONAL-LABORATORY\0"
+	"IHP-GmbH\0"
+	"IHP\0"
+	"Proserv\0"
+	"PROSERV\0"
+	"Axis Electronics\0"
+	"AXIS-ELECTRONICS\0"
+	"NARINET, INC.\0"
+	"NARINET\0"
+	"Intergrated Security Mfg. Ltd\0"
+	"INTERGRATED-SECURITY-MFG\0"
+	"Linkbit, Inc.\0"
+	"LINKBIT\0"
+	"Communication Components Inc.\0"
+	"COMMUNICATION-COMPONENTS\0"
+	"NCI Technologies Inc.\0"
+	"NCI-TECHNOLOGIES\0"
+	"TestPro Systems, Inc.\0"
+	"TESTPRO\0"
+	"Sutus Inc\0"
+	"SUTUS\0"
+	"LESTER ELECTRONICS LTD\0"
+	"LESTER-ELECTRONICS\0"
+	"Imagine Communications\0"
+	"IMAGINE-COMMUNICATION\0"
+	"Harman/Becker Automotive Systems GmbH\0"
+	"HARMAN/BECKER-AUTOMOTIVE\0"
+	"Version-T\0"
+	"VERSION-T\0"
+	"SAFELINE SL\0"
+	"SAFELINE-SL\0"
+	"Comtest Networks\0"
+	"COMTEST-NETWORKS\0"
+	"EBNeuro SpA\0"
+	"Winsys Informatica ltda\0"
+	"WINSYS-INFORMATICA-LTDA\0"
+	"JungleSystem Co., Ltd.\0"
+	"JUNGLESYSTEM\0"
+	"DARE Development\0"
+	"DARE-DEVELOPMENT\0"
+	"MacDonald Humfrey (Products) Ltd\0"
+	"MACDONALD-HUMFREY-PRODUCTS\0"
+	"Prisma Engineering srl\0"
+	"PRISMA-ENGINEERING-SRL\0"
+	"First Control Systems AB\0"
+	"FIRST-CONTROL-AB\0"
+	"AirMatrix, Inc.\0"
+	"AIRMATRIX\0"
+	"TDM Ingénierie\0"
+	"TDM-INGNIERIE\0"
+	"QES\0"
+	"Aurora Flight Sciences\0"
+	"AURORA-FLIGHT-SCIENCES\0"
+	"Fraunhofer IIS\0"
+	"FRAUNHOFER-IIS\0"
+	"RoseTechnology A/S\0"
+	"ROSETECHNOLOGY-A/S\0"
+	"Rice University\0"
+	"RICE-UNIVERSITY\0"
+	"Sohon Inc\0"
+	"SOHON\0"
+	"Shockfish SA\0"
+	"SHOCKFISH\0"
+	"dSPACE GmbH\0"
+	"DSPACE\0"
+	"Omnitrol Networks, Inc.\0"
+	"OMNITROL-NETWORKS\0"
+	"HUNGAROCOM Telecommunication Ltd.\0"
+	"HUNGAROCOM-TELECOMMUNICATION\0"
+	"Qstreams Networks Inc.\0"
+	"QSTREAMS-NETWORKS\0"
+	"3DSP Corporation\0"
+	"3DSP\0"
+	"Powis Corporation\0"
+	"POWIS\0"
+	"dPict Imaging, Inc.\0"
+	"DPICT-IMAGING\0"
+	"IDERs Inc\0"
+	"IDERS\0"
+	"T2 Communication Ltd\0"
+	"T2-COMMUNICATION\0"
+	"SPEECH TECHNOLOGY CENTER LIMITED\0"
+	"SPEECH-CENTER\0"
+	"IAC\0"
+	"NEO Information Systems Co., Ltd.\0"
+	"NEO-INFORMATION\0"
+	"Stanton Technologies Sdn Bhd\0"
+	"STANTON-TECHNOLOGIES\0"
+	"Enatel Limited\0"
+	"ENATEL\0"
+	"The Software Group Limited\0"
+	"THE-SOFTWARE-GROUP\0"
+	"TRUTOUCH TECHNOLOGIES INC\0"
+	"TRUTOUCH-TECHNOLOGIES\0"
+	"R&D Technology Solutionz Limited\0"
+	"R-D-SOLUTIONZ\0"
+	"Fidelity Comtech, Inc.\0"
+	"FIDELITY-COMTECH\0"
+	"Pan-STARRS\0"
+	"PAN-STARRS\0"
+	"CPqD\0"
+	"CPQD\0"
+	"MangoDSP\0"
+	"MANGODSP\0"
+	"CIS Corporation\0"
+	"CIS\0"
+	"Tera Information System Labs\0"
+	"TERA-INFORMATION-SYSTEM-LABS\0"
+	"Northern Power\0"
+	"NORTHERN-POWER\0"
+	"MA Lighting Technology GmbH\0"
+	"MA-LIGHTING\0"
+	"Liquid Breaker, LLC\0"
+	"LIQUID-BREAKER\0"
+	"STAER SPA\0"
+	"STAER-SPA\0"
+	"Wideco Sweden AB\0"
+	"WIDECO-SWEDEN-AB\0"
+	"Physik Instrumente (PI) GmbH&Co.KG\0"
+	"PHYSIK-INSTRUMENTE-PI\0"
+	"LDA Audio Video Profesional\0"
+	"LDA-AUDIO-VIDEO-PROFESIONAL\0"
+	"MONYTEL S.A.\0"
+	"MONYTEL\0"
+	"OpenPKG GmbH\0"
+	"OPENPKG\0"
+	"Dorsett Technologies Inc\0"
+	"DORSETT-TECHNOLOGIES\0"
+	"Hisstema AB\0"
+	"HISSTEMA-AB\0"
+	"Silverbrook Research\0"
+	"SILVERBROOK-RESEARCH\0"
+	"VTZ d.o.o.\0"
+	"VTZ-D-O-O\0"
+	"Redfone Communications LLC\0"
+	"REDFONE-COMMUNICATION\0"
+	"Cantion A/S\0"
+	"CANTION-A/S\0"
+	"Invocon, Inc.\0"
+	"INVOCON\0"
+	"IZISOFT\0"
+	"P.C.E.\0"
+	"P-C-E\0"
+	"Asia Pacific Card & System Sdn Bhd\0"
+	"ASIA-PACIFIC-CARD-SYSTEM\0"
+	"Westel Wireless Systems\0"
+	"WESTEL-WIRELESS\0"
+	"NetworkSound, Inc\0"
+	"NETWORKSOUND\0"
+	"Xworks NZ Limited\0"
+	"XWORKS-NZ\0"
+	"ABB Transmission and Distribution Automation Equipment (Xiamen) Co., Ltd.\0"
+	"ABB-TRANSMISSION-AND-DISTRIBUTION-AUTOMATION-EQUIPMENT-XIAMEN\0"
+	"flsystem\0"
+	"FLSYSTEM\0"
+	"DESY\0"
+	"DIGITEK S.p.A.\0"
+	"DIGITEK\0"
+	"Linear Systems Ltd.\0"
+	"LINEAR\0"
+	"Nilan A/S\0"
+	"NILAN-A/S\0"
+	"Naim Audio\0"
+	"NAIM-AUDIO\0"
+	"Skyline Products, Inc\0"
+	"SKYLINE-PRODUCTS\0"
+	"DDS Elettronica srl\0"
+	"DDS-ELETTRONICA-SRL\0"
+	"Protech Optronics Co., Ltd.\0"
+	"Kenton Research Ltd\0"
+	"KENTON-RESEARCH\0"
+	"EDS\0"
+	"ProconX Pty Ltd\0"
+	"PROCONX-PTY\0"
+	"Industrial Vacuum Systems\0"
+	"INDUSTRIAL-VACUUM\0"
+	"Sparton Electronics\0"
+	"SPARTON-ELECTRONICS\0"
+	"ESA  Messtechnik GmbH\0"
+	"ESA-MESSTECHNIK\0"
+	"Honey Network Research Limited\0"
+	"HONEY-NETWORK-RESEARCH\0"
+	"Commet AB\0"
+	"COMMET-AB\0"
+	"MEGGITT Safety System\0"
+	"MEGGITT-SAFETY-SYSTEM\0"
+	"REASON Tecnologia S.A.\0"
+	"REASON-TECNOLOGIA\0"
+	"Datamars SA\0"
+	"DATAMARS\0"
+	"ANNAX Anzeigesysteme GmbH\0"
+	"ANNAX-ANZEIGESYSTEME\0"
+	"Access Specialties, Inc\0"
+	"ACCESS-SPECIALTIES\0"
+	"Elk Products\0"
+	"ELK-PRODUCTS\0"
+	"Zhuhai Jiahe Electronics Co.,LTD\0"
+	"ZHUHAI-JIAHE-ELECTRONICS\0"
+	"SIMTEK INC.\0"
+	"SIMTEK\0"
+	"Isochron Inc\0"
+	"ISOCHRON\0"
+	"CXR Larus Corporation\0"
+	"CXR-LARUS\0"
+	"BERTRONIC SRL\0"
+	"BERTRONIC-SRL\0"
+	"GHL Systems Berhad\0"
+	"GHL-BERHAD\0"
+	"Interopix, Inc.\0"
+	"INTEROPIX\0"
+	"Mate Media Access Technologies\0"
+	"MATE-MEDIA-ACCESS-TECHNOLOGIES\0"
+	"Tech Comm, Inc.\0"
+	"TECH-COMM\0"
+	"Initel srl\0"
+	"INITEL-SRL\0"
+	"Purelink Technology, inc.\0"
+	"PURELINK\0"
+	"Monarch Instrument\0"
+	"MONARCH-INSTRUMENT\0"
+	"Navtech Radar Ltd\0"
+	"NAVTECH-RADAR\0"
+	"Bulletendpoints Enterprises Inc\0"
+	"BULLETENDPOINTS-ENTERPRISES\0"
+	"StoreTech Limited\0"
+	"STORETECH\0"
+	"Tsien (UK) Ltd\0"
+	"TSIEN-UK\0"
+	"Bug Labs, Inc.\0"
+	"BUG-LABS\0"
+	"Dvation.co.,Ltd\0"
+	"DVATION\0"
+	"Ideus AB\0"
+	"IDEUS-AB\0"
+	"Total RF, LLC\0"
+	"TOTAL-RF\0"
+	"GFP Lab S.r.l.\0"
+	"GFP-LAB\0"
+	"PRICOL LIMITED\0"
+	"PRICOL\0"
+	"Cadi Scientific Pte Ltd\0"
+	"CADI-SCIENTIFIC-PTE\0"
+	"CreaTech Electronics Co.\0"
+	"CREATECH-ELECTRONICS\0"
+	"TELETASK\0"
+	"EATON FHF Funke + Huster Fernsig GmbH\0"
+	"EATON-FHF-FUNKE-+-HUSTER-FERNSIG\0"
+	"Victory Concept Industries Ltd.\0"
+	"VICTORY-CONCEPT-INDUSTRIES\0"
+	"Hoer GmbH & Co. Industrie-Electronic KG\0"
+	"HOER-INDUSTRIE\0"
+	"Delcan Technologies, Inc\0"
+	"DELCAN-TECHNOLOGIES\0"
+	"Armida Technologies Corporation\0"
+	"ARMIDA-TECHNOLOGIES\0"
+	"Ifox - Industria e Comercio Ltda\0"
+	"IFOX-INDUSTRIA-E-COMERCIO-LTDA\0"
+	"Softwareentwicklung\0"
+	"SOFTWAREENTWICKLUNG\0"
+	"Thales UK\0"
+	"THALES-UK\0"
+	"Heim- & Bürokommunikation\0"
+	"HEIM-BUEROKOMMUNIKATION\0"
+	"Qualisys AB\0"
+	"QUALISYS-AB\0"
+	"Nanoradio AB\0"
+	"NANORADIO-AB\0"
+	"Smart Key International Limited\0"
+	"SMART-KEY\0"
+	"Burk Technology\0"
+	"BURK\0"
+	"Edgeware AB\0"
+	"EDGEWARE-AB\0"
+	"SOMESCA\0"
+	"TRIUMF\0"
+	"CommoDaS GmbH\0"
+	"COMMODAS\0"
+	"System LSI CO.Ltd.\0"
+	"SYSTEM-LSI\0"
+	"Epec Oy\0"
+	"EPEC-OY\0"
+	"unipo GmbH\0"
+	"UNIPO\0"
+	"Fertron Controle e Automacao Industrial Ltda.\0"
+	"FERTRON-CONTROLE-E-AUTOMACAO-INDUSTRIAL-LTDA\0"
+	"Ele.Mag S.r.l.\0"
+	"ELE-MAG\0"
+	"Paraytec Ltd\0"
+	"PARAYTEC\0"
+	"Mitron Oy\0"
+	"MITRON-OY\0"
+	"ESTEC Co.,Ltd.\0"
+	"ESTEC\0"
+	"Optoplan as\0"
+	"OPTOPLAN-AS\0"
+	"GLOSTER SANTE EUROPE\0"
+	"GLOSTER-SANTE-EUROPE\0"
+	"RADIUS Sweden AB\0"
+	"RADIUS-SWEDEN-AB\0"
+	"HoseoTelnet Inc...\0"
+	"HOSEOTELNET\0"
+	"iTRACS Corporation\0"
+	"ITRACS\0"
+	"REXXON GmbH\0"
+	"REXXON\0"
+	"Oerlikon Contraves AG\0"
+	"OERLIKON-CONTRAVES\0"
+	"QuickCircuit Ltd.\0"
+	"QUICKCIRCUIT\0"
+	"B&S MEDIA Co., LTD.\0"
+	"B-S-MEDIA\0"
+	"NETAMI\0"
+	"Dynamic Hearing Pty Ltd\0"
+	"DYNAMIC-HEARING-PTY\0"
+	"Stream Processors\0"
+	"STREAM-PROCESSORS\0"
+	"Widmer Time Recorder Co., Inc.\0"
+	"WIDMER-TIME-RECORDER\0"
+	"RGM SPA\0"
+	"RGM-SPA\0"
+	"EMITALL Surveillance S.A,\0"
+	"EMITALL-SURVEILLANCE\0"
+	"Microway\0"
+	"MICROWAY\0"
+	"EDS Systemtechnik\0"
+	"EDS-SYSTEMTECHNIK\0"
+	"Schnick-Schnack-Systems GmbH\0"
+	"SCHNICK-SCHNACK\0"
+	"Lumistar Incorporated\0"
+	"LUMISTAR-INCORPORATED\0"
+	"DigiSensory technologies Pty Ltd\0"
+	"DIGISENSORY-TECHNOLOGIES-PTY\0"
+	"Etani Electronics Co.,Ltd.\0"
+	"ETANI-ELECTRONICS\0"
+	"Becker Electronics GmbH\0"
+	"BECKER-ELECTRONICS\0"
+	"ADL Electronics Ltd.\0"
+	"ADL-ELECTRONICS\0"
+	"Mavenir System, Inc.\0"
+	"MAVENIR-SYSTEM\0"
+	"BL Healthcare, Inc.\0"
+	"BL-HEALTHCARE\0"
+	"Ajeco Oy\0"
+	"AJECO-OY\0"
+	"Techno Fittings S.r.l.\0"
+	"TECHNO-FITTINGS\0"
+	"Gebhardt Ventilatoren GmbH\0"
+	"GEBHARDT-VENTILATOREN\0"
+	"L-3 Communications Mobile-Vision, Inc.\0"
+	"L-3-COMMUNICATION-MOBILE-VISION\0"
+	"Zmicro Systems Inc\0"
+	"ZMICRO\0"
+	"Laser Tools & Technics Corp.\0"
+	"LASER-TOOLS-TECHNICS\0"
+	"QR Sciences Ltd\0"
+	"QR-SCIENCES\0"
+	"FIRSTTRUST Co.,Ltd.\0"
+	"FIRSTTRUST\0"
+	"NewOnSys Ltd.\0"
+	"NEWONSYS\0"
+	"Miros AS\0"
+	"MIROS-AS\0"
+	"Boeckeler Instruments, Inc.\0"
+	"BOECKELER-INSTRUMENTS\0"
+	"Lanetco\0"
+	"LANETCO\0"
+	"Ace Axis Limited\0"
+	"ACE-AXIS\0"
+	"Anymax\0"
+	"ANYMAX\0"
+	"Bando electronic communication Co.Lltd\0"
+	"BANDO-COMMUNICATION-LLTD\0"
+	"FIRSTEC SA\0"
+	"FIRSTEC\0"
+	"Harrison Audio, LLC\0"
+	"HARRISON-AUDIO\0"
+	"Netistix Technologies Corporation\0"
+	"NETISTIX-TECHNOLOGIES\0"
+	"Sechan Electronics, Inc.\0"
+	"SECHAN-ELECTRONICS\0"
+	"Interactive Electronic Systems\0"
+	"INTERACTIVE\0"
+	"Pneumopartners LaenneXT SA\0"
+	"PNEUMOPARTNERS-LAENNEXT\0"
+	"Stanley Security Solutions, Inc.\0"
+	"STANLEY-SECURITY-SOLUTIONS\0"
+	"ITS Telecom\0"
+	"ITS-TELECOM\0"
+	"Laser Electronics Ltd\0"
+	"LASER-ELECTRONICS\0"
+	"E3Switch LLC\0"
+	"E3SWITCH\0"
+	"Cryogenic Control Systems, Inc.\0"
+	"CRYOGENIC-CONTROL\0"
+	"Kitron Microelectronics AB\0"
+	"KITRON-MICROELECTRONICS-AB\0"
+	"AV SatCom AS\0"
+	"AV-SATCOM-AS\0"
+	"infoplan Gesellschaftfür  Informationssysteme mbH\0"
+	"INFOPLAN-GESELLSCHAFTFUER-INFORMATIONSSYSTEME\0"
+	"RV Technology Limited\0"
+	"RV\0"
+	"Revox GmbH\0"
+	"REVOX\0"
+	"DCNS\0"
+	"Acte Sp. z o.o.\0"
+	"ACTE-SP-Z-O-O\0"
+	"Blue Origin\0"
+	"BLUE-ORIGIN\0"
+	"St. Michael Strategies Inc.\0"
+	"GEM-MED SL\0"
+	"GEM-MED-SL\0"
+	"SPM Instrument AB\0"
+	"SPM-INSTRUMENT-AB\0"
+	"SAE IT-systems GmbH & Co. KG\0"
+	"SAE-IT\0"
+	"The Dini Group, La Jolla inc.\0"
+	"THE-DINI-GROUP-LA-JOLLA\0"
+	"Hauch & Bach ApS\0"
+	"HAUCH-BACH-APS\0"
+	"DioDigiWorks. CO., LTD.\0"
+	"DIODIGIWORKS\0"
+	"DTech Labs Inc\0"
+	"DTECH-LABS\0"
+	"Smartek d.o.o.\0"
+	"SMARTEK-D-O-O\0"
+	"RO.VE.R. Laboratories S.p.A\0"
+	"RO-VE-R-LABORATORIES\0"
+	"Exertus\0"
+	"EXERTUS\0"
+	"ela-soft GmbH & Co. KG\0"
+	"ELA-SOFT\0"
+	"AUDICO SYSTEMS OY\0"
+	"AUDICO-OY\0"
+	"Zumbach Electronic AG\0"
+	"ZUMBACH\0"
+	"Wharton Electronics Ltd\0"
+	"WHARTON-ELECTRONICS\0"
+	"LINKIT S.R.L.\0"
+	"LINKIT\0"
+	"Pasan SA\0"
+	"PASAN\0"
+	"3DX-Ray Limited\0"
+	"3DX-RAY\0"
+	"T.E.AM., S. A.\0"
+	"T-E-AM-S-A\0"
+	"RIEXINGER Elektronik\0"
+	"RIEXINGER-ELEKTRONIK\0"
+	"MITROL S.R.L.\0"
+	"MITROL\0"
+	"MB connect line GmbH Fernwartungssysteme\0"
+	"MB-CONNECT-LINE-FERNWARTUNGSSYSTEME\0"
+	"illunis LLC\0"
+	"ILLUNIS\0"
+	"ennovatis GmbH\0"
+	"ENNOVATIS\0"
+	"Logus Broadband Wireless Solutions Inc.\0"
+	"LOGUS-BROADBAND-WIRELESS-SOLUTIONS\0"
+	"ADVA Optical Networking\0"
+	"ADVA-OPTICAL-NETWORKING\0"
+	"Elmec Inc.\0"
+	"ELMEC\0"
+	"MG s.r.l.\0"
+	"MG\0"
+	"ASKI Industrie Elektronik Ges.m.b.H.\0"
+	"ASKI-INDUSTRIE-ELEKTRONIK-GES-M-B-H\0"
+	"ASC telecom AG\0"
+	"ASC-TELECOM\0"
+	"Colorado Engineering Inc.\0"
+	"COLORADO-ENGINEERING\0"
+	"Spectrum Communications FZE\0"
+	"SPECTRUM-COMMUNICATION-FZE\0"
+	"Centric TSolve BV\0"
+	"CENTRIC-TSOLVE\0"
+	"Power Electronics Espana, S.L.\0"
+	"POWER-ELECTRONICS-ESPANA\0"
+	"HSC-Regelungstechnik GmbH\0"
+	"HSC-REGELUNGSTECHNIK\0"
+	"eta systemi CKB\0"
+	"ETA-SYSTEMI-CKB\0"
+	"Pelweckyj Videotechnik GmbH\0"
+	"PELWECKYJ-VIDEOTECHNIK\0"
+	"InterDigital Canada Ltd\0"
+	"INTERDIGITAL-CANADA\0"
+	"Sequestered Solutions\0"
+	"SEQUESTERED-SOLUTIONS\0"
+	"Richard Griessbach Feinmechanik GmbH\0"
+	"RICHARD-GRIESSBACH-FEINMECHANIK\0"
+	"Physical Acoustics Corporation\0"
+	"PHYSICAL-ACOUSTICS\0"
+	"SNCF EIM PAYS DE LOIRE\0"
+	"SNCF-EIM-PAYS-DE-LOIRE\0"
+	"Priority Electronics Ltd\0"
+	"PRIORITY-ELECTRONICS\0"
+	"haber & koenig electronics gmbh\0"
+	"HABER-KOENIG-ELECTRONICS\0"
+	"Spirent Communications\0"
+	"SPIRENT-COMMUNICATION\0"
+	"Schlumberger K.K.\0"
+	"SCHLUMBERGER-K-K\0"
+	"Cimetrics Research Pty Ltd\0"
+	"CIMETRICS-RESEARCH-PTY\0"
+	"CardioMEMS Inc.\0"
+	"CARDIOMEMS\0"
+	"Ant Lamp, Inc\0"
+	"ANT-LAMP\0"
+	"Nika Ltd\0"
+	"NIKA\0"
+	"Teradici Corporation\0"
+	"TERADICI\0"
+	"Miracom Technology Co., Ltd.\0"
+	"MIRACOM\0"
+	"Naturela Ltd.\0"
+	"NATURELA\0"
+	"On Air Networks\0"
+	"ON-AIR-NETWORKS\0"
+	"Simicon\0"
+	"SIMICON\0"
+	"cryptiris\0"
+	"CRYPTIRIS\0"
+	"Quantec Networks GmbH\0"
+	"QUANTEC-NETWORKS\0"
+	"MEDAV GmbH\0"
+	"MEDAV\0"
+	"McQuay China\0"
+	"MCQUAY-CHINA\0"
+	"Dain\0"
+	"DAIN\0"
+	"Fantuzzi Reggiane\0"
+	"FANTUZZI-REGGIANE\0"
+	"Elektro-Top 3000 Ltd.\0"
+	"ELEKTRO-TOP-3000\0"
+	"Avonaco Systems, Inc.\0"
+	"AVONACO\0"
+	"ACISA\0"
+	"Realtronix Company\0"
+	"REALTRONIX-COMPANY\0"
+	"CDSA Dam Neck\0"
+	"CDSA-DAM-NECK\0"
+	"Letechnic Ltd\0"
+	"LETECHNIC\0"
+	"Affolter Technologies SA\0"
+	"AFFOLTER-TECHNOLOGIES\0"
+	"MONITOR ELECTRONICS LTD\0"
+	"MONITOR-ELECTRONICS\0"
+	"STAR-Dundee Ltd\0"
+	"STAR-DUNDEE\0"
+	"Saia-Burgess Controls AG\0"
+	"Beceem Communications, Inc.\0"
+	"BECEEM-COMMUNICATION\0"
+	"TRONICO\0"
+	"German Technologies\0"
+	"GERMAN-TECHNOLOGIES\0"
+	"Brightlights Intellectual Property Ltd\0"
+	"BRIGHTLIGHTS-INTELLECTUAL-PROPERTY\0"
+	"e&s Engineering & Software GmbH\0"
+	"E-S-ENGINEERING-SOFTWARE\0"
+	"LOBER, S.A.\0"
+	"LOBER\0"
+	"Abeo Corporation\0"
+	"ABEO\0"
+	"Teletek Electronics\0"
+	"TELETEK-ELECTRONICS\0"
+	"Chesapeake Sciences Corp\0"
+	"CHESAPEAKE-SCIENCES\0"
+	"E S P Technologies Ltd\0"
+	"E-S-P-TECHNOLOGIES\0"
+	"AixSolve GmbH\0"
+	"AIXSOLVE\0"
+	"Sequentric Energy Systems, LLC\0"
+	"SEQUENTRIC-ENERGY\0"
+	"Gaisler Research AB\0"
+	"GAISLER-RESEARCH-AB\0"
+	"DMT System S.p.A.\0"
+	"DMT-SYSTEM\0"
+	"STÖRK-TRONIC Störk GmbH&Co. KG\0"
+	"STOERK-TRONIC-STOERK\0"
+	"Fluid Analytics, Inc.\0"
+	"FLUID-ANALYTICS\0"
+	"Sky-Skan, Incorporated\0"
+	"SKY-SKAN-INCORPORATED\0"
+	"B. Rexroth the identity company GmbH\0"
+	"B-REXROTH-THE-IDENTITY-COMPANY\0"
+	"AR'S CO., LTD.\0"
+	"AR-S\0"
+	"Elbit Systems of America\0"
+	"ELBIT-OF-AMERICA\0"
+	"Assembly Contracts Limited\0"
+	"ASSEMBLY-CONTRACTS\0"
+	"XtendWave\0"
+	"XTENDWAVE\0"
+	"ARGUS-SPECTRUM\0"
+	"Gutermann Technology GmbH\0"
+	"GUTERMANN\0"
+	"EID\0"
+	"Control Service do Brasil Ltda\0"
+	"CONTROL-SERVICE-DO-BRASIL-LTDA\0"
+	"BES GmbH\0"
+	"BES\0"
+	"Digidrive Audio Limited\0"
+	"DIGIDRIVE-AUDIO\0"
+	"Putercom Enterprise Co., LTD.\0"
+	"EFG CZ spol. s r.o.\0"
+	"EFG-CZ-SPOL-S-R-O\0"
+	"Mobilisme\0"
+	"MOBILISME\0"
+	"Crinia Corporation\0"
+	"CRINIA\0"
+	"Control and Robotics Solutions\0"
+	"CONTROL-AND-ROBOTICS-SOLUTIONS\0"
+	"Cadex Electronics Inc.\0"
+	"CADEX-ELECTRONICS\0"
+	"ZigBee Alliance\0"
+	"ZIGBEE-ALLIANCE\0"
+	"IES Elektronikentwicklung\0"
+	"IES-ELEKTRONIKENTWICKLUNG\0"
+	"Pointe Conception Medical Inc.\0"
+	"POINTE-CONCEPTION-MEDICAL\0"
+	"GeoSIG Ltd.\0"
+	"GEOSIG\0"
+	"Laserdyne Technologies\0"
+	"LASERDYNE-TECHNOLOGIES\0"
+	"Integrated Security Corporation\0"
+	"INTEGRATED-SECURITY\0"
+	"Euro Display Srl\0"
+	"EURO-DISPLAY-SRL\0"
+	"SunGard Vivista\0"
+	"SUNGARD-VIVISTA\0"
+	"Coral Telecom Ltd\0"
+	"CORAL-TELECOM\0"
+	"Smith Meter, Inc\0"
+	"Itibia Technologies\0"
+	"ITIBIA-TECHNOLOGIES\0"
+	"ATEC SRL\0"
+	"ATEC-SRL\0"
+	"Lincoln Industrial\0"
+	"LINCOLN-INDUSTRIAL\0"
+	"IQ Solutions GmbH & Co. KG\0"
+	"IQ-SOLUTIONS\0"
+	"Starling Advanced Communications\0"
+	"STARLING-ADVANCED-COMMUNICATION\0"
+	"NORMA systems GmbH\0"
+	"NORMA\0"
+	"Lewis Controls Inc.\0"
+	"LEWIS-CONTROLS\0"
+	"Icon Time Systems\0"
+	"ICON-TIME\0"
+	"HOSA TECHNOLOGY, INC.\0"
+	"HOSA\0"
+	"Rosslare Enterprises Limited\0"
+	"ROSSLARE-ENTERPRISES\0"
+	"LEVEL TELECOM\0"
+	"LEVEL-TELECOM\0"
+	"Giga-tronics, Inc.\0"
+	"GIGA-TRONICS\0"
+	"Telairity\0"
+	"TELAIRITY\0"
+	"GLOBALCOM ENGINEERING SRL\0"
+	"GLOBALCOM-ENGINEERING-SRL\0"
+	"ELMAR electronic\0"
+	"ELMAR\0"
+	"GE Security-Kampro\0"
+	"M Squared Lasers Limited\0"
+	"M-SQUARED-LASERS\0"
+	"SMARTRO Co.,Ltd.\0"
+	"SMARTRO\0"
+	"Enertex Bayern GmbH\0"
+	"ENERTEX-BAYERN\0"
+	"COMSONICS, INC.\0"
+	"COMSONICS\0"
+	"Ameli Spa\0"
+	"AMELI-SPA\0"
+	"Tiefenbach Control Systems GmbH\0"
+	"TIEFENBACH-CONTROL\0"
+	"Indefia\0"
+	"INDEFIA\0"
+	"AAVD\0"
+	"JMC America, LLC\0"
+	"JMC-AMERICA\0"
+	"Schniewindt GmbH & Co. KG\0"
+	"SCHNIEWINDT\0"
+	"Vital Systems Inc\0"
+	"VITAL\0"
+	"MiraTrek\0"
+	"MIRATREK\0"
+	"Benshaw Canada Controls, Inc.\0"
+	"BENSHAW-CANADA-CONTROLS\0"
+	"ZAO NPC\0"
+	"ZAO-NPC\0"
+	"Field Design Service\0"
+	"FIELD-DESIGN-SERVICE\0"
+	"RaySat Israel LTD\0"
+	"RAYSAT-ISRAEL\0"
+	"Calibre UK LTD\0"
+	"CALIBRE-UK\0"
+	"Quantum Medical Imaging\0"
+	"QUANTUM-MEDICAL-IMAGING\0"
+	"ASIANA IDT\0"
+	"ASIANA-IDT\0"
+	"Guidance Navigation Limited\0"
+	"GUIDANCE-NAVIGATION\0"
+	"Integrated Design Tools, Inc.\0"
+	"INTEGRATED-DESIGN-TOOLS\0"
+	"General Microsystems Sdn Bhd\0"
+	"GENERAL-MICROSYSTEMS\0"
+	"IUSA SA DE CV\0"
+	"IUSA-DE-CV\0"
+	"Turun Turvatekniikka Oy\0"
+	"TURUN-TURVATEKNIIKKA-OY\0"
+	"Global Tel-Link\0"
+	"GLOBAL-TEL-LINK\0"
+	"C2 Microsystems\0"
+	"C2-MICROSYSTEMS\0"
+	"IMP Telekom\0"
+	"IMP-TELEKOM\0"
+	"A.D.I Video technologies\0"
+	"A-D-I-VIDEO-TECHNOLOGIES\0"
+	"Elmec,  Inc.\0"
+	"T 1 Engineering\0"
+	"T-1-ENGINEERING\0"
+	"DIT-MCO International\0"
+	"DIT-MCO\0"
+	"Alstom (Schweiz) AG\0"
+	"ALSTOM-SCHWEIZ\0"
+	"Design 2000 Pty Ltd\0"
+	"DESIGN-2000-PTY\0"
+	"Infodev Electronic Designers Intl.\0"
+	"INFODEV-DESIGNERS-INTL\0"
+	"InRay Solutions Ltd.\0"
+	"INRAY-SOLUTIONS\0"
+	"EIDOS SPA\0"
+	"EIDOS-SPA\0"
+	"PROMATE ELECTRONIC CO.LTD\0"
+	"PROMATE\0"
+	"Powerlinx, Inc.\0"
+	"POWERLINX\0"
+	"Zoe Medical\0"
+	"ZOE-MEDICAL\0"
+	"European Industrial Electronics B.V.\0"
+	"EUROPEAN-INDUSTRIAL-ELECTRONICS-B-V\0"
+	"Primary Integration Encorp LLC\0"
+	"PRIMARY-INTEGRATION-ENCORP\0"
+	"DSR Information Technologies Ltd.\0"
+	"DSR-INFORMATION-TECHNOLOGIES\0"
+	"AST INCORPORATED\0"
+	"AST-INCORPORATED\0"
+	"MoBaCon\0"
+	"MOBACON\0"
+	"Venture Research Inc.\0"
+	"VENTURE-RESEARCH\0"
+	"SL Audio A/S\0"
+	"SL-AUDIO-A/S\0"
+	"Pyrosequencing AB\0"
+	"PYROSEQUENCING-AB\0"
+	"Bluebell Opticom Limited\0"
+	"BLUEBELL-OPTICOM\0"
+	"CEDAR Audio Ltd\0"
+	"CEDAR-AUDIO\0"
+	"ViewPlus Technologies, Inc.\0"
+	"VIEWPLUS-TECHNOLOGIES\0"
+	"SWECO JAPS AB\0"
+	"SWECO-JAPS-AB\0"
+	"Precision MicroControl Corporation\0"
+	"PRECISION-MICROCONTROL\0"
+	"Emitech Corporation\0"
+	"EMITECH\0"
+	"Radar Tronic ltd.\0"
+	"RADAR-TRONIC\0"
+	"Bittitalo Oy\0"
+	"BITTITALO-OY\0"
+	"Highrail Systems Limited\0"
+	"HIGHRAIL\0"
+	"WR Systems, Ltd.\0"
+	"WR\0"
+	"DEUTA-WERKE GmbH\0"
+	"International Mining Technologies\0"
+	"MINING-TECHNOLOGIES\0"
+	"Newtec A/S\0"
+	"NEWTEC-A/S\0"
+	"InnoScan K/S\0"
+	"INNOSCAN-K/S\0"
+	"Volumatic Limited\0"
+	"VOLUMATIC\0"
+	"Mueller Elektronik\0"
+	"MUELLER-ELEKTRONIK\0"
+	"aiXtrusion GmbH\0"
+	"AIXTRUSION\0"
+	"LS Elektronik AB\0"
+	"LS-ELEKTRONIK-AB\0"
+	"Cascade Technologies Ltd\0"
+	"CASCADE-TECHNOLOGIES\0"
+	"C&D Technologies, Inc\0"
+	"C-D-TECHNOLOGIES\0"
+	"Zeltiq Aesthetics, Inc.\0"
+	"ZELTIQ-AESTHETICS\0"
+	"DIGITROL LTD\0"
+	"DIGITROL\0"
+	"Progentech Limited\0"
+	"PROGENTECH\0"
+	"Meta Vision Systems Ltd.\0"
+	"META-VISION\0"
+	"Nystrom Engineering\0"
+	"NYSTROM-ENGINEERING\0"
+	"Empirix Italy S.p.A.\0"
+	"EMPIRIX-ITALY\0"
+	"V2Green, Inc.\0"
+	"V2GREEN\0"
+	"Mistral Solutions Pvt. Ltd\0"
+	"MISTRAL-SOLUTIONS-PVT\0"
+	"Sesol Industrial Computer\0"
+	"SESOL-INDUSTRIAL\0"
+	"Lyngsoe Systems\0"
+	"LYNGSOE\0"
+	"Genesis Automation Inc.\0"
+	"GENESIS-AUTOMATION\0"
+	"NH Research\0"
+	"NH-RESEARCH\0"
+	"Network Harbor, Inc.\0"
+	"NETWORK-HARBOR\0"
+	"STUHL Regelsysteme GmbH\0"
+	"STUHL-REGELSYSTEME\0"
+	"Logotherm Regelsysteme GmbH\0"
+	"LOGOTHERM-REGELSYSTEME\0"
+	"SOREC\0"
+	"ACE Carwash Systems\0"
+	"ACE-CARWASH\0"
+	"Wise Industria de Telecomunicações Ldta.\0"
+	"WISE-INDUSTRIA-DE-TELECOMUNICAES-LDTA\0"
+	"Karl DUNGS GmbH & Co. KG\0"
+	"KARL-DUNGS\0"
+	"AutomationX GmbH\0"
+	"AUTOMATIONX\0"
+	"Qtron Pty Ltd\0"
+	"QTRON-PTY\0"
+	"TIS Dialog LLC\0"
+	"TIS-DIALOG\0"
+	"Adeneo\0"
+	"ADENEO\0"
+	"Shenzhen MaiWei Cable TV Equipment CO.,LTD.\0"
+	"SHENZHEN-MAIWEI-CABLE-TV-EQUIPMENT\0"
+	"JANUS srl\0"
+	"JANUS-SRL\0"
+	"dB Broadcast Limited\0"
+	"DB-BROADCAST\0"
+	"SoftSwitching Technologies\0"
+	"SOFTSWITCHING-TECHNOLOGIES\0"
+	"CET\0"
+	"TECHNOMARK\0"
+	"ITB CompuPhase\0"
+	"ITB-COMPUPHASE\0"
+	"Varma Electronics Oy\0"
+	"VARMA-ELECTRONICS-OY\0"
+	"Open Video, Inc.\0"
+	"OPEN-VIDEO\0"
+	"Luxpert Technologies Co., Ltd.\0"
+	"LUXPERT-TECHNOLOGIES\0"
+	"Acube Systems s.r.l.\0"
+	"ACUBE\0"
+	"Bruno International Ltd.\0"
+	"BRUNO\0"
+	"Selekron Microcontrol s.l.\0"
+	"SELEKRON-MICROCONTROL\0"
+	"Alphion Corporation\0"
+	"ALPHION\0"
+	"Open System Solutions Limited\0"
+	"OPEN-SYSTEM-SOLUTIONS\0"
+	"Femto SA\0"
+	"FEMTO\0"
+	"Intelleflex Corporation\0"
+	"INTELLEFLEX\0"
+	"microC Design SRL\0"
+	"MICROC-DESIGN-SRL\0"
+	"Q-Free America, Inc.\0"
+	"Q-FREE-AMERICA\0"
+	"Odin TeleSystems Inc\0"
+	"ODIN-TELESYSTEMS\0"
+	"Wireless Value BV\0"
+	"WIRELESS-VALUE\0"
+	"Cabinplant A/S\0"
+	"CABINPLANT-A/S\0"
+	"InfoGLOBAL\0"
+	"INFOGLOBAL\0"
+	"Brain Tech Co., Ltd\0"
+	"BRAIN-TECH\0"
+	"Telcom\0"
+	"TELCOM\0"
+	"IT SALUX CO., LTD.\0"
+	"IT-SALUX\0"
+	"Channelot Ltd.\0"
+	"CHANNELOT\0"
+	"TESCAN, s.r.o.\0"
+	"TESCAN-S-R-O\0"
+	"MISCO Refractometer\0"
+	"MISCO-REFRACTOMETER\0"
+	"Winner Technology Co, Ltd.\0"
+	"WINNER\0"
+	"Robot Visual Systems GmbH\0"
+	"ROBOT-VISUAL\0"
+	"SMT d.o.o.\0"
+	"SMT-D-O-O\0"
+	"Funkwerk Information Technologies Karlsfeld GmbH\0"
+	"FUNKWERK-INFORMATION-TECHNOLOGIES-KARLSFELD\0"
+	"HEWI Heinrich Wilke GmbH\0"
+	"HEWI-HEINRICH-WILKE\0"
+	"Enero Solutions inc.\0"
+	"ENERO-SOLUTIONS\0"
+	"Intellectronika\0"
+	"INTELLECTRONIKA\0"
+	"VDC Display Systems\0"
+	"VDC-DISPLAY\0"
+	"Vitel Net\0"
+	"VITEL-NET\0"
+	"Elmec, Inc.\0"
+	"LogiCom GmbH\0"
+	"LOGICOM\0"
+	"CompuShop Services LLC\0"
+	"COMPUSHOP-SERVICES\0"
+	"St Jude Medical, Inc.\0"
+	"ST-JUDE-MEDICAL\0"
+	"S1nn GmbH & Co. KG\0"
+	"S1NN\0"
+	"LaserLinc, Inc.\0"
+	"LASERLINC\0"
+	"ANTEK GmbH\0"
+	"ANTEK\0"
+	"Communications Laboratories Inc\0"
+	"COMMUNICATION-LABORATORIES\0"
+	"ID-KARTA s.r.o.\0"
+	"ID-KARTA-S-R-O\0"
+	"T PROJE MUHENDISLIK DIS. TIC. LTD. STI.\0"
+	"T-PROJE-MUHENDISLIK-DIS-TIC-STI\0"
+	"IMS Röntgensysteme GmbH\0"
+	"IMS-ROENTGENSYSTEME\0"
+	"Syr-Tec Engineering & Marketing\0"
+	"SYR-TEC-ENGINEERING-MARKETING\0"
+	"O. Bay AG\0"
+	"O-BAY\0"
+	"hema electronic GmbH\0"
+	"HEMA\0"
+	"beroNet GmbH\0"
+	"BERONET\0"
+	"KPE spol. s r.o.\0"
+	"KPE-SPOL-S-R-O\0"
+	"Residential Control Systems\0"
+	"RESIDENTIAL-CONTROL\0"
+	"Connection Electronics Ltd.\0"
+	"CONNECTION-ELECTRONICS\0"
+	"Quantum Controls BV\0"
+	"QUANTUM-CONTROLS\0"
+	"Xtensor Systems Inc.\0"
+	"XTENSOR\0"
+	"Prodigy Electronics Limited\0"
+	"PRODIGY-ELECTRONICS\0"
+	"VisualSonics Inc.\0"
+	"VISUALSONICS\0"
+	"ESP-Planning Co.\0"
+	"ESP-PLANNING\0"
+	"Lars Morich Kommunikationstechnik GmbH\0"
+	"LARS-MORICH-KOMMUNIKATIONSTECHNIK\0"
+	"DASA ROBOT Co., Ltd.\0"
+	"DASA-ROBOT\0"
+	"Design Analysis Associates, Inc.\0"
+	"DESIGN-ANALYSIS-ASSOCIATES\0"
+	"Keystone Electronic Solutions\0"
+	"KEYSTONE-SOLUTIONS\0"
+	"TASK SISTEMAS DE COMPUTACAO LTDA\0"
+	"TASK-SISTEMAS-DE-COMPUTACAO-LTDA\0"
+	"Performance Motion Devices\0"
+	"PERFORMANCE-MOTION-DEVICES\0"
+	"BMTI\0"
+	"DRACO SYSTEMS\0"
+	"DRACO\0"
+	"Gamber-Johnson LLC\0"
+	"GAMBER-JOHNSON\0"
+	"K.K. Rocky\0"
+	"K-K-ROCKY\0"
+	"SPJ Embedded Technologies Pvt. Ltd.\0"
+	"SPJ-EMBEDDED-TECHNOLOGIES-PVT\0"
+	"eInfochips Ltd.\0"
+	"EINFOCHIPS\0"
+	"Ettus Research LLC\0"
+	"ETTUS-RESEARCH\0"
+	"Ratioplast-Optoelectronics GmbH\0"
+	"RATIOPLAST-OPTOELECTRONICS\0"
+	"Wireless Acquisition LLC\0"
+	"WIRELESS-ACQUISITION\0"
+	"Nuvation\0"
+	"NUVATION\0"
+	"ART SPA\0"
+	"ART-SPA\0"
+	"Boreste\0"
+	"BORESTE\0"
+	"B S E\0"
+	"B-S-E\0"
+	"Ing. Knauseder Mechatronik GmbH\0"
+	"ING-KNAUSEDER-MECHATRONIK\0"
+	"Radiometer Medical ApS\0"
+	"RADIOMETER-MEDICAL-APS\0"
+	"Eutron S.p.A.\0"
+	"EUTRON\0"
+	"Grantronics Pty Ltd\0"
+	"GRANTRONICS-PTY\0"
+	"Elsys AG\0"
+	"ELSYS\0"
+	"Advanced Technology Solutions\0"
+	"ADVANCED-SOLUTIONS\0"
+	"ATG Automatisierungstechnik GERA GmbH\0"
+	"ATG-AUTOMATISIERUNGSTECHNIK-GERA\0"
+	"Persy Control Services B.v.\0"
+	"PERSY-CONTROL-SERVICES-B-V\0"
+	"Syntronics\0"
+	"SYNTRONICS\0"
+	"Aethon, Inc.\0"
+	"AETHON\0"
+	"USM Systems, Ltd\0"
+	"USM\0"
+	"OMB Sistemas Electronicos S.A.\0"
+	"OMB-SISTEMAS-ELECTRONICOS\0"
+	"Condigi Televagt A/S\0"
+	"CONDIGI-TELEVAGT-A/S\0"
+	"HANYANG ELECTRIC CP., LTD\0"
+	"HANYANG-ELECTRIC-CP\0"
+	"b-plus GmbH\0"
+	"B-PLUS\0"
+	"LOGEL S.R.L.\0"
+	"LOGEL\0"
+	"R-S-I Elektrotechnik GmbH & Co. KG\0"
+	"R-S-I-ELEKTROTECHNIK\0"
+	"Oliotalo Oy\0"
+	"OLIOTALO-OY\0"
+	"XRONET Corporation\0"
+	"XRONET\0"
+	"Arcos Technologies Ltd.\0"
+	"ARCOS-TECHNOLOGIES\0"
+	"Privatquelle Gruber GmbH & CO KG\0"
+	"PRIVATQUELLE-GRUBER\0"
+	"Motion Analysis Corp\0"
+	"Acoustic Research Laboratories Pty Ltd\0"
+	"ACOUSTIC-RESEARCH-LABORATORIES-PTY\0"
+	"MILESYS\0"
+	"Spectrum Management, LC\0"
+	"SPECTRUM-MANAGEMENT-LC\0"
+	"UAVNavigation S.L.\0"
+	"UAVNAVIGATION\0"
+	"Arcontia AB\0"
+	"ARCONTIA-AB\0"
+	"AT&T Government Solutions\0"
+	"AT-T-GOVERNMENT-SOLUTIONS\0"
+	"SCM PRODUCTS, INC.\0"
+	"SCM-PRODUCTS\0"
+	"Optoelettronica Italia S.r.l.\0"
+	"OPTOELETTRONICA-ITALIA\0"
+	"Creation Technologies Chicago\0"
+	"CREATION-TECHNOLOGIES-CHICAGO\0"
+	"InnoTrans Communications, Inc.\0"
+	"INNOTRANS-COMMUNICATION\0"
+	"WARECUBE,INC.\0"
+	"WARECUBE\0"
+	"Neocontrol Soluções em Automação\0"
+	"NEOCONTROL-SOLUES-EM-AUTOMAO\0"
+	"IP Thinking A/S\0"
+	"IP-THINKING-A/S\0"
+	"OOO NTK IMOS\0"
+	"OOO-NTK-IMOS\0"
+	"Wartsila Voyage Oy\0"
+	"WARTSILA-VOYAGE-OY\0"
+	"Inventis Technology Pty Limited\0"
+	"INVENTIS-PTY\0"
+	"IAdea Corporation\0"
+	"IADEA\0"
+	"ACS Motion Control Ltd.\0"
+	"ACS-MOTION-CONTROL\0"
+	"Continental Electronics Corp.\0"
+	"CONTINENTAL-ELECTRONICS\0"
+	"Hollis Electronics Company LLC\0"
+	"HOLLIS-ELECTRONICS-COMPANY\0"
+	"Z-App Systems\0"
+	"Z-APP\0"
+	"L3 Communications Nova Engineering\0"
+	"L3-COMMUNICATION-NOVA-ENGINEERING\0"
+	"Cardinal Scale Mfg Co\0"
+	"CARDINAL-SCALE-MFG\0"
+	"Keynote SIGOS GmbH\0"
+	"KEYNOTE-SIGOS\0"
+	"BAE Systems Hägglunds AB\0"
+	"BAE-HAEGGLUNDS-AB\0"
+	"Trakce a.s.\0"
+	"TRAKCE\0"
+	"EIZO Technologies GmbH\0"
+	"EIZO-TECHNOLOGIES\0"
+	"Marine Communications Limited\0"
+	"MARINE-COMMUNICATION\0"
+	"Blankom\0"
+	"BLANKOM\0"
+	"ODF Optronics, Inc.\0"
+	"ODF-OPTRONICS\0"
+	"Veeco Process Equipment, Inc.\0"
+	"VEECO-PROCESS-EQUIPMENT\0"
+	"Inico Technologies Ltd.\0"
+	"INICO-TECHNOLOGIES\0"
+	"Neptune Technology Group Inc.\0"
+	"NEPTUNE-GROUP\0"
+	"Sensata Technologies\0"
+	"SENSATA-TECHNOLOGIES\0"
+	"Mediana\0"
+	"MEDIANA\0"
+	"Systemtechnik GmbH\0"
+	"SYSTEMTECHNIK\0"
+	"Broadcast Electronics\0"
+	"BROADCAST-ELECTRONICS\0"
+	"Datalink Technologies Gateways Inc.\0"
+	"DATALINK-TECHNOLOGIES-GATEWAYS\0"
+	"Specialized Communications Corp.\0"
+	"SPECIALIZED-COMMUNICATION\0"
+	"Intune Networks\0"
+	"INTUNE-NETWORKS\0"
+	"UAVISION Engenharia de Sistemas\0"
+	"UAVISION-ENGENHARIA-DE-SISTEMAS\0"
+	"RTW GmbH & Co.KG\0"
+	"RTW\0"
+	"BALOGH T.A.G Corporation\0"
+	"BALOGH-T-A-G\0"
+	"Mocon, Inc.\0"
+	"MOCON\0"
+	"PIXEYE LTD\0"
+	"PIXEYE\0"
+	"ALTEK ELECTRONICS\0"
+	"ALTEK-ELECTRONICS\0"
+	"Intelligent Security Systems\0"
+	"INTELLIGENT-SECURITY\0"
+	"ATS Elektronik GmbH\0"
+	"ATS-ELEKTRONIK\0"
+	"Nanomotion Ltd.\0"
+	"NANOMOTION\0"
+	"Telsa s.r.l\0"
+	"TELSA\0"
+	"Thales Communications Inc\0"
+	"DESARROLLO DE SISTEMAS INTEGRADOS DE CONTROL S.A.\0"
+	"DESARROLLO-DE-SISTEMAS-INTEGRADOS-DE-CONTROL\0"
+	"Xelerated\0"
+	"XELERATED\0"
+	"BK Innovation, Inc.\0"
+	"BK-INNOVATION\0"
+	"RingCube Technologies, Inc.\0"
+	"RINGCUBE-TECHNOLOGIES\0"
+	"SERVAIND SA.\0"
+	"SERVAIND\0"
+	"VTQ Videtronik GmbH\0"
+	"VTQ-VIDETRONIK\0"
+	"Sandar Telecast AS\0"
+	"SANDAR-TELECAST-AS\0"
+	"Shadrinskiy Telefonny Zavod\0"
+	"SHADRINSKIY-TELEFONNY-ZAVOD\0"
+	"Calnex Solutions plc\0"
+	"CALNEX-SOLUTIONS-PLC\0"
+	"smtag international ag\0"
+	"SMTAG\0"
+	"Honeywell Sensotec\0"
+	"HONEYWELL-SENSOTEC\0"
+	"Matrix Switch Corporation\0"
+	"MATRIX-SWITCH\0"
+	"The Pennsylvania State University\0"
+	"THE-PENNSYLVANIA-STATE-UNIVERSITY\0"
+	"ARISTO Graphic Systeme GmbH & Co. KG\0"
+	"ARISTO-GRAPHIC-SYSTEME\0"
+	"S.C.E. s.r.l.\0"
+	"S-C-E\0"
+	"Heraeus Noblelight GmbH\0"
+	"HERAEUS-NOBLELIGHT\0"
+	"Access Control Systems JSC\0"
+	"ACCESS-CONTROL-JSC\0"
+	"Byte Paradigm\0"
+	"BYTE-PARADIGM\0"
+	"Soldig Industria e Comercio de Equipamentos Eletronicos LTDA\0"
+	"SOLDIG-INDUSTRIA-E-COMERCIO-DE-EQUIPAMENTOS-ELETRONICOS-LTDA\0"
+	"Vortex Engineering pvt ltd\0"
+	"VORTEX-ENGINEERING-PVT\0"
+	"Pumatronix Equipamentos Eletronicos Ltda.\0"
+	"PUMATRONIX-EQUIPAMENTOS-ELETRONICOS-LTDA\0"
+	"A+S Aktuatorik und Sensorik GmbH\0"
+	"A+S-AKTUATORIK-UND-SENSORIK\0"
+	"Altair semiconductor Ltd\0"
+	"ALTAIR-SEMICONDUCTOR\0"
+	"Beonic Corporation\0"
+	"BEONIC\0"
+	"LyconSys GmbH & Co.KG\0"
+	"LYCONSYS\0"
+	"Cambridge Sound Management, LLC\0"
+	"CAMBRIDGE-SOUND-MANAGEMENT\0"
+	"GigaLinx Ltd.\0"
+	"GIGALINX\0"
+	"Bachmann Monitoring GmbH\0"
+	"BACHMANN-MONITORING\0"
+	"TTi Ltd\0"
+	"TTI\0"
+	"IFAM GmbH\0"
+	"IFAM\0"
+	"INTERNET PROTOCOLO LOGICA SL\0"
+	"INTERNET-PROTOCOLO-LOGICA-SL\0"
+	"Peek Traffic Corp\0"
+	"PEEK-TRAFFIC\0"
+	"UltraVision Security Systems, Inc.\0"
+	"ULTRAVISION-SECURITY\0"
+	"Polygon Informatics Ltd.\0"
+	"POLYGON-INFORMATICS\0"
+	"Array Technologies Inc\0"
+	"ARRAY-TECHNOLOGIES\0"
+	"Industrial Control and Communication Limited\0"
+	"INDUSTRIAL-CONTROL-AND-COMMUNICATION\0"
+	"DOCUTEMP, INC\0"
+	"DOCUTEMP\0"
+	"DCOM Network Technology (Pty) Ltd\0"
+	"DCOM-NETWORK-PTY\0"
+	"Frame Systems Limited\0"
+	"FRAME\0"
+	"GIMCON\0"
+	"Coherix, Inc\0"
+	"COHERIX\0"
+	"Dipl.-Ing. W. Nophut GmbH\0"
+	"DIPL-ING-W-NOPHUT\0"
+	"Shenzhen Pennda Technologies Co., Ltd.\0"
+	"SHENZHEN-PENNDA-TECHNOLOGIES\0"
+	"Deutscher Weterdienst\0"
+	"DEUTSCHER-WETERDIENST\0"
+	"bioMérieux Italia S.p.A.\0"
+	"BIOMRIEUX-ITALIA\0"
+	"MaCaPS International Limited\0"
+	"MACAPS\0"
+	"Berthel GmbH\0"
+	"BERTHEL\0"
+	"Sandel Avionics, Inc.\0"
+	"SANDEL-AVIONICS\0"
+	"MKT Systemtechnik\0"
+	"MKT-SYSTEMTECHNIK\0"
+	"Friedrich Kuhnt GmbH\0"
+	"FRIEDRICH-KUHNT\0"
+	"UNIDATA\0"
+	"C-COM Satellite Systems Inc.\0"
+	"C-COM-SATELLITE\0"
+	"Balfour Beatty Rail GmbH\0"
+	"BALFOUR-BEATTY-RAIL\0"
+	"AT-Automation Technology GmbH\0"
+	"AT-AUTOMATION\0"
+	"Technologies Sensio Inc\0"
+	"TECHNOLOGIES-SENSIO\0"
+	"Xentras Communications\0"
+	"XENTRAS-COMMUNICATION\0"
+	"Detection Technologies Ltd.\0"
+	"DETECTION-TECHNOLOGIES\0"
+	"Schneider Electric GmbH\0"
+	"SCHNEIDER-ELECTRIC\0"
+	"Curtis Door Systems Inc\0"
+	"CURTIS-DOOR\0"
+	"tec5 AG\0"
+	"TEC5\0"
+	"K-MAC Corp.\0"
+	"K-MAC\0"
+	"TGE Co., Ltd.\0"
+	"TGE\0"
+	"RMSD LTD\0"
+	"RMSD\0"
+	"TELIUM s.c.\0"
+	"TELIUM-S-C\0"
+	"Alfred Kuhse GmbH\0"
+	"ALFRED-KUHSE\0"
+	"Symetrics Industries\0"
+	"SYMETRICS-INDUSTRIES\0"
+	"Sindoma Müh Mim Ýnþ Elk San Tic Ltd.\0"
+	"SINDOMA-MUEH-MIM-N-ELK-SAN-TIC\0"
+	"Cross Country Systems AB\0"
+	"CROSS-COUNTRY-AB\0"
+	"Luceat\0"
+	"LUCEAT\0"
+	"Magor Communications Corp\0"
+	"MAGOR-COMMUNICATION\0"
+	"Research Applications Incorp\0"
+	"RESEARCH-APPLICATIONS-INCORP\0"
+	"China Railway Signal & Communication Corp.\0"
+	"CHINA-RAILWAY-SIGNAL-COMMUNICATION\0"
+	"EcoAxis Systems Pvt. Ltd.\0"
+	"ECOAXIS-PVT\0"
+	"R2Sonic, LLC\0"
+	"R2SONIC\0"
+	"Link Communications, Inc\0"
+	"LINK-COMMUNICATION\0"
+	"Gidel\0"
+	"GIDEL\0"
+	"Cristal Controles Ltee\0"
+	"CRISTAL-CONTROLES-LTEE\0"
+	"Codex Digital Ltd\0"
+	"CODEX-DIGITAL\0"
+	"Elisra\0"
+	"ELISRA\0"
+	"Board Level Limited\0"
+	"BOARD-LEVEL\0"
+	"E.ON ES Sverige AB\0"
+	"E-ON-ES-SVERIGE-AB\0"
+	"LSS GmbH\0"
+	"LSS\0"
+	"EVK DI Kerschhaggl GmbH\0"
+	"EVK-DI-KERSCHHAGGL\0"
+	"INTEGRA Biosciences AG\0"
+	"INTEGRA-BIOSCIENCES\0"
+	"Autotank AB\0"
+	"AUTOTANK-AB\0"
+	"Vapor Rail\0"
+	"VAPOR-RAIL\0"
+	"ASSET InterTech, Inc.\0"
+	"ASSET-INTERTECH\0"
+	"Leonardo UK Ltd\0"
+	"LEONARDO-UK\0"
+	"IO-Connect\0"
+	"IO-CONNECT\0"
+	"Verint Systems Ltd.\0"
+	"CHK GridSense P/L\0"
+	"CHK-GRIDSENSE-P/L\0"
+	"CIRTEM\0"
+	"Design Lightning Corp\0"
+	"DESIGN-LIGHTNING\0"
+	"AHV Systems, Inc.\0"
+	"AHV\0"
+	"Xtone Networks\0"
+	"XTONE-NETWORKS\0"
+	"Embedded Data Systems, LLC\0"
+	"EMBEDDED-DATA\0"
+	"Rosendahl Studiotechnik GmbH\0"
+	"ROSENDAHL-STUDIOTECHNIK\0"
+	"Automation Tec\0"
+	"AUTOMATION-TEC\0"
+	"2NCOMM DESIGN SRL\0"
+	"2NCOMM-DESIGN-SRL\0"
+	"Rogue Engineering Inc.\0"
+	"ROGUE-ENGINEERING\0"
+	"iQue RFID Technologies BV\0"
+	"IQUE-RFID-TECHNOLOGIES\0"
+	"Metrum Sweden AB\0"
+	"METRUM-SWEDEN-AB\0"
+	"Amicus Wireless\0"
+	"AMICUS-WIRELESS\0"
+	"Link Electric & Safety Control Co.\0"
+	"LINK-ELECTRIC-SAFETY-CONTROL\0"
+	"PHB Eletronica Ltda.\0"
+	"PHB-ELETRONICA-LTDA\0"
+	"DiTEST Fahrzeugdiagnose GmbH\0"
+	"DITEST-FAHRZEUGDIAGNOSE\0"
+	"ATIS group s.r.o.\0"
+	"ATIS-GROUP-S-R-O\0"
+	"Cinetix GmbH\0"
+	"CINETIX\0"
+	"Flight Deck Resources\0"
+	"FLIGHT-DECK-RESOURCES\0"
+	"Exatrol Corporation\0"
+	"EXATROL\0"
+	"APProSoftware.com\0"
+	"APPROSOFTWARE-COM\0"
+	"Goanna Technologies Pty Ltd\0"
+	"GOANNA-TECHNOLOGIES-PTY\0"
+	"NETA Elektronik AS\0"
+	"NETA-ELEKTRONIK-AS\0"
+	"Korea Telecom Internet Solutions (KTIS)\0"
+	"KOREA-TELECOM-INTERNET-SOLUTIONS-KTIS\0"
+	"SMAVIS Inc.\0"
+	"SMAVIS\0"
+	"Xilar Corp.\0"
+	"XILAR\0"
+	"Image Video\0"
+	"IMAGE-VIDEO\0"
+	"Margaritis Engineering\0"
+	"MARGARITIS-ENGINEERING\0"
+	"BigBear\0"
+	"BIGBEAR\0"
+	"Postec Data Systems Ltd\0"
+	"Mosaic Dynamic Solutions\0"
+	"MOSAIC-DYNAMIC-SOLUTIONS\0"
+	"ALPHATRONICS nv\0"
+	"ALPHATRONICS-NV\0"
+	"Cleaveland/Price, Inc.\0"
+	"CLEAVELAND/PRICE\0"
+	"FractureCode Corporation\0"
+	"FRACTURECODE\0"
+	"Lighting Science Group\0"
+	"LIGHTING-SCIENCE-GROUP\0"
+	"RCS Communication Test Systems Ltd.\0"
+	"RCS-COMMUNICATION-TEST\0"
+	"Phitek Systems Ltd.\0"
+	"PHITEK\0"
+	"Rolbit\0"
+	"ROLBIT\0"
+	"QuanZhou TDX Electronics Co., Ltd.\0"
+	"QUANZHOU-TDX-ELECTRONICS\0"
+	"Wireonair A/S\0"
+	"WIREONAIR-A/S\0"
+	"Exi Flow Measurement Ltd\0"
+	"EXI-FLOW-MEASUREMENT\0"
+	"MEGWARE Computer GmbH\0"
+	"MEGWARE\0"
+	"IMEXHIGHWAY cvba\0"
+	"IMEXHIGHWAY-CVBA\0"
+	"ELECTRONIA\0"
+	"taskit GmbH\0"
+	"TASKIT\0"
+	"TruMedia Measurement Ltd.\0"
+	"TRUMEDIA-MEASUREMENT\0"
+	"Piller engineering Ltd.\0"
+	"PILLER-ENGINEERING\0"
+	"TEMIX\0"
+	"C&H technology  ltd.\0"
+	"C-H\0"
+	"Zynix Original Sdn. Bhd.\0"
+	"ZYNIX-ORIGINAL\0"
+	"IT-Designers GmbH\0"
+	"IT-DESIGNERS\0"
+	"Tele and Radio Research Institute\0"
+	"TELE-AND-RADIO-RESEARCH-INSTITUTE\0"
+	"EL.C.A. soc. coop.\0"
+	"EL-C-A-SOC-COOP\0"
+	"Tech Fass s.r.o.\0"
+	"TECH-FASS-S-R-O\0"
+	"Roessmann Engineering\0"
+	"ROESSMANN-ENGINEERING\0"
+	"STRATEC Control Systems\0"
+	"STRATEC-CONTROL\0"
+	"Sensoptics Ltd\0"
+	"SENSOPTICS\0"
+	"DECTRIS Ltd.\0"
+	"DECTRIS\0"
+	"TechnoAP\0"
+	"TECHNOAP\0"
+	"AS Solar GmbH\0"
+	"AS-SOLAR\0"
+	"Resurgent Health & Medical\0"
+	"RESURGENT-HEALTH-MEDICAL\0"
+	"full electronic system\0"
+	"FULL-SYSTEM\0"
+	"BEEcube Inc.\0"
+	"BEECUBE\0"
+	"METRONIC APARATURA KONTROLNO - POMIAROWA\0"
+	"METRONIC-APARATURA-KONTROLNO-POMIAROWA\0"
+	"kuroneko dennnou kenkyuushitsu\0"
+	"KURONEKO-DENNNOU-KENKYUUSHITSU\0"
+	"Picsolve International Limited\0"
+	"PICSOLVE\0"
+	"Lécureux SA\0"
+	"LCUREUX\0"
+	"IQ Automation GmbH\0"
+	"IQ-AUTOMATION\0"
+	"PCM Industries\0"
+	"PCM-INDUSTRIES\0"
+	"Watthour Engineering Co., Inc.\0"
+	"WATTHOUR-ENGINEERING\0"
+	"BuLogics, Inc.\0"
+	"BULOGICS\0"
+	"Gehrke Kommunikationssysteme GmbH\0"
+	"GEHRKE-KOMMUNIKATIONSSYSTEME\0"
+	"Bittium Wireless Ltd\0"
+	"BITTIUM-WIRELESS\0"
+	"Electronic Media Services Ltd\0"
+	"MEDIA-SERVICES\0"
+	"Aqua Cooler Pty Ltd\0"
+	"AQUA-COOLER-PTY\0"
+	"Keene Electronics Ltd.\0"
+	"KEENE-ELECTRONICS\0"
+	"Peek Traffic Corporation\0"
+	"Varec Inc.\0"
+	"VAREC\0"
+	"Tsuji Electronics Co.,Ltd\0"
+	"TSUJI-ELECTRONICS\0"
+	"Switch Science (Panini Keikaku)\0"
+	"SWITCH-SCIENCE-PANINI-KEIKAKU\0"
+	"Systèmes Pran\0"
+	"SYSTMES-PRAN\0"
+	"Pyramid Technical Consultants\0"
+	"PYRAMID-TECHNICAL-CONSULTANTS\0"
+	"SANDS INSTRUMENTATION INDIA PVT LTD\0"
+	"SANDS-INSTRUMENTATION-INDIA-PVT\0"
+	"LOGITAL DIGITAL MEDIA srl\0"
+	"LOGITAL-DIGITAL-MEDIA-SRL\0"
+	"Far South Networks (Pty) Ltd\0"
+	"FAR-SOUTH-NETWORKS-PTY\0"
+	"KST Technology Co., Ltd\0"
+	"KST\0"
+	"SMARTQUANTUM SA\0"
+	"SMARTQUANTUM\0"
+	"Creacon Technologies B.V.\0"
+	"CREACON-TECHNOLOGIES-B-V\0"
+	"Soehnle Professional GmbH & Co.KG\0"
+	"SOEHNLE-PROFESSIONAL\0"
+	"RF Industries\0"
+	"RF-INDUSTRIES\0"
+	"C&I  Co.Ltd\0"
+	"C-I\0"
+	"Digital Payment Technologies\0"
+	"DIGITAL-PAYMENT-TECHNOLOGIES\0"
+	"Novotronik GmbH\0"
+	"NOVOTRONIK\0"
+	"Triple Ring Technologies, Inc.\0"
+	"TRIPLE-RING-TECHNOLOGIES\0"
+	"Bogart Engineering\0"
+	"BOGART-ENGINEERING\0"
+	"Atel Corporation\0"
+	"ATEL\0"
+	"Earnestcom Sdn Bhd\0"
+	"EARNESTCOM\0"
+	"DSCI\0"
+	"Joinsoon Electronics MFG. Co., Ltd\0"
+	"JOINSOON-ELECTRONICS-MFG\0"
+	"Pantel International\0"
+	"PANTEL\0"
+	"Psigenics Corporation\0"
+	"PSIGENICS\0"
+	"MEV Limited\0"
+	"MEV\0"
+	"TI2000 TECNOLOGIA INFORMATICA 2000\0"
+	"TI2000-TECNOLOGIA-INFORMATICA-2000\0"
+	"MGM-Devices Oy\0"
+	"MGM-DEVICES-OY\0"
+	"Mecos AG\0"
+	"MECOS\0"
+	"Link Technologies, Inc\0"
+	"LINK-TECHNOLOGIES\0"
+	"UGL Limited\0"
+	"UGL\0"
+	"IDT Sound Processing Corporation\0"
+	"IDT-SOUND-PROCESSING\0"
+	"UNETCONVERGENCE CO., LTD\0"
+	"UNETCONVERGENCE\0"
+	"Xafax Nederland bv\0"
+	"XAFAX-NEDERLAND\0"
+	"Inter Control Hermann Köhler  Elektrik GmbH&Co.KG\0"
+	"INTER-CONTROL-HERMANN-KOEHLER-ELEKTRIK\0"
+	"Commercial Timesharing Inc.\0"
+	"COMMERCIAL-TIMESHARING\0"
+	"Depro Électronique\0"
+	"DEPRO-LECTRONIQUE\0"
+	"Cambustion Ltd\0"
+	"CAMBUSTION\0"
+	"Miromico AG\0"
+	"MIROMICO\0"
+	"Bettini srl\0"
+	"BETTINI-SRL\0"
+	"CaTs3 Limited\0"
+	"CATS3\0"
+	"Powersense A/S\0"
+	"POWERSENSE-A/S\0"
+	"Engage Technologies\0"
+	"ENGAGE-TECHNOLOGIES\0"
+	"Sietron Elektronik\0"
+	"SIETRON-ELEKTRONIK\0"
+	"Trs Systems, Inc.\0"
+	"TRS\0"
+	"ComAp s.r.o\0"
+	"COMAP-S-R-O\0"
+	"SAMsystems GmbH\0"
+	"SAMSYSTEMS\0"
+	"Entwicklung Hard- & Software\0"
+	"ENTWICKLUNG-HARD-SOFTWARE\0"
+	"Conolog Corporation\0"
+	"CONOLOG\0"
+	"Metodo2\0"
+	"METODO2\0"
+	"Thales Communications & Security S.A.\0"
+	"THALES-COMMUNICATION-SECURITY\0"
+	"DOMIS SA\0"
+	"DOMIS\0"
+	"TEKO TELECOM SpA\0"
+	"TEKO-TELECOM-SPA\0"
+	"Electrodata Inc.\0"
+	"ELECTRODATA\0"
+	"Questek Australia Pty Ltd\0"
+	"QUESTEK-AUSTRALIA-PTY\0"
+	"Chronos Technology Ltd.\0"
+	"CHRONOS\0"
+	"KRESS-NET Krzysztof Rutecki\0"
+	"KRESS-NET-KRZYSZTOF-RUTECKI\0"
+	"Ebru GmbH\0"
+	"EBRU\0"
+	"Bon Hora GmbH\0"
+	"BON-HORA\0"
+	"Mesa Labs, Inc.\0"
+	"MESA-LABS\0"
+	"Kahler Automation\0"
+	"KAHLER-AUTOMATION\0"
+	"EUKREA ELECTROMATIQUE SARL\0"
+	"EUKREA-ELECTROMATIQUE-SARL\0"
+	"Telegamma srl\0"
+	"TELEGAMMA-SRL\0"
+	"ACTECH\0"
+	"Sound Player Systems e.K.\0"
+	"SOUND-PLAYER-E-K\0"
+	"ISA - Intelligent Sensing Anywhere, S.A.\0"
+	"ISA-INTELLIGENT-SENSING-ANYWHERE\0"
+	"Connor-Winfield\0"
+	"CONNOR-WINFIELD\0"
+	"Kistler Straubenhardt GmbH\0"
+	"KISTLER-STRAUBENHARDT\0"
+	"Sensitron Semiconductor\0"
+	"SENSITRON-SEMICONDUCTOR\0"
+	"Xad Communications Ltd\0"
+	"XAD-COMMUNICATION\0"
+	"Stuyts Engineering Haarlem BV\0"
+	"STUYTS-ENGINEERING-HAARLEM\0"
+	"Team Enginers\0"
+	"TEAM-ENGINERS\0"
+	"Scansonic MI GmbH\0"
+	"SCANSONIC-MI\0"
+	"Protronic GmbH\0"
+	"PROTRONIC\0"
+	"Kumera Drives Oy\0"
+	"KUMERA-DRIVES-OY\0"
+	"ethermetrics\0"
+	"ETHERMETRICS\0"
+	"LUMINEX Lighting Control Equipment\0"
+	"LUMINEX-LIGHTING-CONTROL-EQUIPMENT\0"
+	"ESAB-ATAS GmbH\0"
+	"ESAB-ATAS\0"
+	"NIS-time GmbH\0"
+	"NIS-TIME\0"
+	"Hirotech inc.\0"
+	"HIROTECH\0"
+	"Uwe Schneider GmbH\0"
+	"UWE-SCHNEIDER\0"
+	"Ronan Engineering\0"
+	"RONAN-ENGINEERING\0"
+	"J. DITTRICH ELEKTRONIC GmbH & Co. KG\0"
+	"J-DITTRICH-ELEKTRONIC\0"
+	"Bladelius Design Group AB\0"
+	"BLADELIUS-DESIGN-GROUP-AB\0"
+	"Telemetrie Elektronik GmbH\0"
+	"TELEMETRIE-ELEKTRONIK\0"
+	"FIRST\0"
+	"Netpower Labs AB\0"
+	"NETPOWER-LABS-AB\0"
+	"Melex Inc.\0"
+	"MELEX\0"
+	"SAMSUNG HEAVY INDUSTRIES CO.,LTD.\0"
+	"SAMSUNG-HEAVY-INDUSTRIES\0"
+	"CNS Systems, Inc.\0"
+	"CNS\0"
+	"NEUTRONIK e.K.\0"
+	"NEUTRONIK-E-K\0"
+	"Walter Grotkasten\0"
+	"WALTER-GROTKASTEN\0"
+	"FTM Marketing Limited\0"
+	"FTM-MARKETING\0"
+	"Institut Dr. Foerster\0"
+	"INSTITUT-DR-FOERSTER\0"
+	"CODEC Co., Ltd.\0"
+	"CODEC\0"
+	"DST Swiss AG\0"
+	"DST-SWISS\0"
+	"Enreduce Energy Control AB\0"
+	"ENREDUCE-ENERGY-CONTROL-AB\0"
+	"E-ViEWS SAFETY SYSTEMS, INC\0"
+	"E-VIEWS-SAFETY\0"
+	"SAI Informationstechnik\0"
+	"SAI-INFORMATIONSTECHNIK\0"
+	"Pyxis Controls WLL\0"
+	"PYXIS-CONTROLS-WLL\0"
+	"Halliburton Far East Pte Ltd\0"
+	"HALLIBURTON-FAR-EAST-PTE\0"
+	"Kumho Electric, Inc.\0"
+	"KUMHO-ELECTRIC\0"
+	"Hammock Corporation\0"
+	"HAMMOCK\0"
+	"Ciemme Sistemi Spa\0"
+	"CIEMME-SISTEMI-SPA\0"
+	"SISMODULAR - Engenharia, Lda\0"
+	"SISMODULAR-ENGENHARIA-LDA\0"
+	"AFORE Solutions Inc.\0"
+	"AFORE-SOLUTIONS\0"
+	"Picell B.V.\0"
+	"PICELL-B-V\0"
+	"Michael Stevens & Partners Ltd\0"
+	"MICHAEL-STEVENS-PARTNERS\0"
+	"WoKa-Elektronik GmbH\0"
+	"WOKA-ELEKTRONIK\0"
+	"Veracity UK Ltd\0"
+	"VERACITY-UK\0"
+	"IDEAS s.r.l.\0"
+	"IDEAS\0"
+	"Vision Technologies, Inc.\0"
+	"VISION-TECHNOLOGIES\0"
+	"FSR, INC.\0"
+	"FSR\0"
+	"Commex Technologies\0"
+	"COMMEX-TECHNOLOGIES\0"
+	"Ion Sense Inc.\0"
+	"ION-SENSE\0"
+	"Dave Jones Design\0"
+	"DAVE-JONES-DESIGN\0"
+	"Teranex A Division of Silicon Optix\0"
+	"TERANEX-A-DIVISION-OF-SILICON-OPTIX\0"
+	"Villbau Kft.\0"
+	"VILLBAU-KFT\0"
+	"ECTEC INC.\0"
+	"ECTEC\0"
+	"Bitt technology-A Ltd.\0"
+	"BITT-A\0"
+	"SPECTRA EMBEDDED SYSTEMS\0"
+	"SPECTRA-EMBEDDED\0"
+	"Humphrey Products\0"
+	"HUMPHREY-PRODUCTS\0"
+	"Technovare Systems\0"
+	"Patronics International LTD\0"
+	"PATRONICS\0"
+	"Reference, LLC.\0"
+	"REFERENCE\0"
+	"EEG Enterprises Inc\0"
+	"EEG-ENTERPRISES\0"
+	"TP Radio\0"
+	"TP-RADIO\0"
+	"Adgil Design Inc.\0"
+	"ADGIL-DESIGN\0"
+	"CLOOS ELECTRONIC GMBH\0"
+	"CLOOS\0"
+	"Dynon Instruments\0"
+	"DYNON-INSTRUMENTS\0"
+	"Innovative American Technology\0"
+	"INNOVATIVE-AMERICAN\0"
+	"IDS GeoRadar s.r.l.\0"
+	"IDS-GEORADAR\0"
+	"CHARLYROBOT\0"
+	"ENGICAM s.r.l.\0"
+	"ENGICAM\0"
+	"Visualware Inc\0"
+	"VISUALWARE\0"
+	"Essential Design & Integration P/L\0"
+	"ESSENTIAL-DESIGN-INTEGRATION-P/L\0"
+	"OJSC Rawenstvo\0"
+	"OJSC-RAWENSTVO\0"
+	"HCE Engineering S.r.l.\0"
+	"HCE-ENGINEERING\0"
+	"Talyst, Inc.\0"
+	"TALYST\0"
+	"Elbit Systems of America - Tallahassee Operations\0"
+	"ELBIT-OF-AMERICA-TALLAHASSEE-OPERATIONS\0"
+	"Industrial Computing Ltd\0"
+	"INDUSTRIAL-COMPUTING\0"
+	"Winners Satellite Electronics Corp.\0"
+	"WINNERS-SATELLITE-ELECTRONICS\0"
+	"Eoslink\0"
+	"EOSLINK\0"
+	"DDL\0"
+	"Realtime Systems Ltd.\0"
+	"REALTIME\0"
+	"Microtechnica\0"
+	"MICROTECHNICA\0"
+	"SAMH Engineering Services\0"
+	"SAMH-ENGINEERING-SERVICES\0"
+	"MAMAC Systems, Inc.\0"
+	"MAMAC\0"
+	"Flight Data Systems Pty Ltd\0"
+	"FLIGHT-DATA-PTY\0"
+	"Quorum Technologies Ltd\0"
+	"QUORUM-TECHNOLOGIES\0"
+	"ISAC SRL\0"
+	"ISAC-SRL\0"
+	"Nippon Manufacturing Service Corporation (abbreviated as 'nms')\0"
+	"NIPPON-MANUFACTURING-SERVICE-ABBREVIATED-AS-NMS\0"
+	"Agility Mfg, Inc.\0"
+	"AGILITY-MFG\0"
+	"Preferred Oil, LLC\0"
+	"PREFERRED-OIL\0"
+	"meconet e. K.\0"
+	"MECONET-E-K\0"
+	"KENDA ELECTRONIC SYSTEMS LIMITED\0"
+	"KENDA\0"
+	"Luminex Corporation\0"
+	"LUMINEX\0"
+	"Astronics Custom Control Concepts\0"
+	"ASTRONICS-CUSTOM-CONTROL-CONCEPTS\0"
+	"APRILIA RACING S.R.L.\0"
+	"APRILIA-RACING\0"
+	"KWS-Electronic GmbH\0"
+	"KWS\0"
+	"Inventure Inc.\0"
+	"INVENTURE\0"
+	"DragonFly Scientific LLC\0"
+	"DRAGONFLY-SCIENTIFIC\0"
+	"D-TA Systems\0"
+	"D-TA\0"
+	"Coolit Systems, Inc.\0"
+	"COOLIT\0"
+	"Harris Designs of NRV, Inc.\0"
+	"HARRIS-DESIGNS-OF-NRV\0"
+	"Fuji Firmware\0"
+	"FUJI-FIRMWARE\0"
+	"Appareo Systems, LLC\0"
+	"APPAREO\0"
+	"Shenzhen Shangji electronic Co.Ltd\0"
+	"SHENZHEN-SHANGJI\0"
+	"Software Systems Plus\0"
+	"SOFTWARE-PLUS\0"
+	"Tred Displays\0"
+	"TRED-DISPLAYS\0"
+	"Industrial Data Products Ltd\0"
+	"INDUSTRIAL-DATA-PRODUCTS\0"
+	"Telecor Inc.\0"
+	"TELECOR\0"
+	"IPcontrols GmbH\0"
+	"IPCONTROLS\0"
+	"Brähler ICS Konferenztechnik AG\0"
+	"BRAEHLER-ICS-KONFERENZTECHNIK\0"
+	"OWANDY\0"
+	"DUEVI SNC DI MORA E SANTESE\0"
+	"DUEVI-SNC-DI-MORA-E-SANTESE\0"
+	"LHA Systems CC\0"
+	"LHA-CC\0"
+	"Mosberger Consulting LLC\0"
+	"MOSBERGER-CONSULTING\0"
+	"Meiryo Denshi Corp.\0"
+	"MEIRYO-DENSHI\0"
+	"RealVision Inc.\0"
+	"REALVISION\0"
+	"NKS Co.Ltd.\0"
+	"NKS\0"
+	"TORC Technologies\0"
+	"TORC-TECHNOLOGIES\0"
+	"Sofradir-EC\0"
+	"SOFRADIR-EC\0"
+	"Softronics Ltd.\0"
+	"SOFTRONICS\0"
+	"PRIMETECH ENGINEERING CORP.\0"
+	"PRIMETECH-ENGINEERING\0"
+	"Thales UK Limited\0"
+	"Wayne Dalton Corp.\0"
+	"WAYNE-DALTON\0"
+	"DITRON S.r.l.\0"
+	"DITRON\0"
+	"VasoNova, Inc.\0"
+	"VASONOVA\0"
+	"LevelStar LLC.\0"
+	"LEVELSTAR\0"
+	"Conduant Corporation\0"
+	"CONDUANT\0"
+	"Deuta GmbH\0"
+	"DEUTA\0"
+	"i-RED Infrarot Systeme GmbH\0"
+	"I-RED-INFRAROT-SYSTEME\0"
+	"Y-products co.ltd.\0"
+	"Y-PRODUCTS\0"
+	"The VON Corporation\0"
+	"THE-VON\0"
+	"Quality & Design\0"
+	"QUALITY-DESIGN\0"
+	"Diamond Point International (Europe) Ltd\0"
+	"DIAMOND-POINT-EUROPE\0"
+	"Arrowvale Electronics\0"
+	"ARROWVALE-ELECTRONICS\0"
+	"ReaMetrix, Inc.\0"
+	"REAMETRIX\0"
+	"Juice Technologies, LLC\0"
+	"JUICE-TECHNOLOGIES\0"
+	"EPL\0"
+	"Televic Rail GmbH\0"
+	"TELEVIC-RAIL\0"
+	"ITAS A/S\0"
+	"ITAS-A/S\0"
+	"JSC Component-ASU\0"
+	"JSC-COMPONENT-ASU\0"
+	"MECC CO., LTD.\0"
+	"MECC\0"
+	"Ansen Investment Holdings Ltd.\0"
+	"ANSEN-INVESTMENT-HOLDINGS\0"
+	"Alga Microwave Inc\0"
+	"ALGA-MICROWAVE\0"
+	"Arrow Central Europe GmbH - Division Spoerle\0"
+	"ARROW-CENTRAL-EUROPE-DIVISION-SPOERLE\0"
+	"EMS Industries\0"
+	"EMS-INDUSTRIES\0"
+	"tetronik GmbH AEN\0"
+	"TETRONIK-AEN\0"
+	"Mark-O-Print GmbH\0"
+	"MARK-O-PRINT\0"
+	"DVTech\0"
+	"DVTECH\0"
+	"GSS Avionics Limited\0"
+	"GSS-AVIONICS\0"
+	"X-Pert Paint Mixing Systems\0"
+	"X-PERT-PAINT-MIXING\0"
+	"Advanced Integrated Systems\0"
+	"ADVANCED-INTEGRATED\0"
+	"Infocrossing\0"
+	"INFOCROSSING\0"
+	"Explorer Inc.\0"
+	"EXPLORER\0"
+	"Figment Design Laboratories\0"
+	"FIGMENT-DESIGN-LABORATORIES\0"
+	"DTV Innovations\0"
+	"DTV-INNOVATIONS\0"
+	"Screen Technics Pty Limited\0"
+	"SCREEN-TECHNICS-PTY\0"
+	"Reliable System Services Corp\0"
+	"RELIABLE-SYSTEM-SERVICES\0"
+	"Purite Ltd\0"
+	"PURITE\0"
+	"Gamber-Johnson LLC.\0"
+	"KYOEI ENGINEERING Co.,Ltd.\0"
+	"KYOEI-ENGINEERING\0"
+	"DSP DESIGN LTD\0"
+	"JTL Systems Ltd.\0"
+	"JTL\0"
+	"Roesch & Walter Industrie-Elektronik GmbH\0"
+	"ROESCH-WALTER-INDUSTRIE-ELEKTRONIK\0"
+	"Apantac LLC\0"
+	"APANTAC\0"
+	"Saintronic\0"
+	"SAINTRONIC\0"
+	"DetNet South Africa PTY (LTD)\0"
+	"DETNET-SOUTH-AFRICA-PTY\0"
+	"Orange Tree Technologies\0"
+	"ORANGE-TREE-TECHNOLOGIES\0"
+	"Pneu-Logic Corporation\0"
+	"PNEU-LOGIC\0"
+	"Densitron Technologies Ltd\0"
+	"DENSITRON-TECHNOLOGIES\0"
+	"BPC circuits Ltd\0"
+	"BPC-CIRCUITS\0"
+	"Techno Sobi Co. Ltd.\0"
+	"TECHNO-SOBI\0"
+	"Lino Manfrotto +Co spa\0"
+	"LINO-MANFROTTO-+-SPA\0"
+	"JOYSYSTEM\0"
+	"LIMAB AB\0"
+	"LIMAB-AB\0"
+	"Littlemore Scientific\0"
+	"LITTLEMORE-SCIENTIFIC\0"
+	"S-SYS\0"
+	"CA Traffic Ltd\0"
+	"CA-TRAFFIC\0"
+	"Audio Engineering Ltd.\0"
+	"AUDIO-ENGINEERING\0"
+	"Navicron Oy\0"
+	"NAVICRON-OY\0"
+	"Redwire, LLC\0"
+	"REDWIRE\0"
+	"Frontier Electronic Systems Corp.\0"
+	"FRONTIER\0"
+	"BFI Industrie-Elektronik GmbH & Co.KG\0"
+	"BFI-INDUSTRIE-ELEKTRONIK\0"
+	"S.two Corporation\0"
+	"S-TWO\0"
+	"Ceron Tech Co.,LTD\0"
+	"CERON-TECH\0"
+	"SPX Flow Technology\0"
+	"SPX-FLOW\0"
+	"Par-Tech, Inc.\0"
+	"PAR-TECH\0"
+	"INNOVACIONES Microelectrónicas SL (AnaFocus)\0"
+	"INNOVACIONES-MICROELECTRNICAS-SL-ANAFOCUS\0"
+	"FEP SRL\0"
+	"FEP-SRL\0"
+	"MICROSYSTEMES\0"
+	"Sentry 360 Security\0"
+	"SENTRY-360-SECURITY\0"
+	"Haivision Systems Inc\0"
+	"Absolutron. LLC\0"
+	"ABSOLUTRON\0"
+	"PDQ Manufacturing  Inc.\0"
+	"Star Electronics GmbH & Co. KG\0"
+	"STAR-ELECTRONICS\0"
+	"Joehl & Koeferli AG\0"
+	"JOEHL-KOEFERLI\0"
+	"Procon Engineering Limited\0"
+	"PROCON-ENGINEERING\0"
+	"YellowSoft Co., Ltd.\0"
+	"YELLOWSOFT\0"
+	"ELREM ELECTRONIC AG\0"
+	"ELREM\0"
+	"ELPA sas\0"
+	"ELPA-SAS\0"
+	"PSi Printer Systems international GmbH\0"
+	"PSI-PRINTER\0"
+	"Tampere University of Technology\0"
+	"TAMPERE-UNIVERSITY-OF\0"
+	"Bassett Electronic Systems ltd\0"
+	"BASSETT\0"
+	"Endeas Oy\0"
+	"ENDEAS-OY\0"
+	"Nexans Cabling Solutions\0"
+	"NEXANS-CABLING-SOLUTIONS\0"
+	"SAN GIORGIO S.E.I.N. srl\0"
+	"SAN-GIORGIO-S-E-I-N-SRL\0"
+	"Flexible Picture Systems\0"
+	"FLEXIBLE-PICTURE\0"
+	"BRS Sistemas Eletrônicos\0"
+	"BRS-SISTEMAS-ELETRNICOS\0"
+	"VisiCon GmbH\0"
+	"VISICON\0"
+	"Update Systems Inc.\0"
+	"UPDATE\0"
+	"OUTLINE srl\0"
+	"OUTLINE-SRL\0"
+	"Santa Barbara Instrument Group\0"
+	"SANTA-BARBARA-INSTRUMENT-GROUP\0"
+	"FRAKO Kondensatoren- und Anlagenbau GmbH\0"
+	"FRAKO-KONDENSATOREN-UND-ANLAGENBAU\0"
+	"Bitmanufaktur GmbH\0"
+	"BITMANUFAKTUR\0"
+	"ProCom Systems, Inc.\0"
+	"PROCOM\0"
+	"Compañía de Instrumentacion y control, S.L.\0"
+	"COMPAA-DE-INSTRUMENTACION-Y-CONTROL\0"
+	"n3k Informatik GmbH\0"
+	"N3K-INFORMATIK\0"
+	"Gygax Embedded Engineering GEE.ch\0"
+	"GYGAX-EMBEDDED-ENGINEERING-GEE-CH\0"
+	"Twinfalls Technologies\0"
+	"TWINFALLS-TECHNOLOGIES\0"
+	"AHM Limited (CLiKAPAD)\0"
+	"AHM-CLIKAPAD\0"
+	"Showtacle\0"
+	"SHOWTACLE\0"
+	"Volantic AB\0"
+	"VOLANTIC-AB\0"
+	"Barrick\0"
+	"BARRICK\0"
+	"AP Labs\0"
+	"AP-LABS\0"
+	"MCC Computer Company\0"
+	"MCC-COMPANY\0"
+	"DS PRO Audio Ltda\0"
+	"DS-PRO-AUDIO-LTDA\0"
+	"DAISHIN-DENSHI Co., Ltd\0"
+	"DAISHIN-DENSHI\0"
+	"OpenXS B.V.\0"
+	"OPENXS-B-V\0"
+	"Diversified Control, Inc.\0"
+	"DIVERSIFIED-CONTROL\0"
+	"E-Motion System, Inc.\0"
+	"E-MOTION-SYSTEM\0"
+	"Marathon Products, Inc.\0"
+	"MARATHON-PRODUCTS\0"
+	"Palladio Systeme GmbH\0"
+	"PALLADIO-SYSTEME\0"
+	"Steinbeis-Transferzentrum Embedded Design und Networking\0"
+	"STEINBEIS-TRANSFERZENTRUM-EMBEDDED-DESIGN-UND-NETWORKING\0"
+	"Soft & Control Technology s.r.o.\0"
+	"SOFT-CONTROL-S-R-O\0"
+	"U-CARE INC.\0"
+	"U-CARE\0"
+	"ProPhotonix\0"
+	"PROPHOTONIX\0"
+	"MeshWorks Wireless Oy\0"
+	"MESHWORKS-WIRELESS-OY\0"
+	"ChronoLogic Pty. Ltd.\0"
+	"CHRONOLOGIC-PTY\0"
+	"Geonautics Australia Pty Ltd\0"
+	"GEONAUTICS-AUSTRALIA-PTY\0"
+	"Global Rainmakers Inc.\0"
+	"GLOBAL-RAINMAKERS\0"
+	"Mighty Lube Systematic Lubrication, Inc.\0"
+	"MIGHTY-LUBE-SYSTEMATIC-LUBRICATION\0"
+	"Unisensor A/S\0"
+	"UNISENSOR-A/S\0"
+	"Air Monitors Ltd\0"
+	"AIR-MONITORS\0"
+	"Incyma\0"
+	"INCYMA\0"
+	"elettrondata srl\0"
+	"ELETTRONDATA-SRL\0"
+	"Essepie Srl\0"
+	"ESSEPIE-SRL\0"
+	"GO engineering GmbH\0"
+	"GO-ENGINEERING\0"
+	"Synthesechemie Dr. Penth GmbH\0"
+	"SYNTHESECHEMIE-DR-PENTH\0"
+	"Neoptix Inc.\0"
+	"NEOPTIX\0"
+	"Altinex, Inc\0"
+	"ALTINEX\0"
+	"AT4 wireless.S.A\0"
+	"AT4-WIRELESS\0"
+	"EVERCARE\0"
+	"Power Medical Interventions\0"
+	"POWER-MEDICAL-INTERVENTIONS\0"
+	"PSD\0"
+	"Advanced Electronic Designs, Inc.\0"
+	"ADVANCED-DESIGNS\0"
+	"ABS Gesellschaft f. Automatisierung, Bildverarbeitung und Software mbH\0"
+	"ABS-GESELLSCHAFT-F-AUTOMATISIERUNG-BILDVERARBEITUNG-UND-SOFTWARE\0"
+	"VECOM USA\0"
+	"VECOM-USA\0"
+	"Redwood Systems\0"
+	"REDWOOD\0"
+	"Bit-Lab PTY LTD\0"
+	"BIT-LAB-PTY\0"
+	"ClearCorp Enterprises, Inc\0"
+	"CLEARCORP-ENTERPRISES\0"
+	"EMBEDIA\0"
+	"UMLogics Corporation\0"
+	"UMLOGICS\0"
+	"Fritz Pauker Ingenieure GmbH\0"
+	"FRITZ-PAUKER-INGENIEURE\0"
+	"3Roam\0"
+	"3ROAM\0"
+	"IPtec, Inc.\0"
+	"IPTEC\0"
+	"National CineMedia\0"
+	"NATIONAL-CINEMEDIA\0"
+	"Green Goose\0"
+	"GREEN-GOOSE\0"
+	"Palomar Products, Inc.\0"
+	"PALOMAR-PRODUCTS\0"
+	"Dixell S.p.A.\0"
+	"Kramara s.r.o.\0"
+	"KRAMARA-S-R-O\0"
+	"Energid\0"
+	"ENERGID\0"
+	"Midwest Microwave Solutions Inc.\0"
+	"MIDWEST-MICROWAVE-SOLUTIONS\0"
+	"Global Satellite Engineering\0"
+	"GLOBAL-SATELLITE-ENGINEERING\0"
+	"Ingenieurbuero Bickele und Buehler GmbH\0"
+	"INGENIEURBUERO-BICKELE-UND-BUEHLER\0"
+	"Absolute Fire Solutions Inc.\0"
+	"ABSOLUTE-FIRE-SOLUTIONS\0"
+	"Odus Technologies SA\0"
+	"ODUS-TECHNOLOGIES\0"
+	"HomeScenario, Inc.\0"
+	"HOMESCENARIO\0"
+	"Trolex Limited\0"
+	"TROLEX\0"
+	"XoByte LLC\0"
+	"XOBYTE\0"
+	"HSR Harald L. Reuter\0"
+	"HSR-HARALD-L-REUTER\0"
+	"MASTER CO LTD\0"
+	"MASTER\0"
+	"Spider Tecnologia Ind. e Com. Ltda.\0"
+	"SPIDER-TECNOLOGIA-IND-E-COM-LTDA\0"
+	"Ubiquiti Inc\0"
+	"UBIQUITI\0"
+	"POLA s.r.l.\0"
+	"POLA\0"
+	"CompuDesigns, Inc.\0"
+	"COMPUDESIGNS\0"
+	"FARECO\0"
+	"Harper Chalice Group Limited\0"
+	"HARPER-CHALICE-GROUP\0"
+	"Indutherm Giesstechnologie GmbH\0"
+	"INDUTHERM-GIESSTECHNOLOGIE\0"
+	"SMARTB TECHNOLOGIES\0"
+	"SMARTB-TECHNOLOGIES\0"
+	"Japan Electronics System, Inc\0"
+	"JAPAN-ELECTRONICS-SYSTEM\0"
+	"KYAB Lulea AB\0"
+	"KYAB-LULEA-AB\0"
+	"NARA Controls Inc.\0"
+	"NARA-CONTROLS\0"
+	"Marine Entertainment Systems Ltd\0"
+	"MARINE-ENTERTAINMENT\0"
+	"EXEL s.r.l\0"
+	"EXEL\0"
+	"CM Elektronik GmbH\0"
+	"CM-ELEKTRONIK\0"
+	"Measy Electronics Co., Ltd.\0"
+	"MEASY-ELECTRONICS\0"
+	"PhotoTelesis LP\0"
+	"PHOTOTELESIS-LP\0"
+	"Neothings, Inc.\0"
+	"NEOTHINGS\0"
+	"Elcoteq Design Center Oy\0"
+	"ELCOTEQ-DESIGN-CENTER-OY\0"
+	"Polytron Corporation\0"
+	"POLYTRON\0"
+	"ELCUS\0"
+	"Integrated  Control Corp.\0"
+	"INTEGRATED-CONTROL\0"
+	"Telegenix\0"
+	"TELEGENIX\0"
+	"Abbott Medical Optics\0"
+	"ABBOTT-MEDICAL-OPTICS\0"
+	"Atlas Copco IAS GmbH\0"
+	"ATLAS-COPCO-IAS\0"
+	"FIVE9 NETWORK SYSTEMS LLC\0"
+	"FIVE9-NETWORK\0"
+	"Phytron-Elektronik GmbH\0"
+	"PHYTRON-ELEKTRONIK\0"
+	"FarSite Communications Limited\0"
+	"FARSITE-COMMUNICATION\0"
+	"Ronyo Technologies s.r.o.\0"
+	"RONYO-TECHNOLOGIES-S-R-O\0"
+	"Teledyne Defence Limited\0"
+	"TELEDYNE-DEFENCE\0"
+	"Triax A/S\0"
+	"TRIAX-A/S\0"
+	"Elko Systems\0"
+	"ELKO\0"
+	"Micromax Pty. Ltd.\0"
+	"MICROMAX-PTY\0"
+	"Integra LifeSciences (Ireland) Ltd\0"
+	"INTEGRA-LIFESCIENCES-IRELAND\0"
+	"Trench Austria GmbH\0"
+	"TRENCH-AUSTRIA\0"
+	"CosmoData Informatica Ltda.\0"
+	"COSMODATA-INFORMATICA-LTDA\0"
+	"Concepteers, LLC\0"
+	"CONCEPTEERS\0"
+	"Datasat Digital Entertainment\0"
+	"DATASAT-DIGITAL-ENTERTAINMENT\0"
+	"IntelliVision Technologies, Corp\0"
+	"INTELLIVISION-TECHNOLOGIES\0"
+	"Applied Micro Electronics AME bv\0"
+	"APPLIED-MICRO-ELECTRONICS-AME\0"
+	"Shop Safe AG\0"
+	"SHOP-SAFE\0"
+	"Byres Security Inc\0"
+	"BYRES-SECURITY\0"
+	"Numcore Ltd\0"
+	"NUMCORE\0"
+	"Meisol co.,ltd\0"
+	"MEISOL\0"
+	"haneron\0"
+	"HANERON\0"
+	"Grenmore Ltd\0"
+	"GRENMORE\0"
+	"siXis, Inc.\0"
+	"SIXIS\0"
+	"Nikon Systems Inc.\0"
+	"NIKON\0"
+	"Sportvision Inc.\0"
+	"SPORTVISION\0"
+	"JanasCard\0"
+	"JANASCARD\0"
+	"AMS\0"
+	"Sage Consultants\0"
+	"SAGE-CONSULTANTS\0"
+	"M-Tronic Design and Technology GmbH\0"
+	"M-TRONIC-DESIGN\0"
+	"Tata Power Company, Strategic Electronics Division\0"
+	"TATA-POWER-COMPANY-STRATEGIC-ELECTRONICS-DIVISION\0"
+	"ETM Electromatic Incorporated\0"
+	"ETM-ELECTROMATIC-INCORPORATED\0"
+	"J-Systems Inc.\0"
+	"J\0"
+	"Ampcontrol Pty Ltd\0"
+	"AMPCONTROL-PTY\0"
+	"Efftronics Systems (P) Ltd\0"
+	"EFFTRONICS-P\0"
+	"Mobileye\0"
+	"MOBILEYE\0"
+	"MCS MICRONIC Computer Systeme GmbH\0"
+	"MCS-MICRONIC-SYSTEME\0"
+	"MTD GmbH\0"
+	"MTD\0"
+	"Aplex Technology Inc.\0"
+	"APLEX\0"
+	"Chitose Co.,Ltd\0"
+	"CHITOSE\0"
+	"ElectroCom\0"
+	"ELECTROCOM\0"
+	"Troll Systems Corporation\0"
+	"TROLL\0"
+	"AixControl GmbH\0"
+	"AIXCONTROL\0"
+	"Sencon UK Ltd.\0"
+	"SENCON-UK\0"
+	"SMH Technologies\0"
+	"SMH-TECHNOLOGIES\0"
+	"Prodco\0"
+	"APG Cash Drawer, LLC\0"
+	"APG-CASH-DRAWER\0"
+	"SANYO ELECTRONIC INDUSTRIES CO.,LTD\0"
+	"SANYO-INDUSTRIES\0"
+	"SINOVIA SA\0"
+	"SINOVIA\0"
+	"GREEN Center s.r.o.\0"
+	"GREEN-CENTER-S-R-O\0"
+	"Timberline Manufacturing\0"
+	"TIMBERLINE-MANUFACTURING\0"
+	"ADI Video Technologies\0"
+	"ADI-VIDEO-TECHNOLOGIES\0"
+	"Plitron Manufacturing Inc.\0"
+	"PLITRON-MANUFACTURING\0"
+	"Palgiken Co.,Ltd.\0"
+	"PALGIKEN\0"
+	"North Bridge Technologies\0"
+	"NORTH-BRIDGE-TECHNOLOGIES\0"
+	"OOO NPF ATIS\0"
+	"OOO-NPF-ATIS\0"
+	"Nayos LTD\0"
+	"NAYOS\0"
+	"Rugged Controls\0"
+	"RUGGED-CONTROLS\0"
+	"FEW Bauer GmbH\0"
+	"FEW-BAUER\0"
+	"8185\0"
+	"RC Systems Co. Inc.\0"
+	"RC\0"
+	"Electronic Systems Protection, Inc.\0"
+	"PROTECTION\0"
+	"Thetis S.p.A.\0"
+	"THETIS\0"
+	"Drinelec\0"
+	"DRINELEC\0"
+	"Sound Metrics Corp\0"
+	"SOUND-METRICS\0"
+	"Nisshin Electronics co.,ltd.\0"
+	"NISSHIN-ELECTRONICS\0"
+	"Digitale Analoge COMponenten West Electronic Vertriebs GmbH\0"
+	"DIGITALE-ANALOGE-COMPONENTEN-WEST-VERTRIEBS\0"
+	"Advanced Desktop Systems Ltd\0"
+	"ADVANCED-DESKTOP\0"
+	"ARKRAY, Inc. Kyoto Laboratory\0"
+	"ARKRAY-KYOTO-LABORATORY\0"
+	"AXED Jakubowski Wojciechowski sp.j.\0"
+	"AXED-JAKUBOWSKI-WOJCIECHOWSKI-SP-J\0"
+	"ITF Fröschl GmbH\0"
+	"ITF-FROESCHL\0"
+	"KRISTECH\0"
+	"Folink\0"
+	"FOLINK\0"
+	"MITSUYA LABORATORIES INC.\0"
+	"MITSUYA-LABORATORIES\0"
+	"Schnoor Industrieelektronik GmbH & Co. KG\0"
+	"SCHNOOR-INDUSTRIEELEKTRONIK\0"
+	"QUARTECH CORPORATION\0"
+	"QUARTECH\0"
+	"ELETECH Srl\0"
+	"ELETECH-SRL\0"
+	"NARETRENDS\0"
+	"Enatel\0"
+	"iScreen LLC\0"
+	"ISCREEN\0"
+	"GHL Advanced Technolgy GmbH & Co. KG\0"
+	"GHL-ADVANCED-TECHNOLGY\0"
+	"TANABIKI Inc.\0"
+	"TANABIKI\0"
+	"Advanced Storage Concepts, Inc.\0"
+	"ADVANCED-STORAGE-CONCEPTS\0"
+	"Innovate Software Solutions Pvt Ltd\0"
+	"INNOVATE-SOFTWARE-SOLUTIONS-PVT\0"
+	"SilverNet\0"
+	"SILVERNET\0"
+	"ASTO\0"
+	"Gigatronik  Köln GmbH\0"
+	"GIGATRONIK-KOELN\0"
+	"ENTEC Electric & Electronic Co., LTD.\0"
+	"ENTEC-ELECTRIC\0"
+	"MicroPoise\0"
+	"MICROPOISE\0"
+	"FBB\0"
+	"CEMSI\0"
+	"WAC (Israel) Ltd.\0"
+	"WAC-ISRAEL\0"
+	"Gentec\0"
+	"GENTEC\0"
+	"NAONWORKS Co., Ltd\0"
+	"NAONWORKS\0"
+	"Finnet-Service Ltd.\0"
+	"FINNET-SERVICE\0"
+	"EMC PARTNER AG\0"
+	"EMC-PARTNER\0"
+	"Tritech International Ltd\0"
+	"TRITECH\0"
+	"Rx Monitoring Services\0"
+	"RX-MONITORING-SERVICES\0"
+	"Onix Electronic Systems Inc\0"
+	"ONIX\0"
+	"ikerlan\0"
+	"IKERLAN\0"
+	"Southwest Research Institute\0"
+	"SOUTHWEST-RESEARCH-INSTITUTE\0"
+	"Greenlight Innovation Corp.\0"
+	"GREENLIGHT-INNOVATION\0"
+	"Talo, NV Inc\0"
+	"TALO-NV\0"
+	"Telventy Energia S.A.\0"
+	"TELVENTY-ENERGIA\0"
+	"W. Vershoven GmbH\0"
+	"W-VERSHOVEN\0"
+	"AUDIOSCOPE 2K SRL\0"
+	"AUDIOSCOPE-2K-SRL\0"
+	"txtr GmbH\0"
+	"TXTR\0"
+	"Transtechnik GmbH & Co.KG\0"
+	"TRANSTECHNIK\0"
+	"Logical Tools s.r.l.\0"
+	"LOGICAL-TOOLS\0"
+	"CUSTOS MOBILE S.L.\0"
+	"CUSTOS-MOBILE\0"
+	"InterCel Pty Ltd\0"
+	"INTERCEL-PTY\0"
+	"Jomitek\0"
+	"JOMITEK\0"
+	"RaumComputer Entwicklungs- und Vertriebs GmbH\0"
+	"RAUMCOMPUTER-ENTWICKLUNGS-UND-VERTRIEBS\0"
+	"SISS Technology Inc.\0"
+	"SISS\0"
+	"NetworkFX Communications, LLC\0"
+	"NETWORKFX-COMMUNICATION\0"
+	"iDeal Teknoloji Bilisim Cozumleri A.S.\0"
+	"IDEAL-TEKNOLOJI-BILISIM-COZUMLERI\0"
+	"VITECO VNPT JSC\0"
+	"VITECO-VNPT-JSC\0"
+	"Prediktor AS\0"
+	"PREDIKTOR-AS\0"
+	"Fiber Connections Inc.\0"
+	"FIBER-CONNECTIONS\0"
+	"Gainbrain\0"
+	"GAINBRAIN\0"
+	"Pro4tech\0"
+	"PRO4TECH\0"
+	"St Michael Strategies Inc\0"
+	"ClimateWell AB (publ)\0"
+	"CLIMATEWELL-AB-PUBL\0"
+	"JSC Electrical Equipment Factory\0"
+	"JSC-ELECTRICAL-EQUIPMENT-FACTORY\0"
+	"MROAD INFORMATION SYSTEM\0"
+	"MROAD-INFORMATION-SYSTEM\0"
+	"Quarch Technology Ltd\0"
+	"QUARCH\0"
+	"MoeTronix\0"
+	"MOETRONIX\0"
+	"Systemteq Limited\0"
+	"SYSTEMTEQ\0"
+	"ImpactSystems\0"
+	"IMPACTSYSTEMS\0"
+	"Onlinepizza Norden AB\0"
+	"ONLINEPIZZA-NORDEN-AB\0"
+	"Galaxia Electronics\0"
+	"GALAXIA-ELECTRONICS\0"
+	"Sentec Ltd\0"
+	"SENTEC\0"
+	"Xslent Energy Technologies. LLC\0"
+	"XSLENT-ENERGY-TECHNOLOGIES\0"
+	"Toptechnology SRL\0"
+	"TOPTECHNOLOGY-SRL\0"
+	"MireroTack\0"
+	"MIREROTACK\0"
+	"PTS GmbH\0"
+	"PTS\0"
+	"AGWTech Ltd\0"
+	"AGWTECH\0"
+	"Nextmove Technologies\0"
+	"NEXTMOVE-TECHNOLOGIES\0"
+	"Aitecsystem Co.,Ltd.\0"
+	"AITECSYSTEM\0"
+	"ARTEIXO TELECOM\0"
+	"ARTEIXO-TELECOM\0"
+	"VVDN TECHNOLOGIES PVT. LTD.\0"
+	"VVDN-TECHNOLOGIES-PVT\0"
+	"Highlight Parking Systems Ltd\0"
+	"HIGHLIGHT-PARKING\0"
+	"TV Portal Co., Ltd.\0"
+	"TV-PORTAL\0"
+	"Epiko, elektronski sistemi d.o.o.\0"
+	"EPIKO-ELEKTRONSKI-SISTEMI-D-O-O\0"
+	"EDC wifi\0"
+	"EDC-WIFI\0"
+	"Ariem Technologies Pvt Ltd\0"
+	"ARIEM-TECHNOLOGIES-PVT\0"
+	"Percello Ltd.\0"
+	"PERCELLO\0"
+	"Postjet Systems Ltd\0"
+	"POSTJET\0"
+	"Global Security Devices\0"
+	"GLOBAL-SECURITY-DEVICES\0"
+	"RF-Embedded GmbH\0"
+	"RF-EMBEDDED\0"
+	"BG Systems, Inc.\0"
+	"BG\0"
+	"SLAT\0"
+	"b.a.b-technologie gmbh\0"
+	"B-A-B-TECHNOLOGIE\0"
+	"AMS Controls, Inc.\0"
+	"AMS-CONTROLS\0"
+	"Digital Lumens\0"
+	"DIGITAL-LUMENS\0"
+	"GasTOPS Ltd.\0"
+	"GASTOPS\0"
+	"SS Systems LLC\0"
+	"SS\0"
+	"Evo-Teh d.o.o.\0"
+	"EVO-TEH-D-O-O\0"
+	"Euro-Konsult Sp. z o.o.\0"
+	"EURO-KONSULT-SP-Z-O-O\0"
+	"Convergent Bioscience Ltd.\0"
+	"CONVERGENT-BIOSCIENCE\0"
+	"Jiskoot Ltd\0"
+	"JISKOOT\0"
+	"Docobo Ltd\0"
+	"DOCOBO\0"
+	"Genetec Inc.\0"
+	"GENETEC\0"
+	"VEHICLE TESTING EQUIPMENT, S.L.\0"
+	"VEHICLE-TESTING-EQUIPMENT\0"
+	"ZUCCHETTI SPA\0"
+	"ZUCCHETTI-SPA\0"
+	"Daeyoung inc.\0"
+	"DAEYOUNG\0"
+	"DRS Laruel Technologies\0"
+	"DRS-LARUEL-TECHNOLOGIES\0"
+	"Touch Revolution Inc.\0"
+	"TOUCH-REVOLUTION\0"
+	"SOCIEDAD IBERICA DE CONSTRUCCIONES ELECTRICAS, S.A. (SICE)\0"
+	"SOCIEDAD-IBERICA-DE-CONSTRUCCIONES-ELECTRICAS-SICE\0"
+	"Amatic Industries GmbH\0"
+	"AMATIC-INDUSTRIES\0"
+	"Wanco Inc.\0"
+	"WANCO\0"
+	"Monarch Innovative Technologies Pvt Ltd\0"
+	"MONARCH-INNOVATIVE-TECHNOLOGIES-PVT\0"
+	"AILES ELECTRONICS CO., LTD.\0"
+	"AILES-ELECTRONICS\0"
+	"NOLAM EMBEDDED SYSTEMS\0"
+	"NOLAM-EMBEDDED\0"
+	"Crtiical Link\0"
+	"CRTIICAL-LINK\0"
+	"ECS Srl\0"
+	"ECS-SRL\0"
+	"Altronix Corporation\0"
+	"ALTRONIX\0"
+	"Ernemann Cine Tec GmbH\0"
+	"ERNEMANN-CINE-TEC\0"
+	"Ingeteam Paneles S.A.U.\0"
+	"INGETEAM-PANELES-U\0"
+	"I.S.A. S.r.l.\0"
+	"I\0"
+	"QUERCUS TECHNOLOGIES, S.L.\0"
+	"QUERCUS-TECHNOLOGIES\0"
+	"Hanning Elektro-Werke GmbH & Co. KG\0"
+	"HANNING-ELEKTRO-WERKE\0"
+	"Volumatic Limited.\0"
+	"SoGEME\0"
+	"SOGEME\0"
+	"Doppler Systems LLC\0"
+	"DOPPLER\0"
+	"ANALOG WAY\0"
+	"ANALOG-WAY\0"
+	"CIO Informatique Industrielle\0"
+	"CIO-INFORMATIQUE-INDUSTRIELLE\0"
+	"juiceboss\0"
+	"JUICEBOSS\0"
+	"ProSourcing GmbH\0"
+	"PROSOURCING\0"
+	"Altierre\0"
+	"ALTIERRE\0"
+	"Fr. SauterAG\0"
+	"FR-SAUTERAG\0"
+	"AVItronic GmbH\0"
+	"AVITRONIC\0"
+	"ART Antriebs- und Regeltechnik GmbH\0"
+	"ART-ANTRIEBS-UND-REGELTECHNIK\0"
+	"OKI DENKI BOHSAI CO.,LTD.\0"
+	"OKI-DENKI-BOHSAI\0"
+	"Dantec Dynamics A/S\0"
+	"DANTEC-DYNAMICS-A/S\0"
+	"Spectronix Corporation\0"
+	"SPECTRONIX\0"
+	"INO - Institut National d'Optique\0"
+	"INO-INSTITUT-NATIONAL-D-OPTIQUE\0"
+	"Axis-Shield PoC AS\0"
+	"AXIS-SHIELD-POC-AS\0"
+	"Linuxstamp Designs, LLC\0"
+	"LINUXSTAMP-DESIGNS\0"
+	"Ibercomp SA\0"
+	"IBERCOMP\0"
+	"SAM Co., Ltd.\0"
+	"SAM\0"
+	"Graesslin GmbH\0"
+	"GRAESSLIN\0"
+	"Becton Dickinson\0"
+	"BECTON-DICKINSON\0"
+	"Powerbase Energy Systems Inc.\0"
+	"POWERBASE-ENERGY\0"
+	"Peperoni-Light\0"
+	"PEPERONI-LIGHT\0"
+	"Specialist Electronics Services Ltd\0"
+	"SPECIALIST-ELECTRONICS-SERVICES\0"
+	"SRC Computers, LLC\0"
+	"SRC-COMPUTERS\0"
+	"Audient Ltd\0"
+	"AUDIENT\0"
+	"Vidicon LLC\0"
+	"VIDICON\0"
+	"Qualnetics Corporation\0"
+	"QUALNETICS\0"
+	"Qtechnology A/S\0"
+	"QTECHNOLOGY-A/S\0"
+	"ELREHA GmbH\0"
+	"ELREHA\0"
+	"Newtel Engineering S.r.l.\0"
+	"NEWTEL-ENGINEERING\0"
+	"RealTime Systems Ltd\0"
+	"Z-App Systems, Inc.\0"
+	"bach-messtechnik gmbh\0"
+	"BACH-MESSTECHNIK\0"
+	"DISMUNTEL SAL\0"
+	"DISMUNTEL-SAL\0"
+	"REFLEX CES\0"
+	"REFLEX-CES\0"
+	"Wagner Group GmbH\0"
+	"WAGNER-GROUP\0"
+	"4D Technology Corporation\0"
+	"4D\0"
+	"Kyuhen\0"
+	"KYUHEN\0"
+	"Insitu, Inc\0"
+	"INSITU\0"
+	"SET GmbH\0"
+	"SET\0"
+	"Computer Automation Technology Inc\0"
+	"AUTOMATION\0"
+	"SECAD SA\0"
+	"SECAD\0"
+	"ELEKTRO-AUTOMATIK GmbH & Co. KG\0"
+	"ELEKTRO-AUTOMATIK\0"
+	"ELSIST S.r.l.\0"
+	"ELSIST\0"
+	"PLA ELECTRO APPLIANCES PVT. LTD.\0"
+	"PLA-ELECTRO-APPLIANCES-PVT\0"
+	"Sysacom\0"
+	"SYSACOM\0"
+	"ANXeBusiness Corporation\0"
+	"ANXEBUSINESS\0"
+	"BAE Systems Bofors AB\0"
+	"BAE-BOFORS-AB\0"
+	"COMPRION GmbH\0"
+	"COMPRION\0"
+	"Cammegh Limited\0"
+	"CAMMEGH\0"
+	"Beijing Zhongherongzhi Elec.&Tech.Co.,Ltd.\0"
+	"BEIJING-ZHONGHERONGZHI-ELEC-TECH\0"
+	"Galvamat & Unican Technologies SA\0"
+	"GALVAMAT-UNICAN-TECHNOLOGIES\0"
+	"QNE GmbH & Co. KG\0"
+	"QNE\0"
+	"Weltek Technologies Co. Ltd.\0"
+	"WELTEK-TECHNOLOGIES\0"
+	"Cytek Media Systems, INC.\0"
+	"CYTEK-MEDIA\0"
+	"Elektronic Thoma GmbH\0"
+	"ELEKTRONIC-THOMA\0"
+	"Herrick Technology Laboratories, Inc.\0"
+	"HERRICK-LABORATORIES\0"
+	"R.V.R. elettronica s.p.a.\0"
+	"R-V-R-ELETTRONICA\0"
+	"Lancier Monitoring GmbH\0"
+	"LANCIER-MONITORING\0"
+	"Industrial Automation Systems\0"
+	"INDUSTRIAL-AUTOMATION\0"
+	"Elaso AG\0"
+	"ELASO\0"
+	"InForce Computing, Inc.\0"
+	"INFORCE-COMPUTING\0"
+	"Smartfield, Inc.\0"
+	"SMARTFIELD\0"
+	"Eilersen Electric A/S\0"
+	"EILERSEN-ELECTRIC-A/S\0"
+	"HPC Platform\0"
+	"HPC-PLATFORM\0"
+	"Watterott electronic\0"
+	"WATTEROTT\0"
+	"High Speed Design, Inc.\0"
+	"HIGH-SPEED-DESIGN\0"
+	"Foerster-Technik GmbH\0"
+	"FOERSTER-TECHNIK\0"
+	"SKD System AB\0"
+	"SKD-SYSTEM-AB\0"
+	"Commotive A/S\0"
+	"COMMOTIVE-A/S\0"
+	"MICRO TECHNICA\0"
+	"MICRO-TECHNICA\0"
+	"WAVECOM ELEKTRONIK AG\0"
+	"WAVECOM-ELEKTRONIK\0"
+	"SweMet AB\0"
+	"SWEMET-AB\0"
+	"CellPlus technologies, Inc.\0"
+	"CELLPLUS-TECHNOLOGIES\0"
+	"Integration Technologies Limited\0"
+	"INTEGRATION-TECHNOLOGIES\0"
+	"HaiVision Systems Incorporated\0"
+	"HAIVISION-INCORPORATED\0"
+	"Zeus Systems Private Limited\0"
+	"ZEUS-PRIVATE\0"
+	"Potter Electric Signal Co. LLC\0"
+	"POTTER-ELECTRIC-SIGNAL\0"
+	"Pal Software Service Co.,Ltd.\0"
+	"PAL-SOFTWARE-SERVICE\0"
+	"Micro I/O Servicos de Electronica, Lda\0"
+	"MICRO-I/O-SERVICOS-DE-ELECTRONICA-LDA\0"
+	"KS Beschallungstechnik GmbH\0"
+	"KS-BESCHALLUNGSTECHNIK\0"
+	"Practical Control Ltd\0"
+	"PRACTICAL-CONTROL\0"
+	"Broadsoft PacketSmart, Inc.\0"
+	"BROADSOFT-PACKETSMART\0"
+	"REBO CO.,LTD.\0"
+	"REBO\0"
+	"ELECTRONICA KELD\0"
+	"ELECTRONICA-KELD\0"
+	"SiGarden Sp z o.o.\0"
+	"SIGARDEN-SP-Z-O-O\0"
+	"Deansoft CO., Ltd.\0"
+	"DEANSOFT\0"
+	"TBS Holding AG\0"
+	"TBS-HOLDING\0"
+	"MSB Elektronik und Geraetebau GmbH\0"
+	"MSB-ELEKTRONIK-UND-GERAETEBAU\0"
+	"Wilke Technology GmbH\0"
+	"WILKE\0"
+	"Sequoia Technology Group Ltd\0"
+	"SEQUOIA-GROUP\0"
+	"Quail\0"
+	"QUAIL\0"
+	"Industry Controls, Inc.\0"
+	"INDUSTRY-CONTROLS\0"
+	"Wapice Ltd.\0"
+	"WAPICE\0"
+	"Rovsing A/S\0"
+	"ROVSING-A/S\0"
+	"GridManager A/S\0"
+	"GRIDMANAGER-A/S\0"
+	"AIM Co.,Ltd\0"
+	"9Solutions Oy\0"
+	"9SOLUTIONS-OY\0"
+	"CODESYSTEM Co.,Ltd\0"
+	"CODESYSTEM\0"
+	"Keysight Technologies Inc.\0"
+	"KEYSIGHT-TECHNOLOGIES\0"
+	"TAE Antriebstechnik GmbH\0"
+	"TAE-ANTRIEBSTECHNIK\0"
+	"Buerkert Werke GmbH\0"
+	"BUERKERT-WERKE\0"
+	"Kinects Solutions Inc\0"
+	"KINECTS-SOLUTIONS\0"
+	"Reko-vek\0"
+	"REKO-VEK\0"
+	"Odyssee Systemes SAS\0"
+	"ODYSSEE-SYSTEMES-SAS\0"
+	"Kyosha Industries\0"
+	"KYOSHA-INDUSTRIES\0"
+	"Gronic Systems GmbH\0"
+	"GRONIC\0"
+	"Bruckner & Jarosch Ingenieurgesellschaft mbH\0"
+	"BRUCKNER-JAROSCH-INGENIEURGESELLSCHAFT\0"
+	"CSI Controles e Sistemas Industriais Ltda.\0"
+	"CSI-CONTROLES-E-SISTEMAS-INDUSTRIAIS-LTDA\0"
+	"Creative Micro Design\0"
+	"CREATIVE-MICRO-DESIGN\0"
+	"Automated Media Services, Inc.\0"
+	"AUTOMATED-MEDIA-SERVICES\0"
+	"OCAS AS\0"
+	"OCAS-AS\0"
+	"Lanmark Controls Inc.\0"
+	"LANMARK-CONTROLS\0"
+	"Emergency Message Controls LLC\0"
+	"EMERGENCY-MESSAGE-CONTROLS\0"
+	"SDD ITG\0"
+	"SDD-ITG\0"
+	"Media Technologies Ltd.\0"
+	"MEDIA-TECHNOLOGIES\0"
+	"SENSAIR Pty Ltd\0"
+	"SENSAIR-PTY\0"
+	"ISIS ENGINEERING, S.A.\0"
+	"ISIS-ENGINEERING\0"
+	"IPSES S.r.l.\0"
+	"IPSES\0"
+	"CyberCraft\0"
+	"CYBERCRAFT\0"
+	"MSTRONIC CO., LTD.\0"
+	"MSTRONIC\0"
+	"Criticare Systems, Inc\0"
+	"CRITICARE\0"
+	"HJPC Corporation dba Pactron\0"
+	"HJPC-DBA-PACTRON\0"
+	"PACOMP Sp. z o.o.\0"
+	"PACOMP-SP-Z-O-O\0"
+	"Sm electronic co.\0"
+	"SM\0"
+	"Radius Sweden AB\0"
+	"xxter b.v.\0"
+	"XXTER-B-V\0"
+	"Kiefer technic GmbH\0"
+	"KIEFER-TECHNIC\0"
+	"Wayne Kerr Electronics\0"
+	"WAYNE-KERR-ELECTRONICS\0"
+	"The Logical Company\0"
+	"THE-LOGICAL-COMPANY\0"
+	"Vox Technologies\0"
+	"VOX-TECHNOLOGIES\0"
+	"YOKOWO CO.,LTD\0"
+	"YOKOWO\0"
+	"Vidisys GmbH\0"
+	"Thermo Fisher Scientific\0"
+	"THERMO-FISHER-SCIENTIFIC\0"
+	"Systems With Intelligence Inc.\0"
+	"WITH-INTELLIGENCE\0"
+	"Intelligent Devices\0"
+	"INTELLIGENT-DEVICES\0"
+	"PURVIS Systems Incorporated\0"
+	"PURVIS-INCORPORATED\0"
+	"Pacific Coast Engineering\0"
+	"PACIFIC-COAST-ENGINEERING\0"
+	"Campbell Scientific Canada Corp.\0"
+	"CAMPBELL-SCIENTIFIC-CANADA\0"
+	"Konsmetal S.A.\0"
+	"KONSMETAL\0"
+	"ZK Celltest Inc\0"
+	"ZK-CELLTEST\0"
+	"Moravian Instruments\0"
+	"MORAVIAN-INSTRUMENTS\0"
+	"GEA Farm Technologies GmbH\0"
+	"GEA-FARM-TECHNOLOGIES\0"
+	"Krontek Pty Ltd\0"
+	"KRONTEK-PTY\0"
+	"inotech GmbH\0"
+	"INOTECH\0"
+	"Raith GmbH\0"
+	"RAITH\0"
+	"Micro Technic A/S\0"
+	"MICRO-TECHNIC-A/S\0"
+	"Coptonix GmbH\0"
+	"COPTONIX\0"
+	"CP ELETRONICA SA\0"
+	"CP-ELETRONICA\0"
+	"Hi Tech Electronics Ltd\0"
+	"HI-TECH-ELECTRONICS\0"
+	"CODE BLUE CORPORATION\0"
+	"CODE-BLUE\0"
+	"Megacon AB\0"
+	"MEGACON-AB\0"
+	"World Time Solutions Limited\0"
+	"WORLD-TIME-SOLUTIONS\0"
+	"Level 3 Communications\0"
+	"LEVEL-3-COMMUNICATION\0"
+	"ConectaIP Tecnologia S.L.\0"
+	"CONECTAIP-TECNOLOGIA\0"
+	"viscount systems inc.\0"
+	"VISCOUNT\0"
+	"Tecnovum AG\0"
+	"TECNOVUM\0"
+	"KDT\0"
+	"TOPROOTTechnology Corp. Ltd.\0"
+	"TOPROOTTECHNOLOGY\0"
+	"Promess GmbH\0"
+	"PROMESS\0"
+	"SANMINA SHENZHEN\0"
+	"SANMINA-SHENZHEN\0"
+	"CaptiveAire Systems Inc.\0"
+	"CAPTIVEAIRE\0"
+	"Smartech-technology\0"
+	"SMARTECH\0"
+	"FUJI DATA SYSTEM Co.,Ltd.\0"
+	"FUJI-DATA-SYSTEM\0"
+	"Mac-Gray Corporation\0"
+	"MAC-GRAY\0"
+	"MME Mueller Mikroelektronik\0"
+	"MME-MUELLER-MIKROELEKTRONIK\0"
+	"SIM2 Multimedia S.p.A.\0"
+	"SIM2-MULTIMEDIA\0"
+	"Covidence A/S\0"
+	"COVIDENCE-A/S\0"
+	"SCHRAML GmbH\0"
+	"SCHRAML\0"
+	"Arktan Systems\0"
+	"ARKTAN\0"
+	"IT-IS International Ltd.\0"
+	"IT-IS\0"
+	"NDC Infrared Engineering, Inc.\0"
+	"NDC-INFRARED-ENGINEERING\0"
+	"RUTTER INC\0"
+	"RUTTER\0"
+	"K.C.C. SHOKAI LIMITED\0"
+	"K-C-C-SHOKAI\0"
+	"CoreEL TEchnologies (I) Pvt Ltd\0"
+	"COREEL-TECHNOLOGIES-I-PVT\0"
+	"Industrial Control Links, Inc.\0"
+	"Satellink Inc.\0"
+	"SATELLINK\0"
+	"Industrial Automatics Design Bureau\0"
+	"INDUSTRIAL-AUTOMATICS-DESIGN-BUREAU\0"
+	"TEKTRONIK\0"
+	"Maretron, LLP\0"
+	"MARETRON-LLP\0"
+	"APLICA TECHNOLOGIES\0"
+	"APLICA-TECHNOLOGIES\0"
+	"Echola Systems\0"
+	"ECHOLA\0"
+	"Thomas & Betts\0"
+	"THOMAS-BETTS\0"
+	"Toyon Research Corporation\0"
+	"TOYON-RESEARCH\0"
+	"AeroMechanical Services Ltd, FLYHT\0"
+	"AEROMECHANICAL-SERVICES-FLYHT\0"
+	"EMBED-IT OG\0"
+	"EMBED-IT-OG\0"
+	"Lupatecnologia e Sistemas Ltda\0"
+	"LUPATECNOLOGIA-E-SISTEMAS-LTDA\0"
+	"Inviso B.V.\0"
+	"INVISO-B-V\0"
+	"Bascom Hunter\0"
+	"BASCOM-HUNTER\0"
+	"Weiss Robotics GmbH & Co. KG\0"
+	"WEISS-ROBOTICS\0"
+	"Daiken Automacao Ltda\0"
+	"DAIKEN-AUTOMACAO-LTDA\0"
+	"Armour Home Electronics LTD\0"
+	"ARMOUR-HOME-ELECTRONICS\0"
+	"beks Kommunikacios Technika kft\0"
+	"BEKS-KOMMUNIKACIOS-TECHNIKA-KFT\0"
+	"New Embedded Technology\0"
+	"NEW-EMBEDDED\0"
+	"Tritium Pty Ltd\0"
+	"TRITIUM-PTY\0"
+	"AIRFOLC,INC.\0"
+	"AIRFOLC\0"
+	"Techleader\0"
+	"TECHLEADER\0"
+	"Bodensee Gravitymeter Geosystem GmbH\0"
+	"BODENSEE-GRAVITYMETER-GEOSYSTEM\0"
+	"Aanderaa Data Instruments\0"
+	"AANDERAA-DATA-INSTRUMENTS\0"
+	"SURVALENT TECHNOLOGY CORP\0"
+	"Peekel Instruments B.V.\0"
+	"PEEKEL-INSTRUMENTS-B-V\0"
+	"Tehama Wireless\0"
+	"TEHAMA-WIRELESS\0"
+	"nCk Research LLC\0"
+	"NCK-RESEARCH\0"
+	"IAF GmbH\0"
+	"IAF\0"
+	"Reimesch Kommunikationssysteme GmbH\0"
+	"REIMESCH-KOMMUNIKATIONSSYSTEME\0"
+	"Guardtec,Inc\0"
+	"GUARDTEC\0"
+	"Airpoint Co., Ltd.\0"
+	"AIRPOINT\0"
+	"CODACO ELECTRONIC s.r.o.\0"
+	"CODACO-S-R-O\0"
+	"JVL Industri Elektronik\0"
+	"JVL-INDUSTRI-ELEKTRONIK\0"
+	"DECA Card Engineering GmbH\0"
+	"DECA-CARD-ENGINEERING\0"
+	"Weinert Engineering GmbH\0"
+	"WEINERT-ENGINEERING\0"
+	"Rosslare Enterprises Ltd.\0"
+	"Tokyo Weld Co.,Ltd.\0"
+	"TOKYO-WELD\0"
+	"GUNMA ELECTRONICS CO LTD\0"
+	"GUNMA-ELECTRONICS\0"
+	"SAET I.S.\0"
+	"MSR-Office GmbH\0"
+	"MSR-OFFICE\0"
+	"Imricor Medical Systems, Inc.\0"
+	"IMRICOR-MEDICAL\0"
+	"Glyn GmbH & Co.KG\0"
+	"GLYN\0"
+	"Applied Medical Technologies, Inc DBA AirClean Systems\0"
+	"APPLIED-MEDICAL-TECHNOLOGIES-DBA-AIRCLEAN\0"
+	"TECHKON GmbH\0"
+	"TECHKON\0"
+	"Recon Dynamics, LLC\0"
+	"RECON-DYNAMICS\0"
+	"Moco Media Pty Ltd\0"
+	"MOCO-MEDIA-PTY\0"
+	"Tobila Systems, Inc.\0"
+	"TOBILA\0"
+	"Olympus NDT Canada\0"
+	"OLYMPUS-NDT-CANADA\0"
+	"Innovative Circuit Technology\0"
+	"INNOVATIVE-CIRCUIT\0"
+	"eMDee Technology, Inc.\0"
+	"EMDEE\0"
+	"Bluestone Technology GmbH\0"
+	"BLUESTONE\0"
+	"Expro North Sea\0"
+	"EXPRO-NORTH-SEA\0"
+	"VAF Instruments BV\0"
+	"VAF-INSTRUMENTS\0"
+	"RCH GROUP\0"
+	"RCH-GROUP\0"
+	"Fr.Sauter AG\0"
+	"Axible Technologies\0"
+	"AXIBLE-TECHNOLOGIES\0"
+	"Millennium Electronics Pty.Ltd.\0"
+	"MILLENNIUM-ELECTRONICS-PTY\0"
+	"Video Tech Laboratories, Inc.\0"
+	"VIDEO-TECH-LABORATORIES\0"
+	"Schneider Electric Motion USA\0"
+	"SCHNEIDER-ELECTRIC-MOTION-USA\0"
+	"RS Gesellschaft fur Informationstechnik mbH & Co KG\0"
+	"RS-GESELLSCHAFT-FUR-INFORMATIONSTECHNIK\0"
+	"Key Systems, Inc.\0"
+	"ACTIV Financial Systems, Inc.\0"
+	"ACTIV-FINANCIAL\0"
+	"UNGAVA Technologies Inc.\0"
+	"UNGAVA-TECHNOLOGIES\0"
+	"Maddalena S.p.A\0"
+	"MADDALENA\0"
+	"GAON TECH corp.\0"
+	"GAON-TECH\0"
+	"UG Systems GmbH & Co. KG\0"
+	"UG\0"
+	"LJT & Associates, Inc.\0"
+	"LJT-ASSOCIATES\0"
+	"Kyowa Electronics Co.,Ltd.\0"
+	"KYOWA-ELECTRONICS\0"
+	"Apex NV\0"
+	"APEX-NV\0"
+	"WellSense Technologies\0"
+	"WELLSENSE-TECHNOLOGIES\0"
+	"Gitsn Inc.\0"
+	"GITSN\0"
+	"ASSYSTEM France\0"
+	"ASSYSTEM-FRANCE\0"
+	"Tellabs Operations Inc.\0"
+	"TELLABS-OPERATIONS\0"
+	"Synatec Electronic GmbH\0"
+	"SYNATEC\0"
+	"Communication Systems Solutions\0"
+	"demmel products\0"
+	"DEMMEL-PRODUCTS\0"
+	"AREA ENERGY, INC.\0"
+	"AREA-ENERGY\0"
+	"Hagenuk KMT GmbH\0"
+	"HAGENUK-KMT\0"
+	"DSP4YOU LTd\0"
+	"DSP4YOU\0"
+	"Technagon GmbH\0"
+	"TECHNAGON\0"
+	"Thales Nederland BV\0"
+	"THALES-NEDERLAND\0"
+	"Watermark Estate Management Services, LLC\0"
+	"WATERMARK-ESTATE-MANAGEMENT-SERVICES\0"
+	"Indra Australia\0"
+	"INDRA-AUSTRALIA\0"
+	"DALOG Diagnosesysteme GmbH\0"
+	"DALOG-DIAGNOSESYSTEME\0"
+	"Yardney Technical Products Inc.\0"
+	"YARDNEY-TECHNICAL-PRODUCTS\0"
+	"SECOM GmbH\0"
+	"SECOM\0"
+	"Solbrig Electronics, Inc.\0"
+	"SOLBRIG-ELECTRONICS\0"
+	"BETTINI SRL\0"
+	"F+D Feinwerk- und Drucktechnik GmbH\0"
+	"F+D-FEINWERK-UND-DRUCKTECHNIK\0"
+	"Telemerkki Oy\0"
+	"TELEMERKKI-OY\0"
+	"ABtrack s.r.l.\0"
+	"ABTRACK\0"
+	"Sterna Security\0"
+	"STERNA-SECURITY\0"
+	"SELEX Communications Limited\0"
+	"Hijikata Denki Corp.\0"
+	"HIJIKATA-DENKI\0"
+	"NIK-ELEKTRONIKA Ltd\0"
+	"NIK-ELEKTRONIKA\0"
+	"BUANCO SYSTEM A/S\0"
+	"BUANCO-SYSTEM-A/S\0"
+	"Embedded Monitoring Systems Ltd.\0"
+	"EMBEDDED-MONITORING\0"
+	"Infinition Inc.\0"
+	"INFINITION\0"
+	"Ibetor S.L.\0"
+	"IBETOR\0"
+	"PRIVATECH Inc.\0"
+	"PRIVATECH\0"
+	"Embedded Solution Bank Co., Ltd.\0"
+	"EMBEDDED-SOLUTION-BANK\0"
+	"Nihon Kessho Koogaku Co., Ltd.\0"
+	"NIHON-KESSHO-KOOGAKU\0"
+	"system2 GmbH\0"
+	"SYSTEM2\0"
+	"DATAREGIS S.A.\0"
+	"DATAREGIS\0"
+	"TV1 GmbH\0"
+	"TV1\0"
+	"TX Technology Corp\0"
+	"TX\0"
+	"Uvax Concepts\0"
+	"UVAX-CONCEPTS\0"
+	"KLING & FREITAG GmbH\0"
+	"KLING-FREITAG\0"
+	"HiSpeed Data, Inc.\0"
+	"HISPEED-DATA\0"
+	"GHL Systems Bhd\0"
+	"GHL\0"
+	"A&T Corporation, Electrics Group , LAS R&D Unit,\0"
+	"A-T-ELECTRICS-GROUP-LAS-R-D-UNIT\0"
+	"Nemec Automation\0"
+	"NEMEC-AUTOMATION\0"
+	"ALPHA Corporation\0"
+	"ALPHA\0"
+	"Pro-Digital Industria Eletronica\0"
+	"PRO-DIGITAL-INDUSTRIA-ELETRONICA\0"
+	"BC Illumination, Inc.\0"
+	"BC-ILLUMINATION\0"
+	"Imtron Messtechnik GmbH\0"
+	"IMTRON-MESSTECHNIK\0"
+	"C. Rob. Hammerstein GmbH & Co. KG\0"
+	"C-ROB-HAMMERSTEIN\0"
+	"Scale-Tron, Inc.\0"
+	"SCALE-TRON\0"
+	"Computech International\0"
+	"COMPUTECH\0"
+	"Collectric AB\0"
+	"COLLECTRIC-AB\0"
+	"Fr.SauterAG\0"
+	"P4Q Electronics\0"
+	"P4Q-ELECTRONICS\0"
+	"DSI RF Systems, Inc.\0"
+	"DSI-RF\0"
+	"Transbit Sp. z o.o.\0"
+	"OWITA GmbH\0"
+	"OWITA\0"
+	"Microcubs Systems Pvt Ltd\0"
+	"MICROCUBS-PVT\0"
+	"Voltech Instruments\0"
+	"VOLTECH-INSTRUMENTS\0"
+	"LYNX Technik AG\0"
+	"LYNX-TECHNIK\0"
+	"HMI Technologies\0"
+	"HMI-TECHNOLOGIES\0"
+	"Audio Authority Corp\0"
+	"AUDIO-AUTHORITY\0"
+	"VITEC\0"
+	"ECOMM ERA\0"
+	"ECOMM-ERA\0"
+	"Electrolight Shivuk (1994) Ltd.\0"
+	"ELECTROLIGHT-SHIVUK-1994\0"
+	"T+A elektroakustik GmbH & Co.KG\0"
+	"T+A-ELEKTROAKUSTIK\0"
+	"Visual Telecommunication Network, Inc\0"
+	"VISUAL-TELECOMMUNICATION-NETWORK\0"
+	"OptoLink  Industria e Comercio Ltda\0"
+	"OPTOLINK-INDUSTRIA-E-COMERCIO-LTDA\0"
+	"iRphotonics\0"
+	"IRPHOTONICS\0"
+	"CS-Instruments\0"
+	"CS-INSTRUMENTS\0"
+	"LSD Science&Technology Co.,Ltd.\0"
+	"LSD-SCIENCE\0"
+	"Syes srl\0"
+	"SYES-SRL\0"
+	"Dumps Electronic\0"
+	"DUMPS\0"
+	"Manz\0"
+	"MANZ\0"
+	"Axlon AB\0"
+	"AXLON-AB\0"
+	"Software Effect Enterprises, Inc\0"
+	"SOFTWARE-EFFECT-ENTERPRISES\0"
+	"CONTEC GmbH\0"
+	"ERS electronic GmbH\0"
+	"ERS\0"
+	"Rong Shun Xuan Corp.\0"
+	"RONG-SHUN-XUAN\0"
+	"T-Industry, s.r.o.\0"
+	"T-INDUSTRY-S-R-O\0"
+	"Gamber Johnson LLC\0"
+	"BitWise Controls\0"
+	"BITWISE-CONTROLS\0"
+	"Precision Remotes\0"
+	"PRECISION-REMOTES\0"
+	"metraTec GmbH\0"
+	"METRATEC\0"
+	"Manitowoc Ice\0"
+	"MANITOWOC-ICE\0"
+	"Capton\0"
+	"CAPTON\0"
+	"Sine Systems, Inc.\0"
+	"SINE\0"
+	"M & PAUL, INC\0"
+	"M-PAUL\0"
+	"Spang Power Electronics\0"
+	"SPANG-POWER-ELECTRONICS\0"
+	"eumig industrie-TV GmbH.\0"
+	"EUMIG-INDUSTRIE-TV\0"
+	"SoftwareCannery\0"
+	"SOFTWARECANNERY\0"
+	"LAUDA DR. R. WOBSER GMBH & CO. KG\0"
+	"LAUDA-DR-R-WOBSER\0"
+	"ZAO NPC Kompjuternie Technologii\0"
+	"ZAO-NPC-KOMPJUTERNIE-TECHNOLOGII\0"
+	"PROSOFT-SYSTEMS LTD\0"
+	"PROSOFT\0"
+	"SOREL GmbH\0"
+	"SOREL\0"
+	"Comsat VertriebsgmbH\0"
+	"COMSAT-VERTRIEBSGMBH\0"
+	"Motor Protection Electronics\0"
+	"MOTOR-PROTECTION-ELECTRONICS\0"
+	"Nantes Systems Private Limited\0"
+	"NANTES-PRIVATE\0"
+	"Margento R&D\0"
+	"MARGENTO-R-D\0"
+	"WITHSYSTEM Co.,Ltd\0"
+	"WITHSYSTEM\0"
+	"One-Nemoto Engineering Corporation\0"
+	"ONE-NEMOTO-ENGINEERING\0"
+	"Security Services Group (SSG)\0"
+	"SECURITY-SERVICES-GROUP-SSG\0"
+	"Acrux Technology Limited\0"
+	"ACRUX\0"
+	"TESSERA TECHNOLOGY INC.\0"
+	"TESSERA\0"
+	"ZED Ziegler Electronic Devices GmbH\0"
+	"ZED-ZIEGLER-DEVICES\0"
+	"Fluid Components Intl\0"
+	"FLUID-COMPONENTS-INTL\0"
+	"AGT Holdings Limited\0"
+	"AGT-HOLDINGS\0"
+	"T2M2 GmbH\0"
+	"T2M2\0"
+	"KinotonGmbH\0"
+	"KINOTONGMBH\0"
+	"Tele Data Control\0"
+	"TELE-DATA-CONTROL\0"
+	"Instrumentel Limited\0"
+	"INSTRUMENTEL\0"
+	"dilitronics GmbH\0"
+	"DILITRONICS\0"
+	"MCS Engenharia ltda\0"
+	"MCS-ENGENHARIA-LTDA\0"
+	"IDC Solutions Pty Ltd\0"
+	"IDC-SOLUTIONS-PTY\0"
+	"Brankamp GmbH\0"
+	"BRANKAMP\0"
+	"Electronic Applications, Inc.\0"
+	"APPLICATIONS\0"
+	"SYSTECH\0"
+	"Friend Spring Industrial Co., Ltd.\0"
+	"FRIEND-SPRING-INDUSTRIAL\0"
+	"Metraware\0"
+	"METRAWARE\0"
+	"rbz robot design s.l.\0"
+	"RBZ-ROBOT-DESIGN\0"
+	"Vision  & Control GmbH\0"
+	"VISION-CONTROL\0"
+	"A&A GENERAL SRL\0"
+	"A-A-GENERAL-SRL\0"
+	"DRS Imaging and Targeting Solutions\0"
+	"DRS-IMAGING-AND-TARGETING-SOLUTIONS\0"
+	"Device GmbH\0"
+	"DEVICE\0"
+	"SEQUTEC INC\0"
+	"SEQUTEC\0"
+	"Breakaway Systems LLC\0"
+	"BREAKAWAY\0"
+	"EGS Technologies Ltd\0"
+	"EGS-TECHNOLOGIES\0"
+	"Bucher Automation Budapest\0"
+	"BUCHER-AUTOMATION-BUDAPEST\0"
+	"Visual Productions\0"
+	"VISUAL-PRODUCTIONS\0"
+	"Dacom West GmbH\0"
+	"DACOM-WEST\0"
+	"Cerner Corporation\0"
+	"CERNER\0"
+	"Ruwisch & Kollegen GmbH\0"
+	"RUWISCH-KOLLEGEN\0"
+	"VendNovation LLC\0"
+	"VENDNOVATION\0"
+	"Lee Laser\0"
+	"LEE-LASER\0"
+	"Koncar Electrical Engineering Institute\0"
+	"KONCAR-ELECTRICAL-ENGINEERING-INSTITUTE\0"
+	"Ocean Sonics\0"
+	"OCEAN-SONICS\0"
+	"INSEVIS GmbH\0"
+	"INSEVIS\0"
+	"EtherLight\0"
+	"ETHERLIGHT\0"
+	"HINO ENGINEERING, INC\0"
+	"HINO-ENGINEERING\0"
+	"Combilent\0"
+	"COMBILENT\0"
+	"Tommotek (WA) Pty Ltd.\0"
+	"TOMMOTEK-WA-PTY\0"
+	"Jenny Science AG\0"
+	"JENNY-SCIENCE\0"
+	"MAC Valves, Inc.\0"
+	"MAC-VALVES\0"
+	"I-Evo Ltd\0"
+	"I-EVO\0"
+	"Wotbox ltd\0"
+	"WOTBOX\0"
+	"Xitek Design Limited\0"
+	"XITEK-DESIGN\0"
+	"TANTAL ELECTRONICA, SL\0"
+	"TANTAL-ELECTRONICA-SL\0"
+	"Tyco Traffic & Transportation\0"
+	"TYCO-TRAFFIC-TRANSPORTATION\0"
+	"Cleverscope\0"
+	"CLEVERSCOPE\0"
+	"ICU Scandinavia Schweiz GmbH\0"
+	"ICU-SCANDINAVIA-SCHWEIZ\0"
+	"Sec.Eng Systems Pty Ltd\0"
+	"SEC-ENG-PTY\0"
+	"NOCOSIUM\0"
+	"Ebner Electronic GmbH\0"
+	"EBNER\0"
+	"Protagon Process Technologies GmbH\0"
+	"PROTAGON-PROCESS-TECHNOLOGIES\0"
+	"KST Technology\0"
+	"Seartech\0"
+	"SEARTECH\0"
+	"YOUHO ELECTRIC IND.,LTD.\0"
+	"YOUHO-ELECTRIC-IND\0"
+	"Unixmedia Srl\0"
+	"UNIXMEDIA-SRL\0"
+	"PMAC JAPAN\0"
+	"PMAC-JAPAN\0"
+	"Trentino Systems\0"
+	"TRENTINO\0"
+	"Radinetworks Co., Ltd\0"
+	"RADINETWORKS\0"
+	"RadioMobile Inc\0"
+	"RADIOMOBILE\0"
+	"Kago Electronics BV\0"
+	"KAGO-ELECTRONICS\0"
+	"Automation Assist Japan Company\0"
+	"AUTOMATION-ASSIST-JAPAN-COMPANY\0"
+	"Calixto Systems Pvt Ltd\0"
+	"CALIXTO-PVT\0"
+	"IHI Scube Co.,Ltd\0"
+	"IHI-SCUBE\0"
+	"Jetstream Ltd.\0"
+	"JETSTREAM\0"
+	"Gall Tankdatensysteme GmbH\0"
+	"GALL-TANKDATENSYSTEME\0"
+	"Embedded Labs\0"
+	"EMBEDDED-LABS\0"
+	"Holdline Tecnologia e Sistemas Ltda\0"
+	"HOLDLINE-TECNOLOGIA-E-SISTEMAS-LTDA\0"
+	"Lo-Q plc\0"
+	"LO-Q-PLC\0"
+	"ELVEES\0"
+	"Divelbiss Corporation\0"
+	"DIVELBISS\0"
+	"Norwia AS\0"
+	"NORWIA-AS\0"
+	"Michael Riedel Transformatorenbau GmbH\0"
+	"MICHAEL-RIEDEL-TRANSFORMATORENBAU\0"
+	"Cinetix s.r.l.\0"
+	"CONTROL SYSTEMS Srl\0"
+	"CONTROL-SRL\0"
+	"Teplovodokhran\0"
+	"TEPLOVODOKHRAN\0"
+	"Plant Integrity Limited\0"
+	"PLANT-INTEGRITY\0"
+	"EN ElectronicNetwork Hamburg GmbH\0"
+	"EN-ELECTRONICNETWORK-HAMBURG\0"
+	"Funkwerk IT Karlsfeld GmbH\0"
+	"FUNKWERK-IT-KARLSFELD\0"
+	"DS! Ingenieurbuero\0"
+	"DS!-INGENIEURBUERO\0"
+	"Beam Ltd\0"
+	"BEAM\0"
+	"Goennheimer Elektronic GmbH\0"
+	"GOENNHEIMER-ELEKTRONIC\0"
+	"ENSIS Co., Ltd.\0"
+	"ENSIS\0"
+	"Oshoksh Corporation\0"
+	"OSHOKSH\0"
+	"Morita Technical Center Company\0"
+	"MORITA-TECHNICAL-CENTER-COMPANY\0"
+	"HGL Dynamics\0"
+	"HGL-DYNAMICS\0"
+	"Omnica Corporation\0"
+	"OMNICA\0"
+	"FUJI DATA SYSTEM Co., Ltd\0"
+	"Aesir Copenhagen\0"
+	"AESIR-COPENHAGEN\0"
+	"Telemetrics Inc.\0"
+	"TELEMETRICS\0"
+	"Nanosolution Inc.\0"
+	"NANOSOLUTION\0"
+	"Monnit Corp.\0"
+	"MONNIT\0"
+	"VISITO S.R.L.\0"
+	"VISITO\0"
+	"Ecrin Systems\0"
+	"ECRIN\0"
+	"Higeco S.r.l.\0"
+	"HIGECO\0"
+	"Wings for Media SL\0"
+	"WINGS-FOR-MEDIA-SL\0"
+	"Technica Engineering GmbH\0"
+	"TECHNICA-ENGINEERING\0"
+	"Stichting Sunrise\0"
+	"STICHTING-SUNRISE\0"
+	"Industrea Mining Technology\0"
+	"INDUSTREA-MINING\0"
+	"ENIKA.CZ\0"
+	"ENIKA-CZ\0"
+	"ITW Reyflex North America\0"
+	"ITW-REYFLEX-NORTH-AMERICA\0"
+	"CTF TECHNOLOGIES DO BRASIL LTDA\0"
+	"CTF-TECHNOLOGIES-DO-BRASIL-LTDA\0"
+	"Institute For Information Industry\0"
+	"INSTITUTE-FOR-INFORMATION-INDUSTRY\0"
+	"Wine Technology Marlborough\0"
+	"WINE-MARLBOROUGH\0"
+	"Famas System S.p.A.\0"
+	"FAMAS-SYSTEM\0"
+	"NEXT video systems Hard- and Software Development GmbH\0"
+	"NEXT-VIDEO-HARD-AND-SOFTWARE-DEVELOPMENT\0"
+	"Arcos Technologies LTD\0"
+	"RFENGINE CO., LTD.\0"
+	"RFENGINE\0"
+	"EOLANE MONTCEAU\0"
+	"EOLANE-MONTCEAU\0"
+	"Agri-hitech LLC\0"
+	"AGRI-HITECH\0"
+	"FUTEC INC.\0"
+	"FUTEC\0"
+	"CAIPO Automazione Industriale s.r.l.\0"
+	"CAIPO-AUTOMAZIONE-INDUSTRIALE\0"
+	"MCOPIA Co., Ltd\0"
+	"MCOPIA\0"
+	"T8 Ltd\0"
+	"T8\0"
+	"OREP\0"
+	"HORIZON.INC\0"
+	"HORIZON\0"
+	"Detech Electronics ApS\0"
+	"DETECH-ELECTRONICS-APS\0"
+	"Prima sistemi\0"
+	"PRIMA-SISTEMI\0"
+	"IB Elektronik GmbH\0"
+	"IB-ELEKTRONIK\0"
+	"Kyoritsu Electric Corporation\0"
+	"KYORITSU-ELECTRIC\0"
+	"Netmaker\0"
+	"NETMAKER\0"
+	"Sika Technology AG\0"
+	"SIKA\0"
+	"SAMSUNG Electronics Co.,Ltd.(LED Division)\0"
+	"SAMSUNG-ELECTRONICS-LED-DIVISION\0"
+	"Allerta Inc\0"
+	"ALLERTA\0"
+	"Power-One Italia S.p.A\0"
+	"POWER-ONE-ITALIA\0"
+	"Leyden Engineering\0"
+	"LEYDEN-ENGINEERING\0"
+	"traffic network solutions s.l\0"
+	"TRAFFIC-NETWORK-SOLUTIONS\0"
+	"Will corp.\0"
+	"WILL\0"
+	"FSM AG\0"
+	"FSM\0"
+	"Lightel\0"
+	"LIGHTEL\0"
+	"sp controls, inc\0"
+	"AEL Microsystems Limited\0"
+	"AEL-MICROSYSTEMS\0"
+	"Swareflex GmbH\0"
+	"SWAREFLEX\0"
+	"LS Control A/S\0"
+	"LS-CONTROL-A/S\0"
+	"Adaptive Technologies, Inc.\0"
+	"ADAPTIVE-TECHNOLOGIES\0"
+	"Xplore Technologies Corp\0"
+	"XPLORE-TECHNOLOGIES\0"
+	"Witree Co.,Ltd\0"
+	"WITREE\0"
+	"Cosmo Life Co.,Ltd\0"
+	"COSMO-LIFE\0"
+	"Multisuns Corporation\0"
+	"MULTISUNS\0"
+	"Lamson Safes & Security\0"
+	"LAMSON-SAFES-SECURITY\0"
+	"Pivitec, LLC\0"
+	"PIVITEC\0"
+	"PROTEQSEN\0"
+	"RPA Electronic Solutions, Inc.\0"
+	"RPA-SOLUTIONS\0"
+	"SystemAdvanced Co,Ltd\0"
+	"SYSTEMADVANCED\0"
+	"STT Condigi A/S\0"
+	"STT-CONDIGI-A/S\0"
+	"GS Elektromedizinische Geraete G. Stemple GmbH\0"
+	"GS-ELEKTROMEDIZINISCHE-GERAETE-G-STEMPLE\0"
+	"Perceptive Pixel Inc.\0"
+	"PERCEPTIVE-PIXEL\0"
+	"ANA-U GmbH\0"
+	"ANA-U\0"
+	"Dlite Comercio, Importadora e Serviços de Automação Ltda\0"
+	"DLITE-COMERCIO-IMPORTADORA-E-SERVIOS-DE-AUTOMAO-LTDA\0"
+	"PROYECSON S.A.\0"
+	"PROYECSON\0"
+	"Arista Systems Corporation\0"
+	"ARISTA\0"
+	"i3 International Inc.\0"
+	"I3\0"
+	"UV Networks, Inc.\0"
+	"UV-NETWORKS\0"
+	"Solace Systems\0"
+	"Hentschel System GmbH\0"
+	"HENTSCHEL-SYSTEM\0"
+	"SPARQ systems\0"
+	"SPARQ\0"
+	"nicai-systems\0"
+	"NICAI\0"
+	"DataSoft Corporation\0"
+	"DATASOFT\0"
+	"Robert Bosch Healthcare Systems, Inc.\0"
+	"ROBERT-BOSCH-HEALTHCARE\0"
+	"TEX COMPUTER SRL\0"
+	"ThinkRF Corp\0"
+	"THINKRF\0"
+	"Subsea Systems, Inc.\0"
+	"SUBSEA\0"
+	"head\0"
+	"HEAD\0"
+	"Aerodata AG\0"
+	"AERODATA\0"
+	"BAE Systems\0"
+	"BAE\0"
+	"Warp9 Tech Design, Inc.\0"
+	"WARP9-TECH-DESIGN\0"
+	"Alias ip\0"
+	"ALIAS-IP\0"
+	"Alyrica Networks\0"
+	"ALYRICA-NETWORKS\0"
+	"Pulse Communication Systems Pvt. Ltd.\0"
+	"PULSE-COMMUNICATION-PVT\0"
+	"PDU EXPERT UK LTD\0"
+	"PDU-EXPERT-UK\0"
+	"Otaki Electric Corporation\0"
+	"OTAKI-ELECTRIC\0"
+	"AR RF/Microwave Instrumentation\0"
+	"AR-RF/MICROWAVE-INSTRUMENTATION\0"
+	"Wishtek Technology, Inc.\0"
+	"WISHTEK\0"
+	"Monsoon Solutions, Inc.\0"
+	"MONSOON-SOLUTIONS\0"
+	"dspnor\0"
+	"DSPNOR\0"
+	"ALPHA-MOS\0"
+	"TimeTerminal Adductor Group AB\0"
+	"TIMETERMINAL-ADDUCTOR-GROUP-AB\0"
+	"Diehl AKO Stiftung & Co. KG\0"
+	"DIEHL-AKO-STIFTUNG\0"
+	"Droplet Measurement Technologies\0"
+	"DROPLET-MEASUREMENT-TECHNOLOGIES\0"
+	"Global Tecnologia LTDA.\0"
+	"GLOBAL-TECNOLOGIA-LTDA\0"
+	"CIVOLUTION\0"
+	"UgMO Technologies\0"
+	"UGMO-TECHNOLOGIES\0"
+	"ANT Group s.r.l\0"
+	"ANT-GROUP\0"
+	"Ixonos Plc\0"
+	"IXONOS-PLC\0"
+	"Logical Electromechanical Sys Inc.\0"
+	"LOGICAL-ELECTROMECHANICAL-SYS\0"
+	"RSUPPORT Co., Ltd.\0"
+	"RSUPPORT\0"
+	"INFRONICS SYSTEMS LIMITED\0"
+	"INFRONICS\0"
+	"LIQUID ROBOTICS, INC\0"
+	"LIQUID-ROBOTICS\0"
+	"IBERNEX INGENIERIA, S.L.\0"
+	"IBERNEX-INGENIERIA\0"
+	"Amsterdam Scientific Instruments BV\0"
+	"AMSTERDAM-SCIENTIFIC-INSTRUMENTS\0"
+	"FAL Corp\0"
+	"FAL\0"
+	"easii ic adiis\0"
+	"EASII-IC-ADIIS\0"
+	"TAIWAN HIPLUS CORPORATION\0"
+	"TAIWAN-HIPLUS\0"
+	"Nippon Systemware Co.,Ltd.\0"
+	"NIPPON-SYSTEMWARE\0"
+	"Arcontia Technology AB\0"
+	"Klangspektrum GmbH\0"
+	"KLANGSPEKTRUM\0"
+	"ECO MONITORING UTILITY SYSTEMS LTD\0"
+	"ECO-MONITORING-UTILITY\0"
+	"TAMAGAWA ELECTRONICS CO.,LTD.\0"
+	"TAMAGAWA-ELECTRONICS\0"
+	"Cat AB\0"
+	"CAT-AB\0"
+	"FBT Elettronica spa\0"
+	"FBT-ELETTRONICA-SPA\0"
+	"AVocation Systems, Inc.\0"
+	"AVOCATION\0"
+	"Plasmatronics pty ltd\0"
+	"PLASMATRONICS-PTY\0"
+	"Joint Stock Company Svyaz Inginiring M\0"
+	"JOINT-STOCK-COMPANY-SVYAZ-INGINIRING-M\0"
+	"Eyelock Corporation\0"
+	"EYELOCK\0"
+	"Smart Grid Networks\0"
+	"SMART-GRID-NETWORKS\0"
+	"Monitor Business Machines\0"
+	"osf Hansjuergen Meier GmbH & Co. KG\0"
+	"OSF-HANSJUERGEN-MEIER\0"
+	"System Industrie Electronic GmbH\0"
+	"SYSTEM-INDUSTRIE\0"
+	"Cytec Zylindertechnik GmbH\0"
+	"CYTEC-ZYLINDERTECHNIK\0"
+	"B:TECH, a. s.\0"
+	"B:TECH\0"
+	"syes srl\0"
+	"Kamacho Scale Co., Ltd.\0"
+	"KAMACHO-SCALE\0"
+	"QUANTA S.r.l.\0"
+	"QUANTA\0"
+	"Positioneering Limited\0"
+	"POSITIONEERING\0"
+	"fibrisTerre GmbH\0"
+	"FIBRISTERRE\0"
+	"Future Design Controls, Inc\0"
+	"FUTURE-DESIGN-CONTROLS\0"
+	"IDTRONIC GmbH\0"
+	"IDTRONIC\0"
+	"Homaetrix Ltd\0"
+	"HOMAETRIX\0"
+	"Specialty Microwave Corp\0"
+	"SPECIALTY-MICROWAVE\0"
+	"Smart Power Electronics GmbH & Co. KG\0"
+	"SMART-POWER-ELECTRONICS\0"
+	"Human Network Labs, Inc.\0"
+	"HUMAN-NETWORK-LABS\0"
+	"Netline Communication Technologies\0"
+	"NETLINE-COMMUNICATION-TECHNOLOGIES\0"
+	"Amstelland Electronic BV\0"
+	"AMSTELLAND\0"
+	"HCL Technologies\0"
+	"HCL-TECHNOLOGIES\0"
+	"Predictive Sensor Technology\0"
+	"PREDICTIVE-SENSOR\0"
+	"Sanmina\0"
+	"SANMINA\0"
+	"PLR Information Systems Ltd.\0"
+	"PLR-INFORMATION\0"
+	"Zephyrus Electronics LTD.\0"
+	"ZEPHYRUS-ELECTRONICS\0"
+	"Syscom Instruments\0"
+	"SYSCOM-INSTRUMENTS\0"
+	"Mango DSP, Inc\0"
+	"BMR\0"
+	"Wren Sound Systems\0"
+	"WREN-SOUND\0"
+	"KINKI ROENTGEN INDUSTRIAL CO.,LTD\0"
+	"KINKI-ROENTGEN-INDUSTRIAL\0"
+	"ESI Ventures, LLC\0"
+	"ESI-VENTURES\0"
+	"Micro-Key BV\0"
+	"MICRO-KEY\0"
+	"Icon Research Ltd\0"
+	"HASCOM International Pty Ltd\0"
+	"HASCOM-PTY\0"
+	"Treehaven Technologies, Inc.\0"
+	"TREEHAVEN-TECHNOLOGIES\0"
+	"SKYCHANNEL LTD\0"
+	"SKYCHANNEL\0"
+	"Bluetest AB\0"
+	"BLUETEST-AB\0"
+	"AeroVision Avionics, Inc.\0"
+	"AEROVISION-AVIONICS\0"
+	"Wincor Nixdorf Sp. z o.o.\0"
+	"WINCOR-NIXDORF-SP-Z-O-O\0"
+	"Organis GmbH\0"
+	"ORGANIS\0"
+	"General Industrial Controls Pvt Ltd\0"
+	"GENERAL-INDUSTRIAL-CONTROLS-PVT\0"
+	"Packet Plus, Inc.\0"
+	"PACKET-PLUS\0"
+	"VISION SYSTEMS AERONAUTIC\0"
+	"VISION-AERONAUTIC\0"
+	"Sascal Displays Ltd\0"
+	"SASCAL-DISPLAYS\0"
+	"Peter Huber Kaeltemaschinenbau SE\0"
+	"PETER-HUBER-KAELTEMASCHINENBAU-SE\0"
+	"Vitec Multimedia\0"
+	"Netlink Bilisim Sistemleri San. ve Tic. Ltd. Sti.\0"
+	"NETLINK-BILISIM-SISTEMLERI-SAN-VE-TIC-STI\0"
+	"Aqua Management\0"
+	"AQUA-MANAGEMENT\0"
+	"Dell'Orto S.P.A.\0"
+	"DELL-ORTO\0"
+	"Verified Energy, LLC.\0"
+	"VERIFIED-ENERGY\0"
+	"Unfors Instruments AB\0"
+	"UNFORS-INSTRUMENTS-AB\0"
+	"SEITEC Co. Ltd\0"
+	"SEITEC\0"
+	"Harland Simon plc\0"
+	"HARLAND-SIMON-PLC\0"
+	"Electro-Motive Diesel\0"
+	"ELECTRO-MOTIVE-DIESEL\0"
+	"Samway Electronic SRL\0"
+	"SAMWAY-SRL\0"
+	"Vertex Antennentechnik GmbH\0"
+	"VERTEX-ANTENNENTECHNIK\0"
+	"RADYNE CORPORATION\0"
+	"RADYNE\0"
+	"Bio Guard component & technologies\0"
+	"BIO-GUARD-COMPONENT-TECHNOLOGIES\0"
+	"Terratel Technology s.r.o.\0"
+	"TERRATEL-S-R-O\0"
+	"H&L Instruments, LLC\0"
+	"H-L-INSTRUMENTS\0"
+	"Miris AB\0"
+	"MIRIS-AB\0"
+	"Ruetz Technologies GmbH\0"
+	"RUETZ-TECHNOLOGIES\0"
+	"Net4Things\0"
+	"NET4THINGS\0"
+	"Sequip S+E GmbH\0"
+	"SEQUIP-S+E\0"
+	"Visitech AS\0"
+	"VISITECH-AS\0"
+	"AeroControl, Inc.\0"
+	"AEROCONTROL\0"
+	"TAMS firmware co.\0"
+	"TAMS-FIRMWARE\0"
+	"Vemco Sp. z o. o.\0"
+	"VEMCO-SP-Z-O-O\0"
+	"Project service S.a.s\0"
+	"PROJECT-SERVICE-S\0"
+	"Vtron Pty Ltd\0"
+	"VTRON-PTY\0"
+	"DENSEI COMMUNICATION Inc.\0"
+	"DENSEI-COMMUNICATION\0"
+	"iBWorld co.,ltd.\0"
+	"IBWORLD\0"
+	"FairyDevices Inc.\0"
+	"FAIRYDEVICES\0"
+	"DSPCon\0"
+	"DSPCON\0"
+	"Special Systems Engineering Center LLC\0"
+	"SPECIAL-ENGINEERING-CENTER\0"
+	"Steinbichler Optotechnik GmbH\0"
+	"STEINBICHLER-OPTOTECHNIK\0"
+	"HUSTY M.Styczen J.Hupert Sp.J.\0"
+	"HUSTY-M-STYCZEN-J-HUPERT-SP-J\0"
+	"Reason Tecnologia S.A.\0"
+	"cadac,inc.\0"
+	"CADAC\0"
+	"SHURE INCORPORATED\0"
+	"SHURE-INCORPORATED\0"
+	"Green Instruments A/S\0"
+	"GREEN-INSTRUMENTS-A/S\0"
+	"Supranet\0"
+	"SUPRANET\0"
+	"Enistic Limited\0"
+	"ENISTIC\0"
+	"KNOWHOW INFOCOM INC.\0"
+	"KNOWHOW-INFOCOM\0"
+	"Heinzinger electronic GmbH\0"
+	"HEINZINGER\0"
+	"BAP Precision Ltd.\0"
+	"BAP-PRECISION\0"
+	"Moritex Corporation\0"
+	"MORITEX\0"
+	"BAYCOM OPTO-ELECTRONICS TECHNOLGY CO., LTD.\0"
+	"BAYCOM-OPTO-ELECTRONICS-TECHNOLGY\0"
+	"Hella Gutmann Solutions GmbH\0"
+	"HELLA-GUTMANN-SOLUTIONS\0"
+	"Reach Technologies Inc.\0"
+	"REACH-TECHNOLOGIES\0"
+	"IEEE Registration Authority\0"
+	"IEEE-REGISTRATION-AUTHORITY\0"
+	"G3 Technologies\0"
+	"G3-TECHNOLOGIES\0"
+	"Y-cam Solutions Ltd\0"
+	"Y-CAM-SOLUTIONS\0"
+	"BORYEU TECHNOLOGY CO.,LTD\0"
+	"BORYEU\0"
+	"Deckma GmbH\0"
+	"DECKMA\0"
+	"Brauch Elektronik GmbH&Co.KG\0"
+	"BRAUCH-ELEKTRONIK\0"
+	"Chrisso Technologies LLC\0"
+	"CHRISSO-TECHNOLOGIES\0"
+	"Telebyte Inc.\0"
+	"TELEBYTE\0"
+	"GWT LLC\0"
+	"GWT\0"
+	"Celestial Audio\0"
+	"CELESTIAL-AUDIO\0"
+	"Safe Place Solutions Ltd\0"
+	"SAFE-PLACE-SOLUTIONS\0"
+	"OFI Inc. (dba 2D2C)\0"
+	"OFI-DBA-2D2C\0"
+	"Pro Design Electronic GmbH\0"
+	"PRO-DESIGN\0"
+	"Noralta Technologies Inc\0"
+	"NORALTA-TECHNOLOGIES\0"
+	"MaxDeTec AG\0"
+	"MAXDETEC\0"
+	"DELTACAST.TV\0"
+	"DELTACAST-TV\0"
+	"Thor Technologies Pty Ltd\0"
+	"THOR-TECHNOLOGIES-PTY\0"
+	"PumpWell Solutions Ltd.\0"
+	"PUMPWELL-SOLUTIONS\0"
+	"Rong Jie(FuZhou)Electronics Co.,Ltd\0"
+	"RONG-JIE-FUZHOU-ELECTRONICS\0"
+	"SYSTEMTECHNIK GmbH\0"
+	"Gets MSS S.A.\0"
+	"GETS-MSS\0"
+	"C3 LLC\0"
+	"C3\0"
+	"MCM Electronics\0"
+	"MCM-ELECTRONICS\0"
+	"Atonometrics, Inc.\0"
+	"ATONOMETRICS\0"
+	"D-Hike Electroncs Technology Co.,Ltd\0"
+	"D-HIKE-ELECTRONCS\0"
+	"TruTeq Wireless (Pty) Ltd\0"
+	"Dynamic Design\0"
+	"DYNAMIC-DESIGN\0"
+	"PLDA\0"
+	"Sincair Systems International\0"
+	"SINCAIR\0"
+	"Enetics, Inc.\0"
+	"ENETICS\0"
+	"Audio Power Labs\0"
+	"AUDIO-POWER-LABS\0"
+	"RTC Manufacturing Inc.\0"
+	"RTC-MANUFACTURING\0"
+	"CSA Engineering AG\0"
+	"CSA-ENGINEERING\0"
+	"comlet Verteilte Systeme GmbH\0"
+	"COMLET-VERTEILTE-SYSTEME\0"
+	"UBSTechnology Co., Ltd\0"
+	"UBSTECHNOLOGY\0"
+	"Guangdong East Power Co.,\0"
+	"GUANGDONG-EAST-POWER\0"
+	"GPO\0"
+	"SecureTech Systems, Inc.\0"
+	"SECURETECH\0"
+	"RE2 Inc\0"
+	"RE2\0"
+	"CONET Solutions GmbH\0"
+	"CONET-SOLUTIONS\0"
+	"Digital Barriers\0"
+	"DIGITAL-BARRIERS\0"
+	"TTi LTD (Thurlby Thandar Instruments LTD)\0"
+	"TTI-THURLBY-THANDAR-INSTRUMENTS\0"
+	"Infotech North America\0"
+	"INFOTECH-NORTH-AMERICA\0"
+	"Dr. Neumann elektronik GmbH\0"
+	"DR-NEUMANN-ELEKTRONIK\0"
+	"NEWELL TECHNOLOGIES LIMITED\0"
+	"NEWELL-TECHNOLOGIES\0"
+	"R&D KOMETEH\0"
+	"R-D-KOMETEH\0"
+	"JSC Kaluga Teletypes Manufacturing Plant\0"
+	"JSC-KALUGA-TELETYPES-MANUFACTURING-PLANT\0"
+	"Matsusada Precision Inc.\0"
+	"MATSUSADA-PRECISION\0"
+	"Nanjing SAC Power Grid Automation Co., Ltd.\0"
+	"NANJING-SAC-POWER-GRID-AUTOMATION\0"
+	"Amplus Communication Pte Ltd\0"
+	"AMPLUS-COMMUNICATION-PTE\0"
+	"N-Hands GmbH und Co KG\0"
+	"N-HANDS-UND\0"
+	"Power-One\0"
+	"Xemex NV\0"
+	"XEMEX-NV\0"
+	"Hilkom digital GmbH\0"
+	"HILKOM-DIGITAL\0"
+	"Exelis Inc.\0"
+	"EXELIS\0"
+	"Yash SiQure Technologies India Pvt. Ltd.\0"
+	"YASH-SIQURE-TECHNOLOGIES-INDIA-PVT\0"
+	"Hijet Print d.o.o.\0"
+	"HIJET-PRINT-D-O-O\0"
+	"YJSYSTEM\0"
+	"ADETEL GROUP\0"
+	"ADETEL-GROUP\0"
+	"Finishing Brands\0"
+	"FINISHING-BRANDS\0"
+	"ATI Automação Telecomunicações e Informática Ltda\0"
+	"ATI-AUTOMAO-TELECOMUNICAES-E-INFORMTICA-LTDA\0"
+	"Vremya-CH JSC\0"
+	"VREMYA-CH-JSC\0"
+	"Tateishi Kobisha Co.LTD\0"
+	"TATEISHI-KOBISHA\0"
+	"MATELEX\0"
+	"Preston Industries dba PolyScience\0"
+	"PRESTON-INDUSTRIES-DBA-POLYSCIENCE\0"
+	"MC-monitoring SA\0"
+	"MC-MONITORING\0"
+	"Pounce Consulting\0"
+	"POUNCE-CONSULTING\0"
+	"TECHNO CO.,LTD.\0"
+	"TECHNO\0"
+	"ACIDA GmbH\0"
+	"ACIDA\0"
+	"Leroy Somer\0"
+	"LEROY-SOMER\0"
+	"senTec Elektronik GmbH\0"
+	"SENTEC-ELEKTRONIK\0"
+	"MYLOGIC\0"
+	"ELTA\0"
+	"HSDC Sp. z o.o.\0"
+	"HSDC-SP-Z-O-O\0"
+	"Kyowadensi\0"
+	"KYOWADENSI\0"
+	"Sakura Seiki Co.,Ltd.\0"
+	"SAKURA-SEIKI\0"
+	"SERCOM Regeltechniek\0"
+	"SERCOM-REGELTECHNIEK\0"
+	"Far South Networks\0"
+	"FAR-SOUTH-NETWORKS\0"
+	"Mehta Tech, Inc.\0"
+	"MEHTA-TECH\0"
+	"Telemisis Ltd\0"
+	"TELEMISIS\0"
+	"Propagation Systems Limited\0"
+	"PROPAGATION\0"
+	"Soudronic AG\0"
+	"SOUDRONIC\0"
+	"Jinyoung Contech\0"
+	"JINYOUNG-CONTECH\0"
+	"KOYO ELECTRIC\0"
+	"KOYO-ELECTRIC\0"
+	"DINTEK Shanghai Electronic Ltd\0"
+	"DINTEK-SHANGHAI\0"
+	"Simple Solutions\0"
+	"SIMPLE-SOLUTIONS\0"
+	"Enyx SA\0"
+	"ENYX\0"
+	"Autonomic Controls. Inc\0"
+	"AUTONOMIC-CONTROLS\0"
+	"Aster Electric Co.,Ltd.\0"
+	"ASTER-ELECTRIC\0"
+	"City Computing Ltd\0"
+	"CITY-COMPUTING\0"
+	"Ease Inc.\0"
+	"EASE\0"
+	"The Security Center Inc\0"
+	"THE-SECURITY-CENTER\0"
+	"Peek Traffic\0"
+	"Azurtest\0"
+	"AZURTEST\0"
+	"dotOcean\0"
+	"DOTOCEAN\0"
+	"Pulsotronic Anlagentechnik GmbH\0"
+	"PULSOTRONIC-ANLAGENTECHNIK\0"
+	"RTT Mobile Interpretation\0"
+	"RTT-MOBILE-INTERPRETATION\0"
+	"ScandiNova Systems\0"
+	"SCANDINOVA\0"
+	"Exibea AB\0"
+	"EXIBEA-AB\0"
+	"Mango DSP, Inc.\0"
+	"Brunel GmbH Section Communications\0"
+	"BRUNEL-SECTION-COMMUNICATION\0"
+	"First System Technology Co., Ltd.\0"
+	"FIRST-SYSTEM\0"
+	"LOGISOL Kft.\0"
+	"LOGISOL-KFT\0"
+	"Sparks Instruments SA\0"
+	"SPARKS-INSTRUMENTS\0"
+	"Task Sistemas de Computacao\0"
+	"TASK-SISTEMAS-DE-COMPUTACAO\0"
+	"Flexkom Internet Pazarlama Bilipim ve Eoitim Hiz.Inp.Mim.Muh.Oto.Enerji San. Tic. A.p.\0"
+	"FLEXKOM-INTERNET-PAZARLAMA-BILIPIM-VE-EOITIM-HIZ-INP-MIM-MUH-OTO-ENERJI-SAN-TIC-A-P\0"
+	"Booyco Electronics\0"
+	"BOOYCO-ELECTRONICS\0"
+	"Human Intech\0"
+	"HUMAN-INTECH\0"
+	"KST technology\0"
+	"AVA Monitoring AB\0"
+	"AVA-MONITORING-AB\0"
+	"Nupoint Systems Inc.\0"
+	"NUPOINT\0"
+	"SEFRAM\0"
+	"Touchless Biometric Systems AG\0"
+	"TOUCHLESS-BIOMETRIC\0"
+	"MSR-Solutions GmbH\0"
+	"MSR-SOLUTIONS\0"
+	"XRONOS.INC\0"
+	"XRONOS\0"
+	"Vemotion\0"
+	"VEMOTION\0"
+	"Hangzhou Chenxiao Technologies Co. Ltd.\0"
+	"HANGZHOU-CHENXIAO-TECHNOLOGIES\0"
+	"AlphaNavigation coltd\0"
+	"ALPHANAVIGATION-COLTD\0"
+	"CR Magnetics, Inc.\0"
+	"CR-MAGNETICS\0"
+	"Bactest Limited\0"
+	"BACTEST\0"
+	"Digital Audio SA\0"
+	"DIGITAL-AUDIO\0"
+	"Kaori Industria Eletronica Ltda\0"
+	"KAORI-INDUSTRIA-ELETRONICA-LTDA\0"
+	"ClearSite Communications Inc.\0"
+	"CLEARSITE-COMMUNICATION\0"
+	"Sarana Sistem Mikro\0"
+	"SARANA-SISTEM-MIKRO\0"
+	"HuNS\0"
+	"HUNS\0"
+	"Brightwell Dispensers\0"
+	"BRIGHTWELL-DISPENSERS\0"
+	"DIGITAL DYNAMICS, INC.\0"
+	"Flexim Security Oy\0"
+	"FLEXIM-SECURITY-OY\0"
+	"Sencon Inc.\0"
+	"SENCON\0"
+	"Grande Vitesse Systems\0"
+	"GRANDE-VITESSE\0"
+	"Toni Studio\0"
+	"TONI-STUDIO\0"
+	"BITMILL srl\0"
+	"BITMILL-SRL\0"
+	"Franke Aquarotter GmbH\0"
+	"FRANKE-AQUAROTTER\0"
+	"STANEO SAS\0"
+	"STANEO-SAS\0"
+	"MEGGITT DEFENSE SYSTEMS INC.\0"
+	"MEGGITT-DEFENSE\0"
+	"Audio Enhancement\0"
+	"AUDIO-ENHANCEMENT\0"
+	"BERG Cloud Limited\0"
+	"BERG-CLOUD\0"
+	"Scharco Elektronik GmbH\0"
+	"SCHARCO-ELEKTRONIK\0"
+	"A2S\0"
+	"Sitep Italia Spa\0"
+	"SITEP-ITALIA-SPA\0"
+	"ENTEC Electric & Electronic CO., LTD.\0"
+	"SMT D.O.O.\0"
+	"Digimerge Technology Inc\0"
+	"DIGIMERGE\0"
+	"Shanghai o-solution electronics & Technology Co., Ltd.\0"
+	"SHANGHAI-O-SOLUTION-ELECTRONICS\0"
+	"Electrical Geodesics Incorporated\0"
+	"ELECTRICAL-GEODESICS-INCORPORATED\0"
+	"Rosemount Analytical\0"
+	"ROSEMOUNT-ANALYTICAL\0"
+	"Integrated Control Corp.\0"
+	"Depro Electronique\0"
+	"DEPRO-ELECTRONIQUE\0"
+	"Tinkerforge GmbH\0"
+	"TINKERFORGE\0"
+	"Nomatronics\0"
+	"NOMATRONICS\0"
+	"InventLab s.c.\0"
+	"INVENTLAB-S-C\0"
+	"Elgama Sistemos\0"
+	"ELGAMA-SISTEMOS\0"
+	"Circuitec Ind. Equip. Eletr. Ltda\0"
+	"CIRCUITEC-IND-EQUIP-ELETR-LTDA\0"
+	"Advatek Lighting Pty Ltd\0"
+	"ADVATEK-LIGHTING-PTY\0"
+	"Tecnologias Plexus\0"
+	"TECNOLOGIAS-PLEXUS\0"
+	"Dommel GmbH\0"
+	"DOMMEL\0"
+	"Ermes Elettronica s.r.l.\0"
+	"ERMES-ELETTRONICA\0"
+	"Mesotech International, Inc.\0"
+	"MESOTECH\0"
+	"Schweers informationstechnologie GmbH\0"
+	"SCHWEERS-INFORMATIONSTECHNOLOGIE\0"
+	"Software Workshop\0"
+	"SOFTWARE-WORKSHOP\0"
+	"Special Measurements Labs LLC\0"
+	"SPECIAL-MEASUREMENTS-LABS\0"
+	"CI Systems Ltd\0"
+	"Socus networks\0"
+	"SOCUS-NETWORKS\0"
+	"Telcomkorea\0"
+	"TELCOMKOREA\0"
+	"Computer System Co.,Ltd\0"
+	"SYSTEM\0"
+	"Tekelek Europe Ltd\0"
+	"TEKELEK-EUROPE\0"
+	"Vishay Celtron Technologies, Inc.\0"
+	"VISHAY-CELTRON-TECHNOLOGIES\0"
+	"UniSVR Global Information Technology Corp.\0"
+	"UNISVR-GLOBAL-INFORMATION\0"
+	"T.Q.M. Itaca Technology s.r.l.\0"
+	"T-Q-M-ITACA\0"
+	"Mango Communicaitons Inc.\0"
+	"MANGO-COMMUNICAITONS\0"
+	"SchulerControl GmbH\0"
+	"SCHULERCONTROL\0"
+	"An Chen Computer Co., Ltd.\0"
+	"AN-CHEN\0"
+	"Genadsystem\0"
+	"GENADSYSTEM\0"
+	"Circuitlink Pty Ltd\0"
+	"CIRCUITLINK-PTY\0"
+	"Dos&Donts SRL\0"
+	"DOS-DONTS-SRL\0"
+	"Gateway Technologies SA de CV\0"
+	"GATEWAY-TECHNOLOGIES-DE-CV\0"
+	"Vital Tech Industria e Comercio Ltda\0"
+	"VITAL-TECH-INDUSTRIA-E-COMERCIO-LTDA\0"
+	"MACHINEPERFORMANCE ApS\0"
+	"MACHINEPERFORMANCE-APS\0"
+	"Honeywell International\0"
+	"Haein S&S Co., Ltd\0"
+	"HAEIN-S-S\0"
+	"ATG UV Technology\0"
+	"ATG-UV\0"
+	"CS Instruments Asia\0"
+	"CS-INSTRUMENTS-ASIA\0"
+	"DAN ELECTRONICS SYSTEM (P) LIMITED\0"
+	"DAN-ELECTRONICS-SYSTEM-P\0"
+	"Amantys Ltd\0"
+	"AMANTYS\0"
+	"Helmholtz Zentrum Dresden Rossendorf e.V.\0"
+	"HELMHOLTZ-ZENTRUM-DRESDEN-ROSSENDORF\0"
+	"GROUP 57\0"
+	"GROUP-57\0"
+	"Tammermatic Group Oy\0"
+	"TAMMERMATIC-GROUP-OY\0"
+	"Energy Team S.p.A.\0"
+	"ENERGY-TEAM\0"
+	"COLONIAL ASSEMBLY and  DESIGN\0"
+	"COLONIAL-ASSEMBLY-AND-DESIGN\0"
+	"Ultra Electronics Flightline Systems\0"
+	"ULTRA-ELECTRONICS-FLIGHTLINE\0"
+	"Data Flow Systems, Inc.\0"
+	"DATA-FLOW\0"
+	"Leica Biosystems\0"
+	"LEICA-BIOSYSTEMS\0"
+	"inoage GmbH\0"
+	"INOAGE\0"
+	"Tech Source Inc\0"
+	"TECH-SOURCE\0"
+	"HIPODROMO DE AGUA CALIENTE, S.A. DE C.V.\0"
+	"HIPODROMO-DE-AGUA-CALIENTE-DE-C-V\0"
+	"Parallel Wireless, Inc\0"
+	"PARALLEL-WIRELESS\0"
+	"TeraTron GmbH\0"
+	"TERATRON\0"
+	"Tronic Control ltd.\0"
+	"TRONIC-CONTROL\0"
+	"Oki Seatec Co., Ltd.\0"
+	"OKI-SEATEC\0"
+	"elgris UG\0"
+	"ELGRIS-UG\0"
+	"BroadSoft, INC\0"
+	"BROADSOFT\0"
+	"Diamond Technologies, Inc\0"
+	"DIAMOND-TECHNOLOGIES\0"
+	"Sphere Medical Ltd\0"
+	"SPHERE-MEDICAL\0"
+	"Teraflops\0"
+	"TERAFLOPS\0"
+	"TOEC TECHNOLOGY CO.,LTD\0"
+	"TOEC\0"
+	"NACHI-FUJIKOSHI CORP\0"
+	"NACHI-FUJIKOSHI\0"
+	"DelfiSolutions A/S\0"
+	"DELFISOLUTIONS-A/S\0"
+	"4embedded\0"
+	"4EMBEDDED\0"
+	"IPS Technology Limited\0"
+	"IPS\0"
+	"Agramkow Fluid Systems A/S\0"
+	"AGRAMKOW-FLUID-A/S\0"
+	"Wuxi SiNeng New Energy Co., Ltd.\0"
+	"WUXI-SINENG-NEW-ENERGY\0"
+	"TESCOM CORPORATION\0"
+	"TESCOM\0"
+	"DELOPT\0"
+	"Papendorf Software Engineering GmbH\0"
+	"PAPENDORF-SOFTWARE-ENGINEERING\0"
+	"Bestel China\0"
+	"BESTEL-CHINA\0"
+	"JEL SYSTEM CO., LTD.\0"
+	"JEL-SYSTEM\0"
+	"Wuhan Xingtuxinke ELectronic Co.,Ltd\0"
+	"WUHAN-XINGTUXINKE\0"
+	"Leder Elektronik Design\0"
+	"LEDER-ELEKTRONIK-DESIGN\0"
+	"Magnescale Co.,Ltd\0"
+	"MAGNESCALE\0"
+	"Boehme Nachrichtentechnik\0"
+	"BOEHME-NACHRICHTENTECHNIK\0"
+	"Excelitas\0"
+	"EXCELITAS\0"
+	"Axxess Identification Ltd\0"
+	"AXXESS-IDENTIFICATION\0"
+	"Wasserbauer GmbH\0"
+	"WASSERBAUER\0"
+	"Nomad Digital Limited\0"
+	"NOMAD-DIGITAL\0"
+	"Heart Force Medical\0"
+	"HEART-FORCE-MEDICAL\0"
+	"Comtel Electronics GmbH\0"
+	"COMTEL-ELECTRONICS\0"
+	"Burton Technical Services LLC\0"
+	"BURTON-TECHNICAL-SERVICES\0"
+	"idcell co.ltd\0"
+	"IDCELL\0"
+	"CoherentPlus Sdn Bhd\0"
+	"COHERENTPLUS\0"
+	"Tokyo Denki Gijutsu Kogyo\0"
+	"TOKYO-DENKI-GIJUTSU-KOGYO\0"
+	"Keyware Solutions Inc.\0"
+	"KEYWARE-SOLUTIONS\0"
+	"NanoPulse, Inc.\0"
+	"NANOPULSE\0"
+	"Bascules Robbe nv\0"
+	"BASCULES-ROBBE-NV\0"
+	"ADVALY SYSTEM Inc.\0"
+	"ADVALY-SYSTEM\0"
+	"Telefrank GmbH\0"
+	"TELEFRANK\0"
+	"Resch Electronic Innovation GmbH\0"
+	"RESCH-INNOVATION\0"
+	"WooshCom Corporation\0"
+	"WOOSHCOM\0"
+	"Alumbra Produtos Elétricos e Eletrônicos Ltda\0"
+	"ALUMBRA-PRODUTOS-ELTRICOS-E-ELETRNICOS-LTDA\0"
+	"First Design System Inc.\0"
+	"FIRST-DESIGN-SYSTEM\0"
+	"Thermal Imaging Radar, LLC\0"
+	"THERMAL-IMAGING-RADAR\0"
+	"Enel doo Belgrade\0"
+	"ENEL-DOO-BELGRADE\0"
+	"Fraunhofer HHI\0"
+	"FRAUNHOFER-HHI\0"
+	"Space Micro\0"
+	"SPACE-MICRO\0"
+	"EnVerv Inc.\0"
+	"ENVERV\0"
+	"Micrologic\0"
+	"MICROLOGIC\0"
+	"Nanjing TIANSU Automation Control System Co., Ltd.\0"
+	"NANJING-TIANSU-AUTOMATION-CONTROL-SYSTEM\0"
+	"Ever Trend Technology Development Limited\0"
+	"EVER-TREND-DEVELOPMENT\0"
+	"T.W.S. srl\0"
+	"T-W-S-SRL\0"
+	"MITSUBISHI ELECTRIC SYSTEM & SERVICE CO.,LTD.\0"
+	"MITSUBISHI-ELECTRIC-SYSTEM-SERVICE\0"
+	"DATA SHARING CONSULTING\0"
+	"DATA-SHARING-CONSULTING\0"
+	"Ferlin Trading BV\0"
+	"FERLIN-TRADING\0"
+	"WxBR Sistemas de Telecomunicacoes Ltda\0"
+	"WXBR-SISTEMAS-DE-TELECOMUNICACOES-LTDA\0"
+	"PCH Engineering A/S\0"
+	"PCH-ENGINEERING-A/S\0"
+	"Whiptail\0"
+	"WHIPTAIL\0"
+	"iCOGNIZE GmbH\0"
+	"ICOGNIZE\0"
+	"Manufacturing System Insights Inc\0"
+	"MANUFACTURING-SYSTEM-INSIGHTS\0"
+	"Shenzhen SETEC Power Co.,Ltd\0"
+	"SHENZHEN-SETEC-POWER\0"
+	"Xepto Computing Inc\0"
+	"XEPTO-COMPUTING\0"
+	"SC Techswarm SRL\0"
+	"SC-TECHSWARM-SRL\0"
+	"Inspired Systems\0"
+	"INSPIRED\0"
+	"M.M. Elektrolab\0"
+	"M-M-ELEKTROLAB\0"
+	"comtime GmbH\0"
+	"COMTIME\0"
+	"insensiv GmbH\0"
+	"INSENSIV\0"
+	"QUANTAFLOW\0"
+	"NEUTRIK AG\0"
+	"NEUTRIK\0"
+	"ReliOn Inc\0"
+	"Logical Product\0"
+	"LOGICAL-PRODUCT\0"
+	"EST Analytical\0"
+	"EST-ANALYTICAL\0"
+	"Clark-MXR, Inc.\0"
+	"CLARK-MXR\0"
+	"Icraft Oy\0"
+	"ICRAFT-OY\0"
+	"Cantada Inc\0"
+	"CANTADA\0"
+	"Mitsubishi Heavy Industries, Ltd.\0"
+	"MITSUBISHI-HEAVY-INDUSTRIES\0"
+	"Shimizu Electric Co., Ltd.\0"
+	"SHIMIZU-ELECTRIC\0"
+	"deskontrol electronics\0"
+	"DESKONTROL-ELECTRONICS\0"
+	"Avant Technologies\0"
+	"AVANT-TECHNOLOGIES\0"
+	"NEXT! s.c. S.Piela B.Dryja\0"
+	"NEXT!-S-C-S-PIELA-B-DRYJA\0"
+	"YUKO ELECTRIC CO.,LTD\0"
+	"YUKO-ELECTRIC\0"
+	"Devialet SA\0"
+	"DEVIALET\0"
+	"Top Connect OU\0"
+	"TOP-CONNECT-OU\0"
+	"NVS Technologies Inc\0"
+	"NVS-TECHNOLOGIES\0"
+	"Embed Limited\0"
+	"EMBED\0"
+	"Xadi Inc\0"
+	"XADI\0"
+	"Richter\0"
+	"RICHTER\0"
+	"STV Electronic GmbH\0"
+	"STV\0"
+	"Keocko Holding Kft.\0"
+	"KEOCKO-HOLDING-KFT\0"
+	"Medigus Ltd\0"
+	"MEDIGUS\0"
+	"ARAGO SYSTEMS\0"
+	"ARAGO\0"
+	"Triton Electronics LTD\0"
+	"TRITON-ELECTRONICS\0"
+	"Kyoritsu Electric Corp.\0"
+	"LIGHTSTAR\0"
+	"HEITEC AG\0"
+	"HEITEC\0"
+	"A-Z-E\0"
+	"WANTECH Networks\0"
+	"WANTECH-NETWORKS\0"
+	"Siegmar Zander HuSWare\0"
+	"SIEGMAR-ZANDER-HUSWARE\0"
+	"GeneSys Elektronik GmbH\0"
+	"GENESYS-ELEKTRONIK\0"
+	"SigmaPhi Electronics\0"
+	"SIGMAPHI-ELECTRONICS\0"
+	"ECON Systems Inc.\0"
+	"ECON\0"
+	"CST Group\0"
+	"CST-GROUP\0"
+	"Comline Elektronik Elektrotechnik GmbH\0"
+	"COMLINE-ELEKTRONIK-ELEKTROTECHNIK\0"
+	"Better Place\0"
+	"BETTER-PLACE\0"
+	"Invisua Lighting BV\0"
+	"INVISUA-LIGHTING\0"
+	"Marmitek BV\0"
+	"MARMITEK\0"
+	"InfoMac Sp. z o. o. Sp. k.\0"
+	"INFOMAC-SP-Z-O-O-SP-K\0"
+	"MONOGRAM technologies ltd\0"
+	"MONOGRAM-TECHNOLOGIES\0"
+	"Cytech Technology Pte Ltd\0"
+	"CYTECH-PTE\0"
+	"TASK SISTEMAS DE COMPUTACAO S.A.\0"
+	"e.p.g. Elettronica Srl\0"
+	"E-P-G-ELETTRONICA-SRL\0"
+	"IMPLE SISTEMAS ELETRONICOS EMBARCADOS LTDA\0"
+	"IMPLE-SISTEMAS-ELETRONICOS-EMBARCADOS-LTDA\0"
+	"Orbital A/S\0"
+	"ORBITAL-A/S\0"
+	"ALPHA DESIGN CO.,LTD.\0"
+	"ALPHA-DESIGN\0"
+	"DAVIS DERBY LIMITED\0"
+	"DAVIS-DERBY\0"
+	"So-Cool Corporation.\0"
+	"SO-COOL\0"
+	"Contrans TI sp. z o.o.\0"
+	"CONTRANS-TI-SP-Z-O-O\0"
+	"Rite-Tech Industrial Co., Ltd.\0"
+	"RITE-TECH-INDUSTRIAL\0"
+	"HKS-Prozesstechnik GmbH\0"
+	"HKS-PROZESSTECHNIK\0"
+	"CAVALRY STORAGE INC\0"
+	"CAVALRY-STORAGE\0"
+	"Testbook Ltd\0"
+	"TESTBOOK\0"
+	"MESA Electronic GmbH\0"
+	"MESA\0"
+	"Uniscan LLC\0"
+	"UNISCAN\0"
+	"RCS Energy Management Limited\0"
+	"University of Nebraska -- Lincoln\0"
+	"UNIVERSITY-OF-NEBRASKA-LINCOLN\0"
+	"OOO Group of Industrial Technologies\0"
+	"OOO-GROUP-OF-INDUSTRIAL-TECHNOLOGIES\0"
+	"nanoTRONIC GmbH\0"
+	"NANOTRONIC\0"
+	"CEMSI, Inc.\0"
+	"KOMPAN Pawel Sokolowski\0"
+	"KOMPAN-PAWEL-SOKOLOWSKI\0"
+	"ObjectFab GmbH\0"
+	"OBJECTFAB\0"
+	"shanghai Anjian Information technology co. , ltd.\0"
+	"SHANGHAI-ANJIAN-INFORMATION\0"
+	"ATX Networks Ltd.\0"
+	"ATX-NETWORKS\0"
+	"ZAO NPC  Kompjuternie Technologii\0"
+	"Debug s.r.l.\0"
+	"DEBUG\0"
+	"Scandyna A/S\0"
+	"SCANDYNA-A/S\0"
+	"TTI LTD\0"
+	"AKSE srl\0"
+	"AKSE-SRL\0"
+	"Jadpod Communication Company Limited\0"
+	"JADPOD-COMMUNICATION-COMPANY\0"
+	"NSP Europe Ltd\0"
+	"NSP-EUROPE\0"
+	"Biotage Sweden AB\0"
+	"BIOTAGE-SWEDEN-AB\0"
+	"Canfield Scientific, Inc.\0"
+	"CANFIELD-SCIENTIFIC\0"
+	"AeroVision Avionics, Inc\0"
+	"digitech GmbH &amp; Co. KG\0"
+	"DIGITECH-AMP\0"
+	"Devriecom B.V.\0"
+	"DEVRIECOM-B-V\0"
+	"GDE Polska\0"
+	"GDE-POLSKA\0"
+	"Calon Associates Limited\0"
+	"CALON-ASSOCIATES\0"
+	"WOW System\0"
+	"WOW-SYSTEM\0"
+	"Supplier Ind. e Com de Eletroeletrônicos\0"
+	"SUPPLIER-IND-E-COM-DE-ELETROELETRNICOS\0"
+	"Davin Technologies Co.,Ltd\0"
+	"DAVIN-TECHNOLOGIES\0"
+	"Perm Scientific-Industrial Instrument Making Company JSC\0"
+	"PERM-SCIENTIFIC-INDUSTRIAL-INSTRUMENT-MAKING-COMPANY-JSC\0"
+	"hanatech\0"
+	"HANATECH\0"
+	"Zhejiang Wellsun Electric Meter Co.,Ltd\0"
+	"ZHEJIANG-WELLSUN-ELECTRIC-METER\0"
+	"InnoTrans Communications, Inc\0"
+	"Tetracore, Inc.\0"
+	"TETRACORE\0"
+	"Tokyo Drawing Ltd.\0"
+	"TOKYO-DRAWING\0"
+	"Venco\0"
+	"VENCO\0"
+	"Weber Marking Systems GmbH\0"
+	"WEBER-MARKING\0"
+	"Pleiger Elektronik GmbH  and Co. KG\0"
+	"PLEIGER-ELEKTRONIK\0"
+	"SEIKO TIME SYSTEMS INC.\0"
+	"SEIKO-TIME\0"
+	"PLT\0"
+	"SOMFY SAS\0"
+	"SOMFY-SAS\0"
+	"Marposs S.p.A\0"
+	"MARPOSS\0"
+	"TDS Software Solutions Pty Ltd\0"
+	"TDS-SOFTWARE-SOLUTIONS-PTY\0"
+	"SHIKINO HIGH-TECH\0"
+	"SHIKINO-HIGH-TECH\0"
+	"Progress Rail Services, Inspection and Information Systems\0"
+	"PROGRESS-RAIL-SERVICES-INSPECTION-AND-INFORMATION\0"
+	"Home Automation Europe\0"
+	"HOME-AUTOMATION-EUROPE\0"
+	"BlinkPipe Ltd\0"
+	"BLINKPIPE\0"
+	"iart\0"
+	"IART\0"
+	"Emphysys, Inc.\0"
+	"EMPHYSYS\0"
+	"Hitachi Power Solutions Co., Ltd.\0"
+	"HITACHI-POWER-SOLUTIONS\0"
+	"PLATINUM GmbH\0"
+	"PLATINUM\0"
+	"SQF Spezialelektronik GmbH\0"
+	"SQF-SPEZIALELEKTRONIK\0"
+	"Spectratech Inc.\0"
+	"SPECTRATECH\0"
+	"Actronic Technologies\0"
+	"ACTRONIC-TECHNOLOGIES\0"
+	"Thermo Fisher Sceintific\0"
+	"THERMO-FISHER-SCEINTIFIC\0"
+	"Solidscape Inc\0"
+	"SOLIDSCAPE\0"
+	"LUNA-NEXUS\0"
+	"KMtronic ltd\0"
+	"KMTRONIC\0"
+	"NFT Automatisierungssysteme GmbH\0"
+	"NFT-AUTOMATISIERUNGSSYSTEME\0"
+	"TECHBOARD SRL\0"
+	"TECHBOARD-SRL\0"
+	"Anhui Jiante Network Technology Co., Ltd.\0"
+	"ANHUI-JIANTE-NETWORK\0"
+	"Assembly Contracts Ltd\0"
+	"OPASCA Systems GmbH\0"
+	"OPASCA\0"
+	"Photop Koncent\0"
+	"PHOTOP-KONCENT\0"
+	"TECHWAY\0"
+	"Secuinfo Co.Ltd\0"
+	"BrightLeaf Power\0"
+	"BRIGHTLEAF-POWER\0"
+	"ICS Eletronics\0"
+	"ICS-ELETRONICS\0"
+	"YAWATA ELECTRIC INDUSTRIAL CO.,LTD.\0"
+	"YAWATA-ELECTRIC-INDUSTRIAL\0"
+	"EcoGuard AB\0"
+	"ECOGUARD-AB\0"
+	"AHB Systeme GmbH\0"
+	"AHB-SYSTEME\0"
+	"Schneider Electric Motion, Inc. USA\0"
+	"TRI Engineering co.,ltd.\0"
+	"TRI-ENGINEERING\0"
+	"REDER Domotic GmbH\0"
+	"REDER-DOMOTIC\0"
+	"Servo-Robot Inc.\0"
+	"SERVO-ROBOT\0"
+	"Kiwigrid GmbH\0"
+	"KIWIGRID\0"
+	"TOKHATEC\0"
+	"BroadSoft Inc\0"
+	"eROCCA\0"
+	"EROCCA\0"
+	"Georg Neumann GmbH\0"
+	"GEORG-NEUMANN\0"
+	"Satkirit Ltd\0"
+	"SATKIRIT\0"
+	"Standard Change Makers\0"
+	"STANDARD-CHANGE-MAKERS\0"
+	"CDEX Corp.\0"
+	"CDEX\0"
+	"Array Corporation\0"
+	"ARRAY\0"
+	"Yoozma Corporation\0"
+	"YOOZMA\0"
+	"Diagnosys Test Systems Ltd\0"
+	"DIAGNOSYS-TEST\0"
+	"EOS S.r.l.\0"
+	"EOS\0"
+	"Kerun Visual Technology Co., Ltd.(Shenzhen)\0"
+	"KERUN-VISUAL-SHENZHEN\0"
+	"Beat Sensing co. , ltd.\0"
+	"BEAT-SENSING\0"
+	"Spider Tecnologia Ind. e Com Ltda\0"
+	"Soukai Electric\0"
+	"SOUKAI-ELECTRIC\0"
+	"FORZA SILICON CORP.\0"
+	"FORZA-SILICON\0"
+	"Berg Cloud Limited\0"
+	"devboards GmbH\0"
+	"DEVBOARDS\0"
+	"PRESSOL Schmiergeraete GmbH\0"
+	"PRESSOL-SCHMIERGERAETE\0"
+	"Northern Star Technologies\0"
+	"NORTHERN-STAR-TECHNOLOGIES\0"
+	"Parris Service Corporation\0"
+	"PARRIS-SERVICE\0"
+	"Thirdwayv Inc.\0"
+	"THIRDWAYV\0"
+	"Patria Aviation Oy\0"
+	"PATRIA-AVIATION-OY\0"
+	"KRONOTECH SRL\0"
+	"KRONOTECH-SRL\0"
+	"Noritake Itron Corporation\0"
+	"NORITAKE-ITRON\0"
+	"cibite AG\0"
+	"CIBITE\0"
+	"DemoPad\0"
+	"DEMOPAD\0"
+	"RB-LINK Wireless\0"
+	"RB-LINK-WIRELESS\0"
+	"ENTEC Electric & Electronic CO., LTD\0"
+	"Multiobrabotka\0"
+	"MULTIOBRABOTKA\0"
+	"Lubino s.r.o.\0"
+	"LUBINO-S-R-O\0"
+	"Broachlink Technology Co.,Limited\0"
+	"BROACHLINK\0"
+	"WICHER DIGITAL TECHNIK\0"
+	"WICHER-DIGITAL-TECHNIK\0"
+	"Autonomous Solutions, Inc\0"
+	"AUTONOMOUS-SOLUTIONS\0"
+	"Vigitron Inc.\0"
+	"VIGITRON\0"
+	"Shin-ei Electronic Measuring Co.,Ltd.\0"
+	"SHIN-EI-MEASURING\0"
+	"Logos 01 S.r.l.\0"
+	"LOGOS-01\0"
+	"AGE A. Gilg Elektronik\0"
+	"AGE-A-GILG-ELEKTRONIK\0"
+	"Inforce Computing Inc.\0"
+	"A+EC Klein Ingenieurbuero\0"
+	"A+EC-KLEIN-INGENIEURBUERO\0"
+	"Magic Systems\0"
+	"MAGIC\0"
+	"TEWS Elektronik GmbH & Co. KG\0"
+	"TEWS-ELEKTRONIK\0"
+	"Orion Systems, Inc\0"
+	"ORION\0"
+	"Beking Industrieele automatisering\0"
+	"BEKING-INDUSTRIEELE-AUTOMATISERING\0"
+	"Creative Lighting And Sound Systems Pty Ltd\0"
+	"CREATIVE-LIGHTING-AND-SOUND-PTY\0"
+	"Micromega Dynamics SA\0"
+	"MICROMEGA-DYNAMICS\0"
+	"KbDevice,Inc.\0"
+	"KBDEVICE\0"
+	"shanghai mingding information tech co.Ltd\0"
+	"SHANGHAI-MINGDING-INFORMATION-TECH\0"
+	"NPB Automation AB\0"
+	"NPB-AUTOMATION-AB\0"
+	"Triamec Motion AG\0"
+	"TRIAMEC-MOTION\0"
+	"Digital Display Systems\0"
+	"DIGITAL-DISPLAY\0"
+	"Cornfed Systems LLC\0"
+	"CORNFED\0"
+	"QED Advanced Systems Limited\0"
+	"QED-ADVANCED\0"
+	"Device Solutions Ltd\0"
+	"DEVICE-SOLUTIONS\0"
+	"Andy-L Ltd.\0"
+	"ANDY-L\0"
+	"Rigel Engineering\0"
+	"RIGEL-ENGINEERING\0"
+	"NKT Photonics A/S\0"
+	"NKT-PHOTONICS-A/S\0"
+	"YXLON International A/S\0"
+	"YXLON-A/S\0"
+	"Omnik New Energy Co., Ltd\0"
+	"OMNIK-NEW-ENERGY\0"
+	"Webeasy BV\0"
+	"WEBEASY\0"
+	"Founder Broadband Network Service Co.,Ltd.\0"
+	"FOUNDER-BROADBAND-NETWORK-SERVICE\0"
+	"Kaluga Teletypes Manufacturing Plant\0"
+	"KALUGA-TELETYPES-MANUFACTURING-PLANT\0"
+	"FST21 Ltd.\0"
+	"FST21\0"
+	"EMS Computers Pty Ltd\0"
+	"EMS-COMPUTERS-PTY\0"
+	"Owl Cyber Defense Solutions, LLC\0"
+	"OWL-CYBER-DEFENSE-SOLUTIONS\0"
+	"Commercial Wireless Systems International LLC.\0"
+	"COMMERCIAL-WIRELESS\0"
+	"Energy Technology and Control Ltd.\0"
+	"ENERGY-AND-CONTROL\0"
+	"NIPPON TECHNO LAB.,INC,\0"
+	"NIPPON-TECHNO-LAB\0"
+	"BaOpt Benelux bv\0"
+	"BAOPT-BENELUX\0"
+	"Chengdu Meihuan Technology Co., Ltd\0"
+	"CHENGDU-MEIHUAN\0"
+	"Embedded Technology Corporation\0"
+	"EMBEDDED\0"
+	"AD QUALITE\0"
+	"AD-QUALITE\0"
+	"ELNEC s.r.o.\0"
+	"ELNEC-S-R-O\0"
+	"Mega Electronics Ltd\0"
+	"MEGA-ELECTRONICS\0"
+	"STEK Ltd\0"
+	"STEK\0"
+	"Narinet, Inc.\0"
+	"";
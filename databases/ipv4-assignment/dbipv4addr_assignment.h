@@ -27254,511 +27254,1012 @@ static const s_ipv4addr_assignment dbipv4addr_assignment_iana[] = {
 };
 
 static const s_ipv4addr_info dbipv4addr_info[] = {
-	//first     , last      , registry  
-	{ 0x99100000, 0x991000ff, "LISP#asp-xtr"                 }, // 153.16.0.0      - 153.16.0.255
-	{ 0x99100080, 0x991000ff, "LISP#asp-xtr"                 }, // 153.16.0.128    - 153.16.0.255
-	{ 0x99100100, 0x991001ff, "LISP#ntt-xtr"                 }, // 153.16.1.0      - 153.16.1.255
-	{ 0x99100200, 0x991002ff, "LISP#bell-ca-xtr"             }, // 153.16.2.0      - 153.16.2.255
-	{ 0x99100300, 0x991003ff, "LISP#nyu-xtr"                 }, // 153.16.3.0      - 153.16.3.255
-	{ 0x99100500, 0x991005ff, "LISP#cisco-it-xtr"            }, // 153.16.5.0      - 153.16.5.255
-	{ 0x99100700, 0x991007ff, "LISP#asp-n7k-xtr"             }, // 153.16.7.0      - 153.16.7.255
-	{ 0x99100800, 0x991008ff, "LISP#ucla-xtr"                }, // 153.16.8.0      - 153.16.8.255
-	{ 0x99100900, 0x9910090f, "LISP#fabio-new-mn"            }, // 153.16.9.0      - 153.16.9.15
-	{ 0x99100910, 0x9910091f, "LISP#nmaadara-xtr"            }, // 153.16.9.16     - 153.16.9.31
-	{ 0x99100920, 0x9910092f, "LISP#gbumgard-xtr"            }, // 153.16.9.32     - 153.16.9.47
-	{ 0x99100930, 0x9910093f, "LISP#chuljin-xtr"             }, // 153.16.9.48     - 153.16.9.63
-	{ 0x99100940, 0x9910094f, "LISP#akennedy-xtr"            }, // 153.16.9.64     - 153.16.9.79
-	{ 0x99100950, 0x9910095f, "LISP#jcolin-xtr"              }, // 153.16.9.80     - 153.16.9.95
-	{ 0x99100960, 0x9910096f, "LISP#rbonnell-xtr"            }, // 153.16.9.96     - 153.16.9.111
-	{ 0x99100970, 0x9910097f, "LISP#jalberti-xtr"            }, // 153.16.9.112    - 153.16.9.127
-	{ 0x99100980, 0x9910098f, "LISP#cisco-natal2-xtr"        }, // 153.16.9.128    - 153.16.9.143
-	{ 0x99100990, 0x9910099f, "LISP#lfiegl-xtr"              }, // 153.16.9.144    - 153.16.9.159
-	{ 0x991009b0, 0x991009bf, "LISP#upc-arin-xtr"            }, // 153.16.9.176    - 153.16.9.191
-	{ 0x991009c0, 0x991009cf, "LISP#azure-xtr"               }, // 153.16.9.192    - 153.16.9.207
-	{ 0x99100a00, 0x99100aff, "LISP#vaf-xtr"                 }, // 153.16.10.0     - 153.16.10.255
-	{ 0x99100b00, 0x99100bff, "LISP#icox-xtr"                }, // 153.16.11.0     - 153.16.11.255
-	{ 0x99100c00, 0x99100c3f, "LISP#srin-jcd-dc1"            }, // 153.16.12.0     - 153.16.12.63
-	{ 0x99100c40, 0x99100c7f, "LISP#srin-jcd-dc2"            }, // 153.16.12.64    - 153.16.12.127
-	{ 0x99100cf0, 0x99100cf7, "LISP#srin-jcd-dc1"            }, // 153.16.12.240   - 153.16.12.247
-	{ 0x99100cf8, 0x99100cff, "LISP#srin-jcd-dc2"            }, // 153.16.12.248   - 153.16.12.255
-	{ 0x99100d00, 0x99100d0f, "LISP#snoble-xtr"              }, // 153.16.13.0     - 153.16.13.15
-	{ 0x99100d20, 0x99100d2f, "LISP#dalvarez-xtr"            }, // 153.16.13.32    - 153.16.13.47
-	{ 0x99100d40, 0x99100d4f, "LISP#wnellis-xtr"             }, // 153.16.13.64    - 153.16.13.79
-	{ 0x99100d50, 0x99100d5f, "LISP#srin-xtr"                }, // 153.16.13.80    - 153.16.13.95
-	{ 0x99100d60, 0x99100d6f, "LISP#amit-xtr"                }, // 153.16.13.96    - 153.16.13.111
-	{ 0x99100d80, 0x99100d8f, "LISP#stevenca-xtr"            }, // 153.16.13.128   - 153.16.13.143
-	{ 0x99100d90, 0x99100d9f, "LISP#jearango-xtr"            }, // 153.16.13.144   - 153.16.13.159
-	{ 0x99100da0, 0x99100daf, "LISP#sulrich-xtr"             }, // 153.16.13.160   - 153.16.13.175
-	{ 0x99100db0, 0x99100dbf, "LISP#manishee-xtr"            }, // 153.16.13.176   - 153.16.13.191
-	{ 0x99100dc0, 0x99100dcf, "LISP#aaronm-xtr"              }, // 153.16.13.192   - 153.16.13.207
-	{ 0x99100dd0, 0x99100ddf, "LISP#samuel-xtr"              }, // 153.16.13.208   - 153.16.13.223
-	{ 0x99100de0, 0x99100def, "LISP#wwt-xtr"                 }, // 153.16.13.224   - 153.16.13.239
-	{ 0x99100e00, 0x99100e3f, "LISP#c819-LTE-xtr"            }, // 153.16.14.0     - 153.16.14.63
-	{ 0x99100f00, 0x99100fff, "LISP#facebook-xtr-1"          }, // 153.16.15.0     - 153.16.15.255
-	{ 0x99101000, 0x991010ff, "LISP#isc-pxtr"                }, // 153.16.16.0     - 153.16.16.255
-	{ 0x99101100, 0x9910110f, "LISP#vl-openwrt1-xtr"         }, // 153.16.17.0     - 153.16.17.15
-	{ 0x99101110, 0x9910111f, "LISP#gregg-xtr"               }, // 153.16.17.16    - 153.16.17.31
-	{ 0x99101130, 0x9910113f, "LISP#vl-openwrt2-xtr"         }, // 153.16.17.48    - 153.16.17.63
-	{ 0x99101140, 0x9910114f, "LISP#vl-openwrt3-xtr"         }, // 153.16.17.64    - 153.16.17.79
-	{ 0x99101150, 0x9910115f, "LISP#asr1knat64-xtr"          }, // 153.16.17.80    - 153.16.17.95
-	{ 0x99101160, 0x9910116f, "LISP#zhicheng-xtr"            }, // 153.16.17.96    - 153.16.17.111
-	{ 0x99101170, 0x9910117f, "LISP#nattrav-test-arin"       }, // 153.16.17.112   - 153.16.17.127
-	{ 0x99101180, 0x9910118f, "LISP#liguori-xtr"             }, // 153.16.17.128   - 153.16.17.143
-	{ 0x99101190, 0x9910119f, "LISP#djcalif-xtr"             }, // 153.16.17.144   - 153.16.17.159
-	{ 0x991011a0, 0x991011af, "LISP#dehrle1-xtr"             }, // 153.16.17.160   - 153.16.17.175
-	{ 0x991011b0, 0x991011bf, "LISP#dehrle2-xtr"             }, // 153.16.17.176   - 153.16.17.191
-	{ 0x991011c0, 0x991011cf, "LISP#divya-xtr"               }, // 153.16.17.192   - 153.16.17.207
-	{ 0x991011d0, 0x991011df, "LISP#jhennessy-xtr"           }, // 153.16.17.208   - 153.16.17.223
-	{ 0x991011e0, 0x991011ef, "LISP#martin-xtr"              }, // 153.16.17.224   - 153.16.17.239
-	{ 0x991011f0, 0x991011ff, "LISP#comfort-xtr"             }, // 153.16.17.240   - 153.16.17.255
-	{ 0x99101200, 0x9910120f, "LISP#robert-cdw-xtr"          }, // 153.16.18.0     - 153.16.18.15
-	{ 0x99101210, 0x9910121f, "LISP#lierop-xtr"              }, // 153.16.18.16    - 153.16.18.31
-	{ 0x99101220, 0x9910122f, "LISP#cmh-xtr"                 }, // 153.16.18.32    - 153.16.18.47
-	{ 0x99101240, 0x9910124f, "LISP#tosterbe-xtr"            }, // 153.16.18.64    - 153.16.18.79
-	{ 0x99101250, 0x9910125f, "LISP#kecorbin-xtr"            }, // 153.16.18.80    - 153.16.18.95
-	{ 0x99101260, 0x9910126f, "LISP#dstsyst-xtr"             }, // 153.16.18.96    - 153.16.18.111
-	{ 0x99101280, 0x9910128f, "LISP#ufrj-xtr"                }, // 153.16.18.128   - 153.16.18.143
-	{ 0x99101290, 0x9910129f, "LISP#machilde-xtr"            }, // 153.16.18.144   - 153.16.18.159
-	{ 0x991012a0, 0x991012af, "LISP#jessica-xtr"             }, // 153.16.18.160   - 153.16.18.175
-	{ 0x991012b0, 0x991012bf, "LISP#archana-xtr"             }, // 153.16.18.176   - 153.16.18.191
-	{ 0x991012c0, 0x991012cf, "LISP#jadumars-xtr"            }, // 153.16.18.192   - 153.16.18.207
-	{ 0x991012d0, 0x991012df, "LISP#gorhughe-xtr"            }, // 153.16.18.208   - 153.16.18.223
-	{ 0x99101300, 0x991013ff, "LISP#darrel-xtr"              }, // 153.16.19.0     - 153.16.19.255
-	{ 0x99101400, 0x991014ff, "LISP#scwaller-xtr"            }, // 153.16.20.0     - 153.16.20.255
-	{ 0x991015d4, 0x991015d4, "LISP#antasson-mn"             }, // 153.16.21.212   - 153.16.21.212
-	{ 0x99101700, 0x9910170f, "LISP#linh-xtr"                }, // 153.16.23.0     - 153.16.23.15
-	{ 0x99101710, 0x9910171f, "LISP#sfu-bcnet-xtr"           }, // 153.16.23.16    - 153.16.23.31
-	{ 0x99101720, 0x9910172f, "LISP#dipsingh-xtr"            }, // 153.16.23.32    - 153.16.23.47
-	{ 0x99101730, 0x9910173f, "LISP#trevlac-xtr"             }, // 153.16.23.48    - 153.16.23.63
-	{ 0x99101740, 0x9910174f, "LISP#parna-lev-xtr"           }, // 153.16.23.64    - 153.16.23.79
-	{ 0x99101750, 0x9910175f, "LISP#rob-cdw-xtr"             }, // 153.16.23.80    - 153.16.23.95
-	{ 0x99101760, 0x9910176f, "LISP#scv-xtr"                 }, // 153.16.23.96    - 153.16.23.111
-	{ 0x99101770, 0x9910177f, "LISP#muabid-xtr"              }, // 153.16.23.112   - 153.16.23.127
-	{ 0x99101780, 0x9910178f, "LISP#steve-apple-xtr"         }, // 153.16.23.128   - 153.16.23.143
-	{ 0x99101790, 0x9910179f, "LISP#kleinart-xtr"            }, // 153.16.23.144   - 153.16.23.159
-	{ 0x991017a0, 0x991017af, "LISP#chanu-xtr"               }, // 153.16.23.160   - 153.16.23.175
-	{ 0x991017b0, 0x991017bf, "LISP#mhaaksma-xtr"            }, // 153.16.23.176   - 153.16.23.191
-	{ 0x991017c0, 0x991017cf, "LISP#tellis-xtr"              }, // 153.16.23.192   - 153.16.23.207
-	{ 0x991017d0, 0x991017df, "LISP#jade-xtr"                }, // 153.16.23.208   - 153.16.23.223
-	{ 0x991017e0, 0x991017ef, "LISP#neno-xtr"                }, // 153.16.23.224   - 153.16.23.239
-	{ 0x991017f0, 0x991017ff, "LISP#elsen-xtr"               }, // 153.16.23.240   - 153.16.23.255
-	{ 0x99101800, 0x991018ff, "LISP#attpoc-xtr"              }, // 153.16.24.0     - 153.16.24.255
-	{ 0x99101900, 0x9910190f, "LISP#rymcdowe-xtr"            }, // 153.16.25.0     - 153.16.25.15
-	{ 0x99101910, 0x9910191f, "LISP#miles-xtr"               }, // 153.16.25.16    - 153.16.25.31
-	{ 0x99101920, 0x9910192f, "LISP#smith-xtr"               }, // 153.16.25.32    - 153.16.25.47
-	{ 0x99101930, 0x9910193f, "LISP#epulvino-xtr"            }, // 153.16.25.48    - 153.16.25.63
-	{ 0x99101940, 0x9910194f, "LISP#crhill-xtr"              }, // 153.16.25.64    - 153.16.25.79
-	{ 0x99101950, 0x9910195f, "LISP#smadley-xtr"             }, // 153.16.25.80    - 153.16.25.95
-	{ 0x99101960, 0x9910196f, "LISP#mbirkner-xtr"            }, // 153.16.25.96    - 153.16.25.111
-	{ 0x99101970, 0x9910197f, "LISP#mikea-xtr"               }, // 153.16.25.112   - 153.16.25.127
-	{ 0x99101980, 0x9910198f, "LISP#jemannin-xtr"            }, // 153.16.25.128   - 153.16.25.143
-	{ 0x99101990, 0x9910199f, "LISP#chcoutur-xtr"            }, // 153.16.25.144   - 153.16.25.159
-	{ 0x991019a0, 0x991019af, "LISP#bluethunder-xtr"         }, // 153.16.25.160   - 153.16.25.175
-	{ 0x991019b0, 0x991019bf, "LISP#marknguy-xtr"            }, // 153.16.25.176   - 153.16.25.191
-	{ 0x991019c0, 0x991019cf, "LISP#marcairn-xtr"            }, // 153.16.25.192   - 153.16.25.207
-	{ 0x991019d0, 0x991019df, "LISP#byzek-xtr"               }, // 153.16.25.208   - 153.16.25.223
-	{ 0x991019e0, 0x991019ef, "LISP#jason-xtr"               }, // 153.16.25.224   - 153.16.25.239
-	{ 0x991019f0, 0x991019ff, "LISP#groff-xtr"               }, // 153.16.25.240   - 153.16.25.255
-	{ 0x99101a00, 0x99101a0f, "LISP#mwhitley-xtr"            }, // 153.16.26.0     - 153.16.26.15
-	{ 0x99101a10, 0x99101a1f, "LISP#dlapiper-xtr"            }, // 153.16.26.16    - 153.16.26.31
-	{ 0x99101a20, 0x99101a2f, "LISP#manhoo-xtr"              }, // 153.16.26.32    - 153.16.26.47
-	{ 0x99101a30, 0x99101a3f, "LISP#georgy-xtr"              }, // 153.16.26.48    - 153.16.26.63
-	{ 0x99101a40, 0x99101a4f, "LISP#jhippen-xtr"             }, // 153.16.26.64    - 153.16.26.79
-	{ 0x99101a50, 0x99101a5f, "LISP#cbc-xtr"                 }, // 153.16.26.80    - 153.16.26.95
-	{ 0x99101a60, 0x99101a6f, "LISP#garydla-xtr"             }, // 153.16.26.96    - 153.16.26.111
-	{ 0x99101a70, 0x99101a7f, "LISP#scalan-xtr"              }, // 153.16.26.112   - 153.16.26.127
-	{ 0x99101a80, 0x99101a8f, "LISP#donkdla-xtr"             }, // 153.16.26.128   - 153.16.26.143
-	{ 0x99101a90, 0x99101a9f, "LISP#umissouri-xtr"           }, // 153.16.26.144   - 153.16.26.159
-	{ 0x99101aa0, 0x99101aaf, "LISP#ge-tsg-xtr"              }, // 153.16.26.160   - 153.16.26.175
-	{ 0x99101ab0, 0x99101abf, "LISP#manjeet-xtr"             }, // 153.16.26.176   - 153.16.26.191
-	{ 0x99101ac0, 0x99101acf, "LISP#uvahs-xtr"               }, // 153.16.26.192   - 153.16.26.207
-	{ 0x99101ad0, 0x99101adf, "LISP#zavarce-xtr"             }, // 153.16.26.208   - 153.16.26.223
-	{ 0x99101ae0, 0x99101aef, "LISP#dudek-xtr"               }, // 153.16.26.224   - 153.16.26.239
-	{ 0x99101af0, 0x99101aff, "LISP#force3a-xtr"             }, // 153.16.26.240   - 153.16.26.255
-	{ 0x99101b00, 0x99101bff, "LISP#icann-xtr"               }, // 153.16.27.0     - 153.16.27.255
-	{ 0x99101c00, 0x99101cff, "LISP#attpoc-xtr-2"            }, // 153.16.28.0     - 153.16.28.255
-	{ 0x99101d00, 0x99101d0f, "LISP#jpcaron-xtr"             }, // 153.16.29.0     - 153.16.29.15
-	{ 0x99101d10, 0x99101d1f, "LISP#jamwheat-xtr"            }, // 153.16.29.16    - 153.16.29.31
-	{ 0x99101d20, 0x99101d2f, "LISP#netorian-xtr"            }, // 153.16.29.32    - 153.16.29.47
-	{ 0x99101d30, 0x99101d3f, "LISP#pogue-xtr"               }, // 153.16.29.48    - 153.16.29.63
-	{ 0x99101d40, 0x99101d4f, "LISP#msales-xtr"              }, // 153.16.29.64    - 153.16.29.79
-	{ 0x99101d50, 0x99101d5f, "LISP#spisati-xtr-2"           }, // 153.16.29.80    - 153.16.29.95
-	{ 0x99101d60, 0x99101d6f, "LISP#lprat-xtr"               }, // 153.16.29.96    - 153.16.29.111
-	{ 0x99101d70, 0x99101d7f, "LISP#triple-xtr"              }, // 153.16.29.112   - 153.16.29.127
-	{ 0x99101d80, 0x99101d8f, "LISP#cmich-xtr"               }, // 153.16.29.128   - 153.16.29.143
-	{ 0x99101d90, 0x99101d9f, "LISP#rtajvar-xtr"             }, // 153.16.29.144   - 153.16.29.159
-	{ 0x99101db0, 0x99101dbf, "LISP#snicholas-xtr"           }, // 153.16.29.176   - 153.16.29.191
-	{ 0x99101dc0, 0x99101dcf, "LISP#nist-xtr"                }, // 153.16.29.192   - 153.16.29.207
-	{ 0x99101e00, 0x99101e0f, "LISP#google-xtr"              }, // 153.16.30.0     - 153.16.30.15
-	{ 0x99101e10, 0x99101e1f, "LISP#ineteng-xtr"             }, // 153.16.30.16    - 153.16.30.31
-	{ 0x99101e20, 0x99101e2f, "LISP#force3b-xtr"             }, // 153.16.30.32    - 153.16.30.47
-	{ 0x99101e30, 0x99101e3f, "LISP#force3-xtr"              }, // 153.16.30.48    - 153.16.30.63
-	{ 0x99101e40, 0x99101e4f, "LISP#wason-xtr"               }, // 153.16.30.64    - 153.16.30.79
-	{ 0x99101e50, 0x99101e5f, "LISP#c819-LTE-xtr"            }, // 153.16.30.80    - 153.16.30.95
-	{ 0x99101e60, 0x99101e6f, "LISP#schlutter-xtr"           }, // 153.16.30.96    - 153.16.30.111
-	{ 0x99101e70, 0x99101e7f, "LISP#bguldan-xtr"             }, // 153.16.30.112   - 153.16.30.127
-	{ 0x99101e80, 0x99101e8f, "LISP#naasief-xtr"             }, // 153.16.30.128   - 153.16.30.143
-	{ 0x99101e90, 0x99101e9f, "LISP#ciecior-xtr"             }, // 153.16.30.144   - 153.16.30.159
-	{ 0x99101ea0, 0x99101eaf, "LISP#coopergeneral-xtr"       }, // 153.16.30.160   - 153.16.30.175
-	{ 0x99101eb0, 0x99101ebf, "LISP#plixer-xtr"              }, // 153.16.30.176   - 153.16.30.191
-	{ 0x99101ec0, 0x99101ecf, "LISP#halifaxmediagroup-xtr"   }, // 153.16.30.192   - 153.16.30.207
-	{ 0x99101ed0, 0x99101edf, "LISP#ec2test-xtr"             }, // 153.16.30.208   - 153.16.30.223
-	{ 0x99101ee0, 0x99101eef, "LISP#perry-xtr"               }, // 153.16.30.224   - 153.16.30.239
-	{ 0x99101ef0, 0x99101eff, "LISP#fortinet-xtr"            }, // 153.16.30.240   - 153.16.30.255
-	{ 0x99101f10, 0x99101f1f, "LISP#chris-ge-xtr"            }, // 153.16.31.16    - 153.16.31.31
-	{ 0x99101f20, 0x99101f2f, "LISP#djustice-xtr"            }, // 153.16.31.32    - 153.16.31.47
-	{ 0x99101f30, 0x99101f3f, "LISP#apparatus-xtr"           }, // 153.16.31.48    - 153.16.31.63
-	{ 0x99101f40, 0x99101f4f, "LISP#cdw-xtr"                 }, // 153.16.31.64    - 153.16.31.79
-	{ 0x99101f50, 0x99101f5f, "LISP#krunal-xtr"              }, // 153.16.31.80    - 153.16.31.95
-	{ 0x99101f60, 0x99101f6f, "LISP#gar-xtr"                 }, // 153.16.31.96    - 153.16.31.111
-	{ 0x99101f70, 0x99101f7f, "LISP#jbert-xtr"               }, // 153.16.31.112   - 153.16.31.127
-	{ 0x99101f80, 0x99101f8f, "LISP#rajiva-xtr"              }, // 153.16.31.128   - 153.16.31.143
-	{ 0x99101f90, 0x99101f9f, "LISP#oneok-xtr"               }, // 153.16.31.144   - 153.16.31.159
-	{ 0x99101fa0, 0x99101faf, "LISP#sjury-xtr"               }, // 153.16.31.160   - 153.16.31.175
-	{ 0x99101fb0, 0x99101fbf, "LISP#dbuleza-xtr"             }, // 153.16.31.176   - 153.16.31.191
-	{ 0x99101fc0, 0x99101fcf, "LISP#tommille-xtr"            }, // 153.16.31.192   - 153.16.31.207
-	{ 0x99101fd0, 0x99101fdf, "LISP#uer3-xtr"                }, // 153.16.31.208   - 153.16.31.223
-	{ 0x99101fe0, 0x99101fef, "LISP#tdstelecom-xtr"          }, // 153.16.31.224   - 153.16.31.239
-	{ 0x99101ff0, 0x99101fff, "LISP#dustin-xtr"              }, // 153.16.31.240   - 153.16.31.255
-	{ 0x99102000, 0x9910200f, "LISP#thkernen-xtr"            }, // 153.16.32.0     - 153.16.32.15
-	{ 0x99102010, 0x9910201f, "LISP#jakab-xtr"               }, // 153.16.32.16    - 153.16.32.31
-	{ 0x99102020, 0x9910202f, "LISP#marc-xtr"                }, // 153.16.32.32    - 153.16.32.47
-	{ 0x99102030, 0x9910203f, "LISP#deutsche-bank-xtr"       }, // 153.16.32.48    - 153.16.32.63
-	{ 0x99102040, 0x9910204f, "LISP#gerd-cbc-xtr"            }, // 153.16.32.64    - 153.16.32.79
-	{ 0x99102050, 0x9910205f, "LISP#lbromirs-xtr"            }, // 153.16.32.80    - 153.16.32.95
-	{ 0x99102060, 0x9910206f, "LISP#dimitris-xtr"            }, // 153.16.32.96    - 153.16.32.111
-	{ 0x99102070, 0x9910207f, "LISP#65bit-xtr"               }, // 153.16.32.112   - 153.16.32.127
-	{ 0x99102080, 0x9910208f, "LISP#rolfs-xtr"               }, // 153.16.32.128   - 153.16.32.143
-	{ 0x99102090, 0x9910209f, "LISP#markus-xtr"              }, // 153.16.32.144   - 153.16.32.159
-	{ 0x991020a0, 0x991020af, "LISP#mkramoli-xtr"            }, // 153.16.32.160   - 153.16.32.175
-	{ 0x991020b0, 0x991020bf, "LISP#mironto-xtr"             }, // 153.16.32.176   - 153.16.32.191
-	{ 0x991020c0, 0x991020cf, "LISP#munich-arpt-xtr"         }, // 153.16.32.192   - 153.16.32.207
-	{ 0x991020d0, 0x991020df, "LISP#mitko-xtr"               }, // 153.16.32.208   - 153.16.32.223
-	{ 0x991020e0, 0x991020ef, "LISP#isarnet-xtr"             }, // 153.16.32.224   - 153.16.32.239
-	{ 0x991020f0, 0x991020ff, "LISP#experteach-xtr"          }, // 153.16.32.240   - 153.16.32.255
-	{ 0x99102100, 0x991021ff, "LISP#gerd-xtr"                }, // 153.16.33.0     - 153.16.33.255
-	{ 0x99102200, 0x991022ff, "LISP#luigi-xtr"               }, // 153.16.34.0     - 153.16.34.255
-	{ 0x99102300, 0x991023ff, "LISP#damien-xtr"              }, // 153.16.35.0     - 153.16.35.255
-	{ 0x99102400, 0x991024ff, "LISP#isarnet-xtr"             }, // 153.16.36.0     - 153.16.36.255
-	{ 0x99102500, 0x991025ff, "LISP#dino-xtr"                }, // 153.16.37.0     - 153.16.37.255
-	{ 0x99102600, 0x991026ff, "LISP#lip6-fr-xtr"             }, // 153.16.38.0     - 153.16.38.255
-	{ 0x99102700, 0x991027ff, "LISP#wolfgang-client-xtr"     }, // 153.16.39.0     - 153.16.39.255
-	{ 0x99102800, 0x991028ff, "LISP#simlo-xtr"               }, // 153.16.40.0     - 153.16.40.255
-	{ 0x99102900, 0x991029ff, "LISP#wolfgang-odd-xtr"        }, // 153.16.41.0     - 153.16.41.255
-	{ 0x99102a00, 0x99102aff, "LISP#wolfgang-even-xtr"       }, // 153.16.42.0     - 153.16.42.255
-	{ 0x99102b00, 0x99102b0f, "LISP#jesper-xtr"              }, // 153.16.43.0     - 153.16.43.15
-	{ 0x99102b10, 0x99102b1f, "LISP#isidor-xtr"              }, // 153.16.43.16    - 153.16.43.31
-	{ 0x99102b20, 0x99102b2f, "LISP#jobsnijders-home-xtr"    }, // 153.16.43.32    - 153.16.43.47
-	{ 0x99102b30, 0x99102b3f, "LISP#intouch-office-xtr"      }, // 153.16.43.48    - 153.16.43.63
-	{ 0x99102b40, 0x99102b7f, "LISP#intouch-dc1-xtr-1"       }, // 153.16.43.64    - 153.16.43.127
-	{ 0x99102b80, 0x99102bbf, "LISP#intouch-dc2-xtr-1"       }, // 153.16.43.128   - 153.16.43.191
-	{ 0x99102bf0, 0x99102bff, "LISP#pcharalampou-xtr"        }, // 153.16.43.240   - 153.16.43.255
-	{ 0x99102bf1, 0x99102bf1, "LISP#pcharalampou-xtr"        }, // 153.16.43.241   - 153.16.43.241
-	{ 0x99102bf2, 0x99102bf2, "LISP#pcharalampou-xtr"        }, // 153.16.43.242   - 153.16.43.242
-	{ 0x99102c00, 0x99102c0f, "LISP#tetaneutral-xtr"         }, // 153.16.44.0     - 153.16.44.15
-	{ 0x99102c10, 0x99102c1f, "LISP#korpo-tp-xtr"            }, // 153.16.44.16    - 153.16.44.31
-	{ 0x99102c20, 0x99102c2f, "LISP#mbosecki-xtr"            }, // 153.16.44.32    - 153.16.44.47
-	{ 0x99102c30, 0x99102c3f, "LISP#moreas-xtr"              }, // 153.16.44.48    - 153.16.44.63
-	{ 0x99102c40, 0x99102c4f, "LISP#planete-xtr"             }, // 153.16.44.64    - 153.16.44.79
-	{ 0x99102c50, 0x99102c5f, "LISP#giheron-xtr"             }, // 153.16.44.80    - 153.16.44.95
-	{ 0x99102c60, 0x99102c6f, "LISP#antoine-xtr"             }, // 153.16.44.96    - 153.16.44.111
-	{ 0x99102c70, 0x99102c7f, "LISP#uniroma-xtr"             }, // 153.16.44.112   - 153.16.44.127
-	{ 0x99102c80, 0x99102c8f, "LISP#jjstevens-xtr"           }, // 153.16.44.128   - 153.16.44.143
-	{ 0x99102c90, 0x99102c9f, "LISP#lukasm-xtr"              }, // 153.16.44.144   - 153.16.44.159
-	{ 0x99102ca0, 0x99102caf, "LISP#atle-xtr"                }, // 153.16.44.160   - 153.16.44.175
-	{ 0x99102cc0, 0x99102ccf, "LISP#geert-xtr"               }, // 153.16.44.192   - 153.16.44.207
-	{ 0x99102cd0, 0x99102cdf, "LISP#zilina-xtr"              }, // 153.16.44.208   - 153.16.44.223
-	{ 0x99102ce0, 0x99102cef, "LISP#chrisgray-xtr"           }, // 153.16.44.224   - 153.16.44.239
-	{ 0x99102d00, 0x99102d0f, "LISP#ch-marcel-xtr"           }, // 153.16.45.0     - 153.16.45.15
-	{ 0x99102d10, 0x99102d1f, "LISP#uaveiro-xtr"             }, // 153.16.45.16    - 153.16.45.31
-	{ 0x99102d20, 0x99102d2f, "LISP#caspary-xtr"             }, // 153.16.45.32    - 153.16.45.47
-	{ 0x99102d30, 0x99102d3f, "LISP#maxried-xtr"             }, // 153.16.45.48    - 153.16.45.63
-	{ 0x99102d40, 0x99102d4f, "LISP#yun-xtr"                 }, // 153.16.45.64    - 153.16.45.79
-	{ 0x99102d50, 0x99102d5f, "LISP#tietze-xtr"              }, // 153.16.45.80    - 153.16.45.95
-	{ 0x99102d60, 0x99102d6f, "LISP#jkuhn-xtr"               }, // 153.16.45.96    - 153.16.45.111
-	{ 0x99102d70, 0x99102d7f, "LISP#a1-telekom-xtr"          }, // 153.16.45.112   - 153.16.45.127
-	{ 0x99102d80, 0x99102d8f, "LISP#renne-xtr"               }, // 153.16.45.128   - 153.16.45.143
-	{ 0x99102d90, 0x99102d9f, "LISP#mblokzij-pi-xtr"         }, // 153.16.45.144   - 153.16.45.159
-	{ 0x99102da0, 0x99102daf, "LISP#lueers-xtr"              }, // 153.16.45.160   - 153.16.45.175
-	{ 0x99102db0, 0x99102dbf, "LISP#hkoerth-xtr"             }, // 153.16.45.176   - 153.16.45.191
-	{ 0x99102dc0, 0x99102dcf, "LISP#nclark-xtr"              }, // 153.16.45.192   - 153.16.45.207
-	{ 0x99102dd0, 0x99102ddf, "LISP#teridion-xtr"            }, // 153.16.45.208   - 153.16.45.223
-	{ 0x99102de0, 0x99102def, "LISP#mgrabner-xtr"            }, // 153.16.45.224   - 153.16.45.239
-	{ 0x99102df0, 0x99102dff, "LISP#albring-xtr"             }, // 153.16.45.240   - 153.16.45.255
-	{ 0x99102e00, 0x99102eff, "LISP#mcenteme-xtr"            }, // 153.16.46.0     - 153.16.46.255
-	{ 0x99102f00, 0x99102f0f, "LISP#mblokzij-xtr"            }, // 153.16.47.0     - 153.16.47.15
-	{ 0x99102f10, 0x99102f1f, "LISP#ataf-xtr"                }, // 153.16.47.16    - 153.16.47.31
-	{ 0x99102f20, 0x99102f2f, "LISP#adittman-xtr"            }, // 153.16.47.32    - 153.16.47.47
-	{ 0x99102f30, 0x99102f3f, "LISP#runar-xtr"               }, // 153.16.47.48    - 153.16.47.63
-	{ 0x99102f40, 0x99102f4f, "LISP#iceland-xtr"             }, // 153.16.47.64    - 153.16.47.79
-	{ 0x99102f50, 0x99102f5f, "LISP#raabo-xtr"               }, // 153.16.47.80    - 153.16.47.95
-	{ 0x99102f60, 0x99102f6f, "LISP#alex-xtr"                }, // 153.16.47.96    - 153.16.47.111
-	{ 0x99102f70, 0x99102f7f, "LISP#francesco-xtr"           }, // 153.16.47.112   - 153.16.47.127
-	{ 0x99102f80, 0x99102f8f, "LISP#fraunhofer-igd-xtr"      }, // 153.16.47.128   - 153.16.47.143
-	{ 0x99102fa0, 0x99102fbf, "LISP#smirnov-xtr"             }, // 153.16.47.160   - 153.16.47.191
-	{ 0x99102fc0, 0x99102fcf, "LISP#cegal-xtr"               }, // 153.16.47.192   - 153.16.47.207
-	{ 0x99102fd0, 0x99102fdf, "LISP#gloudemans-xtr"          }, // 153.16.47.208   - 153.16.47.223
-	{ 0x99102fe0, 0x99102fef, "LISP#claes-xtr"               }, // 153.16.47.224   - 153.16.47.239
-	{ 0x99102ff0, 0x99102fff, "LISP#hu-uasu-xtr"             }, // 153.16.47.240   - 153.16.47.255
-	{ 0x99103000, 0x9910300f, "LISP#umurcia-1-xtr"           }, // 153.16.48.0     - 153.16.48.15
-	{ 0x99103010, 0x9910301f, "LISP#umurcia-2-xtr"           }, // 153.16.48.16    - 153.16.48.31
-	{ 0x99103020, 0x9910302f, "LISP#umurcia-3-xtr"           }, // 153.16.48.32    - 153.16.48.47
-	{ 0x99103030, 0x9910303f, "LISP#hauschild-xtr"           }, // 153.16.48.48    - 153.16.48.63
-	{ 0x99103040, 0x9910304f, "LISP#cat6k-demo-uk"           }, // 153.16.48.64    - 153.16.48.79
-	{ 0x99103050, 0x9910305f, "LISP#roel-xtr"                }, // 153.16.48.80    - 153.16.48.95
-	{ 0x99103060, 0x9910306f, "LISP#clemens-xtr"             }, // 153.16.48.96    - 153.16.48.111
-	{ 0x99103070, 0x9910307f, "LISP#fit-xtr"                 }, // 153.16.48.112   - 153.16.48.127
-	{ 0x99103080, 0x9910308f, "LISP#level-it-xtr"            }, // 153.16.48.128   - 153.16.48.143
-	{ 0x99103090, 0x9910309f, "LISP#AVM01-xtr"               }, // 153.16.48.144   - 153.16.48.159
-	{ 0x991030a0, 0x991030af, "LISP#AVM02-xtr"               }, // 153.16.48.160   - 153.16.48.175
-	{ 0x991030b0, 0x991030bf, "LISP#AVM03-xtr"               }, // 153.16.48.176   - 153.16.48.191
-	{ 0x991030c0, 0x991030cf, "LISP#AVM04-xtr"               }, // 153.16.48.192   - 153.16.48.207
-	{ 0x991030d0, 0x991030df, "LISP#AVM05-xtr"               }, // 153.16.48.208   - 153.16.48.223
-	{ 0x991030e0, 0x991030ef, "LISP#AVM06-xtr"               }, // 153.16.48.224   - 153.16.48.239
-	{ 0x991030f0, 0x991030ff, "LISP#AVM07-xtr"               }, // 153.16.48.240   - 153.16.48.255
-	{ 0x99103100, 0x9910310f, "LISP#AVM08-xtr"               }, // 153.16.49.0     - 153.16.49.15
-	{ 0x99103110, 0x9910311f, "LISP#AVM09-xtr"               }, // 153.16.49.16    - 153.16.49.31
-	{ 0x99103120, 0x9910312f, "LISP#vz-niko-ch"              }, // 153.16.49.32    - 153.16.49.47
-	{ 0x99103130, 0x9910313f, "LISP#dipesh-xtr"              }, // 153.16.49.48    - 153.16.49.63
-	{ 0x99103140, 0x9910314f, "LISP#quenzer-xtr"             }, // 153.16.49.64    - 153.16.49.79
-	{ 0x99103150, 0x9910315f, "LISP#turnerhouse-xtr"         }, // 153.16.49.80    - 153.16.49.95
-	{ 0x99103160, 0x9910316f, "LISP#lhsystems-xtr"           }, // 153.16.49.96    - 153.16.49.111
-	{ 0x99103170, 0x9910317f, "LISP#coudron-xtr"             }, // 153.16.49.112   - 153.16.49.127
-	{ 0x99103180, 0x9910318f, "LISP#hubers-xtr"              }, // 153.16.49.128   - 153.16.49.143
-	{ 0x99103190, 0x9910319f, "LISP#woellhaf-xtr"            }, // 153.16.49.144   - 153.16.49.159
-	{ 0x991031a0, 0x991031af, "LISP#damjan-xtr"              }, // 153.16.49.160   - 153.16.49.175
-	{ 0x991031b0, 0x991031bf, "LISP#leander-xtr"             }, // 153.16.49.176   - 153.16.49.191
-	{ 0x991031c0, 0x991031cf, "LISP#nikolay-xtr"             }, // 153.16.49.192   - 153.16.49.207
-	{ 0x991031d0, 0x991031df, "LISP#moritz-xtr"              }, // 153.16.49.208   - 153.16.49.223
-	{ 0x991031e0, 0x991031ef, "LISP#skonecki-xtr"            }, // 153.16.49.224   - 153.16.49.239
-	{ 0x991031f0, 0x991031ff, "LISP#thoene-xtr"              }, // 153.16.49.240   - 153.16.49.255
-	{ 0x99103200, 0x9910320f, "LISP#lori-xtr"                }, // 153.16.50.0     - 153.16.50.15
-	{ 0x99103210, 0x9910321f, "LISP#reitz-xtr"               }, // 153.16.50.16    - 153.16.50.31
-	{ 0x99103220, 0x9910322f, "LISP#jerome-xtr"              }, // 153.16.50.32    - 153.16.50.47
-	{ 0x99103230, 0x9910323f, "LISP#netcloud-xtr"            }, // 153.16.50.48    - 153.16.50.63
-	{ 0x99103240, 0x9910324f, "LISP#dschulz-xtr"             }, // 153.16.50.64    - 153.16.50.79
-	{ 0x99103250, 0x9910325f, "LISP#atea-xtr"                }, // 153.16.50.80    - 153.16.50.95
-	{ 0x99103260, 0x9910326f, "LISP#atea2-xtr"               }, // 153.16.50.96    - 153.16.50.111
-	{ 0x99103270, 0x9910327f, "LISP#cschmidt-xtr"            }, // 153.16.50.112   - 153.16.50.127
-	{ 0x99103280, 0x9910328f, "LISP#eantc-xtr"               }, // 153.16.50.128   - 153.16.50.143
-	{ 0x99103290, 0x9910329f, "LISP#sleiweke-xtr"            }, // 153.16.50.144   - 153.16.50.159
-	{ 0x991032a0, 0x991032af, "LISP#marcel-xtr"              }, // 153.16.50.160   - 153.16.50.175
-	{ 0x991032b0, 0x991032bf, "LISP#goudswaard-xtr"          }, // 153.16.50.176   - 153.16.50.191
-	{ 0x991032c0, 0x991032cf, "LISP#axel-xtr"                }, // 153.16.50.192   - 153.16.50.207
-	{ 0x991032d0, 0x991032df, "LISP#trieb-xtr"               }, // 153.16.50.208   - 153.16.50.223
-	{ 0x991032e0, 0x991032ef, "LISP#strasser-xtr"            }, // 153.16.50.224   - 153.16.50.239
-	{ 0x991032f0, 0x991032ff, "LISP#haase-xtr"               }, // 153.16.50.240   - 153.16.50.255
-	{ 0x99103300, 0x9910330f, "LISP#hendrickx-xtr"           }, // 153.16.51.0     - 153.16.51.15
-	{ 0x99103310, 0x9910331f, "LISP#keronet-xtr"             }, // 153.16.51.16    - 153.16.51.31
-	{ 0x99103320, 0x9910332f, "LISP#sarton-xtr"              }, // 153.16.51.32    - 153.16.51.47
-	{ 0x99103330, 0x9910333f, "LISP#nattrav-test"            }, // 153.16.51.48    - 153.16.51.63
-	{ 0x99103340, 0x9910334f, "LISP#ermidoro-xtr"            }, // 153.16.51.64    - 153.16.51.79
-	{ 0x99103350, 0x9910335f, "LISP#scv-xtr"                 }, // 153.16.51.80    - 153.16.51.95
-	{ 0x99103360, 0x9910336f, "LISP#rjm-xtr"                 }, // 153.16.51.96    - 153.16.51.111
-	{ 0x99103370, 0x9910337f, "LISP#answanso-xtr"            }, // 153.16.51.112   - 153.16.51.127
-	{ 0x99103380, 0x9910338f, "LISP#strehhuber-xtr"          }, // 153.16.51.128   - 153.16.51.143
-	{ 0x99103390, 0x9910339f, "LISP#hintermayr-xtr"          }, // 153.16.51.144   - 153.16.51.159
-	{ 0x991033a0, 0x991033af, "LISP#gruber-xtr"              }, // 153.16.51.160   - 153.16.51.175
-	{ 0x991033b0, 0x991033bf, "LISP#boardrunner-xtr"         }, // 153.16.51.176   - 153.16.51.191
-	{ 0x991033c0, 0x991033cf, "LISP#adwin-xtr"               }, // 153.16.51.192   - 153.16.51.207
-	{ 0x991033d0, 0x991033df, "LISP#bartschnet-xtr"          }, // 153.16.51.208   - 153.16.51.223
-	{ 0x991033e0, 0x991033ef, "LISP#netgaroo-xtr"            }, // 153.16.51.224   - 153.16.51.239
-	{ 0x991033f0, 0x991033ff, "LISP#gensonline-xtr"          }, // 153.16.51.240   - 153.16.51.255
-	{ 0x99103400, 0x9910347f, "LISP#nuage-lisp-xtr"          }, // 153.16.52.0     - 153.16.52.127
-	{ 0x99103480, 0x9910348f, "LISP#kmartini-xtr"            }, // 153.16.52.128   - 153.16.52.143
-	{ 0x99103490, 0x9910349f, "LISP#hs-fulda-xtr"            }, // 153.16.52.144   - 153.16.52.159
-	{ 0x991034a0, 0x991034af, "LISP#datenschleuder-xtr"      }, // 153.16.52.160   - 153.16.52.175
-	{ 0x991034b0, 0x991034bf, "LISP#airmaxx-xtr"             }, // 153.16.52.176   - 153.16.52.191
-	{ 0x991034c0, 0x991034cf, "LISP#kewisch-xtr"             }, // 153.16.52.192   - 153.16.52.207
-	{ 0x991034d0, 0x991034df, "LISP#cybernet-xtr"            }, // 153.16.52.208   - 153.16.52.223
-	{ 0x991034e0, 0x991034ef, "LISP#krzbia-xtr"              }, // 153.16.52.224   - 153.16.52.239
-	{ 0x991034f0, 0x991034ff, "LISP#twarwick-xtr"            }, // 153.16.52.240   - 153.16.52.255
-	{ 0x99103500, 0x9910350f, "LISP#fuhge-xtr"               }, // 153.16.53.0     - 153.16.53.15
-	{ 0x99103510, 0x9910351f, "LISP#isah-xtr"                }, // 153.16.53.16    - 153.16.53.31
-	{ 0x99103520, 0x9910352f, "LISP#lovison-xtr"             }, // 153.16.53.32    - 153.16.53.47
-	{ 0x99103530, 0x9910353f, "LISP#jens-xtr"                }, // 153.16.53.48    - 153.16.53.63
-	{ 0x99103540, 0x9910354f, "LISP#naundorf-xtr"            }, // 153.16.53.64    - 153.16.53.79
-	{ 0x99103550, 0x9910355f, "LISP#leon-xtr"                }, // 153.16.53.80    - 153.16.53.95
-	{ 0x99103560, 0x9910356f, "LISP#orottler-xtr"            }, // 153.16.53.96    - 153.16.53.111
-	{ 0x99103570, 0x9910357f, "LISP#gschell-xtr"             }, // 153.16.53.112   - 153.16.53.127
-	{ 0x99103580, 0x9910358f, "LISP#x10103-xtr"              }, // 153.16.53.128   - 153.16.53.143
-	{ 0x99103590, 0x9910359f, "LISP#iname-xtr"               }, // 153.16.53.144   - 153.16.53.159
-	{ 0x991035a0, 0x991035af, "LISP#aflorio-cz-xtr"          }, // 153.16.53.160   - 153.16.53.175
-	{ 0x991035b0, 0x991035bf, "LISP#jps-networks-xtr"        }, // 153.16.53.176   - 153.16.53.191
-	{ 0x991035c0, 0x991035cf, "LISP#mamouni-xtr"             }, // 153.16.53.192   - 153.16.53.207
-	{ 0x991035d0, 0x991035df, "LISP#hakkarainen-xtr"         }, // 153.16.53.208   - 153.16.53.223
-	{ 0x991035e0, 0x991035ef, "LISP#posteo-xtr"              }, // 153.16.53.224   - 153.16.53.239
-	{ 0x991035f0, 0x991035ff, "LISP#pierson-xtr"             }, // 153.16.53.240   - 153.16.53.255
-	{ 0x99103600, 0x9910360f, "LISP#hulsmann-xtr"            }, // 153.16.54.0     - 153.16.54.15
-	{ 0x99103610, 0x9910361f, "LISP#mdavids-xtr"             }, // 153.16.54.16    - 153.16.54.31
-	{ 0x99103620, 0x9910362f, "LISP#erikbent-xtr"            }, // 153.16.54.32    - 153.16.54.47
-	{ 0x99103630, 0x9910363f, "LISP#polimi-xtr"              }, // 153.16.54.48    - 153.16.54.63
-	{ 0x99103640, 0x9910364f, "LISP#panix-xtr"               }, // 153.16.54.64    - 153.16.54.79
-	{ 0x99103650, 0x9910365f, "LISP#glindhart-xtr"           }, // 153.16.54.80    - 153.16.54.95
-	{ 0x99103660, 0x9910366f, "LISP#dimensiondata-xtr"       }, // 153.16.54.96    - 153.16.54.111
-	{ 0x99103670, 0x9910367f, "LISP#pcforce-xtr"             }, // 153.16.54.112   - 153.16.54.127
-	{ 0x99103680, 0x9910368f, "LISP#plotnicu-xtr"            }, // 153.16.54.128   - 153.16.54.143
-	{ 0x99103690, 0x9910369f, "LISP#zimperfeld-xtr"          }, // 153.16.54.144   - 153.16.54.159
-	{ 0x991036a0, 0x991036af, "LISP#aflorio-it-xtr"          }, // 153.16.54.160   - 153.16.54.175
-	{ 0x991036b0, 0x991036bf, "LISP#vanlid-xtr"              }, // 153.16.54.176   - 153.16.54.191
-	{ 0x991036c0, 0x991036cf, "LISP#kohlstedde-xtr"          }, // 153.16.54.192   - 153.16.54.207
-	{ 0x991036d0, 0x991036df, "LISP#wiegleb-xtr"             }, // 153.16.54.208   - 153.16.54.223
-	{ 0x991036e0, 0x991036ef, "LISP#dirks-xtr"               }, // 153.16.54.224   - 153.16.54.239
-	{ 0x991036f0, 0x991036ff, "LISP#cbursch-xtr"             }, // 153.16.54.240   - 153.16.54.255
-	{ 0x99103700, 0x9910370f, "LISP#vz-niko-ge"              }, // 153.16.55.0     - 153.16.55.15
-	{ 0x99103710, 0x9910371f, "LISP#vz-niko-de"              }, // 153.16.55.16    - 153.16.55.31
-	{ 0x99103720, 0x9910372f, "LISP#voos-xtr"                }, // 153.16.55.32    - 153.16.55.47
-	{ 0x99103730, 0x9910373f, "LISP#plominski-xtr"           }, // 153.16.55.48    - 153.16.55.63
-	{ 0x99103740, 0x9910374f, "LISP#eison-xtr"               }, // 153.16.55.64    - 153.16.55.79
-	{ 0x99103750, 0x9910375f, "LISP#a1-telekom2-xtr"         }, // 153.16.55.80    - 153.16.55.95
-	{ 0x99103770, 0x9910377f, "LISP#nord-west-xtr"           }, // 153.16.55.112   - 153.16.55.127
-	{ 0x99103790, 0x9910379f, "LISP#frank-xtr"               }, // 153.16.55.144   - 153.16.55.159
-	{ 0x991037b0, 0x991037bf, "LISP#uni-obuda-xtr"           }, // 153.16.55.176   - 153.16.55.191
-	{ 0x991037c0, 0x991037cf, "LISP#raiffeisen-hu-xtr"       }, // 153.16.55.192   - 153.16.55.207
-	{ 0x991037d0, 0x991037df, "LISP#dev252-xtr"              }, // 153.16.55.208   - 153.16.55.223
-	{ 0x991037e0, 0x991037ef, "LISP#smit-hague-xtr"          }, // 153.16.55.224   - 153.16.55.239
-	{ 0x991037f0, 0x991037ff, "LISP#gierschner-xtr"          }, // 153.16.55.240   - 153.16.55.255
-	{ 0x99103800, 0x9910380f, "LISP#lukasm2-xtr"             }, // 153.16.56.0     - 153.16.56.15
-	{ 0x99103810, 0x9910381f, "LISP#sacherer-xtr"            }, // 153.16.56.16    - 153.16.56.31
-	{ 0x99103820, 0x9910382f, "LISP#gunis-xtr"               }, // 153.16.56.32    - 153.16.56.47
-	{ 0x99103830, 0x9910383f, "LISP#hilger-xtr"              }, // 153.16.56.48    - 153.16.56.63
-	{ 0x99103840, 0x9910384f, "LISP#schad-xtr"               }, // 153.16.56.64    - 153.16.56.79
-	{ 0x99103850, 0x9910385f, "LISP#hagenhoff-xtr"           }, // 153.16.56.80    - 153.16.56.95
-	{ 0x99103870, 0x9910387f, "LISP#ibm-gr-xtr"              }, // 153.16.56.112   - 153.16.56.127
-	{ 0x99103890, 0x9910389f, "LISP#coldharbour-xtr"         }, // 153.16.56.144   - 153.16.56.159
-	{ 0x991038b0, 0x991038bf, "LISP#bach-xtr"                }, // 153.16.56.176   - 153.16.56.191
-	{ 0x991038c0, 0x991038cf, "LISP#jschmidle-xtr"           }, // 153.16.56.192   - 153.16.56.207
-	{ 0x991038d0, 0x991038df, "LISP#zilina2-xtr"             }, // 153.16.56.208   - 153.16.56.223
-	{ 0x991038e0, 0x991038ef, "LISP#dogscafe-xtr"            }, // 153.16.56.224   - 153.16.56.239
-	{ 0x991038f0, 0x991038ff, "LISP#mgliwka-xtr"             }, // 153.16.56.240   - 153.16.56.255
-	{ 0x99103900, 0x9910390f, "LISP#krunal-eu-xtr"           }, // 153.16.57.0     - 153.16.57.15
-	{ 0x99103910, 0x9910391f, "LISP#cstephens-xtr-1"         }, // 153.16.57.16    - 153.16.57.31
-	{ 0x99103920, 0x9910392f, "LISP#demierre-xtr"            }, // 153.16.57.32    - 153.16.57.47
-	{ 0x99103930, 0x9910393f, "LISP#somogyvari-xtr"          }, // 153.16.57.48    - 153.16.57.63
-	{ 0x99103940, 0x9910394f, "LISP#spisati-xtr"             }, // 153.16.57.64    - 153.16.57.79
-	{ 0x99103950, 0x9910395f, "LISP#tao-networks-xtr"        }, // 153.16.57.80    - 153.16.57.95
-	{ 0x99103960, 0x9910396f, "LISP#willekens-xtr"           }, // 153.16.57.96    - 153.16.57.111
-	{ 0x99103970, 0x9910397f, "LISP#jclayton-xtr"            }, // 153.16.57.112   - 153.16.57.127
-	{ 0x99103980, 0x9910398f, "LISP#niek-xtr"                }, // 153.16.57.128   - 153.16.57.143
-	{ 0x99103990, 0x9910399f, "LISP#mbar-xtr"                }, // 153.16.57.144   - 153.16.57.159
-	{ 0x991039b0, 0x991039bf, "LISP#lsd-xtr"                 }, // 153.16.57.176   - 153.16.57.191
-	{ 0x991039c0, 0x991039cf, "LISP#rfurda-xtr"              }, // 153.16.57.192   - 153.16.57.207
-	{ 0x991039d0, 0x991039df, "LISP#gmaricau-xtr"            }, // 153.16.57.208   - 153.16.57.223
-	{ 0x991039f0, 0x991039ff, "LISP#dzeitler-xtr"            }, // 153.16.57.240   - 153.16.57.255
-	{ 0x99103a00, 0x99103a0f, "LISP#garndt-xtr"              }, // 153.16.58.0     - 153.16.58.15
-	{ 0x99103a10, 0x99103a1f, "LISP#jpreuss-xtr"             }, // 153.16.58.16    - 153.16.58.31
-	{ 0x99103a20, 0x99103a2f, "LISP#smondwurf-xtr"           }, // 153.16.58.32    - 153.16.58.47
-	{ 0x99103a30, 0x99103a3f, "LISP#tbonitz-xtr"             }, // 153.16.58.48    - 153.16.58.63
-	{ 0x99103a40, 0x99103a4f, "LISP#cisco-natal1-xtr"        }, // 153.16.58.64    - 153.16.58.79
-	{ 0x99103a50, 0x99103a5f, "LISP#cglasmeyer-xtr"          }, // 153.16.58.80    - 153.16.58.95
-	{ 0x99103a60, 0x99103a6f, "LISP#rengel-xtr"              }, // 153.16.58.96    - 153.16.58.111
-	{ 0x99103a70, 0x99103a7f, "LISP#hgojny-xtr"              }, // 153.16.58.112   - 153.16.58.127
-	{ 0x99103a80, 0x99103a8f, "LISP#rkohn-xtr"               }, // 153.16.58.128   - 153.16.58.143
-	{ 0x99103a90, 0x99103a9f, "LISP#jpkoegeler-xtr"          }, // 153.16.58.144   - 153.16.58.159
-	{ 0x99103ab0, 0x99103abf, "LISP#gniederwimmer-xtr"       }, // 153.16.58.176   - 153.16.58.191
-	{ 0x99103ad0, 0x99103adf, "LISP#mmikulenas-xtr"          }, // 153.16.58.208   - 153.16.58.223
-	{ 0x99103ae0, 0x99103aef, "LISP#cbretterhofer-xtr"       }, // 153.16.58.224   - 153.16.58.239
-	{ 0x99103af0, 0x99103aff, "LISP#mgoebel-xtr"             }, // 153.16.58.240   - 153.16.58.255
-	{ 0x99103b00, 0x99103b0f, "LISP#bmorcinkowski-xtr"       }, // 153.16.59.0     - 153.16.59.15
-	{ 0x99103b10, 0x99103b1f, "LISP#jbaumann-xtr"            }, // 153.16.59.16    - 153.16.59.31
-	{ 0x99103b20, 0x99103b2f, "LISP#mfey-xtr"                }, // 153.16.59.32    - 153.16.59.47
-	{ 0x99103b30, 0x99103b3f, "LISP#mmuller-xtr"             }, // 153.16.59.48    - 153.16.59.63
-	{ 0x99103b40, 0x99103b4f, "LISP#rjud-xtr"                }, // 153.16.59.64    - 153.16.59.79
-	{ 0x99103b50, 0x99103b5f, "LISP#theinz-xtr"              }, // 153.16.59.80    - 153.16.59.95
-	{ 0x99103b60, 0x99103b6f, "LISP#fzahn-xtr"               }, // 153.16.59.96    - 153.16.59.111
-	{ 0x99103b70, 0x99103b7f, "LISP#ahugi-xtr"               }, // 153.16.59.112   - 153.16.59.127
-	{ 0x99103b80, 0x99103b8f, "LISP#niekvanderven-xtr"       }, // 153.16.59.128   - 153.16.59.143
-	{ 0x99103b90, 0x99103b9f, "LISP#jdechert-xtr"            }, // 153.16.59.144   - 153.16.59.159
-	{ 0x99103bb0, 0x99103bbf, "LISP#crothlander-xtr"         }, // 153.16.59.176   - 153.16.59.191
-	{ 0x99103bd0, 0x99103bdf, "LISP#wvanlid-xtr"             }, // 153.16.59.208   - 153.16.59.223
-	{ 0x99103be0, 0x99103bef, "LISP#upc-oor-xtr"             }, // 153.16.59.224   - 153.16.59.239
-	{ 0x99103c00, 0x99103c0f, "LISP#tivano-software-xtr"     }, // 153.16.60.0     - 153.16.60.15
-	{ 0x99103c10, 0x99103c1f, "LISP#ngunther-xtr"            }, // 153.16.60.16    - 153.16.60.31
-	{ 0x99103c20, 0x99103c2f, "LISP#gthor-xtr"               }, // 153.16.60.32    - 153.16.60.47
-	{ 0x99103c30, 0x99103c3f, "LISP#wonken-xtr"              }, // 153.16.60.48    - 153.16.60.63
-	{ 0x99103c50, 0x99103c5f, "LISP#tzapala-xtr"             }, // 153.16.60.80    - 153.16.60.95
-	{ 0x99103c60, 0x99103c6f, "LISP#rmller-xtr"              }, // 153.16.60.96    - 153.16.60.111
-	{ 0x99103c80, 0x99103c8f, "LISP#feul-xtr"                }, // 153.16.60.128   - 153.16.60.143
-	{ 0x99103c90, 0x99103c9f, "LISP#asunnetci-xtr"           }, // 153.16.60.144   - 153.16.60.159
-	{ 0x99103cc0, 0x99103ccf, "LISP#dfett-xtr"               }, // 153.16.60.192   - 153.16.60.207
-	{ 0x99103cd0, 0x99103cdf, "LISP#mklingspor-xtr"          }, // 153.16.60.208   - 153.16.60.223
-	{ 0x99103ce0, 0x99103cef, "LISP#gsanjay-xtr"             }, // 153.16.60.224   - 153.16.60.239
-	{ 0x99103cf0, 0x99103cff, "LISP#tkoch-xtr"               }, // 153.16.60.240   - 153.16.60.255
-	{ 0x99103d00, 0x99103d0f, "LISP#hrenz-xtr"               }, // 153.16.61.0     - 153.16.61.15
-	{ 0x99103d10, 0x99103d1f, "LISP#blawall-xtr"             }, // 153.16.61.16    - 153.16.61.31
-	{ 0x99103d20, 0x99103d2f, "LISP#unitbv-xtr"              }, // 153.16.61.32    - 153.16.61.47
-	{ 0x99103d30, 0x99103d3f, "LISP#hketele-xtr"             }, // 153.16.61.48    - 153.16.61.63
-	{ 0x99103d40, 0x99103d4f, "LISP#rdchragner-xtr"          }, // 153.16.61.64    - 153.16.61.79
-	{ 0x99103d50, 0x99103d5f, "LISP#mamin-xtr"               }, // 153.16.61.80    - 153.16.61.95
-	{ 0x99103d70, 0x99103d7f, "LISP#twittenberg-xtr"         }, // 153.16.61.112   - 153.16.61.127
-	{ 0x99103d80, 0x99103d8f, "LISP#bwieder-xtr"             }, // 153.16.61.128   - 153.16.61.143
-	{ 0x99103d90, 0x99103d9f, "LISP#sbethge-xtr"             }, // 153.16.61.144   - 153.16.61.159
-	{ 0x99103db0, 0x99103dbf, "LISP#jdornauf-xtr"            }, // 153.16.61.176   - 153.16.61.191
-	{ 0x99103dd0, 0x99103ddf, "LISP#mmiller-xtr"             }, // 153.16.61.208   - 153.16.61.223
-	{ 0x99103de0, 0x99103def, "LISP#cfertig-xtr"             }, // 153.16.61.224   - 153.16.61.239
-	{ 0x99103df0, 0x99103dff, "LISP#jkatolla-xtr"            }, // 153.16.61.240   - 153.16.61.255
-	{ 0x99103e00, 0x99103e0f, "LISP#freenet-xtr"             }, // 153.16.62.0     - 153.16.62.15
-	{ 0x99103e10, 0x99103e1f, "LISP#nweissbach-xtr"          }, // 153.16.62.16    - 153.16.62.31
-	{ 0x99103e20, 0x99103e2f, "LISP#owas-xtr"                }, // 153.16.62.32    - 153.16.62.47
-	{ 0x99103e30, 0x99103e3f, "LISP#rspickers-xtr"           }, // 153.16.62.48    - 153.16.62.63
-	{ 0x99103e40, 0x99103e4f, "LISP#pcech-xtr"               }, // 153.16.62.64    - 153.16.62.79
-	{ 0x99103e50, 0x99103e5f, "LISP#cpalm-xtr"               }, // 153.16.62.80    - 153.16.62.95
-	{ 0x99103e60, 0x99103e6f, "LISP#asellmann-xtr"           }, // 153.16.62.96    - 153.16.62.111
-	{ 0x99103e70, 0x99103e7f, "LISP#mluckert-xtr"            }, // 153.16.62.112   - 153.16.62.127
-	{ 0x99103e80, 0x99103e8f, "LISP#tzimmermann-xtr"         }, // 153.16.62.128   - 153.16.62.143
-	{ 0x99103e90, 0x99103e9f, "LISP#dpeshev-xtr"             }, // 153.16.62.144   - 153.16.62.159
-	{ 0x99103f01, 0x99103f01, "LISP#lispmon-mn-u-1"          }, // 153.16.63.1     - 153.16.63.1
-	{ 0x99103f02, 0x99103f02, "LISP#lispmob-mn-u-2"          }, // 153.16.63.2     - 153.16.63.2
-	{ 0x99104000, 0x991040ff, "LISP#iij-xtr"                 }, // 153.16.64.0     - 153.16.64.255
-	{ 0x99104100, 0x991041ff, "LISP#hughes-xtr"              }, // 153.16.65.0     - 153.16.65.255
-	{ 0x99104200, 0x9910420f, "LISP#ntt-com-xtr"             }, // 153.16.66.0     - 153.16.66.15
-	{ 0x99104210, 0x9910421f, "LISP#kddi-labs-xtr"           }, // 153.16.66.16    - 153.16.66.31
-	{ 0x99104220, 0x9910422f, "LISP#tata-xtr"                }, // 153.16.66.32    - 153.16.66.47
-	{ 0x99104230, 0x9910423f, "LISP#jiwang-xtr"              }, // 153.16.66.48    - 153.16.66.63
-	{ 0x99104240, 0x9910424f, "LISP#layim-xtr"               }, // 153.16.66.64    - 153.16.66.79
-	{ 0x99104250, 0x9910425f, "LISP#cfwong-xtr"              }, // 153.16.66.80    - 153.16.66.95
-	{ 0x99104260, 0x9910426f, "LISP#logicalis-xtr"           }, // 153.16.66.96    - 153.16.66.111
-	{ 0x99104270, 0x9910427f, "LISP#cht-xtr"                 }, // 153.16.66.112   - 153.16.66.127
-	{ 0x99104280, 0x9910428f, "LISP#oasis-tech-xtr"          }, // 153.16.66.128   - 153.16.66.143
-	{ 0x99104290, 0x9910429f, "LISP#mingchow-xtr"            }, // 153.16.66.144   - 153.16.66.159
-	{ 0x991042a0, 0x991042af, "LISP#jiwang2-xtr"             }, // 153.16.66.160   - 153.16.66.175
-	{ 0x991042b0, 0x991042bf, "LISP#fnsc-xtr"                }, // 153.16.66.176   - 153.16.66.191
-	{ 0x991042c0, 0x991042cf, "LISP#matsumoto-xtr"           }, // 153.16.66.192   - 153.16.66.207
-	{ 0x991042d0, 0x991042df, "LISP#vhan-xtr"                }, // 153.16.66.208   - 153.16.66.223
-	{ 0x991042e0, 0x991042ef, "LISP#alphawest-xtr"           }, // 153.16.66.224   - 153.16.66.239
-	{ 0x991042f0, 0x991042ff, "LISP#mra4d-xtr"               }, // 153.16.66.240   - 153.16.66.255
-	{ 0x99104300, 0x991043ff, "LISP#apan-xtr"                }, // 153.16.67.0     - 153.16.67.255
-	{ 0x99104400, 0x991044ff, "LISP#wide-xtr"                }, // 153.16.68.0     - 153.16.68.255
-	{ 0x99104500, 0x991045ff, "LISP#nagoya-u-xtr"            }, // 153.16.69.0     - 153.16.69.255
-	{ 0x99104600, 0x9910460f, "LISP#yuyarin-xtr"             }, // 153.16.70.0     - 153.16.70.15
-	{ 0x99104610, 0x9910461f, "LISP#uet-vnu-xtr"             }, // 153.16.70.16    - 153.16.70.31
-	{ 0x99104620, 0x9910462f, "LISP#pccw-xtr"                }, // 153.16.70.32    - 153.16.70.47
-	{ 0x99104630, 0x9910463f, "LISP#fitac-xtr"               }, // 153.16.70.48    - 153.16.70.63
-	{ 0x99104640, 0x9910465f, "LISP#daniel-xtr-1"            }, // 153.16.70.64    - 153.16.70.95
-	{ 0x99104660, 0x9910466f, "LISP#daniel-xtr-2"            }, // 153.16.70.96    - 153.16.70.111
-	{ 0x99104670, 0x9910467f, "LISP#daniel-xtr-3"            }, // 153.16.70.112   - 153.16.70.127
-	{ 0x99104690, 0x9910469f, "LISP#pgear-xtr"               }, // 153.16.70.144   - 153.16.70.159
-	{ 0x991046a0, 0x991046af, "LISP#hongang-xtr"             }, // 153.16.70.160   - 153.16.70.175
-	{ 0x991046b0, 0x991046bf, "LISP#chaney-xtr"              }, // 153.16.70.176   - 153.16.70.191
-	{ 0x991046c0, 0x991046cf, "LISP#kozuka-xtr"              }, // 153.16.70.192   - 153.16.70.207
-	{ 0x991046d0, 0x991046df, "LISP#nattrav-test-apnic"      }, // 153.16.70.208   - 153.16.70.223
-	{ 0x991046f0, 0x991046ff, "LISP#ydpark-xtr"              }, // 153.16.70.240   - 153.16.70.255
-	{ 0x99104700, 0x9910470f, "LISP#farhadsh-xtr"            }, // 153.16.71.0     - 153.16.71.15
-	{ 0x99104710, 0x9910471f, "LISP#hawthorne-xtr"           }, // 153.16.71.16    - 153.16.71.31
-	{ 0x99104720, 0x9910472f, "LISP#hyunsoo-xtr"             }, // 153.16.71.32    - 153.16.71.47
-	{ 0x99104730, 0x9910473f, "LISP#ykenu-xtr"               }, // 153.16.71.48    - 153.16.71.63
-	{ 0x99104740, 0x9910474f, "LISP#gsik-xtr"                }, // 153.16.71.64    - 153.16.71.79
-	{ 0x99104750, 0x9910475f, "LISP#yshiin-xtr"              }, // 153.16.71.80    - 153.16.71.95
-	{ 0x99104760, 0x9910476f, "LISP#tao-networks2-xtr"       }, // 153.16.71.96    - 153.16.71.111
-	{ 0x99104770, 0x9910477f, "LISP#rdines-xtr"              }, // 153.16.71.112   - 153.16.71.127
-	{ 0x99104780, 0x9910478f, "LISP#upc-oor2-xtr"            }, // 153.16.71.128   - 153.16.71.143
-	{ 0x99104790, 0x9910479f, "LISP#ietf100-xtr"             }, // 153.16.71.144   - 153.16.71.159
-	{ 0x991047a0, 0x991047af, "LISP#sukiyaki-proj-xtr"       }, // 153.16.71.160   - 153.16.71.175
-	{ 0x991047b0, 0x991047bf, "LISP#sukiyaki2-proj-xtr"      }, // 153.16.71.176   - 153.16.71.191
-	{ 0x991047c0, 0x991047cf, "LISP#gtja-xtr"                }, // 153.16.71.192   - 153.16.71.207
-	{ 0x991047d0, 0x991047df, "LISP#hcmus-xtr"               }, // 153.16.71.208   - 153.16.71.223
-	{ 0x991047e0, 0x991047ef, "LISP#amacuz-xtr"              }, // 153.16.71.224   - 153.16.71.239
-	{ 0x991048f0, 0x991048ff, "LISP#gs9591-xtr"              }, // 153.16.72.240   - 153.16.72.255
-	{ 0x99104a00, 0x99104aff, "LISP#layim2-xtr"              }, // 153.16.74.0     - 153.16.74.255
-	{ 0x99108000, 0x9910800f, "LISP#ufba-xtr"                }, // 153.16.128.0    - 153.16.128.15
+	//first     , last      , info offset
+	{ 0x99100000, 0x991000ff,      0 }, // 153.16.0.0      - 153.16.0.255    LISP#asp-xtr
+	{ 0x99100080, 0x991000ff,      0 }, // 153.16.0.128    - 153.16.0.255    LISP#asp-xtr
+	{ 0x99100100, 0x991001ff,     13 }, // 153.16.1.0      - 153.16.1.255    LISP#ntt-xtr
+	{ 0x99100200, 0x991002ff,     26 }, // 153.16.2.0      - 153.16.2.255    LISP#bell-ca-xtr
+	{ 0x99100300, 0x991003ff,     43 }, // 153.16.3.0      - 153.16.3.255    LISP#nyu-xtr
+	{ 0x99100500, 0x991005ff,     56 }, // 153.16.5.0      - 153.16.5.255    LISP#cisco-it-xtr
+	{ 0x99100700, 0x991007ff,     74 }, // 153.16.7.0      - 153.16.7.255    LISP#asp-n7k-xtr
+	{ 0x99100800, 0x991008ff,     91 }, // 153.16.8.0      - 153.16.8.255    LISP#ucla-xtr
+	{ 0x99100900, 0x9910090f,    105 }, // 153.16.9.0      - 153.16.9.15     LISP#fabio-new-mn
+	{ 0x99100910, 0x9910091f,    123 }, // 153.16.9.16     - 153.16.9.31     LISP#nmaadara-xtr
+	{ 0x99100920, 0x9910092f,    141 }, // 153.16.9.32     - 153.16.9.47     LISP#gbumgard-xtr
+	{ 0x99100930, 0x9910093f,    159 }, // 153.16.9.48     - 153.16.9.63     LISP#chuljin-xtr
+	{ 0x99100940, 0x9910094f,    176 }, // 153.16.9.64     - 153.16.9.79     LISP#akennedy-xtr
+	{ 0x99100950, 0x9910095f,    194 }, // 153.16.9.80     - 153.16.9.95     LISP#jcolin-xtr
+	{ 0x99100960, 0x9910096f,    210 }, // 153.16.9.96     - 153.16.9.111    LISP#rbonnell-xtr
+	{ 0x99100970, 0x9910097f,    228 }, // 153.16.9.112    - 153.16.9.127    LISP#jalberti-xtr
+	{ 0x99100980, 0x9910098f,    246 }, // 153.16.9.128    - 153.16.9.143    LISP#cisco-natal2-xtr
+	{ 0x99100990, 0x9910099f,    268 }, // 153.16.9.144    - 153.16.9.159    LISP#lfiegl-xtr
+	{ 0x991009b0, 0x991009bf,    284 }, // 153.16.9.176    - 153.16.9.191    LISP#upc-arin-xtr
+	{ 0x991009c0, 0x991009cf,    302 }, // 153.16.9.192    - 153.16.9.207    LISP#azure-xtr
+	{ 0x99100a00, 0x99100aff,    317 }, // 153.16.10.0     - 153.16.10.255   LISP#vaf-xtr
+	{ 0x99100b00, 0x99100bff,    330 }, // 153.16.11.0     - 153.16.11.255   LISP#icox-xtr
+	{ 0x99100c00, 0x99100c3f,    344 }, // 153.16.12.0     - 153.16.12.63    LISP#srin-jcd-dc1
+	{ 0x99100c40, 0x99100c7f,    362 }, // 153.16.12.64    - 153.16.12.127   LISP#srin-jcd-dc2
+	{ 0x99100cf0, 0x99100cf7,    344 }, // 153.16.12.240   - 153.16.12.247   LISP#srin-jcd-dc1
+	{ 0x99100cf8, 0x99100cff,    362 }, // 153.16.12.248   - 153.16.12.255   LISP#srin-jcd-dc2
+	{ 0x99100d00, 0x99100d0f,    380 }, // 153.16.13.0     - 153.16.13.15    LISP#snoble-xtr
+	{ 0x99100d20, 0x99100d2f,    396 }, // 153.16.13.32    - 153.16.13.47    LISP#dalvarez-xtr
+	{ 0x99100d40, 0x99100d4f,    414 }, // 153.16.13.64    - 153.16.13.79    LISP#wnellis-xtr
+	{ 0x99100d50, 0x99100d5f,    431 }, // 153.16.13.80    - 153.16.13.95    LISP#srin-xtr
+	{ 0x99100d60, 0x99100d6f,    445 }, // 153.16.13.96    - 153.16.13.111   LISP#amit-xtr
+	{ 0x99100d80, 0x99100d8f,    459 }, // 153.16.13.128   - 153.16.13.143   LISP#stevenca-xtr
+	{ 0x99100d90, 0x99100d9f,    477 }, // 153.16.13.144   - 153.16.13.159   LISP#jearango-xtr
+	{ 0x99100da0, 0x99100daf,    495 }, // 153.16.13.160   - 153.16.13.175   LISP#sulrich-xtr
+	{ 0x99100db0, 0x99100dbf,    512 }, // 153.16.13.176   - 153.16.13.191   LISP#manishee-xtr
+	{ 0x99100dc0, 0x99100dcf,    530 }, // 153.16.13.192   - 153.16.13.207   LISP#aaronm-xtr
+	{ 0x99100dd0, 0x99100ddf,    546 }, // 153.16.13.208   - 153.16.13.223   LISP#samuel-xtr
+	{ 0x99100de0, 0x99100def,    562 }, // 153.16.13.224   - 153.16.13.239   LISP#wwt-xtr
+	{ 0x99100e00, 0x99100e3f,    575 }, // 153.16.14.0     - 153.16.14.63    LISP#c819-LTE-xtr
+	{ 0x99100f00, 0x99100fff,    593 }, // 153.16.15.0     - 153.16.15.255   LISP#facebook-xtr-1
+	{ 0x99101000, 0x991010ff,    613 }, // 153.16.16.0     - 153.16.16.255   LISP#isc-pxtr
+	{ 0x99101100, 0x9910110f,    627 }, // 153.16.17.0     - 153.16.17.15    LISP#vl-openwrt1-xtr
+	{ 0x99101110, 0x9910111f,    648 }, // 153.16.17.16    - 153.16.17.31    LISP#gregg-xtr
+	{ 0x99101130, 0x9910113f,    663 }, // 153.16.17.48    - 153.16.17.63    LISP#vl-openwrt2-xtr
+	{ 0x99101140, 0x9910114f,    684 }, // 153.16.17.64    - 153.16.17.79    LISP#vl-openwrt3-xtr
+	{ 0x99101150, 0x9910115f,    705 }, // 153.16.17.80    - 153.16.17.95    LISP#asr1knat64-xtr
+	{ 0x99101160, 0x9910116f,    725 }, // 153.16.17.96    - 153.16.17.111   LISP#zhicheng-xtr
+	{ 0x99101170, 0x9910117f,    743 }, // 153.16.17.112   - 153.16.17.127   LISP#nattrav-test-arin
+	{ 0x99101180, 0x9910118f,    766 }, // 153.16.17.128   - 153.16.17.143   LISP#liguori-xtr
+	{ 0x99101190, 0x9910119f,    783 }, // 153.16.17.144   - 153.16.17.159   LISP#djcalif-xtr
+	{ 0x991011a0, 0x991011af,    800 }, // 153.16.17.160   - 153.16.17.175   LISP#dehrle1-xtr
+	{ 0x991011b0, 0x991011bf,    817 }, // 153.16.17.176   - 153.16.17.191   LISP#dehrle2-xtr
+	{ 0x991011c0, 0x991011cf,    834 }, // 153.16.17.192   - 153.16.17.207   LISP#divya-xtr
+	{ 0x991011d0, 0x991011df,    849 }, // 153.16.17.208   - 153.16.17.223   LISP#jhennessy-xtr
+	{ 0x991011e0, 0x991011ef,    868 }, // 153.16.17.224   - 153.16.17.239   LISP#martin-xtr
+	{ 0x991011f0, 0x991011ff,    884 }, // 153.16.17.240   - 153.16.17.255   LISP#comfort-xtr
+	{ 0x99101200, 0x9910120f,    901 }, // 153.16.18.0     - 153.16.18.15    LISP#robert-cdw-xtr
+	{ 0x99101210, 0x9910121f,    921 }, // 153.16.18.16    - 153.16.18.31    LISP#lierop-xtr
+	{ 0x99101220, 0x9910122f,    937 }, // 153.16.18.32    - 153.16.18.47    LISP#cmh-xtr
+	{ 0x99101240, 0x9910124f,    950 }, // 153.16.18.64    - 153.16.18.79    LISP#tosterbe-xtr
+	{ 0x99101250, 0x9910125f,    968 }, // 153.16.18.80    - 153.16.18.95    LISP#kecorbin-xtr
+	{ 0x99101260, 0x9910126f,    986 }, // 153.16.18.96    - 153.16.18.111   LISP#dstsyst-xtr
+	{ 0x99101280, 0x9910128f,   1003 }, // 153.16.18.128   - 153.16.18.143   LISP#ufrj-xtr
+	{ 0x99101290, 0x9910129f,   1017 }, // 153.16.18.144   - 153.16.18.159   LISP#machilde-xtr
+	{ 0x991012a0, 0x991012af,   1035 }, // 153.16.18.160   - 153.16.18.175   LISP#jessica-xtr
+	{ 0x991012b0, 0x991012bf,   1052 }, // 153.16.18.176   - 153.16.18.191   LISP#archana-xtr
+	{ 0x991012c0, 0x991012cf,   1069 }, // 153.16.18.192   - 153.16.18.207   LISP#jadumars-xtr
+	{ 0x991012d0, 0x991012df,   1087 }, // 153.16.18.208   - 153.16.18.223   LISP#gorhughe-xtr
+	{ 0x99101300, 0x991013ff,   1105 }, // 153.16.19.0     - 153.16.19.255   LISP#darrel-xtr
+	{ 0x99101400, 0x991014ff,   1121 }, // 153.16.20.0     - 153.16.20.255   LISP#scwaller-xtr
+	{ 0x991015d4, 0x991015d4,   1139 }, // 153.16.21.212   - 153.16.21.212   LISP#antasson-mn
+	{ 0x99101700, 0x9910170f,   1156 }, // 153.16.23.0     - 153.16.23.15    LISP#linh-xtr
+	{ 0x99101710, 0x9910171f,   1170 }, // 153.16.23.16    - 153.16.23.31    LISP#sfu-bcnet-xtr
+	{ 0x99101720, 0x9910172f,   1189 }, // 153.16.23.32    - 153.16.23.47    LISP#dipsingh-xtr
+	{ 0x99101730, 0x9910173f,   1207 }, // 153.16.23.48    - 153.16.23.63    LISP#trevlac-xtr
+	{ 0x99101740, 0x9910174f,   1224 }, // 153.16.23.64    - 153.16.23.79    LISP#parna-lev-xtr
+	{ 0x99101750, 0x9910175f,   1243 }, // 153.16.23.80    - 153.16.23.95    LISP#rob-cdw-xtr
+	{ 0x99101760, 0x9910176f,   1260 }, // 153.16.23.96    - 153.16.23.111   LISP#scv-xtr
+	{ 0x99101770, 0x9910177f,   1273 }, // 153.16.23.112   - 153.16.23.127   LISP#muabid-xtr
+	{ 0x99101780, 0x9910178f,   1289 }, // 153.16.23.128   - 153.16.23.143   LISP#steve-apple-xtr
+	{ 0x99101790, 0x9910179f,   1310 }, // 153.16.23.144   - 153.16.23.159   LISP#kleinart-xtr
+	{ 0x991017a0, 0x991017af,   1328 }, // 153.16.23.160   - 153.16.23.175   LISP#chanu-xtr
+	{ 0x991017b0, 0x991017bf,   1343 }, // 153.16.23.176   - 153.16.23.191   LISP#mhaaksma-xtr
+	{ 0x991017c0, 0x991017cf,   1361 }, // 153.16.23.192   - 153.16.23.207   LISP#tellis-xtr
+	{ 0x991017d0, 0x991017df,   1377 }, // 153.16.23.208   - 153.16.23.223   LISP#jade-xtr
+	{ 0x991017e0, 0x991017ef,   1391 }, // 153.16.23.224   - 153.16.23.239   LISP#neno-xtr
+	{ 0x991017f0, 0x991017ff,   1405 }, // 153.16.23.240   - 153.16.23.255   LISP#elsen-xtr
+	{ 0x99101800, 0x991018ff,   1420 }, // 153.16.24.0     - 153.16.24.255   LISP#attpoc-xtr
+	{ 0x99101900, 0x9910190f,   1436 }, // 153.16.25.0     - 153.16.25.15    LISP#rymcdowe-xtr
+	{ 0x99101910, 0x9910191f,   1454 }, // 153.16.25.16    - 153.16.25.31    LISP#miles-xtr
+	{ 0x99101920, 0x9910192f,   1469 }, // 153.16.25.32    - 153.16.25.47    LISP#smith-xtr
+	{ 0x99101930, 0x9910193f,   1484 }, // 153.16.25.48    - 153.16.25.63    LISP#epulvino-xtr
+	{ 0x99101940, 0x9910194f,   1502 }, // 153.16.25.64    - 153.16.25.79    LISP#crhill-xtr
+	{ 0x99101950, 0x9910195f,   1518 }, // 153.16.25.80    - 153.16.25.95    LISP#smadley-xtr
+	{ 0x99101960, 0x9910196f,   1535 }, // 153.16.25.96    - 153.16.25.111   LISP#mbirkner-xtr
+	{ 0x99101970, 0x9910197f,   1553 }, // 153.16.25.112   - 153.16.25.127   LISP#mikea-xtr
+	{ 0x99101980, 0x9910198f,   1568 }, // 153.16.25.128   - 153.16.25.143   LISP#jemannin-xtr
+	{ 0x99101990, 0x9910199f,   1586 }, // 153.16.25.144   - 153.16.25.159   LISP#chcoutur-xtr
+	{ 0x991019a0, 0x991019af,   1604 }, // 153.16.25.160   - 153.16.25.175   LISP#bluethunder-xtr
+	{ 0x991019b0, 0x991019bf,   1625 }, // 153.16.25.176   - 153.16.25.191   LISP#marknguy-xtr
+	{ 0x991019c0, 0x991019cf,   1643 }, // 153.16.25.192   - 153.16.25.207   LISP#marcairn-xtr
+	{ 0x991019d0, 0x991019df,   1661 }, // 153.16.25.208   - 153.16.25.223   LISP#byzek-xtr
+	{ 0x991019e0, 0x991019ef,   1676 }, // 153.16.25.224   - 153.16.25.239   LISP#jason-xtr
+	{ 0x991019f0, 0x991019ff,   1691 }, // 153.16.25.240   - 153.16.25.255   LISP#groff-xtr
+	{ 0x99101a00, 0x99101a0f,   1706 }, // 153.16.26.0     - 153.16.26.15    LISP#mwhitley-xtr
+	{ 0x99101a10, 0x99101a1f,   1724 }, // 153.16.26.16    - 153.16.26.31    LISP#dlapiper-xtr
+	{ 0x99101a20, 0x99101a2f,   1742 }, // 153.16.26.32    - 153.16.26.47    LISP#manhoo-xtr
+	{ 0x99101a30, 0x99101a3f,   1758 }, // 153.16.26.48    - 153.16.26.63    LISP#georgy-xtr
+	{ 0x99101a40, 0x99101a4f,   1774 }, // 153.16.26.64    - 153.16.26.79    LISP#jhippen-xtr
+	{ 0x99101a50, 0x99101a5f,   1791 }, // 153.16.26.80    - 153.16.26.95    LISP#cbc-xtr
+	{ 0x99101a60, 0x99101a6f,   1804 }, // 153.16.26.96    - 153.16.26.111   LISP#garydla-xtr
+	{ 0x99101a70, 0x99101a7f,   1821 }, // 153.16.26.112   - 153.16.26.127   LISP#scalan-xtr
+	{ 0x99101a80, 0x99101a8f,   1837 }, // 153.16.26.128   - 153.16.26.143   LISP#donkdla-xtr
+	{ 0x99101a90, 0x99101a9f,   1854 }, // 153.16.26.144   - 153.16.26.159   LISP#umissouri-xtr
+	{ 0x99101aa0, 0x99101aaf,   1873 }, // 153.16.26.160   - 153.16.26.175   LISP#ge-tsg-xtr
+	{ 0x99101ab0, 0x99101abf,   1889 }, // 153.16.26.176   - 153.16.26.191   LISP#manjeet-xtr
+	{ 0x99101ac0, 0x99101acf,   1906 }, // 153.16.26.192   - 153.16.26.207   LISP#uvahs-xtr
+	{ 0x99101ad0, 0x99101adf,   1921 }, // 153.16.26.208   - 153.16.26.223   LISP#zavarce-xtr
+	{ 0x99101ae0, 0x99101aef,   1938 }, // 153.16.26.224   - 153.16.26.239   LISP#dudek-xtr
+	{ 0x99101af0, 0x99101aff,   1953 }, // 153.16.26.240   - 153.16.26.255   LISP#force3a-xtr
+	{ 0x99101b00, 0x99101bff,   1970 }, // 153.16.27.0     - 153.16.27.255   LISP#icann-xtr
+	{ 0x99101c00, 0x99101cff,   1985 }, // 153.16.28.0     - 153.16.28.255   LISP#attpoc-xtr-2
+	{ 0x99101d00, 0x99101d0f,   2003 }, // 153.16.29.0     - 153.16.29.15    LISP#jpcaron-xtr
+	{ 0x99101d10, 0x99101d1f,   2020 }, // 153.16.29.16    - 153.16.29.31    LISP#jamwheat-xtr
+	{ 0x99101d20, 0x99101d2f,   2038 }, // 153.16.29.32    - 153.16.29.47    LISP#netorian-xtr
+	{ 0x99101d30, 0x99101d3f,   2056 }, // 153.16.29.48    - 153.16.29.63    LISP#pogue-xtr
+	{ 0x99101d40, 0x99101d4f,   2071 }, // 153.16.29.64    - 153.16.29.79    LISP#msales-xtr
+	{ 0x99101d50, 0x99101d5f,   2087 }, // 153.16.29.80    - 153.16.29.95    LISP#spisati-xtr-2
+	{ 0x99101d60, 0x99101d6f,   2106 }, // 153.16.29.96    - 153.16.29.111   LISP#lprat-xtr
+	{ 0x99101d70, 0x99101d7f,   2121 }, // 153.16.29.112   - 153.16.29.127   LISP#triple-xtr
+	{ 0x99101d80, 0x99101d8f,   2137 }, // 153.16.29.128   - 153.16.29.143   LISP#cmich-xtr
+	{ 0x99101d90, 0x99101d9f,   2152 }, // 153.16.29.144   - 153.16.29.159   LISP#rtajvar-xtr
+	{ 0x99101db0, 0x99101dbf,   2169 }, // 153.16.29.176   - 153.16.29.191   LISP#snicholas-xtr
+	{ 0x99101dc0, 0x99101dcf,   2188 }, // 153.16.29.192   - 153.16.29.207   LISP#nist-xtr
+	{ 0x99101e00, 0x99101e0f,   2202 }, // 153.16.30.0     - 153.16.30.15    LISP#google-xtr
+	{ 0x99101e10, 0x99101e1f,   2218 }, // 153.16.30.16    - 153.16.30.31    LISP#ineteng-xtr
+	{ 0x99101e20, 0x99101e2f,   2235 }, // 153.16.30.32    - 153.16.30.47    LISP#force3b-xtr
+	{ 0x99101e30, 0x99101e3f,   2252 }, // 153.16.30.48    - 153.16.30.63    LISP#force3-xtr
+	{ 0x99101e40, 0x99101e4f,   2268 }, // 153.16.30.64    - 153.16.30.79    LISP#wason-xtr
+	{ 0x99101e50, 0x99101e5f,    575 }, // 153.16.30.80    - 153.16.30.95    LISP#c819-LTE-xtr
+	{ 0x99101e60, 0x99101e6f,   2283 }, // 153.16.30.96    - 153.16.30.111   LISP#schlutter-xtr
+	{ 0x99101e70, 0x99101e7f,   2302 }, // 153.16.30.112   - 153.16.30.127   LISP#bguldan-xtr
+	{ 0x99101e80, 0x99101e8f,   2319 }, // 153.16.30.128   - 153.16.30.143   LISP#naasief-xtr
+	{ 0x99101e90, 0x99101e9f,   2336 }, // 153.16.30.144   - 153.16.30.159   LISP#ciecior-xtr
+	{ 0x99101ea0, 0x99101eaf,   2353 }, // 153.16.30.160   - 153.16.30.175   LISP#coopergeneral-xtr
+	{ 0x99101eb0, 0x99101ebf,   2376 }, // 153.16.30.176   - 153.16.30.191   LISP#plixer-xtr
+	{ 0x99101ec0, 0x99101ecf,   2392 }, // 153.16.30.192   - 153.16.30.207   LISP#halifaxmediagroup-xtr
+	{ 0x99101ed0, 0x99101edf,   2419 }, // 153.16.30.208   - 153.16.30.223   LISP#ec2test-xtr
+	{ 0x99101ee0, 0x99101eef,   2436 }, // 153.16.30.224   - 153.16.30.239   LISP#perry-xtr
+	{ 0x99101ef0, 0x99101eff,   2451 }, // 153.16.30.240   - 153.16.30.255   LISP#fortinet-xtr
+	{ 0x99101f10, 0x99101f1f,   2469 }, // 153.16.31.16    - 153.16.31.31    LISP#chris-ge-xtr
+	{ 0x99101f20, 0x99101f2f,   2487 }, // 153.16.31.32    - 153.16.31.47    LISP#djustice-xtr
+	{ 0x99101f30, 0x99101f3f,   2505 }, // 153.16.31.48    - 153.16.31.63    LISP#apparatus-xtr
+	{ 0x99101f40, 0x99101f4f,   2524 }, // 153.16.31.64    - 153.16.31.79    LISP#cdw-xtr
+	{ 0x99101f50, 0x99101f5f,   2537 }, // 153.16.31.80    - 153.16.31.95    LISP#krunal-xtr
+	{ 0x99101f60, 0x99101f6f,   2553 }, // 153.16.31.96    - 153.16.31.111   LISP#gar-xtr
+	{ 0x99101f70, 0x99101f7f,   2566 }, // 153.16.31.112   - 153.16.31.127   LISP#jbert-xtr
+	{ 0x99101f80, 0x99101f8f,   2581 }, // 153.16.31.128   - 153.16.31.143   LISP#rajiva-xtr
+	{ 0x99101f90, 0x99101f9f,   2597 }, // 153.16.31.144   - 153.16.31.159   LISP#oneok-xtr
+	{ 0x99101fa0, 0x99101faf,   2612 }, // 153.16.31.160   - 153.16.31.175   LISP#sjury-xtr
+	{ 0x99101fb0, 0x99101fbf,   2627 }, // 153.16.31.176   - 153.16.31.191   LISP#dbuleza-xtr
+	{ 0x99101fc0, 0x99101fcf,   2644 }, // 153.16.31.192   - 153.16.31.207   LISP#tommille-xtr
+	{ 0x99101fd0, 0x99101fdf,   2662 }, // 153.16.31.208   - 153.16.31.223   LISP#uer3-xtr
+	{ 0x99101fe0, 0x99101fef,   2676 }, // 153.16.31.224   - 153.16.31.239   LISP#tdstelecom-xtr
+	{ 0x99101ff0, 0x99101fff,   2696 }, // 153.16.31.240   - 153.16.31.255   LISP#dustin-xtr
+	{ 0x99102000, 0x9910200f,   2712 }, // 153.16.32.0     - 153.16.32.15    LISP#thkernen-xtr
+	{ 0x99102010, 0x9910201f,   2730 }, // 153.16.32.16    - 153.16.32.31    LISP#jakab-xtr
+	{ 0x99102020, 0x9910202f,   2745 }, // 153.16.32.32    - 153.16.32.47    LISP#marc-xtr
+	{ 0x99102030, 0x9910203f,   2759 }, // 153.16.32.48    - 153.16.32.63    LISP#deutsche-bank-xtr
+	{ 0x99102040, 0x9910204f,   2782 }, // 153.16.32.64    - 153.16.32.79    LISP#gerd-cbc-xtr
+	{ 0x99102050, 0x9910205f,   2800 }, // 153.16.32.80    - 153.16.32.95    LISP#lbromirs-xtr
+	{ 0x99102060, 0x9910206f,   2818 }, // 153.16.32.96    - 153.16.32.111   LISP#dimitris-xtr
+	{ 0x99102070, 0x9910207f,   2836 }, // 153.16.32.112   - 153.16.32.127   LISP#65bit-xtr
+	{ 0x99102080, 0x9910208f,   2851 }, // 153.16.32.128   - 153.16.32.143   LISP#rolfs-xtr
+	{ 0x99102090, 0x9910209f,   2866 }, // 153.16.32.144   - 153.16.32.159   LISP#markus-xtr
+	{ 0x991020a0, 0x991020af,   2882 }, // 153.16.32.160   - 153.16.32.175   LISP#mkramoli-xtr
+	{ 0x991020b0, 0x991020bf,   2900 }, // 153.16.32.176   - 153.16.32.191   LISP#mironto-xtr
+	{ 0x991020c0, 0x991020cf,   2917 }, // 153.16.32.192   - 153.16.32.207   LISP#munich-arpt-xtr
+	{ 0x991020d0, 0x991020df,   2938 }, // 153.16.32.208   - 153.16.32.223   LISP#mitko-xtr
+	{ 0x991020e0, 0x991020ef,   2953 }, // 153.16.32.224   - 153.16.32.239   LISP#isarnet-xtr
+	{ 0x991020f0, 0x991020ff,   2970 }, // 153.16.32.240   - 153.16.32.255   LISP#experteach-xtr
+	{ 0x99102100, 0x991021ff,   2990 }, // 153.16.33.0     - 153.16.33.255   LISP#gerd-xtr
+	{ 0x99102200, 0x991022ff,   3004 }, // 153.16.34.0     - 153.16.34.255   LISP#luigi-xtr
+	{ 0x99102300, 0x991023ff,   3019 }, // 153.16.35.0     - 153.16.35.255   LISP#damien-xtr
+	{ 0x99102400, 0x991024ff,   2953 }, // 153.16.36.0     - 153.16.36.255   LISP#isarnet-xtr
+	{ 0x99102500, 0x991025ff,   3035 }, // 153.16.37.0     - 153.16.37.255   LISP#dino-xtr
+	{ 0x99102600, 0x991026ff,   3049 }, // 153.16.38.0     - 153.16.38.255   LISP#lip6-fr-xtr
+	{ 0x99102700, 0x991027ff,   3066 }, // 153.16.39.0     - 153.16.39.255   LISP#wolfgang-client-xtr
+	{ 0x99102800, 0x991028ff,   3091 }, // 153.16.40.0     - 153.16.40.255   LISP#simlo-xtr
+	{ 0x99102900, 0x991029ff,   3106 }, // 153.16.41.0     - 153.16.41.255   LISP#wolfgang-odd-xtr
+	{ 0x99102a00, 0x99102aff,   3128 }, // 153.16.42.0     - 153.16.42.255   LISP#wolfgang-even-xtr
+	{ 0x99102b00, 0x99102b0f,   3151 }, // 153.16.43.0     - 153.16.43.15    LISP#jesper-xtr
+	{ 0x99102b10, 0x99102b1f,   3167 }, // 153.16.43.16    - 153.16.43.31    LISP#isidor-xtr
+	{ 0x99102b20, 0x99102b2f,   3183 }, // 153.16.43.32    - 153.16.43.47    LISP#jobsnijders-home-xtr
+	{ 0x99102b30, 0x99102b3f,   3209 }, // 153.16.43.48    - 153.16.43.63    LISP#intouch-office-xtr
+	{ 0x99102b40, 0x99102b7f,   3233 }, // 153.16.43.64    - 153.16.43.127   LISP#intouch-dc1-xtr-1
+	{ 0x99102b80, 0x99102bbf,   3256 }, // 153.16.43.128   - 153.16.43.191   LISP#intouch-dc2-xtr-1
+	{ 0x99102bf0, 0x99102bff,   3279 }, // 153.16.43.240   - 153.16.43.255   LISP#pcharalampou-xtr
+	{ 0x99102bf1, 0x99102bf1,   3279 }, // 153.16.43.241   - 153.16.43.241   LISP#pcharalampou-xtr
+	{ 0x99102bf2, 0x99102bf2,   3279 }, // 153.16.43.242   - 153.16.43.242   LISP#pcharalampou-xtr
+	{ 0x99102c00, 0x99102c0f,   3301 }, // 153.16.44.0     - 153.16.44.15    LISP#tetaneutral-xtr
+	{ 0x99102c10, 0x99102c1f,   3322 }, // 153.16.44.16    - 153.16.44.31    LISP#korpo-tp-xtr
+	{ 0x99102c20, 0x99102c2f,   3340 }, // 153.16.44.32    - 153.16.44.47    LISP#mbosecki-xtr
+	{ 0x99102c30, 0x99102c3f,   3358 }, // 153.16.44.48    - 153.16.44.63    LISP#moreas-xtr
+	{ 0x99102c40, 0x99102c4f,   3374 }, // 153.16.44.64    - 153.16.44.79    LISP#planete-xtr
+	{ 0x99102c50, 0x99102c5f,   3391 }, // 153.16.44.80    - 153.16.44.95    LISP#giheron-xtr
+	{ 0x99102c60, 0x99102c6f,   3408 }, // 153.16.44.96    - 153.16.44.111   LISP#antoine-xtr
+	{ 0x99102c70, 0x99102c7f,   3425 }, // 153.16.44.112   - 153.16.44.127   LISP#uniroma-xtr
+	{ 0x99102c80, 0x99102c8f,   3442 }, // 153.16.44.128   - 153.16.44.143   LISP#jjstevens-xtr
+	{ 0x99102c90, 0x99102c9f,   3461 }, // 153.16.44.144   - 153.16.44.159   LISP#lukasm-xtr
+	{ 0x99102ca0, 0x99102caf,   3477 }, // 153.16.44.160   - 153.16.44.175   LISP#atle-xtr
+	{ 0x99102cc0, 0x99102ccf,   3491 }, // 153.16.44.192   - 153.16.44.207   LISP#geert-xtr
+	{ 0x99102cd0, 0x99102cdf,   3506 }, // 153.16.44.208   - 153.16.44.223   LISP#zilina-xtr
+	{ 0x99102ce0, 0x99102cef,   3522 }, // 153.16.44.224   - 153.16.44.239   LISP#chrisgray-xtr
+	{ 0x99102d00, 0x99102d0f,   3541 }, // 153.16.45.0     - 153.16.45.15    LISP#ch-marcel-xtr
+	{ 0x99102d10, 0x99102d1f,   3560 }, // 153.16.45.16    - 153.16.45.31    LISP#uaveiro-xtr
+	{ 0x99102d20, 0x99102d2f,   3577 }, // 153.16.45.32    - 153.16.45.47    LISP#caspary-xtr
+	{ 0x99102d30, 0x99102d3f,   3594 }, // 153.16.45.48    - 153.16.45.63    LISP#maxried-xtr
+	{ 0x99102d40, 0x99102d4f,   3611 }, // 153.16.45.64    - 153.16.45.79    LISP#yun-xtr
+	{ 0x99102d50, 0x99102d5f,   3624 }, // 153.16.45.80    - 153.16.45.95    LISP#tietze-xtr
+	{ 0x99102d60, 0x99102d6f,   3640 }, // 153.16.45.96    - 153.16.45.111   LISP#jkuhn-xtr
+	{ 0x99102d70, 0x99102d7f,   3655 }, // 153.16.45.112   - 153.16.45.127   LISP#a1-telekom-xtr
+	{ 0x99102d80, 0x99102d8f,   3675 }, // 153.16.45.128   - 153.16.45.143   LISP#renne-xtr
+	{ 0x99102d90, 0x99102d9f,   3690 }, // 153.16.45.144   - 153.16.45.159   LISP#mblokzij-pi-xtr
+	{ 0x99102da0, 0x99102daf,   3711 }, // 153.16.45.160   - 153.16.45.175   LISP#lueers-xtr
+	{ 0x99102db0, 0x99102dbf,   3727 }, // 153.16.45.176   - 153.16.45.191   LISP#hkoerth-xtr
+	{ 0x99102dc0, 0x99102dcf,   3744 }, // 153.16.45.192   - 153.16.45.207   LISP#nclark-xtr
+	{ 0x99102dd0, 0x99102ddf,   3760 }, // 153.16.45.208   - 153.16.45.223   LISP#teridion-xtr
+	{ 0x99102de0, 0x99102def,   3778 }, // 153.16.45.224   - 153.16.45.239   LISP#mgrabner-xtr
+	{ 0x99102df0, 0x99102dff,   3796 }, // 153.16.45.240   - 153.16.45.255   LISP#albring-xtr
+	{ 0x99102e00, 0x99102eff,   3813 }, // 153.16.46.0     - 153.16.46.255   LISP#mcenteme-xtr
+	{ 0x99102f00, 0x99102f0f,   3831 }, // 153.16.47.0     - 153.16.47.15    LISP#mblokzij-xtr
+	{ 0x99102f10, 0x99102f1f,   3849 }, // 153.16.47.16    - 153.16.47.31    LISP#ataf-xtr
+	{ 0x99102f20, 0x99102f2f,   3863 }, // 153.16.47.32    - 153.16.47.47    LISP#adittman-xtr
+	{ 0x99102f30, 0x99102f3f,   3881 }, // 153.16.47.48    - 153.16.47.63    LISP#runar-xtr
+	{ 0x99102f40, 0x99102f4f,   3896 }, // 153.16.47.64    - 153.16.47.79    LISP#iceland-xtr
+	{ 0x99102f50, 0x99102f5f,   3913 }, // 153.16.47.80    - 153.16.47.95    LISP#raabo-xtr
+	{ 0x99102f60, 0x99102f6f,   3928 }, // 153.16.47.96    - 153.16.47.111   LISP#alex-xtr
+	{ 0x99102f70, 0x99102f7f,   3942 }, // 153.16.47.112   - 153.16.47.127   LISP#francesco-xtr
+	{ 0x99102f80, 0x99102f8f,   3961 }, // 153.16.47.128   - 153.16.47.143   LISP#fraunhofer-igd-xtr
+	{ 0x99102fa0, 0x99102fbf,   3985 }, // 153.16.47.160   - 153.16.47.191   LISP#smirnov-xtr
+	{ 0x99102fc0, 0x99102fcf,   4002 }, // 153.16.47.192   - 153.16.47.207   LISP#cegal-xtr
+	{ 0x99102fd0, 0x99102fdf,   4017 }, // 153.16.47.208   - 153.16.47.223   LISP#gloudemans-xtr
+	{ 0x99102fe0, 0x99102fef,   4037 }, // 153.16.47.224   - 153.16.47.239   LISP#claes-xtr
+	{ 0x99102ff0, 0x99102fff,   4052 }, // 153.16.47.240   - 153.16.47.255   LISP#hu-uasu-xtr
+	{ 0x99103000, 0x9910300f,   4069 }, // 153.16.48.0     - 153.16.48.15    LISP#umurcia-1-xtr
+	{ 0x99103010, 0x9910301f,   4088 }, // 153.16.48.16    - 153.16.48.31    LISP#umurcia-2-xtr
+	{ 0x99103020, 0x9910302f,   4107 }, // 153.16.48.32    - 153.16.48.47    LISP#umurcia-3-xtr
+	{ 0x99103030, 0x9910303f,   4126 }, // 153.16.48.48    - 153.16.48.63    LISP#hauschild-xtr
+	{ 0x99103040, 0x9910304f,   4145 }, // 153.16.48.64    - 153.16.48.79    LISP#cat6k-demo-uk
+	{ 0x99103050, 0x9910305f,   4164 }, // 153.16.48.80    - 153.16.48.95    LISP#roel-xtr
+	{ 0x99103060, 0x9910306f,   4178 }, // 153.16.48.96    - 153.16.48.111   LISP#clemens-xtr
+	{ 0x99103070, 0x9910307f,   4195 }, // 153.16.48.112   - 153.16.48.127   LISP#fit-xtr
+	{ 0x99103080, 0x9910308f,   4208 }, // 153.16.48.128   - 153.16.48.143   LISP#level-it-xtr
+	{ 0x99103090, 0x9910309f,   4226 }, // 153.16.48.144   - 153.16.48.159   LISP#AVM01-xtr
+	{ 0x991030a0, 0x991030af,   4241 }, // 153.16.48.160   - 153.16.48.175   LISP#AVM02-xtr
+	{ 0x991030b0, 0x991030bf,   4256 }, // 153.16.48.176   - 153.16.48.191   LISP#AVM03-xtr
+	{ 0x991030c0, 0x991030cf,   4271 }, // 153.16.48.192   - 153.16.48.207   LISP#AVM04-xtr
+	{ 0x991030d0, 0x991030df,   4286 }, // 153.16.48.208   - 153.16.48.223   LISP#AVM05-xtr
+	{ 0x991030e0, 0x991030ef,   4301 }, // 153.16.48.224   - 153.16.48.239   LISP#AVM06-xtr
+	{ 0x991030f0, 0x991030ff,   4316 }, // 153.16.48.240   - 153.16.48.255   LISP#AVM07-xtr
+	{ 0x99103100, 0x9910310f,   4331 }, // 153.16.49.0     - 153.16.49.15    LISP#AVM08-xtr
+	{ 0x99103110, 0x9910311f,   4346 }, // 153.16.49.16    - 153.16.49.31    LISP#AVM09-xtr
+	{ 0x99103120, 0x9910312f,   4361 }, // 153.16.49.32    - 153.16.49.47    LISP#vz-niko-ch
+	{ 0x99103130, 0x9910313f,   4377 }, // 153.16.49.48    - 153.16.49.63    LISP#dipesh-xtr
+	{ 0x99103140, 0x9910314f,   4393 }, // 153.16.49.64    - 153.16.49.79    LISP#quenzer-xtr
+	{ 0x99103150, 0x9910315f,   4410 }, // 153.16.49.80    - 153.16.49.95    LISP#turnerhouse-xtr
+	{ 0x99103160, 0x9910316f,   4431 }, // 153.16.49.96    - 153.16.49.111   LISP#lhsystems-xtr
+	{ 0x99103170, 0x9910317f,   4450 }, // 153.16.49.112   - 153.16.49.127   LISP#coudron-xtr
+	{ 0x99103180, 0x9910318f,   4467 }, // 153.16.49.128   - 153.16.49.143   LISP#hubers-xtr
+	{ 0x99103190, 0x9910319f,   4483 }, // 153.16.49.144   - 153.16.49.159   LISP#woellhaf-xtr
+	{ 0x991031a0, 0x991031af,   4501 }, // 153.16.49.160   - 153.16.49.175   LISP#damjan-xtr
+	{ 0x991031b0, 0x991031bf,   4517 }, // 153.16.49.176   - 153.16.49.191   LISP#leander-xtr
+	{ 0x991031c0, 0x991031cf,   4534 }, // 153.16.49.192   - 153.16.49.207   LISP#nikolay-xtr
+	{ 0x991031d0, 0x991031df,   4551 }, // 153.16.49.208   - 153.16.49.223   LISP#moritz-xtr
+	{ 0x991031e0, 0x991031ef,   4567 }, // 153.16.49.224   - 153.16.49.239   LISP#skonecki-xtr
+	{ 0x991031f0, 0x991031ff,   4585 }, // 153.16.49.240   - 153.16.49.255   LISP#thoene-xtr
+	{ 0x99103200, 0x9910320f,   4601 }, // 153.16.50.0     - 153.16.50.15    LISP#lori-xtr
+	{ 0x99103210, 0x9910321f,   4615 }, // 153.16.50.16    - 153.16.50.31    LISP#reitz-xtr
+	{ 0x99103220, 0x9910322f,   4630 }, // 153.16.50.32    - 153.16.50.47    LISP#jerome-xtr
+	{ 0x99103230, 0x9910323f,   4646 }, // 153.16.50.48    - 153.16.50.63    LISP#netcloud-xtr
+	{ 0x99103240, 0x9910324f,   4664 }, // 153.16.50.64    - 153.16.50.79    LISP#dschulz-xtr
+	{ 0x99103250, 0x9910325f,   4681 }, // 153.16.50.80    - 153.16.50.95    LISP#atea-xtr
+	{ 0x99103260, 0x9910326f,   4695 }, // 153.16.50.96    - 153.16.50.111   LISP#atea2-xtr
+	{ 0x99103270, 0x9910327f,   4710 }, // 153.16.50.112   - 153.16.50.127   LISP#cschmidt-xtr
+	{ 0x99103280, 0x9910328f,   4728 }, // 153.16.50.128   - 153.16.50.143   LISP#eantc-xtr
+	{ 0x99103290, 0x9910329f,   4743 }, // 153.16.50.144   - 153.16.50.159   LISP#sleiweke-xtr
+	{ 0x991032a0, 0x991032af,   4761 }, // 153.16.50.160   - 153.16.50.175   LISP#marcel-xtr
+	{ 0x991032b0, 0x991032bf,   4777 }, // 153.16.50.176   - 153.16.50.191   LISP#goudswaard-xtr
+	{ 0x991032c0, 0x991032cf,   4797 }, // 153.16.50.192   - 153.16.50.207   LISP#axel-xtr
+	{ 0x991032d0, 0x991032df,   4811 }, // 153.16.50.208   - 153.16.50.223   LISP#trieb-xtr
+	{ 0x991032e0, 0x991032ef,   4826 }, // 153.16.50.224   - 153.16.50.239   LISP#strasser-xtr
+	{ 0x991032f0, 0x991032ff,   4844 }, // 153.16.50.240   - 153.16.50.255   LISP#haase-xtr
+	{ 0x99103300, 0x9910330f,   4859 }, // 153.16.51.0     - 153.16.51.15    LISP#hendrickx-xtr
+	{ 0x99103310, 0x9910331f,   4878 }, // 153.16.51.16    - 153.16.51.31    LISP#keronet-xtr
+	{ 0x99103320, 0x9910332f,   4895 }, // 153.16.51.32    - 153.16.51.47    LISP#sarton-xtr
+	{ 0x99103330, 0x9910333f,   4911 }, // 153.16.51.48    - 153.16.51.63    LISP#nattrav-test
+	{ 0x99103340, 0x9910334f,   4929 }, // 153.16.51.64    - 153.16.51.79    LISP#ermidoro-xtr
+	{ 0x99103350, 0x9910335f,   1260 }, // 153.16.51.80    - 153.16.51.95    LISP#scv-xtr
+	{ 0x99103360, 0x9910336f,   4947 }, // 153.16.51.96    - 153.16.51.111   LISP#rjm-xtr
+	{ 0x99103370, 0x9910337f,   4960 }, // 153.16.51.112   - 153.16.51.127   LISP#answanso-xtr
+	{ 0x99103380, 0x9910338f,   4978 }, // 153.16.51.128   - 153.16.51.143   LISP#strehhuber-xtr
+	{ 0x99103390, 0x9910339f,   4998 }, // 153.16.51.144   - 153.16.51.159   LISP#hintermayr-xtr
+	{ 0x991033a0, 0x991033af,   5018 }, // 153.16.51.160   - 153.16.51.175   LISP#gruber-xtr
+	{ 0x991033b0, 0x991033bf,   5034 }, // 153.16.51.176   - 153.16.51.191   LISP#boardrunner-xtr
+	{ 0x991033c0, 0x991033cf,   5055 }, // 153.16.51.192   - 153.16.51.207   LISP#adwin-xtr
+	{ 0x991033d0, 0x991033df,   5070 }, // 153.16.51.208   - 153.16.51.223   LISP#bartschnet-xtr
+	{ 0x991033e0, 0x991033ef,   5090 }, // 153.16.51.224   - 153.16.51.239   LISP#netgaroo-xtr
+	{ 0x991033f0, 0x991033ff,   5108 }, // 153.16.51.240   - 153.16.51.255   LISP#gensonline-xtr
+	{ 0x99103400, 0x9910347f,   5128 }, // 153.16.52.0     - 153.16.52.127   LISP#nuage-lisp-xtr
+	{ 0x99103480, 0x9910348f,   5148 }, // 153.16.52.128   - 153.16.52.143   LISP#kmartini-xtr
+	{ 0x99103490, 0x9910349f,   5166 }, // 153.16.52.144   - 153.16.52.159   LISP#hs-fulda-xtr
+	{ 0x991034a0, 0x991034af,   5184 }, // 153.16.52.160   - 153.16.52.175   LISP#datenschleuder-xtr
+	{ 0x991034b0, 0x991034bf,   5208 }, // 153.16.52.176   - 153.16.52.191   LISP#airmaxx-xtr
+	{ 0x991034c0, 0x991034cf,   5225 }, // 153.16.52.192   - 153.16.52.207   LISP#kewisch-xtr
+	{ 0x991034d0, 0x991034df,   5242 }, // 153.16.52.208   - 153.16.52.223   LISP#cybernet-xtr
+	{ 0x991034e0, 0x991034ef,   5260 }, // 153.16.52.224   - 153.16.52.239   LISP#krzbia-xtr
+	{ 0x991034f0, 0x991034ff,   5276 }, // 153.16.52.240   - 153.16.52.255   LISP#twarwick-xtr
+	{ 0x99103500, 0x9910350f,   5294 }, // 153.16.53.0     - 153.16.53.15    LISP#fuhge-xtr
+	{ 0x99103510, 0x9910351f,   5309 }, // 153.16.53.16    - 153.16.53.31    LISP#isah-xtr
+	{ 0x99103520, 0x9910352f,   5323 }, // 153.16.53.32    - 153.16.53.47    LISP#lovison-xtr
+	{ 0x99103530, 0x9910353f,   5340 }, // 153.16.53.48    - 153.16.53.63    LISP#jens-xtr
+	{ 0x99103540, 0x9910354f,   5354 }, // 153.16.53.64    - 153.16.53.79    LISP#naundorf-xtr
+	{ 0x99103550, 0x9910355f,   5372 }, // 153.16.53.80    - 153.16.53.95    LISP#leon-xtr
+	{ 0x99103560, 0x9910356f,   5386 }, // 153.16.53.96    - 153.16.53.111   LISP#orottler-xtr
+	{ 0x99103570, 0x9910357f,   5404 }, // 153.16.53.112   - 153.16.53.127   LISP#gschell-xtr
+	{ 0x99103580, 0x9910358f,   5421 }, // 153.16.53.128   - 153.16.53.143   LISP#x10103-xtr
+	{ 0x99103590, 0x9910359f,   5437 }, // 153.16.53.144   - 153.16.53.159   LISP#iname-xtr
+	{ 0x991035a0, 0x991035af,   5452 }, // 153.16.53.160   - 153.16.53.175   LISP#aflorio-cz-xtr
+	{ 0x991035b0, 0x991035bf,   5472 }, // 153.16.53.176   - 153.16.53.191   LISP#jps-networks-xtr
+	{ 0x991035c0, 0x991035cf,   5494 }, // 153.16.53.192   - 153.16.53.207   LISP#mamouni-xtr
+	{ 0x991035d0, 0x991035df,   5511 }, // 153.16.53.208   - 153.16.53.223   LISP#hakkarainen-xtr
+	{ 0x991035e0, 0x991035ef,   5532 }, // 153.16.53.224   - 153.16.53.239   LISP#posteo-xtr
+	{ 0x991035f0, 0x991035ff,   5548 }, // 153.16.53.240   - 153.16.53.255   LISP#pierson-xtr
+	{ 0x99103600, 0x9910360f,   5565 }, // 153.16.54.0     - 153.16.54.15    LISP#hulsmann-xtr
+	{ 0x99103610, 0x9910361f,   5583 }, // 153.16.54.16    - 153.16.54.31    LISP#mdavids-xtr
+	{ 0x99103620, 0x9910362f,   5600 }, // 153.16.54.32    - 153.16.54.47    LISP#erikbent-xtr
+	{ 0x99103630, 0x9910363f,   5618 }, // 153.16.54.48    - 153.16.54.63    LISP#polimi-xtr
+	{ 0x99103640, 0x9910364f,   5634 }, // 153.16.54.64    - 153.16.54.79    LISP#panix-xtr
+	{ 0x99103650, 0x9910365f,   5649 }, // 153.16.54.80    - 153.16.54.95    LISP#glindhart-xtr
+	{ 0x99103660, 0x9910366f,   5668 }, // 153.16.54.96    - 153.16.54.111   LISP#dimensiondata-xtr
+	{ 0x99103670, 0x9910367f,   5691 }, // 153.16.54.112   - 153.16.54.127   LISP#pcforce-xtr
+	{ 0x99103680, 0x9910368f,   5708 }, // 153.16.54.128   - 153.16.54.143   LISP#plotnicu-xtr
+	{ 0x99103690, 0x9910369f,   5726 }, // 153.16.54.144   - 153.16.54.159   LISP#zimperfeld-xtr
+	{ 0x991036a0, 0x991036af,   5746 }, // 153.16.54.160   - 153.16.54.175   LISP#aflorio-it-xtr
+	{ 0x991036b0, 0x991036bf,   5766 }, // 153.16.54.176   - 153.16.54.191   LISP#vanlid-xtr
+	{ 0x991036c0, 0x991036cf,   5782 }, // 153.16.54.192   - 153.16.54.207   LISP#kohlstedde-xtr
+	{ 0x991036d0, 0x991036df,   5802 }, // 153.16.54.208   - 153.16.54.223   LISP#wiegleb-xtr
+	{ 0x991036e0, 0x991036ef,   5819 }, // 153.16.54.224   - 153.16.54.239   LISP#dirks-xtr
+	{ 0x991036f0, 0x991036ff,   5834 }, // 153.16.54.240   - 153.16.54.255   LISP#cbursch-xtr
+	{ 0x99103700, 0x9910370f,   5851 }, // 153.16.55.0     - 153.16.55.15    LISP#vz-niko-ge
+	{ 0x99103710, 0x9910371f,   5867 }, // 153.16.55.16    - 153.16.55.31    LISP#vz-niko-de
+	{ 0x99103720, 0x9910372f,   5883 }, // 153.16.55.32    - 153.16.55.47    LISP#voos-xtr
+	{ 0x99103730, 0x9910373f,   5897 }, // 153.16.55.48    - 153.16.55.63    LISP#plominski-xtr
+	{ 0x99103740, 0x9910374f,   5916 }, // 153.16.55.64    - 153.16.55.79    LISP#eison-xtr
+	{ 0x99103750, 0x9910375f,   5931 }, // 153.16.55.80    - 153.16.55.95    LISP#a1-telekom2-xtr
+	{ 0x99103770, 0x9910377f,   5952 }, // 153.16.55.112   - 153.16.55.127   LISP#nord-west-xtr
+	{ 0x99103790, 0x9910379f,   5971 }, // 153.16.55.144   - 153.16.55.159   LISP#frank-xtr
+	{ 0x991037b0, 0x991037bf,   5986 }, // 153.16.55.176   - 153.16.55.191   LISP#uni-obuda-xtr
+	{ 0x991037c0, 0x991037cf,   6005 }, // 153.16.55.192   - 153.16.55.207   LISP#raiffeisen-hu-xtr
+	{ 0x991037d0, 0x991037df,   6028 }, // 153.16.55.208   - 153.16.55.223   LISP#dev252-xtr
+	{ 0x991037e0, 0x991037ef,   6044 }, // 153.16.55.224   - 153.16.55.239   LISP#smit-hague-xtr
+	{ 0x991037f0, 0x991037ff,   6064 }, // 153.16.55.240   - 153.16.55.255   LISP#gierschner-xtr
+	{ 0x99103800, 0x9910380f,   6084 }, // 153.16.56.0     - 153.16.56.15    LISP#lukasm2-xtr
+	{ 0x99103810, 0x9910381f,   6101 }, // 153.16.56.16    - 153.16.56.31    LISP#sacherer-xtr
+	{ 0x99103820, 0x9910382f,   6119 }, // 153.16.56.32    - 153.16.56.47    LISP#gunis-xtr
+	{ 0x99103830, 0x9910383f,   6134 }, // 153.16.56.48    - 153.16.56.63    LISP#hilger-xtr
+	{ 0x99103840, 0x9910384f,   6150 }, // 153.16.56.64    - 153.16.56.79    LISP#schad-xtr
+	{ 0x99103850, 0x9910385f,   6165 }, // 153.16.56.80    - 153.16.56.95    LISP#hagenhoff-xtr
+	{ 0x99103870, 0x9910387f,   6184 }, // 153.16.56.112   - 153.16.56.127   LISP#ibm-gr-xtr
+	{ 0x99103890, 0x9910389f,   6200 }, // 153.16.56.144   - 153.16.56.159   LISP#coldharbour-xtr
+	{ 0x991038b0, 0x991038bf,   6221 }, // 153.16.56.176   - 153.16.56.191   LISP#bach-xtr
+	{ 0x991038c0, 0x991038cf,   6235 }, // 153.16.56.192   - 153.16.56.207   LISP#jschmidle-xtr
+	{ 0x991038d0, 0x991038df,   6254 }, // 153.16.56.208   - 153.16.56.223   LISP#zilina2-xtr
+	{ 0x991038e0, 0x991038ef,   6271 }, // 153.16.56.224   - 153.16.56.239   LISP#dogscafe-xtr
+	{ 0x991038f0, 0x991038ff,   6289 }, // 153.16.56.240   - 153.16.56.255   LISP#mgliwka-xtr
+	{ 0x99103900, 0x9910390f,   6306 }, // 153.16.57.0     - 153.16.57.15    LISP#krunal-eu-xtr
+	{ 0x99103910, 0x9910391f,   6325 }, // 153.16.57.16    - 153.16.57.31    LISP#cstephens-xtr-1
+	{ 0x99103920, 0x9910392f,   6346 }, // 153.16.57.32    - 153.16.57.47    LISP#demierre-xtr
+	{ 0x99103930, 0x9910393f,   6364 }, // 153.16.57.48    - 153.16.57.63    LISP#somogyvari-xtr
+	{ 0x99103940, 0x9910394f,   6384 }, // 153.16.57.64    - 153.16.57.79    LISP#spisati-xtr
+	{ 0x99103950, 0x9910395f,   6401 }, // 153.16.57.80    - 153.16.57.95    LISP#tao-networks-xtr
+	{ 0x99103960, 0x9910396f,   6423 }, // 153.16.57.96    - 153.16.57.111   LISP#willekens-xtr
+	{ 0x99103970, 0x9910397f,   6442 }, // 153.16.57.112   - 153.16.57.127   LISP#jclayton-xtr
+	{ 0x99103980, 0x9910398f,   6460 }, // 153.16.57.128   - 153.16.57.143   LISP#niek-xtr
+	{ 0x99103990, 0x9910399f,   6474 }, // 153.16.57.144   - 153.16.57.159   LISP#mbar-xtr
+	{ 0x991039b0, 0x991039bf,   6488 }, // 153.16.57.176   - 153.16.57.191   LISP#lsd-xtr
+	{ 0x991039c0, 0x991039cf,   6501 }, // 153.16.57.192   - 153.16.57.207   LISP#rfurda-xtr
+	{ 0x991039d0, 0x991039df,   6517 }, // 153.16.57.208   - 153.16.57.223   LISP#gmaricau-xtr
+	{ 0x991039f0, 0x991039ff,   6535 }, // 153.16.57.240   - 153.16.57.255   LISP#dzeitler-xtr
+	{ 0x99103a00, 0x99103a0f,   6553 }, // 153.16.58.0     - 153.16.58.15    LISP#garndt-xtr
+	{ 0x99103a10, 0x99103a1f,   6569 }, // 153.16.58.16    - 153.16.58.31    LISP#jpreuss-xtr
+	{ 0x99103a20, 0x99103a2f,   6586 }, // 153.16.58.32    - 153.16.58.47    LISP#smondwurf-xtr
+	{ 0x99103a30, 0x99103a3f,   6605 }, // 153.16.58.48    - 153.16.58.63    LISP#tbonitz-xtr
+	{ 0x99103a40, 0x99103a4f,   6622 }, // 153.16.58.64    - 153.16.58.79    LISP#cisco-natal1-xtr
+	{ 0x99103a50, 0x99103a5f,   6644 }, // 153.16.58.80    - 153.16.58.95    LISP#cglasmeyer-xtr
+	{ 0x99103a60, 0x99103a6f,   6664 }, // 153.16.58.96    - 153.16.58.111   LISP#rengel-xtr
+	{ 0x99103a70, 0x99103a7f,   6680 }, // 153.16.58.112   - 153.16.58.127   LISP#hgojny-xtr
+	{ 0x99103a80, 0x99103a8f,   6696 }, // 153.16.58.128   - 153.16.58.143   LISP#rkohn-xtr
+	{ 0x99103a90, 0x99103a9f,   6711 }, // 153.16.58.144   - 153.16.58.159   LISP#jpkoegeler-xtr
+	{ 0x99103ab0, 0x99103abf,   6731 }, // 153.16.58.176   - 153.16.58.191   LISP#gniederwimmer-xtr
+	{ 0x99103ad0, 0x99103adf,   6754 }, // 153.16.58.208   - 153.16.58.223   LISP#mmikulenas-xtr
+	{ 0x99103ae0, 0x99103aef,   6774 }, // 153.16.58.224   - 153.16.58.239   LISP#cbretterhofer-xtr
+	{ 0x99103af0, 0x99103aff,   6797 }, // 153.16.58.240   - 153.16.58.255   LISP#mgoebel-xtr
+	{ 0x99103b00, 0x99103b0f,   6814 }, // 153.16.59.0     - 153.16.59.15    LISP#bmorcinkowski-xtr
+	{ 0x99103b10, 0x99103b1f,   6837 }, // 153.16.59.16    - 153.16.59.31    LISP#jbaumann-xtr
+	{ 0x99103b20, 0x99103b2f,   6855 }, // 153.16.59.32    - 153.16.59.47    LISP#mfey-xtr
+	{ 0x99103b30, 0x99103b3f,   6869 }, // 153.16.59.48    - 153.16.59.63    LISP#mmuller-xtr
+	{ 0x99103b40, 0x99103b4f,   6886 }, // 153.16.59.64    - 153.16.59.79    LISP#rjud-xtr
+	{ 0x99103b50, 0x99103b5f,   6900 }, // 153.16.59.80    - 153.16.59.95    LISP#theinz-xtr
+	{ 0x99103b60, 0x99103b6f,   6916 }, // 153.16.59.96    - 153.16.59.111   LISP#fzahn-xtr
+	{ 0x99103b70, 0x99103b7f,   6931 }, // 153.16.59.112   - 153.16.59.127   LISP#ahugi-xtr
+	{ 0x99103b80, 0x99103b8f,   6946 }, // 153.16.59.128   - 153.16.59.143   LISP#niekvanderven-xtr
+	{ 0x99103b90, 0x99103b9f,   6969 }, // 153.16.59.144   - 153.16.59.159   LISP#jdechert-xtr
+	{ 0x99103bb0, 0x99103bbf,   6987 }, // 153.16.59.176   - 153.16.59.191   LISP#crothlander-xtr
+	{ 0x99103bd0, 0x99103bdf,   7008 }, // 153.16.59.208   - 153.16.59.223   LISP#wvanlid-xtr
+	{ 0x99103be0, 0x99103bef,   7025 }, // 153.16.59.224   - 153.16.59.239   LISP#upc-oor-xtr
+	{ 0x99103c00, 0x99103c0f,   7042 }, // 153.16.60.0     - 153.16.60.15    LISP#tivano-software-xtr
+	{ 0x99103c10, 0x99103c1f,   7067 }, // 153.16.60.16    - 153.16.60.31    LISP#ngunther-xtr
+	{ 0x99103c20, 0x99103c2f,   7085 }, // 153.16.60.32    - 153.16.60.47    LISP#gthor-xtr
+	{ 0x99103c30, 0x99103c3f,   7100 }, // 153.16.60.48    - 153.16.60.63    LISP#wonken-xtr
+	{ 0x99103c50, 0x99103c5f,   7116 }, // 153.16.60.80    - 153.16.60.95    LISP#tzapala-xtr
+	{ 0x99103c60, 0x99103c6f,   7133 }, // 153.16.60.96    - 153.16.60.111   LISP#rmller-xtr
+	{ 0x99103c80, 0x99103c8f,   7149 }, // 153.16.60.128   - 153.16.60.143   LISP#feul-xtr
+	{ 0x99103c90, 0x99103c9f,   7163 }, // 153.16.60.144   - 153.16.60.159   LISP#asunnetci-xtr
+	{ 0x99103cc0, 0x99103ccf,   7182 }, // 153.16.60.192   - 153.16.60.207   LISP#dfett-xtr
+	{ 0x99103cd0, 0x99103cdf,   7197 }, // 153.16.60.208   - 153.16.60.223   LISP#mklingspor-xtr
+	{ 0x99103ce0, 0x99103cef,   7217 }, // 153.16.60.224   - 153.16.60.239   LISP#gsanjay-xtr
+	{ 0x99103cf0, 0x99103cff,   7234 }, // 153.16.60.240   - 153.16.60.255   LISP#tkoch-xtr
+	{ 0x99103d00, 0x99103d0f,   7249 }, // 153.16.61.0     - 153.16.61.15    LISP#hrenz-xtr
+	{ 0x99103d10, 0x99103d1f,   7264 }, // 153.16.61.16    - 153.16.61.31    LISP#blawall-xtr
+	{ 0x99103d20, 0x99103d2f,   7281 }, // 153.16.61.32    - 153.16.61.47    LISP#unitbv-xtr
+	{ 0x99103d30, 0x99103d3f,   7297 }, // 153.16.61.48    - 153.16.61.63    LISP#hketele-xtr
+	{ 0x99103d40, 0x99103d4f,   7314 }, // 153.16.61.64    - 153.16.61.79    LISP#rdchragner-xtr
+	{ 0x99103d50, 0x99103d5f,   7334 }, // 153.16.61.80    - 153.16.61.95    LISP#mamin-xtr
+	{ 0x99103d70, 0x99103d7f,   7349 }, // 153.16.61.112   - 153.16.61.127   LISP#twittenberg-xtr
+	{ 0x99103d80, 0x99103d8f,   7370 }, // 153.16.61.128   - 153.16.61.143   LISP#bwieder-xtr
+	{ 0x99103d90, 0x99103d9f,   7387 }, // 153.16.61.144   - 153.16.61.159   LISP#sbethge-xtr
+	{ 0x99103db0, 0x99103dbf,   7404 }, // 153.16.61.176   - 153.16.61.191   LISP#jdornauf-xtr
+	{ 0x99103dd0, 0x99103ddf,   7422 }, // 153.16.61.208   - 153.16.61.223   LISP#mmiller-xtr
+	{ 0x99103de0, 0x99103def,   7439 }, // 153.16.61.224   - 153.16.61.239   LISP#cfertig-xtr
+	{ 0x99103df0, 0x99103dff,   7456 }, // 153.16.61.240   - 153.16.61.255   LISP#jkatolla-xtr
+	{ 0x99103e00, 0x99103e0f,   7474 }, // 153.16.62.0     - 153.16.62.15    LISP#freenet-xtr
+	{ 0x99103e10, 0x99103e1f,   7491 }, // 153.16.62.16    - 153.16.62.31    LISP#nweissbach-xtr
+	{ 0x99103e20, 0x99103e2f,   7511 }, // 153.16.62.32    - 153.16.62.47    LISP#owas-xtr
+	{ 0x99103e30, 0x99103e3f,   7525 }, // 153.16.62.48    - 153.16.62.63    LISP#rspickers-xtr
+	{ 0x99103e40, 0x99103e4f,   7544 }, // 153.16.62.64    - 153.16.62.79    LISP#pcech-xtr
+	{ 0x99103e50, 0x99103e5f,   7559 }, // 153.16.62.80    - 153.16.62.95    LISP#cpalm-xtr
+	{ 0x99103e60, 0x99103e6f,   7574 }, // 153.16.62.96    - 153.16.62.111   LISP#asellmann-xtr
+	{ 0x99103e70, 0x99103e7f,   7593 }, // 153.16.62.112   - 153.16.62.127   LISP#mluckert-xtr
+	{ 0x99103e80, 0x99103e8f,   7611 }, // 153.16.62.128   - 153.16.62.143   LISP#tzimmermann-xtr
+	{ 0x99103e90, 0x99103e9f,   7632 }, // 153.16.62.144   - 153.16.62.159   LISP#dpeshev-xtr
+	{ 0x99103f01, 0x99103f01,   7649 }, // 153.16.63.1     - 153.16.63.1     LISP#lispmon-mn-u-1
+	{ 0x99103f02, 0x99103f02,   7669 }, // 153.16.63.2     - 153.16.63.2     LISP#lispmob-mn-u-2
+	{ 0x99104000, 0x991040ff,   7689 }, // 153.16.64.0     - 153.16.64.255   LISP#iij-xtr
+	{ 0x99104100, 0x991041ff,   7702 }, // 153.16.65.0     - 153.16.65.255   LISP#hughes-xtr
+	{ 0x99104200, 0x9910420f,   7718 }, // 153.16.66.0     - 153.16.66.15    LISP#ntt-com-xtr
+	{ 0x99104210, 0x9910421f,   7735 }, // 153.16.66.16    - 153.16.66.31    LISP#kddi-labs-xtr
+	{ 0x99104220, 0x9910422f,   7754 }, // 153.16.66.32    - 153.16.66.47    LISP#tata-xtr
+	{ 0x99104230, 0x9910423f,   7768 }, // 153.16.66.48    - 153.16.66.63    LISP#jiwang-xtr
+	{ 0x99104240, 0x9910424f,   7784 }, // 153.16.66.64    - 153.16.66.79    LISP#layim-xtr
+	{ 0x99104250, 0x9910425f,   7799 }, // 153.16.66.80    - 153.16.66.95    LISP#cfwong-xtr
+	{ 0x99104260, 0x9910426f,   7815 }, // 153.16.66.96    - 153.16.66.111   LISP#logicalis-xtr
+	{ 0x99104270, 0x9910427f,   7834 }, // 153.16.66.112   - 153.16.66.127   LISP#cht-xtr
+	{ 0x99104280, 0x9910428f,   7847 }, // 153.16.66.128   - 153.16.66.143   LISP#oasis-tech-xtr
+	{ 0x99104290, 0x9910429f,   7867 }, // 153.16.66.144   - 153.16.66.159   LISP#mingchow-xtr
+	{ 0x991042a0, 0x991042af,   7885 }, // 153.16.66.160   - 153.16.66.175   LISP#jiwang2-xtr
+	{ 0x991042b0, 0x991042bf,   7902 }, // 153.16.66.176   - 153.16.66.191   LISP#fnsc-xtr
+	{ 0x991042c0, 0x991042cf,   7916 }, // 153.16.66.192   - 153.16.66.207   LISP#matsumoto-xtr
+	{ 0x991042d0, 0x991042df,   7935 }, // 153.16.66.208   - 153.16.66.223   LISP#vhan-xtr
+	{ 0x991042e0, 0x991042ef,   7949 }, // 153.16.66.224   - 153.16.66.239   LISP#alphawest-xtr
+	{ 0x991042f0, 0x991042ff,   7968 }, // 153.16.66.240   - 153.16.66.255   LISP#mra4d-xtr
+	{ 0x99104300, 0x991043ff,   7983 }, // 153.16.67.0     - 153.16.67.255   LISP#apan-xtr
+	{ 0x99104400, 0x991044ff,   7997 }, // 153.16.68.0     - 153.16.68.255   LISP#wide-xtr
+	{ 0x99104500, 0x991045ff,   8011 }, // 153.16.69.0     - 153.16.69.255   LISP#nagoya-u-xtr
+	{ 0x99104600, 0x9910460f,   8029 }, // 153.16.70.0     - 153.16.70.15    LISP#yuyarin-xtr
+	{ 0x99104610, 0x9910461f,   8046 }, // 153.16.70.16    - 153.16.70.31    LISP#uet-vnu-xtr
+	{ 0x99104620, 0x9910462f,   8063 }, // 153.16.70.32    - 153.16.70.47    LISP#pccw-xtr
+	{ 0x99104630, 0x9910463f,   8077 }, // 153.16.70.48    - 153.16.70.63    LISP#fitac-xtr
+	{ 0x99104640, 0x9910465f,   8092 }, // 153.16.70.64    - 153.16.70.95    LISP#daniel-xtr-1
+	{ 0x99104660, 0x9910466f,   8110 }, // 153.16.70.96    - 153.16.70.111   LISP#daniel-xtr-2
+	{ 0x99104670, 0x9910467f,   8128 }, // 153.16.70.112   - 153.16.70.127   LISP#daniel-xtr-3
+	{ 0x99104690, 0x9910469f,   8146 }, // 153.16.70.144   - 153.16.70.159   LISP#pgear-xtr
+	{ 0x991046a0, 0x991046af,   8161 }, // 153.16.70.160   - 153.16.70.175   LISP#hongang-xtr
+	{ 0x991046b0, 0x991046bf,   8178 }, // 153.16.70.176   - 153.16.70.191   LISP#chaney-xtr
+	{ 0x991046c0, 0x991046cf,   8194 }, // 153.16.70.192   - 153.16.70.207   LISP#kozuka-xtr
+	{ 0x991046d0, 0x991046df,   8210 }, // 153.16.70.208   - 153.16.70.223   LISP#nattrav-test-apnic
+	{ 0x991046f0, 0x991046ff,   8234 }, // 153.16.70.240   - 153.16.70.255   LISP#ydpark-xtr
+	{ 0x99104700, 0x9910470f,   8250 }, // 153.16.71.0     - 153.16.71.15    LISP#farhadsh-xtr
+	{ 0x99104710, 0x9910471f,   8268 }, // 153.16.71.16    - 153.16.71.31    LISP#hawthorne-xtr
+	{ 0x99104720, 0x9910472f,   8287 }, // 153.16.71.32    - 153.16.71.47    LISP#hyunsoo-xtr
+	{ 0x99104730, 0x9910473f,   8304 }, // 153.16.71.48    - 153.16.71.63    LISP#ykenu-xtr
+	{ 0x99104740, 0x9910474f,   8319 }, // 153.16.71.64    - 153.16.71.79    LISP#gsik-xtr
+	{ 0x99104750, 0x9910475f,   8333 }, // 153.16.71.80    - 153.16.71.95    LISP#yshiin-xtr
+	{ 0x99104760, 0x9910476f,   8349 }, // 153.16.71.96    - 153.16.71.111   LISP#tao-networks2-xtr
+	{ 0x99104770, 0x9910477f,   8372 }, // 153.16.71.112   - 153.16.71.127   LISP#rdines-xtr
+	{ 0x99104780, 0x9910478f,   8388 }, // 153.16.71.128   - 153.16.71.143   LISP#upc-oor2-xtr
+	{ 0x99104790, 0x9910479f,   8406 }, // 153.16.71.144   - 153.16.71.159   LISP#ietf100-xtr
+	{ 0x991047a0, 0x991047af,   8423 }, // 153.16.71.160   - 153.16.71.175   LISP#sukiyaki-proj-xtr
+	{ 0x991047b0, 0x991047bf,   8446 }, // 153.16.71.176   - 153.16.71.191   LISP#sukiyaki2-proj-xtr
+	{ 0x991047c0, 0x991047cf,   8470 }, // 153.16.71.192   - 153.16.71.207   LISP#gtja-xtr
+	{ 0x991047d0, 0x991047df,   8484 }, // 153.16.71.208   - 153.16.71.223   LISP#hcmus-xtr
+	{ 0x991047e0, 0x991047ef,   8499 }, // 153.16.71.224   - 153.16.71.239   LISP#amacuz-xtr
+	{ 0x991048f0, 0x991048ff,   8515 }, // 153.16.72.240   - 153.16.72.255   LISP#gs9591-xtr
+	{ 0x99104a00, 0x99104aff,   8531 }, // 153.16.74.0     - 153.16.74.255   LISP#layim2-xtr
+	{ 0x99108000, 0x9910800f,   8547 }, // 153.16.128.0    - 153.16.128.15   LISP#ufba-xtr
 };
+
+static const char dbipv4addr_info_strings[] =
+	"LISP#asp-xtr\0"
+	"LISP#ntt-xtr\0"
+	"LISP#bell-ca-xtr\0"
+	"LISP#nyu-xtr\0"
+	"LISP#cisco-it-xtr\0"
+	"LISP#asp-n7k-xtr\0"
+	"LISP#ucla-xtr\0"
+	"LISP#fabio-new-mn\0"
+	"LISP#nmaadara-xtr\0"
+	"LISP#gbumgard-xtr\0"
+	"LISP#chuljin-xtr\0"
+	"LISP#akennedy-xtr\0"
+	"LISP#jcolin-xtr\0"
+	"LISP#rbonnell-xtr\0"
+	"LISP#jalberti-xtr\0"
+	"LISP#cisco-natal2-xtr\0"
+	"LISP#lfiegl-xtr\0"
+	"LISP#upc-arin-xtr\0"
+	"LISP#azure-xtr\0"
+	"LISP#vaf-xtr\0"
+	"LISP#icox-xtr\0"
+	"LISP#srin-jcd-dc1\0"
+	"LISP#srin-jcd-dc2\0"
+	"LISP#snoble-xtr\0"
+	"LISP#dalvarez-xtr\0"
+	"LISP#wnellis-xtr\0"
+	"LISP#srin-xtr\0"
+	"LISP#amit-xtr\0"
+	"LISP#stevenca-xtr\0"
+	"LISP#jearango-xtr\0"
+	"LISP#sulrich-xtr\0"
+	"LISP#manishee-xtr\0"
+	"LISP#aaronm-xtr\0"
+	"LISP#samuel-xtr\0"
+	"LISP#wwt-xtr\0"
+	"LISP#c819-LTE-xtr\0"
+	"LISP#facebook-xtr-1\0"
+	"LISP#isc-pxtr\0"
+	"LISP#vl-openwrt1-xtr\0"
+	"LISP#gregg-xtr\0"
+	"LISP#vl-openwrt2-xtr\0"
+	"LISP#vl-openwrt3-xtr\0"
+	"LISP#asr1knat64-xtr\0"
+	"LISP#zhicheng-xtr\0"
+	"LISP#nattrav-test-arin\0"
+	"LISP#liguori-xtr\0"
+	"LISP#djcalif-xtr\0"
+	"LISP#dehrle1-xtr\0"
+	"LISP#dehrle2-xtr\0"
+	"LISP#divya-xtr\0"
+	"LISP#jhennessy-xtr\0"
+	"LISP#martin-xtr\0"
+	"LISP#comfort-xtr\0"
+	"LISP#robert-cdw-xtr\0"
+	"LISP#lierop-xtr\0"
+	"LISP#cmh-xtr\0"
+	"LISP#tosterbe-xtr\0"
+	"LISP#kecorbin-xtr\0"
+	"LISP#dstsyst-xtr\0"
+	"LISP#ufrj-xtr\0"
+	"LISP#machilde-xtr\0"
+	"LISP#jessica-xtr\0"
+	"LISP#archana-xtr\0"
+	"LISP#jadumars-xtr\0"
+	"LISP#gorhughe-xtr\0"
+	"LISP#darrel-xtr\0"
+	"LISP#scwaller-xtr\0"
+	"LISP#antasson-mn\0"
+	"LISP#linh-xtr\0"
+	"LISP#sfu-bcnet-xtr\0"
+	"LISP#dipsingh-xtr\0"
+	"LISP#trevlac-xtr\0"
+	"LISP#parna-lev-xtr\0"
+	"LISP#rob-cdw-xtr\0"
+	"LISP#scv-xtr\0"
+	"LISP#muabid-xtr\0"
+	"LISP#steve-apple-xtr\0"
+	"LISP#kleinart-xtr\0"
+	"LISP#chanu-xtr\0"
+	"LISP#mhaaksma-xtr\0"
+	"LISP#tellis-xtr\0"
+	"LISP#jade-xtr\0"
+	"LISP#neno-xtr\0"
+	"LISP#elsen-xtr\0"
+	"LISP#attpoc-xtr\0"
+	"LISP#rymcdowe-xtr\0"
+	"LISP#miles-xtr\0"
+	"LISP#smith-xtr\0"
+	"LISP#epulvino-xtr\0"
+	"LISP#crhill-xtr\0"
+	"LISP#smadley-xtr\0"
+	"LISP#mbirkner-xtr\0"
+	"LISP#mikea-xtr\0"
+	"LISP#jemannin-xtr\0"
+	"LISP#chcoutur-xtr\0"
+	"LISP#bluethunder-xtr\0"
+	"LISP#marknguy-xtr\0"
+	"LISP#marcairn-xtr\0"
+	"LISP#byzek-xtr\0"
+	"LISP#jason-xtr\0"
+	"LISP#groff-xtr\0"
+	"LISP#mwhitley-xtr\0"
+	"LISP#dlapiper-xtr\0"
+	"LISP#manhoo-xtr\0"
+	"LISP#georgy-xtr\0"
+	"LISP#jhippen-xtr\0"
+	"LISP#cbc-xtr\0"
+	"LISP#garydla-xtr\0"
+	"LISP#scalan-xtr\0"
+	"LISP#donkdla-xtr\0"
+	"LISP#umissouri-xtr\0"
+	"LISP#ge-tsg-xtr\0"
+	"LISP#manjeet-xtr\0"
+	"LISP#uvahs-xtr\0"
+	"LISP#zavarce-xtr\0"
+	"LISP#dudek-xtr\0"
+	"LISP#force3a-xtr\0"
+	"LISP#icann-xtr\0"
+	"LISP#attpoc-xtr-2\0"
+	"LISP#jpcaron-xtr\0"
+	"LISP#jamwheat-xtr\0"
+	"LISP#netorian-xtr\0"
+	"LISP#pogue-xtr\0"
+	"LISP#msales-xtr\0"
+	"LISP#spisati-xtr-2\0"
+	"LISP#lprat-xtr\0"
+	"LISP#triple-xtr\0"
+	"LISP#cmich-xtr\0"
+	"LISP#rtajvar-xtr\0"
+	"LISP#snicholas-xtr\0"
+	"LISP#nist-xtr\0"
+	"LISP#google-xtr\0"
+	"LISP#ineteng-xtr\0"
+	"LISP#force3b-xtr\0"
+	"LISP#force3-xtr\0"
+	"LISP#wason-xtr\0"
+	"LISP#schlutter-xtr\0"
+	"LISP#bguldan-xtr\0"
+	"LISP#naasief-xtr\0"
+	"LISP#ciecior-xtr\0"
+	"LISP#coopergeneral-xtr\0"
+	"LISP#plixer-xtr\0"
+	"LISP#halifaxmediagroup-xtr\0"
+	"LISP#ec2test-xtr\0"
+	"LISP#perry-xtr\0"
+	"LISP#fortinet-xtr\0"
+	"LISP#chris-ge-xtr\0"
+	"LISP#djustice-xtr\0"
+	"LISP#apparatus-xtr\0"
+	"LISP#cdw-xtr\0"
+	"LISP#krunal-xtr\0"
+	"LISP#gar-xtr\0"
+	"LISP#jbert-xtr\0"
+	"LISP#rajiva-xtr\0"
+	"LISP#oneok-xtr\0"
+	"LISP#sjury-xtr\0"
+	"LISP#dbuleza-xtr\0"
+	"LISP#tommille-xtr\0"
+	"LISP#uer3-xtr\0"
+	"LISP#tdstelecom-xtr\0"
+	"LISP#dustin-xtr\0"
+	"LISP#thkernen-xtr\0"
+	"LISP#jakab-xtr\0"
+	"LISP#marc-xtr\0"
+	"LISP#deutsche-bank-xtr\0"
+	"LISP#gerd-cbc-xtr\0"
+	"LISP#lbromirs-xtr\0"
+	"LISP#dimitris-xtr\0"
+	"LISP#65bit-xtr\0"
+	"LISP#rolfs-xtr\0"
+	"LISP#markus-xtr\0"
+	"LISP#mkramoli-xtr\0"
+	"LISP#mironto-xtr\0"
+	"LISP#munich-arpt-xtr\0"
+	"LISP#mitko-xtr\0"
+	"LISP#isarnet-xtr\0"
+	"LISP#experteach-xtr\0"
+	"LISP#gerd-xtr\0"
+	"LISP#luigi-xtr\0"
+	"LISP#damien-xtr\0"
+	"LISP#dino-xtr\0"
+	"LISP#lip6-fr-xtr\0"
+	"LISP#wolfgang-client-xtr\0"
+	"LISP#simlo-xtr\0"
+	"LISP#wolfgang-odd-xtr\0"
+	"LISP#wolfgang-even-xtr\0"
+	"LISP#jesper-xtr\0"
+	"LISP#isidor-xtr\0"
+	"LISP#jobsnijders-home-xtr\0"
+	"LISP#intouch-office-xtr\0"
+	"LISP#intouch-dc1-xtr-1\0"
+	"LISP#intouch-dc2-xtr-1\0"
+	"LISP#pcharalampou-xtr\0"
+	"LISP#tetaneutral-xtr\0"
+	"LISP#korpo-tp-xtr\0"
+	"LISP#mbosecki-xtr\0"
+	"LISP#moreas-xtr\0"
+	"LISP#planete-xtr\0"
+	"LISP#giheron-xtr\0"
+	"LISP#antoine-xtr\0"
+	"LISP#uniroma-xtr\0"
+	"LISP#jjstevens-xtr\0"
+	"LISP#lukasm-xtr\0"
+	"LISP#atle-xtr\0"
+	"LISP#geert-xtr\0"
+	"LISP#zilina-xtr\0"
+	"LISP#chrisgray-xtr\0"
+	"LISP#ch-marcel-xtr\0"
+	"LISP#uaveiro-xtr\0"
+	"LISP#caspary-xtr\0"
+	"LISP#maxried-xtr\0"
+	"LISP#yun-xtr\0"
+	"LISP#tietze-xtr\0"
+	"LISP#jkuhn-xtr\0"
+	"LISP#a1-telekom-xtr\0"
+	"LISP#renne-xtr\0"
+	"LISP#mblokzij-pi-xtr\0"
+	"LISP#lueers-xtr\0"
+	"LISP#hkoerth-xtr\0"
+	"LISP#nclark-xtr\0"
+	"LISP#teridion-xtr\0"
+	"LISP#mgrabner-xtr\0"
+	"LISP#albring-xtr\0"
+	"LISP#mcenteme-xtr\0"
+	"LISP#mblokzij-xtr\0"
+	"LISP#ataf-xtr\0"
+	"LISP#adittman-xtr\0"
+	"LISP#runar-xtr\0"
+	"LISP#iceland-xtr\0"
+	"LISP#raabo-xtr\0"
+	"LISP#alex-xtr\0"
+	"LISP#francesco-xtr\0"
+	"LISP#fraunhofer-igd-xtr\0"
+	"LISP#smirnov-xtr\0"
+	"LISP#cegal-xtr\0"
+	"LISP#gloudemans-xtr\0"
+	"LISP#claes-xtr\0"
+	"LISP#hu-uasu-xtr\0"
+	"LISP#umurcia-1-xtr\0"
+	"LISP#umurcia-2-xtr\0"
+	"LISP#umurcia-3-xtr\0"
+	"LISP#hauschild-xtr\0"
+	"LISP#cat6k-demo-uk\0"
+	"LISP#roel-xtr\0"
+	"LISP#clemens-xtr\0"
+	"LISP#fit-xtr\0"
+	"LISP#level-it-xtr\0"
+	"LISP#AVM01-xtr\0"
+	"LISP#AVM02-xtr\0"
+	"LISP#AVM03-xtr\0"
+	"LISP#AVM04-xtr\0"
+	"LISP#AVM05-xtr\0"
+	"LISP#AVM06-xtr\0"
+	"LISP#AVM07-xtr\0"
+	"LISP#AVM08-xtr\0"
+	"LISP#AVM09-xtr\0"
+	"LISP#vz-niko-ch\0"
+	"LISP#dipesh-xtr\0"
+	"LISP#quenzer-xtr\0"
+	"LISP#turnerhouse-xtr\0"
+	"LISP#lhsystems-xtr\0"
+	"LISP#coudron-xtr\0"
+	"LISP#hubers-xtr\0"
+	"LISP#woellhaf-xtr\0"
+	"LISP#damjan-xtr\0"
+	"LISP#leander-xtr\0"
+	"LISP#nikolay-xtr\0"
+	"LISP#moritz-xtr\0"
+	"LISP#skonecki-xtr\0"
+	"LISP#thoene-xtr\0"
+	"LISP#lori-xtr\0"
+	"LISP#reitz-xtr\0"
+	"LISP#jerome-xtr\0"
+	"LISP#netcloud-xtr\0"
+	"LISP#dschulz-xtr\0"
+	"LISP#atea-xtr\0"
+	"LISP#atea2-xtr\0"
+	"LISP#cschmidt-xtr\0"
+	"LISP#eantc-xtr\0"
+	"LISP#sleiweke-xtr\0"
+	"LISP#marcel-xtr\0"
+	"LISP#goudswaard-xtr\0"
+	"LISP#axel-xtr\0"
+	"LISP#trieb-xtr\0"
+	"LISP#strasser-xtr\0"
+	"LISP#haase-xtr\0"
+	"LISP#hendrickx-xtr\0"
+	"LISP#keronet-xtr\0"
+	"LISP#sarton-xtr\0"
+	"LISP#nattrav-test\0"
+	"LISP#ermidoro-xtr\0"
+	"LISP#rjm-xtr\0"
+	"LISP#answanso-xtr\0"
+	"LISP#strehhuber-xtr\0"
+	"LISP#hintermayr-xtr\0"
+	"LISP#gruber-xtr\0"
+	"LISP#boardrunner-xtr\0"
+	"LISP#adwin-xtr\0"
+	"LISP#bartschnet-xtr\0"
+	"LISP#netgaroo-xtr\0"
+	"LISP#gensonline-xtr\0"
+	"LISP#nuage-lisp-xtr\0"
+	"LISP#kmartini-xtr\0"
+	"LISP#hs-fulda-xtr\0"
+	"LISP#datenschleuder-xtr\0"
+	"LISP#airmaxx-xtr\0"
+	"LISP#kewisch-xtr\0"
+	"LISP#cybernet-xtr\0"
+	"LISP#krzbia-xtr\0"
+	"LISP#twarwick-xtr\0"
+	"LISP#fuhge-xtr\0"
+	"LISP#isah-xtr\0"
+	"LISP#lovison-xtr\0"
+	"LISP#jens-xtr\0"
+	"LISP#naundorf-xtr\0"
+	"LISP#leon-xtr\0"
+	"LISP#orottler-xtr\0"
+	"LISP#gschell-xtr\0"
+	"LISP#x10103-xtr\0"
+	"LISP#iname-xtr\0"
+	"LISP#aflorio-cz-xtr\0"
+	"LISP#jps-networks-xtr\0"
+	"LISP#mamouni-xtr\0"
+	"LISP#hakkarainen-xtr\0"
+	"LISP#posteo-xtr\0"
+	"LISP#pierson-xtr\0"
+	"LISP#hulsmann-xtr\0"
+	"LISP#mdavids-xtr\0"
+	"LISP#erikbent-xtr\0"
+	"LISP#polimi-xtr\0"
+	"LISP#panix-xtr\0"
+	"LISP#glindhart-xtr\0"
+	"LISP#dimensiondata-xtr\0"
+	"LISP#pcforce-xtr\0"
+	"LISP#plotnicu-xtr\0"
+	"LISP#zimperfeld-xtr\0"
+	"LISP#aflorio-it-xtr\0"
+	"LISP#vanlid-xtr\0"
+	"LISP#kohlstedde-xtr\0"
+	"LISP#wiegleb-xtr\0"
+	"LISP#dirks-xtr\0"
+	"LISP#cbursch-xtr\0"
+	"LISP#vz-niko-ge\0"
+	"LISP#vz-niko-de\0"
+	"LISP#voos-xtr\0"
+	"LISP#plominski-xtr\0"
+	"LISP#eison-xtr\0"
+	"LISP#a1-telekom2-xtr\0"
+	"LISP#nord-west-xtr\0"
+	"LISP#frank-xtr\0"
+	"LISP#uni-obuda-xtr\0"
+	"LISP#raiffeisen-hu-xtr\0"
+	"LISP#dev252-xtr\0"
+	"LISP#smit-hague-xtr\0"
+	"LISP#gierschner-xtr\0"
+	"LISP#lukasm2-xtr\0"
+	"LISP#sacherer-xtr\0"
+	"LISP#gunis-xtr\0"
+	"LISP#hilger-xtr\0"
+	"LISP#schad-xtr\0"
+	"LISP#hagenhoff-xtr\0"
+	"LISP#ibm-gr-xtr\0"
+	"LISP#coldharbour-xtr\0"
+	"LISP#bach-xtr\0"
+	"LISP#jschmidle-xtr\0"
+	"LISP#zilina2-xtr\0"
+	"LISP#dogscafe-xtr\0"
+	"LISP#mgliwka-xtr\0"
+	"LISP#krunal-eu-xtr\0"
+	"LISP#cstephens-xtr-1\0"
+	"LISP#demierre-xtr\0"
+	"LISP#somogyvari-xtr\0"
+	"LISP#spisati-xtr\0"
+	"LISP#tao-networks-xtr\0"
+	"LISP#willekens-xtr\0"
+	"LISP#jclayton-xtr\0"
+	"LISP#niek-xtr\0"
+	"LISP#mbar-xtr\0"
+	"LISP#lsd-xtr\0"
+	"LISP#rfurda-xtr\0"
+	"LISP#gmaricau-xtr\0"
+	"LISP#dzeitler-xtr\0"
+	"LISP#garndt-xtr\0"
+	"LISP#jpreuss-xtr\0"
+	"LISP#smondwurf-xtr\0"
+	"LISP#tbonitz-xtr\0"
+	"LISP#cisco-natal1-xtr\0"
+	"LISP#cglasmeyer-xtr\0"
+	"LISP#rengel-xtr\0"
+	"LISP#hgojny-xtr\0"
+	"LISP#rkohn-xtr\0"
+	"LISP#jpkoegeler-xtr\0"
+	"LISP#gniederwimmer-xtr\0"
+	"LISP#mmikulenas-xtr\0"
+	"LISP#cbretterhofer-xtr\0"
+	"LISP#mgoebel-xtr\0"
+	"LISP#bmorcinkowski-xtr\0"
+	"LISP#jbaumann-xtr\0"
+	"LISP#mfey-xtr\0"
+	"LISP#mmuller-xtr\0"
+	"LISP#rjud-xtr\0"
+	"LISP#theinz-xtr\0"
+	"LISP#fzahn-xtr\0"
+	"LISP#ahugi-xtr\0"
+	"LISP#niekvanderven-xtr\0"
+	"LISP#jdechert-xtr\0"
+	"LISP#crothlander-xtr\0"
+	"LISP#wvanlid-xtr\0"
+	"LISP#upc-oor-xtr\0"
+	"LISP#tivano-software-xtr\0"
+	"LISP#ngunther-xtr\0"
+	"LISP#gthor-xtr\0"
+	"LISP#wonken-xtr\0"
+	"LISP#tzapala-xtr\0"
+	"LISP#rmller-xtr\0"
+	"LISP#feul-xtr\0"
+	"LISP#asunnetci-xtr\0"
+	"LISP#dfett-xtr\0"
+	"LISP#mklingspor-xtr\0"
+	"LISP#gsanjay-xtr\0"
+	"LISP#tkoch-xtr\0"
+	"LISP#hrenz-xtr\0"
+	"LISP#blawall-xtr\0"
+	"LISP#unitbv-xtr\0"
+	"LISP#hketele-xtr\0"
+	"LISP#rdchragner-xtr\0"
+	"LISP#mamin-xtr\0"
+	"LISP#twittenberg-xtr\0"
+	"LISP#bwieder-xtr\0"
+	"LISP#sbethge-xtr\0"
+	"LISP#jdornauf-xtr\0"
+	"LISP#mmiller-xtr\0"
+	"LISP#cfertig-xtr\0"
+	"LISP#jkatolla-xtr\0"
+	"LISP#freenet-xtr\0"
+	"LISP#nweissbach-xtr\0"
+	"LISP#owas-xtr\0"
+	"LISP#rspickers-xtr\0"
+	"LISP#pcech-xtr\0"
+	"LISP#cpalm-xtr\0"
+	"LISP#asellmann-xtr\0"
+	"LISP#mluckert-xtr\0"
+	"LISP#tzimmermann-xtr\0"
+	"LISP#dpeshev-xtr\0"
+	"LISP#lispmon-mn-u-1\0"
+	"LISP#lispmob-mn-u-2\0"
+	"LISP#iij-xtr\0"
+	"LISP#hughes-xtr\0"
+	"LISP#ntt-com-xtr\0"
+	"LISP#kddi-labs-xtr\0"
+	"LISP#tata-xtr\0"
+	"LISP#jiwang-xtr\0"
+	"LISP#layim-xtr\0"
+	"LISP#cfwong-xtr\0"
+	"LISP#logicalis-xtr\0"
+	"LISP#cht-xtr\0"
+	"LISP#oasis-tech-xtr\0"
+	"LISP#mingchow-xtr\0"
+	"LISP#jiwang2-xtr\0"
+	"LISP#fnsc-xtr\0"
+	"LISP#matsumoto-xtr\0"
+	"LISP#vhan-xtr\0"
+	"LISP#alphawest-xtr\0"
+	"LISP#mra4d-xtr\0"
+	"LISP#apan-xtr\0"
+	"LISP#wide-xtr\0"
+	"LISP#nagoya-u-xtr\0"
+	"LISP#yuyarin-xtr\0"
+	"LISP#uet-vnu-xtr\0"
+	"LISP#pccw-xtr\0"
+	"LISP#fitac-xtr\0"
+	"LISP#daniel-xtr-1\0"
+	"LISP#daniel-xtr-2\0"
+	"LISP#daniel-xtr-3\0"
+	"LISP#pgear-xtr\0"
+	"LISP#hongang-xtr\0"
+	"LISP#chaney-xtr\0"
+	"LISP#kozuka-xtr\0"
+	"LISP#nattrav-test-apnic\0"
+	"LISP#ydpark-xtr\0"
+	"LISP#farhadsh-xtr\0"
+	"LISP#hawthorne-xtr\0"
+	"LISP#hyunsoo-xtr\0"
+	"LISP#ykenu-xtr\0"
+	"LISP#gsik-xtr\0"
+	"LISP#yshiin-xtr\0"
+	"LISP#tao-networks2-xtr\0"
+	"LISP#rdines-xtr\0"
+	"LISP#upc-oor2-xtr\0"
+	"LISP#ietf100-xtr\0"
+	"LISP#sukiyaki-proj-xtr\0"
+	"LISP#sukiyaki2-proj-xtr\0"
+	"LISP#gtja-xtr\0"
+	"LISP#hcmus-xtr\0"
+	"LISP#amacuz-xtr\0"
+	"LISP#gs9591-xtr\0"
+	"LISP#layim2-xtr\0"
+	"LISP#ufba-xtr\0"
+	"";
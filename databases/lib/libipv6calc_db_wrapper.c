@@ -12,6 +12,8 @@
 #include <stdlib.h>
 #include <ctype.h>
 #include <errno.h>
+#include <time.h>
+#include <sys/stat.h>
 #include <netinet/in.h>
 
 #include "config.h"
@@ -37,6 +39,7 @@
 #include "ipv6calctypes.h"
 
 #include "libipv6calc.h"
+#include "librfc3056.h"
 
 #ifdef DOMAIN
 // fallback for IP2Location.h < 8.0.0 where "DOMAIN" is defined
@@ -91,20 +94,32 @@ int wrapper_features_selector[IPV6CALC_DB_FEATURE_NUM_MAX + 1][IPV6CALC_DB_PRIO_
 unsigned int wrapper_source_priority_selector[IPV6CALC_DB_SOURCE_MAX + 1];
 int wrapper_source_priority_selector_by_option = -1; // -1: uninitialized, 0: initialized, > 0: touched by option
 
+// hot reload of changed database files (see libipv6calc_db_wrapper_file_state_changed)
+// handles are swapped and the old ones closed without locking: only for single-threaded processes
+int wrapper_reload_interval = 0; // seconds, 0: disabled
+unsigned int libipv6calc_db_wrapper_reload_generation = 0; // incremented on each reload
+
+
+// lazy initialization of database backends (see libipv6calc_db_wrapper_init_lazy)
+static int wrapper_backends_init_pending = 0;
+static char wrapper_backends_init_prefix_string[IPV6CALC_STRING_MAX] = "";
+
+#define LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE() \
+	if (wrapper_backends_init_pending != 0) { \
+		libipv6calc_db_wrapper_init_ensure(); \
+	};
+
+static void libipv6calc_db_wrapper_init_ensure(void);
+
 
 /*
- * function initialise the main wrapper
+ * function initialise the feature/source priority selector of the main wrapper
  *
  * in : (nothing)
- * out: 0=ok, 1=error
+ * out: (nothing)
  */
-int libipv6calc_db_wrapper_init(const char *prefix_string) {
-	int result = 0, f, p, s, j;
-
-#if defined SUPPORT_IP2LOCATION || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2 || SUPPORT_IP2LOCATION2
-	int r;
-#endif
-	s = strlen(prefix_string); // make compiler happy (avoid unused "...")
+static void libipv6calc_db_wrapper_init_priority(void) {
+	int f, p, s, j;
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
@@ -163,6 +178,25 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 	for (j = IPV6CALC_DB_SOURCE_MIN; j <= wrapper_source_priority_selector_by_option; j++) {
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Database priorization/defined by option entry %d: %s", j, libipv6calc_db_wrapper_get_data_source_name_by_number(wrapper_source_priority_selector[j]));
 	};
+};
+
+
+/*
+ * function initialise the database backends of the main wrapper
+ *  (library load, database file probing, feature selection)
+ *
+ * in : prefix_string
+ * out: 0=ok, 1=error
+ */
+static int libipv6calc_db_wrapper_init_backends(const char *prefix_string) {
+	int result = 0, f, p, s;
+
+#if defined SUPPORT_IP2LOCATION || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2 || SUPPORT_IP2LOCATION2
+	int r;
+#endif
+	s = strlen(prefix_string); // make compiler happy (avoid unused "...")
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
 #ifdef SUPPORT_MMDB
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_MMDB_wrapper_init");
@@ -451,6 +485,69 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 };
 
 
+/*
+ * function initialise the main wrapper
+ *
+ * in : prefix_string
+ * out: 0=ok, 1=error
+ */
+int libipv6calc_db_wrapper_init(const char *prefix_string) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+	wrapper_backends_init_pending = 0;
+
+	libipv6calc_db_wrapper_init_priority();
+
+	return(libipv6calc_db_wrapper_init_backends(prefix_string));
+};
+
+
+/*
+ * function initialise the main wrapper, database backends are initialized on first use
+ *  (for one-shot calls which may not require any database at all)
+ *
+ * in : prefix_string
+ * out: 0=ok, 1=error
+ */
+int libipv6calc_db_wrapper_init_lazy(const char *prefix_string) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+	libipv6calc_db_wrapper_init_priority();
+
+	snprintf(wrapper_backends_init_prefix_string, sizeof(wrapper_backends_init_prefix_string), "%s", prefix_string);
+	wrapper_backends_init_pending = 1;
+
+	return(0);
+};
+
+
+/*
+ * function initialise the database backends now in case of pending lazy initialization
+ *  exits on error like the callers of libipv6calc_db_wrapper_init do
+ *
+ * in : (nothing)
+ * out: (nothing)
+ */
+static void libipv6calc_db_wrapper_init_ensure(void) {
+	int r;
+
+	if (wrapper_backends_init_pending == 0) {
+		return;
+	};
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called, run pending backend initialization");
+
+	// clear before calling backends to avoid recursion
+	wrapper_backends_init_pending = 0;
+
+	r = libipv6calc_db_wrapper_init_backends(wrapper_backends_init_prefix_string);
+	if (r != 0) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db_wrapper_init_backends failed, result=%d", r);
+		exit(EXIT_FAILURE);
+	};
+};
+
+
 /*
  * function cleanup the main wrapper
  *
@@ -466,6 +563,12 @@ int libipv6calc_db_wrapper_cleanup(void) {
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	if (wrapper_backends_init_pending != 0) {
+		// backends never used, nothing to cleanup
+		wrapper_backends_init_pending = 0;
+		return(result);
+	};
+
 #ifdef SUPPORT_GEOIP2
 	if (wrapper_GeoIP2_disable == 0) {
 		// Call GeoIP2 wrapper
@@ -530,10 +633,61 @@ int libipv6calc_db_wrapper_cleanup(void) {
 };
 
 
+/* function clear information regarding used databases */
+void libipv6calc_db_wrapper_db_info_used_clear(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+	if (wrapper_backends_init_pending != 0) {
+		// backends not initialized yet, nothing used
+		return;
+	};
+
+#ifdef SUPPORT_GEOIP2
+	if (wrapper_GeoIP2_disable == 0) {
+		libipv6calc_db_wrapper_GeoIP2_wrapper_db_info_used_clear();
+	};
+#endif
+
+#ifdef SUPPORT_IP2LOCATION
+	if (wrapper_IP2Location_disable == 0) {
+		libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used_clear();
+	};
+#endif
+
+#ifdef SUPPORT_IP2LOCATION2
+	if (wrapper_IP2Location2_disable == 0) {
+		libipv6calc_db_wrapper_IP2Location2_wrapper_db_info_used_clear();
+	};
+#endif
+
+#ifdef SUPPORT_DBIP2
+	if (wrapper_DBIP2_disable == 0) {
+		libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used_clear();
+	};
+#endif
+
+#ifdef SUPPORT_EXTERNAL
+	if (wrapper_External_disable == 0) {
+		libipv6calc_db_wrapper_External_wrapper_db_info_used_clear();
+	};
+#endif
+
+#ifdef SUPPORT_BUILTIN
+	if (wrapper_BuiltIn_disable == 0) {
+		libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used_clear();
+	};
+#endif
+
+	return;
+};
+
+
 /* function get info strings */
 void libipv6calc_db_wrapper_info(char *string, const size_t size) {
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	snprintf(string, size, "%s", ""); // default empty
 
 #ifdef SUPPORT_GEOIP2
@@ -592,6 +746,8 @@ void libipv6calc_db_wrapper_features(char *string, const size_t size) {
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_db_features); i++) {
 		if (wrapper_features & ipv6calc_db_features[i].number) {
 			if (strlen(string) == 0) {
@@ -616,6 +772,8 @@ int libipv6calc_db_wrapper_features_support_by_name(const char* feature_name) {
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_db_features); i++) {
 		if (wrapper_features & ipv6calc_db_features[i].number) {
 			if (strcmp(feature_name, ipv6calc_db_features[i].token) == 0) {
@@ -638,6 +796,8 @@ void libipv6calc_db_wrapper_capabilities(char *string, const size_t size) {
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	snprintf(string, size, "%s", ""); // default empty
 
 #ifdef SUPPORT_GEOIP2
@@ -730,6 +890,8 @@ void libipv6calc_db_wrapper_print_features_verbose(const int level_verbose) {
 	char string[IPV6CALC_STRING_MAX] = "";
 #endif
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 #ifdef SUPPORT_MMDB
 #ifdef MMDB_INCLUDE_VERSION
 	fprintf(stderr, "MaxMindDB for GeoIP2/DBIP2/IP2Location2 support enabled, compiled with include file version: %s\n", MMDB_INCLUDE_VERSION);
@@ -878,6 +1040,8 @@ void libipv6calc_db_wrapper_features_help(void) {
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_db_features); i++) {
 		fprintf(stderr, "%-25s%c %s", ipv6calc_db_features[i].token, (wrapper_features & ipv6calc_db_features[i].number) ? 'x' : 'o', ipv6calc_db_features[i].explanation);
 
@@ -977,6 +1141,8 @@ void libipv6calc_db_wrapper_print_db_info(const int level_verbose, const char *p
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with verbose level: %d", level_verbose);
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	fprintf(stderr, "%sDB features: 0x%08x\n\n", prefix_string, wrapper_features);
 
 #ifdef SUPPORT_GEOIP2
@@ -1102,6 +1268,8 @@ int libipv6calc_db_wrapper_has_features(uint32_t features) {
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with feature value to test: 0x%08x", features);
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	if ((wrapper_features & features) == features) {
 		result = 1;
 	} else {
@@ -1114,6 +1282,80 @@ int libipv6calc_db_wrapper_has_features(uint32_t features) {
 };
 
 
+/*********************************************
+ * Hot reload support
+ *********************************************/
+
+/* function store state of database file (after open)
+ * in : filename, state
+ * mod: state
+ */
+void libipv6calc_db_wrapper_file_state_store(const char *filename, s_libipv6calc_db_wrapper_file_state *state) {
+	struct stat st;
+
+	state->checked = time(NULL);
+
+	if ((filename == NULL) || (stat(filename, &st) != 0)) {
+		state->valid = 0;
+		return;
+	};
+
+	state->mtime = st.st_mtime;
+	state->size  = st.st_size;
+	state->ino   = st.st_ino;
+	state->valid = 1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Stored state of database file: %s mtime=%lld size=%lld", filename, (long long) state->mtime, (long long) state->size);
+};
+
+
+/* function check database file for change (at most once per reload interval)
+ * in : filename, state
+ * mod: state (time of last check)
+ * ret: 1 = changed (reload required), 0 = unchanged/disabled/not due
+ */
+int libipv6calc_db_wrapper_file_state_changed(const char *filename, s_libipv6calc_db_wrapper_file_state *state) {
+	struct stat st;
+	time_t now;
+
+	if ((wrapper_reload_interval <= 0) || (filename == NULL) || (state->valid == 0)) {
+		return(0);
+	};
+
+	now = time(NULL);
+
+	if ((now - state->checked) < wrapper_reload_interval) {
+		return(0);
+	};
+
+	state->checked = now;
+
+	if (stat(filename, &st) != 0) {
+		// file temporary not available (e.g. update in progress), keep current one
+		return(0);
+	};
+
+	if ((st.st_mtime == state->mtime) && (st.st_size == state->size) && (st.st_ino == state->ino)) {
+		return(0);
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Database file changed: %s mtime=%lld->%lld size=%lld->%lld", filename, (long long) state->mtime, (long long) st.st_mtime, (long long) state->size, (long long) st.st_size);
+
+	return(1);
+};
+
+
+/* function called by backends after swapping in a reloaded database
+ * in : filename, state
+ */
+void libipv6calc_db_wrapper_reloaded(const char *filename, s_libipv6calc_db_wrapper_file_state *state) {
+	libipv6calc_db_wrapper_file_state_store(filename, state);
+	LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION_INC();
+
+	NONQUIETPRINT_WA("Database reloaded: %s", filename);
+};
+
+
 /*********************************************
  * Option handling
  * return < 0: error
@@ -1381,6 +1623,16 @@ int libipv6calc_db_wrapper_options(const int opt, const char *optarg, const stru
 			result = 0;
 			break;
 
+		case DB_common_reload_interval:
+			if ((atoi(optarg) >= 0) && (atoi(optarg) <= 86400)) {
+				wrapper_reload_interval = atoi(optarg);
+			} else {
+				fprintf(stderr, " Argument of option 'db-reload-interval' is out of range (0-86400): %d\n", atoi(optarg));
+				exit(EXIT_FAILURE);
+			};
+			result = 0;
+			break;
+
 		case DB_common_priorization:
 #if defined SUPPORT_EXTERNAL || SUPPORT_IP2LOCATION || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2 || SUPPORT_IP2LOCATION2
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Parse database priorization string: %s", optarg);
@@ -1501,6 +1753,8 @@ void libipv6calc_db_wrapper_geolocation_record_clear(libipv6calc_db_wrapper_geol
  */
 int libipv6calc_db_wrapper_registry_num_by_as_num32(const uint32_t as_num32) {
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with as_num32: %d", as_num32);
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
 #ifdef SUPPORT_BUILTIN
 	// currently only supported by BuiltIn
 	return(libipv6calc_db_wrapper_BuiltIn_registry_num_by_as_num32(as_num32));
@@ -1515,6 +1769,8 @@ int libipv6calc_db_wrapper_registry_num_by_as_num32(const uint32_t as_num32) {
  */
 int libipv6calc_db_wrapper_registry_num_by_cc_index(const uint16_t cc_index) {
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with cc_index: %d", cc_index);
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
 #ifdef SUPPORT_BUILTIN
 	// currently only supported by BuiltIn
 	return(libipv6calc_db_wrapper_BuiltIn_registry_num_by_cc_index(cc_index));
@@ -1578,6 +1834,8 @@ int libipv6calc_db_wrapper_country_code_by_addr(char *string, const int length,
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	if (string == NULL) {
 		ERRORPRINT_NA("given pointer 'string' is NULL (FIX CODE)");
 		exit(EXIT_FAILURE);
@@ -1736,14 +1994,45 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/*
+ * get CountryCode in special internal form (index) [A-Z] (26) x [0-9A-Z] (36) by the 2 chars of a country code
+ * in : c1, c2
+ * out: cc_index (COUNTRYCODE_INDEX_UNKNOWN in case of not a valid country code)
+ */
+uint16_t libipv6calc_db_wrapper_cc_index_by_chars(const char c1, const char c2) {
+	uint16_t i1, i2;
+
+	if ((c1 >= 'A') && (c1 <= 'Z')) {
+		i1 = c1 - 'A';
+	} else if ((c1 >= 'a') && (c1 <= 'z')) {
+		i1 = c1 - 'a';
+	} else {
+		return(COUNTRYCODE_INDEX_UNKNOWN);
+	};
+
+	if ((c2 >= '0') && (c2 <= '9')) {
+		i2 = c2 - '0';
+	} else if ((c2 >= 'A') && (c2 <= 'Z')) {
+		i2 = c2 - 'A' + 10;
+	} else if ((c2 >= 'a') && (c2 <= 'z')) {
+		i2 = c2 - 'a' + 10;
+	} else {
+		return(COUNTRYCODE_INDEX_UNKNOWN);
+	};
+
+	// max: 25 + 35 * 26 = 935 < COUNTRYCODE_INDEX_MAX
+	return(i1 + i2 * COUNTRYCODE_LETTER1_MAX);
+};
+
+
 /*
  * get CountryCode in special internal form (index) [A-Z] (26) x [0-9A-Z] (36)
+ *  backends return the index directly from their native data, no text round-trip
  */
 uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
 	uint16_t index = COUNTRYCODE_INDEX_UNKNOWN;
-	char cc_text[256] = "";
-	uint8_t c1, c2;
-	int r;
+	unsigned int data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
+	int f = 0, p;
 
 	int cache_hit = 0;
 
@@ -1751,9 +2040,20 @@ uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp,
 	static uint16_t cc_index_lastused;
 	static unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
 	static int ipaddr_cache_lastused_valid = 0;
+	static unsigned int ipaddr_cache_lastused_generation = 0;
+	unsigned int generation;
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto);
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
+	generation = LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION();
+	if (ipaddr_cache_lastused_generation != generation) {
+		// database reloaded in the meantime
+		ipaddr_cache_lastused_valid = 0;
+		ipaddr_cache_lastused_generation = generation;
+	};
+
 	if ((ipaddr_cache_lastused_valid == 1)
 	    &&	(ipaddr_cache_lastused.proto == ipaddrp->proto)
 	    && 	(ipaddr_cache_lastused.addr[0] == ipaddrp->addr[0])
@@ -1770,58 +2070,123 @@ uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp,
 
 		cache_hit = 1;
 		goto END_libipv6calc_db_wrapper_cached;
-	} else {
-		// retrieve always data_source for caching
-		r = libipv6calc_db_wrapper_country_code_by_addr(cc_text, sizeof(cc_text), ipaddrp, &data_source_lastused);
-		if (r != 0) {
-			goto END_libipv6calc_db_wrapper_cached; // something wrong
+	};
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		f = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_CC;
+		if ((ipaddrp->typeinfo1 & IPV4_ADDR_RESERVED) != 0) {
+			// reserved IPv4 address has no country
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Given IPv4 address: %08x is reserved (skip CountryCode lookup)", (unsigned int) ipaddrp->addr[0]);
+			goto END_libipv6calc_db_wrapper_cached;
+		};
+	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
+		f = IPV6CALC_DB_FEATURE_NUM_IPV6_TO_CC;
+		if ((ipaddrp->typeinfo1 & IPV6_ADDR_RESERVED) != 0) {
+			// reserved IPv6 address has no country
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Given IPv6 address prefix (0-63): %08x%08x is reserved (skip CountryCode lookup)", (unsigned int) ipaddrp->addr[0], (unsigned int) ipaddrp->addr[1]);
+			goto END_libipv6calc_db_wrapper_cached;
 		};
+	} else {
+		ERRORPRINT_WA("unsupported proto=%d (FIX CODE)", ipaddrp->proto);
+		exit(EXIT_FAILURE);
+	};
 
-		if (strlen(cc_text) == 2) {
-			if (isalpha((int) cc_text[0]) && isalnum((int) cc_text[1])) {
-				c1 = toupper(cc_text[0]);
-				if (! (c1 >= 'A' && c1 <= 'Z')) {
-					goto END_libipv6calc_db_wrapper_cached; // something wrong
-				};
-				c1 -= 'A';
-
-				c2 = toupper(cc_text[1]);
-				if (c2 >= '0' && c2 <= '9') {
-					c2 -= '0';
-				} else if (c2 >= 'A' && c2 <= 'Z') {
-					c2 -= 'A';
-					c2 += 10;
-				} else {
-					goto END_libipv6calc_db_wrapper_cached; // something wrong
+	// run through priorities
+	for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+		switch(wrapper_features_selector[f][p]) {
+		    case 0:
+			// last
+			goto END_libipv6calc_db_wrapper_lookup;
+			break;
+
+		    case IPV6CALC_DB_SOURCE_GEOIP2:
+#ifdef SUPPORT_GEOIP2
+			if (wrapper_GeoIP2_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now GeoIP(MaxMindDB)");
+				index = libipv6calc_db_wrapper_GeoIP2_wrapper_cc_index_by_addr(ipaddrp);
+				if (index != COUNTRYCODE_INDEX_UNKNOWN) {
+					data_source = IPV6CALC_DB_SOURCE_GEOIP2;
+					goto END_libipv6calc_db_wrapper_lookup; // ok
 				};
+			};
+#endif
+			break;
 
-				index = c1 + c2 * COUNTRYCODE_LETTER1_MAX;
+		    case IPV6CALC_DB_SOURCE_IP2LOCATION:
+#ifdef SUPPORT_IP2LOCATION
+			if (wrapper_IP2Location_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now IP2Location(BIN)");
+				index = libipv6calc_db_wrapper_IP2Location_wrapper_cc_index_by_addr(ipaddrp);
+				if (index != COUNTRYCODE_INDEX_UNKNOWN) {
+					data_source = IPV6CALC_DB_SOURCE_IP2LOCATION;
+					goto END_libipv6calc_db_wrapper_lookup; // ok
+				};
+			};
+#endif
+			break;
 
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "c1=%d c2=%d index=%d (0x%03x) -> test: %c%c", c1, c2, index, index, COUNTRYCODE_INDEX_TO_CHAR1(index), COUNTRYCODE_INDEX_TO_CHAR2(index));
+		    case IPV6CALC_DB_SOURCE_IP2LOCATION2:
+#ifdef SUPPORT_IP2LOCATION2
+			if (wrapper_IP2Location2_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now IP2Location(MaxMindDB)");
+				index = libipv6calc_db_wrapper_IP2Location2_wrapper_cc_index_by_addr(ipaddrp);
+				if (index != COUNTRYCODE_INDEX_UNKNOWN) {
+					data_source = IPV6CALC_DB_SOURCE_IP2LOCATION2;
+					goto END_libipv6calc_db_wrapper_lookup; // ok
+				};
+			};
+#endif
+			break;
 
-				if (index >= COUNTRYCODE_INDEX_MAX) {
-					index = COUNTRYCODE_INDEX_UNKNOWN; // failsafe
-					ERRORPRINT_WA("unexpected index (too high): %d", index);
-					goto END_libipv6calc_db_wrapper_cached; // something wrong
+		    case IPV6CALC_DB_SOURCE_DBIP2:
+#ifdef SUPPORT_DBIP2
+			if (wrapper_DBIP2_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now db-ip.com(MaxMindDB)");
+				index = libipv6calc_db_wrapper_DBIP2_wrapper_cc_index_by_addr(ipaddrp);
+				if (index != COUNTRYCODE_INDEX_UNKNOWN) {
+					data_source = IPV6CALC_DB_SOURCE_DBIP2;
+					goto END_libipv6calc_db_wrapper_lookup; // ok
 				};
 			};
-		} else {
-			ERRORPRINT_WA("returned cc_text has not 2 chars: %s (addr=%08x%08x%08x%08x)", cc_text, ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3]);
-			goto END_libipv6calc_db_wrapper_cached; // something wrong
-		};
+#endif
+			break;
 
-		// store in last used cache
-		ipaddr_cache_lastused_valid = 1;
-		cc_index_lastused = index;
-		ipaddr_cache_lastused = *ipaddrp;
+		    case IPV6CALC_DB_SOURCE_EXTERNAL:
+#ifdef SUPPORT_EXTERNAL
+			if (wrapper_External_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now External");
+				index = libipv6calc_db_wrapper_External_cc_index_by_addr(ipaddrp);
+				if (index != COUNTRYCODE_INDEX_UNKNOWN) {
+					data_source = IPV6CALC_DB_SOURCE_EXTERNAL;
+					goto END_libipv6calc_db_wrapper_lookup; // ok
+				};
+			};
+#endif
+			break;
 
-		// set only data_source from cache if caller request it
-		if (data_source_ptr != NULL) {
-			*data_source_ptr = data_source_lastused;
+		    default:
+			goto END_libipv6calc_db_wrapper_lookup; // dummy goto in case no db is enabled
+			break;
 		};
 	};
 
-END_libipv6calc_db_wrapper_cached:
+END_libipv6calc_db_wrapper_lookup:
+	if (index == COUNTRYCODE_INDEX_UNKNOWN) {
+		goto END_libipv6calc_db_wrapper_cached; // no result
+	};
+
+	// store in last used cache
+	ipaddr_cache_lastused_valid = 1;
+	cc_index_lastused = index;
+	data_source_lastused = data_source;
+	ipaddr_cache_lastused = *ipaddrp;
+
+	// set only data_source if caller request it
+	if (data_source_ptr != NULL) {
+		*data_source_ptr = data_source;
+	};
+
+END_libipv6calc_db_wrapper_cached:
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x%08x%08x%08x cc_index=%d (0x%03x) %c%c%s", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], index, index, COUNTRYCODE_INDEX_TO_CHAR1(index), COUNTRYCODE_INDEX_TO_CHAR2(index), (cache_hit == 1 ? " (cached)" : ""));
 
 	return(index);
@@ -1856,38 +2221,13 @@ int libipv6calc_db_wrapper_country_code_by_cc_index(char *string, const int leng
  */
 uint16_t libipv6calc_db_wrapper_cc_index_by_country_code(const char *cc_text) {
 	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
-	uint8_t c1, c2;
-
-	if (strlen(cc_text) == 2) {
-		if (isalpha((int) cc_text[0]) && isalnum((int) cc_text[1])) {
-			c1 = toupper(cc_text[0]);
-			if (! (c1 >= 'A' && c1 <= 'Z')) {
-				goto END_libipv6calc_db_wrapper; // something wrong
-			};
-			c1 -= 'A';
-
-			c2 = toupper(cc_text[1]);
-			if (c2 >= '0' && c2 <= '9') {
-				c2 -= '0';
-			} else if (c2 >= 'A' && c2 <= 'Z') {
-				c2 -= 'A';
-				c2 += 10;
-			} else {
-				goto END_libipv6calc_db_wrapper; // something wrong
-			};
 
-			cc_index = c1 + c2 * COUNTRYCODE_LETTER1_MAX;
+	if ((cc_text[0] != '\0') && (cc_text[1] != '\0') && (cc_text[2] == '\0')) {
+		cc_index = libipv6calc_db_wrapper_cc_index_by_chars(cc_text[0], cc_text[1]);
 
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "cc_text=%s cc_index=%d (0x%03x) -> test: %c%c", cc_text, cc_index, cc_index, COUNTRYCODE_INDEX_TO_CHAR1(cc_index), COUNTRYCODE_INDEX_TO_CHAR2(cc_index));
-
-			if (cc_index >= COUNTRYCODE_INDEX_MAX) {
-				cc_index = COUNTRYCODE_INDEX_UNKNOWN; // failsafe
-				goto END_libipv6calc_db_wrapper; // something wrong
-			};
-		};
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "cc_text=%s cc_index=%d (0x%03x) -> test: %c%c", cc_text, cc_index, cc_index, COUNTRYCODE_INDEX_TO_CHAR1(cc_index), COUNTRYCODE_INDEX_TO_CHAR2(cc_index));
 	};
 
-END_libipv6calc_db_wrapper:
 	return (cc_index);
 };
 
@@ -1911,9 +2251,20 @@ uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp,
 	static uint32_t as_num32_lastused;
 	static unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
 	static int ipaddr_cache_lastused_valid = 0;
+	static unsigned int ipaddr_cache_lastused_generation = 0;
+	unsigned int generation;
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto);
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
+	generation = LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION();
+	if (ipaddr_cache_lastused_generation != generation) {
+		// database reloaded in the meantime
+		ipaddr_cache_lastused_valid = 0;
+		ipaddr_cache_lastused_generation = generation;
+	};
+
 	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
 		f = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_AS;
 		if ((ipaddrp->typeinfo1 & IPV4_ADDR_RESERVED) != 0) {
@@ -2132,9 +2483,20 @@ uint32_t libipv6calc_db_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp
 	static int GeonameID_type_lastused;
 	static unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
 	static int ipaddr_cache_lastused_valid = 0;
+	static unsigned int ipaddr_cache_lastused_generation = 0;
+	unsigned int generation;
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto);
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
+	generation = LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION();
+	if (ipaddr_cache_lastused_generation != generation) {
+		// database reloaded in the meantime
+		ipaddr_cache_lastused_valid = 0;
+		ipaddr_cache_lastused_generation = generation;
+	};
+
 	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
 		f = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_GEONAMEID;
 		if ((ipaddrp->typeinfo1 & IPV4_ADDR_RESERVED) != 0) {
@@ -2280,6 +2642,8 @@ int libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(char *resultstring, con
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with mp=%p", macaddrp); // avoid -Werror=unused-parameter
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 #ifdef SUPPORT_BUILTIN
 	retval = libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_by_macaddr(resultstring, resultstring_length, macaddrp);
 #else
@@ -2301,6 +2665,8 @@ int libipv6calc_db_wrapper_ieee_vendor_string_short_by_macaddr(char *resultstrin
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with mp=%p", macaddrp); // avoid -Werror=unused-parameter
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 #ifdef SUPPORT_BUILTIN
 	retval = libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(resultstring, resultstring_length, macaddrp);
 #else
@@ -2318,7 +2684,7 @@ int libipv6calc_db_wrapper_ieee_vendor_string_short_by_macaddr(char *resultstrin
 static const char *libipv6calc_db_wrapper_reserved_string_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp) {
 	const char *info = NULL;
 
-	uint32_t ipv4 = ipv4addr_getdword(ipv4addrp);
+	uint32_t ipv4 = ipv4addr_getdword_unchecked(ipv4addrp);
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Given IPv4 address: %08x", (unsigned int) ipv4);
 
@@ -2391,12 +2757,12 @@ static const char *libipv6calc_db_wrapper_reserved_string_by_ipv4addr(const ipv6
 static const char *libipv6calc_db_wrapper_reserved_string_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp) {
 	const char *info = NULL;
 
-	uint32_t ipv6_00_31 = ipv6addr_getdword(ipv6addrp, 0);
-	uint32_t ipv6_32_63 = ipv6addr_getdword(ipv6addrp, 1);
-	uint32_t ipv6_64_95 = ipv6addr_getdword(ipv6addrp, 2);
-	uint32_t ipv6_96_127 = ipv6addr_getdword(ipv6addrp, 3);
+	uint32_t ipv6_00_31 = ipv6addr_getdword_unchecked(ipv6addrp, 0);
+	uint32_t ipv6_32_63 = ipv6addr_getdword_unchecked(ipv6addrp, 1);
+	uint32_t ipv6_64_95 = ipv6addr_getdword_unchecked(ipv6addrp, 2);
+	uint32_t ipv6_96_127 = ipv6addr_getdword_unchecked(ipv6addrp, 3);
 	
-	uint16_t ipv6_00_15 = ipv6addr_getword(ipv6addrp, 0);
+	uint16_t ipv6_00_15 = ipv6addr_getword_unchecked(ipv6addrp, 0);
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x"
 		, (unsigned int) ipv6_00_31
@@ -2475,6 +2841,8 @@ int libipv6calc_db_wrapper_registry_string_by_ipv4addr(const ipv6calc_ipv4addr *
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	const char *info = libipv6calc_db_wrapper_reserved_string_by_ipv4addr(ipv4addrp);
 
 	if (info != NULL) {
@@ -2514,7 +2882,9 @@ int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv
 	ipv6calc_ipaddr ipaddr;
 #endif
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x", ipv4addr_getdword(ipv4addrp));
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x", ipv4addr_getdword_unchecked(ipv4addrp));
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
 
 	if ((cache_lu_ipv4addr_valid == 1)
 	    &&  (&cache_lu_ipv4addr.in_addr.s_addr == &ipv4addrp->in_addr.s_addr)
@@ -2575,7 +2945,7 @@ END_libipv6calc_db_wrapper:
 
 END_libipv6calc_db_wrapper_cached:
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x reg=%d%s"
-		, ipv4addr_getdword(ipv4addrp)
+		, ipv4addr_getdword_unchecked(ipv4addrp)
 		, retval
 		, (cache_hit == 1 ? " (cached)" : "")
 	);
@@ -2596,6 +2966,8 @@ int libipv6calc_db_wrapper_registry_string_by_ipv6addr(const ipv6calc_ipv6addr *
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
 	const char *info = libipv6calc_db_wrapper_reserved_string_by_ipv6addr(ipv6addrp);
 
 	if (info != NULL) {
@@ -2636,7 +3008,9 @@ int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv
 	ipv6calc_ipaddr ipaddr;
 #endif
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3));
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x", ipv6addr_getdword_unchecked(ipv6addrp, 0), ipv6addr_getdword_unchecked(ipv6addrp, 1), ipv6addr_getdword_unchecked(ipv6addrp, 2), ipv6addr_getdword_unchecked(ipv6addrp, 3));
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
 
 	if ((cache_lu_ipv6addr_valid == 1)
 #ifdef __KAME__ // FreeBSD misses s6_addr8/16/32 in non-kernel include, also union has different name in glibc (__in6_u vs.  __u6_addr) :-(
@@ -2663,7 +3037,7 @@ int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	if (ipv6addr_getword(ipv6addrp, 0) == 0x3ffe) {
+	if (ipv6addr_getword_unchecked(ipv6addrp, 0) == 0x3ffe) {
 		// special handling of 6BONE
 		retval = REGISTRY_6BONE;
 		goto END_libipv6calc_db_wrapper;
@@ -2713,10 +3087,10 @@ END_libipv6calc_db_wrapper:
 
 END_libipv6calc_db_wrapper_cached:
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x%08x%08x%08x reg=%d%s"
-		, ipv6addr_getdword(ipv6addrp, 0)
-		, ipv6addr_getdword(ipv6addrp, 1)
-		, ipv6addr_getdword(ipv6addrp, 2)
-		, ipv6addr_getdword(ipv6addrp, 3)
+		, ipv6addr_getdword_unchecked(ipv6addrp, 0)
+		, ipv6addr_getdword_unchecked(ipv6addrp, 1)
+		, ipv6addr_getdword_unchecked(ipv6addrp, 2)
+		, ipv6addr_getdword_unchecked(ipv6addrp, 3)
 		, retval
 		, (cache_hit == 1 ? " (cached)" : "")
 	);
@@ -2738,7 +3112,9 @@ int libipv6calc_db_wrapper_info_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp,
 	ipv6calc_ipaddr ipaddr;
 #endif
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x typeinfo=%08x", ipv4addr_getdword(ipv4addrp), ipv4addrp->typeinfo);
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x typeinfo=%08x", ipv4addr_getdword_unchecked(ipv4addrp), ipv4addrp->typeinfo);
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
 
 	if ((ipv4addrp->typeinfo & IPV4_ADDR_GLOBAL) == 0) {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "IPv4 address is not global, skip further database calls");
@@ -2804,7 +3180,9 @@ int libipv6calc_db_wrapper_info_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp,
 	ipv6calc_ipaddr ipaddr;
 #endif
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x typeinfo=%08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3), ipv6addrp->typeinfo);
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x typeinfo=%08x", ipv6addr_getdword_unchecked(ipv6addrp, 0), ipv6addr_getdword_unchecked(ipv6addrp, 1), ipv6addr_getdword_unchecked(ipv6addrp, 2), ipv6addr_getdword_unchecked(ipv6addrp, 3), ipv6addrp->typeinfo);
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
 
 	if ((ipv6addrp->typeinfo & IPV6_ADDR_GLOBAL) == 0) {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "IPv6 address not global, skip further database calls");
@@ -3462,7 +3840,6 @@ long int libipv6calc_db_wrapper_get_entry_generic(
 /*********** generic function **********************/
 uint16_t libipv6calc_db_cc_to_index(const char *cc_text) {
 	uint16_t index = COUNTRYCODE_INDEX_UNKNOWN;
-	uint8_t c1, c2;
 
 	if (cc_text == NULL) {
 		ERRORPRINT_NA("input is NULL");
@@ -3474,37 +3851,14 @@ uint16_t libipv6calc_db_cc_to_index(const char *cc_text) {
 		goto END_libipv6calc_db_cc_to_index; // something wrong
 	};
 
-	if ((! isalpha((int) cc_text[0])) || (! isalnum((int) cc_text[1]))) {
-		ERRORPRINT_WA("input is not valid country code: %s", cc_text);
-		goto END_libipv6calc_db_cc_to_index; // something wrong
-	};
+	index = libipv6calc_db_wrapper_cc_index_by_chars(cc_text[0], cc_text[1]);
 
-	c1 = toupper(cc_text[0]);
-	if (! (c1 >= 'A' && c1 <= 'Z')) {
-		ERRORPRINT_WA("input char 1 is not part of a valid country code: %s", cc_text);
-		goto END_libipv6calc_db_cc_to_index; // something wrong
-	};
-	c1 -= 'A';
-
-	c2 = toupper(cc_text[1]);
-	if (c2 >= '0' && c2 <= '9') {
-		c2 -= '0';
-	} else if (c2 >= 'A' && c2 <= 'Z') {
-		c2 -= 'A';
-		c2 += 10;
-	} else {
-		ERRORPRINT_WA("input char 2 is not part of a valid country code: %s", cc_text);
+	if (index == COUNTRYCODE_INDEX_UNKNOWN) {
+		ERRORPRINT_WA("input is not valid country code: %s", cc_text);
 		goto END_libipv6calc_db_cc_to_index; // something wrong
 	};
 
-	index = c1 + c2 * COUNTRYCODE_LETTER1_MAX;
-
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "c1=%d c2=%d index=%d (0x%03x) -> test: %c%c", c1, c2, index, index, COUNTRYCODE_INDEX_TO_CHAR1(index), COUNTRYCODE_INDEX_TO_CHAR2(index));
-
-	if (index >= COUNTRYCODE_INDEX_MAX) {
-		index = COUNTRYCODE_INDEX_UNKNOWN; // failsafe
-		ERRORPRINT_WA("unexpected index (too high): %d", index);
-	};
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "index=%d (0x%03x) -> test: %c%c", index, index, COUNTRYCODE_INDEX_TO_CHAR1(index), COUNTRYCODE_INDEX_TO_CHAR2(index));
 
 END_libipv6calc_db_cc_to_index:
 	return(index);
@@ -4110,14 +4464,601 @@ int libipv6calc_db_registry_filter(const uint32_t registry, const s_ipv6calc_fil
 
 
 /*
- * dump database
+ * database dump: name of set (CountryCode placeholder replaced)
  *
- * in : selector
+ * in : dump, set index (= CountryCode index in case of placeholder)
+ * out: name
  */
-int libipv6calc_db_dump(const int source, const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_ipset) {
-	int retval;
+static void libipv6calc_db_dump_set_name(const s_ipv6calc_db_dump *dump, const int set, char *name, const size_t name_length) {
+	char cc2[IPV6CALC_COUNTRYCODE_STRING_MAX];
+	const char *cptr;
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "called with source=%d selector=%d", source, selector);
+	if (dump->flag_set_cc == 0) {
+		snprintf(name, name_length, "%s", dump->name_set);
+		return;
+	};
+
+	libipv6calc_db_wrapper_country_code_by_cc_index(cc2, sizeof(cc2), (uint16_t) set);
+
+	cptr = strstr(dump->name_set, IPV6CALC_DB_DUMP_SET_CC);
+	snprintf(name, name_length, "%.*s%s%s", (int) (cptr - dump->name_set), dump->name_set, cc2, cptr + strlen(IPV6CALC_DB_DUMP_SET_CC));
+};
+
+
+/*
+ * database dump: print one prefix
+ *
+ * in : dump, set index, first address, prefix length, separator flag (nftables element list)
+ */
+static void libipv6calc_db_dump_print_prefix(s_ipv6calc_db_dump *dump, const int set, const uint64_t first, const int prefixlength, const int flag_separator) {
+	char tempstring[IPV6CALC_STRING_MAX];
+	char name[IPV6CALC_STRING_MAX];
+	ipv6calc_ipaddr ipaddr, ipaddr2;
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipv4addr ipv4addr;
+
+	libipaddr_clearall(&ipaddr);
+
+	if (dump->selector == IPV6CALC_PROTO_IPV4) {
+		ipaddr.proto = IPV6CALC_PROTO_IPV4;
+		ipaddr.addr[0] = (uint32_t) first;
+	} else {
+		ipaddr.proto = IPV6CALC_PROTO_IPV6;
+		ipaddr.addr[0] = (uint32_t) (first >> 32);
+		ipaddr.addr[1] = (uint32_t) (first & 0xffffffff);
+	};
+
+	ipaddr.prefixlength = (uint8_t) prefixlength;
+	ipaddr.flag_valid = 1;
+	ipaddr.flag_prefixuse = 1;
+
+	if ((dump->selector == IPV6CALC_PROTO_IPV4) && (dump->outputtype == FORMAT_ipv6to4)) {
+		CONVERT_IPADDR_IPV4ADDR(ipaddr, ipv4addr);
+		librfc3056_ipv4addr_to_ipv6to4addr(&ipv6addr, &ipv4addr);
+		CONVERT_IPV6ADDR_IPADDR(ipv6addr, ipaddr2);
+		libipaddr_ipaddrstruct_to_string(&ipaddr2, tempstring, sizeof(tempstring), dump->formatoptions);
+	} else {
+		libipaddr_ipaddrstruct_to_string(&ipaddr, tempstring, sizeof(tempstring), dump->formatoptions);
+	};
+
+	if ((dump->formatoptions & FORMATOPTION_print_nftables) != 0) {
+		fprintf(stdout, "%s\t%s", (flag_separator == 1) ? ",\n" : "", tempstring);
+	} else if ((dump->formatoptions & FORMATOPTION_print_ipset) != 0) {
+		libipv6calc_db_dump_set_name(dump, set, name, sizeof(name));
+		fprintf(stdout, "add %s %s\n", name, tempstring);
+	} else {
+		fprintf(stdout, "%s\n", tempstring);
+	};
+
+	dump->count++;
+};
+
+
+/*
+ * database dump: print minimal CIDR cover of a range
+ *
+ * in : dump, set index, range, separator flag (nftables element list)
+ */
+static void libipv6calc_db_dump_print_range(s_ipv6calc_db_dump *dump, const int set, uint64_t first, const uint64_t last, int flag_separator) {
+	int size;
+	uint64_t span;
+
+	while (1) {
+		// largest block aligned to first
+		for (size = 0; (size < dump->bits) && (((first >> size) & 1) == 0); size++);
+
+		// shrink block until inside range
+		while (1) {
+			span = (size == 64) ? UINT64_MAX : ((((uint64_t) 1) << size) - 1);
+			if ((last - first) >= span) {
+				break;
+			};
+			size--;
+		};
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "set=%d first=%016llx last=%016llx prefixlength=%d", set, (unsigned long long) first, (unsigned long long) last, dump->bits - size);
+
+		libipv6calc_db_dump_print_prefix(dump, set, first, dump->bits - size, flag_separator);
+		flag_separator = 1;
+
+		if ((last - first) == span) {
+			// all covered, finished
+			break;
+		};
+
+		first += span + 1;
+	};
+};
+
+
+/*
+ * database dump: print set header
+ *
+ * in : dump, set index
+ */
+static void libipv6calc_db_dump_print_header(s_ipv6calc_db_dump *dump, const int set) {
+	char name[IPV6CALC_STRING_MAX];
+	int family6;
+
+	// family inet : IPv4
+	// family inet6: IPv6 and IPv4 converted by 6to4
+	family6 = ((dump->selector == IPV6CALC_PROTO_IPV6) || (dump->outputtype == FORMAT_ipv6to4)) ? 1 : 0;
+
+	libipv6calc_db_dump_set_name(dump, set, name, sizeof(name));
+
+	if ((dump->formatoptions & FORMATOPTION_print_nftables) != 0) {
+		// create but don't care if already existing, intervals require non-overlapping elements
+		fprintf(stdout, "add set %s %s { type %s; flags interval; }\n", dump->nft_table, name, (family6 == 1) ? "ipv6_addr" : "ipv4_addr");
+		fprintf(stdout, "flush set %s %s\n", dump->nft_table, name);
+	} else if ((dump->formatoptions & FORMATOPTION_print_ipset) != 0) {
+		// create but don't care if already existing
+		fprintf(stdout, "create %s hash:net family %s counters -exist\n", name, (family6 == 1) ? "inet6" : "inet");
+		fprintf(stdout, "flush %s\n", name);
+	};
+
+	dump->sets[set].flag_header = 1;
+};
+
+
+/*
+ * database dump: emit range (print or collect)
+ *
+ * in : dump, set index, range
+ * ret: ==0: ok, !=0: error
+ */
+static int libipv6calc_db_dump_emit(s_ipv6calc_db_dump *dump, const int set, const uint64_t first, const uint64_t last) {
+	s_ipv6calc_db_dump_set *setp = &dump->sets[set];
+	s_ipv6calc_db_dump_range *ranges;
+
+	if ((dump->formatoptions & FORMATOPTION_print_nftables) != 0) {
+		// collect, elements are printed per set on close
+		if (setp->ranges_used == setp->ranges_size) {
+			ranges = realloc(setp->ranges, sizeof(s_ipv6calc_db_dump_range) * ((setp->ranges_size == 0) ? 1024 : setp->ranges_size * 2));
+			if (ranges == NULL) {
+				ERRORPRINT_NA("can't allocate memory for database dump");
+				return (1);
+			};
+			setp->ranges = ranges;
+			setp->ranges_size = (setp->ranges_size == 0) ? 1024 : setp->ranges_size * 2;
+		};
+		setp->ranges[setp->ranges_used].first = first;
+		setp->ranges[setp->ranges_used].last = last;
+		setp->ranges_used++;
+		return (0);
+	};
+
+	if (setp->flag_header == 0) {
+		libipv6calc_db_dump_print_header(dump, set);
+	};
+
+	libipv6calc_db_dump_print_range(dump, set, first, last, 0);
+	return (0);
+};
+
+
+/*
+ * database dump: initialize output
+ *
+ * in : selector, outputtype, formatoptions, name of set (ipset/nftables), dump options
+ * out: dump
+ * ret: ==0: ok, !=0: error
+ */
+int libipv6calc_db_dump_open(s_ipv6calc_db_dump *dump, const int selector, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options) {
+	const char *cptr;
+
+	memset(dump, 0, sizeof(s_ipv6calc_db_dump));
+
+	dump->selector = selector;
+	dump->outputtype = outputtype;
+	dump->formatoptions = formatoptions;
+	dump->dump_options = dump_options;
+	dump->bits = (selector == IPV6CALC_PROTO_IPV4) ? 32 : 64;
+
+	if ((formatoptions & (FORMATOPTION_print_ipset | FORMATOPTION_print_nftables)) != 0) {
+		if ((formatoptions & FORMATOPTION_print_ipset) && (formatoptions & FORMATOPTION_print_nftables)) {
+			ERRORPRINT_NA("Format 'print-ipset' and 'print-nftables' can't be combined");
+			return (1);
+		};
+
+		if ((name_set == NULL) || (strlen(name_set) == 0)) {
+			ERRORPRINT_NA("Format 'print-ipset|print-nftables <name>' selected but no name provided");
+			return (1);
+		};
+
+		if ((formatoptions & FORMATOPTION_print_nftables) != 0) {
+			// optional "<family> <table> " before set name
+			cptr = strrchr(name_set, ' ');
+			if (cptr != NULL) {
+				snprintf(dump->nft_table, sizeof(dump->nft_table), "%.*s", (int) (cptr - name_set), name_set);
+				name_set = cptr + 1;
+			} else {
+				snprintf(dump->nft_table, sizeof(dump->nft_table), "%s", "inet filter");
+			};
+
+			// nftables interval sets don't accept overlapping elements
+			dump->dump_options |= IPV6CALC_DB_DUMP_AGGREGATE;
+		};
+
+		snprintf(dump->name_set, sizeof(dump->name_set), "%s", name_set);
+
+		if (strstr(dump->name_set, IPV6CALC_DB_DUMP_SET_CC) != NULL) {
+			dump->flag_set_cc = 1;
+		};
+	};
+
+	dump->sets_max = (dump->flag_set_cc == 1) ? (COUNTRYCODE_INDEX_MAX + 1) : 1;
+	dump->sets = calloc((size_t) dump->sets_max, sizeof(s_ipv6calc_db_dump_set));
+	if (dump->sets == NULL) {
+		ERRORPRINT_NA("can't allocate memory for database dump");
+		return (1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "dump opened selector=%d name_set=%s set_cc=%d dump_options=0x%08x", selector, dump->name_set, dump->flag_set_cc, dump->dump_options);
+
+	if ((formatoptions & FORMATOPTION_print_nftables) != 0) {
+		// create but don't care if already existing
+		fprintf(stdout, "add table %s\n", dump->nft_table);
+	};
+
+	if ((dump->flag_set_cc == 0) && ((formatoptions & FORMATOPTION_print_ipset) != 0)) {
+		// single set, header always printed
+		libipv6calc_db_dump_print_header(dump, 0);
+	};
+
+	return (0);
+};
+
+
+/*
+ * database dump: add range of a CountryCode
+ *
+ * in : dump, CountryCode index, range (IPv4: 32 bit, IPv6: upper 64 bit)
+ * ret: ==0: ok, !=0: error
+ */
+int libipv6calc_db_dump_range(s_ipv6calc_db_dump *dump, const uint16_t cc_index, const uint64_t first, const uint64_t last) {
+	int set = (dump->flag_set_cc == 1) ? (int) cc_index : 0;
+	s_ipv6calc_db_dump_set *setp;
+
+	if (set >= dump->sets_max) {
+		ERRORPRINT_WA("CountryCode index out of range: %u", cc_index);
+		return (1);
+	};
+
+	setp = &dump->sets[set];
+
+	if ((dump->dump_options & IPV6CALC_DB_DUMP_AGGREGATE) == 0) {
+		return (libipv6calc_db_dump_emit(dump, set, first, last));
+	};
+
+	if (setp->flag_pending == 1) {
+		if ((first >= setp->pending.first) && ((setp->pending.last == UINT64_MAX) || (first <= setp->pending.last + 1))) {
+			// adjacent or overlapping, extend
+			if (last > setp->pending.last) {
+				setp->pending.last = last;
+			};
+			return (0);
+		};
+
+		if (libipv6calc_db_dump_emit(dump, set, setp->pending.first, setp->pending.last) != 0) {
+			return (1);
+		};
+	};
+
+	setp->pending.first = first;
+	setp->pending.last = last;
+	setp->flag_pending = 1;
+	return (0);
+};
+
+
+/*
+ * database dump: flush pending ranges, print collected sets and free resources
+ *
+ * in : dump
+ * ret: ==0: ok, !=0: error
+ */
+int libipv6calc_db_dump_close(s_ipv6calc_db_dump *dump) {
+	int set, retval = 0;
+	size_t i;
+
+	if (dump->sets == NULL) {
+		return (1);
+	};
+
+	for (set = 0; set < dump->sets_max; set++) {
+		if (dump->sets[set].flag_pending == 1) {
+			if (libipv6calc_db_dump_emit(dump, set, dump->sets[set].pending.first, dump->sets[set].pending.last) != 0) {
+				retval = 1;
+			};
+			dump->sets[set].flag_pending = 0;
+		};
+
+		if ((dump->formatoptions & FORMATOPTION_print_nftables) != 0) {
+			if ((dump->sets[set].ranges_used == 0) && (dump->flag_set_cc == 1)) {
+				continue;
+			};
+
+			libipv6calc_db_dump_print_header(dump, set);
+
+			if (dump->sets[set].ranges_used > 0) {
+				char name[IPV6CALC_STRING_MAX];
+				libipv6calc_db_dump_set_name(dump, set, name, sizeof(name));
+				fprintf(stdout, "add element %s %s {\n", dump->nft_table, name);
+				for (i = 0; i < dump->sets[set].ranges_used; i++) {
+					libipv6calc_db_dump_print_range(dump, set, dump->sets[set].ranges[i].first, dump->sets[set].ranges[i].last, (i > 0) ? 1 : 0);
+				};
+				fprintf(stdout, "\n}\n");
+			};
+		};
+
+		if (dump->sets[set].ranges != NULL) {
+			free(dump->sets[set].ranges);
+		};
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "dump closed, printed prefixes: %ld", dump->count);
+
+	free(dump->sets);
+	dump->sets = NULL;
+
+	return (retval);
+};
+
+
+/*
+ * database dump: check filter and outputtype, create filter info string
+ *
+ * in : selector, filter_master, outputtype, name of set
+ * out: filterstring (optional), required database features (IPV6CALC_DB_IPV*_DUMP_CC and/or IPV6CALC_DB_IPV*_TO_AS)
+ * ret: ==0: ok, !=0: error
+ */
+int libipv6calc_db_dump_filter_check(const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const char *name_set, char *filterstring, const size_t filterstring_length, uint32_t *features_ptr) {
+	const s_ipv6calc_filter_db_cc *filter_db_cc;
+	const s_ipv6calc_filter_db_asn *filter_db_asn;
+	char tempstring[IPV6CALC_STRING_MAX] = "";
+	char cc2[IPV6CALC_COUNTRYCODE_STRING_MAX];
+	char asnstring[IPV6CALC_STRING_MAX];
+	uint32_t features = 0;
+	int set_cc = 0, i;
+
+	// one set per CountryCode, CountryCode filter becomes optional
+	if ((name_set != NULL) && (strstr(name_set, IPV6CALC_DB_DUMP_SET_CC) != NULL)) {
+		set_cc = 1;
+	};
+
+	switch (selector) {
+	    case IPV6CALC_PROTO_IPV4:
+		if (filter_master->filter_ipv4addr.active == 0) {
+			ERRORPRINT_NA("no IPv4 filter provided (-E ...)");
+			return (1);
+		};
+
+		if ((filter_master->filter_ipv4addr.filter_db_cc.active == 0) && (filter_master->filter_ipv4addr.filter_db_asn.active == 0) && (set_cc == 0)) {
+			ERRORPRINT_NA("no IPv4 Database CountryCode or ASN filter provided (-E ipv4.db.cc=<CountryCode>|ipv4.db.asn=<ASN>)");
+			return (1);
+		};
+
+		if (filter_master->filter_ipv4addr.filter_db_registry.active != 0) {
+			ERRORPRINT_NA("IPv4 Registry filter currently not supported for database dump");
+			return (1);
+		};
+
+		// plain '-E ipv4' (any address) is accepted
+		if ((filter_master->filter_ipv4addr.filter_typeinfo.active != 0) && ((filter_master->filter_ipv4addr.filter_typeinfo.typeinfo_must_have != IPV4_ADDR_ANY) || (filter_master->filter_ipv4addr.filter_typeinfo.typeinfo_may_not_have != 0))) {
+			ERRORPRINT_NA("IPv4 TypeInfo filter currently not supported for database dump");
+			return (1);
+		};
+
+		if (filter_master->filter_ipv4addr.filter_addr.active != 0) {
+			ERRORPRINT_NA("IPv4 Address filter currently not supported for database dump");
+			return (1);
+		};
+
+		switch (outputtype) {
+			case FORMAT_ipv4addr:
+			case FORMAT_ipv6to4:
+			case FORMAT_undefined:
+				// supported
+				break;
+
+			default:
+				ERRORPRINT_WA("Outputtype for IPv4 Address is not supported: 0x%08x", outputtype);
+				return (1);
+				break;
+		};
+
+		filter_db_cc = &filter_master->filter_ipv4addr.filter_db_cc;
+		filter_db_asn = &filter_master->filter_ipv4addr.filter_db_asn;
+
+		if ((filter_db_cc->active != 0) || (set_cc == 1)) {
+			features |= IPV6CALC_DB_IPV4_DUMP_CC;
+		};
+
+		if (filter_db_asn->active != 0) {
+			features |= IPV6CALC_DB_IPV4_TO_AS;
+		};
+
+		STRCAT(tempstring, "IPv4");
+		break;
+
+	    case IPV6CALC_PROTO_IPV6:
+		if (filter_master->filter_ipv6addr.active == 0) {
+			ERRORPRINT_NA("no IPv6 filter provided (-E ...)");
+			return (1);
+		};
+
+		if ((filter_master->filter_ipv6addr.filter_db_cc.active == 0) && (filter_master->filter_ipv6addr.filter_db_asn.active == 0) && (set_cc == 0)) {
+			ERRORPRINT_NA("no IPv6 Database CountryCode or ASN filter provided (-E ipv6.db.cc=<CountryCode>|ipv6.db.asn=<ASN>)");
+			return (1);
+		};
+
+		if (filter_master->filter_ipv6addr.filter_db_registry.active != 0) {
+			ERRORPRINT_NA("IPv6 Registry filter currently not supported for database dump");
+			return (1);
+		};
+
+		// plain '-E ipv6' (any address) is accepted
+		if (((filter_master->filter_ipv6addr.filter_typeinfo.active != 0) && ((filter_master->filter_ipv6addr.filter_typeinfo.typeinfo_must_have != IPV6_ADDR_ANY) || (filter_master->filter_ipv6addr.filter_typeinfo.typeinfo_may_not_have != 0))) || (filter_master->filter_ipv6addr.filter_typeinfo2.active != 0)) {
+			ERRORPRINT_NA("IPv6 TypeInfo filter currently not supported for database dump");
+			return (1);
+		};
+
+		if (filter_master->filter_ipv6addr.filter_addr.active != 0) {
+			ERRORPRINT_NA("IPv6 Address filter currently not supported for database dump");
+			return (1);
+		};
+
+		switch (outputtype) {
+			case FORMAT_ipv6addr:
+			case FORMAT_undefined:
+				// supported
+				break;
+
+			default:
+				ERRORPRINT_WA("Outputtype for IPv6 Address is not supported: 0x%08x", outputtype);
+				return (1);
+				break;
+		};
+
+		filter_db_cc = &filter_master->filter_ipv6addr.filter_db_cc;
+		filter_db_asn = &filter_master->filter_ipv6addr.filter_db_asn;
+
+		if ((filter_db_cc->active != 0) || (set_cc == 1)) {
+			features |= IPV6CALC_DB_IPV6_DUMP_CC;
+		};
+
+		if (filter_db_asn->active != 0) {
+			features |= IPV6CALC_DB_IPV6_TO_AS;
+		};
+
+		STRCAT(tempstring, "IPv6");
+		break;
+
+	    default:
+		ERRORPRINT_WA("unsupported selector: %d (FIX CODE)", selector);
+		return (1);
+		break;
+	};
+
+	// check for unsupported mixed filter
+	if (((filter_db_cc->cc_must_have_max > 0) && (filter_db_cc->cc_may_not_have_max > 0)) || ((filter_db_asn->asn_must_have_max > 0) && (filter_db_asn->asn_may_not_have_max > 0))) {
+		ERRORPRINT_NA("mixed Database filter with 'must-have' and 'may-not-have' is senseless for database dump");
+		return (1);
+	};
+
+	// create filter info string
+	if ((features & IPV6CALC_DB_IP_DUMP_CC) != 0) {
+		STRCAT(tempstring, " && CountryCode(s):");
+
+		if (filter_db_cc->active == 0) {
+			STRCAT(tempstring, " (all)");
+		};
+
+		for (i = 0; i < filter_db_cc->cc_must_have_max; i++) {
+			libipv6calc_db_wrapper_country_code_by_cc_index(cc2, sizeof(cc2), filter_db_cc->cc_must_have[i]);
+			STRCAT(tempstring, " ");
+			STRCAT(tempstring, cc2);
+		};
+
+		for (i = 0; i < filter_db_cc->cc_may_not_have_max; i++) {
+			libipv6calc_db_wrapper_country_code_by_cc_index(cc2, sizeof(cc2), filter_db_cc->cc_may_not_have[i]);
+			STRCAT(tempstring, " ^");
+			STRCAT(tempstring, cc2);
+		};
+	};
+
+	if ((features & IPV6CALC_DB_IP_TO_AS) != 0) {
+		STRCAT(tempstring, " && ASN(s):");
+
+		for (i = 0; i < filter_db_asn->asn_must_have_max; i++) {
+			snprintf(asnstring, sizeof(asnstring), " %u", filter_db_asn->asn_must_have[i]);
+			STRCAT(tempstring, asnstring);
+		};
+
+		for (i = 0; i < filter_db_asn->asn_may_not_have_max; i++) {
+			snprintf(asnstring, sizeof(asnstring), " ^%u", filter_db_asn->asn_may_not_have[i]);
+			STRCAT(tempstring, asnstring);
+		};
+	};
+
+	if ((outputtype == FORMAT_ipv6to4) && (selector == IPV6CALC_PROTO_IPV4)) {
+		STRCAT(tempstring, " (output format: 6to4)");
+	};
+
+	if ((filterstring != NULL) && (filterstring_length > 0)) {
+		snprintf(filterstring, filterstring_length, "%s", tempstring);
+	};
+
+	if (features_ptr != NULL) {
+		*features_ptr = features;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "dump filter: %s features=0x%08x", tempstring, features);
+
+	return (0);
+};
+
+
+/*
+ * database dump: select source by priority supporting the required features
+ *
+ * in : features
+ * mod: priority_ptr (start position in priority list, set behind selected source)
+ * ret: source, IPV6CALC_DB_SOURCE_UNKNOWN: none (further) found
+ */
+static int libipv6calc_db_dump_source_select(const uint32_t features, int *priority_ptr) {
+	int p;
+	unsigned int source;
+
+	for (p = *priority_ptr; p <= IPV6CALC_DB_SOURCE_MAX; p++) {
+		source = wrapper_source_priority_selector[p];
+
+		if ((wrapper_features_by_source[source] & features) != features) {
+			continue;
+		};
+
+		switch (source) {
+		    case IPV6CALC_DB_SOURCE_EXTERNAL:
+#ifdef SUPPORT_EXTERNAL
+			if (wrapper_External_status == 1) {
+				*priority_ptr = p + 1;
+				return (source);
+			};
+#endif
+			break;
+
+		    case IPV6CALC_DB_SOURCE_GEOIP2:
+#ifdef SUPPORT_GEOIP2
+			if (wrapper_GeoIP2_status == 1) {
+				*priority_ptr = p + 1;
+				return (source);
+			};
+#endif
+			break;
+
+		    case IPV6CALC_DB_SOURCE_DBIP2:
+#ifdef SUPPORT_DBIP2
+			if (wrapper_DBIP2_status == 1) {
+				*priority_ptr = p + 1;
+				return (source);
+			};
+#endif
+			break;
+		};
+	};
+
+	*priority_ptr = p;
+	return (IPV6CALC_DB_SOURCE_UNKNOWN);
+};
+
+
+/*
+ * dump database of given source
+ *
+ * ret: 0 = ok, 1 = error, IPV6CALC_DB_DUMP_UNSUPPORTED = filter combination not supported by source
+ */
+static int libipv6calc_db_dump_source(const int source, const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options) {
+	int retval;
 
 	switch (source) {
 	    case IPV6CALC_DB_SOURCE_EXTERNAL:
@@ -4125,7 +5066,7 @@ int libipv6calc_db_dump(const int source, const int selector, const s_ipv6calc_f
 		switch (selector) {
 		    case IPV6CALC_PROTO_IPV4:
 		    case IPV6CALC_PROTO_IPV6:
-			retval = libipv6calc_db_wrapper_External_dump(selector, filter_master, outputtype, formatoptions, name_ipset);
+			retval = libipv6calc_db_wrapper_External_dump(selector, filter_master, outputtype, formatoptions, name_set, dump_options);
 			break;
 
 		    default:
@@ -4137,7 +5078,27 @@ int libipv6calc_db_dump(const int source, const int selector, const s_ipv6calc_f
 		if (formatoptions == 0) { }; // avoid -Werror=unused-parameter
 		if (outputtype == 0) { }; // avoid -Werror=unused-parameter
 		if (filter_master == NULL) { }; // avoid -Werror=unused-parameter
-		if (name_ipset == NULL) { }; // avoid -Werror=unused-parameter
+		if (name_set == NULL) { }; // avoid -Werror=unused-parameter
+		if (dump_options == 0) { }; // avoid -Werror=unused-parameter
+		if (selector == 0) { }; // avoid -Werror=unused-parameter
+		ERRORPRINT_WA("source not compiled in: %d", source);
+		return(1);
+#endif
+		break;
+
+	    case IPV6CALC_DB_SOURCE_GEOIP2:
+#ifdef SUPPORT_GEOIP2
+		retval = libipv6calc_db_wrapper_GeoIP2_dump(selector, filter_master, outputtype, formatoptions, name_set, dump_options);
+#else
+		ERRORPRINT_WA("source not compiled in: %d", source);
+		return(1);
+#endif
+		break;
+
+	    case IPV6CALC_DB_SOURCE_DBIP2:
+#ifdef SUPPORT_DBIP2
+		retval = libipv6calc_db_wrapper_DBIP2_dump(selector, filter_master, outputtype, formatoptions, name_set, dump_options);
+#else
 		ERRORPRINT_WA("source not compiled in: %d", source);
 		return(1);
 #endif
@@ -4153,6 +5114,51 @@ int libipv6calc_db_dump(const int source, const int selector, const s_ipv6calc_f
 };
 
 
+/*
+ * dump database
+ *
+ * in : source (IPV6CALC_DB_SOURCE_UNKNOWN: select by priority, try next one in case filter combination is not supported), selector
+ */
+int libipv6calc_db_dump(const int source, const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options) {
+	int retval;
+	int source_selected, priority = IPV6CALC_DB_SOURCE_MIN;
+	uint32_t features;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "called with source=%d selector=%d", source, selector);
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_ENSURE()
+
+	if (source != IPV6CALC_DB_SOURCE_UNKNOWN) {
+		retval = libipv6calc_db_dump_source(source, selector, filter_master, outputtype, formatoptions, name_set, dump_options);
+	} else {
+		if (libipv6calc_db_dump_filter_check(selector, filter_master, outputtype, name_set, NULL, 0, &features) != 0) {
+			return(1);
+		};
+
+		retval = IPV6CALC_DB_DUMP_UNSUPPORTED;
+
+		while ((source_selected = libipv6calc_db_dump_source_select(features, &priority)) != IPV6CALC_DB_SOURCE_UNKNOWN) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "selected source=%s", libipv6calc_db_wrapper_get_data_source_name_by_number(source_selected));
+
+			retval = libipv6calc_db_dump_source(source_selected, selector, filter_master, outputtype, formatoptions, name_set, dump_options);
+
+			if (retval != IPV6CALC_DB_DUMP_UNSUPPORTED) {
+				break;
+			};
+
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "source=%s does not support filter combination, try next one", libipv6calc_db_wrapper_get_data_source_name_by_number(source_selected));
+		};
+	};
+
+	if (retval == IPV6CALC_DB_DUMP_UNSUPPORTED) {
+		ERRORPRINT_NA("no database available supporting dump with given filter (see 'ipv6calc -v')");
+		retval = 1;
+	};
+
+	return(retval);
+};
+
+
 /*
  * return library version numeric
  */
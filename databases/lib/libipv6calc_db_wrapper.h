@@ -16,6 +16,9 @@
 #define _libipv6calc_db_wrapper_h 1
 
 
+#include <time.h>
+#include <sys/types.h>
+
 #include "libmac.h"
 #include "libipv4addr.h"
 #include "libipv6addr.h"
@@ -28,6 +31,27 @@ extern uint32_t wrapper_features;
 extern uint32_t wrapper_features_by_source[];
 extern uint32_t wrapper_features_by_source_implemented[];
 
+extern int wrapper_reload_interval;
+extern unsigned int libipv6calc_db_wrapper_reload_generation;
+
+// reload generation, read/updated atomically
+#if defined(__ATOMIC_ACQUIRE)
+#define LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION()	__atomic_load_n(&libipv6calc_db_wrapper_reload_generation, __ATOMIC_ACQUIRE)
+#define LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION_INC()	__atomic_add_fetch(&libipv6calc_db_wrapper_reload_generation, 1, __ATOMIC_RELEASE)
+#else
+#define LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION()	(libipv6calc_db_wrapper_reload_generation)
+#define LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION_INC()	(++libipv6calc_db_wrapper_reload_generation)
+#endif
+
+// state of database file for hot reload
+typedef struct {
+	int    valid;
+	time_t checked;
+	time_t mtime;
+	off_t  size;
+	ino_t  ino;
+} s_libipv6calc_db_wrapper_file_state;
+
 #define IPV6CALC_PROTO_IPV4				4
 #define IPV6CALC_PROTO_IPV6				6
 
@@ -95,6 +119,7 @@ extern uint32_t wrapper_features_by_source_implemented[];
 #define IPV6CALC_DB_IP_TO_CITY			(IPV6CALC_DB_IPV4_TO_CITY      | IPV6CALC_DB_IPV6_TO_CITY     )
 #define IPV6CALC_DB_IP_TO_REGION		(IPV6CALC_DB_IPV4_TO_REGION    | IPV6CALC_DB_IPV6_TO_REGION   )
 #define IPV6CALC_DB_IP_TO_GEONAMEID		(IPV6CALC_DB_IPV4_TO_GEONAMEID | IPV6CALC_DB_IPV6_TO_GEONAMEID)
+#define IPV6CALC_DB_IP_DUMP_CC			(IPV6CALC_DB_IPV4_DUMP_CC      | IPV6CALC_DB_IPV6_DUMP_CC     )
 
 //                                              0xXXUBBBBB 20 bit are blocked by above
 // define database specific generic features
@@ -357,6 +382,42 @@ typedef struct {
 #define COUNTRYCODE_INDEX_TO_CHAR2(index)  ((index / COUNTRYCODE_LETTER1_MAX) > 9) ? ((index / COUNTRYCODE_LETTER1_MAX) - 10 + 'A') : ((index / COUNTRYCODE_LETTER1_MAX) + '0')
 
 
+// database dump
+#define IPV6CALC_DB_DUMP_AGGREGATE	0x00000001	// merge adjacent/overlapping ranges into minimal CIDR cover
+
+#define IPV6CALC_DB_DUMP_SET_CC		"%CC"		// placeholder in set name: one set per CountryCode
+
+#define IPV6CALC_DB_DUMP_UNSUPPORTED	2		// return code of source dump: filter combination not supported by database(s) of source
+
+typedef struct {
+	uint64_t first;
+	uint64_t last;
+} s_ipv6calc_db_dump_range;
+
+typedef struct {
+	int      flag_pending;		// =1: pending range (aggregation)
+	int      flag_header;		// =1: set header printed
+	s_ipv6calc_db_dump_range pending;
+	s_ipv6calc_db_dump_range *ranges;	// collected ranges (nftables)
+	size_t   ranges_used;
+	size_t   ranges_size;
+} s_ipv6calc_db_dump_set;
+
+typedef struct {
+	int      selector;		// IPV6CALC_PROTO_IPV4 (32 bit) or IPV6CALC_PROTO_IPV6 (upper 64 bit)
+	uint32_t outputtype;
+	uint32_t formatoptions;
+	uint32_t dump_options;
+	int      bits;
+	int      flag_set_cc;		// =1: set name contains IPV6CALC_DB_DUMP_SET_CC
+	char     name_set[IPV6CALC_STRING_MAX];
+	char     nft_table[IPV6CALC_STRING_MAX];	// nftables: "<family> <table>"
+	long int count;			// printed prefixes
+	int      sets_max;
+	s_ipv6calc_db_dump_set *sets;
+} s_ipv6calc_db_dump;
+
+
 // generic database lookup function
 #define IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY		1	 // array
 
@@ -402,7 +463,9 @@ typedef struct {
 
 
 extern int  libipv6calc_db_wrapper_init(const char *prefix_string);
+extern int  libipv6calc_db_wrapper_init_lazy(const char *prefix_string);
 extern int  libipv6calc_db_wrapper_cleanup(void);
+extern void libipv6calc_db_wrapper_db_info_used_clear(void);
 extern void libipv6calc_db_wrapper_info(char *string, const size_t size);
 extern void libipv6calc_db_wrapper_features(char *string, const size_t size);
 extern int libipv6calc_db_wrapper_features_support_by_name(const char* feature_name);
@@ -415,6 +478,10 @@ extern int  libipv6calc_db_wrapper_has_features(uint32_t features);
 extern int  libipv6calc_db_wrapper_options(const int opt, const char *optarg, const struct option longopts[]);
 extern const char *libipv6calc_db_wrapper_get_data_source_name_by_number(const unsigned int number);
 
+extern void libipv6calc_db_wrapper_file_state_store(const char *filename, s_libipv6calc_db_wrapper_file_state *state);
+extern int  libipv6calc_db_wrapper_file_state_changed(const char *filename, s_libipv6calc_db_wrapper_file_state *state);
+extern void libipv6calc_db_wrapper_reloaded(const char *filename, s_libipv6calc_db_wrapper_file_state *state);
+
 
 /* functional wrappers */
 
@@ -422,6 +489,7 @@ extern const char *libipv6calc_db_wrapper_get_data_source_name_by_number(const u
 extern int         libipv6calc_db_wrapper_country_code_by_addr(char *string, const int length, const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr);
 extern int         libipv6calc_db_wrapper_country_code_by_cc_index(char *string, const int length, const uint16_t cc_index);
 extern uint16_t    libipv6calc_db_wrapper_cc_index_by_country_code(const char *cc_text);
+extern uint16_t    libipv6calc_db_wrapper_cc_index_by_chars(const char c1, const char c2);
 extern uint16_t    libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr);
 
 // Autonomous System Number/Text
@@ -502,7 +570,12 @@ extern int libipv6calc_db_registry_filter_parse(s_ipv6calc_filter_db_registry *f
 extern int libipv6calc_db_registry_filter_check(const s_ipv6calc_filter_db_registry *filter, const int proto);
 extern int libipv6calc_db_registry_filter(const uint32_t registry, const s_ipv6calc_filter_db_registry *filter);
 
-extern int libipv6calc_db_dump(const int source, const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_ipset);
+extern int libipv6calc_db_dump(const int source, const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options);
+
+extern int libipv6calc_db_dump_filter_check(const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const char *name_set, char *filterstring, const size_t filterstring_length, uint32_t *features_ptr);
+extern int libipv6calc_db_dump_open(s_ipv6calc_db_dump *dump, const int selector, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options);
+extern int libipv6calc_db_dump_range(s_ipv6calc_db_dump *dump, const uint16_t cc_index, const uint64_t first, const uint64_t last);
+extern int libipv6calc_db_dump_close(s_ipv6calc_db_dump *dump);
 
 extern       uint32_t libipv6calc_db_lib_version_numeric(void);
 extern const char    *libipv6calc_db_lib_version_string(void);
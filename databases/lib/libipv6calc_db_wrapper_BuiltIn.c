@@ -310,6 +310,17 @@ char *libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: clear information regarding used databases (e.g. between records in pipe mode)
+ */
+void libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used_clear(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Called");
+
+	memset(builtin_db_usage_map, 0, sizeof(builtin_db_usage_map));
+	builtin_db_usage_string[0] = '\0';
+};
+
+
 /*********************************************
  * Abstract functions
  * *******************************************/
@@ -482,7 +493,7 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_by_macaddr(char *resultstr
 		if (libieee_iab[i].id == idval) {
 			/* major id match */
 			if (libieee_iab[i].subid_begin <= subidval && libieee_iab[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_iab[i].string_owner);
+				snprintf(resultstring, resultstring_length, "%s", libieee_iab_strings + libieee_iab[i].string_owner_offset);
 				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IAB);
 				return (0);
 			};
@@ -494,7 +505,7 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_by_macaddr(char *resultstr
 		if (libieee_oui36[i].id == idval) {
 			/* major id match */
 			if (libieee_oui36[i].subid_begin <= subidval && libieee_oui36[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_oui36[i].string_owner);
+				snprintf(resultstring, resultstring_length, "%s", libieee_oui36_strings + libieee_oui36[i].string_owner_offset);
 				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI36);
 				return (0);
 			};
@@ -506,7 +517,7 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_by_macaddr(char *resultstr
 		if (libieee_oui28[i].id == idval) {
 			/* major id match */
 			if (libieee_oui28[i].subid_begin <= subidval && libieee_oui28[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_oui28[i].string_owner);
+				snprintf(resultstring, resultstring_length, "%s", libieee_oui28_strings + libieee_oui28[i].string_owner_offset);
 				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI28);
 				return (0);
 			};
@@ -517,7 +528,7 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_by_macaddr(char *resultstr
 	for (i = 0; i < MAXENTRIES_ARRAY(libieee_oui); i++) {
 		if (libieee_oui[i].id == idval) {
 			/* match */
-			snprintf(resultstring, resultstring_length, "%s", libieee_oui[i].string_owner);
+			snprintf(resultstring, resultstring_length, "%s", libieee_oui_strings + libieee_oui[i].string_owner_offset);
 			BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI);
 			return (0);
 		};
@@ -570,7 +581,7 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(char *res
 		if (libieee_iab[i].id == idval) {
 			/* major id match */
 			if (libieee_iab[i].subid_begin <= subidval && libieee_iab[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_iab[i].shortstring_owner);
+				snprintf(resultstring, resultstring_length, "%s", libieee_iab_strings + libieee_iab[i].shortstring_owner_offset);
 				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IAB);
 				return (0);
 			};
@@ -582,7 +593,7 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(char *res
 		if (libieee_oui36[i].id == idval) {
 			/* major id match */
 			if (libieee_oui36[i].subid_begin <= subidval && libieee_oui36[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_oui36[i].shortstring_owner);
+				snprintf(resultstring, resultstring_length, "%s", libieee_oui36_strings + libieee_oui36[i].shortstring_owner_offset);
 				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI36);
 				return (0);
 			};
@@ -594,7 +605,7 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(char *res
 		if (libieee_oui28[i].id == idval) {
 			/* major id match */
 			if (libieee_oui28[i].subid_begin <= subidval && libieee_oui28[i].subid_end >= subidval) {
-				snprintf(resultstring, resultstring_length, "%s", libieee_oui28[i].shortstring_owner);
+				snprintf(resultstring, resultstring_length, "%s", libieee_oui28_strings + libieee_oui28[i].shortstring_owner_offset);
 				BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI28);
 				return (0);
 			};
@@ -605,7 +616,7 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(char *res
 	for (i = 0; i < MAXENTRIES_ARRAY(libieee_oui); i++) {
 		if (libieee_oui[i].id == idval) {
 			/* match */
-			snprintf(resultstring, resultstring_length, "%s", libieee_oui[i].shortstring_owner);
+			snprintf(resultstring, resultstring_length, "%s", libieee_oui_strings + libieee_oui[i].shortstring_owner_offset);
 			BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_OUI);
 			return (0);
 		};
@@ -708,7 +719,7 @@ int libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_info(const uint32_t row, u
  * out: assignment number (-1 = no result)
  */
 int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp) {
-	uint32_t ipv4 = ipv4addr_getdword(ipv4addrp);
+	uint32_t ipv4 = ipv4addr_getdword_unchecked(ipv4addrp);
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Given IPv4 address: %08x", (unsigned int) ipv4);
 
@@ -777,7 +788,7 @@ int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr(const ipv6calc_ipv4a
  * out: 0 = found, -1 = no result
  */
 int libipv6calc_db_wrapper_BuiltIn_info_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, char *string, const size_t string_len) {
-	uint32_t ipv4 = ipv4addr_getdword(ipv4addrp);
+	uint32_t ipv4 = ipv4addr_getdword_unchecked(ipv4addrp);
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Given IPv4 address: %08x", (unsigned int) ipv4);
 
@@ -801,7 +812,7 @@ int libipv6calc_db_wrapper_BuiltIn_info_by_ipv4addr(const ipv6calc_ipv4addr *ipv
 	);
 
 	if (match > -1) {
-		snprintf(string, string_len, "%s", dbipv4addr_info[match].info);
+		snprintf(string, string_len, "%s", dbipv4addr_info_strings + dbipv4addr_info[match].info_offset);
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Finished with success result (dbipv4addr_info): match=%d info=\"%s\"", match, string);
 		BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IPV4_REGISTRY);
 		result = 0;
@@ -882,8 +893,8 @@ int libipv6calc_db_wrapper_BuiltIn_get_row_dbipv6addr_info(const uint32_t row, u
  * out: assignment number (-1 = no result)
  */
 int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp) {
-	uint32_t ipv6_00_31 = ipv6addr_getdword(ipv6addrp, 0);
-	uint32_t ipv6_32_63 = ipv6addr_getdword(ipv6addrp, 1);
+	uint32_t ipv6_00_31 = ipv6addr_getdword_unchecked(ipv6addrp, 0);
+	uint32_t ipv6_32_63 = ipv6addr_getdword_unchecked(ipv6addrp, 1);
 	
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Given ipv6 prefix: %08x%08x", (unsigned int) ipv6_00_31, (unsigned int) ipv6_32_63);
 
@@ -932,8 +943,8 @@ int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv6addr(const ipv6calc_ipv6a
  * out: 0 = found, -1 = no result
  */
 int libipv6calc_db_wrapper_BuiltIn_info_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp, char *string, const size_t string_len) {
-	uint32_t ipv6_00_31 = ipv6addr_getdword(ipv6addrp, 0);
-	uint32_t ipv6_32_63 = ipv6addr_getdword(ipv6addrp, 1);
+	uint32_t ipv6_00_31 = ipv6addr_getdword_unchecked(ipv6addrp, 0);
+	uint32_t ipv6_32_63 = ipv6addr_getdword_unchecked(ipv6addrp, 1);
 	
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Given ipv6 prefix: %08x%08x", (unsigned int) ipv6_00_31, (unsigned int) ipv6_32_63);
 
@@ -957,7 +968,7 @@ int libipv6calc_db_wrapper_BuiltIn_info_by_ipv6addr(const ipv6calc_ipv6addr *ipv
 	);
 
 	if (match > -1) {
-		snprintf(string, string_len, "%s", dbipv6addr_info[match].info);
+		snprintf(string, string_len, "%s", dbipv6addr_info_strings + dbipv6addr_info[match].info_offset);
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Finished with success result (dbipv6addr_info): match=%d info=\"%s\"", match, string);
 		BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IPV6_REGISTRY);
 		result = 0;
@@ -60,11 +60,11 @@ typedef struct {
 } s_ipv4addr_assignment;
 
 
-/* IPv4 address info structure */
+/* IPv4 address info structure, info is stored as offset into dbipv4addr_info_strings */
 typedef struct {
 	const uint32_t first;
 	const uint32_t last;
-	const char*    info;
+	const uint32_t info_offset;
 } s_ipv4addr_info;
 
 
@@ -79,14 +79,14 @@ typedef struct {
 } s_ipv6addr_assignment;
 
 
-/* IPv6 address info structure */
+/* IPv6 address info structure, info is stored as offset into dbipv6addr_info_strings */
 typedef struct {
 	const uint32_t ipv6addr_00_31;
 	const uint32_t ipv6addr_32_63;
 	const uint32_t ipv6mask_00_31;
 	const uint32_t ipv6mask_32_63;
 	const uint8_t  prefixlength;	/* prefix length (0-128) 8 bit*/
-	const char*    info;
+	const uint32_t info_offset;
 } s_ipv6addr_info;
 
 #endif
@@ -97,6 +97,7 @@ extern int  libipv6calc_db_wrapper_BuiltIn_wrapper_cleanup(void);
 extern void libipv6calc_db_wrapper_BuiltIn_wrapper_info(char *string, const size_t size);
 extern void libipv6calc_db_wrapper_BuiltIn_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char *libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used(void);
+extern void libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used_clear(void);
 
 extern int libipv6calc_db_wrapper_BuiltIn_has_features(uint32_t features);
 extern time_t libipv6calc_db_wrapper_BuiltIn_db_unixtime_by_feature(uint32_t feature);
@@ -38,7 +38,7 @@ static const db_file_desc2 libipv6calc_db_wrapper_DBIP2_db_file_desc[] = {
 	{ DBIP2_DB_COUNTRY_LITE
 		, "dbip-country-lite.mmdb"
 		, "IPv4/v6 CountryCode (LITE)"
-		, IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY
+		, IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY
 		, IPV6CALC_DB_DBIP2_INTERNAL_LITE
 	},
 
@@ -46,7 +46,7 @@ static const db_file_desc2 libipv6calc_db_wrapper_DBIP2_db_file_desc[] = {
 	{ DBIP2_DB_CITY_LITE
 		, "dbip-city-lite.mmdb"
 		, "IPv4/v6 City (LITE)"
-		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY
+		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY
 		, IPV6CALC_DB_DBIP2_INTERNAL_LITE
 	},
 
@@ -62,7 +62,7 @@ static const db_file_desc2 libipv6calc_db_wrapper_DBIP2_db_file_desc[] = {
 	{ DBIP2_DB_COUNTRY
 		, "dbip-country.mmdb"
 		, "IPv4/v6 CountryCode (COMM)"
-		, IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY
+		, IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY
 		, IPV6CALC_DB_DBIP2_INTERNAL_COMM
 	},
 
@@ -70,14 +70,14 @@ static const db_file_desc2 libipv6calc_db_wrapper_DBIP2_db_file_desc[] = {
 	{ DBIP2_DB_LOCATION
 		, "dbip-location.mmdb"
 		, "IPv4/v6 Location (COMM)"
-		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_COUNTRY | IPV6CALC_DB_IP_TO_GEONAMEID
+		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_COUNTRY | IPV6CALC_DB_IP_TO_GEONAMEID
 		, IPV6CALC_DB_DBIP2_INTERNAL_COMM
 	},
 
 	// ISP
 	{ DBIP2_DB_ISP
 		, "dbip-isp.mmdb"
-		, "IPv4/v6 ISP (COMM)", IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_AS
+		, "IPv4/v6 ISP (COMM)", IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_AS
 		, IPV6CALC_DB_DBIP2_INTERNAL_COMM
 	},
 
@@ -85,7 +85,7 @@ static const db_file_desc2 libipv6calc_db_wrapper_DBIP2_db_file_desc[] = {
 	{ DBIP2_DB_LOCATION_ISP
 		, "dbip-location-isp.mmdb"
 		, "IPv4/v6 Location+ISP (COMM)"
-		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_COUNTRY | IPV6CALC_DB_IP_TO_AS | IPV6CALC_DB_IP_TO_GEONAMEID
+		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_DBIP | IPV6CALC_DB_IP_TO_COUNTRY | IPV6CALC_DB_IP_TO_AS | IPV6CALC_DB_IP_TO_GEONAMEID
 		, IPV6CALC_DB_DBIP2_INTERNAL_COMM
 	},
 };
@@ -141,6 +141,7 @@ char dbip2_db_usage_string[IPV6CALC_STRING_MAX] = "";
 
 // local cache
 static MMDB_s mmdb_cache[DBIP2_DB_MAX+1];
+static s_libipv6calc_db_wrapper_file_state mmdb_file_state[DBIP2_DB_MAX+1];
 
 // local prototyping
 static char     *libipv6calc_db_wrapper_DBIP2_dbfilename(const unsigned int type); 
@@ -583,6 +584,17 @@ char *libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: clear information regarding used databases (e.g. between records in pipe mode)
+ */
+void libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used_clear(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_DBIP2, "Called");
+
+	memset(dbip2_db_usage_map, 0, sizeof(dbip2_db_usage_map));
+	dbip2_db_usage_string[0] = '\0';
+};
+
+
 /*******************************
  * Wrapper extension functions for DBIP2
  *******************************/
@@ -707,6 +719,21 @@ int libipv6calc_db_wrapper_DBIP2_open_type(const unsigned int type) {
 		// already open
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP2, "Database already opened (cached) type=%d", type);
 		ret = MMDB_SUCCESS;
+
+		if (libipv6calc_db_wrapper_file_state_changed(mmdb_cache[type].filename, &mmdb_file_state[type]) == 1) {
+			// open changed database first, swap on success and close old one afterwards (keep old one on error)
+			MMDB_s mmdb_new, mmdb_old;
+
+			if (libipv6calc_db_wrapper_MMDB_open(mmdb_cache[type].filename, MMDB_MODE_MMAP, &mmdb_new) == MMDB_SUCCESS) {
+				mmdb_old = mmdb_cache[type];
+				mmdb_cache[type] = mmdb_new;
+				libipv6calc_db_wrapper_MMDB_close(&mmdb_old);
+				libipv6calc_db_wrapper_reloaded(mmdb_cache[type].filename, &mmdb_file_state[type]);
+			} else {
+				NONQUIETPRINT_WA("Database reload failed, keep current one: %s", mmdb_cache[type].filename);
+			};
+		};
+
 		goto END_libipv6calc_db_wrapper;
 	};
 
@@ -737,6 +764,8 @@ int libipv6calc_db_wrapper_DBIP2_open_type(const unsigned int type) {
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP2, "Database successfully opened (fill-cache), type=%d", type);
 
+	libipv6calc_db_wrapper_file_state_store(filename, &mmdb_file_state[type]);
+
 END_libipv6calc_db_wrapper:
 	return(ret);
 };
@@ -851,8 +880,8 @@ int libipv6calc_db_wrapper_DBIP2_has_features(uint32_t features) {
 };
 
 
-/* country code */
-int libipv6calc_db_wrapper_DBIP2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+/* country code (text) or country code index (country == NULL, cc_index_ptr != NULL) */
+static int libipv6calc_db_wrapper_DBIP2_wrapper_country_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, uint16_t *cc_index_ptr) {
 	int result = MMDB_INVALID_DATA_ERROR;
 
 	int DBIP2_type = 0;
@@ -883,14 +912,19 @@ int libipv6calc_db_wrapper_DBIP2_wrapper_country_code_by_addr(const ipv6calc_ipa
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	result = libipv6calc_db_wrapper_MMDB_country_code_by_addr(ipaddrp, country, country_len, &mmdb_cache[DBIP2_type]);
- 
+	if (country != NULL) {
+		result = libipv6calc_db_wrapper_MMDB_country_code_by_addr(ipaddrp, country, country_len, &mmdb_cache[DBIP2_type]);
+	} else {
+		*cc_index_ptr = libipv6calc_db_wrapper_MMDB_cc_index_by_addr(ipaddrp, &mmdb_cache[DBIP2_type]);
+		result = (*cc_index_ptr != COUNTRYCODE_INDEX_UNKNOWN) ? MMDB_SUCCESS : MMDB_INVALID_DATA_ERROR;
+	};
+
 	if (result != MMDB_SUCCESS) {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_DBIP2, "no match found");
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP2, "result country=%s", country);
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP2, "result country=%s cc_index=%u", (country != NULL) ? country : "-", (country != NULL) ? COUNTRYCODE_INDEX_UNKNOWN : *cc_index_ptr);
 
 	DBIP2_DB_USAGE_MAP_TAG(DBIP2_type);
 
@@ -901,6 +935,22 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/* country code */
+int libipv6calc_db_wrapper_DBIP2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+	return(libipv6calc_db_wrapper_DBIP2_wrapper_country_by_addr(ipaddrp, country, country_len, NULL));
+};
+
+
+/* country code index */
+uint16_t libipv6calc_db_wrapper_DBIP2_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+
+	libipv6calc_db_wrapper_DBIP2_wrapper_country_by_addr(ipaddrp, NULL, 0, &cc_index);
+
+	return(cc_index);
+};
+
+
 /*
  * get AS 32-bit number and orgname (optional)
  * in : ipaddrp (mandatory)
@@ -1104,4 +1154,79 @@ END_libipv6calc_db_wrapper:
 	return(result);
 };
 
+
+/*
+ * database dump (full search tree traversal)
+ *
+ * in:  selector
+ * in:  filter (CountryCode and/or ASN)
+ * in:  outputtype
+ * in:  formatoptions
+ * in:  name of set (ipset/nftables, '%CC' creates one set per CountryCode)
+ * in:  dump options (IPV6CALC_DB_DUMP_*)
+ * out: 0=OK
+ */
+int libipv6calc_db_wrapper_DBIP2_dump(const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options) {
+	char filterstring[IPV6CALC_STRING_MAX] = "";
+	s_ipv6calc_db_dump dump;
+	uint32_t features;
+	long int count = 0;
+	int DBIP2_type = 0, DBIP2_type_asn;
+	int retval = 1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP2, "Called: %s selector=%d", wrapper_dbip2_info, selector);
+
+	if (libipv6calc_db_dump_filter_check(selector, filter_master, outputtype, name_set, filterstring, sizeof(filterstring), &features) != 0) {
+		return(1);
+	};
+
+	// select database by required features
+	if ((features & IPV6CALC_DB_IP_DUMP_CC) != 0) {
+		DBIP2_type = (selector == IPV6CALC_PROTO_IPV4) ? dbip2_db_country_v4 : dbip2_db_country_v6;
+	};
+
+	if ((features & IPV6CALC_DB_IP_TO_AS) != 0) {
+		DBIP2_type_asn = (selector == IPV6CALC_PROTO_IPV4) ? dbip2_db_asn_v4 : dbip2_db_asn_v6;
+
+		if (DBIP2_type == 0) {
+			DBIP2_type = DBIP2_type_asn;
+		} else if (DBIP2_type != DBIP2_type_asn) {
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_DBIP2, "combined CountryCode and ASN filter requires a DBIP2 database providing both");
+			return(IPV6CALC_DB_DUMP_UNSUPPORTED);
+		};
+	};
+
+	if (DBIP2_type == 0) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_DBIP2, "no DBIP2 database available supporting dump with given filter");
+		return(IPV6CALC_DB_DUMP_UNSUPPORTED);
+	};
+
+	if (libipv6calc_db_wrapper_DBIP2_open_type(DBIP2_type) != MMDB_SUCCESS) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_DBIP2, "Error opening DBIP2 by type");
+		return(1);
+	};
+
+	if (libipv6calc_db_dump_open(&dump, selector, outputtype, formatoptions, name_set, dump_options) != 0) {
+		return(1);
+	};
+
+	NONQUIETPRINT_WA("# 'DBIP2' database dump of %s (%u search tree nodes) start with filter %s (suppress this line with option '-q')", libipv6calc_db_wrapper_DBIP2_dbdescription(DBIP2_type), mmdb_cache[DBIP2_type].metadata.node_count, filterstring);
+
+	count = libipv6calc_db_wrapper_MMDB_dump(&mmdb_cache[DBIP2_type], selector, filter_master, features, &dump);
+
+	if (count >= 0) {
+		DBIP2_DB_USAGE_MAP_TAG(DBIP2_type);
+		retval = 0;
+	};
+
+	if (libipv6calc_db_dump_close(&dump) != 0) {
+		retval = 1;
+	};
+
+	NONQUIETPRINT_WA("# 'DBIP2' database dump finished displaying %ld entries (%ld prefixes) with filter %s (suppress this line with option '-q')", count, dump.count, filterstring);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP2, "retval=%d", retval);
+	return(retval);
+};
+
 #endif
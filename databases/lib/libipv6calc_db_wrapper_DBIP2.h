@@ -37,12 +37,14 @@ extern int         libipv6calc_db_wrapper_DBIP2_wrapper_cleanup(void);
 extern void        libipv6calc_db_wrapper_DBIP2_wrapper_info(char* string, const size_t size);
 extern void        libipv6calc_db_wrapper_DBIP2_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char       *libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used(void);
+extern void        libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used_clear(void);
 extern int         libipv6calc_db_wrapper_DBIP2_has_features(const uint32_t features);
 
 #ifdef SUPPORT_DBIP2
 #include "libipv6calc_db_wrapper_MMDB.h"
 
 extern int         libipv6calc_db_wrapper_DBIP2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len);
+extern uint16_t    libipv6calc_db_wrapper_DBIP2_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp);
 extern uint32_t    libipv6calc_db_wrapper_DBIP2_wrapper_asn_by_addr(const ipv6calc_ipaddr *ipaddrp, char *as_orgname, const size_t as_orgname_length);
 extern uint32_t    libipv6calc_db_wrapper_DBIP2_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, int *source_ptr);
 extern int         libipv6calc_db_wrapper_DBIP2_all_by_addr(const ipv6calc_ipaddr *ipaddrp, libipv6calc_db_wrapper_geolocation_record *recordp);
@@ -53,6 +55,7 @@ extern int  dbip2_db_only_type;
 
 extern int         libipv6calc_db_wrapper_DBIP2_db_avail(const unsigned int type);
 extern int         libipv6calc_db_wrapper_DBIP2_open_type(const unsigned int type);
+extern int         libipv6calc_db_wrapper_DBIP2_dump(const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options);
 
 extern const char *libipv6calc_db_wrapper_DBIP2_dbdescription(const unsigned int type);
 extern char       *libipv6calc_db_wrapper_DBIP2_database_info(const unsigned int type);
@@ -53,6 +53,7 @@ char external_db_usage_string[IPV6CALC_STRING_MAX] = "";
 #define IPV6CALC_DBD_SUBDB_MAX 3
 static DB *db_ptr_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)][IPV6CALC_DBD_SUBDB_MAX];
 static db_recno_t db_recno_max_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)][IPV6CALC_DBD_SUBDB_MAX];
+static s_libipv6calc_db_wrapper_file_state db_file_state[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)];
 
 // creation time of databases
 time_t wrapper_db_unixtime_External[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)];
@@ -309,6 +310,17 @@ char *libipv6calc_db_wrapper_External_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: clear information regarding used databases (e.g. between records in pipe mode)
+ */
+void libipv6calc_db_wrapper_External_wrapper_db_info_used_clear(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_External, "Called");
+
+	memset(external_db_usage_map, 0, sizeof(external_db_usage_map));
+	external_db_usage_string[0] = '\0';
+};
+
+
 /*******************************
  * Wrapper extension functions for External
  *******************************/
@@ -450,6 +462,19 @@ DB *libipv6calc_db_wrapper_External_open_type(const unsigned int type_flag, long
 		return(NULL);
 	};
 
+	if ((wrapper_reload_interval > 0) && (info_selector == 0) && (db_ptr_cache[entry][subdb] != NULL)) {
+		filename = libipv6calc_db_wrapper_External_dbfilename(type);
+
+		if (libipv6calc_db_wrapper_file_state_changed(filename, &db_file_state[entry]) == 1) {
+			// close all sub-databases of changed file, reopened on next use (file is replaced atomically by update script)
+			// closed immediately like the other backends, reload is only supported in single-threaded processes
+			for (i = 0; i < IPV6CALC_DBD_SUBDB_MAX; i++) {
+				libipv6calc_db_wrapper_External_close(db_ptr_cache[entry][i]);
+			};
+			libipv6calc_db_wrapper_reloaded(filename, &db_file_state[entry]);
+		};
+	};
+
 	if ((info_selector == 0) && (db_ptr_cache[entry][subdb] != NULL)) {
 		// already open
 		dbp = db_ptr_cache[entry][subdb];
@@ -526,6 +551,10 @@ DB *libipv6calc_db_wrapper_External_open_type(const unsigned int type_flag, long
 		};
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database successfully opened (fill-cache), dbp=%p type=%d subdb=%d recno_max=%u", dbp, type, subdb, db_recno_max_cache[entry][subdb]);
+
+		if (db_file_state[entry].valid == 0) {
+			libipv6calc_db_wrapper_file_state_store(filename, &db_file_state[entry]);
+		};
 	} else {
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database successfully opened, dbp=%p type=%d (info)", dbp, type);
 	};
@@ -841,13 +870,13 @@ END_libipv6calc_db_wrapper:
 
 
 /*
- * get country code of an IPv4/IPv6 address
+ * get country code or country code index of an IPv4/IPv6 address
  *
  * in:  ipaddr
- * mod: country code
+ * mod: country code (if country != NULL) or country code index (if country == NULL)
  * out: status of retrievment (0=success, -1=problem)
  */
-int libipv6calc_db_wrapper_External_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+static int libipv6calc_db_wrapper_External_country_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, uint16_t *cc_index_ptr) {
 	DB *dbp;
 	long int recno_max;
 	char resultstring[IPV6CALC_STRING_MAX];
@@ -913,6 +942,24 @@ int libipv6calc_db_wrapper_External_country_code_by_addr(const ipv6calc_ipaddr *
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "resultstring=%s", resultstring);
 
+	if (country == NULL) {
+		// country code index directly from data (single token with 2 chars)
+		if ((resultstring[0] == '\0') || (resultstring[1] == '\0') || (resultstring[2] != '\0')) {
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_External, "did not return a record for 'CountryCode'");
+			goto END_libipv6calc_db_wrapper;
+		};
+
+		*cc_index_ptr = libipv6calc_db_wrapper_cc_index_by_chars(resultstring[0], resultstring[1]);
+		if (*cc_index_ptr == COUNTRYCODE_INDEX_UNKNOWN) {
+			goto END_libipv6calc_db_wrapper;
+		};
+
+		retval = 0;
+
+		EXTERNAL_DB_USAGE_MAP_TAG(External_type);
+		goto END_libipv6calc_db_wrapper;
+	};
+
 	char datastring[IPV6CALC_STRING_MAX];
 	snprintf(datastring, sizeof(datastring), "%s", resultstring); // copy string for strtok
 
@@ -959,6 +1006,33 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/*
+ * get country code of an IPv4/IPv6 address
+ *
+ * in:  ipaddr
+ * mod: country code
+ * out: status of retrievment (0=success, -1=problem)
+ */
+int libipv6calc_db_wrapper_External_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+	return(libipv6calc_db_wrapper_External_country_by_addr(ipaddrp, country, country_len, NULL));
+};
+
+
+/*
+ * get country code index of an IPv4/IPv6 address
+ *
+ * in:  ipaddr
+ * out: cc_index (COUNTRYCODE_INDEX_UNKNOWN in case of problem)
+ */
+uint16_t libipv6calc_db_wrapper_External_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+
+	libipv6calc_db_wrapper_External_country_by_addr(ipaddrp, NULL, 0, &cc_index);
+
+	return(cc_index);
+};
+
+
 /*
  * get info of an IPv4/IPv6 address
  *  stored in REGISTRY db in dedicated table
@@ -1083,174 +1157,53 @@ END_libipv6calc_db_wrapper:
  * database dump
  *
  * in:  selector
- * in:  filter ('External' database only supports CountryCode so far)
+ * in:  filter (validated by libipv6calc_db_dump_filter_check, 'External' database only supports CountryCode so far)
  * in:  formatoptions
- * out: 0=OK
+ * in:  name of set (ipset/nftables, '%CC' creates one set per CountryCode)
+ * in:  dump options (IPV6CALC_DB_DUMP_*)
+ * out: 0=OK, IPV6CALC_DB_DUMP_UNSUPPORTED=filter not supported
  */
-int libipv6calc_db_wrapper_External_dump(const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_ipset) {
+int libipv6calc_db_wrapper_External_dump(const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options) {
 	DB *dbp;
 	long int recno_max, recno, count = 0;
 	char resultstring[IPV6CALC_STRING_MAX];
-	char tempstring[IPV6CALC_STRING_MAX];
 	char filterstring[IPV6CALC_STRING_MAX] = "";
-	char conversionstring[IPV6CALC_STRING_MAX] = "";
 	int result;
 	int retval = -1;
-	char protocol;
-	int i;
 
 	uint32_t value_first_00_31, value_last_00_31;
         uint32_t value_first_32_63, value_last_32_63;
+	uint32_t features;
 
 	const s_ipv6calc_filter_db_cc *filter_db_cc;
 
 	int External_type, key_format;
 
-	char cc2[IPV6CALC_COUNTRYCODE_STRING_MAX];
+	uint64_t mask;
 
-	int prefixlength;
-	uint32_t mask;
-	uint32_t delta;
+	s_ipv6calc_db_dump dump;
 
-	ipv6calc_ipaddr ipaddr, ipaddr2;
-	ipv6calc_ipv6addr ipv6addr;
-	ipv6calc_ipv4addr ipv4addr;
-
-	int print_ipset = 0;
-
-	// general failsafe check
-	if ((formatoptions & FORMATOPTION_print_ipset) > 0) {
-		if (name_ipset == NULL) {
-			ERRORPRINT_NA("Format 'print-ipset <name>' selected but no name provided");
-			return (1);
-		};
-
-		if (strlen(name_ipset) == 0) {
-			ERRORPRINT_NA("Format 'print-ipset <name>' selected but name has zero length");
-			return (1);
-		};
+	// common filter/outputtype validation
+	if (libipv6calc_db_dump_filter_check(selector, filter_master, outputtype, name_set, filterstring, sizeof(filterstring), &features) != 0) {
+		return (1);
+	};
 
-		// enable
-		print_ipset = 1;
+	if ((features & IPV6CALC_DB_IP_TO_AS) != 0) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_External, "ASN filter not supported by 'External' database dump");
+		return (IPV6CALC_DB_DUMP_UNSUPPORTED);
 	};
 
-	// failsafe check per proto
 	switch (selector) {
 	    case IPV6CALC_PROTO_IPV4:
 		External_type = EXTERNAL_DB_IPV4_COUNTRYCODE;
-		protocol = '4';
 		key_format = IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_32x2;
-
-		if (filter_master->filter_ipv4addr.active == 0) {
-			ERRORPRINT_NA("no IPv4 filter provided (-E ...)");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv4addr.filter_db_cc.active == 0) {
-			ERRORPRINT_NA("no IPv4 Database CountryCode filter provided (-E ipv4.db.cc=<CountryCode>)");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv4addr.filter_db_asn.active != 0) {
-			ERRORPRINT_NA("IPv4 ASN filter currently not supported for database dump");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv4addr.filter_db_registry.active != 0) {
-			ERRORPRINT_NA("IPv4 Registry filter currently not supported for database dump");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv4addr.filter_typeinfo.active != 0) {
-			ERRORPRINT_NA("IPv4 TypeInfo filter currently not supported for database dump");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv4addr.filter_addr.active != 0) {
-			ERRORPRINT_NA("IPv4 Address filter currently not supported for database dump");
-			return (1);
-		};
-
 		filter_db_cc = &filter_master->filter_ipv4addr.filter_db_cc;
-
-		// check for supported outputtype
-		switch (outputtype) {
-			case FORMAT_ipv4addr:
-			case FORMAT_ipv6to4:
-			case FORMAT_undefined:
-				// supported
-				break;
-
-			default:
-				ERRORPRINT_WA("Outputtype for IPv4 Address is not supported: 0x%08x", outputtype);
-				return (1);
-				break;
-		};
-
-		// check for supported outputtype
-		switch (outputtype) {
-			case FORMAT_ipv6to4:
-				snprintf(conversionstring, sizeof(conversionstring), "%s", " (output format: 6to4)");
-				break;
-		};
-
 		break;
 
 	    case IPV6CALC_PROTO_IPV6:
 		External_type = EXTERNAL_DB_IPV6_COUNTRYCODE;
-		protocol = '6';
 		key_format = IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_HEX_32x4;
-
-		if (filter_master->filter_ipv6addr.active == 0) {
-			ERRORPRINT_NA("no IPv6 filter provided (-E ...)");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv6addr.filter_db_cc.active == 0) {
-			ERRORPRINT_NA("no IPv6 Database CountryCode filter provided (-E ipv6.db.cc=<CountryCode>)");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv6addr.filter_db_asn.active != 0) {
-			ERRORPRINT_NA("IPv6 ASN filter currently not supported for database dump");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv6addr.filter_db_registry.active != 0) {
-			ERRORPRINT_NA("IPv6 Registry filter currently not supported for database dump");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv6addr.filter_typeinfo.active != 0) {
-			ERRORPRINT_NA("IPv6 TypeInfo filter currently not supported for database dump");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv6addr.filter_typeinfo2.active != 0) {
-			ERRORPRINT_NA("IPv6 TypeInfo filter currently not supported for database dump");
-			return (1);
-		};
-
-		if (filter_master->filter_ipv6addr.filter_addr.active != 0) {
-			ERRORPRINT_NA("IPv6 Address filter currently not supported for database dump");
-			return (1);
-		};
-
 		filter_db_cc = &filter_master->filter_ipv6addr.filter_db_cc;
-
-		// check for supported outputtype
-		switch (outputtype) {
-			case FORMAT_ipv6addr:
-			case FORMAT_undefined:
-				// supported
-				break;
-
-			default:
-				ERRORPRINT_WA("Outputtype for IPv6 Address is not supported: 0x%08x", outputtype);
-				return (1);
-				break;
-		};
-
 		break;
 
 	    default:
@@ -1259,31 +1212,10 @@ int libipv6calc_db_wrapper_External_dump(const int selector, const s_ipv6calc_fi
 		break;
 	};
 
-	// check for unsupported mixed filter
-	if ((filter_db_cc->cc_must_have_max > 0) && (filter_db_cc->cc_may_not_have_max > 0)) {
-		ERRORPRINT_NA("mixed Database filter with 'must-have' and 'may-not-have' is senseless for database dump");
+	if (libipv6calc_db_dump_open(&dump, selector, outputtype, formatoptions, name_set, dump_options) != 0) {
 		return (1);
 	};
 
-	// create filter info string
-	snprintf(resultstring, sizeof(resultstring), "%s", ""); // clear string
-
-	if (filter_db_cc->cc_must_have_max > 0) {
-		for (i = 0; i < filter_db_cc->cc_must_have_max; i++) {
-			libipv6calc_db_wrapper_country_code_by_cc_index(cc2, sizeof(cc2), filter_db_cc->cc_must_have[i]);
-			STRCAT(filterstring, " ");
-			STRCAT(filterstring, cc2);
-		};
-	};
-
-	if (filter_db_cc->cc_may_not_have_max > 0) {
-		for (i = 0; i < filter_db_cc->cc_may_not_have_max; i++) {
-			libipv6calc_db_wrapper_country_code_by_cc_index(cc2, sizeof(cc2), filter_db_cc->cc_may_not_have[i]);
-			STRCAT(filterstring, " ");
-			STRCAT(filterstring, cc2);
-		};
-	};
-
 	// data-info
 	dbp = libipv6calc_db_wrapper_External_open_type(External_type, &recno_max);
 
@@ -1294,22 +1226,8 @@ int libipv6calc_db_wrapper_External_dump(const int selector, const s_ipv6calc_fi
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "database opened type=%x recno_max=%ld dbp=%p", External_type | 0x40000, recno_max, dbp);
 
-	NONQUIETPRINT_WA("# 'External' database dump (with %lu entries) start with filter IPv%c && CountryCode(s):%s%s (suppress this line with option '-q')", recno_max, protocol, filterstring, conversionstring); // filterstring has a trailing space
-
-
-	// print header for 'ipset'
-	// family inet : IPv4
-	// family inet6: IPv6 and IPv4 converted by 6to4
-	if (print_ipset == 1) {
-		// create but don't care if already existing
-		fprintf(stdout, "create %s hash:net family %s counters -exist\n", name_ipset,
-			(selector == IPV6CALC_PROTO_IPV6) ? "inet6" : (
-				(outputtype == FORMAT_ipv6to4) ? "inet6" : "inet")
-		);
+	NONQUIETPRINT_WA("# 'External' database dump (with %lu entries) start with filter %s (suppress this line with option '-q')", recno_max, filterstring);
 
-		// flush ipset
-		fprintf(stdout, "flush %s\n", name_ipset);
-	};
 
 	for (recno = 1; recno <= recno_max; recno++) {
 		result = libipv6calc_db_wrapper_bdb_fetch_row(
@@ -1332,117 +1250,30 @@ int libipv6calc_db_wrapper_External_dump(const int selector, const s_ipv6calc_fi
 
 		int16_t cc_index = libipv6calc_db_wrapper_cc_index_by_country_code(resultstring);
 
-		switch (selector) {
-		    case IPV6CALC_PROTO_IPV4:
-			// countrycode shortcut filter
-			if (libipv6calc_db_cc_filter(cc_index, filter_db_cc) > 0) {
-				continue;
-			};
-
-			count++;
-			libipaddr_clearall(&ipaddr);
-			ipaddr.proto = IPV6CALC_PROTO_IPV4;
-			ipaddr.addr[0] = value_first_00_31;
+		// countrycode shortcut filter
+		if ((filter_db_cc->active != 0) && (libipv6calc_db_cc_filter(cc_index, filter_db_cc) > 0)) {
+			continue;
+		};
 
-			// convert start/end into prefix length
-			delta = value_last_00_31 - value_first_00_31;
+		count++;
 
+		switch (selector) {
+		    case IPV6CALC_PROTO_IPV4:
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "# IPv4 start=0x%08x end=0x%08x CC: %s", value_first_00_31, value_last_00_31, resultstring);
 
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "entry (main   ): ipv4=0x%08x delta=0x%08x", ipaddr.addr[0], delta);
-
-			// backfill with smaller segments if necessary
-			int split = 0;
-			while (delta > 0) {
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "entry (analzye): ipv4=0x%08x delta=0x%08x split=%d", ipaddr.addr[0], delta, split);
-				// calculate base mask from delta
-				prefixlength = 32;
-				mask = 0xffffffff;
-				while (delta >= ~mask) {
-					mask <<= 1;
-					prefixlength--;
-				};
-				mask = ~((~mask) >> 1);
-				prefixlength++;
-
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "entry (check  ): ipv4=0x%08x delta=0x%08x split=%d mask=0x%08x prefixlength=%d", ipaddr.addr[0], delta, split, mask, prefixlength);
-
-				// check whether mask is aligned
-				while ((ipaddr.addr[0] & mask) != ipaddr.addr[0]) {
-					// increase mask/prefixlength
-					mask = ~((~mask) >> 1);
-					prefixlength++;
-                                };
-
-				ipaddr.prefixlength = prefixlength;
-				ipaddr.flag_valid = 1;
-				ipaddr.flag_prefixuse = 1;
-
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "entry (aligned): ipv4=0x%08x delta=0x%08x split=%d mask=0x%08x prefixlength=%d", ipaddr.addr[0], delta, split, mask, prefixlength);
-
-				switch (outputtype) {
-					case FORMAT_ipv6to4:
-						CONVERT_IPADDR_IPV4ADDR(ipaddr, ipv4addr);
-						retval = librfc3056_ipv4addr_to_ipv6to4addr(&ipv6addr, &ipv4addr);
-						CONVERT_IPV6ADDR_IPADDR(ipv6addr, ipaddr2);
-						libipaddr_ipaddrstruct_to_string(&ipaddr2, tempstring, sizeof(tempstring), formatoptions);
-						break;
-
-					default:
-						libipaddr_ipaddrstruct_to_string(&ipaddr, tempstring, sizeof(tempstring), formatoptions);
-						break;
-				};
-
-				if (print_ipset == 1) {
-					fprintf(stdout, "add %s %s\n", name_ipset, tempstring);
-				} else {
-					fprintf(stdout, "%s\n", tempstring);
-				};
-
-				delta -= ~mask;
-				if (delta == 0) {
-					// all covered, finished
-					break;
-				};
-
-				delta--;
-				ipaddr.addr[0] += ~mask + 1;
-				split++;
+			if (libipv6calc_db_dump_range(&dump, (uint16_t) cc_index, value_first_00_31, value_last_00_31) != 0) {
+				goto END_libipv6calc_db_wrapper;
 			};
-
 			break;
 
 		    case IPV6CALC_PROTO_IPV6:
-			// countrycode shortcut filter
-			if (libipv6calc_db_cc_filter(cc_index, filter_db_cc) > 0) {
-				continue;
-			};
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "# IPv6 prefix=%08x:%08x mask=%08x:%08x CC: %s", value_first_00_31, value_first_32_63, value_last_00_31, value_last_32_63, resultstring);
 
-			count++;
-			libipaddr_clearall(&ipaddr);
-			ipaddr.proto = IPV6CALC_PROTO_IPV6;
-			ipaddr.addr[0] = value_first_00_31;
-			ipaddr.addr[1] = value_first_32_63;
-
-			// convert mask into prefix length
-			prefixlength = libipv6calc_bitcount_uint32_t(value_last_00_31);
-
-			if (prefixlength == 32) {
-				// continue with 2nd block
-				prefixlength += libipv6calc_bitcount_uint32_t(value_last_32_63);
-			};
+			// convert prefix/mask into range of upper 64 bits
+			mask = (((uint64_t) value_last_00_31) << 32) | value_last_32_63;
 
-			ipaddr.prefixlength = prefixlength;
-			ipaddr.flag_valid = 1;
-			ipaddr.flag_prefixuse = 1;
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "# IPv6 prefix=%08x:%08x mask=%08x:%08x prefixlength=%d CC: %s", value_first_00_31, value_first_32_63, value_last_00_31, value_last_32_63, prefixlength, resultstring);
-
-			libipaddr_ipaddrstruct_to_string(&ipaddr, tempstring, sizeof(tempstring), formatoptions);
-
-			if (print_ipset == 1) {
-				fprintf(stdout, "add %s %s\n", name_ipset, tempstring);
-			} else {
-				fprintf(stdout, "%s\n", tempstring);
+			if (libipv6calc_db_dump_range(&dump, (uint16_t) cc_index, (((uint64_t) value_first_00_31) << 32) | value_first_32_63, ((((uint64_t) value_first_00_31) << 32) | value_first_32_63) | ~mask) != 0) {
+				goto END_libipv6calc_db_wrapper;
 			};
 			break;
 		};
@@ -1453,7 +1284,11 @@ int libipv6calc_db_wrapper_External_dump(const int selector, const s_ipv6calc_fi
 	retval = 0;
 
 END_libipv6calc_db_wrapper:
-	NONQUIETPRINT_WA("# 'External' database dump finished displaying %lu entries with filter IPv%c && CountryCode(s):%s%s (suppress this line with option '-q')", count, protocol, filterstring, conversionstring); // filterstring has a trailing space
+	if (libipv6calc_db_dump_close(&dump) != 0) {
+		retval = 1;
+	};
+
+	NONQUIETPRINT_WA("# 'External' database dump finished displaying %lu entries (%ld prefixes) with filter %s (suppress this line with option '-q')", count, dump.count, filterstring);
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "retval=%d", retval);
 	return(retval);
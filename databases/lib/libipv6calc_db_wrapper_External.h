@@ -58,6 +58,7 @@ extern int         libipv6calc_db_wrapper_External_wrapper_cleanup(void);
 extern void        libipv6calc_db_wrapper_External_wrapper_info(char* string, const size_t size);
 extern void        libipv6calc_db_wrapper_External_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char       *libipv6calc_db_wrapper_External_wrapper_db_info_used(void);
+extern void        libipv6calc_db_wrapper_External_wrapper_db_info_used_clear(void);
 
 extern int         libipv6calc_db_wrapper_External_has_features(uint32_t features);
 extern time_t      libipv6calc_db_wrapper_External_db_unixtime_by_feature(uint32_t feature);
@@ -79,11 +80,12 @@ extern int libipv6calc_db_wrapper_External_registry_num_by_addr(const ipv6calc_i
 
 // IPv4/v6 CountryCode 
 extern int libipv6calc_db_wrapper_External_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len);
+extern uint16_t libipv6calc_db_wrapper_External_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp);
 
 // IPv4/v6 Info
 extern int libipv6calc_db_wrapper_External_info_by_ipaddr(const ipv6calc_ipaddr *ipaddrp, char *string, const size_t string_len);
 
 // Database dump
-extern int libipv6calc_db_wrapper_External_dump(const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_ipset);
+extern int libipv6calc_db_wrapper_External_dump(const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options);
 
 #endif
@@ -39,7 +39,7 @@ static const db_file_desc2 libipv6calc_db_wrapper_GeoIP2_db_file_desc[] = {
 	{ GeoIP2_DB_COUNTRY_LITE
 		, "GeoLite2-Country.mmdb"
 		, "IPv4/v6 CountryCode (LITE)"
-		, IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY | IPV6CALC_DB_GEOIP
+		, IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY | IPV6CALC_DB_GEOIP
 		, IPV6CALC_DB_GEOIP2_INTERNAL_LITE
 	},
 
@@ -47,7 +47,7 @@ static const db_file_desc2 libipv6calc_db_wrapper_GeoIP2_db_file_desc[] = {
 	{ GeoIP2_DB_CITY_LITE
 		, "GeoLite2-City.mmdb"
 		, "IPv4/v6 City (LITE)"
-		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_GEOIP | IPV6CALC_DB_IP_TO_GEONAMEID
+		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_GEOIP | IPV6CALC_DB_IP_TO_GEONAMEID
 		, IPV6CALC_DB_GEOIP2_INTERNAL_LITE
 	},
 
@@ -63,7 +63,7 @@ static const db_file_desc2 libipv6calc_db_wrapper_GeoIP2_db_file_desc[] = {
 	{ GeoIP2_DB_COUNTRY
 		, "Geo2-Country.mmdb"
 		, "IPv4/v6 CountryCode (COMM)"
-		, IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY | IPV6CALC_DB_GEOIP
+		, IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_IP_TO_GEONAMEID | IPV6CALC_DB_IP_TO_COUNTRY | IPV6CALC_DB_GEOIP
 		, IPV6CALC_DB_GEOIP2_INTERNAL_COMM
 	},
 
@@ -71,7 +71,7 @@ static const db_file_desc2 libipv6calc_db_wrapper_GeoIP2_db_file_desc[] = {
 	{ GeoIP2_DB_CITY
 		, "Geo2-City.mmdb"
 		, "IPv4/v6 City (COMM)"
-		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_GEOIP | IPV6CALC_DB_IP_TO_GEONAMEID
+		, IPV6CALC_DB_IP_TO_CITY | IPV6CALC_DB_IP_TO_REGION | IPV6CALC_DB_IP_TO_CC | IPV6CALC_DB_IP_DUMP_CC | IPV6CALC_DB_GEOIP | IPV6CALC_DB_IP_TO_GEONAMEID
 		, IPV6CALC_DB_GEOIP2_INTERNAL_COMM
 	},
 
@@ -135,6 +135,7 @@ char geoip2_db_usage_string[IPV6CALC_STRING_MAX] = "";
 
 // local cache
 static MMDB_s mmdb_cache[GeoIP2_DB_MAX+1];
+static s_libipv6calc_db_wrapper_file_state mmdb_file_state[GeoIP2_DB_MAX+1];
 
 // local prototyping
 static char *libipv6calc_db_wrapper_GeoIP2_dbfilename(const unsigned int type);
@@ -576,6 +577,17 @@ char *libipv6calc_db_wrapper_GeoIP2_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: clear information regarding used databases (e.g. between records in pipe mode)
+ */
+void libipv6calc_db_wrapper_GeoIP2_wrapper_db_info_used_clear(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Called");
+
+	memset(geoip2_db_usage_map, 0, sizeof(geoip2_db_usage_map));
+	geoip2_db_usage_string[0] = '\0';
+};
+
+
 /*******************************
  * Wrapper extension functions for GeoIP2
  *******************************/
@@ -700,6 +712,21 @@ int libipv6calc_db_wrapper_GeoIP2_open_type(const unsigned int type) {
 		// already open
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Database already opened (cached) type=%d", type);
 		ret = MMDB_SUCCESS;
+
+		if (libipv6calc_db_wrapper_file_state_changed(mmdb_cache[type].filename, &mmdb_file_state[type]) == 1) {
+			// open changed database first, swap on success and close old one afterwards (keep old one on error)
+			MMDB_s mmdb_new, mmdb_old;
+
+			if (libipv6calc_db_wrapper_MMDB_open(mmdb_cache[type].filename, MMDB_MODE_MMAP, &mmdb_new) == MMDB_SUCCESS) {
+				mmdb_old = mmdb_cache[type];
+				mmdb_cache[type] = mmdb_new;
+				libipv6calc_db_wrapper_MMDB_close(&mmdb_old);
+				libipv6calc_db_wrapper_reloaded(mmdb_cache[type].filename, &mmdb_file_state[type]);
+			} else {
+				NONQUIETPRINT_WA("Database reload failed, keep current one: %s", mmdb_cache[type].filename);
+			};
+		};
+
 		goto END_libipv6calc_db_wrapper;
 	};
 
@@ -730,6 +757,8 @@ int libipv6calc_db_wrapper_GeoIP2_open_type(const unsigned int type) {
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Database successfully opened (fill-cache), type=%d", type);
 
+	libipv6calc_db_wrapper_file_state_store(filename, &mmdb_file_state[type]);
+
 END_libipv6calc_db_wrapper:
 	return(ret);
 };
@@ -844,8 +873,8 @@ int libipv6calc_db_wrapper_GeoIP2_has_features(uint32_t features) {
 };
 
 
-/* country code */
-int libipv6calc_db_wrapper_GeoIP2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+/* country code (text) or country code index (country == NULL, cc_index_ptr != NULL) */
+static int libipv6calc_db_wrapper_GeoIP2_wrapper_country_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, uint16_t *cc_index_ptr) {
 	int result = MMDB_INVALID_DATA_ERROR;
 
 	int GeoIP2_type = 0;
@@ -876,14 +905,19 @@ int libipv6calc_db_wrapper_GeoIP2_wrapper_country_code_by_addr(const ipv6calc_ip
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	result = libipv6calc_db_wrapper_MMDB_country_code_by_addr(ipaddrp, country, country_len, &mmdb_cache[GeoIP2_type]);
- 
+	if (country != NULL) {
+		result = libipv6calc_db_wrapper_MMDB_country_code_by_addr(ipaddrp, country, country_len, &mmdb_cache[GeoIP2_type]);
+	} else {
+		*cc_index_ptr = libipv6calc_db_wrapper_MMDB_cc_index_by_addr(ipaddrp, &mmdb_cache[GeoIP2_type]);
+		result = (*cc_index_ptr != COUNTRYCODE_INDEX_UNKNOWN) ? MMDB_SUCCESS : MMDB_INVALID_DATA_ERROR;
+	};
+
 	if (result != MMDB_SUCCESS) {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "no match found");
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "result country=%s", country);
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "result country=%s cc_index=%u", (country != NULL) ? country : "-", (country != NULL) ? COUNTRYCODE_INDEX_UNKNOWN : *cc_index_ptr);
 
 	GeoIP2_DB_USAGE_MAP_TAG(GeoIP2_type);
 
@@ -892,6 +926,22 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/* country code */
+int libipv6calc_db_wrapper_GeoIP2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+	return(libipv6calc_db_wrapper_GeoIP2_wrapper_country_by_addr(ipaddrp, country, country_len, NULL));
+};
+
+
+/* country code index */
+uint16_t libipv6calc_db_wrapper_GeoIP2_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+
+	libipv6calc_db_wrapper_GeoIP2_wrapper_country_by_addr(ipaddrp, NULL, 0, &cc_index);
+
+	return(cc_index);
+};
+
+
 /*
  * get AS 32-bit number and orgname (optional)
  * in : ipaddrp (mandatory)
@@ -1092,4 +1142,79 @@ END_libipv6calc_db_wrapper:
 	return(result);
 };
 
+
+/*
+ * database dump (full search tree traversal)
+ *
+ * in:  selector
+ * in:  filter (CountryCode and/or ASN)
+ * in:  outputtype
+ * in:  formatoptions
+ * in:  name of set (ipset/nftables, '%CC' creates one set per CountryCode)
+ * in:  dump options (IPV6CALC_DB_DUMP_*)
+ * out: 0=OK
+ */
+int libipv6calc_db_wrapper_GeoIP2_dump(const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t outputtype, const uint32_t formatoptions, const char *name_set, const uint32_t dump_options) {
+	char filterstring[IPV6CALC_STRING_MAX] = "";
+	s_ipv6calc_db_dump dump;
+	uint32_t features;
+	long int count = 0;
+	int GeoIP2_type = 0, GeoIP2_type_asn;
+	int retval = 1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Called: %s selector=%d", wrapper_geoip2_info, selector);
+
+	if (libipv6calc_db_dump_filter_check(selector, filter_master, outputtype, name_set, filterstring, sizeof(filterstring), &features) != 0) {
+		return(1);
+	};
+
+	// select database by required features
+	if ((features & IPV6CALC_DB_IP_DUMP_CC) != 0) {
+		GeoIP2_type = (selector == IPV6CALC_PROTO_IPV4) ? geoip2_db_country_v4 : geoip2_db_country_v6;
+	};
+
+	if ((features & IPV6CALC_DB_IP_TO_AS) != 0) {
+		GeoIP2_type_asn = (selector == IPV6CALC_PROTO_IPV4) ? geoip2_db_asn_v4 : geoip2_db_asn_v6;
+
+		if (GeoIP2_type == 0) {
+			GeoIP2_type = GeoIP2_type_asn;
+		} else if (GeoIP2_type != GeoIP2_type_asn) {
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "combined CountryCode and ASN filter requires a GeoIP2 database providing both");
+			return(IPV6CALC_DB_DUMP_UNSUPPORTED);
+		};
+	};
+
+	if (GeoIP2_type == 0) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "no GeoIP2 database available supporting dump with given filter");
+		return(IPV6CALC_DB_DUMP_UNSUPPORTED);
+	};
+
+	if (libipv6calc_db_wrapper_GeoIP2_open_type(GeoIP2_type) != MMDB_SUCCESS) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Error opening GeoIP2 by type");
+		return(1);
+	};
+
+	if (libipv6calc_db_dump_open(&dump, selector, outputtype, formatoptions, name_set, dump_options) != 0) {
+		return(1);
+	};
+
+	NONQUIETPRINT_WA("# 'GeoIP2' database dump of %s (%u search tree nodes) start with filter %s (suppress this line with option '-q')", libipv6calc_db_wrapper_GeoIP2_dbdescription(GeoIP2_type), mmdb_cache[GeoIP2_type].metadata.node_count, filterstring);
+
+	count = libipv6calc_db_wrapper_MMDB_dump(&mmdb_cache[GeoIP2_type], selector, filter_master, features, &dump);
+
+	if (count >= 0) {
+		GeoIP2_DB_USAGE_MAP_TAG(GeoIP2_type);
+		retval = 0;
+	};
+
+	if (libipv6calc_db_dump_close(&dump) != 0) {
+		retval = 1;
+	};
+
+	NONQUIETPRINT_WA("# 'GeoIP2' database dump finished displaying %ld entries (%ld prefixes) with filter %s (suppress this line with option '-q')", count, dump.count, filterstring);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "retval=%d", retval);
+	return(retval);
+};
+
 #endif
@@ -591,6 +591,7 @@ char ip2location_db_usage_string[IPV6CALC_STRING_MAX] = "";
 
 // local cache
 static IP2Location *db_ptr_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc)];
+static s_libipv6calc_db_wrapper_file_state db_file_state[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc)];
 
 // local prototyping
 static char     *libipv6calc_db_wrapper_IP2Location_dbfilename(const unsigned int type); 
@@ -1269,6 +1270,17 @@ char *libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: clear information regarding used databases (e.g. between records in pipe mode)
+ */
+void libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used_clear(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Called");
+
+	memset(ip2location_db_usage_map, 0, sizeof(ip2location_db_usage_map));
+	ip2location_db_usage_string[0] = '\0';
+};
+
+
 
 #ifdef SUPPORT_IP2LOCATION
 
@@ -1473,6 +1485,25 @@ IP2Location *libipv6calc_db_wrapper_IP2Location_open_type(const unsigned int typ
 		loc = db_ptr_cache[entry];
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Database already opened (cached) loc=%p type=%d", loc, type);
+
+		if (wrapper_reload_interval > 0) {
+			filename = libipv6calc_db_wrapper_IP2Location_dbfilename(type);
+
+			if (libipv6calc_db_wrapper_file_state_changed(filename, &db_file_state[entry]) == 1) {
+				// open changed database first, swap on success and close old one afterwards (keep old one on error)
+				IP2Location *loc_new = libipv6calc_db_wrapper_IP2Location_open(filename);
+
+				if (loc_new != NULL) {
+					libipv6calc_db_wrapper_IP2Location_close(loc);
+					db_ptr_cache[entry] = loc_new;
+					loc = loc_new;
+					libipv6calc_db_wrapper_reloaded(filename, &db_file_state[entry]);
+				} else {
+					NONQUIETPRINT_WA("Database reload failed, keep current one: %s", filename);
+				};
+			};
+		};
+
 		goto END_libipv6calc_db_wrapper;
 	} else {
 		filename = libipv6calc_db_wrapper_IP2Location_dbfilename(type);
@@ -1488,6 +1519,7 @@ IP2Location *libipv6calc_db_wrapper_IP2Location_open_type(const unsigned int typ
 		};
 
 		db_ptr_cache[entry] = loc;
+		libipv6calc_db_wrapper_file_state_store(filename, &db_file_state[entry]);
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Database successfully opened (fill-cache), loc=%p type=%d", loc, type);
 	};
@@ -1872,8 +1904,8 @@ int libipv6calc_db_wrapper_IP2Location_has_features(uint32_t features) {
 };
 
 
-/* country_code */
-int libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_addr(char *addr, const int proto, char *country, const size_t country_len) {
+/* country_code (text) or country code index (country == NULL, cc_index_ptr != NULL) */
+static int libipv6calc_db_wrapper_IP2Location_wrapper_country_by_addr(char *addr, const int proto, char *country, const size_t country_len, uint16_t *cc_index_ptr) {
 	IP2Location *loc;
 	IP2LocationRecord *record = NULL;
 	int result = -1;
@@ -1956,7 +1988,14 @@ int libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_addr(char *addr,
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "country_short code: %s", IP2Location_result_ptr);
 
-	snprintf(country, country_len, "%s", IP2Location_result_ptr);
+	if (country != NULL) {
+		snprintf(country, country_len, "%s", IP2Location_result_ptr);
+	} else {
+		*cc_index_ptr = (IP2Location_result_ptr[0] != '\0') ? libipv6calc_db_wrapper_cc_index_by_chars(IP2Location_result_ptr[0], IP2Location_result_ptr[1]) : COUNTRYCODE_INDEX_UNKNOWN;
+		if (*cc_index_ptr == COUNTRYCODE_INDEX_UNKNOWN) {
+			goto END_libipv6calc_db_wrapper;
+		};
+	};
 	result = 0;
 
 	IP2LOCATION_DB_USAGE_MAP_TAG(IP2Location_type);
@@ -1969,6 +2008,29 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/* country_code */
+int libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_addr(char *addr, const int proto, char *country, const size_t country_len) {
+	return(libipv6calc_db_wrapper_IP2Location_wrapper_country_by_addr(addr, proto, country, country_len, NULL));
+};
+
+
+/* country code index, library API requires the address in text form */
+uint16_t libipv6calc_db_wrapper_IP2Location_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+	char addrstring[IPV6CALC_ADDR_STRING_MAX] = "";
+
+	if (libipaddr_ipaddrstruct_to_string(ipaddrp, addrstring, sizeof(addrstring), 0) != 0) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Error converting address object into string");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	libipv6calc_db_wrapper_IP2Location_wrapper_country_by_addr(addrstring, ipaddrp->proto, NULL, 0, &cc_index);
+
+END_libipv6calc_db_wrapper:
+	return(cc_index);
+};
+
+
 #if API_VERSION_NUMERIC >= 80600
 /*
  * get AS 32-bit number and orgname (optional)
@@ -220,8 +220,10 @@ extern uint32_t    libipv6calc_db_wrapper_IP2Location_wrapper_asn_by_addr(const
 extern void        libipv6calc_db_wrapper_IP2Location_wrapper_info(char* string, const size_t size);
 extern void        libipv6calc_db_wrapper_IP2Location_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char       *libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used(void);
+extern void        libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used_clear(void);
 
 extern int         libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_addr(char *addr, const int proto, char *country, const size_t country_len);
+extern uint16_t    libipv6calc_db_wrapper_IP2Location_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp);
 
 extern int         libipv6calc_db_wrapper_IP2Location_has_features(uint32_t features);
 
@@ -324,6 +324,7 @@ char ip2location2_db_usage_string[IPV6CALC_STRING_MAX] = "";
 
 // local cache
 static MMDB_s mmdb_cache[IP2LOCATION2_DB_MAX+1];
+static s_libipv6calc_db_wrapper_file_state mmdb_file_state[IP2LOCATION2_DB_MAX+1];
 
 // local prototyping
 static char *libipv6calc_db_wrapper_IP2Location2_dbfilename(const unsigned int type); 
@@ -878,6 +879,17 @@ char *libipv6calc_db_wrapper_IP2Location2_wrapper_db_info_used(void) {
 };
 
 
+/*
+ * wrapper: clear information regarding used databases (e.g. between records in pipe mode)
+ */
+void libipv6calc_db_wrapper_IP2Location2_wrapper_db_info_used_clear(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_IP2Location2, "Called");
+
+	memset(ip2location2_db_usage_map, 0, sizeof(ip2location2_db_usage_map));
+	ip2location2_db_usage_string[0] = '\0';
+};
+
+
 
 /*******************************
  * Wrapper extension functions for IP2Location
@@ -1020,6 +1032,21 @@ int libipv6calc_db_wrapper_IP2Location2_open_type(const unsigned int type) {
 		// already open
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location2, "Database already opened (cached) type=%d", type);
 		ret = MMDB_SUCCESS;
+
+		if (libipv6calc_db_wrapper_file_state_changed(mmdb_cache[type].filename, &mmdb_file_state[type]) == 1) {
+			// open changed database first, swap on success and close old one afterwards (keep old one on error)
+			MMDB_s mmdb_new, mmdb_old;
+
+			if (libipv6calc_db_wrapper_MMDB_open(mmdb_cache[type].filename, MMDB_MODE_MMAP, &mmdb_new) == MMDB_SUCCESS) {
+				mmdb_old = mmdb_cache[type];
+				mmdb_cache[type] = mmdb_new;
+				libipv6calc_db_wrapper_MMDB_close(&mmdb_old);
+				libipv6calc_db_wrapper_reloaded(mmdb_cache[type].filename, &mmdb_file_state[type]);
+			} else {
+				NONQUIETPRINT_WA("Database reload failed, keep current one: %s", mmdb_cache[type].filename);
+			};
+		};
+
 		goto END_libipv6calc_db_wrapper;
 	};
 
@@ -1048,6 +1075,8 @@ int libipv6calc_db_wrapper_IP2Location2_open_type(const unsigned int type) {
 		goto END_libipv6calc_db_wrapper;
 	};
 
+	libipv6calc_db_wrapper_file_state_store(filename, &mmdb_file_state[type]);
+
 END_libipv6calc_db_wrapper:
 	return(ret);
 };
@@ -1176,8 +1205,8 @@ int libipv6calc_db_wrapper_IP2Location2_has_features(uint32_t features) {
 };
 
 
-/* country_code */
-int libipv6calc_db_wrapper_IP2Location2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+/* country code (text) or country code index (country == NULL, cc_index_ptr != NULL) */
+static int libipv6calc_db_wrapper_IP2Location2_wrapper_country_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, uint16_t *cc_index_ptr) {
 	int result = MMDB_INVALID_DATA_ERROR;
 
 	unsigned int IP2Location2_type = 0;
@@ -1228,14 +1257,19 @@ int libipv6calc_db_wrapper_IP2Location2_wrapper_country_code_by_addr(const ipv6c
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	result = libipv6calc_db_wrapper_MMDB_country_code_by_addr(ipaddrp, country, country_len, &mmdb_cache[IP2Location2_type]);
- 
+	if (country != NULL) {
+		result = libipv6calc_db_wrapper_MMDB_country_code_by_addr(ipaddrp, country, country_len, &mmdb_cache[IP2Location2_type]);
+	} else {
+		*cc_index_ptr = libipv6calc_db_wrapper_MMDB_cc_index_by_addr(ipaddrp, &mmdb_cache[IP2Location2_type]);
+		result = (*cc_index_ptr != COUNTRYCODE_INDEX_UNKNOWN) ? MMDB_SUCCESS : MMDB_INVALID_DATA_ERROR;
+	};
+
 	if (result != MMDB_SUCCESS) {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_IP2Location2, "no match found");
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location2, "result country=%s", country);
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location2, "result country=%s cc_index=%u", (country != NULL) ? country : "-", (country != NULL) ? COUNTRYCODE_INDEX_UNKNOWN : *cc_index_ptr);
 
 	IP2LOCATION2_DB_USAGE_MAP_TAG(IP2Location2_type);
 
@@ -1244,6 +1278,22 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/* country code */
+int libipv6calc_db_wrapper_IP2Location2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+	return(libipv6calc_db_wrapper_IP2Location2_wrapper_country_by_addr(ipaddrp, country, country_len, NULL));
+};
+
+
+/* country code index */
+uint16_t libipv6calc_db_wrapper_IP2Location2_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+
+	libipv6calc_db_wrapper_IP2Location2_wrapper_country_by_addr(ipaddrp, NULL, 0, &cc_index);
+
+	return(cc_index);
+};
+
+
 /*
  * get AS 32-bit number and orgname (optional)
  * in : ipaddrp (mandatory)
@@ -145,8 +145,10 @@ extern uint32_t    libipv6calc_db_wrapper_IP2Location2_wrapper_GeonameID_by_addr
 extern void        libipv6calc_db_wrapper_IP2Location2_wrapper_info(char* string, const size_t size);
 extern void        libipv6calc_db_wrapper_IP2Location2_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char       *libipv6calc_db_wrapper_IP2Location2_wrapper_db_info_used(void);
+extern void        libipv6calc_db_wrapper_IP2Location2_wrapper_db_info_used_clear(void);
 
 extern int         libipv6calc_db_wrapper_IP2Location2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len);
+extern uint16_t    libipv6calc_db_wrapper_IP2Location2_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp);
 
 extern int         libipv6calc_db_wrapper_IP2Location2_has_features(uint32_t features);
 
@@ -11,6 +11,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <dlfcn.h>
 #include <string.h>
 
@@ -65,6 +66,10 @@ static int dl_status_MMDB_strerror = IPV6CALC_DL_STATUS_UNKNOWN;
 typedef const char *(*dl_MMDB_strerror_t)(int error_code);
 static union { dl_MMDB_strerror_t func; void * obj; } dl_MMDB_strerror;
 
+static int dl_status_MMDB_read_node = IPV6CALC_DL_STATUS_UNKNOWN;
+typedef int (*dl_MMDB_read_node_t)(const MMDB_s *const mmdb, uint32_t node_number, MMDB_search_node_s *const node);
+static union { dl_MMDB_read_node_t func; void * obj; } dl_MMDB_read_node;
+
 #else // SUPPORT_MMDB_DYN
 static const char* wrapper_mmdb_info = "built-in";
 #endif // SUPPORT_MMDB_DYN
@@ -680,6 +685,51 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/*
+ * wrapper: MMDB_read_node
+ */
+int libipv6calc_db_wrapper_MMDB_read_node (const MMDB_s *const mmdb, uint32_t node_number, MMDB_search_node_s *const node) {
+#ifdef SUPPORT_MMDB_DYN
+	int result_MMDB_read_node = MMDB_INVALID_NODE_NUMBER_ERROR;
+	const char *dl_symbol = "MMDB_read_node";
+	char *error;
+
+	if (dl_MMDB_handle == NULL) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMDB, "dl_MMDB_handle not defined");
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	if (dl_status_MMDB_read_node == IPV6CALC_DL_STATUS_UNKNOWN) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "Call dlsym: %s", dl_symbol);
+
+		dlerror();    /* Clear any existing error */
+
+		*(void **) (&dl_MMDB_read_node.obj) = dlsym(dl_MMDB_handle, dl_symbol);
+
+		if ((error = dlerror()) != NULL)  {
+			dl_status_MMDB_read_node = IPV6CALC_DL_STATUS_ERROR;
+			fprintf(stderr, "%s\n", error);
+			goto END_libipv6calc_db_wrapper;
+		};
+
+		dl_status_MMDB_read_node = IPV6CALC_DL_STATUS_OK;
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "Called dlsym successful: %s", dl_symbol);
+	} else if (dl_status_MMDB_read_node == IPV6CALC_DL_STATUS_ERROR) {
+		/* already known issue */
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	// called once per search tree node on database dump, no debug/dlerror per call
+	result_MMDB_read_node = (*dl_MMDB_read_node.func)(mmdb, node_number, node);
+
+END_libipv6calc_db_wrapper:
+	return(result_MMDB_read_node);
+#else
+	return(MMDB_read_node(mmdb, node_number, node));
+#endif
+};
+
+
 /*
  * wrapper: MMDB_strerror
  */
@@ -784,44 +834,30 @@ END_libipv6calc_db_wrapper:
 };
 
 
-/* Country Code By Addr
- * in : ipaddrp, country_len, country, mmdb
- * mod: country
+/* Country Code entry of data record (country with fallback to registered_country)
+ * in : entry
+ * mod: entry_data
  * out: mmdb_error
  */
-int libipv6calc_db_wrapper_MMDB_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, MMDB_s *const mmdb) {
-	MMDB_lookup_result_s lookup_result;
-	MMDB_entry_data_s entry_data;
-	int mmdb_error = MMDB_INVALID_DATA_ERROR;
-
-	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
-
-	if (mmdb_error != MMDB_SUCCESS) {
-		goto END_libipv6calc_db_wrapper;
-	};
+static int libipv6calc_db_wrapper_MMDB_country_code_entry(MMDB_entry_s *const entry, MMDB_entry_data_s *entry_data) {
+	int mmdb_error = MMDB_SUCCESS;
 
 	// fetch CountryCode
 	const char *lookup_path_country_code[] = { "country", "iso_code", NULL };
-	libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_country_code);
-	if (entry_data.has_data) {
-		if (entry_data.type == MMDB_DATA_TYPE_UTF8_STRING) {
-			int max = (entry_data.data_size + 1 > country_len) ? country_len : entry_data.data_size +1;
-			snprintf(country, max , "%s", entry_data.utf8_string);
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "CountryCode: %s", country);
-		} else {
-			ERRORPRINT_WA("Lookup result from MaxMindDB has unexpected type for CountryCode: %u", entry_data.type);
+	libipv6calc_db_wrapper_MMDB_aget_value(entry, entry_data, lookup_path_country_code);
+	if (entry_data->has_data) {
+		if (entry_data->type != MMDB_DATA_TYPE_UTF8_STRING) {
+			ERRORPRINT_WA("Lookup result from MaxMindDB has unexpected type for CountryCode: %u", entry_data->type);
+			mmdb_error = MMDB_INVALID_DATA_ERROR;
 		};
 	} else {
 		// fetch CountryCode from fallback (registered_country)
 		const char *lookup_path_registered_country_code[] = { "registered_country", "iso_code", NULL };
-		libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_registered_country_code);
-		if (entry_data.has_data) {
-			if (entry_data.type == MMDB_DATA_TYPE_UTF8_STRING) {
-				int max = (entry_data.data_size + 1 > country_len) ? country_len : entry_data.data_size +1;
-				snprintf(country, max , "%s", entry_data.utf8_string);
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "CountryCode(Registered): %s", country);
-			} else {
-				ERRORPRINT_WA("Lookup result from MaxMindDB has unexpected type for CountryCode(Registered): %u", entry_data.type);
+		libipv6calc_db_wrapper_MMDB_aget_value(entry, entry_data, lookup_path_registered_country_code);
+		if (entry_data->has_data) {
+			if (entry_data->type != MMDB_DATA_TYPE_UTF8_STRING) {
+				ERRORPRINT_WA("Lookup result from MaxMindDB has unexpected type for CountryCode(Registered): %u", entry_data->type);
+				mmdb_error = MMDB_INVALID_DATA_ERROR;
 			};
 		} else {
 			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMDB, "CountryCode not found");
@@ -829,35 +865,110 @@ int libipv6calc_db_wrapper_MMDB_country_code_by_addr(const ipv6calc_ipaddr *ipad
 		};
 	};
 
-END_libipv6calc_db_wrapper:
 	return(mmdb_error);
 };
 
 
-/* ASN By Addr
+/* Country Code entry By Addr (country with fallback to registered_country)
  * in : ipaddrp, mmdb
- * out: asn
+ * mod: entry_data
+ * out: mmdb_error
  */
-uint32_t libipv6calc_db_wrapper_MMDB_asn_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb) {
+static int libipv6calc_db_wrapper_MMDB_country_code_entry_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_entry_data_s *entry_data, MMDB_s *const mmdb) {
 	MMDB_lookup_result_s lookup_result;
-	MMDB_entry_data_s entry_data;
 	int mmdb_error = MMDB_INVALID_DATA_ERROR;
-	uint32_t result = ASNUM_AS_UNKNOWN;
 
 	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
 
 	if (mmdb_error != MMDB_SUCCESS) {
+		return(mmdb_error);
+	};
+
+	return(libipv6calc_db_wrapper_MMDB_country_code_entry(&lookup_result.entry, entry_data));
+};
+
+
+/* Country Code By Addr
+ * in : ipaddrp, country_len, country, mmdb
+ * mod: country
+ * out: mmdb_error
+ */
+int libipv6calc_db_wrapper_MMDB_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, MMDB_s *const mmdb) {
+	MMDB_entry_data_s entry_data;
+	int mmdb_error;
+
+	mmdb_error = libipv6calc_db_wrapper_MMDB_country_code_entry_by_addr(ipaddrp, &entry_data, mmdb);
+
+	if (mmdb_error == MMDB_SUCCESS) {
+		int max = (entry_data.data_size + 1 > country_len) ? country_len : entry_data.data_size +1;
+		snprintf(country, max , "%s", entry_data.utf8_string);
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "CountryCode: %s", country);
+	};
+
+	return(mmdb_error);
+};
+
+
+/* Country Code index of data record (taken directly from the data, no string copy)
+ * in : entry
+ * out: cc_index (COUNTRYCODE_INDEX_UNKNOWN if not found)
+ */
+uint16_t libipv6calc_db_wrapper_MMDB_cc_index_by_entry(MMDB_entry_s *const entry) {
+	MMDB_entry_data_s entry_data;
+	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+
+	if (libipv6calc_db_wrapper_MMDB_country_code_entry(entry, &entry_data) != MMDB_SUCCESS) {
 		goto END_libipv6calc_db_wrapper;
 	};
 
+	if (entry_data.data_size != 2) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "CountryCode has unexpected length: %u", entry_data.data_size);
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	cc_index = libipv6calc_db_wrapper_cc_index_by_chars(entry_data.utf8_string[0], entry_data.utf8_string[1]);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "CountryCode index: %u", cc_index);
+
+END_libipv6calc_db_wrapper:
+	return(cc_index);
+};
+
+
+/* Country Code index By Addr (taken directly from the data, no string copy)
+ * in : ipaddrp, mmdb
+ * out: cc_index (COUNTRYCODE_INDEX_UNKNOWN if not found)
+ */
+uint16_t libipv6calc_db_wrapper_MMDB_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb) {
+	MMDB_lookup_result_s lookup_result;
+	int mmdb_error = MMDB_INVALID_DATA_ERROR;
+
+	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
+
+	if (mmdb_error != MMDB_SUCCESS) {
+		return(COUNTRYCODE_INDEX_UNKNOWN);
+	};
+
+	return(libipv6calc_db_wrapper_MMDB_cc_index_by_entry(&lookup_result.entry));
+};
+
+
+/* ASN of data record
+ * in : entry, mmdb
+ * out: asn
+ */
+uint32_t libipv6calc_db_wrapper_MMDB_asn_by_entry(MMDB_entry_s *const entry, MMDB_s *const mmdb) {
+	MMDB_entry_data_s entry_data;
+	uint32_t result = ASNUM_AS_UNKNOWN;
+
 	// fetch ASN
 	if(strstr(mmdb->metadata.database_type, "ASN")) {
 		// GeoLite2-ASN
 		const char *lookup_path_asn[] = { "autonomous_system_number", NULL };
-		libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_asn);
+		libipv6calc_db_wrapper_MMDB_aget_value(entry, &entry_data, lookup_path_asn);
 	} else {
 		const char *lookup_path_asn[] = { "traits", "autonomous_system_number", NULL };
-		libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_asn);
+		libipv6calc_db_wrapper_MMDB_aget_value(entry, &entry_data, lookup_path_asn);
 	};
 	if (entry_data.has_data) {
 		if (entry_data.type == MMDB_DATA_TYPE_UINT32) {
@@ -868,14 +979,30 @@ uint32_t libipv6calc_db_wrapper_MMDB_asn_by_addr(const ipv6calc_ipaddr *ipaddrp,
 		};
 	} else {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMDB, "ASN not found");
-		mmdb_error = MMDB_INVALID_DATA_ERROR;
 	};
 
-END_libipv6calc_db_wrapper:
 	return(result);
 };
 
 
+/* ASN By Addr
+ * in : ipaddrp, mmdb
+ * out: asn
+ */
+uint32_t libipv6calc_db_wrapper_MMDB_asn_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb) {
+	MMDB_lookup_result_s lookup_result;
+	int mmdb_error = MMDB_INVALID_DATA_ERROR;
+
+	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
+
+	if (mmdb_error != MMDB_SUCCESS) {
+		return(ASNUM_AS_UNKNOWN);
+	};
+
+	return(libipv6calc_db_wrapper_MMDB_asn_by_entry(&lookup_result.entry, mmdb));
+};
+
+
 /* GeonameID By Addr
  * in : ipaddrp, mmdb
  * mod: source
@@ -1149,4 +1276,258 @@ END_libipv6calc_db_wrapper:
 	return(mmdb_error);
 };
 
+
+/***********************************************
+ * Database dump by search tree traversal
+ ***********************************************/
+
+/* decoded data record, cached by data section offset (records are shared by many networks) */
+typedef struct {
+	uint32_t key;		// data section offset + 1, 0: unused
+	uint16_t cc_index;
+	int      flag_skip;	// =1: record filtered out
+} s_libipv6calc_db_wrapper_MMDB_dump_record;
+
+/* pending record of the search tree traversal */
+typedef struct {
+	uint8_t      type;	// MMDB_RECORD_TYPE_*
+	uint32_t     node;
+	MMDB_entry_s entry;
+	int          depth;
+	uint64_t     prefix;	// IPv4: 32 bit, IPv6: upper 64 bit
+} s_libipv6calc_db_wrapper_MMDB_dump_item;
+
+#define MMDB_DUMP_CACHE_SIZE_MIN	4096	// power of 2
+#define MMDB_DUMP_STACK_MAX		(2 * 128 + 2)
+
+
+/* record cache slot for a data section offset (open addressing)
+ * in : cache, size, offset
+ * out: slot (key == 0: not cached)
+ */
+static s_libipv6calc_db_wrapper_MMDB_dump_record *libipv6calc_db_wrapper_MMDB_dump_cache_slot(s_libipv6calc_db_wrapper_MMDB_dump_record *cache, const uint32_t size, const uint32_t offset) {
+	uint32_t i = (offset * 2654435761U) & (size - 1);
+
+	while ((cache[i].key != 0) && (cache[i].key != offset + 1)) {
+		i = (i + 1) & (size - 1);
+	};
+
+	return(&cache[i]);
+};
+
+
+/* database dump by full search tree traversal
+ *  each data record is decoded only once, ranges are fed in ascending order into libipv6calc_db_dump_range
+ * in : mmdb, selector, filter_master, features (IPV6CALC_DB_IP*_DUMP_CC: decode CountryCode, IPV6CALC_DB_IP*_TO_AS: decode ASN), dump
+ * out: number of ranges passing the filter, < 0: error
+ */
+long int libipv6calc_db_wrapper_MMDB_dump(MMDB_s *const mmdb, const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t features, s_ipv6calc_db_dump *dump) {
+	s_libipv6calc_db_wrapper_MMDB_dump_item stack[MMDB_DUMP_STACK_MAX], item;
+	s_libipv6calc_db_wrapper_MMDB_dump_record *cache = NULL, *cache_new, *record;
+	uint32_t cache_size = MMDB_DUMP_CACHE_SIZE_MIN, cache_used = 0, i;
+	const s_ipv6calc_filter_db_cc *filter_db_cc;
+	const s_ipv6calc_filter_db_asn *filter_db_asn;
+	MMDB_search_node_s search_node;
+	uint32_t node_ipv4 = UINT32_MAX;
+	uint64_t first, last, last_first = 0, last_last = 0;
+	uint16_t last_cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+	long int count = 0, records = 0;
+	int sp = 0, bits, depth, flag_last = 0;
+	int mmdb_error;
+
+	switch (selector) {
+	    case IPV6CALC_PROTO_IPV4:
+		bits = 32;
+		filter_db_cc = &filter_master->filter_ipv4addr.filter_db_cc;
+		filter_db_asn = &filter_master->filter_ipv4addr.filter_db_asn;
+		break;
+
+	    case IPV6CALC_PROTO_IPV6:
+		bits = 64;
+		filter_db_cc = &filter_master->filter_ipv6addr.filter_db_cc;
+		filter_db_asn = &filter_master->filter_ipv6addr.filter_db_asn;
+
+		if (mmdb->metadata.ip_version != 6) {
+			ERRORPRINT_NA("MaxMindDB database contains no IPv6 search tree");
+			return(-1);
+		};
+		break;
+
+	    default:
+		ERRORPRINT_WA("unsupported selector: %d (FIX CODE)", selector);
+		return(-1);
+		break;
+	};
+
+	// IPv4 search tree starts in IPv6 databases at ::/96
+	item.type = MMDB_RECORD_TYPE_SEARCH_NODE;
+	item.node = 0;
+	item.depth = 0;
+	item.prefix = 0;
+
+	if (mmdb->metadata.ip_version == 6) {
+		for (depth = 0; (depth < 96) && (item.type == MMDB_RECORD_TYPE_SEARCH_NODE); depth++) {
+			mmdb_error = libipv6calc_db_wrapper_MMDB_read_node(mmdb, item.node, &search_node);
+			if (mmdb_error != MMDB_SUCCESS) {
+				ERRORPRINT_WA("MaxMindDB search tree node read failed: %s", libipv6calc_db_wrapper_MMDB_strerror(mmdb_error));
+				return(-1);
+			};
+			item.type = search_node.left_record_type;
+			item.node = (uint32_t) search_node.left_record;
+			item.entry = search_node.left_record_entry;
+		};
+
+		if (item.type == MMDB_RECORD_TYPE_SEARCH_NODE) {
+			node_ipv4 = item.node;
+		};
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "IPv4 search tree start node: %u (type=%u)", item.node, item.type);
+
+		if (selector == IPV6CALC_PROTO_IPV6) {
+			item.type = MMDB_RECORD_TYPE_SEARCH_NODE;
+			item.node = 0;
+		};
+	};
+
+	cache = calloc((size_t) cache_size, sizeof(s_libipv6calc_db_wrapper_MMDB_dump_record));
+	if (cache == NULL) {
+		ERRORPRINT_NA("can't allocate memory for database dump");
+		return(-1);
+	};
+
+	stack[sp++] = item;
+
+	while (sp > 0) {
+		item = stack[--sp];
+
+		switch (item.type) {
+		    case MMDB_RECORD_TYPE_SEARCH_NODE:
+			if ((selector == IPV6CALC_PROTO_IPV6) && (item.node == node_ipv4)) {
+				// IPv4 search tree and its aliases (IPv4-mapped, 6to4, Teredo) are not part of IPv6 dump
+				continue;
+			};
+
+			if ((item.depth >= 128) || (sp + 2 > MMDB_DUMP_STACK_MAX)) {
+				ERRORPRINT_WA("MaxMindDB search tree is corrupt (depth=%d)", item.depth);
+				count = -1;
+				goto END_libipv6calc_db_wrapper;
+			};
+
+			mmdb_error = libipv6calc_db_wrapper_MMDB_read_node(mmdb, item.node, &search_node);
+			if (mmdb_error != MMDB_SUCCESS) {
+				ERRORPRINT_WA("MaxMindDB search tree node read failed: %s", libipv6calc_db_wrapper_MMDB_strerror(mmdb_error));
+				count = -1;
+				goto END_libipv6calc_db_wrapper;
+			};
+
+			// right branch (bit set) first on stack, left branch is processed next
+			stack[sp].type = search_node.right_record_type;
+			stack[sp].node = (uint32_t) search_node.right_record;
+			stack[sp].entry = search_node.right_record_entry;
+			stack[sp].depth = item.depth + 1;
+			stack[sp].prefix = (item.depth < bits) ? (item.prefix | (((uint64_t) 1) << (bits - 1 - item.depth))) : item.prefix;
+			sp++;
+
+			stack[sp].type = search_node.left_record_type;
+			stack[sp].node = (uint32_t) search_node.left_record;
+			stack[sp].entry = search_node.left_record_entry;
+			stack[sp].depth = item.depth + 1;
+			stack[sp].prefix = item.prefix;
+			sp++;
+			break;
+
+		    case MMDB_RECORD_TYPE_EMPTY:
+			break;
+
+		    case MMDB_RECORD_TYPE_DATA:
+			record = libipv6calc_db_wrapper_MMDB_dump_cache_slot(cache, cache_size, item.entry.offset);
+
+			if (record->key == 0) {
+				// not decoded so far
+				record->key = item.entry.offset + 1;
+				record->cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+				record->flag_skip = 0;
+				records++;
+
+				if ((features & IPV6CALC_DB_IP_DUMP_CC) != 0) {
+					record->cc_index = libipv6calc_db_wrapper_MMDB_cc_index_by_entry(&item.entry);
+					// countrycode filter decides also about unknown ones (like External)
+					if ((filter_db_cc->active != 0) && (libipv6calc_db_cc_filter(record->cc_index, filter_db_cc) > 0)) {
+						record->flag_skip = 1;
+					};
+				};
+
+				if (((features & IPV6CALC_DB_IP_TO_AS) != 0) && (record->flag_skip == 0)) {
+					if ((filter_db_asn->active != 0) && (libipv6calc_db_asn_filter(libipv6calc_db_wrapper_MMDB_asn_by_entry(&item.entry, mmdb), filter_db_asn) > 0)) {
+						record->flag_skip = 1;
+					};
+				};
+
+				cache_used++;
+				if (cache_used * 2 > cache_size) {
+					// grow and rehash
+					cache_new = calloc((size_t) cache_size * 2, sizeof(s_libipv6calc_db_wrapper_MMDB_dump_record));
+					if (cache_new == NULL) {
+						ERRORPRINT_NA("can't allocate memory for database dump");
+						count = -1;
+						goto END_libipv6calc_db_wrapper;
+					};
+					for (i = 0; i < cache_size; i++) {
+						if (cache[i].key != 0) {
+							*libipv6calc_db_wrapper_MMDB_dump_cache_slot(cache_new, cache_size * 2, cache[i].key - 1) = cache[i];
+						};
+					};
+					free(cache);
+					cache = cache_new;
+					cache_size *= 2;
+					record = libipv6calc_db_wrapper_MMDB_dump_cache_slot(cache, cache_size, item.entry.offset);
+				};
+			};
+
+			if (record->flag_skip == 1) {
+				continue;
+			};
+
+			first = item.prefix;
+			if (item.depth >= bits) {
+				last = first;
+			} else if (item.depth == 0) {
+				last = (bits == 64) ? UINT64_MAX : (((uint64_t) 1) << bits) - 1;
+			} else {
+				last = first | ((((uint64_t) 1) << (bits - item.depth)) - 1);
+			};
+
+			// IPv6 networks longer than /64 collapse into the same upper 64 bit range
+			if ((flag_last == 1) && (first == last_first) && (last == last_last) && (record->cc_index == last_cc_index)) {
+				continue;
+			};
+
+			flag_last = 1;
+			last_first = first;
+			last_last = last;
+			last_cc_index = record->cc_index;
+
+			count++;
+
+			if (libipv6calc_db_dump_range(dump, record->cc_index, first, last) != 0) {
+				count = -1;
+				goto END_libipv6calc_db_wrapper;
+			};
+			break;
+
+		    default:
+			ERRORPRINT_WA("MaxMindDB search tree contains invalid record type: %u", item.type);
+			count = -1;
+			goto END_libipv6calc_db_wrapper;
+			break;
+		};
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "search tree traversal finished, decoded records: %ld ranges: %ld", records, count);
+
+END_libipv6calc_db_wrapper:
+	free(cache);
+	return(count);
+};
+
 #endif  // MMDB
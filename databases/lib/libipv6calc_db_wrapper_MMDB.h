@@ -45,9 +45,14 @@ extern char mmdb_lib_file[PATH_MAX];
 #endif
 
 extern int          libipv6calc_db_wrapper_MMDB_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, MMDB_s *const mmdb);
+extern uint16_t     libipv6calc_db_wrapper_MMDB_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb);
 extern int          libipv6calc_db_wrapper_MMDB_all_by_addr(const ipv6calc_ipaddr *ipaddrp, libipv6calc_db_wrapper_geolocation_record *recordp, MMDB_s *const mmdb);
 extern uint32_t     libipv6calc_db_wrapper_MMDB_asn_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb);
 extern uint32_t     libipv6calc_db_wrapper_MMDB_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb, int *source_ptr);
+extern uint16_t     libipv6calc_db_wrapper_MMDB_cc_index_by_entry(MMDB_entry_s *const entry);
+extern uint32_t     libipv6calc_db_wrapper_MMDB_asn_by_entry(MMDB_entry_s *const entry, MMDB_s *const mmdb);
+
+extern long int     libipv6calc_db_wrapper_MMDB_dump(MMDB_s *const mmdb, const int selector, const s_ipv6calc_filter_master *filter_master, const uint32_t features, s_ipv6calc_db_dump *dump);
 
 extern int	    libipv6calc_db_wrapper_MMDB_open(const char *const filename, uint32_t flags, MMDB_s *const mmdb);
 extern void         libipv6calc_db_wrapper_MMDB_close(MMDB_s *const mmdb);
@@ -60,4 +65,5 @@ extern void         libipv6calc_db_wrapper_MMDB_free_entry_data_list(MMDB_entry_
 extern int          libipv6calc_db_wrapper_MMDB_dump_entry_data_list(FILE *const stream, MMDB_entry_data_list_s *const entry_data_list, int indent);
 
 extern MMDB_lookup_result_s libipv6calc_db_wrapper_MMDB_lookup_sockaddr(MMDB_s *const mmdb, const struct sockaddr *const sockaddr, int *const mmdb_error);
+extern int          libipv6calc_db_wrapper_MMDB_read_node(const MMDB_s *const mmdb, uint32_t node_number, MMDB_search_node_s *const node);
 #endif
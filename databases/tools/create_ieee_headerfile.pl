@@ -85,11 +85,27 @@ print OUT qq| * Generated     : $now_string
 my $sb = stat($INFILE);
 print OUT "\/\*\@unused\@\*\/ static const char* libieee_" . $TYPE . "_status __attribute__ ((__unused__)) = \"" . uc($TYPE) . "/" . strftime("%Y%m%d", localtime($sb->mtime)) . "\";\n";
 
-# Structure
-print OUT qq|
 
-static const s_ieee_$TYPE libieee_${TYPE}[] = {
-|;
+# string pool (deduplicated, entries referenced by offset)
+my %string_pool;
+my @string_pool_list;
+my $string_pool_length = 0;
+
+sub string_pool_add($) {
+	my $string = shift;
+
+	if (! defined $string_pool{$string}) {
+		# length in C without escaping
+		my $string_raw = $string;
+		$string_raw =~ s/\\\\/\\/g;
+
+		$string_pool{$string} = $string_pool_length;
+		push @string_pool_list, $string;
+		$string_pool_length += length($string_raw) + 1;
+	};
+
+	return($string_pool{$string});
+};
 
 # normalize
 sub normalize($) {
@@ -287,25 +303,44 @@ if (scalar(keys %map) > 0) {
 		$map{"525400"}->{'short'} = "QEMU-VIRTUAL";
 	};
 
+	# Structure (pointer-free, strings are stored as offsets into one string pool)
+	print OUT qq|
+
+static const s_ieee_$TYPE libieee_${TYPE}[] = {
+|;
+
 	for my $prefix (sort { $a cmp $b } keys %map) {
 		my $oui_major = "0x" . substr($prefix, 0, 6);
 		my $oui_minor_begin = "0x" . substr($prefix, 6) . "0" x (6 - length(substr($prefix, 6)));
 		my $oui_minor_end   = "0x" . substr($prefix, 6) . "F" x (6 - length(substr($prefix, 6)));
-		my $oui_owner = $map{$prefix}->{'long'};
-		my $oui_owner_short = $map{$prefix}->{'short'};
+		my $oui_owner = string_pool_add($map{$prefix}->{'long'});
+		my $oui_owner_short = string_pool_add($map{$prefix}->{'short'});
 
 		if ($TYPE eq "oui") {
-			print OUT "\t{ " . $oui_major . ", \"" . $oui_owner . "\", \"" . $oui_owner_short . "\" },\n";
+			print OUT "\t{ " . $oui_major . ", " . $oui_owner . ", " . $oui_owner_short . " },\n";
 		} else {
-			print OUT "\t{ " . $oui_major . ", " . $oui_minor_begin . ", " . $oui_minor_end . ", \"" . $oui_owner . "\", \"" . $oui_owner_short . "\" },\n";
+			print OUT "\t{ " . $oui_major . ", " . $oui_minor_begin . ", " . $oui_minor_end . ", " . $oui_owner . ", " . $oui_owner_short . " },\n";
 		};
 	};
-};
 
-print OUT qq|
+	print OUT qq|
 };
 |;
 
+	# String pool
+	print OUT qq|
+
+static const char libieee_${TYPE}_strings[] =
+|;
+
+	foreach my $string (@string_pool_list) {
+		print OUT "\t\"" . $string . "\\0\"\n";
+	};
+
+	print OUT qq|\t"";
+|;
+};
+
 my @missing;
 
 my %defines = (
@@ -31,6 +31,7 @@
 #include "libeui64.h"
 
 #include "showinfo.h"
+#include "ptrgen.h"
 
 #include "librfc1884.h"
 #include "librfc1886.h"
@@ -76,8 +77,13 @@ int feature_kp      = 0; // will be checked later
 int feature_kg      = 0; // will be checked later
 
 /* showinfo machine readable filter */
-char showinfo_machine_readable_filter[32] = "";
-int showinfo_machine_readable_filter_used = 0;
+char showinfo_machine_readable_filter[IPV6CALC_STRING_MAX] = "";
+
+/* showinfo JSON Lines output: error object for invalid input (keeps one object per input) */
+#define SHOWINFO_JSON_ERROR(input, message) \
+	if ((command == CMD_showinfo) && ((formatoptions & FORMATOPTION_mr_json) != 0)) { \
+		showinfo_json_error(((input) != NULL) ? (input) : "", message); \
+	};
 
 
 /**************************************************/
@@ -92,7 +98,8 @@ int main(int argc, char *argv[]) {
 	char resultstring[IPV6CALC_STRING_MAX] = "";
 	char resultstring2[IPV6CALC_STRING_MAX] = "";
 	char resultstring3[IPV6CALC_STRING_MAX] = "";
-	char name_ipset[IPV6CALC_STRING_MAX] = "";
+	char name_set[IPV6CALC_STRING_MAX] = "";
+	uint32_t dump_options = 0;
 	int retval = 1, i, j, lop, result;
 	uint32_t command = 0;
 	int bit_start = 0, bit_end = 0, force_prefix = 0;
@@ -103,6 +110,9 @@ int main(int argc, char *argv[]) {
 
 	int ipv6rd_prefixlength = -1;
 
+	/* PTR generator */
+	s_ptrgen_spec ptrgen_spec = { 0, 0, 1, 0, NULL };
+
 	/* new option style storage */	
 	uint32_t inputtype  = FORMAT_undefined, inputtype2 = FORMAT_undefined;
 	uint32_t outputtype = FORMAT_undefined;
@@ -151,6 +161,7 @@ int main(int argc, char *argv[]) {
 	ipv4addr_clearall(&ipv4addr2);
 
 	mac_clearall(&macaddr);
+	libeui64_clearall(&eui64addr);
 
 	for (a = 0; a < ipv6calc_arrays; a++) {
 		ipv6addr_clearall(&ipv6addr_a[a]);
@@ -165,6 +176,7 @@ int main(int argc, char *argv[]) {
 	ptrptr = &cptr;
 	int linecounter = 0;
 	int flush_mode = 0;
+	int record_end_mode = 0;
 
 	/* options */
 	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
@@ -253,6 +265,11 @@ int main(int argc, char *argv[]) {
 				flush_mode = 1;
 				break;
 
+			case CMD_print_record_end:
+				record_end_mode = 1;
+				flush_mode = 1;
+				break;
+
 			case 'h':
 			case '?':
 				command |= CMD_printhelp;
@@ -396,6 +413,27 @@ int main(int argc, char *argv[]) {
 				};
 				break;
 
+			/* PTR generator */
+			case CMD_ptr_range:
+			case CMD_ptr_step:
+			case CMD_ptr_template:
+				// autodefine action
+				action = ACTION_ptr_generate;
+				action_given = 1;
+
+				if (i == CMD_ptr_range) {
+					if (ptrgen_range_parse(optarg, &ptrgen_spec) != 0) {
+						exit(EXIT_FAILURE);
+					};
+				} else if (i == CMD_ptr_step) {
+					if (ptrgen_step_parse(optarg, &ptrgen_spec) != 0) {
+						exit(EXIT_FAILURE);
+					};
+				} else {
+					ptrgen_spec.template = optarg;
+				};
+				break;
+
 			/* test command */
 			case CMD_test_prefix:
 			case CMD_test_ge:
@@ -548,8 +586,12 @@ int main(int argc, char *argv[]) {
 				formatoptions |= (FORMATOPTION_mr_quote_never | FORMATOPTION_machinereadable);
 				break;
 
+			case FORMATOPTION_NUM_mr_json + FORMATOPTION_NUM_HEAD:
+				formatoptions |= (FORMATOPTION_mr_json | FORMATOPTION_machinereadable);
+				break;
+
 			case FORMATOPTION_NUM_mr_value_only + FORMATOPTION_NUM_HEAD:
-				if (strlen(showinfo_machine_readable_filter) >= sizeof(showinfo_machine_readable_filter)) {
+				if (strlen(optarg) >= sizeof(showinfo_machine_readable_filter)) {
 					fprintf(stderr, " Argument of option 'mrtvo' is too long: %s\n", optarg);
 					exit(EXIT_FAILURE);
 				};
@@ -558,7 +600,7 @@ int main(int argc, char *argv[]) {
 				break;
 				
 			case FORMATOPTION_NUM_mr_select_token + FORMATOPTION_NUM_HEAD:
-				if (strlen(showinfo_machine_readable_filter) >= sizeof(showinfo_machine_readable_filter)) {
+				if (strlen(optarg) >= sizeof(showinfo_machine_readable_filter)) {
 					fprintf(stderr, " Argument of option 'mrst' is too long: %s\n", optarg);
 					exit(EXIT_FAILURE);
 				};
@@ -567,7 +609,7 @@ int main(int argc, char *argv[]) {
 				break;
 
 			case FORMATOPTION_NUM_mr_select_token_pa + FORMATOPTION_NUM_HEAD:
-				if (strlen(showinfo_machine_readable_filter) >= sizeof(showinfo_machine_readable_filter)) {
+				if (strlen(optarg) >= sizeof(showinfo_machine_readable_filter)) {
 					fprintf(stderr, " Argument of option 'mrstpa' is too long: %s\n", optarg);
 					exit(EXIT_FAILURE);
 				};
@@ -576,7 +618,7 @@ int main(int argc, char *argv[]) {
 				break;
 
 			case FORMATOPTION_NUM_mr_match_token + FORMATOPTION_NUM_HEAD:
-				if (strlen(showinfo_machine_readable_filter) >= sizeof(showinfo_machine_readable_filter)) {
+				if (strlen(optarg) >= sizeof(showinfo_machine_readable_filter)) {
 					fprintf(stderr, " Argument of option 'mrmt' is too long: %s\n", optarg);
 					exit(EXIT_FAILURE);
 				};
@@ -585,7 +627,7 @@ int main(int argc, char *argv[]) {
 				break;
 
 			case FORMATOPTION_NUM_mr_match_token_suffix + FORMATOPTION_NUM_HEAD:
-				if (strlen(showinfo_machine_readable_filter) >= sizeof(showinfo_machine_readable_filter)) {
+				if (strlen(optarg) >= sizeof(showinfo_machine_readable_filter)) {
 					fprintf(stderr, " Argument of option 'mrmts' is too long: %s\n", optarg);
 					exit(EXIT_FAILURE);
 				};
@@ -616,14 +658,27 @@ int main(int argc, char *argv[]) {
 				break;
 
 			case FORMATOPTION_NUM_print_ipset + FORMATOPTION_NUM_HEAD:
-				if (strlen(optarg) >= sizeof(name_ipset)) {
+				if (strlen(optarg) >= sizeof(name_set)) {
 					fprintf(stderr, " Argument of option 'print-ipset' is too long: %s\n", optarg);
 					exit(EXIT_FAILURE);
 				};
-				snprintf(name_ipset, sizeof(name_ipset), "%s", optarg);
+				snprintf(name_set, sizeof(name_set), "%s", optarg);
 				formatoptions |= FORMATOPTION_print_ipset;
 				break;
 
+			case FORMATOPTION_NUM_print_nftables + FORMATOPTION_NUM_HEAD:
+				if (strlen(optarg) >= sizeof(name_set)) {
+					fprintf(stderr, " Argument of option 'print-nftables' is too long: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				snprintf(name_set, sizeof(name_set), "%s", optarg);
+				formatoptions |= FORMATOPTION_print_nftables;
+				break;
+
+			case CMD_db_dump_aggregate:
+				dump_options |= IPV6CALC_DB_DUMP_AGGREGATE;
+				break;
+
 
 			/* new options */
 			case 'I':	
@@ -716,29 +771,32 @@ int main(int argc, char *argv[]) {
 		formatoptions |= FORMATOPTION_quiet;
 	};
 
-	/* initialise database wrapper */
-	result = libipv6calc_db_wrapper_init("");
+	/* initialise database wrapper, backends are initialized on first database query */
+	result = libipv6calc_db_wrapper_init_lazy("");
 	if (result != 0) {
 		DEBUGPRINT_WA(DEBUG_ipv6calc_general, "db_wrapper_init failed, result=%d", result);
 		exit(EXIT_FAILURE);
 	};
 
-	/* check for KeepTypeAsnCC support */
-	if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV4_REQ_DB) == 1) \
-	    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV6_REQ_DB) == 1)) {
-		feature_kp = 1;
-	};
+	/* feature flags are only required for version/help/feature query and showinfo */
+	if (((command & (CMD_printversion | CMD_printhelp)) != 0) || (ipv6calcoptions_has_feature_query != 0) || (command == CMD_showinfo)) {
+		/* check for KeepTypeAsnCC support */
+		if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV4_REQ_DB) == 1) \
+		    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV6_REQ_DB) == 1)) {
+			feature_kp = 1;
+		};
 
-	/* check for KeepTypeGeonameID support */
-	if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEGEONAMEID_IPV4_REQ_DB) == 1) \
-	    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEGEONAMEID_IPV6_REQ_DB) == 1)) {
-		feature_kg = 1;
-	};
+		/* check for KeepTypeGeonameID support */
+		if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEGEONAMEID_IPV4_REQ_DB) == 1) \
+		    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEGEONAMEID_IPV6_REQ_DB) == 1)) {
+			feature_kg = 1;
+		};
 
-	/* check for standard anonymization support */
-	if ((libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_REGISTRY) == 1) \
-	    && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_REGISTRY) == 1)) {
-		feature_anon = 1;
+		/* check for standard anonymization support */
+		if ((libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_REGISTRY) == 1) \
+		    && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_REGISTRY) == 1)) {
+			feature_anon = 1;
+		};
 	};
 
 	DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Debug value:%08lx command:%08lx inputtype:%08lx outputtype:%08lx action:%08lx formatoptions:%08lx", (unsigned long) ipv6calc_debug, (unsigned long) command, (unsigned long) inputtype, (unsigned long) outputtype, (unsigned long) action, (unsigned long) formatoptions); // ipv6calc_debug usage ok
@@ -815,6 +873,13 @@ int main(int argc, char *argv[]) {
 		};
 	};
 
+	if (command == CMD_showinfo) {
+		/* parse machine readable filter, select required lookups */
+		if (showinfo_filter_init(formatoptions) != 0) {
+			exit(EXIT_FAILURE);
+		};
+	};
+
 	if (action == ACTION_filter) {
 		if (libipv6calc_filter_check(&filter_master) != 0) {
 			fprintf(stderr, "ipv6calc filter check causes a problem\n");
@@ -844,13 +909,13 @@ int main(int argc, char *argv[]) {
 			goto RESULT_none;
 		};
 
-		// TODO SOURCE SELECTION in case more databases support dump format
-		db_source = IPV6CALC_DB_SOURCE_EXTERNAL;
+		// source selected by database priorization (External, GeoIP2, DBIP2) supporting the filter
+		db_source = IPV6CALC_DB_SOURCE_UNKNOWN;
 
 		if ((filter_master.filter_ipv4addr.active == 0) && (filter_master.filter_ipv6addr.active != 0)) {
-			retval = libipv6calc_db_dump(db_source, IPV6CALC_PROTO_IPV6, &filter_master, outputtype, formatoptions, name_ipset);
+			retval = libipv6calc_db_dump(db_source, IPV6CALC_PROTO_IPV6, &filter_master, outputtype, formatoptions, name_set, dump_options);
 		} else if ((filter_master.filter_ipv4addr.active != 0) && (filter_master.filter_ipv6addr.active == 0)) {
-			retval = libipv6calc_db_dump(db_source, IPV6CALC_PROTO_IPV4, &filter_master, outputtype, formatoptions, name_ipset);
+			retval = libipv6calc_db_dump(db_source, IPV6CALC_PROTO_IPV4, &filter_master, outputtype, formatoptions, name_set, dump_options);
 		} else {
 			fprintf(stderr, "ipv6calc action 'dbdump' is not supporting combined IPv4 and IPv6 filter\n");
 			retval = 1;
@@ -859,6 +924,23 @@ int main(int argc, char *argv[]) {
 		goto RESULT_none;
 	};
 
+	if (action == ACTION_ptr_generate) {
+		if (ptrgen_spec.flag_range == 0) {
+			fprintf(stderr, "ipv6calc action 'ptrgen' requires a host range (see option --ptr-range)\n");
+			retval = 1;
+			goto RESULT_none;
+		};
+
+		if (argc != 1) {
+			fprintf(stderr, "ipv6calc action 'ptrgen' requires exactly one IPv4/IPv6 prefix as input\n");
+			retval = 1;
+			goto RESULT_none;
+		};
+
+		retval = ptrgen_stream(argv[0], &ptrgen_spec, formatoptions);
+		goto RESULT_none;
+	};
+
 	if (argc > 0) {
 		DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Got input: %s", argv[0]);
 	} else {
@@ -903,6 +985,9 @@ PIPE_input:
 
 		linecounter++;
 
+		/* reset result of previous record */
+		retval = 0;
+
 		if (linecounter == 1) {
 			DEBUGPRINT_NA(DEBUG_ipv6calc_general, "Ok, proceeding stdin...");
 		};
@@ -916,6 +1001,7 @@ PIPE_input:
 		
 		if (strlen(linebuffer) == 0) {
 			fprintf(stderr, "Line empty: %d\n", linecounter);
+			SHOWINFO_JSON_ERROR("", "Line empty")
 			goto PIPE_input;
 		};
 
@@ -936,11 +1022,21 @@ PIPE_input:
 
 		if ( charptr == NULL ) {
 			fprintf(stderr, "Line contains no token: %d\n", linecounter);
+			SHOWINFO_JSON_ERROR("", "Line contains no token")
+			if (record_end_mode == 1) {
+				retval = 1;
+				goto RESULT_record_end;
+			};
 			goto PIPE_input;
 		};
 
 		if ( strlen(charptr) >=  LINEBUFFER) {
 			fprintf(stderr, "Line too strange: %d\n", linecounter);
+			SHOWINFO_JSON_ERROR("", "Line too strange")
+			if (record_end_mode == 1) {
+				retval = 1;
+				goto RESULT_record_end;
+			};
 			goto PIPE_input;
 		};
 
@@ -959,6 +1055,23 @@ PIPE_input:
 			DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Token 2: '%s'", input2);
 		};
 
+		if ((command == CMD_showinfo) && (inputtype_given == 0)) {
+			/* each line can contain a different type, clear previous results and reset input type for autodetection */
+			DEBUGPRINT_NA(DEBUG_ipv6calc_general, "reset input type and address structures for showinfo");
+			inputtype = FORMAT_auto;
+			if (outputtype_given == 0) {
+				/* output type was autodetected by previous line, would fail check of machine readable format options */
+				outputtype = FORMAT_undefined;
+			};
+			ipv6addr_clearall(&ipv6addr);
+			ipv4addr_clearall(&ipv4addr);
+			mac_clearall(&macaddr);
+			libeui64_clearall(&eui64addr);
+			asn_valid = 0;
+			resultstring[0] = '\0';
+			libipv6calc_db_wrapper_db_info_used_clear();
+		};
+
 	} else {
 		inputc = argc;
 		if (argc >= 1) {
@@ -1137,6 +1250,11 @@ PIPE_input:
 		case FORMAT_auto_noresult:
 		default:
 			fprintf(stderr, " Input-type isn't autodetected\n");
+			SHOWINFO_JSON_ERROR(input1, "Input-type isn't autodetected")
+			if ((input_is_pipe == 1) && (record_end_mode == 1)) {
+				retval = 1;
+				goto RESULT_record_end;
+			};
 			exit(EXIT_FAILURE);
 	};
 
@@ -1241,6 +1359,11 @@ PIPE_input:
 	};
 
 	if (retval != 0) {
+		SHOWINFO_JSON_ERROR(input1, (strlen(resultstring) > 0) ? resultstring : "Input is invalid")
+		if ((input_is_pipe == 1) && (record_end_mode == 1)) {
+			/* report error and proceed with next line */
+			goto RESULT_print;
+		};
 		if (strlen(resultstring) > 0) fprintf(stderr, "%s\n", resultstring);
 		exit(EXIT_FAILURE);
 	};
@@ -2059,6 +2182,10 @@ PIPE_input:
 		};
 		if (retval != 0) {
 			fprintf(stderr, "Problem occurs during selection of showinfo\n");
+			SHOWINFO_JSON_ERROR(input1, "Problem occurs during selection of showinfo")
+			if ((input_is_pipe == 1) && (record_end_mode == 1)) {
+				goto RESULT_print;
+			};
 			exit(EXIT_FAILURE);
 		};
 		goto RESULT_print;
@@ -2191,6 +2318,8 @@ PIPE_input:
 					iid_statistics.digit_delta_amount
 				);
 				STRCAT(resultstring, resultstring2);
+				snprintf(resultstring2, sizeof(resultstring2), " F=%d", ipv6addr_iidrandomdetection_fast(&ipv6addr));
+				STRCAT(resultstring, resultstring2);
 			};
 			break;
 
@@ -2271,7 +2400,12 @@ RESULT_print:
 		};
 	};
 
+RESULT_record_end:
 	if (input_is_pipe == 1) {
+		if ((record_end_mode == 1) && ((command != CMD_showinfo) || ((formatoptions & FORMATOPTION_mr_json) == 0))) {
+			/* not for JSON Lines output, each record is one line (object or error object) */
+			fprintf(stdout, "IPV6CALC_RECORD_END=%d\n", (retval == 0) ? 0 : 1);
+		};
 		if (flush_mode == 1) {
 			fflush(stdout);
 		};
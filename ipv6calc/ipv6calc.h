@@ -30,4 +30,3 @@ extern int feature_kp;
 extern int feature_kg;
 
 extern char showinfo_machine_readable_filter[];
-extern int showinfo_machine_readable_filter_used;
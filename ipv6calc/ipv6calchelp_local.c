@@ -101,6 +101,8 @@ void ipv6calc_printhelp(const struct option longopts[], const s_ipv6calc_longopt
 
 	fprintf(stderr, "  [-q|--quiet]               : be more quiet (auto-enabled in pipe mode)\n");
 	fprintf(stderr, "  [-f|--flush]               : flush each line in pipe mode\n");
+	fprintf(stderr, "  [--print-record-end]       : print 'IPV6CALC_RECORD_END=<rc>' after each line in pipe mode\n");
+	fprintf(stderr, "                               (implies flush, continue on invalid input)\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, " Usage with new style options:\n");
 	fprintf(stderr, "  [--in|-I <input type>]   : specify input  type\n");
@@ -122,11 +124,14 @@ void ipv6calc_printhelp(const struct option longopts[], const s_ipv6calc_longopt
 	fprintf(stderr, "  --showinfo|-i [--machine_readable|-m] : show information about input data\n");
 	fprintf(stderr, "  --showinfo|-i --mrqva                 : Machine Readable Quote Values Always\n");
 	fprintf(stderr, "  --showinfo|-i --mrqvn                 : Machine Readable Quote Values Never\n");
+	fprintf(stderr, "  --showinfo|-i --mrjson                : Machine Readable JSON Lines (one object per input)\n");
 	fprintf(stderr, "  --showinfo|-i --mrst <TOKEN>          : Machine Readable Select Token\n");
 	fprintf(stderr, "  --showinfo|-i --mrstpa <TOKEN>        : Machine Readable Select Token Print Always\n");
 	fprintf(stderr, "  --showinfo|-i --mrmt <TOKENPREFIX>    : Machine Readable Match Token Prefix\n");
 	fprintf(stderr, "  --showinfo|-i --mrmts <TOKENSUFFIX>   : Machine Readable Match Token Suffix\n");
 	fprintf(stderr, "  --showinfo|-i --mrtvo <TOKEN>         : Machine Readable Token Value Only\n");
+	fprintf(stderr, "     (<TOKEN>, <TOKENPREFIX> and <TOKENSUFFIX> can be a comma separated list,\n");
+	fprintf(stderr, "      lookups of not selected tokens are skipped)\n");
 	fprintf(stderr, "  --showinfo|-i --show-tokens           : show available tokens (aka types) on '-m'\n");
 
 	printhelp_shortcut_options(longopts, longopts_shortopts_map);
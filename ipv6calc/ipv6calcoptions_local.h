@@ -111,6 +111,7 @@ static struct option ipv6calc_longopts[] = {
 	{ "mrstpa"               , 1, NULL, FORMATOPTION_NUM_mr_select_token_pa + FORMATOPTION_NUM_HEAD },
 	{ "mrmt"                 , 1, NULL, FORMATOPTION_NUM_mr_match_token  + FORMATOPTION_NUM_HEAD },
 	{ "mrmts"                , 1, NULL, FORMATOPTION_NUM_mr_match_token_suffix  + FORMATOPTION_NUM_HEAD },
+	{ "mrjson"               , 0, NULL, FORMATOPTION_NUM_mr_json          + FORMATOPTION_NUM_HEAD },
 	
 	{ "printmirrored"        , 0, NULL, FORMATOPTION_NUM_printmirrored + FORMATOPTION_NUM_HEAD },
 
@@ -119,6 +120,10 @@ static struct option ipv6calc_longopts[] = {
 	{ "print-octal"		 , 0, NULL, FORMATOPTION_NUM_print_octal + FORMATOPTION_NUM_HEAD },
 
 	{ "print-ipset"		 , 1, NULL, FORMATOPTION_NUM_print_ipset + FORMATOPTION_NUM_HEAD },
+	{ "print-nftables"	 , 1, NULL, FORMATOPTION_NUM_print_nftables + FORMATOPTION_NUM_HEAD },
+
+	/* database dump options */
+	{ "dump-aggregate"	 , 0, NULL, CMD_db_dump_aggregate },
 
 	/* new options */
 	{ "in"        , 1, NULL, CMD_inputtype  },
@@ -139,6 +144,14 @@ static struct option ipv6calc_longopts[] = {
 	{ "test_le"		, 1, NULL, CMD_test_le },
 	{ "test_lt"		, 1, NULL, CMD_test_lt },
 
+	/* PTR generator options for action */
+	{ "ptr-range"		, 1, NULL, CMD_ptr_range },
+	{ "ptr-step"		, 1, NULL, CMD_ptr_step },
+	{ "ptr-template"	, 1, NULL, CMD_ptr_template },
+
+	/* pipe mode options */
+	{ "print-record-end"	, 0, NULL, CMD_print_record_end },
+
 }; 
 
 
@@ -0,0 +1,526 @@
+/*
+ * Project    : ipv6calc
+ * File       : ptrgen.c
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Streaming generator of reverse zone (PTR) records for a host range of a prefix
+ *
+ *  The reverse name is built once and afterwards only the nibbles/labels
+ *  of changed octets are rewritten while iterating over the host range.
+ *  Records are collected in a large buffer which is written in chunks.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "ipv6calc.h"
+#include "libipv6calc.h"
+#include "libipv6calcdebug.h"
+#include "ipv6calctypes.h"
+#include "libipv6addr.h"
+#include "libipv4addr.h"
+#include "librfc1884.h"
+#include "ptrgen.h"
+
+
+static char   ptrgen_buffer[PTRGEN_BUFFER_SIZE];
+static size_t ptrgen_buffer_used = 0;
+
+static s_ptrgen_token ptrgen_tokens[PTRGEN_TEMPLATE_TOKENS_MAX];
+static int            ptrgen_tokens_entries = 0;
+
+static const char ptrgen_hex_lower[] = "0123456789abcdef";
+static const char ptrgen_hex_upper[] = "0123456789ABCDEF";
+
+/* decimal labels of octet values */
+static char   ptrgen_label[256][4];
+static size_t ptrgen_label_length[256];
+
+
+/*
+ * parse number
+ *
+ * in : string
+ * out: *valuep
+ * ret: ==0: ok, !=0: error
+ */
+static int ptrgen_number_parse(const char *string, uint64_t *valuep) {
+	char *endptr;
+	unsigned long long value;
+
+	if ((*string < '0') || (*string > '9')) {
+		return (1);
+	};
+
+	errno = 0;
+	value = strtoull(string, &endptr, 0);
+	if ((errno != 0) || (endptr == string) || (*endptr != '\0')) {
+		return (1);
+	};
+
+	*valuep = (uint64_t) value;
+	return (0);
+};
+
+
+/*
+ * parse host range
+ *
+ * in : string (<FIRST>-<LAST>, decimal or hex with 0x prefix)
+ * mod: *specp
+ * ret: ==0: ok, !=0: error
+ */
+int ptrgen_range_parse(const char *string, s_ptrgen_spec *specp) {
+	char tempstring[IPV6CALC_STRING_MAX];
+	char *cptr;
+
+	if (strlen(string) >= sizeof(tempstring)) {
+		fprintf(stderr, "PTR host range too long: %s\n", string);
+		return (1);
+	};
+
+	snprintf(tempstring, sizeof(tempstring), "%s", string);
+
+	cptr = strchr(tempstring, '-');
+	if (cptr == NULL) {
+		fprintf(stderr, "PTR host range misses '-' (expected <FIRST>-<LAST>): %s\n", string);
+		return (1);
+	};
+	*cptr = '\0';
+
+	if ((ptrgen_number_parse(tempstring, &specp->first) != 0) || (ptrgen_number_parse(cptr + 1, &specp->last) != 0)) {
+		fprintf(stderr, "PTR host range contains invalid number: %s\n", string);
+		return (1);
+	};
+
+	if (specp->last < specp->first) {
+		fprintf(stderr, "PTR host range has last below first: %s\n", string);
+		return (1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_ptrgen, "host range first=%llu last=%llu", (unsigned long long) specp->first, (unsigned long long) specp->last);
+
+	specp->flag_range = 1;
+	return (0);
+};
+
+
+/*
+ * parse host step
+ *
+ * in : string
+ * mod: *specp
+ * ret: ==0: ok, !=0: error
+ */
+int ptrgen_step_parse(const char *string, s_ptrgen_spec *specp) {
+	if ((ptrgen_number_parse(string, &specp->step) != 0) || (specp->step == 0)) {
+		fprintf(stderr, "PTR host step is not a number > 0: %s\n", string);
+		return (1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_ptrgen, "host step=%llu", (unsigned long long) specp->step);
+	return (0);
+};
+
+
+/*
+ * add token to template token list
+ *
+ * in : type, literal, length
+ * ret: ==0: ok, !=0: error
+ */
+static int ptrgen_template_add(const int type, const char *literal, const size_t length) {
+	if (ptrgen_tokens_entries >= PTRGEN_TEMPLATE_TOKENS_MAX) {
+		fprintf(stderr, "PTR template contains too many tokens (max: %d)\n", PTRGEN_TEMPLATE_TOKENS_MAX);
+		return (1);
+	};
+
+	ptrgen_tokens[ptrgen_tokens_entries].type = type;
+	ptrgen_tokens[ptrgen_tokens_entries].literal = literal;
+	ptrgen_tokens[ptrgen_tokens_entries].length = length;
+	ptrgen_tokens_entries++;
+	return (0);
+};
+
+
+/*
+ * parse record template
+ *
+ * in : template
+ * out: *record_maxp = maximum length of one record (incl. newline)
+ * ret: ==0: ok, !=0: error
+ */
+static int ptrgen_template_parse(const char *template, size_t *record_maxp) {
+	const char *cptr = template, *literal = template;
+	size_t record_max = 1;
+	int type;
+
+	ptrgen_tokens_entries = 0;
+
+	while (*cptr != '\0') {
+		if (*cptr != '%') {
+			cptr++;
+			continue;
+		};
+
+		if (cptr > literal) {
+			if (ptrgen_template_add(PTRGEN_TOKEN_LITERAL, literal, (size_t) (cptr - literal)) != 0) {
+				return (1);
+			};
+			record_max += (size_t) (cptr - literal);
+		};
+
+		switch (cptr[1]) {
+			case 'r':
+				type = PTRGEN_TOKEN_NAME;
+				break;
+			case 'a':
+				type = PTRGEN_TOKEN_ADDRESS;
+				break;
+			case 'n':
+				type = PTRGEN_TOKEN_HOST_DEC;
+				break;
+			case 'x':
+				type = PTRGEN_TOKEN_HOST_HEX;
+				break;
+			case '%':
+				type = PTRGEN_TOKEN_LITERAL;
+				break;
+			default:
+				fprintf(stderr, "PTR template contains unsupported token '%%%c' (supported: %%r %%a %%n %%x %%%%)\n", cptr[1]);
+				return (1);
+		};
+
+		if (ptrgen_template_add(type, cptr, (type == PTRGEN_TOKEN_LITERAL) ? 1 : 0) != 0) {
+			return (1);
+		};
+		record_max += (type == PTRGEN_TOKEN_LITERAL) ? 1 : PTRGEN_FIELD_MAX;
+
+		cptr += 2;
+		literal = cptr;
+	};
+
+	if (cptr > literal) {
+		if (ptrgen_template_add(PTRGEN_TOKEN_LITERAL, literal, (size_t) (cptr - literal)) != 0) {
+			return (1);
+		};
+		record_max += (size_t) (cptr - literal);
+	};
+
+	if (record_max > PTRGEN_BUFFER_SIZE / 2) {
+		fprintf(stderr, "PTR template too long\n");
+		return (1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_ptrgen, "template tokens=%d record_max=%zu", ptrgen_tokens_entries, record_max);
+
+	*record_maxp = record_max;
+	return (0);
+};
+
+
+/*
+ * write buffer to stdout
+ *
+ * ret: ==0: ok, !=0: error
+ */
+static int ptrgen_flush(void) {
+	if (ptrgen_buffer_used > 0) {
+		if (fwrite(ptrgen_buffer, 1, ptrgen_buffer_used, stdout) != ptrgen_buffer_used) {
+			fprintf(stderr, "PTR generator can't write output: %s\n", strerror(errno));
+			return (1);
+		};
+		ptrgen_buffer_used = 0;
+	};
+	return (0);
+};
+
+
+/*
+ * add value to IPv6 address, update reverse nibble name of changed octets only
+ *
+ * in : value, hex = digit table
+ * mod: octets, name (optional)
+ * ret: carry (!=0: overflow)
+ */
+static unsigned int ptrgen_ipv6_add(uint8_t *octets, uint64_t value, char *name, const char *hex) {
+	int n;
+	unsigned int sum, carry = 0;
+
+	for (n = 15; n >= 0; n--) {
+		if ((value == 0) && (carry == 0)) {
+			break;
+		};
+
+		sum = (unsigned int) octets[n] + (unsigned int) (value & 0xff) + carry;
+		value >>= 8;
+		carry = sum >> 8;
+		sum &= 0xff;
+
+		if (sum != octets[n]) {
+			octets[n] = (uint8_t) sum;
+			if (name != NULL) {
+				/* least significant nibble is first label */
+				name[(15 - n) * 4]     = hex[sum & 0xf];
+				name[(15 - n) * 4 + 2] = hex[sum >> 4];
+			};
+		};
+	};
+
+	return (carry);
+};
+
+
+/*
+ * store unsigned number decimal or hexadecimal
+ *
+ * in : value, base (10|16), hex = digit table
+ * out: *dst
+ * ret: length
+ */
+static size_t ptrgen_number_store(char *dst, uint64_t value, const unsigned int base, const char *hex) {
+	char tempstring[24];
+	size_t i = sizeof(tempstring);
+
+	do {
+		tempstring[--i] = hex[value % base];
+		value /= base;
+	} while (value > 0);
+
+	memcpy(dst, tempstring + i, sizeof(tempstring) - i);
+	return (sizeof(tempstring) - i);
+};
+
+
+/*
+ * build reverse IPv4 name tail (labels of upper 3 octets + domain)
+ *
+ * in : address, domain
+ * out: *tail
+ * ret: length
+ */
+static size_t ptrgen_ipv4_tail(const uint32_t address, const char *domain, char *tail) {
+	size_t len = 0;
+	int n;
+	unsigned int octet;
+
+	for (n = 1; n <= 3; n++) {
+		octet = (address >> (8 * n)) & 0xff;
+		tail[len++] = '.';
+		memcpy(tail + len, ptrgen_label[octet], ptrgen_label_length[octet]);
+		len += ptrgen_label_length[octet];
+	};
+
+	tail[len++] = '.';
+	memcpy(tail + len, domain, strlen(domain));
+	len += strlen(domain);
+	return (len);
+};
+
+
+/*
+ * generate PTR records for a host range of a prefix
+ *
+ * in : input = IPv4/IPv6 prefix (or base address), *specp = generator specification
+ * ret: ==0: ok, !=0: error
+ */
+int ptrgen_stream(const char *input, const s_ptrgen_spec *specp, const uint32_t formatoptions) {
+	char resultstring[IPV6CALC_STRING_MAX];
+	char name[PTRGEN_FIELD_MAX], tail[PTRGEN_FIELD_MAX];
+	size_t name_length = 0, tail_length = 0, record_max, len;
+	uint8_t octets[16], octets_check[16];
+	uint32_t inputtype, ipv4_base = 0, ipv4_address = 0, ipv4_upper = 0;
+	unsigned int hostbits, n;
+	uint64_t host, count = 0;
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipv4addr ipv4addr;
+	const char *hex = ((formatoptions & FORMATOPTION_printuppercase) != 0) ? ptrgen_hex_upper : ptrgen_hex_lower;
+	const char *domain = ((formatoptions & FORMATOPTION_printuppercase) != 0) ? "IP6.ARPA." : "ip6.arpa.";
+	const char *template = (specp->template != NULL) ? specp->template : PTRGEN_TEMPLATE_DEFAULT;
+	char *dst;
+	int t, retval;
+
+	if (ptrgen_template_parse(template, &record_max) != 0) {
+		return (1);
+	};
+
+	for (n = 0; n < 256; n++) {
+		snprintf(ptrgen_label[n], sizeof(ptrgen_label[n]), "%u", n);
+		ptrgen_label_length[n] = strlen(ptrgen_label[n]);
+	};
+
+	inputtype = libipv6calc_autodetectinput(input);
+
+	if (inputtype == FORMAT_ipv6addr) {
+		retval = addr_to_ipv6addrstruct(input, resultstring, sizeof(resultstring), &ipv6addr);
+		if (retval != 0) {
+			fprintf(stderr, "%s\n", resultstring);
+			return (1);
+		};
+
+		if (ipv6addr.flag_prefixuse == 1) {
+			ipv6addrstruct_maskprefix(&ipv6addr);
+			hostbits = 128 - (unsigned int) ipv6addr.prefixlength;
+		} else {
+			hostbits = 128;
+		};
+
+		ipv6addr.flag_prefixuse = 0;
+		ipv6addr.flag_scopeid = 0;
+		memcpy(octets, ipv6addr.in6_addr.s6_addr, sizeof(octets));
+	} else if (inputtype == FORMAT_ipv4addr) {
+		retval = addr_to_ipv4addrstruct(input, resultstring, sizeof(resultstring), &ipv4addr);
+		if (retval != 0) {
+			fprintf(stderr, "%s\n", resultstring);
+			return (1);
+		};
+
+		ipv4_base = ipv4addr_getdword(&ipv4addr);
+		if (ipv4addr.flag_prefixuse == 1) {
+			hostbits = 32 - (unsigned int) ipv4addr.prefixlength;
+			if (hostbits < 32) {
+				ipv4_base &= ~((1U << hostbits) - 1);
+			} else {
+				ipv4_base = 0;
+			};
+		} else {
+			hostbits = 32;
+		};
+	} else {
+		fprintf(stderr, "PTR generator supports only IPv4/IPv6 prefix as input: %s\n", input);
+		return (1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_ptrgen, "input=%s hostbits=%u", input, hostbits);
+
+	/* range check */
+	if ((hostbits < 64) && ((specp->last >> hostbits) != 0)) {
+		fprintf(stderr, "PTR host range exceeds host part of prefix (%u bits): %s\n", hostbits, input);
+		return (1);
+	};
+
+	if (inputtype == FORMAT_ipv6addr) {
+		memcpy(octets_check, octets, sizeof(octets_check));
+		if (ptrgen_ipv6_add(octets_check, specp->last, NULL, hex) != 0) {
+			fprintf(stderr, "PTR host range exceeds address space: %s\n", input);
+			return (1);
+		};
+
+		/* initial name, afterwards only changed octets are rewritten */
+		ptrgen_ipv6_add(octets, specp->first, NULL, hex);
+		for (n = 0; n < 16; n++) {
+			name[(15 - n) * 4]     = hex[octets[n] & 0xf];
+			name[(15 - n) * 4 + 1] = '.';
+			name[(15 - n) * 4 + 2] = hex[octets[n] >> 4];
+			name[(15 - n) * 4 + 3] = '.';
+		};
+		memcpy(name + 64, domain, 9);
+		name_length = 73;
+	} else {
+		if (((uint64_t) ipv4_base + specp->last) > 0xffffffffUL) {
+			fprintf(stderr, "PTR host range exceeds address space: %s\n", input);
+			return (1);
+		};
+
+		ipv4_address = ipv4_base + (uint32_t) specp->first;
+		ipv4_upper = ipv4_address >> 8;
+		domain = ((formatoptions & FORMATOPTION_printuppercase) != 0) ? "IN-ADDR.ARPA." : "in-addr.arpa.";
+		tail_length = ptrgen_ipv4_tail(ipv4_address, domain, tail);
+	};
+
+	host = specp->first;
+
+	while (1) {
+		if (ptrgen_buffer_used + record_max > sizeof(ptrgen_buffer)) {
+			if (ptrgen_flush() != 0) {
+				return (1);
+			};
+		};
+
+		dst = ptrgen_buffer + ptrgen_buffer_used;
+
+		for (t = 0; t < ptrgen_tokens_entries; t++) {
+			switch (ptrgen_tokens[t].type) {
+				case PTRGEN_TOKEN_LITERAL:
+					memcpy(dst, ptrgen_tokens[t].literal, ptrgen_tokens[t].length);
+					dst += ptrgen_tokens[t].length;
+					break;
+
+				case PTRGEN_TOKEN_NAME:
+					if (inputtype == FORMAT_ipv6addr) {
+						memcpy(dst, name, name_length);
+						dst += name_length;
+					} else {
+						memcpy(dst, ptrgen_label[ipv4_address & 0xff], ptrgen_label_length[ipv4_address & 0xff]);
+						dst += ptrgen_label_length[ipv4_address & 0xff];
+						memcpy(dst, tail, tail_length);
+						dst += tail_length;
+					};
+					break;
+
+				case PTRGEN_TOKEN_ADDRESS:
+					if (inputtype == FORMAT_ipv6addr) {
+						memcpy(ipv6addr.in6_addr.s6_addr, octets, sizeof(octets));
+						librfc1884_ipv6addrstruct_to_compaddr(&ipv6addr, resultstring, RFC1884_COMPADDR_STRING_MAX, formatoptions & FORMATOPTION_printuppercase);
+						len = strlen(resultstring);
+						memcpy(dst, resultstring, len);
+						dst += len;
+					} else {
+						for (n = 4; n > 0; n--) {
+							memcpy(dst, ptrgen_label[(ipv4_address >> (8 * (n - 1))) & 0xff], ptrgen_label_length[(ipv4_address >> (8 * (n - 1))) & 0xff]);
+							dst += ptrgen_label_length[(ipv4_address >> (8 * (n - 1))) & 0xff];
+							if (n > 1) {
+								*dst++ = '.';
+							};
+						};
+					};
+					break;
+
+				case PTRGEN_TOKEN_HOST_DEC:
+					dst += ptrgen_number_store(dst, host, 10, ptrgen_hex_lower);
+					break;
+
+				case PTRGEN_TOKEN_HOST_HEX:
+					dst += ptrgen_number_store(dst, host, 16, hex);
+					break;
+			};
+		};
+
+		*dst++ = '\n';
+		ptrgen_buffer_used = (size_t) (dst - ptrgen_buffer);
+		count++;
+
+		if ((specp->last - host) < specp->step) {
+			break;
+		};
+
+		host += specp->step;
+
+		if (inputtype == FORMAT_ipv6addr) {
+			ptrgen_ipv6_add(octets, specp->step, name, hex);
+		} else {
+			ipv4_address += (uint32_t) specp->step;
+			if ((ipv4_address >> 8) != ipv4_upper) {
+				/* upper octets changed, rebuild tail */
+				ipv4_upper = ipv4_address >> 8;
+				tail_length = ptrgen_ipv4_tail(ipv4_address, domain, tail);
+			};
+		};
+	};
+
+	if (ptrgen_flush() != 0) {
+		return (1);
+	};
+
+	if (fflush(stdout) != 0) {
+		fprintf(stderr, "PTR generator can't write output: %s\n", strerror(errno));
+		return (1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_ptrgen, "generated records: %llu", (unsigned long long) count);
+
+	return (0);
+};
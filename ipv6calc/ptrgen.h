@@ -0,0 +1,51 @@
+/*
+ * Project    : ipv6calc
+ * File       : ptrgen.h
+ * Copyright  : 2026 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for ptrgen.c
+ */
+
+#include "ipv6calc_inttypes.h"
+
+#define DEBUG_ptrgen		0x00000004l
+
+/* output buffer, flushed with one write if next record could not fit */
+#define PTRGEN_BUFFER_SIZE		(1024 * 1024)
+
+/* maximum length of a generated field (reverse name, address, number) */
+#define PTRGEN_FIELD_MAX		80
+
+/* default template: reverse name only */
+#define PTRGEN_TEMPLATE_DEFAULT		"%r"
+
+/* template tokens */
+#define PTRGEN_TOKEN_LITERAL		0
+#define PTRGEN_TOKEN_NAME		1	// %r
+#define PTRGEN_TOKEN_ADDRESS		2	// %a
+#define PTRGEN_TOKEN_HOST_DEC		3	// %n
+#define PTRGEN_TOKEN_HOST_HEX		4	// %x
+
+#define PTRGEN_TEMPLATE_TOKENS_MAX	64
+
+typedef struct {
+	int         type;
+	const char *literal;
+	size_t      length;
+} s_ptrgen_token;
+
+/* generator specification */
+typedef struct {
+	uint64_t    first;		/* first host number */
+	uint64_t    last;		/* last host number */
+	uint64_t    step;		/* increment between host numbers */
+	int         flag_range;		/* =1: range given */
+	const char *template;		/* record template */
+} s_ptrgen_spec;
+
+
+/* prototypes */
+extern int ptrgen_range_parse(const char *string, s_ptrgen_spec *specp);
+extern int ptrgen_step_parse(const char *string, s_ptrgen_spec *specp);
+extern int ptrgen_stream(const char *input, const s_ptrgen_spec *specp, const uint32_t formatoptions);
@@ -156,47 +156,353 @@ void showinfo_availabletypes(void) {
 	fprintf(stderr, "         even in case of no/empty output: --mrstpa <TOKEN>\n");
 	fprintf(stderr, "         value of a specific token can be displayed using --mrtvo <TOKEN>\n");
 	fprintf(stderr, "         wildcard '.' is supported in select token\n");
+	fprintf(stderr, "         multiple tokens can be given as comma separated list\n");
 	fprintf(stderr, "       matching tokens can be selected using --mrmt <TOKEN>\n");
+	fprintf(stderr, "       JSON Lines output (one object per input, tokens as keys) using --mrjson\n");
+	fprintf(stderr, "         invalid input (also empty line in pipe mode) results in object with\n");
+	fprintf(stderr, "         IPV6CALC_INPUT and IPV6CALC_ERROR, invalid UTF-8 is replaced by U+FFFD\n");
+	fprintf(stderr, "         no IPV6CALC_RECORD_END line in case of --print-record-end (one line per input)\n");
 };
 
 /*
- * print one information
+ * machine readable filter: list of tokens (comma separated), parsed by showinfo_filter_init
  */
-static void printout(const char *token, const char *value, const uint32_t formatoptions) {
-	int quote = 0;
-	unsigned int i;
+static char showinfo_filter_buffer[IPV6CALC_STRING_MAX] = "";
+static const char *showinfo_filter_token[SHOWINFO_FILTER_ENTRIES_MAX];
+static int showinfo_filter_used[SHOWINFO_FILTER_ENTRIES_MAX];
+static int showinfo_filter_entries = 0;
+
+/* lookup groups required by filter */
+static uint32_t showinfo_lookup_groups = SHOWINFO_GROUP_ALL;
+
+#define SHOWINFO_GROUP_REQUESTED(group)	((showinfo_lookup_groups & (group)) != 0)
+
+/* token prefixes of lookup groups */
+static const struct {
+	const uint32_t group;
+	const char *prefix;
+} showinfo_group_prefixes[] = {
+	{ SHOWINFO_GROUP_CC		, "IPV4_COUNTRYCODE" },
+	{ SHOWINFO_GROUP_CC		, "IPV6_COUNTRYCODE" },
+	{ SHOWINFO_GROUP_AS		, "IPV4_AS_" },
+	{ SHOWINFO_GROUP_AS		, "IPV6_AS_" },
+	{ SHOWINFO_GROUP_GEONAMEID	, "IPV4_GEONAME_ID" },
+	{ SHOWINFO_GROUP_GEONAMEID	, "IPV6_GEONAME_ID" },
+	{ SHOWINFO_GROUP_REGISTRY	, "IPV4_REGISTRY" },
+	{ SHOWINFO_GROUP_REGISTRY	, "IPV6_REGISTRY" },
+	{ SHOWINFO_GROUP_REGISTRY	, "AS_NUM_REGISTRY" },
+	{ SHOWINFO_GROUP_IEEE		, "OUI" },
+	{ SHOWINFO_GROUP_IP2LOCATION	, "IP2LOCATION_" },
+	{ SHOWINFO_GROUP_IP2LOCATION2	, "IP2LOCATION2_" },
+	{ SHOWINFO_GROUP_GEOIP2		, "GEOIP2_" },
+	{ SHOWINFO_GROUP_DBIP2		, "DBIP2_" },
+	{ SHOWINFO_GROUP_EXTERNAL	, "EXTERNAL_" },
+	{ SHOWINFO_GROUP_ALL		, "BUILTIN_" },	// database info depends on all lookups
+};
 
-	DEBUGPRINT_WA(DEBUG_showinfo, "called with token='%s' value='%s'", token, value);
+
+/*
+ * check token against one filter entry (wildcard '.' is supported in select token)
+ * ret: 1 = match, 0 = no match
+ */
+static int showinfo_filter_match_entry(const char *filter, const char *token, const uint32_t formatoptions) {
+	size_t i;
 
 	if (formatoptions & FORMATOPTION_mr_select_token) {
-		if (strchr(showinfo_machine_readable_filter, '.')) {
-			// wildcard found, execute sophisticated check
-			if (strlen(showinfo_machine_readable_filter) != strlen(token)) return; // length not matching
-			for (i = 0; i < strlen(token); i++) {
-				if (showinfo_machine_readable_filter[i] == '.') {
-					continue; // skip
-				};
-				if (showinfo_machine_readable_filter[i] != token[i]) return; // not matching
+		if (strlen(filter) != strlen(token)) return (0); // length not matching
+		for (i = 0; i < strlen(token); i++) {
+			if (filter[i] == '.') {
+				continue; // skip
 			};
-		} else {
-			// skip not matching token
-			if (strcmp(showinfo_machine_readable_filter, token) != 0) return;
+			if (filter[i] != token[i]) return (0); // not matching
 		};
-
-		showinfo_machine_readable_filter_used = 1;
 	};
 
 	if (formatoptions & FORMATOPTION_mr_match_token) {
-		// skip not matching token (begin)
-		if (strncmp(showinfo_machine_readable_filter, token, strlen(showinfo_machine_readable_filter)) != 0) return;
+		// not matching token (begin)
+		if (strncmp(filter, token, strlen(filter)) != 0) return (0);
+	};
+
+	if (formatoptions & FORMATOPTION_mr_match_token_suffix) {
+		// not matching token (end)
+		if (strlen(token) < strlen(filter)) return (0); // filter longer than token
+		if (strcmp(token + strlen(token) - strlen(filter), filter) != 0) return (0);
+	};
+
+	return (1);
+};
+
+
+/*
+ * check token against machine readable filter
+ * ret: 1 = print, 0 = skip
+ */
+static int showinfo_filter_match(const char *token, const char *additional, const uint32_t formatoptions) {
+	int i, match = 0;
+
+	if ((formatoptions & (FORMATOPTION_mr_select_token | FORMATOPTION_mr_match_token | FORMATOPTION_mr_match_token_suffix)) == 0) {
+		// no filter
+		return (1);
+	};
+
+	if ((formatoptions & (FORMATOPTION_mr_select_token | FORMATOPTION_mr_match_token)) != 0) {
+		// skip in case additional is not empty
+		if ((additional != NULL) && (strlen(additional) > 0)) return (0);
 	};
 
+	for (i = 0; i < showinfo_filter_entries; i++) {
+		if (showinfo_filter_match_entry(showinfo_filter_token[i], token, formatoptions) == 1) {
+			if (formatoptions & FORMATOPTION_mr_select_token) {
+				showinfo_filter_used[i] = 1;
+			};
+			match = 1;
+		};
+	};
+
+	return (match);
+};
+
+
+/*
+ * check whether a filter entry can match a token starting with given prefix
+ * ret: 1 = possible, 0 = not possible
+ */
+static int showinfo_filter_prefix_possible(const char *filter, const char *prefix, const uint32_t formatoptions) {
+	size_t i, length = strlen(prefix);
+
 	if (formatoptions & FORMATOPTION_mr_match_token_suffix) {
-		// skip not matching token (end)
-		if (strlen(token) < strlen(showinfo_machine_readable_filter)) return; // token longer then filter
-		char *c = strstr(token, showinfo_machine_readable_filter); // search for filter in token
-		if (c == NULL) return; // filter not found
-		if (strlen(c) != strlen(showinfo_machine_readable_filter)) return; // found but not the suffix
+		// can't be decided by prefix
+		return (1);
+	};
+
+	if (formatoptions & FORMATOPTION_mr_select_token) {
+		if (strlen(filter) < length) return (0); // token would be shorter than prefix
+		for (i = 0; i < length; i++) {
+			if (filter[i] == '.') {
+				continue; // skip
+			};
+			if (filter[i] != prefix[i]) return (0);
+		};
+	};
+
+	if (formatoptions & FORMATOPTION_mr_match_token) {
+		if (strncmp(filter, prefix, (strlen(filter) < length) ? strlen(filter) : length) != 0) return (0);
+	};
+
+	return (1);
+};
+
+
+/*
+ * parse machine readable filter (comma separated list of tokens) and
+ * select the lookup groups required for the requested tokens
+ *
+ * in : formatoptions
+ * ret: 0 = ok, 1 = error
+ */
+int showinfo_filter_init(const uint32_t formatoptions) {
+	char *token, *cptr, **ptrptr;
+	int i;
+	unsigned int j;
+
+	ptrptr = &cptr;
+
+	showinfo_filter_entries = 0;
+	showinfo_lookup_groups = SHOWINFO_GROUP_ALL;
+
+	if ((formatoptions & (FORMATOPTION_mr_select_token | FORMATOPTION_mr_match_token | FORMATOPTION_mr_match_token_suffix)) == 0) {
+		// no filter
+		return (0);
+	};
+
+	snprintf(showinfo_filter_buffer, sizeof(showinfo_filter_buffer), "%s", showinfo_machine_readable_filter);
+
+	token = strtok_r(showinfo_filter_buffer, ",", ptrptr);
+	while (token != NULL) {
+		if (showinfo_filter_entries >= SHOWINFO_FILTER_ENTRIES_MAX) {
+			fprintf(stderr, "Too many tokens in machine readable filter (max: %d): %s\n", SHOWINFO_FILTER_ENTRIES_MAX, showinfo_machine_readable_filter);
+			return (1);
+		};
+
+		DEBUGPRINT_WA(DEBUG_showinfo, "filter token %d: %s", showinfo_filter_entries, token);
+		showinfo_filter_token[showinfo_filter_entries] = token;
+		showinfo_filter_used[showinfo_filter_entries] = 0;
+		showinfo_filter_entries++;
+
+		token = strtok_r(NULL, ",", ptrptr);
+	};
+
+	if (showinfo_filter_entries == 0) {
+		fprintf(stderr, "Machine readable filter contains no token\n");
+		return (1);
+	};
+
+	/* select lookup groups */
+	showinfo_lookup_groups = 0;
+	for (i = 0; i < showinfo_filter_entries; i++) {
+		for (j = 0; j < MAXENTRIES_ARRAY(showinfo_group_prefixes); j++) {
+			if (showinfo_filter_prefix_possible(showinfo_filter_token[i], showinfo_group_prefixes[j].prefix, formatoptions) == 1) {
+				showinfo_lookup_groups |= showinfo_group_prefixes[j].group;
+			};
+		};
+	};
+
+	DEBUGPRINT_WA(DEBUG_showinfo, "lookup groups: 0x%08x", (unsigned int) showinfo_lookup_groups);
+
+	return (0);
+};
+
+
+/*
+ * JSON Lines output: tokens of one input are collected in a reusable buffer
+ * and written as one object per line by printfooter
+ */
+static char   showinfo_json_buffer[IPV6CALC_STRING_MAX * 32];
+static size_t showinfo_json_length = 0;
+static int    showinfo_json_overflow = 0;
+
+/* return length of valid UTF-8 sequence (0: invalid) */
+static int showinfo_json_utf8_length(const unsigned char *c) {
+	int length, i;
+	uint32_t codepoint;
+
+	if (*c < 0x80) {
+		return (1);
+	} else if ((*c & 0xe0) == 0xc0) {
+		length = 2;
+		codepoint = *c & 0x1f;
+	} else if ((*c & 0xf0) == 0xe0) {
+		length = 3;
+		codepoint = *c & 0x0f;
+	} else if ((*c & 0xf8) == 0xf0) {
+		length = 4;
+		codepoint = *c & 0x07;
+	} else {
+		return (0);
+	};
+
+	for (i = 1; i < length; i++) {
+		if ((c[i] & 0xc0) != 0x80) {
+			return (0); // also end of string
+		};
+		codepoint = (codepoint << 6) | (c[i] & 0x3f);
+	};
+
+	// overlong encoding, surrogates, out of range
+	if (((length == 2) && (codepoint < 0x80)) || ((length == 3) && (codepoint < 0x800)) || ((length == 4) && (codepoint < 0x10000)) || ((codepoint >= 0xd800) && (codepoint <= 0xdfff)) || (codepoint > 0x10ffff)) {
+		return (0);
+	};
+
+	return (length);
+};
+
+/* append string (optionally JSON escaped) to buffer, keeps space for closing "}\n" */
+/*  in case of escape invalid UTF-8 bytes are replaced by U+FFFD */
+static int showinfo_json_append(const char *string, const int escape) {
+	const unsigned char *c;
+	size_t need;
+	int length;
+
+	for (c = (const unsigned char *) string; *c != '\0'; c += length) {
+		length = 1; // bytes copied unchanged, 0: escaped
+		need = 1;
+		if ((escape == 1) && ((*c == '"') || (*c == '\\'))) {
+			length = 0;
+			need = 2;
+		} else if ((escape == 1) && ((*c < 0x20) || ((*c >= 0x80) && (showinfo_json_utf8_length(c) == 0)))) {
+			length = 0;
+			need = 6;
+		} else if ((escape == 1) && (*c >= 0x80)) {
+			length = showinfo_json_utf8_length(c);
+			need = length;
+		};
+
+		if (showinfo_json_length + need + 3 > sizeof(showinfo_json_buffer)) {
+			return (1);
+		};
+
+		if (length > 0) {
+			memcpy(showinfo_json_buffer + showinfo_json_length, c, length);
+			showinfo_json_length += length;
+			continue;
+		};
+
+		if (need == 2) {
+			showinfo_json_buffer[showinfo_json_length++] = '\\';
+			showinfo_json_buffer[showinfo_json_length++] = (char) *c;
+		} else {
+			snprintf(showinfo_json_buffer + showinfo_json_length, 7, "\\u%04x", (*c < 0x20) ? (unsigned int) *c : 0xfffd);
+			showinfo_json_length += 6;
+		};
+
+		length = 1;
+	};
+
+	return (0);
+};
+
+/* add one member "<token><additional>":"<value>" */
+static void showinfo_json_add(const char *token, const char *additional, const char *value) {
+	size_t length = showinfo_json_length;
+	int r;
+
+	r = showinfo_json_append((length == 0) ? "{\"" : ",\"", 0);
+	if (r == 0) r = showinfo_json_append(token, 1);
+	if ((r == 0) && (additional != NULL)) r = showinfo_json_append(additional, 1);
+	if (r == 0) r = showinfo_json_append("\":\"", 0);
+	if (r == 0) r = showinfo_json_append(value, 1);
+	if (r == 0) r = showinfo_json_append("\"", 0);
+
+	if (r != 0) {
+		// drop incomplete member
+		showinfo_json_length = length;
+		showinfo_json_overflow = 1;
+	};
+};
+
+/* write object of current input and reset buffer */
+static void showinfo_json_flush(void) {
+	if (showinfo_json_length == 0) {
+		showinfo_json_buffer[showinfo_json_length++] = '{';
+	};
+	showinfo_json_buffer[showinfo_json_length++] = '}';
+	showinfo_json_buffer[showinfo_json_length++] = '\n';
+
+	fwrite(showinfo_json_buffer, 1, showinfo_json_length, stdout);
+
+	if (showinfo_json_overflow == 1) {
+		fprintf(stderr, "JSON output buffer too small, information dropped\n");
+	};
+
+	showinfo_json_length = 0;
+	showinfo_json_overflow = 0;
+};
+
+
+/* print error object for input which can't be shown, drops tokens collected so far */
+void showinfo_json_error(const char *input, const char *message) {
+	showinfo_json_length = 0;
+	showinfo_json_overflow = 0;
+
+	showinfo_json_add("IPV6CALC_INPUT", NULL, input);
+	showinfo_json_add("IPV6CALC_ERROR", NULL, message);
+	showinfo_json_flush();
+};
+
+
+/*
+ * print one information
+ */
+static void printout(const char *token, const char *value, const uint32_t formatoptions) {
+	int quote = 0;
+
+	DEBUGPRINT_WA(DEBUG_showinfo, "called with token='%s' value='%s'", token, value);
+
+	if (showinfo_filter_match(token, NULL, formatoptions) == 0) return;
+
+	if ((formatoptions & FORMATOPTION_mr_json) != 0) {
+		showinfo_json_add(token, NULL, value);
+		return;
 	};
 
 	/* automatic quoting disabled
@@ -228,45 +534,14 @@ static void printout(const char *token, const char *value, const uint32_t format
 
 static void printout2(const char *token, const char *additional, const char *value, const uint32_t formatoptions) {
 	int quote = 0;
-	unsigned int i;
 
 	DEBUGPRINT_WA(DEBUG_showinfo, "called with token='%s' additional='%s' value='%s'", token, additional, value);
 
-	if (formatoptions & FORMATOPTION_mr_select_token) {
-		// skip in case additional is not empty
-		if ((additional != NULL) && (strlen(additional) > 0)) return;
-
-		if (strchr(showinfo_machine_readable_filter, '.')) {
-			// wildcard found, execute sophisticated check
-			if (strlen(showinfo_machine_readable_filter) != strlen(token)) return; // length not matching
-			for (i = 0; i < strlen(token); i++) {
-				if (showinfo_machine_readable_filter[i] == '.') {
-					continue; // skip
-				};
-				if (showinfo_machine_readable_filter[i] != token[i]) return; // not matching
-			};
-		} else {
-			// skip not matching token
-			if (strcmp(showinfo_machine_readable_filter, token) != 0) return;
-		};
-
-		showinfo_machine_readable_filter_used = 1;
-	};
-
-	if (formatoptions & FORMATOPTION_mr_match_token) {
-		// skip in case additional is not empty
-		if ((additional != NULL) && (strlen(additional) > 0)) return;
-
-		// skip not matching token (begin)
-		if (strncmp(showinfo_machine_readable_filter, token, strlen(showinfo_machine_readable_filter)) != 0) return;
-	};
+	if (showinfo_filter_match(token, additional, formatoptions) == 0) return;
 
-	if (formatoptions & FORMATOPTION_mr_match_token_suffix) {
-		// skip not matching token (end)
-		if (strlen(token) < strlen(showinfo_machine_readable_filter)) return; // token longer then filter
-		char *c = strstr(token, showinfo_machine_readable_filter); // search for filter in token
-		if (c == NULL) return; // filter not found
-		if (strlen(c) != strlen(showinfo_machine_readable_filter)) return; // found but not the suffix
+	if ((formatoptions & FORMATOPTION_mr_json) != 0) {
+		showinfo_json_add(token, additional, value);
+		return;
 	};
 
 	/* automatic quoting disabled
@@ -301,8 +576,19 @@ static void printfooter(const uint32_t formatoptions) {
 	char tempstring[IPV6CALC_STRING_MAX] = "";
 	char tempstring2[IPV6CALC_STRING_MAX] = "";
 
-	if ((formatoptions & FORMATOPTION_mr_select_token_pa) && (showinfo_machine_readable_filter_used == 0)) {
-		printout(showinfo_machine_readable_filter, "", formatoptions);
+	int i;
+
+	if (formatoptions & FORMATOPTION_mr_select_token_pa) {
+		for (i = 0; i < showinfo_filter_entries; i++) {
+			if (showinfo_filter_used[i] == 0) {
+				printout(showinfo_filter_token[i], "", formatoptions);
+			};
+		};
+	};
+
+	// reset for next address
+	for (i = 0; i < showinfo_filter_entries; i++) {
+		showinfo_filter_used[i] = 0;
 	};
 
 #if defined SUPPORT_IP2LOCATION || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2 || SUPPORT_IP2LOCATION2
@@ -375,7 +661,9 @@ static void printfooter(const uint32_t formatoptions) {
 	};
 #endif
 
-	if ( (formatoptions & FORMATOPTION_machinereadable) != 0 ) {
+	/* program information is constant, contained in JSON output only on selection */
+	if (((formatoptions & FORMATOPTION_machinereadable) != 0)
+	    && (((formatoptions & FORMATOPTION_mr_json) == 0) || (showinfo_filter_entries > 0))) {
 		printout("IPV6CALC_NAME"     , PROGRAM_NAME, formatoptions);
 		printout("IPV6CALC_VERSION"  , PACKAGE_VERSION, formatoptions);
 		printout("IPV6CALC_COPYRIGHT", PROGRAM_COPYRIGHT, formatoptions | FORMATOPTION_mr_quote_default);
@@ -420,6 +708,10 @@ static void printfooter(const uint32_t formatoptions) {
 
 		printout("IPV6CALC_CAPABILITIES", tempstring, formatoptions | FORMATOPTION_mr_quote_default);
 	};
+
+	if ((formatoptions & FORMATOPTION_mr_json) != 0) {
+		showinfo_json_flush();
+	};
 };
 
 
@@ -527,6 +819,11 @@ static void print_ip2location(const ipv6calc_ipaddr *ipaddrp, const uint32_t for
 		return;
 	};
 
+	if (! SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_IP2LOCATION)) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "IP2Location(BIN) lookup not requested by filter");
+		return;
+	};
+
 	/* get all information */
 	ret = libipv6calc_db_wrapper_IP2Location_all_by_addr(ipaddrp, &record);
 
@@ -549,6 +846,11 @@ static void print_ip2location2(const ipv6calc_ipaddr *ipaddrp, const uint32_t fo
 		return;
 	};
 
+	if (! SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_IP2LOCATION2)) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "IP2Location(MMDB) lookup not requested by filter");
+		return;
+	};
+
 	/* get all information */
 	ret = libipv6calc_db_wrapper_IP2Location2_all_by_addr(ipaddrp, &record);
 
@@ -568,6 +870,11 @@ static void print_geoip2(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatop
 		return;
 	};
 
+	if (! SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_GEOIP2)) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "GeoIP(MMDB) lookup not requested by filter");
+		return;
+	};
+
 	int ret;
 
 	libipv6calc_db_wrapper_geolocation_record record;
@@ -591,6 +898,11 @@ static void print_dbip2(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatopt
 		return;
 	};
 
+	if (! SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_DBIP2)) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "DBIP(MMDB) lookup not requested by filter");
+		return;
+	};
+
 	int ret;
 
 	libipv6calc_db_wrapper_geolocation_record record;
@@ -614,6 +926,11 @@ static void print_external(const ipv6calc_ipaddr *ipaddrp, const uint32_t format
 		return;
 	};
 
+	if (! SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_EXTERNAL)) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "External(BDB) lookup not requested by filter");
+		return;
+	};
+
 	int ret;
 
 	char returnedCountry[256] = "";
@@ -747,10 +1064,12 @@ static void print_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t fo
 	if ((ipv4addrp->typeinfo & (IPV4_ADDR_GLOBAL)) != 0) {
 		/* get AS Information */
 		data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
-		as_num32 = libipv4addr_as_num32_by_addr(ipv4addrp, &data_source);
-		if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) == 0) {
-			if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_AS) == 1) {
-				as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, &data_source, as_orgname, sizeof(as_orgname));
+		if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_AS)) {
+			as_num32 = libipv4addr_as_num32_by_addr(ipv4addrp, &data_source);
+			if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) == 0) {
+				if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_AS) == 1) {
+					as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, &data_source, as_orgname, sizeof(as_orgname));
+				};
 			};
 		};
 
@@ -789,7 +1108,9 @@ static void print_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t fo
 
 		/* get CountryCode Information */
 		data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
-		cc_index = libipv4addr_cc_index_by_addr(ipv4addrp, &data_source);
+		if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_CC)) {
+			cc_index = libipv4addr_cc_index_by_addr(ipv4addrp, &data_source);
+		};
 
 		if (cc_index < COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN) {
 			libipv6calc_db_wrapper_country_code_by_cc_index(tempstring2, sizeof(tempstring2), cc_index);
@@ -816,8 +1137,11 @@ static void print_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t fo
 		};
 
 		// get GeonameID
-		unsigned int GeonameID_type;
-		uint32_t GeonameID = libipv4addr_GeonameID_by_addr(ipv4addrp, &data_source, &GeonameID_type);
+		unsigned int GeonameID_type = IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN;
+		uint32_t GeonameID = IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN;
+		if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_GEONAMEID)) {
+			GeonameID = libipv4addr_GeonameID_by_addr(ipv4addrp, &data_source, &GeonameID_type);
+		};
 		if (GeonameID != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
 			if ( machinereadable != 0 ) {
 				snprintf(tempstring, sizeof(tempstring), "%u", GeonameID);
@@ -849,33 +1173,35 @@ static void print_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t fo
 	};
 
 
-	DEBUGPRINT_NA(DEBUG_showinfo, "get registry");
+	if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_REGISTRY)) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "get registry");
 
-	STRCLR(tempstring2);
-	if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) != 0) {
-		registry = libipv4addr_registry_num_by_addr(ipv4addrp);
-		STRCAT(tempstring2, libipv6calc_registry_string_by_num(registry));
-	} else {
-		libipv6calc_db_wrapper_registry_string_by_ipv4addr(ipv4addrp, tempstring, sizeof(tempstring));
-		STRCAT(tempstring2, tempstring);
+		STRCLR(tempstring2);
+		if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) != 0) {
+			registry = libipv4addr_registry_num_by_addr(ipv4addrp);
+			STRCAT(tempstring2, libipv6calc_registry_string_by_num(registry));
+		} else {
+			libipv6calc_db_wrapper_registry_string_by_ipv4addr(ipv4addrp, tempstring, sizeof(tempstring));
+			STRCAT(tempstring2, tempstring);
 
-		DEBUGPRINT_NA(DEBUG_showinfo, "try to get additional information from databases");
-		r = libipv6calc_db_wrapper_info_by_ipv4addr(ipv4addrp, tempstring3, sizeof(tempstring3));
-		if (r == 0) {
-			// info found, append to registry
-			STRCAT(tempstring2, "(");
-			STRCAT(tempstring2, tempstring3);
-			STRCAT(tempstring2, ")");
+			DEBUGPRINT_NA(DEBUG_showinfo, "try to get additional information from databases");
+			r = libipv6calc_db_wrapper_info_by_ipv4addr(ipv4addrp, tempstring3, sizeof(tempstring3));
+			if (r == 0) {
+				// info found, append to registry
+				STRCAT(tempstring2, "(");
+				STRCAT(tempstring2, tempstring3);
+				STRCAT(tempstring2, ")");
+			};
 		};
-	};
 
-	if (machinereadable != 0) {
-		printout2("IPV4_REGISTRY", embeddedipv4string, tempstring2, formatoptions);
-	} else {
-		if (strlen(embeddedipv4string) > 0) {
-			fprintf(stdout, "IPv4 registry for %s: %s\n", embeddedipv4string, tempstring2);
+		if (machinereadable != 0) {
+			printout2("IPV4_REGISTRY", embeddedipv4string, tempstring2, formatoptions);
 		} else {
-			fprintf(stdout, "IPv4 registry: %s\n", tempstring2);
+			if (strlen(embeddedipv4string) > 0) {
+				fprintf(stdout, "IPv4 registry for %s: %s\n", embeddedipv4string, tempstring2);
+			} else {
+				fprintf(stdout, "IPv4 registry: %s\n", tempstring2);
+			};
 		};
 	};
 
@@ -929,11 +1255,13 @@ static void print_asn(const uint32_t asn, const uint32_t formatoptions) {
 		fprintf(stdout, "Autonomous System Number: %s\n", helpstring);
 	};
 
-	registry = libipv6calc_db_wrapper_registry_num_by_as_num32(asn);	
-	if ( machinereadable != 0 ) {
-		printout("AS_NUM_REGISTRY", libipv6calc_registry_string_by_num(registry), formatoptions);
-	} else {
-		fprintf(stdout, "Registry of Autonomous System Number: %s\n", libipv6calc_registry_string_by_num(registry));
+	if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_REGISTRY)) {
+		registry = libipv6calc_db_wrapper_registry_num_by_as_num32(asn);	
+		if ( machinereadable != 0 ) {
+			printout("AS_NUM_REGISTRY", libipv6calc_registry_string_by_num(registry), formatoptions);
+		} else {
+			fprintf(stdout, "Registry of Autonomous System Number: %s\n", libipv6calc_registry_string_by_num(registry));
+		};
 	};
 	
 	return;
@@ -998,7 +1326,10 @@ static void print_eui48(const ipv6calc_macaddr *macaddrp, const uint32_t formato
 	};
 	
 	/* vendor string */
-	result = libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(helpstring, sizeof(helpstring), macaddrp);
+	result = -1;
+	if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_IEEE)) {
+		result = libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(helpstring, sizeof(helpstring), macaddrp);
+	};
 	if (result == 0) {
 		if ( machinereadable != 0 ) {
 			printout("OUI", helpstring, formatoptions | FORMATOPTION_mr_quote_default);
@@ -1066,7 +1397,10 @@ static void print_eui64(const ipv6calc_eui64addr *eui64addrp, const uint32_t for
 		macaddr.addr[i] = eui64addrp->addr[i];
 	};
 
-	result = libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(helpstring, sizeof(helpstring), &macaddr);
+	result = -1;
+	if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_IEEE)) {
+		result = libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(helpstring, sizeof(helpstring), &macaddr);
+	};
 	if (result == 0) {
 		if ( machinereadable != 0 ) {
 			printout("OUI", helpstring, formatoptions | FORMATOPTION_mr_quote_default);
@@ -1206,7 +1540,10 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 		/* CountryCode */
 		DEBUGPRINT_NA(DEBUG_showinfo, "get country code");
 		data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
-		cc_index = libipv6addr_cc_index_by_addr(ipv6addrp, &data_source);
+		cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+		if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_CC)) {
+			cc_index = libipv6addr_cc_index_by_addr(ipv6addrp, &data_source);
+		};
 
 		if (cc_index > COUNTRYCODE_INDEX_MAX) {
 			if ( machinereadable != 0 ) {
@@ -1237,11 +1574,14 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 		/* AS */
 		DEBUGPRINT_NA(DEBUG_showinfo, "get AS number");
 		data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
-		as_num32 = libipv6addr_as_num32_by_addr(ipv6addrp, &data_source);
+		as_num32 = ASNUM_AS_UNKNOWN;
+		if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_AS)) {
+			as_num32 = libipv6addr_as_num32_by_addr(ipv6addrp, &data_source);
 
-		if ((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) == 0) {
-			if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_AS) == 1) {
-				as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, &data_source, as_orgname, sizeof(as_orgname));
+			if ((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) == 0) {
+				if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_AS) == 1) {
+					as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, &data_source, as_orgname, sizeof(as_orgname));
+				};
 			};
 		};
 
@@ -1282,7 +1622,8 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 
 
 	/* GeonameID */
-	if (((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_AGU)) != 0)
+	if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_GEONAMEID)
+	    && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_AGU)) != 0)
 	    && ! (((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) != 0) && (((ipv6addrp->typeinfo2 & IPV6_ADDR_TYPE2_ANONYMIZED_GEONAMEID)) == 0))) {
 		// get GeonameID
 		unsigned int GeonameID_type;
@@ -1315,30 +1656,32 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 
 
 	/* IPv6 Registry */
-	DEBUGPRINT_NA(DEBUG_showinfo, "get registry");
-	STRCLR(tempstring2);
-	if (((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) != 0) \
-		&& ((ipv6addrp->typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4_IN_PREFIX) == 0)) {
-		registry = libipv6addr_registry_num_by_addr(ipv6addrp);
-		STRCAT(tempstring2, libipv6calc_registry_string_by_num(registry));
-	} else {
-		libipv6calc_db_wrapper_registry_string_by_ipv6addr(ipv6addrp, tempstring, sizeof(tempstring));
-		STRCAT(tempstring2, tempstring);
+	if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_REGISTRY)) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "get registry");
+		STRCLR(tempstring2);
+		if (((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) != 0) \
+			&& ((ipv6addrp->typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4_IN_PREFIX) == 0)) {
+			registry = libipv6addr_registry_num_by_addr(ipv6addrp);
+			STRCAT(tempstring2, libipv6calc_registry_string_by_num(registry));
+		} else {
+			libipv6calc_db_wrapper_registry_string_by_ipv6addr(ipv6addrp, tempstring, sizeof(tempstring));
+			STRCAT(tempstring2, tempstring);
 
-		DEBUGPRINT_NA(DEBUG_showinfo, "try to get additional information");
-		r = libipv6calc_db_wrapper_info_by_ipv6addr(ipv6addrp, tempstring3, sizeof(tempstring3));
-		if (r == 0) {
-			// info found, append to registry
-			STRCAT(tempstring2, "(");
-			STRCAT(tempstring2, tempstring3);
-			STRCAT(tempstring2, ")");
+			DEBUGPRINT_NA(DEBUG_showinfo, "try to get additional information");
+			r = libipv6calc_db_wrapper_info_by_ipv6addr(ipv6addrp, tempstring3, sizeof(tempstring3));
+			if (r == 0) {
+				// info found, append to registry
+				STRCAT(tempstring2, "(");
+				STRCAT(tempstring2, tempstring3);
+				STRCAT(tempstring2, ")");
+			};
 		};
-	};
 
-	if ( machinereadable != 0 ) {
-		printout("IPV6_REGISTRY", tempstring2, formatoptions);
-	} else {
-		fprintf(stdout, "Registry for address: %s\n", tempstring2);
+		if ( machinereadable != 0 ) {
+			printout("IPV6_REGISTRY", tempstring2, formatoptions);
+		} else {
+			fprintf(stdout, "Registry for address: %s\n", tempstring2);
+		};
 	};
 
 
@@ -1360,10 +1703,10 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 				fprintf(stdout, "Address type is 6to4 and included IPv4 address is: %s\n", helpstring);
 			};
 
-			/* get registry string */
-			retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr, helpstring, sizeof(helpstring));
+			/* get registry string (only shown in human readable output) */
 			if ( machinereadable != 0 ) {
 			} else {
+				retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr, helpstring, sizeof(helpstring));
 				fprintf(stdout, "IPv4 registry of 6to4 address: %s\n", helpstring);
 			};
 		};
@@ -1398,11 +1741,10 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 					fprintf(stdout, "Address type is Teredo and included IPv4 server address is: %s and client port: %u\n", helpstring, (unsigned int) port);
 				};
 
-				/* get registry string */
-				retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr2, helpstring, sizeof(helpstring));
-				
+				/* get registry string (only shown in human readable output) */
 				if ( machinereadable != 0 ) {
 				} else {
+					retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr2, helpstring, sizeof(helpstring));
 					fprintf(stdout, "IPv4 registry of Teredo server address: %s\n", helpstring);
 				};
 			};
@@ -1428,10 +1770,10 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 				fprintf(stdout, "Address type is IPv6 Rapid Deployment and included IPv4 address is: %s\n", helpstring);
 			};
 
-			/* get registry string */
-			retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr, helpstring, sizeof(helpstring));
+			/* get registry string (only shown in human readable output) */
 			if ( machinereadable != 0 ) {
 			} else {
+				retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr, helpstring, sizeof(helpstring));
 				fprintf(stdout, "IPv4 registry of IPv6 Rapid Deployment address: %s\n", helpstring);
 			};
 		};
@@ -1679,7 +2021,10 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 	};
 END:
 
-	i = libipv6calc_db_wrapper_registry_num_by_ipv6addr(ipv6addrp);
+	i = REGISTRY_RESERVED;
+	if (SHOWINFO_GROUP_REQUESTED(SHOWINFO_GROUP_GEOLOCATION)) {
+		i = libipv6calc_db_wrapper_registry_num_by_ipv6addr(ipv6addrp);
+	};
 	if ((i != REGISTRY_RESERVED) && (i != REGISTRY_6BONE)) {
 		if (((ipv6addrp->typeinfo & IPV6_NEW_ADDR_AGU) != 0) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO | IPV6_NEW_ADDR_ORCHID | IPV6_ADDR_ANONYMIZED_PREFIX)) == 0)) {
 
@@ -106,6 +106,22 @@
 
 #define IPV6CALC_OUTPUT_VERSION	23
 
+/* lookup groups, skipped in case no token of group is selected by machine readable filter */
+#define SHOWINFO_GROUP_CC		0x00000001
+#define SHOWINFO_GROUP_AS		0x00000002
+#define SHOWINFO_GROUP_GEONAMEID	0x00000004
+#define SHOWINFO_GROUP_REGISTRY		0x00000008
+#define SHOWINFO_GROUP_IEEE		0x00000010
+#define SHOWINFO_GROUP_IP2LOCATION	0x00000100
+#define SHOWINFO_GROUP_IP2LOCATION2	0x00000200
+#define SHOWINFO_GROUP_GEOIP2		0x00000400
+#define SHOWINFO_GROUP_DBIP2		0x00000800
+#define SHOWINFO_GROUP_EXTERNAL		0x00001000
+#define SHOWINFO_GROUP_GEOLOCATION	0x00001f00
+#define SHOWINFO_GROUP_ALL		0xffffffff
+
+#define SHOWINFO_FILTER_ENTRIES_MAX	32	// maximum amount of tokens in machine readable filter
+
 /* prototypes */
 extern int  showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp, const uint32_t formatoptions);
 extern int  showinfo_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t formatoptions);
@@ -113,3 +129,5 @@ extern int  showinfo_eui48(const ipv6calc_macaddr *macaddrp, const uint32_t form
 extern int  showinfo_eui64(const ipv6calc_eui64addr *eui64addrp, const uint32_t formatoptions);
 extern int  showinfo_asn(const uint32_t asn, const uint32_t formatoptions);
 extern void showinfo_availabletypes(void);
+extern int  showinfo_filter_init(const uint32_t formatoptions);
+extern void showinfo_json_error(const char *input, const char *message);
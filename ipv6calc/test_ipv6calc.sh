@@ -345,6 +345,9 @@ testscenarios_pipe() {
 3ffe::1:ff00:1234,--in ipv6addr --out ipv6addr --printuncompressed,3ffe:0:0:0:0:1:ff00:1234
 3ffe::1:ff00:1234,--in ipv6addr --out ipv6addr --printuncompressed --printprefix --forceprefix 96,3ffe:0:0:0:0:1
 192.0.2.1\\\n2001:db8::1,--addr2cc,--
+192.0.2.1\\\n2001:db8::1,-m -i -q --print-record-end,IPV6=2001:0db8:0000:0000:0000:0000:0000:0001
+invalid\\\n2001:db8::1,-m -i -q --print-record-end,IPV6CALC_RECORD_END=1
+invalid\\\n2001:db8::1,-m -i -q --print-record-end,IPV6CALC_RECORD_END=0
 END
 
 }
@@ -519,6 +522,25 @@ else
 	echo "NOTICE: $test not executed (feature missing: DB_IPV4_DUMP)"
 fi
 
+test="run 'ipv6calc' database dump for IPv4 by CountryCode aggregated and as nftables sets per CountryCode"
+if ./ipv6calc --has-feature DB_IPV4_DUMP_CC; then
+	echo "INFO  : $test"
+	lines=$(./ipv6calc -q -A dbdump -E ipv4.db.cc=VN | wc -l)
+	lines_aggregated=$(./ipv6calc -q -A dbdump -E ipv4.db.cc=VN --dump-aggregate | wc -l)
+	if [ $lines_aggregated -eq 0 -o $lines_aggregated -gt $lines ]; then
+		echo "ERROR : $test failed (aggregated: $lines_aggregated, not aggregated: $lines)"
+		exit 1
+	fi
+	sets=$(./ipv6calc -q -A dbdump -E ipv4.db.cc=VN,ipv4.db.cc=DE --print-nftables 'Net_%CC_IPv4' | grep -c "^add set inet filter Net_[A-Z][A-Z]_IPv4 { type ipv4_addr; flags interval; }$")
+	if [ $sets -ne 2 ]; then
+		echo "ERROR : $test failed (nftables sets: $sets)"
+		exit 1
+	fi
+	echo "INFO  : $test successful"
+else
+	echo "NOTICE: $test not executed (feature missing: DB_IPV4_DUMP_CC)"
+fi
+
 test="run 'ipv6calc' database dump for IPv6 by CountryCode"
 if ./ipv6calc --has-feature DB_IPV6_DUMP_CC; then
 	echo "INFO  : $test"
@@ -532,6 +554,82 @@ else
 	echo "NOTICE: $test not executed (feature missing: DB_IPV6_DUMP)"
 fi
 
+test="run 'ipv6calc' database dump for IPv6 by ASN (MaxMindDB search tree traversal)"
+if ./ipv6calc --has-feature DB_IPV6_DUMP_CC && ./ipv6calc --has-feature DB_IPV6_AS; then
+	echo "INFO  : $test"
+	if ./ipv6calc -q -A dbdump -E ipv6.db.asn=3320 2>&1 | grep -q "no database available supporting dump"; then
+		echo "NOTICE: $test not executed (no GeoIP2/DBIP2 database with ASN available)"
+	else
+		lines=$(./ipv6calc -q -A dbdump -E ipv6.db.asn=3320 --dump-aggregate | wc -l)
+		if [ $lines -eq 0 ]; then
+			echo "ERROR : $test failed"
+			exit 1
+		fi
+		echo "INFO  : $test successful"
+	fi
+else
+	echo "NOTICE: $test not executed (feature missing: DB_IPV6_DUMP_CC/DB_IPV6_AS)"
+fi
+
+# MaxMindDB search tree traversal: IPv4 subtree/aliases are skipped, prefixes longer than /64 are collapsed,
+# dumped prefixes are cross-checked by lookup of the same source and (if available) the 'External' database
+for source in GeoIP2:GeoIPv6:"GeoIP(MMDB)" DBIP2:DBIPv6:"db-ip.com(MMDB)"; do
+	name="${source%%:*}"
+	feature="${source#*:}"; feature="${feature%%:*}"
+	sourcename="${source##*:}"
+	test="run 'ipv6calc' database dump for IPv6 by CountryCode from $name (MaxMindDB search tree traversal)"
+	if ! ./ipv6calc --has-feature $feature; then
+		echo "NOTICE: $test not executed (feature missing: $feature)"
+		continue
+	fi
+	echo "INFO  : $test"
+	prefixes=$(./ipv6calc -q --db-priorization $name -A dbdump -E ipv6.db.cc=DE --dump-aggregate)
+	if [ -z "$prefixes" ]; then
+		echo "ERROR : $test failed (no prefixes)"
+		exit 1
+	fi
+	if echo "$prefixes" | grep -q -E "^(::|2002:)"; then
+		echo "ERROR : $test failed (IPv4 subtree/alias not skipped)"
+		echo "$prefixes" | grep -E "^(::|2002:)" | head -5
+		exit 1
+	fi
+	if echo "$prefixes" | awk -F/ '$2 > 64 { exit 1 }'; then
+		true
+	else
+		echo "ERROR : $test failed (prefix longer than /64)"
+		exit 1
+	fi
+	hits_source=0
+	hits_external=0
+	checks_external=0
+	for prefix in $(echo "$prefixes" | head -20); do
+		address="${prefix%/*}"
+		if ./ipv6calc -q --db-priorization $name -m -i $address | grep -q "^IPV6_COUNTRYCODE_SOURCE=$sourcename$"; then
+			if ./ipv6calc -q --db-priorization $name -m -i $address | grep -q "^IPV6_COUNTRYCODE=DE$"; then
+				hits_source=$[ $hits_source + 1 ]
+			else
+				echo "ERROR : $test failed (lookup of dumped prefix returns other CountryCode: $prefix)"
+				exit 1
+			fi
+		fi
+		if ./ipv6calc -q --db-priorization External -m -i $address | grep -q "^IPV6_COUNTRYCODE_SOURCE=External(BDB)$"; then
+			checks_external=$[ $checks_external + 1 ]
+			if ./ipv6calc -q --db-priorization External -m -i $address | grep -q "^IPV6_COUNTRYCODE=DE$"; then
+				hits_external=$[ $hits_external + 1 ]
+			fi
+		fi
+	done
+	if [ $hits_source -eq 0 ]; then
+		echo "ERROR : $test failed (lookup of dumped prefixes not served by $name)"
+		exit 1
+	fi
+	if [ $checks_external -gt 0 -a $[ $hits_external * 2 ] -lt $checks_external ]; then
+		echo "ERROR : $test failed (dumped prefixes mostly not DE according to 'External' database: $hits_external/$checks_external)"
+		exit 1
+	fi
+	echo "INFO  : $test successful (External cross-check: $hits_external/$checks_external)"
+done
+
 ## genprivacyiid
 test="run 'ipv6calc' action 'genprivacyiid'"
 echo "INFO  : $test"
@@ -561,6 +659,58 @@ $verbose || echo
 echo "INFO  : $test successful"
 
 
+## ptrgen
+test="run 'ipv6calc' action 'ptrgen'"
+echo "INFO  : $test"
+for spec in "2001:db8:1::/48 0xfe-0x102 1" "2001:db8:1::/48 0xfff0-0x10010 0x10" "192.0.2.0/23 250-260 3"; do
+	set -- $spec
+	info="INFO  : test './ipv6calc -q -A ptrgen --ptr-range $2 --ptr-step $3 --ptr-template \"%r %a %n\" $1'"
+	$verbose && echo "$info"
+
+	result="`./ipv6calc -q -A ptrgen --ptr-range $2 --ptr-step $3 --ptr-template "%r %a %n" $1`"
+	if [ $? -ne 0 ]; then
+		$verbose || echo "$info"
+		echo "Error executing 'ipv6calc'!"
+		exit 1
+	fi
+
+	# compare against single address conversion
+	echo "$result" | while read name address host; do
+		case $address in
+		    *:*)
+			expected="`./ipv6calc -q --out revnibbles.arpa $address`"
+			;;
+		    *)
+			expected="`./ipv6calc -q --out revipv4 $address`"
+			;;
+		esac
+		if [ "$name" != "$expected" ]; then
+			$verbose || echo "$info"
+			echo "Result is not matching for host $host ($address)!"
+			echo "Result is      : $name"
+			echo "Result expected: $expected"
+			exit 1
+		fi
+	done || exit 1
+	$verbose || echo -n "."
+done || exit 1
+
+# large range crossing output buffer flushes
+result="`./ipv6calc -q -A ptrgen --ptr-range 0-99999 --ptr-template "%r IN PTR host-%x.example.net." 2001:db8::/64 | tail -1`"
+if [ "$result" != "f.9.6.8.1.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.0.8.b.d.0.1.0.0.2.ip6.arpa. IN PTR host-1869f.example.net." ]; then
+	echo "ERROR : $test failed (last record of large range): $result"
+	exit 1
+fi
+
+# range exceeding prefix
+if ./ipv6calc -q -A ptrgen --ptr-range 0-256 192.0.2.0/24 >/dev/null 2>&1; then
+	echo "ERROR : $test failed (range exceeding prefix not detected)"
+	exit 1
+fi
+$verbose || echo
+echo "INFO  : $test successful"
+
+
 test="run 'ipv6calc' input validation tests (empty input)"
 echo "INFO  : $test"
 ./ipv6calc -m --in -? | while read inputformat; do
@@ -399,7 +399,36 @@ analyze() {
 
 }
 
+verify() {
+	f="$1"
+
+	if [ -z "$f" ]; then
+		echo "ERROR : missing file (arg2)"
+		return 1
+	fi
+
+	echo "INFO : verify integer implementation against floating point implementation: $f" >&2
+
+	# R=: floating point implementation, F=: integer implementation
+	cat $f | ./ipv6calc --print-iid-var | awk '{
+		r = $2; sub(/^R=/, "", r);
+		f = $NF; sub(/^F=/, "", f);
+		n++;
+		if (r != f) {
+			print "ERROR : result mismatch: " $1 " R=" r " F=" f;
+			e++;
+		};
+	} END {
+		print "INFO : verified: " n " mismatch: " e+0;
+		if (e > 0) { exit 1; };
+	}'
+}
+
 case $1 in
+    verify)
+	verify $2
+	exit $?
+	;;
     generate)
 	generate
 	exit 0
@@ -425,7 +454,7 @@ case $1 in
 	exit 0
 	;;
     *)
-	echo "Usage: `basename $0` generate|analyze <file1> <file2>"
+	echo "Usage: `basename $0` generate|analyze <file1> <file2>|verify <file>"
 	exit 1
 	;;
 esac
@@ -452,6 +452,10 @@ a909:16fa:9092:23ff:a909:4941::7	IPV6_REGISTRY=RIPENCC
 1.2.3.4					IPV4=1.2.3.4|--mrst IPV4
 1.2.3.4					IPV4="1.2.3.4"|--mrst IPV4 --mrqva
 2a01:238:423d:8800:85b3:9e6b:3019:8909	IPV4=""|--mrstpa IPV4 --mrqva
+2a01:238:423d:8800:85b3:9e6b:3019:8909	IPV4=""|--mrstpa IPV4,IPV6_TYPE --mrqva
+a909:16fa:9092:23ff:a909:4941::7	IPV6_COUNTRYCODE=DE|--mrst IPV6_COUNTRYCODE,IPV6_AS_NUM
+a909:16fa:9092:23ff:a909:4941::7	IPV6_AS_NUM=8767|--mrst IPV6_COUNTRYCODE,IPV6_AS_NUM
+242.222.34.63				8767|--mrtvo IPV._AS_NUM,IPV6_REGISTRY
 2a01:238:423d:8800:85b3:9e6b:3019:8909	"ipv6,unicast,global-unicast,productive,iid-random,iid,iid-local"|--mrqva --mrtvo IPV6_TYPE
 2a01:238:423d:8800:85b3:9e6b:3019:8909	ipv6,unicast,global-unicast,productive,iid-random,iid,iid-local|--mrqvn --mrtvo IPV6_TYPE
 2a01:238:423d:8800:85b3:9e6b:3019:8909	IPV6_TYPE=ipv6,unicast,global-unicast,productive,iid-random,iid,iid-local|--mrst IPV6_TYPE
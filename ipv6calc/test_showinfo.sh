@@ -234,6 +234,39 @@ done || exit 1
 $verbose || echo
 echo "INFO  : $test successful"
 
+test="test showinfo JSON Lines output in pipe mode"
+echo "INFO  : $test"
+result="$(printf '1.2.3.4\n2001:db8::1\n00:02:b3:01:23:45\n' | ./ipv6calc -i --mrjson --mrst IPV4,IPV6,EUI48_SCOPE,IPV6CALC_NAME)"
+if [ "$result" != '{"IPV4":"1.2.3.4","IPV6CALC_NAME":"ipv6calc"}
+{"IPV6":"2001:0db8:0000:0000:0000:0000:0000:0001","IPV6CALC_NAME":"ipv6calc"}
+{"EUI48_SCOPE":"global","IPV6CALC_NAME":"ipv6calc"}' ]; then
+	echo "ERROR: unexpected result"
+	echo "$result"
+	exit 1
+fi
+if [ "$(printf '1.2.3.4\n2001:db8::1\n' | ./ipv6calc -i --mrjson | grep -c '^{"IPV[46]":.*}$')" != "2" ]; then
+	echo "ERROR: unexpected result (no filter)"
+	printf '1.2.3.4\n2001:db8::1\n' | ./ipv6calc -i --mrjson
+	exit 1
+fi
+result="$(printf '1.2.3.4\nfoo\n' | ./ipv6calc -q -i --mrjson --mrst IPV4 --print-record-end 2>/dev/null)"
+if [ "$result" != '{"IPV4":"1.2.3.4"}
+{"IPV6CALC_INPUT":"foo","IPV6CALC_ERROR":"Input-type isn'"'"'t autodetected"}' ]; then
+	echo "ERROR: unexpected result (invalid input, record end)"
+	echo "$result"
+	exit 1
+fi
+# empty line results in error object (one line per input), invalid UTF-8 is replaced
+result="$(printf '1.2.3.4\n\nfoo\377\n' | ./ipv6calc -q -i --mrjson --mrst IPV4 2>/dev/null)"
+if [ "$result" != '{"IPV4":"1.2.3.4"}
+{"IPV6CALC_INPUT":"","IPV6CALC_ERROR":"Line contains no token"}
+{"IPV6CALC_INPUT":"foo\ufffd","IPV6CALC_ERROR":"Input-type isn'"'"'t autodetected"}' ]; then
+	echo "ERROR: unexpected result (empty line, invalid UTF-8)"
+	echo "$result"
+	exit 1
+fi
+echo "INFO  : $test successful"
+
 if [ "$1" = "minimal" ]; then
 	echo "NOTICE: GeoIP/IP2Location/DBIP tests skipped (option 'minimal' used)"
 	exit 0
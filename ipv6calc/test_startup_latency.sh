@@ -0,0 +1,65 @@
+#!/bin/bash
+#
+# Project    : ipv6calc
+# File       : test_startup_latency.sh
+# Copyright  : 2026-2026 by Peter Bieringer <pb (at) bieringer.de>
+#
+# Benchmark script for startup latency of one-shot ipv6calc calls
+#
+# Usage: test_startup_latency.sh [<count> [<reference binary>]]
+#  e.g. compare against an older build:
+#   ./test_startup_latency.sh 1000 /path/to/old/ipv6calc
+
+if [ ! -x ./ipv6calc ]; then
+	echo "Binary './ipv6calc' missing or not executable"
+	exit 1
+fi
+
+count=${1:-500}
+reference="$2"
+
+if [ -n "$reference" -a ! -x "$reference" ]; then
+	echo "Reference binary '$reference' missing or not executable"
+	exit 1
+fi
+
+# conversion without database (lazy initialization skips database backends)
+# and showinfo (database backends are initialized)
+testlist="--out revnibbles.arpa 2001:db8::1
+-q -i -m 2001:db8::1"
+
+# run given binary <count> times with options, print average in microseconds
+run_latency() {
+	local binary="$1"
+	shift
+	local start end i
+
+	start=$(date +%s%N)
+	i=0
+	while [ $i -lt $count ]; do
+		$binary $* >/dev/null 2>&1
+		i=$[ $i + 1 ]
+	done
+	end=$(date +%s%N)
+
+	echo $[ ($end - $start) / 1000 / $count ]
+}
+
+echo "INFO  : startup latency, amount of calls per test: $count" >&2
+
+echo "$testlist" | while read options; do
+	[ -z "$options" ] && continue
+
+	ipv6calc_options="$options"
+	if [ -n "$IPV6CALC_OPTIONS" ]; then
+		ipv6calc_options="$IPV6CALC_OPTIONS $options"
+	fi
+
+	latency=$(run_latency ./ipv6calc $ipv6calc_options)
+	if [ -n "$reference" ]; then
+		latency_ref=$(run_latency $reference $ipv6calc_options)
+		echo "INFO  : $latency usec/call (reference: $latency_ref usec/call): $options"
+	else
+		echo "INFO  : $latency usec/call: $options"
+	fi
+done
@@ -12,6 +12,7 @@
 #include <stdlib.h> 
 #include <getopt.h> 
 #include <unistd.h>
+#include <ctype.h>
 
 #include "ipv6loganon.h"
 #include "libipv6calcdebug.h"
@@ -44,6 +45,7 @@
 
 long int ipv6calc_debug = 0; // ipv6calc_debug usage ok
 int flag_nocache = 0;
+int flag_alladdresses = 0;
 
 /* anonymization default values */
 s_ipv6calc_anon_set ipv6calc_anon_set;
@@ -60,8 +62,10 @@ int feature_kg      = 0; // will be checked later
 
 
 /* prototypes */
-static int anonymizetoken(char *result, const size_t resultstring_length, const char *token);
+static int anonymizetoken(char *result, const size_t resultstring_length, const char *token, const int flag_silent);
+static int anonymizeline(char *result, const size_t result_length, const char *line);
 static void lineparser();
+static void cache_lru_generation_check(void);
 
 
 /* LRU cache */
@@ -208,6 +212,10 @@ int main(int argc,char *argv[]) {
 				flag_nocache = 1;
 				break;
 
+			case CMD_loganon_all_addresses:
+				flag_alladdresses = 1;
+				break;
+
 			default:
 				ipv6loganon_printinfo();
 				exit(EXIT_FAILURE);
@@ -310,6 +318,7 @@ static void lineparser(void) {
 	char linebuffer[LINEBUFFER];
 	char token[LINEBUFFER];
 	char resultstring[LINEBUFFER];
+	char resultline[LINEBUFFER * 2];
 	char *charptr, *cptr, **ptrptr;
 	int linecounter = 0, retval, i;
 
@@ -350,6 +359,31 @@ static void lineparser(void) {
 		
 		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Got line: '%s'", linebuffer);
 
+		if (flag_alladdresses == 1) {
+			/* anonymize all addresses in line */
+			retval = anonymizeline(resultline, sizeof(resultline), linebuffer);
+
+			if (retval != 0) {
+				fprintf(stderr, "Line too long after anonymization (skipped): %d\n", linecounter);
+				continue;
+			};
+
+			if (file_out_flag == 2) {
+				fprintf(FILE_OUT, "%s", resultline);
+			} else {
+				printf("%s", resultline);
+			};
+
+			if (file_out_flush == 1) {
+				if (file_out_flag == 2) {
+					fflush(FILE_OUT);
+				} else {
+					fflush(stdout);
+				};
+			};
+			continue;
+		};
+
 		/* look for first token */
 		charptr = strtok_r(linebuffer, " \t\n", ptrptr);
 		
@@ -368,7 +402,7 @@ static void lineparser(void) {
 		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Token 1: '%s'", token);
 		
 		/* call anonymizer now */
-		retval = anonymizetoken(resultstring, sizeof(resultstring), charptr);
+		retval = anonymizetoken(resultstring, sizeof(resultstring), charptr, 0);
 
 		if (retval != 0) {
 			continue;
@@ -412,10 +446,219 @@ static void lineparser(void) {
 };
 
 
+/*
+ * Scanner for address candidates (option --all-addresses)
+ *  word-at-a-time prefilter: skip all bytes until next separator character ('.', ':', '-')
+ *   contained in every IPv4/IPv6/MAC/EUI-64 address
+ */
+#define SCAN_ONES	0x0101010101010101ULL
+#define SCAN_HIGHS	0x8080808080808080ULL
+#define SCAN_HAS_BYTE(word, c) ((((word) ^ (SCAN_ONES * (c))) - SCAN_ONES) & ~((word) ^ (SCAN_ONES * (c))) & SCAN_HIGHS)
+
+static const char *scan_separator(const char *p, const char *end) {
+	uint64_t word;
+
+	while (p + sizeof(word) <= end) {
+		memcpy(&word, p, sizeof(word));
+		if ((SCAN_HAS_BYTE(word, ':') | SCAN_HAS_BYTE(word, '.') | SCAN_HAS_BYTE(word, '-')) != 0) {
+			break;
+		};
+		p += sizeof(word);
+	};
+
+	for (; p < end; p++) {
+		if ((*p == ':') || (*p == '.') || (*p == '-')) {
+			return (p);
+		};
+	};
+
+	return (NULL);
+};
+
+
+/* character possibly part of an address */
+static int scan_is_candidate_char(const char c) {
+	return ((isxdigit((unsigned char) c) != 0) || (c == ':') || (c == '.') || (c == '-'));
+};
+
+/* character which is not allowed directly before/after an address */
+static int scan_is_word_char(const char c) {
+	return ((isalnum((unsigned char) c) != 0) || (c == '_'));
+};
+
+
+/*
+ * Append string to result line
+ * ret: 0 = ok, 1 = result too long
+ */
+static int line_append(char *result, size_t *result_used, const size_t result_length, const char *string, const size_t length) {
+	if (*result_used + length >= result_length) {
+		return (1);
+	};
+
+	memcpy(result + *result_used, string, length);
+	*result_used += length;
+	result[*result_used] = '\0';
+
+	return (0);
+};
+
+
+/*
+ * Anonymize candidate of a line (validated by the library parsers in anonymizetoken)
+ * in : line, end (of line), start (of candidate), stop (end of candidate)
+ * out: resultstring, stop (shortened in case of IPv4 address with port)
+ * ret: 0 = anonymized, 1 = no address
+ */
+static int anonymizecandidate(char *resultstring, const size_t resultstring_length, const char *line, const char *end, const char *start, const char **stop_ptr) {
+	char candidate[IPV6CALC_STRING_MAX];
+	const char *stop = *stop_ptr, *colon;
+	int retval;
+
+	if (((stop - start) < 3) || ((size_t) (stop - start) >= sizeof(candidate))
+	    || ((start != line) && (scan_is_word_char(*(start - 1)) != 0))
+	    || ((stop != end) && (scan_is_word_char(*stop) != 0))) {
+		return (1);
+	};
+
+	snprintf(candidate, sizeof(candidate), "%.*s", (int) (stop - start), start);
+
+	retval = anonymizetoken(resultstring, resultstring_length, candidate, 1);
+
+	if (retval != 0) {
+		/* IPv4 address with port */
+		colon = strrchr(candidate, ':');
+		if ((colon != NULL) && (strchr(colon, '.') == NULL) && (strchr(candidate, '.') != NULL)) {
+			candidate[colon - candidate] = '\0';
+			retval = anonymizetoken(resultstring, resultstring_length, candidate, 1);
+			if (retval == 0) {
+				*stop_ptr = start + (colon - candidate);
+			};
+		};
+	};
+
+	if (retval == 0) {
+		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Replace candidate: '%s' -> '%s'", candidate, resultstring);
+	};
+
+	return (retval);
+};
+
+
+/*
+ * Anonymize all addresses in line (option --all-addresses)
+ *  candidates are validated by the library parsers (in anonymizetoken)
+ * in : line
+ * out: result
+ * ret: 0 = ok, 1 = error
+ */
+static int anonymizeline(char *result, const size_t result_length, const char *line) {
+	char resultstring[IPV6CALC_STRING_MAX];
+	const char *p = line, *end = line + strlen(line), *sep, *start, *stop, *span_end, *q, *dash, *piece_end, *piece_stop;
+	size_t result_used = 0;
+
+	result[0] = '\0';
+
+	while ((sep = scan_separator(p, end)) != NULL) {
+		/* expand to candidate span */
+		start = sep;
+		while ((start > p) && (scan_is_candidate_char(*(start - 1)) != 0)) {
+			start--;
+		};
+
+		span_end = sep;
+		while ((span_end < end) && (scan_is_candidate_char(*span_end) != 0)) {
+			span_end++;
+		};
+
+		/* strip leading/trailing separators (keep '::') */
+		while ((start < span_end) && ((*start == '.') || (*start == '-') || ((*start == ':') && (*(start + 1) != ':')))) {
+			start++;
+		};
+
+		stop = span_end;
+		while ((stop > start) && ((*(stop - 1) == '.') || (*(stop - 1) == '-') || ((*(stop - 1) == ':') && ((stop - 2 < start) || (*(stop - 2) != ':'))))) {
+			stop--;
+		};
+
+		if (anonymizecandidate(resultstring, sizeof(resultstring), line, end, start, &stop) == 0) {
+			if ((line_append(result, &result_used, result_length, p, start - p) != 0) || (line_append(result, &result_used, result_length, resultstring, strlen(resultstring)) != 0)) {
+				return (1);
+			};
+			p = stop;
+		} else if ((stop > start) && (memchr(start, '-', stop - start) != NULL)) {
+			/* addresses joined by '-' (range) or with prefix word, retry each piece */
+			if (line_append(result, &result_used, result_length, p, start - p) != 0) {
+				return (1);
+			};
+
+			q = start;
+			while (q < stop) {
+				dash = memchr(q, '-', stop - q);
+				piece_end = (dash != NULL) ? dash : stop;
+				piece_stop = piece_end;
+
+				/* piece requires an address separator (skip e.g. UUID parts) */
+				if (((memchr(q, ':', piece_end - q) != NULL) || (memchr(q, '.', piece_end - q) != NULL))
+				    && (anonymizecandidate(resultstring, sizeof(resultstring), line, end, q, &piece_stop) == 0)) {
+					/* remaining port (if any) is copied unchanged */
+					if ((line_append(result, &result_used, result_length, resultstring, strlen(resultstring)) != 0) || (line_append(result, &result_used, result_length, piece_stop, piece_end - piece_stop) != 0)) {
+						return (1);
+					};
+				} else {
+					if (line_append(result, &result_used, result_length, q, piece_end - q) != 0) {
+						return (1);
+					};
+				};
+
+				if (dash != NULL) {
+					if (line_append(result, &result_used, result_length, "-", 1) != 0) {
+						return (1);
+					};
+					q = dash + 1;
+				} else {
+					q = piece_end;
+				};
+			};
+
+			if (line_append(result, &result_used, result_length, stop, span_end - stop) != 0) {
+				return (1);
+			};
+			p = span_end;
+		} else {
+			/* no address, copy span unchanged */
+			if (line_append(result, &result_used, result_length, p, span_end - p) != 0) {
+				return (1);
+			};
+			p = span_end;
+		};
+	};
+
+	/* rest of line */
+	return (line_append(result, &result_used, result_length, p, end - p));
+};
+
+
+/*
+ * Flush LRU cache in case database was reloaded in the meantime (option --db-reload-interval)
+ */
+static void cache_lru_generation_check(void) {
+	static unsigned int cache_lru_generation = 0;
+	unsigned int generation = LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION();
+
+	if (cache_lru_generation != generation) {
+		DEBUGPRINT_NA(DEBUG_ipv6loganon_cache, "LRU cache: database reloaded, flush cache");
+		cache_lru_max = 0;
+		cache_lru_last = 0;
+		cache_lru_generation = generation;
+	};
+};
+
+
 /*
  * Anonymize token
  */
-static int anonymizetoken(char *resultstring, const size_t resultstring_length, const char *token) {
+static int anonymizetoken(char *resultstring, const size_t resultstring_length, const char *token, const int flag_silent) {
 	uint32_t inputtype = FORMAT_undefined;
 	int retval = 1, i;
 
@@ -434,6 +677,8 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 		return (1);
 	};
 
+	cache_lru_generation_check();
+
 	/* use cache ? */
 	if (flag_nocache == 0 && cache_lru_max > 0) {
 		/* check last seen one first */
@@ -494,7 +739,7 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 	/* proceed input depending on type */	
 	switch (inputtype) {
 		case FORMAT_ipv6addr:
-			retval = addr_to_ipv6addrstruct(token, resultstring, resultstring_length, &ipv6addr);
+			retval = addr_to_ipv6addrstruct_basic(token, resultstring, resultstring_length, &ipv6addr);
 			break;
 
 		case FORMAT_ipv4addr:
@@ -511,7 +756,9 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 	};
 
 	if (retval != 0) {
-		fprintf(stderr, "Can't parse string: %s (%s)\n", token, resultstring);
+		if (flag_silent == 0) {
+			fprintf(stderr, "Can't parse string: %s (%s)\n", token, resultstring);
+		};
 		return 1;
 	};
 
@@ -81,6 +81,8 @@ void ipv6loganon_printhelp(void) {
 	fprintf(stderr, "  [-c|--cachelimit <value>]  : set cache limit\n");
 	fprintf(stderr, "                               default: %d\n", cache_lru_limit);
 	fprintf(stderr, "                               maximum: %d\n", CACHE_LRU_SIZE);
+	fprintf(stderr, "  [--all-addresses]          : anonymize all IPv4/IPv6/MAC/EUI-64 addresses in line\n");
+	fprintf(stderr, "                               (default: only first token)\n");
 
 	printhelp_action_dispatcher(ACTION_anonymize, 1);
 
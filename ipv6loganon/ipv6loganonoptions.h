@@ -11,6 +11,7 @@
 #include <getopt.h> 
 
 #include "ipv6calctypes.h"
+#include "ipv6calccommands.h"
 
 
 #ifndef _ipv6loganonoptions_h_
@@ -35,6 +36,7 @@ static struct option ipv6loganon_longopts[] = {
 	{"cachelimit", required_argument, 0, (int) 'c'},
 	{"write"     , required_argument, 0, (int) 'w'},
 	{"append"    , required_argument, 0, (int) 'a'},
+	{"all-addresses", no_argument   , 0, CMD_loganon_all_addresses},
 };                
 
 #endif
@@ -462,6 +462,28 @@ if [ $? -ne 0 ]; then
 	exit 1
 fi
 
+test="run 'ipv6loganon' all addresses tests"
+echo "INFO  : $test"
+cat <<END | while IFS="|" read input result; do
+10.1.2.3 - - [10/Oct/2026:13:55:36 +0200] "GET /?ip=192.0.2.1&v6=2001:db8::1 HTTP/1.1" 200 1|10.1.2.0 - - [10/Oct/2026:13:55:36 +0200] "GET /?ip=192.0.2.0&v6=2001:db8:0:9:a929:4291:c02d:5d15 HTTP/1.1" 200 1
+xff="198.51.100.7, [2001:db8:1:2:3:4:5:6]:443" mac=00:11:22:33:44:55 src=203.0.113.9:8080.|xff="198.51.100.0, [2001:db8:1:9:a929:4291:c02d:5d15]:443" mac=00:11:22:00:00:00 src=203.0.113.0:8080.
+sshd[123]: from ::ffff:1.2.3.4 port 2222 date=2026-10-10T11:56:59Z hex=dead.beef ver=1.2.3|sshd[123]: from ::ffff:1.2.3.0 port 2222 date=2026-10-10T11:56:59Z hex=dead.beef ver=1.2.3
+range 192.0.2.1-192.0.2.9 end|range 192.0.2.0-192.0.2.0 end
+x cafe-192.0.2.1 y|x cafe-192.0.2.0 y
+x 2001:db8::1-2001:db8::2 y|x 2001:db8:0:9:a929:4291:c02d:5d15-2001:db8:0:9:a929:4291:c02d:5d15 y
+uuid 123e4567-e89b-12d3-a456-426614174000 z|uuid 123e4567-e89b-12d3-a456-426614174000 z
+END
+	output="$(echo "$input" | ./ipv6loganon -q --all-addresses)"
+	if [ "$output" != "$result" ]; then
+		echo "ERROR : unexpected result"
+		echo "IN     : $input"
+		echo "CHECK  : $result"
+		echo "OUT    : $output"
+		exit 1
+	fi
+done || exit 1
+echo "INFO  : $test successful"
+
 echo "INFO  : run 'ipv6loganon' option tests..." >&2
 # Test Scenarios
 source ../ipv6calc/test_scenarios.sh
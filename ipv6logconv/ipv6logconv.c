@@ -51,7 +51,12 @@ int flag_nocache = 0;
 
 /* prototypes */
 static int converttoken(char *result, const size_t resultstring_length, const char *token, const long int outputtype, const int flag_skipunknown);
+static int convertcolumns(char *resultstring, const size_t resultstring_length, const char *token);
+static int parsetoken(const char *token, ipv6calc_ipv6addr *ipv6addrp, ipv6calc_ipv4addr *ipv4addrp);
+static int formattoken(char *resultstring, const size_t resultstring_length, ipv6calc_ipv6addr *ipv6addrp, const ipv6calc_ipv4addr *ipv4addrp, const long int outputtype, const int flag_skipunknown);
+static int output_columns_parse(const char *string);
 static void lineparser(const long int outputtype);
+static void cache_lru_generation_check(void);
 
 
 /* LRU cache */
@@ -65,6 +70,23 @@ static long int cache_lru_key_outputtype[CACHE_LRU_SIZE];
 static char     cache_lru_value[CACHE_LRU_SIZE][IPV6CALC_STRING_MAX];
 static long int cache_lru_statistics[CACHE_LRU_SIZE];
 
+/* multi-output mode uses the same LRU ring, but keyed by binary address */
+static int      cache_lru_key_proto[CACHE_LRU_SIZE];
+static uint32_t cache_lru_key_addr[CACHE_LRU_SIZE][4];
+
+
+/* multi-output mode: columns */
+static const s_type ipv6logconv_columns[] = {
+	{ COLUMN_addrtype	, "addrtype" },
+	{ COLUMN_ipv6addrtype	, "ipv6addrtype" },
+	{ COLUMN_ouitype	, "ouitype" },
+	{ COLUMN_cc		, "cc" },
+	{ COLUMN_asn		, "asn" },
+};
+
+static int output_columns[COLUMNS_MAX];
+static int output_columns_count = 0;
+
 int feature_reg = 0;
 int feature_ieee = 0;
 
@@ -170,9 +192,12 @@ int main(int argc,char *argv[]) {
 				};
 				
 				outputtype = ipv6calctypes_checktype(optarg);
-				if (outputtype == FORMAT_undefined) {
-					fprintf(stderr, " Output option is unknown: %s\n", optarg);
-					exit(EXIT_FAILURE);
+				if ((strchr(optarg, ',') != NULL) || ((outputtype & (FORMAT_addrtype | FORMAT_ouitype | FORMAT_ipv6addrtype | FORMAT_any)) == 0)) {
+					/* multi-output mode */
+					if (output_columns_parse(optarg) != 0) {
+						exit(EXIT_FAILURE);
+					};
+					outputtype = FORMAT_undefined;
 				};
 				break;
 
@@ -242,6 +267,22 @@ int main(int argc,char *argv[]) {
 		exit(EXIT_FAILURE);
 	};
 
+	for (i = 0; i < output_columns_count; i++) {
+		if ((output_columns[i] == COLUMN_addrtype) && (feature_reg == 0)) {
+			fprintf(stderr, "Basic databases are missing for conversion and output column 'addrtype'\n");
+			exit(EXIT_FAILURE);
+		} else if ((output_columns[i] == COLUMN_ouitype) && (feature_ieee == 0)) {
+			fprintf(stderr, "Basic databases are missing for conversion and output column 'ouitype'\n");
+			exit(EXIT_FAILURE);
+		} else if ((output_columns[i] == COLUMN_cc) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_CC) != 1) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_CC) != 1)) {
+			fprintf(stderr, "Databases are missing for conversion and output column 'cc'\n");
+			exit(EXIT_FAILURE);
+		} else if ((output_columns[i] == COLUMN_asn) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_AS) != 1) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_AS) != 1)) {
+			fprintf(stderr, "Databases are missing for conversion and output column 'asn'\n");
+			exit(EXIT_FAILURE);
+		};
+	};
+
 	/* call lineparser */
 	lineparser(outputtype);
 
@@ -316,7 +357,9 @@ static void lineparser(const long int outputtype) {
 		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Token 1: '%s'", token);
 		
 		/* call converter now */
-		if ( outputtype == FORMAT_any ) {
+		if (output_columns_count > 0) {
+			retval = convertcolumns(resultstring, sizeof(resultstring), charptr);
+		} else if ( outputtype == FORMAT_any ) {
 			retval = converttoken(resultstring, sizeof(resultstring), charptr, FORMAT_addrtype, 0);
 		} else {
 			retval = converttoken(resultstring, sizeof(resultstring), charptr, outputtype, 1);
@@ -394,15 +437,27 @@ END_line:
 };
 
 
+/*
+ * Flush LRU cache in case database was reloaded in the meantime (option --db-reload-interval)
+ */
+static void cache_lru_generation_check(void) {
+	static unsigned int cache_lru_generation = 0;
+	unsigned int generation = LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION();
+
+	if (cache_lru_generation != generation) {
+		DEBUGPRINT_NA(DEBUG_ipv6logconv_processing, "LRU cache: database reloaded, flush cache");
+		cache_lru_max = 0;
+		cache_lru_last = 0;
+		cache_lru_generation = generation;
+	};
+};
+
+
 /*
  * Convert token
  */
 static int converttoken(char *resultstring, const size_t resultstring_length, const char *token, const long int outputtype, const int flag_skipunknown) {
-	uint32_t inputtype = FORMAT_undefined;
-	int retval = 1, i, registry;
-	uint32_t typeinfo_test;
-	char tempstring[IPV6CALC_STRING_MAX];
-	ipv6calc_macaddr macaddr;
+	int retval, i;
 
 	/* used structures */
 	ipv6calc_ipv6addr ipv6addr;
@@ -417,6 +472,8 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 		return (1);
 	};
 
+	cache_lru_generation_check();
+
 	/* use cache ? */
 	if (flag_nocache == 0 && cache_lru_max > 0) {
 		/* check last seen one first */
@@ -460,9 +517,253 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 	};
 
 
+	/* parse token */
+	if (parsetoken(token, &ipv6addr, &ipv4addr) != 0) {
+		return (1);
+	};
+
+	/* format result */
+	retval = formattoken(resultstring, resultstring_length, &ipv6addr, &ipv4addr, outputtype, flag_skipunknown);
+	if (retval != 0) {
+		return (retval);
+	};
+
+	/* use cache ? */
+	if (flag_nocache == 0) {
+		/* calculate pointer */
+		if (cache_lru_max < cache_lru_limit) {
+			cache_lru_last++;
+			cache_lru_max++;
+		} else {
+			if (cache_lru_last == cache_lru_limit) {
+				cache_lru_last = 1;
+			} else {
+				cache_lru_last++;
+			};
+		};
+
+		/* store key and value */
+		snprintf(cache_lru_key_token[cache_lru_last - 1], IPV6CALC_STRING_MAX - 1, "%s", token);
+		cache_lru_key_outputtype[cache_lru_last - 1] = outputtype;
+		snprintf(cache_lru_value[cache_lru_last - 1], IPV6CALC_STRING_MAX - 1, "%s", resultstring);
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: fill line=%d key_token=%s key_outputtype=%lx value=%s", cache_lru_last - 1, cache_lru_key_token[cache_lru_last - 1], cache_lru_key_outputtype[cache_lru_last - 1], cache_lru_value[cache_lru_last - 1]);
+	};
+
+	return (0);
+};
+
+/*
+ * Convert token into all selected output columns (multi-output mode)
+ *  token is parsed once, result of all columns is cached keyed by binary address
+ */
+static int convertcolumns(char *resultstring, const size_t resultstring_length, const char *token) {
+	int i, c, proto = 0;
+	uint32_t key_addr[4] = { 0, 0, 0, 0 };
+	uint32_t as_num32;
+	uint16_t cc_index;
+	char columnstring[IPV6CALC_STRING_MAX];
+	char columnsstring[IPV6CALC_STRING_MAX] = "";
+	char cc_text[IPV6CALC_STRING_MAX / 4];
+
+	/* used structures */
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipv4addr ipv4addr;
+
+	DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Token: '%s'", token);
+
+	/* clear resultstring */
+	resultstring[0] = '\0';
+
+	if (strlen(token) == 0) {
+		return (1);
+	};
+
+	/* parse token */
+	if (parsetoken(token, &ipv6addr, &ipv4addr) != 0) {
+		return (1);
+	};
+
+	/* binary cache key */
+	if (ipv6addr.flag_valid == 1) {
+		proto = 6;
+		for (i = 0; i < 4; i++) {
+			key_addr[i] = ipv6addr_getdword(&ipv6addr, i);
+		};
+	} else if (ipv4addr.flag_valid == 1) {
+		proto = 4;
+		key_addr[0] = ipv4addr_getdword(&ipv4addr);
+	};
+
+	cache_lru_generation_check();
+
+	/* use cache ? (only for valid addresses) */
+	if (flag_nocache == 0 && proto != 0 && cache_lru_max > 0) {
+		/* run backwards from last seen one to first entry, then round robin */
+		for (c = 0; c < cache_lru_max; c++) {
+			i = cache_lru_last - 1 - c;
+			if (i < 0) {
+				i += cache_lru_max;
+			};
+
+			if ((cache_lru_key_proto[i] == proto) && (memcmp(cache_lru_key_addr[i], key_addr, sizeof(key_addr)) == 0)) {
+				snprintf(resultstring, resultstring_length, "%s", cache_lru_value[i]);
+				cache_lru_statistics[c]++;
+				DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: hit line=%d distance=%d key_token=%s value=%s", i, c, token, resultstring);
+				return (0);
+			};
+		};
+	};
+
+	/* build columns */
+	for (c = 0; c < output_columns_count; c++) {
+		switch (output_columns[c]) {
+			case COLUMN_addrtype:
+				formattoken(columnstring, sizeof(columnstring), &ipv6addr, &ipv4addr, FORMAT_addrtype, 0);
+				break;
+
+			case COLUMN_ipv6addrtype:
+				formattoken(columnstring, sizeof(columnstring), &ipv6addr, &ipv4addr, FORMAT_ipv6addrtype, 0);
+				break;
+
+			case COLUMN_ouitype:
+				formattoken(columnstring, sizeof(columnstring), &ipv6addr, &ipv4addr, FORMAT_ouitype, 0);
+				break;
+
+			case COLUMN_cc:
+				if (ipv6addr.flag_valid == 1) {
+					cc_index = libipv6addr_cc_index_by_addr(&ipv6addr, NULL);
+				} else if (ipv4addr.flag_valid == 1) {
+					cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
+				} else {
+					cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+				};
+				libipv6calc_db_wrapper_country_code_by_cc_index(cc_text, sizeof(cc_text), cc_index);
+				snprintf(columnstring, sizeof(columnstring), "%s.cc.ipv6calc", cc_text);
+				break;
+
+			case COLUMN_asn:
+				if (ipv6addr.flag_valid == 1) {
+					as_num32 = libipv6addr_as_num32_by_addr(&ipv6addr, NULL);
+				} else if (ipv4addr.flag_valid == 1) {
+					as_num32 = libipv4addr_as_num32_by_addr(&ipv4addr, NULL);
+				} else {
+					as_num32 = ASNUM_AS_UNKNOWN;
+				};
+				if (as_num32 == ASNUM_AS_UNKNOWN) {
+					snprintf(columnstring, sizeof(columnstring), "unknown.asn.ipv6calc");
+				} else {
+					snprintf(columnstring, sizeof(columnstring), "%u.asn.ipv6calc", as_num32);
+				};
+				break;
+
+			default:
+				fprintf(stderr, " Output column isn't implemented\n");
+				return (1);
+		};
+
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Column %d: '%s'", c, columnstring);
+
+		/* append column */
+		if (c > 0) {
+			STRCAT(columnsstring, " ");
+		};
+		STRCAT(columnsstring, columnstring);
+	};
+
+	snprintf(resultstring, resultstring_length, "%s", columnsstring);
+
+	/* use cache ? */
+	if (flag_nocache == 0 && proto != 0) {
+		/* calculate pointer */
+		if (cache_lru_max < cache_lru_limit) {
+			cache_lru_last++;
+			cache_lru_max++;
+		} else {
+			if (cache_lru_last == cache_lru_limit) {
+				cache_lru_last = 1;
+			} else {
+				cache_lru_last++;
+			};
+		};
+
+		/* store key and value */
+		cache_lru_key_proto[cache_lru_last - 1] = proto;
+		memcpy(cache_lru_key_addr[cache_lru_last - 1], key_addr, sizeof(key_addr));
+		snprintf(cache_lru_value[cache_lru_last - 1], IPV6CALC_STRING_MAX, "%s", columnsstring);
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: fill line=%d key_token=%s value=%s", cache_lru_last - 1, token, cache_lru_value[cache_lru_last - 1]);
+	};
+
+	return (0);
+};
+
+
+/*
+ * Parse comma separated list of output columns
+ * in : string
+ * ret: 0 = ok, 1 = error
+ */
+static int output_columns_parse(const char *string) {
+	char tempstring[IPV6CALC_STRING_MAX];
+	char *token, *cptr, **ptrptr;
+	int i, found;
+
+	ptrptr = &cptr;
+
+	snprintf(tempstring, sizeof(tempstring), "%s", string);
+
+	output_columns_count = 0;
+
+	token = strtok_r(tempstring, ",", ptrptr);
+	while (token != NULL) {
+		found = 0;
+		for (i = 0; i < MAXENTRIES_ARRAY(ipv6logconv_columns); i++) {
+			if (strcmp(token, ipv6logconv_columns[i].token) == 0) {
+				found = 1;
+				break;
+			};
+		};
+
+		if (found == 0) {
+			fprintf(stderr, " Output column is unknown: %s\n", token);
+			return (1);
+		};
+
+		if (output_columns_count >= COLUMNS_MAX) {
+			fprintf(stderr, " Too many output columns, built-in limit: %d\n", COLUMNS_MAX);
+			return (1);
+		};
+
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_general, "Output column %d: %s", output_columns_count, token);
+		output_columns[output_columns_count] = ipv6logconv_columns[i].number;
+		output_columns_count++;
+
+		token = strtok_r(NULL, ",", ptrptr);
+	};
+
+	if (output_columns_count == 0) {
+		fprintf(stderr, " Output option is unknown: %s\n", string);
+		return (1);
+	};
+
+	return (0);
+};
+
+
+
+/*
+ * Parse token into address structures
+ * in : token
+ * out: *ipv6addrp, *ipv4addrp (flag_valid set on success)
+ * ret: 0 = ok, 1 = unknown input type
+ */
+static int parsetoken(const char *token, ipv6calc_ipv6addr *ipv6addrp, ipv6calc_ipv4addr *ipv4addrp) {
+	uint32_t inputtype = FORMAT_undefined;
+	int i;
+	char resultstring[IPV6CALC_STRING_MAX];
+
 	/* set addresses to invalid */
-	ipv6addr.flag_valid = 0;
-	ipv4addr.flag_valid = 0;
+	ipv6addrp->flag_valid = 0;
+	ipv4addrp->flag_valid = 0;
 	
 	/* autodetection */
 	inputtype = libipv6calc_autodetectinput(token);
@@ -484,29 +785,43 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 	/* proceed input depending on type */	
 	switch (inputtype) {
 		case FORMAT_ipv6addr:
-			retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
+			addr_to_ipv6addrstruct_basic(token, resultstring, sizeof(resultstring), ipv6addrp);
 			break;
 
 		case FORMAT_ipv4addr:
-			retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
+			addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), ipv4addrp);
 			break;
 	};
 
 	DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Token: '%s'", token);
 
+	return (0);
+};
+
+
+/*
+ * Format result of parsed token depending on outputtype
+ * in : *ipv6addrp, *ipv4addrp, outputtype, flag_skipunknown
+ * out: *resultstring
+ * ret: 0 = ok, 1 = skip token
+ */
+static int formattoken(char *resultstring, const size_t resultstring_length, ipv6calc_ipv6addr *ipv6addrp, const ipv6calc_ipv4addr *ipv4addrp, const long int outputtype, const int flag_skipunknown) {
+	int retval = 1, i, registry;
+	uint32_t typeinfo_test;
+	char tempstring[IPV6CALC_STRING_MAX];
+	ipv6calc_macaddr macaddr;
+	ipv6calc_ipv4addr ipv4addr = *ipv4addrp; /* local copy, can be filled from IPv6 address */
+
 	/***** postprocessing input *****/
 
 	DEBUGPRINT_NA(DEBUG_ipv6logconv_processing, "Start of postprocessing input");
 
 	switch (outputtype) {
 		case FORMAT_addrtype:
-			if (ipv6addr.flag_valid == 1) {
+			if (ipv6addrp->flag_valid == 1) {
 				DEBUGPRINT_NA(DEBUG_ipv6logconv_processing, "is IPv6 address");
 				snprintf(resultstring, resultstring_length, "ipv6-addr.addrtype.ipv6calc");
 
-				/* set type */
-				ipv6addr_settype(&ipv6addr);
-
 				/* scope of IPv6 address */
 				/* init retval */
 				for (i = 0; i < ipv6calc_ipv6addrtypestrings_entries; i++) {
@@ -515,7 +830,7 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 						break;
 					};
 				};
-				typeinfo_test = ipv6addr.typeinfo & (IPV6_NEW_ADDR_AGU | IPV6_ADDR_LINKLOCAL | IPV6_ADDR_SITELOCAL | IPV6_ADDR_MAPPED | IPV6_ADDR_COMPATv4 | IPV6_ADDR_ULUA);
+				typeinfo_test = ipv6addrp->typeinfo & (IPV6_NEW_ADDR_AGU | IPV6_ADDR_LINKLOCAL | IPV6_ADDR_SITELOCAL | IPV6_ADDR_MAPPED | IPV6_ADDR_COMPATv4 | IPV6_ADDR_ULUA);
 				if ( typeinfo_test != 0 ) {
 					/* get string */
 					for (i = 0; i < ipv6calc_ipv6addrtypestrings_entries; i++) {
@@ -536,9 +851,9 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 						break;
 					};
 				};
-				typeinfo_test = ipv6addr.typeinfo & (IPV6_NEW_ADDR_6TO4 | IPV6_NEW_ADDR_6BONE | IPV6_NEW_ADDR_PRODUCTIVE);
+				typeinfo_test = ipv6addrp->typeinfo & (IPV6_NEW_ADDR_6TO4 | IPV6_NEW_ADDR_6BONE | IPV6_NEW_ADDR_PRODUCTIVE);
 				if ( typeinfo_test != 0 ) {
-					if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_TEREDO) != 0) {
+					if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_TEREDO) != 0) {
 						snprintf(tempstring, sizeof(tempstring), "teredo.%s", resultstring);
 						snprintf(resultstring, resultstring_length, "%s", tempstring);
 					} else {
@@ -555,25 +870,25 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 				};
 
 				/* registry of IPv6 address */
-				if ( ( (ipv6addr.typeinfo & (IPV6_NEW_ADDR_6BONE | IPV6_NEW_ADDR_PRODUCTIVE) ) != 0) && ( (ipv6addr.typeinfo & (IPV6_NEW_ADDR_TEREDO)) == 0)) {
-					registry = libipv6addr_registry_num_by_addr(&ipv6addr);
+				if ( ( (ipv6addrp->typeinfo & (IPV6_NEW_ADDR_6BONE | IPV6_NEW_ADDR_PRODUCTIVE) ) != 0) && ( (ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO)) == 0)) {
+					registry = libipv6addr_registry_num_by_addr(ipv6addrp);
 					snprintf(tempstring, sizeof(tempstring), "%s.%s", libipv6calc_registry_string_by_num(registry), resultstring);
 					snprintf(resultstring, resultstring_length, "%s", tempstring);
-				} else if ( (ipv6addr.typeinfo & (IPV6_NEW_ADDR_6TO4 | IPV6_ADDR_MAPPED | IPV6_ADDR_COMPATv4 | IPV6_NEW_ADDR_TEREDO)) != 0 ) {
+				} else if ( (ipv6addrp->typeinfo & (IPV6_NEW_ADDR_6TO4 | IPV6_ADDR_MAPPED | IPV6_ADDR_COMPATv4 | IPV6_NEW_ADDR_TEREDO)) != 0 ) {
 					DEBUGPRINT_NA(DEBUG_ipv6logconv_processing, "IPv6 has IPv4 included");
 
 					/* fill IPv4 address */
-					if ( (ipv6addr.typeinfo & (IPV6_ADDR_MAPPED | IPV6_ADDR_COMPATv4)) != 0 ) {
+					if ( (ipv6addrp->typeinfo & (IPV6_ADDR_MAPPED | IPV6_ADDR_COMPATv4)) != 0 ) {
 						for (i = 0; i <= 3; i++) {
-							ipv4addr_setoctet(&ipv4addr, i, ipv6addr_getoctet(&ipv6addr, i + 12));
+							ipv4addr_setoctet(&ipv4addr, i, ipv6addr_getoctet(ipv6addrp, i + 12));
 						};
-					} else if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_6TO4) != 0 ) {
+					} else if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_6TO4) != 0 ) {
 						for (i = 0; i <= 3; i++) {
-							ipv4addr_setoctet(&ipv4addr, i, ipv6addr_getoctet(&ipv6addr, i + 2));
+							ipv4addr_setoctet(&ipv4addr, i, ipv6addr_getoctet(ipv6addrp, i + 2));
 						};
-					} else if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_TEREDO) != 0 ) {
+					} else if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_TEREDO) != 0 ) {
 						for (i = 0; i <= 3; i++) {
-							ipv4addr_setoctet(&ipv4addr, i, ipv6addr_getoctet(&ipv6addr, i + 12) ^ 0xff);
+							ipv4addr_setoctet(&ipv4addr, i, ipv6addr_getoctet(ipv6addrp, i + 12) ^ 0xff);
 						};
 					} else {
 						/* normally never happen */
@@ -601,7 +916,7 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 			break;
 
 		case FORMAT_ouitype:
-			if (ipv6addr.flag_valid != 1) {
+			if (ipv6addrp->flag_valid != 1) {
 				if (flag_skipunknown != 0) {
 					return (1);
 				} else {
@@ -610,10 +925,8 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 				};
 		       	};
 
-			ipv6addr_settype(&ipv6addr);
-
 			/* check whether address has an OUI ID */
-			if ( (( ipv6addr.typeinfo & (IPV6_ADDR_LINKLOCAL | IPV6_ADDR_SITELOCAL | IPV6_NEW_ADDR_AGU | IPV6_NEW_ADDR_6BONE | IPV6_NEW_ADDR_6TO4 | IPV6_ADDR_ULUA)) == 0) && ((ipv6addr.typeinfo & (IPV6_NEW_ADDR_TEREDO)) == 0) )  {
+			if ( (( ipv6addrp->typeinfo & (IPV6_ADDR_LINKLOCAL | IPV6_ADDR_SITELOCAL | IPV6_NEW_ADDR_AGU | IPV6_NEW_ADDR_6BONE | IPV6_NEW_ADDR_6TO4 | IPV6_ADDR_ULUA)) == 0) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO)) == 0) )  {
 				if (flag_skipunknown != 0) {
 					return (1);
 				} else {
@@ -622,13 +935,13 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 				};
 		       	};
 
-			if ((ipv6addr_getoctet(&ipv6addr, 8) & 0x02) != 0) {
-				macaddr.addr[0] = ipv6addr_getoctet(&ipv6addr, 8) ^0x02;
-				macaddr.addr[1] = ipv6addr_getoctet(&ipv6addr, 9);
-				macaddr.addr[2] = ipv6addr_getoctet(&ipv6addr, 10);
-				macaddr.addr[3] = ipv6addr_getoctet(&ipv6addr, 13);
-				macaddr.addr[4] = ipv6addr_getoctet(&ipv6addr, 14);
-				macaddr.addr[5] = ipv6addr_getoctet(&ipv6addr, 15);
+			if ((ipv6addr_getoctet(ipv6addrp, 8) & 0x02) != 0) {
+				macaddr.addr[0] = ipv6addr_getoctet(ipv6addrp, 8) ^0x02;
+				macaddr.addr[1] = ipv6addr_getoctet(ipv6addrp, 9);
+				macaddr.addr[2] = ipv6addr_getoctet(ipv6addrp, 10);
+				macaddr.addr[3] = ipv6addr_getoctet(ipv6addrp, 13);
+				macaddr.addr[4] = ipv6addr_getoctet(ipv6addrp, 14);
+				macaddr.addr[5] = ipv6addr_getoctet(ipv6addrp, 15);
 
 				retval = libipv6calc_db_wrapper_ieee_vendor_string_short_by_macaddr(resultstring, sizeof(resultstring), &macaddr);
 				if (retval != 0) {
@@ -646,13 +959,13 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 					snprintf(resultstring, resultstring_length, "%s", tempstring);
 				};
 			} else {
-				if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_6TO4_MICROSOFT) != 0 ) {
+				if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_6TO4_MICROSOFT) != 0 ) {
 					snprintf(resultstring, resultstring_length, "6to4-microsoft.ouitype.ipv6calc");
-				} else if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_ISATAP) != 0 ) {
+				} else if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_IID_ISATAP) != 0 ) {
 					snprintf(resultstring, resultstring_length, "ISATAP.ouitype.ipv6calc");
-				} else if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_RANDOM) != 0 ) {
+				} else if ( (ipv6addr_gettypeinfo(ipv6addrp) & IPV6_NEW_ADDR_IID_RANDOM) != 0 ) {
 					snprintf(resultstring, resultstring_length, "local-scope-random.ouitype.ipv6calc");
-				} else if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_TEREDO) != 0 ) {
+				} else if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_TEREDO) != 0 ) {
 					snprintf(resultstring, resultstring_length, "local-scope-teredo.ouitype.ipv6calc");
 				} else {
 					snprintf(resultstring, resultstring_length, "local-scope.ouitype.ipv6calc");
@@ -661,7 +974,7 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 			break;
 			
 		case FORMAT_ipv6addrtype:
-			if (ipv6addr.flag_valid != 1) {
+			if (ipv6addrp->flag_valid != 1) {
 				if (flag_skipunknown != 0) {
 					return (1);
 				} else {
@@ -670,29 +983,27 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 				};
 		       	};
 
-			ipv6addr_settype(&ipv6addr);
-
-		       	if ( (ipv6addr.typeinfo & IPV6_ADDR_LINKLOCAL) != 0 ) {
+		       	if ( (ipv6addrp->typeinfo & IPV6_ADDR_LINKLOCAL) != 0 ) {
 				snprintf(resultstring, resultstring_length, "link-local.ipv6addrtype.ipv6calc");
-			} else if ( (ipv6addr.typeinfo & IPV6_ADDR_SITELOCAL) != 0 ) {
+			} else if ( (ipv6addrp->typeinfo & IPV6_ADDR_SITELOCAL) != 0 ) {
 				snprintf(resultstring, resultstring_length, "site-local.ipv6addrtype.ipv6calc");
-			} else if ( (ipv6addr.typeinfo & IPV6_ADDR_ULUA) != 0 ) {
+			} else if ( (ipv6addrp->typeinfo & IPV6_ADDR_ULUA) != 0 ) {
 				snprintf(resultstring, resultstring_length, "unique-local.ipv6addrtype.ipv6calc");
-			} else if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_TEREDO) != 0 ) {
-				if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_6BONE) != 0 ) {
+			} else if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_TEREDO) != 0 ) {
+				if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_6BONE) != 0 ) {
 					snprintf(resultstring, resultstring_length, "teredo.6bone-global.ipv6addrtype.ipv6calc");
 				} else {
 					snprintf(resultstring, resultstring_length, "teredo.unknown-global.ipv6addrtype.ipv6calc");
 				};
-			} else if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_6BONE) != 0 ) {
+			} else if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_6BONE) != 0 ) {
 				snprintf(resultstring, resultstring_length, "6bone-global.ipv6addrtype.ipv6calc");
-			} else if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_6TO4) != 0 ) {
+			} else if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_6TO4) != 0 ) {
 				snprintf(resultstring, resultstring_length, "6to4-global.ipv6addrtype.ipv6calc");
-			} else if ( (ipv6addr.typeinfo & IPV6_NEW_ADDR_PRODUCTIVE) != 0 ) {
+			} else if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_PRODUCTIVE) != 0 ) {
 				snprintf(resultstring, resultstring_length, "productive-global.ipv6addrtype.ipv6calc");
-			} else if ( (ipv6addr.typeinfo & IPV6_ADDR_MAPPED) != 0 ) {
+			} else if ( (ipv6addrp->typeinfo & IPV6_ADDR_MAPPED) != 0 ) {
 				snprintf(resultstring, resultstring_length, "mapped-ipv4.ipv6addrtype.ipv6calc");
-			} else if ( (ipv6addr.typeinfo & IPV6_ADDR_COMPATv4) != 0 ) {
+			} else if ( (ipv6addrp->typeinfo & IPV6_ADDR_COMPATv4) != 0 ) {
 				snprintf(resultstring, resultstring_length, "compat-ipv4.ipv6addrtype.ipv6calc");
 			} else {
 				snprintf(resultstring, resultstring_length, "unknown-ipv6.ipv6addrtype.ipv6calc");
@@ -704,26 +1015,5 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 			return (1);
 	};
 
-	/* use cache ? */
-	if (flag_nocache == 0) {
-		/* calculate pointer */
-		if (cache_lru_max < cache_lru_limit) {
-			cache_lru_last++;
-			cache_lru_max++;
-		} else {
-			if (cache_lru_last == cache_lru_limit) {
-				cache_lru_last = 1;
-			} else {
-				cache_lru_last++;
-			};
-		};
-
-		/* store key and value */
-		snprintf(cache_lru_key_token[cache_lru_last - 1], IPV6CALC_STRING_MAX - 1, "%s", token);
-		cache_lru_key_outputtype[cache_lru_last - 1] = outputtype;
-		snprintf(cache_lru_value[cache_lru_last - 1], IPV6CALC_STRING_MAX - 1, "%s", resultstring);
-		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: fill line=%d key_token=%s key_outputtype=%lx value=%s", cache_lru_last - 1, cache_lru_key_token[cache_lru_last - 1], cache_lru_key_outputtype[cache_lru_last - 1], cache_lru_value[cache_lru_last - 1]);
-	};
-
 	return (0);
 };
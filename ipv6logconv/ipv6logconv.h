@@ -16,6 +16,15 @@
 /* LRU cache maximum size */
 #define CACHE_LRU_SIZE 200
 
+/* multi-output mode: columns */
+#define COLUMN_addrtype		1
+#define COLUMN_ipv6addrtype	2
+#define COLUMN_ouitype		3
+#define COLUMN_cc		4
+#define COLUMN_asn		5
+
+#define COLUMNS_MAX		8
+
 
 #define DEBUG_ipv6logconv_general      0x00000001l
 #define DEBUG_ipv6logconv_processing   0x00000002l
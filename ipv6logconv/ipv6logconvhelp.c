@@ -17,6 +17,8 @@
 #include "ipv6calchelp.h"
 #include "config.h"
 
+#include "../databases/lib/libipv6calc_db_wrapper.h"
+
 /* display info */
 void printversion(void) {
 	fprintf(stderr, "%s: version %s", PROGRAM_NAME, PACKAGE_VERSION);
@@ -75,6 +77,11 @@ void ipv6logconv_printhelp(void) {
 	fprintf(stderr, "   ouitype        : OUI (IEEE) type%s\n", (feature_ieee == 0) ? "  (NOT-SUPPORTED)" : "");
 	fprintf(stderr, "   ipv6addrtype   : IPv6 address type\n");
 	fprintf(stderr, "   any            : any type%s\n", ((feature_reg == 0) || (feature_ieee == 0)) ? "  (NOT-SUPPORTED)" : "");
+	fprintf(stderr, "  [--out <column>,<column>,...] : multi-output mode, one column per type\n");
+	fprintf(stderr, "                                  token is parsed once per line\n");
+	fprintf(stderr, "   addrtype|ipv6addrtype|ouitype : see above\n");
+	fprintf(stderr, "   cc             : Country code%s\n", ((libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_CC) != 1) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_CC) != 1)) ? "  (NOT-SUPPORTED)" : "");
+	fprintf(stderr, "   asn            : Autonomous System Number%s\n", ((libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_AS) != 1) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_AS) != 1)) ? "  (NOT-SUPPORTED)" : "");
 	fprintf(stderr, "\n");
 	if ((feature_reg == 0) || (feature_ieee == 0)) {
 			fprintf(stderr, " NOT-SUPPORTED means either database missing or support not compiled-in\n");
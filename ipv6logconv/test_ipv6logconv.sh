@@ -140,6 +140,22 @@ else
 	echo
 fi
 
+echo "INFO  : test multi-output mode..."
+# addrtype and ouitype columns have to match output type 'any'
+result_any="$(testscenarios | ./ipv6logconv -q --out any | awk '{ print $1, $3 }')"
+result_multi="$(testscenarios | ./ipv6logconv -q --out addrtype,ipv6addrtype,ouitype | awk '{ print $1, $3 }')"
+if [ $? -ne 0 -o -z "$result_multi" ]; then
+	echo "ERROR : exit code <> 0 or empty result"
+	exit 1
+fi
+if [ "$result_any" != "$result_multi" ]; then
+	echo "ERROR : multi-output mode result differs"
+	echo "$result_any"
+	echo "$result_multi"
+	exit 1
+fi
+echo "INFO  : test multi-output mode: OK"
+
 echo "INFO  : test scenario with huge amount of addresses..."
 testscenario_hugelist ipv4 | awk '{ print $1 " token2 token3" }' | ./ipv6logconv -q --out any -q >/dev/null
 if [ $? -ne 0 ]; then
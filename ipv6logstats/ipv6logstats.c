@@ -13,6 +13,16 @@
 #include <getopt.h> 
 #include <unistd.h>
 #include <time.h>
+#include <limits.h>
+#include <errno.h>
+#include <poll.h>
+#include <dirent.h>
+#include <glob.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 
 #include "config.h"
 
@@ -47,7 +57,16 @@ static int opt_column_numbers = 0;
 static int opt_noheader = 0;
 static int opt_onlyheader = 0;
 static int opt_printdirection = 0; /* rows */
+static int opt_jobs = 1;
+static int opt_window = 0;		/* streaming mode: window length in seconds */
+static int opt_window_column = 0;	/* streaming mode: column containing timestamp (0: wall clock) */
+static int opt_merge = 0;		/* merge binary checkpoints given as arguments */
+static char opt_checkpoint[IPV6CALC_STRING_MAX] = "";
+static int opt_prefix_top = 0;		/* prefix aggregation: amount of top prefixes per protocol */
+static int opt_prefix_length_ipv4 = PREFIX_LENGTH_IPV4_DEFAULT;
+static int opt_prefix_length_ipv6 = PREFIX_LENGTH_IPV6_DEFAULT;
 static char opt_token[IPV6CALC_STRING_MAX] = "";
+static int opt_pcap_address = PCAP_ADDRESS_SRC;	/* packet capture input: address(es) to take */
 
 char    file_out[IPV6CALC_STRING_MAX] = "";
 int     file_out_flag = 0;
@@ -57,72 +76,124 @@ int feature_cc  = 0;
 int feature_as  = 0;
 int feature_reg = 0;
 
-static stat_entries ipv6logstats_statentries[] = {
-	{ STATS_ALL		, 0, "ALL" },
-	{ STATS_IPV4		, 0, "IPv4" },
-	{ STATS_IPV6		, 0, "IPv6" },
-	{ STATS_UNKNOWN		, 0, "UNKNOWN" },
-	{ STATS_IPV4_APNIC	, 0, "IPv4/APNIC" },
-	{ STATS_IPV4_ARIN	, 0, "IPv4/ARIN" },
-	{ STATS_IPV4_RIPENCC	, 0, "IPv4/RIPE" },
-	{ STATS_IPV4_LACNIC	, 0, "IPv4/LACNIC" },
-	{ STATS_IPV4_AFRINIC	, 0, "IPv4/AFRINIC" },
-	{ STATS_IPV4_UNKNOWN	, 0, "IPv4/UNKNOWN" },
-	{ STATS_IPV6_6BONE	, 0, "IPv6/6bone" },
-	{ STATS_IPV6_IANA	, 0, "IPv6/IANA" },
-	{ STATS_IPV6_APNIC	, 0, "IPv6/APNIC" },
-	{ STATS_IPV6_ARIN	, 0, "IPv6/ARIN" },
-	{ STATS_IPV6_RIPENCC    , 0, "IPv6/RIPE" },
-	{ STATS_IPV6_LACNIC	, 0, "IPv6/LACNIC" },
-	{ STATS_IPV6_AFRINIC	, 0, "IPv6/AFRINIC" },
-	{ STATS_IPV6_RESERVED	, 0, "IPv6/RESERVED" },
-	{ STATS_IPV6_UNKNOWN	, 0, "IPv6/UNKNOWN" },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_IANA    , 0, "IPv6/6to4/IANA"     },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_APNIC   , 0, "IPv6/6to4/APNIC"    },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_ARIN    , 0, "IPv6/6to4/ARIN"     },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_RIPENCC , 0, "IPv6/6to4/RIPE"     },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_LACNIC  , 0, "IPv6/6to4/LACNIC"   },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_AFRINIC , 0, "IPv6/6to4/AFRINIC"  },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_RESERVED, 0, "IPv6/6to4/RESERVED" },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_UNKNOWN , 0, "IPv6/6to4/UNKNOWN"  },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_IANA    , 0, "IPv6/Teredo/IANA"     },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_APNIC   , 0, "IPv6/Teredo/APNIC"    },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_ARIN    , 0, "IPv6/Teredo/ARIN"     },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_RIPENCC , 0, "IPv6/Teredo/RIPE"     },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_LACNIC  , 0, "IPv6/Teredo/LACNIC"   },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_AFRINIC , 0, "IPv6/Teredo/AFRINIC"  },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_RESERVED, 0, "IPv6/Teredo/RESERVED" },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_UNKNOWN , 0, "IPv6/Teredo/UNKNOWN"  },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_IANA    , 0, "IPv6/NAT64/IANA"     },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_APNIC   , 0, "IPv6/NAT64/APNIC"    },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_ARIN    , 0, "IPv6/NAT64/ARIN"     },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_RIPENCC , 0, "IPv6/NAT64/RIPE"     },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_LACNIC  , 0, "IPv6/NAT64/LACNIC"   },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_AFRINIC , 0, "IPv6/NAT64/AFRINIC"  },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_RESERVED, 0, "IPv6/NAT64/RESERVED" },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_UNKNOWN , 0, "IPv6/NAT64/UNKNOWN"  },
-	{ STATS_IPV6_IID_GLOBAL, 0, "IPv6/IID/Global" },
-	{ STATS_IPV6_IID_RANDOM, 0, "IPv6/IID/Random" },
-	{ STATS_IPV6_IID_MANUAL, 0, "IPv6/IID/Manual" },
-	{ STATS_IPV6_IID_ISATAP, 0, "IPv6/IID/ISATAP" },
-	{ STATS_IPV6_IID_MANUAL, 0, "IPv6/IID/Unknown" },
-};
-
-/* stat by Country Code */
-static long unsigned int counter_country[COUNTRYCODE_INDEX_MAX];
-static long unsigned int counter_country_ipv4[COUNTRYCODE_INDEX_MAX];
-static long unsigned int counter_country_ipv6[COUNTRYCODE_INDEX_MAX];
-
-static long unsigned int counter_country_A46, counter_country_IPV4, counter_country_IPV6;
+static const stat_entries ipv6logstats_statentries[] = {
+	{ STATS_ALL		, "ALL" },
+	{ STATS_IPV4		, "IPv4" },
+	{ STATS_IPV6		, "IPv6" },
+	{ STATS_UNKNOWN		, "UNKNOWN" },
+	{ STATS_IPV4_APNIC	, "IPv4/APNIC" },
+	{ STATS_IPV4_ARIN	, "IPv4/ARIN" },
+	{ STATS_IPV4_RIPENCC	, "IPv4/RIPE" },
+	{ STATS_IPV4_LACNIC	, "IPv4/LACNIC" },
+	{ STATS_IPV4_AFRINIC	, "IPv4/AFRINIC" },
+	{ STATS_IPV4_UNKNOWN	, "IPv4/UNKNOWN" },
+	{ STATS_IPV6_6BONE	, "IPv6/6bone" },
+	{ STATS_IPV6_IANA	, "IPv6/IANA" },
+	{ STATS_IPV6_APNIC	, "IPv6/APNIC" },
+	{ STATS_IPV6_ARIN	, "IPv6/ARIN" },
+	{ STATS_IPV6_RIPENCC    , "IPv6/RIPE" },
+	{ STATS_IPV6_LACNIC	, "IPv6/LACNIC" },
+	{ STATS_IPV6_AFRINIC	, "IPv6/AFRINIC" },
+	{ STATS_IPV6_RESERVED	, "IPv6/RESERVED" },
+	{ STATS_IPV6_UNKNOWN	, "IPv6/UNKNOWN" },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_IANA    , "IPv6/6to4/IANA"     },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_APNIC   , "IPv6/6to4/APNIC"    },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_ARIN    , "IPv6/6to4/ARIN"     },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_RIPENCC , "IPv6/6to4/RIPE"     },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_LACNIC  , "IPv6/6to4/LACNIC"   },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_AFRINIC , "IPv6/6to4/AFRINIC"  },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_RESERVED, "IPv6/6to4/RESERVED" },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_UNKNOWN , "IPv6/6to4/UNKNOWN"  },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_IANA    , "IPv6/Teredo/IANA"     },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_APNIC   , "IPv6/Teredo/APNIC"    },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_ARIN    , "IPv6/Teredo/ARIN"     },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_RIPENCC , "IPv6/Teredo/RIPE"     },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_LACNIC  , "IPv6/Teredo/LACNIC"   },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_AFRINIC , "IPv6/Teredo/AFRINIC"  },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_RESERVED, "IPv6/Teredo/RESERVED" },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_UNKNOWN , "IPv6/Teredo/UNKNOWN"  },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_IANA    , "IPv6/NAT64/IANA"     },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_APNIC   , "IPv6/NAT64/APNIC"    },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_ARIN    , "IPv6/NAT64/ARIN"     },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_RIPENCC , "IPv6/NAT64/RIPE"     },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_LACNIC  , "IPv6/NAT64/LACNIC"   },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_AFRINIC , "IPv6/NAT64/AFRINIC"  },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_RESERVED, "IPv6/NAT64/RESERVED" },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_UNKNOWN , "IPv6/NAT64/UNKNOWN"  },
+	{ STATS_IPV6_IID_GLOBAL, "IPv6/IID/Global" },
+	{ STATS_IPV6_IID_RANDOM, "IPv6/IID/Random" },
+	{ STATS_IPV6_IID_MANUAL, "IPv6/IID/Manual" },
+	{ STATS_IPV6_IID_ISATAP, "IPv6/IID/ISATAP" },
+	{ STATS_IPV6_IID_MANUAL, "IPv6/IID/Unknown" },
+};
 
 /* stat by ASN (only 16-bit ASN supported, 32-bit ASNs are mapped to 23456 "AS_TRANS" */
 #define ASNUM_MAX     65536
-static long unsigned int counter_asn[ASNUM_MAX];
-static long unsigned int counter_asn_ipv4[ASNUM_MAX];
-static long unsigned int counter_asn_ipv6[ASNUM_MAX];
+
+/* counters of one statistics run (stdin, one input file or total of all input files) */
+typedef struct {
+	long unsigned int stat[MAXENTRIES_ARRAY(ipv6logstats_statentries)];
+
+	/* stat by Country Code */
+	long unsigned int country[COUNTRYCODE_INDEX_MAX];
+	long unsigned int country_ipv4[COUNTRYCODE_INDEX_MAX];
+	long unsigned int country_ipv6[COUNTRYCODE_INDEX_MAX];
+
+	long unsigned int country_A46, country_IPV4, country_IPV6;
+
+	/* stat by ASN */
+	long unsigned int asn[ASNUM_MAX];
+	long unsigned int asn_ipv4[ASNUM_MAX];
+	long unsigned int asn_ipv6[ASNUM_MAX];
+} stat_counters;
+
+static stat_counters counters_input;	/* current input */
+static stat_counters counters_total;	/* total of all input files */
+
+/* prefix aggregation */
+typedef struct {
+	uint64_t prefix;		/* IPv4: 32 bit, IPv6: upper 64 bit, masked */
+	long unsigned int count;
+	uint8_t proto;			/* 0: free */
+} prefix_entry;
+
+static prefix_entry *prefix_table = NULL;	/* exact table or heavy hitter list */
+static uint32_t prefix_table_mask = 0;
+static uint32_t prefix_table_used = 0;
+static uint32_t prefix_entries_max = PREFIX_ENTRIES_DEFAULT;
+static uint32_t prefix_hh_max = PREFIX_HH_MIN;
+static long unsigned int prefix_hh_min = 0;	/* lower bound of minimum counter in heavy hitter list */
+static uint32_t *prefix_sketch = NULL;		/* Count-Min sketch */
+static int prefix_mode_sketch = 0;
+static int prefix_estimated = 0;		/* counters are estimations */
+
+/* input files */
+static char **input_files = NULL;
+static int  input_files_count = 0;
+static int  input_files_max = 0;
 
 /* prototypes */
-static void lineparser(void);
+static void lineparser(FILE *input, const char *input_name, stat_counters *counters);
+static void stat_address(uint32_t inputtype, ipv6calc_ipv6addr *ipv6addrp, ipv6calc_ipv4addr *ipv4addrp, const char *token, stat_counters *counters);
+static int  pcap_magic_check(const unsigned char *p);
+static int  pcap_file_proceed(const char *name, stat_counters *counters);
+static void stat_print_unknown(const uint32_t inputtype, const ipv6calc_ipv6addr *ipv6addrp, const ipv6calc_ipv4addr *ipv4addrp, const char *token);
+static void lineparser_window(FILE *input);
+static void stat_add(stat_counters *total, const stat_counters *counters);
+static void print_statistics(const stat_counters *counters, const char *token, const int flag_header);
+static void print_db_used(void);
+static int  input_files_add(const char *name);
+static int  input_files_proceed(void);
+static int  checkpoint_write(const char *name, const stat_counters *counters);
+static int  checkpoint_merge(const char *name, stat_counters *counters);
+static int  prefix_add(const uint8_t proto, const uint64_t prefix, const long unsigned int count);
+static int  prefix_sketch_enable(void);
+static void prefix_sketch_counter_add(uint32_t *counter, const long unsigned int count);
+static long unsigned int prefix_sketch_estimate(const uint8_t proto, const uint64_t prefix);
+static void prefix_hh_update(const uint8_t proto, const uint64_t prefix, const long unsigned int estimation);
+static void prefix_hh_estimate(void);
+static void prefix_add_addr(const uint32_t inputtype, const ipv6calc_ipv6addr *ipv6addrp, const ipv6calc_ipv4addr *ipv4addrp);
+static void print_prefix_top(void);
 
 
 /**************************************************/
@@ -136,6 +207,7 @@ int main(int argc,char *argv[]) {
 
 	int i, lop, result;
 	unsigned long int command = 0;
+	char *charptr;
 
 	/* options */
 	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
@@ -234,6 +306,88 @@ int main(int argc,char *argv[]) {
 				opt_simple = 1; // force simple mode in addition
 				break;
 
+			case 'j':
+				opt_jobs = atoi(optarg);
+				if (opt_jobs < 1) {
+					fprintf(stderr, " Amount of jobs too small: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case CMD_stats_window:
+				opt_window = (int) strtol(optarg, &charptr, 10);
+				if (strcmp(charptr, "m") == 0) {
+					opt_window *= 60;
+				} else if (strcmp(charptr, "h") == 0) {
+					opt_window *= 3600;
+				} else if (strcmp(charptr, "d") == 0) {
+					opt_window *= 86400;
+				} else if ((strlen(charptr) > 0) && (strcmp(charptr, "s") != 0)) {
+					opt_window = 0;
+				};
+				if (opt_window <= 0) {
+					fprintf(stderr, " Window length is not valid: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case CMD_stats_window_column:
+				opt_window_column = atoi(optarg);
+				if (opt_window_column < 0) {
+					fprintf(stderr, " Window column is not valid: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case CMD_stats_checkpoint:
+				if (strlen(optarg) < sizeof(opt_checkpoint)) {
+					snprintf(opt_checkpoint, sizeof(opt_checkpoint), "%s", optarg);
+				} else {
+					fprintf(stderr, " Checkpoint file name too long: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case CMD_stats_merge:
+				opt_merge = 1;
+				break;
+
+			case CMD_stats_prefix_top:
+				opt_prefix_top = atoi(optarg);
+				if (opt_prefix_top < 1) {
+					fprintf(stderr, " Amount of top prefixes too small: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case CMD_stats_prefix_length:
+				if ((sscanf(optarg, "%d,%d", &opt_prefix_length_ipv4, &opt_prefix_length_ipv6) != 2) || (opt_prefix_length_ipv4 < 1) || (opt_prefix_length_ipv4 > 32) || (opt_prefix_length_ipv6 < 1) || (opt_prefix_length_ipv6 > 64)) {
+					fprintf(stderr, " Prefix length is not valid (IPv4: 1-32, IPv6: 1-64): %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case CMD_stats_prefix_entries:
+				if ((atoi(optarg) < PREFIX_HH_MIN) || (atoi(optarg) > 0x10000000)) {
+					fprintf(stderr, " Maximum entries of prefix table is not valid (%d-%d): %s\n", PREFIX_HH_MIN, 0x10000000, optarg);
+					exit(EXIT_FAILURE);
+				};
+				prefix_entries_max = atoi(optarg);
+				break;
+
+			case CMD_stats_pcap_address:
+				if (strcmp(optarg, "src") == 0) {
+					opt_pcap_address = PCAP_ADDRESS_SRC;
+				} else if (strcmp(optarg, "dst") == 0) {
+					opt_pcap_address = PCAP_ADDRESS_DST;
+				} else if (strcmp(optarg, "both") == 0) {
+					opt_pcap_address = PCAP_ADDRESS_BOTH;
+				} else {
+					fprintf(stderr, " Packet capture address selection is not valid (src|dst|both): %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
 			case 'w':
 				if (strlen(optarg) < sizeof(file_out)) {
 					snprintf(file_out, sizeof(file_out), "%s", optarg);
@@ -306,8 +460,105 @@ int main(int argc,char *argv[]) {
 		exit(EXIT_FAILURE);
 	};
 
-	/* call lineparser */
-	lineparser();
+	/* memo table for IID random detection (clients appear usually multiple times) */
+	if (ipv6addr_iidrandomdetection_cache_init(IID_RANDOM_CACHE_ENTRIES) != 0) {
+		exit(EXIT_FAILURE);
+	};
+
+	if (opt_prefix_top > 0) {
+		/* prefix aggregation */
+		if ((opt_printdirection != 0) || (opt_window > 0) || (opt_jobs > 1)) {
+			fprintf(stderr, "Option --prefix-top is not supported in columns mode and in combination with --window/--jobs\n");
+			exit(EXIT_FAILURE);
+		};
+
+		/* heavy hitter list in case of sketch mode */
+		prefix_hh_max = opt_prefix_top * 2 * 4;
+		if (prefix_hh_max < PREFIX_HH_MIN) {
+			prefix_hh_max = PREFIX_HH_MIN;
+		};
+		if (prefix_hh_max > prefix_entries_max) {
+			prefix_hh_max = prefix_entries_max;
+		};
+	};
+
+	if ((opt_window > 0) && (opt_onlyheader == 0)) {
+		/* streaming mode */
+		if ((argc > 0) || (opt_merge == 1) || (strlen(opt_checkpoint) > 0)) {
+			fprintf(stderr, "Option --window is only supported for stdin and not in combination with --merge/--checkpoint\n");
+			exit(EXIT_FAILURE);
+		};
+
+		lineparser_window(stdin);
+	} else if ((opt_merge == 1) && (opt_onlyheader == 0)) {
+		/* merge checkpoints */
+		for (i = 0; i < argc; i++) {
+			if (input_files_add(argv[i]) != 0) {
+				exit(EXIT_FAILURE);
+			};
+		};
+
+		if (input_files_count == 0) {
+			fprintf(stderr, "No checkpoint file given\n");
+			exit(EXIT_FAILURE);
+		};
+
+		for (i = 0; i < input_files_count; i++) {
+			if (checkpoint_merge(input_files[i], &counters_total) != 0) {
+				exit(EXIT_FAILURE);
+			};
+		};
+
+		print_statistics(&counters_total, opt_token, 1);
+	} else if ((argc > 0) && (opt_onlyheader == 0)) {
+		/* input files given */
+		for (i = 0; i < argc; i++) {
+			if (input_files_add(argv[i]) != 0) {
+				exit(EXIT_FAILURE);
+			};
+		};
+
+		if (input_files_count == 0) {
+			fprintf(stderr, "No input file found\n");
+			exit(EXIT_FAILURE);
+		};
+
+		if (input_files_proceed() != 0) {
+			exit(EXIT_FAILURE);
+		};
+	} else {
+		/* call lineparser */
+		if (opt_onlyheader == 0) {
+			lineparser(stdin, "stdin", &counters_input);
+		};
+
+		print_statistics(&counters_input, opt_token, 1);
+
+		stat_add(&counters_total, &counters_input);
+	};
+
+	if ((strlen(opt_checkpoint) > 0) && (opt_onlyheader == 0)) {
+		/* store total counters */
+		if (checkpoint_write(opt_checkpoint, &counters_total) != 0) {
+			exit(EXIT_FAILURE);
+		};
+	};
+
+	if (opt_prefix_top > 0) {
+		print_prefix_top();
+
+		free(prefix_table);
+		if (prefix_sketch != NULL) {
+			free(prefix_sketch);
+		};
+	};
+
+	if ((opt_printdirection == 0) && (opt_jobs == 1) && (opt_merge == 0)) {
+		/* print used database only in row mode (not available in case of jobs and merge) */
+		print_db_used();
+	};
+
+	ipv6addr_iidrandomdetection_cache_init(0);
 
 	libipv6calc_cleanup();
 
@@ -318,22 +569,50 @@ int main(int argc,char *argv[]) {
 /*
  * Statistics structure handling
  */
-static void stat_inc(int number) {
+static void stat_inc(stat_counters *counters, const int number) {
 	int i;
 	
 	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
 		if (number == ipv6logstats_statentries[i].number) {
-			ipv6logstats_statentries[i].counter++;
+			counters->stat[i]++;
 			break;
 		};
 	};
 };
 
 
+/*
+ * Add counters of one input to total
+ */
+static void stat_add(stat_counters *total, const stat_counters *counters) {
+	int i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		total->stat[i] += counters->stat[i];
+	};
+
+	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
+		total->country[i] += counters->country[i];
+		total->country_ipv4[i] += counters->country_ipv4[i];
+		total->country_ipv6[i] += counters->country_ipv6[i];
+	};
+
+	total->country_A46 += counters->country_A46;
+	total->country_IPV4 += counters->country_IPV4;
+	total->country_IPV6 += counters->country_IPV6;
+
+	for (i = 0; i < ASNUM_MAX; i++) {
+		total->asn[i] += counters->asn[i];
+		total->asn_ipv4[i] += counters->asn_ipv4[i];
+		total->asn_ipv6[i] += counters->asn_ipv6[i];
+	};
+};
+
+
 /*
  * Country code statistics
  */
-static void stat_inc_country_code(uint16_t country_code, const int proto) {
+static void stat_inc_country_code(stat_counters *counters, uint16_t country_code, const int proto) {
 	int index = COUNTRYCODE_INDEX_UNKNOWN;
 
 	if (country_code < COUNTRYCODE_INDEX_MAX) {
@@ -345,15 +624,15 @@ static void stat_inc_country_code(uint16_t country_code, const int proto) {
 
 	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Increment CountryCode index: %d (%d)", index, country_code);
 
-	counter_country[index]++;
-	counter_country_A46++;
+	counters->country[index]++;
+	counters->country_A46++;
 
 	if (proto == 4) {
-		counter_country_ipv4[index]++;
-		counter_country_IPV4++;
+		counters->country_ipv4[index]++;
+		counters->country_IPV4++;
 	} else if (proto == 6) {
-		counter_country_ipv6[index]++;
-		counter_country_IPV6++;
+		counters->country_ipv6[index]++;
+		counters->country_IPV6++;
 	} else {
 		fprintf(stderr, "%s/%s: unexpected unsupported proto: %d\n", __FILE__, __func__, proto);
 		exit(1);
@@ -364,7 +643,7 @@ static void stat_inc_country_code(uint16_t country_code, const int proto) {
 /*
  * AS Number statistics
  */
-static void stat_inc_asnum(const uint32_t as_num32, const int proto) {
+static void stat_inc_asnum(stat_counters *counters, const uint32_t as_num32, const int proto) {
 	unsigned int index = ASNUM_AS_UNKNOWN;
 
 	if (as_num32 < ASNUM_MAX) {
@@ -377,553 +656,2362 @@ static void stat_inc_asnum(const uint32_t as_num32, const int proto) {
 
 	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Increment ASN index: %d (%d)", index, as_num32);
 
-	counter_asn[index]++;
+	counters->asn[index]++;
 
 	if (proto == 4) {
-		counter_asn_ipv4[index]++;
+		counters->asn_ipv4[index]++;
 	} else if (proto == 6) {
-		counter_asn_ipv6[index]++;
+		counters->asn_ipv6[index]++;
 	};
 };
 
 
 /*
- * Line parser
+ * Parse one line and fill statistics
  */
-static void lineparser(void) {
-	char linebuffer[LINEBUFFER];
+static void lineparser_line(char *linebuffer, const int linecounter, stat_counters *counters) {
 	char token[LINEBUFFER];
 	char resultstring[LINEBUFFER];
 	char *charptr, *cptr, **ptrptr;
-	int linecounter = 0, retval, i, r;
+	int retval;
 
 	uint32_t inputtype  = FORMAT_undefined;
 	ipv6calc_ipv6addr ipv6addr;
 	ipv6calc_ipv4addr ipv4addr;
-	int registry, stat_registry_base;
 
-	time_t timer;
-	struct tm* tm_info;
+	ptrptr = &cptr;
 
-	int index;
-	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
-	uint32_t as_num32 = ASNUM_AS_UNKNOWN;
-	long unsigned int c_all, c_ipv4, c_ipv6;
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Line counter: %d", linecounter);
 
-	int column_offset = 1;
+	if (strlen(linebuffer) >= LINEBUFFER) {
+		fprintf(stderr, "Line too long: %d\n", linecounter);
+		return;
+	};
 
-	// clear counters
-	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
-		counter_country[i] = 0;
-		counter_country_ipv4[i] = 0;
-		counter_country_ipv6[i] = 0;
+	/* remove trailing \n */
+	if (linebuffer[strlen(linebuffer) - 1] == '\n') {
+		linebuffer[strlen(linebuffer) - 1] = '\0';
 	};
 
-	ptrptr = &cptr;
 	
-	if (opt_onlyheader == 0) {
-		if (ipv6calc_quiet == 0) {
-			fprintf(stderr, "Expecting log lines on stdin\n");
-		};
+	if (strlen(linebuffer) == 0) {
+		fprintf(stderr, "Line empty: %d\n", linecounter);
+		return;
 	};
+	
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Got line: '%s'", linebuffer);
 
-	while (opt_onlyheader == 0) {
-		/* read line from stdin */
-		charptr = fgets(linebuffer, LINEBUFFER, stdin);
-		
-		if (charptr == NULL) {
-			/* end of input */
-			break;
-		};
-
-		linecounter++;
-
-		stat_registry_base = 0;
+	/* look for first token (should be IP address) */
+	charptr = strtok_r(linebuffer, " \t\n", ptrptr);
+	
+	if ( charptr == NULL ) {
+		fprintf(stderr, "Line contains no token: %d\n", linecounter);
+		return;
+	};
 
-		if (linecounter == 1) {
-			if (ipv6calc_quiet == 0) {
-				fprintf(stderr, "Ok, proceeding stdin...\n");
-			};
-		};
-		
-		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Line counter: %d", linecounter);
+	if ( strlen(charptr) >=  LINEBUFFER) {
+		fprintf(stderr, "Line too strange: %d\n", linecounter);
+		return;
+	};
 
-		if (strlen(linebuffer) >= LINEBUFFER) {
-			fprintf(stderr, "Line too long: %d\n", linecounter);
-			continue;
-		};
+	snprintf(token, sizeof(token), "%s", charptr);
+	
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Token 1: '%s'", token);
 
-		/* remove trailing \n */
-		if (linebuffer[strlen(linebuffer) - 1] == '\n') {
-			linebuffer[strlen(linebuffer) - 1] = '\0';
-		};
+	stat_inc(counters, STATS_ALL);
 
-		
-		if (strlen(linebuffer) == 0) {
-			fprintf(stderr, "Line empty: %d\n", linecounter);
-			continue;
-		};
-		
-		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Got line: '%s'", linebuffer);
+	/* get input type now */
+	inputtype = libipv6calc_autodetectinput(token);
 
-		/* look for first token (should be IP address) */
-		charptr = strtok_r(linebuffer, " \t\n", ptrptr);
-		
-		if ( charptr == NULL ) {
-			fprintf(stderr, "Line contains no token: %d\n", linecounter);
-			continue;
-		};
+	/* check for proper type */
+	if ((inputtype != FORMAT_ipv4addr) && (inputtype != FORMAT_ipv6addr)) {
+		/* fprintf(stderr, "Token 1 (address) is not an IP address in line: %d\n", linecounter); */
+		stat_inc(counters, STATS_UNKNOWN);
+		return;
+	};
 
-		if ( strlen(charptr) >=  LINEBUFFER) {
-			fprintf(stderr, "Line too strange: %d\n", linecounter);
-			continue;
-		};
+	/* fill related structure */
+	switch (inputtype) {
+		case FORMAT_ipv6addr:
+			retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
+			break;
 
-		snprintf(token, sizeof(token), "%s", charptr);
-		
-		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Token 1: '%s'", token);
+		case FORMAT_ipv4addr:
+			retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
+			break;
 
-		stat_inc(STATS_ALL);
+		default:
+			retval = 0;
+			break;
+	};
 
-		/* get input type now */
-		inputtype = libipv6calc_autodetectinput(token);
+	if (retval != 0 ) {
+		fprintf(stderr, "Problem during address parsing on line %d (skipped): %s\n", linecounter, resultstring);
+		return;
+	};
 
-		/* check for proper type */
-		if ((inputtype != FORMAT_ipv4addr) && (inputtype != FORMAT_ipv6addr)) {
-			/* fprintf(stderr, "Token 1 (address) is not an IP address in line: %d\n", linecounter); */
-			stat_inc(STATS_UNKNOWN);
-			continue;
-		};
+	stat_address(inputtype, &ipv6addr, &ipv4addr, token, counters);
 
-		/* fill related structure */
-		switch (inputtype) {
-			case FORMAT_ipv6addr:
-				retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
-				break;
+	return;
+};
 
-			case FORMAT_ipv4addr:
-				retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
-				break;
 
-			default:
-				retval = 0;
-				break;
-		};
+/*
+ * Report unknown address
+ *  token: text representation, NULL: create from structure
+ */
+static void stat_print_unknown(const uint32_t inputtype, const ipv6calc_ipv6addr *ipv6addrp, const ipv6calc_ipv4addr *ipv4addrp, const char *token) {
+	char tempstring[IPV6CALC_STRING_MAX] = "";
 
-		if (retval != 0 ) {
-			fprintf(stderr, "Problem during address parsing on line %d (skipped): %s\n", linecounter, resultstring);
-			continue;
+	if (token == NULL) {
+		if (inputtype == FORMAT_ipv6addr) {
+			libipv6addr_ipv6addrstruct_to_uncompaddr(ipv6addrp, tempstring, sizeof(tempstring), 0);
+		} else {
+			libipv4addr_ipv4addrstruct_to_string(ipv4addrp, tempstring, sizeof(tempstring), 0);
 		};
+		token = tempstring;
+	};
 
-		/* catch compat/mapped */
-		switch (inputtype) {
-			case FORMAT_ipv6addr:
-				if ((ipv6addr.typeinfo & (IPV6_ADDR_COMPATv4 | IPV6_ADDR_MAPPED)) != 0) {
-					/* extract IPv4 address */
-					r = libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
-					if (r != 0) {
-						continue;
-					};
+	fprintf(stderr, "Unknown address: %s\n", token);
+};
 
-					// remap
-					inputtype = FORMAT_ipv4addr;
 
-					// create text represenation
-					r = libipv4addr_ipv4addrstruct_to_string(&ipv4addr, token, sizeof(token), 0);
-				};
-				break;
+/*
+ * Fill statistics of one already parsed address (without STATS_ALL)
+ *  token: text representation, NULL: not available (e.g. address taken from packet capture)
+ */
+static void stat_address(uint32_t inputtype, ipv6calc_ipv6addr *ipv6addrp, ipv6calc_ipv4addr *ipv4addrp, const char *token, stat_counters *counters) {
+	char token_mapped[IPV6CALC_STRING_MAX];
+	int r;
+	int registry, stat_registry_base = 0;
 
-			default:
-				// nothing to do
-				break;
-		};
+	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+	uint32_t as_num32 = ASNUM_AS_UNKNOWN;
 
-		/* get information and fill statistics */
-		switch (inputtype) {
-			case FORMAT_ipv6addr:
-				/* is IPv6 address */
-				stat_inc(STATS_IPV6);
+	/* catch compat/mapped */
+	switch (inputtype) {
+		case FORMAT_ipv6addr:
+			if ((ipv6addrp->typeinfo & (IPV6_ADDR_COMPATv4 | IPV6_ADDR_MAPPED)) != 0) {
+				/* extract IPv4 address */
+				r = libipv6addr_get_included_ipv4addr(ipv6addrp, ipv4addrp, IPV6_ADDR_SELECT_IPV4_DEFAULT);
+				if (r != 0) {
+					return;
+				};
 
-				if ((ipv6addr.typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4) != 0) {
-					/* has public IPv4 address included */
+				// remap
+				inputtype = FORMAT_ipv4addr;
 
-					// get IPv4 address (in case of Teredo the client IP)
-					r = libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
-					if (r != 0) {
-						continue;
-					};
+				// create text represenation
+				if (token != NULL) {
+					r = libipv4addr_ipv4addrstruct_to_string(ipv4addrp, token_mapped, sizeof(token_mapped), 0);
+					token = token_mapped;
+				};
+			};
+			break;
 
-					if (opt_simple != 1) {
-						cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
-						as_num32 = libipv4addr_as_num32_by_addr(&ipv4addr, NULL);
-						if (feature_cc == 1) {
-							stat_inc_country_code(cc_index, 4);
-						};
+		default:
+			// nothing to do
+			break;
+	};
 
-						if (feature_as == 1) {
-							stat_inc_asnum(as_num32, 4);
-						};
-					};
+	if (opt_prefix_top > 0) {
+		prefix_add_addr(inputtype, ipv6addrp, ipv4addrp);
+	};
 
-					registry = libipv4addr_registry_num_by_addr(&ipv4addr);
+	/* get information and fill statistics */
+	switch (inputtype) {
+		case FORMAT_ipv6addr:
+			/* is IPv6 address */
+			stat_inc(counters, STATS_IPV6);
 
-					if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_6TO4) != 0) {
-						stat_registry_base = STATS_IPV6_6TO4_BASE;
+			if ((ipv6addrp->typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4) != 0) {
+				/* has public IPv4 address included */
 
-					} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_TEREDO) != 0) {
-						stat_registry_base = STATS_IPV6_TEREDO_BASE;
+				// get IPv4 address (in case of Teredo the client IP)
+				r = libipv6addr_get_included_ipv4addr(ipv6addrp, ipv4addrp, IPV6_ADDR_SELECT_IPV4_DEFAULT);
+				if (r != 0) {
+					return;
+				};
 
-					} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_NAT64) != 0) {
-						stat_registry_base = STATS_IPV6_NAT64_BASE;
+				if (opt_simple != 1) {
+					cc_index = libipv4addr_cc_index_by_addr(ipv4addrp, NULL);
+					as_num32 = libipv4addr_as_num32_by_addr(ipv4addrp, NULL);
+					if (feature_cc == 1) {
+						stat_inc_country_code(counters, cc_index, 4);
 					};
 
-					if (stat_registry_base > 0) {
-						switch (registry) {
-							case REGISTRY_IANA:
-								stat_inc(stat_registry_base + REGISTRY_IANA);
-								break;
-							case REGISTRY_APNIC:
-								stat_inc(stat_registry_base + REGISTRY_APNIC);
-								break;
-							case REGISTRY_ARIN:
-								stat_inc(stat_registry_base + REGISTRY_ARIN);
-								break;
-							case REGISTRY_RIPENCC:
-								stat_inc(stat_registry_base + REGISTRY_RIPENCC);
-								break;
-							case REGISTRY_LACNIC:
-								stat_inc(stat_registry_base + REGISTRY_LACNIC);
-								break;
-							case REGISTRY_AFRINIC:
-								stat_inc(stat_registry_base + REGISTRY_AFRINIC);
-								break;
-							case REGISTRY_RESERVED:
-								stat_inc(stat_registry_base + REGISTRY_RESERVED);
-								break;
-							default:
-								stat_inc(stat_registry_base + REGISTRY_UNKNOWN);
-								if (opt_unknown == 1) {
-									fprintf(stderr, "Unknown address: %s\n", token);
-								};
-								break;
-						};
-					} else {
-						if (opt_unknown == 1) {
-							fprintf(stderr, "Unknown address: %s\n", token);
-						};
+					if (feature_as == 1) {
+						stat_inc_asnum(counters, as_num32, 4);
 					};
-				} else {
-					if (opt_simple != 1) {
-						cc_index = libipv6addr_cc_index_by_addr(&ipv6addr, NULL);
-						as_num32 = libipv6addr_as_num32_by_addr(&ipv6addr, NULL);
+				};
 
-						if (feature_cc == 1) {
-							/* country code */
-							stat_inc_country_code(cc_index, 6);
-						};
+				registry = libipv4addr_registry_num_by_addr(ipv4addrp);
 
-						if (feature_as == 1) {
-							/* asnum */
-							stat_inc_asnum(as_num32, 6);
-						};
-					};
+				if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_6TO4) != 0) {
+					stat_registry_base = STATS_IPV6_6TO4_BASE;
 
-					registry = libipv6addr_registry_num_by_addr(&ipv6addr);
+				} else if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_TEREDO) != 0) {
+					stat_registry_base = STATS_IPV6_TEREDO_BASE;
 
+				} else if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_NAT64) != 0) {
+					stat_registry_base = STATS_IPV6_NAT64_BASE;
+				};
+
+				if (stat_registry_base > 0) {
 					switch (registry) {
-						case REGISTRY_6BONE:
-							stat_inc(STATS_IPV6_6BONE);
-							break;
 						case REGISTRY_IANA:
-							stat_inc(STATS_IPV6_IANA);
+							stat_inc(counters, stat_registry_base + REGISTRY_IANA);
 							break;
 						case REGISTRY_APNIC:
-							stat_inc(STATS_IPV6_APNIC);
+							stat_inc(counters, stat_registry_base + REGISTRY_APNIC);
 							break;
 						case REGISTRY_ARIN:
-							stat_inc(STATS_IPV6_ARIN);
+							stat_inc(counters, stat_registry_base + REGISTRY_ARIN);
 							break;
 						case REGISTRY_RIPENCC:
-							stat_inc(STATS_IPV6_RIPENCC);
+							stat_inc(counters, stat_registry_base + REGISTRY_RIPENCC);
 							break;
 						case REGISTRY_LACNIC:
-							stat_inc(STATS_IPV6_LACNIC);
+							stat_inc(counters, stat_registry_base + REGISTRY_LACNIC);
 							break;
 						case REGISTRY_AFRINIC:
-							stat_inc(STATS_IPV6_AFRINIC);
+							stat_inc(counters, stat_registry_base + REGISTRY_AFRINIC);
 							break;
 						case REGISTRY_RESERVED:
-							stat_inc(STATS_IPV6_RESERVED);
+							stat_inc(counters, stat_registry_base + REGISTRY_RESERVED);
 							break;
 						default:
-							stat_inc(STATS_IPV6_UNKNOWN);
+							stat_inc(counters, stat_registry_base + REGISTRY_UNKNOWN);
 							if (opt_unknown == 1) {
-								fprintf(stderr, "Unknown address: %s\n", token);
+								stat_print_unknown(inputtype, ipv6addrp, ipv4addrp, token);
 							};
 							break;
 					};
-
-					if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID) == IPV6_NEW_ADDR_IID) {
-						if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_RANDOM) != 0) {
-							stat_inc(STATS_IPV6_IID_RANDOM);
-						} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_ISATAP) != 0) {
-							stat_inc(STATS_IPV6_IID_ISATAP);
-						} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_LOCAL) != 0) {
-							stat_inc(STATS_IPV6_IID_MANUAL);
-						} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_GLOBAL) != 0) {
-							stat_inc(STATS_IPV6_IID_GLOBAL);
-						} else {
-							stat_inc(STATS_IPV6_IID_UNKNOWN);
-						};
+				} else {
+					if (opt_unknown == 1) {
+						stat_print_unknown(inputtype, ipv6addrp, ipv4addrp, token);
 					};
 				};
-				
-				break;
-
-			case FORMAT_ipv4addr:
-				/* is IPv4 address */
-				stat_inc(STATS_IPV4);
-
+			} else {
 				if (opt_simple != 1) {
-					cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
-					as_num32 = libipv4addr_as_num32_by_addr(&ipv4addr, NULL);
+					cc_index = libipv6addr_cc_index_by_addr(ipv6addrp, NULL);
+					as_num32 = libipv6addr_as_num32_by_addr(ipv6addrp, NULL);
+
+					if (feature_cc == 1) {
+						/* country code */
+						stat_inc_country_code(counters, cc_index, 6);
+					};
 
-					stat_inc_country_code(cc_index, 4);
-					stat_inc_asnum(as_num32, 4);
+					if (feature_as == 1) {
+						/* asnum */
+						stat_inc_asnum(counters, as_num32, 6);
+					};
 				};
 
-				registry = libipv4addr_registry_num_by_addr(&ipv4addr);
+				registry = libipv6addr_registry_num_by_addr(ipv6addrp);
 
 				switch (registry) {
+					case REGISTRY_6BONE:
+						stat_inc(counters, STATS_IPV6_6BONE);
+						break;
 					case REGISTRY_IANA:
-						stat_inc(STATS_IPV4_IANA);
+						stat_inc(counters, STATS_IPV6_IANA);
 						break;
 					case REGISTRY_APNIC:
-						stat_inc(STATS_IPV4_APNIC);
+						stat_inc(counters, STATS_IPV6_APNIC);
 						break;
 					case REGISTRY_ARIN:
-						stat_inc(STATS_IPV4_ARIN);
+						stat_inc(counters, STATS_IPV6_ARIN);
 						break;
 					case REGISTRY_RIPENCC:
-						stat_inc(STATS_IPV4_RIPENCC);
+						stat_inc(counters, STATS_IPV6_RIPENCC);
 						break;
 					case REGISTRY_LACNIC:
-						stat_inc(STATS_IPV4_LACNIC);
+						stat_inc(counters, STATS_IPV6_LACNIC);
 						break;
 					case REGISTRY_AFRINIC:
-						stat_inc(STATS_IPV4_AFRINIC);
+						stat_inc(counters, STATS_IPV6_AFRINIC);
 						break;
 					case REGISTRY_RESERVED:
-						stat_inc(STATS_IPV4_RESERVED);
+						stat_inc(counters, STATS_IPV6_RESERVED);
 						break;
 					default:
-						stat_inc(STATS_IPV4_UNKNOWN);
+						stat_inc(counters, STATS_IPV6_UNKNOWN);
 						if (opt_unknown == 1) {
-							fprintf(stderr, "Unknown address: %s\n", token);
+							stat_print_unknown(inputtype, ipv6addrp, ipv4addrp, token);
 						};
 						break;
 				};
-				
-				break;
-		};
-	};
 
-	if (opt_onlyheader == 0) {
-		if (ipv6calc_quiet == 0) {
-			fprintf(stderr, "...finished\n");
-		};
-	};
+				if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_IID) == IPV6_NEW_ADDR_IID) {
+					if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_IID_RANDOM) != 0) {
+						stat_inc(counters, STATS_IPV6_IID_RANDOM);
+					} else if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_IID_ISATAP) != 0) {
+						stat_inc(counters, STATS_IPV6_IID_ISATAP);
+					} else if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_IID_LOCAL) != 0) {
+						stat_inc(counters, STATS_IPV6_IID_MANUAL);
+					} else if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_IID_GLOBAL) != 0) {
+						stat_inc(counters, STATS_IPV6_IID_GLOBAL);
+					} else {
+						stat_inc(counters, STATS_IPV6_IID_UNKNOWN);
+					};
+				};
+			};
+			
+			break;
 
-	/* print result */
-	if (opt_printdirection == 0) {
-		/* print in rows */
+		case FORMAT_ipv4addr:
+			/* is IPv4 address */
+			stat_inc(counters, STATS_IPV4);
 
-		/* print version number */
-		printf("%-20s %d.%d\n", "*Version", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
+			if (opt_simple != 1) {
+				cc_index = libipv4addr_cc_index_by_addr(ipv4addrp, NULL);
+				as_num32 = libipv4addr_as_num32_by_addr(ipv4addrp, NULL);
 
-		time(&timer);
-		tm_info = gmtime(&timer);
-		strftime(resultstring, sizeof(resultstring), "%Y:%m:%d %H:%M:%S%z %Z", tm_info);
+				stat_inc_country_code(counters, cc_index, 4);
+				stat_inc_asnum(counters, as_num32, 4);
+			};
 
-		printf("*DateTime: %s\n", resultstring);
-		printf("*UnixTime: %ju\n", (uintmax_t) timer);
+			registry = libipv4addr_registry_num_by_addr(ipv4addrp);
+
+			switch (registry) {
+				case REGISTRY_IANA:
+					stat_inc(counters, STATS_IPV4_IANA);
+					break;
+				case REGISTRY_APNIC:
+					stat_inc(counters, STATS_IPV4_APNIC);
+					break;
+				case REGISTRY_ARIN:
+					stat_inc(counters, STATS_IPV4_ARIN);
+					break;
+				case REGISTRY_RIPENCC:
+					stat_inc(counters, STATS_IPV4_RIPENCC);
+					break;
+				case REGISTRY_LACNIC:
+					stat_inc(counters, STATS_IPV4_LACNIC);
+					break;
+				case REGISTRY_AFRINIC:
+					stat_inc(counters, STATS_IPV4_AFRINIC);
+					break;
+				case REGISTRY_RESERVED:
+					stat_inc(counters, STATS_IPV4_RESERVED);
+					break;
+				default:
+					stat_inc(counters, STATS_IPV4_UNKNOWN);
+					if (opt_unknown == 1) {
+						stat_print_unknown(inputtype, ipv6addrp, ipv4addrp, token);
+					};
+					break;
+			};
+			
+			break;
+	};
 
-		libipv6calc_db_wrapper_print_db_info(0, "*3*DB-Info: ");
+	return;
+};
 
-		/* print version number */
-		if (strlen(opt_token) > 0) {
-			printf("%-20s %s\n", "*Token", opt_token);
-		};
 
-		for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
-			printf("%-20s %lu\n", ipv6logstats_statentries[i].token, ipv6logstats_statentries[i].counter);
-		};
+/*
+ * Line parser
+ */
+static void lineparser(FILE *input, const char *input_name, stat_counters *counters) {
+	char linebuffer[LINEBUFFER];
+	char *charptr;
+	int linecounter = 0;
 
-		if (feature_cc == 1) {
-			/* country_code / proto */
-			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
-				if (counter_country[index] > 0) {
-					DEBUGPRINT_WA(DEBUG_ipv6logstats_summary, "CC-Index: %d", index);
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "Expecting log lines on %s\n", input_name);
+	};
 
-					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
+	while (1 == 1) {
+		/* read line from input */
+		charptr = fgets(linebuffer, LINEBUFFER, input);
+		
+		if (charptr == NULL) {
+			/* end of input */
+			break;
+		};
 
-					printf("*3*CC-code-proto/%s/ALL   %lu\n", resultstring, counter_country[index]);
-					printf("*3*CC-code-proto/%s/IPv4  %lu\n", resultstring, counter_country_ipv4[index]);
-					printf("*3*CC-code-proto/%s/IPv6  %lu\n", resultstring, counter_country_ipv6[index]);
-					printf("*3*CC-code-proto-list/%s  %lu %lu %lu\n", resultstring, counter_country[index], counter_country_ipv4[index], counter_country_ipv6[index]);
-				};
-			};
+		linecounter++;
 
-			/* proto / country_code */
-			c_all = 0; c_ipv4 = 0; c_ipv6 = 0;
-			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
-				if (counter_country[index] > 0) {
-					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
-					printf("*3*CC-proto-code/ALL/%s   %lu\n", resultstring, counter_country[index]);
-					c_all += counter_country[index];
-				};
+		if (linecounter == 1) {
+			if (ipv6calc_quiet == 0) {
+				fprintf(stderr, "Ok, proceeding %s...\n", input_name);
 			};
-			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
-				if (counter_country_ipv4[index] > 0) {
-					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
-					printf("*3*CC-proto-code/IPv4/%s  %lu\n", resultstring, counter_country_ipv4[index]);
-					c_ipv4 += counter_country_ipv4[index];
-				};
+		};
+		
+		lineparser_line(linebuffer, linecounter, counters);
+	};
+
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "...finished\n");
+	};
+
+	return;
+};
+
+
+/*
+ * Packet capture reader (pcap/pcapng)
+ *  file is mapped into memory, addresses are taken directly from IPv4/IPv6 headers
+ */
+
+/* get 16/32-bit value in file byte order */
+static uint16_t pcap_get16(const unsigned char *p, const int swap) {
+	if (swap == 0) {
+		return ((uint16_t) (p[0] | (p[1] << 8)));
+	};
+	return ((uint16_t) ((p[0] << 8) | p[1]));
+};
+
+static uint32_t pcap_get32(const unsigned char *p, const int swap) {
+	if (swap == 0) {
+		return ((uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24));
+	};
+	return (((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | (uint32_t) p[3]);
+};
+
+
+/*
+ * Fill statistics of one address from packet header
+ *  proto: 4 or 6, p: pointer to address in network byte order
+ */
+static void pcap_address(const int proto, const unsigned char *p, stat_counters *counters) {
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipv4addr ipv4addr;
+	int i;
+
+	stat_inc(counters, STATS_ALL);
+
+	if (proto == 4) {
+		ipv4addr_clearall(&ipv4addr);
+		ipv4addr_setdword(&ipv4addr, ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | (uint32_t) p[3]);
+		ipv4addr_settype(&ipv4addr, 1);
+		ipv4addr.flag_valid = 1;
+
+		stat_address(FORMAT_ipv4addr, &ipv6addr, &ipv4addr, NULL, counters);
+	} else {
+		ipv6addr_clearall(&ipv6addr);
+		for (i = 0; i < 4; i++) {
+			ipv6addr_setdword(&ipv6addr, (unsigned int) i, ((uint32_t) p[i * 4] << 24) | ((uint32_t) p[i * 4 + 1] << 16) | ((uint32_t) p[i * 4 + 2] << 8) | (uint32_t) p[i * 4 + 3]);
+		};
+		ipv6addr_settype(&ipv6addr);
+		ipv6addr.flag_valid = 1;
+
+		stat_address(FORMAT_ipv6addr, &ipv6addr, &ipv4addr, NULL, counters);
+	};
+};
+
+
+/*
+ * Proceed one captured packet
+ *  linktype: LINKTYPE_* of interface, data/length: captured part of packet
+ */
+static void pcap_packet(const uint32_t linktype, const unsigned char *data, uint32_t length, stat_counters *counters) {
+	uint32_t offset, family;
+	uint16_t ethertype = 0;
+	int version = 0;
+
+	switch (linktype) {
+		case PCAP_LINKTYPE_ETHERNET:
+			if (length < 14) {
+				break;
 			};
-			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
-				if (counter_country_ipv6[index] > 0) {
-					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
-					printf("*3*CC-proto-code/IPv6/%s  %lu\n", resultstring, counter_country_ipv6[index]);
-					c_ipv6 += counter_country_ipv6[index];
-				};
+			ethertype = (uint16_t) ((data[12] << 8) | data[13]);
+			offset = 14;
+			/* skip VLAN tags */
+			while ((ethertype == 0x8100 || ethertype == 0x88a8 || ethertype == 0x9100) && (length >= offset + 4)) {
+				ethertype = (uint16_t) ((data[offset + 2] << 8) | data[offset + 3]);
+				offset += 4;
 			};
+			data += offset; length -= offset;
+			break;
 
-			if ((c_all + c_ipv4 + c_ipv6) > 0) {
-				printf("*3*CC-proto-code-list/ALL  %lu %lu %lu\n", c_all, c_ipv4, c_ipv6);
+		case PCAP_LINKTYPE_LINUX_SLL:
+			if (length < 16) {
+				break;
 			};
-		};
+			ethertype = (uint16_t) ((data[14] << 8) | data[15]);
+			data += 16; length -= 16;
+			break;
 
-		if (feature_as == 1) {
-			/* ASN number / proto */
-			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn[index] > 0) {
-					printf("*3*AS-num-proto/%d/ALL   %lu\n", index, counter_asn[index]);
-					printf("*3*AS-num-proto/%d/IPv4  %lu\n", index, counter_asn_ipv4[index]);
-					printf("*3*AS-num-proto/%d/IPv6  %lu\n", index, counter_asn_ipv6[index]);
-					printf("*3*AS-num-proto-list/%d  %lu %lu %lu\n", index, counter_asn[index], counter_asn_ipv4[index], counter_asn_ipv6[index]);
-				};
+		case PCAP_LINKTYPE_LINUX_SLL2:
+			if (length < 20) {
+				break;
 			};
+			ethertype = (uint16_t) ((data[0] << 8) | data[1]);
+			data += 20; length -= 20;
+			break;
 
-			/* ASN proto / number */
-			c_all = 0; c_ipv4 = 0; c_ipv6 = 0;
-			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn[index] > 0) {
-					printf("*3*AS-proto-num/ALL/%d   %lu\n", index, counter_asn[index]);
-					c_all += counter_asn[index];
-				};
+		case PCAP_LINKTYPE_NULL:
+		case PCAP_LINKTYPE_LOOP:
+			if (length < 4) {
+				break;
 			};
-			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn_ipv4[index] > 0) {
-					printf("*3*AS-proto-num/IPv4/%d  %lu\n", index, counter_asn_ipv4[index]);
-					c_ipv4 += counter_asn_ipv4[index];
-				};
+			/* address family in host byte order of capturing system (NULL) or network byte order (LOOP) */
+			family = pcap_get32(data, 0);
+			if (family > 0xffff) {
+				family = pcap_get32(data, 1);
 			};
-			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn_ipv6[index] > 0) {
-					printf("*3*AS-proto-num/IPv6/%d  %lu\n", index, counter_asn_ipv6[index]);
-					c_ipv6 += counter_asn_ipv6[index];
-				};
+			if (family == 2) {
+				ethertype = 0x0800;
+			} else if (family == 24 || family == 28 || family == 30) {
+				/* AF_INET6 of BSD/FreeBSD/Darwin */
+				ethertype = 0x86dd;
 			};
+			data += 4; length -= 4;
+			break;
 
-			if ((c_all + c_ipv4 + c_ipv6) > 0) {
-				printf("*3*AS-proto-num-list/ALL  %lu %lu %lu\n", c_all, c_ipv4, c_ipv6);
+		case PCAP_LINKTYPE_RAW:
+		case PCAP_LINKTYPE_RAW_12:
+		case PCAP_LINKTYPE_RAW_14:
+		case PCAP_LINKTYPE_IPV4:
+		case PCAP_LINKTYPE_IPV6:
+			if (length < 1) {
+				break;
+			};
+			if ((data[0] >> 4) == 4) {
+				ethertype = 0x0800;
+			} else if ((data[0] >> 4) == 6) {
+				ethertype = 0x86dd;
+			};
+			break;
+
+		default:
+			break;
+	};
+
+	if ((ethertype == 0x0800) && (length >= 20) && ((data[0] >> 4) == 4)) {
+		version = 4;
+	} else if ((ethertype == 0x86dd) && (length >= 40) && ((data[0] >> 4) == 6)) {
+		version = 6;
+	};
+
+	if (version == 0) {
+		/* no IP packet or truncated */
+		stat_inc(counters, STATS_ALL);
+		stat_inc(counters, STATS_UNKNOWN);
+		return;
+	};
+
+	if ((opt_pcap_address & PCAP_ADDRESS_SRC) != 0) {
+		pcap_address(version, data + ((version == 4) ? 12 : 8), counters);
+	};
+
+	if ((opt_pcap_address & PCAP_ADDRESS_DST) != 0) {
+		pcap_address(version, data + ((version == 4) ? 16 : 24), counters);
+	};
+};
+
+
+/*
+ * Check for packet capture file magic
+ * ret: 1 = pcap/pcapng, 0 = other
+ */
+static int pcap_magic_check(const unsigned char *p) {
+	uint32_t magic = pcap_get32(p, 0);
+
+	switch (magic) {
+		case PCAP_MAGIC_USEC:
+		case PCAP_MAGIC_NSEC:
+		case PCAP_MAGIC_USEC_SWAPPED:
+		case PCAP_MAGIC_NSEC_SWAPPED:
+		case PCAPNG_BLOCK_SHB:
+			return (1);
+	};
+
+	return (0);
+};
+
+
+/*
+ * Proceed one packet capture file (pcap/pcapng)
+ * ret: 0 = ok, 1 = error
+ */
+static int pcap_file_proceed(const char *name, stat_counters *counters) {
+	const unsigned char *map, *p, *end;
+	struct stat st;
+	uint32_t magic, linktype = 0, block_type, block_length, caplen = 0, iface;
+	uint32_t linktypes[PCAPNG_INTERFACES_MAX];
+	uint32_t interfaces = 0;
+	long unsigned int packets = 0;
+	int fd, swap = 0, result = 0;
+
+	fd = open(name, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "Can't open input file: %s (%s)\n", name, strerror(errno));
+		return (1);
+	};
+
+	if (fstat(fd, &st) != 0) {
+		fprintf(stderr, "Can't stat input file: %s (%s)\n", name, strerror(errno));
+		close(fd);
+		return (1);
+	};
+
+	if (st.st_size < 24) {
+		fprintf(stderr, "Packet capture file too short: %s\n", name);
+		close(fd);
+		return (1);
+	};
+
+	map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		fprintf(stderr, "Can't map input file: %s (%s)\n", name, strerror(errno));
+		return (1);
+	};
+
+	(void) madvise((void *) map, (size_t) st.st_size, MADV_SEQUENTIAL);
+
+	end = map + st.st_size;
+	magic = pcap_get32(map, 0);
+
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "Proceeding packet capture file %s (%s)...\n", name, (magic == PCAPNG_BLOCK_SHB) ? "pcapng" : "pcap");
+	};
+
+	if (magic != PCAPNG_BLOCK_SHB) {
+		/* classic pcap: global header, followed by records */
+		swap = ((magic == PCAP_MAGIC_USEC_SWAPPED) || (magic == PCAP_MAGIC_NSEC_SWAPPED)) ? 1 : 0;
+		linktype = pcap_get32(map + 20, swap) & 0x0fffffff;
+
+		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "pcap file: swap=%d linktype=%u", swap, linktype);
+
+		for (p = map + 24; p + 16 <= end; p += 16 + caplen) {
+			caplen = pcap_get32(p + 8, swap);
+			if (caplen > (uint32_t) (end - p - 16)) {
+				fprintf(stderr, "Packet capture file truncated: %s (packet %lu)\n", name, packets + 1);
+				break;
 			};
+
+			pcap_packet(linktype, p + 16, caplen, counters);
+			packets++;
 		};
 	} else {
-		/* print in columns */
-		if (opt_noheader == 0) {
-			if (strlen(opt_token) > 0) {
-				column_offset++;
-				if (opt_onlyheader == 0) {
-					if (opt_column_numbers == 1) {
-						printf("Token(1) ");
-					} else {
-						printf("Token ");
-					}
-				} else {
-					printf("%s ", opt_token);
+		/* pcapng: sequence of blocks */
+		for (p = map; p + 12 <= end; p += block_length) {
+			block_type = pcap_get32(p, swap);
+
+			if (block_type == PCAPNG_BLOCK_SHB) {
+				/* new section, byte order magic decides */
+				if (p + 28 > end) {
+					break;
 				};
-			};
-			for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
-				if (i > 0) {
-					printf(" ");
-				};
-				if (opt_column_numbers == 1) {
-					printf("%s(%d)", ipv6logstats_statentries[i].token, i + column_offset);
+				if (pcap_get32(p + 8, 0) == PCAPNG_BYTE_ORDER_MAGIC) {
+					swap = 0;
+				} else if (pcap_get32(p + 8, 1) == PCAPNG_BYTE_ORDER_MAGIC) {
+					swap = 1;
 				} else {
-					printf("%s", ipv6logstats_statentries[i].token);
+					fprintf(stderr, "Packet capture file has unsupported byte order magic: %s\n", name);
+					result = 1;
+					break;
 				};
+				interfaces = 0;
 			};
-			printf(" #Version(%d.%d)\n", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
-		};
-		if (opt_onlyheader == 0) {
-			if (strlen(opt_token) > 0) {
-				printf("%s ", opt_token);
-			};
-			for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
-				if (i > 0) {
-					printf(" ");
-				};
-				printf("%lu", ipv6logstats_statentries[i].counter);
+
+			block_length = pcap_get32(p + 4, swap);
+			if ((block_length < 12) || ((block_length & 0x3) != 0) || (block_length > (uint32_t) (end - p))) {
+				fprintf(stderr, "Packet capture file truncated or corrupt: %s (offset %lu)\n", name, (long unsigned int) (p - map));
+				break;
 			};
 
-			printf(" #%d.%d\n", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
+			switch (block_type) {
+				case PCAPNG_BLOCK_IDB:
+					if (block_length < 20) {
+						break;
+					};
+					if (interfaces < PCAPNG_INTERFACES_MAX) {
+						linktypes[interfaces] = pcap_get16(p + 8, swap);
+					};
+					interfaces++;
+					break;
+
+				case PCAPNG_BLOCK_EPB:
+				case PCAPNG_BLOCK_PB:
+					if (block_length < 32) {
+						break;
+					};
+					if (block_type == PCAPNG_BLOCK_EPB) {
+						iface = pcap_get32(p + 8, swap);
+					} else {
+						iface = pcap_get16(p + 8, swap);
+					};
+					caplen = pcap_get32(p + 20, swap);
+					if ((iface >= interfaces) || (iface >= PCAPNG_INTERFACES_MAX) || (caplen > block_length - 32)) {
+						break;
+					};
+					pcap_packet(linktypes[iface], p + 28, caplen, counters);
+					packets++;
+					break;
+
+				case PCAPNG_BLOCK_SPB:
+					if ((block_length < 16) || (interfaces == 0)) {
+						break;
+					};
+					/* captured length is limited by block, interface 0 is implied */
+					caplen = pcap_get32(p + 8, swap);
+					if (caplen > block_length - 16) {
+						caplen = block_length - 16;
+					};
+					pcap_packet(linktypes[0], p + 12, caplen, counters);
+					packets++;
+					break;
+
+				default:
+					/* skip other blocks */
+					break;
+			};
 		};
 	};
 
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_summary, "Packets proceeded: %lu", packets);
 
-	if (opt_printdirection == 0) {
-		/* print used database only in row mode */
+	munmap((void *) map, (size_t) st.st_size);
 
-#if defined SUPPORT_IP2LOCATION || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2 || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN
-		char *string;
-#endif
+	return (result);
+};
 
-#ifdef SUPPORT_IP2LOCATION
-		string = libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
+
+/*
+ * Streaming mode: line reader with timeout (used in case of wall clock)
+ * in : fd, timeout_ms (-1: no timeout)
+ * out: line
+ * ret: 1 = line, 0 = timeout, -1 = end of input
+ */
+static char   stream_buffer[LINEBUFFER * 2];
+static size_t stream_buffer_start = 0;
+static size_t stream_buffer_fill = 0;
+static int    stream_eof = 0;
+
+static int stream_getline(const int fd, char *line, const size_t line_size, const int timeout_ms) {
+	char *newline;
+	size_t len;
+	ssize_t r;
+	struct pollfd pfd;
+
+	while (1 == 1) {
+		newline = memchr(stream_buffer + stream_buffer_start, '\n', stream_buffer_fill - stream_buffer_start);
+
+		if ((newline != NULL) || ((stream_buffer_fill - stream_buffer_start) >= (line_size - 1)) || ((stream_eof == 1) && (stream_buffer_fill > stream_buffer_start))) {
+			if (newline != NULL) {
+				len = newline - (stream_buffer + stream_buffer_start) + 1;
+			} else {
+				len = stream_buffer_fill - stream_buffer_start;
+			};
+			if (len > line_size - 1) {
+				len = line_size - 1;
+			};
+
+			memcpy(line, stream_buffer + stream_buffer_start, len);
+			line[len] = '\0';
+			stream_buffer_start += len;
+			return (1);
 		};
-#endif
 
-#ifdef SUPPORT_GEOIP2
-		string = libipv6calc_db_wrapper_GeoIP2_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
+		if (stream_eof == 1) {
+			return (-1);
 		};
-#endif
 
-#ifdef SUPPORT_DBIP2
-		string = libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
+		/* move remaining data to begin of buffer */
+		if (stream_buffer_start > 0) {
+			memmove(stream_buffer, stream_buffer + stream_buffer_start, stream_buffer_fill - stream_buffer_start);
+			stream_buffer_fill -= stream_buffer_start;
+			stream_buffer_start = 0;
 		};
-#endif
 
-#ifdef SUPPORT_EXTERNAL
-		string = libipv6calc_db_wrapper_External_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
+		pfd.fd = fd;
+		pfd.events = POLLIN;
+		r = poll(&pfd, 1, timeout_ms);
+		if (r < 0) {
+			if (errno == EINTR) {
+				continue;
+			};
+			return (-1);
+		} else if (r == 0) {
+			return (0);
 		};
-#endif
 
-#ifdef SUPPORT_BUILTIN
-		string = libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
+		r = read(fd, stream_buffer + stream_buffer_fill, sizeof(stream_buffer) - stream_buffer_fill);
+		if (r < 0) {
+			if ((errno == EINTR) || (errno == EAGAIN)) {
+				continue;
+			};
+			return (-1);
+		} else if (r == 0) {
+			stream_eof = 1;
+		} else {
+			stream_buffer_fill += r;
 		};
-#endif
 	};
+};
 
-	return;
+
+/*
+ * Streaming mode: get UNIX time from timestamp
+ * in : string (column with timestamp), string_next (next column, can contain timezone)
+ * supported formats
+ *  Apache/nginx combined log format: [10/Oct/2000:13:55:36 -0700]
+ *  ISO 8601: 2000-10-10T13:55:36+02:00 (optional in [...])
+ *  UNIX time: 971186136(.123)
+ * ret: UNIX time, -1 on error
+ */
+static time_t window_timestamp_parse(const char *string, const char *string_next) {
+	static const char *months[12] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+	const char *tz = NULL;
+	char month[4];
+	int year, mon = 0, day, hour, min, sec, n = 0, i, tz_hour, tz_min, tz_sign;
+	long int days;
+	time_t result;
+
+	if (string[0] == '[') {
+		string++;
+	};
+
+	if (sscanf(string, "%2d/%3[A-Za-z]/%4d:%2d:%2d:%2d%n", &day, month, &year, &hour, &min, &sec, &n) == 6) {
+		/* Apache/nginx combined log format */
+		for (i = 0; i < 12; i++) {
+			if (strcmp(month, months[i]) == 0) {
+				mon = i + 1;
+				break;
+			};
+		};
+		if (mon == 0) {
+			return (-1);
+		};
+		tz = (string[n] != '\0') ? &string[n] : string_next;
+	} else if (sscanf(string, "%4d-%2d-%2dT%2d:%2d:%2d%n", &year, &mon, &day, &hour, &min, &sec, &n) == 6) {
+		/* ISO 8601, skip fraction */
+		if (string[n] == '.') {
+			n++;
+			while ((string[n] >= '0') && (string[n] <= '9')) {
+				n++;
+			};
+		};
+		tz = &string[n];
+	} else if ((string[0] >= '0') && (string[0] <= '9')) {
+		/* UNIX time */
+		result = (time_t) strtoll(string, NULL, 10);
+		return ((result > 0) ? result : -1);
+	} else {
+		return (-1);
+	};
+
+	if ((mon < 1) || (mon > 12) || (day < 1) || (day > 31) || (hour > 23) || (min > 59) || (sec > 60)) {
+		return (-1);
+	};
+
+	/* days since 1970-01-01 (proleptic Gregorian calendar) */
+	if (mon <= 2) {
+		year--;
+	};
+	days = (long int) 365 * year + year / 4 - year / 100 + year / 400 + (153 * (mon + ((mon > 2) ? -3 : 9)) + 2) / 5 + day - 1 - 719468;
+
+	result = (time_t) days * 86400 + hour * 3600 + min * 60 + sec;
+
+	/* timezone: [+-]hhmm or [+-]hh:mm or Z */
+	if ((tz != NULL) && ((tz[0] == '+') || (tz[0] == '-'))) {
+		tz_sign = (tz[0] == '-') ? -1 : 1;
+		if ((sscanf(tz + 1, "%2d:%2d", &tz_hour, &tz_min) == 2) || (sscanf(tz + 1, "%2d%2d", &tz_hour, &tz_min) == 2)) {
+			result -= tz_sign * (tz_hour * 3600 + tz_min * 60);
+		};
+	};
+
+	return (result);
+};
+
+
+/*
+ * Streaming mode: get UNIX time from line (column selected by option)
+ * ret: UNIX time, -1 on error
+ */
+static time_t window_timestamp_by_line(const char *line) {
+	char linecopy[LINEBUFFER];
+	char *charptr, *charptr_next, *cptr, **ptrptr;
+	int column;
+
+	ptrptr = &cptr;
+
+	snprintf(linecopy, sizeof(linecopy), "%s", line);
+
+	charptr = strtok_r(linecopy, " \t\n", ptrptr);
+	for (column = 1; (charptr != NULL) && (column < opt_window_column); column++) {
+		charptr = strtok_r(NULL, " \t\n", ptrptr);
+	};
+
+	if (charptr == NULL) {
+		return (-1);
+	};
+
+	charptr_next = strtok_r(NULL, " \t\n", ptrptr);
+
+	return (window_timestamp_parse(charptr, (charptr_next != NULL) ? charptr_next : ""));
+};
+
+
+/*
+ * Streaming mode: print statistics of a window and clear counters for reuse
+ */
+static void window_print(const time_t window_start, stat_counters *counters, const int flag_header) {
+	char token[IPV6CALC_STRING_MAX];
+	char timestring[IPV6CALC_STRING_MAX];
+	struct tm *tm_info;
+
+	tm_info = gmtime(&window_start);
+	strftime(timestring, sizeof(timestring), "%Y-%m-%dT%H:%M:%SZ", tm_info);
+
+	token[0] = '\0';
+	if (strlen(opt_token) > 0) {
+		STRCAT(token, opt_token);
+		STRCAT(token, "/");
+	};
+	STRCAT(token, timestring);
+
+	print_statistics(counters, token, flag_header);
+	fflush(stdout);
+
+	memset(counters, 0, sizeof(stat_counters));
+};
+
+
+/*
+ * Streaming mode: line parser with time windows
+ *  timestamp is taken from column selected by option or wall clock
+ *  each completed window is printed, windows without any line are not printed
+ *  lines with timestamp before current window are counted in current window
+ */
+static void lineparser_window(FILE *input) {
+	char linebuffer[LINEBUFFER];
+	int linecounter = 0, windowcounter = 0, result, timeout;
+	time_t timestamp, window_start = 0, remaining;
+
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "Expecting log lines on stdin (window: %d seconds, time: %s)\n", opt_window, (opt_window_column == 0) ? "wall clock" : "column");
+	};
+
+	while (1 == 1) {
+		if (opt_window_column == 0) {
+			/* wall clock, wait for next line at most until end of window */
+			if (window_start == 0) {
+				timeout = -1;
+			} else {
+				/* calculate in time_t, clamp to range of poll timeout */
+				remaining = window_start + opt_window - time(NULL);
+				if (remaining <= 0) {
+					timeout = 0;
+				} else if (remaining > (time_t) (INT_MAX / 1000)) {
+					timeout = INT_MAX;
+				} else {
+					timeout = (int) remaining * 1000;
+				};
+			};
+
+			result = stream_getline(fileno(input), linebuffer, sizeof(linebuffer), timeout);
+			timestamp = time(NULL);
+		} else {
+			result = (fgets(linebuffer, sizeof(linebuffer), input) != NULL) ? 1 : -1;
+			timestamp = -1;
+
+			if (result == 1) {
+				timestamp = window_timestamp_by_line(linebuffer);
+				if (timestamp < 0) {
+					DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "No proper timestamp found in line: %d", linecounter + 1);
+				};
+			};
+		};
+
+		if (result < 0) {
+			/* end of input */
+			break;
+		};
+
+		if ((window_start != 0) && (timestamp >= window_start + opt_window)) {
+			/* window completed */
+			window_print(window_start, &counters_input, (windowcounter == 0) ? 1 : 0);
+			windowcounter++;
+			window_start = 0;
+		};
+
+		if (result == 0) {
+			/* timeout */
+			continue;
+		};
+
+		if ((window_start == 0) && (timestamp > 0)) {
+			window_start = timestamp - (timestamp % opt_window);
+		};
+
+		linecounter++;
+
+		if (linecounter == 1) {
+			if (ipv6calc_quiet == 0) {
+				fprintf(stderr, "Ok, proceeding stdin...\n");
+			};
+		};
+
+		lineparser_line(linebuffer, linecounter, &counters_input);
+	};
+
+	if (linecounter > 0) {
+		/* last (incomplete) window */
+		if (window_start == 0) {
+			/* no proper timestamp found at all */
+			window_start = time(NULL);
+			window_start -= window_start % opt_window;
+		};
+
+		window_print(window_start, &counters_input, (windowcounter == 0) ? 1 : 0);
+	};
+
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "...finished\n");
+	};
+
+	return;
+};
+
+
+/*
+ * Print statistics
+ * in : counters
+ * in : token (optional, can be empty)
+ * in : flag_header (column mode: print header line, if not disabled by option)
+ */
+static void print_statistics(const stat_counters *counters, const char *token, const int flag_header) {
+	char resultstring[IPV6CALC_STRING_MAX];
+	int i, index;
+	long unsigned int c_all, c_ipv4, c_ipv6;
+
+	time_t timer;
+	struct tm* tm_info;
+
+	int column_offset = 1;
+
+	/* print result */
+	if (opt_printdirection == 0) {
+		/* print in rows */
+
+		/* print version number */
+		printf("%-20s %d.%d\n", "*Version", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
+
+		time(&timer);
+		tm_info = gmtime(&timer);
+		strftime(resultstring, sizeof(resultstring), "%Y:%m:%d %H:%M:%S%z %Z", tm_info);
+
+		printf("*DateTime: %s\n", resultstring);
+		printf("*UnixTime: %ju\n", (uintmax_t) timer);
+
+		libipv6calc_db_wrapper_print_db_info(0, "*3*DB-Info: ");
+
+		/* print version number */
+		if (strlen(token) > 0) {
+			printf("%-20s %s\n", "*Token", token);
+		};
+
+		for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+			printf("%-20s %lu\n", ipv6logstats_statentries[i].token, counters->stat[i]);
+		};
+
+		if (feature_cc == 1) {
+			/* country_code / proto */
+			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+				if (counters->country[index] > 0) {
+					DEBUGPRINT_WA(DEBUG_ipv6logstats_summary, "CC-Index: %d", index);
+
+					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
+
+					printf("*3*CC-code-proto/%s/ALL   %lu\n", resultstring, counters->country[index]);
+					printf("*3*CC-code-proto/%s/IPv4  %lu\n", resultstring, counters->country_ipv4[index]);
+					printf("*3*CC-code-proto/%s/IPv6  %lu\n", resultstring, counters->country_ipv6[index]);
+					printf("*3*CC-code-proto-list/%s  %lu %lu %lu\n", resultstring, counters->country[index], counters->country_ipv4[index], counters->country_ipv6[index]);
+				};
+			};
+
+			/* proto / country_code */
+			c_all = 0; c_ipv4 = 0; c_ipv6 = 0;
+			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+				if (counters->country[index] > 0) {
+					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
+					printf("*3*CC-proto-code/ALL/%s   %lu\n", resultstring, counters->country[index]);
+					c_all += counters->country[index];
+				};
+			};
+			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+				if (counters->country_ipv4[index] > 0) {
+					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
+					printf("*3*CC-proto-code/IPv4/%s  %lu\n", resultstring, counters->country_ipv4[index]);
+					c_ipv4 += counters->country_ipv4[index];
+				};
+			};
+			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+				if (counters->country_ipv6[index] > 0) {
+					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
+					printf("*3*CC-proto-code/IPv6/%s  %lu\n", resultstring, counters->country_ipv6[index]);
+					c_ipv6 += counters->country_ipv6[index];
+				};
+			};
+
+			if ((c_all + c_ipv4 + c_ipv6) > 0) {
+				printf("*3*CC-proto-code-list/ALL  %lu %lu %lu\n", c_all, c_ipv4, c_ipv6);
+			};
+		};
+
+		if (feature_as == 1) {
+			/* ASN number / proto */
+			for (index = 0; index < ASNUM_MAX; index++) {
+				if (counters->asn[index] > 0) {
+					printf("*3*AS-num-proto/%d/ALL   %lu\n", index, counters->asn[index]);
+					printf("*3*AS-num-proto/%d/IPv4  %lu\n", index, counters->asn_ipv4[index]);
+					printf("*3*AS-num-proto/%d/IPv6  %lu\n", index, counters->asn_ipv6[index]);
+					printf("*3*AS-num-proto-list/%d  %lu %lu %lu\n", index, counters->asn[index], counters->asn_ipv4[index], counters->asn_ipv6[index]);
+				};
+			};
+
+			/* ASN proto / number */
+			c_all = 0; c_ipv4 = 0; c_ipv6 = 0;
+			for (index = 0; index < ASNUM_MAX; index++) {
+				if (counters->asn[index] > 0) {
+					printf("*3*AS-proto-num/ALL/%d   %lu\n", index, counters->asn[index]);
+					c_all += counters->asn[index];
+				};
+			};
+			for (index = 0; index < ASNUM_MAX; index++) {
+				if (counters->asn_ipv4[index] > 0) {
+					printf("*3*AS-proto-num/IPv4/%d  %lu\n", index, counters->asn_ipv4[index]);
+					c_ipv4 += counters->asn_ipv4[index];
+				};
+			};
+			for (index = 0; index < ASNUM_MAX; index++) {
+				if (counters->asn_ipv6[index] > 0) {
+					printf("*3*AS-proto-num/IPv6/%d  %lu\n", index, counters->asn_ipv6[index]);
+					c_ipv6 += counters->asn_ipv6[index];
+				};
+			};
+
+			if ((c_all + c_ipv4 + c_ipv6) > 0) {
+				printf("*3*AS-proto-num-list/ALL  %lu %lu %lu\n", c_all, c_ipv4, c_ipv6);
+			};
+		};
+	} else {
+		/* print in columns */
+		if ((opt_noheader == 0) && (flag_header == 1)) {
+			if (strlen(token) > 0) {
+				column_offset++;
+				if (opt_onlyheader == 0) {
+					if (opt_column_numbers == 1) {
+						printf("Token(1) ");
+					} else {
+						printf("Token ");
+					}
+				} else {
+					printf("%s ", token);
+				};
+			};
+			for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+				if (i > 0) {
+					printf(" ");
+				};
+				if (opt_column_numbers == 1) {
+					printf("%s(%d)", ipv6logstats_statentries[i].token, i + column_offset);
+				} else {
+					printf("%s", ipv6logstats_statentries[i].token);
+				};
+			};
+			printf(" #Version(%d.%d)\n", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
+		};
+		if (opt_onlyheader == 0) {
+			if (strlen(token) > 0) {
+				printf("%s ", token);
+			};
+			for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+				if (i > 0) {
+					printf(" ");
+				};
+				printf("%lu", counters->stat[i]);
+			};
+
+			printf(" #%d.%d\n", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
+		};
+	};
+
+	return;
+};
+
+
+/*
+ * Print used databases
+ */
+static void print_db_used(void) {
+#if defined SUPPORT_IP2LOCATION || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2 || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN
+	char *string;
+#endif
+
+#ifdef SUPPORT_IP2LOCATION
+	string = libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
+#endif
+
+#ifdef SUPPORT_GEOIP2
+	string = libipv6calc_db_wrapper_GeoIP2_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
+#endif
+
+#ifdef SUPPORT_DBIP2
+	string = libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
+#endif
+
+#ifdef SUPPORT_EXTERNAL
+	string = libipv6calc_db_wrapper_External_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
+#endif
+
+#ifdef SUPPORT_BUILTIN
+	string = libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
+#endif
+
+	return;
+};
+
+
+/*
+ * Add one input file to list
+ */
+static int input_file_append(const char *name) {
+	char **ptr;
+
+	if (input_files_count >= input_files_max) {
+		input_files_max += 256;
+		ptr = realloc(input_files, input_files_max * sizeof(char *));
+		if (ptr == NULL) {
+			fprintf(stderr, "Can't allocate memory for list of input files\n");
+			return (1);
+		};
+		input_files = ptr;
+	};
+
+	input_files[input_files_count] = strdup(name);
+	if (input_files[input_files_count] == NULL) {
+		fprintf(stderr, "Can't allocate memory for list of input files\n");
+		return (1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Add input file #%d: %s", input_files_count, name);
+
+	input_files_count++;
+	return (0);
+};
+
+
+static int input_file_compare(const void *a, const void *b) {
+	return (strcmp(*(char * const *) a, *(char * const *) b));
+};
+
+
+/*
+ * Add input file(s)
+ * in : name of file, directory (regular files inside, sorted by name) or glob pattern, "-" for stdin
+ * ret: 0 = ok, 1 = error
+ */
+static int input_files_add(const char *name) {
+	char filename[IPV6CALC_STRING_MAX];
+	struct stat st;
+	struct dirent *entry;
+	DIR *dir;
+	glob_t globbuf;
+	int i, first, result = 0;
+
+	if (strcmp(name, "-") == 0) {
+		return (input_file_append(name));
+	};
+
+	if (strpbrk(name, "*?[") != NULL) {
+		/* glob pattern (e.g. quoted to avoid too long argument list) */
+		result = glob(name, 0, NULL, &globbuf);
+		if (result == GLOB_NOMATCH) {
+			fprintf(stderr, "No input file matches pattern: %s\n", name);
+			return (1);
+		} else if (result != 0) {
+			fprintf(stderr, "Can't resolve pattern: %s\n", name);
+			return (1);
+		};
+
+		for (i = 0; i < (int) globbuf.gl_pathc; i++) {
+			if ((stat(globbuf.gl_pathv[i], &st) == 0) && S_ISDIR(st.st_mode)) {
+				/* skip directories */
+				continue;
+			};
+			result = input_file_append(globbuf.gl_pathv[i]);
+			if (result != 0) {
+				break;
+			};
+		};
+
+		globfree(&globbuf);
+		return (result);
+	};
+
+	if (stat(name, &st) != 0) {
+		fprintf(stderr, "Can't access input file: %s (%s)\n", name, strerror(errno));
+		return (1);
+	};
+
+	if (! S_ISDIR(st.st_mode)) {
+		return (input_file_append(name));
+	};
+
+	/* directory */
+	dir = opendir(name);
+	if (dir == NULL) {
+		fprintf(stderr, "Can't open directory: %s (%s)\n", name, strerror(errno));
+		return (1);
+	};
+
+	first = input_files_count;
+
+	while ((entry = readdir(dir)) != NULL) {
+		if (entry->d_name[0] == '.') {
+			/* skip hidden files */
+			continue;
+		};
+
+		if (strlen(name) + strlen(entry->d_name) + 2 > sizeof(filename)) {
+			fprintf(stderr, "Input file name too long: %s/%s\n", name, entry->d_name);
+			result = 1;
+			break;
+		};
+		snprintf(filename, sizeof(filename), "%s/%s", name, entry->d_name);
+
+		if ((stat(filename, &st) != 0) || (! S_ISREG(st.st_mode))) {
+			continue;
+		};
+
+		result = input_file_append(filename);
+		if (result != 0) {
+			break;
+		};
+	};
+
+	closedir(dir);
+
+	/* sort entries of directory */
+	qsort(&input_files[first], input_files_count - first, sizeof(char *), input_file_compare);
+
+	return (result);
+};
+
+
+/*
+ * Proceed one input file
+ * ret: 0 = ok, 1 = error
+ */
+static int input_file_proceed(const char *name, stat_counters *counters) {
+	FILE *input;
+	unsigned char magic[4];
+
+	memset(counters, 0, sizeof(stat_counters));
+
+	if (strcmp(name, "-") == 0) {
+		lineparser(stdin, "stdin", counters);
+		return (0);
+	};
+
+	input = fopen(name, "r");
+	if (input == NULL) {
+		fprintf(stderr, "Can't open input file: %s (%s)\n", name, strerror(errno));
+		return (1);
+	};
+
+	/* autodetect packet capture file by magic */
+	if ((fread(magic, 1, sizeof(magic), input) == sizeof(magic)) && (pcap_magic_check(magic) == 1)) {
+		fclose(input);
+		return (pcap_file_proceed(name, counters));
+	};
+	rewind(input);
+
+	lineparser(input, name, counters);
+
+	fclose(input);
+	return (0);
+};
+
+
+/*
+ * Start a job proceeding one input file, counters are returned via pipe
+ * out: *pid_p, *fd_p (read side of pipe)
+ * ret: 0 = ok, 1 = error
+ */
+static int input_file_job_start(const char *name, pid_t *pid_p, int *fd_p) {
+	int fds[2];
+	size_t done;
+	ssize_t r;
+	pid_t pid;
+
+	if (pipe(fds) != 0) {
+		fprintf(stderr, "Can't create pipe for job: %s\n", strerror(errno));
+		return (1);
+	};
+
+	/* avoid duplicated output of buffered data by child */
+	fflush(stdout);
+	fflush(stderr);
+
+	pid = fork();
+	if (pid < 0) {
+		fprintf(stderr, "Can't create job: %s\n", strerror(errno));
+		close(fds[0]);
+		close(fds[1]);
+		return (1);
+	};
+
+	if (pid == 0) {
+		/* child */
+		close(fds[0]);
+
+		if (input_file_proceed(name, &counters_input) != 0) {
+			_exit(EXIT_FAILURE);
+		};
+
+		for (done = 0; done < sizeof(counters_input); done += r) {
+			r = write(fds[1], ((char *) &counters_input) + done, sizeof(counters_input) - done);
+			if (r <= 0) {
+				_exit(EXIT_FAILURE);
+			};
+		};
+
+		close(fds[1]);
+		_exit(EXIT_SUCCESS);
+	};
+
+	/* parent */
+	close(fds[1]);
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Started job pid=%d for input file: %s", (int) pid, name);
+
+	*pid_p = pid;
+	*fd_p = fds[0];
+	return (0);
+};
+
+
+/*
+ * Wait for job and receive counters
+ * ret: 0 = ok, 1 = error
+ */
+static int input_file_job_finish(const char *name, const pid_t pid, const int fd, stat_counters *counters) {
+	size_t done;
+	ssize_t r = 0;
+	int status;
+
+	for (done = 0; done < sizeof(stat_counters); done += r) {
+		r = read(fd, ((char *) counters) + done, sizeof(stat_counters) - done);
+		if (r <= 0) {
+			break;
+		};
+	};
+
+	close(fd);
+
+	if ((waitpid(pid, &status, 0) != pid) || (! WIFEXITED(status)) || (WEXITSTATUS(status) != 0) || (done != sizeof(stat_counters))) {
+		fprintf(stderr, "Job for input file failed: %s\n", name);
+		return (1);
+	};
+
+	return (0);
+};
+
+
+/*
+ * Proceed all input files
+ *  print statistics per input file and total (in case of more than one input file)
+ *  in case of jobs > 1 input files are proceeded in parallel by child processes
+ * ret: 0 = ok, 1 = error
+ */
+static int input_files_proceed(void) {
+	pid_t *job_pid = NULL;
+	int *job_fd = NULL;
+	int i, started = 0, finished = 0, result = 0;
+
+	if (opt_jobs > 1) {
+		job_pid = calloc(input_files_count, sizeof(pid_t));
+		job_fd = calloc(input_files_count, sizeof(int));
+		if ((job_pid == NULL) || (job_fd == NULL)) {
+			fprintf(stderr, "Can't allocate memory for jobs\n");
+			return (1);
+		};
+	};
+
+	for (i = 0; i < input_files_count; i++) {
+		if (opt_jobs > 1) {
+			/* keep up to opt_jobs jobs running, results are collected in order of input files */
+			while ((started < input_files_count) && (started < i + opt_jobs)) {
+				if (input_file_job_start(input_files[started], &job_pid[started], &job_fd[started]) != 0) {
+					result = 1;
+					break;
+				};
+				started++;
+			};
+
+			if (result != 0) {
+				break;
+			};
+
+			/* job is closed and waited for also in case of error */
+			finished = i + 1;
+			if (input_file_job_finish(input_files[i], job_pid[i], job_fd[i], &counters_input) != 0) {
+				result = 1;
+				break;
+			};
+		} else {
+			if (input_file_proceed(input_files[i], &counters_input) != 0) {
+				result = 1;
+				break;
+			};
+		};
+
+		print_statistics(&counters_input, input_files[i], (i == 0) ? 1 : 0);
+
+		stat_add(&counters_total, &counters_input);
+	};
+
+	if (result != 0) {
+		/* cleanup started but not finished jobs */
+		for (i = finished; i < started; i++) {
+			close(job_fd[i]);
+			waitpid(job_pid[i], NULL, 0);
+		};
+	} else if (input_files_count > 1) {
+		/* total */
+		print_statistics(&counters_total, (strlen(opt_token) > 0) ? opt_token : "TOTAL", 0);
+	};
+
+	if (job_pid != NULL) {
+		free(job_pid);
+	};
+	if (job_fd != NULL) {
+		free(job_fd);
+	};
+
+	return (result);
+};
+
+
+/*
+ * Checkpoint: little endian number handling
+ */
+static void checkpoint_put(unsigned char *buffer, const uint64_t value, const int bytes) {
+	int i;
+
+	for (i = 0; i < bytes; i++) {
+		buffer[i] = (unsigned char) ((value >> (8 * i)) & 0xff);
+	};
+};
+
+static uint64_t checkpoint_get(const unsigned char *buffer, const int bytes) {
+	uint64_t value = 0;
+	int i;
+
+	for (i = bytes - 1; i >= 0; i--) {
+		value = (value << 8) | buffer[i];
+	};
+
+	return (value);
+};
+
+
+/*
+ * Checkpoint: write section header
+ * ret: 0 = ok, 1 = error
+ */
+static int checkpoint_write_section(FILE *output, const uint32_t tag, const uint32_t entries, const uint32_t entry_size) {
+	unsigned char buffer[12];
+
+	checkpoint_put(buffer, tag, 4);
+	checkpoint_put(buffer + 4, entries, 4);
+	checkpoint_put(buffer + 8, entry_size, 4);
+
+	return ((fwrite(buffer, sizeof(buffer), 1, output) == 1) ? 0 : 1);
+};
+
+
+/*
+ * Checkpoint: write entries of section with index and 3 counters (CC, ASN)
+ * ret: 0 = ok, 1 = error
+ */
+static int checkpoint_write_section_list(FILE *output, const uint32_t tag, const int max, const long unsigned int *all, const long unsigned int *ipv4, const long unsigned int *ipv6) {
+	unsigned char buffer[28];
+	uint32_t entries = 0;
+	int i;
+
+	for (i = 0; i < max; i++) {
+		if ((all[i] > 0) || (ipv4[i] > 0) || (ipv6[i] > 0)) {
+			entries++;
+		};
+	};
+
+	if (entries == 0) {
+		return (0);
+	};
+
+	if (checkpoint_write_section(output, tag, entries, sizeof(buffer)) != 0) {
+		return (1);
+	};
+
+	for (i = 0; i < max; i++) {
+		if ((all[i] > 0) || (ipv4[i] > 0) || (ipv6[i] > 0)) {
+			checkpoint_put(buffer, i, 4);
+			checkpoint_put(buffer + 4, all[i], 8);
+			checkpoint_put(buffer + 12, ipv4[i], 8);
+			checkpoint_put(buffer + 20, ipv6[i], 8);
+			if (fwrite(buffer, sizeof(buffer), 1, output) != 1) {
+				return (1);
+			};
+		};
+	};
+
+	return (0);
+};
+
+
+/*
+ * Write counters to binary checkpoint file (only counters > 0 are stored)
+ * in : name, counters
+ * ret: 0 = ok, 1 = error
+ */
+static int checkpoint_write(const char *name, const stat_counters *counters) {
+	FILE *output;
+	unsigned char buffer[24];
+	uint32_t entries = 0;
+	int i, result = 0;
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Write checkpoint: %s", name);
+
+	output = fopen(name, "wb");
+	if (output == NULL) {
+		fprintf(stderr, "Can't open checkpoint file: %s (%s)\n", name, strerror(errno));
+		return (1);
+	};
+
+	/* header */
+	memset(buffer, 0, sizeof(buffer));
+	memcpy(buffer, CHECKPOINT_MAGIC, strlen(CHECKPOINT_MAGIC));
+	checkpoint_put(buffer + 8, STATS_VERSION_MAJOR, 2);
+	checkpoint_put(buffer + 10, STATS_VERSION_MINOR, 2);
+	checkpoint_put(buffer + 12, CHECKPOINT_FORMAT, 2);
+	checkpoint_put(buffer + 14, ((feature_cc == 1) ? CHECKPOINT_FLAG_CC : 0) | ((feature_as == 1) ? CHECKPOINT_FLAG_AS : 0) | ((prefix_estimated == 1) ? CHECKPOINT_FLAG_PREFIX_ESTIMATED : 0), 2);
+	if (fwrite(buffer, 16, 1, output) != 1) {
+		result = 1;
+	};
+
+	/* statistics */
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		if (counters->stat[i] > 0) {
+			entries++;
+		};
+	};
+
+	if ((result == 0) && (entries > 0)) {
+		result = checkpoint_write_section(output, CHECKPOINT_SECTION_STAT, entries, 12);
+
+		for (i = 0; (result == 0) && (i < MAXENTRIES_ARRAY(ipv6logstats_statentries)); i++) {
+			if (counters->stat[i] > 0) {
+				checkpoint_put(buffer, ipv6logstats_statentries[i].number, 4);
+				checkpoint_put(buffer + 4, counters->stat[i], 8);
+				if (fwrite(buffer, 12, 1, output) != 1) {
+					result = 1;
+				};
+			};
+		};
+	};
+
+	/* Country Code */
+	if ((result == 0) && ((counters->country_A46 > 0) || (counters->country_IPV4 > 0) || (counters->country_IPV6 > 0))) {
+		result = checkpoint_write_section(output, CHECKPOINT_SECTION_CC_SUM, 1, 24);
+		if (result == 0) {
+			checkpoint_put(buffer, counters->country_A46, 8);
+			checkpoint_put(buffer + 8, counters->country_IPV4, 8);
+			checkpoint_put(buffer + 16, counters->country_IPV6, 8);
+			if (fwrite(buffer, 24, 1, output) != 1) {
+				result = 1;
+			};
+		};
+	};
+
+	if (result == 0) {
+		result = checkpoint_write_section_list(output, CHECKPOINT_SECTION_CC, COUNTRYCODE_INDEX_MAX, counters->country, counters->country_ipv4, counters->country_ipv6);
+	};
+
+	/* ASN */
+	if (result == 0) {
+		result = checkpoint_write_section_list(output, CHECKPOINT_SECTION_ASN, ASNUM_MAX, counters->asn, counters->asn_ipv4, counters->asn_ipv6);
+	};
+
+	/* prefix aggregation: in case of sketch mode the sketch and the heavy hitters (re-estimated) */
+	if ((result == 0) && (prefix_mode_sketch == 1)) {
+		prefix_hh_estimate();
+
+		result = checkpoint_write_section(output, CHECKPOINT_SECTION_PREFIX_SKETCH, PREFIX_SKETCH_DEPTH * PREFIX_SKETCH_WIDTH, 4);
+
+		for (i = 0; (result == 0) && (i < PREFIX_SKETCH_DEPTH * PREFIX_SKETCH_WIDTH); i++) {
+			checkpoint_put(buffer, prefix_sketch[i], 4);
+			if (fwrite(buffer, 4, 1, output) != 1) {
+				result = 1;
+			};
+		};
+	};
+
+	if ((result == 0) && (prefix_table_used > 0)) {
+		result = checkpoint_write_section(output, CHECKPOINT_SECTION_PREFIX, prefix_table_used, 20);
+
+		for (i = 0; (result == 0) && (i <= (int) prefix_table_mask); i++) {
+			if (prefix_table[i].proto != 0) {
+				checkpoint_put(buffer, prefix_table[i].proto, 1);
+				checkpoint_put(buffer + 1, (prefix_table[i].proto == IPV6CALC_PROTO_IPV4) ? opt_prefix_length_ipv4 : opt_prefix_length_ipv6, 1);
+				checkpoint_put(buffer + 2, 0, 2);
+				checkpoint_put(buffer + 4, prefix_table[i].prefix, 8);
+				checkpoint_put(buffer + 12, prefix_table[i].count, 8);
+				if (fwrite(buffer, 20, 1, output) != 1) {
+					result = 1;
+				};
+			};
+		};
+	};
+
+	if (result == 0) {
+		result = checkpoint_write_section(output, CHECKPOINT_SECTION_END, 0, 0);
+	};
+
+	if ((fclose(output) != 0) || (result != 0)) {
+		fprintf(stderr, "Can't write checkpoint file: %s (%s)\n", name, strerror(errno));
+		return (1);
+	};
+
+	return (0);
+};
+
+
+/*
+ * Read binary checkpoint file and add counters
+ * in : name
+ * mod: counters
+ * ret: 0 = ok, 1 = error
+ */
+static int checkpoint_merge(const char *name, stat_counters *counters) {
+	FILE *input;
+	unsigned char buffer[32];
+	uint32_t tag, entries, entry_size, e, index;
+	int i, result = 1, sketch_merged = 0;
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Merge checkpoint: %s", name);
+
+	input = fopen(name, "rb");
+	if (input == NULL) {
+		fprintf(stderr, "Can't open checkpoint file: %s (%s)\n", name, strerror(errno));
+		return (1);
+	};
+
+	/* header */
+	if ((fread(buffer, 16, 1, input) != 1) || (memcmp(buffer, CHECKPOINT_MAGIC, strlen(CHECKPOINT_MAGIC) + 1) != 0)) {
+		fprintf(stderr, "No checkpoint file: %s\n", name);
+		goto END_checkpoint_merge;
+	};
+
+	if ((checkpoint_get(buffer + 8, 2) != STATS_VERSION_MAJOR) || (checkpoint_get(buffer + 12, 2) != CHECKPOINT_FORMAT)) {
+		fprintf(stderr, "Unsupported checkpoint version %d.%d (format %d), expected %d.x (format %d): %s\n", (int) checkpoint_get(buffer + 8, 2), (int) checkpoint_get(buffer + 10, 2), (int) checkpoint_get(buffer + 12, 2), STATS_VERSION_MAJOR, CHECKPOINT_FORMAT, name);
+		goto END_checkpoint_merge;
+	};
+
+	/* CC/ASN statistics are printed if available in any checkpoint */
+	if (opt_simple == 0) {
+		if ((checkpoint_get(buffer + 14, 2) & CHECKPOINT_FLAG_CC) != 0) {
+			feature_cc = 1;
+		};
+		if ((checkpoint_get(buffer + 14, 2) & CHECKPOINT_FLAG_AS) != 0) {
+			feature_as = 1;
+		};
+	};
+
+	if ((checkpoint_get(buffer + 14, 2) & CHECKPOINT_FLAG_PREFIX_ESTIMATED) != 0) {
+		prefix_estimated = 1;
+	};
+
+	/* sections */
+	while (fread(buffer, 12, 1, input) == 1) {
+		tag = checkpoint_get(buffer, 4);
+		entries = checkpoint_get(buffer + 4, 4);
+		entry_size = checkpoint_get(buffer + 8, 4);
+
+		DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Checkpoint section: tag=%u entries=%u size=%u", tag, entries, entry_size);
+
+		if (tag == CHECKPOINT_SECTION_END) {
+			result = 0;
+			break;
+		};
+
+		if ((tag == CHECKPOINT_SECTION_PREFIX_SKETCH) && (opt_prefix_top > 0)) {
+			/* sketches are added element-wise (same dimension and hash functions) */
+			if ((entry_size != 4) || (entries != PREFIX_SKETCH_DEPTH * PREFIX_SKETCH_WIDTH)) {
+				fprintf(stderr, "Prefix sketch dimension of checkpoint (%u) differs from supported one: %s\n", entries, name);
+				goto END_checkpoint_merge;
+			};
+
+			if (prefix_sketch_enable() != 0) {
+				goto END_checkpoint_merge;
+			};
+
+			for (e = 0; e < entries; e++) {
+				if (fread(buffer, entry_size, 1, input) != 1) {
+					break;
+				};
+
+				prefix_sketch_counter_add(&prefix_sketch[e], checkpoint_get(buffer, 4));
+			};
+
+			if (e != entries) {
+				break;
+			};
+
+			prefix_hh_estimate();
+
+			sketch_merged = 1;
+			continue;
+		};
+
+		if ((tag == CHECKPOINT_SECTION_PREFIX) && (entry_size == 20) && (opt_prefix_top > 0)) {
+			for (e = 0; e < entries; e++) {
+				if (fread(buffer, entry_size, 1, input) != 1) {
+					break;
+				};
+
+				if (checkpoint_get(buffer + 1, 1) != (uint64_t) ((checkpoint_get(buffer, 1) == IPV6CALC_PROTO_IPV4) ? opt_prefix_length_ipv4 : opt_prefix_length_ipv6)) {
+					fprintf(stderr, "Prefix length of checkpoint (%d) differs from selected one: %s\n", (int) checkpoint_get(buffer + 1, 1), name);
+					goto END_checkpoint_merge;
+				};
+
+				if (sketch_merged == 1) {
+					/* counter is already contained in merged sketch, only candidate for heavy hitter list */
+					prefix_hh_update((uint8_t) checkpoint_get(buffer, 1), checkpoint_get(buffer + 4, 8), prefix_sketch_estimate((uint8_t) checkpoint_get(buffer, 1), checkpoint_get(buffer + 4, 8)));
+				} else if (prefix_add((uint8_t) checkpoint_get(buffer, 1), checkpoint_get(buffer + 4, 8), checkpoint_get(buffer + 12, 8)) != 0) {
+					goto END_checkpoint_merge;
+				};
+			};
+
+			if (e != entries) {
+				break;
+			};
+			continue;
+		};
+
+		if ((tag != CHECKPOINT_SECTION_STAT) && (tag != CHECKPOINT_SECTION_CC_SUM) && (tag != CHECKPOINT_SECTION_CC) && (tag != CHECKPOINT_SECTION_ASN)) {
+			/* unknown section (newer minor version) or not selected */
+			DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Skip unknown checkpoint section: %u", tag);
+			if (fseek(input, (long) entries * entry_size, SEEK_CUR) != 0) {
+				break;
+			};
+			continue;
+		};
+
+		if (((tag == CHECKPOINT_SECTION_STAT) && (entry_size != 12)) || ((tag == CHECKPOINT_SECTION_CC_SUM) && (entry_size != 24)) || (((tag == CHECKPOINT_SECTION_CC) || (tag == CHECKPOINT_SECTION_ASN)) && (entry_size != 28))) {
+			break;
+		};
+
+		for (e = 0; e < entries; e++) {
+			if (fread(buffer, entry_size, 1, input) != 1) {
+				break;
+			};
+
+			index = checkpoint_get(buffer, 4);
+
+			if (tag == CHECKPOINT_SECTION_STAT) {
+				for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+					if ((uint32_t) ipv6logstats_statentries[i].number == index) {
+						counters->stat[i] += checkpoint_get(buffer + 4, 8);
+						break;
+					};
+				};
+				if (i == MAXENTRIES_ARRAY(ipv6logstats_statentries)) {
+					DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Skip unknown statistic number: 0x%x", index);
+				};
+			} else if (tag == CHECKPOINT_SECTION_CC_SUM) {
+				counters->country_A46 += checkpoint_get(buffer, 8);
+				counters->country_IPV4 += checkpoint_get(buffer + 8, 8);
+				counters->country_IPV6 += checkpoint_get(buffer + 16, 8);
+			} else if (((tag == CHECKPOINT_SECTION_CC) && (index < COUNTRYCODE_INDEX_MAX)) || ((tag == CHECKPOINT_SECTION_ASN) && (index < ASNUM_MAX))) {
+				if (tag == CHECKPOINT_SECTION_CC) {
+					counters->country[index] += checkpoint_get(buffer + 4, 8);
+					counters->country_ipv4[index] += checkpoint_get(buffer + 12, 8);
+					counters->country_ipv6[index] += checkpoint_get(buffer + 20, 8);
+				} else {
+					counters->asn[index] += checkpoint_get(buffer + 4, 8);
+					counters->asn_ipv4[index] += checkpoint_get(buffer + 12, 8);
+					counters->asn_ipv6[index] += checkpoint_get(buffer + 20, 8);
+				};
+			} else {
+				break;
+			};
+		};
+
+		if (e != entries) {
+			break;
+		};
+	};
+
+	if (result != 0) {
+		fprintf(stderr, "Checkpoint file is truncated or corrupt: %s\n", name);
+	};
+
+END_checkpoint_merge:
+	fclose(input);
+	return (result);
+};
+
+
+/*
+ * Prefix aggregation
+ *  exact mode : open addressing hash table (linear probing) with bounded amount of entries
+ *  sketch mode: (in case of exact table is full) Count-Min sketch with heavy hitter list,
+ *               heavy hitter list is stored in a small hash table, counters are estimations
+ */
+static uint64_t prefix_hash(const uint8_t proto, const uint64_t prefix, const uint64_t seed) {
+	uint64_t h = prefix ^ ((uint64_t) proto << 56) ^ seed;
+
+	/* 64-bit finalizer (MurmurHash3) */
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+
+	return (h);
+};
+
+
+/*
+ * Allocate prefix table
+ *  size: power of 2 >= 2 * entries
+ * ret: 0 = ok, 1 = error
+ */
+static int prefix_table_alloc(const uint32_t entries) {
+	uint32_t size = 64;
+
+	while (size < entries * 2) {
+		size <<= 1;
+	};
+
+	prefix_table = calloc(size, sizeof(prefix_entry));
+	if (prefix_table == NULL) {
+		fprintf(stderr, "Can't allocate memory for prefix table (%u entries)\n", size);
+		return (1);
+	};
+
+	prefix_table_mask = size - 1;
+	prefix_table_used = 0;
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Allocated prefix table: size=%u", size);
+
+	return (0);
+};
+
+
+/*
+ * Find slot of prefix in table (existing or free)
+ */
+static uint32_t prefix_table_slot(const uint8_t proto, const uint64_t prefix) {
+	uint32_t slot = (uint32_t) prefix_hash(proto, prefix, 0) & prefix_table_mask;
+
+	while ((prefix_table[slot].proto != 0) && ((prefix_table[slot].proto != proto) || (prefix_table[slot].prefix != prefix))) {
+		slot = (slot + 1) & prefix_table_mask;
+	};
+
+	return (slot);
+};
+
+
+/*
+ * Delete entry from table (backward shift deletion, keeps probe chains intact)
+ */
+static void prefix_table_delete(uint32_t slot) {
+	uint32_t next, home;
+
+	while (1 == 1) {
+		prefix_table[slot].proto = 0;
+
+		next = slot;
+		while (1 == 1) {
+			next = (next + 1) & prefix_table_mask;
+			if (prefix_table[next].proto == 0) {
+				prefix_table_used--;
+				return;
+			};
+
+			home = (uint32_t) prefix_hash(prefix_table[next].proto, prefix_table[next].prefix, 0) & prefix_table_mask;
+
+			/* move entry if its home slot is not located cyclically in (slot, next] */
+			if (((next - home) & prefix_table_mask) >= ((next - slot) & prefix_table_mask)) {
+				break;
+			};
+		};
+
+		prefix_table[slot] = prefix_table[next];
+		slot = next;
+	};
+};
+
+
+/*
+ * Compare function for sorting prefix entries (proto, count descending)
+ */
+static int prefix_entry_compare(const void *a, const void *b) {
+	const prefix_entry *pa = (const prefix_entry *) a;
+	const prefix_entry *pb = (const prefix_entry *) b;
+
+	/* free entries at the end */
+	if ((pa->proto == 0) || (pb->proto == 0)) {
+		return ((pa->proto == pb->proto) ? 0 : ((pa->proto == 0) ? 1 : -1));
+	};
+
+	if (pa->proto != pb->proto) {
+		return ((int) pa->proto - (int) pb->proto);
+	};
+
+	if (pa->count > pb->count) {
+		return (-1);
+	} else if (pa->count < pb->count) {
+		return (1);
+	} else if (pa->prefix < pb->prefix) {
+		return (-1);
+	} else if (pa->prefix > pb->prefix) {
+		return (1);
+	};
+
+	return (0);
+};
+
+
+/*
+ * Count-Min sketch: add count to counter (saturating)
+ */
+static void prefix_sketch_counter_add(uint32_t *counter, const long unsigned int count) {
+	if ((count < UINT32_MAX) && (*counter < UINT32_MAX - (uint32_t) count)) {
+		*counter += (uint32_t) count;
+	} else {
+		*counter = UINT32_MAX;
+	};
+};
+
+
+/*
+ * Count-Min sketch: counter of prefix in row
+ */
+static uint32_t *prefix_sketch_counter(const uint8_t proto, const uint64_t prefix, const int row) {
+	return (&prefix_sketch[row * PREFIX_SKETCH_WIDTH + (prefix_hash(proto, prefix, (uint64_t) (row + 1) * 0x9e3779b97f4a7c15ULL) & (PREFIX_SKETCH_WIDTH - 1))]);
+};
+
+
+/*
+ * Count-Min sketch: return estimation (minimum of counters)
+ */
+static long unsigned int prefix_sketch_estimate(const uint8_t proto, const uint64_t prefix) {
+	long unsigned int estimation = 0;
+	uint32_t *counter;
+	int row;
+
+	for (row = 0; row < PREFIX_SKETCH_DEPTH; row++) {
+		counter = prefix_sketch_counter(proto, prefix, row);
+
+		if ((row == 0) || (*counter < estimation)) {
+			estimation = *counter;
+		};
+	};
+
+	return (estimation);
+};
+
+
+/*
+ * Count-Min sketch: add count and return estimation
+ */
+static long unsigned int prefix_sketch_add(const uint8_t proto, const uint64_t prefix, const long unsigned int count) {
+	int row;
+
+	for (row = 0; row < PREFIX_SKETCH_DEPTH; row++) {
+		prefix_sketch_counter_add(prefix_sketch_counter(proto, prefix, row), count);
+	};
+
+	return (prefix_sketch_estimate(proto, prefix));
+};
+
+
+/*
+ * Switch from exact mode to sketch mode
+ *  all counters are added to sketch, heavy hitter list is filled with top entries
+ * ret: 0 = ok, 1 = error
+ */
+static int prefix_switch_to_sketch(void) {
+	prefix_entry *table_exact = prefix_table;
+	uint32_t i, size = prefix_table_mask + 1, slot;
+
+	prefix_sketch = calloc(PREFIX_SKETCH_DEPTH * PREFIX_SKETCH_WIDTH, sizeof(uint32_t));
+	if (prefix_sketch == NULL) {
+		fprintf(stderr, "Can't allocate memory for prefix sketch\n");
+		return (1);
+	};
+
+	for (i = 0; i < size; i++) {
+		if (table_exact[i].proto != 0) {
+			prefix_sketch_add(table_exact[i].proto, table_exact[i].prefix, table_exact[i].count);
+		};
+	};
+
+	/* keep top entries as heavy hitters */
+	qsort(table_exact, size, sizeof(prefix_entry), prefix_entry_compare);
+
+	if (prefix_table_alloc(prefix_hh_max) != 0) {
+		return (1);
+	};
+
+	for (i = 0; (i < size) && (i < prefix_hh_max) && (table_exact[i].proto != 0); i++) {
+		slot = prefix_table_slot(table_exact[i].proto, table_exact[i].prefix);
+		prefix_table[slot] = table_exact[i];
+		prefix_table_used++;
+	};
+
+	prefix_hh_min = (i > 0) ? table_exact[i - 1].count : 0;
+
+	free(table_exact);
+
+	prefix_mode_sketch = 1;
+	prefix_estimated = 1;
+
+	return (0);
+};
+
+
+/*
+ * Enable sketch mode (merge of checkpoint containing a sketch)
+ * ret: 0 = ok, 1 = error
+ */
+static int prefix_sketch_enable(void) {
+	if (prefix_table == NULL) {
+		if (prefix_table_alloc(prefix_entries_max) != 0) {
+			return (1);
+		};
+	};
+
+	if (prefix_mode_sketch == 0) {
+		DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Switch to sketch mode for merge, exact entries: %u", prefix_table_used);
+		return (prefix_switch_to_sketch());
+	};
+
+	return (0);
+};
+
+
+/*
+ * Update heavy hitter list with estimation of prefix (sketch mode)
+ *  entry with minimum counter is replaced in case list is full
+ */
+static void prefix_hh_update(const uint8_t proto, const uint64_t prefix, const long unsigned int estimation) {
+	long unsigned int min;
+	uint32_t slot, slot_min = 0, i;
+
+	slot = prefix_table_slot(proto, prefix);
+
+	if (prefix_table[slot].proto != 0) {
+		/* already heavy hitter */
+		prefix_table[slot].count = estimation;
+		return;
+	};
+
+	if (prefix_table_used >= prefix_hh_max) {
+		if (estimation <= prefix_hh_min) {
+			/* below (lower bound of) minimum */
+			return;
+		};
+
+		/* search current minimum */
+		min = ULONG_MAX;
+		for (i = 0; i <= prefix_table_mask; i++) {
+			if ((prefix_table[i].proto != 0) && (prefix_table[i].count < min)) {
+				min = prefix_table[i].count;
+				slot_min = i;
+			};
+		};
+
+		if (estimation <= min) {
+			prefix_hh_min = min;
+			return;
+		};
+
+		prefix_table_delete(slot_min);
+
+		/* lower bound of new minimum */
+		prefix_hh_min = min;
+
+		slot = prefix_table_slot(proto, prefix);
+	};
+
+	prefix_table[slot].proto = proto;
+	prefix_table[slot].prefix = prefix;
+	prefix_table[slot].count = estimation;
+	prefix_table_used++;
+};
+
+
+/*
+ * Re-estimate counters of heavy hitter list from (merged) sketch
+ */
+static void prefix_hh_estimate(void) {
+	uint32_t i;
+
+	for (i = 0; i <= prefix_table_mask; i++) {
+		if (prefix_table[i].proto != 0) {
+			prefix_table[i].count = prefix_sketch_estimate(prefix_table[i].proto, prefix_table[i].prefix);
+		};
+	};
+};
+
+
+/*
+ * Add count for prefix
+ * in : proto, prefix (masked), count
+ * ret: 0 = ok, 1 = error
+ */
+static int prefix_add(const uint8_t proto, const uint64_t prefix, const long unsigned int count) {
+	uint32_t slot;
+
+	if (prefix_table == NULL) {
+		if (prefix_table_alloc(prefix_entries_max) != 0) {
+			return (1);
+		};
+	};
+
+	if (prefix_mode_sketch == 0) {
+		/* exact mode */
+		slot = prefix_table_slot(proto, prefix);
+
+		if (prefix_table[slot].proto != 0) {
+			prefix_table[slot].count += count;
+			return (0);
+		};
+
+		if (prefix_table_used < prefix_entries_max) {
+			prefix_table[slot].proto = proto;
+			prefix_table[slot].prefix = prefix;
+			prefix_table[slot].count = count;
+			prefix_table_used++;
+			return (0);
+		};
+
+		if (prefix_switch_to_sketch() != 0) {
+			return (1);
+		};
+
+		if (ipv6calc_quiet == 0) {
+			fprintf(stderr, "Prefix table limit reached (%u entries), switch to Count-Min sketch with heavy hitter list (%u entries)\n", prefix_entries_max, prefix_hh_max);
+		};
+	};
+
+	/* sketch mode */
+	prefix_hh_update(proto, prefix, prefix_sketch_add(proto, prefix, count));
+
+	return (0);
+};
+
+
+/*
+ * Add address to prefix aggregation
+ */
+static void prefix_add_addr(const uint32_t inputtype, const ipv6calc_ipv6addr *ipv6addrp, const ipv6calc_ipv4addr *ipv4addrp) {
+	uint64_t prefix;
+	int result;
+
+	if (inputtype == FORMAT_ipv4addr) {
+		prefix = ipv4addr_getdword(ipv4addrp) & (uint32_t) (0xffffffffUL << (32 - opt_prefix_length_ipv4));
+		result = prefix_add(IPV6CALC_PROTO_IPV4, prefix, 1);
+	} else {
+		prefix = (((uint64_t) ipv6addr_getdword(ipv6addrp, 0)) << 32) | ipv6addr_getdword(ipv6addrp, 1);
+		prefix &= (uint64_t) (0xffffffffffffffffULL << (64 - opt_prefix_length_ipv6));
+		result = prefix_add(IPV6CALC_PROTO_IPV6, prefix, 1);
+	};
+
+	if (result != 0) {
+		exit(EXIT_FAILURE);
+	};
+};
+
+
+/*
+ * Print top prefixes per protocol with CountryCode and ASN (lookup only for printed prefixes)
+ */
+static void print_prefix_top(void) {
+	char resultstring[IPV6CALC_STRING_MAX];
+	char cc_text[IPV6CALC_STRING_MAX];
+	char as_text[IPV6CALC_STRING_MAX];
+	ipv6calc_ipaddr ipaddr;
+	uint32_t i, size;
+	int rank_ipv4 = 0, rank_ipv6 = 0, *rank_p;
+
+	if (prefix_table == NULL) {
+		return;
+	};
+
+	size = prefix_table_mask + 1;
+
+	if (prefix_mode_sketch == 1) {
+		prefix_hh_estimate();
+	};
+
+	qsort(prefix_table, size, sizeof(prefix_entry), prefix_entry_compare);
+
+	printf("*3*Prefix-Info: IPv4/%d IPv6/%d mode=%s\n", opt_prefix_length_ipv4, opt_prefix_length_ipv6, (prefix_estimated == 1) ? "estimated" : "exact");
+
+	for (i = 0; (i < size) && (prefix_table[i].proto != 0); i++) {
+		rank_p = (prefix_table[i].proto == IPV6CALC_PROTO_IPV4) ? &rank_ipv4 : &rank_ipv6;
+
+		if (*rank_p >= opt_prefix_top) {
+			continue;
+		};
+
+		(*rank_p)++;
+
+		libipaddr_clearall(&ipaddr);
+		ipaddr.proto = prefix_table[i].proto;
+		ipaddr.flag_valid = 1;
+		ipaddr.flag_prefixuse = 1;
+
+		if (prefix_table[i].proto == IPV6CALC_PROTO_IPV4) {
+			ipaddr.addr[0] = (uint32_t) prefix_table[i].prefix;
+			ipaddr.prefixlength = opt_prefix_length_ipv4;
+		} else {
+			ipaddr.addr[0] = (uint32_t) (prefix_table[i].prefix >> 32);
+			ipaddr.addr[1] = (uint32_t) (prefix_table[i].prefix & 0xffffffffUL);
+			ipaddr.prefixlength = opt_prefix_length_ipv6;
+		};
+
+		libipaddr_ipaddrstruct_to_string(&ipaddr, resultstring, sizeof(resultstring), FORMATOPTION_printprefix);
+
+		snprintf(cc_text, sizeof(cc_text), "-");
+		if (feature_cc == 1) {
+			libipv6calc_db_wrapper_country_code_by_cc_index(cc_text, sizeof(cc_text), libipv6calc_db_wrapper_cc_index_by_addr(&ipaddr, NULL));
+		};
+
+		snprintf(as_text, sizeof(as_text), "-");
+		if (feature_as == 1) {
+			snprintf(as_text, sizeof(as_text), "%u", libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, NULL, NULL, 0));
+		};
+
+		printf("*3*Prefix-top/%s/%d  %s %lu %s %s\n", (prefix_table[i].proto == IPV6CALC_PROTO_IPV4) ? "IPv4" : "IPv6", *rank_p, resultstring, prefix_table[i].count, cc_text, as_text);
+	};
 };
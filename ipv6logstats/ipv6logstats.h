@@ -15,6 +15,9 @@
 #define STATS_VERSION_MAJOR	4
 #define STATS_VERSION_MINOR	0
 
+/* entries of memo table for IID random detection */
+#define IID_RANDOM_CACHE_ENTRIES	4096
+
 #define STATS_ALL		0x00
 #define STATS_IPV4		0x01
 #define STATS_IPV6		0x02
@@ -51,6 +54,63 @@
 #define STATS_IPV6_IID_ISATAP		0x103
 #define STATS_IPV6_IID_UNKNOWN		0x10f
 
+/* binary checkpoint (all numbers little endian)
+ *  header : magic (8 bytes), STATS_VERSION_MAJOR (u16), STATS_VERSION_MINOR (u16), CHECKPOINT_FORMAT (u16), flags (u16)
+ *  section: tag (u32), entries (u32), entry size (u32), entries...
+ *  unknown sections are skipped, list of sections is terminated by tag CHECKPOINT_SECTION_END
+ */
+#define CHECKPOINT_MAGIC		"IP6LSCP"
+#define CHECKPOINT_FORMAT		1
+
+#define CHECKPOINT_FLAG_CC		0x0001	// CountryCode statistics available
+#define CHECKPOINT_FLAG_AS		0x0002	// ASN statistics available
+#define CHECKPOINT_FLAG_PREFIX_ESTIMATED	0x0004	// prefix counters are estimations (sketch mode)
+
+#define CHECKPOINT_SECTION_END		0
+#define CHECKPOINT_SECTION_STAT		1	// statistic number (u32), counter (u64)
+#define CHECKPOINT_SECTION_CC_SUM	2	// counters ALL/IPv4/IPv6 (u64)
+#define CHECKPOINT_SECTION_CC		3	// CC index (u32), counters ALL/IPv4/IPv6 (u64)
+#define CHECKPOINT_SECTION_ASN		4	// ASN (u32), counters ALL/IPv4/IPv6 (u64)
+#define CHECKPOINT_SECTION_PREFIX	5	// proto (u8), prefix length (u8), reserved (u16), prefix (u64), counter (u64)
+#define CHECKPOINT_SECTION_PREFIX_SKETCH	6	// Count-Min sketch counter (u32), PREFIX_SKETCH_DEPTH rows of PREFIX_SKETCH_WIDTH (sketch mode, before section PREFIX)
+
+/* prefix aggregation */
+#define PREFIX_LENGTH_IPV4_DEFAULT	24
+#define PREFIX_LENGTH_IPV6_DEFAULT	48
+#define PREFIX_ENTRIES_DEFAULT		262144	// maximum entries of exact prefix table
+#define PREFIX_HH_MIN			64	// minimum entries of heavy hitter list (sketch mode)
+#define PREFIX_SKETCH_DEPTH		4	// Count-Min sketch rows
+#define PREFIX_SKETCH_WIDTH		65536	// Count-Min sketch counters per row (power of 2)
+
+/* packet capture input */
+#define PCAP_ADDRESS_SRC		0x1
+#define PCAP_ADDRESS_DST		0x2
+#define PCAP_ADDRESS_BOTH		(PCAP_ADDRESS_SRC | PCAP_ADDRESS_DST)
+
+#define PCAP_MAGIC_USEC			0xa1b2c3d4
+#define PCAP_MAGIC_NSEC			0xa1b23c4d
+#define PCAP_MAGIC_USEC_SWAPPED		0xd4c3b2a1
+#define PCAP_MAGIC_NSEC_SWAPPED		0x4d3cb2a1
+
+#define PCAPNG_BLOCK_SHB		0x0a0d0d0a	// Section Header Block
+#define PCAPNG_BLOCK_IDB		0x00000001	// Interface Description Block
+#define PCAPNG_BLOCK_PB			0x00000002	// Packet Block (obsolete)
+#define PCAPNG_BLOCK_SPB		0x00000003	// Simple Packet Block
+#define PCAPNG_BLOCK_EPB		0x00000006	// Enhanced Packet Block
+#define PCAPNG_BYTE_ORDER_MAGIC		0x1a2b3c4d
+#define PCAPNG_INTERFACES_MAX		256
+
+#define PCAP_LINKTYPE_NULL		0
+#define PCAP_LINKTYPE_ETHERNET		1
+#define PCAP_LINKTYPE_RAW_12		12
+#define PCAP_LINKTYPE_RAW_14		14
+#define PCAP_LINKTYPE_RAW		101
+#define PCAP_LINKTYPE_LOOP		108
+#define PCAP_LINKTYPE_LINUX_SLL		113
+#define PCAP_LINKTYPE_IPV4		228
+#define PCAP_LINKTYPE_IPV6		229
+#define PCAP_LINKTYPE_LINUX_SLL2	276
+
 #define DEBUG_ipv6logstats_general	0x00000001l
 #define DEBUG_ipv6logstats_summary	0x00000002l
 #define DEBUG_ipv6logstats_processing	0x00000004l
@@ -58,7 +118,6 @@
 /* labels statistic numbers */
 typedef struct {
 	const int	number;
-	long unsigned int counter;
 	const char *token;
 } stat_entries;
 
@@ -74,6 +74,13 @@ void ipv6logstats_printhelp(void) {
 
 	fprintf(stderr, " Takes web server log data (or any other data which has IPv4/v6 address in first column)\n");
 	fprintf(stderr, "   from stdin and print statistics table/list (depending on option) to stdout\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, " %s [<options>] [<file>|<directory>|'<pattern>' ...]\n", PROGRAM_NAME);
+	fprintf(stderr, "   reads given files instead of stdin (directory: all regular files inside), prints\n");
+	fprintf(stderr, "   statistics per file (file name as token) and in case of more than one file the total\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, " %s [<options>] --merge <checkpoint file>|<directory>|'<pattern>' ...\n", PROGRAM_NAME);
+	fprintf(stderr, "   merges checkpoint files (created by option --checkpoint) and prints statistics\n");
 
 	printhelp_common(IPV6CALC_HELP_ALL);
 
@@ -84,8 +91,26 @@ void ipv6logstats_printhelp(void) {
 	fprintf(stderr, "  [-o|--onlyheader]          : print only header in columns mode (1)\n");
 	fprintf(stderr, "  [-p|--prefix <token>]      : print token as prefix (1)\n");
 	fprintf(stderr, "  [-s|--simple]              : disable extended statistic (CountryCode/ASN)\n");
+	fprintf(stderr, "  [-j|--jobs <num>]          : proceed given files with <num> parallel jobs\n");
+	fprintf(stderr, "                                (no DB-Used information in output)\n");
+	fprintf(stderr, "  [--window <time>[s|m|h|d]] : streaming mode (stdin only), print statistics of\n");
+	fprintf(stderr, "                                each completed time window (token: window start)\n");
+	fprintf(stderr, "  [--window-column <num>]    : column containing timestamp (default: 0 = wall clock)\n");
+	fprintf(stderr, "                                supported: [dd/Mon/yyyy:HH:MM:SS +zzzz] (Apache/nginx),\n");
+	fprintf(stderr, "                                ISO 8601, UNIX time\n");
+	fprintf(stderr, "  [--checkpoint <file>]      : store (total) counters in binary checkpoint file\n");
+	fprintf(stderr, "  [--merge]                  : arguments are checkpoint files, print statistics of\n");
+	fprintf(stderr, "                                merged counters\n");
+	fprintf(stderr, "  [--prefix-top <num>]       : print top <num> client prefixes per protocol with\n");
+	fprintf(stderr, "                                CountryCode and ASN (2)\n");
+	fprintf(stderr, "  [--prefix-length <IPv4>,<IPv6>] : prefix length for aggregation (default: %d,%d)\n", PREFIX_LENGTH_IPV4_DEFAULT, PREFIX_LENGTH_IPV6_DEFAULT);
+	fprintf(stderr, "  [--prefix-entries <num>]   : maximum prefixes counted exact (default: %d), on more\n", PREFIX_ENTRIES_DEFAULT);
+	fprintf(stderr, "                                prefixes a Count-Min sketch is used (estimations)\n");
+	fprintf(stderr, "  [--pcap-address src|dst|both] : addresses taken from packet capture input files\n");
+	fprintf(stderr, "                                (pcap/pcapng, autodetected), default: src\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, " (1) unsupported for CountryCode & ASN statistics\n");
+	fprintf(stderr, " (2) only supported in row mode\n");
 	fprintf(stderr, "\n");
 
 	return;
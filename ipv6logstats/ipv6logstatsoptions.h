@@ -11,6 +11,7 @@
 #include <getopt.h> 
 
 #include "ipv6calctypes.h"
+#include "ipv6calccommands.h"
 
 
 #ifndef _ipv6logstatsoptions_h_
@@ -20,7 +21,7 @@
 /* Options */
 
 /* define short options */
-static char *ipv6logstats_shortopts = "vh?uNosncp:w:";
+static char *ipv6logstats_shortopts = "vh?uNosncp:w:j:";
 
 /* define long options */
 static struct option ipv6logstats_longopts[] = {
@@ -38,6 +39,15 @@ static struct option ipv6logstats_longopts[] = {
 	{"simple"	, 0, 0, (int) 's'},
 	{"write"	, 1, 0, (int) 'O'},
 	{"column-numbers", 1, 0, (int) 'N'},
+	{"jobs"		, 1, 0, (int) 'j'},
+	{"window"	, 1, 0, CMD_stats_window},
+	{"window-column", 1, 0, CMD_stats_window_column},
+	{"checkpoint"	, 1, 0, CMD_stats_checkpoint},
+	{"merge"	, 0, 0, CMD_stats_merge},
+	{"prefix-top"	, 1, 0, CMD_stats_prefix_top},
+	{"prefix-length", 1, 0, CMD_stats_prefix_length},
+	{"prefix-entries", 1, 0, CMD_stats_prefix_entries},
+	{"pcap-address"	, 1, 0, CMD_stats_pcap_address},
 };                
 
 #endif
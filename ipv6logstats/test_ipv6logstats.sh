@@ -236,6 +236,156 @@ testscenarios_match | while read ip match; do
 done || exit 1
 echo "INFO  : $test successful"
 
+test="run 'ipv6logstats' multi-file test"
+echo "INFO  : $test"
+tmpdir=$(mktemp -d /tmp/test_ipv6logstats.XXXXXX)
+testscenarios > $tmpdir/file1
+testscenarios | head -3 > $tmpdir/file2
+result_stdin="$(cat $tmpdir/file1 $tmpdir/file2 | ./ipv6logstats -q -c -n 2>/dev/null)"
+for jobs in 1 2; do
+	result="$(./ipv6logstats -q -c -n -j $jobs $tmpdir 2>/dev/null)"
+	if [ $? -ne 0 ]; then
+		echo "ERROR : exit code != 0"
+		rm -rf $tmpdir
+		exit 1
+	fi
+	if [ "$(echo "$result" | wc -l)" -ne 3 -o "$(echo "$result" | tail -1)" != "TOTAL $result_stdin" ]; then
+		echo "ERROR : unexpected result (jobs=$jobs)"
+		echo "$result"
+		echo "TOTAL $result_stdin"
+		rm -rf $tmpdir
+		exit 1
+	fi
+done
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' checkpoint/merge test"
+echo "INFO  : $test"
+for file in file1 file2; do
+	./ipv6logstats -q -c -n --checkpoint $tmpdir/$file.checkpoint $tmpdir/$file >/dev/null 2>/dev/null
+	if [ $? -ne 0 ]; then
+		echo "ERROR : exit code != 0 (checkpoint of $file)"
+		rm -rf $tmpdir
+		exit 1
+	fi
+done
+result="$(./ipv6logstats -q -c -n --merge "$tmpdir/*.checkpoint" 2>/dev/null)"
+if [ $? -ne 0 -o "$result" != "$result_stdin" ]; then
+	echo "ERROR : unexpected result"
+	echo "$result"
+	echo "$result_stdin"
+	rm -rf $tmpdir
+	exit 1
+fi
+rm -rf $tmpdir
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' streaming window test"
+echo "INFO  : $test"
+result="$(cat <<END | ./ipv6logstats -q -c -n --window 1m --window-column 4 2>/dev/null
+2001:db8::1 - - [10/Oct/2026:13:55:36 +0200] "GET / HTTP/1.1" 200 1
+192.0.2.1 - - [10/Oct/2026:13:55:59 +0200] "GET / HTTP/1.1" 200 1
+2001:db8::2 - - [10/Oct/2026:13:56:30 +0200] "GET / HTTP/1.1" 200 1
+192.0.2.2 - - 2026-10-10T11:56:59Z "GET / HTTP/1.1" 200 1
+192.0.2.3 - - 1791633480 "GET / HTTP/1.1" 200 1
+END
+)"
+if [ $? -ne 0 ]; then
+	echo "ERROR : exit code != 0"
+	exit 1
+fi
+if [ "$(echo "$result" | awk '{ print $1, $2, $3, $4 }' | tr '\n' ';')" != "2026-10-10T11:55:00Z 2 1 1;2026-10-10T11:56:00Z 2 1 1;2026-10-10T11:58:00Z 1 1 0;" ]; then
+	echo "ERROR : unexpected result"
+	echo "$result"
+	exit 1
+fi
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' prefix aggregation test"
+echo "INFO  : $test"
+# exact mode and sketch mode (counters are estimations, only top prefixes are checked)
+for entries in 262144 64; do
+	result="$( (for i in $(seq 1 50); do echo "192.0.2.$[ $i % 4 ]"; echo "2001:db8:1:$i::1"; done; echo "2001:db8:2::1"; testscenario_hugelist ipv4) | ./ipv6logstats -q --prefix-top 2 --prefix-length 24,48 --prefix-entries $entries 2>/dev/null | grep '^\*3\*Prefix-top/' | awk '{ print $1, $2, $3 }' | tr '\n' ';')"
+	if [ $entries -eq 64 ]; then
+		match="^\*3\*Prefix-top/IPv4/1 192.0.2.0/24 [0-9]*;.*\*3\*Prefix-top/IPv6/1 2001:db8:1::/48 [0-9]*;"
+	else
+		match="^\*3\*Prefix-top/IPv4/1 192.0.2.0/24 50;.*\*3\*Prefix-top/IPv6/1 2001:db8:1::/48 50;\*3\*Prefix-top/IPv6/2 2001:db8:2::/48 1;$"
+	fi
+	if ! echo "$result" | grep -q "$match"; then
+		echo "ERROR : unexpected result (entries=$entries)"
+		echo "$result"
+		exit 1
+	fi
+done
+# merge of checkpoints in sketch mode: prefix not in heavy hitter list of 2nd checkpoint is counted by merged sketch
+tmpdir=$(mktemp -d /tmp/test_ipv6logstats.XXXXXX)
+(for i in $(seq 1 50); do echo "192.0.2.1"; done; for i in $(seq 1 100); do echo "10.0.$i.1"; done) >$tmpdir/file1
+(for i in $(seq 1 20); do echo "192.0.2.1"; done; for j in $(seq 1 30); do for i in $(seq 1 100); do echo "10.1.$i.1"; done; done) >$tmpdir/file2
+for file in file1 file2; do
+	./ipv6logstats -q --prefix-top 1 --prefix-entries 64 --checkpoint $tmpdir/$file.checkpoint <$tmpdir/$file >/dev/null 2>/dev/null
+	if [ $? -ne 0 ]; then
+		echo "ERROR : exit code != 0 (checkpoint of $file)"
+		rm -rf $tmpdir
+		exit 1
+	fi
+done
+result="$(./ipv6logstats -q --prefix-top 1 --prefix-entries 64 --merge "$tmpdir/*.checkpoint" 2>/dev/null | grep '^\*3\*Prefix-top/IPv4/' | awk '{ print $1, $2, $3 }')"
+rm -rf $tmpdir
+if [ "$result" != "*3*Prefix-top/IPv4/1 192.0.2.0/24 70" ]; then
+	echo "ERROR : unexpected result (merge of sketch checkpoints)"
+	echo "$result"
+	exit 1
+fi
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' packet capture test"
+echo "INFO  : $test"
+# write bytes given in hex
+hex2bin() {
+	for b in $*; do
+		printf "\\$(printf '%03o' 0x$b)"
+	done
+}
+zero() {
+	for i in $(seq 1 $1); do echo -n "00 "; done
+}
+ipv4="45 00 00 14 $(zero 4) 40 11 00 00 c0 00 02 01 c6 33 64 01"
+ipv6="60 00 00 00 00 00 3b 40 20 01 0d b8 $(zero 11) 01 2a 01 $(zero 13) 01"
+tmpdir=$(mktemp -d /tmp/test_ipv6logstats.XXXXXX)
+# pcap (Ethernet): IPv4, IPv6 with VLAN tag, ARP
+hex2bin "d4 c3 b2 a1 02 00 04 00 $(zero 8) ff ff 00 00 01 00 00 00" >$tmpdir/test.pcap
+hex2bin "$(zero 8) 22 00 00 00 22 00 00 00 $(zero 12) 08 00 $ipv4" >>$tmpdir/test.pcap
+hex2bin "$(zero 8) 3a 00 00 00 3a 00 00 00 $(zero 12) 81 00 00 01 86 dd $ipv6" >>$tmpdir/test.pcap
+hex2bin "$(zero 8) 2a 00 00 00 2a 00 00 00 $(zero 12) 08 06 $(zero 28)" >>$tmpdir/test.pcap
+# pcapng (raw IP): IPv4, IPv6
+hex2bin "0a 0d 0d 0a 1c 00 00 00 4d 3c 2b 1a 01 00 00 00 ff ff ff ff ff ff ff ff 1c 00 00 00" >$tmpdir/test.pcapng
+hex2bin "01 00 00 00 14 00 00 00 65 00 00 00 00 00 04 00 14 00 00 00" >>$tmpdir/test.pcapng
+hex2bin "06 00 00 00 34 00 00 00 $(zero 12) 14 00 00 00 14 00 00 00 $ipv4 34 00 00 00" >>$tmpdir/test.pcapng
+hex2bin "06 00 00 00 48 00 00 00 $(zero 12) 28 00 00 00 28 00 00 00 $ipv6 48 00 00 00" >>$tmpdir/test.pcapng
+for entry in "src|192.0.2.1 2001:db8::1 ARP" "dst|198.51.100.1 2a01::1 ARP" "both|192.0.2.1 198.51.100.1 2001:db8::1 2a01::1 ARP"; do
+	address="${entry/|*}"
+	result_text="$(echo "${entry/*|}" | tr ' ' '\n' | ./ipv6logstats -q -c -n 2>/dev/null)"
+	result="$(./ipv6logstats -q -c -n --pcap-address $address $tmpdir/test.pcap 2>/dev/null | cut -d " " -f 2-)"
+	if [ $? -ne 0 -o "$result" != "$result_text" ]; then
+		echo "ERROR : unexpected result (pcap, $address)"
+		echo "$result"
+		echo "$result_text"
+		rm -rf $tmpdir
+		exit 1
+	fi
+	result_text="$(echo "${entry/*|}" | tr ' ' '\n' | grep -v ARP | ./ipv6logstats -q -c -n 2>/dev/null)"
+	result="$(./ipv6logstats -q -c -n --pcap-address $address $tmpdir/test.pcapng 2>/dev/null | cut -d " " -f 2-)"
+	if [ $? -ne 0 -o "$result" != "$result_text" ]; then
+		echo "ERROR : unexpected result (pcapng, $address)"
+		echo "$result"
+		echo "$result_text"
+		rm -rf $tmpdir
+		exit 1
+	fi
+done
+rm -rf $tmpdir
+echo "INFO  : $test successful"
+
 echo "INFO  : test scenario with huge amount of addresses..."
 if $verbose; then
 	testscenario_hugelist ipv4 | ./ipv6logstats -q >/dev/null
@@ -105,6 +105,7 @@
 #define DB_dbip2_comm_to_free_switch_min_delta_months		0x0027110
 #define DB_dbip2_only_type		0x0027120
 
+#define DB_common_reload_interval	0x002ffe0
 #define DB_common_priorization		0x002fff0
 
 
@@ -133,6 +134,30 @@
 #define CMD_test_lt			0x0050040	// less than
 #define CMD_test_le			0x0050050	// less equal
 
+/* pipe mode options */
+#define CMD_print_record_end		0x0060010	// print end marker after each record
+
+/* streaming statistics options (ipv6logstats) */
+#define CMD_stats_window		0x0070010	// window length
+#define CMD_stats_window_column		0x0070020	// column containing timestamp
+#define CMD_stats_checkpoint		0x0070030	// write binary checkpoint
+#define CMD_stats_merge			0x0070040	// merge binary checkpoints
+#define CMD_stats_prefix_top		0x0070050	// amount of top prefixes
+#define CMD_stats_prefix_length		0x0070060	// prefix length IPv4,IPv6
+#define CMD_stats_prefix_entries	0x0070070	// maximum entries of exact prefix table
+#define CMD_stats_pcap_address		0x0070080	// address selection of packet capture input
+
+/* log anonymization options (ipv6loganon) */
+#define CMD_loganon_all_addresses	0x0080010	// anonymize all addresses in line
+
+/* PTR generator options */
+#define CMD_ptr_range			0x0090010	// host range
+#define CMD_ptr_step			0x0090020	// host step
+#define CMD_ptr_template		0x0090030	// record template
+
+/* database dump options */
+#define CMD_db_dump_aggregate		0x00a0010	// merge ranges into minimal CIDR cover
+
 /* no operations (dummy) */
 #define OPTION_NOOP			0xfffffff
 
@@ -389,6 +389,7 @@ void printhelp_common(const uint32_t help_features) {
 			fprintf(stderr, " %s", data_sources[i].shortname);
 		};
 		fprintf(stderr, "\n");
+		fprintf(stderr, "  [--db-reload-interval <seconds>  ] : Check opened database files for change and reload (0=disabled, default, single-threaded only)\n");
 #endif
 	};
 
@@ -891,12 +892,39 @@ void printhelp_action_dispatcher(const uint32_t action, const int embedded) {
 
 		case ACTION_db_dump:
 			fprintf(stderr, "  Dump (supported) databases depending on selector\n");
-			fprintf(stderr, "   ipv6calc -A dbdump -E <FILTER> [--print-ipset <SETNAME>]\n");
+			fprintf(stderr, "   ipv6calc -A dbdump -E <FILTER> [--dump-aggregate] [--print-ipset <SETNAME>|--print-nftables [<FAMILY> <TABLE> ]<SETNAME>]\n");
 			fprintf(stderr, "\n");
 			fprintf(stderr, "  See '-O ipv4 -h' or '-O ipv6 -h' for optional output modifications\n");
 			fprintf(stderr, "  See '-E -h' for available filter\n");
+			fprintf(stderr, "  Use '--dump-aggregate' to merge adjacent/overlapping ranges into a minimal CIDR cover\n");
 			fprintf(stderr, "  Use '-q --print-ipset <SETNAME>' to generate 'ipset restore' compatible format\n");
-			fprintf(stderr, "  Supported and autoselected database: External (only so far)\n");
+			fprintf(stderr, "  Use '-q --print-nftables <SETNAME>' to generate 'nft -f' compatible interval sets\n");
+			fprintf(stderr, "   (default table: 'inet filter', implies '--dump-aggregate')\n");
+			fprintf(stderr, "  SETNAME containing '%%CC' creates one set per CountryCode in a single pass,\n");
+			fprintf(stderr, "   CountryCode filter is optional then, e.g.\n");
+			fprintf(stderr, "   ipv6calc -q -A dbdump -E ipv4 --print-nftables 'Net_%%CC_IPv4'\n");
+			fprintf(stderr, "   ipv6calc -q -A dbdump -E ipv4.db.cc=^unknown --dump-aggregate --print-ipset 'Net_%%CC_IPv4'\n");
+			fprintf(stderr, "  CountryCode and/or ASN filter (ASN only with GeoIP2/db-ip.com), e.g.\n");
+			fprintf(stderr, "   ipv6calc -q -A dbdump -E ipv6.db.asn=3320 --dump-aggregate\n");
+			fprintf(stderr, "  Supported databases: External, GeoIP2, db-ip.com (MaxMindDB search tree traversal)\n");
+			fprintf(stderr, "   autoselected by database priorization (see '--db-priorization')\n");
+			break;
+
+		case ACTION_ptr_generate:
+			fprintf(stderr, "  Generate reverse zone (PTR) records for a host range of a prefix\n");
+			fprintf(stderr, "   ipv6calc -A ptrgen --ptr-range <FIRST>-<LAST> [--ptr-step <STEP>] [--ptr-template <TEMPLATE>] [--uppercase] <PREFIX>\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, "  Host numbers (decimal or hex with 0x prefix) are added to the prefix\n");
+			fprintf(stderr, "  Template tokens (default: '%%r'), each record is terminated by newline:\n");
+			fprintf(stderr, "   %%r: reverse name (ip6.arpa. or in-addr.arpa.)\n");
+			fprintf(stderr, "   %%a: address (IPv6 compressed, slower than other tokens)\n");
+			fprintf(stderr, "   %%n: host number decimal\n");
+			fprintf(stderr, "   %%x: host number hexadecimal\n");
+			fprintf(stderr, "   %%%%: literal '%%'\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, " Examples:\n");
+			fprintf(stderr, "  ipv6calc -A ptrgen --ptr-range 1-0xffff --ptr-template '%%r IN PTR host-%%x.example.net.' 2001:db8:1::/48\n");
+			fprintf(stderr, "  ipv6calc -A ptrgen --ptr-range 1-254 --ptr-template '%%r IN PTR %%n.example.net.' 192.0.2.0/24\n");
 			break;
 	};
 };
@@ -62,6 +62,9 @@ void ipv6calc_debug_from_env(void) {
 		if (ipv6calc_debug_val != 0) {
 			ipv6calc_debug = ipv6calc_debug_val; // ipv6calc_debug usage ok
 			ERRORPRINT_WA("IPV6CALC_DEBUG proper parsed: %08lx", ipv6calc_debug); // ipv6calc_debug usage ok
+#ifdef DISABLE_DEBUG_TRACE
+			ERRORPRINT_NA("debug tracing is disabled at compile time (configure --disable-debug-trace), debug value has no effect on tracing");
+#endif
 		};
 	};
 };
@@ -221,6 +224,9 @@ int ipv6calcoptions_common_basic(const int opt, const char *optarg, const struct
 			DEBUGPRINT_WA(DEBUG_ipv6calcoptions, "Found debug option with value: %s", optarg);
 			ipv6calc_debug = parse_dec_hex_val(optarg);
 			ERRORPRINT_WA("given debug value: %lx", ipv6calc_debug);
+#ifdef DISABLE_DEBUG_TRACE
+			ERRORPRINT_NA("debug tracing is disabled at compile time (configure --disable-debug-trace), debug value has no effect on tracing");
+#endif
 			result = 0;
 			break;
 
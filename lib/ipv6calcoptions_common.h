@@ -155,6 +155,7 @@ static char *ipv6calc_shortopts_db_common = "";
 
 static struct option ipv6calc_longopts_db_common[] = {
 	{"db-priorization"             , 1, NULL, DB_common_priorization },
+	{"db-reload-interval"          , 1, NULL, DB_common_reload_interval },
 };
 #endif
 
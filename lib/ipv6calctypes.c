@@ -89,6 +89,7 @@ const s_action ipv6calc_actionstrings[] = {
 	{ ACTION_test                 , "test"            , "Test address against given prefix or address", "" },
 	{ ACTION_addr_to_countrycode  , "addr2cc"         , "Converts IPv4/IPv6 address into Country Code", "" },
 	{ ACTION_db_dump              , "dbdump"          , "Dump Database", "" },
+	{ ACTION_ptr_generate         , "ptrgen"          , "Generate reverse zone (PTR) records for a host range of a prefix", "" },
 };
 
 const int ipv6calc_actionstrings_entries = MAXENTRIES_ARRAY(ipv6calc_actionstrings);
@@ -161,6 +162,9 @@ const uint32_t ipv6calc_actionoptionmap[][3]  = {
 	{ ACTION_test			, CMD_test_ge, 1},
 	{ ACTION_test			, CMD_test_lt, 1},
 	{ ACTION_test			, CMD_test_le, 1},
+	{ ACTION_ptr_generate		, CMD_ptr_range, 0},
+	{ ACTION_ptr_generate		, CMD_ptr_step, 1},
+	{ ACTION_ptr_generate		, CMD_ptr_template, 1},
 };
 
 const int ipv6calc_actionoptionmap_entries = MAXENTRIES_ARRAY(ipv6calc_actionoptionmap);
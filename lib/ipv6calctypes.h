@@ -141,6 +141,8 @@ typedef struct {
 #define FORMATOPTION_NUM_mr_match_token		24	// 01000000
 #define FORMATOPTION_NUM_mr_quote_default	25	// 02000000 flag for controlling old quote behavior < 0.99.0
 #define FORMATOPTION_NUM_mr_match_token_suffix	26	// 04000000
+#define FORMATOPTION_NUM_mr_json		27	// 08000000 JSON Lines output
+#define FORMATOPTION_NUM_print_nftables		28	// 'nft -f' interval set format
 
 #define FORMATOPTION_NUM_print_ipset		29	// 'ipset' restore format
 #define FORMATOPTION_NUM_print_octal		30	// octal with separator
@@ -172,7 +174,9 @@ typedef struct {
 #define FORMATOPTION_mr_match_token		(uint32_t) (1 << FORMATOPTION_NUM_mr_match_token)
 #define FORMATOPTION_mr_quote_default		(uint32_t) (1 << FORMATOPTION_NUM_mr_quote_default) // flag for controlling old quote behavior < 0.99.0
 #define FORMATOPTION_mr_match_token_suffix	(uint32_t) (1 << FORMATOPTION_NUM_mr_match_token_suffix)
+#define FORMATOPTION_mr_json			(uint32_t) (1 << FORMATOPTION_NUM_mr_json)
 
+#define FORMATOPTION_print_nftables		(uint32_t) (1 << FORMATOPTION_NUM_print_nftables)
 #define FORMATOPTION_print_ipset		(uint32_t) (1 << FORMATOPTION_NUM_print_ipset)
 #define FORMATOPTION_print_octal		(uint32_t) (1 << FORMATOPTION_NUM_print_octal)
 #define FORMATOPTION_printembedded		(uint32_t) (1 << FORMATOPTION_NUM_printembedded)
@@ -200,6 +204,7 @@ typedef struct {
 #define ACTION_NUM_test			16
 #define ACTION_NUM_addr_to_countrycode	17
 #define ACTION_NUM_db_dump		18
+#define ACTION_NUM_ptr_generate		19
 #define ACTION_NUM_undefined		31
 
 #define ACTION_auto			(uint32_t) 0x0
@@ -217,6 +222,7 @@ typedef struct {
 #define ACTION_test			(uint32_t) (1 << ACTION_NUM_test)
 #define ACTION_addr_to_countrycode	(uint32_t) (1 << ACTION_NUM_addr_to_countrycode)
 #define ACTION_db_dump			(uint32_t) (1 << ACTION_NUM_db_dump)
+#define ACTION_ptr_generate		(uint32_t) (1 << ACTION_NUM_ptr_generate)
 #define ACTION_undefined		(uint32_t) (1 << ACTION_NUM_undefined)
 
 #define ANON_METHOD_ANONYMIZE		1
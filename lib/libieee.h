@@ -17,35 +17,35 @@
 
 #define _libieee_h
 
-/* Structure */
+/* Structure, strings are stored as offsets into the related libieee_*_strings pool */
 typedef struct {
 	const uint32_t id;
-	const char *string_owner;
-	const char *shortstring_owner;
+	const uint32_t string_owner_offset;
+	const uint32_t shortstring_owner_offset;
 } s_ieee_oui;
 
 typedef struct {
 	const uint32_t id;
 	const uint32_t subid_begin;
 	const uint32_t subid_end;
-	const char *string_owner;
-	const char *shortstring_owner;
+	const uint32_t string_owner_offset;
+	const uint32_t shortstring_owner_offset;
 } s_ieee_oui28;
 
 typedef struct {
 	const uint32_t id;
 	const uint32_t subid_begin;
 	const uint32_t subid_end;
-	const char *string_owner;
-	const char *shortstring_owner;
+	const uint32_t string_owner_offset;
+	const uint32_t shortstring_owner_offset;
 } s_ieee_oui36;
 
 typedef struct {
 	const uint32_t id;
 	const uint32_t subid_begin;
 	const uint32_t subid_end;
-	const char *string_owner;
-	const char *shortstring_owner;
+	const uint32_t string_owner_offset;
+	const uint32_t shortstring_owner_offset;
 } s_ieee_iab;
 
 typedef struct {
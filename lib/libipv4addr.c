@@ -10,6 +10,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <ctype.h>
 #include <regex.h>
@@ -22,6 +23,11 @@
 
 #include "libipv6calc_db_wrapper.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <emmintrin.h>
+#define LIBIPV4ADDR_PARSE_SSE2	1
+#endif
+
 /* regex cache */
 #define LIBIPV4ADDR_REGEX_CACHE_MAX	8
 #define LIBIPV4ADDR_REGEX_IPV4_OCTAL	0
@@ -29,6 +35,28 @@
 static regex_t libipv4addr_regex_cache_entry[LIBIPV4ADDR_REGEX_CACHE_MAX];
 static int     libipv4addr_regex_cache_valid[LIBIPV4ADDR_REGEX_CACHE_MAX];
 
+/* decimal text of octets, used by formatter */
+static const char libipv4addr_octet_string[256][4] = {
+	"0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "10", "11", "12", "13", "14", "15",
+	"16", "17", "18", "19", "20", "21", "22", "23", "24", "25", "26", "27", "28", "29", "30", "31",
+	"32", "33", "34", "35", "36", "37", "38", "39", "40", "41", "42", "43", "44", "45", "46", "47",
+	"48", "49", "50", "51", "52", "53", "54", "55", "56", "57", "58", "59", "60", "61", "62", "63",
+	"64", "65", "66", "67", "68", "69", "70", "71", "72", "73", "74", "75", "76", "77", "78", "79",
+	"80", "81", "82", "83", "84", "85", "86", "87", "88", "89", "90", "91", "92", "93", "94", "95",
+	"96", "97", "98", "99", "100", "101", "102", "103", "104", "105", "106", "107", "108", "109", "110", "111",
+	"112", "113", "114", "115", "116", "117", "118", "119", "120", "121", "122", "123", "124", "125", "126", "127",
+	"128", "129", "130", "131", "132", "133", "134", "135", "136", "137", "138", "139", "140", "141", "142", "143",
+	"144", "145", "146", "147", "148", "149", "150", "151", "152", "153", "154", "155", "156", "157", "158", "159",
+	"160", "161", "162", "163", "164", "165", "166", "167", "168", "169", "170", "171", "172", "173", "174", "175",
+	"176", "177", "178", "179", "180", "181", "182", "183", "184", "185", "186", "187", "188", "189", "190", "191",
+	"192", "193", "194", "195", "196", "197", "198", "199", "200", "201", "202", "203", "204", "205", "206", "207",
+	"208", "209", "210", "211", "212", "213", "214", "215", "216", "217", "218", "219", "220", "221", "222", "223",
+	"224", "225", "226", "227", "228", "229", "230", "231", "232", "233", "234", "235", "236", "237", "238", "239",
+	"240", "241", "242", "243", "244", "245", "246", "247", "248", "249", "250", "251", "252", "253", "254", "255",
+};
+
+#define LIBIPV4ADDR_OCTET_STRING_LEN(v)	(1 + ((v) >= 10) + ((v) >= 100))
+
 
 /* text representation */
 const s_type ipv6calc_ipv4addrtypestrings[] = {
@@ -261,8 +289,8 @@ void ipv4addr_copy(ipv6calc_ipv4addr *ipv4addrp_dst, const ipv6calc_ipv4addr *ip
  * returns: 0: addr1 equal with addr2 or covered by addr2/prefix (compare_flags == 1)
  */
 int ipv4addr_compare(const ipv6calc_ipv4addr *ipv4addrp1, const ipv6calc_ipv4addr *ipv4addrp2, const uint16_t compare_flags) {
-	uint32_t ipv4addr1 = ipv4addr_getdword(ipv4addrp1);
-	uint32_t ipv4addr2 = ipv4addr_getdword(ipv4addrp2);
+	uint32_t ipv4addr1 = ipv4addr_getdword_unchecked(ipv4addrp1);
+	uint32_t ipv4addr2 = ipv4addr_getdword_unchecked(ipv4addrp2);
 
 	DEBUGPRINT_WA(DEBUG_libipv4addr, "compare addr1 with addr2 0x%08x/%d 0x%08x/%d (compare flags: %08x)", ipv4addr1, ipv4addrp1->prefixlength, ipv4addr2, ipv4addrp2->prefixlength, compare_flags);
 
@@ -323,7 +351,7 @@ void ipv4addr_settype(ipv6calc_ipv4addr *ipv4addrp, int flag_reset) {
  */
 uint32_t ipv4addr_gettype(const ipv6calc_ipv4addr *ipv4addrp) {
 	uint32_t type = 0, c, p;
-	uint32_t ipv4 = ipv4addr_getdword(ipv4addrp);
+	uint32_t ipv4 = ipv4addr_getdword_unchecked(ipv4addrp);
 	int i;
 
 	DEBUGPRINT_WA(DEBUG_libipv4addr, "Got IPv4 address: 0x%08x", ipv4);
@@ -459,6 +487,170 @@ END_ipv4addr_gettype:
 };
 
 
+/*
+ * convert decimal octet (1-3 digits) without leading zero
+ *
+ * in : p = pointer to first digit
+ *      n = amount of digits (already validated to be 1-3 decimal digits)
+ * ret: value, >255 on error (incl. leading zero)
+ */
+static inline unsigned int libipv4addr_parse_octet(const char *p, const int n) {
+	switch (n) {
+	    case 1:
+		return (p[0] - '0');
+	    case 2:
+		if (p[0] == '0') {
+			return (256);
+		};
+		return ((p[0] - '0') * 10 + (p[1] - '0'));
+	    case 3:
+		if (p[0] == '0') {
+			return (256);
+		};
+		return ((p[0] - '0') * 100 + (p[1] - '0') * 10 + (p[2] - '0'));
+	    default:
+		return (256);
+	};
+};
+
+
+/*
+ * fast parser for plain dotted quad IPv4 address with optional prefix length (scalar)
+ *
+ * only canonical notation "a.b.c.d[/p]" without leading zeros is accepted,
+ * everything else (octal, shortened, leading zeros, errors) is left to the generic parser
+ *
+ * in : *addrstring = IPv4 address
+ * out: compat[0-3] = octets, compat[4] = prefix length
+ * out: *in_prefix_len = 1 if prefix length is given
+ * ret: ==1: parsed, ==0: not handled
+ */
+static int libipv4addr_parse_fast_scalar(const char *addrstring, unsigned int *compat, int *in_prefix_len) {
+	const char *p = addrstring;
+	int i, n;
+
+	for (i = 0; i < 4; i++) {
+		for (n = 0; n < 3 && p[n] >= '0' && p[n] <= '9'; n++);
+
+		compat[i] = libipv4addr_parse_octet(p, n);
+		if (compat[i] > 255) {
+			return (0);
+		};
+
+		p += n;
+
+		if (i < 3) {
+			if (*p != '.') {
+				return (0);
+			};
+			p++;
+		};
+	};
+
+	*in_prefix_len = 0;
+
+	if (*p == '/') {
+		p++;
+		for (n = 0; n < 2 && p[n] >= '0' && p[n] <= '9'; n++);
+
+		compat[4] = libipv4addr_parse_octet(p, n);
+		if (compat[4] > 32) {
+			return (0);
+		};
+
+		p += n;
+		*in_prefix_len = 1;
+	};
+
+	if (*p != '\0') {
+		return (0);
+	};
+
+	return (1);
+};
+
+
+#ifdef LIBIPV4ADDR_PARSE_SSE2
+/*
+ * fast parser for plain dotted quad IPv4 address (SSE2)
+ *
+ * classifies all chars in one 16 byte vector, octets are located by the dot mask
+ * input with prefix length or longer than 15 chars is handed to the scalar variant
+ *
+ * in/out/ret: see libipv4addr_parse_fast_scalar
+ */
+__attribute__((target("sse2")))
+static int libipv4addr_parse_fast_sse2(const char *addrstring, unsigned int *compat, int *in_prefix_len) {
+	__m128i v, digits;
+	unsigned int mask_valid, mask_dot, mask_digit, mask_nul;
+	int len, d0, d1, d2;
+
+	if (((uintptr_t) addrstring & 0xfff) > (0x1000 - 16)) {
+		/* 16 byte load would cross page boundary */
+		return (libipv4addr_parse_fast_scalar(addrstring, compat, in_prefix_len));
+	};
+
+	v = _mm_loadu_si128((const __m128i *) addrstring);
+
+	mask_nul = (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+	if (mask_nul == 0) {
+		return (libipv4addr_parse_fast_scalar(addrstring, compat, in_prefix_len));
+	};
+
+	len = __builtin_ctz(mask_nul);
+	mask_valid = (1u << len) - 1;
+
+	mask_dot = (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('.'))) & mask_valid;
+	digits = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+	mask_digit = (unsigned int) _mm_movemask_epi8(digits) & mask_valid;
+
+	if (((mask_dot | mask_digit) != mask_valid) || (__builtin_popcount(mask_dot) != 3)) {
+		/* other chars like '/' or amount of dots not matching */
+		return (libipv4addr_parse_fast_scalar(addrstring, compat, in_prefix_len));
+	};
+
+	d0 = __builtin_ctz(mask_dot);
+	mask_dot &= mask_dot - 1;
+	d1 = __builtin_ctz(mask_dot);
+	mask_dot &= mask_dot - 1;
+	d2 = __builtin_ctz(mask_dot);
+
+	compat[0] = libipv4addr_parse_octet(addrstring, d0);
+	compat[1] = libipv4addr_parse_octet(addrstring + d0 + 1, d1 - d0 - 1);
+	compat[2] = libipv4addr_parse_octet(addrstring + d1 + 1, d2 - d1 - 1);
+	compat[3] = libipv4addr_parse_octet(addrstring + d2 + 1, len - d2 - 1);
+
+	if ((compat[0] | compat[1] | compat[2] | compat[3]) > 255) {
+		return (0);
+	};
+
+	*in_prefix_len = 0;
+	return (1);
+};
+#endif
+
+
+static int libipv4addr_parse_fast_dispatch(const char *addrstring, unsigned int *compat, int *in_prefix_len);
+
+/* fast parser selected on first call by CPU features */
+static int (*libipv4addr_parse_fast)(const char *addrstring, unsigned int *compat, int *in_prefix_len) = libipv4addr_parse_fast_dispatch;
+
+static int libipv4addr_parse_fast_dispatch(const char *addrstring, unsigned int *compat, int *in_prefix_len) {
+#ifdef LIBIPV4ADDR_PARSE_SSE2
+	if (__builtin_cpu_supports("sse2")) {
+		DEBUGPRINT_NA(DEBUG_libipv4addr, "select SSE2 parser");
+		libipv4addr_parse_fast = libipv4addr_parse_fast_sse2;
+	} else
+#endif
+	{
+		DEBUGPRINT_NA(DEBUG_libipv4addr, "select scalar parser");
+		libipv4addr_parse_fast = libipv4addr_parse_fast_scalar;
+	};
+
+	return (libipv4addr_parse_fast(addrstring, compat, in_prefix_len));
+};
+
+
 /*
  * function stores an IPv4 address string into a structure
  *
@@ -486,6 +678,14 @@ int addr_to_ipv4addrstruct(const char *addrstring, char *resultstring, const siz
 
 	memset(compat, 0, sizeof(compat));
 
+	// plain dotted quad notation
+	if (libipv4addr_parse_fast(addrstring, compat, &in_prefix_len) == 1) {
+		goto END_addr_to_ipv4addrstruct;
+	};
+
+	memset(compat, 0, sizeof(compat));
+	in_prefix_len = 0;
+
 	// catch octal notation
 	if (libipv4addr_regex_cache_valid[LIBIPV4ADDR_REGEX_IPV4_OCTAL] == 0) {
 		// compile and store in cache
@@ -585,8 +785,8 @@ END_addr_to_ipv4addrstruct:
 		ipv4addr_setoctet(ipv4addrp, i, compat[i]);
 	};
 
-	DEBUGPRINT_WA(DEBUG_libipv4addr, "In structure %03u %03u %03u %03u", (unsigned int) ipv4addr_getoctet(ipv4addrp, 0), (unsigned int) ipv4addr_getoctet(ipv4addrp, 1), (unsigned int) ipv4addr_getoctet(ipv4addrp, 2), (unsigned int) ipv4addr_getoctet(ipv4addrp, 3));
-	DEBUGPRINT_WA(DEBUG_libipv4addr, "In structure %8x", (unsigned int) ipv4addr_getdword(ipv4addrp));
+	DEBUGPRINT_WA(DEBUG_libipv4addr, "In structure %03u %03u %03u %03u", (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0), (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1), (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 2), (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 3));
+	DEBUGPRINT_WA(DEBUG_libipv4addr, "In structure %8x", (unsigned int) ipv4addr_getdword_unchecked(ipv4addrp));
 
 	typeinfo = ipv4addr_gettype(ipv4addrp); 
 
@@ -699,8 +899,8 @@ int addrhex_to_ipv4addrstruct(const char *addrstring, char *resultstring, const
 		ipv4addr_setoctet(ipv4addrp, (unsigned int) i, (unsigned int) compat[i]);
 	};
 
-	DEBUGPRINT_WA(DEBUG_libipv4addr, "In structure %03u %03u %03u %03u", (unsigned int) ipv4addr_getoctet(ipv4addrp, 0), (unsigned int) ipv4addr_getoctet(ipv4addrp, 1), (unsigned int) ipv4addr_getoctet(ipv4addrp, 2), (unsigned int) ipv4addr_getoctet(ipv4addrp, 3));
-	DEBUGPRINT_WA(DEBUG_libipv4addr, "In structure %8x", (unsigned int) ipv4addr_getdword(ipv4addrp));
+	DEBUGPRINT_WA(DEBUG_libipv4addr, "In structure %03u %03u %03u %03u", (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0), (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1), (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 2), (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 3));
+	DEBUGPRINT_WA(DEBUG_libipv4addr, "In structure %8x", (unsigned int) ipv4addr_getdword_unchecked(ipv4addrp));
 	
 	typeinfo = ipv4addr_gettype(ipv4addrp); 
 
@@ -724,18 +924,38 @@ int addrhex_to_ipv4addrstruct(const char *addrstring, char *resultstring, const
 int libipv4addr_ipv4addrstruct_to_string(const ipv6calc_ipv4addr *ipv4addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions) {
 	char tempstring[IPV6CALC_STRING_MAX];
 
-	if ((formatoptions & FORMATOPTION_machinereadable) != 0) {
+	if (((formatoptions & (FORMATOPTION_machinereadable | FORMATOPTION_print_octal | FORMATOPTION_printcompressed)) == 0) && (resultstring_length >= LIBIPV4ADDR_STRING_MAX)) {
+		/* fast path: table based, written directly into result */
+		char *p = resultstring;
+		unsigned int i, octet;
+
+		for (i = 0; i <= 3; i++) {
+			octet = ipv4addr_getoctet_unchecked(ipv4addrp, i);
+			memcpy(p, libipv4addr_octet_string[octet], 4);
+			p += LIBIPV4ADDR_OCTET_STRING_LEN(octet);
+			*p++ = '.';
+		};
+		p--;
+
+		if ((ipv4addrp->flag_prefixuse == 1) && ((formatoptions & FORMATOPTION_no_prefixlength) == 0)) {
+			*p++ = '/';
+			memcpy(p, libipv4addr_octet_string[ipv4addrp->prefixlength & 0xff], 4);
+			p += LIBIPV4ADDR_OCTET_STRING_LEN(ipv4addrp->prefixlength);
+		};
+
+		*p = '\0';
+	} else if ((formatoptions & FORMATOPTION_machinereadable) != 0) {
 		snprintf(resultstring, resultstring_length, "IPV4=%u.%u.%u.%u",
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 0),
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 1),
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 2),
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 3));
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0),
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1),
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 2),
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 3));
 	} else if ((formatoptions & FORMATOPTION_print_octal) != 0) {
 		snprintf(tempstring, sizeof(tempstring), "0%03o.0%03o.0%03o.0%03o",
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 0),
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 1),
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 2),
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 3));
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0),
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1),
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 2),
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 3));
 
 		if ((ipv4addrp->flag_prefixuse == 1) && ((formatoptions & FORMATOPTION_no_prefixlength) == 0)) {
 			snprintf(resultstring, resultstring_length, "%s/%d", tempstring, ipv4addrp->prefixlength);
@@ -754,28 +974,28 @@ int libipv4addr_ipv4addrstruct_to_string(const ipv6calc_ipv4addr *ipv4addrp, cha
 		switch (oct_to_print) {
 		case 4:
 			snprintf(tempstring, sizeof(tempstring), "%u.%u.%u.%u",
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 0),
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 1),
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 2),
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 3));
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0),
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1),
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 2),
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 3));
 			break;
 
 		case 3:
 			snprintf(tempstring, sizeof(tempstring), "%u.%u.%u",
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 0),
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 1),
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 2));
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0),
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1),
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 2));
 			break;
 
 		case 2:
 			snprintf(tempstring, sizeof(tempstring), "%u.%u",
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 0),
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 1));
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0),
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1));
 			break;
 
 		case 1:
 			snprintf(tempstring, sizeof(tempstring), "%u",
-			         (unsigned int) ipv4addr_getoctet(ipv4addrp, 0));
+			         (unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0));
 			break;
 
 		default:
@@ -871,17 +1091,17 @@ int libipv4addr_to_octal(const ipv6calc_ipv4addr *ipv4addrp, char *resultstring,
 
 	if ( (formatoptions & FORMATOPTION_printfulluncompressed) != 0 ) {
 		snprintf(tempstring, sizeof(tempstring), "\\0%03o\\0%03o\\0%03o\\0%03o",
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 0),  \
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 1),  \
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 2),  \
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 3)   \
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0),  \
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1),  \
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 2),  \
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 3)   \
 		);
 	} else {
 		snprintf(tempstring, sizeof(tempstring), "\\0%o\\0%o\\0%o\\0%o",
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 0),  \
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 1),  \
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 2),  \
-			(unsigned int) ipv4addr_getoctet(ipv4addrp, 3)   \
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0),  \
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1),  \
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 2),  \
+			(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 3)   \
 		);
 	};
 
@@ -985,10 +1205,10 @@ int libipv4addr_to_hex(const ipv6calc_ipv4addr *ipv4addrp, char *resultstring, c
 	char tempstring[IPV6CALC_STRING_MAX];
 
 	snprintf(tempstring, sizeof(tempstring), "%02x%02x%02x%02x",
-		(unsigned int) ipv4addr_getoctet(ipv4addrp, 0),  \
-		(unsigned int) ipv4addr_getoctet(ipv4addrp, 1),  \
-		(unsigned int) ipv4addr_getoctet(ipv4addrp, 2),  \
-		(unsigned int) ipv4addr_getoctet(ipv4addrp, 3)   \
+		(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 0),  \
+		(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 1),  \
+		(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 2),  \
+		(unsigned int) ipv4addr_getoctet_unchecked(ipv4addrp, 3)   \
 	);
 
 	snprintf(resultstring, resultstring_length, "%s", tempstring);
@@ -1074,7 +1294,7 @@ int libipv4addr_anonymize(ipv6calc_ipv4addr *ipv4addrp, unsigned int mask, const
 				ipv4addr_setoctet(ipv4addrp, 1, 0u);
 			} else {
 				/* mask IPv4 address */
-				ipv4addr_setdword(ipv4addrp, ipv4addr_getdword(ipv4addrp) & (0xffffffffu << ((unsigned int) 32 - mask)));
+				ipv4addr_setdword(ipv4addrp, ipv4addr_getdword_unchecked(ipv4addrp) & (0xffffffffu << ((unsigned int) 32 - mask)));
 			};
 		};
 	} else if (method == ANON_METHOD_KEEPTYPEASNCC) {
@@ -1212,7 +1432,7 @@ uint32_t ipv4addr_anonymized_get_as_num32(const ipv6calc_ipv4addr *ipv4addrp) {
 		return(ASNUM_AS_UNKNOWN);
 	};
 
-	return(libipv6calc_db_wrapper_as_num32_decomp17(ipv4addr_getdword(ipv4addrp) & 0x1ffff));
+	return(libipv6calc_db_wrapper_as_num32_decomp17(ipv4addr_getdword_unchecked(ipv4addrp) & 0x1ffff));
 };
 
 
@@ -1739,7 +1959,7 @@ int libipv4addr_registry_num_by_addr(const ipv6calc_ipv4addr *ipv4addrp) {
 		if( (ipv4addrp->typeinfo & IPV4_ADDR_LISP) != 0) {
 			DEBUGPRINT_NA(DEBUG_libipv4addr, "IPv4 is anonymized LISP, extract registry from anonymized data");
 			// extract registry
-			uint32_t ipv4addr = ipv4addr_getdword(ipv4addrp);
+			uint32_t ipv4addr = ipv4addr_getdword_unchecked(ipv4addrp);
 			registry = (ipv4addr >> 13) & 0x7;
 		} else if( (ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED_GEONAMEID) != 0) {
 			// GeonameID can't save Registry (exception: LISP)
@@ -1785,7 +2005,7 @@ uint32_t libipv4addr_GeonameID_by_addr(const ipv6calc_ipv4addr *ipv4addrp, unsig
 	unsigned int GeonameID_type = IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN;
 	unsigned int data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
 	ipv6calc_ipaddr ipaddr;
-	uint32_t ipv4 = ipv4addr_getdword(ipv4addrp);
+	uint32_t ipv4 = ipv4addr_getdword_unchecked(ipv4addrp);
 
 	if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) != 0) {
 		if (((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED_GEONAMEID) != 0) \
@@ -18,6 +18,10 @@
 #include "ipv6calctypes.h"
 
 
+/* min. buffer size for direct formatting of dotted quad with prefix length ("255.255.255.255/32", table copies 4 bytes per octet) */
+#define LIBIPV4ADDR_STRING_MAX	20
+
+
 /* typedefs */
 
 /* IPv4 address structure */
@@ -172,6 +176,20 @@ typedef struct {
 // Prefix anonymization on method=kg
 #define ANON_METHOD_KEEPTYPEGEONAMEID_IPV4_REQ_DB   (IPV6CALC_DB_IPV4_TO_GEONAMEID)
 
+
+/* inline accessors without range check for internal hot paths, caller has to take care of range */
+static inline uint8_t ipv4addr_getoctet_unchecked(const ipv6calc_ipv4addr *ipv4addrp, const unsigned int numoctet) {
+	return ((uint8_t) ((ipv4addrp->in_addr.s_addr >> (numoctet << 3)) & 0xff));
+};
+
+static inline uint32_t ipv4addr_getdword_unchecked(const ipv6calc_ipv4addr *ipv4addrp) {
+	return (((uint32_t) ipv4addr_getoctet_unchecked(ipv4addrp, 0) << 24) \
+		| ((uint32_t) ipv4addr_getoctet_unchecked(ipv4addrp, 1) << 16) \
+		| ((uint32_t) ipv4addr_getoctet_unchecked(ipv4addrp, 2) << 8) \
+		| ((uint32_t) ipv4addr_getoctet_unchecked(ipv4addrp, 3)));
+};
+
+
 #endif
 
 
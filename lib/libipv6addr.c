@@ -83,10 +83,15 @@ const int ipv6calc_ipv6addr_type2_strings_entries = MAXENTRIES_ARRAY(ipv6calc_ip
 
 
 /* IID random limits */
+#define IID_RANDOM_HEXDIGIT_MIN		0.249
+#define IID_RANDOM_HEXDIGIT_MAX		2.5
+#define IID_RANDOM_LLS_RESIDUAL_MIN	6.275
+#define IID_RANDOM_LLS_RESIDUAL_MAX	26.042
+
 // this filter values detects 999.744 from 1.000.000 generated random (using privacy extension) IIDs (256 are not detected)
 static const s_iid_statistics s_iid_statistics_ok_min = {
-	0.249,		// fits to 100% of 1 million tested
-	6.275,		// fits to 100% of 1 million tested
+	IID_RANDOM_HEXDIGIT_MIN,	// fits to 100% of 1 million tested
+	IID_RANDOM_LLS_RESIDUAL_MIN,	// fits to 100% of 1 million tested
 	{  4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},	// fit to 100% of 1 million tested
 	{  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},	// fit to 100% of 1 million tested
 	{  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},	// default
@@ -95,8 +100,8 @@ static const s_iid_statistics s_iid_statistics_ok_min = {
 };
 
 static const s_iid_statistics s_iid_statistics_ok_max = {
-	2.5,		// fits to 1 million - 90 tested (100%: 4.016)
-	26.042,		// fits to 100% of 1 million tested
+	IID_RANDOM_HEXDIGIT_MAX,	// fits to 1 million - 90 tested (100%: 4.016)
+	IID_RANDOM_LLS_RESIDUAL_MAX,	// fits to 100% of 1 million tested
 	{ 16, 6, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},	// fit to 1 million - 3 tested
 	{  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},	// TODO
 	{  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7},	// fit to 1 million - 38 tested
@@ -104,6 +109,37 @@ static const s_iid_statistics s_iid_statistics_ok_max = {
 	15	// fit to 1 million
 };
 
+/*
+ * integer limits for ipv6addr_iidrandomdetection_fast
+ *  hexdigit:     variance^2     = sum((16 * amount - 16 * avg)^2) / 256 / used_digits
+ *  lls_residual: lls_residual^2 = N / 21760 (N see below)
+ * values within IID_RANDOM_LIMIT_BAND around a limit are verified by the floating point implementation
+ */
+#define IID_RANDOM_LIMIT_BAND		0.001
+#define IID_RANDOM_HEXDIGIT_SCALE	1000000
+
+static const uint64_t iid_random_hexdigit_min_lo = (uint64_t) (IID_RANDOM_HEXDIGIT_MIN * IID_RANDOM_HEXDIGIT_MIN * 256 * IID_RANDOM_HEXDIGIT_SCALE * (1 - IID_RANDOM_LIMIT_BAND));
+static const uint64_t iid_random_hexdigit_min_hi = (uint64_t) (IID_RANDOM_HEXDIGIT_MIN * IID_RANDOM_HEXDIGIT_MIN * 256 * IID_RANDOM_HEXDIGIT_SCALE * (1 + IID_RANDOM_LIMIT_BAND));
+static const uint64_t iid_random_hexdigit_max_lo = (uint64_t) (IID_RANDOM_HEXDIGIT_MAX * IID_RANDOM_HEXDIGIT_MAX * 256 * IID_RANDOM_HEXDIGIT_SCALE * (1 - IID_RANDOM_LIMIT_BAND));
+static const uint64_t iid_random_hexdigit_max_hi = (uint64_t) (IID_RANDOM_HEXDIGIT_MAX * IID_RANDOM_HEXDIGIT_MAX * 256 * IID_RANDOM_HEXDIGIT_SCALE * (1 + IID_RANDOM_LIMIT_BAND));
+
+static const int64_t iid_random_lls_min_lo = (int64_t) (IID_RANDOM_LLS_RESIDUAL_MIN * IID_RANDOM_LLS_RESIDUAL_MIN * 21760 * (1 - IID_RANDOM_LIMIT_BAND));
+static const int64_t iid_random_lls_min_hi = (int64_t) (IID_RANDOM_LLS_RESIDUAL_MIN * IID_RANDOM_LLS_RESIDUAL_MIN * 21760 * (1 + IID_RANDOM_LIMIT_BAND));
+static const int64_t iid_random_lls_max_lo = (int64_t) (IID_RANDOM_LLS_RESIDUAL_MAX * IID_RANDOM_LLS_RESIDUAL_MAX * 21760 * (1 - IID_RANDOM_LIMIT_BAND));
+static const int64_t iid_random_lls_max_hi = (int64_t) (IID_RANDOM_LLS_RESIDUAL_MAX * IID_RANDOM_LLS_RESIDUAL_MAX * 21760 * (1 + IID_RANDOM_LIMIT_BAND));
+
+
+/* IID random detection memo table (optional, not thread-safe, see ipv6addr_iidrandomdetection_cache_init) */
+typedef struct {
+	uint32_t iid[2];
+	int8_t   result;
+	int8_t   valid;
+} s_iid_random_cache;
+
+static s_iid_random_cache *iid_random_cache = NULL;
+static uint32_t iid_random_cache_mask = 0;
+static uint32_t iid_random_cache_statistics[2]; // 0: hit, 1: miss
+
 
 /*
  * function returns an octet of an IPv6 address
@@ -446,7 +482,7 @@ void ipv6addr_set_checksum_anonymized_prefix(ipv6calc_ipv6addr *ipv6addrp) {
 	uint32_t checksum = ipv6addr_checksum_anonymized_qword(ipv6addrp, ANON_CHECKSUM_FLAG_CREATE, 0);
 
 	/* checksum is stored in rightmost nibble */
-	ipv6addr_setoctet(ipv6addrp, 7, (ipv6addr_getoctet(ipv6addrp, 7) & 0xf0) | checksum);
+	ipv6addr_setoctet(ipv6addrp, 7, (ipv6addr_getoctet_unchecked(ipv6addrp, 7) & 0xf0) | checksum);
 };
 
 
@@ -470,7 +506,7 @@ void ipv6addr_set_checksum_anonymized_iid(ipv6calc_ipv6addr *ipv6addrp) {
 	uint32_t checksum = ipv6addr_checksum_anonymized_qword(ipv6addrp, ANON_CHECKSUM_FLAG_CREATE, 1);
 
 	/* checksum is stored in rightmost nibble */
-	ipv6addr_setoctet(ipv6addrp, 15, (ipv6addr_getoctet(ipv6addrp, 15) & 0xf0) | checksum);
+	ipv6addr_setoctet(ipv6addrp, 15, (ipv6addr_getoctet_unchecked(ipv6addrp, 15) & 0xf0) | checksum);
 };
 
 
@@ -494,8 +530,8 @@ int ipv6addr_verify_checksum_anonymized_iid(const ipv6calc_ipv6addr *ipv6addrp)
 int ipv6addr_iidrandomdetection(const ipv6calc_ipv6addr *ipv6addrp, s_iid_statistics *iid_statisticsp) {
 	uint32_t iid[2];
 
-	iid[0] = ipv6addr_getdword(ipv6addrp, 2); // 00-31
-	iid[1] = ipv6addr_getdword(ipv6addrp, 3); // 32-63
+	iid[0] = ipv6addr_getdword_unchecked(ipv6addrp, 2); // 00-31
+	iid[1] = ipv6addr_getdword_unchecked(ipv6addrp, 3); // 32-63
 
 	int result = 2;
 
@@ -548,7 +584,7 @@ int ipv6addr_iidrandomdetection(const ipv6calc_ipv6addr *ipv6addrp, s_iid_statis
 		iid_statisticsp->digit_amount[v]++;
 	};
 
-	if ( (ipv6calc_debug & DEBUG_libipv6addr_iidrandomdetection) != 0 ) { // ipv6calc_debug usage ok
+	if (IPV6CALC_DEBUG_ACTIVE(DEBUG_libipv6addr_iidrandomdetection)) {
 		DEBUGPRINT_NA(DEBUG_libipv6addr, "distribution");
 
 		fprintf(stderr, "%s/%s: hex distribution: digit   ", __FILE__, __func__);
@@ -658,7 +694,7 @@ int ipv6addr_iidrandomdetection(const ipv6calc_ipv6addr *ipv6addrp, s_iid_statis
 
 	};
 
-	if ( (ipv6calc_debug & DEBUG_libipv6addr_iidrandomdetection) != 0 ) { // ipv6calc_debug usage ok
+	if (IPV6CALC_DEBUG_ACTIVE(DEBUG_libipv6addr_iidrandomdetection)) {
 		fprintf(stderr, "%s/%s: digit blocks: ", __FILE__, __func__);
 		for (c = 0; c < 16; c++) {
 			fprintf(stderr, "%d:%d ", c+1, iid_statisticsp->digit_blocks[c]);
@@ -735,6 +771,248 @@ END_ipv6addr_iidrandomdetection:
 };
 
 
+/*
+ * index of lowest set bit (de Bruijn sequence)
+ */
+static const int iid_random_debruijn64[64] = {
+	 0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+	62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+	63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+	46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+};
+
+#define IID_RANDOM_LOWEST_BIT(x)	iid_random_debruijn64[(((x) & (~(x) + 1)) * 0x03f79d71b4cb0a89ull) >> 58]
+
+/* least significant bit of each nibble pair of neighbor digits (15 pairs) */
+#define IID_RANDOM_NIBBLE_PAIRS		0x0111111111111111ull
+
+
+/*
+ * fuzzy detection of IID is random generated (e.g. by privacy extension)
+ *  integer implementation of ipv6addr_iidrandomdetection with same classification
+ *  (bit-parallel, without statistics, optional memo table)
+ *
+ * in:  ipv6addrp  = pointer to IPv6 address structure
+ * out: 0=probably random generated (e.g. by privacy extension), 1=manual set, -1=global
+ */
+int ipv6addr_iidrandomdetection_fast(const ipv6calc_ipv6addr *ipv6addrp) {
+	uint32_t iid[2], h = 0;
+	uint64_t iid64, e, z, zc, m;
+	int digit_amount[16];
+	int digit_blocks_hexdigit[16];
+	int digit_delta[31];
+	int digit_delta_amount = 0;
+	int blocks, blocks_ge, blocks_ge_next;
+	int b, c, d, d_last, v;
+	int sum = 0, sum2 = 0, sumxy = 0, used = 0;
+	uint64_t hexdigit = 0;
+	int64_t lls;
+	int result = 1;
+	s_iid_statistics iid_statistics;
+
+	iid[0] = ipv6addr_getdword_unchecked(ipv6addrp, 2); // 00-31
+	iid[1] = ipv6addr_getdword_unchecked(ipv6addrp, 3); // 32-63
+
+	// blacklists
+	if ((iid[0] & 0x02000000u) == 0x02000000u) {
+		return (-1);
+	};
+
+	if (((iid[0] & 0x000000ffu) == 0x000000ffu) && ((iid[1] & 0xff000000u) == 0xfe000000u)) {
+		return (-1);
+	};
+
+	if (iid_random_cache != NULL) {
+		h = iid[0] ^ (iid[1] * 0x9e3779b1u);
+		h = (h ^ (h >> 16)) & iid_random_cache_mask;
+
+		if ((iid_random_cache[h].valid == 1) && (iid_random_cache[h].iid[0] == iid[0]) && (iid_random_cache[h].iid[1] == iid[1])) {
+			iid_random_cache_statistics[0]++;
+			return (iid_random_cache[h].result);
+		};
+		iid_random_cache_statistics[1]++;
+	};
+
+	iid64 = ((uint64_t) iid[0] << 32) | iid[1];
+
+	/* digit blocks: z has a bit set for each pair of equal neighbor digits */
+	e = iid64 ^ (iid64 >> 4);
+	z = ~(e | (e >> 1) | (e >> 2) | (e >> 3)) & IID_RANDOM_NIBBLE_PAIRS;
+
+	/* zc: chains of at least c+1 equal neighbor pairs (block length >= c+2), amount of blocks is amount of chain ends */
+	blocks = 16;
+	for (m = z; m != 0; m &= m - 1) {
+		blocks--;
+	};
+
+	zc = z;
+	blocks_ge = blocks;
+	for (c = 0; c < 16; c++) {
+		blocks_ge_next = 0;
+		for (m = zc & ~(zc >> 4); m != 0; m &= m - 1) {
+			blocks_ge_next++;
+		};
+
+		// blocks of length c+1
+		v = blocks_ge - blocks_ge_next;
+		if (v < s_iid_statistics_ok_min.digit_blocks[c] || v > s_iid_statistics_ok_max.digit_blocks[c]) {
+			goto END_ipv6addr_iidrandomdetection_fast;
+		};
+
+		blocks_ge = blocks_ge_next;
+		zc &= zc >> 4;
+	};
+
+	/* hexdigits used in blocks of length >= 2 (last block is not counted by ipv6addr_iidrandomdetection) */
+	memset(digit_blocks_hexdigit, 0, sizeof(digit_blocks_hexdigit));
+	for (m = z & ~(z << 4) & ~((uint64_t) 0x1); m != 0; m &= m - 1) {
+		digit_blocks_hexdigit[(iid64 >> IID_RANDOM_LOWEST_BIT(m)) & 0xf]++;
+	};
+
+	/* digit amount, delta of neighbor digits, sums for linear least square fit */
+	memset(digit_amount, 0, sizeof(digit_amount));
+	memset(digit_delta, 0, sizeof(digit_delta));
+
+	d_last = (int) (iid64 >> 60);
+	digit_amount[d_last]++;
+	sum2 = d_last * d_last;
+	sum = d_last;
+
+	for (b = 1; b < 16; b++) {
+		d = (int) ((iid64 >> ((15 - b) << 2)) & 0xf);
+		digit_amount[d]++;
+		digit_delta[d - d_last + 15]++;
+		sum   += d;
+		sum2  += d * d;
+		sumxy += b * d;
+		d_last = d;
+	};
+
+	/* check against integer limits (without branches) */
+	v = 0;
+	for (c = 0; c < 16; c++) {
+		v |= (digit_blocks_hexdigit[c] < s_iid_statistics_ok_min.digit_blocks_hexdigit[c]) | (digit_blocks_hexdigit[c] > s_iid_statistics_ok_max.digit_blocks_hexdigit[c]);
+		v |= (digit_amount[c] < s_iid_statistics_ok_min.digit_amount[c]) | (digit_amount[c] > s_iid_statistics_ok_max.digit_amount[c]);
+	};
+
+	for (c = 0; c < 31; c++) {
+		v |= (digit_delta[c] < s_iid_statistics_ok_min.digit_delta[c]) | (digit_delta[c] > s_iid_statistics_ok_max.digit_delta[c]);
+		digit_delta_amount += (digit_delta[c] != 0);
+	};
+
+	v |= (digit_delta_amount < s_iid_statistics_ok_min.digit_delta_amount) | (digit_delta_amount > s_iid_statistics_ok_max.digit_delta_amount);
+
+	if (v != 0) {
+		goto END_ipv6addr_iidrandomdetection_fast;
+	};
+
+	/* variance over hexdigits (scaled by 16, average compensates universal/local bit) */
+	for (b = 0; b < 16; b++) {
+		v = 16 * digit_amount[b] - 16 - (((b & 0x02) == 0x02) ? -1 : 1);
+		hexdigit += (uint64_t) ((digit_amount[b] != 0) * v * v);
+		used += (digit_amount[b] != 0);
+	};
+	hexdigit *= IID_RANDOM_HEXDIGIT_SCALE;
+
+	/* residual of linear least square fit (scaled by 21760) */
+	lls = (int64_t) 1360 * (16 * sum2 - sum * sum) - (int64_t) 16 * (2 * sumxy - 15 * sum) * (2 * sumxy - 15 * sum);
+
+	if ((hexdigit < iid_random_hexdigit_min_lo * used) || (hexdigit > iid_random_hexdigit_max_hi * used)
+	    || (lls < iid_random_lls_min_lo) || (lls > iid_random_lls_max_hi)) {
+		// clearly out of limits
+		goto END_ipv6addr_iidrandomdetection_fast;
+	};
+
+	if ((hexdigit <= iid_random_hexdigit_min_hi * used) || (hexdigit >= iid_random_hexdigit_max_lo * used)
+	    || (lls <= iid_random_lls_min_hi) || (lls >= iid_random_lls_max_lo)) {
+		// too close to a limit, let floating point implementation decide
+		DEBUGPRINT_WA(DEBUG_libipv6addr_iidrandomdetection, "close to limit, call floating point implementation: %08x%08x", iid[0], iid[1]);
+		result = ipv6addr_iidrandomdetection(ipv6addrp, &iid_statistics);
+		goto END_ipv6addr_iidrandomdetection_fast;
+	};
+
+	result = 0;
+
+END_ipv6addr_iidrandomdetection_fast:
+	DEBUGPRINT_WA(DEBUG_libipv6addr_iidrandomdetection, "IID=%08x%08x result=%d", iid[0], iid[1], result);
+
+	if (iid_random_cache != NULL) {
+		iid_random_cache[h].iid[0] = iid[0];
+		iid_random_cache[h].iid[1] = iid[1];
+		iid_random_cache[h].result = result;
+		iid_random_cache[h].valid  = 1;
+	};
+
+	return (result);
+};
+
+
+/*
+ * initialize memo table for ipv6addr_iidrandomdetection_fast
+ *  note: table is global, use only in single-threaded programs
+ *
+ * in:  entries = amount of entries (rounded down to power of 2), 0: disable
+ * out: 0=ok, 1=error
+ */
+int ipv6addr_iidrandomdetection_cache_init(const unsigned int entries) {
+	uint32_t size = 1;
+
+	if (iid_random_cache != NULL) {
+		DEBUGPRINT_WA(DEBUG_libipv6addr_iidrandomdetection, "memo table statistics: hit=%u miss=%u", iid_random_cache_statistics[0], iid_random_cache_statistics[1]);
+		free(iid_random_cache);
+		iid_random_cache = NULL;
+		iid_random_cache_mask = 0;
+	};
+
+	iid_random_cache_statistics[0] = 0;
+	iid_random_cache_statistics[1] = 0;
+
+	if (entries == 0) {
+		return (0);
+	};
+
+	while ((size << 1) <= entries && size < 0x1000000u) {
+		size <<= 1;
+	};
+
+	iid_random_cache = calloc(size, sizeof(s_iid_random_cache));
+	if (iid_random_cache == NULL) {
+		fprintf(stderr, "ipv6addr_iidrandomdetection_cache_init: can't allocate memory for %u entries\n", size);
+		return (1);
+	};
+
+	iid_random_cache_mask = size - 1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6addr_iidrandomdetection, "memo table initialized with entries: %u", size);
+
+	return (0);
+};
+
+
+/*
+ * typeinfo of an IPv6 address related to IID random detection (expensive tier)
+ *
+ * in : ipv6addrp = pointer to IPv6 address structure
+ * ret: typeinfo bits to add
+ */
+static uint32_t ipv6addr_gettype_iidrandom(const ipv6calc_ipv6addr *ipv6addrp) {
+	uint32_t type = 0;
+	int r;
+
+	/* fuzzy detection of random IID (e.g. privacy extension) */
+	r = ipv6addr_iidrandomdetection_fast(ipv6addrp);
+	if (r == 0) {
+		type |= IPV6_NEW_ADDR_IID_RANDOM;
+	} else if (r == 2) {
+		type |= IPV6_NEW_ADDR_IID_RANDOM | IPV6_ADDR_ANONYMIZED_IID;
+	} else if (r == 3) {
+		type |= IPV6_NEW_ADDR_IID_LOCAL | IPV6_ADDR_ANONYMIZED_IID;
+	};
+
+	return(type);
+};
+
+
 /*
  * Set type of an IPv6 address
  *
@@ -742,12 +1020,14 @@ END_ipv6addr_iidrandomdetection:
  * basic code was taken from "kernel/net/ipv6/addrconf.c"
  *
  * in : ipv6addrp = pointer to IPv6 address structure
- * mod: typeinfo, typeinfo2, prefix2length
+ *      tier = IPV6ADDR_TYPEINFO_FULL: all checks
+ *             IPV6ADDR_TYPEINFO_BASIC: skip expensive checks, done later by ipv6addr_gettypeinfo
+ * mod: typeinfo, typeinfo2, prefix2length, flag_typeinfo
  */
-void ipv6addr_settype(ipv6calc_ipv6addr *ipv6addrp) {
+static void ipv6addr_settype_tier(ipv6calc_ipv6addr *ipv6addrp, const int tier) {
 	uint32_t type = 0, r, type2 = 0;
 	uint32_t st, st1, st2, st3;
-	s_iid_statistics variances;
+	int8_t flag_typeinfo = IPV6ADDR_TYPEINFO_FULL;
 	int p;
 	uint32_t mask_0_15, mask_16_31;
 
@@ -757,10 +1037,10 @@ void ipv6addr_settype(ipv6calc_ipv6addr *ipv6addrp) {
 	ipv6calc_ipv4addr ipv4addr;
 	ipv6calc_ipv6addr ipv6addr;
 
-	st =  ipv6addr_getdword(ipv6addrp, 0); /* 32 MSB */
-	st1 = ipv6addr_getdword(ipv6addrp, 1);
-	st2 = ipv6addr_getdword(ipv6addrp, 2);
-	st3 = ipv6addr_getdword(ipv6addrp, 3); /* 32 LSB */
+	st =  ipv6addr_getdword_unchecked(ipv6addrp, 0); /* 32 MSB */
+	st1 = ipv6addr_getdword_unchecked(ipv6addrp, 1);
+	st2 = ipv6addr_getdword_unchecked(ipv6addrp, 2);
+	st3 = ipv6addr_getdword_unchecked(ipv6addrp, 3); /* 32 LSB */
 
 	DEBUGPRINT_NA(DEBUG_libipv6addr, "Called");
 
@@ -877,11 +1157,11 @@ void ipv6addr_settype(ipv6calc_ipv6addr *ipv6addrp) {
 		/* 2002::/16 -> 6to4 tunneling */
 		type |= IPV6_NEW_ADDR_6TO4;
 
-		if (	(ipv6addr_getword(ipv6addrp, 3) == 0) &&
-			(ipv6addr_getword(ipv6addrp, 4) == 0) &&
-			(ipv6addr_getword(ipv6addrp, 5) == 0) &&
-			(ipv6addr_getword(ipv6addrp, 6) == ipv6addr_getword(ipv6addrp, 1)) &&
-			(ipv6addr_getword(ipv6addrp, 7) == ipv6addr_getword(ipv6addrp, 2)) ) {
+		if (	(ipv6addr_getword_unchecked(ipv6addrp, 3) == 0) &&
+			(ipv6addr_getword_unchecked(ipv6addrp, 4) == 0) &&
+			(ipv6addr_getword_unchecked(ipv6addrp, 5) == 0) &&
+			(ipv6addr_getword_unchecked(ipv6addrp, 6) == ipv6addr_getword_unchecked(ipv6addrp, 1)) &&
+			(ipv6addr_getword_unchecked(ipv6addrp, 7) == ipv6addr_getword_unchecked(ipv6addrp, 2)) ) {
 			/* 2002:<ipv4addr>::<ipv4addr> -> usually Microsoft does this */
 			type |= IPV6_NEW_ADDR_6TO4_MICROSOFT;
 			type |= IPV6_ADDR_IID_32_63_HAS_IPV4;
@@ -892,7 +1172,7 @@ void ipv6addr_settype(ipv6calc_ipv6addr *ipv6addrp) {
 		/* 3ffe:831f::/32 -> Teredo (6bone, older draft) */
 		/* 2001:0000::/32 -> Teredo (RFC 4380) */
 		type |= IPV6_NEW_ADDR_TEREDO;
-		if (ipv6addr_getword(ipv6addrp, 5) == 0xffffu) {
+		if (ipv6addr_getword_unchecked(ipv6addrp, 5) == 0xffffu) {
 			// port=0, done by anonymization
 			type |= IPV6_ADDR_ANONYMIZED_IID;
 		};
@@ -1213,16 +1493,12 @@ END_ANON_IID:
 				type |= IPV6_NEW_ADDR_IID_LOCAL;
 
 				if ((type & (IPV6_ADDR_IID_32_63_HAS_IPV4 | IPV6_NEW_ADDR_LINKLOCAL_TEREDO | IPV6_NEW_ADDR_IID_ISATAP | IPV6_NEW_ADDR_TEREDO | IPV6_NEW_ADDR_SOLICITED_NODE)) == 0) {
-					DEBUGPRINT_WA(DEBUG_libipv6addr, "call IID random detection, typeinfo=%08x", type);
-
-					/* fuzzy detection of random IID (e.g. privacy extension) */
-					r = ipv6addr_iidrandomdetection(ipv6addrp, &variances);
-					if (r == 0) {
-						type |= IPV6_NEW_ADDR_IID_RANDOM;
-					} else if (r == 2) {
-						type |= IPV6_NEW_ADDR_IID_RANDOM | IPV6_ADDR_ANONYMIZED_IID;
-					} else if (r == 3) {
-						type |= IPV6_NEW_ADDR_IID_LOCAL | IPV6_ADDR_ANONYMIZED_IID;
+					if (tier == IPV6ADDR_TYPEINFO_BASIC) {
+						DEBUGPRINT_WA(DEBUG_libipv6addr, "defer IID random detection, typeinfo=%08x", type);
+						flag_typeinfo = IPV6ADDR_TYPEINFO_BASIC;
+					} else {
+						DEBUGPRINT_WA(DEBUG_libipv6addr, "call IID random detection, typeinfo=%08x", type);
+						type |= ipv6addr_gettype_iidrandom(ipv6addrp);
 					};
 				};
 			};
@@ -1234,7 +1510,50 @@ END_ANON_IID:
 END_ipv6addr_gettype:
 	ipv6addrp->typeinfo  = type;
 	ipv6addrp->typeinfo2 = type2;
-	ipv6addrp->flag_typeinfo = 1;
+	ipv6addrp->flag_typeinfo = flag_typeinfo;
+};
+
+
+/*
+ * Set type of an IPv6 address (all checks)
+ *
+ * in : ipv6addrp = pointer to IPv6 address structure
+ * mod: typeinfo, typeinfo2, prefix2length, flag_typeinfo
+ */
+void ipv6addr_settype(ipv6calc_ipv6addr *ipv6addrp) {
+	ipv6addr_settype_tier(ipv6addrp, IPV6ADDR_TYPEINFO_FULL);
+};
+
+
+/*
+ * Set type of an IPv6 address (cheap checks only)
+ *  IID random detection is deferred until typeinfo is retrieved by ipv6addr_gettypeinfo
+ *
+ * in : ipv6addrp = pointer to IPv6 address structure
+ * mod: typeinfo, typeinfo2, prefix2length, flag_typeinfo
+ */
+void ipv6addr_settype_basic(ipv6calc_ipv6addr *ipv6addrp) {
+	ipv6addr_settype_tier(ipv6addrp, IPV6ADDR_TYPEINFO_BASIC);
+};
+
+
+/*
+ * Get complete typeinfo of an IPv6 address, run deferred checks on first access
+ *
+ * in : ipv6addrp = pointer to IPv6 address structure
+ * mod: typeinfo, flag_typeinfo
+ * ret: typeinfo
+ */
+uint32_t ipv6addr_gettypeinfo(ipv6calc_ipv6addr *ipv6addrp) {
+	if (ipv6addrp->flag_typeinfo == IPV6ADDR_TYPEINFO_NONE) {
+		ipv6addr_settype(ipv6addrp);
+	} else if (ipv6addrp->flag_typeinfo == IPV6ADDR_TYPEINFO_BASIC) {
+		DEBUGPRINT_WA(DEBUG_libipv6addr, "run deferred IID random detection, typeinfo=%08x", ipv6addrp->typeinfo);
+		ipv6addrp->typeinfo |= ipv6addr_gettype_iidrandom(ipv6addrp);
+		ipv6addrp->flag_typeinfo = IPV6ADDR_TYPEINFO_FULL;
+	};
+
+	return(ipv6addrp->typeinfo);
 };
 
 
@@ -1303,11 +1622,12 @@ int addrliteral_to_ipv6addrstruct(const char *addrstring, char *resultstring, co
  * function stores an IPv6 address string into a structure
  *
  * in : *addrstring = IPv6 address
+ *      tier = typeinfo tier (see ipv6addr_settype_tier)
  * out: *resultstring = error message
  * out: ipv6addrp = changed IPv6 address structure
  * ret: ==0: ok, !=0: error
  */
-int addr_to_ipv6addrstruct(const char *addrstring, char *resultstring, const size_t resultstring_length, ipv6calc_ipv6addr *ipv6addrp) {
+static int addr_to_ipv6addrstruct_tier(const char *addrstring, char *resultstring, const size_t resultstring_length, ipv6calc_ipv6addr *ipv6addrp, const int tier) {
 	int retval = 1, result, i, cpoints = 0, ccolons = 0, cxdigits = 0;
 	char *addronlystring, *cp, tempstring[IPV6CALC_STRING_MAX], tempstring2[IPV6CALC_STRING_MAX], *cptr, **ptrptr;
 	int expecteditems = 0;
@@ -1489,10 +1809,10 @@ int addr_to_ipv6addrstruct(const char *addrstring, char *resultstring, const siz
 		ipv6addr_setword(ipv6addrp, (unsigned int) i, (unsigned int) temp[i]);
 	};
 
-	DEBUGPRINT_WA(DEBUG_libipv6addr, "In structure %08x %08x %08x %08x", (unsigned int) ipv6addr_getdword(ipv6addrp, 0), (unsigned int) ipv6addr_getdword(ipv6addrp, 1), (unsigned int) ipv6addr_getdword(ipv6addrp, 2), (unsigned int) ipv6addr_getdword(ipv6addrp, 3));
-	DEBUGPRINT_WA(DEBUG_libipv6addr, "In structure %04x %04x %04x %04x %04x %04x %04x %04x", (unsigned int) ipv6addr_getword(ipv6addrp, 0), (unsigned int) ipv6addr_getword(ipv6addrp, 1), (unsigned int) ipv6addr_getword(ipv6addrp, 2), (unsigned int) ipv6addr_getword(ipv6addrp, 3), (unsigned int) ipv6addr_getword(ipv6addrp, 4), (unsigned int) ipv6addr_getword(ipv6addrp, 5), (unsigned int) ipv6addr_getword(ipv6addrp, 6), (unsigned int) ipv6addr_getword(ipv6addrp, 7));
+	DEBUGPRINT_WA(DEBUG_libipv6addr, "In structure %08x %08x %08x %08x", (unsigned int) ipv6addr_getdword_unchecked(ipv6addrp, 0), (unsigned int) ipv6addr_getdword_unchecked(ipv6addrp, 1), (unsigned int) ipv6addr_getdword_unchecked(ipv6addrp, 2), (unsigned int) ipv6addr_getdword_unchecked(ipv6addrp, 3));
+	DEBUGPRINT_WA(DEBUG_libipv6addr, "In structure %04x %04x %04x %04x %04x %04x %04x %04x", (unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 0), (unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 1), (unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 2), (unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 3), (unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 4), (unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 5), (unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 6), (unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 7));
 	
-	ipv6addr_settype(ipv6addrp);
+	ipv6addr_settype_tier(ipv6addrp, tier);
 
 	DEBUGPRINT_WA(DEBUG_libipv6addr, "flag_prefixuse %d", ipv6addrp->flag_prefixuse);
 	
@@ -1502,6 +1822,33 @@ int addr_to_ipv6addrstruct(const char *addrstring, char *resultstring, const siz
 };
 
 
+/*
+ * function stores an IPv6 address string into a structure
+ *
+ * in : *addrstring = IPv6 address
+ * out: *resultstring = error message
+ * out: ipv6addrp = changed IPv6 address structure
+ * ret: ==0: ok, !=0: error
+ */
+int addr_to_ipv6addrstruct(const char *addrstring, char *resultstring, const size_t resultstring_length, ipv6calc_ipv6addr *ipv6addrp) {
+	return(addr_to_ipv6addrstruct_tier(addrstring, resultstring, resultstring_length, ipv6addrp, IPV6ADDR_TYPEINFO_FULL));
+};
+
+
+/*
+ * function stores an IPv6 address string into a structure, typeinfo with cheap checks only
+ *  (use ipv6addr_gettypeinfo to retrieve IID random detection related bits)
+ *
+ * in : *addrstring = IPv6 address
+ * out: *resultstring = error message
+ * out: ipv6addrp = changed IPv6 address structure
+ * ret: ==0: ok, !=0: error
+ */
+int addr_to_ipv6addrstruct_basic(const char *addrstring, char *resultstring, const size_t resultstring_length, ipv6calc_ipv6addr *ipv6addrp) {
+	return(addr_to_ipv6addrstruct_tier(addrstring, resultstring, resultstring_length, ipv6addrp, IPV6ADDR_TYPEINFO_BASIC));
+};
+
+
 /*
  * stores the ipv6addr structure in an uncompressed IPv6 format string
  *
@@ -1518,12 +1865,12 @@ static int ipv6addrstruct_to_uncompaddr(const ipv6calc_ipv6addr *ipv6addrp, char
 	if ( ((ipv6addrp->typeinfo & (IPV6_ADDR_COMPATv4 | IPV6_ADDR_MAPPED | IPV6_ADDR_IID_32_63_HAS_IPV4)) != 0) && ((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_IID) == 0)) {
 		if ( (formatoptions & FORMATOPTION_printfulluncompressed) != 0 ) {
 			snprintf(tempstring, sizeof(tempstring), "%04x:%04x:%04x:%04x:%04x:%04x:%u.%u.%u.%u", \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 0), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 1), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 2), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 3), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 4), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 5), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 0), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 1), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 2), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 3), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 4), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 5), \
 				(unsigned int) ipv6addrp->in6_addr.s6_addr[12], \
 				(unsigned int) ipv6addrp->in6_addr.s6_addr[13], \
 				(unsigned int) ipv6addrp->in6_addr.s6_addr[14], \
@@ -1531,12 +1878,12 @@ static int ipv6addrstruct_to_uncompaddr(const ipv6calc_ipv6addr *ipv6addrp, char
 			);
 		} else {
 			snprintf(tempstring, sizeof(tempstring), "%x:%x:%x:%x:%x:%x:%u.%u.%u.%u", \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 0), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 1), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 2), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 3), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 4), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 5), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 0), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 1), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 2), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 3), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 4), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 5), \
 				(unsigned int) ipv6addrp->in6_addr.s6_addr[12], \
 				(unsigned int) ipv6addrp->in6_addr.s6_addr[13], \
 				(unsigned int) ipv6addrp->in6_addr.s6_addr[14], \
@@ -1546,25 +1893,25 @@ static int ipv6addrstruct_to_uncompaddr(const ipv6calc_ipv6addr *ipv6addrp, char
 	} else {
 		if ( (formatoptions & FORMATOPTION_printfulluncompressed) != 0 ) {
 			snprintf(tempstring, sizeof(tempstring), "%04x:%04x:%04x:%04x:%04x:%04x:%04x:%04x", \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 0), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 1), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 2), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 3), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 4), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 5), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 6), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 7)  \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 0), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 1), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 2), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 3), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 4), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 5), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 6), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 7)  \
 			);
 		} else {
 			snprintf(tempstring, sizeof(tempstring), "%x:%x:%x:%x:%x:%x:%x:%x", \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 0), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 1), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 2), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 3), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 4), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 5), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 6), \
-				(unsigned int) ipv6addr_getword(ipv6addrp, 7)  \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 0), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 1), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 2), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 3), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 4), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 5), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 6), \
+				(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 7)  \
 			);
 		};
 	};
@@ -1939,10 +2286,10 @@ int libipv6addr_ipv6addrstruct_to_tokenlsb64(const ipv6calc_ipv6addr *ipv6addrp,
 	
 	/* print array */
 	snprintf(resultstring, resultstring_length, "%04x%04x%04x%04x", \
-		(unsigned int) ipv6addr_getword(ipv6addrp, 4), \
-		(unsigned int) ipv6addr_getword(ipv6addrp, 5), \
-		(unsigned int) ipv6addr_getword(ipv6addrp, 6), \
-		(unsigned int) ipv6addr_getword(ipv6addrp, 7)  \
+		(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 4), \
+		(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 5), \
+		(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 6), \
+		(unsigned int) ipv6addr_getword_unchecked(ipv6addrp, 7)  \
 	);
 
 	if ( (formatoptions & FORMATOPTION_printlowercase) != 0 ) {
@@ -2084,8 +2431,8 @@ int libipv6addr_to_hex(const ipv6calc_ipv6addr *ipv6addrp, char *resultstring, c
 int ipv6addr_get_payload_anonymized_prefix(const ipv6calc_ipv6addr *ipv6addrp, const int payload_selector, uint32_t *result_ptr) {
 	uint32_t prefix[2], flags;
 
-	prefix[0] = ipv6addr_getdword(ipv6addrp, 0);
-	prefix[1] = ipv6addr_getdword(ipv6addrp, 1);
+	prefix[0] = ipv6addr_getdword_unchecked(ipv6addrp, 0);
+	prefix[1] = ipv6addr_getdword_unchecked(ipv6addrp, 1);
 
 	// retrieve flags
 	flags = UNPACK_XMS(prefix[ANON_PREFIX_FLAGS_DWORD], ANON_PREFIX_FLAGS_XOR, ANON_PREFIX_FLAGS_MASK, ANON_PREFIX_FLAGS_SHIFT);
@@ -2130,8 +2477,8 @@ uint32_t ipv6addr_get_payload_anonymized_iid(const ipv6calc_ipv6addr *ipv6addrp,
 	uint32_t iid[2];
 	uint32_t payload = 0;
 
-	iid[0] = ipv6addr_getdword(ipv6addrp, 2);
-	iid[1] = ipv6addr_getdword(ipv6addrp, 3);
+	iid[0] = ipv6addr_getdword_unchecked(ipv6addrp, 2);
+	iid[1] = ipv6addr_getdword_unchecked(ipv6addrp, 3);
 
 	DEBUGPRINT_WA(DEBUG_libipv6addr, "typeinfo=%08x iid[0]=%08x iid[1]=%08x", typeinfo, iid[0], iid[1]);
 
@@ -2188,15 +2535,17 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 
 	uint8_t bit_ul = 0;
 
-	DEBUGPRINT_WA(DEBUG_libipv6addr, "Called: addr=%08x %08x %08x %08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3));
-
-	ipv6addr_settype(ipv6addrp);
+	DEBUGPRINT_WA(DEBUG_libipv6addr, "Called: addr=%08x %08x %08x %08x", ipv6addr_getdword_unchecked(ipv6addrp, 0), ipv6addr_getdword_unchecked(ipv6addrp, 1), ipv6addr_getdword_unchecked(ipv6addrp, 2), ipv6addr_getdword_unchecked(ipv6addrp, 3));
 
 	if (method == ANON_METHOD_ZEROIZE) {
+		/* IID random detection only required in special cases, see below */
+		ipv6addr_settype_basic(ipv6addrp);
 		zeroize_prefix = 1;
+	} else {
+		ipv6addr_settype(ipv6addrp);
 	};
 
-	if ( (ipv6calc_debug & DEBUG_libipv6addr) != 0 ) {	// ipv6calc_debug usage ok
+	if (IPV6CALC_DEBUG_ACTIVE(DEBUG_libipv6addr)) {
 		libipv6calc_anon_infostring(tempstring, sizeof(tempstring), ipv6calc_anon_set);
 		DEBUGPRINT_WA(DEBUG_libipv6addr, "Anonymize IPv6 address flags: %s", tempstring);
 	};
@@ -2265,7 +2614,7 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 	/* prefix handling */
 	if ( ((ipv6addrp->typeinfo & (IPV6_ADDR_SITELOCAL | IPV6_ADDR_ULUA | IPV6_NEW_ADDR_AGU)) != 0) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO | IPV6_NEW_ADDR_ORCHID)) == 0) ) {
 		/* prefix included */
-		DEBUGPRINT_WA(DEBUG_libipv6addr, "Prefix: pref=%08x %08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1));
+		DEBUGPRINT_WA(DEBUG_libipv6addr, "Prefix: pref=%08x %08x", ipv6addr_getdword_unchecked(ipv6addrp, 0), ipv6addr_getdword_unchecked(ipv6addrp, 1));
 
 		if (((ipv6addrp->typeinfo & IPV6_NEW_ADDR_AGU) != 0) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_6TO4)) == 0) \
 		    && ((method == ANON_METHOD_KEEPTYPEASNCC) || (method == ANON_METHOD_KEEPTYPEGEONAMEID))) {
@@ -2406,9 +2755,9 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 
 			if (mask_ipv6 < 64 && mask_ipv6 > 32) {
 				if (zeroize_prefix != 0) {
-					ipv6addr_setdword(ipv6addrp, 1, ipv6addr_getdword(ipv6addrp, 1) & (0xffffffffu << ((unsigned int) 64 - mask_ipv6)));
+					ipv6addr_setdword(ipv6addrp, 1, ipv6addr_getdword_unchecked(ipv6addrp, 1) & (0xffffffffu << ((unsigned int) 64 - mask_ipv6)));
 				} else {
-					ipv6addr_setdword(ipv6addrp, 1, (ipv6addr_getdword(ipv6addrp, 1) & (0xffffffffu << ((unsigned int) 64 - mask_ipv6))) | ((ANON_TOKEN_VALUE_00_31 | (ANON_TOKEN_VALUE_00_31 >> 16)) & ((0xffffffffu >> ((unsigned int) mask_ipv6 - 32)))));
+					ipv6addr_setdword(ipv6addrp, 1, (ipv6addr_getdword_unchecked(ipv6addrp, 1) & (0xffffffffu << ((unsigned int) 64 - mask_ipv6))) | ((ANON_TOKEN_VALUE_00_31 | (ANON_TOKEN_VALUE_00_31 >> 16)) & ((0xffffffffu >> ((unsigned int) mask_ipv6 - 32)))));
 					anonymized_prefix_nibbles = (64 - mask_ipv6) / 4;
 				};
 			} else if (mask_ipv6 == 32) {
@@ -2421,10 +2770,10 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 			} else if (mask_ipv6 < 32 && mask_ipv6 >= 16) {
 				if (zeroize_prefix != 0) {
 					ipv6addr_setdword(ipv6addrp, 1, 0u);
-					ipv6addr_setdword(ipv6addrp, 0, ipv6addr_getdword(ipv6addrp, 0) & (0xffffffffu << ((unsigned int) 32 - mask_ipv6)));
+					ipv6addr_setdword(ipv6addrp, 0, ipv6addr_getdword_unchecked(ipv6addrp, 0) & (0xffffffffu << ((unsigned int) 32 - mask_ipv6)));
 				} else {
 					ipv6addr_setdword(ipv6addrp, 1, ANON_TOKEN_VALUE_00_31 | (ANON_TOKEN_VALUE_00_31 >> 16));
-					ipv6addr_setdword(ipv6addrp, 0, (ipv6addr_getdword(ipv6addrp, 0) & (0xffffffffu << ((unsigned int) 32 - mask_ipv6))) | ((ANON_TOKEN_VALUE_00_31 | (ANON_TOKEN_VALUE_00_31 >> 16)) & ((0xffffffffu >> ((unsigned int) mask_ipv6)))));
+					ipv6addr_setdword(ipv6addrp, 0, (ipv6addr_getdword_unchecked(ipv6addrp, 0) & (0xffffffffu << ((unsigned int) 32 - mask_ipv6))) | ((ANON_TOKEN_VALUE_00_31 | (ANON_TOKEN_VALUE_00_31 >> 16)) & ((0xffffffffu >> ((unsigned int) mask_ipv6)))));
 					anonymized_prefix_nibbles = (64 - mask_ipv6) / 4;
 				};
 			};
@@ -2432,12 +2781,12 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 
 		/* restore prefix in special cases */
 		if ( ((ipv6addrp->typeinfo & IPV6_ADDR_SITELOCAL) != 0) && (mask_ipv6 < 10) ) { 
-			ipv6addr_setword(ipv6addrp, 0, ipv6addr_getword(ipv6addrp, 1) | 0xfec0u);
+			ipv6addr_setword(ipv6addrp, 0, ipv6addr_getword_unchecked(ipv6addrp, 1) | 0xfec0u);
 		} else if ( ((ipv6addrp->typeinfo & IPV6_ADDR_ULUA) != 0) && (mask_ipv6 < 7) ) {
-			ipv6addr_setoctet(ipv6addrp, 0, ipv6addr_getoctet(ipv6addrp, 0) | 0xfdu);
+			ipv6addr_setoctet(ipv6addrp, 0, ipv6addr_getoctet_unchecked(ipv6addrp, 0) | 0xfdu);
 		};
 
-		DEBUGPRINT_WA(DEBUG_libipv6addr, "Prefix: pref=%08x %08x (anonymized)", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1));
+		DEBUGPRINT_WA(DEBUG_libipv6addr, "Prefix: pref=%08x %08x (anonymized)", ipv6addr_getdword_unchecked(ipv6addrp, 0), ipv6addr_getdword_unchecked(ipv6addrp, 1));
 	};
 
 InterfaceIdentifier:
@@ -2453,15 +2802,15 @@ InterfaceIdentifier:
 				zeroize_iid = 1;
 			} else {
 				/* set anon interface ID, include shifted OUI bytes */
-				DEBUGPRINT_WA(DEBUG_libipv6addr, "Anonymize IPv6 address: OUI=%02x:%02x:%02x", ipv6addr_getoctet(ipv6addrp, 8) & 0xfc, ipv6addr_getoctet(ipv6addrp, 9), ipv6addr_getoctet(ipv6addrp, 10));
+				DEBUGPRINT_WA(DEBUG_libipv6addr, "Anonymize IPv6 address: OUI=%02x:%02x:%02x", ipv6addr_getoctet_unchecked(ipv6addrp, 8) & 0xfc, ipv6addr_getoctet_unchecked(ipv6addrp, 9), ipv6addr_getoctet_unchecked(ipv6addrp, 10));
 
 				mac_clearall(&macaddr);
-				macaddr.addr[0] = ipv6addr_getoctet(ipv6addrp,  8) ^ 0x2;
-				macaddr.addr[1] = ipv6addr_getoctet(ipv6addrp,  9);
-				macaddr.addr[2] = ipv6addr_getoctet(ipv6addrp, 10);
-				macaddr.addr[3] = ipv6addr_getoctet(ipv6addrp, 13);
-				macaddr.addr[4] = ipv6addr_getoctet(ipv6addrp, 14);
-				macaddr.addr[5] = ipv6addr_getoctet(ipv6addrp, 15);
+				macaddr.addr[0] = ipv6addr_getoctet_unchecked(ipv6addrp,  8) ^ 0x2;
+				macaddr.addr[1] = ipv6addr_getoctet_unchecked(ipv6addrp,  9);
+				macaddr.addr[2] = ipv6addr_getoctet_unchecked(ipv6addrp, 10);
+				macaddr.addr[3] = ipv6addr_getoctet_unchecked(ipv6addrp, 13);
+				macaddr.addr[4] = ipv6addr_getoctet_unchecked(ipv6addrp, 14);
+				macaddr.addr[5] = ipv6addr_getoctet_unchecked(ipv6addrp, 15);
 				macaddr.flag_valid = 1;
 
 				map_value = libieee_map_oui_macaddr(&macaddr) ^ 0x00020000;
@@ -2474,7 +2823,13 @@ InterfaceIdentifier:
 				calculate_checksum = 1;
 			};
 		} else {
-			if ( (ipv6addrp->typeinfo & IPV6_NEW_ADDR_IID_RANDOM) != 0 ) {
+			if ((method == ANON_METHOD_ZEROIZE) \
+			    && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_SOLICITED_NODE | IPV6_NEW_ADDR_IID_ISATAP | IPV6_NEW_ADDR_6TO4_MICROSOFT)) == 0) \
+			    && (((ipv6addrp->typeinfo & IPV6_ADDR_LINKLOCAL) == 0) || (ipv6addr_getdword_unchecked(ipv6addrp, 2) != 0) || (ipv6addr_getword_unchecked(ipv6addrp, 6) == 0)) \
+			) {
+				/* random, EUI-64 and local scope IIDs are zeroized in the same way, no IID random detection required */
+				zeroize_iid = 1;
+			} else if ( (ipv6addr_gettypeinfo(ipv6addrp) & IPV6_NEW_ADDR_IID_RANDOM) != 0 ) {
 				if (method == ANON_METHOD_ZEROIZE) {
 					/* mask ID according to mask_eui64 */
 					zeroize_iid = 1;
@@ -2494,14 +2849,14 @@ InterfaceIdentifier:
 					zeroize_iid = 1;
 				} else {
 					libeui64_clearall(&eui64addr);
-					eui64addr.addr[0] = ipv6addr_getoctet(ipv6addrp,  8) ^ 0x2;
-					eui64addr.addr[1] = ipv6addr_getoctet(ipv6addrp,  9);
-					eui64addr.addr[2] = ipv6addr_getoctet(ipv6addrp, 10);
-					eui64addr.addr[3] = ipv6addr_getoctet(ipv6addrp, 11);
-					eui64addr.addr[4] = ipv6addr_getoctet(ipv6addrp, 12);
-					eui64addr.addr[5] = ipv6addr_getoctet(ipv6addrp, 13);
-					eui64addr.addr[6] = ipv6addr_getoctet(ipv6addrp, 14);
-					eui64addr.addr[7] = ipv6addr_getoctet(ipv6addrp, 15);
+					eui64addr.addr[0] = ipv6addr_getoctet_unchecked(ipv6addrp,  8) ^ 0x2;
+					eui64addr.addr[1] = ipv6addr_getoctet_unchecked(ipv6addrp,  9);
+					eui64addr.addr[2] = ipv6addr_getoctet_unchecked(ipv6addrp, 10);
+					eui64addr.addr[3] = ipv6addr_getoctet_unchecked(ipv6addrp, 11);
+					eui64addr.addr[4] = ipv6addr_getoctet_unchecked(ipv6addrp, 12);
+					eui64addr.addr[5] = ipv6addr_getoctet_unchecked(ipv6addrp, 13);
+					eui64addr.addr[6] = ipv6addr_getoctet_unchecked(ipv6addrp, 14);
+					eui64addr.addr[7] = ipv6addr_getoctet_unchecked(ipv6addrp, 15);
 					eui64addr.flag_valid = 1;
 
 					map_value = libieee_map_oui_eui64addr(&eui64addr) ^ 0x00020000;
@@ -2529,7 +2884,7 @@ InterfaceIdentifier:
 						};
 						libipv4addr_anonymize(&ipv4addr, mask_ipv4, method);
 
-						DEBUGPRINT_WA(DEBUG_libipv6addr, "ISATAP includes IPv4 address: IPv4=%d.%d.%d.%d, anonymized: %d.%d.%d.%d", ipv6addr_getoctet(ipv6addrp, 12), ipv6addr_getoctet(ipv6addrp, 13), ipv6addr_getoctet(ipv6addrp, 14), ipv6addr_getoctet(ipv6addrp, 15), ipv4addr_getoctet(&ipv4addr, 0), ipv4addr_getoctet(&ipv4addr, 1), ipv4addr_getoctet(&ipv4addr, 2), ipv4addr_getoctet(&ipv4addr, 3));
+						DEBUGPRINT_WA(DEBUG_libipv6addr, "ISATAP includes IPv4 address: IPv4=%d.%d.%d.%d, anonymized: %d.%d.%d.%d", ipv6addr_getoctet_unchecked(ipv6addrp, 12), ipv6addr_getoctet_unchecked(ipv6addrp, 13), ipv6addr_getoctet_unchecked(ipv6addrp, 14), ipv6addr_getoctet_unchecked(ipv6addrp, 15), ipv4addr_getoctet_unchecked(&ipv4addr, 0), ipv4addr_getoctet_unchecked(&ipv4addr, 1), ipv4addr_getoctet_unchecked(&ipv4addr, 2), ipv4addr_getoctet_unchecked(&ipv4addr, 3));
 
 						/* store back */
 						for (i = 0; i <= 3; i++) {
@@ -2540,11 +2895,11 @@ InterfaceIdentifier:
 							// nothing to do, IPv4 address already anonymized
 						} else {
 							iid[0] = ANON_TOKEN_VALUE_00_31 | ANON_IID_ISATAP_VALUE_00_31;
-							iid[1] = (ipv6addr_getoctet(ipv6addrp, 12) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 16)) | (ipv6addr_getoctet(ipv6addrp, 13) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 8)) | (ipv6addr_getoctet(ipv6addrp, 14) << (ANON_IID_ISATAP_PAYLOAD_SHIFT));
+							iid[1] = (ipv6addr_getoctet_unchecked(ipv6addrp, 12) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 16)) | (ipv6addr_getoctet_unchecked(ipv6addrp, 13) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 8)) | (ipv6addr_getoctet_unchecked(ipv6addrp, 14) << (ANON_IID_ISATAP_PAYLOAD_SHIFT));
 							iid[1] |= ANON_IID_ISATAP_TYPE_IPV4_VALUE_32_63;
 							calculate_checksum = 1;
 						};
-					} else if ((ipv6addr_getoctet(ipv6addrp, 11) == 0xff) && (ipv6addr_getoctet(ipv6addrp, 12) == 0xfe)) {
+					} else if ((ipv6addr_getoctet_unchecked(ipv6addrp, 11) == 0xff) && (ipv6addr_getoctet_unchecked(ipv6addrp, 12) == 0xfe)) {
 						/* vendor ID included */
 						if (method == ANON_METHOD_ZEROIZE) {
 							/* zero'ise unique ID */
@@ -2554,7 +2909,7 @@ InterfaceIdentifier:
 							ipv6addr_setoctet(ipv6addrp, 15, 0x0u);
 						} else {
 							iid[0] = ANON_TOKEN_VALUE_00_31 | ANON_IID_ISATAP_VALUE_00_31;
-							iid[1] = (ipv6addr_getoctet(ipv6addrp, 13) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 16));
+							iid[1] = (ipv6addr_getoctet_unchecked(ipv6addrp, 13) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 16));
 							iid[1] |= ANON_IID_ISATAP_TYPE_VENDOR_VALUE_32_63;
 							calculate_checksum = 1;
 						};
@@ -2565,7 +2920,7 @@ InterfaceIdentifier:
 							zeroize_iid = 1;
 						} else {
 							iid[0] = ANON_TOKEN_VALUE_00_31 | ANON_IID_ISATAP_VALUE_00_31;
-							iid[1] = (ipv6addr_getoctet(ipv6addrp, 11) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 16)) | (ipv6addr_getoctet(ipv6addrp, 12) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 8)) | (ipv6addr_getoctet(ipv6addrp, 13) << (ANON_IID_ISATAP_PAYLOAD_SHIFT));
+							iid[1] = (ipv6addr_getoctet_unchecked(ipv6addrp, 11) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 16)) | (ipv6addr_getoctet_unchecked(ipv6addrp, 12) << (ANON_IID_ISATAP_PAYLOAD_SHIFT + 8)) | (ipv6addr_getoctet_unchecked(ipv6addrp, 13) << (ANON_IID_ISATAP_PAYLOAD_SHIFT));
 							iid[1] |= ANON_IID_ISATAP_TYPE_EXTID_VALUE_32_63;
 							calculate_checksum = 1;
 						};
@@ -2585,7 +2940,7 @@ InterfaceIdentifier:
 						ipv6addr_setdword(ipv6addrp, 3, iid[1]);
 					};
 
-				} else if ( ( ( (ipv6addrp->typeinfo & IPV6_ADDR_LINKLOCAL) != 0) && (ipv6addr_getdword(ipv6addrp, 2) == 0 && ipv6addr_getword(ipv6addrp, 6) != 0)) )   {
+				} else if ( ( ( (ipv6addrp->typeinfo & IPV6_ADDR_LINKLOCAL) != 0) && (ipv6addr_getdword_unchecked(ipv6addrp, 2) == 0 && ipv6addr_getword_unchecked(ipv6addrp, 6) != 0)) )   {
 					/* fe80:: must have 0000:0000:xxxx:yyyy where xxxx > 0 */
 					for (i = 0; i <= 3; i++) {
 						ipv4addr_setoctet(&ipv4addr, (unsigned int) i, (unsigned int) ipv6addr_getoctet(ipv6addrp, (unsigned int) (i + 12)));
@@ -2613,7 +2968,7 @@ InterfaceIdentifier:
 							};
 						} else {
 							iid[0] = ANON_TOKEN_VALUE_00_31 | ANON_IID_IPV4_VALUE_00_31;
-							iid[1] = ANON_IID_IPV4_VALUE_32_63 | (ipv4addr_getoctet(&ipv4addr, 0) << (ANON_IID_IPV4_PAYLOAD_SHIFT + 16)) | (ipv4addr_getoctet(&ipv4addr, 1) << (ANON_IID_IPV4_PAYLOAD_SHIFT + 8)) | (ipv4addr_getoctet(&ipv4addr, 2) << (ANON_IID_IPV4_PAYLOAD_SHIFT));
+							iid[1] = ANON_IID_IPV4_VALUE_32_63 | (ipv4addr_getoctet_unchecked(&ipv4addr, 0) << (ANON_IID_IPV4_PAYLOAD_SHIFT + 16)) | (ipv4addr_getoctet_unchecked(&ipv4addr, 1) << (ANON_IID_IPV4_PAYLOAD_SHIFT + 8)) | (ipv4addr_getoctet_unchecked(&ipv4addr, 2) << (ANON_IID_IPV4_PAYLOAD_SHIFT));
 
 							ipv6addr_setdword(ipv6addrp, 2, iid[0]);
 							ipv6addr_setdword(ipv6addrp, 3, iid[1]);
@@ -2659,10 +3014,10 @@ InterfaceIdentifier:
 		if (zeroize_prefix != 0) {
 			ipv6addr_setword(ipv6addrp, 3, 0x0u);
 			ipv6addr_setword(ipv6addrp, 2, 0x0u);
-			ipv6addr_setword(ipv6addrp, 1, ipv6addr_getword(ipv6addrp, 1) & 0xFFF0);
+			ipv6addr_setword(ipv6addrp, 1, ipv6addr_getword_unchecked(ipv6addrp, 1) & 0xFFF0);
 		} else {
 			ipv6addr_setdword(ipv6addrp, 1, (ANON_TOKEN_VALUE_00_31 | (ANON_TOKEN_VALUE_00_31 >> 16)));
-			ipv6addr_setword(ipv6addrp, 1, (ipv6addr_getword(ipv6addrp, 1) & 0xFFF0) | ((ANON_TOKEN_VALUE_00_31 >> 16) & 0xF));
+			ipv6addr_setword(ipv6addrp, 1, (ipv6addr_getword_unchecked(ipv6addrp, 1) & 0xFFF0) | ((ANON_TOKEN_VALUE_00_31 >> 16) & 0xF));
 			anonymized_prefix_nibbles = (64 - 28) / 4;
 		};
 	};
@@ -2679,14 +3034,14 @@ InterfaceIdentifier:
 
 		libeui64_clearall(&eui64addr);
 
-		eui64addr.addr[0] = ipv6addr_getoctet(ipv6addrp,  8) ^ 0x2;
-		eui64addr.addr[1] = ipv6addr_getoctet(ipv6addrp,  9);
-		eui64addr.addr[2] = ipv6addr_getoctet(ipv6addrp, 10);
-		eui64addr.addr[3] = ipv6addr_getoctet(ipv6addrp, 11);
-		eui64addr.addr[4] = ipv6addr_getoctet(ipv6addrp, 12);
-		eui64addr.addr[5] = ipv6addr_getoctet(ipv6addrp, 13);
-		eui64addr.addr[6] = ipv6addr_getoctet(ipv6addrp, 14);
-		eui64addr.addr[7] = ipv6addr_getoctet(ipv6addrp, 15);
+		eui64addr.addr[0] = ipv6addr_getoctet_unchecked(ipv6addrp,  8) ^ 0x2;
+		eui64addr.addr[1] = ipv6addr_getoctet_unchecked(ipv6addrp,  9);
+		eui64addr.addr[2] = ipv6addr_getoctet_unchecked(ipv6addrp, 10);
+		eui64addr.addr[3] = ipv6addr_getoctet_unchecked(ipv6addrp, 11);
+		eui64addr.addr[4] = ipv6addr_getoctet_unchecked(ipv6addrp, 12);
+		eui64addr.addr[5] = ipv6addr_getoctet_unchecked(ipv6addrp, 13);
+		eui64addr.addr[6] = ipv6addr_getoctet_unchecked(ipv6addrp, 14);
+		eui64addr.addr[7] = ipv6addr_getoctet_unchecked(ipv6addrp, 15);
 		eui64addr.flag_valid = 1;
 
 		bit_ul = eui64addr.addr[0] & 0x02;
@@ -2715,7 +3070,7 @@ InterfaceIdentifier:
 			/* fill amount of nibbles into IID lead token */
 			DEBUGPRINT_WA(DEBUG_libipv6addr, "Store amount of anonymized nibbles to IID lead token: %d", anonymized_prefix_nibbles);
 
-			ipv6addr_setoctet(ipv6addrp, 9, ipv6addr_getoctet(ipv6addrp, 9) | (anonymized_prefix_nibbles << 4));
+			ipv6addr_setoctet(ipv6addrp, 9, ipv6addr_getoctet_unchecked(ipv6addrp, 9) | (anonymized_prefix_nibbles << 4));
 		};
 
 		ipv6addr_set_checksum_anonymized_iid(ipv6addrp);
@@ -2726,7 +3081,7 @@ InterfaceIdentifier:
 		ipv6addrp->typeinfo |= IPV6_ADDR_ANONYMIZED_PREFIX;
 	};
 
-	DEBUGPRINT_WA(DEBUG_libipv6addr, "Result: addr=%08x %08x %08x %08x (anonymized)", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3));
+	DEBUGPRINT_WA(DEBUG_libipv6addr, "Result: addr=%08x %08x %08x %08x (anonymized)", ipv6addr_getdword_unchecked(ipv6addrp, 0), ipv6addr_getdword_unchecked(ipv6addrp, 1), ipv6addr_getdword_unchecked(ipv6addrp, 2), ipv6addr_getdword_unchecked(ipv6addrp, 3));
 
 	return(0);
 };
@@ -210,6 +210,12 @@
 #define ANON_PREFIX_PAYLOAD_GEONAMEID_TYPE	4
 
 
+/* typeinfo tiers (flag_typeinfo) */
+#define IPV6ADDR_TYPEINFO_NONE		0	/* typeinfo not set */
+#define IPV6ADDR_TYPEINFO_FULL		1	/* typeinfo complete */
+#define IPV6ADDR_TYPEINFO_BASIC		2	/* typeinfo without IID random detection, completed by ipv6addr_gettypeinfo */
+
+
 /* IPv6 address storage structure */
 typedef struct {
 	struct   in6_addr in6_addr;	/* in6_addr structure */
@@ -217,7 +223,7 @@ typedef struct {
 	int      flag_prefixuse;	/* =1: prefix length in use */
 	uint32_t typeinfo;		/* address typeinfo/scope */
 	uint32_t typeinfo2;		/* address typeinfo2 */
-	int8_t   flag_typeinfo;		/* =1: typeinfo valid */
+	int8_t   flag_typeinfo;		/* =1: typeinfo valid, =2: basic typeinfo valid (see IPV6ADDR_TYPEINFO_*) */
 	uint8_t  bit_start;		/* start of bit */
 	uint8_t  bit_end;		/* end of bit */
 	int8_t   flag_startend_use;	/* =1: start or end of bit in use */
@@ -347,6 +353,24 @@ typedef struct {
 /* text representations -> libipv6addr.c */
 
 
+
+/* inline accessors without range check for internal hot paths, caller has to take care of range */
+static inline uint8_t ipv6addr_getoctet_unchecked(const ipv6calc_ipv6addr *ipv6addrp, const unsigned int numoctet) {
+	return (ipv6addrp->in6_addr.s6_addr[numoctet]);
+};
+
+static inline uint16_t ipv6addr_getword_unchecked(const ipv6calc_ipv6addr *ipv6addrp, const unsigned int numword) {
+	return ((uint16_t) ((ipv6addrp->in6_addr.s6_addr[numword * 2] << 8) | ipv6addrp->in6_addr.s6_addr[numword * 2 + 1]));
+};
+
+static inline uint32_t ipv6addr_getdword_unchecked(const ipv6calc_ipv6addr *ipv6addrp, const unsigned int numdword) {
+	return (((uint32_t) ipv6addrp->in6_addr.s6_addr[numdword * 4] << 24) \
+		| ((uint32_t) ipv6addrp->in6_addr.s6_addr[numdword * 4 + 1] << 16) \
+		| ((uint32_t) ipv6addrp->in6_addr.s6_addr[numdword * 4 + 2] << 8) \
+		| ((uint32_t) ipv6addrp->in6_addr.s6_addr[numdword * 4 + 3]));
+};
+
+
 #endif
 
 
@@ -373,9 +397,12 @@ extern void ipv6addr_copy(ipv6calc_ipv6addr *ipv6addrp_dst, const ipv6calc_ipv6a
 
 extern int ipv6addr_compare(const ipv6calc_ipv6addr *ipv6addrp1, const ipv6calc_ipv6addr *ipv6addrp2, const uint16_t compare_flags);
 
-extern void ipv6addr_settype(ipv6calc_ipv6addr *ipv6addrp);
+extern void     ipv6addr_settype(ipv6calc_ipv6addr *ipv6addrp);
+extern void     ipv6addr_settype_basic(ipv6calc_ipv6addr *ipv6addrp);
+extern uint32_t ipv6addr_gettypeinfo(ipv6calc_ipv6addr *ipv6addrp);
 
 extern int  addr_to_ipv6addrstruct(const char *addrstring, char *resultstring, const size_t resultstring_length, ipv6calc_ipv6addr *ipv6addrp);
+extern int  addr_to_ipv6addrstruct_basic(const char *addrstring, char *resultstring, const size_t resultstring_length, ipv6calc_ipv6addr *ipv6addrp);
 extern int  addrliteral_to_ipv6addrstruct(const char *addrstring, char *resultstring, const size_t resultstring_length, ipv6calc_ipv6addr *ipv6addrp);
 
 extern int  libipv6addr_ipv6addrstruct_to_uncompaddr(const ipv6calc_ipv6addr *ipv6addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions);
@@ -395,6 +422,8 @@ extern uint32_t ipv6addr_get_payload_anonymized_iid(const ipv6calc_ipv6addr *ipv
 extern int      ipv6addr_get_payload_anonymized_prefix(const ipv6calc_ipv6addr *ipv6addrp, const int payload_selector, uint32_t *result_ptr);
 
 extern int ipv6addr_iidrandomdetection(const ipv6calc_ipv6addr *ipv6addrp, s_iid_statistics *variancesp);
+extern int ipv6addr_iidrandomdetection_fast(const ipv6calc_ipv6addr *ipv6addrp);
+extern int ipv6addr_iidrandomdetection_cache_init(const unsigned int entries);
 
 extern int  ipv6addr_filter(const ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_filter_ipv6addr *filter);
 extern int  ipv6addr_filter_parse(s_ipv6calc_filter_ipv6addr *filter, const char *token);
@@ -12,6 +12,8 @@
 
 #define _libipv6calcdebug_h_
 
+#include "config.h"
+
 #define DEBUG_ipv6calc_ALL				-1
 
 //reserved for debug levels of dedicated binary 	0x00000001l
@@ -51,9 +53,16 @@
 #define DEBUG_libipv6calc_db_wrapper_BuiltIn		0x40000000l
 #define DEBUG_libipv6calc_db_wrapper_MMDB		0x80000000l
 
+/* check for active debug level, constant false if debug tracing is disabled by configure */
+#ifdef DISABLE_DEBUG_TRACE
+#define IPV6CALC_DEBUG_ACTIVE(d)	(0 && ((d) != 0))
+#else
+#define IPV6CALC_DEBUG_ACTIVE(d)	((ipv6calc_debug & (d)) != 0)
+#endif
+
 /* debug print with args */
 #define DEBUGPRINT_WA(d, t, ...)	\
-	if ((ipv6calc_debug & (d)) != 0) { \
+	if (IPV6CALC_DEBUG_ACTIVE(d)) { \
 		if (ipv6calc_debug == DEBUG_ipv6calc_ALL) { \
 			fprintf(stderr, "%s/%s:%d[0x%08lx]: " t "\n", __FILE__, __func__, __LINE__, d, __VA_ARGS__); \
 		} else { \
@@ -63,7 +72,7 @@
 
 /* debug print no args */
 #define DEBUGPRINT_NA(d, t)		\
-	if ((ipv6calc_debug & (d)) != 0) { \
+	if (IPV6CALC_DEBUG_ACTIVE(d)) { \
 		if (ipv6calc_debug == DEBUG_ipv6calc_ALL) { \
 			fprintf(stderr, "%s/%s:%d[0x%08lx]: " t "\n", __FILE__, __func__, __LINE__, d); \
 		} else { \
@@ -80,7 +89,7 @@
 	fprintf(stderr, "%s/%s:%d: " t "\n", __FILE__, __func__, __LINE__);
 
 /* begin/end of debug section */
-#define DEBUGSECTION_BEGIN(d)	if ((ipv6calc_debug & (d)) != 0) {
+#define DEBUGSECTION_BEGIN(d)	if (IPV6CALC_DEBUG_ACTIVE(d)) {
 #define DEBUGSECTION_ELSE	} else {
 #define DEBUGSECTION_END	};
 
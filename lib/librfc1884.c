@@ -117,166 +117,215 @@ int ipv6addrstruct_to_compaddr(const ipv6calc_ipv6addr *ipv6addrp, char *results
 	return (retval);
 };
 	
-int librfc1884_ipv6addrstruct_to_compaddr(const ipv6calc_ipv6addr *ipv6addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions) {
-	char tempstring[IPV6CALC_STRING_MAX] = "", tempstring2[IPV6CALC_STRING_MAX] = "";
-	int retval = 1;
-	int zstart = -1, zend = -1, tstart = -1, tend = -1, i, w_max = 7;
-	unsigned int s;
+/*
+ * longest block of '0' words (at least 2), leading has precedence
+ *  index: bit i set if word i is '0'
+ *  value: start word << 4 | amount of words (0: no block)
+ */
+static const uint8_t librfc1884_zero_block[256] = {
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03, 0x32, 0x32, 0x32, 0x02, 0x23, 0x23, 0x14, 0x05,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+	0x42, 0x42, 0x42, 0x02, 0x42, 0x42, 0x12, 0x03, 0x33, 0x33, 0x33, 0x33, 0x24, 0x24, 0x15, 0x06,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03, 0x32, 0x32, 0x32, 0x02, 0x23, 0x23, 0x14, 0x05,
+	0x52, 0x52, 0x52, 0x02, 0x52, 0x52, 0x12, 0x03, 0x52, 0x52, 0x52, 0x02, 0x22, 0x22, 0x13, 0x04,
+	0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x03, 0x34, 0x34, 0x34, 0x34, 0x25, 0x25, 0x16, 0x07,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03, 0x32, 0x32, 0x32, 0x02, 0x23, 0x23, 0x14, 0x05,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x13, 0x04,
+	0x42, 0x42, 0x42, 0x02, 0x42, 0x42, 0x12, 0x03, 0x33, 0x33, 0x33, 0x33, 0x24, 0x24, 0x15, 0x06,
+	0x62, 0x62, 0x62, 0x02, 0x62, 0x62, 0x12, 0x03, 0x62, 0x62, 0x62, 0x02, 0x22, 0x22, 0x13, 0x04,
+	0x62, 0x62, 0x62, 0x02, 0x62, 0x62, 0x12, 0x03, 0x32, 0x32, 0x32, 0x02, 0x23, 0x23, 0x14, 0x05,
+	0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x03, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x13, 0x04,
+	0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x35, 0x35, 0x35, 0x35, 0x26, 0x26, 0x17, 0x08,
+};
+
+static const char librfc1884_hexdigits[] = "0123456789abcdef";
+
+
+/*
+ * append 16-bit value in hex without leading zeros
+ *
+ * in : p = pointer to buffer
+ *      w = value
+ * ret: pointer behind appended text
+ */
+static char *librfc1884_append_hex16(char *p, const unsigned int w) {
+	int n, k;
+	unsigned int v = w;
+
+	n = 1 + (w > 0xf) + (w > 0xff) + (w > 0xfff);
+
+	for (k = n - 1; k >= 0; k--) {
+		p[k] = librfc1884_hexdigits[v & 0xf];
+		v >>= 4;
+	};
+
+	return (p + n);
+};
+
+
+/*
+ * append value (0-999) in decimal without leading zeros
+ *
+ * in : p = pointer to buffer
+ *      v = value
+ * ret: pointer behind appended text
+ */
+static char *librfc1884_append_dec(char *p, const unsigned int v) {
+	if (v >= 100) {
+		*p++ = '0' + (v / 100);
+	};
+	if (v >= 10) {
+		*p++ = '0' + ((v / 10) % 10);
+	};
+	*p++ = '0' + (v % 10);
+
+	return (p);
+};
+
+
+/*
+ * append IPv4 address stored in octets 12-15 in dotted decimal
+ *
+ * in : p = pointer to buffer
+ *      ipv6addrp = IPv6 address
+ * ret: pointer behind appended text
+ */
+static char *librfc1884_append_ipv4(char *p, const ipv6calc_ipv6addr *ipv6addrp) {
+	int i;
+
+	for (i = 12; i <= 15; i++) {
+		p = librfc1884_append_dec(p, (unsigned int) ipv6addrp->in6_addr.s6_addr[i]);
+		*p++ = (i < 15) ? '.' : '\0';
+	};
+
+	return (p - 1);
+};
+
+
+/*
+ * IPv6addrstruct to compressed format text (RFC 5952), written directly into buffer
+ *
+ *  compress the biggest '0' block, leading has precedence
+ *
+ * in : *ipv6addrp = IPv6 address structure
+ * out: *resultstring = result (at least RFC1884_COMPADDR_STRING_MAX bytes)
+ * ret: length of result
+ */
+static size_t librfc1884_compaddr_text(const ipv6calc_ipv6addr *ipv6addrp, char *resultstring) {
+	char *p = resultstring;
+	uint16_t w[8];
+	unsigned int i, mask = 0, zblock;
+	int zstart = -1, zend = -1, w_max = 7;
+
+	for (i = 0; i < 8; i++) {
+		w[i] = (ipv6addrp->in6_addr.s6_addr[i * 2] << 8) | ipv6addrp->in6_addr.s6_addr[i * 2 + 1];
+		mask |= (unsigned int) (w[i] == 0) << i;
+	};
 
-	DEBUGPRINT_WA(DEBUG_librfc1884, "typeinfo of IPv6 address: %08x", (unsigned int) ipv6addrp->typeinfo);
-	
 	if ( (ipv6addrp->typeinfo & IPV6_ADDR_COMPATv4) != 0 ) {
 		/* compatv4 address */
-			
 		DEBUGPRINT_NA(DEBUG_librfc1884, "IPV6_ADDR_COMPATv4 type - fast conversion");
-	
-		snprintf(tempstring, sizeof(tempstring), "::%u.%u.%u.%u", (unsigned int) ipv6addrp->in6_addr.s6_addr[12], (unsigned int) ipv6addrp->in6_addr.s6_addr[13], (unsigned int) ipv6addrp->in6_addr.s6_addr[14], (unsigned int) ipv6addrp->in6_addr.s6_addr[15]);
-		retval = 0;
+		*p++ = ':';
+		*p++ = ':';
+		p = librfc1884_append_ipv4(p, ipv6addrp);
 	} else if ( (ipv6addrp->typeinfo & IPV6_ADDR_MAPPED) != 0 ) {
 		/* mapped address */
-			
 		DEBUGPRINT_NA(DEBUG_librfc1884, "IPV6_ADDR_MAPPED type - fast conversion");
-		
-		snprintf(tempstring, sizeof(tempstring), "::%x:%u.%u.%u.%u", (unsigned int) ipv6addr_getword(ipv6addrp, 5), (unsigned int) ipv6addrp->in6_addr.s6_addr[12], (unsigned int) ipv6addrp->in6_addr.s6_addr[13], (unsigned int) ipv6addrp->in6_addr.s6_addr[14], (unsigned int) ipv6addrp->in6_addr.s6_addr[15]);
-		retval = 0;
-	} else if ( (ipv6addr_getdword(ipv6addrp, 0) == 0) && (ipv6addr_getdword(ipv6addrp, 1) == 0) && (ipv6addr_getdword(ipv6addrp, 2) == 0) && (ipv6addr_getdword(ipv6addrp, 3) == 0) ) {
-		/* unspecified address */
-			
-		DEBUGPRINT_NA(DEBUG_librfc1884, "unspecified address - fast conversion");
-		
-		snprintf(tempstring, sizeof(tempstring), "::");
-		retval = 0;
-	} else if ( (ipv6addr_getdword(ipv6addrp, 0) == 0) && (ipv6addr_getdword(ipv6addrp, 1) == 0) && (ipv6addr_getdword(ipv6addrp, 2) == 0) && (ipv6addr_getdword(ipv6addrp, 3) == 1) ) {
-		/* loopback address */
-			
-		DEBUGPRINT_NA(DEBUG_librfc1884, "loopback - fast conversion");
-		
-		snprintf(tempstring, sizeof(tempstring), "::1");
-		retval = 0;
+		*p++ = ':';
+		*p++ = ':';
+		p = librfc1884_append_hex16(p, w[5]);
+		*p++ = ':';
+		p = librfc1884_append_ipv4(p, ipv6addrp);
+	} else if ( (mask == 0xff) || ((mask == 0x7f) && (w[7] == 1)) ) {
+		/* unspecified or loopback address */
+		DEBUGPRINT_NA(DEBUG_librfc1884, "unspecified or loopback address - fast conversion");
+		*p++ = ':';
+		*p++ = ':';
+		if (mask == 0x7f) {
+			*p++ = '1';
+		};
+		*p = '\0';
 	} else {
 		/* normal address */
-
 		if ( ((ipv6addrp->typeinfo & IPV6_ADDR_IID_32_63_HAS_IPV4) != 0) && ((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_IID) == 0)) {
 			w_max = 5;
-		};
-			
-		DEBUGPRINT_NA(DEBUG_librfc1884, "normal address, detect '0' blocks now");
-
-		for ( i = 0; i <= w_max; i++ ) {
-			if ( ipv6addr_getword(ipv6addrp, (unsigned int) i) == 0 ) {
-				/* found a '0' */
-					
-				DEBUGPRINT_WA(DEBUG_librfc1884, "Found '0' in word '%d'", i);
-
-				if ( tstart == -1 ) {
-					/* possible starting '0' block */ 
-						
-					DEBUGPRINT_WA(DEBUG_librfc1884, "Found a possible '0' starting block at '%d'",  i);
-					
-					tstart = i;				
-				};
-			} else {
-				/* end of a '0' block */
-					
-				DEBUGPRINT_WA(DEBUG_librfc1884, "Found non '0' in word '%d'", i);
-
-				if ( tstart != -1 ) {
-					tend = i - 1;
-					if ( ( tend - tstart ) >= 1 ) {
-						/* ok, more than one 16-bit block with '0' */
-							
-						DEBUGPRINT_WA(DEBUG_librfc1884, "Found '0' blocks from '%d' to '%d' with length '%d'", tstart, tend, tend - tstart + 1);
-						
-						if ( zstart < 0 ) {
-							/* no other block before, init */
-							zstart = tstart;
-							zend = tend;
-						
-							DEBUGPRINT_WA(DEBUG_librfc1884, "First found '0' block from '%d' to '%d' with length '%d'",  zstart, zend, zend - zstart + 1);
-							
-						} else if ( ( zend - zstart ) < ( tend - tstart ) ) {
-							/* ok, bigger block found */
-							zstart = tstart;
-							zend = tend;
-							
-							DEBUGPRINT_WA(DEBUG_librfc1884, "Found bigger '0' block from '%d' to '%d' with length '%d'",  zstart, zend, zend - zstart + 1);
-							
-						} else {
-								
-							DEBUGPRINT_NA(DEBUG_librfc1884, "This '0' block is not bigger than the last one - skip");
-
-						};
-					};
-					tstart = -1;
-					tend = -1;
-				};
-			};
-		};
-		/* cleanup */
-		if ( tstart >= 0 ) {
-			tend = w_max;
-			/* trailing '0' block */
-			if ( ( tend - tstart ) > 0 ) {
-				/* ok, a block with 2 or more '0' */
-				if ( zstart < 0 ) {
-					/* no other block before, init */
-					zstart = tstart;
-					zend = tend;
-				} else if ( ( zend - zstart ) < ( tend - tstart ) ) {
-					/* ok, bigger block found */
-					zstart = tstart;
-					zend = tend;
-				};
-			};
+			mask &= 0x3f;
 		};
 
-		if ( zstart != -1 ) {
+		zblock = librfc1884_zero_block[mask];
+		if (zblock != 0) {
+			zstart = zblock >> 4;
+			zend = zstart + (zblock & 0xf) - 1;
 			DEBUGPRINT_WA(DEBUG_librfc1884, "biggest '0' block is from word '%d' to '%d'",  zstart, zend);
-		} else {
-			DEBUGPRINT_NA(DEBUG_librfc1884, "no '0' block found");
 		};
 
-		/* create string */
-		STRCLR(tempstring);
-
-		for ( i = 0; i <= w_max; i++ ) {
-			if ( i == zstart ) {
-				DEBUGPRINT_WA(DEBUG_librfc1884, "start of '0' at '%d'", i);
-				STRCAT(tempstring, ":");
-			} else if ( i == 0 ) {
-				snprintf(tempstring2, sizeof(tempstring2), "%x", (unsigned int) ipv6addr_getword(ipv6addrp, (unsigned int) i));
-				STRCAT(tempstring, tempstring2);
-			} else if ( ( i > zend ) || ( i < zstart ) ) {
-				snprintf(tempstring2, sizeof(tempstring2), "%x", (unsigned int) ipv6addr_getword(ipv6addrp, (unsigned int) i));
-				STRCAT(tempstring, ":");
-				STRCAT(tempstring, tempstring2);
-			} else if ( ( i == 7 ) && ( zend == i )) {
-				STRCAT(tempstring, ":");
+		for (i = 0; (int) i <= w_max; i++) {
+			if ((int) i == zstart) {
+				*p++ = ':';
+				if (zend == 7) {
+					*p++ = ':';
+				};
+				i = zend;
+				continue;
 			};
+			if (i > 0) {
+				*p++ = ':';
+			};
+			p = librfc1884_append_hex16(p, w[i]);
 		};
-		
-		if ( ((ipv6addrp->typeinfo & IPV6_ADDR_IID_32_63_HAS_IPV4) != 0) && ((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_IID) == 0)) {
+
+		if (w_max == 5) {
 			/* append IPv4 address */
-			snprintf(tempstring2, sizeof(tempstring2), ":%u.%u.%u.%u", \
-				(unsigned int) ipv6addrp->in6_addr.s6_addr[12], \
-				(unsigned int) ipv6addrp->in6_addr.s6_addr[13], \
-				(unsigned int) ipv6addrp->in6_addr.s6_addr[14], \
-				(unsigned int) ipv6addrp->in6_addr.s6_addr[15]  \
-			);
-			STRCAT(tempstring, tempstring2);
+			*p++ = ':';
+			p = librfc1884_append_ipv4(p, ipv6addrp);
+		} else {
+			*p = '\0';
 		};
+	};
 
-		DEBUGPRINT_WA(DEBUG_librfc1884, "new method: '%s'", tempstring);
+	return ((size_t) (p - resultstring));
+};
 
-		retval = 0;
+
+/*
+ * function IPv6addrstruct to compressed format (RFC 1884, RFC 5952)
+ *
+ * in : *ipv6addrp = IPv6 address structure
+ *      formatoptions
+ * out: *resultstring = result
+ * ret: ==0: ok, !=0: error
+ */
+int librfc1884_ipv6addrstruct_to_compaddr(const ipv6calc_ipv6addr *ipv6addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions) {
+	char tempstring[IPV6CALC_STRING_MAX] = "", tempstring2[IPV6CALC_STRING_MAX] = "";
+	char *cp = tempstring;
+	size_t len;
+	unsigned int s;
+
+	DEBUGPRINT_WA(DEBUG_librfc1884, "typeinfo of IPv6 address: %08x", (unsigned int) ipv6addrp->typeinfo);
+
+	/* write directly into result if possible */
+	if ((resultstring_length >= RFC1884_COMPADDR_STRING_MAX) && (ipv6addrp->flag_scopeid == 0) && ((formatoptions & FORMATOPTION_literal) == 0)) {
+		cp = resultstring;
 	};
 
-	if ( ( retval == 0 ) && ( ipv6addrp->flag_prefixuse == 1 ) && ((formatoptions & (FORMATOPTION_literal|FORMATOPTION_no_prefixlength)) == 0) ) {
+	len = librfc1884_compaddr_text(ipv6addrp, cp);
+
+	DEBUGPRINT_WA(DEBUG_librfc1884, "compressed address: '%s'", cp);
+
+	if (cp == resultstring) {
+		if ( ( ipv6addrp->flag_prefixuse == 1 ) && ((formatoptions & FORMATOPTION_no_prefixlength) == 0) ) {
+			resultstring[len++] = '/';
+			*librfc1884_append_dec(resultstring + len, (unsigned int) ipv6addrp->prefixlength) = '\0';
+		};
+	} else if ( ( ipv6addrp->flag_prefixuse == 1 ) && ((formatoptions & (FORMATOPTION_literal|FORMATOPTION_no_prefixlength)) == 0) ) {
 		snprintf(resultstring, resultstring_length, "%s/%u", tempstring, (unsigned int) ipv6addrp->prefixlength);
 	} else {
 		if ((formatoptions & FORMATOPTION_literal) != 0) {
 			/* replace : by - */
-			for (s = 0; s < strlen(tempstring); s++) {
+			for (s = 0; s < len; s++) {
 				if (tempstring[s] == ':') {
 					tempstring[s] = '-';
 				};
@@ -307,5 +356,44 @@ int librfc1884_ipv6addrstruct_to_compaddr(const ipv6calc_ipv6addr *ipv6addrp, ch
 	};
 
 	DEBUGPRINT_WA(DEBUG_librfc1884, "Result: '%s'", resultstring);
+	return (0);
+};
+
+
+/*
+ * function array of IPv6addrstruct to compressed format (RFC 1884, RFC 5952)
+ *
+ * in : *ipv6addrp = array of IPv6 address structures
+ *      count = amount of entries in array
+ *      formatoptions
+ * out: *resultstrings = result buffer, entry i starts at resultstrings + i * resultstring_length
+ * ret: ==0: ok, !=0: error
+ */
+int librfc1884_ipv6addrstruct_to_compaddr_batch(const ipv6calc_ipv6addr *ipv6addrp, const size_t count, char *resultstrings, const size_t resultstring_length, const uint32_t formatoptions) {
+	size_t i;
+	int retval = 0;
+
+	if ((formatoptions & (FORMATOPTION_literal | FORMATOPTION_printuppercase | FORMATOPTION_machinereadable)) == 0 && resultstring_length >= RFC1884_COMPADDR_STRING_MAX) {
+		/* fast path: plain lowercase text written directly into result buffer */
+		for (i = 0; i < count; i++) {
+			if (ipv6addrp[i].flag_scopeid != 0) {
+				retval |= librfc1884_ipv6addrstruct_to_compaddr(&ipv6addrp[i], resultstrings + i * resultstring_length, resultstring_length, formatoptions);
+				continue;
+			};
+
+			char *cp = resultstrings + i * resultstring_length;
+			size_t len = librfc1884_compaddr_text(&ipv6addrp[i], cp);
+
+			if ( ( ipv6addrp[i].flag_prefixuse == 1 ) && ((formatoptions & FORMATOPTION_no_prefixlength) == 0) ) {
+				cp[len++] = '/';
+				*librfc1884_append_dec(cp + len, (unsigned int) ipv6addrp[i].prefixlength) = '\0';
+			};
+		};
+	} else {
+		for (i = 0; i < count; i++) {
+			retval |= librfc1884_ipv6addrstruct_to_compaddr(&ipv6addrp[i], resultstrings + i * resultstring_length, resultstring_length, formatoptions);
+		};
+	};
+
 	return (retval);
 };
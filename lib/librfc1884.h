@@ -10,8 +10,12 @@
 
 #include "libipv6addr.h"
 
+/* max length of compressed address including embedded IPv4 address, prefix length and terminating NUL */
+#define RFC1884_COMPADDR_STRING_MAX	64
+
 /* prototypes */
 extern int compaddr_to_uncompaddr(const char *addrstring, char *resultstring, const size_t resultstring_length);
 
 extern int librfc1884_ipv6addrstruct_to_compaddr(const ipv6calc_ipv6addr *ipv6addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions);
+extern int librfc1884_ipv6addrstruct_to_compaddr_batch(const ipv6calc_ipv6addr *ipv6addrp, const size_t count, char *resultstrings, const size_t resultstring_length, const uint32_t formatoptions);
 extern int ipv6addrstruct_to_compaddr(const ipv6calc_ipv6addr *ipv6addr, char *resultstring, const size_t resultstring_length); /* going obsolete */
@@ -20,10 +20,15 @@
  *   ipv6calcActionCountrycode		on
  *   ipv6calcActionAsn			on
  *   ipv6calcActionRegistry		on
- *   ipv6calcCache			off (default: on)
+ *   ipv6calcCache			off (default: on, includes per-connection memo)
  *   ipv6calcCacheLimit			>= IPV6CALC_CACHE_LRI_LIMIT_MIN
  *   ipv6calcCacheStatisticsInterval	0:disable 
  *   ipv6calcDebuglevel			>0 (see defines below)
+ *   ipv6calcLazy			on (default: off, retrieve data only on demand by log format %{...}y)
+ *
+ *  runtime statistics (shared between children) by
+ *   SetHandler ipv6calc-status
+ *   or mod_status (section "mod_ipv6calc")
  *
  *  ipv6calc behavior can be controlled by config, e.g
  *   ipv6calcOption debug                   0x8
@@ -44,7 +49,15 @@
 #include <http_config.h>
 #include <http_log.h>
 #include <http_protocol.h>
+#include <http_connection.h>
+#include <ap_mpm.h>
 #include <apr_strings.h>
+#include <apr_optional.h>
+#include <apr_shm.h>
+#include <apr_atomic.h>
+#include <apr_thread_mutex.h>
+#include <mod_log_config.h>
+#include <mod_status.h>
 
 // ipv6calc related includes
 #undef PACKAGE_BUGREPORT
@@ -120,6 +133,7 @@ static const char *set_ipv6calc_cache(cmd_parms *cmd, void *dummy, int arg);
 static const char *set_ipv6calc_cache_limit(cmd_parms *cmd, void *dummy, const char *value);
 static const char *set_ipv6calc_cache_statistics_interval(cmd_parms *cmd, void *dummy, const char *value);
 static const char *set_ipv6calc_debuglevel(cmd_parms *cmd, void *dummy, const char *value);
+static const char *set_ipv6calc_lazy(cmd_parms *cmd, void *dummy, int arg);
 
 static const char *set_ipv6calc_action_anonymize(cmd_parms *cmd, void *dummy, int arg);
 static const char *set_ipv6calc_action_countrycode(cmd_parms *cmd, void *dummy, int arg);
@@ -148,12 +162,72 @@ static char     ipv6calc_cache_lri_value_asn[2][IPV6CALC_CACHE_LRI_SIZE][APRMAXH
 static char     ipv6calc_cache_lri_value_registry[2][IPV6CALC_CACHE_LRI_SIZE][APRMAXHOSTLEN];
 static char     ipv6calc_cache_lri_value_geonameid[2][IPV6CALC_CACHE_LRI_SIZE][APRMAXHOSTLEN];
 
+static unsigned int ipv6calc_cache_lri_generation = 0; // database reload generation of cache content
+
 static struct in_addr  ipv6calc_cache_lri_ipv4_token[IPV6CALC_CACHE_LRI_SIZE];
 #if APR_HAVE_IPV6
 static struct in6_addr ipv6calc_cache_lri_ipv6_token[IPV6CALC_CACHE_LRI_SIZE];
 #endif
 
 
+/***************************
+ * Connection memo (keep-alive/HTTP/2: requests of one connection share the client address)
+ *  HTTP/2 streams are processed on secondary connections in parallel, therefore the memo is
+ *  attached to the master connection (created in pre_connection) and protected by a mutex
+ *  requests of one connection can address different (name-based) virtual hosts, therefore
+ *  the memo is only valid for the server config of the request it was stored by
+ ***************************/
+#define IPV6CALC_CONN_MEMO_ENV_MAX	6
+
+static const char *ipv6calc_conn_memo_env[IPV6CALC_CONN_MEMO_ENV_MAX] = {
+	"IPV6CALC_CLIENT_IP_ANON",
+	"IPV6CALC_CLIENT_COUNTRYCODE",
+	"IPV6CALC_CLIENT_ASN",
+	"IPV6CALC_CLIENT_REGISTRY",
+	"IPV6CALC_CLIENT_GEONAMEID",
+	"IPV6CALC_ANON_METHOD",
+};
+
+typedef struct {
+#if APR_HAS_THREADS
+	apr_thread_mutex_t *mutex;
+#endif
+	int valid;
+	unsigned int generation; // database reload generation
+	const void *config; // server config of virtual host
+	char client_ip[APRMAXHOSTLEN];
+	char value[IPV6CALC_CONN_MEMO_ENV_MAX][APRMAXHOSTLEN];
+} ipv6calc_conn_memo;
+
+
+/***************************
+ * Runtime statistics (shared memory, updated atomically by all children)
+ ***************************/
+#define IPV6CALC_STATUS_HANDLER			"ipv6calc-status"
+#define IPV6CALC_STATUS_LATENCY_BUCKETS		16	// < 2^i usec, last one: above
+
+typedef struct {
+	apr_uint32_t requests;
+	apr_uint32_t conn_memo_hits;
+	apr_uint32_t cache_hits[2];
+	apr_uint32_t cache_misses[2];
+	apr_uint32_t lookups_cc[IPV6CALC_DB_SOURCE_MAX + 1]; // by data source, 0: unknown
+	apr_uint32_t lookups_asn;
+	apr_uint32_t lookups_registry;
+	apr_uint32_t lookups_geonameid;
+	apr_uint32_t latency_request[IPV6CALC_STATUS_LATENCY_BUCKETS];
+	apr_uint32_t latency_lookup[IPV6CALC_STATUS_LATENCY_BUCKETS];
+} ipv6calc_status;
+
+static apr_shm_t      *ipv6calc_status_shm = NULL;
+static ipv6calc_status *ipv6calc_status_data = NULL;
+
+#define IPV6CALC_STATUS_INC(field) \
+	if (ipv6calc_status_data != NULL) { \
+		apr_atomic_inc32(&ipv6calc_status_data->field); \
+	};
+
+
 /***************************
  * Static values
  ***************************/
@@ -184,6 +258,8 @@ typedef struct {
 
 	uint32_t debuglevel;
 
+	int lazy;
+
 	int action_anonymize;
 	int action_countrycode;
 	int action_asn;
@@ -222,6 +298,7 @@ static const command_rec ipv6calc_cmds[] = {
 	AP_INIT_TAKE1("ipv6calcCacheLimit", set_ipv6calc_cache_limit, NULL, OR_FILEINFO, "mod_ipv6calc cache limit: <value>"),
 	AP_INIT_TAKE1("ipv6calcCacheStatisticsInterval", set_ipv6calc_cache_statistics_interval, NULL, OR_FILEINFO, "mod_ipv6calc cache statistics interval: <value> (0=disabled)"),
 	AP_INIT_TAKE1("ipv6calcDebuglevel", set_ipv6calc_debuglevel, NULL, OR_FILEINFO, "Debug level of module (binary or'ed): <value>"),
+	AP_INIT_FLAG("ipv6calcLazy", set_ipv6calc_lazy, NULL, OR_FILEINFO, "Retrieve data only on demand by log format %{anon|cc|asn|registry|geonameid|method|ip}y"),
 	AP_INIT_FLAG("ipv6calcActionAnonymize", set_ipv6calc_action_anonymize, NULL, OR_FILEINFO, "Store anonymized IP address in IPV6CALC_CLIENT_IP_ANON"),
 	AP_INIT_FLAG("ipv6calcActionCountrycode", set_ipv6calc_action_countrycode, NULL, OR_FILEINFO, "Store Country Code of IP address in IPV6CALC_CLIENT_COUNTRYCODE"),
 	AP_INIT_FLAG("ipv6calcActionAsn", set_ipv6calc_action_asn, NULL, OR_FILEINFO, "Store ASN of IP address in IPV6CALC_CLIENT_ASN"),
@@ -354,7 +431,6 @@ static int ipv6calc_support_init(server_rec *s) {
  * ipv6calc_post_config
  */
 static int ipv6calc_post_config(apr_pool_t *pconf, apr_pool_t *plog, apr_pool_t *ptemp, server_rec *s) {
-	UNUSED(pconf);
 	UNUSED(plog);
 	UNUSED(ptemp);
 
@@ -444,6 +520,11 @@ static int ipv6calc_post_config(apr_pool_t *pconf, apr_pool_t *plog, apr_pool_t
 		, config->debuglevel
 	);
 
+	ap_log_error(APLOG_MARK, APLOG_NOTICE, 0, s
+		, "module data retrieval: %s"
+		, (config->lazy == 1) ? "lazy by log format %{...}y (configured)" : "every request (default)"
+	);
+
 	if (config->cache == 0) {
 		ap_log_error(APLOG_MARK, APLOG_NOTICE, 0, s
 			, "module cache: OFF (configured)"
@@ -464,6 +545,25 @@ static int ipv6calc_post_config(apr_pool_t *pconf, apr_pool_t *plog, apr_pool_t
 		return(1);
 	};
 
+	// database reload swaps handles without locking, only supported with single-threaded children
+	if (wrapper_reload_interval > 0) {
+		int threads_max = 1;
+
+		ap_mpm_query(AP_MPMQ_MAX_THREADS, &threads_max);
+
+		if ((threads_max > 1) || (ap_find_linked_module("mod_http2.c") != NULL)) {
+			ap_log_error(APLOG_MARK, APLOG_WARNING, 0, s
+				, "database reload NOT supported with threaded MPM or mod_http2, disabled (graceful restart required after database update)"
+			);
+			wrapper_reload_interval = 0;
+		} else {
+			ap_log_error(APLOG_MARK, APLOG_NOTICE, 0, s
+				, "database reload: check interval=%d seconds (configured)"
+				, wrapper_reload_interval
+			);
+		};
+	};
+
 	string[0] = '\0';
 	libipv6calc_db_wrapper_features(string, sizeof(string));
 	ap_log_error(APLOG_MARK, APLOG_NOTICE, 0, s
@@ -537,6 +637,18 @@ static int ipv6calc_post_config(apr_pool_t *pconf, apr_pool_t *plog, apr_pool_t
 
 	anon_method_name = libipv6calc_anon_method_name(&config->ipv6calc_anon_set);
 
+	// runtime statistics in anonymous shared memory (inherited by children)
+	apr_status_t status = apr_shm_create(&ipv6calc_status_shm, sizeof(ipv6calc_status), NULL, pconf);
+	if (status == APR_SUCCESS) {
+		ipv6calc_status_data = (ipv6calc_status *) apr_shm_baseaddr_get(ipv6calc_status_shm);
+		memset(ipv6calc_status_data, 0, sizeof(ipv6calc_status));
+	} else {
+		ap_log_error(APLOG_MARK, APLOG_WARNING, status, s
+			, "can't create shared memory for runtime statistics, use per child statistics"
+		);
+		ipv6calc_status_data = (ipv6calc_status *) apr_pcalloc(pconf, sizeof(ipv6calc_status));
+	};
+
 	return(0);
 };
 
@@ -569,9 +681,163 @@ static void ipv6calc_child_init(apr_pool_t *p, server_rec *s) {
 
 
 /*
- * ipv6calc_post_read_request  (ACTION CODE)
+ * ipv6calc_conn_master
+ *  return master connection (HTTP/2 streams run on secondary connections)
  */
-static int ipv6calc_post_read_request(request_rec *r) {
+static conn_rec *ipv6calc_conn_master(conn_rec *c) {
+#if AP_MODULE_MAGIC_AT_LEAST(20120211, 52)
+	if (c->master != NULL) {
+		return(c->master);
+	};
+#endif
+	return(c);
+};
+
+
+/*
+ * ipv6calc_pre_connection
+ *  create connection memo on master connection (before any request/stream is processed)
+ */
+static int ipv6calc_pre_connection(conn_rec *c, void *csd) {
+	UNUSED(csd);
+
+	ipv6calc_server_config *config = (ipv6calc_server_config*) ap_get_module_config(c->base_server->module_config, &ipv6calc_module);
+	ipv6calc_conn_memo *memo;
+
+	if ((config->enabled == 0) || (config->cache != 1) || (ipv6calc_conn_master(c) != c)) {
+		return OK;
+	};
+
+	memo = apr_pcalloc(c->pool, sizeof(ipv6calc_conn_memo));
+
+#if APR_HAS_THREADS
+	if (apr_thread_mutex_create(&memo->mutex, APR_THREAD_MUTEX_DEFAULT, c->pool) != APR_SUCCESS) {
+		ap_log_cerror(APLOG_MARK, APLOG_WARNING, 0, c, "can't create mutex for connection memo, memo disabled");
+		return OK;
+	};
+#endif
+
+	ap_set_module_config(c->conn_config, &ipv6calc_module, memo);
+
+	return OK;
+};
+
+
+/*
+ * ipv6calc_conn_memo_get
+ *  return connection memo of master connection (NULL: not available), locked on success
+ */
+static ipv6calc_conn_memo *ipv6calc_conn_memo_get(conn_rec *c) {
+	ipv6calc_conn_memo *memo = (ipv6calc_conn_memo*) ap_get_module_config(ipv6calc_conn_master(c)->conn_config, &ipv6calc_module);
+
+#if APR_HAS_THREADS
+	if ((memo != NULL) && (apr_thread_mutex_lock(memo->mutex) != APR_SUCCESS)) {
+		return(NULL);
+	};
+#endif
+
+	return(memo);
+};
+
+
+/*
+ * ipv6calc_conn_memo_release
+ *  unlock connection memo
+ */
+static void ipv6calc_conn_memo_release(ipv6calc_conn_memo *memo) {
+#if APR_HAS_THREADS
+	apr_thread_mutex_unlock(memo->mutex);
+#else
+	UNUSED(memo);
+#endif
+};
+
+
+/*
+ * ipv6calc_conn_memo_store
+ *  store retrieved values from environment of request in connection memo
+ */
+static void ipv6calc_conn_memo_store(request_rec *r, const char *client_ip) {
+	ipv6calc_conn_memo *memo = ipv6calc_conn_memo_get(r->connection);
+	const char *value;
+	int i;
+
+	if (memo == NULL) {
+		return;
+	};
+
+	for (i = 0; i < IPV6CALC_CONN_MEMO_ENV_MAX; i++) {
+		value = apr_table_get(r->subprocess_env, ipv6calc_conn_memo_env[i]);
+		snprintf(memo->value[i], sizeof(memo->value[i]), "%s", (value != NULL) ? value : ""); // empty: not set
+	};
+
+	snprintf(memo->client_ip, sizeof(memo->client_ip), "%s", client_ip);
+	memo->generation = LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION();
+	memo->config = ap_get_module_config(r->server->module_config, &ipv6calc_module);
+	memo->valid = 1;
+
+	ipv6calc_conn_memo_release(memo);
+};
+
+
+/*
+ * ipv6calc_conn_memo_lookup
+ *  set environment of request from connection memo in case of same client address
+ * ret: 1 = found, 0 = not found (memo invalidated on different client address or virtual host)
+ */
+static int ipv6calc_conn_memo_lookup(request_rec *r, const char *client_ip) {
+	ipv6calc_conn_memo *memo = ipv6calc_conn_memo_get(r->connection);
+	int i, result = 0;
+
+	if (memo == NULL) {
+		return(0);
+	};
+
+	if (memo->valid == 0) {
+		goto END_ipv6calc_conn_memo_lookup;
+	};
+
+	if ((strcmp(memo->client_ip, client_ip) != 0) || (memo->generation != LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION()) || (memo->config != ap_get_module_config(r->server->module_config, &ipv6calc_module))) {
+		memo->valid = 0;
+		goto END_ipv6calc_conn_memo_lookup;
+	};
+
+	for (i = 0; i < IPV6CALC_CONN_MEMO_ENV_MAX; i++) {
+		if (memo->value[i][0] != '\0') {
+			apr_table_set(r->subprocess_env, ipv6calc_conn_memo_env[i], memo->value[i]);
+		};
+	};
+
+	result = 1;
+
+END_ipv6calc_conn_memo_lookup:
+	ipv6calc_conn_memo_release(memo);
+	return(result);
+};
+
+
+/*
+ * ipv6calc_status_latency_bucket
+ * in : usec = latency in microseconds
+ * ret: histogram bucket
+ */
+static int ipv6calc_status_latency_bucket(apr_interval_time_t usec) {
+	int i;
+
+	for (i = 0; i < IPV6CALC_STATUS_LATENCY_BUCKETS - 1; i++) {
+		if (usec < (((apr_interval_time_t) 1) << i)) {
+			break;
+		};
+	};
+
+	return(i);
+};
+
+
+/*
+ * ipv6calc_retrieve_data  (ACTION CODE)
+ */
+static int ipv6calc_retrieve_data(request_rec *r) {
 	int i, hit;
 	int pi; // proto index (0:IPv4, 1:IPv6
 	int p_mapped; // proto mapped (IPv6 in IPv4)
@@ -601,6 +867,7 @@ static int ipv6calc_post_read_request(request_rec *r) {
 	const char *source_env_content;
 	const char *client_ip;
 	unsigned int data_source;
+	unsigned int generation;
 
 	int result;
 
@@ -696,6 +963,20 @@ static int ipv6calc_post_read_request(request_rec *r) {
 
 	apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_IP", client_ip);
 
+	/* connection memo lookup */
+	if (config->cache == 1) {
+		if (ipv6calc_conn_memo_lookup(r, client_ip) == 1) {
+			IPV6CALC_STATUS_INC(conn_memo_hits)
+			if (config->debuglevel & IPV6CALC_DEBUG_CACHE_LOOKUP) {
+				ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
+					, "retrieve data of client IP address from connection memo: %s"
+					, client_ip
+				);
+			};
+			return OK;
+		};
+	};
+
 	// convert address into ipv6calc structure
 	libipaddr_clearall(&ipaddr);
 
@@ -729,6 +1010,17 @@ static int ipv6calc_post_read_request(request_rec *r) {
 	if (config->cache == 1) {
 		hit = -1;
 
+		generation = LIBIPV6CALC_DB_WRAPPER_RELOAD_GENERATION();
+		if (ipv6calc_cache_lri_generation != generation) {
+			// database reloaded, flush cache
+			ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r, "database reloaded, flush cache");
+			ipv6calc_cache_lri_max[mod_ipv6calc_pi_IPV4] = 0;
+			ipv6calc_cache_lri_max[mod_ipv6calc_pi_IPV6] = 0;
+			ipv6calc_cache_lri_last[mod_ipv6calc_pi_IPV4] = 0;
+			ipv6calc_cache_lri_last[mod_ipv6calc_pi_IPV6] = 0;
+			ipv6calc_cache_lri_generation = generation;
+		};
+
 #if APR_HAVE_IPV6
 #define IPV6CALC_COMPARE(entry) \
 			     (    pi == mod_ipv6calc_pi_IPV4 \
@@ -843,6 +1135,8 @@ static int ipv6calc_post_read_request(request_rec *r) {
 			};
 
 			if (hit >= 0) {
+				IPV6CALC_STATUS_INC(cache_hits[pi])
+
 				ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
 					, "retrieve data of IPv%s address from cache position: %d"
 					, (pi == 0) ? "4" : "6"
@@ -911,6 +1205,7 @@ static int ipv6calc_post_read_request(request_rec *r) {
 					apr_table_set(r->subprocess_env, "IPV6CALC_ANON_METHOD", anon_method_name);
 				};
 
+				ipv6calc_conn_memo_store(r, client_ip);
 				return OK;
 			};
 
@@ -933,6 +1228,10 @@ static int ipv6calc_post_read_request(request_rec *r) {
 	};
 
 	/* post cache lookup */
+	if (config->cache == 1) {
+		IPV6CALC_STATUS_INC(cache_misses[pi])
+	};
+
 	if (pi == mod_ipv6calc_pi_IPV4) {
 		// IPv4
 		ipv4addr_clearall(&ipv4addr);
@@ -1000,6 +1299,7 @@ static int ipv6calc_post_read_request(request_rec *r) {
 	const char *data_source_string = "-";
 	uint32_t asn_num = 0;
 	uint32_t result_geonameid = 0;
+	apr_time_t time_lookup = apr_time_now();
 
 	if (	(config->action_countrycode == 1)
 	     ||	(config->action_asn == 1)
@@ -1056,6 +1356,7 @@ static int ipv6calc_post_read_request(request_rec *r) {
 		if (config->action_countrycode == 1) {
 			if (retrieve_cc != 0) {
 				result_cc = libipv6calc_db_wrapper_country_code_by_addr(cc, sizeof(cc), &ipaddr, &data_source);
+				IPV6CALC_STATUS_INC(lookups_cc[((result_cc == 0) && (data_source <= IPV6CALC_DB_SOURCE_MAX)) ? data_source : IPV6CALC_DB_SOURCE_UNKNOWN])
 
 				if ((result_cc == 0) && (strlen(cc) > 0)) {
 					data_source_string = libipv6calc_db_wrapper_get_data_source_name_by_number(data_source);
@@ -1093,6 +1394,7 @@ static int ipv6calc_post_read_request(request_rec *r) {
 		if (config->action_asn == 1) {
 			if (retrieve_asn != 0) {
 				asn_num = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, NULL, NULL, 0);
+				IPV6CALC_STATUS_INC(lookups_asn)
 
 				snprintf(asn, sizeof(asn), "%u", asn_num);
 
@@ -1125,6 +1427,7 @@ static int ipv6calc_post_read_request(request_rec *r) {
 		if (config->action_registry == 1) {
 			if (retrieve_registry != 0) {
 				result_registry = libipv6calc_db_wrapper_registry_string_by_ipaddr(&ipaddr, registry, sizeof(registry));
+				IPV6CALC_STATUS_INC(lookups_registry)
 
 				if (((result_registry == 0) || (result_registry == 2)) && (strlen(registry) > 0)) {
 					// everything ok
@@ -1161,6 +1464,7 @@ static int ipv6calc_post_read_request(request_rec *r) {
 		if (config->action_geonameid == 1) {
 			if (retrieve_geonameid != 0) {
 				result_geonameid = libipv6calc_db_wrapper_GeonameID_by_addr(&ipaddr, NULL, NULL);
+				IPV6CALC_STATUS_INC(lookups_geonameid)
 
 				if (result_registry == IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
 					snprintf(geonameid, sizeof(geonameid), "%u", result_geonameid);
@@ -1194,6 +1498,8 @@ static int ipv6calc_post_read_request(request_rec *r) {
 		};
 	};
 
+	IPV6CALC_STATUS_INC(latency_lookup[ipv6calc_status_latency_bucket(apr_time_now() - time_lookup)])
+
 	// set special value if not enabled
 	if (config->action_countrycode == 0) {
 		apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_COUNTRYCODE", "disabled"); 
@@ -1270,10 +1576,207 @@ static int ipv6calc_post_read_request(request_rec *r) {
 		apr_table_set(r->subprocess_env, "IPV6CALC_ANON_METHOD", "disabled");
 	};
 
+	if (config->cache == 1) {
+		ipv6calc_conn_memo_store(r, client_ip);
+	};
+
+	return OK;
+};
+
+
+/*
+ * ipv6calc_retrieve
+ *  retrieve data and update runtime statistics
+ */
+static int ipv6calc_retrieve(request_rec *r) {
+	apr_time_t time_start = apr_time_now();
+	int result;
+
+	result = ipv6calc_retrieve_data(r);
+
+	IPV6CALC_STATUS_INC(requests)
+	IPV6CALC_STATUS_INC(latency_request[ipv6calc_status_latency_bucket(apr_time_now() - time_start)])
+
+	return(result);
+};
+
+
+/***************************
+ * Runtime statistics output
+ ***************************/
+
+/*
+ * ipv6calc_status_print
+ * in : r = request, prefix = key prefix, html = 1: HTML (mod_status), 0: text
+ */
+static void ipv6calc_status_print(request_rec *r, const char *prefix, int html) {
+	ipv6calc_status *st = ipv6calc_status_data;
+	int i, pi;
+
+	if (html == 1) {
+		ap_rputs("<hr />\n<h2>mod_ipv6calc</h2>\n<pre>\n", r);
+	};
+
+	if (st == NULL) {
+		ap_rprintf(r, "%sStatus: not enabled\n", prefix);
+		goto END_ipv6calc_status_print;
+	};
+
+	ap_rprintf(r, "%sRequests: %u\n", prefix, apr_atomic_read32(&st->requests));
+	ap_rprintf(r, "%sConnectionMemoHits: %u\n", prefix, apr_atomic_read32(&st->conn_memo_hits));
+
+	for (pi = mod_ipv6calc_pi_IPV4; pi <= mod_ipv6calc_pi_IPV6; pi++) {
+		ap_rprintf(r, "%sCacheHits/IPv%s: %u\n", prefix, (pi == mod_ipv6calc_pi_IPV4) ? "4" : "6", apr_atomic_read32(&st->cache_hits[pi]));
+		ap_rprintf(r, "%sCacheMisses/IPv%s: %u\n", prefix, (pi == mod_ipv6calc_pi_IPV4) ? "4" : "6", apr_atomic_read32(&st->cache_misses[pi]));
+	};
+
+	for (i = 0; i <= IPV6CALC_DB_SOURCE_MAX; i++) {
+		if ((i != IPV6CALC_DB_SOURCE_UNKNOWN) && (apr_atomic_read32(&st->lookups_cc[i]) == 0)) {
+			continue;
+		};
+		ap_rprintf(r, "%sLookups/CountryCode/%s: %u\n", prefix, (i == IPV6CALC_DB_SOURCE_UNKNOWN) ? "unknown" : libipv6calc_db_wrapper_get_data_source_name_by_number(i), apr_atomic_read32(&st->lookups_cc[i]));
+	};
+
+	ap_rprintf(r, "%sLookups/ASN: %u\n", prefix, apr_atomic_read32(&st->lookups_asn));
+	ap_rprintf(r, "%sLookups/Registry: %u\n", prefix, apr_atomic_read32(&st->lookups_registry));
+	ap_rprintf(r, "%sLookups/GeonameID: %u\n", prefix, apr_atomic_read32(&st->lookups_geonameid));
+
+	for (i = 0; i < IPV6CALC_STATUS_LATENCY_BUCKETS; i++) {
+		if (i < IPV6CALC_STATUS_LATENCY_BUCKETS - 1) {
+			ap_rprintf(r, "%sLatencyRequest/<%luus: %u\n", prefix, 1UL << i, apr_atomic_read32(&st->latency_request[i]));
+		} else {
+			ap_rprintf(r, "%sLatencyRequest/>=%luus: %u\n", prefix, 1UL << (i - 1), apr_atomic_read32(&st->latency_request[i]));
+		};
+	};
+
+	for (i = 0; i < IPV6CALC_STATUS_LATENCY_BUCKETS; i++) {
+		if (i < IPV6CALC_STATUS_LATENCY_BUCKETS - 1) {
+			ap_rprintf(r, "%sLatencyLookup/<%luus: %u\n", prefix, 1UL << i, apr_atomic_read32(&st->latency_lookup[i]));
+		} else {
+			ap_rprintf(r, "%sLatencyLookup/>=%luus: %u\n", prefix, 1UL << (i - 1), apr_atomic_read32(&st->latency_lookup[i]));
+		};
+	};
+
+END_ipv6calc_status_print:
+	if (html == 1) {
+		ap_rputs("</pre>\n", r);
+	};
+	return;
+};
+
+
+/*
+ * ipv6calc_status_handler  (SetHandler ipv6calc-status)
+ */
+static int ipv6calc_status_handler(request_rec *r) {
+	if ((r->handler == NULL) || (strcmp(r->handler, IPV6CALC_STATUS_HANDLER) != 0)) {
+		return DECLINED;
+	};
+
+	ap_set_content_type(r, "text/plain; charset=ISO-8859-1");
+
+	if (r->header_only) {
+		return OK;
+	};
+
+	ipv6calc_status_print(r, "", 0);
+
+	return OK;
+};
+
+
+/*
+ * ipv6calc_status_hook  (mod_status)
+ */
+static int ipv6calc_status_hook(request_rec *r, int flags) {
+	if (flags & AP_STATUS_SHORT) {
+		ipv6calc_status_print(r, "ipv6calc", 0);
+	} else {
+		ipv6calc_status_print(r, "", 1);
+	};
+
 	return OK;
 };
 
 
+/*
+ * ipv6calc_post_read_request  (fixups hook)
+ *  retrieve data for every request unless 'ipv6calcLazy on' defers it to the log format handler
+ */
+static int ipv6calc_post_read_request(request_rec *r) {
+	ipv6calc_server_config *config = (ipv6calc_server_config*) ap_get_module_config(r->server->module_config, &ipv6calc_module);
+
+	if ((config->enabled == 1) && (config->lazy == 1)) {
+		return OK;
+	};
+
+	return ipv6calc_retrieve(r);
+};
+
+
+/***************************
+ * Log format handler (mod_log_config)
+ ***************************/
+#define IPV6CALC_NOTE_RETRIEVED	"ipv6calc-retrieved"
+
+static const struct {
+	const char *token;
+	const char *env;
+} ipv6calc_log_format_map[] = {
+	{ "anon"     , "IPV6CALC_CLIENT_IP_ANON"     },
+	{ "cc"       , "IPV6CALC_CLIENT_COUNTRYCODE" },
+	{ "asn"      , "IPV6CALC_CLIENT_ASN"         },
+	{ "registry" , "IPV6CALC_CLIENT_REGISTRY"    },
+	{ "geonameid", "IPV6CALC_CLIENT_GEONAMEID"   },
+	{ "method"   , "IPV6CALC_ANON_METHOD"        },
+	{ "ip"       , "IPV6CALC_CLIENT_IP"          },
+};
+
+/*
+ * ipv6calc_log_format  (%{<token>}y)
+ *  retrieve data on first use per request (memo in r->notes), afterwards return stored value
+ * in : r = request, a = token
+ * ret: value or "-"
+ */
+static const char *ipv6calc_log_format(request_rec *r, char *a) {
+	const char *env = NULL;
+	const char *value;
+	ipv6calc_server_config *config;
+	unsigned int i;
+
+	if (a == NULL) {
+		return "-";
+	};
+
+	for (i = 0; i < (sizeof(ipv6calc_log_format_map) / sizeof(ipv6calc_log_format_map[0])); i++) {
+		if (strcasecmp(a, ipv6calc_log_format_map[i].token) == 0) {
+			env = ipv6calc_log_format_map[i].env;
+			break;
+		};
+	};
+
+	if (env == NULL) {
+		return "-";
+	};
+
+	config = (ipv6calc_server_config*) ap_get_module_config(r->server->module_config, &ipv6calc_module);
+
+	if (config->enabled == 0) {
+		return "-";
+	};
+
+	if ((config->lazy == 1) && (apr_table_get(r->notes, IPV6CALC_NOTE_RETRIEVED) == NULL)) {
+		// retrieve all enabled actions once per request, result is stored in subprocess_env
+		apr_table_setn(r->notes, IPV6CALC_NOTE_RETRIEVED, "1");
+		ipv6calc_retrieve(r);
+	};
+
+	value = apr_table_get(r->subprocess_env, env);
+
+	return (value != NULL) ? value : "-";
+};
+
+
 /***************************
  * Module config option handlers
  ***************************/
@@ -1609,6 +2112,24 @@ static const char *set_ipv6calc_option(cmd_parms *cmd, void *dummy, const char *
 };
 
 
+/*
+ * set_ipv6calc_lazy
+ */
+static const char *set_ipv6calc_lazy(cmd_parms *cmd, void *dummy, int arg) {
+	UNUSED(dummy);
+
+	ipv6calc_server_config *config = (ipv6calc_server_config*) ap_get_module_config(cmd->server->module_config, &ipv6calc_module);
+
+	if (!config) {
+		return NULL;
+	};
+
+	config->lazy = arg;
+
+	return NULL;
+};
+
+
 /*
  * ipv6calc_create_svr_conf
  */
@@ -1633,6 +2154,8 @@ static void *ipv6calc_create_svr_conf(apr_pool_t* pool, server_rec* svr) {
 
 	svr_cfg->debuglevel = 0;
 
+	svr_cfg->lazy = 0; // default: off
+
 	svr_cfg->action_anonymize = 0;
 	svr_cfg->action_countrycode = 0;
 	svr_cfg->action_asn = 0;
@@ -1646,15 +2169,41 @@ static void *ipv6calc_create_svr_conf(apr_pool_t* pool, server_rec* svr) {
 }
 
 
+/*
+ * ipv6calc_pre_config
+ *  register log format handler %{...}y in mod_log_config (if loaded)
+ */
+static int ipv6calc_pre_config(apr_pool_t *pconf, apr_pool_t *plog, apr_pool_t *ptemp) {
+	UNUSED(plog);
+	UNUSED(ptemp);
+
+	APR_OPTIONAL_FN_TYPE(ap_register_log_handler) *log_pfn_register;
+
+	log_pfn_register = APR_RETRIEVE_OPTIONAL_FN(ap_register_log_handler);
+
+	if (log_pfn_register) {
+		log_pfn_register(pconf, "y", ipv6calc_log_format, 0);
+	};
+
+	return OK;
+};
+
+
 /*
  * ipv6calc_register_hooks
  */
 static void ipv6calc_register_hooks(apr_pool_t *p) {
 	UNUSED(p);
 
+	static const char * const pre_log_config[] = { "mod_log_config.c", NULL };
+
+	ap_hook_pre_config(ipv6calc_pre_config, NULL, pre_log_config, APR_HOOK_MIDDLE);
 	ap_hook_post_config(ipv6calc_post_config, NULL, NULL, APR_HOOK_MIDDLE);
 	ap_hook_child_init(ipv6calc_child_init, NULL, NULL, APR_HOOK_MIDDLE);
+	ap_hook_pre_connection(ipv6calc_pre_connection, NULL, NULL, APR_HOOK_MIDDLE);
 	ap_hook_fixups(ipv6calc_post_read_request, NULL, NULL, APR_HOOK_MIDDLE);
+	ap_hook_handler(ipv6calc_status_handler, NULL, NULL, APR_HOOK_MIDDLE);
+	APR_OPTIONAL_HOOK(ap, status_hook, ipv6calc_status_hook, NULL, NULL, APR_HOOK_MIDDLE);
 };
 
 
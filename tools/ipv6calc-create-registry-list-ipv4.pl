@@ -159,6 +159,23 @@ sub dec_to_ipv4 {
 	return ($ipv4);
 };
 
+# string pool (deduplicated, entries referenced by offset)
+my %string_pool;
+my @string_pool_list;
+my $string_pool_length = 0;
+
+sub string_pool_add {
+	my $string = shift;
+
+	if (! defined $string_pool{$string}) {
+		$string_pool{$string} = $string_pool_length;
+		push @string_pool_list, $string;
+		$string_pool_length += length($string) + 1;
+	};
+
+	return ($string_pool{$string});
+};
+
 
 # find start of ipv4 in %assignments_iana
 sub find_start_iana {
@@ -559,7 +576,7 @@ static const s_ipv4addr_assignment dbipv4addr_assignment_iana[] = {
 static const s_ipv4addr_info dbipv4addr_info[] = {
 |;
 
-	printf $OUT "\t//first     , last      , registry  \n";
+	printf $OUT "\t//first     , last      , info offset\n";
 
 	foreach my $ipv4 (sort { $a <=> $b } keys %assignments_info) {
 		next if (! defined $assignments_info{$ipv4}->{'info'});
@@ -567,11 +584,22 @@ static const s_ipv4addr_info dbipv4addr_info[] = {
 		my $distance = $assignments_info{$ipv4}->{'distance'};
 		my $info = $assignments_info{$ipv4}->{'info'};
 
-		printf $OUT "\t{ 0x%08x, 0x%08x, %-30s }, // %-15s - %s\n", $ipv4, ($ipv4 + $distance - 1), "\"" . $info . "\"", &dec_to_ipv4($ipv4), &dec_to_ipv4($ipv4 + $distance - 1);
+		printf $OUT "\t{ 0x%08x, 0x%08x, %6d }, // %-15s - %-15s %s\n", $ipv4, ($ipv4 + $distance - 1), &string_pool_add($info), &dec_to_ipv4($ipv4), &dec_to_ipv4($ipv4 + $distance - 1), $info;
 	};
 
 	print $OUT "};\n";
 
+	## INFO string pool
+	print $OUT qq|
+static const char dbipv4addr_info_strings[] =
+|;
+
+	foreach my $string (@string_pool_list) {
+		print $OUT "\t\"" . $string . "\\0\"\n";
+	};
+
+	print $OUT "\t\"\";\n";
+
 
 	## END
 	print "INFO  : finished creation of header file: " . $file_dst_h . "\n";
@@ -460,6 +460,24 @@ my %data;
 my %data_cc;
 my %data_info;
 
+# string pool (deduplicated, entries referenced by offset)
+my %string_pool;
+my @string_pool_list;
+my $string_pool_length = 0;
+
+sub string_pool_add {
+	my $string = shift;
+
+	if (! defined $string_pool{$string}) {
+		$string_pool{$string} = $string_pool_length;
+		push @string_pool_list, $string;
+		$string_pool_length += length($string) + 1;
+	};
+
+	return ($string_pool{$string});
+};
+
+
 sub fill_data {
 	my $parray = shift || die "missing array pointer";
 	my $reg = shift || die "missing registry";
@@ -580,13 +598,24 @@ static const s_ipv6addr_assignment dbipv6addr_assignment[] = {
 	print $OUT qq|
 static const s_ipv6addr_info dbipv6addr_info[] = {
 |;
-	printf $OUT "\t//%-10s, %-10s, %-10s, %-10s, %-s, %-10s\n", "ipv6_00_31", "ipv6_32_63", "mask_00_31", "mask_32_63", "mask_length", "info";
+	printf $OUT "\t//%-10s, %-10s, %-10s, %-10s, %-s, %-10s\n", "ipv6_00_31", "ipv6_32_63", "mask_00_31", "mask_32_63", "mask_length", "info offset";
 
 	foreach my $ipv6 (sort keys %data_info) {
-		printf $OUT "\t{ 0x%s, 0x%s, 0x%s, 0x%s, %3d, \"%s\" },\n", $data_info{$ipv6}->{'ipv6_00_31'}, $data_info{$ipv6}->{'ipv6_32_63'}, $data_info{$ipv6}->{'mask_00_31'}, $data_info{$ipv6}->{'mask_32_63'}, $data_info{$ipv6}->{'mask_length'}, $data_info{$ipv6}->{'reg'};
+		printf $OUT "\t{ 0x%s, 0x%s, 0x%s, 0x%s, %3d, %6d }, // %s\n", $data_info{$ipv6}->{'ipv6_00_31'}, $data_info{$ipv6}->{'ipv6_32_63'}, $data_info{$ipv6}->{'mask_00_31'}, $data_info{$ipv6}->{'mask_32_63'}, $data_info{$ipv6}->{'mask_length'}, &string_pool_add($data_info{$ipv6}->{'reg'}), $data_info{$ipv6}->{'reg'};
 	};
 
 	print $OUT "};\n";
+
+	# data-info string pool
+	print $OUT qq|
+static const char dbipv6addr_info_strings[] =
+|;
+
+	foreach my $string (@string_pool_list) {
+		print $OUT "\t\"" . $string . "\\0\"\n";
+	};
+
+	print $OUT "\t\"\";\n";
 	close($OUT);
 
 	print "INFO  : header file created from input: " . $file_dst_h . "\n";